@@ -20,6 +20,7 @@ defaultConfig = {
 	'NP2_ENABLE_HIDPI_IMAGE_RESOURCE': 1,
 
 	'NP2_ENABLE_DOT_LOG_FEATURE': 0,
+	'NP2_ENABLE_ENCODING_BENCHMARK': 0,
 
 	'NP2_ENABLE_APP_LOCALIZATION_DLL': 1,
 	'NP2_ENABLE_TEST_LOCALIZATION_LAYOUT': 0,
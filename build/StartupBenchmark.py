@@ -0,0 +1,90 @@
+import sys
+import os.path
+import json
+import statistics
+import subprocess
+
+# run Notepad4 with /perf-startup several times, then compare median time of each phase with a baseline.
+# Usage: StartupBenchmark.py <Notepad4.exe> [count] [file] [--baseline baseline.json] [--save baseline.json]
+logPath = os.path.join(os.environ.get('TEMP', '.'), 'Notepad4-startup.log')
+regressionThreshold = 1.10
+
+def read_log():
+	result = []
+	if os.path.isfile(logPath):
+		with open(logPath, encoding='utf-8') as fd:
+			for line in fd:
+				items = line.split()
+				if items:
+					result.append({key: float(value) for key, value in (item.split('=') for item in items)})
+	return result
+
+def run_benchmark(exe, count, path):
+	if os.path.isfile(logPath):
+		os.remove(logPath)
+	args = [exe, '/n', '/perf-startup']
+	if path:
+		args.append(path)
+	for _ in range(count):
+		subprocess.run(args, check=False)
+	records = read_log()
+	if not records:
+		print('no record in', logPath)
+		return {}
+	keys = records[0].keys()
+	return {key: statistics.median(record[key] for record in records) for key in keys}
+
+def compare_result(result, baseline):
+	regression = False
+	for key, value in result.items():
+		base = baseline.get(key)
+		if base:
+			ratio = value/base
+			mark = ''
+			if ratio > regressionThreshold:
+				mark = ' regression'
+				regression = True
+			print(f'{key:<14}{value:10.3f}{base:10.3f}{ratio:8.2f}{mark}')
+		else:
+			print(f'{key:<14}{value:10.3f}')
+	return regression
+
+def main(argv):
+	args = []
+	baselinePath = None
+	savePath = None
+	index = 1
+	while index < len(argv):
+		arg = argv[index]
+		if arg == '--baseline' and index + 1 < len(argv):
+			index += 1
+			baselinePath = argv[index]
+		elif arg == '--save' and index + 1 < len(argv):
+			index += 1
+			savePath = argv[index]
+		else:
+			args.append(arg)
+		index += 1
+	if not args:
+		print(f"Usage: {os.path.basename(__file__)} <Notepad4.exe> [count] [file] [--baseline baseline.json] [--save baseline.json]")
+		return 1
+
+	exe = args[0]
+	count = int(args[1]) if len(args) > 1 else 10
+	path = args[2] if len(args) > 2 else None
+	result = run_benchmark(exe, count, path)
+	if not result:
+		return 1
+
+	baseline = {}
+	if baselinePath:
+		with open(baselinePath, encoding='utf-8') as fd:
+			baseline = json.load(fd)
+	regression = compare_result(result, baseline)
+	if savePath:
+		with open(savePath, 'w', encoding='utf-8') as fd:
+			json.dump(result, fd, indent='\t')
+	return 1 if regression else 0
+
+if __name__ == '__main__':
+	sys.exit(main(sys.argv))
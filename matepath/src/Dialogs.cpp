@@ -1707,6 +1707,141 @@ INT_PTR CALLBACK CopyMoveDlgProc(HWND hwnd, UINT umsg, WPARAM wParam, LPARAM lPa
 	return FALSE;
 }
 
+//=============================================================================
+//
+//  FileOp_Queue()
+//
+//  File operations run one after another on a background thread, the list is
+//  kept responsive and updated by directory watcher as the shell makes changes.
+//
+struct FILEOPITEM {
+	FILEOPITEM *next;
+	UINT wFunc;
+	FILEOP_FLAGS fFlags;
+	bool bClearReadOnly;
+	WCHAR szFrom[MAX_PATH + 4];	// double null terminated
+	WCHAR szTo[MAX_PATH + 4];
+};
+
+static struct FILEOPQUEUE {
+	SRWLOCK lock;
+	FILEOPITEM *head;
+	FILEOPITEM *tail;
+	HWND hwnd;
+	HANDLE eventIdle;			// signaled when no operation is queued or running
+	bool running;				// worker thread is alive
+} fileOpQueue = { SRWLOCK_INIT, nullptr, nullptr, nullptr, nullptr, false };
+
+static DWORD WINAPI FileOp_Thread(LPVOID lpParam) noexcept {
+	UNREFERENCED_PARAMETER(lpParam);
+	const HRESULT hrInit = CoInitializeEx(nullptr, COINIT_APARTMENTTHREADED | COINIT_DISABLE_OLE1DDE);
+
+	while (true) {
+		AcquireSRWLockExclusive(&fileOpQueue.lock);
+		FILEOPITEM *item = fileOpQueue.head;
+		if (item == nullptr) {
+			fileOpQueue.tail = nullptr;
+			fileOpQueue.running = false;
+			SetEvent(fileOpQueue.eventIdle);
+			ReleaseSRWLockExclusive(&fileOpQueue.lock);
+			break;
+		}
+		fileOpQueue.head = item->next;
+		ReleaseSRWLockExclusive(&fileOpQueue.lock);
+
+		SHFILEOPSTRUCT shfos;
+		memset(&shfos, 0, sizeof(SHFILEOPSTRUCT));
+		shfos.hwnd = fileOpQueue.hwnd;
+		shfos.wFunc = item->wFunc;
+		shfos.pFrom = item->szFrom;
+		shfos.pTo = (item->wFunc == FO_DELETE) ? nullptr : item->szTo;
+		shfos.fFlags = item->fFlags;
+
+		const int result = SHFileOperation(&shfos);
+		if (result == 0 && item->bClearReadOnly) { // success
+			DWORD dwFileAttributes = GetFileAttributes(item->szTo);
+			if (dwFileAttributes != INVALID_FILE_ATTRIBUTES && (dwFileAttributes & FILE_ATTRIBUTE_READONLY)) {
+				dwFileAttributes &= ~FILE_ATTRIBUTE_READONLY;
+				SetFileAttributes(item->szTo, dwFileAttributes);
+				// this should work after the successful file operation...
+			}
+		}
+		PostMessage(fileOpQueue.hwnd, APPM_FILEOP_DONE, item->wFunc, result);
+		NP2HeapFree(item);
+	}
+
+	if (SUCCEEDED(hrInit)) {
+		CoUninitialize();
+	}
+	return 0;
+}
+
+bool FileOp_Queue(HWND hwnd, UINT wFunc, LPCWSTR pszFrom, LPCWSTR pszTo, FILEOP_FLAGS fFlags, bool bClearReadOnly) noexcept {
+	FILEOPITEM *item = static_cast<FILEOPITEM *>(NP2HeapAlloc(sizeof(FILEOPITEM)));
+	if (item == nullptr) {
+		return false;
+	}
+	item->wFunc = wFunc;
+	item->fFlags = fFlags;
+	item->bClearReadOnly = bClearReadOnly;
+	lstrcpyn(item->szFrom, pszFrom, MAX_PATH);
+	if (pszTo != nullptr) {
+		lstrcpyn(item->szTo, pszTo, MAX_PATH);
+	}
+
+	if (fileOpQueue.eventIdle == nullptr) {
+		fileOpQueue.eventIdle = CreateEvent(nullptr, TRUE, TRUE, nullptr);
+	}
+	AcquireSRWLockExclusive(&fileOpQueue.lock);
+	fileOpQueue.hwnd = hwnd;
+	if (fileOpQueue.tail != nullptr) {
+		fileOpQueue.tail->next = item;
+	} else {
+		fileOpQueue.head = item;
+	}
+	fileOpQueue.tail = item;
+	bool started = fileOpQueue.running;
+	if (!started) {
+		HANDLE hThread = CreateThread(nullptr, 0, FileOp_Thread, nullptr, 0, nullptr);
+		if (hThread != nullptr) {
+			CloseHandle(hThread);
+			ResetEvent(fileOpQueue.eventIdle);
+			fileOpQueue.running = true;
+			started = true;
+		} else {
+			fileOpQueue.head = nullptr;
+			fileOpQueue.tail = nullptr;
+		}
+	}
+	ReleaseSRWLockExclusive(&fileOpQueue.lock);
+
+	if (!started) {
+		NP2HeapFree(item);
+	}
+	return started;
+}
+
+bool FileOp_IsBusy() noexcept {
+	return fileOpQueue.eventIdle != nullptr && WaitForSingleObject(fileOpQueue.eventIdle, 0) != WAIT_OBJECT_0;
+}
+
+// progress dialogs of pending operations are owned by main window,
+// wait until they are finished before it's destroyed.
+void FileOp_WaitIdle() noexcept {
+	if (fileOpQueue.eventIdle == nullptr) {
+		return;
+	}
+	while (MsgWaitForMultipleObjects(1, &fileOpQueue.eventIdle, FALSE, INFINITE, QS_ALLINPUT) != WAIT_OBJECT_0) {
+		MSG msg;
+		while (PeekMessage(&msg, nullptr, 0, 0, PM_REMOVE)) {
+			TranslateMessage(&msg);
+			DispatchMessage(&msg);
+		}
+	}
+	CloseHandle(fileOpQueue.eventIdle);
+	fileOpQueue.eventIdle = nullptr;
+}
+
 //=============================================================================
 //
 //  CopyMoveDlg()
@@ -1732,15 +1867,9 @@ bool CopyMoveDlg(HWND hwnd, UINT *wFunc) {
 		WCHAR tchSource[MAX_PATH + 4];
 		WCHAR tchDestination[MAX_PATH + 4];
 
-		SHFILEOPSTRUCT shfos;
-		memset(&shfos, 0, sizeof(SHFILEOPSTRUCT));
-		shfos.hwnd = hwnd;
-		shfos.wFunc = fod.wFunc;
-		shfos.pFrom = tchSource;
-		shfos.pTo = tchDestination;
-		shfos.fFlags = FOF_NO_CONNECTED_ELEMENTS | FOF_ALLOWUNDO;
-		if (shfos.wFunc == FO_COPY && bRenameOnCollision) {
-			shfos.fFlags |= FOF_RENAMEONCOLLISION;
+		FILEOP_FLAGS fFlags = FOF_NO_CONNECTED_ELEMENTS | FOF_ALLOWUNDO;
+		if (fod.wFunc == FO_COPY && bRenameOnCollision) {
+			fFlags |= FOF_RENAMEONCOLLISION;
 		}
 
 		// Save item
@@ -1770,16 +1899,7 @@ bool CopyMoveDlg(HWND hwnd, UINT *wFunc) {
 			PathAppend(tchDestination, PathFindFileName(dli.szFileName));
 		}
 
-		if (SHFileOperation(&shfos) == 0) { // success
-			if (bClearReadOnly) {
-				DWORD dwFileAttributes = GetFileAttributes(tchDestination);
-				if (dwFileAttributes & FILE_ATTRIBUTE_READONLY) {
-					dwFileAttributes &= ~FILE_ATTRIBUTE_READONLY;
-					SetFileAttributes(tchDestination, dwFileAttributes);
-					// this should work after the successful file operation...
-				}
-			}
-		}
+		FileOp_Queue(hwnd, fod.wFunc, tchSource, tchDestination, fFlags, bClearReadOnly);
 
 		*wFunc = fod.wFunc; // save state for next call
 	}
@@ -1790,6 +1910,7 @@ bool CopyMoveDlg(HWND hwnd, UINT *wFunc) {
 
 extern WCHAR tchOpenWithDir[MAX_PATH];
 extern bool flagNoFadeHidden;
+extern bool flagShareOverlay;
 
 INT_PTR CALLBACK OpenWithDlgProc(HWND hwnd, UINT umsg, WPARAM wParam, LPARAM lParam) {
 	static const DWORD controlDefinition[] = {
@@ -1816,7 +1937,7 @@ INT_PTR CALLBACK OpenWithDlgProc(HWND hwnd, UINT umsg, WPARAM wParam, LPARAM lPa
 #endif
 		};
 		ListView_InsertColumn(hwndLV, 0, &lvc);
-		DirList_Init(hwndLV);
+		DirList_Init(hwndLV, flagShareOverlay, false);
 		DirList_Fill(hwndLV, tchOpenWithDir, DL_ALLOBJECTS, nullptr, false, flagNoFadeHidden, DS_NAME, false);
 		DirList_StartIconThread(hwndLV);
 		ListView_SetItemState(hwndLV, 0, LVIS_FOCUSED, LVIS_FOCUSED);
@@ -1832,6 +1953,17 @@ INT_PTR CALLBACK OpenWithDlgProc(HWND hwnd, UINT umsg, WPARAM wParam, LPARAM lPa
 		DeleteBitmapButton(hwnd, IDC_GETOPENWITHDIR);
 		return FALSE;
 
+	case APPM_DIRLIST_FILL: {
+		HWND hwndLV = GetDlgItem(hwnd, IDC_OPENWITHDIR);
+		if (DirList_FillUpdate(hwndLV)) {
+			DirList_StartIconThread(hwndLV);
+			if (ListView_GetNextItem(hwndLV, -1, LVNI_FOCUSED) < 0) {
+				ListView_SetItemState(hwndLV, 0, LVIS_FOCUSED, LVIS_FOCUSED);
+			}
+		}
+	}
+	return TRUE;
+
 	case WM_NOTIFY: {
 		LPNMHDR pnmh = AsPointer<LPNMHDR>(lParam);
 		if (pnmh->idFrom == IDC_OPENWITHDIR) {
@@ -1841,8 +1973,12 @@ INT_PTR CALLBACK OpenWithDlgProc(HWND hwnd, UINT umsg, WPARAM wParam, LPARAM lPa
 				DirList_GetDispInfo(hwndLV, lParam);
 				break;
 
-			case LVN_DELETEITEM:
-				DirList_DeleteItem(hwndLV, lParam);
+			case LVN_ODFINDITEM:
+				SetWindowLongPtr(hwnd, DWLP_MSGRESULT, DirList_FindItem(hwndLV, lParam));
+				break;
+
+			case LVN_ODCACHEHINT:
+				DirList_CacheHint(hwndLV, lParam);
 				break;
 
 			case LVN_ITEMCHANGED: {
@@ -1919,24 +2055,7 @@ bool OpenWithDlg(HWND hwnd, const DirListItem *lpdliParam) {
 
 			PathAppend(szDestination, PathFindFileName(szSource));
 
-			SHFILEOPSTRUCT shfos;
-			memset(&shfos, 0, sizeof(SHFILEOPSTRUCT));
-			shfos.hwnd = hwnd;
-			shfos.wFunc = FO_COPY;
-			shfos.pFrom = szSource;
-			shfos.pTo = szDestination;
-			shfos.fFlags = FOF_ALLOWUNDO;
-
-			if (SHFileOperation(&shfos) == 0) { // success
-				if (bClearReadOnly) {
-					DWORD dwFileAttributes = GetFileAttributes(szDestination);
-					if (dwFileAttributes & FILE_ATTRIBUTE_READONLY) {
-						dwFileAttributes &= ~FILE_ATTRIBUTE_READONLY;
-						SetFileAttributes(szDestination, dwFileAttributes);
-						// this should work after the successful file operation...
-					}
-				}
-			}
+			FileOp_Queue(hwnd, FO_COPY, szSource, szDestination, FOF_ALLOWUNDO, bClearReadOnly);
 		}
 		else {
 			SHELLEXECUTEINFO sei;
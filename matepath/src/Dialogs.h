@@ -46,6 +46,11 @@ INT_PTR OptionsPropSheet(HWND hwnd, HINSTANCE hInstance) noexcept;
 bool GetFilterDlg(HWND hwnd) noexcept;
 bool RenameFileDlg(HWND hwnd);
 bool CopyMoveDlg(HWND hwnd, UINT *wFunc);
+// posted to main window after each queued file operation, wParam is wFunc, lParam is result of SHFileOperation()
+#define APPM_FILEOP_DONE	(WM_APP + 8)
+bool FileOp_Queue(HWND hwnd, UINT wFunc, LPCWSTR pszFrom, LPCWSTR pszTo, FILEOP_FLAGS fFlags, bool bClearReadOnly) noexcept;
+bool FileOp_IsBusy() noexcept;
+void FileOp_WaitIdle() noexcept;
 bool OpenWithDlg(HWND hwnd, const DirListItem *lpdliParam);
 bool NewDirDlg(HWND hwnd, LPWSTR pszNewDir) noexcept;
 
@@ -24,15 +24,122 @@
 #include <shlobj.h>
 #include <shellapi.h>
 #include <commctrl.h>
+#include <cstdlib>
 #include "Helpers.h"
 #include "Dlapi.h"
 #include "DropSource.h"
 
 //==== DirList ================================================================
 
+//==== DirList Enumeration ====================================================
+#define DL_ENUM_BATCH_SIZE		256		// items fetched by each IEnumIDList::Next()
+#define DL_FILL_SYNC_TIMEOUT	200		// milliseconds, small directory is filled synchronously
+#define DL_ARENA_BLOCK_SIZE		(64*1024)	// pidls and names are packed into arena blocks
+#define DL_ICON_THREAD_COUNT	4		// maximum number of icon workers
+#define DL_ICONCACHE_SIZE		256		// extension keyed icon cache, power of 2
+#define DL_ICONCACHE_EXT_SIZE	16
+#define DL_WATCH_BUFFER_SIZE	(64*1024)	// limit for network share
+#define DL_WATCH_DELAY			200		// milliseconds, changes are coalesced before applied
+#define DL_WATCH_FILTER			(FILE_NOTIFY_CHANGE_FILE_NAME | FILE_NOTIFY_CHANGE_DIR_NAME | FILE_NOTIFY_CHANGE_ATTRIBUTES | FILE_NOTIFY_CHANGE_SIZE | FILE_NOTIFY_CHANGE_LAST_WRITE)
+#define DL_WATCH_COMPACT_COUNT	1024	// arena is compacted when stale items exceed this and item count
+#define DL_SEARCH_THREAD_COUNT	4		// directory walkers of recursive search
+#define DL_SEARCH_WAIT			100		// milliseconds, idle walker checks cancellation
+#if _WIN32_WINNT >= _WIN32_WINNT_WIN7
+#define DL_SEARCH_INFO_LEVEL	FindExInfoBasic
+#define DL_SEARCH_FIND_FLAGS	FIND_FIRST_EX_LARGE_FETCH
+#else
+#define DL_SEARCH_INFO_LEVEL	FindExInfoStandard
+#define DL_SEARCH_FIND_FLAGS	0
+#endif
+
+#define DL_MARK_SELECTED		1
+#define DL_MARK_FOCUSED			2
+#define DL_MARK_REMOVED			4
+
+//==== DL_ITEM Structure ======================================================
+// compact item of the owner data listview, sort keys are extracted on enumeration
+struct DL_ITEM {
+	LPCITEMIDLIST pidl;		// Item Id, relative to DLDATA::lpsf, multiple levels for search result
+	LPCWSTR pszName;		// Display Name
+	LPCWSTR pszExt;			// File Extension, empty for folder
+	ULONGLONG size;			// File Size
+	ULONGLONG lastWrite;	// Last Write Time
+	DWORD dwAttributes;		// File Attributes
+	int iImage;				// Icon Index
+	UINT overlay;			// Link and Share Overlay
+	bool iconDone;			// Icon Thread has processed the item
+	BYTE mark;				// DL_MARK_xx, used while items are rearranged
+	LPCWSTR pszFileName;	// File Name, used to match change notification
+};
+
+struct DL_CHANGE {
+	DWORD action;			// FILE_ACTION_xx
+	UINT name;				// offset in DLDATA::changeNames
+};
+
+struct DL_ICONCACHE {
+	WCHAR szExt[DL_ICONCACHE_EXT_SIZE];	// lower case, empty for unused entry
+	int iImage;
+};
+
+struct DL_ARENABLOCK {
+	DL_ARENABLOCK *next;
+	UINT used;
+	UINT size;
+};
+
+struct DL_SEARCHQUEUE {
+	SRWLOCK lock;
+	CONDITION_VARIABLE cond;	// signaled when directory queued or search finished
+	LPWSTR *dirs;				// relative to DLDATA::szPath
+	UINT count;
+	UINT capacity;
+	UINT active;				// walkers processing a directory
+	SRWLOCK arenaLock;			// walkers append items into same arena
+};
+
 //==== DLDATA Structure =======================================================
 struct DLDATA {
 	BackgroundWorker worker;	// where HWND is ListView Control
+	BackgroundWorker enumerator;// enumerate directory in the background
+	HWND hwndNotify;			// receives APPM_DIRLIST_FILL
+	SRWLOCK lock;				// guards pending items and flags
+	DL_ITEM *pendingItems;
+	UINT pendingCount;
+	UINT pendingCapacity;
+	bool fillDone;				// enumeration finished
+	bool notifyPosted;			// APPM_DIRLIST_FILL is posted and not handled
+	bool filling;				// used on UI thread
+	DL_ITEM *items;				// items shown in the listview, used on UI thread
+	UINT itemCount;
+	UINT itemCapacity;
+	DL_ARENABLOCK *arena;		// appended by enumeration, freed with items
+	UINT staleCount;			// removed items still occupy arena
+	BackgroundWorker watcher;	// watch directory changes in the background
+	HANDLE hWatchDir;
+	bool bWatchChanges;
+	bool applying;				// used on UI thread
+	bool changePosted;			// APPM_DIRLIST_CHANGE is posted and not handled
+	bool changeOverflow;		// changes are lost, full refresh is required
+	DL_CHANGE *changes;			// guarded by lock
+	UINT changeCount;
+	UINT changeCapacity;
+	WCHAR *changeNames;
+	UINT changeNameLength;
+	UINT changeNameCapacity;
+	LONG iconNext;				// next slot claimed by icon workers
+	UINT iconFirst;				// visible items [iconFirst, iconEnd) are processed first,
+	UINT iconEnd;				// guarded by lock
+	bool bShareOverlay;			// query share overlay for every item
+	SRWLOCK iconCacheLock;
+	UINT iconCacheCount;
+	DL_ICONCACHE iconCache[DL_ICONCACHE_SIZE];
+	DL_SEARCHQUEUE search;		// used by recursive search
+	bool bRecursive;
+	DWORD grfFlags;
+	int iSortFlags;
+	bool fSortRev;
+	DirListFilter dlf;
 	UINT cbidl;					// Size of pidl
 	bool bNoFadeHidden;			// Flag passed from GetDispInfo()
 	LPITEMIDLIST pidl;			// Directory Id
@@ -52,19 +159,113 @@ static inline LPCITEMIDLIST IL_Next(LPCITEMIDLIST pidl) noexcept {
 	return reinterpret_cast<LPCITEMIDLIST>(reinterpret_cast<const char *>(pidl) + pidl->mkid.cb);
 }
 
+static inline DLDATA *DirList_GetData(HWND hwnd) noexcept {
+	return static_cast<DLDATA *>(GetProp(hwnd, pDirListProp));
+}
+
+// search result has multiple level pidl, bind to its parent folder,
+// pidlAbsolute must be freed after the returned folder is released
+static LPSHELLFOLDER DirList_BindItem(const DLDATA *lpdl, const DL_ITEM *item, LPCITEMIDLIST *pidlChild, LPITEMIDLIST *pidlAbsolute) noexcept {
+	*pidlAbsolute = nullptr;
+	if (IL_Next(item->pidl)->mkid.cb == 0) {
+		*pidlChild = item->pidl;
+		lpdl->lpsf->AddRef();
+		return lpdl->lpsf;
+	}
+
+	LPSHELLFOLDER lpsf = nullptr;
+	LPITEMIDLIST pidl = IL_Create(lpdl->pidl, lpdl->cbidl, item->pidl, 0);
+	PCUITEMID_CHILD child = nullptr;
+	if (pidl && S_OK == SHBindToParent(reinterpret_cast<PCIDLIST_ABSOLUTE>(pidl), IID_IShellFolder, AsPPVArgs(&lpsf), &child)) {
+		*pidlChild = reinterpret_cast<LPCITEMIDLIST>(child);
+		*pidlAbsolute = pidl;
+		return lpsf;
+	}
+	CoTaskMemFree(pidl);
+	return nullptr;
+}
+
+static inline const DL_ITEM *DirList_GetItemData(const DLDATA *lpdl, int iItem) noexcept {
+	return (iItem >= 0 && static_cast<UINT>(iItem) < lpdl->itemCount) ? (lpdl->items + iItem) : nullptr;
+}
+
+template <typename T>
+static bool DirList_Reserve(T **items, UINT *capacity, UINT count) noexcept {
+	if (count <= *capacity) {
+		return true;
+	}
+	const UINT newCapacity = max(*capacity*2, count + DL_ENUM_BATCH_SIZE);
+	void *buffer = (*items == nullptr) ? NP2HeapAlloc(newCapacity*sizeof(T))
+		: NP2HeapReAlloc(*items, newCapacity*sizeof(T));
+	if (buffer == nullptr) {
+		return false;
+	}
+	*items = static_cast<T *>(buffer);
+	*capacity = newCapacity;
+	return true;
+}
+
+// called by enumeration thread, or UI thread after enumeration finished
+static void *DirList_ArenaAlloc(DLDATA *lpdl, UINT cb) noexcept {
+	cb = (cb + sizeof(void *) - 1) & ~static_cast<UINT>(sizeof(void *) - 1);
+	DL_ARENABLOCK *block = lpdl->arena;
+	if (block == nullptr || block->used + cb > block->size) {
+		const UINT size = max<UINT>(DL_ARENA_BLOCK_SIZE, cb + sizeof(DL_ARENABLOCK));
+		block = static_cast<DL_ARENABLOCK *>(NP2HeapAlloc(size));
+		if (block == nullptr) {
+			return nullptr;
+		}
+		block->next = lpdl->arena;
+		block->used = sizeof(DL_ARENABLOCK);
+		block->size = size;
+		lpdl->arena = block;
+	}
+	void *ptr = reinterpret_cast<char *>(block) + block->used;
+	block->used += cb;
+	return ptr;
+}
+
+static LPCWSTR DirList_ArenaString(DLDATA *lpdl, LPCWSTR text) noexcept {
+	const UINT cb = (lstrlen(text) + 1)*sizeof(WCHAR);
+	void *ptr = DirList_ArenaAlloc(lpdl, cb);
+	if (ptr) {
+		memcpy(ptr, text, cb);
+	}
+	return static_cast<LPCWSTR>(ptr);
+}
+
+static void DirList_FreeArena(DL_ARENABLOCK *block) noexcept {
+	while (block) {
+		DL_ARENABLOCK *next = block->next;
+		NP2HeapFree(block);
+		block = next;
+	}
+}
+
 //=============================================================================
 //
 //  DirList_Init()
 //
 //  Initializes the DLDATA structure and sets up the listview control
 //
-void DirList_Init(HWND hwnd) noexcept {
+void DirList_Init(HWND hwnd, bool bShareOverlay, bool bWatchChanges) noexcept {
 	// Allocate DirListData Property
 	DLDATA *lpdl = static_cast<DLDATA *>(GlobalAlloc(GPTR, sizeof(DLDATA)));
 	SetProp(hwnd, pDirListProp, lpdl);
 
 	// Setup dl
 	lpdl->worker.Init(hwnd);
+	lpdl->enumerator.Init(hwnd);
+	lpdl->watcher.Init(hwnd);
+	lpdl->hwndNotify = GetParent(hwnd);
+	InitializeSRWLock(&lpdl->lock);
+	InitializeSRWLock(&lpdl->iconCacheLock);
+	InitializeSRWLock(&lpdl->search.lock);
+	InitializeConditionVariable(&lpdl->search.cond);
+	InitializeSRWLock(&lpdl->search.arenaLock);
+	lpdl->bShareOverlay = bShareOverlay;
+	lpdl->bWatchChanges = bWatchChanges;
+	lpdl->hWatchDir = INVALID_HANDLE_VALUE;
 	lpdl->cbidl = 0;
 	lpdl->pidl = nullptr;
 	lpdl->lpsf = nullptr;
@@ -78,6 +279,9 @@ void DirList_Init(HWND hwnd) noexcept {
 	hil = AsPointer<HIMAGELIST>(SHGetFileInfo(L"C:\\", 0, &shfi, sizeof(SHFILEINFO), SHGFI_LARGEICON | SHGFI_SYSICONINDEX));
 	ListView_SetImageList(hwnd, hil, LVSIL_NORMAL);
 
+	// fading and overlay are provided by DirList_GetDispInfo()
+	ListView_SetCallbackMask(hwnd, LVIS_CUT | LVIS_OVERLAYMASK);
+
 	// Initialize default icons - done in DirList_Fill()
 	//SHGetFileInfo(L"Icon", FILE_ATTRIBUTE_DIRECTORY, &shfi, sizeof(SHFILEINFO), SHGFI_USEFILEATTRIBUTES | SHGFI_SMALLICON | SHGFI_SYSICONINDEX);
 	//lpdl->iDefIconFolder = shfi.iIcon;
@@ -89,6 +293,31 @@ void DirList_Init(HWND hwnd) noexcept {
 	lpdl->iDefIconFile = 0;
 }
 
+// enumeration must be stopped before calling this
+static void DirList_ClearItems(DLDATA *lpdl) noexcept {
+	lpdl->pendingCount = 0;
+	lpdl->fillDone = false;
+	lpdl->notifyPosted = false;
+	lpdl->itemCount = 0;
+	lpdl->staleCount = 0;
+
+	DirList_FreeArena(lpdl->arena);
+	lpdl->arena = nullptr;
+}
+
+// stop watching current directory and discard pending changes
+static void DirList_StopWatch(DLDATA *lpdl) noexcept {
+	lpdl->watcher.Cancel();
+	if (lpdl->hWatchDir != INVALID_HANDLE_VALUE) {
+		CloseHandle(lpdl->hWatchDir);
+		lpdl->hWatchDir = INVALID_HANDLE_VALUE;
+	}
+	lpdl->changeCount = 0;
+	lpdl->changeNameLength = 0;
+	lpdl->changePosted = false;
+	lpdl->changeOverflow = false;
+}
+
 //=============================================================================
 //
 //  DirList_Destroy()
@@ -96,9 +325,28 @@ void DirList_Init(HWND hwnd) noexcept {
 //  Free memory used by dl structure
 //
 void DirList_Destroy(HWND hwnd) {
-	DLDATA * const lpdl = static_cast<DLDATA *>(GetProp(hwnd, pDirListProp));
+	DLDATA * const lpdl = DirList_GetData(hwnd);
 
 	lpdl->worker.Destroy();
+	lpdl->enumerator.Destroy();
+	DirList_StopWatch(lpdl);
+	lpdl->watcher.Destroy();
+	DirList_ClearItems(lpdl);
+	if (lpdl->changes) {
+		NP2HeapFree(lpdl->changes);
+	}
+	if (lpdl->changeNames) {
+		NP2HeapFree(lpdl->changeNames);
+	}
+	if (lpdl->search.dirs) {
+		NP2HeapFree(lpdl->search.dirs);
+	}
+	if (lpdl->pendingItems) {
+		NP2HeapFree(lpdl->pendingItems);
+	}
+	if (lpdl->items) {
+		NP2HeapFree(lpdl->items);
+	}
 
 	if (lpdl->pidl) {
 		CoTaskMemFree(lpdl->pidl);
@@ -113,6 +361,21 @@ void DirList_Destroy(HWND hwnd) {
 	GlobalFree(lpdl);
 }
 
+// called on UI thread, icons for visible items and the hinted range are extracted first
+static void DirList_SetIconRange(HWND hwnd, DLDATA *lpdl, int iFrom, int iTo) noexcept {
+	const int top = ListView_GetTopIndex(hwnd);
+	const int page = ListView_GetCountPerPage(hwnd);
+	const int count = static_cast<int>(lpdl->itemCount);
+	const int first = clamp(min(top, iFrom), 0, count);
+	const int end = clamp(max(top + page + 1, iTo + 1), first, count);
+
+	AcquireSRWLockExclusive(&lpdl->lock);
+	lpdl->iconFirst = first;
+	lpdl->iconEnd = end;
+	InterlockedExchange(&lpdl->iconNext, 0);
+	ReleaseSRWLockExclusive(&lpdl->lock);
+}
+
 //=============================================================================
 //
 //  DirList_StartIconThread()
@@ -120,20 +383,446 @@ void DirList_Destroy(HWND hwnd) {
 //  Start thread to extract file icons in the background
 //
 void DirList_StartIconThread(HWND hwnd) noexcept {
-	DLDATA * const lpdl = static_cast<DLDATA *>(GetProp(hwnd, pDirListProp));
+	DLDATA * const lpdl = DirList_GetData(hwnd);
 
 	lpdl->worker.Cancel();
+	// started again by APPM_DIRLIST_FILL handler after enumeration finished
+	if (lpdl->filling) {
+		return;
+	}
+	DirList_SetIconRange(hwnd, lpdl, lpdl->itemCount, 0);
 	lpdl->worker.workerThread = CreateThread(nullptr, 0, DirList_IconThread, lpdl, 0, nullptr);
 }
 
+//=============================================================================
+//
+//  DirList_EnumThread()
+//
+//  Thread to enumerate directory items in batches, items are handed over to
+//  the UI thread with APPM_DIRLIST_FILL
+//
+static void DirList_PushItems(DLDATA *lpdl, const DL_ITEM *items, UINT count, bool done) noexcept {
+	AcquireSRWLockExclusive(&lpdl->lock);
+	// items are dropped when out of memory
+	if (count != 0 && DirList_Reserve(&lpdl->pendingItems, &lpdl->pendingCapacity, lpdl->pendingCount + count)) {
+		memcpy(lpdl->pendingItems + lpdl->pendingCount, items, count*sizeof(DL_ITEM));
+		lpdl->pendingCount += count;
+	}
+	lpdl->fillDone = done;
+	const bool post = !lpdl->notifyPosted && (lpdl->pendingCount != 0 || done);
+	lpdl->notifyPosted |= post;
+	ReleaseSRWLockExclusive(&lpdl->lock);
+
+	if (post) {
+		PostMessage(lpdl->hwndNotify, APPM_DIRLIST_FILL, 0, 0);
+	}
+}
+
+// file name and attributes are fetched once for filter and item
+static void DirList_GetFindData(LPSHELLFOLDER lpsf, PCUITEMID_CHILD pidlEntry, DWORD dwAttributes, WIN32_FIND_DATA *fd) noexcept {
+	if (S_OK != SHGetDataFromIDList(lpsf, pidlEntry, SHGDFIL_FINDDATA, fd, sizeof(WIN32_FIND_DATA))) {
+		memset(fd, 0, sizeof(WIN32_FIND_DATA));
+		fd->dwFileAttributes = (dwAttributes & SFGAO_FOLDER) ? FILE_ATTRIBUTE_DIRECTORY : FILE_ATTRIBUTE_NORMAL;
+		IL_GetDisplayName(lpsf, reinterpret_cast<LPCITEMIDLIST>(pidlEntry), SHGDN_INFOLDER | SHGDN_FORPARSING, fd->cFileName, MAX_PATH);
+	}
+}
+
+// search result is displayed with given relative path
+static bool DirList_MakeItem(DLDATA *lpdl, PCUITEMID_CHILD pidlEntry, const WIN32_FIND_DATA &fd, LPCWSTR lpszDisplayName, DL_ITEM *item) noexcept {
+	WCHAR szDisplayName[MAX_PATH];
+	if (lpszDisplayName) {
+		lstrcpyn(szDisplayName, lpszDisplayName, MAX_PATH);
+	} else if (!IL_GetDisplayName(lpdl->lpsf, reinterpret_cast<LPCITEMIDLIST>(pidlEntry), SHGDN_INFOLDER, szDisplayName, MAX_PATH)) {
+		lstrcpy(szDisplayName, fd.cFileName);
+	}
+
+	const UINT cb = IL_GetSize(reinterpret_cast<LPCITEMIDLIST>(pidlEntry));
+	void *pidl = DirList_ArenaAlloc(lpdl, cb + sizeof(USHORT));
+	LPCWSTR pszName = DirList_ArenaString(lpdl, szDisplayName);
+	// display name equals to file name when extension is shown
+	LPCWSTR pszFileName = (pszName && StrEqual(szDisplayName, fd.cFileName)) ? pszName : DirList_ArenaString(lpdl, fd.cFileName);
+	if (pidl == nullptr || pszName == nullptr || pszFileName == nullptr) {
+		return false;
+	}
+
+	// copy the pidl including the terminating zero
+	memcpy(pidl, pidlEntry, cb + sizeof(USHORT));
+	const bool folder = (fd.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) != 0;
+	item->pidl = static_cast<LPCITEMIDLIST>(pidl);
+	item->pszName = pszName;
+	item->pszFileName = pszFileName;
+	item->pszExt = folder ? L"" : PathFindExtension(pszFileName);
+	item->size = (static_cast<ULONGLONG>(fd.nFileSizeHigh) << 32) | fd.nFileSizeLow;
+	item->lastWrite = (static_cast<ULONGLONG>(fd.ftLastWriteTime.dwHighDateTime) << 32) | fd.ftLastWriteTime.dwLowDateTime;
+	item->dwAttributes = fd.dwFileAttributes;
+	// Setup default Icon - Folder or File
+	item->iImage = folder ? lpdl->iDefIconFolder : lpdl->iDefIconFile;
+	item->overlay = 0;
+	item->iconDone = false;
+	item->mark = 0;
+	return true;
+}
+
+// copy pidl and names of the item into current arena
+static bool DirList_CopyItem(DLDATA *lpdl, DL_ITEM *item) noexcept {
+	const UINT cb = IL_GetSize(item->pidl) + sizeof(USHORT);
+	void *pidl = DirList_ArenaAlloc(lpdl, cb);
+	LPCWSTR pszName = DirList_ArenaString(lpdl, item->pszName);
+	LPCWSTR pszFileName = (item->pszFileName == item->pszName) ? pszName : DirList_ArenaString(lpdl, item->pszFileName);
+	if (pidl == nullptr || pszName == nullptr || pszFileName == nullptr) {
+		return false;
+	}
+
+	memcpy(pidl, item->pidl, cb);
+	item->pidl = static_cast<LPCITEMIDLIST>(pidl);
+	item->pszName = pszName;
+	item->pszFileName = pszFileName;
+	item->pszExt = (item->dwAttributes & FILE_ATTRIBUTE_DIRECTORY) ? L"" : PathFindExtension(pszFileName);
+	return true;
+}
+
+static DWORD WINAPI DirList_EnumThread(LPVOID lpParam) {
+	DLDATA * const lpdl = static_cast<DLDATA *>(lpParam);
+	const BackgroundWorker &worker = lpdl->enumerator;
+	LPSHELLFOLDER lpsf = lpdl->lpsf;
+	const HRESULT hrInit = CoInitializeEx(nullptr, COINIT_APARTMENTTHREADED);
+
+	// Create an Enumeration object for lpsf
+	LPENUMIDLIST lpe = nullptr;
+	if (S_OK == lpsf->EnumObjects(nullptr, lpdl->grfFlags, &lpe)) {
+		PITEMID_CHILD pidls[DL_ENUM_BATCH_SIZE];
+		DL_ITEM items[DL_ENUM_BATCH_SIZE];
+		HRESULT hr = S_OK;
+		while (hr == S_OK && worker.Continue()) {
+			// Enumerate the contents of lpsf in batches
+			ULONG fetched = 0;
+			hr = lpe->Next(DL_ENUM_BATCH_SIZE, pidls, &fetched);
+			if (FAILED(hr)) {
+				break;
+			}
+
+			UINT count = 0;
+			for (ULONG i = 0; i < fetched; i++) {
+				PITEMID_CHILD pidlEntry = pidls[i];
+				// Check if it's part of the Filesystem
+				DWORD dwAttributes = SFGAO_FILESYSTEM | SFGAO_FOLDER;
+				lpsf->GetAttributesOf(1, reinterpret_cast<PCUITEMID_CHILD_ARRAY>(&pidlEntry), &dwAttributes);
+
+				// Check if item matches specified filter
+				if (dwAttributes & SFGAO_FILESYSTEM) {
+					WIN32_FIND_DATA fd;
+					DirList_GetFindData(lpsf, pidlEntry, dwAttributes, &fd);
+					if (lpdl->dlf.Match(fd.cFileName, fd.dwFileAttributes)
+						&& DirList_MakeItem(lpdl, pidlEntry, fd, nullptr, items + count)) {
+						++count;
+					}
+				}
+				CoTaskMemFree(pidlEntry);
+			}
+			if (count != 0) {
+				DirList_PushItems(lpdl, items, count, false);
+			}
+		}
+
+		lpe->Release();
+	}
+
+	DirList_PushItems(lpdl, nullptr, 0, true);
+	if (SUCCEEDED(hrInit)) {
+		CoUninitialize();
+	}
+	return 0;
+}
+
+//=============================================================================
+//
+//  DirList_SearchThread()
+//
+//  Recursive search with a pool of directory walkers: each walker takes a
+//  directory from the shared queue, queues its subdirectories and pushes
+//  matching files like DirList_EnumThread()
+//
+static void DirList_QueueDirectory(DLDATA *lpdl, LPCWSTR lpszDir) noexcept {
+	const UINT cb = (lstrlen(lpszDir) + 1)*sizeof(WCHAR);
+	LPWSTR dir = static_cast<LPWSTR>(NP2HeapAlloc(cb));
+	if (dir == nullptr) {
+		return;
+	}
+
+	memcpy(dir, lpszDir, cb);
+	DL_SEARCHQUEUE &queue = lpdl->search;
+	AcquireSRWLockExclusive(&queue.lock);
+	const bool queued = DirList_Reserve(&queue.dirs, &queue.capacity, queue.count + 1);
+	if (queued) {
+		queue.dirs[queue.count++] = dir;
+	}
+	ReleaseSRWLockExclusive(&queue.lock);
+	if (queued) {
+		WakeConditionVariable(&queue.cond);
+	} else {
+		NP2HeapFree(dir);
+	}
+}
+
+// lpszDir is relative to current directory, empty for itself
+static void DirList_SearchDirectory(DLDATA *lpdl, LPCWSTR lpszDir, DL_ITEM *items, UINT *count) noexcept {
+	const BackgroundWorker &worker = lpdl->enumerator;
+	WCHAR szPath[MAX_PATH];
+	if (!PathCombine(szPath, lpdl->szPath, lpszDir) || !PathAppend(szPath, L"*")) {
+		return;
+	}
+
+	WIN32_FIND_DATA fd;
+	HANDLE hFind = FindFirstFileEx(szPath, DL_SEARCH_INFO_LEVEL, &fd, FindExSearchNameMatch, nullptr, DL_SEARCH_FIND_FLAGS);
+	if (hFind == INVALID_HANDLE_VALUE) {
+		return;
+	}
+
+	const DWORD grfFlags = lpdl->grfFlags;
+	WCHAR szRelative[MAX_PATH];
+	do {
+		LPCWSTR name = fd.cFileName;
+		if (name[0] == L'.' && (name[1] == L'\0' || (name[1] == L'.' && name[2] == L'\0'))) {
+			continue;
+		}
+		if ((fd.dwFileAttributes & FILE_ATTRIBUTE_HIDDEN) && !(grfFlags & SHCONTF_INCLUDEHIDDEN)) {
+			continue;
+		}
+		if (StrIsEmpty(lpszDir)) {
+			lstrcpyn(szRelative, name, MAX_PATH);
+		} else if (!PathCombine(szRelative, lpszDir, name)) {
+			continue;
+		}
+
+		if (fd.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) {
+			// junctions and mount points are not followed, the walk stays on one volume
+			if (!(fd.dwFileAttributes & FILE_ATTRIBUTE_REPARSE_POINT)) {
+				DirList_QueueDirectory(lpdl, szRelative);
+			}
+		} else if ((grfFlags & SHCONTF_NONFOLDERS) && lpdl->dlf.Match(name, fd.dwFileAttributes)) {
+			PIDLIST_RELATIVE pidl = nullptr;
+			if (S_OK == lpdl->lpsf->ParseDisplayName(nullptr, nullptr, szRelative, nullptr, &pidl, nullptr)) {
+				// arena is shared by all walkers
+				AcquireSRWLockExclusive(&lpdl->search.arenaLock);
+				const bool made = DirList_MakeItem(lpdl, reinterpret_cast<PCUITEMID_CHILD>(pidl), fd, szRelative, items + *count);
+				ReleaseSRWLockExclusive(&lpdl->search.arenaLock);
+				CoTaskMemFree(pidl);
+				if (made && ++*count == DL_ENUM_BATCH_SIZE) {
+					DirList_PushItems(lpdl, items, *count, false);
+					*count = 0;
+				}
+			}
+		}
+	} while (worker.Continue() && FindNextFile(hFind, &fd));
+	FindClose(hFind);
+}
+
+static DWORD WINAPI DirList_SearchWorker(LPVOID lpParam) {
+	DLDATA * const lpdl = static_cast<DLDATA *>(lpParam);
+	const BackgroundWorker &worker = lpdl->enumerator;
+	DL_SEARCHQUEUE &queue = lpdl->search;
+	const HRESULT hrInit = CoInitializeEx(nullptr, COINIT_APARTMENTTHREADED);
+
+	DL_ITEM items[DL_ENUM_BATCH_SIZE];
+	UINT count = 0;
+	while (true) {
+		// wait until other walkers queued more directories or all finished
+		AcquireSRWLockExclusive(&queue.lock);
+		while (queue.count == 0 && queue.active != 0 && worker.Continue()) {
+			SleepConditionVariableSRW(&queue.cond, &queue.lock, DL_SEARCH_WAIT, 0);
+		}
+		LPWSTR dir = nullptr;
+		if (queue.count != 0 && worker.Continue()) {
+			dir = queue.dirs[--queue.count];
+			queue.active++;
+		}
+		ReleaseSRWLockExclusive(&queue.lock);
+		if (dir == nullptr) {
+			break;
+		}
+
+		DirList_SearchDirectory(lpdl, dir, items, &count);
+		NP2HeapFree(dir);
+		// stream matches of each directory while the walk continues
+		if (count != 0) {
+			DirList_PushItems(lpdl, items, count, false);
+			count = 0;
+		}
+
+		AcquireSRWLockExclusive(&queue.lock);
+		queue.active--;
+		const bool finished = queue.count == 0 && queue.active == 0;
+		ReleaseSRWLockExclusive(&queue.lock);
+		if (finished) {
+			WakeAllConditionVariable(&queue.cond);
+		}
+	}
+
+	WakeAllConditionVariable(&queue.cond);
+	if (SUCCEEDED(hrInit)) {
+		CoUninitialize();
+	}
+	return 0;
+}
+
+static DWORD WINAPI DirList_SearchThread(LPVOID lpParam) {
+	DLDATA * const lpdl = static_cast<DLDATA *>(lpParam);
+	DL_SEARCHQUEUE &queue = lpdl->search;
+	queue.count = 0;
+	queue.active = 0;
+	DirList_QueueDirectory(lpdl, L"");
+
+	// current thread is one of the walkers
+	HANDLE threads[DL_SEARCH_THREAD_COUNT - 1];
+	DWORD threadCount = 0;
+	for (UINT i = 0; i < COUNTOF(threads); i++) {
+		HANDLE thread = CreateThread(nullptr, 0, DirList_SearchWorker, lpdl, 0, nullptr);
+		if (thread) {
+			threads[threadCount++] = thread;
+		}
+	}
+
+	DirList_SearchWorker(lpdl);
+	if (threadCount != 0) {
+		WaitForMultipleObjects(threadCount, threads, TRUE, INFINITE);
+		for (DWORD i = 0; i < threadCount; i++) {
+			CloseHandle(threads[i]);
+		}
+	}
+
+	// directories left by cancellation
+	for (UINT i = 0; i < queue.count; i++) {
+		NP2HeapFree(queue.dirs[i]);
+	}
+	queue.count = 0;
+
+	DirList_PushItems(lpdl, nullptr, 0, true);
+	return 0;
+}
+
+//=============================================================================
+//
+//  DirList_WatchThread()
+//
+//  Thread to watch changes of current directory with ReadDirectoryChangesW(),
+//  changes are coalesced and handed over to the UI thread with APPM_DIRLIST_CHANGE
+//
+static void DirList_PushChanges(DLDATA *lpdl, const BYTE *buffer, DWORD cbBytes) noexcept {
+	AcquireSRWLockExclusive(&lpdl->lock);
+	if (cbBytes == 0) {
+		// buffer overflow or error
+		lpdl->changeOverflow = true;
+	}
+	while (cbBytes != 0 && !lpdl->changeOverflow) {
+		const FILE_NOTIFY_INFORMATION *info = reinterpret_cast<const FILE_NOTIFY_INFORMATION *>(buffer);
+		const UINT cch = info->FileNameLength/sizeof(WCHAR);
+		if (DirList_Reserve(&lpdl->changes, &lpdl->changeCapacity, lpdl->changeCount + 1)
+			&& DirList_Reserve(&lpdl->changeNames, &lpdl->changeNameCapacity, lpdl->changeNameLength + cch + 1)) {
+			WCHAR *name = lpdl->changeNames + lpdl->changeNameLength;
+			memcpy(name, info->FileName, cch*sizeof(WCHAR));
+			name[cch] = L'\0';
+			DL_CHANGE &change = lpdl->changes[lpdl->changeCount++];
+			change.action = info->Action;
+			change.name = lpdl->changeNameLength;
+			lpdl->changeNameLength += cch + 1;
+		} else {
+			lpdl->changeOverflow = true;
+		}
+		if (info->NextEntryOffset == 0) {
+			break;
+		}
+		buffer += info->NextEntryOffset;
+	}
+	ReleaseSRWLockExclusive(&lpdl->lock);
+}
+
+static void DirList_PostChanges(DLDATA *lpdl) noexcept {
+	AcquireSRWLockExclusive(&lpdl->lock);
+	const bool post = !lpdl->changePosted && (lpdl->changeCount != 0 || lpdl->changeOverflow);
+	lpdl->changePosted |= post;
+	ReleaseSRWLockExclusive(&lpdl->lock);
+
+	if (post) {
+		PostMessage(lpdl->hwndNotify, APPM_DIRLIST_CHANGE, 0, 0);
+	}
+}
+
+static DWORD WINAPI DirList_WatchThread(LPVOID lpParam) {
+	DLDATA * const lpdl = static_cast<DLDATA *>(lpParam);
+	const BackgroundWorker &worker = lpdl->watcher;
+	HANDLE hDir = lpdl->hWatchDir;
+
+	BYTE *buffer = static_cast<BYTE *>(NP2HeapAlloc(DL_WATCH_BUFFER_SIZE));
+	OVERLAPPED overlapped;
+	memset(&overlapped, 0, sizeof(overlapped));
+	overlapped.hEvent = CreateEvent(nullptr, TRUE, FALSE, nullptr);
+	const HANDLE handles[2] = { worker.eventCancel, overlapped.hEvent };
+
+	bool pending = false;
+	DWORD dwPendingTick = 0;
+	while (buffer != nullptr && overlapped.hEvent != nullptr) {
+		if (!ReadDirectoryChangesW(hDir, buffer, DL_WATCH_BUFFER_SIZE, FALSE, DL_WATCH_FILTER, nullptr, &overlapped, nullptr)) {
+			// directory is removed or inaccessible
+			DirList_PushChanges(lpdl, nullptr, 0);
+			DirList_PostChanges(lpdl);
+			break;
+		}
+
+		DWORD dwWait;
+		while (true) {
+			DWORD dwTimeout = INFINITE;
+			if (pending) {
+				const DWORD dwElapsed = GetTickCount() - dwPendingTick;
+				dwTimeout = (dwElapsed >= DL_WATCH_DELAY) ? 0 : (DL_WATCH_DELAY - dwElapsed);
+			}
+			dwWait = WaitForMultipleObjects(COUNTOF(handles), handles, FALSE, dwTimeout);
+			if (dwWait != WAIT_TIMEOUT) {
+				break;
+			}
+			pending = false;
+			DirList_PostChanges(lpdl);
+		}
+
+		if (dwWait != WAIT_OBJECT_0 + 1) {
+			// cancelled
+			DWORD cbBytes;
+			CancelIo(hDir);
+			GetOverlappedResult(hDir, &overlapped, &cbBytes, TRUE);
+			break;
+		}
+
+		DWORD cbBytes = 0;
+		const bool success = GetOverlappedResult(hDir, &overlapped, &cbBytes, FALSE);
+		if (!success && GetLastError() != ERROR_NOTIFY_ENUM_DIR) {
+			DirList_PushChanges(lpdl, nullptr, 0);
+			DirList_PostChanges(lpdl);
+			break;
+		}
+		DirList_PushChanges(lpdl, buffer, success ? cbBytes : 0);
+		if (!pending) {
+			pending = true;
+			dwPendingTick = GetTickCount();
+		}
+	}
+
+	if (overlapped.hEvent) {
+		CloseHandle(overlapped.hEvent);
+	}
+	if (buffer) {
+		NP2HeapFree(buffer);
+	}
+	return 0;
+}
+
 //=============================================================================
 //
 //  DirList_Fill()
 //
-//  Snapshots a directory and displays the items in the listview control
+//  Snapshots a directory and displays the items in the listview control,
+//  items are enumerated in the background, small directory is filled before return
 //
 int DirList_Fill(HWND hwnd, LPCWSTR lpszDir, DWORD grfFlags, LPCWSTR lpszFileSpec, bool bExcludeFilter, bool bNoFadeHidden, int iSortFlags, bool fSortRev) {
-	DLDATA * const lpdl = static_cast<DLDATA *>(GetProp(hwnd, pDirListProp));
+	DLDATA * const lpdl = DirList_GetData(hwnd);
 	SHFILEINFO shfi;
 
 	// Initialize default icons
@@ -143,32 +832,27 @@ int DirList_Fill(HWND hwnd, LPCWSTR lpszDir, DWORD grfFlags, LPCWSTR lpszFileSpe
 	SHGetFileInfo(L"Icon", FILE_ATTRIBUTE_NORMAL, &shfi, sizeof(SHFILEINFO), SHGFI_USEFILEATTRIBUTES | SHGFI_SMALLICON | SHGFI_SYSICONINDEX);
 	lpdl->iDefIconFile = shfi.iIcon;
 
-	// First of all terminate running icon thread
+	// First of all terminate running icon thread and stale enumeration
+	lpdl->filling = false;
 	lpdl->worker.Cancel();
+	lpdl->enumerator.Cancel();
+	DirList_StopWatch(lpdl);
+
+	// Init ListView
+	SendMessage(hwnd, WM_SETREDRAW, 0, 0);
+	ListView_SetItemCount(hwnd, 0);
+	DirList_ClearItems(lpdl);
 
 	// A Directory is strongly required
 	if (StrIsEmpty(lpszDir)) {
+		SendMessage(hwnd, WM_SETREDRAW, 1, 0);
 		return -1;
 	}
 
 	lstrcpy(lpdl->szPath, lpszDir);
 
-	// Init ListView
-	SendMessage(hwnd, WM_SETREDRAW, 0, 0);
-	ListView_DeleteAllItems(hwnd);
-
 	// Init Filter
-	DirListFilter dlf;
-	dlf.Create(lpszFileSpec, bExcludeFilter);
-
-	// Init lvi
-	LV_ITEM lvi;
-	lvi.mask = LVIF_TEXT | LVIF_IMAGE | LVIF_PARAM;
-	lvi.iItem = 0;
-	lvi.iSubItem = 0;
-	lvi.pszText = LPSTR_TEXTCALLBACK;
-	lvi.cchTextMax = MAX_PATH;
-	lvi.iImage = I_IMAGECALLBACK;
+	lpdl->dlf.Create(lpszFileSpec, bExcludeFilter);
 
 	WCHAR wszDir[MAX_PATH];
 	lstrcpy(wszDir, lpszDir);
@@ -183,40 +867,7 @@ int DirList_Fill(HWND hwnd, LPCWSTR lpszDir, DWORD grfFlags, LPCWSTR lpszFileSpe
 		ULONG dwAttributes = 0;
 		if (S_OK == lpsfDesktop->ParseDisplayName(hwnd, nullptr, wszDir, &chParsed, &pidl, &dwAttributes)) {
 			// Bind pidl to IShellFolder
-			if (S_OK == lpsfDesktop->BindToObject(pidl, nullptr, IID_IShellFolder, AsPPVArgs(&lpsf))) {
-				// Create an Enumeration object for lpsf
-				LPENUMIDLIST lpe = nullptr;
-				if (S_OK == lpsf->EnumObjects(hwnd, grfFlags, &lpe)) {
-					// Enumerate the contents of lpsf
-					PITEMID_CHILD pidlEntry = nullptr;
-					while (S_OK == lpe->Next(1, &pidlEntry, nullptr)) {
-						// Add found item to the List
-						// Check if it's part of the Filesystem
-						dwAttributes = SFGAO_FILESYSTEM | SFGAO_FOLDER;
-						lpsf->GetAttributesOf(1, reinterpret_cast<PCUITEMID_CHILD_ARRAY>(&pidlEntry), &dwAttributes);
-
-						if (dwAttributes & SFGAO_FILESYSTEM) {
-							// Check if item matches specified filter
-							if (dlf.Match(lpsf, pidlEntry)) {
-								LV_ITEMDATA *lplvid = static_cast<LV_ITEMDATA *>(CoTaskMemAlloc(sizeof(LV_ITEMDATA)));
-								lplvid->pidl = pidlEntry;
-								lplvid->lpsf = lpsf;
-								lpsf->AddRef();
-								lvi.lParam = AsInteger<LPARAM>(lplvid);
-								// Setup default Icon - Folder or File
-								lvi.iImage = (dwAttributes & SFGAO_FOLDER) ? lpdl->iDefIconFolder : lpdl->iDefIconFile;
-								ListView_InsertItem(hwnd, &lvi);
-								lvi.iItem++;
-							}
-						}
-					} // IEnumIDList::Next()
-
-					lpe->Release();
-
-				} // IShellFolder::EnumObjects()
-
-			} // IShellFolder::BindToObject()
-
+			lpsfDesktop->BindToObject(pidl, nullptr, IID_IShellFolder, AsPPVArgs(&lpsf));
 		} // IShellFolder::ParseDisplayName()
 
 		lpsfDesktop->Release();
@@ -235,12 +886,33 @@ int DirList_Fill(HWND hwnd, LPCWSTR lpszDir, DWORD grfFlags, LPCWSTR lpszFileSpe
 	lpdl->pidl = pidl;
 	lpdl->lpsf = lpsf;
 	lpdl->bNoFadeHidden = bNoFadeHidden;
+	lpdl->bRecursive = (grfFlags & DL_RECURSIVE) != 0;
+	lpdl->grfFlags = grfFlags & ~DL_RECURSIVE;
+	lpdl->iSortFlags = iSortFlags;
+	lpdl->fSortRev = fSortRev;
+
+	if (lpsf && lpdl->bWatchChanges && !lpdl->bRecursive) {
+		// start watching before enumeration, changes are applied after enumeration finished
+		lpdl->hWatchDir = CreateFile(lpszDir, FILE_LIST_DIRECTORY, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+			nullptr, OPEN_EXISTING, FILE_FLAG_BACKUP_SEMANTICS | FILE_FLAG_OVERLAPPED, nullptr);
+		if (lpdl->hWatchDir != INVALID_HANDLE_VALUE) {
+			lpdl->watcher.workerThread = CreateThread(nullptr, 0, DirList_WatchThread, lpdl, 0, nullptr);
+		}
+	}
 
-	// Set column width to fit window
-	ListView_SetColumnWidth(hwnd, 0, LVSCW_AUTOSIZE_USEHEADER);
-
-	// Sort before display is updated
-	DirList_Sort(hwnd, iSortFlags, fSortRev);
+	if (lpsf) {
+		lpdl->enumerator.workerThread = CreateThread(nullptr, 0, (lpdl->bRecursive ? DirList_SearchThread : DirList_EnumThread), lpdl, 0, nullptr);
+		if (lpdl->enumerator.workerThread) {
+			lpdl->filling = true;
+			// wait a moment to avoid flicker for small directory
+			WaitForSingleObject(lpdl->enumerator.workerThread, DL_FILL_SYNC_TIMEOUT);
+			DirList_FillUpdate(hwnd);
+		}
+	}
+	if (!lpdl->filling) {
+		// Set column width to fit window
+		ListView_SetColumnWidth(hwnd, 0, LVSCW_AUTOSIZE_USEHEADER);
+	}
 
 	// Redraw Listview
 	SendMessage(hwnd, WM_SETREDRAW, 1, 0);
@@ -251,87 +923,284 @@ int DirList_Fill(HWND hwnd, LPCWSTR lpszDir, DWORD grfFlags, LPCWSTR lpszFileSpe
 
 //=============================================================================
 //
-//  DirList_IconThread()
+//  DirList_FillUpdate()
 //
-//  Thread to extract file icons in the background
+//  Must be called in response to APPM_DIRLIST_FILL, appends enumerated items
+//  and returns true when the enumeration is finished
 //
-DWORD WINAPI DirList_IconThread(LPVOID lpParam) {
-	DLDATA * const lpdl = static_cast<DLDATA *>(lpParam);
-	const BackgroundWorker &worker = lpdl->worker;
+bool DirList_FillUpdate(HWND hwnd) {
+	DLDATA * const lpdl = DirList_GetData(hwnd);
+	if (!lpdl->filling) {
+		return false;
+	}
 
-	// Exit immediately if DirList_Fill() hasn't been called
-	if (!lpdl->lpsf) {
-		return 0;
+	AcquireSRWLockExclusive(&lpdl->lock);
+	UINT count = lpdl->pendingCount;
+	if (count != 0 && DirList_Reserve(&lpdl->items, &lpdl->itemCapacity, lpdl->itemCount + count)) {
+		memcpy(lpdl->items + lpdl->itemCount, lpdl->pendingItems, count*sizeof(DL_ITEM));
+		lpdl->itemCount += count;
+	} else {
+		count = 0;
+	}
+	const bool done = lpdl->fillDone;
+	lpdl->pendingCount = 0;
+	lpdl->notifyPosted = false;
+	ReleaseSRWLockExclusive(&lpdl->lock);
+
+	if (count != 0 || done) {
+		SendMessage(hwnd, WM_SETREDRAW, 0, 0);
+		ListView_SetItemCountEx(hwnd, lpdl->itemCount, LVSICF_NOINVALIDATEALL | LVSICF_NOSCROLL);
+
+		if (done) {
+			lpdl->filling = false;
+			lpdl->enumerator.Cancel();
+			// Set column width to fit window
+			ListView_SetColumnWidth(hwnd, 0, LVSCW_AUTOSIZE_USEHEADER);
+			// Sort before display is updated
+			DirList_Sort(hwnd, lpdl->iSortFlags, lpdl->fSortRev);
+			// changes during enumeration are not handled
+			AcquireSRWLockShared(&lpdl->lock);
+			const bool changed = lpdl->changePosted;
+			ReleaseSRWLockShared(&lpdl->lock);
+			if (changed) {
+				PostMessage(lpdl->hwndNotify, APPM_DIRLIST_CHANGE, 0, 0);
+			}
+		}
+		SendMessage(hwnd, WM_SETREDRAW, 1, 0);
 	}
+	return done;
+}
 
-	HWND hwnd = worker.hwnd;
-	const int iMaxItem = ListView_GetItemCount(hwnd);
+//=============================================================================
+//
+//  DirList_IsFilling()
+//
+bool DirList_IsFilling(HWND hwnd) noexcept {
+	const DLDATA * const lpdl = DirList_GetData(hwnd);
+	return lpdl->filling;
+}
 
-	// Get IShellIcon
-	IShellIcon *lpshi;
-	lpdl->lpsf->QueryInterface(IID_IShellIcon, AsPPVArgs(&lpshi));
+//=============================================================================
+//
+//  DirList_IconThread()
+//
+//  Thread to extract file icons in the background, it runs a small pool of
+//  icon workers and waits for them. Visible items are processed first, then
+//  their neighbours. The item array is not changed while the thread is running
+//
+static bool DirList_IsSharedIconExt(LPCWSTR pszExt) noexcept {
+	// files with these extensions have their own icon
+	static const LPCWSTR extList[] = {
+		L".exe", L".ico", L".cur", L".ani", L".lnk", L".url", L".pif", L".scr", L".cpl", L".appref-ms",
+	};
+	if (StrIsEmpty(pszExt) || lstrlen(pszExt) >= DL_ICONCACHE_EXT_SIZE) {
+		return false;
+	}
+	for (LPCWSTR ext : extList) {
+		if (StrCaseEqual(pszExt, ext)) {
+			return false;
+		}
+	}
+	return true;
+}
 
-	int iItem = 0;
-	while (iItem < iMaxItem && worker.Continue()) {
-		LV_ITEM lvi;
-		lvi.iItem = iItem;
-		lvi.mask = LVIF_PARAM;
-		if (ListView_GetItem(hwnd, &lvi)) {
-			LV_ITEMDATA *lplvid = AsPointer<LV_ITEMDATA *>(lvi.lParam);
-			lvi.mask = LVIF_IMAGE;
-
-			if (!lpshi || S_OK != lpshi->GetIconOf(reinterpret_cast<PCUITEMID_CHILD>(lplvid->pidl), GIL_FORSHELL, &lvi.iImage)) {
-				SHFILEINFO shfi;
-				LPITEMIDLIST pidl = IL_Create(lpdl->pidl, lpdl->cbidl, lplvid->pidl, 0);
-				SHGetFileInfo(reinterpret_cast<LPCWSTR>(pidl), 0, &shfi, sizeof(SHFILEINFO), SHGFI_PIDL | SHGFI_SYSICONINDEX | SHGFI_SMALLICON);
-				CoTaskMemFree(pidl);
-				lvi.iImage = shfi.iIcon;
+static int DirList_GetExtIcon(DLDATA *lpdl, LPCWSTR pszExt) noexcept {
+	WCHAR szExt[DL_ICONCACHE_EXT_SIZE];
+	lstrcpy(szExt, pszExt);
+	CharLower(szExt);
+	UINT hash = 0;
+	for (LPCWSTR p = szExt; *p; p++) {
+		hash = hash*31 + *p;
+	}
+
+	AcquireSRWLockShared(&lpdl->iconCacheLock);
+	int iImage = -1;
+	for (UINT index = hash & (DL_ICONCACHE_SIZE - 1); ; index = (index + 1) & (DL_ICONCACHE_SIZE - 1)) {
+		const DL_ICONCACHE &entry = lpdl->iconCache[index];
+		if (entry.szExt[0] == L'\0') {
+			break;
+		}
+		if (StrEqual(entry.szExt, szExt)) {
+			iImage = entry.iImage;
+			break;
+		}
+	}
+	ReleaseSRWLockShared(&lpdl->iconCacheLock);
+	if (iImage >= 0) {
+		return iImage;
+	}
+
+	SHFILEINFO shfi;
+	SHGetFileInfo(szExt, FILE_ATTRIBUTE_NORMAL, &shfi, sizeof(SHFILEINFO), SHGFI_USEFILEATTRIBUTES | SHGFI_SMALLICON | SHGFI_SYSICONINDEX);
+	iImage = shfi.iIcon;
+
+	AcquireSRWLockExclusive(&lpdl->iconCacheLock);
+	// keep the table sparse, other extensions are resolved each time
+	if (lpdl->iconCacheCount < DL_ICONCACHE_SIZE*3/4) {
+		for (UINT index = hash & (DL_ICONCACHE_SIZE - 1); ; index = (index + 1) & (DL_ICONCACHE_SIZE - 1)) {
+			DL_ICONCACHE &entry = lpdl->iconCache[index];
+			if (entry.szExt[0] == L'\0') {
+				lstrcpy(entry.szExt, szExt);
+				entry.iImage = iImage;
+				lpdl->iconCacheCount++;
+				break;
 			}
+			if (StrEqual(entry.szExt, szExt)) {
+				break;
+			}
+		}
+	}
+	ReleaseSRWLockExclusive(&lpdl->iconCacheLock);
+	return iImage;
+}
 
-			// It proved necessary to reset the state bits...
-			lvi.stateMask = 0;
-			lvi.state = 0;
+static void DirList_ExtractIcon(DLDATA *lpdl, IShellIcon *lpshi, DL_ITEM *item) noexcept {
+	int iImage;
+	DWORD dwAttributes = lpdl->bShareOverlay ? (SFGAO_LINK | SFGAO_SHARE) : 0;
+	if (!(item->dwAttributes & FILE_ATTRIBUTE_DIRECTORY) && DirList_IsSharedIconExt(item->pszExt)) {
+		// most files share the icon of their type
+		iImage = DirList_GetExtIcon(lpdl, item->pszExt);
+	} else {
+		const bool child = IL_Next(item->pidl)->mkid.cb == 0;
+		if (!child || !lpshi || S_OK != lpshi->GetIconOf(reinterpret_cast<PCUITEMID_CHILD>(item->pidl), GIL_FORSHELL, &iImage)) {
+			SHFILEINFO shfi;
+			LPITEMIDLIST pidl = IL_Create(lpdl->pidl, lpdl->cbidl, item->pidl, 0);
+			SHGetFileInfo(reinterpret_cast<LPCWSTR>(pidl), 0, &shfi, sizeof(SHFILEINFO), SHGFI_PIDL | SHGFI_SYSICONINDEX | SHGFI_SMALLICON);
+			CoTaskMemFree(pidl);
+			iImage = shfi.iIcon;
+		}
+		dwAttributes |= SFGAO_LINK;
+	}
 
-			DWORD dwAttributes = SFGAO_LINK | SFGAO_SHARE;
-			// Link and Share Overlay
-			lplvid->lpsf->GetAttributesOf(1, reinterpret_cast<PCUITEMID_CHILD_ARRAY>(&lplvid->pidl), &dwAttributes);
+	UINT overlay = 0;
+	if (dwAttributes) {
+		// Link and Share Overlay
+		LPCITEMIDLIST pidl;
+		LPITEMIDLIST pidlAbsolute;
+		LPSHELLFOLDER lpsf = DirList_BindItem(lpdl, item, &pidl, &pidlAbsolute);
+		if (lpsf) {
+			lpsf->GetAttributesOf(1, reinterpret_cast<PCUITEMID_CHILD_ARRAY>(&pidl), &dwAttributes);
+			lpsf->Release();
+		} else {
+			dwAttributes = 0;
+		}
+		CoTaskMemFree(pidlAbsolute);
+		if (dwAttributes & SFGAO_LINK) {
+			overlay = INDEXTOOVERLAYMASK(2);
+		}
+		if (dwAttributes & SFGAO_SHARE) {
+			overlay = INDEXTOOVERLAYMASK(1);
+		}
+	}
 
-			if (dwAttributes & SFGAO_LINK) {
-				lvi.mask |= LVIF_STATE;
-				lvi.stateMask |= LVIS_OVERLAYMASK;
-				lvi.state |= INDEXTOOVERLAYMASK(2);
-			}
+	item->iImage = iImage;
+	item->overlay = overlay;
+	item->iconDone = true;
+}
 
-			if (dwAttributes & SFGAO_SHARE) {
-				lvi.mask |= LVIF_STATE;
-				lvi.stateMask |= LVIS_OVERLAYMASK;
-				lvi.state |= INDEXTOOVERLAYMASK(1);
-			}
+// maps processing order to item index: [first, end) first, then alternately below and above it
+static UINT DirList_IconSlotToItem(UINT slot, UINT first, UINT end, UINT count) noexcept {
+	const UINT visible = end - first;
+	if (slot < visible) {
+		return first + slot;
+	}
+	slot -= visible;
+	const UINT below = count - end;
+	const UINT pairs = min(below, first);
+	if (slot < 2*pairs) {
+		return (slot & 1) ? (first - 1 - slot/2) : (end + slot/2);
+	}
+	slot -= 2*pairs;
+	return (below > first) ? (end + pairs + slot) : (first - 1 - pairs - slot);
+}
 
-			// Fade hidden/system files
-			if (!lpdl->bNoFadeHidden) {
-				WIN32_FIND_DATA fd;
-				if (S_OK == SHGetDataFromIDList(lplvid->lpsf, reinterpret_cast<PCUITEMID_CHILD>(lplvid->pidl), SHGDFIL_FINDDATA, &fd, sizeof(WIN32_FIND_DATA))) {
-					if ((fd.dwFileAttributes & FILE_ATTRIBUTE_HIDDEN) || (fd.dwFileAttributes & FILE_ATTRIBUTE_SYSTEM)) {
-						lvi.mask |= LVIF_STATE;
-						lvi.stateMask |= LVIS_CUT;
-						lvi.state |= LVIS_CUT;
-					}
-				}
+static DWORD WINAPI DirList_IconWorker(LPVOID lpParam) {
+	DLDATA * const lpdl = static_cast<DLDATA *>(lpParam);
+	const BackgroundWorker &worker = lpdl->worker;
+	HWND hwnd = worker.hwnd;
+	const UINT count = lpdl->itemCount;
+	const HRESULT hrInit = CoInitializeEx(nullptr, COINIT_APARTMENTTHREADED);
+
+	// Get IShellIcon
+	IShellIcon *lpshi = nullptr;
+	lpdl->lpsf->QueryInterface(IID_IShellIcon, AsPPVArgs(&lpshi));
+
+	while (worker.Continue()) {
+		const UINT slot = static_cast<UINT>(InterlockedIncrement(&lpdl->iconNext) - 1);
+		if (slot >= count) {
+			break;
+		}
+
+		AcquireSRWLockShared(&lpdl->lock);
+		const UINT first = lpdl->iconFirst;
+		const UINT end = lpdl->iconEnd;
+		ReleaseSRWLockShared(&lpdl->lock);
+
+		const UINT iItem = DirList_IconSlotToItem(slot, first, end, count);
+		DL_ITEM * const item = lpdl->items + iItem;
+		if (!item->iconDone) {
+			DirList_ExtractIcon(lpdl, lpshi, item);
+			// other items are drawn with their icon when scrolled into view
+			if (iItem >= first && iItem < end) {
+				ListView_RedrawItems(hwnd, iItem, iItem);
 			}
-			lvi.iSubItem = 0;
-			ListView_SetItem(hwnd, &lvi);
 		}
-		iItem++;
 	}
 
 	if (lpshi) {
 		lpshi->Release();
 	}
+	if (SUCCEEDED(hrInit)) {
+		CoUninitialize();
+	}
+	return 0;
+}
+
+DWORD WINAPI DirList_IconThread(LPVOID lpParam) {
+	DLDATA * const lpdl = static_cast<DLDATA *>(lpParam);
+
+	// Exit immediately if DirList_Fill() hasn't been called
+	if (!lpdl->lpsf || lpdl->itemCount == 0) {
+		return 0;
+	}
 
+	SYSTEM_INFO info;
+	GetSystemInfo(&info);
+	const UINT threadCount = min<UINT>(info.dwNumberOfProcessors, DL_ICON_THREAD_COUNT);
+	HANDLE threads[DL_ICON_THREAD_COUNT];
+	UINT helperCount = 0;
+	for (UINT i = 1; i < threadCount && i*DL_ENUM_BATCH_SIZE < lpdl->itemCount; i++) {
+		HANDLE thread = CreateThread(nullptr, 0, DirList_IconWorker, lpdl, 0, nullptr);
+		if (thread) {
+			threads[helperCount++] = thread;
+		}
+	}
+
+	DirList_IconWorker(lpdl);
+	if (helperCount != 0) {
+		WaitForMultipleObjects(helperCount, threads, TRUE, INFINITE);
+		for (UINT i = 0; i < helperCount; i++) {
+			CloseHandle(threads[i]);
+		}
+	}
 	return 0;
 }
 
+//=============================================================================
+//
+//  DirList_CacheHint()
+//
+//  Must be called in response to a WM_NOTIFY/LVN_ODCACHEHINT message from
+//  the listview control, icons for the shown items are extracted first
+//
+void DirList_CacheHint(HWND hwnd, LPARAM lParam) noexcept {
+	DLDATA * const lpdl = DirList_GetData(hwnd);
+	const NMLVCACHEHINT *lpch = AsPointer<const NMLVCACHEHINT *>(lParam);
+	if (lpdl->worker.workerThread != nullptr && !lpdl->filling) {
+		DirList_SetIconRange(hwnd, lpdl, lpch->iFrom, lpch->iTo);
+	}
+}
+
 //=============================================================================
 //
 //  DirList_GetDispInfo()
@@ -340,101 +1209,432 @@ DWORD WINAPI DirList_IconThread(LPVOID lpParam) {
 //  the listview control
 //
 bool DirList_GetDispInfo(HWND hwnd, LPARAM lParam) {
-	UNREFERENCED_PARAMETER(hwnd);
-
+	const DLDATA * const lpdl = DirList_GetData(hwnd);
 	LV_DISPINFO *lpdi = AsPointer<LV_DISPINFO *>(lParam);
-	LV_ITEMDATA *lplvid = AsPointer<LV_ITEMDATA *>(lpdi->item.lParam);
 
 	// SubItem 0 is handled only
-	if (lpdi->item.iSubItem != 0) {
+	const DL_ITEM *item = DirList_GetItemData(lpdl, lpdi->item.iItem);
+	if (item == nullptr || lpdi->item.iSubItem != 0) {
 		return false;
 	}
 
 	// Text
 	if (lpdi->item.mask & LVIF_TEXT) {
-		IL_GetDisplayName(lplvid->lpsf, lplvid->pidl, SHGDN_INFOLDER, lpdi->item.pszText, lpdi->item.cchTextMax);
+		lstrcpyn(lpdi->item.pszText, item->pszName, lpdi->item.cchTextMax);
 	}
 
-	// Set values
-	lpdi->item.mask |= LVIF_DI_SETITEM;
+	// Icon
+	if (lpdi->item.mask & LVIF_IMAGE) {
+		lpdi->item.iImage = item->iImage;
+	}
+
+	// Overlay and fade hidden/system files
+	if (lpdi->item.mask & LVIF_STATE) {
+		UINT state = item->overlay;
+		if (!lpdl->bNoFadeHidden && (item->dwAttributes & (FILE_ATTRIBUTE_HIDDEN | FILE_ATTRIBUTE_SYSTEM))) {
+			state |= LVIS_CUT;
+		}
+		const UINT mask = lpdi->item.stateMask & (LVIS_CUT | LVIS_OVERLAYMASK);
+		lpdi->item.state = (lpdi->item.state & ~mask) | (state & mask);
+	}
 
 	return true;
 }
 
 //=============================================================================
 //
-//  DirList_DeleteItem()
+//  DirList_FindItem()
+//
+//  Must be called in response to a WM_NOTIFY/LVN_ODFINDITEM message from
+//  the listview control, returns index of the found item or -1
+//
+int DirList_FindItem(HWND hwnd, LPARAM lParam) noexcept {
+	const DLDATA * const lpdl = DirList_GetData(hwnd);
+	const NMLVFINDITEM *lpfi = AsPointer<const NMLVFINDITEM *>(lParam);
+	const LVFINDINFO &lvfi = lpfi->lvfi;
+
+	const UINT count = lpdl->itemCount;
+	if (count == 0 || !(lvfi.flags & (LVFI_STRING | LVFI_PARTIAL)) || lvfi.psz == nullptr) {
+		return -1;
+	}
+
+	const UINT start = (lpfi->iStart < 0 || static_cast<UINT>(lpfi->iStart) >= count) ? 0 : lpfi->iStart;
+	const UINT total = (lvfi.flags & LVFI_WRAP) ? count : count - start;
+	const bool partial = (lvfi.flags & LVFI_PARTIAL) != 0;
+	const int cch = lstrlen(lvfi.psz);
+	for (UINT n = 0; n < total; n++) {
+		UINT index = start + n;
+		if (index >= count) {
+			index -= count;
+		}
+		LPCWSTR pszName = lpdl->items[index].pszName;
+		if (partial ? (StrCmpNI(pszName, lvfi.psz, cch) == 0) : StrCaseEqual(pszName, lvfi.psz)) {
+			return index;
+		}
+	}
+	return -1;
+}
+
+//=============================================================================
+//
+//  DirList_CompareProc()
+//
+//  Compares two list items, folders are placed before files
+//
+static int dlSortFlags;
+
+static int __cdecl DirList_CompareProcFw(const void *p1, const void *p2) noexcept {
+	const DL_ITEM * const item1 = static_cast<const DL_ITEM *>(p1);
+	const DL_ITEM * const item2 = static_cast<const DL_ITEM *>(p2);
+
+	const bool folder1 = (item1->dwAttributes & FILE_ATTRIBUTE_DIRECTORY) != 0;
+	const bool folder2 = (item2->dwAttributes & FILE_ATTRIBUTE_DIRECTORY) != 0;
+	if (folder1 != folder2) {
+		return folder1 ? -1 : 1;
+	}
+
+	int result = 0;
+	switch (dlSortFlags) {
+	case DS_SIZE:
+		result = (item1->size < item2->size) ? -1 : (item1->size > item2->size);
+		break;
+
+	case DS_TYPE:
+		result = StrCmpLogicalW(item1->pszExt, item2->pszExt);
+		break;
+
+	case DS_LASTMOD:
+		result = (item1->lastWrite < item2->lastWrite) ? -1 : (item1->lastWrite > item2->lastWrite);
+		break;
+	}
+
+	if (result == 0) {
+		result = StrCmpLogicalW(item1->pszName, item2->pszName);
+	}
+	return result;
+}
+
+static int __cdecl DirList_CompareProcRw(const void *p1, const void *p2) noexcept {
+	return -DirList_CompareProcFw(p1, p2);
+}
+
+// selection and focus of owner data listview are stored by index,
+// mark them on the items before the items are rearranged
+static int DirList_MarkSelection(HWND hwnd, DLDATA *lpdl) noexcept {
+	const int iSelected = ListView_GetNextItem(hwnd, -1, LVNI_ALL | LVNI_SELECTED);
+	const int iFocused = ListView_GetNextItem(hwnd, -1, LVNI_ALL | LVNI_FOCUSED);
+	if (iSelected >= 0 && static_cast<UINT>(iSelected) < lpdl->itemCount) {
+		lpdl->items[iSelected].mark |= DL_MARK_SELECTED;
+	}
+	if (iFocused >= 0 && static_cast<UINT>(iFocused) < lpdl->itemCount) {
+		lpdl->items[iFocused].mark |= DL_MARK_FOCUSED;
+	}
+	return (iSelected >= 0 || iFocused >= 0) ? iFocused : -2;
+}
+
+// iFocused is the index returned by DirList_MarkSelection()
+static void DirList_RestoreSelection(HWND hwnd, DLDATA *lpdl, int iFocused) noexcept {
+	int iNewSelected = -1;
+	int iNewFocused = -1;
+	for (UINT i = 0; i < lpdl->itemCount; i++) {
+		DL_ITEM &item = lpdl->items[i];
+		if (item.mark & DL_MARK_SELECTED) {
+			iNewSelected = i;
+		}
+		if (item.mark & DL_MARK_FOCUSED) {
+			iNewFocused = i;
+		}
+		item.mark = 0;
+	}
+	if (iFocused == -2) {
+		return;
+	}
+
+	// focused item is removed, focus the item at same position
+	if (iNewFocused < 0 && iFocused >= 0 && lpdl->itemCount != 0) {
+		iNewFocused = min<int>(iFocused, lpdl->itemCount - 1);
+	}
+	ListView_SetItemState(hwnd, -1, 0, LVIS_SELECTED | LVIS_FOCUSED);
+	if (iNewSelected >= 0) {
+		ListView_SetItemState(hwnd, iNewSelected, LVIS_SELECTED, LVIS_SELECTED);
+	}
+	if (iNewFocused >= 0) {
+		ListView_SetItemState(hwnd, iNewFocused, LVIS_FOCUSED, LVIS_FOCUSED);
+	}
+}
+
+//=============================================================================
+//
+//  DirList_Sort()
 //
-//  Must be called in response to a WM_NOTIFY/LVN_DELETEITEM message
-//  from the control
+//  Sorts the listview control by the specified order
 //
-bool DirList_DeleteItem(HWND hwnd, LPARAM lParam) {
-	const NM_LISTVIEW *lpnmlv = AsPointer<NM_LISTVIEW *>(lParam);
+BOOL DirList_Sort(HWND hwnd, int lFlags, bool fRev) noexcept {
+	// applied again after background enumeration finished
+	DLDATA * const lpdl = DirList_GetData(hwnd);
+	lpdl->iSortFlags = lFlags;
+	lpdl->fSortRev = fRev;
+	if (lpdl->itemCount == 0) {
+		return TRUE;
+	}
 
-	LV_ITEM lvi;
-	lvi.iItem = lpnmlv->iItem;
-	lvi.iSubItem = 0;
-	lvi.mask = LVIF_PARAM;
+	// item array is read by the icon thread
+	const bool restart = lpdl->worker.workerThread != nullptr && !lpdl->filling;
+	lpdl->worker.Cancel();
 
-	if (ListView_GetItem(hwnd, &lvi)) {
-		// Free mem
-		LV_ITEMDATA *lplvid = AsPointer<LV_ITEMDATA *>(lvi.lParam);
-		CoTaskMemFree(lplvid->pidl);
-		lplvid->lpsf->Release();
-		CoTaskMemFree(lplvid);
-		return true;
+	const int iFocused = DirList_MarkSelection(hwnd, lpdl);
+	dlSortFlags = lFlags;
+	qsort(lpdl->items, lpdl->itemCount, sizeof(DL_ITEM), (fRev ? DirList_CompareProcRw : DirList_CompareProcFw));
+	DirList_RestoreSelection(hwnd, lpdl, iFocused);
+	ListView_RedrawItems(hwnd, 0, lpdl->itemCount - 1);
+
+	if (restart) {
+		DirList_StartIconThread(hwnd);
 	}
-	return false;
+	return TRUE;
 }
 
 //=============================================================================
 //
-//  DirList_CompareProc()
+//  DirList_WatchUpdate()
 //
-//  Compares two list items
+//  Must be called in response to APPM_DIRLIST_CHANGE, applies changes of
+//  current directory to the items, returns false when the list must be refilled
 //
-int CALLBACK DirList_CompareProcFw(LPARAM lp1, LPARAM lp2, LPARAM lFlags) {
-	const LV_ITEMDATA * const lplvid1 = AsPointer<const LV_ITEMDATA *>(lp1);
-	const LV_ITEMDATA * const lplvid2 = AsPointer<const LV_ITEMDATA *>(lp2);
+static inline UINT DirList_HashName(LPCWSTR name) noexcept {
+	UINT hash = 0;
+	while (*name) {
+		UINT ch = *name++;
+		if (ch >= 'A' && ch <= 'Z') {
+			ch |= 0x20;
+		}
+		hash = hash*31 + ch;
+	}
+	return hash;
+}
 
-	HRESULT hr = lplvid1->lpsf->CompareIDs(lFlags, reinterpret_cast<PCUIDLIST_RELATIVE>(lplvid1->pidl), reinterpret_cast<PCUIDLIST_RELATIVE>(lplvid2->pidl));
-	int result = static_cast<short>(HRESULT_CODE(hr));
+struct DL_NAMEINDEX {
+	UINT *slots;	// item index + 1, 0 for empty slot
+	UINT mask;
 
-	if (result != 0 || lFlags == 0) {
-		return result;
+	bool Init(UINT count) noexcept {
+		UINT size = 64;
+		while (size < count*2) {
+			size <<= 1;
+		}
+		mask = size - 1;
+		slots = static_cast<UINT *>(NP2HeapAlloc(size*sizeof(UINT)));
+		return slots != nullptr;
+	}
+	void Insert(const DL_ITEM *items, UINT index) noexcept {
+		UINT slot = DirList_HashName(items[index].pszFileName) & mask;
+		while (slots[slot]) {
+			slot = (slot + 1) & mask;
+		}
+		slots[slot] = index + 1;
+	}
+	int Find(const DL_ITEM *items, LPCWSTR name) const noexcept {
+		UINT slot = DirList_HashName(name) & mask;
+		while (slots[slot]) {
+			const DL_ITEM &item = items[slots[slot] - 1];
+			if (!(item.mark & DL_MARK_REMOVED) && StrCaseEqual(item.pszFileName, name)) {
+				return slots[slot] - 1;
+			}
+			slot = (slot + 1) & mask;
+		}
+		return -1;
 	}
+};
 
-	hr = lplvid1->lpsf->CompareIDs(0, reinterpret_cast<PCUIDLIST_RELATIVE>(lplvid1->pidl), reinterpret_cast<PCUIDLIST_RELATIVE>(lplvid2->pidl));
-	result = static_cast<short>(HRESULT_CODE(hr));
+// create item for changed file, return false when the file is not listed
+static bool DirList_ParseItem(DLDATA *lpdl, LPCWSTR name, DL_ITEM *item) noexcept {
+	WCHAR szName[MAX_PATH];
+	lstrcpyn(szName, name, COUNTOF(szName));
+	PIDLIST_RELATIVE pidl = nullptr;
+	ULONG dwAttributes = SFGAO_FILESYSTEM | SFGAO_FOLDER;
+	if (S_OK != lpdl->lpsf->ParseDisplayName(nullptr, nullptr, szName, nullptr, &pidl, &dwAttributes)) {
+		return false;
+	}
 
+	bool result = false;
+	PCUITEMID_CHILD pidlEntry = reinterpret_cast<PCUITEMID_CHILD>(pidl);
+	// same check as DirList_EnumThread()
+	if (dwAttributes & SFGAO_FILESYSTEM) {
+		WIN32_FIND_DATA fd;
+		DirList_GetFindData(lpdl->lpsf, pidlEntry, dwAttributes, &fd);
+		const bool folder = (fd.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) != 0;
+		result = (lpdl->grfFlags & (folder ? SHCONTF_FOLDERS : SHCONTF_NONFOLDERS))
+			&& ((lpdl->grfFlags & SHCONTF_INCLUDEHIDDEN) || !(fd.dwFileAttributes & FILE_ATTRIBUTE_HIDDEN))
+			&& lpdl->dlf.Match(fd.cFileName, fd.dwFileAttributes)
+			&& DirList_MakeItem(lpdl, pidlEntry, fd, nullptr, item);
+	}
+	CoTaskMemFree(pidl);
 	return result;
 }
 
-int CALLBACK DirList_CompareProcRw(LPARAM lp1, LPARAM lp2, LPARAM lFlags) {
-	const LV_ITEMDATA * const lplvid1 = AsPointer<const LV_ITEMDATA *>(lp1);
-	const LV_ITEMDATA * const lplvid2 = AsPointer<const LV_ITEMDATA *>(lp2);
+// arena is rebuilt when most of it is used by removed items
+static void DirList_CompactArena(DLDATA *lpdl) noexcept {
+	const UINT count = lpdl->itemCount;
+	DL_ITEM *items = static_cast<DL_ITEM *>(NP2HeapAlloc(max(count, 1U)*sizeof(DL_ITEM)));
+	if (items == nullptr) {
+		return;
+	}
+
+	DL_ARENABLOCK * const arena = lpdl->arena;
+	lpdl->arena = nullptr;
+	memcpy(items, lpdl->items, count*sizeof(DL_ITEM));
+	for (UINT i = 0; i < count; i++) {
+		if (!DirList_CopyItem(lpdl, items + i)) {
+			// out of memory, keep current arena
+			DirList_FreeArena(lpdl->arena);
+			lpdl->arena = arena;
+			NP2HeapFree(items);
+			return;
+		}
+	}
 
-	HRESULT hr = lplvid1->lpsf->CompareIDs(lFlags, reinterpret_cast<PCUIDLIST_RELATIVE>(lplvid1->pidl), reinterpret_cast<PCUIDLIST_RELATIVE>(lplvid2->pidl));
-	int result = -static_cast<short>(HRESULT_CODE(hr));
+	DirList_FreeArena(arena);
+	NP2HeapFree(lpdl->items);
+	lpdl->items = items;
+	lpdl->itemCapacity = max(count, 1U);
+	lpdl->staleCount = 0;
+}
 
-	if (result != 0) {
-		return result;
+static void DirList_ApplyChanges(DLDATA *lpdl, const DL_CHANGE *changes, UINT count, LPCWSTR names) noexcept {
+	const UINT sortedCount = lpdl->itemCount;
+	DL_NAMEINDEX nameIndex;
+	if (!nameIndex.Init(sortedCount + count)) {
+		return;
+	}
+	for (UINT i = 0; i < sortedCount; i++) {
+		nameIndex.Insert(lpdl->items, i);
 	}
 
-	hr = lplvid1->lpsf->CompareIDs(0, reinterpret_cast<PCUIDLIST_RELATIVE>(lplvid1->pidl), reinterpret_cast<PCUIDLIST_RELATIVE>(lplvid2->pidl));
-	result = -static_cast<short>(HRESULT_CODE(hr));
+	BYTE renamedMark = 0;
+	for (UINT i = 0; i < count; i++) {
+		const DWORD action = changes[i].action;
+		LPCWSTR name = names + changes[i].name;
+		// skip repeated modification of same file
+		if (action == FILE_ACTION_MODIFIED && i != 0 && changes[i - 1].action == FILE_ACTION_MODIFIED
+			&& StrEqual(name, names + changes[i - 1].name)) {
+			continue;
+		}
 
-	return result;
+		const int iItem = nameIndex.Find(lpdl->items, name);
+		BYTE mark = 0;
+		if (iItem >= 0) {
+			// changed item is inserted again to keep sort order
+			DL_ITEM &item = lpdl->items[iItem];
+			mark = item.mark;
+			item.mark |= DL_MARK_REMOVED;
+			lpdl->staleCount++;
+		}
+		if (action == FILE_ACTION_REMOVED || action == FILE_ACTION_RENAMED_OLD_NAME) {
+			renamedMark = (action == FILE_ACTION_RENAMED_OLD_NAME) ? mark : 0;
+			continue;
+		}
+		if (action == FILE_ACTION_RENAMED_NEW_NAME) {
+			mark |= renamedMark;
+			renamedMark = 0;
+		}
+
+		DL_ITEM item;
+		if (DirList_ParseItem(lpdl, name, &item)
+			&& DirList_Reserve(&lpdl->items, &lpdl->itemCapacity, lpdl->itemCount + 1)) {
+			item.mark = mark & (DL_MARK_SELECTED | DL_MARK_FOCUSED);
+			lpdl->items[lpdl->itemCount] = item;
+			nameIndex.Insert(lpdl->items, lpdl->itemCount);
+			lpdl->itemCount++;
+		}
+	}
+	NP2HeapFree(nameIndex.slots);
+
+	// sort appended items, then merge them with sorted items
+	DL_ITEM * const items = lpdl->items;
+	const UINT totalCount = lpdl->itemCount;
+	const auto cmp = lpdl->fSortRev ? DirList_CompareProcRw : DirList_CompareProcFw;
+	dlSortFlags = lpdl->iSortFlags;
+	qsort(items + sortedCount, totalCount - sortedCount, sizeof(DL_ITEM), cmp);
+
+	DL_ITEM *merged = static_cast<DL_ITEM *>(NP2HeapAlloc(max(totalCount, 1U)*sizeof(DL_ITEM)));
+	UINT n = 0;
+	if (merged != nullptr) {
+		UINT i = 0;
+		UINT j = sortedCount;
+		while (i < sortedCount || j < totalCount) {
+			if (i < sortedCount && (items[i].mark & DL_MARK_REMOVED)) {
+				i++;
+			} else if (j < totalCount && (items[j].mark & DL_MARK_REMOVED)) {
+				j++;
+			} else if (j == totalCount || (i < sortedCount && cmp(items + i, items + j) <= 0)) {
+				merged[n++] = items[i++];
+			} else {
+				merged[n++] = items[j++];
+			}
+		}
+		NP2HeapFree(items);
+		lpdl->items = merged;
+		lpdl->itemCapacity = max(totalCount, 1U);
+	} else {
+		for (UINT i = 0; i < totalCount; i++) {
+			if (!(items[i].mark & DL_MARK_REMOVED)) {
+				items[n++] = items[i];
+			}
+		}
+		qsort(items, n, sizeof(DL_ITEM), cmp);
+	}
+	lpdl->itemCount = n;
+
+	if (lpdl->staleCount > max(n, static_cast<UINT>(DL_WATCH_COMPACT_COUNT))) {
+		DirList_CompactArena(lpdl);
+	}
 }
 
-//=============================================================================
-//
-//  DirList_Sort()
-//
-//  Sorts the listview control by the specified order
-//
-BOOL DirList_Sort(HWND hwnd, int lFlags, bool fRev) noexcept {
-	return ListView_SortItems(hwnd, (fRev? DirList_CompareProcRw : DirList_CompareProcFw), lFlags);
+bool DirList_WatchUpdate(HWND hwnd) {
+	DLDATA * const lpdl = DirList_GetData(hwnd);
+	// changes are posted again after enumeration finished
+	if (lpdl->filling || lpdl->applying || lpdl->lpsf == nullptr) {
+		return true;
+	}
+
+	// item array is read by the icon thread
+	lpdl->applying = true;
+	lpdl->worker.Cancel();
+
+	AcquireSRWLockExclusive(&lpdl->lock);
+	DL_CHANGE * const changes = lpdl->changes;
+	WCHAR * const names = lpdl->changeNames;
+	const UINT count = lpdl->changeCount;
+	const bool overflow = lpdl->changeOverflow;
+	lpdl->changes = nullptr;
+	lpdl->changeCount = 0;
+	lpdl->changeCapacity = 0;
+	lpdl->changeNames = nullptr;
+	lpdl->changeNameLength = 0;
+	lpdl->changeNameCapacity = 0;
+	lpdl->changeOverflow = false;
+	lpdl->changePosted = false;
+	ReleaseSRWLockExclusive(&lpdl->lock);
+
+	if (count != 0 && !overflow) {
+		const int iFocused = DirList_MarkSelection(hwnd, lpdl);
+		DirList_ApplyChanges(lpdl, changes, count, names);
+		SendMessage(hwnd, WM_SETREDRAW, 0, 0);
+		ListView_SetItemCountEx(hwnd, lpdl->itemCount, LVSICF_NOINVALIDATEALL | LVSICF_NOSCROLL);
+		DirList_RestoreSelection(hwnd, lpdl, iFocused);
+		SendMessage(hwnd, WM_SETREDRAW, 1, 0);
+		InvalidateRect(hwnd, nullptr, TRUE);
+	}
+	if (changes) {
+		NP2HeapFree(changes);
+	}
+	if (names) {
+		NP2HeapFree(names);
+	}
+
+	lpdl->applying = false;
+	DirList_StartIconThread(hwnd);
+	return !overflow;
 }
 
 //=============================================================================
@@ -452,40 +1652,35 @@ int DirList_GetItem(HWND hwnd, int iItem, DirListItem *lpdli) {
 		}
 	}
 
-	LV_ITEM lvi;
-	lvi.mask = LVIF_PARAM;
-	lvi.iItem = iItem;
-	lvi.iSubItem = 0;
-
-	if (!ListView_GetItem(hwnd, &lvi)) {
+	const DLDATA * const lpdl = DirList_GetData(hwnd);
+	const DL_ITEM *item = DirList_GetItemData(lpdl, iItem);
+	if (item == nullptr) {
 		if (lpdli->mask & DLI_TYPE) {
 			lpdli->ntype = DLE_NONE;
 		}
 		return -1;
 	}
 
-	LV_ITEMDATA *lplvid = AsPointer<LV_ITEMDATA *>(lvi.lParam);
-
 	// Filename
 	if (lpdli->mask & DLI_FILENAME) {
-		IL_GetDisplayName(lplvid->lpsf, lplvid->pidl, SHGDN_FORPARSING, lpdli->szFileName, MAX_PATH);
+		LPCITEMIDLIST pidl;
+		LPITEMIDLIST pidlAbsolute;
+		LPSHELLFOLDER lpsf = DirList_BindItem(lpdl, item, &pidl, &pidlAbsolute);
+		if (lpsf) {
+			IL_GetDisplayName(lpsf, pidl, SHGDN_FORPARSING, lpdli->szFileName, MAX_PATH);
+			lpsf->Release();
+		}
+		CoTaskMemFree(pidlAbsolute);
 	}
 
 	// Displayname
 	if (lpdli->mask & DLI_DISPNAME) {
-		IL_GetDisplayName(lplvid->lpsf, lplvid->pidl, SHGDN_INFOLDER, lpdli->szDisplayName, MAX_PATH);
+		lstrcpyn(lpdli->szDisplayName, item->pszName, MAX_PATH);
 	}
 
 	// Type (File / Directory)
 	if (lpdli->mask & DLI_TYPE) {
-		WIN32_FIND_DATA fd;
-		//ULONG dwAttributes = SFGAO_FILESYSTEM;
-
-		if (S_OK == SHGetDataFromIDList(lplvid->lpsf, reinterpret_cast<PCUITEMID_CHILD>(lplvid->pidl), SHGDFIL_FINDDATA, &fd, sizeof(WIN32_FIND_DATA))) {
-			lpdli->ntype = (fd.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) ? DLE_DIR : DLE_FILE;
-		}
-		//lplvid->lpsf->GetAttributesOf(1, reinterpret_cast<PCUITEMID_CHILD_ARRAY>(&lplvid->pidl), &dwAttributes);
-		//lpdli->ntype = (dwAttributes & SFGAO_FOLDER) ? DLE_DIR : DLE_FILE;
+		lpdli->ntype = (item->dwAttributes & FILE_ATTRIBUTE_DIRECTORY) ? DLE_DIR : DLE_FILE;
 	}
 
 	return iItem;
@@ -506,20 +1701,22 @@ int DirList_GetItemEx(HWND hwnd, int iItem, LPWIN32_FIND_DATA pfd) noexcept {
 		}
 	}
 
-	LV_ITEM lvi;
-	lvi.mask = LVIF_PARAM;
-	lvi.iItem = iItem;
-	lvi.iSubItem = 0;
-
-	if (!ListView_GetItem(hwnd, &lvi)) {
+	const DLDATA * const lpdl = DirList_GetData(hwnd);
+	const DL_ITEM *item = DirList_GetItemData(lpdl, iItem);
+	if (item == nullptr) {
 		return -1;
 	}
 
-	LV_ITEMDATA *lplvid = AsPointer<LV_ITEMDATA *>(lvi.lParam);
-	if (S_OK == SHGetDataFromIDList(lplvid->lpsf, reinterpret_cast<PCUITEMID_CHILD>(lplvid->pidl), SHGDFIL_FINDDATA, pfd, sizeof(WIN32_FIND_DATA))) {
-		return iItem;
+	LPCITEMIDLIST pidl;
+	LPITEMIDLIST pidlAbsolute;
+	LPSHELLFOLDER lpsf = DirList_BindItem(lpdl, item, &pidl, &pidlAbsolute);
+	if (lpsf == nullptr) {
+		return -1;
 	}
-	return -1;
+	const HRESULT hr = SHGetDataFromIDList(lpsf, reinterpret_cast<PCUITEMID_CHILD>(pidl), SHGDFIL_FINDDATA, pfd, sizeof(WIN32_FIND_DATA));
+	lpsf->Release();
+	CoTaskMemFree(pidlAbsolute);
+	return (hr == S_OK) ? iItem : -1;
 }
 
 //=============================================================================
@@ -537,20 +1734,19 @@ bool DirList_PropertyDlg(HWND hwnd, int iItem) {
 		}
 	}
 
-	LV_ITEM lvi;
-	lvi.mask = LVIF_PARAM;
-	lvi.iItem = iItem;
-	lvi.iSubItem = 0;
-
-	if (!ListView_GetItem(hwnd, &lvi)) {
+	const DLDATA * const lpdl = DirList_GetData(hwnd);
+	const DL_ITEM *item = DirList_GetItemData(lpdl, iItem);
+	if (item == nullptr) {
 		return false;
 	}
 
 	bool bSuccess = true;
-	LV_ITEMDATA *lplvid = AsPointer<LV_ITEMDATA *>(lvi.lParam);
+	LPCITEMIDLIST pidl;
+	LPITEMIDLIST pidlAbsolute;
+	LPSHELLFOLDER lpsf = DirList_BindItem(lpdl, item, &pidl, &pidlAbsolute);
 	LPCONTEXTMENU lpcm;
 
-	if (S_OK == lplvid->lpsf->GetUIObjectOf(GetParent(hwnd), 1, reinterpret_cast<PCUITEMID_CHILD_ARRAY>(&lplvid->pidl), IID_IContextMenu, nullptr, AsPPVArgs(&lpcm))) {
+	if (lpsf && S_OK == lpsf->GetUIObjectOf(GetParent(hwnd), 1, reinterpret_cast<PCUITEMID_CHILD_ARRAY>(&pidl), IID_IContextMenu, nullptr, AsPPVArgs(&lpcm))) {
 		CMINVOKECOMMANDINFO cmi;
 		cmi.cbSize = sizeof(CMINVOKECOMMANDINFO);
 		cmi.fMask = 0;
@@ -571,6 +1767,10 @@ bool DirList_PropertyDlg(HWND hwnd, int iItem) {
 		bSuccess = false;
 	}
 
+	if (lpsf) {
+		lpsf->Release();
+	}
+	CoTaskMemFree(pidlAbsolute);
 	return bSuccess;
 }
 
@@ -582,16 +1782,15 @@ bool DirList_PropertyDlg(HWND hwnd, int iItem) {
 //
 void DirList_DoDragDrop(HWND hwnd, LPARAM lParam) {
 	const NM_LISTVIEW *pnmlv = AsPointer<NM_LISTVIEW *>(lParam);
+	const DLDATA * const lpdl = DirList_GetData(hwnd);
+	const DL_ITEM *item = DirList_GetItemData(lpdl, pnmlv->iItem);
 
-	LV_ITEM lvi;
-	lvi.iItem = pnmlv->iItem;
-	lvi.iSubItem = 0;
-	lvi.mask = LVIF_PARAM;
-
-	if (ListView_GetItem(hwnd, &lvi)) {
-		LV_ITEMDATA *lplvid = AsPointer<LV_ITEMDATA *>(lvi.lParam);
+	if (item != nullptr) {
+		LPCITEMIDLIST pidl;
+		LPITEMIDLIST pidlAbsolute;
+		LPSHELLFOLDER lpsf = DirList_BindItem(lpdl, item, &pidl, &pidlAbsolute);
 		LPDATAOBJECT lpdo;
-		if (SUCCEEDED(lplvid->lpsf->GetUIObjectOf(GetParent(hwnd), 1, reinterpret_cast<PCUITEMID_CHILD_ARRAY>(&lplvid->pidl), IID_IDataObject, nullptr, AsPPVArgs(&lpdo)))) {
+		if (lpsf && SUCCEEDED(lpsf->GetUIObjectOf(GetParent(hwnd), 1, reinterpret_cast<PCUITEMID_CHILD_ARRAY>(&pidl), IID_IDataObject, nullptr, AsPPVArgs(&lpdo)))) {
 			CDropSource lpds;
 			DWORD dwEffect;
 
@@ -599,6 +1798,10 @@ void DirList_DoDragDrop(HWND hwnd, LPARAM lParam) {
 
 			lpdo->Release();
 		}
+		if (lpsf) {
+			lpsf->Release();
+		}
+		CoTaskMemFree(pidlAbsolute);
 	}
 }
 
@@ -610,7 +1813,7 @@ void DirList_DoDragDrop(HWND hwnd, LPARAM lParam) {
 //
 bool DirList_GetLongPathName(HWND hwnd, LPWSTR lpszLongPath) noexcept {
 	WCHAR tch[MAX_PATH];
-	const DLDATA * const lpdl = static_cast<DLDATA *>(GetProp(hwnd, pDirListProp));
+	const DLDATA * const lpdl = DirList_GetData(hwnd);
 	if (SHGetPathFromIDList(reinterpret_cast<PCIDLIST_ABSOLUTE>(lpdl->pidl), tch)) {
 		lstrcpy(lpszLongPath, tch);
 		return true;
@@ -641,15 +1844,15 @@ bool DirList_SelectItem(HWND hwnd, LPCWSTR lpszDisplayName, LPCWSTR lpszFullPath
 		lstrcpyn(shfi.szDisplayName, lpszDisplayName, MAX_PATH);
 	}
 
-	LV_FINDINFO lvfi;
-	lvfi.flags = LVFI_STRING;
-	lvfi.psz = shfi.szDisplayName;
-
+	const DLDATA * const lpdl = DirList_GetData(hwnd);
 	DirListItem dli;
-	dli.mask = DLI_ALL;
+	dli.mask = DLI_FILENAME;
+
+	for (UINT i = 0; i < lpdl->itemCount; i++) {
+		if (!StrCaseEqual(lpdl->items[i].pszName, shfi.szDisplayName)) {
+			continue;
+		}
 
-	int i = -1;
-	while ((i = ListView_FindItem(hwnd, i, &lvfi)) >= 0) {
 		DirList_GetItem(hwnd, i, &dli);
 		GetShortPathName(dli.szFileName, dli.szFileName, MAX_PATH);
 
@@ -680,6 +1883,46 @@ bool DirList_IsFileSelected(HWND hwnd) {
 	return (i != 0 && dli.ntype == DLE_FILE);
 }
 
+// same case folding as PathMatchSpec()
+static inline UINT DL_FilterFold(UINT ch) noexcept {
+	if (ch < 0x80) {
+		return (ch >= 'A' && ch <= 'Z') ? (ch | 0x20) : ch;
+	}
+	return LOWORD(reinterpret_cast<UINT_PTR>(CharLower(reinterpret_cast<LPWSTR>(static_cast<UINT_PTR>(ch)))));
+}
+
+static inline UINT DL_FilterHash(LPCWSTR ext) noexcept {
+	UINT hash = 0;
+	while (*ext) {
+		hash = hash*31 + DL_FilterFold(*ext++);
+	}
+	return hash & (DL_FILTER_HASHSIZE - 1);
+}
+
+// "*" and "?" wildcards, backtrack to the last "*" on mismatch
+static bool DL_GlobMatch(LPCWSTR name, LPCWSTR pattern) noexcept {
+	LPCWSTR starPattern = nullptr;
+	LPCWSTR starName = nullptr;
+	while (*name) {
+		if (*pattern == L'*') {
+			starPattern = ++pattern;
+			starName = name;
+		} else if (*pattern == L'?' || (*pattern && static_cast<UINT>(*pattern) == DL_FilterFold(*name))) {
+			++pattern;
+			++name;
+		} else if (starPattern) {
+			pattern = starPattern;
+			name = ++starName;
+		} else {
+			return false;
+		}
+	}
+	while (*pattern == L'*') {
+		++pattern;
+	}
+	return *pattern == L'\0';
+}
+
 //=============================================================================
 //
 //  Create a valid DirListFilter structure
@@ -691,15 +1934,35 @@ void DirListFilter::Create(LPCWSTR lpszFileSpec, bool bExclude) noexcept {
 	}
 
 	lstrcpyn(tFilterBuf, lpszFileSpec, (DL_FILTER_BUFSIZE - 1));
+	CharLower(tFilterBuf);
 	bExcludeFilter = bExclude;
-	nCount = 1;
-	pFilter[0] = tFilterBuf;    // Zeile zum Ausprobieren
 
-	WCHAR *p;
-	while ((p = StrChr(pFilter[nCount - 1], L';')) != nullptr) {
-		*p = L'\0';                              // Replace L';' by L'\0'
-		pFilter[nCount] = (p + 1);  // Next position after L';'
-		nCount++;                         // Increase number of filters
+	// compile filters once: "*.ext" into extension hash set, others are matched as glob
+	WCHAR *p = tFilterBuf;
+	while (p) {
+		WCHAR *next = StrChr(p, L';');
+		if (next) {
+			*next++ = L'\0';
+		}
+		while (*p == L' ') {
+			++p;
+		}
+		if (*p) { // Filters like L"\0" are ignored
+			nCount++;
+			if (StrEqualEx(p, L"*") || StrEqualEx(p, L"*.*")) {
+				bMatchAll = true;
+			} else if (p[0] == L'*' && p[1] == L'.' && StrPBrk(p + 2, L".*?") == nullptr) {
+				LPCWSTR ext = p + 1;
+				UINT slot = DL_FilterHash(ext);
+				while (pExtension[slot] && !StrEqual(pExtension[slot], ext)) {
+					slot = (slot + 1) & (DL_FILTER_HASHSIZE - 1);
+				}
+				pExtension[slot] = ext;
+			} else {
+				pFilter[nGlob++] = p;
+			}
+		}
+		p = next;
 	}
 }
 
@@ -707,17 +1970,14 @@ void DirListFilter::Create(LPCWSTR lpszFileSpec, bool bExclude) noexcept {
 //
 //  Check if a specified item matches a given filter
 //
-bool DirListFilter::Match(LPSHELLFOLDER lpsf, LPCITEMIDLIST pidl) const noexcept {
+bool DirListFilter::Match(LPCWSTR lpszFileName, DWORD dwAttributes) const noexcept {
 	// Immediately return true if lpszFileSpec is *.* or nullptr
 	if (nCount == 0 && !bExcludeFilter) {
 		return true;
 	}
 
-	WIN32_FIND_DATA fd;
-	SHGetDataFromIDList(lpsf, reinterpret_cast<PCUITEMID_CHILD>(pidl), SHGDFIL_FINDDATA, &fd, sizeof(WIN32_FIND_DATA));
-
 	// All the directories are added
-	if (fd.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) {
+	if (dwAttributes & FILE_ATTRIBUTE_DIRECTORY) {
 		return true;
 	}
 
@@ -725,13 +1985,29 @@ bool DirListFilter::Match(LPSHELLFOLDER lpsf, LPCITEMIDLIST pidl) const noexcept
 	if (nCount == 0 && bExcludeFilter) {
 		return false;
 	}
+	if (bMatchAll) {
+		return !bExcludeFilter;
+	}
 
-	for (int i = 0; i < nCount; i++) {
-		if (*pFilter[i]) { // Filters like L"\0" are ignored
-			const BOOL bMatchSpec = PathMatchSpec(fd.cFileName, pFilter[i]);
-			if (bMatchSpec) {
-				return !bExcludeFilter;
-			}
+	LPCWSTR ext = PathFindExtension(lpszFileName);
+	if (*ext == L'\0') {
+		ext = L".";	// matched by "*."
+	}
+	for (UINT slot = DL_FilterHash(ext); pExtension[slot]; slot = (slot + 1) & (DL_FILTER_HASHSIZE - 1)) {
+		LPCWSTR key = pExtension[slot];
+		LPCWSTR s = ext;
+		while (*key && static_cast<UINT>(*key) == DL_FilterFold(*s)) {
+			++key;
+			++s;
+		}
+		if (*key == L'\0' && *s == L'\0') {
+			return !bExcludeFilter;
+		}
+	}
+
+	for (int i = 0; i < nGlob; i++) {
+		if (DL_GlobMatch(lpszFileName, pFilter[i])) {
+			return !bExcludeFilter;
 		}
 	}
 
@@ -743,13 +2019,139 @@ bool DirListFilter::Match(LPSHELLFOLDER lpsf, LPCITEMIDLIST pidl) const noexcept
 
 //=============================================================================
 //
-//  Internal Itemdata Structure
-//
-struct DC_ITEMDATA {
-	LPITEMIDLIST pidl;
-	LPSHELLFOLDER lpsf;
+//  Drive information, item lParam of the combo box is the drive number.
+//  Display name and icon are queried by one thread for each drive, so a slow
+//  or disconnected drive never blocks the UI or other drives.
+//
+#define DC_DRIVE_COUNT			26
+#define DC_RESOLVE_TIMEOUT		3000	// milliseconds, slower drive is not queried again
+#define DC_REFRESH_INTERVAL		60000	// milliseconds, minimum time between queries for same drive
+#define DC_INI_SECTION_SIZE		(DC_DRIVE_COUNT * (MAX_PATH + 4))
+
+struct DC_DRIVEINFO {
+	WCHAR szName[MAX_PATH];		// display name, cached between runs
+	int iIcon;					// system image list index, -1 until queried
+	DWORD dwTick;				// when last query finished
+	bool pending;				// query is running
+	bool slow;					// last query exceeded DC_RESOLVE_TIMEOUT
+};
+
+// passed to query thread and posted back with APPM_DRIVEBOX_UPDATE
+struct DC_RESOLVE {
+	HWND hwndNotify;
+	UINT drive;
+	DWORD dwStart;
+	int iIcon;
+	WCHAR szName[MAX_PATH];
 };
 
+static DC_DRIVEINFO driveInfo[DC_DRIVE_COUNT];
+static DWORD dwDriveMask;
+static int iDefaultDriveIcon;
+
+static inline void DriveBox_GetRoot(UINT drive, LPWSTR lpszRoot) noexcept {
+	lpszRoot[0] = static_cast<WCHAR>(L'A' + drive);
+	lpszRoot[1] = L':';
+	lpszRoot[2] = L'\\';
+	lpszRoot[3] = L'\0';
+}
+
+// icon for drive type, GetDriveType() doesn't access the drive
+static int DriveBox_GetDefaultIcon(LPCWSTR lpszRoot) noexcept {
+#if _WIN32_WINNT >= _WIN32_WINNT_VISTA
+	SHSTOCKICONID siid;
+	switch (GetDriveType(lpszRoot)) {
+	case DRIVE_REMOVABLE:
+		siid = SIID_DRIVEREMOVE;
+		break;
+	case DRIVE_REMOTE:
+		siid = SIID_DRIVENET;
+		break;
+	case DRIVE_CDROM:
+		siid = SIID_DRIVECD;
+		break;
+	case DRIVE_RAMDISK:
+		siid = SIID_DRIVERAM;
+		break;
+	default:
+		return iDefaultDriveIcon;
+	}
+
+	SHSTOCKICONINFO sii;
+	sii.cbSize = sizeof(SHSTOCKICONINFO);
+	if (S_OK == SHGetStockIconInfo(siid, SHGSI_SYSICONINDEX | SHGSI_SMALLICON, &sii)) {
+		return sii.iSysImageIndex;
+	}
+#else
+	UNREFERENCED_PARAMETER(lpszRoot);
+#endif
+	return iDefaultDriveIcon;
+}
+
+static DWORD WINAPI DriveBox_ResolveThread(LPVOID lpParam) noexcept {
+	DC_RESOLVE * const lpdr = static_cast<DC_RESOLVE *>(lpParam);
+	const HRESULT hrInit = CoInitializeEx(nullptr, COINIT_APARTMENTTHREADED);
+
+	WCHAR szRoot[4];
+	DriveBox_GetRoot(lpdr->drive, szRoot);
+	SHFILEINFO shfi;
+	if (SHGetFileInfo(szRoot, 0, &shfi, sizeof(SHFILEINFO), SHGFI_DISPLAYNAME | SHGFI_SYSICONINDEX | SHGFI_SMALLICON)) {
+		lstrcpyn(lpdr->szName, shfi.szDisplayName, COUNTOF(lpdr->szName));
+		lpdr->iIcon = shfi.iIcon;
+	}
+
+	if (SUCCEEDED(hrInit)) {
+		CoUninitialize();
+	}
+	if (!PostMessage(lpdr->hwndNotify, APPM_DRIVEBOX_UPDATE, 0, AsInteger<LPARAM>(lpdr))) {
+		NP2HeapFree(lpdr);
+	}
+	return 0;
+}
+
+static void DriveBox_Resolve(HWND hwnd, UINT drive, DWORD dwNow) noexcept {
+	DC_DRIVEINFO &info = driveInfo[drive];
+	if (info.pending || info.slow || (info.iIcon >= 0 && dwNow - info.dwTick < DC_REFRESH_INTERVAL)) {
+		return;
+	}
+
+	DC_RESOLVE * const lpdr = static_cast<DC_RESOLVE *>(NP2HeapAlloc(sizeof(DC_RESOLVE)));
+	if (lpdr == nullptr) {
+		return;
+	}
+	lpdr->hwndNotify = GetParent(hwnd);
+	lpdr->drive = drive;
+	lpdr->dwStart = dwNow;
+	lpdr->iIcon = -1;
+	// thread is detached, it may never finish for a hung network drive
+	HANDLE hThread = CreateThread(nullptr, 0, DriveBox_ResolveThread, lpdr, 0, nullptr);
+	if (hThread == nullptr) {
+		NP2HeapFree(lpdr);
+		return;
+	}
+	CloseHandle(hThread);
+	info.pending = true;
+}
+
+static UINT DriveBox_GetItemDrive(HWND hwnd, int iItem) noexcept {
+	COMBOBOXEXITEM cbei;
+	cbei.mask = CBEIF_LPARAM;
+	cbei.iItem = iItem;
+	cbei.lParam = 0;
+	SendMessage(hwnd, CBEM_GETITEM, 0, AsInteger<LPARAM>(&cbei));
+	return static_cast<UINT>(cbei.lParam);
+}
+
+static int DriveBox_FindItem(HWND hwnd, UINT drive) noexcept {
+	const int cbItems = ComboBox_GetCount(hwnd);
+	for (int i = 0; i < cbItems; i++) {
+		if (DriveBox_GetItemDrive(hwnd, i) == drive) {
+			return i;
+		}
+	}
+	return -1;
+}
+
 //=============================================================================
 //
 //  DriveBox_Init()
@@ -761,99 +2163,148 @@ bool DriveBox_Init(HWND hwnd) noexcept {
 	DWORD_PTR hil = SHGetFileInfo(L"C:\\", 0, &shfi, sizeof(SHFILEINFO), SHGFI_SMALLICON | SHGFI_SYSICONINDEX);
 	SendMessage(hwnd, CBEM_SETIMAGELIST, 0, hil);
 	SendMessage(hwnd, CBEM_SETEXTENDEDSTYLE, CBES_EX_NOSIZELIMIT, CBES_EX_NOSIZELIMIT);
+	iDefaultDriveIcon = shfi.iIcon;
+	for (UINT drive = 0; drive < DC_DRIVE_COUNT; drive++) {
+		driveInfo[drive].iIcon = -1;
+	}
 
 	return true;
 }
 
+//=============================================================================
+//
+//  DriveBox_LoadCache()
+//  DriveBox_SaveCache()
+//
+//  Display names from last run are shown until drives are queried
+//
+void DriveBox_LoadCache(LPCWSTR lpszSection) noexcept {
+	IniSectionParser section;
+	WCHAR *pIniSectionBuf = static_cast<WCHAR *>(NP2HeapAlloc(sizeof(WCHAR) * DC_INI_SECTION_SIZE));
+	constexpr DWORD cchIniSection = DC_INI_SECTION_SIZE;
+
+	section.Init(DC_DRIVE_COUNT);
+	LoadIniSection(lpszSection, pIniSectionBuf, cchIniSection);
+	section.ParseArray(pIniSectionBuf);
+
+	for (UINT i = 0; i < section.count; i++) {
+		const IniKeyValueNode &node = section.nodeList[i];
+		const UINT drive = static_cast<UINT>((node.key[0] | 0x20) - L'a');
+		if (drive < DC_DRIVE_COUNT && node.key[1] == L'\0') {
+			lstrcpyn(driveInfo[drive].szName, node.value, COUNTOF(driveInfo[drive].szName));
+		}
+	}
+
+	section.Free();
+	NP2HeapFree(pIniSectionBuf);
+}
+
+void DriveBox_SaveCache(LPCWSTR lpszSection) noexcept {
+	WCHAR *pIniSectionBuf = static_cast<WCHAR *>(NP2HeapAlloc(sizeof(WCHAR) * DC_INI_SECTION_SIZE));
+	IniSectionBuilder section = { pIniSectionBuf };
+
+	for (UINT drive = 0; drive < DC_DRIVE_COUNT; drive++) {
+		if (StrNotEmpty(driveInfo[drive].szName)) {
+			const WCHAR key[2] = { static_cast<WCHAR>(L'A' + drive), L'\0' };
+			section.SetString(key, driveInfo[drive].szName);
+		}
+	}
+
+	SaveIniSection(lpszSection, pIniSectionBuf);
+	NP2HeapFree(pIniSectionBuf);
+}
+
 //=============================================================================
 //
 //  DriveBox_Fill
 //
+//  Drive letters are listed immediately with cached names and default icons,
+//  display names and icons are updated by DriveBox_Update()
+//
 int DriveBox_Fill(HWND hwnd) {
-	// Init ComboBox
-	SendMessage(hwnd, WM_SETREDRAW, 0, 0);
-	ComboBox_ResetContent(hwnd);
+	const DWORD dwMask = GetLogicalDrives();
+	if (dwMask != dwDriveMask || ComboBox_GetCount(hwnd) == 0) {
+		dwDriveMask = dwMask;
+		SendMessage(hwnd, WM_SETREDRAW, 0, 0);
+		ComboBox_ResetContent(hwnd);
+
+		COMBOBOXEXITEM cbei;
+		memset(&cbei, 0, sizeof(COMBOBOXEXITEM));
+		cbei.mask = CBEIF_TEXT | CBEIF_IMAGE | CBEIF_SELECTEDIMAGE | CBEIF_LPARAM;
+		for (UINT drive = 0; drive < DC_DRIVE_COUNT; drive++) {
+			DC_DRIVEINFO &info = driveInfo[drive];
+			WCHAR szRoot[4];
+			DriveBox_GetRoot(drive, szRoot);
+			if (!(dwMask & (1U << drive))) {
+				// removed drive is queried again when it comes back
+				info.slow = false;
+				info.iIcon = -1;
+				continue;
+			}
 
-	COMBOBOXEXITEM cbei;
-	memset(&cbei, 0, sizeof(COMBOBOXEXITEM));
-	cbei.mask = CBEIF_TEXT | CBEIF_IMAGE | CBEIF_SELECTEDIMAGE | CBEIF_LPARAM;
-	cbei.pszText = LPSTR_TEXTCALLBACK;
-	cbei.cchTextMax = MAX_PATH;
-	cbei.iImage = I_IMAGECALLBACK;
-	cbei.iSelectedImage = I_IMAGECALLBACK;
-
-	// Get pidl to [My Computer]
-	PIDLIST_ABSOLUTE pidl;
-	if (S_OK == SHGetKnownFolderIDList(FOLDERID_ComputerFolder, KF_FLAG_DEFAULT, nullptr, &pidl)) {
-		// Get Desktop Folder
-		LPSHELLFOLDER lpsfDesktop;
-		if (S_OK == SHGetDesktopFolder(&lpsfDesktop)) {
-			// Bind pidl to IShellFolder
-			LPSHELLFOLDER lpsf; // Workspace == FOLDERID_ComputerFolder
-			if (S_OK == lpsfDesktop->BindToObject(pidl, nullptr, IID_IShellFolder, AsPPVArgs(&lpsf))) {
-				// Create an Enumeration object for lpsf
-				constexpr DWORD grfFlags = SHCONTF_FOLDERS;
-				LPENUMIDLIST lpe;
-				if (S_OK == lpsf->EnumObjects(hwnd, grfFlags, &lpe)) {
-					// Enumerate the contents of [My Computer]
-					PITEMID_CHILD pidlEntry;
-					while (S_OK == lpe->Next(1, &pidlEntry, nullptr)) {
-						// Add item to the List if it is part of the
-						// Filesystem
-						ULONG dwAttributes = SFGAO_FILESYSTEM;
-						lpsf->GetAttributesOf(1, reinterpret_cast<PCUITEMID_CHILD_ARRAY>(&pidlEntry), &dwAttributes);
-
-						if (dwAttributes & SFGAO_FILESYSTEM) {
-							// Windows XP: check if pidlEntry is a drive
-							SHDESCRIPTIONID di;
-							HRESULT hr = SHGetDataFromIDList(lpsf, pidlEntry, SHGDFIL_DESCRIPTIONID, &di, sizeof(SHDESCRIPTIONID));
-							if (hr != S_OK || (di.dwDescriptionId >= SHDID_COMPUTER_DRIVE35 && di.dwDescriptionId <= SHDID_COMPUTER_OTHER)) {
-								DC_ITEMDATA * const lpdcid = static_cast<DC_ITEMDATA *>(CoTaskMemAlloc(sizeof(DC_ITEMDATA)));
-								//lpdcid->pidl = IL_Copy(pidlEntry);
-								lpdcid->pidl = pidlEntry;
-								lpdcid->lpsf = lpsf;
-								lpsf->AddRef();
-
-								// Insert sorted ...
-								{
-									COMBOBOXEXITEM cbei2;
-									cbei2.mask = CBEIF_LPARAM;
-									cbei2.iItem = 0;
-
-									while ((SendMessage(hwnd, CBEM_GETITEM, 0, AsInteger<LPARAM>(&cbei2)))) {
-										const LV_ITEMDATA * const lpdcid2 = AsPointer<const LV_ITEMDATA *>(cbei2.lParam);
-										hr = lpdcid->lpsf->CompareIDs(0, reinterpret_cast<PCUIDLIST_RELATIVE>(lpdcid->pidl), reinterpret_cast<PCUIDLIST_RELATIVE>(lpdcid2->pidl));
-
-										if (static_cast<short>(HRESULT_CODE(hr)) < 0) {
-											break;
-										}
-										cbei2.iItem++;
-									}
-
-									cbei.iItem = cbei2.iItem;
-									cbei.lParam = AsInteger<LPARAM>(lpdcid);
-									SendMessage(hwnd, CBEM_INSERTITEM, 0, AsInteger<LPARAM>(&cbei));
-								}
-							}
-						}
-					} // IEnumIDList::Next()
-
-					lpe->Release();
-				} // IShellFolder::EnumObjects()
-
-				lpsf->Release();
-			} // IShellFolder::BindToObject()
-			CoTaskMemFree(pidl);
-		} // SHGetDesktopFolder()
+			if (StrIsEmpty(info.szName)) {
+				szRoot[2] = L'\0';
+				lstrcpy(info.szName, szRoot);
+				szRoot[2] = L'\\';
+			}
+			cbei.pszText = info.szName;
+			cbei.iImage = (info.iIcon >= 0) ? info.iIcon : DriveBox_GetDefaultIcon(szRoot);
+			cbei.iSelectedImage = cbei.iImage;
+			cbei.lParam = drive;
+			SendMessage(hwnd, CBEM_INSERTITEM, 0, AsInteger<LPARAM>(&cbei));
+			cbei.iItem++;
+		}
+		SendMessage(hwnd, WM_SETREDRAW, 1, 0);
+	}
 
-		lpsfDesktop->Release();
-	} // SHGetKnownFolderIDList()
+	const DWORD dwNow = GetTickCount();
+	for (UINT drive = 0; drive < DC_DRIVE_COUNT; drive++) {
+		if (dwMask & (1U << drive)) {
+			DriveBox_Resolve(hwnd, drive, dwNow);
+		}
+	}
 
-	SendMessage(hwnd, WM_SETREDRAW, 1, 0);
 	// Return number of items added to combo box
 	return ComboBox_GetCount(hwnd);
 }
 
+//=============================================================================
+//
+//  DriveBox_Update
+//
+//  Must be called in response to APPM_DRIVEBOX_UPDATE
+//
+bool DriveBox_Update(HWND hwnd, LPARAM lParam) noexcept {
+	DC_RESOLVE * const lpdr = AsPointer<DC_RESOLVE *>(lParam);
+	DC_DRIVEINFO &info = driveInfo[lpdr->drive];
+	info.pending = false;
+	info.dwTick = GetTickCount();
+	info.slow = info.dwTick - lpdr->dwStart > DC_RESOLVE_TIMEOUT;
+
+	bool bChanged = false;
+	if (lpdr->iIcon >= 0 && (dwDriveMask & (1U << lpdr->drive))) {
+		bChanged = info.iIcon != lpdr->iIcon || !StrEqual(info.szName, lpdr->szName);
+		info.iIcon = lpdr->iIcon;
+		lstrcpy(info.szName, lpdr->szName);
+	}
+	NP2HeapFree(lpdr);
+
+	if (bChanged) {
+		const int iItem = DriveBox_FindItem(hwnd, static_cast<UINT>(&info - driveInfo));
+		if (iItem >= 0) {
+			COMBOBOXEXITEM cbei;
+			memset(&cbei, 0, sizeof(COMBOBOXEXITEM));
+			cbei.mask = CBEIF_TEXT | CBEIF_IMAGE | CBEIF_SELECTEDIMAGE;
+			cbei.iItem = iItem;
+			cbei.pszText = info.szName;
+			cbei.iImage = info.iIcon;
+			cbei.iSelectedImage = info.iIcon;
+			SendMessage(hwnd, CBEM_SETITEM, 0, AsInteger<LPARAM>(&cbei));
+		}
+	}
+	return bChanged;
+}
+
 //=============================================================================
 //
 //  DriveBox_GetSelDrive
@@ -861,19 +2312,12 @@ int DriveBox_Fill(HWND hwnd) {
 bool DriveBox_GetSelDrive(HWND hwnd, LPWSTR lpszDrive, int nDrive, bool fNoSlash) {
 	const int i = ComboBox_GetCurSel(hwnd);
 	// CB_ERR means no Selection
-	if (i == CB_ERR) {
+	if (i == CB_ERR || nDrive < 4) {
 		return false;
 	}
 
-	// Get DC_ITEMDATA* of selected Item
-	COMBOBOXEXITEM cbei;
-	cbei.mask = CBEIF_LPARAM;
-	cbei.iItem = i;
-	SendMessage(hwnd, CBEM_GETITEM, 0, AsInteger<LPARAM>(&cbei));
-	const DC_ITEMDATA * const lpdcid = AsPointer<const DC_ITEMDATA *>(cbei.lParam);
-
 	// Get File System Path for Drive
-	IL_GetDisplayName(lpdcid->lpsf, lpdcid->pidl, SHGDN_FORPARSING, lpszDrive, nDrive);
+	DriveBox_GetRoot(DriveBox_GetItemDrive(hwnd, i), lpszDrive);
 
 	// Remove Backslash if required (makes Drive relative!!!)
 	if (fNoSlash) {
@@ -894,18 +2338,9 @@ bool DriveBox_SelectDrive(HWND hwnd, LPCWSTR lpszPath) {
 		return false;
 	}
 
-	COMBOBOXEXITEM cbei;
-	cbei.mask = CBEIF_LPARAM;
-
 	for (int i = 0; i < cbItems; i++) {
-		WCHAR szRoot[64] = L"";
-		// Get DC_ITEMDATA* of Item i
-		cbei.iItem = i;
-		SendMessage(hwnd, CBEM_GETITEM, 0, AsInteger<LPARAM>(&cbei));
-		const DC_ITEMDATA * const lpdcid = AsPointer<const DC_ITEMDATA *>(cbei.lParam);
-
-		// Get File System Path for Drive
-		IL_GetDisplayName(lpdcid->lpsf, lpdcid->pidl, SHGDN_FORPARSING, szRoot, COUNTOF(szRoot));
+		WCHAR szRoot[4];
+		DriveBox_GetRoot(DriveBox_GetItemDrive(hwnd, i), szRoot);
 
 		// Compare Root Directory with Path
 		if (PathIsSameRoot(lpszPath, szRoot)) {
@@ -927,101 +2362,41 @@ bool DriveBox_SelectDrive(HWND hwnd, LPCWSTR lpszPath) {
 //  Shows standard Win95 Property Dlg for selected Drive
 //
 bool DriveBox_PropertyDlg(HWND hwnd) {
-	const int iItem = ComboBox_GetCurSel(hwnd);
-	if (iItem == CB_ERR) {
+	WCHAR szRoot[4];
+	if (!DriveBox_GetSelDrive(hwnd, szRoot, COUNTOF(szRoot), false)) {
 		return false;
 	}
 
-	bool bSuccess = true;
-	COMBOBOXEXITEM cbei;
-	cbei.mask = CBEIF_LPARAM;
-	cbei.iItem = iItem;
-	SendMessage(hwnd, CBEM_GETITEM, 0, AsInteger<LPARAM>(&cbei));
-	const DC_ITEMDATA * const lpdcid = AsPointer<const DC_ITEMDATA *>(cbei.lParam);
-	LPCONTEXTMENU lpcm;
-
-	if (S_OK == lpdcid->lpsf->GetUIObjectOf(GetParent(hwnd), 1, reinterpret_cast<PCUITEMID_CHILD_ARRAY>(&lpdcid->pidl), IID_IContextMenu, nullptr, AsPPVArgs(&lpcm))) {
-		CMINVOKECOMMANDINFO cmi;
-		cmi.cbSize = sizeof(CMINVOKECOMMANDINFO);
-		cmi.fMask = 0;
-		cmi.hwnd = GetParent(hwnd);
-		cmi.lpVerb = "properties";
-		cmi.lpParameters = nullptr;
-		cmi.lpDirectory = nullptr;
-		cmi.nShow = SW_SHOWNORMAL;
-		cmi.dwHotKey = 0;
-		cmi.hIcon = nullptr;
-
-		if (S_OK != lpcm->InvokeCommand(&cmi)) {
-			bSuccess = false;
+	bool bSuccess = false;
+	PIDLIST_ABSOLUTE pidl;
+	if (S_OK == SHParseDisplayName(szRoot, nullptr, &pidl, 0, nullptr)) {
+		LPSHELLFOLDER lpsf;
+		PCUITEMID_CHILD pidlChild;
+		if (S_OK == SHBindToParent(pidl, IID_IShellFolder, AsPPVArgs(&lpsf), &pidlChild)) {
+			LPCONTEXTMENU lpcm;
+			if (S_OK == lpsf->GetUIObjectOf(GetParent(hwnd), 1, &pidlChild, IID_IContextMenu, nullptr, AsPPVArgs(&lpcm))) {
+				CMINVOKECOMMANDINFO cmi;
+				cmi.cbSize = sizeof(CMINVOKECOMMANDINFO);
+				cmi.fMask = 0;
+				cmi.hwnd = GetParent(hwnd);
+				cmi.lpVerb = "properties";
+				cmi.lpParameters = nullptr;
+				cmi.lpDirectory = nullptr;
+				cmi.nShow = SW_SHOWNORMAL;
+				cmi.dwHotKey = 0;
+				cmi.hIcon = nullptr;
+
+				bSuccess = S_OK == lpcm->InvokeCommand(&cmi);
+				lpcm->Release();
+			}
+			lpsf->Release();
 		}
-
-		lpcm->Release();
-	} else {
-		bSuccess = false;
+		CoTaskMemFree(pidl);
 	}
 
 	return bSuccess;
 }
 
-//=============================================================================
-//
-//  DriveBox_DeleteItem
-//
-bool DriveBox_DeleteItem(HWND hwnd, LPARAM lParam) {
-	const NMCOMBOBOXEX *lpnmcbe = AsPointer<NMCOMBOBOXEX *>(lParam);
-	COMBOBOXEXITEM cbei;
-	cbei.iItem = lpnmcbe->ceItem.iItem;
-
-	cbei.mask = CBEIF_LPARAM;
-	SendMessage(hwnd, CBEM_GETITEM, 0, AsInteger<LPARAM>(&cbei));
-	DC_ITEMDATA * const lpdcid = AsPointer<DC_ITEMDATA *>(cbei.lParam);
-
-	// Free pidl
-	CoTaskMemFree(lpdcid->pidl);
-	// Release lpsf
-	lpdcid->lpsf->Release();
-	// Free lpdcid itself
-	CoTaskMemFree(lpdcid);
-
-	return true;
-}
-
-//=============================================================================
-//
-//  DriveBox_GetDispInfo
-//
-bool DriveBox_GetDispInfo(HWND hwnd, LPARAM lParam) {
-	UNREFERENCED_PARAMETER(hwnd);
-
-	NMCOMBOBOXEX *lpnmcbe = AsPointer<NMCOMBOBOXEX *>(lParam);
-	const DC_ITEMDATA * const lpdcid = AsPointer<const DC_ITEMDATA *>(lpnmcbe->ceItem.lParam);
-
-	if (!lpdcid) {
-		return false;
-	}
-
-	// Get Display Name
-	if (lpnmcbe->ceItem.mask & CBEIF_TEXT) {
-		IL_GetDisplayName(lpdcid->lpsf, lpdcid->pidl, SHGDN_NORMAL, lpnmcbe->ceItem.pszText, lpnmcbe->ceItem.cchTextMax);
-	}
-
-	// Get Icon Index
-	if (lpnmcbe->ceItem.mask & (CBEIF_IMAGE | CBEIF_SELECTEDIMAGE)) {
-		WCHAR szTemp[MAX_PATH];
-		SHFILEINFO shfi;
-		IL_GetDisplayName(lpdcid->lpsf, lpdcid->pidl, SHGDN_FORPARSING, szTemp, MAX_PATH);
-		SHGetFileInfo(szTemp, 0, &shfi, sizeof(SHFILEINFO), SHGFI_SYSICONINDEX | SHGFI_SMALLICON);
-		lpnmcbe->ceItem.iImage = shfi.iIcon;
-		lpnmcbe->ceItem.iSelectedImage = shfi.iIcon;
-	}
-
-	// Set values
-	lpnmcbe->ceItem.mask |= CBEIF_DI_SETITEM;
-
-	return true;
-}
-
 //==== ItemID =================================================================
 
 //=============================================================================
@@ -19,12 +19,7 @@
 ******************************************************************************/
 #pragma once
 
-struct LV_ITEMDATA {
-	LPITEMIDLIST pidl; // Item Id
-	LPSHELLFOLDER lpsf; // Parent IShellFolder Interface
-};
-
-void DirList_Init(HWND hwnd) noexcept;
+void DirList_Init(HWND hwnd, bool bShareOverlay, bool bWatchChanges) noexcept;
 void DirList_Destroy(HWND hwnd);
 void DirList_StartIconThread(HWND hwnd) noexcept;
 
@@ -32,12 +27,21 @@ void DirList_StartIconThread(HWND hwnd) noexcept;
 #define DL_NONFOLDERS   64
 #define DL_INCLHIDDEN  128
 #define DL_ALLOBJECTS  (DL_FOLDERS | DL_NONFOLDERS | DL_INCLHIDDEN)
+#define DL_RECURSIVE   0x01000000	// search files in subdirectories
 int DirList_Fill(HWND hwnd, LPCWSTR lpszDir, DWORD grfFlags, LPCWSTR lpszFileSpec,
 				 bool bExcludeFilter, bool bNoFadeHidden,
 				 int iSortFlags, bool fSortRev);
+// posted to parent window of the listview control, call DirList_FillUpdate() on it
+#define APPM_DIRLIST_FILL	(WM_APP + 5)
+bool DirList_FillUpdate(HWND hwnd);
+bool DirList_IsFilling(HWND hwnd) noexcept;
+// posted to parent window when current directory changed, call DirList_WatchUpdate() on it
+#define APPM_DIRLIST_CHANGE	(WM_APP + 6)
+bool DirList_WatchUpdate(HWND hwnd);
 DWORD WINAPI DirList_IconThread(LPVOID lpParam);
+void DirList_CacheHint(HWND hwnd, LPARAM lParam) noexcept;
 bool DirList_GetDispInfo(HWND hwnd, LPARAM lParam);
-bool DirList_DeleteItem(HWND hwnd, LPARAM lParam);
+int DirList_FindItem(HWND hwnd, LPARAM lParam) noexcept;
 
 #define DS_NAME     0
 #define DS_SIZE     1
@@ -71,22 +75,29 @@ bool DirList_SelectItem(HWND hwnd, LPCWSTR lpszDisplayName, LPCWSTR lpszFullPath
 bool DirList_IsFileSelected(HWND hwnd);
 
 #define DL_FILTER_BUFSIZE 128
+#define DL_FILTER_HASHSIZE 64	// power of 2, more than count of "*.ext" patterns fit in the buffer
 struct DirListFilter {
-	int nCount;
+	int nCount;					// count of all patterns
+	int nGlob;					// count of patterns in pFilter
 	bool bExcludeFilter;
-	WCHAR tFilterBuf[DL_FILTER_BUFSIZE];
-	LPWSTR pFilter[DL_FILTER_BUFSIZE];
+	bool bMatchAll;				// "*" or "*.*" in the list
+	WCHAR tFilterBuf[DL_FILTER_BUFSIZE];	// lower case patterns
+	LPCWSTR pFilter[DL_FILTER_BUFSIZE];
+	LPCWSTR pExtension[DL_FILTER_HASHSIZE];	// hash set for "*.ext" patterns, stores ".ext"
 	void Create(LPCWSTR lpszFileSpec, bool bExclude) noexcept;
-	bool Match(LPSHELLFOLDER lpsf, LPCITEMIDLIST pidl) const noexcept;
+	bool Match(LPCWSTR lpszFileName, DWORD dwAttributes) const noexcept;
 };
 
 bool DriveBox_Init(HWND hwnd) noexcept;
+void DriveBox_LoadCache(LPCWSTR lpszSection) noexcept;
+void DriveBox_SaveCache(LPCWSTR lpszSection) noexcept;
 int  DriveBox_Fill(HWND hwnd);
+// posted to parent window of the combo box when a drive is queried, call DriveBox_Update() on it
+#define APPM_DRIVEBOX_UPDATE	(WM_APP + 7)
+bool DriveBox_Update(HWND hwnd, LPARAM lParam) noexcept;
 bool DriveBox_GetSelDrive(HWND hwnd, LPWSTR lpszDrive, int nDrive, bool fNoSlash);
 bool DriveBox_SelectDrive(HWND hwnd, LPCWSTR lpszPath);
 bool DriveBox_PropertyDlg(HWND hwnd);
-bool DriveBox_DeleteItem(HWND hwnd, LPARAM lParam);
-bool DriveBox_GetDispInfo(HWND hwnd, LPARAM lParam);
 
 LPITEMIDLIST IL_Create(LPCITEMIDLIST pidl1, UINT cb1, LPCITEMIDLIST pidl2, UINT cb2) noexcept;
 UINT IL_GetSize(LPCITEMIDLIST pidl) noexcept;
@@ -73,7 +73,6 @@ HWND	hwndMain;
 static HICON hTrayIcon = nullptr;
 static UINT uTrayIconDPI = 0;
 
-static HANDLE hChangeHandle = nullptr;
 HistoryList	mHistory;
 
 WCHAR	szIniFile[MAX_PATH];
@@ -136,6 +135,7 @@ int		nIdFocus = IDC_DIRLIST;
 WCHAR	szCurDir[MAX_PATH + 40];
 static WCHAR szMRUDirectory[MAX_PATH];
 static DWORD dwFillMask;
+static bool bSearchSubdirs;
 static int nSortFlags;
 static bool fSortRev;
 
@@ -207,6 +207,7 @@ bool		flagPortableMyDocs	= false;
 bool		flagGotoFavorites	= false;
 static DWORD iAutoRefreshRate	= 0;
 bool		flagNoFadeHidden	= false;
+bool		flagShareOverlay	= false;
 static int	iOpacityLevel		= 75;
 static bool	flagPosParam		= false;
 
@@ -491,21 +492,12 @@ LRESULT CALLBACK MainWndProc(HWND hwnd, UINT umsg, WPARAM wParam, LPARAM lParam)
 	static bool bShutdownOK;
 
 	switch (umsg) {
-	case WM_CREATE: {
-		// Init directory watching
-		if (iAutoRefreshRate) {
-			SetTimer(hwnd, ID_TIMER, iAutoRefreshRate, nullptr);
-		}
+	case WM_CREATE:
 		return MsgCreate(hwnd, wParam, lParam);
-	}
 
 	case WM_DESTROY:
 	case WM_ENDSESSION:
 		if (!bShutdownOK) {
-			// Terminate directory watching
-			KillTimer(hwnd, ID_TIMER);
-			FindCloseChangeNotification(hChangeHandle);
-
 			DirList_Destroy(hwndDirList);
 			DragAcceptFiles(hwnd, FALSE);
 
@@ -571,25 +563,6 @@ LRESULT CALLBACK MainWndProc(HWND hwnd, UINT umsg, WPARAM wParam, LPARAM lParam)
 	}
 	return DefWindowProc(hwnd, umsg, wParam, lParam);
 
-	case WM_TIMER:
-		// Check Change Notification Handle
-		if (WAIT_OBJECT_0 == WaitForSingleObject(hChangeHandle, 0)) {
-			// Store information about currently selected item
-			DirListItem dli;
-			dli.mask = DLI_ALL;
-			dli.ntype = DLE_NONE;
-			DirList_GetItem(hwndDirList, -1, &dli);
-
-			FindNextChangeNotification(hChangeHandle);
-			SendWMCommand(hwnd, IDM_VIEW_UPDATE);
-
-			// must use SendMessage() !!
-			if (dli.ntype != DLE_NONE) {
-				DirList_SelectItem(hwndDirList, dli.szDisplayName, dli.szFileName);
-			}
-		}
-		break;
-
 	case WM_SIZE:
 		MsgSize(hwnd, wParam, lParam);
 		break;
@@ -741,6 +714,65 @@ LRESULT CALLBACK MainWndProc(HWND hwnd, UINT umsg, WPARAM wParam, LPARAM lParam)
 		}
 		break;
 
+	case APPM_DIRLIST_FILL:
+		// items of large directory are streamed from background enumeration
+		if (DirList_FillUpdate(hwndDirList)) {
+			DirList_StartIconThread(hwndDirList);
+			if (ListView_GetNextItem(hwndDirList, -1, LVNI_FOCUSED) < 0) {
+				ListView_SetItemState(hwndDirList, 0, LVIS_FOCUSED, LVIS_FOCUSED);
+			}
+		}
+		UpdateFileInfoStatus(ListView_GetItemCount(hwndDirList));
+		break;
+
+	case APPM_DIRLIST_CHANGE:
+		// changes of current directory are applied to the list in place
+		if (!DirList_WatchUpdate(hwndDirList)) {
+			// too many changes, store information about currently selected item
+			DirListItem dli;
+			dli.mask = DLI_ALL;
+			dli.ntype = DLE_NONE;
+			DirList_GetItem(hwndDirList, -1, &dli);
+
+			SendWMCommand(hwnd, IDM_VIEW_UPDATE);
+
+			// must use SendMessage() !!
+			if (dli.ntype != DLE_NONE) {
+				DirList_SelectItem(hwndDirList, dli.szDisplayName, dli.szFileName);
+			}
+		}
+		UpdateFileInfoStatus(ListView_GetItemCount(hwndDirList));
+		break;
+
+	case APPM_DRIVEBOX_UPDATE:
+		DriveBox_Update(hwndDriveBox, lParam);
+		break;
+
+	case APPM_FILEOP_DONE:
+		// without directory watching, update the list now
+		if (iAutoRefreshRate == 0) {
+			int iItem = ListView_GetNextItem(hwndDirList, -1, LVNI_FOCUSED);
+			SendWMCommand(hwnd, IDM_VIEW_UPDATE);
+			if (wParam == FO_DELETE && iItem > 0) {
+				iItem--;
+			}
+			iItem = min(iItem, ListView_GetItemCount(hwndDirList) - 1);
+			if (iItem >= 0) {
+				ListView_SetItemState(hwndDirList, iItem, LVIS_FOCUSED, LVIS_FOCUSED);
+				ListView_EnsureVisible(hwndDirList, iItem, FALSE);
+			}
+		}
+		break;
+
+	case WM_CLOSE: {
+		static bool closing;
+		if (!closing) {
+			closing = true;
+			FileOp_WaitIdle();
+			DestroyWindow(hwnd);
+		}
+	} break;
+
 	case APPM_CENTER_MESSAGE_BOX: {
 		HWND box = FindWindow(L"#32770", nullptr);
 		HWND parent = GetParent(box);
@@ -815,7 +847,7 @@ LRESULT MsgCreate(HWND hwnd, WPARAM wParam, LPARAM lParam) noexcept {
 	};
 	ListView_SetExtendedListViewStyle(hwndDirList, LVS_EX_DOUBLEBUFFER | LVS_EX_LABELTIP);
 	ListView_InsertColumn(hwndDirList, 0, &lvc);
-	DirList_Init(hwndDirList);
+	DirList_Init(hwndDirList, flagShareOverlay, iAutoRefreshRate != 0);
 	if (bTrackSelect) {
 		ListView_SetExtendedListViewStyleEx(hwndDirList,
 											LVS_EX_TRACKSELECT | LVS_EX_ONECLICKACTIVATE,
@@ -1163,6 +1195,7 @@ void MsgInitMenu(HWND hwnd, WPARAM wParam, LPARAM lParam) {
 	CheckCmd(hmenu, IDM_VIEW_HIDDEN, (dwFillMask & DL_INCLHIDDEN));
 
 	EnableCmd(hmenu, IDM_VIEW_FILTERALL, HasFilter());
+	CheckCmd(hmenu, IDM_VIEW_RECURSIVE, bSearchSubdirs);
 
 	CheckCmd(hmenu, IDM_VIEW_TOOLBAR, bShowToolbar);
 	EnableCmd(hmenu, IDM_VIEW_CUSTOMIZETB, bShowToolbar);
@@ -1509,38 +1542,15 @@ LRESULT MsgCommand(HWND hwnd, WPARAM wParam, LPARAM lParam) {
 			break;
 		}
 
-		WCHAR tch[512];
-		memset(tch, 0, sizeof(tch));
-		lstrcpy(tch, dli.szFileName);
-
-		SHFILEOPSTRUCT shfos;
-		memset(&shfos, 0, sizeof(SHFILEOPSTRUCT));
-		shfos.hwnd = hwnd;
-		shfos.wFunc = FO_DELETE;
-		shfos.pFrom = tch;
-		shfos.pTo = nullptr;
+		FILEOP_FLAGS fFlags = 0;
 		if (fUseRecycleBin && (LOWORD(wParam) != IDM_FILE_DELETE2)) {
-			shfos.fFlags = FOF_ALLOWUNDO;
+			fFlags = FOF_ALLOWUNDO;
 		}
 		if (fNoConfirmDelete || LOWORD(wParam) == IDM_FILE_DELETE3) {
-			shfos.fFlags |= FOF_NOCONFIRMATION;
+			fFlags |= FOF_NOCONFIRMATION;
 		}
 
-		SHFileOperation(&shfos);
-
-		// Check if there are any changes in the directory, then update!
-		if (WAIT_OBJECT_0 == WaitForSingleObject(hChangeHandle, 0)) {
-
-			SendWMCommand(hwnd, IDM_VIEW_UPDATE);
-			if (iItem > 0) {
-				iItem--;
-			}
-			iItem = min(iItem, ListView_GetItemCount(hwndDirList) - 1);
-			ListView_SetItemState(hwndDirList, iItem, LVIS_FOCUSED, LVIS_FOCUSED);
-			ListView_EnsureVisible(hwndDirList, iItem, FALSE);
-
-			FindNextChangeNotification(hChangeHandle);
-		}
+		FileOp_Queue(hwnd, FO_DELETE, dli.szFileName, nullptr, fFlags, false);
 	}
 	break;
 
@@ -1672,6 +1682,12 @@ LRESULT MsgCommand(HWND hwnd, WPARAM wParam, LPARAM lParam) {
 		Toolbar_SetButtonImage(hwndToolbar, IDT_VIEW_FILTER, TB_ADD_FILTER_BMP);
 		break;
 
+	case IDM_VIEW_RECURSIVE:
+		bSearchSubdirs = !bSearchSubdirs;
+		SendWMCommand(hwnd, IDM_VIEW_UPDATE);
+		ListView_EnsureVisible(hwndDirList, 0, FALSE); // not done by update
+		break;
+
 	case IDM_VIEW_UPDATE:
 		ChangeDirectory(hwnd, nullptr, true);
 		break;
@@ -2092,8 +2108,11 @@ LRESULT MsgNotify(HWND hwnd, WPARAM wParam, LPARAM lParam) {
 			DirList_GetDispInfo(hwndDirList, lParam);
 			break;
 
-		case LVN_DELETEITEM:
-			DirList_DeleteItem(hwndDirList, lParam);
+		case LVN_ODFINDITEM:
+			return DirList_FindItem(hwndDirList, lParam);
+
+		case LVN_ODCACHEHINT:
+			DirList_CacheHint(hwndDirList, lParam);
 			break;
 
 		case LVN_BEGINDRAG:
@@ -2183,18 +2202,6 @@ LRESULT MsgNotify(HWND hwnd, WPARAM wParam, LPARAM lParam) {
 		}
 		break;
 
-	case IDC_DRIVEBOX:
-		switch (pnmh->code) {
-		case CBEN_GETDISPINFO:
-			DriveBox_GetDispInfo(hwndDriveBox, lParam);
-			break;
-
-		case CBEN_DELETEITEM:
-			DriveBox_DeleteItem(hwndDriveBox, lParam);
-			break;
-		}
-		break;
-
 	case IDC_TOOLBAR:
 		switch (pnmh->code) {
 		case TBN_ENDADJUST:
@@ -2258,6 +2265,15 @@ void SetWindowPathTitle(HWND hwnd, LPCWSTR lpszFile) noexcept {
 	SetWindowText(hwnd, szTitle);
 }
 
+void UpdateFileInfoStatus(int cItems) noexcept {
+	WCHAR tch[256];
+	WCHAR tchnum[64];
+	FormatNumber(tchnum, cItems);
+	WCHAR fmt[64];
+	FormatString(tch, fmt, HasFilter() ? IDS_NUMFILES_FILTER : IDS_NUMFILES, tchnum);
+	StatusSetText(hwndStatus, ID_FILEINFO, tch);
+}
+
 //=============================================================================
 //
 //  ChangeDirectory()
@@ -2297,8 +2313,10 @@ bool ChangeDirectory(HWND hwnd, LPCWSTR lpszNewDir, bool bUpdateHistory) {
 			Toolbar_SetButtonImage(hwndToolbar, IDT_VIEW_FILTER, TB_ADD_FILTER_BMP);
 		}
 
-		const int cItems = DirList_Fill(hwndDirList, szCurDir, dwFillMask, tchFilter, bNegFilter, flagNoFadeHidden, nSortFlags, fSortRev);
-		DirList_StartIconThread(hwndDirList);
+		const int cItems = DirList_Fill(hwndDirList, szCurDir, dwFillMask | (bSearchSubdirs ? DL_RECURSIVE : 0), tchFilter, bNegFilter, flagNoFadeHidden, nSortFlags, fSortRev);
+		if (!DirList_IsFilling(hwndDirList)) {
+			DirList_StartIconThread(hwndDirList);
+		}
 
 		// Get long pathname
 		DirList_GetLongPathName(hwndDirList, szCurDir);
@@ -2317,24 +2335,10 @@ bool ChangeDirectory(HWND hwnd, LPCWSTR lpszNewDir, bool bUpdateHistory) {
 			ListView_EnsureVisible(hwndDirList, iTopItem, TRUE);
 		}
 
-		// setup new change notification handle
-		FindCloseChangeNotification(hChangeHandle);
-		hChangeHandle = FindFirstChangeNotification(szCurDir, FALSE,
-						FILE_NOTIFY_CHANGE_FILE_NAME  | \
-						FILE_NOTIFY_CHANGE_DIR_NAME   | \
-						FILE_NOTIFY_CHANGE_ATTRIBUTES | \
-						FILE_NOTIFY_CHANGE_SIZE | \
-						FILE_NOTIFY_CHANGE_LAST_WRITE);
-
 		DriveBox_Fill(hwndDriveBox);
 		DriveBox_SelectDrive(hwndDriveBox, szCurDir);
 
-		WCHAR tch[256];
-		WCHAR tchnum[64];
-		FormatNumber(tchnum, cItems);
-		WCHAR fmt[64];
-		FormatString(tch, fmt, HasFilter() ? IDS_NUMFILES_FILTER : IDS_NUMFILES, tchnum);
-		StatusSetText(hwndStatus, ID_FILEINFO, tch);
+		UpdateFileInfoStatus(cItems);
 
 		// Update History
 		if (bUpdateHistory) {
@@ -2625,6 +2629,8 @@ void LoadSettings() noexcept {
 	section.Free();
 	NP2HeapFree(pIniSectionBuf);
 
+	DriveBox_LoadCache(INI_SECTION_NAME_DRIVES);
+
 	// Initialize custom colors for ChooseColor()
 	colorCustom[0] = RGB(0, 0, 128);
 	colorCustom[8]  = RGB(255, 255, 226);
@@ -2745,6 +2751,8 @@ void SaveSettings(bool bSaveSettingsNow) noexcept {
 
 	SaveIniSection(INI_SECTION_NAME_SETTINGS, pIniSectionBuf);
 	NP2HeapFree(pIniSectionBuf);
+
+	DriveBox_SaveCache(INI_SECTION_NAME_DRIVES);
 }
 
 void SaveWindowPosition(WCHAR *pIniSectionBuf) noexcept {
@@ -2981,6 +2989,7 @@ void LoadFlags() noexcept {
 	flagPortableMyDocs = section.GetBool(L"PortableMyDocs", true);
 	iAutoRefreshRate = section.GetInt(L"AutoRefreshRate", 3000);
 	flagNoFadeHidden = section.GetBool(L"NoFadeHidden", false);
+	flagShareOverlay = section.GetBool(L"ShareOverlay", false);
 
 	const int iValue = section.GetInt(L"OpacityLevel", 75);
 	iOpacityLevel = validate(iValue, 0, 100, 75);
@@ -49,7 +49,8 @@
 					LVS_SHAREIMAGELISTS | \
 					LVS_AUTOARRANGE | \
 					LVS_SINGLESEL | \
-					LVS_SHOWSELALWAYS)
+					LVS_SHOWSELALWAYS | \
+					LVS_OWNERDATA)
 
 //==== Toolbar Style ==========================================================
 #define WS_TOOLBAR (WS_CHILD | WS_VISIBLE | WS_CLIPSIBLINGS | \
@@ -79,9 +80,6 @@
 #define ID_FILEINFO		0
 #define ID_MENUHELP		(255 | SBT_NOBORDERS)
 
-//==== Timer for Change Notifications =========================================
-#define ID_TIMER		0xA000
-
 /**
  * App message used to center MessageBox to the window of the program.
  */
@@ -119,6 +117,7 @@ enum TargetApplicationMode {
 #define INI_SECTION_NAME_TOOLBAR_LABELS		L"Toolbar Labels"
 #define INI_SECTION_NAME_FILTERS			L"Filters"
 #define INI_SECTION_NAME_TARGET_APPLICATION	L"Target Application"
+#define INI_SECTION_NAME_DRIVES				L"Drives"
 
 #define MRU_KEY_COPY_MOVE_HISTORY			L"Copy/Move MRU"
 
@@ -150,6 +149,7 @@ bool ActivatePrevInst() noexcept;
 void GetRelaunchParameters(LPWSTR szParameters) noexcept;
 void ShowNotifyIcon(HWND hwnd, bool bAdd) noexcept;
 
+void UpdateFileInfoStatus(int cItems) noexcept;
 bool ChangeDirectory(HWND hwnd, LPCWSTR lpszNewDir, bool bUpdateHistory);
 void SetUILanguage(int resID) noexcept;
 void LoadSettings() noexcept;
@@ -212,6 +212,7 @@
 #define IDM_VIEW_ABOUT					40218
 #define IDM_VIEW_AUTO_SCALE_TOOLBAR		40219
 #define IDM_VIEW_USE_LARGE_TOOLBAR		40220
+#define IDM_VIEW_RECURSIVE				40221
 
 #define IDM_SORT_NAME					40301
 #define IDM_SORT_SIZE					40302
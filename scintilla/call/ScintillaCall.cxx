@@ -322,6 +322,14 @@ void ScintillaCall::SetBufferedDraw(bool buffered) {
 	Call(Message::SetBufferedDraw, buffered);
 }
 
+bool ScintillaCall::ScrollBlit() {
+	return Call(Message::GetScrollBlit);
+}
+
+void ScintillaCall::SetScrollBlit(bool blit) {
+	Call(Message::SetScrollBlit, blit);
+}
+
 void ScintillaCall::SetTabWidth(int tabWidth) {
 	Call(Message::SetTabWidth, tabWidth);
 }
@@ -1230,6 +1238,10 @@ void ScintillaCall::AllocateLines(Line lines) {
 	Call(Message::AllocateLines, lines);
 }
 
+void ScintillaCall::SetLineStartsHint(Line lines, void *lineStarts) {
+	CallPointer(Message::SetLineStartsHint, lines, lineStarts);
+}
+
 void ScintillaCall::SetMarginLeft(int pixelWidth) {
 	Call(Message::SetMarginLeft, 0, pixelWidth);
 }
@@ -1614,6 +1626,10 @@ void ScintillaCall::FoldAll(Scintilla::FoldAction action) {
 	Call(Message::FoldAll, static_cast<uintptr_t>(action));
 }
 
+void ScintillaCall::FoldAtLevel(Scintilla::FoldAction action, int level) {
+	Call(Message::FoldAtLevel, static_cast<uintptr_t>(action), level);
+}
+
 void ScintillaCall::EnsureVisible(Line line) {
 	Call(Message::EnsureVisible, line);
 }
@@ -1678,6 +1694,34 @@ IdleStyling ScintillaCall::IdleStyling() {
 	return static_cast<Scintilla::IdleStyling>(Call(Message::GetIdleStyling));
 }
 
+void ScintillaCall::SetBackgroundStyling(bool background) {
+	Call(Message::SetBackgroundStyling, background);
+}
+
+bool ScintillaCall::BackgroundStyling() {
+	return Call(Message::GetBackgroundStyling);
+}
+
+void ScintillaCall::SetLineStyler(void *styler) {
+	CallPointer(Message::SetLineStyler, 0, styler);
+}
+
+void *ScintillaCall::LineStyler() {
+	return AsPointer<void *>(Call(Message::GetLineStyler));
+}
+
+Position ScintillaCall::StylingCache(char *cache) {
+	return CallPointer(Message::GetStylingCache, 0, cache);
+}
+
+std::string ScintillaCall::StylingCache() {
+	return CallReturnString(Message::GetStylingCache, 0);
+}
+
+bool ScintillaCall::SetStylingCache(Position length, const char *cache) {
+	return CallString(Message::SetStylingCache, length, cache);
+}
+
 void ScintillaCall::SetWrapMode(Scintilla::Wrap wrapMode) {
 	Call(Message::SetWrapMode, static_cast<uintptr_t>(wrapMode));
 }
@@ -2214,6 +2258,10 @@ DocumentOption ScintillaCall::DocumentOptions() {
 	return static_cast<Scintilla::DocumentOption>(Call(Message::GetDocumentOptions));
 }
 
+void ScintillaCall::SetDocumentOptions(Scintilla::DocumentOption documentOptions) {
+	Call(Message::SetDocumentOptions, static_cast<uintptr_t>(documentOptions));
+}
+
 ModificationFlags ScintillaCall::ModEventMask() {
 	return static_cast<Scintilla::ModificationFlags>(Call(Message::GetModEventMask));
 }
@@ -2638,6 +2686,10 @@ void ScintillaCall::IndicatorClearRange(Position start, Position lengthClear) {
 	Call(Message::IndicatorClearRange, start, lengthClear);
 }
 
+void ScintillaCall::IndicatorFillRanges(Position count, void *ranges) {
+	CallPointer(Message::IndicatorFillRanges, count, ranges);
+}
+
 int ScintillaCall::IndicatorAllOnFor(Position pos) {
 	return static_cast<int>(Call(Message::IndicatorAllOnFor, pos));
 }
@@ -2662,6 +2714,26 @@ int ScintillaCall::PositionCache() {
 	return static_cast<int>(Call(Message::GetPositionCache));
 }
 
+Position ScintillaCall::PositionCacheStatistic(Scintilla::PositionCacheStatistic statistic, int shard) {
+	return Call(Message::GetPositionCacheStatistic, static_cast<uintptr_t>(statistic), shard);
+}
+
+Position ScintillaCall::FrameStatistic(Scintilla::FrameStatistic statistic) {
+	return Call(Message::GetFrameStatistic, static_cast<uintptr_t>(statistic));
+}
+
+void ScintillaCall::SetLayoutCacheBudget(Position bytes) {
+	Call(Message::SetLayoutCacheBudget, bytes);
+}
+
+Position ScintillaCall::LayoutCacheBudget() {
+	return Call(Message::GetLayoutCacheBudget);
+}
+
+Position ScintillaCall::LayoutCacheStatistic(Scintilla::LayoutCacheStatistic statistic) {
+	return Call(Message::GetLayoutCacheStatistic, static_cast<uintptr_t>(statistic));
+}
+
 void ScintillaCall::CopyAllowLine() {
 	Call(Message::CopyAllowLine);
 }
@@ -3122,6 +3194,18 @@ void *ScintillaCall::CreateLoader(Position bytes, Scintilla::DocumentOption docu
 	return AsPointer<void *>(Call(Message::CreateLoader, bytes, static_cast<intptr_t>(documentOptions)));
 }
 
+void ScintillaCall::ReleaseCaches(Scintilla::ReleaseCache level) {
+	Call(Message::ReleaseCaches, static_cast<uintptr_t>(level));
+}
+
+void ScintillaCall::SetStylingDuration(int nanoseconds) {
+	Call(Message::SetStylingDuration, nanoseconds);
+}
+
+int ScintillaCall::StylingDuration() {
+	return static_cast<int>(Call(Message::GetStylingDuration));
+}
+
 void ScintillaCall::FindIndicatorShow(Position start, Position end) {
 	Call(Message::FindIndicatorShow, start, end);
 }
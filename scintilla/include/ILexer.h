@@ -39,6 +39,8 @@ public:
 	virtual int SCI_METHOD CodePage() const noexcept = 0;
 	virtual bool SCI_METHOD IsDBCSLeadByte(unsigned char ch) const noexcept = 0;
 	virtual const char * SCI_METHOD BufferPointer() noexcept = 0;
+	// pointer to text in range without rearranging the buffer, nullptr when range is not contiguous.
+	virtual const char * SCI_METHOD ContiguousRangePointer(Sci_Position position, Sci_Position rangeLength) const noexcept = 0;
 	virtual int SCI_METHOD GetLineIndentation(Sci_Line line) const noexcept = 0;
 	virtual Sci_Position SCI_METHOD LineEnd(Sci_Line line) const noexcept = 0;
 	virtual Sci_Position SCI_METHOD GetRelativePosition(Sci_Position positionStart, Sci_Position characterOffset) const noexcept = 0;
@@ -50,6 +52,28 @@ enum {
 	lvRelease5 = 3,
 };
 
+// PrivateCall(lexerCallLineCheckpoint) returns line checkpoint flags as pointer sized integer.
+// A lexer with checkpoint reads only the flagged state of previous line when restarting at a line start,
+// so lexing from any line with same checkpoint gives same result, and it can lex concurrently on other threads.
+enum {
+	lexerCallLineCheckpoint = 0x4C43,
+};
+
+// For lexer with lineCheckpointSection, PrivateCall(lexerCallSectionStart, const int *checkpoint) with
+// {style, lineState} of previous line returns non null when the line starts a section (e.g. HTML text
+// outside script block) where restarting only reads the checkpoint, checkpoint on other lines is not used.
+enum {
+	lexerCallSectionStart = 0x4C53,
+};
+
+enum {
+	lineCheckpointNone = 0,
+	lineCheckpointStyle = 1,		// style of last character on previous line
+	lineCheckpointLineState = 2,	// line state of previous line
+	lineCheckpointLevel = 4,		// fold level of previous line
+	lineCheckpointSection = 8,		// checkpoint is only valid at section start
+};
+
 class ILexer5 {
 public:
 	virtual int SCI_METHOD Version() const noexcept = 0;
@@ -2,6 +2,7 @@
 /** @file ILoader.h
  ** Interface for loading into a Scintilla document from a background thread.
  ** Interface for manipulating a document without a view.
+ ** Interface for reading a document from a background thread.
  **/
 // Copyright 1998-2017 by Neil Hodgson <neilh@scintilla.org>
 // The License.txt file describes the conditions under which this software may be distributed.
@@ -31,4 +32,18 @@ public:
 	virtual int SCI_METHOD Release() noexcept = 0;
 };
 
+// Read only copy of document text, all methods can be called from any thread.
+class IDocumentSnapshot {
+public:
+	// Lifetime control
+	virtual int SCI_METHOD AddRef() noexcept = 0;
+	virtual int SCI_METHOD Release() noexcept = 0;
+
+	// NUL terminated text when the snapshot was created
+	virtual const char * SCI_METHOD Text() const noexcept = 0;
+	virtual Sci_Position SCI_METHOD Length() const noexcept = 0;
+	// Document changed after the snapshot was created, results computed from it should be discarded.
+	virtual bool SCI_METHOD IsStale() const noexcept = 0;
+};
+
 }
@@ -32,6 +32,8 @@ typedef intptr_t sptr_t;
 
 typedef sptr_t (*SciFnDirect)(sptr_t ptr, unsigned int iMessage, uptr_t wParam, sptr_t lParam);
 typedef sptr_t (*SciFnDirectStatus)(sptr_t ptr, unsigned int iMessage, uptr_t wParam, sptr_t lParam, int *pStatus);
+// Fill styles for one line from its text, used when document has no style buffer.
+typedef void (*SciFnLineStyler)(const char *text, unsigned char *styles, Sci_Position length);
 
 #ifndef SCI_DISABLE_AUTOGENERATED
 
@@ -65,6 +67,8 @@ typedef sptr_t (*SciFnDirectStatus)(sptr_t ptr, unsigned int iMessage, uptr_t wP
 #define SCI_MARKERHANDLEFROMLINE 2732
 #define SCI_MARKERNUMBERFROMLINE 2733
 #define SCI_GETUNDOCOLLECTION 2019
+#define SCI_SETUNDOMEMORYBUDGET 2821
+#define SCI_GETUNDOMEMORYBUDGET 2822
 #define SCWS_INVISIBLE 0
 #define SCWS_VISIBLEALWAYS 1
 #define SCWS_VISIBLEAFTERINDENT 2
@@ -93,6 +97,8 @@ typedef sptr_t (*SciFnDirectStatus)(sptr_t ptr, unsigned int iMessage, uptr_t wP
 #define SCI_SETSTYLING 2033
 #define SCI_GETBUFFEREDDRAW 2034
 #define SCI_SETBUFFEREDDRAW 2035
+#define SCI_GETSCROLLBLIT 2831
+#define SCI_SETSCROLLBLIT 2830
 #define SCI_SETTABWIDTH 2036
 #define SCI_GETTABWIDTH 2121
 #define SCI_SETTABMINIMUMWIDTH 2724
@@ -511,7 +517,10 @@ typedef sptr_t (*SciFnDirectStatus)(sptr_t ptr, unsigned int iMessage, uptr_t wP
 #define SCFIND_POSIX 0x40
 #define SCFIND_CXX11REGEX 0x80
 #define SCFIND_REGEX_DOT_ALL 0x100
+#define SCFIND_REGEX_DFA 0x200
+#define SCFIND_REGEX_JIT 0x400
 #define SCI_FINDTEXTFULL 2196
+#define SCI_FINDALLFULL 2827
 #define SCI_FORMATRANGEFULL 2777
 #define SC_CHANGE_HISTORY_DISABLED 0
 #define SC_CHANGE_HISTORY_ENABLED 1
@@ -528,6 +537,7 @@ typedef sptr_t (*SciFnDirectStatus)(sptr_t ptr, unsigned int iMessage, uptr_t wP
 #define SCI_GETLINE 2153
 #define SCI_GETLINECOUNT 2154
 #define SCI_ALLOCATELINES 2089
+#define SCI_SETLINESTARTSHINT 2820
 #define SCI_SETMARGINLEFT 2155
 #define SCI_GETMARGINLEFT 2156
 #define SCI_SETMARGINRIGHT 2157
@@ -583,6 +593,8 @@ typedef sptr_t (*SciFnDirectStatus)(sptr_t ptr, unsigned int iMessage, uptr_t wP
 #define SCI_REPLACETARGETRE 2195
 #define SCI_REPLACETARGETMINIMAL 2779
 #define SCI_SEARCHINTARGET 2197
+#define SCI_REPLACEALLINTARGET 2825
+#define SCI_REPLACEALLINTARGETRE 2826
 #define SCI_SETSEARCHFLAGS 2198
 #define SCI_GETSEARCHFLAGS 2199
 #define SCI_CALLTIPSHOW 2200
@@ -632,10 +644,12 @@ typedef sptr_t (*SciFnDirectStatus)(sptr_t ptr, unsigned int iMessage, uptr_t wP
 #define SC_FOLDACTION_EXPAND 1
 #define SC_FOLDACTION_TOGGLE 2
 #define SC_FOLDACTION_CONTRACT_EVERY_LEVEL 4
+#define SC_FOLDACTION_NESTING_DEPTH 8
 #define SCI_FOLDLINE 2237
 #define SCI_FOLDCHILDREN 2238
 #define SCI_EXPANDCHILDREN 2239
 #define SCI_FOLDALL 2662
+#define SCI_FOLDATLEVEL 2833
 #define SCI_ENSUREVISIBLE 2232
 #define SC_AUTOMATICFOLD_NONE 0x0000
 #define SC_AUTOMATICFOLD_SHOW 0x0001
@@ -668,6 +682,12 @@ typedef sptr_t (*SciFnDirectStatus)(sptr_t ptr, unsigned int iMessage, uptr_t wP
 #define SC_IDLESTYLING_ALL 3
 #define SCI_SETIDLESTYLING 2692
 #define SCI_GETIDLESTYLING 2693
+#define SCI_SETBACKGROUNDSTYLING 2837
+#define SCI_GETBACKGROUNDSTYLING 2838
+#define SCI_SETLINESTYLER 2840
+#define SCI_GETLINESTYLER 2841
+#define SCI_GETSTYLINGCACHE 2842
+#define SCI_SETSTYLINGCACHE 2843
 #define SC_WRAP_NONE 0
 #define SC_WRAP_WORD 1
 #define SC_WRAP_CHAR 2
@@ -843,11 +863,16 @@ typedef sptr_t (*SciFnDirectStatus)(sptr_t ptr, unsigned int iMessage, uptr_t wP
 #define SCI_GETZOOM 2374
 #define SC_DOCUMENTOPTION_DEFAULT 0
 #define SC_DOCUMENTOPTION_STYLES_NONE 0x1
+#define SC_DOCUMENTOPTION_STYLES_RUNS 0x2
 #define SC_DOCUMENTOPTION_TEXT_LARGE 0x100
+#define SC_DOCUMENTOPTION_SEARCH_INDEX 0x200
+#define SC_DOCUMENTOPTION_CHARACTER_BLOCK_INDEX 0x400
+#define SC_DOCUMENTOPTION_BRACE_INDEX 0x800
 #define SCI_CREATEDOCUMENT 2375
 #define SCI_ADDREFDOCUMENT 2376
 #define SCI_RELEASEDOCUMENT 2377
 #define SCI_GETDOCUMENTOPTIONS 2379
+#define SCI_SETDOCUMENTOPTIONS 2839
 #define SCI_GETMODEVENTMASK 2378
 #define SCI_SETCOMMANDEVENTS 2717
 #define SCI_GETCOMMANDEVENTS 2718
@@ -983,12 +1008,34 @@ typedef sptr_t (*SciFnDirectStatus)(sptr_t ptr, unsigned int iMessage, uptr_t wP
 #define SCI_GETINDICATORVALUE 2503
 #define SCI_INDICATORFILLRANGE 2504
 #define SCI_INDICATORCLEARRANGE 2505
+#define SCI_INDICATORFILLRANGES 2828
 #define SCI_INDICATORALLONFOR 2506
 #define SCI_INDICATORVALUEAT 2507
 #define SCI_INDICATORSTART 2508
 #define SCI_INDICATOREND 2509
 #define SCI_SETPOSITIONCACHE 2514
 #define SCI_GETPOSITIONCACHE 2515
+#define SC_POSITIONCACHESTATISTIC_SHARDS 0
+#define SC_POSITIONCACHESTATISTIC_HITS 1
+#define SC_POSITIONCACHESTATISTIC_MISSES 2
+#define SCI_GETPOSITIONCACHESTATISTIC 2829
+#define SC_FRAMESTATISTIC_PAINTTIME 0
+#define SC_FRAMESTATISTIC_PAINTLINESTART 1
+#define SC_FRAMESTATISTIC_PAINTLINEEND 2
+#define SC_FRAMESTATISTIC_WRAPTIME 3
+#define SC_FRAMESTATISTIC_WRAPLINES 4
+#define SC_FRAMESTATISTIC_STYLETIME 5
+#define SC_FRAMESTATISTIC_STYLEBYTES 6
+#define SC_FRAMESTATISTIC_IDLETIME 7
+#define SCI_GETFRAMESTATISTIC 2832
+#define SCI_SETLAYOUTCACHEBUDGET 2834
+#define SCI_GETLAYOUTCACHEBUDGET 2835
+#define SC_LAYOUTCACHESTATISTIC_HITS 0
+#define SC_LAYOUTCACHESTATISTIC_MISSES 1
+#define SC_LAYOUTCACHESTATISTIC_EVICTIONS 2
+#define SC_LAYOUTCACHESTATISTIC_LONGLINES 3
+#define SC_LAYOUTCACHESTATISTIC_LONGBYTES 4
+#define SCI_GETLAYOUTCACHESTATISTIC 2836
 #define SCI_COPYALLOWLINE 2519
 #define SCI_CUTALLOWLINE 2810
 #define SCI_SETCOPYSEPARATOR 2811
@@ -1116,6 +1163,28 @@ typedef sptr_t (*SciFnDirectStatus)(sptr_t ptr, unsigned int iMessage, uptr_t wP
 #define SCI_SETTECHNOLOGY 2630
 #define SCI_GETTECHNOLOGY 2631
 #define SCI_CREATELOADER 2632
+#define SCI_CREATEDOCUMENTSNAPSHOT 2823
+#define SC_MEMORYUSAGE_SUBSTANCE 0
+#define SC_MEMORYUSAGE_STYLE 1
+#define SC_MEMORYUSAGE_LINE_INDEX 2
+#define SC_MEMORYUSAGE_CHARACTER_INDEX 3
+#define SC_MEMORYUSAGE_UNDO 4
+#define SC_MEMORYUSAGE_CHANGE_HISTORY 5
+#define SC_MEMORYUSAGE_DECORATION 6
+#define SC_MEMORYUSAGE_MARKER 7
+#define SC_MEMORYUSAGE_FOLD_LEVEL 8
+#define SC_MEMORYUSAGE_LINE_LAYOUT 9
+#define SC_MEMORYUSAGE_POSITION_CACHE 10
+#define SC_MEMORYUSAGE_SEARCH_INDEX 11
+#define SC_MEMORYUSAGE_CHARACTER_BLOCK_INDEX 12
+#define SC_MEMORYUSAGE_BRACE_INDEX 13
+#define SCI_GETMEMORYUSAGE 2824
+#define SC_RELEASECACHE_LAYOUT 0
+#define SC_RELEASECACHE_INDEX 1
+#define SC_RELEASECACHE_UNDO 2
+#define SCI_RELEASECACHES 2844
+#define SCI_SETSTYLINGDURATION 2845
+#define SCI_GETSTYLINGDURATION 2846
 #define SCI_FINDINDICATORSHOW 2640
 #define SCI_FINDINDICATORFLASH 2641
 #define SCI_FINDINDICATORHIDE 2642
@@ -1235,7 +1304,8 @@ typedef sptr_t (*SciFnDirectStatus)(sptr_t ptr, unsigned int iMessage, uptr_t wP
 #define SC_MOD_INSERTCHECK 0x100000
 #define SC_MOD_CHANGETABSTOPS 0x200000
 #define SC_MOD_CHANGEEOLANNOTATION 0x400000
-#define SC_MODEVENTMASKALL 0x7FFFFF
+#define SC_MOD_BATCHUPDATE 0x800000
+#define SC_MODEVENTMASKALL 0xFFFFFF
 #define SC_UPDATE_NONE 0x0
 #define SC_UPDATE_CONTENT 0x1
 #define SC_UPDATE_SELECTION 0x2
@@ -1344,6 +1414,13 @@ struct Sci_TextToFindFull {
 	struct Sci_CharacterRangeFull chrgText;
 };
 
+struct Sci_TextToFindAllFull {
+	struct Sci_CharacterRangeFull chrg;
+	const char *lpstrText;
+	Sci_Position *ranges;
+	Sci_Position maxCount;
+};
+
 typedef void *Sci_SurfaceID;
 
 struct Sci_Rectangle {
@@ -1416,4 +1493,5 @@ struct SCNotification {
 	/* SCN_AUTOCSELECTION, SCN_AUTOCCOMPLETED, SCN_USERLISTSELECTION */
 	int characterSource;	/* SCN_CHARADDED */
 	int oldCodePage;		/* SCN_CODEPAGECHANGED */
+	Sci_Position lengthBefore;	/* SCN_MODIFIED with SC_MOD_BATCHUPDATE */
 };
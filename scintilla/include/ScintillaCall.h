@@ -16,6 +16,7 @@ enum class Message;	// Declare in case ScintillaMessages.h not included
 // Declare in case ScintillaStructures.h not included
 struct TextRangeFull;
 struct TextToFindFull;
+struct TextToFindAllFull;
 struct RangeToFormatFull;
 
 class IDocumentEditable;
@@ -108,6 +109,8 @@ public:
 	int MarkerHandleFromLine(Line line, int which);
 	int MarkerNumberFromLine(Line line, int which);
 	bool UndoCollection();
+	void SetUndoMemoryBudget(Position bytes);
+	Position UndoMemoryBudget();
 	Scintilla::WhiteSpace ViewWS();
 	void SetViewWS(Scintilla::WhiteSpace viewWS);
 	Scintilla::TabDrawMode TabDrawMode();
@@ -127,6 +130,8 @@ public:
 	void SetStyling(Position length, int style);
 	bool BufferedDraw();
 	void SetBufferedDraw(bool buffered);
+	bool ScrollBlit();
+	void SetScrollBlit(bool blit);
 	void SetTabWidth(int tabWidth);
 	int TabWidth();
 	void SetTabMinimumWidth(int pixels);
@@ -344,6 +349,7 @@ public:
 	void SetPrintColourMode(Scintilla::PrintOption mode);
 	Scintilla::PrintOption PrintColourMode();
 	Position FindTextFull(Scintilla::FindOption searchFlags, TextToFindFull *ft);
+	Position FindAllFull(Scintilla::FindOption searchFlags, TextToFindAllFull *ft);
 	Position FormatRangeFull(bool draw, const RangeToFormatFull *fr);
 	void SetChangeHistory(Scintilla::ChangeHistoryOption changeHistory);
 	Scintilla::ChangeHistoryOption ChangeHistory();
@@ -354,6 +360,7 @@ public:
 	std::string GetLine(Line line);
 	Line LineCount();
 	void AllocateLines(Line lines);
+	void SetLineStartsHint(Line lines, void *lineStarts);
 	void SetMarginLeft(int pixelWidth);
 	int MarginLeft();
 	void SetMarginRight(int pixelWidth);
@@ -412,6 +419,8 @@ public:
 	Position ReplaceTargetRE(Position length, const char *text);
 	Position ReplaceTargetMinimal(Position length, const char *text);
 	Position SearchInTarget(Position length, const char *text);
+	Position ReplaceAllInTarget(const char *search, const char *text);
+	Position ReplaceAllInTargetRE(const char *search, const char *text);
 	void SetSearchFlags(Scintilla::FindOption searchFlags);
 	Scintilla::FindOption SearchFlags();
 	void CallTipShow(Position pos, const char *definition);
@@ -450,6 +459,7 @@ public:
 	void FoldChildren(Line line, Scintilla::FoldAction action);
 	void ExpandChildren(Line line, Scintilla::FoldLevel level);
 	void FoldAll(Scintilla::FoldAction action);
+	void FoldAtLevel(Scintilla::FoldAction action, int level);
 	void EnsureVisible(Line line);
 	void SetAutomaticFold(Scintilla::AutomaticFold automaticFold);
 	Scintilla::AutomaticFold AutomaticFold();
@@ -466,6 +476,13 @@ public:
 	bool IsRangeWord(Position start, Position end);
 	void SetIdleStyling(Scintilla::IdleStyling idleStyling);
 	Scintilla::IdleStyling IdleStyling();
+	void SetBackgroundStyling(bool background);
+	bool BackgroundStyling();
+	void SetLineStyler(void *styler);
+	void *LineStyler();
+	Position StylingCache(char *cache);
+	std::string StylingCache();
+	bool SetStylingCache(Position length, const char *cache);
 	void SetWrapMode(Scintilla::Wrap wrapMode);
 	Scintilla::Wrap WrapMode();
 	void SetWrapVisualFlags(Scintilla::WrapVisualFlag wrapVisualFlags);
@@ -600,6 +617,7 @@ public:
 	void AddRefDocument(IDocumentEditable *doc);
 	void ReleaseDocument(IDocumentEditable *doc);
 	Scintilla::DocumentOption DocumentOptions();
+	void SetDocumentOptions(Scintilla::DocumentOption documentOptions);
 	Scintilla::ModificationFlags ModEventMask();
 	void SetCommandEvents(bool commandEvents);
 	bool CommandEvents();
@@ -706,12 +724,18 @@ public:
 	int IndicatorValue();
 	void IndicatorFillRange(Position start, Position lengthFill);
 	void IndicatorClearRange(Position start, Position lengthClear);
+	void IndicatorFillRanges(Position count, void *ranges);
 	int IndicatorAllOnFor(Position pos);
 	int IndicatorValueAt(int indicator, Position pos);
 	Position IndicatorStart(int indicator, Position pos);
 	Position IndicatorEnd(int indicator, Position pos);
 	void SetPositionCache(int size);
 	int PositionCache();
+	Position PositionCacheStatistic(Scintilla::PositionCacheStatistic statistic, int shard);
+	Position FrameStatistic(Scintilla::FrameStatistic statistic);
+	void SetLayoutCacheBudget(Position bytes);
+	Position LayoutCacheBudget();
+	Position LayoutCacheStatistic(Scintilla::LayoutCacheStatistic statistic);
 	void CopyAllowLine();
 	void CutAllowLine();
 	void SetCopySeparator(const char *separator);
@@ -827,6 +851,11 @@ public:
 	void SetTechnology(Scintilla::Technology technology);
 	Scintilla::Technology Technology();
 	void *CreateLoader(Position bytes, Scintilla::DocumentOption documentOptions);
+	void *CreateDocumentSnapshot();
+	Position MemoryUsage(Scintilla::MemoryUsage usage);
+	void ReleaseCaches(Scintilla::ReleaseCache level);
+	void SetStylingDuration(int nanoseconds);
+	int StylingDuration();
 	void FindIndicatorShow(Position start, Position end);
 	void FindIndicatorFlash(Position start, Position end);
 	void FindIndicatorHide();
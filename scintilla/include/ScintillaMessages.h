@@ -39,6 +39,8 @@ enum class Message {
 	MarkerHandleFromLine = 2732,
 	MarkerNumberFromLine = 2733,
 	GetUndoCollection = 2019,
+	SetUndoMemoryBudget = 2821,
+	GetUndoMemoryBudget = 2822,
 	GetViewWS = 2020,
 	SetViewWS = 2021,
 	GetTabDrawMode = 2698,
@@ -57,6 +59,8 @@ enum class Message {
 	SetStyling = 2033,
 	GetBufferedDraw = 2034,
 	SetBufferedDraw = 2035,
+	GetScrollBlit = 2831,
+	SetScrollBlit = 2830,
 	SetTabWidth = 2036,
 	GetTabWidth = 2121,
 	SetTabMinimumWidth = 2724,
@@ -269,6 +273,7 @@ enum class Message {
 	SetPrintColourMode = 2148,
 	GetPrintColourMode = 2149,
 	FindTextFull = 2196,
+	FindAllFull = 2827,
 	FormatRangeFull = 2777,
 	SetChangeHistory = 2780,
 	GetChangeHistory = 2781,
@@ -278,6 +283,7 @@ enum class Message {
 	GetLine = 2153,
 	GetLineCount = 2154,
 	AllocateLines = 2089,
+	SetLineStartsHint = 2820,
 	SetMarginLeft = 2155,
 	GetMarginLeft = 2156,
 	SetMarginRight = 2157,
@@ -333,6 +339,8 @@ enum class Message {
 	ReplaceTargetRE = 2195,
 	ReplaceTargetMinimal = 2779,
 	SearchInTarget = 2197,
+	ReplaceAllInTarget = 2825,
+	ReplaceAllInTargetRE = 2826,
 	SetSearchFlags = 2198,
 	GetSearchFlags = 2199,
 	CallTipShow = 2200,
@@ -370,6 +378,7 @@ enum class Message {
 	FoldChildren = 2238,
 	ExpandChildren = 2239,
 	FoldAll = 2662,
+	FoldAtLevel = 2833,
 	EnsureVisible = 2232,
 	SetAutomaticFold = 2663,
 	GetAutomaticFold = 2664,
@@ -386,6 +395,12 @@ enum class Message {
 	IsRangeWord = 2691,
 	SetIdleStyling = 2692,
 	GetIdleStyling = 2693,
+	SetBackgroundStyling = 2837,
+	GetBackgroundStyling = 2838,
+	SetLineStyler = 2840,
+	GetLineStyler = 2841,
+	GetStylingCache = 2842,
+	SetStylingCache = 2843,
 	SetWrapMode = 2268,
 	GetWrapMode = 2269,
 	SetWrapVisualFlags = 2460,
@@ -519,6 +534,7 @@ enum class Message {
 	AddRefDocument = 2376,
 	ReleaseDocument = 2377,
 	GetDocumentOptions = 2379,
+	SetDocumentOptions = 2839,
 	GetModEventMask = 2378,
 	SetCommandEvents = 2717,
 	GetCommandEvents = 2718,
@@ -620,12 +636,18 @@ enum class Message {
 	GetIndicatorValue = 2503,
 	IndicatorFillRange = 2504,
 	IndicatorClearRange = 2505,
+	IndicatorFillRanges = 2828,
 	IndicatorAllOnFor = 2506,
 	IndicatorValueAt = 2507,
 	IndicatorStart = 2508,
 	IndicatorEnd = 2509,
 	SetPositionCache = 2514,
 	GetPositionCache = 2515,
+	GetPositionCacheStatistic = 2829,
+	GetFrameStatistic = 2832,
+	SetLayoutCacheBudget = 2834,
+	GetLayoutCacheBudget = 2835,
+	GetLayoutCacheStatistic = 2836,
 	CopyAllowLine = 2519,
 	CutAllowLine = 2810,
 	SetCopySeparator = 2811,
@@ -736,6 +758,11 @@ enum class Message {
 	SetTechnology = 2630,
 	GetTechnology = 2631,
 	CreateLoader = 2632,
+	CreateDocumentSnapshot = 2823,
+	GetMemoryUsage = 2824,
+	ReleaseCaches = 2844,
+	SetStylingDuration = 2845,
+	GetStylingDuration = 2846,
 	FindIndicatorShow = 2640,
 	FindIndicatorFlash = 2641,
 	FindIndicatorHide = 2642,
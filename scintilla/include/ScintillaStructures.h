@@ -26,6 +26,13 @@ struct TextToFindFull final {
 	CharacterRangeFull chrgText;
 };
 
+struct TextToFindAllFull final {
+	CharacterRangeFull chrg;
+	const char *lpstrText;
+	Position *ranges;
+	Position maxCount;
+};
+
 using SurfaceID = void *;
 
 struct Rectangle final {
@@ -99,6 +106,7 @@ struct NotificationData final {
 	/* SCN_AUTOCSELECTION, SCN_AUTOCCOMPLETED, SCN_USERLISTSELECTION */
 	CharacterSource characterSource;	/* SCN_CHARADDED */
 	int oldCodePage;/* SCN_CODEPAGECHANGED */
+	Position lengthBefore;	/* SCN_MODIFIED with SC_MOD_BATCHUPDATE */
 };
 
 }
@@ -295,6 +295,8 @@ enum class FindOption {
 	Posix = 0x40,
 	Cxx11RegEx = 0x80,
 	RegexDotAll = 0x100,
+	RegexDfa = 0x200,
+	RegexJit = 0x400,
 };
 
 enum class ChangeHistoryOption {
@@ -336,6 +338,7 @@ enum class FoldAction {
 	Expand = 1,
 	Toggle = 2,
 	ContractEveryLevel = 4,
+	NestingDepth = 8,
 };
 
 enum class AutomaticFold {
@@ -443,7 +446,11 @@ enum class PopUp {
 enum class DocumentOption {
 	Default = 0,
 	StylesNone = 0x1,
+	StylesRuns = 0x2,
 	TextLarge = 0x100,
+	SearchIndex = 0x200,
+	CharacterBlockIndex = 0x400,
+	BraceIndex = 0x800,
 };
 
 enum class Status {
@@ -507,6 +514,31 @@ enum class CaretStyle {
 	BlockAfter = 0x100,
 };
 
+enum class PositionCacheStatistic {
+	Shards = 0,
+	Hits = 1,
+	Misses = 2,
+};
+
+enum class FrameStatistic {
+	PaintTime = 0,
+	PaintLineStart = 1,
+	PaintLineEnd = 2,
+	WrapTime = 3,
+	WrapLines = 4,
+	StyleTime = 5,
+	StyleBytes = 6,
+	IdleTime = 7,
+};
+
+enum class LayoutCacheStatistic {
+	Hits = 0,
+	Misses = 1,
+	Evictions = 2,
+	LongLines = 3,
+	LongBytes = 4,
+};
+
 enum class MarginOption {
 	None = 0,
 	SubLineSelect = 1,
@@ -539,6 +571,29 @@ enum class Technology {
 	DirectWrite1 = 4,
 };
 
+enum class MemoryUsage {
+	Substance = 0,
+	Style = 1,
+	LineIndex = 2,
+	CharacterIndex = 3,
+	Undo = 4,
+	ChangeHistory = 5,
+	Decoration = 6,
+	Marker = 7,
+	FoldLevel = 8,
+	LineLayout = 9,
+	PositionCache = 10,
+	SearchIndex = 11,
+	CharacterBlockIndex = 12,
+	BraceIndex = 13,
+};
+
+enum class ReleaseCache {
+	Layout = 0,
+	Index = 1,
+	Undo = 2,
+};
+
 enum class LineEndType {
 	Default = 0,
 	Unicode = 1,
@@ -611,7 +666,8 @@ enum class ModificationFlags {
 	InsertCheck = 0x100000,
 	ChangeTabStops = 0x200000,
 	ChangeEOLAnnotation = 0x400000,
-	EventMaskAll = 0x7FFFFF,
+	BatchUpdate = 0x800000,
+	EventMaskAll = 0xFFFFFF,
 };
 
 enum class Update {
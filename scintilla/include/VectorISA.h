@@ -23,8 +23,13 @@
 	#define NP2_USE_SSE2		0
 	#define NP2_USE_AVX2		0
 	#define NP2_USE_AVX512		0
+	#define NP2_DISPATCH_AVX2	0
+	// Advanced SIMD (NEON) is mandatory on AArch64
+	#define NP2_USE_NEON		1
+	#include <arm_neon.h>
 #else
 	#define NP2_TARGET_ARM		0
+	#define NP2_USE_NEON		0
 	// SSE2 enabled by default
 	#define NP2_USE_SSE2		1
 
@@ -48,13 +53,54 @@
 		#define NP2_USE_AVX512	0
 	#endif
 
-	// TODO: use __isa_enabled/__isa_available in MSVC build to dynamic enable AVX2 code.
-	//#if defined(_MSC_VER) || (defined(__has_include) && __has_include(<isa_availability.h>))
-	//	#include <isa_availability.h>
-	//#else
-	//#endif
+	// x64 build without AVX2 also compiles AVX2 and AVX-512 kernels for hot loops,
+	// and selects them at runtime with np2_cpu_features().
+	#if defined(_WIN64) && !NP2_USE_AVX2
+		#define NP2_DISPATCH_AVX2	1
+	#else
+		#define NP2_DISPATCH_AVX2	0
+	#endif
+#endif
 
-	// TODO: Function Multiversioning https://gcc.gnu.org/wiki/FunctionMultiVersioning
+#if !NP2_TARGET_ARM
+enum {
+	NP2_CPU_FEATURE_SSSE3 = 1,
+	NP2_CPU_FEATURE_AVX2 = 2,		// AVX2 and YMM state enabled by OS
+	NP2_CPU_FEATURE_AVX512BW = 4,	// AVX512F, AVX512BW and ZMM state enabled by OS
+};
+
+// query CPUID once, result is cached for later kernel selection.
+#if defined(__GNUC__) || defined(__clang__)
+__attribute__((__target__("xsave")))
+#endif
+inline uint32_t np2_cpu_features() noexcept {
+	static uint32_t features = UINT32_MAX;
+	if (features == UINT32_MAX) {
+		uint32_t result = 0;
+		int info[4]{};
+		__cpuid(info, 0x00000000);
+		const int maxLeaf = info[0];
+		__cpuid(info, 0x00000001);
+		if (info[2] & 0x00000200) {
+			result |= NP2_CPU_FEATURE_SSSE3;
+		}
+		// OSXSAVE, then check enabled states with XGETBV
+		if (maxLeaf >= 7 && (info[2] & 0x08000000)) {
+			const uint64_t xcr0 = _xgetbv(0);
+			__cpuidex(info, 0x00000007, 0);
+			// AVX2, XMM and YMM state
+			if ((info[1] & 0x00000020) && (xcr0 & 0x06) == 0x06) {
+				result |= NP2_CPU_FEATURE_AVX2;
+				// AVX512F and AVX512BW, opmask and ZMM state
+				if ((info[1] & 0x40010000) == 0x40010000 && (xcr0 & 0xE6) == 0xE6) {
+					result |= NP2_CPU_FEATURE_AVX512BW;
+				}
+			}
+		}
+		features = result;
+	}
+	return features;
+}
 #endif
 
 // for C++20, use functions from <bit> header.
@@ -178,6 +224,16 @@
 #define mm_cmple_epu8(a, b)		mm_cmpge_epu8((b), (a))
 #endif
 
+#if NP2_USE_NEON
+// NEON has no movemask, narrow comparison result to 4 bits for each byte.
+// https://community.arm.com/arm-community-blogs/b/infrastructure-solutions-blog/posts/porting-x86-vector-bitmask-optimizations-to-arm-neon
+inline uint64_t neon_nibble_mask(uint8x16_t cmp) noexcept {
+	return vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(cmp), 4)), 0);
+}
+// one bit for each byte at bit index 4*i
+#define neon_byte_mask(cmp)		(neon_nibble_mask(cmp) & UINT64_C(0x1111111111111111))
+#endif
+
 
 #if defined(__GNUC__) || defined(__clang__)
 #define bswap16(x)				__builtin_bswap16(x)
@@ -372,11 +372,15 @@ void ColouriseCppDoc(Sci_PositionU startPos, Sci_Position length, int initStyle,
 			if (sc.Match('*', '/')) {
 				sc.Forward();
 				sc.ForwardSetState(SCE_C_DEFAULT);
+			} else {
+				sc.SkipToAny("*\\");
 			}
 			break;
 		case SCE_C_COMMENTLINE:
 			if (sc.atLineStart && !continuationLine) {
 				sc.SetState(SCE_C_DEFAULT);
+			} else {
+				sc.SkipToAny("\\");
 			}
 			break;
 		case SCE_C_COMMENTDOC:
@@ -489,6 +493,10 @@ void ColouriseCppDoc(Sci_PositionU startPos, Sci_Position length, int initStyle,
 					outerStyle = SCE_C_DEFAULT;
 					sc.ForwardSetState(SCE_C_DEFAULT);
 				}
+			} else if (sc.state == SCE_C_CHARACTER) {
+				sc.SkipToAny("\\'");
+			} else {
+				sc.SkipToAny(isIncludePreprocessor ? "\\\">" : "\\\"");
 			}
 			break;
 		case SCE_C_ESCAPECHAR:
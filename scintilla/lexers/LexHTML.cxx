@@ -403,7 +403,11 @@ void ColouriseHyperTextDoc(Sci_PositionU startPos, Sci_Position length, int init
 	//	Set to 0 to disable scripts in XML.
 	const bool allowScripts = styler.GetPropertyBool("lexer.xml.allow.scripts", true);
 
-	int levelPrev = styler.LevelAt(lineCurrent) & SC_FOLDLEVELNUMBERMASK;
+	// level at line start is saved into upper 16 bits of previous line
+	int levelPrev = SC_FOLDLEVELBASE;
+	if (lineCurrent > 0) {
+		levelPrev = sci::max(styler.LevelAt(lineCurrent - 1) >> 16, SC_FOLDLEVELBASE);
+	}
 	int levelCurrent = levelPrev;
 
 	int chPrev = ' ';
@@ -470,7 +474,7 @@ void ColouriseHyperTextDoc(Sci_PositionU startPos, Sci_Position length, int init
 				if ((levelCurrent > levelPrev))
 					lev |= SC_FOLDLEVELHEADERFLAG;
 
-				styler.SetLevel(lineCurrent, lev);
+				styler.SetLevel(lineCurrent, lev | (levelCurrent << 16));
 				levelPrev = levelCurrent;
 			}
 			styler.SetLineState(lineCurrent,
@@ -1269,7 +1273,7 @@ void ColouriseHyperTextDoc(Sci_PositionU startPos, Sci_Position length, int init
 
 	// Fill in the real level of the next line, keeping the current flags as they will be filled in later
 	if (fold) {
-		const int flagsNext = styler.LevelAt(lineCurrent) & ~SC_FOLDLEVELNUMBERMASK;
+		const int flagsNext = styler.LevelAt(lineCurrent) & (SC_FOLDLEVELWHITEFLAG | SC_FOLDLEVELHEADERFLAG);
 		styler.SetLevel(lineCurrent, levelPrev | flagsNext);
 	}
 }
@@ -1284,7 +1288,15 @@ void ColouriseHTMLDoc(Sci_PositionU startPos, Sci_Position length, int initStyle
 	ColouriseHyperTextDoc(startPos, length, initStyle, keywordLists, styler, false);
 }
 
+// text line outside of tag and script, restarting from it doesn't look back
+constexpr bool IsHyperTextSectionStart(int style, int lineState) noexcept {
+	return style == SCE_H_DEFAULT && (lineState & 0x0f) == 0;
+}
+
+constexpr int lineCheckpointHyperText = Scintilla::lineCheckpointStyle | Scintilla::lineCheckpointLineState
+	| Scintilla::lineCheckpointLevel | Scintilla::lineCheckpointSection;
+
 }
 
-extern const LexerModule lmHTML(SCLEX_HTML, ColouriseHTMLDoc, "hypertext");
-extern const LexerModule lmXML(SCLEX_XML, ColouriseXMLDoc, "xml");
+extern const LexerModule lmHTML(SCLEX_HTML, ColouriseHTMLDoc, "hypertext", nullptr, lineCheckpointHyperText, IsHyperTextSectionStart);
+extern const LexerModule lmXML(SCLEX_XML, ColouriseXMLDoc, "xml", nullptr, lineCheckpointHyperText, IsHyperTextSectionStart);
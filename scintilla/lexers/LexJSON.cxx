@@ -58,6 +58,8 @@ bool IsJsonProperty(LexAccessor &styler, Sci_PositionU startPos, uint8_t chNext)
 
 void ColouriseJSONDoc(Sci_PositionU startPos, Sci_Position lengthDoc, int initStyle, LexerWordList keywordLists, Accessor &styler) {
 	const bool fold = styler.GetPropertyBool("fold");
+	// trail byte in DBCS character may be backslash or quote
+	const bool skipBody = styler.Encoding() != EncodingType::dbcs;
 
 	// JSON5 line continuation
 	bool lineContinuation = false;
@@ -182,6 +184,10 @@ void ColouriseJSONDoc(Sci_PositionU startPos, Sci_Position lengthDoc, int initSt
 				styler.ColorTo(startPos, state);
 				state = SCE_JSON_DEFAULT;
 				continue;
+			} else if (skipBody) {
+				const char stops[] = {'\\', static_cast<char>(GetStringQuote(state)), '\0'};
+				startPos = styler.FindAnyOf(startPos, sci::min(lineStartNext, endPos), stops);
+				chNext = styler[startPos];
 			}
 			break;
 
@@ -189,6 +195,9 @@ void ColouriseJSONDoc(Sci_PositionU startPos, Sci_Position lengthDoc, int initSt
 			if (atLineStart) {
 				styler.ColorTo(currentPos, state);
 				state = SCE_JSON_DEFAULT;
+			} else if (skipBody) {
+				startPos = sci::min(lineStartNext, endPos);
+				chNext = styler[startPos];
 			}
 			break;
 
@@ -200,6 +209,9 @@ void ColouriseJSONDoc(Sci_PositionU startPos, Sci_Position lengthDoc, int initSt
 				state = SCE_JSON_DEFAULT;
 				levelNext--;
 				continue;
+			} else if (skipBody) {
+				startPos = styler.FindAnyOf(startPos, sci::min(lineStartNext, endPos), "*");
+				chNext = styler[startPos];
 			}
 			break;
 		}
@@ -271,4 +283,4 @@ void ColouriseJSONDoc(Sci_PositionU startPos, Sci_Position lengthDoc, int initSt
 
 }
 
-extern const LexerModule lmJSON(SCLEX_JSON, ColouriseJSONDoc, "json");
+extern const LexerModule lmJSON(SCLEX_JSON, ColouriseJSONDoc, "json", nullptr, Scintilla::lineCheckpointStyle | Scintilla::lineCheckpointLevel);
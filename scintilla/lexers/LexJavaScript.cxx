@@ -336,6 +336,10 @@ void ColouriseJsDoc(Sci_PositionU startPos, Sci_Position lengthDoc, int initStyl
 				nestedState.push_back({sc.state, 1, jsxTagLevel});
 				sc.SetState(SCE_JS_OPERATOR2);
 				sc.Forward();
+			} else {
+				char stops[] = "\\\"$";
+				stops[1] = static_cast<char>(GetStringQuote(sc.state));
+				sc.SkipToAny(stops);
 			}
 			break;
 
@@ -425,6 +429,9 @@ void ColouriseJsDoc(Sci_PositionU startPos, Sci_Position lengthDoc, int initStyl
 					}
 				} else if (HighlightTaskMarker(sc, visibleChars, visibleCharsBefore, SCE_JS_TASKMARKER)) {
 					continue;
+				} else if (visibleChars > visibleCharsBefore + 3) {
+					// too far from comment start for task marker
+					sc.SkipToAny((sc.state == SCE_JS_COMMENTBLOCK || sc.state == SCE_JS_COMMENTBLOCKDOC) ? "*@{" : "@<");
 				}
 			}
 			break;
@@ -232,10 +232,26 @@ struct DelimiterRun {
 	}
 };
 
+// line that may end UpdateParentIndentCount() backward search
+enum class ContainerLineType {
+	ListItem,	// list item first line
+	Paragraph,	// no indentation, ends the search when it starts a block
+	Barrier,
+};
+
+struct ContainerLine {
+	Sci_Line line;
+	uint32_t lineState;
+	ContainerLineType type;
+};
+
 struct MarkdownLexer {
 	StyleContext sc;
 	std::vector<int> nestedState;
 	std::vector<Sci_PositionU> backPos;
+	// lines searched by UpdateParentIndentCount() in lexed range, list items with increasing indentation,
+	// so finding parent container on each line doesn't scan back to the block start.
+	std::vector<ContainerLine> containerLines;
 
 	HtmlTagState tagState = HtmlTagState::None; // html tag, link title
 	int indentParent = 0; // parent container's indentChild
@@ -291,6 +307,10 @@ struct MarkdownLexer {
 	int GetListChildIndentCount(int indentCurrent) const noexcept;
 
 	int UpdateParentIndentCount(int indentCurrent) noexcept;
+	bool IsEmptyLineBefore(Sci_Line line) const noexcept;
+	void AddContainerLine(Sci_Line line, uint32_t lineState);
+	void InitContainerLines();
+	void FindParentIndentCount(int indentCurrent);
 	uint32_t HighlightIndentedText(uint32_t lineState, int indentCount);
 	bool IsIndentedBlockEnd() const noexcept;
 
@@ -677,6 +697,105 @@ int MarkdownLexer::UpdateParentIndentCount(int indentCurrent) noexcept {
 	return indentCurrent;
 }
 
+// empty line between line and previous non-empty line
+bool MarkdownLexer::IsEmptyLineBefore(Sci_Line line) const noexcept {
+	while (line != 0) {
+		--line;
+		const uint32_t lineState = sc.styler.GetLineState(line);
+		if (static_cast<HtmlTagState>(lineState & LineStateHtmlTagMask) == HtmlTagState::None) {
+			return (lineState & LineStateEmptyLine) != 0;
+		}
+	}
+	return false;
+}
+
+// Same rules as UpdateParentIndentCount(), lines before a barrier are not reachable from later lines.
+void MarkdownLexer::AddContainerLine(Sci_Line line, uint32_t lineState) {
+	while (!containerLines.empty() && containerLines.back().line >= line) {
+		containerLines.pop_back();
+	}
+	if ((lineState & (LineStateHtmlTagMask | LineStateEmptyLine)) != 0) {
+		return;
+	}
+	const int indentCount = GetIndentCount(lineState);
+	if (indentCount < MinContainerIndentChild && IsEmptyLineBefore(line)) {
+		containerLines.clear();
+	}
+	if (lineState & LineStateListItemFirstLine) {
+		if (indentCount < MinContainerIndentChild) {
+			containerLines.clear();
+		} else {
+			while (!containerLines.empty() && containerLines.back().type == ContainerLineType::ListItem
+				&& GetIndentCount(containerLines.back().lineState) >= indentCount) {
+				containerLines.pop_back();
+			}
+		}
+		containerLines.push_back({line, lineState, ContainerLineType::ListItem});
+	} else if (indentCount < MinContainerIndentChild) {
+		if (lineState & LineStateBlockMask) {
+			containerLines.clear();
+			containerLines.push_back({line, lineState, ContainerLineType::Barrier});
+		} else {
+			containerLines.push_back({line, lineState, ContainerLineType::Paragraph});
+		}
+	}
+}
+
+// collect lines before current line from where UpdateParentIndentCount() stops for any indentation.
+void MarkdownLexer::InitContainerLines() {
+	Sci_Line line = sc.currentLine;
+	while (line != 0) {
+		--line;
+		const uint32_t lineState = sc.styler.GetLineState(line);
+		if ((lineState & (LineStateHtmlTagMask | LineStateEmptyLine)) != 0
+			|| GetIndentCount(lineState) >= MinContainerIndentChild) {
+			continue;
+		}
+		if ((lineState & LineStateBlockMask) != 0 || IsEmptyLineBefore(line)
+			|| IsBlockStyle(GetBlockStyle(sc.styler, line, lineState))) {
+			break;
+		}
+	}
+	for (; line < sc.currentLine; line++) {
+		AddContainerLine(line, sc.styler.GetLineState(line));
+	}
+}
+
+// UpdateParentIndentCount() for current line with containerLines.
+void MarkdownLexer::FindParentIndentCount(int indentCurrent) {
+	while (!containerLines.empty() && containerLines.back().line >= sc.currentLine) {
+		containerLines.pop_back();
+	}
+	indentParent = 0;
+	if (indentCurrent < MinContainerIndentChild && IsEmptyLineBefore(sc.currentLine)) {
+		return;
+	}
+	size_t index = containerLines.size();
+	while (index != 0) {
+		--index;
+		const ContainerLine &item = containerLines[index];
+		if (item.type == ContainerLineType::ListItem) {
+			const int indentCount = GetIndentCount(item.lineState);
+			if (indentCount < indentCurrent) {
+				indentParent = GetIndentChild(item.lineState);
+				return;
+			}
+			if (indentCount < MinContainerIndentChild) {
+				return;
+			}
+		} else if (item.type == ContainerLineType::Barrier) {
+			return;
+		} else if (IsBlockStyle(GetBlockStyle(sc.styler, item.line, item.lineState))) {
+			// line style is final after the line was lexed
+			containerLines.erase(containerLines.begin(), containerLines.begin() + index);
+			containerLines.front().type = ContainerLineType::Barrier;
+			return;
+		} else {
+			containerLines.erase(containerLines.begin() + index);
+		}
+	}
+}
+
 int MarkdownLexer::GetCurrentDelimiterRun(DelimiterRun &delimiterRun, bool ignoreCurrent) const noexcept {
 	int chPrev = sc.chPrev;
 	int delimiter = sc.ch;
@@ -1666,6 +1785,7 @@ void ColouriseMarkdownDoc(Sci_PositionU startPos, Sci_Position lengthDoc, int in
 		*/
 		indentPrevious = lexer.UpdateParentIndentCount(-1);
 		indentPrevious = sci::max(indentPrevious, 0);
+		lexer.InitContainerLines();
 	}
 	if (startPos == 0) {
 		switch (sc.ch) {
@@ -1763,6 +1883,9 @@ void ColouriseMarkdownDoc(Sci_PositionU startPos, Sci_Position lengthDoc, int in
 					lineState |= LineStateBlockEndLine;
 					break;
 				}
+			} else if (visibleChars != 0) {
+				// only closing fence at line start is checked
+				sc.SkipToAny("");
 			}
 			break;
 
@@ -1771,6 +1894,8 @@ void ColouriseMarkdownDoc(Sci_PositionU startPos, Sci_Position lengthDoc, int in
 				if (lexer.IsIndentedBlockEnd()) {
 					lineState |= LineStateBlockEndLine;
 				}
+			} else if (visibleChars != 0) {
+				sc.SkipToAny("");
 			}
 			break;
 
@@ -2045,6 +2170,8 @@ void ColouriseMarkdownDoc(Sci_PositionU startPos, Sci_Position lengthDoc, int in
 					sc.SetState(lexer.TryTakeOuterStyle());
 					continue;
 				}
+			} else if (visibleChars != 0) {
+				sc.SkipToAny("-");
 			}
 			break;
 
@@ -2125,7 +2252,7 @@ void ColouriseMarkdownDoc(Sci_PositionU startPos, Sci_Position lengthDoc, int in
 			if (sc.ch >= ' ') {
 				if (sc.ch > ' ' && visibleBefore == 0) {
 					if (indentCurrent != indentPrevious) {
-						lexer.UpdateParentIndentCount(indentCurrent);
+						lexer.FindParentIndentCount(indentCurrent);
 					}
 					const int indentCount = indentCurrent - lexer.indentParent;
 					if (indentCount < 4) {
@@ -2190,6 +2317,7 @@ void ColouriseMarkdownDoc(Sci_PositionU startPos, Sci_Position lengthDoc, int in
 				lineState |= LineStateNestedStateLine;
 			}
 			styler.SetLineState(sc.currentLine, static_cast<int>(lineState));
+			lexer.AddContainerLine(sc.currentLine, lineState);
 		}
 		sc.Forward();
 	}
@@ -1556,6 +1556,13 @@ void FoldPHPDoc(Sci_PositionU startPos, Sci_Position lengthDoc, int initStyle, L
 	}
 }
 
+// HTML text line without nested PHP state, restarting from it doesn't backtrack or look back
+constexpr bool IsPHPSectionStart(int style, int lineState) noexcept {
+	return style == SCE_H_DEFAULT && (lineState & LineStateNestedStateLine) == 0;
 }
 
-extern const LexerModule lmPHPScript(SCLEX_PHPSCRIPT, ColourisePHPDoc, "php", FoldPHPDoc);
+}
+
+extern const LexerModule lmPHPScript(SCLEX_PHPSCRIPT, ColourisePHPDoc, "php", FoldPHPDoc,
+	Scintilla::lineCheckpointStyle | Scintilla::lineCheckpointLineState | Scintilla::lineCheckpointLevel | Scintilla::lineCheckpointSection,
+	IsPHPSectionStart);
@@ -729,6 +729,13 @@ void ColourisePyDoc(Sci_PositionU startPos, Sci_Position lengthDoc, int initStyl
 					sc.SetState(SCE_PY_COMMENTTAGAT);
 				}
 				break;
+
+			default:
+				// indentation and URL are checked on every character
+				if (visibleChars != 0 && !insideUrl) {
+					sc.SkipToAny(IsPyDoubleQuotedString(sc.state) ? "\\\"{}%$:!" : "\\'{}%$:!");
+				}
+				break;
 			}
 			break;
 
@@ -805,8 +812,10 @@ void ColourisePyDoc(Sci_PositionU startPos, Sci_Position lengthDoc, int initStyl
 		case SCE_PY_COMMENTLINE:
 			if (sc.atLineStart) {
 				sc.SetState(SCE_PY_DEFAULT);
-			} else {
-				HighlightTaskMarker(sc, visibleChars, visibleCharsBefore, SCE_PY_TASKMARKER);
+			} else if (!HighlightTaskMarker(sc, visibleChars, visibleCharsBefore, SCE_PY_TASKMARKER)
+				&& visibleChars > visibleCharsBefore + 3) {
+				// too far from comment start for task marker
+				sc.SkipToAny("");
 			}
 			break;
 		}
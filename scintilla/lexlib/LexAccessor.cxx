@@ -11,6 +11,7 @@
 
 #include "ILexer.h"
 #include "Scintilla.h"
+#include "VectorISA.h"
 
 #include "LexAccessor.h"
 #include "CharacterSet.h"
@@ -18,6 +19,75 @@
 
 using namespace Lexilla;
 
+namespace {
+
+#if NP2_USE_SSE2
+template <size_t N>
+const char *FindAnyOfSSE2(const char *s, const char *end, const char *stops, size_t count) noexcept {
+	__m128i stop[N];
+	for (size_t i = 0; i < N; i++) {
+		// repeat last character for unused comparison
+		stop[i] = _mm_set1_epi8(stops[sci::min(i, count - 1)]);
+	}
+	while (s + sizeof(__m128i) <= end) {
+		const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i *>(s));
+		__m128i match = _mm_cmpeq_epi8(chunk, stop[0]);
+		for (size_t i = 1; i < N; i++) {
+			match = _mm_or_si128(match, _mm_cmpeq_epi8(chunk, stop[i]));
+		}
+		const uint32_t mask = mm_movemask_epi8(match);
+		if (mask != 0) {
+			return s + np2_ctz(mask);
+		}
+		s += sizeof(__m128i);
+	}
+	return s;
+}
+#endif
+
+// copy and lowercase ASCII letters in one pass, avoid rescanning the result for NUL.
+void CopyLowerCase(char *dest, const char *src, size_t len) noexcept {
+	const char * const end = src + len;
+#if NP2_USE_SSE2
+	const __m128i offset = _mm_set1_epi8(127 - 'Z');
+	const __m128i limit = _mm_set1_epi8(127 - 26);
+	const __m128i caseBit = _mm_set1_epi8('a' - 'A');
+	while (src + sizeof(__m128i) <= end) {
+		const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src));
+		// 'A' to 'Z' maps to [127 - 25, 127], other characters wrap below it
+		const __m128i upper = _mm_cmpgt_epi8(_mm_add_epi8(chunk, offset), limit);
+		_mm_storeu_si128(reinterpret_cast<__m128i *>(dest), _mm_or_si128(chunk, _mm_and_si128(upper, caseBit)));
+		src += sizeof(__m128i);
+		dest += sizeof(__m128i);
+	}
+#endif
+	while (src < end) {
+		*dest++ = MakeLowerCase(*src++);
+	}
+}
+
+const char *FindAnyOfChars(const char *s, const char *end, const char *stops) noexcept {
+	const size_t count = strlen(stops);
+	if (count == 0) {
+		return end;
+	}
+#if NP2_USE_SSE2
+	if (count <= 4) {
+		s = FindAnyOfSSE2<4>(s, end, stops, count);
+	} else if (count <= 8) {
+		s = FindAnyOfSSE2<8>(s, end, stops, count);
+	}
+#endif
+	for (; s < end; s++) {
+		if (memchr(stops, *s, count) != nullptr) {
+			break;
+		}
+	}
+	return s;
+}
+
+}
+
 namespace Lexilla {
 
 bool LexAccessor::MatchIgnoreCase(Sci_Position pos, const char *s) noexcept {
@@ -38,6 +108,22 @@ bool LexAccessor::MatchLowerCase(Sci_Position pos, const char *s) noexcept {
 	return true;
 }
 
+Sci_Position LexAccessor::FindAnyOf(Sci_Position startPos_, Sci_Position endPos_, const char *stops) noexcept {
+	endPos_ = sci::min(endPos_, lenDoc);
+	while (startPos_ < endPos_) {
+		if (startPos_ < startPos || startPos_ >= endPos) {
+			Fill(startPos_);
+		}
+		const char * const end = text + (sci::min(endPos_, endPos) - startPos);
+		const char * const s = FindAnyOfChars(text + (startPos_ - startPos), end, stops);
+		startPos_ = startPos + (s - text);
+		if (s != end) {
+			return startPos_;
+		}
+	}
+	return endPos_;
+}
+
 void LexAccessor::GetRange(Sci_PositionU startPos_, Sci_PositionU endPos_, char *s, Sci_PositionU len) const noexcept {
 	assert(s != nullptr);
 	assert(startPos_ <= endPos_ && len != 0);
@@ -46,7 +132,7 @@ void LexAccessor::GetRange(Sci_PositionU startPos_, Sci_PositionU endPos_, char
 	//endPos_ = sci::min(endPos_, static_cast<Sci_PositionU>(lenDoc));
 	len = endPos_ - startPos_;
 	if (startPos_ >= static_cast<Sci_PositionU>(startPos) && endPos_ <= static_cast<Sci_PositionU>(endPos)) {
-		const char * const p = buf + (startPos_ - startPos);
+		const char * const p = text + (startPos_ - startPos);
 		memcpy(s, p, len);
 	} else {
 		pAccess->GetCharRange(s, startPos_, len);
@@ -55,8 +141,17 @@ void LexAccessor::GetRange(Sci_PositionU startPos_, Sci_PositionU endPos_, char
 }
 
 void LexAccessor::GetRangeLowered(Sci_PositionU startPos_, Sci_PositionU endPos_, char *s, Sci_PositionU len) const noexcept {
-	GetRange(startPos_, endPos_, s, len);
-	ToLowerCase(s);
+	assert(s != nullptr);
+	assert(startPos_ <= endPos_ && len != 0);
+	endPos_ = sci::min(endPos_, startPos_ + len - 1);
+	len = endPos_ - startPos_;
+	if (startPos_ >= static_cast<Sci_PositionU>(startPos) && endPos_ <= static_cast<Sci_PositionU>(endPos)) {
+		CopyLowerCase(s, text + (startPos_ - startPos), len);
+	} else {
+		pAccess->GetCharRange(s, startPos_, len);
+		CopyLowerCase(s, s, len);
+	}
+	s[len] = '\0';
 }
 
 void LexAccessor::GetRange(Sci_PositionU startPos_, Sci_PositionU endPos_, std::string &s) const {
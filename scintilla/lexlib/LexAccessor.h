@@ -19,11 +19,17 @@ class LexAccessor {
 	/** @a bufferSize is a trade off between time taken to copy the characters
 	 * and retrieval overhead.
 	 * @a slopSize positions the buffer before the desired position
-	 * in case there is some backtracking. */
+	 * in case there is some backtracking.
+	 * @a windowSize is used when document text is referenced directly,
+	 * text is only copied into buffer when the window overlaps gap of document.
+	 * @a styleBufferSize is larger to reduce calls to SetStyles(). */
 	enum {
 		bufferSize = 4096,
 		slopSize = bufferSize / 8,
+		windowSize = 64*1024,
+		styleBufferSize = 4*bufferSize,
 	};
+	const char *text = buf;
 	char buf[bufferSize + sizeof(int)];
 	const EncodingType encodingType;
 	Sci_Position startPos = 0;
@@ -31,13 +37,25 @@ class LexAccessor {
 	//const int codePage;
 	//const int documentVersion;
 	const Sci_Position lenDoc;
-	unsigned char styleBuf[bufferSize];
+	unsigned char styleBuf[styleBufferSize];
 	Sci_PositionU validLen = 0;
 	Sci_PositionU startSeg = 0;
 	Sci_Position startPosStyling = 0;
 
 	void Fill(Sci_Position position) noexcept {
-		Sci_Position m = lenDoc - bufferSize;
+		Sci_Position m = lenDoc - windowSize;
+		startPos = position - slopSize;
+		startPos = sci::min(startPos, m);
+		startPos = sci::max<Sci_Position>(startPos, 0);
+		endPos = startPos + windowSize;
+		endPos = sci::min(endPos, lenDoc);
+		text = pAccess->ContiguousRangePointer(startPos, endPos - startPos);
+		if (text != nullptr) {
+			return;
+		}
+
+		text = buf;
+		m = lenDoc - bufferSize;
 		startPos = position - slopSize;
 		startPos = sci::min(startPos, m);
 		startPos = sci::max<Sci_Position>(startPos, 0);
@@ -73,7 +91,7 @@ public:
 		if (position < startPos || position >= endPos) {
 			Fill(position);
 		}
-		return buf[position - startPos];
+		return text[position - startPos];
 	}
 	constexpr Scintilla::IDocument *MultiByteAccess() const noexcept {
 		return pAccess;
@@ -103,7 +121,7 @@ public:
 				return '\0';
 			}
 		}
-		return buf[position - startPos];
+		return text[position - startPos];
 	}
 	unsigned char SafeGetUCharAt(Sci_Position position) noexcept {
 		return SafeGetCharAt(position);
@@ -118,7 +136,7 @@ public:
 				return chDefault;
 			}
 		}
-		return buf[position - startPos];
+		return text[position - startPos];
 	}
 	[[deprecated]]
 	unsigned char SafeGetUCharAt(Sci_Position position, char chDefault) noexcept {
@@ -142,6 +160,8 @@ public:
 	}
 	bool MatchIgnoreCase(Sci_Position pos, const char *s) noexcept;
 	bool MatchLowerCase(Sci_Position pos, const char *s) noexcept;
+	// Find first position in range [startPos_, endPos_) with character in stops, returns endPos_ when not found or stops is empty.
+	Sci_Position FindAnyOf(Sci_Position startPos_, Sci_Position endPos_, const char *stops) noexcept;
 
 	// Get first len - 1 characters in range [startPos_, endPos_).
 	void GetRange(Sci_PositionU startPos_, Sci_PositionU endPos_, char *s, Sci_PositionU len) const noexcept;
@@ -226,13 +246,13 @@ public:
 		assert(endPos_ >= startSeg && endPos_ <= static_cast<Sci_PositionU>(Length()));
 		if (endPos_ > startSeg) {
 			Sci_PositionU len = endPos_ - startSeg;
-			if (validLen + len >= bufferSize) {
+			if (validLen + len >= styleBufferSize) {
 				Flush();
 			}
 			assert((startPosStyling + validLen + len) <= static_cast<Sci_PositionU>(Length()));
 			const auto attr = static_cast<unsigned char>(chAttr);
 			startSeg += len;
-			if (validLen + len < bufferSize) {
+			if (validLen + len < styleBufferSize) {
 				unsigned char *ptr = styleBuf + validLen;
 				validLen += len;
 				do {
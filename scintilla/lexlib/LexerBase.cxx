@@ -6,6 +6,7 @@
 // The License.txt file describes the conditions under which this software may be distributed.
 
 #include <cstdlib>
+#include <cstdint>
 #include <cassert>
 #include <cstring>
 
@@ -100,7 +101,14 @@ void SCI_METHOD LexerBase::Fold(Sci_PositionU startPos, Sci_Position lengthDoc,
 	}
 }
 
-void * SCI_METHOD LexerBase::PrivateCall(int, void *) noexcept {
+void * SCI_METHOD LexerBase::PrivateCall(int operation, void *pointer) noexcept {
+	if (operation == Scintilla::lexerCallLineCheckpoint) {
+		return reinterpret_cast<void *>(static_cast<uintptr_t>(lexer.lineCheckpoint));
+	}
+	if (operation == Scintilla::lexerCallSectionStart && lexer.fnSection) {
+		const int *checkpoint = static_cast<const int *>(pointer);
+		return lexer.fnSection(checkpoint[0], checkpoint[1]) ? this : nullptr;
+	}
 	return nullptr;
 }
 
@@ -15,6 +15,8 @@ typedef const WordList (&LexerWordList)[KEYWORDSET_MAX];
 
 typedef void (*LexerFunction)(Sci_PositionU startPos, Sci_Position lengthDoc, int initStyle, LexerWordList keywordLists, Accessor &styler);
 typedef Scintilla::ILexer5 *(*LexerFactoryFunction)();
+// whether line after previous line with the style and line state starts a section, see Scintilla::lexerCallSectionStart
+typedef bool (*LexerSectionFunction)(int style, int lineState) noexcept;
 
 /**
  * A LexerModule is responsible for lexing and folding a particular language.
@@ -26,17 +28,25 @@ public:
 	LexerFunction const fnFolder;
 	LexerFactoryFunction const fnFactory;
 	const char *const languageName;
+	// Scintilla::lineCheckpoint* flags, requires fnLexer and fnFolder have no mutable global state.
+	const int lineCheckpoint;
+	// required for Scintilla::lineCheckpointSection
+	LexerSectionFunction const fnSection;
 
 	constexpr LexerModule(
 		int language_,
 		LexerFunction fnLexer_,
 		const char *languageName_ = nullptr,
-		LexerFunction fnFolder_ = nullptr) noexcept:
+		LexerFunction fnFolder_ = nullptr,
+		int lineCheckpoint_ = Scintilla::lineCheckpointNone,
+		LexerSectionFunction fnSection_ = nullptr) noexcept:
 		language(language_),
 		fnLexer(fnLexer_),
 		fnFolder(fnFolder_),
 		fnFactory(nullptr),
-		languageName(languageName_) {
+		languageName(languageName_),
+		lineCheckpoint(lineCheckpoint_),
+		fnSection(fnSection_) {
 	}
 
 	constexpr LexerModule(
@@ -47,7 +57,9 @@ public:
 		fnLexer(nullptr),
 		fnFolder(nullptr),
 		fnFactory(fnFactory_),
-		languageName(languageName_) {
+		languageName(languageName_),
+		lineCheckpoint(Scintilla::lineCheckpointNone),
+		fnSection(nullptr) {
 	}
 
 	constexpr int GetLanguage() const noexcept {
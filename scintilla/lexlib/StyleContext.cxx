@@ -40,6 +40,30 @@ StyleContext::StyleContext(Sci_PositionU startPos, Sci_PositionU length, int ini
 	SeekTo(startPos);
 }
 
+void StyleContext::SkipToAny(const char *stops) noexcept {
+	if (multiByteAccess) {
+		return;
+	}
+	const Sci_PositionU lineEndPos = lineStartNext - (currentLine < lineDocEnd);
+	const Sci_PositionU limit = sci::min(lineEndPos, endPos);
+	if (currentPos + 2 >= limit) {
+		return;
+	}
+	const Sci_PositionU stopPos = styler.FindAnyOf(currentPos + 1, limit, stops);
+	Sci_PositionU pos = stopPos - 1;
+	while (pos > currentPos + 1 && IsWhiteSpace(styler[pos])) {
+		--pos;
+	}
+	if (pos > currentPos) {
+		currentPos = pos;
+		chPrev = static_cast<unsigned char>(styler[pos - 1]);
+		ch = static_cast<unsigned char>(styler[pos]);
+		chNext = static_cast<unsigned char>(styler.SafeGetCharAt(pos + 1));
+		atLineStart = false;
+		atLineEnd = false;
+	}
+}
+
 bool StyleContext::MatchIgnoreCase(const char *s) const noexcept {
 	if (MakeLowerCase(ch) != static_cast<unsigned char>(*s)) {
 		return false;
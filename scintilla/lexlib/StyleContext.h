@@ -96,6 +96,10 @@ public:
 			Forward();
 		}
 	}
+	// Skip characters on current line that are not in stops (may be empty), next Forward() moves onto the stop character,
+	// line end or end of range. It stops at last non-space character before them,
+	// so code after the call sees same previous non-space character. Does nothing for DBCS.
+	void SkipToAny(const char *stops) noexcept;
 	void ForwardBytes(Sci_Position nb) noexcept {
 		const Sci_PositionU forwardPos = currentPos + nb;
 		while (forwardPos > currentPos) {
@@ -20,11 +20,28 @@ using range_t = WordList::range_t;
 
 namespace {
 
+// words in static list end with space, words in copied list end with NUL.
+constexpr bool IsWordEnd(char ch) noexcept {
+	return static_cast<unsigned char>(ch) <= ' ';
+}
+
+constexpr int WordChar(char ch) noexcept {
+	return IsWordEnd(ch) ? 0 : static_cast<unsigned char>(ch);
+}
+
+inline size_t WordLength(const char *s) noexcept {
+	const char * const start = s;
+	while (!IsWordEnd(*s)) {
+		++s;
+	}
+	return s - start;
+}
+
 /**
  * Creates an array that points into each word in the string and puts \0 terminators
  * after each word.
  */
-inline char **ArrayFromWordList(char *wordlist, size_t slen, range_t *len) {
+inline const char **ArrayFromWordList(char *wordlist, size_t slen, range_t *len) {
 	unsigned char prev = 1;
 	range_t words = 0;
 	// treat space and C0 control characters as word separators.
@@ -64,7 +81,7 @@ inline char **ArrayFromWordList(char *wordlist, size_t slen, range_t *len) {
 	} while (s < end);
 #endif // NP2_USE_AVX2
 
-	char **keywords = new char *[words + 1];
+	const char **keywords = new const char *[words + 1];
 	range_t wordsStore = 0;
 	if (words) {
 		prev = '\0';
@@ -92,12 +109,58 @@ inline char **ArrayFromWordList(char *wordlist, size_t slen, range_t *len) {
 	return keywords;
 }
 
+// Creates an array that points into each word in the read only string.
+const char **ArrayFromStaticWordList(const char *wordlist, size_t slen, range_t *len) {
+	const char * const end = wordlist + slen;
+	range_t words = 0;
+	unsigned char prev = ' ';
+	for (const char *s = wordlist; s < end; s++) {
+		const unsigned char ch = *s;
+		if (prev <= ' ' && ch > ' ') {
+			words++;
+		}
+		prev = ch;
+	}
+
+	const char **keywords = new const char *[words + 1];
+	range_t wordsStore = 0;
+	prev = ' ';
+	for (const char *s = wordlist; s < end; s++) {
+		const unsigned char ch = *s;
+		if (prev <= ' ' && ch > ' ') {
+			keywords[wordsStore] = s;
+			wordsStore++;
+		}
+		prev = ch;
+	}
+	keywords[wordsStore] = end;
+	*len = wordsStore;
+	return keywords;
+}
+
 /** Threshold for linear search.
  * Because of cache locality and other metrics, linear search is faster than binary search
  * when word list contains few words.
  */
 constexpr range_t WordListLinearSearchThreshold = 5;
 
+/** Word count to build hash table for InList().
+ * binary search in first character range compares several words, hash lookup usually compares only one.
+ */
+constexpr range_t WordListHashThreshold = 128;
+
+// FNV-1a, returns word length in len
+inline range_t HashWord(const char *s, size_t &len) noexcept {
+	range_t hash = 2166136261U;
+	const char * const start = s;
+	while (!IsWordEnd(*s)) {
+		hash = (hash ^ static_cast<unsigned char>(*s)) * 16777619U;
+		++s;
+	}
+	len = s - start;
+	return hash;
+}
+
 // words in [start, end) starts with same character, maximum word count limited to 0xffff.
 struct Range {
 	range_t start;
@@ -136,12 +199,52 @@ void WordList::Clear() noexcept {
 	if (words) {
 		delete[]words;
 		delete[]list;
+		delete[]table;
 		words = nullptr;
 		list = nullptr;
+		table = nullptr;
+		tableMask = 0;
 		//len = 0;
 	}
 }
 
+void WordList::BuildHashTable(range_t len) {
+	// load factor below 0.5
+	range_t size = 2*WordListHashThreshold;
+	while (size < 2*len) {
+		size *= 2;
+	}
+	table = new HashSlot[size]();
+	tableMask = size - 1;
+	for (range_t i = 0; i < len; i++) {
+		size_t length;
+		const range_t hash = HashWord(words[i], length);
+		range_t slot = hash & tableMask;
+		while (table[slot].index != 0) {
+			slot = (slot + 1) & tableMask;
+		}
+		table[slot] = {hash, i + 1};
+	}
+}
+
+bool WordList::InHashTable(const char *s) const noexcept {
+	size_t length;
+	const range_t hash = HashWord(s, length);
+	if (s[length] != '\0') {
+		return false;
+	}
+	range_t slot = hash & tableMask;
+	while (table[slot].index != 0) {
+		const HashSlot &entry = table[slot];
+		const char *word = words[entry.index - 1];
+		if (entry.hash == hash && memcmp(word, s, length) == 0 && IsWordEnd(word[length])) {
+			return true;
+		}
+		slot = (slot + 1) & tableMask;
+	}
+	return false;
+}
+
 bool WordList::Set(const char *s, KeywordAttr attribute) {
 	// omitted comparison for Notepad4, we don't care whether the list is same as before or not.
 	// 1. when we call SciCall_SetKeywords(), the document or lexer already changed.
@@ -149,6 +252,13 @@ bool WordList::Set(const char *s, KeywordAttr attribute) {
 
 	Clear();
 	const size_t lenS = strlen(s);
+	range_t len = 0;
+	if ((attribute & (KeywordAttr_Static | KeywordAttr_PreSorted | KeywordAttr_MakeLower)) == (KeywordAttr_Static | KeywordAttr_PreSorted)) {
+		words = ArrayFromStaticWordList(s, lenS, &len);
+		BuildIndex(len);
+		return true;
+	}
+
 	list = new char[lenS + 1 + 32*NP2_USE_AVX2];
 	memcpy(list, s, lenS + 1);
 	if (attribute & KeywordAttr_MakeLower) {
@@ -168,14 +278,17 @@ bool WordList::Set(const char *s, KeywordAttr attribute) {
 		} while (p < end);
 	}
 
-	range_t len = 0;
 	words = ArrayFromWordList(list, lenS, &len);
 	if (!(attribute & KeywordAttr_PreSorted)) {
 		std::sort(words, words + len, [](const char *a, const char *b) noexcept {
 			return strcmp(a, b) < 0;
 		});
 	}
+	BuildIndex(len);
+	return true;
+}
 
+void WordList::BuildIndex(range_t len) {
 	memset(ranges, 0, sizeof(ranges));
 	for (range_t i = 0; i < len;) {
 		const unsigned char indexChar = *words[i];
@@ -186,7 +299,9 @@ bool WordList::Set(const char *s, KeywordAttr attribute) {
 		assert(static_cast<unsigned>(indexChar - MinIndexChar) < std::size(ranges));
 		ranges[indexChar - MinIndexChar] = start | (i << 16);
 	}
-	return true;
+	if (len >= WordListHashThreshold) {
+		BuildHashTable(len);
+	}
 }
 
 /** Check whether a string is in the list.
@@ -203,18 +318,22 @@ bool WordList::InList(const char *s) const noexcept {
 		return false;
 	}
 	range_t end = ranges[index];
-	if (end) {
+	if (table) {
+		if (end && InHashTable(s)) {
+			return true;
+		}
+	} else if (end) {
 		Range range(end);
 		range_t count = range.Length();
 		if (count < WordListLinearSearchThreshold) {
 			do {
 				const char *a = words[range.start] + 1;
 				const char *b = s + 1;
-				while (*a && *a == *b) {
+				while (!IsWordEnd(*a) && *a == *b) {
 					a++;
 					b++;
 				}
-				if (!*a && !*b) {
+				if (IsWordEnd(*a) && !*b) {
 					return true;
 				}
 			} while (range.Next());
@@ -224,11 +343,11 @@ bool WordList::InList(const char *s) const noexcept {
 				const range_t mid = range.start + step;
 				const char *a = words[mid] + 1;
 				const char *b = s + 1;
-				while (*a && *a == *b) {
+				while (!IsWordEnd(*a) && *a == *b) {
 					a++;
 					b++;
 				}
-				const int diff = static_cast<unsigned char>(*a) - static_cast<unsigned char>(*b);
+				const int diff = WordChar(*a) - static_cast<unsigned char>(*b);
 				if (diff == 0) {
 					return true;
 				}
@@ -248,11 +367,11 @@ bool WordList::InList(const char *s) const noexcept {
 		do {
 			const char *a = words[range.start] + 1;
 			const char *b = s;
-			while (*a && *a == *b) {
+			while (!IsWordEnd(*a) && *a == *b) {
 				a++;
 				b++;
 			}
-			if (!*a) {
+			if (IsWordEnd(*a)) {
 				return true;
 			}
 		} while (range.Next());
@@ -282,11 +401,11 @@ bool WordList::InListPrefixed(const char *s, const char marker) const noexcept {
 			do {
 				const char *a = words[range.start] + 1;
 				const char *b = s + 1;
-				while (*a && *a == *b) {
+				while (!IsWordEnd(*a) && *a == *b) {
 					a++;
 					b++;
 				}
-				if ((!*a || *a == marker) && !*b) {
+				if ((IsWordEnd(*a) || *a == marker) && !*b) {
 					return true;
 				}
 			} while (range.Next());
@@ -296,11 +415,11 @@ bool WordList::InListPrefixed(const char *s, const char marker) const noexcept {
 				const range_t mid = range.start + step;
 				const char *a = words[mid] + 1;
 				const char *b = s + 1;
-				while (*a && *a == *b) {
+				while (!IsWordEnd(*a) && *a == *b) {
 					a++;
 					b++;
 				}
-				const int diff = static_cast<unsigned char>(*a) - static_cast<unsigned char>(*b);
+				const int diff = WordChar(*a) - static_cast<unsigned char>(*b);
 				if (diff == 0 || diff == static_cast<unsigned char>(marker)) {
 					return true;
 				}
@@ -320,11 +439,11 @@ bool WordList::InListPrefixed(const char *s, const char marker) const noexcept {
 		do {
 			const char *a = words[range.start] + 1;
 			const char *b = s;
-			while (*a && *a == *b) {
+			while (!IsWordEnd(*a) && *a == *b) {
 				a++;
 				b++;
 			}
-			if (!*a) {
+			if (IsWordEnd(*a)) {
 				return true;
 			}
 		} while (range.Next());
@@ -356,7 +475,7 @@ bool WordList::InListAbbreviated(const char *s, const char marker) const noexcep
 				isSubword = true;
 				a++;
 			}
-			while (*a && *a == *b) {
+			while (!IsWordEnd(*a) && *a == *b) {
 				a++;
 				if (*a == marker) {
 					isSubword = true;
@@ -364,7 +483,7 @@ bool WordList::InListAbbreviated(const char *s, const char marker) const noexcep
 				}
 				b++;
 			}
-			if ((!*a || isSubword) && !*b) {
+			if ((IsWordEnd(*a) || isSubword) && !*b) {
 				return true;
 			}
 		} while (range.Next());
@@ -376,11 +495,11 @@ bool WordList::InListAbbreviated(const char *s, const char marker) const noexcep
 		do {
 			const char *a = words[range.start] + 1;
 			const char *b = s;
-			while (*a && *a == *b) {
+			while (!IsWordEnd(*a) && *a == *b) {
 				a++;
 				b++;
 			}
-			if (!*a) {
+			if (IsWordEnd(*a)) {
 				return true;
 			}
 		} while (range.Next());
@@ -409,11 +528,11 @@ bool WordList::InListAbridged(const char *s, const char marker) const noexcept {
 		do {
 			const char *a = words[range.start];
 			const char *b = s;
-			while (*a && *a == *b) {
+			while (!IsWordEnd(*a) && *a == *b) {
 				a++;
 				if (*a == marker) {
 					a++;
-					const size_t suffixLengthA = strlen(a);
+					const size_t suffixLengthA = WordLength(a);
 					const size_t suffixLengthB = strlen(b);
 					if (suffixLengthA >= suffixLengthB) {
 						break;
@@ -422,7 +541,7 @@ bool WordList::InListAbridged(const char *s, const char marker) const noexcept {
 				}
 				b++;
 			}
-			if (!*a && !*b) {
+			if (IsWordEnd(*a) && !*b) {
 				return true;
 			}
 		} while (range.Next());
@@ -438,18 +557,18 @@ bool WordList::InListAbridged(const char *s, const char marker) const noexcept {
 		do {
 			const char *a = words[range.start] + 1;
 			const char *b = s;
-			const size_t suffixLengthA = strlen(a);
+			const size_t suffixLengthA = WordLength(a);
 			const size_t suffixLengthB = strlen(b);
 			if (suffixLengthA > suffixLengthB) {
 				continue;
 			}
 			b = b + suffixLengthB - suffixLengthA;
 
-			while (*a && *a == *b) {
+			while (!IsWordEnd(*a) && *a == *b) {
 				a++;
 				b++;
 			}
-			if (!*a && !*b) {
+			if (IsWordEnd(*a) && !*b) {
 				return true;
 			}
 		} while (range.Next());
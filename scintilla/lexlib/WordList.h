@@ -18,13 +18,22 @@ public:
 		KeywordAttr_Default = 0,
 		KeywordAttr_MakeLower = 1,
 		KeywordAttr_PreSorted = 2,
+		KeywordAttr_Static = 16,
 	};
 //--Autogenerated -- end of section automatically generated
 
 private:
 	// Each word contains at least one character - an empty word acts as sentinel at the end.
-	char **words = nullptr;
+	// words end with NUL in copied list, or with space in KeywordAttr_Static list.
+	const char **words = nullptr;
 	char *list = nullptr;
+	// open addressing hash table built for long list, index is word index + 1, 0 for empty slot.
+	struct HashSlot {
+		range_t hash;
+		range_t index;
+	};
+	HashSlot *table = nullptr;
+	range_t tableMask = 0;
 	//range_t len = 0;
 #if 1
 	// ASCII graphic character only, most word starts with character in '_a-zA-Z'
@@ -32,8 +41,11 @@ private:
 	range_t ranges[0x7f - MinIndexChar];
 #else
 	static constexpr unsigned char MinIndexChar = '@';
-	range_t ranges[64 - 2*sizeof(char *)/4]; // make sizeof(WordList) == 256
+	range_t ranges[64 - 3*sizeof(char *)/4 - 1]; // make sizeof(WordList) == 256
 #endif
+	void BuildIndex(range_t len);
+	void BuildHashTable(range_t len);
+	bool InHashTable(const char *s) const noexcept;
 public:
 	WordList() noexcept {
 		// Prevent warnings by static analyzers about uninitialized ranges.
@@ -64,6 +76,7 @@ public:
 	bool InListPrefixed(const char *s, char marker) const noexcept;
 	bool InListAbbreviated(const char *s, char marker) const noexcept;
 	bool InListAbridged(const char *s, char marker) const noexcept;
+	// word ends with space in KeywordAttr_Static list
 	const char *WordAt(range_t n) const noexcept;
 };
 
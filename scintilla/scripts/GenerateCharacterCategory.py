@@ -335,28 +335,29 @@ def updateCharClassifyTable(filename, headfile):
 	indexTable = indexTable[:tableSize]
 	print(f'Unicode CharClassify table size: {tableSize}, last value: {CharacterClass(indexTable[tableSize - 1]).name}')
 
-	valueBit, totalBit, data = runLengthEncode('CharClassify Unicode BMP', indexTable[:BMPCharacterCharacterCount])
-	assert valueBit == 3
-	assert totalBit == 16
-	output.append('const uint16_t CharClassifyRLE_BMP[] = {')
-	output.extend(dumpArray(data, 20))
-	output.append("};")
-	output.append("")
-	output.append("}") # namespace
+	table = indexTable[:BMPCharacterCharacterCount]
+	# CharClassify::SetDefaultCharClasses()
+	table[ord('\n')] = int(CharacterClass.NewLine)
+	table[ord('\r')] = int(CharacterClass.NewLine)
+	table[ord('_')] = int(CharacterClass.Word)
+	shift, indexCount, data = packedTwoStageEncode('CharClassify Unicode BMP', table, 'CharClassify::CharClassifyBMP')
+	output.extend(data)
 	output.append("")
 
 	config = {
 		'tableVarName': 'CharClassify::CharClassifyTable',
 		'tableName': 'CharClassifyTable',
-		'function': """static CharacterClass ClassifyCharacter(uint32_t ch) noexcept {
-	if (ch < sizeof(classifyMap)) {
-		return static_cast<CharacterClass>(classifyMap[ch]);
-	}
-	if (ch >= maxUnicode) {
+		'function': f"""static CharacterClass ClassifyCharacter(uint32_t ch) noexcept {{
+	if (ch < {hex(BMPCharacterCharacterCount)}) {{
+		const uint32_t block = CharClassifyBMP[ch >> {shift}];
+		const uint32_t value = CharClassifyBMP[(block << {shift - 1}) + ((ch & {(1 << shift) - 1}) >> 1) + {indexCount}];
+		return static_cast<CharacterClass>((value >> ((ch & 1) << 2)) & 15);
+	}}
+	if (ch >= {hex(tableSize)}) {{
 		return CharacterClass::space; // Co, Cn
-	}
+	}}
 
-	ch -= sizeof(classifyMap);""".replace('maxUnicode', hex(tableSize)),
+	ch -= {hex(BMPCharacterCharacterCount)};""",
 		'returnType': 'CharacterClass'
 	}
 
@@ -578,17 +579,10 @@ def makeDBCSCharClassifyTable(output, filename, encodingList, isReservedOrUDC=No
 
 	# skip all ccUndefined in [256, DBCSMinCharacter - 1]
 	indexTable = indexTable[0x8000:]
-	valueBit, totalBit, data = runLengthEncode(head, indexTable)
-	assert valueBit == 3
-	if codePage == 1361:
-		#skipBlockEncode(head, indexTable, tableName=head)
-		data = runBlockEncode(head, indexTable, tableName=head)
-		output.extend(data)
-	else:
-		assert totalBit == 16
-		output.append(f'const uint16_t CharClassifyRLE{suffix}[] = {{')
-		output.extend(dumpArray(data, 20))
-		output.append("};")
+	# same block size for all code pages, see DBCSCharClassify::ClassifyCharacter()
+	shift, indexCount, data = packedTwoStageEncode(head, indexTable, tableName=head, shift=6)
+	assert indexCount == 512
+	output.extend(data)
 	output.append("")
 
 	if False:
@@ -21,6 +21,11 @@ source_info = {
 # sequence[0] is already stored in `magic` field.
 BuildDataForLookupOnly = False
 
+# FNV-1a hash for perfect hash bucket, mixed with bucket seed to get sequence slot
+PerfectHashBasis = 0x811C9DC5
+PerfectHashPrime = 0x01000193
+PerfectHashMixMultiplier = 0x9E3779B1
+
 def escape_c_char(ch):
 	if ch in r'\'"':
 		return '\\' + ch
@@ -62,6 +67,12 @@ def djb2_hash(buf, multiplier):
 	# masked to match C/C++ unsigned integer overflow wrap around
 	return value & (2**32 - 1)
 
+def fnv1a_hash(buf):
+	value = PerfectHashBasis
+	for ch in buf:
+		value = ((value ^ ch) * PerfectHashPrime) & (2**32 - 1)
+	return value
+
 def fast_counter(items):
 	# faster than defaultdict and Counter
 	counter = {}
@@ -415,6 +426,117 @@ def update_all_latex_input_data_linear(latex_map=None, emoji_map=None):
 	update_latex_input_data_linear('Emoji', emoji_map, 'emoji_map.json', param)
 
 
+def perfect_hash_slot(value, seed, slot_count):
+	value = ((value ^ seed) * PerfectHashMixMultiplier) & (2**32 - 1)
+	# map to [0, slot_count) with high bits, same as (uint64_t)value*slot_count >> 32
+	return (value * slot_count) >> 32
+
+def find_perfect_hash_seed(input_name, raw_hash, bucket_count):
+	buckets = {}
+	for index, value in enumerate(raw_hash):
+		bucket = value % bucket_count
+		if bucket in buckets:
+			buckets[bucket].append(index)
+		else:
+			buckets[bucket] = [index]
+
+	# hash and displace: place large buckets first, find smallest seed without collision
+	slot_count = len(raw_hash)
+	slot_list = [-1] * slot_count
+	seed_table = [0] * bucket_count
+	max_seed = 0
+	for bucket, items in sorted(buckets.items(), key=lambda m: (-len(m[1]), m[0])):
+		for seed in range(0x10000):
+			slots = [perfect_hash_slot(raw_hash[index], seed, slot_count) for index in items]
+			if len(set(slots)) == len(slots) and all(slot_list[slot] < 0 for slot in slots):
+				break
+		else:
+			assert False, (input_name, bucket, len(items))
+		seed_table[bucket] = seed
+		max_seed = max(max_seed, seed)
+		for index, slot in zip(items, slots):
+			slot_list[slot] = index
+	return seed_table, slot_list, max_seed
+
+def update_latex_input_data_perfect_hash(input_name, input_map, bucket_count):
+	input_list = sorted(input_map.items())
+	key_list = [item[0] for item in input_list]
+	raw_hash = [fnv1a_hash(info['hash_key']) for key, info in input_list]
+	assert len(set(raw_hash)) == len(raw_hash), (input_name, 'hash collision')
+
+	lines = MakeKeywordLines(key_list)
+	content = ''.join(line + ' ' for line in lines)
+	string_offset = 0
+	for key in content.split(' ')[:-1]:
+		# offset for sequence[1:], sequence[0] is stored in magic field
+		input_map[key]['offset'] = string_offset + 1
+		string_offset += len(key) + 1
+	assert string_offset <= 0xffff, (input_name, string_offset)
+
+	start_time = time.perf_counter_ns()
+	seed_table, slot_list, max_seed = find_perfect_hash_seed(input_name, raw_hash, bucket_count)
+	duration = (time.perf_counter_ns() - start_time)/1e6
+
+	output = []
+	if input_name == 'LaTeX':
+		output.append(f'static constexpr uint32_t PerfectHashBasis = 0x{PerfectHashBasis:08x};')
+		output.append(f'static constexpr uint32_t PerfectHashPrime = 0x{PerfectHashPrime:08x};')
+		output.append(f'static constexpr uint32_t PerfectHashMixMultiplier = 0x{PerfectHashMixMultiplier:08x};')
+		output.append('')
+	output.append(f'static const uint16_t {input_name}HashSeedTable[] = {{')
+	for i in range(0, bucket_count, 10):
+		line = ', '.join(f'0x{value:04x}' for value in seed_table[i:i+10])
+		output.append(line + ',')
+	output.append('};')
+	Regenerate(data_path, f'//{input_name} hash', output)
+
+	prefix = '\\'
+	suffix = ''
+	if input_name == 'Emoji':
+		prefix = '\\:'
+		suffix = ':'
+	# see https://www.unicode.org/faq/utf_bom.html
+	LEAD_OFFSET = 0xD800 - (0x10000 >> 10)
+	output = []
+	for index in slot_list:
+		key, info = input_list[index]
+		character = info['character']
+		if len(character) == 1:
+			ch = ord(character)
+			if ch <= 0xffff:
+				code = f'0x{ch:04X}'
+			else:
+				character = f'U+{ch:X}, {character}'
+				# convert to UTF-16
+				lead = LEAD_OFFSET + (ch >> 10)
+				trail = 0xDC00 + (ch & 0x3FF)
+				code = f"0x{trail:04X}'{lead:04X}"
+		else:
+			code = f"0x{ord(character[1]):04X}'{ord(character[0]):04X}"
+		magic = info['magic']
+		offset = info['offset']
+		sequence = prefix + info['sequence'] + suffix
+		name = info['name']
+		line = f'{{0x{magic:04x}, 0x{offset:04x}, {code}}}, // {character}, {sequence}, {name}'
+		output.append(line)
+	Regenerate(data_path, f'//{input_name} list', output)
+
+	output = [f'"{line} "' for line in lines]
+	output[-1] += ';'
+	Regenerate(data_path, f'//{input_name} string', output)
+
+	size = (string_offset + 1 + bucket_count*2 + len(input_map)*8)/1024
+	print(input_name, 'count:', len(input_map), 'bucket:', bucket_count, 'max seed:', max_seed,
+		'content:', string_offset + 1, 'total:', size, 'time:', duration)
+
+def update_all_latex_input_data_perfect_hash(latex_map=None, emoji_map=None):
+	latex_map = prepare_input_data_hash(latex_map, 'latex_map.json')
+	emoji_map = prepare_input_data_hash(emoji_map, 'emoji_map.json')
+	# about 3 sequences per bucket
+	update_latex_input_data_perfect_hash('LaTeX', latex_map, len(latex_map) // 3)
+	update_latex_input_data_perfect_hash('Emoji', emoji_map, len(emoji_map) // 3)
+
+
 def get_input_map_size_info(input_name, input_map):
 	items = [len(key) for key in input_map.keys()]
 	min_len = min(items)
@@ -650,4 +772,5 @@ def parse_all_data_source():
 
 parse_all_data_source()
 #update_all_latex_input_data_hash()
-update_all_latex_input_data_linear()
+#update_all_latex_input_data_linear()
+update_all_latex_input_data_perfect_hash()
@@ -612,6 +612,53 @@ def skipBlockEncode(head, table, tableName=''):
 		_dumpRunBlock(output, tableName, offsetList, blockData, bitCount, shift)
 	return output
 
+def packedTwoStageEncode(head, table, tableName, shift=None):
+	# two-stage table of 4-bit values packed two per byte, duplicate blocks are stored once.
+	# uint8_t index for each block followed by block data, lookup code:
+	# block = table[ch >> shift]
+	# value = table[(block << (shift - 1)) + ((ch & blockMask) >> 1) + indexCount]
+	# value = (value >> ((ch & 1) << 2)) & 15
+	assert max(table) < 16
+	shiftList = [shift] if shift else range(2, 10)
+	minSize = sys.maxsize
+	minResult = None
+	for shift in shiftList:
+		if len(table) & ((1 << shift) - 1):
+			continue
+		indexList, blockList, dataCount = _compressTable(table, shift)
+		if len(blockList) > 256:
+			continue
+		size = len(indexList) + dataCount//2
+		if size < minSize:
+			minSize = size
+			minResult = shift, indexList, blockList
+
+	shift, indexList, blockList = minResult
+	blockSize = 1 << shift
+	print(f'{head} packed two-stage size: {minSize} {minSize/1024}, block: {len(blockList)} {blockSize}')
+
+	blockData = []
+	for block in blockList:
+		blockData.extend(block[i] | (block[i + 1] << 4) for i in range(0, blockSize, 2))
+	data = indexList + blockData
+	indexCount = len(indexList)
+	blockMask = blockSize - 1
+	for ch, value in enumerate(table):
+		block = data[ch >> shift]
+		packed = data[(block << (shift - 1)) + ((ch & blockMask) >> 1) + indexCount]
+		assert value == (packed >> ((ch & 1) << 2)) & 15
+
+	output = []
+	if tableName:
+		name = tableName.split('::')[-1]
+		output.append(f'const uint8_t {tableName}[] = {{')
+		output.append(f'// {name} index')
+		output.extend(dumpArray(indexList, 20))
+		output.append(f'// {name} values')
+		output.extend(dumpArray(blockData, 20))
+		output.append('};')
+	return shift, indexCount, output
+
 def _compressTableMergedEx(table, itemSize, level):
 	minSize = sys.maxsize
 	minResult = None
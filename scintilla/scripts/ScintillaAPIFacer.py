@@ -18,6 +18,7 @@ typeAliases = {
 	"colouralpha": "ColourAlpha",
 	"findtext": "TextToFindFull *",
 	"findtextfull": "TextToFindFull *",
+	"findallfull": "TextToFindAllFull *",
 	"formatrange": "const RangeToFormatFull *",
 	"formatrangefull": "const RangeToFormatFull *",
 	"int": "int",
@@ -52,6 +52,7 @@ void AutoComplete::Start(Window &parent, int ctrlID,
 	lb->SetOptions(listOptions);
 	lb->Create(parent, ctrlID, location, lineHeight, codePage, technology);
 	lb->Clear();
+	selectEnd = -1;
 	active = true;
 	startLen = startLen_;
 	posStart = position;
@@ -129,6 +130,16 @@ struct Sorter {
 	}
 };
 
+// Same as strncmp(word, item, word.length()) on NUL terminated item
+int ComparePrefix(std::string_view word, std::string_view item, bool ignoreCase) noexcept {
+	const size_t len = std::min(word.length(), item.length());
+	const int cmp = ignoreCase ? CompareNCaseInsensitive(word.data(), item.data(), len) : memcmp(word.data(), item.data(), len);
+	if (cmp != 0 || word.length() <= item.length()) {
+		return cmp;
+	}
+	return 1;
+}
+
 void FillSortMatrix(std::vector<int> &sortMatrix, unsigned itemCount) {
 #if 1
 	sortMatrix.clear();
@@ -147,6 +158,7 @@ void FillSortMatrix(std::vector<int> &sortMatrix, unsigned itemCount) {
 }
 
 void AutoComplete::SetList(const char *list) {
+	selectEnd = -1;
 	if (autoSort == Ordering::PreSorted) {
 		lb->SetList(list, separator, typesep);
 		FillSortMatrix(sortMatrix, lb->Length());
@@ -223,63 +235,62 @@ void AutoComplete::Move(int delta) const {
 }
 
 void AutoComplete::Select(const char *word) {
-	const size_t lenWord = strlen(word);
+	const std::string_view wordView(word);
+	// matches of the extended word are inside matches of previous word
+	const bool narrow = selectEnd >= 0 && wordView.starts_with(selectWord);
+	int start = narrow ? selectStart : 0; // lower bound of the api array block to search
+	const int upper = narrow ? selectEnd : lb->Length(); // upper bound (exclusive) of the api array block to search
+	int end = upper;
+
+	// binary search first and last item starting with word
+	while (start < end) {
+		const int pivot = (start + end) / 2;
+		if (ComparePrefix(wordView, lb->GetText(sortMatrix[pivot]), ignoreCase) > 0) {
+			start = pivot + 1;
+		} else {
+			end = pivot;
+		}
+	}
+	const int first = start;
+	end = upper;
+	while (start < end) {
+		const int pivot = (start + end) / 2;
+		if (ComparePrefix(wordView, lb->GetText(sortMatrix[pivot]), ignoreCase) >= 0) {
+			start = pivot + 1;
+		} else {
+			end = pivot;
+		}
+	}
+	const int last = start;
+	selectWord = wordView;
+	selectStart = first;
+	selectEnd = last;
+
 	int location = -1;
-	int start = 0; // lower bound of the api array block to search
-	int end = lb->Length() - 1; // upper bound of the api array block to search
-	while ((start <= end) && (location < 0)) { // Binary searching loop
-		int pivot = (start + end) / 2;
-		std::string item = lb->GetValue(sortMatrix[pivot]);
-		int cond;
-		if (ignoreCase)
-			cond = CompareNCaseInsensitive(word, item.c_str(), lenWord);
-		else
-			cond = strncmp(word, item.c_str(), lenWord);
-		if (!cond) {
-			// Find first match
-			while (pivot > start) {
-				item = lb->GetValue(sortMatrix[pivot - 1]);
-				if (ignoreCase)
-					cond = CompareNCaseInsensitive(word, item.c_str(), lenWord);
-				else
-					cond = strncmp(word, item.c_str(), lenWord);
-				if (0 != cond)
+	if (first < last) {
+		location = first;
+		if (ignoreCase
+			&& ignoreCaseBehaviour == CaseInsensitiveBehaviour::RespectCase) {
+			// Check for exact-case match
+			for (int pivot = first; pivot < last; pivot++) {
+				if (ComparePrefix(wordView, lb->GetText(sortMatrix[pivot]), false) == 0) {
+					location = pivot;
 					break;
-				--pivot;
-			}
-			location = pivot;
-			if (ignoreCase
-				&& ignoreCaseBehaviour == CaseInsensitiveBehaviour::RespectCase) {
-				// Check for exact-case match
-				for (; pivot <= end; pivot++) {
-					item = lb->GetValue(sortMatrix[pivot]);
-					if (!strncmp(word, item.c_str(), lenWord)) {
-						location = pivot;
-						break;
-					}
-					if (CompareNCaseInsensitive(word, item.c_str(), lenWord) != 0)
-						break;
 				}
 			}
-		} else if (cond < 0) {
-			end = pivot - 1;
-		} else {
-			start = pivot + 1;
 		}
 	}
 	if (location < 0) {
 		if (autoHide)
 			Cancel();
 		else
-			lb->Select(-1);
+			// custom ordered list is ranked by container, select the best item
+			lb->Select((autoSort == Ordering::Custom && lb->Length() != 0) ? 0 : -1);
 	} else {
 		if (autoSort == Ordering::Custom) {
 			// Check for a logically earlier match
-			for (int i = location + 1; i <= end; ++i) {
-				const std::string item = lb->GetValue(sortMatrix[i]);
-				if (CompareNCaseInsensitive(word, item.c_str(), lenWord) != 0)
-					break;
-				if (sortMatrix[i] < sortMatrix[location] && !strncmp(word, item.c_str(), lenWord))
+			for (int i = location + 1; i < last; ++i) {
+				if (sortMatrix[i] < sortMatrix[location] && ComparePrefix(wordView, lb->GetText(sortMatrix[i]), false) == 0)
 					location = i;
 			}
 		}
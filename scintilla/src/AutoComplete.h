@@ -17,6 +17,10 @@ class AutoComplete {
 	std::string stopChars;
 	std::string fillUpChars;
 	std::vector<int> sortMatrix;
+	// matched range of sortMatrix for previous Select(), narrowed when the word is extended
+	std::string selectWord;
+	int selectStart = 0;
+	int selectEnd = -1;
 
 public:
 
@@ -0,0 +1,503 @@
+// Scintilla source code edit control
+/** @file BackgroundLexer.cxx
+ ** Run lexer and folder on a thread pool thread against read only document snapshot.
+ **/
+// This file is part of Notepad4.
+// See License.txt for details about distribution and modification.
+
+#include <cstddef>
+#include <cstdlib>
+#include <cstdint>
+#include <cassert>
+#include <cstring>
+
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <array>
+#include <forward_list>
+#include <optional>
+#include <algorithm>
+#include <atomic>
+#include <memory>
+
+#include "ParallelSupport.h"
+#include "ScintillaTypes.h"
+#include "ILoader.h"
+#include "ILexer.h"
+
+#include "Debugging.h"
+
+#include "CharacterSet.h"
+#include "Position.h"
+#include "SplitVector.h"
+#include "Partitioning.h"
+#include "RunStyles.h"
+#include "CellBuffer.h"
+#include "PerLine.h"
+#include "CharClassify.h"
+#include "Decoration.h"
+#include "CaseFolder.h"
+#include "Document.h"
+#include "BackgroundLexer.h"
+#include "UniConversion.h"
+
+using namespace Scintilla;
+using namespace Scintilla::Internal;
+
+// assumed checkpoint requires start after first line.
+BackgroundLexer::BackgroundLexer(ILexer5 *instance_, Document &doc, Sci::Position start, Sci::Position end, const Checkpoint *assumed) :
+	instance{instance_},
+	lengthDoc{doc.Length()},
+	startPos{start},
+	endGoal{std::min(end, lengthDoc)},
+	startLine{doc.SciLineFromPosition(start)},
+	lineBase{assumed ? startLine - 1 : std::max<Sci::Line>(startLine - lineWindow, 0)},
+	lineBaseStart{doc.LineStart(lineBase)},
+	linesTotal{doc.LinesTotal()},
+	lineLimit{std::min(doc.SciLineFromPosition(endGoal) + lineWindow, linesTotal)},
+	textEnd{doc.LineStart(lineLimit)},
+	snapshot{doc.CreateSnapshot(lineBaseStart, textEnd - lineBaseStart)},
+	text{snapshot->Text()},
+	startCheckpoint{assumed ? *assumed : Checkpoint{}},
+	speculative{assumed != nullptr},
+	codePage{doc.dbcsCodePage},
+	tabInChars{doc.tabInChars},
+	stylesStart{assumed ? start - 1 : std::max<Sci::Position>(start - styleWindow, 0)},
+	lexerStateStart{Sci::invalidPosition},
+	lexerStateEnd{Sci::invalidPosition},
+	endStyled{start},
+	initStyle{assumed ? assumed->style : ((start > 0) ? doc.StyleIndexAt(start - 1) : 0)},
+	lexedTo{start},
+	committedTo{start} {
+	for (unsigned int ch = 0; ch < std::size(charClasses); ch++) {
+		charClasses[ch] = doc.GetCharacterClass(ch);
+	}
+	const size_t lineCount = lineLimit - lineBase;
+	levels.resize(lineCount, static_cast<int>(FoldLevel::Base));
+	lineStates.resize(lineCount);
+	if (assumed) {
+		styles.push_back(static_cast<unsigned char>(assumed->style));
+		levels[0] = assumed->level;
+		lineStates[0] = assumed->lineState;
+		return;
+	}
+	styles.resize(start - stylesStart);
+	doc.GetStyleRange(styles.data(), stylesStart, start - stylesStart);
+	for (Sci::Line line = lineBase; line < startLine; line++) {
+		levels[LineIndex(line)] = doc.GetLevel(line);
+		lineStates[LineIndex(line)] = doc.GetLineState(line);
+	}
+}
+
+BackgroundLexer::~BackgroundLexer() {
+	Stop();
+	snapshot->Release();
+}
+
+bool BackgroundLexer::Supported(const Document &doc) noexcept {
+	// line starts are found with only CR, LF and CR+LF, DBCS lead bytes are not handled
+	return (doc.dbcsCodePage == 0 || doc.dbcsCodePage == CpUtf8)
+		&& doc.GetLineEndTypesActive() == LineEndType::Default;
+}
+
+BackgroundLexer::Checkpoint BackgroundLexer::DocumentCheckpoint(const Document &doc, Sci::Position position) noexcept {
+	const Sci::Line line = doc.SciLineFromPosition(position) - 1;
+	return {doc.StyleIndexAt(position - 1), doc.GetLineState(line), doc.GetLevel(line)};
+}
+
+bool BackgroundLexer::Start() noexcept {
+	work = CreateThreadpoolWork(WorkCallback, this, nullptr);
+	if (work) {
+		SubmitThreadpoolWork(work);
+		return true;
+	}
+	return false;
+}
+
+void BackgroundLexer::Stop() noexcept {
+	cancelled.store(true, std::memory_order_relaxed);
+	if (work) {
+		WaitForThreadpoolWorkCallbacks(work, FALSE);
+		CloseThreadpoolWork(work);
+		work = nullptr;
+	}
+}
+
+VOID CALLBACK BackgroundLexer::WorkCallback(PTP_CALLBACK_INSTANCE callbackInstance, PVOID parameter, [[maybe_unused]] PTP_WORK work_) noexcept {
+	CallbackMayRunLong(callbackInstance);
+	BackgroundLexer *self = static_cast<BackgroundLexer *>(parameter);
+	try {
+		self->Lex();
+	} catch (...) {
+		// stopped before endGoal, reported by Failed()
+	}
+	self->finished.store(true, std::memory_order_release);
+}
+
+bool BackgroundLexer::FindLineStarts() {
+	const size_t count = lineLimit - lineBase + 1;
+	lineStarts.reserve(count);
+	lineStarts.push_back(lineBaseStart);
+	for (Sci::Position position = lineBaseStart; position < textEnd && lineStarts.size() < count; position++) {
+		const char ch = text[position - lineBaseStart];
+		if (ch == '\n' || ch == '\r') {
+			// snapshot is NUL terminated
+			if (ch == '\r' && text[position + 1 - lineBaseStart] == '\n') {
+				++position;
+			}
+			lineStarts.push_back(position + 1);
+		}
+	}
+	if (lineStarts.size() < count) {
+		lineStarts.push_back(lengthDoc);
+	}
+	// line count must match the document, the text ends with line break or not
+	return lineStarts.size() == count;
+}
+
+void BackgroundLexer::Lex() {
+	if (!FindLineStarts()) {
+		return;
+	}
+	Sci::Position position = startPos;
+	// folder moves back one line, which would refold the line before assumed checkpoint without its previous line.
+	Sci::Position foldStart = speculative ? LineStart(startLine + 1) : startPos;
+	while (position < endGoal && !cancelled.load(std::memory_order_relaxed) && !IsStale()) {
+		const Sci::Line lineLast = LineFromPosition(std::min(position + chunkSize, endGoal) - 1);
+		const Sci::Position end = LineStart(lineLast + 1);
+		{
+			const LockGuard<NativeMutex> guard(mutex);
+			instance->Lex(position, end - position, initStyle, this);
+			if (end > foldStart) {
+				instance->Fold(foldStart, end - foldStart, StyleAt(foldStart - 1), this);
+				foldStart = end;
+			}
+			initStyle = StyleAt(end - 1);
+		}
+		position = end;
+		lexedTo.store(end, std::memory_order_release);
+	}
+}
+
+bool BackgroundLexer::CheckpointAt(Sci::Position position, Checkpoint &checkpoint) noexcept {
+	if (position == startPos) {
+		checkpoint = startCheckpoint;
+		return true;
+	}
+	if (position > lexedTo.load(std::memory_order_acquire)) {
+		return false;
+	}
+	const TryLockGuard<NativeMutex> guard(mutex, false);
+	if (!guard.OwnsLock()) {
+		return false;
+	}
+	const Sci::Line line = LineFromPosition(position) - 1;
+	checkpoint = {StyleAt(position - 1), lineStates[LineIndex(line)], levels[LineIndex(line)]};
+	return true;
+}
+
+void BackgroundLexer::Resume(Sci::Position position) {
+	const LockGuard<NativeMutex> guard(mutex);
+	committedTo = position;
+	decorations.erase(std::remove_if(decorations.begin(), decorations.end(), [position](const DecorationFill &fill) noexcept {
+		return fill.position < position;
+	}), decorations.end());
+}
+
+Sci::Position BackgroundLexer::Commit(Document &doc, bool wait) {
+	const TryLockGuard<NativeMutex> guard(mutex, wait);
+	if (guard.OwnsLock()) {
+		CommitLocked(doc);
+	}
+	return committedTo;
+}
+
+void BackgroundLexer::CommitLocked(Document &doc) {
+	const Sci::Position start = committedTo;
+	const Sci::Position end = lexedTo.load(std::memory_order_acquire);
+	if (end <= start) {
+		return;
+	}
+
+	doc.StartStyling(start);
+	if (!doc.SetStyles(end - start, styles.data() + (start - stylesStart))) {
+		rejected = true;
+		return;
+	}
+	committedTo = end;
+
+	const Sci::Line lineEnd = (end >= lengthDoc) ? linesTotal : LineFromPosition(end);
+	// lexer may change previous line when lexing chunk starting at next line
+	for (Sci::Line line = std::max(LineFromPosition(start) - 1, lineBase); line < lineEnd; line++) {
+		doc.SetLineState(line, lineStates[LineIndex(line)]);
+		doc.SetLevel(line, levels[LineIndex(line)]);
+	}
+	for (const DecorationFill &fill : decorations) {
+		doc.DecorationSetCurrentIndicator(fill.indicator);
+		doc.DecorationFillRange(fill.position, fill.value, fill.length);
+	}
+	decorations.clear();
+	if (lexerStateStart != Sci::invalidPosition) {
+		doc.ChangeLexerState(lexerStateStart, lexerStateEnd);
+		lexerStateStart = Sci::invalidPosition;
+		lexerStateEnd = Sci::invalidPosition;
+	}
+	if (errorStatus) {
+		doc.SetErrorStatus(errorStatus);
+		errorStatus = 0;
+	}
+
+	// keep a window of committed styles for lexer reads before next chunk
+	const Sci::Position discard = committedTo - styleWindow - stylesStart;
+	if (discard > styleWindow) {
+		styles.erase(styles.begin(), styles.begin() + discard);
+		stylesStart += discard;
+	}
+}
+
+int SCI_METHOD BackgroundLexer::Version() const noexcept {
+	return dvRelease4;
+}
+
+void SCI_METHOD BackgroundLexer::SetErrorStatus(int status) noexcept {
+	errorStatus = status;
+}
+
+Sci_Position SCI_METHOD BackgroundLexer::Length() const noexcept {
+	return lengthDoc;
+}
+
+void SCI_METHOD BackgroundLexer::GetCharRange(char *buffer, Sci_Position position, Sci_Position lengthRetrieve) const noexcept {
+	if (position < 0 || lengthRetrieve <= 0 || position + lengthRetrieve > lengthDoc) {
+		return;
+	}
+	const Sci::Position end = position + lengthRetrieve;
+	if (position >= lineBaseStart && end <= textEnd) {
+		memcpy(buffer, text + (position - lineBaseStart), lengthRetrieve);
+		return;
+	}
+	// text outside the snapshot reads as NUL
+	memset(buffer, 0, lengthRetrieve);
+	const Sci::Position copyStart = std::max(position, lineBaseStart);
+	const Sci::Position copyEnd = std::min(end, textEnd);
+	if (copyEnd > copyStart) {
+		memcpy(buffer + (copyStart - position), text + (copyStart - lineBaseStart), copyEnd - copyStart);
+	}
+}
+
+unsigned char SCI_METHOD BackgroundLexer::StyleAt(Sci_Position position) const noexcept {
+	const size_t index = position - stylesStart;
+	return (index < styles.size()) ? styles[index] : 0;
+}
+
+Sci_Line SCI_METHOD BackgroundLexer::LineFromPosition(Sci_Position position) const noexcept {
+	// lineStarts.back() is lengthDoc, position at end is on last line
+	const auto it = std::upper_bound(lineStarts.begin(), lineStarts.end() - 1, position);
+	const Sci::Line index = it - lineStarts.begin() - 1;
+	return lineBase + std::clamp<Sci::Line>(index, 0, lineLimit - lineBase - 1);
+}
+
+Sci_Position SCI_METHOD BackgroundLexer::LineStart(Sci_Line line) const noexcept {
+	if (line >= lineLimit) {
+		return (line >= linesTotal) ? lengthDoc : lineStarts.back();
+	}
+	return lineStarts[std::max<Sci::Line>(line - lineBase, 0)];
+}
+
+Sci_Position SCI_METHOD BackgroundLexer::LineEnd(Sci_Line line) const noexcept {
+	const Sci::Position lineStart = LineStart(line);
+	Sci::Position position = LineStart(line + 1);
+	if (position > lineStart && CharAt(position - 1) == '\n') {
+		--position;
+	}
+	if (position > lineStart && CharAt(position - 1) == '\r') {
+		--position;
+	}
+	return position;
+}
+
+int SCI_METHOD BackgroundLexer::GetLevel(Sci_Line line) const noexcept {
+	return ValidLineIndex(line) ? levels[LineIndex(line)] : static_cast<int>(FoldLevel::Base);
+}
+
+int SCI_METHOD BackgroundLexer::SetLevel(Sci_Line line, int level) {
+	if (ValidLineIndex(line)) {
+		const int prev = levels[LineIndex(line)];
+		levels[LineIndex(line)] = level;
+		return prev;
+	}
+	return static_cast<int>(FoldLevel::Base);
+}
+
+int SCI_METHOD BackgroundLexer::GetLineState(Sci_Line line) const noexcept {
+	return ValidLineIndex(line) ? lineStates[LineIndex(line)] : 0;
+}
+
+int SCI_METHOD BackgroundLexer::SetLineState(Sci_Line line, int state) {
+	if (ValidLineIndex(line)) {
+		const int prev = lineStates[LineIndex(line)];
+		lineStates[LineIndex(line)] = state;
+		return prev;
+	}
+	return 0;
+}
+
+void SCI_METHOD BackgroundLexer::StartStyling(Sci_Position position) noexcept {
+	endStyled = position;
+}
+
+bool SCI_METHOD BackgroundLexer::SetStyleFor(Sci_Position length, unsigned char style) {
+	if (length <= 0) {
+		return false;
+	}
+	const Sci::Position end = endStyled + length;
+	const Sci::Position start = std::max(endStyled, stylesStart);
+	if (end > start) {
+		if (static_cast<size_t>(end - stylesStart) > styles.size()) {
+			styles.resize(end - stylesStart);
+		}
+		memset(styles.data() + (start - stylesStart), style, end - start);
+	}
+	endStyled = end;
+	return true;
+}
+
+bool SCI_METHOD BackgroundLexer::SetStyles(Sci_Position length, const unsigned char *styles_) {
+	if (length <= 0) {
+		return false;
+	}
+	const Sci::Position end = endStyled + length;
+	const Sci::Position start = std::max(endStyled, stylesStart);
+	if (end > start) {
+		if (static_cast<size_t>(end - stylesStart) > styles.size()) {
+			styles.resize(end - stylesStart);
+		}
+		memcpy(styles.data() + (start - stylesStart), styles_ + (start - endStyled), end - start);
+	}
+	endStyled = end;
+	return true;
+}
+
+void SCI_METHOD BackgroundLexer::DecorationSetCurrentIndicator(int indicator) noexcept {
+	currentIndicator = indicator;
+}
+
+void SCI_METHOD BackgroundLexer::DecorationFillRange(Sci_Position position, int value, Sci_Position fillLength) {
+	decorations.push_back({currentIndicator, value, position, fillLength});
+}
+
+void SCI_METHOD BackgroundLexer::ChangeLexerState(Sci_Position start, Sci_Position end) {
+	if (lexerStateStart == Sci::invalidPosition) {
+		lexerStateStart = start;
+		lexerStateEnd = end;
+	} else {
+		lexerStateStart = std::min(lexerStateStart, start);
+		lexerStateEnd = std::max(lexerStateEnd, end);
+	}
+}
+
+int SCI_METHOD BackgroundLexer::CodePage() const noexcept {
+	return codePage;
+}
+
+bool SCI_METHOD BackgroundLexer::IsDBCSLeadByte([[maybe_unused]] unsigned char ch) const noexcept {
+	return false;
+}
+
+const char * SCI_METHOD BackgroundLexer::BufferPointer() noexcept {
+	return (lineBaseStart == 0 && textEnd == lengthDoc) ? text : nullptr;
+}
+
+const char * SCI_METHOD BackgroundLexer::ContiguousRangePointer(Sci_Position position, Sci_Position rangeLength) const noexcept {
+	// LexAccessor falls back to GetCharRange() for range outside the snapshot
+	if (position >= lineBaseStart && position + rangeLength <= textEnd) {
+		return text + (position - lineBaseStart);
+	}
+	return nullptr;
+}
+
+int SCI_METHOD BackgroundLexer::GetLineIndentation(Sci_Line line) const noexcept {
+	int indent = 0;
+	if (line >= 0 && line < linesTotal) {
+		for (Sci::Position i = LineStart(line); i < textEnd; i++) {
+			const char ch = CharAt(i);
+			if (ch == ' ') {
+				indent++;
+			} else if (ch == '\t') {
+				indent = ((indent / tabInChars) + 1) * tabInChars;
+			} else {
+				break;
+			}
+		}
+	}
+	return indent;
+}
+
+Sci_Position SCI_METHOD BackgroundLexer::GetRelativePosition(Sci_Position positionStart, Sci_Position characterOffset) const noexcept {
+	Sci::Position pos = positionStart;
+	if (codePage == CpUtf8) {
+		while (characterOffset > 0) {
+			if (pos >= lengthDoc) {
+				return Sci::invalidPosition;
+			}
+			if (pos >= lineBaseStart && pos < textEnd) {
+				const int utf8status = UTF8Classify(text + (pos - lineBaseStart), textEnd - pos);
+				pos += (utf8status & UTF8MaskInvalid) ? 1 : (utf8status & UTF8MaskWidth);
+			} else {
+				++pos;
+			}
+			--characterOffset;
+		}
+		while (characterOffset < 0) {
+			if (pos <= 0) {
+				return Sci::invalidPosition;
+			}
+			--pos;
+			// step back over trail bytes
+			for (int trail = 0; trail < UTF8MaxBytes - 1 && pos > 0 && UTF8IsTrailByte(static_cast<unsigned char>(CharAt(pos))); trail++) {
+				--pos;
+			}
+			++characterOffset;
+		}
+	} else {
+		pos = positionStart + characterOffset;
+		if (pos < 0 || pos > lengthDoc) {
+			return Sci::invalidPosition;
+		}
+	}
+	return pos;
+}
+
+int SCI_METHOD BackgroundLexer::GetCharacterAndWidth(Sci_Position position, Sci_Position *pWidth) const noexcept {
+	int bytesInCharacter = 1;
+	const unsigned char leadByte = CharAt(position);
+	int character = leadByte;
+	if (!UTF8IsAscii(leadByte) && codePage == CpUtf8) {
+		const int widthCharBytes = UTF8BytesOfLead(leadByte);
+		unsigned char charBytes[UTF8MaxBytes] = { leadByte, 0, 0, 0 };
+		for (int b = 1; b < widthCharBytes && position + b < lengthDoc; b++) {
+			charBytes[b] = CharAt(position + b);
+		}
+		const int utf8status = UTF8ClassifyMulti(charBytes, widthCharBytes);
+		if (utf8status & UTF8MaskInvalid) {
+			// Report as singleton surrogate values which are invalid Unicode
+			character = 0xDC80 + character;
+		} else {
+			bytesInCharacter = utf8status & UTF8MaskWidth;
+			character = UnicodeFromUTF8(charBytes);
+		}
+	}
+	if (pWidth) {
+		*pWidth = bytesInCharacter;
+	}
+	return character;
+}
+
+CharacterClass SCI_METHOD BackgroundLexer::GetCharacterClass(unsigned int character) const noexcept {
+	if (character < std::size(charClasses)) {
+		return charClasses[character];
+	}
+	return CharClassify::ClassifyCharacter(character);
+}
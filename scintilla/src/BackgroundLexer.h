@@ -0,0 +1,176 @@
+// Scintilla source code edit control
+/** @file BackgroundLexer.h
+ ** Run lexer and folder on a thread pool thread against read only document snapshot.
+ **/
+// This file is part of Notepad4.
+// See License.txt for details about distribution and modification.
+#pragma once
+
+namespace Scintilla::Internal {
+
+/**
+ * Styles, fold levels and line states are written into private buffers line chunk by chunk,
+ * finished chunks are committed into the document on UI thread when the snapshot is not stale
+ * and styling still ends where the job stopped committing.
+ * Only text of the lines used by the job (from lineBase to lineLimit) and a window of document
+ * styles, levels and line states before the start are copied, lexer reads outside get default values.
+ * The lexer instance is shared with UI thread, the job must be stopped before UI thread uses it.
+ * A speculative job starts from an assumed checkpoint without copying document state,
+ * its results are only committed after Resume() at a line where checkpoint matches the document.
+ */
+class BackgroundLexer final : public Scintilla::IDocument {
+public:
+	static constexpr Sci::Position chunkSize = 128*1024;
+	static constexpr Sci::Position styleWindow = 256*1024;
+	static constexpr Sci::Line lineWindow = 4096;
+
+	// state of previous line read by lexer restarting at a line start, see Scintilla::lineCheckpoint*
+	struct Checkpoint {
+		int style;
+		int lineState;
+		int level;
+		bool Same(const Checkpoint &other, int flags) const noexcept {
+			return ((flags & Scintilla::lineCheckpointStyle) == 0 || style == other.style)
+				&& ((flags & Scintilla::lineCheckpointLineState) == 0 || lineState == other.lineState)
+				&& ((flags & Scintilla::lineCheckpointLevel) == 0 || level == other.level);
+		}
+	};
+
+	BackgroundLexer(Scintilla::ILexer5 *instance_, Document &doc, Sci::Position start, Sci::Position end, const Checkpoint *assumed = nullptr);
+	BackgroundLexer(const BackgroundLexer &) = delete;
+	BackgroundLexer(BackgroundLexer &&) = delete;
+	BackgroundLexer &operator=(const BackgroundLexer &) = delete;
+	BackgroundLexer &operator=(BackgroundLexer &&) = delete;
+	~BackgroundLexer();
+
+	static bool Supported(const Document &doc) noexcept;
+	static Checkpoint DocumentCheckpoint(const Document &doc, Sci::Position position) noexcept;
+	bool Start() noexcept;
+	void Stop() noexcept;
+	bool IsStale() const noexcept {
+		return snapshot->IsStale();
+	}
+	bool Finished() const noexcept {
+		return finished.load(std::memory_order_acquire);
+	}
+	// job stopped before reaching its end without being cancelled or invalidated by modification.
+	bool Failed() const noexcept {
+		return rejected || (Finished() && !cancelled.load(std::memory_order_relaxed) && !IsStale()
+			&& lexedTo.load(std::memory_order_acquire) < endGoal);
+	}
+	bool Done() const noexcept {
+		return committedTo >= endGoal;
+	}
+	Sci::Position CommittedTo() const noexcept {
+		return committedTo;
+	}
+	Sci::Position StartPosition() const noexcept {
+		return startPos;
+	}
+	Sci::Position EndGoal() const noexcept {
+		return endGoal;
+	}
+	// checkpoint of the line before position, returns false when worker has not lexed that far or is busy.
+	bool CheckpointAt(Sci::Position position, Checkpoint &checkpoint) noexcept;
+	// results before position are replaced by another job, commit from position.
+	void Resume(Sci::Position position);
+	// copy finished chunks into the document, returns end of committed text.
+	// when not wait, nothing is committed while worker is lexing a chunk.
+	Sci::Position Commit(Document &doc, bool wait);
+
+	int SCI_METHOD Version() const noexcept override;
+	void SCI_METHOD SetErrorStatus(int status) noexcept override;
+	Sci_Position SCI_METHOD Length() const noexcept override;
+	void SCI_METHOD GetCharRange(char *buffer, Sci_Position position, Sci_Position lengthRetrieve) const noexcept override;
+	unsigned char SCI_METHOD StyleAt(Sci_Position position) const noexcept override;
+	Sci_Line SCI_METHOD LineFromPosition(Sci_Position position) const noexcept override;
+	Sci_Position SCI_METHOD LineStart(Sci_Line line) const noexcept override;
+	int SCI_METHOD GetLevel(Sci_Line line) const noexcept override;
+	int SCI_METHOD SetLevel(Sci_Line line, int level) override;
+	int SCI_METHOD GetLineState(Sci_Line line) const noexcept override;
+	int SCI_METHOD SetLineState(Sci_Line line, int state) override;
+	void SCI_METHOD StartStyling(Sci_Position position) noexcept override;
+	bool SCI_METHOD SetStyleFor(Sci_Position length, unsigned char style) override;
+	bool SCI_METHOD SetStyles(Sci_Position length, const unsigned char *styles_) override;
+	void SCI_METHOD DecorationSetCurrentIndicator(int indicator) noexcept override;
+	void SCI_METHOD DecorationFillRange(Sci_Position position, int value, Sci_Position fillLength) override;
+	void SCI_METHOD ChangeLexerState(Sci_Position start, Sci_Position end) override;
+	int SCI_METHOD CodePage() const noexcept override;
+	bool SCI_METHOD IsDBCSLeadByte(unsigned char ch) const noexcept override;
+	const char * SCI_METHOD BufferPointer() noexcept override;
+	const char * SCI_METHOD ContiguousRangePointer(Sci_Position position, Sci_Position rangeLength) const noexcept override;
+	int SCI_METHOD GetLineIndentation(Sci_Line line) const noexcept override;
+	Sci_Position SCI_METHOD LineEnd(Sci_Line line) const noexcept override;
+	Sci_Position SCI_METHOD GetRelativePosition(Sci_Position positionStart, Sci_Position characterOffset) const noexcept override;
+	int SCI_METHOD GetCharacterAndWidth(Sci_Position position, Sci_Position *pWidth) const noexcept override;
+	Scintilla::CharacterClass SCI_METHOD GetCharacterClass(unsigned int character) const noexcept override;
+
+private:
+	struct DecorationFill {
+		int indicator;
+		int value;
+		Sci::Position position;
+		Sci::Position length;
+	};
+
+	Scintilla::ILexer5 * const instance;
+	const Sci::Position lengthDoc;
+	const Sci::Position startPos;
+	const Sci::Position endGoal;
+	const Sci::Line startLine;
+	const Sci::Line lineBase;
+	const Sci::Position lineBaseStart;
+	const Sci::Line linesTotal;
+	// lines after it are not used by lexing up to endGoal
+	const Sci::Line lineLimit;
+	// snapshot of text in [lineBaseStart, textEnd), text[position - lineBaseStart]
+	const Sci::Position textEnd;
+	Scintilla::IDocumentSnapshot * const snapshot;
+	const char * const text;
+	const Checkpoint startCheckpoint;
+	const bool speculative;
+	const int codePage;
+	const int tabInChars;
+	Scintilla::CharacterClass charClasses[256];
+
+	// lineStarts[line - lineBase] up to lineLimit, filled by worker before lexing
+	std::vector<Sci::Position> lineStarts;
+	// styles[position - stylesStart]
+	Sci::Position stylesStart;
+	std::vector<unsigned char> styles;
+	// levels[line - lineBase] and lineStates[line - lineBase]
+	std::vector<int> levels;
+	std::vector<int> lineStates;
+	std::vector<DecorationFill> decorations;
+	Sci::Position lexerStateStart;
+	Sci::Position lexerStateEnd;
+	Sci::Position endStyled;
+	int currentIndicator = 0;
+	int errorStatus = 0;
+	int initStyle;
+	bool rejected = false;
+
+	// guards buffers above while worker is lexing a chunk
+	NativeMutex mutex;
+	PTP_WORK work = nullptr;
+	std::atomic<Sci::Position> lexedTo;
+	std::atomic<bool> cancelled = false;
+	std::atomic<bool> finished = false;
+	Sci::Position committedTo;
+
+	static VOID CALLBACK WorkCallback(PTP_CALLBACK_INSTANCE callbackInstance, PVOID parameter, PTP_WORK work_) noexcept;
+	bool FindLineStarts();
+	void Lex();
+	void CommitLocked(Document &doc);
+	Sci::Line LineIndex(Sci::Line line) const noexcept {
+		return line - lineBase;
+	}
+	char CharAt(Sci::Position position) const noexcept {
+		return (position >= lineBaseStart && position < textEnd) ? text[position - lineBaseStart] : '\0';
+	}
+	bool ValidLineIndex(Sci::Line line) const noexcept {
+		return static_cast<size_t>(line - lineBase) < levels.size();
+	}
+};
+
+}
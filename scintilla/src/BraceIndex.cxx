@@ -0,0 +1,111 @@
+// Scintilla source code edit control
+/** @file BraceIndex.cxx
+ ** Per block brace depth summaries to skip text blocks when matching brace in large document.
+ **/
+// This file is part of Notepad4.
+// See License.txt for details about distribution and modification.
+
+#include <cstddef>
+#include <cstdlib>
+#include <cstdint>
+#include <cassert>
+#include <cstring>
+
+#include <stdexcept>
+#include <vector>
+#include <algorithm>
+#include <memory>
+
+#include "Debugging.h"
+
+#include "Position.h"
+#include "SplitVector.h"
+#include "Partitioning.h"
+#include "BraceIndex.h"
+
+using namespace Scintilla::Internal;
+
+size_t BraceIndex::MemoryUsage() const noexcept {
+	size_t size = blocks.capacity()*sizeof(Block) + starts.MemoryUsage();
+	for (const Block &block : blocks) {
+		size += block.summaries.capacity()*sizeof(Summary);
+	}
+	return size;
+}
+
+void BraceIndex::Build(Sci::Position length) noexcept {
+	const Sci::Position blockCount = std::max<Sci::Position>(1, (length + blockSize - 1) / blockSize);
+	try {
+		blocks.clear();
+		blocks.resize(blockCount);
+		Sci::Position *positions = starts.ResetPartitions(blockCount);
+		for (Sci::Position block = 1; block <= blockCount; block++) {
+			*positions++ = std::min(block*blockSize, length);
+		}
+	} catch (...) {
+		Clear();
+	}
+}
+
+void BraceIndex::Clear() noexcept {
+	std::vector<Block>().swap(blocks);
+}
+
+void BraceIndex::Invalidate(Sci::Position first, Sci::Position last) noexcept {
+	for (Sci::Position block = first; block <= last; block++) {
+		blocks[block].summarized = false;
+	}
+}
+
+void BraceIndex::InsertText(Sci::Position position, Sci::Position insertLength) noexcept {
+	if (!Built()) {
+		return;
+	}
+	const Sci::Position block = starts.PartitionFromPosition(position);
+	const Sci::Position blockLength = starts.PositionFromPartition(block + 1) - starts.PositionFromPartition(block);
+	if (blockLength + insertLength > maxBlockLength) {
+		// rebuild partitions on next brace matching
+		Clear();
+		return;
+	}
+	starts.InsertText(block, insertLength);
+	Invalidate(block, block);
+}
+
+void BraceIndex::DeleteText(Sci::Position position, Sci::Position deleteLength) noexcept {
+	if (!Built()) {
+		return;
+	}
+	// blocks inside deleted range become empty, text before and after it is kept in the first and last block.
+	const Sci::Position first = starts.PartitionFromPosition(position);
+	const Sci::Position last = starts.PartitionFromPosition(position + deleteLength);
+	for (Sci::Position block = first + 1; block <= last; block++) {
+		starts.SetPartitionStartPosition(block, position + deleteLength);
+	}
+	starts.InsertText(first, -deleteLength);
+	Invalidate(first, last);
+}
+
+void BraceIndex::ChangeStyle(Sci::Position position, Sci::Position length) noexcept {
+	if (!Built() || length <= 0) {
+		return;
+	}
+	const Sci::Position first = starts.PartitionFromPosition(position);
+	const Sci::Position last = starts.PartitionFromPosition(position + length - 1);
+	Invalidate(first, last);
+}
+
+void BraceIndex::SetSummaries(Sci::Position block, std::vector<Summary> &&summaries) noexcept {
+	Block &item = blocks[block];
+	item.summaries = std::move(summaries);
+	item.summarized = true;
+}
+
+const BraceIndex::Summary *BraceIndex::Find(Sci::Position block, int pair, int style) const noexcept {
+	for (const Summary &summary : blocks[block].summaries) {
+		if (summary.pair == pair && summary.style == style) {
+			return &summary;
+		}
+	}
+	return nullptr;
+}
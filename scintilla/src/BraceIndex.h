@@ -0,0 +1,65 @@
+// Scintilla source code edit control
+/** @file BraceIndex.h
+ ** Per block brace depth summaries to skip text blocks when matching brace in large document.
+ **/
+// This file is part of Notepad4.
+// See License.txt for details about distribution and modification.
+#pragma once
+
+namespace Scintilla::Internal {
+
+/**
+ * Document is split into blocks, for each brace pair and style a block has the net depth change and
+ * the minimum prefix depth of its braces. A block can be skipped when matching brace is not inside it.
+ * Summaries are computed lazily on brace matching, and dropped when text or style inside the block
+ * is changed. Block bounds are moved on modification, partitions are rebuilt only after large insertion.
+ */
+class BraceIndex {
+public:
+	static constexpr Sci::Position blockSize = 64*1024;
+	static constexpr Sci::Position maxBlockLength = 4*blockSize;
+
+	struct Summary {
+		uint8_t pair;
+		uint8_t style;
+		int32_t net;		// opening brace +1, closing brace -1
+		int32_t minPrefix;	// minimum depth change from block start, including empty prefix
+	};
+
+	bool Built() const noexcept {
+		return !blocks.empty();
+	}
+	size_t MemoryUsage() const noexcept;
+	void Build(Sci::Position length) noexcept;
+	void Clear() noexcept;
+	void InsertText(Sci::Position position, Sci::Position insertLength) noexcept;
+	void DeleteText(Sci::Position position, Sci::Position deleteLength) noexcept;
+	void ChangeStyle(Sci::Position position, Sci::Position length) noexcept;
+
+	Sci::Position Blocks() const noexcept {
+		return starts.Partitions();
+	}
+	Sci::Position BlockFromPosition(Sci::Position position) const noexcept {
+		return starts.PartitionFromPosition(position);
+	}
+	Sci::Position BlockStart(Sci::Position block) const noexcept {
+		return starts.PositionFromPartition(block);
+	}
+	bool Summarized(Sci::Position block) const noexcept {
+		return blocks[block].summarized;
+	}
+	void SetSummaries(Sci::Position block, std::vector<Summary> &&summaries) noexcept;
+	const Summary *Find(Sci::Position block, int pair, int style) const noexcept;
+
+private:
+	struct Block {
+		bool summarized = false;
+		std::vector<Summary> summaries;
+	};
+	Partitioning<Sci::Position> starts;
+	std::vector<Block> blocks;
+
+	void Invalidate(Sci::Position first, Sci::Position last) noexcept;
+};
+
+}
@@ -8,6 +8,7 @@
 // Copyright 2013 by Neil Hodgson <neilh@scintilla.org>
 // The License.txt file describes the conditions under which this software may be distributed.
 
+#include <cstdint>
 #include <cassert>
 #include <cstring>
 
@@ -17,6 +18,8 @@
 #include <vector>
 #include <algorithm>
 
+#include "VectorISA.h"
+
 #include "CaseConvert.h"
 #include "UniConversion.h"
 
@@ -607,6 +610,8 @@ class CaseConverter final : public ICaseConverter {
 	// The parallel arrays
 	std::vector<int> characters;
 	std::vector<ConversionString> conversions;
+	// first of the 26 ASCII letters changed by this conversion, other ASCII characters are unchanged
+	unsigned char asciiFirst = 'A';
 
 public:
 	[[nodiscard]] bool Initialised() const noexcept {
@@ -628,7 +633,27 @@ public:
 		size_t lenConverted = 0;
 		size_t mixedPos = 0;
 		unsigned char bytes[UTF8MaxBytes + 1]{};
+#if NP2_USE_SSE2
+		const __m128i letterFirst = _mm_set1_epi8(static_cast<char>(asciiFirst - 1));
+		const __m128i letterLast = _mm_set1_epi8(static_cast<char>(asciiFirst + 26));
+		const __m128i caseBit = _mm_set1_epi8(0x20);
+#endif
 		while (mixedPos < lenMixed) {
+#if NP2_USE_SSE2
+			// convert leading ASCII bytes of the block, remaining character uses the tables
+			if (mixedPos + sizeof(__m128i) <= lenMixed && lenConverted + sizeof(__m128i) < sizeConverted) {
+				const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i *>(mixed + mixedPos));
+				const __m128i letter = _mm_and_si128(_mm_cmpgt_epi8(chunk, letterFirst), _mm_cmpgt_epi8(letterLast, chunk));
+				_mm_storeu_si128(reinterpret_cast<__m128i *>(converted + lenConverted), _mm_xor_si128(chunk, _mm_and_si128(letter, caseBit)));
+				const uint32_t mask = _mm_movemask_epi8(chunk);
+				const size_t ascii = (mask == 0) ? sizeof(__m128i) : np2_ctz(mask);
+				mixedPos += ascii;
+				lenConverted += ascii;
+				if (ascii != 0) {
+					continue;
+				}
+			}
+#endif
 			const unsigned char leadByte = mixed[mixedPos];
 			const char *caseConverted = nullptr;
 			size_t lenMixedChar = 1;
@@ -693,6 +718,7 @@ void CaseConverter::AddSymmetric(CaseConversion conversion, int lower, int upper
 }
 
 void CaseConverter::SetupConversions(CaseConversion conversion) {
+	asciiFirst = (conversion == CaseConversion::upper) ? 'a' : 'A';
 	// First initialize for the symmetric ranges
 	for (size_t i = 0; i < std::size(symmetricCaseConversionRanges); i += 2) {
 		unsigned int lower = symmetricCaseConversionRanges[i];
@@ -797,8 +823,14 @@ size_t CaseConvertString(char *converted, size_t sizeConverted, const char *mixe
 }
 
 std::string CaseConvertString(const std::string &s, CaseConversion conversion) {
-	std::string retMapped(s.length() * maxExpansionCaseConversion, 0);
-	const size_t lenMapped = CaseConvertString(retMapped.data(), retMapped.length(), s.c_str(), s.length(), conversion);
+	const CaseConverter *pCaseConv = ConverterForConversion(conversion);
+	// converted text rarely grows, retry with maximum expansion when buffer is too small
+	std::string retMapped(s.length() + s.length()/8 + 16, 0);
+	size_t lenMapped = pCaseConv->CaseConvertString(retMapped.data(), retMapped.length(), s.c_str(), s.length());
+	if (lenMapped == 0 && !s.empty()) {
+		retMapped.assign(s.length() * maxExpansionCaseConversion, 0);
+		lenMapped = pCaseConv->CaseConvertString(retMapped.data(), retMapped.length(), s.c_str(), s.length());
+	}
 	retMapped.resize(lenMapped);
 	return retMapped;
 }
@@ -21,9 +21,13 @@
 #include <optional>
 #include <algorithm>
 #include <memory>
+#include <atomic>
 //#include <type_traits>
 
+#include <windows.h>
+
 #include "ScintillaTypes.h"
+#include "ILoader.h"
 
 #include "Debugging.h"
 #include "VectorISA.h"
@@ -70,6 +74,73 @@ struct CountWidths {
 	}
 };
 
+namespace {
+
+size_t ASCIIPrefixLength(const char *s, size_t length) noexcept {
+	size_t count = 0;
+#if NP2_USE_SSE2
+	while (count + sizeof(__m128i) <= length) {
+		const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i *>(s + count));
+		const uint32_t mask = mm_movemask_epi8(chunk);
+		if (mask) {
+			return count + np2::ctz(mask);
+		}
+		count += sizeof(__m128i);
+	}
+#endif
+	while (count < length && UTF8IsAscii(s[count])) {
+		count++;
+	}
+	return count;
+}
+
+CountWidths CountCharacterWidthsUTF8(std::string_view sv) noexcept {
+	CountWidths cw;
+	size_t remaining = sv.length();
+	while (remaining > 0) {
+		if (UTF8IsAscii(sv.front())) {
+			// skip ASCII run
+			const size_t count = ASCIIPrefixLength(sv.data(), remaining);
+			cw.countBasePlane += count;
+			sv.remove_prefix(count);
+			remaining -= count;
+			continue;
+		}
+		const int utf8Status = UTF8Classify(sv);
+		const int lenChar = utf8Status & UTF8MaskWidth;
+		cw.CountChar(lenChar);
+		sv.remove_prefix(lenChar);
+		remaining -= lenChar;
+	}
+	return cw;
+}
+
+CountWidths CountCharacterWidthsRange(const SplitVector<char, TextStorage> &substance, Sci::Position position, Sci::Position length) noexcept {
+	CountWidths cw;
+	char buffer[1024];
+	while (length > 0) {
+		size_t count = std::min<size_t>(length, sizeof(buffer));
+		substance.GetRange(buffer, position, count);
+		if (static_cast<Sci::Position>(count) < length) {
+			// leave possible incomplete last character to next block
+			for (size_t i = count - 1; i >= count - (UTF8MaxBytes - 1); i--) {
+				if (!UTF8IsTrailByte(static_cast<unsigned char>(buffer[i]))) {
+					count = i;
+					break;
+				}
+			}
+		}
+		const CountWidths widths = CountCharacterWidthsUTF8(std::string_view(buffer, count));
+		cw.countBasePlane += widths.countBasePlane;
+		cw.countOtherPlanes += widths.countOtherPlanes;
+		position += count;
+		length -= count;
+	}
+	return cw;
+}
+
+}
+
 class ILineVector {
 public:
 	virtual void Init() = 0;
@@ -85,11 +156,15 @@ public:
 	virtual Sci::Position LineStart(Sci::Line line) const noexcept = 0;
 	virtual void InsertCharacters(Sci::Line line, CountWidths delta) noexcept = 0;
 	virtual void SetLineCharactersWidth(Sci::Line line, CountWidths width) noexcept = 0;
+	virtual Sci::Line IndexValidLines() const noexcept = 0;
+	virtual void ValidateLineCharactersWidth(CountWidths width) noexcept = 0;
+	virtual void InvalidateLineCharacterIndex(Sci::Line line) noexcept = 0;
 	virtual Scintilla::LineCharacterIndexType LineCharacterIndex() const noexcept = 0;
 	virtual bool AllocateLineCharacterIndex(Scintilla::LineCharacterIndexType lineCharacterIndex, Sci::Line lines) = 0;
 	virtual bool ReleaseLineCharacterIndex(Scintilla::LineCharacterIndexType lineCharacterIndex) = 0;
 	virtual Sci::Position IndexLineStart(Sci::Line line, Scintilla::LineCharacterIndexType lineCharacterIndex) const noexcept = 0;
 	virtual Sci::Line LineFromPositionIndex(Sci::Position pos, Scintilla::LineCharacterIndexType lineCharacterIndex) const noexcept = 0;
+	virtual size_t MemoryUsage(bool characterIndex) const noexcept = 0;
 	virtual ~ILineVector() = default;
 };
 
@@ -116,11 +191,12 @@ public:
 	}
 	bool Allocate(Sci::Line lines) {
 		refCount++;
-		Sci::Position length = starts.Length();
-		for (Sci::Line line = starts.Partitions(); line < lines; line++) {
+		if (lines > starts.Partitions()) {
 			// Produce an ascending sequence that will be filled in with correct widths later
-			length++;
-			starts.InsertPartition(line_cast(line), line_cast(length));
+			POS * const positions = starts.ResetPartitions(line_cast(lines));
+			for (POS line = 0; line < line_cast(lines); line++) {
+				positions[line] = line + 1;
+			}
 		}
 		return refCount == 1;
 	}
@@ -165,6 +241,8 @@ class LineVector final : public ILineVector {
 	LineStartIndex<POS> startsUTF16;
 	LineStartIndex<POS> startsUTF32;
 	LineCharacterIndexType activeIndices = LineCharacterIndexType::None;
+	// character widths are only valid for lines before it, others are calculated on demand
+	POS indexValidLines = 0;
 
 	void SetActiveIndices() noexcept {
 		activeIndices = (startsUTF32.Active() ? LineCharacterIndexType::Utf32 : LineCharacterIndexType::None)
@@ -193,6 +271,7 @@ public:
 		}
 		startsUTF32.starts.DeleteAll();
 		startsUTF16.starts.DeleteAll();
+		indexValidLines = 0;
 	}
 	void SetPerLine(PerLine *pl) noexcept override {
 		perLine = pl;
@@ -210,6 +289,9 @@ public:
 			if (FlagSet(activeIndices, LineCharacterIndexType::Utf16)) {
 				startsUTF16.InsertLines(line, 1);
 			}
+			if (lineAsPos <= indexValidLines) {
+				indexValidLines++;
+			}
 		}
 		if (perLine) {
 			if ((line > 0) && lineStart) {
@@ -232,6 +314,9 @@ public:
 			if (FlagSet(activeIndices, LineCharacterIndexType::Utf16)) {
 				startsUTF16.InsertLines(line, lines);
 			}
+			if (lineAsPos <= indexValidLines) {
+				indexValidLines += pos_cast(lines);
+			}
 		}
 		if (perLine) {
 			if ((line > 0) && lineStart) {
@@ -251,6 +336,10 @@ public:
 		if (FlagSet(activeIndices, LineCharacterIndexType::Utf16)) {
 			startsUTF16.starts.RemovePartition(pos_cast(line));
 		}
+		if (pos_cast(line) <= indexValidLines && activeIndices != LineCharacterIndexType::None) {
+			// merged with previous line
+			indexValidLines--;
+		}
 		if (perLine) {
 			perLine->RemoveLine(line);
 		}
@@ -276,6 +365,9 @@ public:
 		return starts.PositionFromPartition(pos_cast(line));
 	}
 	void InsertCharacters(Sci::Line line, CountWidths delta) noexcept override {
+		if (pos_cast(line) >= indexValidLines) {
+			return;
+		}
 		if (FlagSet(activeIndices, LineCharacterIndexType::Utf32)) {
 			startsUTF32.starts.InsertText(pos_cast(line), pos_cast(delta.WidthUTF32()));
 		}
@@ -293,7 +385,16 @@ public:
 			startsUTF16.SetLineWidth(line, width.WidthUTF16());
 		}
 	}
-
+	Sci::Line IndexValidLines() const noexcept override {
+		return line_from_pos_cast(indexValidLines);
+	}
+	void ValidateLineCharactersWidth(CountWidths width) noexcept override {
+		SetLineCharactersWidth(indexValidLines, width);
+		indexValidLines++;
+	}
+	void InvalidateLineCharacterIndex(Sci::Line line) noexcept override {
+		indexValidLines = std::min(indexValidLines, pos_cast(line));
+	}
 	LineCharacterIndexType LineCharacterIndex() const noexcept override {
 		return activeIndices;
 	}
@@ -308,7 +409,12 @@ public:
 			assert(startsUTF16.starts.Partitions() == starts.Partitions());
 		}
 		SetActiveIndices();
-		return activeIndicesStart != activeIndices;
+		if (activeIndicesStart != activeIndices) {
+			// Changed so recalculate whole file on demand
+			indexValidLines = 0;
+			return true;
+		}
+		return false;
 	}
 	bool ReleaseLineCharacterIndex(LineCharacterIndexType lineCharacterIndex) override {
 		const LineCharacterIndexType activeIndicesStart = activeIndices;
@@ -328,12 +434,29 @@ public:
 			return startsUTF16.starts.PositionFromPartition(pos_cast(line));
 		}
 	}
+	size_t MemoryUsage(bool characterIndex) const noexcept override {
+		if (characterIndex) {
+			return startsUTF16.starts.MemoryUsage() + startsUTF32.starts.MemoryUsage();
+		}
+		return starts.MemoryUsage();
+	}
 	Sci::Line LineFromPositionIndex(Sci::Position pos, LineCharacterIndexType lineCharacterIndex) const noexcept override {
-		if (lineCharacterIndex == LineCharacterIndexType::Utf32) {
-			return line_from_pos_cast(startsUTF32.starts.PartitionFromPosition(pos_cast(pos)));
-		} else {
-			return line_from_pos_cast(startsUTF16.starts.PartitionFromPosition(pos_cast(pos)));
+		const Partitioning<POS> &index = (lineCharacterIndex == LineCharacterIndexType::Utf32) ? startsUTF32.starts : startsUTF16.starts;
+		if (indexValidLines >= starts.Partitions()) {
+			return line_from_pos_cast(index.PartitionFromPosition(pos_cast(pos)));
+		}
+		// caller ensured pos is before indexValidLines, only search valid lines
+		POS lower = 0;
+		POS upper = indexValidLines - 1;
+		while (lower < upper) {
+			const POS middle = (upper + lower + 1) / 2; 	// Round high
+			if (pos < index.PositionFromPartition(middle)) {
+				upper = middle - 1;
+			} else {
+				lower = middle;
+			}
 		}
+		return line_from_pos_cast(lower);
 	}
 };
 
@@ -346,17 +469,255 @@ std::unique_ptr<ILineVector> LineVectorCreate(bool largeDocument) {
 
 }
 
-CellBuffer::CellBuffer(bool hasStyles_, bool largeDocument_) :
-	hasStyles(hasStyles_), largeDocument(largeDocument_),
+namespace Scintilla::Internal {
+
+// Copy of text (or a range of text) shared between CellBuffer and readers on other threads,
+// CellBuffer marks it stale and drops its reference on first change.
+class TextSnapshot final : public IDocumentSnapshot {
+	std::atomic<int> refCount = 1;
+	std::atomic<bool> stale = false;
+	const Sci::Position length;
+	const std::unique_ptr<char[]> text;
+public:
+	TextSnapshot(const SplitVector<char, TextStorage> &substance, Sci::Position start, Sci::Position length_) :
+		length{length_},
+		text{std::make_unique_for_overwrite<char[]>(length + 1)} {
+		substance.GetRange(text.get(), start, length);
+		text[length] = '\0';
+	}
+	bool Shared() const noexcept {
+		return refCount.load(std::memory_order_acquire) > 1;
+	}
+	int SCI_METHOD AddRef() noexcept override {
+		return refCount.fetch_add(1, std::memory_order_relaxed) + 1;
+	}
+	int SCI_METHOD Release() noexcept override {
+		const int refs = refCount.fetch_sub(1, std::memory_order_acq_rel) - 1;
+		if (refs == 0) {
+			delete this;
+		}
+		return refs;
+	}
+	const char * SCI_METHOD Text() const noexcept override {
+		return text.get();
+	}
+	Sci_Position SCI_METHOD Length() const noexcept override {
+		return length;
+	}
+	bool SCI_METHOD IsStale() const noexcept override {
+		return stale.load(std::memory_order_acquire);
+	}
+	void SetStale() noexcept {
+		stale.store(true, std::memory_order_release);
+	}
+};
+
+}
+
+namespace {
+
+#if defined(_WIN64)
+constexpr size_t VirtualMemoryGranularity = 64*1024;
+constexpr size_t MinimumVirtualReserveSize = 1024*1024*1024;
+
+constexpr size_t RoundUpVirtualMemory(size_t size) noexcept {
+	return (size + VirtualMemoryGranularity - 1) & ~(VirtualMemoryGranularity - 1);
+}
+#endif
+
+}
+
+void TextStorage::Release() noexcept {
+	if (ptr) {
+#if defined(_WIN64)
+		if (reserved) {
+			VirtualFree(ptr, 0, MEM_RELEASE);
+		} else
+#endif
+		{
+			free(ptr);
+		}
+		ptr = nullptr;
+	}
+	committed = 0;
+	reserved = 0;
+}
+
+void TextStorage::reserve(size_t newSize) {
+	if (newSize <= committed) {
+		return;
+	}
+#if defined(_WIN64)
+	if (newSize <= reserved) {
+		// commit more pages, existing content is kept in place
+		const size_t size = std::min(RoundUpVirtualMemory(newSize), reserved);
+		if (VirtualAlloc(ptr, size, MEM_COMMIT, PAGE_READWRITE) == nullptr) {
+			throw std::bad_alloc();
+		}
+		committed = size;
+		return;
+	}
+	if (virtualMemory) {
+		// reserve twice the requested size, content is only copied after it's exhausted
+		const size_t reserveSize = RoundUpVirtualMemory(std::max(newSize*2, MinimumVirtualReserveSize));
+		char *buffer = static_cast<char *>(VirtualAlloc(nullptr, reserveSize, MEM_RESERVE, PAGE_NOACCESS));
+		if (buffer) {
+			const size_t size = RoundUpVirtualMemory(newSize);
+			if (VirtualAlloc(buffer, size, MEM_COMMIT, PAGE_READWRITE)) {
+				if (length != 0) {
+					memcpy(buffer, ptr, length);
+				}
+				Release();
+				ptr = buffer;
+				committed = size;
+				reserved = reserveSize;
+				return;
+			}
+			VirtualFree(buffer, 0, MEM_RELEASE);
+		}
+		// fallback to heap allocation
+	}
+#endif
+	char *buffer = static_cast<char *>(malloc(newSize));
+	if (buffer == nullptr) {
+		throw std::bad_alloc();
+	}
+	if (length != 0) {
+		memcpy(buffer, ptr, length);
+	}
+	Release();
+	ptr = buffer;
+	committed = newSize;
+}
+
+namespace Scintilla::Internal {
+
+template <typename T>
+void AddDelta(T *data, ptrdiff_t length, T delta) noexcept {
+	static_assert(sizeof(T) == sizeof(int32_t) || sizeof(T) == sizeof(int64_t));
+	T * const end = data + length;
+#if NP2_USE_AVX2
+	constexpr ptrdiff_t blockSize = 2*sizeof(__m256i)/sizeof(T);
+	__m256i mmDelta;
+	if constexpr (sizeof(T) == sizeof(int32_t)) {
+		mmDelta = _mm256_set1_epi32(delta);
+	} else {
+		mmDelta = _mm256_set1_epi64x(delta);
+	}
+	while (data + blockSize <= end) {
+		__m256i *ptr = reinterpret_cast<__m256i *>(data);
+		__m256i chunk1 = _mm256_loadu_si256(ptr);
+		__m256i chunk2 = _mm256_loadu_si256(ptr + 1);
+		if constexpr (sizeof(T) == sizeof(int32_t)) {
+			chunk1 = _mm256_add_epi32(chunk1, mmDelta);
+			chunk2 = _mm256_add_epi32(chunk2, mmDelta);
+		} else {
+			chunk1 = _mm256_add_epi64(chunk1, mmDelta);
+			chunk2 = _mm256_add_epi64(chunk2, mmDelta);
+		}
+		_mm256_storeu_si256(ptr, chunk1);
+		_mm256_storeu_si256(ptr + 1, chunk2);
+		data += blockSize;
+	}
+	// end NP2_USE_AVX2
+#elif NP2_USE_SSE2
+	constexpr ptrdiff_t blockSize = 2*sizeof(__m128i)/sizeof(T);
+	__m128i mmDelta;
+	if constexpr (sizeof(T) == sizeof(int32_t)) {
+		mmDelta = _mm_set1_epi32(delta);
+	} else {
+		mmDelta = _mm_set1_epi64x(delta);
+	}
+	while (data + blockSize <= end) {
+		__m128i *ptr = reinterpret_cast<__m128i *>(data);
+		__m128i chunk1 = _mm_loadu_si128(ptr);
+		__m128i chunk2 = _mm_loadu_si128(ptr + 1);
+		if constexpr (sizeof(T) == sizeof(int32_t)) {
+			chunk1 = _mm_add_epi32(chunk1, mmDelta);
+			chunk2 = _mm_add_epi32(chunk2, mmDelta);
+		} else {
+			chunk1 = _mm_add_epi64(chunk1, mmDelta);
+			chunk2 = _mm_add_epi64(chunk2, mmDelta);
+		}
+		_mm_storeu_si128(ptr, chunk1);
+		_mm_storeu_si128(ptr + 1, chunk2);
+		data += blockSize;
+	}
+	// end NP2_USE_SSE2
+#endif
+	while (data < end) {
+		*data += delta;
+		++data;
+	}
+}
+
+// Partitioning is instantiated with int and Sci::Position
+template void AddDelta<int>(int *data, ptrdiff_t length, int delta) noexcept;
+#if PTRDIFF_MAX > INT_MAX
+template void AddDelta<Sci::Position>(Sci::Position *data, ptrdiff_t length, Sci::Position delta) noexcept;
+#endif
+
+}
+
+CellBuffer::CellBuffer(bool hasStyles_, bool largeDocument_, bool runStyles_) :
+	hasStyles(hasStyles_), largeDocument(largeDocument_), runStyles(runStyles_),
 	uh{std::make_unique<UndoHistory>()},
 	plv{LineVectorCreate(largeDocument_)} {
+	// grow text and styles of large document without copying
+	substance.BodyStorage().UseVirtualMemory(largeDocument_);
+	style.BodyStorage().UseVirtualMemory(largeDocument_);
+	if (hasStyles && runStyles) {
+		styleRuns = std::make_unique<RunStyles<Sci::Position, char>>();
+	}
 	readOnly = false;
 	utf8Substance = false;
 	utf8LineEnds = LineEndType::Default;
 	collectingUndo = true;
+	lineStartsHint = nullptr;
+	lineStartsHintCount = 0;
+	snapshot = nullptr;
+}
+
+CellBuffer::~CellBuffer() noexcept {
+	DiscardSnapshot();
+}
+
+IDocumentSnapshot *CellBuffer::CreateSnapshot() {
+	if (!snapshot) {
+		snapshot = new TextSnapshot(substance, 0, substance.Length());
+	}
+	snapshot->AddRef();
+	return snapshot;
 }
 
-CellBuffer::~CellBuffer() noexcept = default;
+IDocumentSnapshot *CellBuffer::CreateSnapshot(Sci::Position start, Sci::Position length) {
+	// drop range snapshots no longer used by readers
+	rangeSnapshots.erase(std::remove_if(rangeSnapshots.begin(), rangeSnapshots.end(), [](TextSnapshot *range) noexcept {
+		if (range->Shared()) {
+			return false;
+		}
+		range->Release();
+		return true;
+	}), rangeSnapshots.end());
+	rangeSnapshots.reserve(rangeSnapshots.size() + 1);
+	TextSnapshot * const range = new TextSnapshot(substance, start, length);
+	rangeSnapshots.push_back(range);
+	range->AddRef();
+	return range;
+}
+
+void CellBuffer::DiscardSnapshot() noexcept {
+	if (snapshot) {
+		snapshot->SetStale();
+		snapshot->Release();
+		snapshot = nullptr;
+	}
+	for (TextSnapshot *range : rangeSnapshots) {
+		range->SetStale();
+		range->Release();
+	}
+	rangeSnapshots.clear();
+}
 
 char CellBuffer::CharAt(Sci::Position position) const noexcept {
 	return substance.ValueAt(position);
@@ -377,7 +738,13 @@ void CellBuffer::GetCharRange(char *buffer, Sci::Position position, Sci::Positio
 }
 
 char CellBuffer::StyleAt(Sci::Position position) const noexcept {
-	return hasStyles ? style.ValueAt(position) : '\0';
+	if (!hasStyles) {
+		return '\0';
+	}
+	if (styleRuns) {
+		return (position >= 0 && position < styleRuns->Length()) ? styleRuns->ValueAt(position) : '\0';
+	}
+	return style.ValueAt(position);
 }
 
 void CellBuffer::GetStyleRange(unsigned char *buffer, Sci::Position position, Sci::Position lengthRetrieve) const noexcept {
@@ -388,13 +755,23 @@ void CellBuffer::GetStyleRange(unsigned char *buffer, Sci::Position position, Sc
 		std::fill_n(buffer, lengthRetrieve, static_cast<unsigned char>(0));
 		return;
 	}
-	if ((position + lengthRetrieve) > style.Length()) {
+	if ((position + lengthRetrieve) > (styleRuns ? styleRuns->Length() : style.Length())) {
 		//Platform::DebugPrintf("Bad GetStyleRange %.0f for %.0f of %.0f\n",
 		//					static_cast<double>(position),
 		//					static_cast<double>(lengthRetrieve),
 		//					static_cast<double>(style.Length()));
 		return;
 	}
+	if (styleRuns) {
+		const Sci::Position end = position + lengthRetrieve;
+		while (position < end) {
+			const Sci::Position runEnd = std::min(styleRuns->EndRun(position), end);
+			memset(buffer, static_cast<unsigned char>(styleRuns->ValueAt(position)), runEnd - position);
+			buffer += runEnd - position;
+			position = runEnd;
+		}
+		return;
+	}
 	style.GetRange(reinterpret_cast<char *>(buffer), position, lengthRetrieve);
 }
 
@@ -406,9 +783,23 @@ const char *CellBuffer::RangePointer(Sci::Position position, Sci::Position range
 	return substance.RangePointer(position, rangeLength);
 }
 
+const char *CellBuffer::ContiguousRangePointer(Sci::Position position, Sci::Position rangeLength) const noexcept {
+	return substance.ContiguousRangePointer(position, rangeLength);
+}
+
 int CellBuffer::CheckRange(const char *chars, const char *styles, Sci::Position position, Sci::Position rangeLength) const noexcept {
 	int result = substance.CheckRange(chars, position, rangeLength);
-	if (hasStyles) {
+	if (styleRuns) {
+		const Sci::Position end = position + rangeLength;
+		while (result == 0 && position < end) {
+			const Sci::Position runEnd = std::min(styleRuns->EndRun(position), end);
+			const char value = styleRuns->ValueAt(position);
+			while (position < runEnd) {
+				result |= *styles++ ^ value;
+				++position;
+			}
+		}
+	} else if (hasStyles) {
 		result |= style.CheckRange(styles, position, rangeLength);
 	}
 	return result;
@@ -438,6 +829,169 @@ SplitView CellBuffer::AllView() const noexcept {
 	};
 }
 
+namespace {
+
+// width of UTF-8 character same as NextPosition(), invalid byte is treated as a character.
+inline int UTF8CharacterWidth(const unsigned char *us) noexcept {
+	const unsigned char leadByte = us[0];
+	if (UTF8IsAscii(leadByte)) {
+		return 1;
+	}
+	const int utf8status = UTF8ClassifyMulti(us, UTF8BytesOfLead(leadByte));
+	return (utf8status & UTF8MaskInvalid) ? 1 : (utf8status & UTF8MaskWidth);
+}
+
+// Count UTF-8 characters and 4-byte characters from ptr (at character boundary) until reaching last.
+// Block of 32 bytes that only contains complete and valid sequences is counted by number of non-trail bytes,
+// block with invalid or rare sequences (overlong, surrogate, non-character, above U+10FFFF) is counted
+// character by character. Up to 3 bytes after last are read, returns pointer at or after last.
+const unsigned char *CountUTF8(const unsigned char *ptr, const unsigned char *last, Sci::Position &count, Sci::Position &countSupplementary) noexcept {
+#if NP2_USE_AVX2 || NP2_USE_SSE2
+	constexpr uint32_t blockSize = 32;
+	while (ptr + blockSize <= last) {
+#if NP2_USE_AVX2
+		const __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(ptr));
+		const uint32_t nonAscii = mm256_movemask_epi8(chunk);
+		const auto ge = [chunk](uint8_t value) noexcept {
+			return mm256_movemask_epi8(mm256_cmpge_epu8(chunk, mm256_set1_epi8(value)));
+		};
+		const auto eq = [chunk](uint8_t value) noexcept {
+			return mm256_movemask_epi8(_mm256_cmpeq_epi8(chunk, mm256_set1_epi8(value)));
+		};
+#else
+		const __m128i chunk1 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(ptr));
+		const __m128i chunk2 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(ptr + sizeof(__m128i)));
+		const uint32_t nonAscii = mm_movemask_epi8(chunk1) | (mm_movemask_epi8(chunk2) << 16);
+		const auto ge = [chunk1, chunk2](uint8_t value) noexcept {
+			const __m128i mmValue = _mm_set1_epi8(static_cast<char>(value));
+			return mm_movemask_epi8(mm_cmpge_epu8(chunk1, mmValue)) | (mm_movemask_epi8(mm_cmpge_epu8(chunk2, mmValue)) << 16);
+		};
+		const auto eq = [chunk1, chunk2](uint8_t value) noexcept {
+			const __m128i mmValue = _mm_set1_epi8(static_cast<char>(value));
+			return mm_movemask_epi8(_mm_cmpeq_epi8(chunk1, mmValue)) | (mm_movemask_epi8(_mm_cmpeq_epi8(chunk2, mmValue)) << 16);
+		};
+#endif
+		if (nonAscii == 0) {
+			count += blockSize;
+			ptr += blockSize;
+			continue;
+		}
+
+		const uint32_t geC0 = ge(0xC0);
+		const uint32_t geC2 = ge(0xC2);
+		const uint32_t geE0 = ge(0xE0);
+		const uint32_t geF0 = ge(0xF0);
+		const uint32_t geF5 = ge(0xF5);
+		const uint32_t trail = nonAscii & ~geC0;
+		const uint32_t lead2 = geC2 & ~geE0;
+		const uint32_t lead3 = geE0 & ~geF0;
+		const uint32_t lead4 = geF0 & ~geF5;
+		// stop before the sequence that doesn't end inside the block
+		const uint32_t straddle = (lead2 & 0x80000000U) | (lead3 & 0xC0000000U) | (lead4 & 0xE0000000U);
+		const uint32_t span = straddle ? np2::ctz(straddle) : blockSize;
+		const uint32_t keep = (span == blockSize) ? UINT32_MAX : ((1U << span) - 1);
+		// trail bytes expected by leads before the span, a sequence truncated by the span is invalid
+		const uint32_t lead34 = (lead3 | lead4) & keep;
+		const uint32_t expected = (((lead2 & keep) | lead34) << 1) | (lead34 << 2) | ((lead4 & keep) << 3);
+		uint32_t invalid = (expected ^ (trail & keep)) | (((geC0 & ~geC2) | geF5) & keep);
+		if (invalid == 0) {
+			const uint32_t ge90 = ge(0x90);
+			const uint32_t geA0 = ge(0xA0);
+			const uint32_t eqBF = eq(0xBF);
+			invalid = ((eq(0xE0) & ~(geA0 >> 1))	// overlong
+				| (eq(0xED) & (geA0 >> 1))				// surrogate
+				| (eq(0xEF) & ((eqBF | eq(0xB7)) >> 1))	// maybe non-character U+FDD0..U+FDEF, U+FFFE, U+FFFF
+				| (eq(0xF0) & ~(ge90 >> 1))				// overlong
+				| (eq(0xF4) & (ge90 >> 1))				// above U+10FFFF
+				| (lead4 & (eqBF >> 2))) & keep;		// maybe non-character *FFFE, *FFFF
+		}
+		if (invalid == 0) {
+			count += np2::popcount(~trail & keep);
+			countSupplementary += np2::popcount(lead4 & keep);
+			ptr += span;
+		} else {
+			const unsigned char * const end = ptr + span;
+			while (ptr < end) {
+				const int width = UTF8CharacterWidth(ptr);
+				count++;
+				countSupplementary += width >> 2;
+				ptr += width;
+			}
+		}
+	}
+#endif
+	while (ptr < last) {
+		const int width = UTF8CharacterWidth(ptr);
+		count++;
+		countSupplementary += width >> 2;
+		ptr += width;
+	}
+	return ptr;
+}
+
+}
+
+int CellBuffer::CharacterWidthUTF8(Sci::Position position) const noexcept {
+	unsigned char charBytes[UTF8MaxBytes];
+	for (int i = 0; i < UTF8MaxBytes; i++) {
+		charBytes[i] = substance.ValueAt(position + i);
+	}
+	return UTF8CharacterWidth(charBytes);
+}
+
+/**
+ * Count UTF-8 characters and characters outside the Base Multilingual Plane inside [start, end),
+ * start must be at character boundary, invalid byte is counted as a character.
+ * Returns position after last counted character, which may be up to 3 bytes after end.
+ */
+Sci::Position CellBuffer::CountCharactersUTF8(Sci::Position start, Sci::Position end, Sci::Position &count, Sci::Position &countSupplementary) const noexcept {
+	const SplitView cbView = AllView();
+	const Sci::Position length1 = cbView.length1;
+	Sci::Position pos = start;
+	while (pos < end) {
+		const bool first = pos < length1;
+		// character may cross the gap, bytes before the gap are counted one by one
+		const Sci::Position last = first ? std::min(end, length1 - UTF8MaxBytes) : end;
+		if (pos < last) {
+			const unsigned char * const segment = reinterpret_cast<const unsigned char *>(first ? cbView.segment1 : cbView.segment2);
+			pos = CountUTF8(segment + pos, segment + last, count, countSupplementary) - segment;
+		}
+		if (first) {
+			while (pos < end && pos < length1) {
+				const int width = CharacterWidthUTF8(pos);
+				count++;
+				countSupplementary += width >> 2;
+				pos += width;
+			}
+		}
+	}
+	return pos;
+}
+
+/**
+ * Move forward from position (at character boundary) over remaining characters (UTF-16 code units
+ * when utf16 is true), stops at end of document. remaining is set to count not moved over,
+ * which is negative when stopped after a supplementary character while only one code unit remains.
+ */
+Sci::Position CellBuffer::MoveCharactersUTF8(Sci::Position position, Sci::Position &remaining, bool utf16) const noexcept {
+	const Sci::Position length = Length();
+	// a character never has less bytes than UTF-16 code units, characters starting inside
+	// [position, position + remaining - UTF8MaxBytes) can be counted in bulk without overshoot.
+	while (remaining > UTF8MaxBytes && position < length) {
+		const Sci::Position end = std::min(position + remaining - UTF8MaxBytes, length);
+		Sci::Position count = 0;
+		Sci::Position countSupplementary = 0;
+		position = CountCharactersUTF8(position, end, count, countSupplementary);
+		remaining -= utf16 ? (count + countSupplementary) : count;
+	}
+	while (remaining > 0 && position < length) {
+		const int width = CharacterWidthUTF8(position);
+		remaining -= (utf16 && width == UTF8MaxBytes) ? 2 : 1;
+		position += width;
+	}
+	return position;
+}
+
 // The char* returned is to an allocation owned by the undo history
 const char *CellBuffer::InsertString(Sci::Position position, const char *s, Sci::Position insertLength, bool &startSequence) {
 	// InsertString and DeleteChars are the bottleneck though which all changes occur
@@ -502,10 +1056,34 @@ void SetBytes(char *data, char styleValue, Sci::Position length, ChangedRange &r
 	}
 }
 
+void MergeFillResult(ChangedRange &range, FillResult<Sci::Position> result) noexcept {
+	if (result.changed) {
+		if (range.Empty()) {
+			range.start = result.position;
+		}
+		range.end = result.position + result.fillLength;
+	}
+}
+
 }
 
-ChangedRange CellBuffer::SetStyles(Sci::Position position, Sci::Position lengthStyle, const char *styles) noexcept {
+ChangedRange CellBuffer::SetStyles(Sci::Position position, Sci::Position lengthStyle, const char *styles) {
 	ChangedRange range;
+	if (styleRuns) {
+		// fill each run of same style
+		const Sci::Position end = std::min(position + lengthStyle, styleRuns->Length());
+		while (position < end) {
+			const char value = *styles;
+			Sci::Position next = position + 1;
+			while (next < end && styles[next - position] == value) {
+				++next;
+			}
+			MergeFillResult(range, styleRuns->FillRange(position, value, next - position));
+			styles += next - position;
+			position = next;
+		}
+		return range;
+	}
 	Sci::Position range1Length = 0;
 	const Sci::Position part1Length = style.GapPosition();
 	char *data = style.Segment1Pointer(position);
@@ -525,8 +1103,15 @@ ChangedRange CellBuffer::SetStyles(Sci::Position position, Sci::Position lengthS
 	return range;
 }
 
-ChangedRange CellBuffer::SetStyleFor(Sci::Position position, Sci::Position lengthStyle, char styleValue) noexcept {
+ChangedRange CellBuffer::SetStyleFor(Sci::Position position, Sci::Position lengthStyle, char styleValue) {
 	ChangedRange range;
+	if (styleRuns) {
+		lengthStyle = std::min(lengthStyle, styleRuns->Length() - position);
+		if (lengthStyle > 0) {
+			MergeFillResult(range, styleRuns->FillRange(position, styleValue, lengthStyle));
+		}
+		return range;
+	}
 	Sci::Position range1Length = 0;
 	const Sci::Position part1Length = style.GapPosition();
 	char *data = style.Segment1Pointer(position);
@@ -573,18 +1158,73 @@ void CellBuffer::Allocate(Sci::Position newSize) {
 	//	throw std::runtime_error("CellBuffer::Allocate: size of standard document limited to 2G.");
 	//}
 	substance.ReAllocate(newSize);
-	if (hasStyles) {
+	if (hasStyles && !styleRuns) {
 		style.ReAllocate(newSize);
 	}
 }
 
+/**
+ * Take over text, styles and line starts of other buffer without copying the text,
+ * this buffer must be empty. Other buffer is left empty, with its undo history discarded.
+ */
+void CellBuffer::AdoptText(CellBuffer &other) {
+	PLATFORM_ASSERT(Length() == 0);
+	DiscardSnapshot();
+	other.DiscardSnapshot();
+	const Sci::Position length = other.Length();
+	std::swap(substance, other.substance);
+	if (hasStyles == other.hasStyles && runStyles == other.runStyles) {
+		std::swap(style, other.style);
+		std::swap(styleRuns, other.styleRuns);
+	} else {
+		if (styleRuns) {
+			styleRuns->InsertSpace(0, length);
+		} else if (hasStyles) {
+			style.InsertValue(0, length, 0);
+		}
+		other.style.DeleteAll();
+		if (other.styleRuns) {
+			other.styleRuns->DeleteAll();
+		}
+	}
+
+	const Sci::Line lines = other.plv->Lines();
+	if (utf8LineEnds == other.utf8LineEnds) {
+		plv->AllocateLines(lines);
+		plv->InsertText(0, length);
+		// copy line starts in blocks, without scanning the text
+		constexpr size_t PositionBlockSize = 256;
+		Sci::Position positions[PositionBlockSize];
+		Sci::Line lineInsert = 1;
+		while (lineInsert < lines) {
+			const size_t count = std::min<Sci::Line>(PositionBlockSize, lines - lineInsert);
+			for (size_t i = 0; i < count; i++) {
+				positions[i] = other.plv->LineStart(lineInsert + i);
+			}
+			plv->InsertLines(lineInsert, positions, count, true);
+			lineInsert += count;
+		}
+	} else {
+		ResetLineEnds();
+	}
+	other.plv->Init();
+	other.uh->DeleteUndoHistory();
+	other.changeHistory.reset();
+}
+
 bool CellBuffer::EnsureStyleBuffer(bool hasStyles_) {
 	if (hasStyles != hasStyles_) {
 		hasStyles = hasStyles_;
 		if (hasStyles_) {
-			style.InsertValue(0, substance.Length(), 0);
+			if (runStyles) {
+				styleRuns = std::make_unique<RunStyles<Sci::Position, char>>();
+				styleRuns->InsertSpace(0, substance.Length());
+			} else {
+				style.InsertValue(0, substance.Length(), 0);
+			}
 		} else {
 			style.DeleteAll();
+			styleRuns.reset();
 		}
 		return true;
 	}
@@ -593,10 +1233,9 @@ bool CellBuffer::EnsureStyleBuffer(bool hasStyles_) {
 
 void CellBuffer::SetLineEndTypes(LineEndType utf8LineEnds_) {
 	if (utf8LineEnds != utf8LineEnds_) {
-		const LineCharacterIndexType indexes = plv->LineCharacterIndex();
 		utf8LineEnds = utf8LineEnds_;
+		// index lines are kept in step by ResetLineEnds, widths are recalculated on demand
 		ResetLineEnds();
-		AllocateLineCharacterIndex(indexes);
 	}
 }
 
@@ -629,10 +1268,7 @@ LineCharacterIndexType CellBuffer::LineCharacterIndex() const noexcept {
 
 void CellBuffer::AllocateLineCharacterIndex(LineCharacterIndexType lineCharacterIndex) {
 	if (utf8Substance) {
-		if (plv->AllocateLineCharacterIndex(lineCharacterIndex, Lines())) {
-			// Changed so recalculate whole file
-			RecalculateIndexLineStarts(0, Lines() - 1);
-		}
+		plv->AllocateLineCharacterIndex(lineCharacterIndex, Lines());
 	}
 }
 
@@ -686,11 +1322,35 @@ Sci::Line CellBuffer::LineFromPosition(Sci::Position pos) const noexcept {
 	return plv->LineFromPosition(pos);
 }
 
+void CellBuffer::EnsureIndexLineStarts(Sci::Line line) const noexcept {
+	// calculate character widths of lines before line on demand
+	line = std::min(line, Lines());
+	Sci::Line lineValid = plv->IndexValidLines();
+	if (lineValid < line) {
+		Sci::Position posLineEnd = LineStart(lineValid);
+		do {
+			const Sci::Position posLineStart = posLineEnd;
+			posLineEnd = LineStart(lineValid + 1);
+			const CountWidths cw = CountCharacterWidthsRange(substance, posLineStart, posLineEnd - posLineStart);
+			plv->ValidateLineCharactersWidth(cw);
+			lineValid++;
+		} while (lineValid < line);
+	}
+}
+
 Sci::Position CellBuffer::IndexLineStart(Sci::Line line, LineCharacterIndexType lineCharacterIndex) const noexcept {
+	EnsureIndexLineStarts(line);
 	return plv->IndexLineStart(line, lineCharacterIndex);
 }
 
 Sci::Line CellBuffer::LineFromPositionIndex(Sci::Position pos, LineCharacterIndexType lineCharacterIndex) const noexcept {
+	constexpr Sci::Line IndexLineBlockSize = 1024;
+	const Sci::Line lines = Lines();
+	Sci::Line lineValid = plv->IndexValidLines();
+	while (lineValid < lines && plv->IndexLineStart(lineValid, lineCharacterIndex) <= pos) {
+		lineValid = std::min(lineValid + IndexLineBlockSize, lines);
+		EnsureIndexLineStarts(lineValid);
+	}
 	return plv->LineFromPositionIndex(pos, lineCharacterIndex);
 }
 
@@ -779,52 +1439,42 @@ void CellBuffer::ResetLineEnds() {
 	plv->Init();
 	plv->AllocateLines(lines);
 
-	constexpr Sci::Position position = 0;
 	const Sci::Position length = Length();
 	plv->InsertText(0, length);
 	Sci::Line lineInsert = 1;
 	constexpr bool atLineStart = true;
+	// collect line starts into block, then insert them in bulk
+	constexpr size_t PositionBlockSize = 256;
+	Sci::Position positions[PositionBlockSize];
+	size_t nPositions = 0;
+	const char * const text = substance.RangePointer(0, length);
 	unsigned char chBeforePrev = 0;
 	unsigned char chPrev = 0;
 	for (Sci::Position i = 0; i < length; i++) {
-		const unsigned char ch = substance[position + 1];
-		if (ch == '\r') {
-			InsertLine(lineInsert, (position + i) + 1, atLineStart);
-			lineInsert++;
-		} else if (ch == '\n') {
-			if (chPrev == '\r') {
-				// Patch up what was end of line
-				plv->SetLineStart(lineInsert - 1, (position + i) + 1);
-			} else {
-				InsertLine(lineInsert, (position + i) + 1, atLineStart);
-				lineInsert++;
+		unsigned char ch = text[i];
+		if (ch == '\r' || ch == '\n') {
+			if (ch == '\r' && i + 1 < length && text[i + 1] == '\n') {
+				i++;
+				ch = '\n';
+				chPrev = '\r';
 			}
+			positions[nPositions++] = i + 1;
 		} else if (utf8LineEnds != LineEndType::Default && !UTF8IsAscii(ch)) {
 			if (UTF8IsMultibyteLineEnd(chBeforePrev, chPrev, ch)) {
-				InsertLine(lineInsert, (position + i) + 1, atLineStart);
-				lineInsert++;
+				positions[nPositions++] = i + 1;
 			}
 		}
+		if (nPositions == PositionBlockSize) {
+			plv->InsertLines(lineInsert, positions, nPositions, atLineStart);
+			lineInsert += nPositions;
+			nPositions = 0;
+		}
 		chBeforePrev = chPrev;
 		chPrev = ch;
 	}
-}
-
-namespace {
-
-CountWidths CountCharacterWidthsUTF8(std::string_view sv) noexcept {
-	CountWidths cw;
-	size_t remaining = sv.length();
-	while (remaining > 0) {
-		const int utf8Status = UTF8Classify(sv);
-		const int lenChar = utf8Status & UTF8MaskWidth;
-		cw.CountChar(lenChar);
-		sv.remove_prefix(lenChar);
-		remaining -= lenChar;
+	if (nPositions != 0) {
+		plv->InsertLines(lineInsert, positions, nPositions, atLineStart);
 	}
-	return cw;
-}
-
 }
 
 bool CellBuffer::MaintainingLineCharacterIndex() const noexcept {
@@ -832,6 +1482,13 @@ bool CellBuffer::MaintainingLineCharacterIndex() const noexcept {
 }
 
 void CellBuffer::RecalculateIndexLineStarts(Sci::Line lineFirst, Sci::Line lineLast) {
+	if (lineFirst == 0 && lineLast != 0 && lineLast == Lines() - 1) {
+		// whole document, e.g. text added into empty document
+		plv->InvalidateLineCharacterIndex(0);
+		return;
+	}
+	// lines after valid lines are calculated on demand
+	lineLast = std::min(lineLast, plv->IndexValidLines() - 1);
 	std::string text;
 	Sci::Position posLineEnd = LineStart(lineFirst);
 	for (Sci::Line line = lineFirst; line <= lineLast; line++) {
@@ -850,6 +1507,7 @@ void CellBuffer::BasicInsertString(const Sci::Position position, const char * co
 	if (insertLength == 0)
 		return;
 	PLATFORM_ASSERT(insertLength > 0);
+	DiscardSnapshot();
 
 	const unsigned char chAfter = substance.ValueAt(position);
 	bool breakingUTF8LineEnd = false;
@@ -876,7 +1534,9 @@ void CellBuffer::BasicInsertString(const Sci::Position position, const char * co
 {
 	// const ElapsedPeriod period;
 	substance.InsertFromArray(position, s, insertLength);
-	if (hasStyles) {
+	if (styleRuns) {
+		styleRuns->InsertSpace(position, insertLength);
+	} else if (hasStyles) {
 		style.InsertValue(position, insertLength, 0);
 	}
 	// const double duration = period.Duration()*1e3;
@@ -886,12 +1546,29 @@ void CellBuffer::BasicInsertString(const Sci::Position position, const char * co
 	const bool atLineStart = plv->LineStart(lineInsert - 1) == position;
 	// Point all the lines after the insertion point further along in the buffer
 	plv->InsertText(lineInsert - 1, insertLength);
+	if (lineStartsHint) {
+		const Sci::Position * const positions = lineStartsHint;
+		const Sci::Line lines = lineStartsHintCount;
+		lineStartsHint = nullptr;
+		lineStartsHintCount = 0;
+		if (position == 0 && insertLength == substance.Length() && utf8LineEnds == LineEndType::Default) {
+			// line starts already found by application, e.g. on multiple threads
+			if (lines != 0) {
+				plv->InsertLines(lineInsert, positions, static_cast<size_t>(lines), atLineStart);
+			}
+			if (maintainingIndex) {
+				RecalculateIndexLineStarts(linePosition, lineInsert + lines - 1);
+			}
+			return;
+		}
+	}
 	unsigned char chBeforePrev = substance.ValueAt(position - 2);
 	unsigned char chPrev = substance.ValueAt(position - 1);
 	if (chPrev == '\r' && chAfter == '\n') {
 		// Splitting up a crlf pair at position
 		InsertLine(lineInsert, position, false);
 		lineInsert++;
+		simpleInsertion = false;
 	}
 	if (breakingUTF8LineEnd) {
 		RemoveLine(lineInsert);
@@ -911,12 +1588,15 @@ void CellBuffer::BasicInsertString(const Sci::Position position, const char * co
 	// s may not NULL-terminated, ensure *ptr == '\n' or *next == '\n' is valid.
 	const char * const end = s + insertLength - 1;
 	const char *ptr = s;
+	Sci::Line lineRecalculateStart = linePosition;
 
 	if (chPrev == '\r' && *ptr == '\n') {
 		++ptr;
 		// Patch up what was end of line
 		plv->SetLineStart(lineInsert - 1, (position + ptr - s));
 		simpleInsertion = false;
+		// previous line now ends with CR+LF
+		lineRecalculateStart = std::max<Sci::Line>(linePosition - 1, 0);
 	}
 
 	// set EditDetectEOLMode()
@@ -1159,6 +1839,48 @@ void CellBuffer::BasicInsertString(const Sci::Position position, const char * co
 #endif
 	// end NP2_USE_SSE2
 
+#elif NP2_USE_NEON
+	if (utf8LineEnds == LineEndType::Default && ptr + sizeof(uint8x16_t) <= end) {
+		const uint8x16_t vectCR = vdupq_n_u8('\r');
+		const uint8x16_t vectLF = vdupq_n_u8('\n');
+		do {
+			if (nPositions >= PositionBlockSize - sizeof(uint8x16_t)) {
+				plv->InsertLines(lineInsert, positions, nPositions, atLineStart);
+				lineInsert += nPositions;
+				nPositions = 0;
+			}
+
+			const uint8x16_t chunk = vld1q_u8(reinterpret_cast<const uint8_t *>(ptr));
+			uint64_t maskLF = neon_byte_mask(vceqq_u8(chunk, vectLF));
+			uint64_t maskCR = neon_byte_mask(vceqq_u8(chunk, vectCR));
+
+			if (maskCR) {
+				// same as SSE2 path, with 4 bits for each byte.
+				const uint64_t lastCR = maskCR >> 60;
+				maskCR <<= 4;
+				maskLF |= (((~maskLF) & maskCR) >> 4);
+				maskCR = lastCR;
+			}
+			if (maskLF) {
+				const Sci::Position offset = position + ptr - s + 1;
+				do {
+					positions[nPositions++] = offset + (np2::ctz(maskLF) >> 2);
+					maskLF &= maskLF - 1;
+				} while (maskLF);
+			}
+
+			ptr += sizeof(uint8x16_t);
+			if (maskCR) {
+				if (*ptr == '\n') {
+					// CR+LF across boundary
+					++ptr;
+				}
+				positions[nPositions++] = position + ptr - s;
+			}
+		} while (ptr + sizeof(uint8x16_t) <= end);
+	}
+	// end NP2_USE_NEON
+
 #else
 #if defined(__clang__) || defined(__GNUC__) || defined(__ICL) || !defined(_MSC_VER)
 	if (utf8LineEnds == LineEndType::Default) {
@@ -1253,8 +1975,8 @@ void CellBuffer::BasicInsertString(const Sci::Position position, const char * co
 				positions[nPositions++] = position + ptr - s;
 				break;
 			default:
-				// LS, PS and NEL
-				if ((ch == 0x85 && chPrev == 0xc2) || ((ch == 0xa8 || ch == 0xa9) && chPrev == 0x80 && chBeforePrev == 0xe2)) {
+				// LS, PS and NEL, ch may be any character when reached end of text
+				if (utf8LineEnds != LineEndType::Default && ((ch == 0x85 && chPrev == 0xc2) || ((ch == 0xa8 || ch == 0xa9) && chPrev == 0x80 && chBeforePrev == 0xe2))) {
 					if (nPositions == PositionBlockSize) {
 						plv->InsertLines(lineInsert, positions, nPositions, atLineStart);
 						lineInsert += nPositions;
@@ -1324,7 +2046,7 @@ void CellBuffer::BasicInsertString(const Sci::Position position, const char * co
 			const CountWidths cw = CountCharacterWidthsUTF8(std::string_view(s, insertLength));
 			plv->InsertCharacters(linePosition, cw);
 		} else {
-			RecalculateIndexLineStarts(linePosition, lineInsert - 1);
+			RecalculateIndexLineStarts(lineRecalculateStart, lineInsert - 1);
 		}
 	}
 }
@@ -1332,8 +2054,10 @@ void CellBuffer::BasicInsertString(const Sci::Position position, const char * co
 void CellBuffer::BasicDeleteChars(const Sci::Position position, const Sci::Position deleteLength) {
 	if (deleteLength == 0)
 		return;
+	DiscardSnapshot();
 
 	Sci::Line lineRecalculateStart = Sci::invalidPosition;
+	Sci::Line lineRecalculateEnd = Sci::invalidPosition;
 
 	if ((position == 0) && (deleteLength == substance.Length())) {
 		// If whole buffer is being deleted, faster to reinitialise lines data
@@ -1368,9 +2092,11 @@ void CellBuffer::BasicDeleteChars(const Sci::Position position, const Sci::Posit
 					plv->InsertCharacters(linePosition, -cw);
 				} else {
 					lineRecalculateStart = linePosition;
+					lineRecalculateEnd = linePosition;
 				}
 			} else {
 				lineRecalculateStart = linePosition;
+				lineRecalculateEnd = linePosition;
 			}
 		}
 
@@ -1380,6 +2106,10 @@ void CellBuffer::BasicDeleteChars(const Sci::Position position, const Sci::Posit
 			plv->SetLineStart(lineRemove, position);
 			lineRemove++;
 			ignoreNL = true; 	// First \n is not real deletion
+			if (lineRecalculateStart >= 0) {
+				// following line now starts with the LF
+				lineRecalculateEnd = linePosition + 1;
+			}
 		}
 		if (utf8LineEnds != LineEndType::Default && UTF8IsTrailByte(chNext)) {
 			if (UTF8LineEndOverlaps(position)) {
@@ -1419,13 +2149,20 @@ void CellBuffer::BasicDeleteChars(const Sci::Position position, const Sci::Posit
 			// Using lineRemove-1 as CR ended line before start of deletion
 			RemoveLine(lineRemove - 1);
 			plv->SetLineStart(lineRemove - 1, position + 1);
+			if (lineRecalculateStart >= 0) {
+				// line ended with CR joined with LF
+				lineRecalculateStart = lineRemove - 2;
+				lineRecalculateEnd = lineRemove - 1;
+			}
 		}
 	}
 	substance.DeleteRange(position, deleteLength);
 	if (lineRecalculateStart >= 0) {
-		RecalculateIndexLineStarts(lineRecalculateStart, lineRecalculateStart);
+		RecalculateIndexLineStarts(lineRecalculateStart, lineRecalculateEnd);
 	}
-	if (hasStyles) {
+	if (styleRuns) {
+		styleRuns->DeleteRange(position, deleteLength);
+	} else if (hasStyles) {
 		style.DeleteRange(position, deleteLength);
 	}
 }
@@ -1461,6 +2198,37 @@ void CellBuffer::DeleteUndoHistory() noexcept {
 	uh->DeleteUndoHistory();
 }
 
+void CellBuffer::SetUndoMemoryBudget(size_t budget) noexcept {
+	uh->SetMemoryBudget(budget);
+}
+
+size_t CellBuffer::UndoMemoryBudget() const noexcept {
+	return uh->MemoryBudget();
+}
+
+void CellBuffer::ReleaseUndoMemory() noexcept {
+	uh->ReleaseMemory();
+}
+
+size_t CellBuffer::MemoryUsed(Scintilla::MemoryUsage usage) const noexcept {
+	switch (usage) {
+	case Scintilla::MemoryUsage::Substance:
+		return substance.MemoryUsage();
+	case Scintilla::MemoryUsage::Style:
+		return styleRuns ? (sizeof(*styleRuns) + styleRuns->MemoryUsage()) : style.MemoryUsage();
+	case Scintilla::MemoryUsage::LineIndex:
+		return plv->MemoryUsage(false);
+	case Scintilla::MemoryUsage::CharacterIndex:
+		return plv->MemoryUsage(true);
+	case Scintilla::MemoryUsage::Undo:
+		return uh->MemoryUsage();
+	case Scintilla::MemoryUsage::ChangeHistory:
+		return changeHistory ? (sizeof(ChangeHistory) + changeHistory->MemoryUsage()) : 0;
+	default:
+		return 0;
+	}
+}
+
 bool CellBuffer::CanUndo() const noexcept {
 	return uh->CanUndo();
 }
@@ -1475,6 +2243,10 @@ Action CellBuffer::GetUndoStep() const noexcept {
 
 void CellBuffer::PerformUndoStep() {
 	const Action previousStep = uh->GetUndoStep();
+	if (previousStep.at == ActionType::remove && previousStep.lenData != 0 && previousStep.data == nullptr) {
+		throw std::runtime_error(
+			"CellBuffer::PerformUndoStep: text of the step can not be read.");
+	}
 	// PreviousBeforeSavePoint and AfterDetachPoint are called since acting on the previous action,
 	// that is currentAction-1
 	if (changeHistory && uh->PreviousBeforeSavePoint()) {
@@ -1513,6 +2285,10 @@ Action CellBuffer::GetRedoStep() const noexcept {
 
 void CellBuffer::PerformRedoStep() {
 	const Action actionStep = uh->GetRedoStep();
+	if (actionStep.at == ActionType::insert && actionStep.lenData != 0 && actionStep.data == nullptr) {
+		throw std::runtime_error(
+			"CellBuffer::PerformRedoStep: text of the step can not be read.");
+	}
 	if (actionStep.at == ActionType::insert) {
 		BasicInsertString(actionStep.position, actionStep.data, actionStep.lenData);
 		if (changeHistory) {
@@ -1659,6 +2435,10 @@ void CellBuffer::ChangeLastUndoActionText(size_t length, const char *text) {
 	uh->ChangeLastUndoActionText(length, text);
 }
 
+void CellBuffer::SetUndoTransform(int action) noexcept {
+	uh->SetTransform(action);
+}
+
 void CellBuffer::ChangeHistorySet(bool set) {
 	if (set) {
 		if (!changeHistory && !uh->CanUndo()) {
@@ -8,6 +8,10 @@
 
 #define InsertString_WithoutPerLine		1023
 
+namespace Scintilla {
+class IDocumentSnapshot;
+}
+
 namespace Scintilla::Internal {
 
 struct Failure : public std::runtime_error {
@@ -15,6 +19,9 @@ struct Failure : public std::runtime_error {
 	Failure(Status status_) : std::runtime_error("failure with status"), status(status_) {}
 };
 
+template <typename DISTANCE, typename STYLE>
+class RunStyles;
+
 // Interface to per-line data that wants to see each line insertion and deletion
 class PerLine {
 public:
@@ -28,6 +35,7 @@ public:
 
 class UndoHistory;
 class ChangeHistory;
+class TextSnapshot;
 
 /**
  * The line vector contains information about each of the lines in a cell buffer.
@@ -45,6 +53,7 @@ struct Action {
 	Sci::Position position = 0;
 	const char *data = nullptr;
 	Sci::Position lenData = 0;
+	bool transform = false;
 };
 
 struct SplitView {
@@ -82,6 +91,90 @@ struct ChangedRange {
 	}
 };
 
+/**
+ * Storage of SplitVector for text and styles. When using virtual memory (for large document),
+ * address space is reserved up front and pages are committed as the buffer grows,
+ * so appending to a huge document neither copies the buffer nor needs twice the memory.
+ */
+class TextStorage {
+	char *ptr = nullptr;
+	size_t length = 0;
+	size_t committed = 0;
+	size_t reserved = 0;	// size of reserved address space, zero for heap allocation
+	bool virtualMemory = false;
+	void Release() noexcept;
+	void SwapBuffer(TextStorage &other) noexcept {
+		std::swap(ptr, other.ptr);
+		std::swap(length, other.length);
+		std::swap(committed, other.committed);
+		std::swap(reserved, other.reserved);
+	}
+public:
+	TextStorage() noexcept = default;
+	TextStorage(const TextStorage &) = delete;
+	TextStorage(TextStorage &&other) noexcept : virtualMemory{other.virtualMemory} {
+		SwapBuffer(other);
+	}
+	TextStorage &operator=(const TextStorage &) = delete;
+	TextStorage &operator=(TextStorage &&other) noexcept {
+		SwapBuffer(other);
+		return *this;
+	}
+	~TextStorage() noexcept {
+		Release();
+	}
+
+	void UseVirtualMemory([[maybe_unused]] bool useVirtual) noexcept {
+#if defined(_WIN64)
+		virtualMemory = useVirtual;
+#endif
+	}
+	bool CanGrowInPlace(size_t newSize) const noexcept {
+		// reserve() commits pages in place, rarely copies when reserved address space is exhausted
+		return virtualMemory || newSize <= committed;
+	}
+
+	char *data() noexcept {
+		return ptr;
+	}
+	const char *data() const noexcept {
+		return ptr;
+	}
+	char &operator[](size_t index) noexcept {
+		return ptr[index];
+	}
+	const char &operator[](size_t index) const noexcept {
+		return ptr[index];
+	}
+	size_t size() const noexcept {
+		return length;
+	}
+	size_t capacity() const noexcept {
+		return committed;
+	}
+	void reserve(size_t newSize);
+	void resize(size_t newSize) {
+		// like default_init_allocator, new elements are not initialized
+		reserve(newSize);
+		length = newSize;
+	}
+	void clear() noexcept {
+		length = 0;
+	}
+	void shrink_to_fit() noexcept {
+		if (length == 0) {
+			Release();
+		}
+	}
+	void swap(TextStorage &other) noexcept {
+		SwapBuffer(other);
+	}
+};
+
+inline bool CanGrowInPlace(const TextStorage &body, size_t newSize) noexcept {
+	return body.CanGrowInPlace(newSize);
+}
+
 /**
  * Holder for an expandable array of characters that supports undo and line markers.
  * Based on article "Data Structures in a Bit-Mapped Text Editor"
@@ -91,11 +184,14 @@ class CellBuffer {
 private:
 	bool hasStyles;
 	const bool largeDocument;
+	const bool runStyles;
 	bool readOnly;
 	bool utf8Substance;
 	Scintilla::LineEndType utf8LineEnds;
-	SplitVector<char> substance;
-	SplitVector<char> style;
+	SplitVector<char, TextStorage> substance;
+	SplitVector<char, TextStorage> style;
+	// run-length style storage used instead of style when runStyles is set
+	std::unique_ptr<RunStyles<Sci::Position, char>> styleRuns;
 
 	bool collectingUndo;
 	const std::unique_ptr<UndoHistory> uh;
@@ -104,17 +200,27 @@ private:
 
 	const std::unique_ptr<ILineVector> plv;
 
+	const Sci::Position *lineStartsHint;
+	Sci::Line lineStartsHintCount;
+
+	// latest snapshot, reused until text changed
+	TextSnapshot *snapshot;
+	// snapshots of text ranges, marked stale together with snapshot
+	std::vector<TextSnapshot *> rangeSnapshots;
+	void DiscardSnapshot() noexcept;
+
 	bool UTF8LineEndOverlaps(Sci::Position position) const noexcept;
 	bool UTF8IsCharacterBoundary(Sci::Position position) const noexcept;
 	void ResetLineEnds();
 	void RecalculateIndexLineStarts(Sci::Line lineFirst, Sci::Line lineLast);
+	void EnsureIndexLineStarts(Sci::Line line) const noexcept;
 	bool MaintainingLineCharacterIndex() const noexcept;
 	/// Actions without undo
 	void BasicInsertString(Sci::Position position, const char *s, Sci::Position insertLength);
 	void BasicDeleteChars(Sci::Position position, Sci::Position deleteLength);
 
 public:
-	CellBuffer(bool hasStyles_, bool largeDocument_);
+	CellBuffer(bool hasStyles_, bool largeDocument_, bool runStyles_);
 	// Deleted so CellBuffer objects can not be copied.
 	CellBuffer(const CellBuffer &) = delete;
 	CellBuffer(CellBuffer &&) = delete;
@@ -132,14 +238,19 @@ public:
 	void GetStyleRange(unsigned char *buffer, Sci::Position position, Sci::Position lengthRetrieve) const noexcept;
 	const char *BufferPointer() noexcept;
 	const char *RangePointer(Sci::Position position, Sci::Position rangeLength) noexcept;
+	const char *ContiguousRangePointer(Sci::Position position, Sci::Position rangeLength) const noexcept;
 	int CheckRange(const char *chars, const char *styles, Sci::Position position, Sci::Position rangeLength) const noexcept;
 	Sci::Position GapPosition() const noexcept;
 	SplitView AllView() const noexcept;
+	int CharacterWidthUTF8(Sci::Position position) const noexcept;
+	Sci::Position CountCharactersUTF8(Sci::Position start, Sci::Position end, Sci::Position &count, Sci::Position &countSupplementary) const noexcept;
+	Sci::Position MoveCharactersUTF8(Sci::Position position, Sci::Position &remaining, bool utf16) const noexcept;
 
 	Sci::Position Length() const noexcept {
 		return substance.Length();
 	}
 	void Allocate(Sci::Position newSize);
+	void AdoptText(CellBuffer &other);
 	bool EnsureStyleBuffer(bool hasStyles_);
 	void SetUTF8Substance(bool utf8Substance_) noexcept {
 		utf8Substance = utf8Substance_;
@@ -155,6 +266,10 @@ public:
 	void ReleaseLineCharacterIndex(Scintilla::LineCharacterIndexType lineCharacterIndex);
 	Sci::Line Lines() const noexcept;
 	void AllocateLines(Sci::Line lines);
+	void SetLineStartsHint(Sci::Line lines, const Sci::Position *lineStarts) noexcept {
+		lineStartsHintCount = lines;
+		lineStartsHint = lineStarts;
+	}
 	Sci::Position LineStart(Sci::Line line) const noexcept;
 	Sci::Position LineEnd(Sci::Line line) const noexcept;
 	Sci::Position IndexLineStart(Sci::Line line, Scintilla::LineCharacterIndexType lineCharacterIndex) const noexcept;
@@ -166,8 +281,8 @@ public:
 
 	/// Setting styles for positions outside the range of the buffer is safe and has no effect.
 	/// @return true if the style of a character is changed.
-	ChangedRange SetStyles(Sci::Position position, Sci::Position lengthStyle, const char *styles) noexcept;
-	ChangedRange SetStyleFor(Sci::Position position, Sci::Position lengthStyle, char styleValue) noexcept;
+	ChangedRange SetStyles(Sci::Position position, Sci::Position lengthStyle, const char *styles);
+	ChangedRange SetStyleFor(Sci::Position position, Sci::Position lengthStyle, char styleValue);
 
 	const char *DeleteChars(Sci::Position position, Sci::Position deleteLength, bool &startSequence);
 
@@ -183,6 +298,9 @@ public:
 	bool HasStyles() const noexcept {
 		return hasStyles;
 	}
+	bool HasStyleRuns() const noexcept {
+		return runStyles;
+	}
 
 	/// The save point is a marker in the undo stack where the container has stated that
 	/// the buffer was saved. Undo and redo can move over the save point.
@@ -204,6 +322,15 @@ public:
 	bool AfterUndoSequenceStart() const noexcept;
 	void AddUndoAction(Sci::Position token, bool mayCoalesce);
 	void DeleteUndoHistory() noexcept;
+	void SetUndoMemoryBudget(size_t budget) noexcept;
+	// Read only copy of text for other threads, caller should Release() it after use.
+	Scintilla::IDocumentSnapshot *CreateSnapshot();
+	// Same for text range [start, start + length), Text() points to text at start.
+	Scintilla::IDocumentSnapshot *CreateSnapshot(Sci::Position start, Sci::Position length);
+	size_t UndoMemoryBudget() const noexcept;
+	void ReleaseUndoMemory() noexcept;
+	/// Approximate bytes allocated for buffer, style, line index, undo or change history.
+	size_t MemoryUsed(Scintilla::MemoryUsage usage) const noexcept;
 
 	/// To perform an undo, StartUndo is called to retrieve the number of steps, then UndoStep is
 	/// called that many times. Similarly for redo.
@@ -230,6 +357,7 @@ public:
 	std::string_view UndoActionText(int action) const noexcept;
 	void PushUndoActionType(int type, Sci::Position position);
 	void ChangeLastUndoActionText(size_t length, const char *text);
+	void SetUndoTransform(int action) noexcept;
 
 	void ChangeHistorySet(bool set);
 	[[nodiscard]] int EditionAt(Sci::Position pos) const noexcept;
@@ -104,6 +104,10 @@ void ChangeStack::Check() const noexcept {
 #endif
 }
 
+size_t ChangeStack::MemoryUsage() const noexcept {
+	return steps.capacity() * sizeof(int) + changes.capacity() * sizeof(ChangeSpan);
+}
+
 void ChangeLog::Clear(Sci::Position length) {
 	changeStack.Clear();
 	insertEdition.DeleteAll();
@@ -122,9 +126,8 @@ void ChangeLog::DeleteRange(Sci::Position position, Sci::Position deleteLength)
 	const EditionSetOwned empty{};
 	const EditionSetOwned &editions = deleteEdition.ValueOr(position, empty);
 	if (editions) {
-		const EditionSet savedEditions = *editions;
+		EditionSetOwned reset = editions.Copy();
 		deleteEdition.DeleteRange(position, deleteLength);
-		EditionSetOwned reset = std::make_unique<EditionSet>(savedEditions);
 		deleteEdition.SetValueAt(position, std::move(reset));
 	} else {
 		deleteEdition.DeleteRange(position, deleteLength);
@@ -140,62 +143,93 @@ void ChangeLog::CollapseRange(Sci::Position position, Sci::Position deleteLength
 	const Sci::Position positionMax = position + deleteLength;
 	Sci::Position positionDeletion = position + 1;
 	while (positionDeletion <= positionMax) {
-		EditionSetOwned empty{};
-		const EditionSetOwned &editions = deleteEdition.ValueOr(positionDeletion, empty);
-		if (editions) {
-			for (const EditionCount &ec : *editions) {
+		const EditionSetOwned empty{};
+		if (deleteEdition.ValueOr(positionDeletion, empty)) {
+			// Extract before pushing as inline editions move when deleteEdition grows
+			const EditionSetOwned editions = deleteEdition.Extract(positionDeletion);
+			for (const EditionCount &ec : editions) {
 				PushDeletionAt(position, ec);
 			}
-			deleteEdition.SetValueAt(positionDeletion, std::move(empty));
 		}
 		positionDeletion = deleteEdition.PositionNext(positionDeletion);
 	}
 }
 
-namespace {
+EditionSetOwned EditionSetOwned::Copy() const {
+	EditionSetOwned copy(single);
+	if (multiple) {
+		copy.multiple = std::make_unique<EditionSet>(*multiple);
+	}
+	return copy;
+}
 
-// EditionSets have repeat counts on items so push and pop may just
-// manipulate the count field or may push/pop items.
+EditionSet EditionSetOwned::ToSet() const {
+	return EditionSet(begin(), end());
+}
 
-void EditionSetPush(EditionSet &set, EditionCount ec) {
-	if (set.empty() || (set.back().edition != ec.edition)) {
-		set.push_back(ec);
+void EditionSetOwned::Push(EditionCount ec) {
+	if (multiple) {
+		if (multiple->back().edition != ec.edition) {
+			multiple->push_back(ec);
+		} else {
+			multiple->back().count += ec.count;
+		}
+	} else if (single.count == 0) {
+		single = ec;
+	} else if (single.edition == ec.edition) {
+		single.count += ec.count;
 	} else {
-		set.back().count += ec.count;
+		multiple = std::make_unique<EditionSet>(EditionSet{single, ec});
+		single = {};
 	}
 }
 
-void EditionSetPop(EditionSet &set) noexcept {
-	if (set.back().count == 1) {
-		set.pop_back();
+void EditionSetOwned::PushFront(EditionCount ec) {
+	if (multiple) {
+		multiple->insert(multiple->begin(), ec);
+	} else if (single.count == 0) {
+		single = ec;
 	} else {
-		set.back().count--;
+		multiple = std::make_unique<EditionSet>(EditionSet{ec, single});
+		single = {};
 	}
 }
 
-int EditionSetCount(const EditionSet &set) noexcept {
+void EditionSetOwned::Pop() noexcept {
+	if (multiple) {
+		if (multiple->back().count == 1) {
+			multiple->pop_back();
+			if (multiple->size() == 1) {
+				single = multiple->front();
+				multiple.reset();
+			}
+		} else {
+			multiple->back().count--;
+		}
+	} else {
+		single.count--;
+	}
+}
+
+int EditionSetOwned::Count() const noexcept {
 	int count = 0;
-	for (const EditionCount &ec : set) {
+	for (const EditionCount &ec : *this) {
 		count += ec.count;
 	}
 	return count;
 }
 
-}
-
 void ChangeLog::Add(Sci::Position position, EditionCount ec, bool front) {
 	const EditionSetOwned empty{};
 	const EditionSetOwned &editions = deleteEdition.ValueOr(position, empty);
 	if (editions) {
 		if (front) {
-			const_cast<EditionSetOwned &>(editions)->insert(editions->begin(), ec);
+			const_cast<EditionSetOwned &>(editions).PushFront(ec);
 		} else {
-			EditionSetPush(*const_cast<EditionSetOwned &>(editions), ec);
+			const_cast<EditionSetOwned &>(editions).Push(ec);
 		}
 	} else {
-		EditionSetOwned editionSet = std::make_unique<EditionSet>();
-		editionSet->push_back(ec);
-		deleteEdition.SetValueAt(position, std::move(editionSet));
+		deleteEdition.SetValueAt(position, EditionSetOwned(ec));
 	}
 }
 
@@ -227,7 +261,7 @@ void ChangeLog::SaveRange(Sci::Position position, Sci::Position length) {
 		const EditionSetOwned empty{};
 		const EditionSetOwned &editions = deleteEdition.ValueOr(positionDeletion, empty);
 		if (editions) {
-			for (const EditionCount &ec : *editions) {
+			for (const EditionCount &ec : editions) {
 				changeStack.PushDeletion(positionDeletion, ec);
 			}
 		}
@@ -238,12 +272,10 @@ void ChangeLog::SaveRange(Sci::Position position, Sci::Position length) {
 void ChangeLog::PopDeletion(Sci::Position position, Sci::Position deleteLength) {
 	// Just performed InsertSpace(position, deleteLength) so *this* element in
 	// deleteEdition moved forward by deleteLength
-	EditionSetOwned eso = deleteEdition.Extract(position + deleteLength);
-	deleteEdition.SetValueAt(position, std::move(eso));
-	const EditionSetOwned empty{};
-	const EditionSetOwned &editions = deleteEdition.ValueOr(position, empty);
+	// Work on extracted editions as inline editions move when deleteEdition grows
+	EditionSetOwned editions = deleteEdition.Extract(position + deleteLength);
 	assert(editions);
-	EditionSetPop(*editions);
+	editions.Pop();
 	const int inserts = changeStack.PopStep();
 	for (int i = 0; i < inserts;) {
 		const ChangeSpan span = changeStack.PopSpan(inserts);
@@ -253,9 +285,9 @@ void ChangeLog::PopDeletion(Sci::Position position, Sci::Position deleteLength)
 			i++;
 		} else {
 			assert(editions);
-			assert(editions->back().edition == span.edition);
+			assert(editions.back().edition == span.edition);
 			for (int j = 0; j < span.count; j++) {
-				EditionSetPop(*editions);
+				editions.Pop();
 			}
 			// Iterating backwards (pop) through changeStack, reverse order of insertion
 			// and original deletion list.
@@ -265,9 +297,7 @@ void ChangeLog::PopDeletion(Sci::Position position, Sci::Position deleteLength)
 		}
 	}
 
-	if (editions->empty()) {
-		deleteEdition.SetValueAt(position, EditionSetOwned{});
-	}
+	deleteEdition.SetValueAt(position, std::move(editions));
 }
 
 void ChangeLog::SaveHistoryForDelete(Sci::Position position, Sci::Position deleteLength) {
@@ -301,7 +331,7 @@ void ChangeLog::SetSavePoint() {
 		const EditionSetOwned empty{};
 		const EditionSetOwned &editions = deleteEdition.ValueOr(positionDeletion, empty);
 		if (editions) {
-			for (EditionCount &ec : *editions) {
+			for (EditionCount &ec : const_cast<EditionSetOwned &>(editions)) {
 				if (ec.edition == changeModified) {
 					ec.edition = changeSaved;
 				}
@@ -322,13 +352,22 @@ size_t ChangeLog::DeletionCount(Sci::Position start, Sci::Position length) const
 		const EditionSetOwned empty{};
 		const EditionSetOwned &editions = deleteEdition.ValueOr(start, empty);
 		if (editions) {
-			count += EditionSetCount(*editions);
+			count += editions.Count();
 		}
 		start = deleteEdition.PositionNext(start);
 	}
 	return count;
 }
 
+size_t ChangeLog::MemoryUsage() const noexcept {
+	size_t usage = changeStack.MemoryUsage() + insertEdition.MemoryUsage() + deleteEdition.MemoryUsage();
+	const EditionSetOwned empty{};
+	for (Sci::Position element = 0; element < deleteEdition.Elements(); element++) {
+		usage += deleteEdition.ValueOr(deleteEdition.PositionOfElement(element), empty).MemoryUsage();
+	}
+	return usage;
+}
+
 void ChangeLog::Check() const noexcept {
 #ifndef NDEBUG
 	assert(insertEdition.Length() == deleteEdition.Length());
@@ -415,6 +454,14 @@ Sci::Position ChangeHistory::Length() const noexcept {
 	return changeLog.Length();
 }
 
+size_t ChangeHistory::MemoryUsage() const noexcept {
+	size_t usage = changeLog.MemoryUsage();
+	if (changeLogReversions) {
+		usage += sizeof(ChangeLog) + changeLogReversions->MemoryUsage();
+	}
+	return usage;
+}
+
 void ChangeHistory::SetEpoch(int epoch) noexcept {
 	historicEpoch = epoch;
 }
@@ -466,7 +513,7 @@ unsigned int ChangeHistory::EditionDeletesAt(Sci::Position pos) const noexcept {
 	const EditionSetOwned empty{};
 	const EditionSetOwned &editionSetDeletions = changeLog.deleteEdition.ValueOr(pos, empty);
 	if (editionSetDeletions) {
-		for (const EditionCount &ec : *editionSetDeletions) {
+		for (const EditionCount &ec : editionSetDeletions) {
 			editionSet = editionSet | (1u << (ec.edition-1));
 		}
 	}
@@ -500,10 +547,7 @@ size_t ChangeHistory::DeletionCount(Sci::Position start, Sci::Position length) c
 EditionSet ChangeHistory::DeletionsAt(Sci::Position pos) const {
 	const EditionSetOwned empty{};
 	const EditionSetOwned &editions = changeLog.deleteEdition.ValueOr(pos, empty);
-	if (editions) {
-		return *editions;
-	}
-	return {};
+	return editions.ToSet();
 }
 
 void ChangeHistory::Check() const noexcept {
@@ -39,7 +39,66 @@ struct EditionCount {
 
 // EditionSet is ordered from oldest to newest, its not really a set
 using EditionSet = std::vector<EditionCount>;
-using EditionSetOwned = std::unique_ptr<EditionSet>;
+
+// Deletions at one position of deleteEdition. Most positions only hold a single edition
+// which is stored inline, a vector is only allocated when there are multiple editions.
+// This avoids a heap allocation (about 64 bytes) for each deletion position.
+class EditionSetOwned {
+	EditionCount single {};
+	std::unique_ptr<EditionSet> multiple;
+public:
+	EditionSetOwned() noexcept = default;
+	explicit EditionSetOwned(EditionCount ec) noexcept : single{ec} {}
+	EditionSetOwned(const EditionSetOwned &) = delete;
+	EditionSetOwned(EditionSetOwned &&other) noexcept : single{other.single}, multiple{std::move(other.multiple)} {
+		other.single = {};
+	}
+	EditionSetOwned &operator=(const EditionSetOwned &) = delete;
+	EditionSetOwned &operator=(EditionSetOwned &&other) noexcept {
+		single = other.single;
+		multiple = std::move(other.multiple);
+		other.single = {};
+		return *this;
+	}
+	~EditionSetOwned() = default;
+
+	[[nodiscard]] bool empty() const noexcept {
+		return single.count == 0 && !multiple;
+	}
+	explicit operator bool() const noexcept {
+		return !empty();
+	}
+	// Only used by SparseVector to compare with the empty value.
+	bool operator==(const EditionSetOwned &other) const noexcept {
+		return empty() && other.empty();
+	}
+	const EditionCount *begin() const noexcept {
+		return multiple ? multiple->data() : &single;
+	}
+	const EditionCount *end() const noexcept {
+		return multiple ? (multiple->data() + multiple->size()) : (&single + (single.count ? 1 : 0));
+	}
+	EditionCount *begin() noexcept {
+		return multiple ? multiple->data() : &single;
+	}
+	EditionCount *end() noexcept {
+		return multiple ? (multiple->data() + multiple->size()) : (&single + (single.count ? 1 : 0));
+	}
+	[[nodiscard]] const EditionCount &back() const noexcept {
+		return multiple ? multiple->back() : single;
+	}
+	[[nodiscard]] EditionSetOwned Copy() const;
+	[[nodiscard]] EditionSet ToSet() const;
+	// Repeat counts on items so push and pop may just manipulate the count field
+	void Push(EditionCount ec);
+	void PushFront(EditionCount ec);
+	void Pop() noexcept;
+	[[nodiscard]] int Count() const noexcept;
+	// Bytes allocated outside of the object
+	[[nodiscard]] size_t MemoryUsage() const noexcept {
+		return multiple ? (sizeof(EditionSet) + multiple->capacity() * sizeof(EditionCount)) : 0;
+	}
+};
 
 class ChangeStack {
 	std::vector<int> steps;
@@ -52,6 +111,7 @@ public:
 	[[nodiscard]] int PopStep() noexcept;
 	[[nodiscard]] ChangeSpan PopSpan(int maxSteps) noexcept;
 	void SetSavePoint() noexcept;
+	[[nodiscard]] size_t MemoryUsage() const noexcept;
 	void Check() const noexcept;
 };
 
@@ -76,6 +136,7 @@ struct ChangeLog {
 
 	Sci::Position Length() const noexcept;
 	[[nodiscard]] size_t DeletionCount(Sci::Position start, Sci::Position length) const noexcept;
+	[[nodiscard]] size_t MemoryUsage() const noexcept;
 	void Check() const noexcept;
 };
 
@@ -112,6 +173,8 @@ public:
 	[[nodiscard]] unsigned int EditionDeletesAt(Sci::Position pos) const noexcept;
 	[[nodiscard]] Sci::Position EditionNextDelete(Sci::Position pos) const noexcept;
 
+	[[nodiscard]] size_t MemoryUsage() const noexcept;
+
 	// Testing - not used by Scintilla
 	[[nodiscard]] size_t DeletionCount(Sci::Position start, Sci::Position length) const noexcept;
 	EditionSet DeletionsAt(Sci::Position pos) const;
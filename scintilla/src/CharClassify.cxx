@@ -82,22 +82,31 @@ bool DBCSIsTrailByte(int codePage, unsigned char trail) noexcept {
 
 }
 
+namespace {
+
+void CopyASCIICharClasses(uint8_t *charClass, uint32_t count) noexcept {
+	for (uint32_t ch = 0; ch < count; ch++) {
+		charClass[ch] = static_cast<uint8_t>(CharClassify::ClassifyCharacter(ch));
+	}
+}
+
+}
+
 CharClassify::CharClassify() noexcept {
 	// SetDefaultCharClasses(true);
-	memcpy(charClass, classifyMap, 128);
+	CopyASCIICharClasses(charClass, 128);
 	memset(charClass + 128, static_cast<int>(CharacterClass::word), 128);
 }
 
 void CharClassify::SetDefaultCharClasses(bool includeWordClass) noexcept {
 	// Initialize all char classes to default values
 	unsigned offset = 32;
-	memcpy(charClass, classifyMap, offset);
 	CharacterClass cc = CharacterClass::punctuation;
 	if (includeWordClass) {
-		memcpy(charClass + offset, classifyMap + offset, 128 - offset);
 		offset = 128;
 		cc = CharacterClass::word;
 	}
+	CopyASCIICharClasses(charClass, offset);
 	memset(charClass + offset, static_cast<int>(cc), 256 - offset);
 	charClass[32] = static_cast<uint8_t>(CharacterClass::space);
 	charClass[127] = static_cast<uint8_t>(CharacterClass::space);
@@ -167,25 +176,6 @@ void ExpandRLE2(const DataType *begin, const DataType *end, ValueType (&buffer)[
 	assert(p == buffer + BufferSize);
 }
 
-template <typename DataType, typename ValueType, size_t BufferSize>
-void ExpandRLE3(const DataType *begin, const DataType *end, ValueType (&buffer)[BufferSize]) noexcept {
-	constexpr int ValueBit = 3;
-	constexpr DataType mask = (1 << ValueBit) - 1;
-	ValueType *p = buffer;
-
-	do {
-		DataType count = *begin;
-		const ValueType value = count & mask;
-		count >>= ValueBit;
-		assert(p + count <= buffer + BufferSize);
-		memset(p, value, count);
-		p += count;
-		++begin;
-	} while (begin != end);
-	// ensure full expanded
-	assert(p == buffer + BufferSize);
-}
-
 template <typename DataType, size_t DataSize, typename ValueType>
 void ExpandRLE3(const DataType (&data)[DataSize], ValueType *p, [[maybe_unused]] ValueType *end) noexcept {
 	constexpr int ValueBit = 3;
@@ -241,32 +231,6 @@ void ExpandRunBlock(const IndexType (&indexList)[IndexSize], const ValueType (&b
 	assert(p == buffer + BufferSize);
 }
 
-template <typename ValueType, size_t DataSize, size_t BufferSize>
-void ExpandRunBlock(const ValueType (&blockData)[DataSize], ValueType (&buffer)[BufferSize],
-	uint32_t indexOffset, uint32_t indexBit, uint32_t blockBit) noexcept {
-	const uint32_t indexMask = (1 << indexBit) - 1;
-	const uint32_t blockSize = 1 << blockBit;
-
-	ValueType *p = buffer;
-	const ValueType *begin = blockData + indexOffset;
-	const ValueType * const end = blockData + DataSize;
-	do {
-		uint32_t count = *begin;
-		const uint32_t index = (count & indexMask) << blockBit;
-		count >>= indexBit;
-		assert(index + blockSize <= indexOffset);
-		assert(count != 0);
-		do {
-			assert(p + blockSize <= buffer + BufferSize);
-			memcpy(p, blockData + index, blockSize);
-			p += blockSize;
-		} while (--count);
-		++begin;
-	} while (begin != end);
-	// ensure full expanded
-	assert(p == buffer + BufferSize);
-}
-
 template <typename IndexType, size_t IndexSize, typename ValueType, size_t DataSize, size_t BufferSize>
 void ExpandSkipBlock(const IndexType (&indexList)[IndexSize], const ValueType (&blockData)[DataSize], ValueType (&buffer)[BufferSize],
 	uint32_t indexBit, uint32_t blockBit, ValueType defaultValue = 0) noexcept {
@@ -283,63 +247,293 @@ void ExpandSkipBlock(const IndexType (&indexList)[IndexSize], const ValueType (&
 	}
 }
 
+}
+
 //++Autogenerated -- start of section automatically generated
 // Created with Python 3.15.0a5, Unicode 17.0.0
-const uint16_t CharClassifyRLE_BMP[] = {
-264, 122, 83, 58, 211, 50, 211, 34, 272, 74, 11, 18, 8, 34, 19, 10, 11, 26, 19, 10,
-27, 10, 187, 10, 251, 10, 3667, 34, 99, 114, 43, 58, 11, 10, 11, 138, 939, 10, 19, 16,
-35, 10, 11, 32, 18, 11, 10, 27, 8, 11, 8, 163, 8, 667, 10, 1115, 10, 1387, 8, 307,
-16, 11, 50, 331, 18, 16, 26, 8, 363, 10, 11, 10, 19, 10, 19, 10, 11, 64, 219, 32,
-35, 18, 136, 82, 91, 10, 8, 26, 595, 34, 819, 10, 67, 8, 10, 83, 10, 155, 18, 11,
-114, 16, 475, 16, 811, 112, 435, 34, 11, 16, 11, 18, 371, 16, 122, 8, 227, 16, 10, 8,
-91, 40, 195, 10, 59, 56, 603, 8, 1035, 18, 83, 10, 155, 8, 67, 16, 19, 16, 179, 8,
-59, 8, 11, 24, 35, 16, 75, 16, 19, 16, 35, 64, 11, 32, 19, 8, 43, 16, 99, 18,
-51, 18, 11, 10, 11, 16, 27, 8, 51, 32, 19, 16, 179, 8, 59, 8, 19, 8, 19, 8,
-19, 16, 11, 8, 43, 32, 19, 16, 27, 24, 11, 56, 35, 8, 11, 56, 131, 10, 80, 27,
-8, 75, 8, 27, 8, 179, 8, 59, 8, 19, 8, 43, 16, 83, 8, 27, 8, 27, 16, 11,
-120, 35, 16, 83, 18, 56, 59, 8, 27, 8, 67, 16, 19, 16, 179, 8, 59, 8, 19, 8,
-43, 16, 75, 16, 19, 16, 27, 56, 27, 32, 19, 8, 43, 16, 83, 10, 59, 80, 19, 8,
-51, 24, 27, 8, 35, 24, 19, 8, 11, 8, 19, 24, 19, 24, 27, 24, 99, 32, 43, 24,
-27, 8, 35, 16, 11, 48, 11, 112, 107, 66, 40, 107, 8, 27, 8, 187, 8, 131, 16, 75,
-8, 27, 8, 35, 56, 19, 8, 27, 8, 19, 16, 35, 16, 83, 56, 10, 59, 10, 35, 10,
-67, 8, 27, 8, 187, 8, 83, 8, 43, 16, 75, 8, 27, 8, 35, 56, 19, 40, 27, 8,
-35, 16, 83, 8, 27, 96, 107, 8, 27, 8, 411, 8, 27, 8, 43, 10, 32, 131, 16, 155,
-10, 51, 8, 27, 8, 147, 24, 195, 8, 75, 8, 11, 16, 59, 24, 11, 32, 51, 8, 11,
-8, 67, 48, 83, 16, 19, 10, 96, 467, 32, 10, 123, 10, 83, 18, 296, 19, 8, 11, 8,
-43, 8, 195, 8, 11, 8, 187, 16, 43, 8, 11, 8, 59, 8, 83, 16, 35, 256, 11, 186,
-19, 50, 163, 10, 11, 10, 11, 10, 11, 34, 83, 8, 291, 32, 163, 10, 147, 8, 291, 8,
-66, 11, 50, 8, 106, 296, 595, 50, 627, 18, 307, 8, 11, 40, 11, 16, 347, 10, 35, 2052,
-587, 8, 35, 16, 59, 8, 11, 8, 35, 16, 331, 8, 35, 16, 267, 8, 35, 16, 59, 8,
-11, 8, 35, 16, 123, 8, 459, 8, 35, 16, 539, 16, 27, 74, 163, 24, 131, 82, 48, 691,
-16, 51, 16, 10, 4963, 18, 139, 8, 211, 18, 24, 603, 26, 91, 56, 179, 72, 179, 18, 72,
-163, 96, 107, 8, 27, 8, 19, 96, 675, 26, 11, 34, 19, 16, 83, 48, 83, 48, 90, 27,
-8, 91, 48, 715, 56, 347, 40, 563, 80, 251, 8, 99, 32, 99, 32, 10, 24, 18, 323, 16,
-43, 88, 355, 32, 211, 48, 91, 24, 274, 227, 16, 18, 507, 8, 235, 16, 91, 48, 83, 48,
-58, 11, 50, 16, 371, 16, 99, 160, 619, 8, 18, 83, 138, 75, 98, 931, 64, 34, 451, 24,
-42, 83, 24, 395, 18, 91, 40, 347, 16, 27, 66, 64, 27, 10, 315, 40, 4275, 16, 51, 16,
-307, 16, 51, 16, 67, 8, 11, 8, 11, 8, 11, 8, 251, 16, 427, 8, 59, 10, 11, 26,
-27, 8, 59, 26, 35, 16, 51, 8, 26, 107, 26, 16, 27, 8, 59, 18, 136, 194, 17, 48,
-378, 136, 19, 16, 51, 42, 91, 42, 8, 107, 24, 274, 112, 267, 120, 18, 11, 34, 11, 18,
-83, 10, 11, 26, 43, 50, 11, 10, 11, 10, 11, 10, 35, 10, 91, 18, 35, 42, 43, 34,
-11, 10, 467, 18, 32, 5330, 176, 90, 168, 483, 626, 179, 5042, 243, 7938, 16, 1106, 1835, 50, 75,
-40, 34, 11, 18, 307, 8, 11, 40, 11, 16, 451, 56, 11, 10, 112, 195, 72, 59, 8, 59,
-8, 59, 8, 59, 8, 59, 8, 59, 8, 59, 8, 59, 8, 259, 378, 11, 370, 272, 210, 8,
-714, 96, 1714, 208, 130, 8, 34, 28, 202, 124, 10, 44, 18, 44, 26, 8, 692, 16, 20, 18,
-28, 10, 724, 10, 36, 40, 348, 8, 756, 8, 18, 36, 82, 260, 306, 72, 10, 132, 250, 8,
-84, 242, 68, 10, 124, 258, 84, 314, 124, 2562, 52740, 514, 65532, 65532, 46204, 24, 442, 72, 371, 18,
-2155, 26, 227, 160, 411, 10, 83, 10, 923, 50, 64, 186, 75, 18, 827, 18, 659, 160, 443, 34,
-11, 24, 51, 34, 48, 419, 34, 64, 563, 64, 18, 83, 48, 195, 26, 11, 10, 395, 18, 291,
-88, 10, 236, 24, 523, 106, 8, 91, 32, 18, 251, 8, 443, 72, 115, 16, 83, 16, 34, 187,
-26, 587, 192, 27, 18, 131, 18, 43, 80, 51, 16, 51, 16, 51, 72, 59, 8, 59, 8, 347,
-10, 115, 18, 32, 987, 10, 19, 16, 83, 48, 65532, 23852, 96, 188, 32, 396, 65528, 2088, 2932, 16,
-852, 304, 59, 96, 43, 40, 99, 10, 107, 8, 43, 8, 11, 8, 19, 8, 19, 8, 867, 266,
-2907, 146, 515, 18, 435, 66, 256, 99, 34, 131, 82, 48, 131, 282, 8, 154, 8, 34, 32, 43,
-8, 1083, 32, 122, 83, 58, 211, 50, 211, 90, 716, 24, 52, 16, 52, 16, 52, 16, 28, 24,
-58, 8, 58, 104, 18, 16,
+const uint8_t CharClassify::CharClassifyBMP[] = {
+// CharClassifyBMP index
+0, 1, 2, 3, 4, 5, 6, 6, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+7, 7, 8, 9, 7, 7, 7, 10, 11, 12, 7, 13, 7, 7, 7, 7, 14, 7, 7, 7,
+7, 15, 16, 7, 17, 18, 19, 20, 21, 7, 7, 22, 7, 7, 23, 24, 25, 7, 26, 7,
+7, 27, 7, 28, 7, 29, 30, 31, 32, 7, 7, 12, 7, 7, 7, 33, 34, 35, 36, 37,
+38, 39, 40, 41, 42, 43, 44, 45, 46, 43, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56,
+57, 58, 59, 60, 53, 7, 61, 62, 63, 64, 65, 66, 67, 68, 69, 4, 70, 71, 72, 4,
+73, 74, 75, 76, 77, 78, 79, 4, 7, 7, 80, 7, 81, 7, 82, 83, 84, 84, 84, 84,
+84, 84, 84, 84, 7, 7, 85, 7, 86, 87, 88, 7, 89, 7, 90, 91, 92, 7, 7, 93,
+94, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 95,
+96, 7, 7, 97, 98, 99, 100, 101, 7, 7, 102, 103, 104, 7, 7, 105, 7, 31, 7, 106,
+107, 108, 109, 110, 7, 111, 112, 113, 114, 7, 107, 115, 103, 116, 117, 118, 7, 7, 119, 120,
+7, 7, 7, 121, 7, 122, 123, 81, 31, 90, 124, 125, 7, 7, 7, 7, 7, 7, 7, 7,
+7, 7, 7, 7, 7, 7, 7, 7, 93, 7, 126, 117, 7, 127, 128, 129, 130, 131, 132, 133,
+134, 113, 135, 136, 137, 138, 139, 7, 140, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113,
+113, 113, 113, 113, 113, 113, 113, 113, 113, 141, 142, 7, 143, 113, 113, 144, 113, 113, 113, 113,
+113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 145, 146, 113, 113, 113,
+113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113,
+113, 113, 113, 113, 113, 113, 113, 147, 113, 113, 113, 113, 7, 7, 7, 7, 7, 7, 7, 148,
+7, 82, 7, 149, 150, 151, 151, 7, 113, 152, 153, 4, 154, 113, 113, 155, 113, 113, 113, 113,
+113, 113, 156, 130, 157, 158, 159, 84, 160, 161, 84, 162, 163, 164, 84, 84, 165, 84, 113, 166,
+132, 167, 168, 113, 167, 169, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 84, 84, 84, 84,
+84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+84, 84, 113, 113, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 170, 113, 171, 81,
+7, 7, 7, 7, 7, 7, 7, 7, 172, 118, 7, 173, 7, 7, 7, 174, 175, 176, 7, 7,
+177, 7, 178, 179, 7, 180, 7, 181, 7, 7, 182, 183, 7, 184, 185, 186, 7, 7, 187, 107,
+7, 150, 188, 189, 7, 7, 190, 191, 192, 193, 83, 194, 7, 7, 7, 195, 84, 84, 84, 84,
+84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+84, 84, 84, 84, 84, 196, 197, 198, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 84, 84, 84, 84, 84, 84, 84, 84,
+84, 84, 84, 199, 84, 84, 200, 4, 201, 202, 203, 7, 7, 204, 205, 7, 7, 7, 7, 7,
+7, 7, 7, 7, 7, 81, 206, 7, 207, 7, 208, 209, 92, 210, 211, 212, 7, 7, 7, 178,
+1, 213, 213, 214, 84, 215, 216, 217,
+// CharClassifyBMP values
+0, 0, 0, 0, 0, 1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32, 34, 34, 34,
+34, 34, 34, 34, 51, 51, 51, 51, 51, 34, 34, 34, 50, 51, 51, 51, 51, 51, 51, 51,
+51, 51, 51, 51, 51, 35, 34, 50, 50, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+51, 35, 34, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+32, 34, 34, 34, 34, 35, 2, 34, 34, 51, 50, 34, 50, 35, 51, 35, 51, 51, 51, 51,
+51, 51, 51, 51, 51, 51, 51, 35, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+51, 51, 51, 51, 51, 51, 51, 51, 51, 34, 34, 51, 51, 51, 51, 51, 51, 34, 34, 34,
+34, 34, 34, 34, 51, 51, 35, 34, 34, 34, 35, 35, 34, 34, 34, 34, 34, 34, 34, 34,
+51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 35, 51, 0, 51, 51, 50, 0, 0, 34, 35,
+51, 3, 3, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 48, 51, 51, 51, 51, 51, 51,
+51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 50,
+51, 51, 51, 51, 51, 50, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+51, 51, 51, 51, 51, 51, 51, 51, 48, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+51, 51, 51, 51, 51, 51, 51, 3, 48, 34, 34, 34, 51, 51, 51, 51, 35, 2, 32, 34,
+48, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+51, 51, 51, 50, 50, 35, 51, 50, 0, 0, 0, 0, 51, 51, 51, 51, 51, 51, 51, 51,
+51, 51, 51, 51, 51, 3, 0, 48, 51, 35, 2, 0, 0, 0, 0, 0, 0, 0, 0, 34,
+34, 34, 34, 34, 51, 51, 51, 51, 51, 35, 32, 34, 51, 51, 51, 51, 51, 34, 34, 51,
+51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 50, 51,
+51, 51, 3, 50, 51, 51, 51, 51, 35, 51, 51, 51, 51, 51, 51, 51, 51, 51, 35, 50,
+34, 34, 34, 34, 34, 34, 34, 0, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+51, 3, 48, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+51, 0, 0, 0, 0, 0, 0, 0, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 34,
+34, 3, 48, 34, 51, 51, 51, 51, 51, 51, 51, 0, 34, 34, 34, 34, 34, 34, 34, 2,
+51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 0, 2, 51, 51, 51, 51,
+51, 3, 0, 0, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 50, 51, 51, 51,
+0, 0, 0, 48, 51, 51, 51, 51, 51, 51, 34, 51, 51, 51, 51, 51, 50, 51, 51, 51,
+51, 51, 51, 51, 51, 51, 48, 51, 51, 51, 3, 48, 3, 48, 51, 51, 51, 51, 51, 51,
+51, 51, 51, 51, 3, 51, 51, 51, 3, 3, 0, 51, 51, 0, 51, 51, 51, 51, 3, 48,
+3, 48, 51, 3, 0, 0, 0, 48, 0, 0, 51, 48, 51, 51, 0, 51, 51, 51, 51, 51,
+51, 34, 51, 51, 51, 34, 35, 3, 48, 51, 48, 51, 51, 3, 0, 48, 3, 48, 51, 51,
+51, 51, 51, 51, 51, 51, 51, 51, 3, 51, 51, 51, 3, 51, 48, 3, 51, 0, 3, 51,
+51, 3, 0, 48, 3, 48, 51, 0, 48, 0, 0, 0, 48, 51, 3, 3, 0, 0, 0, 51,
+51, 51, 51, 51, 51, 51, 51, 2, 0, 0, 0, 0, 48, 51, 48, 51, 51, 51, 51, 48,
+51, 48, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 3, 51, 51, 51, 3, 51, 48, 51,
+51, 0, 51, 51, 51, 51, 51, 48, 51, 48, 51, 0, 3, 0, 0, 0, 0, 0, 0, 0,
+51, 51, 0, 51, 51, 51, 51, 51, 34, 0, 0, 0, 48, 51, 51, 51, 48, 51, 48, 51,
+51, 51, 3, 48, 3, 48, 51, 51, 51, 51, 51, 51, 51, 51, 3, 48, 3, 48, 51, 0,
+0, 0, 48, 51, 0, 0, 51, 48, 51, 51, 0, 51, 51, 51, 51, 51, 50, 51, 51, 51,
+0, 0, 0, 0, 0, 51, 48, 51, 51, 3, 0, 51, 3, 51, 51, 0, 48, 3, 3, 51,
+0, 48, 3, 0, 51, 3, 0, 51, 51, 51, 51, 51, 51, 0, 0, 51, 51, 3, 0, 51,
+3, 51, 51, 0, 3, 0, 0, 48, 0, 0, 0, 0, 0, 0, 0, 51, 51, 51, 51, 51,
+51, 35, 34, 34, 34, 2, 0, 0, 51, 51, 51, 51, 51, 51, 3, 51, 3, 51, 51, 51,
+51, 51, 51, 51, 51, 51, 51, 51, 3, 51, 51, 51, 51, 51, 51, 51, 51, 0, 51, 51,
+51, 51, 3, 51, 3, 51, 51, 0, 0, 0, 48, 3, 51, 3, 51, 0, 51, 51, 0, 51,
+51, 51, 51, 51, 0, 0, 0, 32, 51, 51, 51, 35, 51, 51, 50, 51, 51, 51, 3, 51,
+3, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 3, 51, 51, 51, 51, 51, 48, 51,
+51, 0, 51, 51, 51, 51, 3, 51, 3, 51, 51, 0, 0, 0, 48, 3, 0, 0, 51, 3,
+51, 51, 0, 51, 51, 51, 51, 51, 48, 51, 0, 0, 0, 0, 0, 0, 51, 51, 3, 51,
+3, 51, 51, 35, 0, 0, 51, 51, 51, 51, 51, 51, 51, 51, 0, 51, 51, 51, 51, 51,
+51, 51, 51, 51, 35, 51, 51, 51, 48, 51, 48, 51, 51, 51, 51, 51, 51, 51, 51, 3,
+0, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 48, 51, 51, 51, 51, 48, 0,
+51, 51, 51, 3, 0, 3, 0, 48, 51, 51, 3, 3, 51, 51, 51, 51, 0, 0, 0, 51,
+51, 51, 51, 51, 0, 51, 2, 0, 0, 0, 0, 0, 48, 51, 51, 51, 51, 51, 51, 51,
+51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+51, 3, 0, 32, 51, 51, 51, 51, 51, 51, 51, 35, 51, 51, 51, 51, 51, 34, 0, 0,
+48, 3, 3, 51, 51, 3, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 48, 48,
+51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 0, 51, 51, 3, 3, 51, 51, 51, 3,
+51, 51, 51, 51, 51, 0, 51, 51, 35, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+51, 34, 34, 34, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 50, 50, 50, 34, 34, 51,
+51, 51, 51, 51, 48, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+51, 51, 3, 0, 48, 51, 51, 51, 51, 51, 51, 51, 51, 51, 35, 51, 51, 51, 51, 51,
+51, 51, 51, 51, 48, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+51, 51, 3, 34, 34, 34, 34, 35, 34, 34, 2, 34, 34, 34, 34, 34, 34, 2, 0, 0,
+51, 51, 51, 51, 51, 34, 34, 34, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 34, 51, 51, 51, 48, 0, 0, 48, 0,
+51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+51, 35, 51, 51, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+51, 51, 51, 51, 3, 51, 51, 0, 51, 51, 51, 3, 3, 51, 51, 0, 51, 51, 51, 51,
+3, 51, 51, 0, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+3, 51, 51, 0, 51, 51, 51, 3, 3, 51, 51, 0, 51, 51, 51, 51, 51, 51, 51, 3,
+51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 3, 51, 51, 0, 51, 51, 51, 51,
+51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 3, 48, 51, 34, 34, 34, 34,
+50, 51, 51, 51, 51, 51, 51, 51, 51, 51, 3, 0, 51, 51, 51, 51, 51, 51, 51, 51,
+34, 34, 34, 34, 34, 0, 0, 0, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 0,
+51, 51, 51, 0, 50, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+51, 51, 51, 51, 51, 51, 35, 50, 51, 51, 51, 51, 51, 51, 51, 51, 48, 51, 51, 51,
+51, 51, 51, 51, 51, 51, 51, 51, 51, 35, 2, 0, 51, 51, 51, 51, 51, 35, 34, 51,
+51, 51, 51, 51, 3, 0, 0, 0, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 0,
+0, 0, 0, 48, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 35, 2, 0, 0, 0, 0,
+51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 0, 0, 0, 0, 0, 0, 51, 51, 51, 51,
+51, 51, 3, 51, 3, 51, 0, 0, 0, 0, 0, 0, 51, 51, 51, 51, 51, 51, 51, 51,
+51, 51, 34, 50, 34, 34, 51, 0, 51, 51, 51, 51, 51, 0, 0, 0, 51, 51, 51, 51,
+51, 0, 0, 0, 34, 34, 34, 34, 34, 50, 51, 48, 51, 51, 51, 51, 51, 0, 0, 0,
+51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 3, 0, 0, 0, 51, 51, 51, 51,
+51, 51, 51, 51, 51, 51, 51, 0, 0, 0, 0, 0, 51, 51, 51, 51, 51, 51, 51, 51,
+51, 51, 51, 51, 51, 51, 51, 3, 51, 51, 51, 51, 51, 51, 0, 0, 51, 51, 51, 51,
+51, 51, 0, 0, 2, 0, 34, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+51, 51, 51, 51, 51, 51, 51, 0, 51, 51, 3, 0, 0, 0, 0, 0, 51, 51, 51, 51,
+51, 51, 0, 0, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 0, 0, 0,
+51, 51, 51, 51, 51, 3, 0, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+34, 34, 34, 34, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 0, 34,
+51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 3, 48, 34, 34, 34, 50,
+34, 34, 34, 0, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+51, 51, 51, 51, 51, 51, 51, 0, 51, 51, 51, 51, 51, 51, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 51, 51, 51, 51, 51, 51, 3, 34, 51, 51, 51, 51, 51, 34, 34, 34,
+34, 34, 34, 34, 34, 50, 51, 51, 51, 51, 34, 34, 34, 34, 34, 34, 51, 51, 51, 51,
+51, 51, 51, 51, 51, 51, 0, 0, 0, 0, 34, 34, 51, 51, 51, 51, 51, 51, 51, 51,
+51, 51, 51, 51, 0, 32, 34, 34, 51, 51, 51, 51, 51, 0, 48, 51, 51, 51, 51, 51,
+51, 51, 51, 51, 34, 34, 34, 34, 0, 0, 0, 0, 51, 35, 51, 51, 51, 51, 51, 51,
+51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 3, 0, 0, 51, 51, 51, 0,
+51, 51, 51, 0, 51, 51, 51, 51, 48, 48, 48, 48, 51, 51, 51, 51, 51, 51, 51, 51,
+51, 51, 3, 51, 51, 51, 35, 35, 34, 51, 3, 51, 51, 51, 35, 34, 51, 51, 0, 51,
+51, 51, 32, 34, 51, 51, 51, 51, 51, 51, 35, 34, 0, 51, 3, 51, 51, 51, 35, 2,
+0, 0, 0, 0, 0, 0, 0, 0, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+17, 0, 0, 0, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+34, 34, 34, 34, 34, 34, 34, 2, 0, 0, 0, 0, 0, 0, 0, 0, 51, 0, 51, 51,
+51, 34, 34, 50, 51, 51, 51, 51, 51, 34, 34, 2, 51, 51, 51, 51, 51, 51, 3, 0,
+34, 0, 0, 0, 0, 0, 0, 0, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+51, 51, 51, 51, 3, 0, 0, 0, 0, 0, 0, 0, 34, 35, 34, 50, 34, 51, 51, 51,
+51, 51, 50, 34, 50, 51, 51, 34, 34, 34, 35, 35, 35, 51, 51, 50, 51, 51, 51, 51,
+51, 34, 51, 51, 34, 34, 50, 51, 51, 34, 34, 35, 51, 51, 51, 51, 51, 51, 51, 51,
+51, 51, 51, 51, 51, 34, 0, 0, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+34, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 34, 34, 34, 34, 34, 2, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+51, 51, 34, 34, 34, 34, 34, 34, 34, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+51, 51, 51, 51, 51, 51, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+34, 34, 0, 34, 34, 34, 34, 34, 51, 51, 35, 34, 34, 50, 51, 51, 51, 51, 0, 0,
+32, 34, 50, 34, 51, 51, 51, 51, 0, 0, 0, 48, 2, 0, 0, 0, 0, 0, 0, 48,
+51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 3, 0, 0, 0, 0, 51, 51, 51, 3,
+51, 51, 51, 3, 51, 51, 51, 3, 51, 51, 51, 3, 34, 34, 34, 34, 34, 34, 34, 50,
+34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+34, 34, 34, 0, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 32, 34, 34,
+34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 0, 0, 0, 0, 0, 0, 34, 34, 34, 34,
+34, 34, 34, 34, 34, 34, 34, 0, 0, 0, 0, 0, 32, 34, 66, 68, 34, 34, 34, 34,
+34, 34, 34, 34, 34, 34, 34, 34, 66, 68, 68, 68, 68, 68, 68, 68, 66, 68, 68, 34,
+68, 68, 36, 34, 64, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 4, 64, 36, 66, 68, 66, 68, 68, 68,
+68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+68, 68, 68, 68, 68, 36, 68, 68, 0, 0, 64, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 64, 68, 68, 68, 68, 68, 68, 68,
+68, 68, 68, 68, 68, 68, 68, 4, 34, 68, 68, 34, 34, 34, 34, 34, 34, 34, 34, 0,
+0, 0, 0, 32, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 34, 34, 34,
+34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 68, 68, 68, 68, 66, 68, 68, 68,
+68, 68, 68, 68, 34, 34, 34, 34, 34, 34, 34, 34, 66, 68, 68, 68, 68, 68, 68, 68,
+68, 68, 68, 68, 68, 68, 4, 0, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 2,
+0, 0, 0, 0, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 35, 34,
+51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 35, 51, 51,
+51, 51, 51, 50, 51, 51, 51, 51, 51, 51, 51, 51, 51, 34, 34, 34, 0, 0, 0, 0,
+34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 50, 51, 51, 51, 51, 34, 51, 51, 51,
+51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 35, 50, 51, 51,
+51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+51, 51, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 48, 51, 51, 51, 51, 51, 51, 51,
+51, 51, 51, 51, 34, 34, 3, 0, 51, 51, 51, 34, 34, 0, 0, 0, 51, 51, 51, 51,
+51, 51, 51, 51, 51, 51, 34, 34, 0, 0, 0, 0, 51, 51, 51, 0, 0, 0, 0, 34,
+51, 51, 51, 51, 51, 0, 0, 0, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+34, 50, 50, 51, 51, 51, 51, 51, 51, 51, 51, 34, 51, 51, 51, 51, 51, 51, 51, 51,
+51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 0, 0, 0, 0, 0, 32, 68, 68, 68, 68,
+68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 4, 0, 35, 34, 34, 34, 34, 34, 34, 48,
+51, 51, 51, 51, 51, 0, 0, 34, 51, 51, 51, 51, 51, 51, 51, 0, 51, 51, 51, 51,
+51, 0, 34, 34, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 35, 34, 51, 51, 51,
+51, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 48, 51, 34, 51, 51, 51, 51,
+51, 51, 51, 51, 34, 51, 51, 3, 0, 0, 0, 0, 48, 51, 51, 3, 48, 51, 51, 3,
+48, 51, 51, 3, 0, 0, 0, 0, 51, 51, 51, 3, 51, 51, 51, 3, 51, 51, 51, 51,
+51, 51, 51, 51, 51, 51, 51, 51, 51, 34, 0, 0, 51, 51, 51, 51, 51, 51, 51, 51,
+51, 51, 51, 51, 51, 35, 51, 0, 51, 51, 51, 51, 51, 0, 0, 0, 68, 68, 0, 0,
+0, 0, 0, 0, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 4, 0, 64, 68, 68,
+68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+68, 68, 0, 0, 68, 68, 68, 68, 68, 68, 68, 0, 68, 68, 68, 68, 68, 68, 68, 68,
+68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 0, 0, 0, 51, 51, 51, 3,
+0, 0, 0, 0, 0, 48, 51, 51, 0, 0, 48, 51, 51, 51, 51, 51, 35, 51, 51, 51,
+51, 51, 51, 3, 51, 51, 3, 3, 51, 48, 3, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 34, 34, 34, 34, 34, 34, 34,
+34, 34, 34, 34, 34, 34, 34, 34, 34, 50, 51, 51, 51, 51, 51, 51, 34, 34, 34, 34,
+34, 34, 34, 34, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+34, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 34, 34, 34, 34, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 51, 51, 51, 51, 51, 51, 34, 34,
+51, 51, 51, 51, 51, 51, 51, 51, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+34, 34, 34, 34, 34, 2, 34, 34, 34, 34, 34, 34, 34, 34, 34, 2, 34, 34, 0, 0,
+51, 51, 3, 51, 51, 51, 51, 51, 50, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+51, 35, 34, 34, 34, 34, 34, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 4, 0, 68, 68, 68,
+0, 68, 68, 68, 0, 68, 68, 68, 0, 68, 4, 0, 34, 34, 34, 2, 34, 34, 34, 2,
+0, 0, 0, 0, 0, 0, 34, 0,
 };
 
-}
-
 const uint8_t CharClassify::CharClassifyTable[] = {
 // CharClassifyTable index 1
 0, 8, 16, 24, 32, 40, 48, 56, 64, 72, 72, 72, 80, 88, 96, 96, 96, 104, 72, 72,
@@ -800,14 +994,9 @@ const uint8_t CharClassify::GraphemeBreakTable[] = {
 };
 //grapheme table--Autogenerated -- end of section automatically generated
 
-uint8_t CharClassify::classifyMap[0xffff + 1];
 uint8_t CharClassify::graphemeMap[0x4000];
 
 void CharClassify::InitUnicodeData() noexcept {
-	ExpandRLE3(std::begin(CharClassifyRLE_BMP), std::end(CharClassifyRLE_BMP), classifyMap);
-	classifyMap['\n'] = static_cast<uint8_t>(CharacterClass::newLine);
-	classifyMap['\r'] = static_cast<uint8_t>(CharacterClass::newLine);
-	classifyMap['_'] = static_cast<uint8_t>(CharacterClass::word);
 	ExpandRLE4(GraphemeBreakRLE_BMP, graphemeMap);
 }
 
@@ -815,218 +1004,360 @@ namespace {
 
 //dbcs++Autogenerated -- start of section automatically generated
 // Created with Python 3.15.0a5, Unicode 17.0.0
-const uint16_t CharClassifyRLE_CP932[] = {
-2568, 138, 36, 10, 44, 282, 8, 394, 60, 450, 11, 98, 536, 122, 83, 58, 211, 10, 19, 10,
-11, 8, 10, 211, 34, 692, 600, 508, 8, 188, 64, 195, 66, 283, 82, 84, 8, 52, 536, 267,
-122, 123, 8, 147, 36, 18, 27, 290, 244, 64, 66, 115, 552, 10, 8, 34, 11, 10, 8, 18,
-19, 18, 19, 10, 27, 10, 331, 8, 259, 10, 83, 10, 67, 10, 267, 10, 307, 536, 283, 8,
-27, 64, 67, 10, 59, 8, 42, 16, 83, 10, 363, 410, 72, 18, 536, 251, 186, 11, 56, 10,
-8, 250, 756, 536, 508, 8, 1004, 536, 508, 8, 1004, 536, 508, 8, 1004, 536, 508, 8, 1004, 536,
-508, 8, 1004, 536, 508, 8, 1004, 536, 508, 8, 1004, 536, 508, 8, 1004, 536, 508, 8, 1004, 536,
-508, 8, 1004, 536, 508, 8, 1004, 536, 508, 8, 1004, 536, 508, 8, 1004, 536, 508, 8, 1004, 536,
-508, 8, 1004, 536, 508, 8, 1004, 536, 508, 8, 1004, 536, 508, 8, 1004, 536, 508, 8, 1004, 536,
-508, 8, 1004, 536, 508, 8, 1004, 536, 508, 8, 1004, 536, 508, 8, 1004, 536, 508, 8, 1004, 65528,
-65528, 552, 508, 8, 1004, 536, 508, 8, 1004, 536, 508, 8, 1004, 536, 508, 8, 1004, 536, 508, 8,
-1004, 536, 508, 8, 1004, 536, 508, 8, 1004, 536, 508, 8, 1004, 536, 508, 8, 1004, 536, 508, 8,
-1004, 536, 508, 8, 1004, 536, 508, 8, 1004, 536, 508, 8, 1004, 536, 508, 8, 1004, 536, 508, 8,
-892, 83, 34, 536, 508, 8, 1004, 536, 508, 8, 1004, 536, 508, 8, 1004, 536, 508, 8, 1004, 536,
-508, 8, 1004, 536, 508, 8, 1004, 536, 508, 8, 1004, 536, 508, 8, 1004, 536, 508, 8, 1004, 536,
-508, 8, 1004, 536, 508, 8, 1004, 536, 163, 66, 284, 8, 1004, 536, 508, 8, 1004, 536, 508, 8,
-940, 6232,
+const uint8_t CharClassify_CP932[] = {
+// CharClassify_CP932 index
+0, 0, 0, 0, 0, 1, 2, 3, 0, 4, 5, 6, 0, 7, 8, 9, 0, 10, 11, 12,
+0, 13, 14, 15, 0, 16, 17, 18, 0, 19, 20, 21, 0, 7, 22, 21, 0, 7, 22, 21,
+0, 7, 22, 21, 0, 7, 22, 21, 0, 7, 22, 21, 0, 7, 22, 21, 0, 7, 22, 21,
+0, 7, 22, 21, 0, 7, 22, 21, 0, 7, 22, 21, 0, 7, 22, 21, 0, 7, 22, 21,
+0, 7, 22, 21, 0, 7, 22, 21, 0, 7, 22, 21, 0, 7, 22, 21, 0, 7, 22, 21,
+0, 7, 22, 21, 0, 7, 22, 21, 0, 7, 22, 21, 0, 7, 22, 21, 0, 7, 22, 21,
+0, 7, 22, 21, 0, 7, 22, 21, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 7, 22, 21, 0, 7, 22, 21, 0, 7, 22, 21, 0, 7, 22, 21,
+0, 7, 22, 21, 0, 7, 22, 21, 0, 7, 22, 21, 0, 7, 22, 21, 0, 7, 22, 21,
+0, 7, 22, 21, 0, 7, 22, 21, 0, 7, 22, 21, 0, 7, 22, 21, 0, 7, 22, 21,
+0, 7, 22, 23, 0, 7, 22, 21, 0, 7, 22, 21, 0, 7, 22, 21, 0, 7, 22, 21,
+0, 7, 22, 21, 0, 7, 22, 21, 0, 7, 22, 21, 0, 7, 22, 21, 0, 7, 22, 21,
+0, 7, 22, 21, 0, 7, 22, 21, 0, 24, 22, 21, 0, 7, 22, 21, 0, 7, 22, 6,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+// CharClassify_CP932 values
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32, 34, 34, 34, 34, 34, 34, 34,
+34, 68, 68, 66, 68, 68, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+34, 34, 34, 2, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+34, 34, 34, 34, 34, 34, 34, 34, 66, 68, 68, 68, 34, 34, 34, 34, 34, 34, 34, 34,
+34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+35, 34, 34, 34, 34, 34, 2, 0, 34, 34, 34, 34, 34, 34, 34, 50, 51, 51, 51, 51,
+35, 34, 34, 34, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 50, 35, 3,
+50, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 35, 34, 66, 68, 68, 68, 68,
+68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 4, 0,
+0, 0, 0, 0, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 4, 68, 68, 68, 68,
+68, 68, 68, 68, 68, 68, 68, 4, 0, 0, 0, 48, 51, 51, 51, 51, 51, 51, 51, 51,
+51, 51, 51, 35, 34, 34, 34, 50, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+51, 51, 51, 51, 51, 34, 34, 34, 34, 34, 68, 68, 68, 68, 68, 64, 68, 68, 4, 0,
+51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 35, 34, 34, 34,
+34, 34, 34, 34, 51, 51, 51, 51, 51, 51, 51, 3, 51, 51, 51, 51, 51, 51, 51, 51,
+51, 68, 68, 34, 51, 35, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+34, 34, 34, 66, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 4, 0,
+0, 0, 32, 34, 34, 34, 50, 51, 51, 51, 51, 51, 51, 3, 0, 0, 2, 34, 34, 35,
+32, 50, 35, 50, 35, 51, 35, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+51, 51, 51, 51, 51, 51, 51, 3, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+51, 51, 51, 51, 50, 51, 51, 51, 51, 35, 51, 51, 51, 51, 50, 51, 51, 51, 51, 51,
+51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 50, 51, 51, 51, 51, 51, 51, 51, 51,
+51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 3, 0, 51, 51, 51, 51, 51, 51, 51, 51,
+51, 51, 51, 51, 51, 51, 51, 51, 51, 3, 51, 3, 0, 0, 0, 48, 51, 51, 51, 35,
+51, 51, 51, 3, 34, 34, 2, 48, 51, 51, 51, 51, 35, 51, 51, 51, 51, 51, 51, 51,
+51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 35, 34, 34, 34, 34,
+34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+34, 0, 0, 0, 0, 32, 2, 0, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+51, 51, 51, 35, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 3, 0, 0, 0, 2,
+34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 66, 68, 68, 68, 68,
+68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+68, 68, 4, 0, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 52,
+51, 51, 51, 51, 35, 34, 2, 0, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 34, 34,
+34, 34, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 4,
 };
 
-const uint16_t CharClassifyRLE_CP936[] = {
-2560, 508, 8, 1020, 520, 508, 8, 1020, 520, 508, 8, 1020, 520, 508, 8, 1020, 520, 508, 8, 1020,
-520, 508, 8, 1020, 520, 508, 8, 1020, 520, 508, 8, 1020, 520, 508, 8, 1020, 520, 508, 8, 1020,
-520, 508, 8, 1020, 520, 508, 8, 1020, 520, 508, 8, 1020, 520, 508, 8, 1020, 520, 508, 8, 1020,
-520, 508, 8, 1020, 520, 508, 8, 1020, 520, 508, 8, 1020, 520, 508, 8, 1020, 520, 508, 8, 1020,
-520, 508, 8, 1020, 520, 508, 8, 1020, 520, 508, 8, 1020, 520, 508, 8, 1020, 520, 508, 8, 1020,
-520, 508, 8, 1020, 520, 508, 8, 1020, 520, 508, 8, 1020, 520, 508, 8, 1020, 520, 508, 8, 1020,
-520, 508, 8, 1020, 520, 508, 8, 1020, 520, 508, 8, 268, 8, 26, 19, 18, 12, 682, 520, 508,
-8, 268, 83, 52, 403, 116, 99, 20, 520, 508, 8, 268, 122, 83, 58, 211, 50, 211, 34, 520,
-508, 8, 1020, 520, 508, 8, 1020, 520, 508, 8, 268, 195, 68, 195, 60, 98, 20, 42, 12, 18,
-76, 520, 508, 8, 268, 267, 124, 267, 108, 520, 19, 490, 8, 178, 92, 219, 12, 19, 12, 11,
-500, 520, 76, 122, 12, 18, 12, 10, 36, 18, 44, 186, 8, 74, 220, 610, 124, 520, 508, 8,
-1020, 520, 508, 8, 1020, 520, 508, 8, 1020, 520, 508, 8, 1020, 520, 508, 8, 1020, 520, 508, 8,
-1020, 520, 508, 8, 1020, 520, 508, 8, 1020, 520, 508, 8, 1020, 520, 508, 8, 1020, 520, 508, 8,
-1020, 520, 508, 8, 1020, 520, 508, 8, 1020, 520, 508, 8, 1020, 520, 508, 8, 1020, 520, 508, 8,
-1020, 520, 508, 8, 1020, 520, 508, 8, 1020, 520, 508, 8, 1020, 520, 508, 8, 1020, 520, 508, 8,
-1020, 520, 508, 8, 1020, 520, 508, 8, 1020, 520, 508, 8, 1020, 520, 508, 8, 1020, 520, 508, 8,
-1020, 520, 508, 8, 1020, 520, 508, 8, 1020, 520, 508, 8, 1020, 520, 508, 8, 1020, 520, 508, 8,
-1020, 520, 508, 8, 1020, 520, 508, 8, 1020, 520, 508, 8, 1020, 520, 508, 8, 1020, 520, 508, 8,
-1020, 520, 508, 8, 1020, 520, 508, 8, 1020, 520, 508, 8, 1020, 520, 508, 8, 1020, 520, 508, 8,
-1020, 520, 508, 8, 1020, 520, 508, 8, 1020, 520, 508, 8, 1020, 520, 508, 8, 1020, 520, 508, 8,
-1020, 520, 508, 8, 1020, 520, 508, 8, 1020, 520, 508, 8, 1020, 520, 508, 8, 1020, 520, 508, 8,
-1020, 520, 508, 8, 1020, 520, 508, 8, 1020, 520, 508, 8, 1020, 520, 508, 8, 1020, 520, 508, 8,
-1020, 520, 508, 8, 1020, 520, 508, 8, 1020, 520, 508, 8, 1020, 520, 508, 8, 1020, 520, 508, 8,
-1020, 520, 508, 8, 1020, 520, 508, 8, 1020, 520, 508, 8, 1020, 520, 508, 8, 1020, 520, 508, 8,
-1020, 520, 508, 8, 1020, 520, 508, 8, 1020, 520, 508, 8, 1020, 520, 508, 8, 1020, 520, 508, 8,
-1020, 520, 508, 8, 1020, 520, 508, 8, 1020, 520, 508, 8, 1020, 520, 508, 8, 1020, 520, 508, 8,
-1020, 520, 508, 8, 1020, 520, 508, 8, 1020, 520, 508, 8, 1020, 520, 508, 8, 1020, 520, 508, 8,
-1020, 520, 508, 8, 1020, 520, 508, 8, 1020, 520, 508, 8, 1020, 520, 508, 8, 1020, 2056,
+const uint8_t CharClassify_CP936[] = {
+// CharClassify_CP936 index
+0, 0, 0, 0, 0, 1, 2, 1, 0, 1, 2, 1, 0, 1, 2, 1, 0, 1, 2, 1,
+0, 1, 2, 1, 0, 1, 2, 1, 0, 1, 2, 1, 0, 1, 2, 1, 0, 1, 2, 1,
+0, 1, 2, 1, 0, 1, 2, 1, 0, 1, 2, 1, 0, 1, 2, 1, 0, 1, 2, 1,
+0, 1, 2, 1, 0, 1, 2, 1, 0, 1, 2, 1, 0, 1, 2, 1, 0, 1, 2, 1,
+0, 1, 2, 1, 0, 1, 2, 1, 0, 1, 2, 1, 0, 1, 2, 1, 0, 1, 2, 1,
+0, 1, 2, 1, 0, 1, 2, 1, 0, 1, 2, 1, 0, 1, 2, 1, 0, 1, 2, 1,
+0, 1, 2, 1, 0, 1, 2, 1, 0, 1, 2, 1, 0, 1, 3, 4, 0, 1, 5, 6,
+0, 1, 7, 8, 0, 1, 2, 1, 0, 1, 2, 1, 0, 1, 9, 10, 0, 1, 11, 12,
+0, 13, 14, 15, 0, 16, 17, 18, 0, 1, 2, 1, 0, 1, 2, 1, 0, 1, 2, 1,
+0, 1, 2, 1, 0, 1, 2, 1, 0, 1, 2, 1, 0, 1, 2, 1, 0, 1, 2, 1,
+0, 1, 2, 1, 0, 1, 2, 1, 0, 1, 2, 1, 0, 1, 2, 1, 0, 1, 2, 1,
+0, 1, 2, 1, 0, 1, 2, 1, 0, 1, 2, 1, 0, 1, 2, 1, 0, 1, 2, 1,
+0, 1, 2, 1, 0, 1, 2, 1, 0, 1, 2, 1, 0, 1, 2, 1, 0, 1, 2, 1,
+0, 1, 2, 1, 0, 1, 2, 1, 0, 1, 2, 1, 0, 1, 2, 1, 0, 1, 2, 1,
+0, 1, 2, 1, 0, 1, 2, 1, 0, 1, 2, 1, 0, 1, 2, 1, 0, 1, 2, 1,
+0, 1, 2, 1, 0, 1, 2, 1, 0, 1, 2, 1, 0, 1, 2, 1, 0, 1, 2, 1,
+0, 1, 2, 1, 0, 1, 2, 1, 0, 1, 2, 1, 0, 1, 2, 1, 0, 1, 2, 1,
+0, 1, 2, 1, 0, 1, 2, 1, 0, 1, 2, 1, 0, 1, 2, 1, 0, 1, 2, 1,
+0, 1, 2, 1, 0, 1, 2, 1, 0, 1, 2, 1, 0, 1, 2, 1, 0, 1, 2, 1,
+0, 1, 2, 1, 0, 1, 2, 1, 0, 1, 2, 1, 0, 1, 2, 1, 0, 1, 2, 1,
+0, 1, 2, 1, 0, 1, 2, 1, 0, 1, 2, 1, 0, 1, 2, 1, 0, 1, 2, 1,
+0, 1, 2, 1, 0, 1, 2, 1, 0, 1, 2, 1, 0, 1, 2, 1, 0, 1, 2, 1,
+0, 1, 2, 1, 0, 1, 2, 1, 0, 1, 2, 1, 0, 1, 2, 1, 0, 1, 2, 1,
+0, 1, 2, 1, 0, 1, 2, 1, 0, 1, 2, 1, 0, 1, 2, 1, 0, 1, 2, 1,
+0, 1, 2, 1, 0, 1, 2, 1, 0, 1, 2, 1, 0, 1, 2, 1, 0, 1, 2, 1,
+0, 1, 2, 1, 0, 1, 2, 1, 0, 0, 0, 0,
+// CharClassify_CP936 values
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 68, 68, 68, 68, 68, 68, 68, 68,
+68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+68, 68, 68, 4, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 4, 34, 50, 35, 66, 34, 34, 34,
+34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 2,
+68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 52, 51, 51, 51,
+51, 67, 68, 68, 52, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+51, 51, 51, 51, 51, 51, 51, 51, 51, 67, 68, 68, 68, 68, 68, 68, 52, 51, 51, 51,
+51, 51, 67, 4, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+36, 34, 34, 34, 34, 34, 34, 34, 51, 51, 51, 51, 51, 34, 34, 34, 50, 51, 51, 51,
+51, 51, 51, 51, 51, 51, 51, 51, 51, 35, 34, 34, 50, 51, 51, 51, 51, 51, 51, 51,
+51, 51, 51, 51, 51, 35, 34, 2, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+68, 68, 68, 68, 52, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 67, 68, 68, 68,
+52, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 67, 68, 68, 68, 34, 34, 34, 34,
+34, 34, 68, 34, 34, 66, 34, 68, 68, 68, 68, 4, 68, 68, 68, 68, 68, 68, 68, 68,
+68, 68, 68, 68, 68, 68, 68, 68, 52, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+51, 51, 51, 51, 51, 68, 68, 68, 68, 68, 68, 68, 52, 51, 51, 51, 51, 51, 51, 51,
+51, 51, 51, 51, 51, 51, 51, 51, 51, 68, 68, 68, 68, 68, 68, 4, 51, 34, 34, 34,
+34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+34, 34, 34, 34, 34, 34, 34, 2, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 68,
+68, 68, 68, 68, 52, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 52, 67,
+67, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 4, 68, 68, 68, 68, 36, 34, 34, 34,
+34, 34, 34, 34, 36, 66, 66, 68, 36, 66, 68, 68, 34, 34, 34, 34, 34, 34, 34, 34,
+34, 34, 34, 2, 34, 34, 34, 34, 66, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+68, 68, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+68, 68, 68, 68, 68, 68, 68, 4,
 };
 
-const uint16_t CharClassifyRLE_CP949[] = {
-2568, 212, 48, 212, 48, 1012, 528, 212, 48, 212, 48, 1012, 528, 212, 48, 212, 48, 1012, 528, 212,
-48, 212, 48, 1012, 528, 212, 48, 212, 48, 1012, 528, 212, 48, 212, 48, 1012, 528, 212, 48, 212,
-48, 1012, 528, 212, 48, 212, 48, 1012, 528, 212, 48, 212, 48, 1012, 528, 212, 48, 212, 48, 1012,
-528, 212, 48, 212, 48, 1012, 528, 212, 48, 212, 48, 1012, 528, 212, 48, 212, 48, 1012, 528, 212,
-48, 212, 48, 1012, 528, 212, 48, 212, 48, 1012, 528, 212, 48, 212, 48, 1012, 528, 212, 48, 212,
-48, 1012, 528, 212, 48, 212, 48, 1012, 528, 212, 48, 212, 48, 1012, 528, 212, 48, 212, 48, 1012,
-528, 212, 48, 212, 48, 1012, 528, 212, 48, 212, 48, 1012, 528, 212, 48, 212, 48, 1012, 528, 212,
-48, 212, 48, 1012, 528, 212, 48, 212, 48, 1012, 528, 212, 48, 212, 48, 1012, 528, 212, 48, 212,
-48, 1012, 528, 212, 48, 212, 48, 1012, 528, 212, 48, 212, 48, 1012, 528, 212, 48, 212, 48, 1012,
-528, 212, 48, 212, 48, 1012, 528, 212, 48, 212, 48, 1012, 528, 212, 48, 212, 48, 260, 8, 58,
-8, 258, 11, 418, 528, 212, 48, 212, 48, 260, 50, 11, 66, 11, 442, 712, 212, 48, 212, 48,
-260, 122, 83, 58, 211, 50, 211, 34, 528, 212, 48, 212, 48, 1012, 528, 212, 48, 212, 48, 260,
-83, 40, 83, 56, 195, 64, 195, 576, 212, 48, 212, 48, 260, 546, 736, 212, 48, 212, 48, 260,
-26, 11, 418, 11, 178, 648, 212, 48, 212, 48, 260, 35, 8, 11, 8, 67, 8, 434, 195, 528,
-212, 48, 212, 48, 260, 131, 434, 195, 528, 212, 48, 212, 48, 924, 616, 212, 48, 212, 48, 948,
-592, 212, 48, 212, 48, 260, 267, 120, 267, 632, 212, 48, 212, 48, 260, 1280, 212, 48, 212, 48,
-260, 1280, 212, 48, 212, 48, 260, 1280, 212, 48, 212, 48, 1012, 528, 212, 48, 212, 48, 1012, 528,
-212, 48, 212, 48, 1012, 528, 212, 48, 212, 48, 1012, 528, 212, 48, 212, 48, 1012, 528, 212, 48,
-212, 48, 1012, 528, 212, 48, 212, 48, 1012, 528, 212, 48, 212, 48, 1012, 528, 212, 48, 212, 48,
-1012, 528, 212, 48, 212, 48, 1012, 528, 212, 48, 212, 48, 1012, 528, 212, 48, 212, 48, 1012, 528,
-212, 48, 212, 48, 1012, 528, 212, 48, 212, 48, 1012, 528, 212, 48, 212, 48, 1012, 528, 212, 48,
-212, 48, 1012, 528, 212, 48, 212, 48, 1012, 528, 212, 48, 212, 48, 1012, 528, 212, 48, 212, 48,
-1012, 528, 212, 48, 212, 48, 1012, 528, 212, 48, 212, 48, 1012, 528, 212, 48, 212, 48, 1012, 528,
-148, 624, 756, 1296, 756, 1296, 756, 1296, 756, 1296, 756, 1296, 756, 1296, 756, 1296, 756, 1296, 756, 1296,
-756, 1296, 756, 1296, 756, 1296, 756, 1296, 756, 1296, 756, 1296, 756, 1296, 756, 1296, 756, 1296, 756, 1296,
-756, 1296, 756, 1296, 756, 1296, 756, 1296, 756, 1296, 756, 1296, 756, 1296, 756, 1296, 756, 1296, 756, 1296,
-756, 1296, 756, 1296, 756, 1296, 756, 1296, 756, 1296, 756, 1296, 756, 1296, 756, 1296, 756, 1296, 756, 1296,
-756, 1296, 756, 1296, 756, 1296, 756, 1296, 756, 1296, 756, 1296, 756, 1296, 756, 1296, 756, 1296, 756, 1296,
-756, 1296, 756, 1296, 756, 1296, 756, 1296, 756, 1296, 756, 1296, 756, 1296, 756, 2056,
+const uint8_t CharClassify_CP949[] = {
+// CharClassify_CP949 index
+0, 0, 0, 0, 0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3,
+0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3,
+0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3,
+0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3,
+0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3,
+0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3,
+0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 4, 5, 0, 1, 6, 7,
+0, 1, 8, 9, 0, 1, 2, 3, 0, 1, 10, 11, 0, 1, 12, 13, 0, 1, 14, 15,
+0, 1, 16, 17, 0, 1, 18, 17, 0, 1, 2, 19, 0, 1, 2, 20, 0, 1, 21, 22,
+0, 1, 23, 0, 0, 1, 23, 0, 0, 1, 23, 0, 0, 1, 2, 3, 0, 1, 2, 3,
+0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3,
+0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3,
+0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3,
+0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3,
+0, 24, 25, 3, 0, 0, 25, 3, 0, 0, 25, 3, 0, 0, 25, 3, 0, 0, 25, 3,
+0, 0, 25, 3, 0, 0, 25, 3, 0, 0, 25, 3, 0, 0, 25, 3, 0, 0, 25, 3,
+0, 0, 25, 3, 0, 0, 25, 3, 0, 0, 25, 3, 0, 0, 25, 3, 0, 0, 25, 3,
+0, 0, 25, 3, 0, 0, 25, 3, 0, 0, 25, 3, 0, 0, 25, 3, 0, 0, 25, 3,
+0, 0, 25, 3, 0, 0, 25, 3, 0, 0, 25, 3, 0, 0, 25, 3, 0, 0, 25, 3,
+0, 0, 25, 3, 0, 0, 25, 3, 0, 0, 25, 3, 0, 0, 25, 3, 0, 0, 25, 3,
+0, 0, 25, 3, 0, 0, 25, 3, 0, 0, 25, 3, 0, 0, 25, 3, 0, 0, 25, 3,
+0, 0, 25, 3, 0, 0, 25, 3, 0, 0, 25, 3, 0, 0, 25, 3, 0, 0, 25, 3,
+0, 0, 25, 3, 0, 0, 25, 3, 0, 0, 25, 3, 0, 0, 25, 3, 0, 0, 25, 3,
+0, 0, 25, 3, 0, 0, 25, 3, 0, 0, 25, 3, 0, 0, 25, 3, 0, 0, 25, 3,
+0, 0, 25, 3, 0, 0, 25, 3, 0, 0, 25, 3, 0, 0, 25, 3, 0, 0, 25, 3,
+0, 0, 25, 3, 0, 0, 25, 3, 0, 0, 0, 0,
+// CharClassify_CP949 values
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 64, 68, 68, 68, 68, 68, 68, 68,
+68, 68, 68, 68, 68, 4, 0, 0, 64, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+68, 4, 0, 0, 64, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+68, 68, 68, 68, 68, 68, 68, 4, 64, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+68, 68, 68, 68, 4, 34, 34, 34, 2, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+34, 34, 34, 34, 34, 35, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 2, 64, 68, 68, 68, 68, 68, 68, 68,
+68, 68, 68, 68, 68, 68, 68, 68, 36, 34, 34, 50, 34, 34, 34, 34, 35, 34, 34, 34,
+34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+34, 34, 34, 34, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 64, 68, 68, 68,
+68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 36, 34, 34, 34, 34, 34, 34, 34,
+51, 51, 51, 51, 51, 34, 34, 34, 50, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+51, 35, 34, 34, 50, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 35, 34, 2,
+64, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 52, 51, 51, 51,
+51, 3, 0, 0, 51, 51, 51, 51, 51, 0, 0, 0, 48, 51, 51, 51, 51, 51, 51, 51,
+51, 51, 51, 51, 3, 0, 0, 0, 48, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+3, 0, 0, 0, 64, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+36, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 2, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 64, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+68, 68, 68, 68, 36, 34, 35, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 50, 34, 34, 34, 34, 34, 34, 34,
+34, 34, 34, 34, 0, 0, 0, 0, 0, 0, 0, 0, 64, 68, 68, 68, 68, 68, 68, 68,
+68, 68, 68, 68, 68, 68, 68, 68, 52, 51, 3, 3, 51, 51, 51, 51, 32, 34, 34, 34,
+34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+34, 34, 34, 50, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 3, 64, 68, 68, 68,
+68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 52, 51, 51, 51, 51, 51, 51, 51,
+35, 34, 34, 34, 34, 34, 34, 34, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 0, 0, 0, 0, 0, 0,
+68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+68, 68, 68, 68, 68, 68, 68, 4, 0, 0, 0, 0, 64, 68, 68, 68, 68, 68, 68, 68,
+68, 68, 68, 68, 68, 68, 68, 68, 52, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+51, 51, 51, 51, 51, 0, 0, 0, 0, 0, 0, 0, 48, 51, 51, 51, 51, 51, 51, 51,
+51, 51, 51, 51, 51, 51, 51, 51, 51, 0, 0, 0, 0, 0, 0, 0, 64, 68, 68, 68,
+68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 4, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 64, 68, 68, 68, 68, 68, 68, 68, 68, 4, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 64, 68, 68, 68,
+68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
 };
 
-const uint16_t CharClassifyRLE_CP950[] = {
-2560, 14340, 42, 12, 10, 20, 18, 20, 10, 12, 34, 12, 18, 99, 12, 11, 12, 211, 276, 19,
-12, 11, 12, 27, 18, 49828, 528, 498, 272, 290, 11, 458, 520, 202, 76, 234, 272, 114, 163, 100,
-387, 520, 419, 92, 272, 212, 10, 35, 268, 10, 236, 520, 508, 272, 756, 520, 508, 272, 756, 520,
-508, 272, 756, 520, 508, 272, 756, 520, 508, 272, 756, 520, 508, 272, 756, 520, 508, 272, 756, 520,
-508, 272, 756, 520, 508, 272, 756, 520, 508, 272, 756, 520, 508, 272, 756, 520, 508, 272, 756, 520,
-508, 272, 756, 520, 508, 272, 756, 520, 508, 272, 756, 520, 508, 272, 756, 520, 508, 272, 756, 520,
-508, 272, 756, 520, 508, 272, 756, 520, 508, 272, 756, 520, 508, 272, 756, 520, 508, 272, 756, 520,
-508, 272, 756, 520, 508, 272, 756, 520, 508, 272, 756, 520, 508, 272, 756, 520, 508, 272, 756, 520,
-508, 272, 756, 520, 508, 272, 756, 520, 508, 272, 756, 520, 508, 272, 756, 520, 508, 272, 756, 520,
-508, 272, 756, 520, 508, 272, 756, 520, 508, 272, 2180, 627, 524, 435, 34, 668, 298, 28, 83, 520,
-508, 272, 756, 520, 508, 272, 756, 520, 508, 272, 756, 520, 508, 272, 756, 520, 508, 272, 756, 520,
-508, 272, 756, 520, 508, 272, 756, 520, 508, 272, 756, 520, 508, 272, 756, 520, 508, 272, 756, 520,
-508, 272, 756, 520, 508, 272, 756, 520, 508, 272, 756, 520, 508, 272, 756, 520, 508, 272, 756, 520,
-508, 272, 756, 520, 508, 272, 756, 520, 508, 272, 756, 520, 508, 272, 756, 520, 508, 272, 756, 520,
-508, 272, 756, 520, 508, 272, 756, 520, 508, 272, 756, 520, 508, 272, 756, 520, 508, 272, 756, 520,
-508, 272, 756, 520, 508, 272, 756, 520, 508, 272, 756, 520, 508, 272, 756, 520, 508, 272, 756, 520,
-508, 272, 756, 520, 508, 272, 756, 520, 508, 272, 756, 520, 508, 272, 756, 520, 508, 272, 756, 520,
-508, 272, 756, 520, 508, 272, 756, 520, 508, 272, 756, 520, 508, 272, 756, 520, 508, 272, 756, 520,
-508, 272, 756, 520, 508, 272, 756, 520, 508, 272, 756, 520, 508, 272, 756, 520, 508, 272, 756, 520,
-508, 272, 756, 520, 508, 272, 756, 520, 508, 272, 756, 520, 508, 272, 484, 274, 10244, 2056,
+const uint8_t CharClassify_CP950[] = {
+// CharClassify_CP950 index
+0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 3, 1, 1, 1, 1, 1,
+1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 4, 0, 5, 6, 7, 0, 8, 9, 10,
+0, 11, 12, 13, 0, 4, 14, 4, 0, 4, 14, 4, 0, 4, 14, 4, 0, 4, 14, 4,
+0, 4, 14, 4, 0, 4, 14, 4, 0, 4, 14, 4, 0, 4, 14, 4, 0, 4, 14, 4,
+0, 4, 14, 4, 0, 4, 14, 4, 0, 4, 14, 4, 0, 4, 14, 4, 0, 4, 14, 4,
+0, 4, 14, 4, 0, 4, 14, 4, 0, 4, 14, 4, 0, 4, 14, 4, 0, 4, 14, 4,
+0, 4, 14, 4, 0, 4, 14, 4, 0, 4, 14, 4, 0, 4, 14, 4, 0, 4, 14, 4,
+0, 4, 14, 4, 0, 4, 14, 4, 0, 4, 14, 4, 0, 4, 14, 4, 0, 4, 14, 4,
+0, 4, 14, 4, 0, 4, 14, 4, 0, 4, 14, 4, 0, 4, 14, 4, 0, 4, 14, 4,
+0, 4, 14, 1, 1, 1, 15, 16, 1, 17, 1, 18, 0, 4, 14, 4, 0, 4, 14, 4,
+0, 4, 14, 4, 0, 4, 14, 4, 0, 4, 14, 4, 0, 4, 14, 4, 0, 4, 14, 4,
+0, 4, 14, 4, 0, 4, 14, 4, 0, 4, 14, 4, 0, 4, 14, 4, 0, 4, 14, 4,
+0, 4, 14, 4, 0, 4, 14, 4, 0, 4, 14, 4, 0, 4, 14, 4, 0, 4, 14, 4,
+0, 4, 14, 4, 0, 4, 14, 4, 0, 4, 14, 4, 0, 4, 14, 4, 0, 4, 14, 4,
+0, 4, 14, 4, 0, 4, 14, 4, 0, 4, 14, 4, 0, 4, 14, 4, 0, 4, 14, 4,
+0, 4, 14, 4, 0, 4, 14, 4, 0, 4, 14, 4, 0, 4, 14, 4, 0, 4, 14, 4,
+0, 4, 14, 4, 0, 4, 14, 4, 0, 4, 14, 4, 0, 4, 14, 4, 0, 4, 14, 4,
+0, 4, 14, 4, 0, 4, 14, 4, 0, 4, 14, 4, 0, 4, 14, 4, 0, 4, 14, 4,
+0, 4, 14, 4, 0, 4, 14, 4, 0, 4, 14, 4, 0, 4, 14, 4, 0, 4, 14, 4,
+0, 4, 14, 4, 0, 4, 14, 19, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+1, 1, 1, 1, 1, 1, 1, 4, 0, 0, 0, 0,
+// CharClassify_CP950 values
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 68, 68, 68, 68, 68, 68, 68, 68,
+68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+68, 68, 68, 68, 34, 34, 66, 66, 36, 66, 36, 36, 34, 66, 34, 51, 51, 51, 51, 51,
+51, 52, 52, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 67, 68, 68, 68, 68,
+68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 52, 67, 67, 51, 35, 66, 68, 68,
+68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 4,
+32, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 2, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 32, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+34, 34, 34, 34, 34, 34, 50, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 2, 34, 34, 34, 34,
+34, 34, 34, 34, 34, 34, 34, 34, 66, 68, 68, 68, 68, 34, 34, 34, 34, 34, 34, 34,
+34, 34, 34, 34, 34, 34, 34, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 32, 34, 34, 34, 34, 34, 34, 50, 51, 51, 51, 51, 51, 51, 51, 51,
+51, 67, 68, 68, 68, 68, 68, 52, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 3, 51, 51, 51, 51, 51, 51, 51, 51,
+51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 68, 68,
+68, 68, 68, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+64, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 36, 51, 51, 68, 68, 68, 68,
+68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 36, 68, 68, 68, 68, 68, 68, 68,
+68, 68, 68, 68, 68, 68, 68, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 64, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+68, 68, 68, 68, 52, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+51, 51, 51, 67, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 34, 34, 68, 68, 68, 68, 68, 68, 68,
+68, 68, 36, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+34, 68, 52, 51, 51, 51, 51, 3, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+68, 68, 36, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 66,
 };
 
-constexpr int CharClassify_CP1361IndexBit = 6;
-constexpr int CharClassify_CP1361BlockBit = 5;
-constexpr int CharClassify_CP1361Offset = 1216;
-
-const uint8_t CharClassify_CP1361Data[] = {
+const uint8_t CharClassify_CP1361[] = {
+// CharClassify_CP1361 index
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 2,
+0, 2, 2, 2, 0, 2, 2, 2, 0, 2, 2, 0, 0, 3, 4, 4, 0, 4, 4, 4,
+0, 4, 4, 4, 0, 4, 4, 0, 0, 3, 4, 4, 0, 4, 4, 4, 0, 4, 4, 4,
+0, 4, 4, 0, 0, 3, 4, 4, 0, 4, 4, 4, 0, 4, 4, 4, 0, 4, 4, 0,
+0, 3, 4, 4, 0, 4, 4, 4, 0, 4, 4, 4, 0, 4, 4, 0, 0, 3, 4, 4,
+0, 4, 4, 4, 0, 4, 4, 4, 0, 4, 4, 0, 0, 3, 4, 4, 0, 4, 4, 4,
+0, 4, 4, 4, 0, 4, 4, 0, 0, 3, 4, 4, 0, 4, 4, 4, 0, 4, 4, 4,
+0, 4, 4, 0, 0, 3, 4, 4, 0, 4, 4, 4, 0, 4, 4, 4, 0, 4, 4, 0,
+0, 3, 4, 4, 0, 4, 4, 4, 0, 4, 4, 4, 0, 4, 4, 0, 0, 3, 4, 4,
+0, 4, 4, 4, 0, 4, 4, 4, 0, 4, 4, 0, 0, 3, 4, 4, 0, 4, 4, 4,
+0, 4, 4, 4, 0, 4, 4, 0, 0, 3, 4, 4, 0, 4, 4, 4, 0, 4, 4, 4,
+0, 4, 4, 0, 0, 3, 4, 4, 0, 4, 4, 4, 0, 4, 4, 4, 0, 4, 4, 0,
+0, 3, 4, 4, 0, 4, 4, 4, 0, 4, 4, 4, 0, 4, 4, 0, 0, 3, 4, 4,
+0, 4, 4, 4, 0, 4, 4, 4, 0, 4, 4, 0, 0, 3, 4, 4, 0, 4, 4, 4,
+0, 4, 4, 4, 0, 4, 4, 0, 0, 3, 4, 4, 0, 4, 4, 4, 0, 4, 4, 4,
+0, 4, 4, 0, 0, 3, 4, 4, 0, 4, 4, 4, 0, 4, 4, 4, 0, 4, 4, 0,
+0, 3, 4, 4, 0, 4, 4, 4, 0, 4, 4, 4, 0, 4, 4, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 6, 7, 6, 8, 9, 10, 11,
+12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 5, 6, 28, 29,
+0, 0, 0, 0, 5, 6, 7, 6, 5, 6, 7, 6, 5, 6, 7, 6, 5, 6, 7, 6,
+5, 6, 7, 6, 5, 6, 7, 6, 5, 6, 7, 6, 5, 6, 7, 6, 5, 6, 7, 6,
+5, 6, 7, 6, 5, 6, 7, 6, 5, 6, 7, 6, 5, 6, 7, 6, 5, 6, 7, 6,
+5, 6, 7, 6, 5, 6, 7, 6, 5, 6, 7, 6, 5, 6, 7, 6, 5, 6, 7, 6,
+5, 6, 7, 6, 5, 6, 7, 6, 5, 6, 7, 6, 5, 6, 7, 6, 5, 6, 7, 6,
+5, 6, 7, 6, 5, 6, 7, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
 // CharClassify_CP1361 values
 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 4,
-4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 4, 4, 4, 4, 4, 4, 4, 4, 4,
-4, 4, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4,
-4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 4, 4, 4, 4, 4,
-4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
-4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
-4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
-4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
-4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-2, 2, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2,
-2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3,
-2, 2, 2, 2, 2, 2, 2, 2, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 2, 2,
-2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
-3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 2, 2, 2, 2, 2, 2, 3, 3, 3,
-3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
-3, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 68, 68, 68, 68, 68, 68, 68,
+68, 64, 68, 68, 68, 68, 68, 0, 64, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 64, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+64, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 64, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 64, 68, 68, 68, 68, 68, 68, 68,
+68, 64, 68, 68, 68, 68, 68, 0, 64, 68, 68, 68, 68, 68, 68, 68, 68, 64, 68, 68,
+68, 68, 68, 0, 64, 68, 68, 68, 68, 68, 68, 68, 68, 64, 68, 68, 68, 68, 68, 0,
 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4,
-4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0,
-3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3,
-3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
-3, 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
-3, 3, 3, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 64, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+68, 68, 68, 4, 0, 0, 0, 0, 0, 0, 0, 0, 64, 68, 68, 68, 68, 68, 68, 68,
+68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 0, 0, 0, 0,
 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 2, 2, 2, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 3, 3, 3, 3, 0, 3, 0, 3, 3, 3, 3, 3, 3, 3, 3,
-0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
-3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
-3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3,
-3, 3, 3, 0, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
-4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
-4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0,
+0, 34, 34, 34, 2, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+34, 35, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 2,
+0, 0, 0, 0, 0, 0, 0, 0, 32, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 50,
+34, 34, 34, 34, 35, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 0, 0, 0, 0, 0, 0, 0, 0,
 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0,
-0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
-3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0,
-0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
-3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
-3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-// CharClassify_CP1361 index
-192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 64, 65, 194, 130, 128, 194, 194, 128, 194,
-194, 128, 194, 66, 192, 64, 66, 195, 131, 128, 195, 195, 128, 195, 195, 128, 195, 67, 192, 64,
-66, 195, 131, 128, 195, 195, 128, 195, 195, 128, 195, 67, 192, 64, 66, 195, 131, 128, 195, 195,
-128, 195, 195, 128, 195, 67, 192, 64, 66, 195, 131, 128, 195, 195, 128, 195, 195, 128, 195, 67,
-192, 64, 66, 195, 131, 128, 195, 195, 128, 195, 195, 128, 195, 67, 192, 64, 66, 195, 131, 128,
-195, 195, 128, 195, 195, 128, 195, 67, 192, 64, 66, 195, 131, 128, 195, 195, 128, 195, 195, 128,
-195, 67, 192, 64, 66, 195, 131, 128, 195, 195, 128, 195, 195, 128, 195, 67, 192, 64, 66, 195,
-131, 128, 195, 195, 128, 195, 195, 128, 195, 67, 192, 64, 66, 195, 131, 128, 195, 195, 128, 195,
-195, 128, 195, 67, 192, 64, 66, 195, 131, 128, 195, 195, 128, 195, 195, 128, 195, 67, 192, 64,
-66, 195, 131, 128, 195, 195, 128, 195, 195, 128, 195, 67, 192, 64, 66, 195, 131, 128, 195, 195,
-128, 195, 195, 128, 195, 67, 192, 64, 66, 195, 131, 128, 195, 195, 128, 195, 195, 128, 195, 67,
-192, 64, 66, 195, 131, 128, 195, 195, 128, 195, 195, 128, 195, 67, 192, 64, 66, 195, 131, 128,
-195, 195, 128, 195, 195, 128, 195, 67, 192, 64, 66, 195, 131, 128, 195, 195, 128, 195, 195, 128,
-195, 67, 192, 64, 66, 195, 131, 128, 195, 195, 128, 195, 195, 128, 195, 67, 192, 64, 66, 195,
-131, 128, 195, 195, 128, 195, 195, 128, 195, 67, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192,
-192, 128, 68, 69, 70, 68, 133, 70, 64, 71, 72, 73, 74, 75, 76, 77, 64, 74, 78, 79,
-80, 81, 82, 70, 64, 83, 84, 85, 83, 86, 76, 87, 64, 88, 76, 89, 90, 91, 76, 92,
-64, 93, 94, 95, 93, 96, 69, 97, 64, 68, 69, 70, 98, 99, 100, 101, 192, 192, 192, 68,
-69, 70, 68, 133, 70, 64, 68, 69, 70, 68, 133, 70, 64, 68, 69, 70, 68, 133, 70, 64,
-68, 69, 70, 68, 133, 70, 64, 68, 69, 70, 68, 133, 70, 64, 68, 69, 70, 68, 133, 70,
-64, 68, 69, 70, 68, 133, 70, 64, 68, 69, 70, 68, 133, 70, 64, 68, 69, 70, 68, 133,
-70, 64, 68, 69, 70, 68, 133, 70, 64, 68, 69, 70, 68, 133, 70, 64, 68, 69, 70, 68,
-133, 70, 64, 68, 69, 70, 68, 133, 70, 64, 68, 69, 70, 68, 133, 70, 64, 68, 69, 70,
-68, 133, 70, 64, 68, 69, 70, 68, 133, 70, 64, 68, 69, 70, 68, 133, 70, 64, 68, 69,
-70, 68, 133, 70, 64, 68, 69, 70, 68, 133, 70, 64, 68, 69, 70, 68, 133, 70, 64, 68,
-69, 70, 68, 133, 70, 64, 68, 69, 70, 68, 133, 70, 64, 68, 69, 70, 68, 133, 70, 64,
-68, 69, 70, 68, 133, 70, 64, 68, 69, 70, 68, 133, 70, 64, 68, 69, 70, 68, 133, 70,
-192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192,
+0, 0, 0, 0, 0, 0, 0, 0, 32, 34, 34, 34, 34, 34, 34, 34, 51, 51, 51, 51,
+51, 34, 34, 34, 50, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 35, 34, 34,
+50, 51, 51, 51, 51, 51, 51, 3, 0, 0, 0, 0, 0, 0, 0, 0, 48, 51, 51, 51,
+51, 51, 35, 34, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 4, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 48, 51, 51, 51,
+51, 3, 0, 0, 51, 51, 51, 51, 51, 0, 0, 0, 48, 51, 51, 51, 51, 51, 51, 51,
+51, 51, 51, 51, 3, 0, 0, 0, 48, 51, 51, 51, 51, 51, 51, 3, 0, 0, 0, 0,
+0, 0, 0, 0, 48, 51, 51, 51, 51, 3, 0, 0, 32, 34, 34, 34, 34, 34, 34, 34,
+34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+34, 34, 34, 34, 34, 34, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 32, 34, 35, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 50, 34, 34, 34, 34, 34, 34, 34,
+34, 34, 34, 2, 0, 0, 0, 0, 0, 0, 0, 0, 32, 0, 0, 0, 0, 0, 0, 0,
+48, 51, 3, 3, 51, 51, 51, 51, 32, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 50, 51, 51, 51, 51,
+51, 51, 51, 51, 51, 51, 51, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 48, 51, 51, 51, 51, 51, 51, 51,
+35, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+34, 34, 34, 34, 34, 34, 34, 50, 51, 51, 51, 3, 0, 0, 0, 0, 0, 0, 0, 0,
+48, 51, 51, 51, 51, 51, 51, 51, 67, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 64, 68, 68, 68, 4, 0, 0, 0, 48, 51, 51, 51, 51, 51, 51, 51,
+51, 51, 51, 51, 51, 51, 51, 51, 51, 0, 0, 0, 0, 0, 0, 0, 48, 51, 51, 51,
+51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 0, 0, 0, 0, 0, 0, 0,
 };
 //dbcs--Autogenerated -- end of section automatically generated
 }
 
 DBCSCharClassify::DBCSCharClassify(int codePage_) noexcept {
-	const uint16_t *classifyBegin = nullptr;
-	size_t classifyCount = 0;
 	size_t bytesCount = 0;
 	uint8_t bytesRLE[16]{}; // generated with DBCS.py
-	memcpy(charClass, CharClassify::GetClassifyMap(), 128);
+	CopyASCIICharClasses(charClass, 128);
 	memset(charClass + 128, static_cast<int>(CharacterClass::space), 128);
 	switch (codePage_) {
 	case cp932: {
@@ -1037,8 +1368,7 @@ DBCSCharClassify::DBCSCharClassify(int codePage_) noexcept {
 		memcpy(bytesRLE, BytesRLE_CP932, sizeof(BytesRLE_CP932));
 		//cp932--Autogenerated -- end of section automatically generated
 
-		classifyBegin = std::begin(CharClassifyRLE_CP932);
-		classifyCount = std::size(CharClassifyRLE_CP932);
+		classifyTable = CharClassify_CP932;
 		//CP932High++Autogenerated -- start of section automatically generated
 		constexpr uint8_t CP932High[] = {248, 8, 12, 42, 252, 220, 232, 28,};
 		//CP932High--Autogenerated -- end of section automatically generated
@@ -1053,8 +1383,7 @@ DBCSCharClassify::DBCSCharClassify(int codePage_) noexcept {
 		memcpy(bytesRLE, BytesRLE_CP936, sizeof(BytesRLE_CP936));
 		//cp936--Autogenerated -- end of section automatically generated
 
-		classifyBegin = std::begin(CharClassifyRLE_CP936);
-		classifyCount = std::size(CharClassifyRLE_CP936);
+		classifyTable = CharClassify_CP936;
 		charClass[0x80] = static_cast<uint8_t>(CharacterClass::punctuation);
 	} break;
 
@@ -1066,8 +1395,7 @@ DBCSCharClassify::DBCSCharClassify(int codePage_) noexcept {
 		memcpy(bytesRLE, BytesRLE_CP949, sizeof(BytesRLE_CP949));
 		//cp949--Autogenerated -- end of section automatically generated
 
-		classifyBegin = std::begin(CharClassifyRLE_CP949);
-		classifyCount = std::size(CharClassifyRLE_CP949);
+		classifyTable = CharClassify_CP949;
 	} break;
 
 	case cp950: {
@@ -1078,8 +1406,7 @@ DBCSCharClassify::DBCSCharClassify(int codePage_) noexcept {
 		memcpy(bytesRLE, BytesRLE_CP950, sizeof(BytesRLE_CP950));
 		//cp950--Autogenerated -- end of section automatically generated
 
-		classifyBegin = std::begin(CharClassifyRLE_CP950);
-		classifyCount = std::size(CharClassifyRLE_CP950);
+		classifyTable = CharClassify_CP950;
 	} break;
 
 	default: {
@@ -1090,13 +1417,15 @@ DBCSCharClassify::DBCSCharClassify(int codePage_) noexcept {
 		memcpy(bytesRLE, BytesRLE_CP1361, sizeof(BytesRLE_CP1361));
 		//cp1361--Autogenerated -- end of section automatically generated
 
-		ExpandRunBlock(CharClassify_CP1361Data, classifyMap,
-			CharClassify_CP1361Offset, CharClassify_CP1361IndexBit, CharClassify_CP1361BlockBit);
+		classifyTable = CharClassify_CP1361;
 	} break;
 	}
 
 	ExpandRLE2(bytesRLE, bytesRLE + bytesCount, byteMask.byteMask);
-	if (classifyBegin) {
-		ExpandRLE3(classifyBegin, classifyBegin + classifyCount, classifyMap);
+}
+
+void DBCSCharClassify::ExpandClassifyMap(uint8_t *buffer) const noexcept {
+	for (uint32_t index = 0; index < 0x8000; index++) {
+		buffer[index] = static_cast<uint8_t>(ClassifyCharacter(index | 0x8000));
 	}
 }
@@ -114,21 +114,20 @@ public:
 	}
 
 	static void InitUnicodeData() noexcept;
-	static const uint8_t *GetClassifyMap() noexcept {
-		return classifyMap;
-	}
 
 //++Autogenerated -- start of section automatically generated
 // Created with Python 3.15.0a5, Unicode 17.0.0
 	static CharacterClass ClassifyCharacter(uint32_t ch) noexcept {
-		if (ch < sizeof(classifyMap)) {
-			return static_cast<CharacterClass>(classifyMap[ch]);
+		if (ch < 0x10000) {
+			const uint32_t block = CharClassifyBMP[ch >> 5];
+			const uint32_t value = CharClassifyBMP[(block << 4) + ((ch & 31) >> 1) + 2048];
+			return static_cast<CharacterClass>((value >> ((ch & 1) << 2)) & 15);
 		}
 		if (ch >= 0xe01f0) {
 			return CharacterClass::space; // Co, Cn
 		}
 
-		ch -= sizeof(classifyMap);
+		ch -= 0x10000;
 		ch = (CharClassifyTable[ch >> 11] << 8) | (ch & 2047);
 		ch = (CharClassifyTable[(ch >> 6) + 417] << 6) | (ch & 63);
 		ch = (CharClassifyTable[(ch >> 3) + 1417] << 3) | (ch & 7);
@@ -155,9 +154,10 @@ public:
 
 private:
 	static constexpr uint32_t maxUnicode = 0x10ffff;
+	// two-stage table of 4-bit classes for BMP, generated by GenerateCharacterCategory.py
+	static const uint8_t CharClassifyBMP[];
 	static const uint8_t CharClassifyTable[];
 	static const uint8_t GraphemeBreakTable[];
-	static uint8_t classifyMap[0xffff + 1];
 	static uint8_t graphemeMap[0x4000];
 
 	static constexpr int maxChar = 256;
@@ -187,17 +187,19 @@ public:
 	const DBCSByteMask& GetByteMask() const noexcept {
 		return byteMask;
 	}
-	const uint8_t *GetClassifyMap() const noexcept {
-		return classifyMap;
-	}
+	// fill classes of all DBCS characters, indexed by DBCSIndex()
+	void ExpandClassifyMap(uint8_t *buffer) const noexcept;
 
 	CharacterClass ClassifyCharacter(uint32_t ch) const noexcept {
 		if (ch < sizeof(charClass)) {
 			return static_cast<CharacterClass>(charClass[ch]);
 		}
 		ch -= 0x8000;
-		if (ch < sizeof(classifyMap)) {
-			return static_cast<CharacterClass>(classifyMap[ch]);
+		if (ch < 0x8000) {
+			// two-stage table of 4-bit classes with 64 characters per block
+			const uint32_t block = classifyTable[ch >> 6];
+			const uint32_t value = classifyTable[(block << 5) + ((ch & 63) >> 1) + 512];
+			return static_cast<CharacterClass>((value >> ((ch & 1) << 2)) & 15);
 		}
 		// Cn
 		return CharacterClass::space;
@@ -206,7 +208,7 @@ public:
 private:
 	DBCSByteMask byteMask;
 	uint8_t charClass[256];
-	uint8_t classifyMap[0x8000];
+	const uint8_t *classifyTable;
 };
 
 }
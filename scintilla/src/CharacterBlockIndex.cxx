@@ -0,0 +1,177 @@
+// Scintilla source code edit control
+/** @file CharacterBlockIndex.cxx
+ ** Character and UTF-16 code unit counts for blocks of large UTF-8 document.
+ **/
+// This file is part of Notepad4.
+// See License.txt for details about distribution and modification.
+
+#include <cstddef>
+#include <cstdlib>
+#include <cstdint>
+#include <cassert>
+#include <cstring>
+
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <algorithm>
+#include <memory>
+
+#include "ScintillaTypes.h"
+
+#include "Debugging.h"
+
+#include "Position.h"
+#include "SplitVector.h"
+#include "Partitioning.h"
+#include "RunStyles.h"
+#include "CellBuffer.h"
+#include "UniConversion.h"
+#include "CharacterBlockIndex.h"
+
+using namespace Scintilla::Internal;
+
+namespace {
+
+// first non-trail byte at or after pos, a long run of trail bytes is kept in current block.
+Sci::Position NextBlockStart(const CellBuffer &cb, Sci::Position pos, Sci::Position end) noexcept {
+	const Sci::Position limit = std::min(end, pos + CharacterBlockIndex::blockSize);
+	while (pos < limit) {
+		if (!UTF8IsTrailByte(cb.UCharAt(pos))) {
+			return pos;
+		}
+		++pos;
+	}
+	return end;
+}
+
+}
+
+void CharacterBlockIndex::Build(const CellBuffer &cb) noexcept {
+	Clear();
+	try {
+		starts.InsertText(0, cb.Length());
+		Recount(cb, 0);
+		built = true;
+	} catch (...) {
+		Clear();
+	}
+}
+
+void CharacterBlockIndex::Clear() noexcept {
+	built = false;
+	try {
+		starts.DeleteAll();
+		characters.DeleteAll();
+		codeUnits.DeleteAll();
+	} catch (...) {
+		// DeleteAll() only fails when it can't allocate the two initial partitions
+	}
+}
+
+void CharacterBlockIndex::RemoveBlocks(Sci::Position block, Sci::Position count) {
+	starts.RemovePartitions(block, count);
+	characters.RemovePartitions(block, count);
+	codeUnits.RemovePartitions(block, count);
+}
+
+void CharacterBlockIndex::Recount(const CellBuffer &cb, Sci::Position block) {
+	const Sci::Position start = starts.PositionFromPartition(block);
+	Sci::Position end = starts.PositionFromPartition(block + 1);
+	if (end - start < blockSize/2 && block + 1 < starts.Partitions()) {
+		// merge short block with next one
+		RemoveBlocks(block + 1, 1);
+		end = starts.PositionFromPartition(block + 1);
+	}
+
+	// split long block, each piece is counted as a new block
+	std::vector<Sci::Position> positions;
+	std::vector<Sci::Position> counts;
+	std::vector<Sci::Position> countsUTF16;
+	Sci::Position count = characters.PositionFromPartition(block);
+	Sci::Position countUTF16 = codeUnits.PositionFromPartition(block);
+	Sci::Position pos = start;
+	while (true) {
+		const Sci::Position next = (end - pos >= 2*blockSize) ? NextBlockStart(cb, pos + blockSize, end) : end;
+		Sci::Position countBlock = 0;
+		Sci::Position countSupplementary = 0;
+		cb.CountCharactersUTF8(pos, next, countBlock, countSupplementary);
+		count += countBlock;
+		countUTF16 += countBlock + countSupplementary;
+		if (next == end) {
+			break;
+		}
+		positions.push_back(next);
+		counts.push_back(count);
+		countsUTF16.push_back(countUTF16);
+		pos = next;
+	}
+
+	characters.InsertText(block, count - characters.PositionFromPartition(block + 1));
+	codeUnits.InsertText(block, countUTF16 - codeUnits.PositionFromPartition(block + 1));
+	if (!positions.empty()) {
+		starts.InsertPartitions(block + 1, positions.data(), positions.size());
+		characters.InsertPartitions(block + 1, counts.data(), counts.size());
+		codeUnits.InsertPartitions(block + 1, countsUTF16.data(), countsUTF16.size());
+	}
+}
+
+void CharacterBlockIndex::InsertText(const CellBuffer &cb, Sci::Position position, Sci::Position insertLength) noexcept {
+	if (!built || insertLength <= 0) {
+		return;
+	}
+	// text inserted at block start is appended to previous block, so next block still starts at same byte
+	const Sci::Position block = starts.PartitionFromPosition(std::max<Sci::Position>(position - 1, 0));
+	try {
+		starts.InsertText(block, insertLength);
+		Recount(cb, block);
+	} catch (...) {
+		Clear();
+	}
+}
+
+void CharacterBlockIndex::DeleteText(const CellBuffer &cb, Sci::Position position, Sci::Position deleteLength) noexcept {
+	if (!built || deleteLength <= 0) {
+		return;
+	}
+	// blocks that start inside deleted range are merged into the block before it
+	const Sci::Position first = starts.PartitionFromPosition(std::max<Sci::Position>(position - 1, 0));
+	const Sci::Position last = starts.PartitionFromPosition(position + deleteLength - 1);
+	try {
+		if (last > first) {
+			RemoveBlocks(first + 1, last - first);
+		}
+		starts.InsertText(first, -deleteLength);
+		Recount(cb, first);
+	} catch (...) {
+		Clear();
+	}
+}
+
+void CharacterBlockIndex::CountBefore(const CellBuffer &cb, Sci::Position position, Sci::Position &count, Sci::Position &countUTF16) const noexcept {
+	const Sci::Position block = starts.PartitionFromPosition(position);
+	Sci::Position countBlock = 0;
+	Sci::Position countSupplementary = 0;
+	cb.CountCharactersUTF8(starts.PositionFromPartition(block), position, countBlock, countSupplementary);
+	count = characters.PositionFromPartition(block) + countBlock;
+	countUTF16 = codeUnits.PositionFromPartition(block) + countBlock + countSupplementary;
+}
+
+Sci::Position CharacterBlockIndex::RelativePosition(const CellBuffer &cb, Sci::Position position, Sci::Position offset, bool utf16) const noexcept {
+	Sci::Position count;
+	Sci::Position countUTF16;
+	CountBefore(cb, position, count, countUTF16);
+	const Partitioning<Sci::Position> &index = utf16 ? codeUnits : characters;
+	const Sci::Position target = (utf16 ? countUTF16 : count) + offset;
+	if (target < 0 || target > index.Length()) {
+		return Sci::invalidPosition;
+	}
+
+	const Sci::Position block = index.PartitionFromPosition(target);
+	Sci::Position pos = starts.PositionFromPartition(block);
+	Sci::Position remaining = target - index.PositionFromPartition(block);
+	pos = cb.MoveCharactersUTF8(pos, remaining, utf16);
+	// target is inside a surrogate pair
+	return (remaining == 0) ? pos : Sci::invalidPosition;
+}
@@ -0,0 +1,46 @@
+// Scintilla source code edit control
+/** @file CharacterBlockIndex.h
+ ** Character and UTF-16 code unit counts for blocks of large UTF-8 document.
+ **/
+// This file is part of Notepad4.
+// See License.txt for details about distribution and modification.
+#pragma once
+
+namespace Scintilla::Internal {
+
+/**
+ * Document is split into blocks that start at non-trail byte, so characters never cross blocks
+ * and counts for a block only depend on its own bytes. Cumulative counts are stored in partitions
+ * like line starts, counting a range costs a binary search plus counting inside two blocks.
+ * On modification, the changed block is merged with short neighbour and counted again.
+ */
+class CharacterBlockIndex {
+public:
+	static constexpr Sci::Position blockSize = 64*1024;
+
+	bool Built() const noexcept {
+		return built;
+	}
+	size_t MemoryUsage() const noexcept {
+		return starts.MemoryUsage() + characters.MemoryUsage() + codeUnits.MemoryUsage();
+	}
+	void Build(const CellBuffer &cb) noexcept;
+	void Clear() noexcept;
+	void InsertText(const CellBuffer &cb, Sci::Position position, Sci::Position insertLength) noexcept;
+	void DeleteText(const CellBuffer &cb, Sci::Position position, Sci::Position deleteLength) noexcept;
+	// count characters and UTF-16 code units before position at character boundary.
+	void CountBefore(const CellBuffer &cb, Sci::Position position, Sci::Position &count, Sci::Position &countUTF16) const noexcept;
+	// position offset by characters or UTF-16 code units from position at character boundary.
+	Sci::Position RelativePosition(const CellBuffer &cb, Sci::Position position, Sci::Position offset, bool utf16) const noexcept;
+
+private:
+	bool built = false;
+	Partitioning<Sci::Position> starts;
+	Partitioning<Sci::Position> characters;
+	Partitioning<Sci::Position> codeUnits;
+
+	void RemoveBlocks(Sci::Position block, Sci::Position count);
+	void Recount(const CellBuffer &cb, Sci::Position block);
+};
+
+}
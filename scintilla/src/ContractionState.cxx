@@ -85,6 +85,7 @@ public:
 
 	bool GetVisible(Sci::Line lineDoc) const noexcept override;
 	bool SetVisible(Sci::Line lineDocStart, Sci::Line lineDocEnd, bool isVisible) override;
+	void SetHiddenRanges(const ptrdiff_t *ranges, size_t count) override;
 	bool HiddenLines() const noexcept override;
 
 #if EnablePerLineFoldDisplayText
@@ -94,6 +95,7 @@ public:
 
 	bool GetExpanded(Sci::Line lineDoc) const noexcept override;
 	bool SetExpanded(Sci::Line lineDoc, bool isExpanded) override;
+	bool SetExpandedRanges(const ptrdiff_t *ranges, size_t count, bool isExpanded) override;
 	bool ExpandAll() override;
 	Sci::Line ContractedNext(Sci::Line lineDocStart) const noexcept override;
 
@@ -367,6 +369,35 @@ bool ContractionState<LINE>::SetVisible(Sci::Line lineDocStart, Sci::Line lineDo
 	}
 }
 
+template <typename LINE>
+void ContractionState<LINE>::SetHiddenRanges(const ptrdiff_t *ranges, size_t count) {
+	if (OneToOne() && count == 0) {
+		return;
+	}
+	EnsureData();
+	const LINE lines = line_cast(OneToMany_LinesInDoc());
+	visible->FillRange(0, 1, lines);
+	if (count != 0) {
+		visible->FillRanges(ranges, count, 0);
+	}
+	// rebuild display lines instead of moving partitions after each changed line,
+	// last partition is the empty one after last line.
+	LINE * const positions = displayLines->ResetPartitions(lines + 1);
+	LINE lineDisplay = 0;
+	LINE line = 0;
+	while (line < lines) {
+		// both visibility and height are same until end of the shorter run
+		const LINE runEnd = std::min(visible->EndRun(line), heights->EndRun(line));
+		const LINE height = visible->ValueAt(line) ? heights->ValueAt(line) : 0;
+		for (; line < runEnd; line++) {
+			lineDisplay += height;
+			positions[line] = lineDisplay;
+		}
+	}
+	positions[lines] = lineDisplay;
+	Check();
+}
+
 template <typename LINE>
 bool ContractionState<LINE>::HiddenLines() const noexcept {
 	if (OneToOne()) {
@@ -428,6 +459,17 @@ bool ContractionState<LINE>::SetExpanded(Sci::Line lineDoc, bool isExpanded) {
 	}
 }
 
+template <typename LINE>
+bool ContractionState<LINE>::SetExpandedRanges(const ptrdiff_t *ranges, size_t count, bool isExpanded) {
+	if ((OneToOne() && isExpanded) || count == 0) {
+		return false;
+	}
+	EnsureData();
+	const bool changed = expanded->FillRanges(ranges, count, static_cast<char>(isExpanded)).changed;
+	Check();
+	return changed;
+}
+
 template <typename LINE>
 bool ContractionState<LINE>::ExpandAll() {
 	if (OneToOne()) {
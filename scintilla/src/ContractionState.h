@@ -34,6 +34,8 @@ public:
 
 	virtual bool GetVisible(Sci::Line lineDoc) const noexcept = 0;
 	virtual bool SetVisible(Sci::Line lineDocStart, Sci::Line lineDocEnd, bool isVisible) = 0;
+	// Show all lines except count sorted pairs of start line and line count, in one pass
+	virtual void SetHiddenRanges(const ptrdiff_t *ranges, size_t count) = 0;
 	virtual bool HiddenLines() const noexcept = 0;
 
 #if EnablePerLineFoldDisplayText
@@ -43,6 +45,7 @@ public:
 
 	virtual bool GetExpanded(Sci::Line lineDoc) const noexcept = 0;
 	virtual bool SetExpanded(Sci::Line lineDoc, bool isExpanded) = 0;
+	virtual bool SetExpandedRanges(const ptrdiff_t *ranges, size_t count, bool isExpanded) = 0;
 	virtual bool ExpandAll() = 0;
 	virtual Sci::Line ContractedNext(Sci::Line lineDocStart) const noexcept = 0;
 
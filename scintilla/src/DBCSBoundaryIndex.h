@@ -0,0 +1,51 @@
+// Scintilla source code edit control
+/** @file DBCSBoundaryIndex.h
+ ** Character boundary at start of fixed size blocks to resynchronize backward movement in DBCS document.
+ **/
+// This file is part of Notepad4.
+// See License.txt for details about distribution and modification.
+#pragma once
+
+namespace Scintilla::Internal {
+
+/**
+ * In DBCS encodings trail bytes overlap lead bytes, so finding start of the character before a position
+ * scans back to a byte that can't be lead byte, which can be the whole line for text without ASCII.
+ * For each block the offset (0 or 1) of its first character boundary is computed lazily, long backward
+ * scans stop at nearest block start instead. Offsets of blocks starting at or after modified position
+ * are dropped. Filled under lock as the document may be searched from multiple threads.
+ */
+class DBCSBoundaryIndex {
+public:
+	static constexpr Sci::Position blockSize = 4*1024;
+
+	NativeMutex mutex;
+
+	// offset of first character boundary from block start, -1 when unknown
+	int Offset(Sci::Position block) const noexcept {
+		return (static_cast<size_t>(block) < offsets.size()) ? offsets[block] : -1;
+	}
+	void SetOffset(Sci::Position block, int offset) {
+		if (static_cast<size_t>(block) >= offsets.size()) {
+			offsets.resize(block + 1, -1);
+		}
+		offsets[block] = static_cast<int8_t>(offset);
+	}
+	void Invalidate(Sci::Position position) noexcept {
+		const size_t keep = (position + blockSize - 1) / blockSize;
+		if (keep < offsets.size()) {
+			offsets.erase(offsets.begin() + keep, offsets.end());
+		}
+	}
+	void Clear() noexcept {
+		std::vector<int8_t>().swap(offsets);
+	}
+	size_t MemoryUsage() const noexcept {
+		return offsets.capacity();
+	}
+
+private:
+	std::vector<int8_t> offsets;
+};
+
+}
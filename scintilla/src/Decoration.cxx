@@ -75,6 +75,20 @@ public:
 	Sci::Position Runs() const noexcept override {
 		return rs.Runs();
 	}
+	void AppendRuns(Sci::Position start, Sci::Position end, std::vector<DecorationRun> &runs) const override {
+		const POS runCount = rs.Runs();
+		POS run = rs.RunContaining(pos_cast(start));
+		POS runStart = rs.PositionFromRun(run);
+		while (run < runCount && runStart < end) {
+			const POS runEnd = rs.PositionFromRun(run + 1);
+			const int value = rs.ValueOfRun(run);
+			if (value && runEnd > runStart) {
+				runs.push_back({runStart, runEnd, indicator, value});
+			}
+			runStart = runEnd;
+			++run;
+		}
+	}
 };
 
 template <typename POS>
@@ -87,6 +101,10 @@ class DecorationList : public IDecorationList {
 	std::vector<std::unique_ptr<Decoration<POS>>> decorationList;
 	std::vector<const IDecoration*> decorationView;	// Read-only view of decorationList
 	bool clickNotified;
+	bool runsValid;
+	Sci::Position runsStart;
+	Sci::Position runsEnd;
+	std::vector<DecorationRun> runs;	// Cached by RunsInRange()
 
 	Decoration<POS> *DecorationFromIndicator(int indicator) noexcept;
 	Decoration<POS> *Create(int indicator, Sci::Position length);
@@ -120,6 +138,7 @@ public:
 
 	// Returns changed=true if some values may have changed
 	FillResult<Sci::Position> FillRange(Sci::Position position, int value, Sci::Position fillLength) override;
+	FillResult<Sci::Position> FillRanges(const Sci::Position *ranges, size_t count, int value) override;
 
 	void InsertSpace(Sci::Position position, Sci::Position insertLength) override;
 	void DeleteRange(Sci::Position position, Sci::Position deleteLength) override;
@@ -130,6 +149,7 @@ public:
 	int ValueAt(int indicator, Sci::Position position) noexcept override;
 	Sci::Position Start(int indicator, Sci::Position position) noexcept override;
 	Sci::Position End(int indicator, Sci::Position position) noexcept override;
+	const std::vector<DecorationRun> &RunsInRange(Sci::Position start, Sci::Position end) override;
 
 	bool ClickNotified() const noexcept override {
 		return clickNotified;
@@ -137,11 +157,20 @@ public:
 	void SetClickNotified(bool notified) noexcept override {
 		clickNotified = notified;
 	}
+
+	size_t MemoryUsage() const noexcept override {
+		size_t usage = (decorationList.capacity() + decorationView.capacity()) * sizeof(void *)
+			+ runs.capacity() * sizeof(DecorationRun);
+		for (const auto &deco : decorationList) {
+			usage += sizeof(Decoration<POS>) + deco->rs.MemoryUsage();
+		}
+		return usage;
+	}
 };
 
 template <typename POS>
 DecorationList<POS>::DecorationList() noexcept : currentIndicator(0), currentValue(1), current(nullptr),
-lengthDocument(0), clickNotified(false) {
+lengthDocument(0), clickNotified(false), runsValid(false), runsStart(0), runsEnd(0) {
 }
 
 template <typename POS>
@@ -205,6 +234,24 @@ FillResult<Sci::Position> DecorationList<POS>::FillRange(Sci::Position position,
 	// Converting result from POS to Sci::Position as callers not polymorphic.
 	const FillResult<POS> frInPOS = current->rs.FillRange(pos_cast(position), value, pos_cast(fillLength));
 	const FillResult<Sci::Position> fr{ frInPOS.changed, frInPOS.position, frInPOS.fillLength };
+	runsValid = runsValid && !fr.changed;
+	if (current->Empty()) {
+		Delete(currentIndicator);
+	}
+	return fr;
+}
+
+template <typename POS>
+FillResult<Sci::Position> DecorationList<POS>::FillRanges(const Sci::Position *ranges, size_t count, int value) {
+	if (!current) {
+		current = DecorationFromIndicator(currentIndicator);
+		if (!current) {
+			current = Create(currentIndicator, lengthDocument);
+		}
+	}
+	const FillResult<POS> frInPOS = current->rs.FillRanges(ranges, count, value);
+	const FillResult<Sci::Position> fr{ frInPOS.changed, frInPOS.position, frInPOS.fillLength };
+	runsValid = runsValid && !fr.changed;
 	if (current->Empty()) {
 		Delete(currentIndicator);
 	}
@@ -215,6 +262,7 @@ template <typename POS>
 void DecorationList<POS>::InsertSpace(Sci::Position position, Sci::Position insertLength) {
 	const bool atEnd = position == lengthDocument;
 	lengthDocument += insertLength;
+	runsValid = false;
 	for (const auto &deco : decorationList) {
 		deco->rs.InsertSpace(pos_cast(position), pos_cast(insertLength));
 		if (atEnd) {
@@ -226,6 +274,7 @@ void DecorationList<POS>::InsertSpace(Sci::Position position, Sci::Position inse
 template <typename POS>
 void DecorationList<POS>::DeleteRange(Sci::Position position, Sci::Position deleteLength) {
 	lengthDocument -= deleteLength;
+	runsValid = false;
 	for (const auto &deco : decorationList) {
 		deco->rs.DeleteRange(pos_cast(position), pos_cast(deleteLength));
 	}
@@ -261,6 +310,7 @@ void DecorationList<POS>::DeleteAnyEmpty() {
 
 template <typename POS>
 void DecorationList<POS>::SetView() {
+	runsValid = false;
 	decorationView.resize(decorationList.size());
 	auto iter = decorationView.begin();
 	for (const auto &deco : decorationList) {
@@ -308,6 +358,20 @@ Sci::Position DecorationList<POS>::End(int indicator, Sci::Position position) no
 	return 0;
 }
 
+template <typename POS>
+const std::vector<DecorationRun> &DecorationList<POS>::RunsInRange(Sci::Position start, Sci::Position end) {
+	if (!runsValid || start < runsStart || end > runsEnd) {
+		runs.clear();
+		for (const auto &deco : decorationList) {
+			deco->AppendRuns(start, end, runs);
+		}
+		runsValid = true;
+		runsStart = start;
+		runsEnd = end;
+	}
+	return runs;
+}
+
 }
 
 namespace Scintilla::Internal {
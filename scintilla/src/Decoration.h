@@ -7,6 +7,14 @@
 
 namespace Scintilla::Internal {
 
+// Run with non-zero value of one indicator, positions are not clipped to the requested range.
+struct DecorationRun {
+	Sci::Position start;
+	Sci::Position end;
+	int indicator;
+	int value;
+};
+
 class IDecoration {
 public:
 	virtual ~IDecoration() = default;
@@ -19,6 +27,7 @@ public:
 	virtual void SetValueAt(Sci::Position position, int value) = 0;
 	virtual void InsertSpace(Sci::Position position, Sci::Position insertLength) = 0;
 	virtual Sci::Position Runs() const noexcept = 0;
+	virtual void AppendRuns(Sci::Position start, Sci::Position end, std::vector<DecorationRun> &runs) const = 0;
 };
 
 class IDecorationList {
@@ -35,6 +44,7 @@ public:
 
 	// Returns with changed=true if some values may have changed
 	virtual FillResult<Sci::Position> FillRange(Sci::Position position, int value, Sci::Position fillLength) = 0;
+	virtual FillResult<Sci::Position> FillRanges(const Sci::Position *ranges, size_t count, int value) = 0;
 	virtual void InsertSpace(Sci::Position position, Sci::Position insertLength) = 0;
 	virtual void DeleteRange(Sci::Position position, Sci::Position deleteLength) = 0;
 	virtual void DeleteLexerDecorations() = 0;
@@ -43,11 +53,38 @@ public:
 	virtual int ValueAt(int indicator, Sci::Position position) noexcept = 0;
 	virtual Sci::Position Start(int indicator, Sci::Position position) noexcept = 0;
 	virtual Sci::Position End(int indicator, Sci::Position position) noexcept = 0;
+	// Runs of all decorations intersecting [start, end) ordered by indicator then position.
+	// Cached until decorations change or a range outside the cached one is requested,
+	// so painting collects the visible range once; valid until next call.
+	virtual const std::vector<DecorationRun> &RunsInRange(Sci::Position start, Sci::Position end) = 0;
 
 	virtual bool ClickNotified() const noexcept = 0;
 	virtual void SetClickNotified(bool notified) noexcept = 0;
+
+	virtual size_t MemoryUsage() const noexcept = 0;
 };
 
+// Calls visit() for each run intersecting [start, end) in runs ordered by indicator then position.
+template <typename Visitor>
+void ForEachDecorationRun(const std::vector<DecorationRun> &runs, Sci::Position start, Sci::Position end, Visitor visit) {
+	if (start >= end) {
+		return;
+	}
+	auto it = runs.begin();
+	while (it != runs.end()) {
+		const int indicator = it->indicator;
+		it = std::partition_point(it, runs.end(), [indicator, start](const DecorationRun &run) noexcept {
+			return run.indicator == indicator && run.end <= start;
+		});
+		for (; it != runs.end() && it->indicator == indicator && it->start < end; ++it) {
+			visit(*it);
+		}
+		it = std::partition_point(it, runs.end(), [indicator](const DecorationRun &run) noexcept {
+			return run.indicator == indicator;
+		});
+	}
+}
+
 std::unique_ptr<IDecoration> DecorationCreate(bool largeDocument, int indicator);
 
 std::unique_ptr<IDecorationList> DecorationListCreate(bool largeDocument);
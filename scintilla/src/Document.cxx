@@ -23,6 +23,7 @@
 #include <forward_list>
 #include <optional>
 #include <algorithm>
+#include <atomic>
 #include <memory>
 
 #include <windows.h>
@@ -31,7 +32,12 @@
 #elif !defined(NO_CXX11_REGEX)
 #include <regex>
 #endif
+#if defined(PCRE2_REGEX)
+#define PCRE2_CODE_UNIT_WIDTH 8
+#include <pcre2.h>
+#endif
 
+#include "ParallelSupport.h"
 #include "ScintillaTypes.h"
 #include "ScintillaMessages.h"
 #include "ScintillaStructures.h"
@@ -54,6 +60,11 @@
 #include "CaseFolder.h"
 #include "Document.h"
 #include "RESearch.h"
+#include "SearchIndex.h"
+#include "CharacterBlockIndex.h"
+#include "BraceIndex.h"
+#include "DBCSBoundaryIndex.h"
+#include "BackgroundLexer.h"
 #include "UniConversion.h"
 #include "ElapsedPeriod.h"
 
@@ -64,10 +75,14 @@ using namespace Lexilla;
 LexInterface::LexInterface(Document *pdoc_) noexcept : pdoc{pdoc_} {
 }
 
-LexInterface::~LexInterface() noexcept = default;
+LexInterface::~LexInterface() noexcept {
+	DiscardBackground();
+}
 
 void LexInterface::Colourise(Sci::Position start, Sci::Position end) {
 	if (pdoc && instance && !performingStyle) {
+		// lexer instance can't be used by both threads
+		StopBackground();
 		// Protect against reentrance, which may occur, for example, when
 		// fold points are discovered while performing styling and the folding
 		// code looks for child lines which may trigger styling.
@@ -88,7 +103,6 @@ void LexInterface::Colourise(Sci::Position start, Sci::Position end) {
 				styleStart = pdoc->StyleIndexAt(start - 1);
 			}
 			instance->Lex(start, len, styleStart, pdoc);
-			instance->Fold(start, len, styleStart, pdoc);
 			if (enableUrlHighlight) {
 				pdoc->HighlightUrl(start, len, urlIgnoreStyle);
 			}
@@ -98,6 +112,222 @@ void LexInterface::Colourise(Sci::Position start, Sci::Position end) {
 	}
 }
 
+// Fold styled text after Colourise(), returns false when called during styling.
+bool LexInterface::Fold(Sci::Position start, Sci::Position end) {
+	if (performingStyle) {
+		return false;
+	}
+	if (pdoc && instance && end > start) {
+		StopBackground();
+		performingStyle = true;
+		int styleStart = 0;
+		if (start > 0) {
+			styleStart = pdoc->StyleIndexAt(start - 1);
+		}
+		instance->Fold(start, end - start, styleStart, pdoc);
+		performingStyle = false;
+	}
+	return true;
+}
+
+namespace {
+
+// don't restart background lexing for each keystroke, text is copied into new snapshot
+constexpr uint64_t backgroundRestartDelay = 500;
+// remaining text shorter than this is styled on idle in current thread
+constexpr Sci::Position backgroundMinimumLength = 4*BackgroundLexer::chunkSize;
+// lexer with line checkpoint is split into at most this many segments
+constexpr uint32_t backgroundMaxSegments = 8;
+// lines searched for section start to begin a speculative segment
+constexpr Sci::Line backgroundSectionSearchLines = 4096;
+
+}
+
+// Returns false when background lexing is not used, caller should style on current thread.
+bool LexInterface::ColouriseInBackground(Sci::Position end, uint32_t threadCount) {
+	if (!instance || performingStyle || backgroundFailed) {
+		return false;
+	}
+	if (background) {
+		CommitBackground(false);
+		if (background && !speculative.empty()) {
+			StitchBackground();
+		}
+		if (background) {
+			if (background->Failed()) {
+				backgroundFailed = true;
+				DiscardBackground();
+				return false;
+			}
+			if (!background->Done() || !speculative.empty()) {
+				return true;
+			}
+			background.reset();
+		}
+	}
+
+	const Sci::Position start = pdoc->LineStartPosition(pdoc->GetEndStyled());
+	if (end - start < backgroundMinimumLength
+		|| GetTickCount64() - backgroundDiscardTime < backgroundRestartDelay
+		|| !BackgroundLexer::Supported(*pdoc)) {
+		return false;
+	}
+	if (!StartBackground(start, end, threadCount)) {
+		backgroundFailed = true;
+		DiscardBackground();
+		return false;
+	}
+	return true;
+}
+
+// Lexer with line checkpoint is split at line starts, later segments start from checkpoint
+// currently in the document, which is likely unchanged after editing, or default state on first styling.
+bool LexInterface::StartBackground(Sci::Position start, Sci::Position end, uint32_t threadCount) {
+	lineCheckpoint = static_cast<int>(reinterpret_cast<uintptr_t>(instance->PrivateCall(lexerCallLineCheckpoint, nullptr)));
+	Sci::Position segmentEnd = end;
+	uint32_t segmentCount = 1;
+	if (lineCheckpoint != lineCheckpointNone) {
+		segmentCount = static_cast<uint32_t>(std::min<Sci::Position>({
+			(end - start)/backgroundMinimumLength, threadCount, backgroundMaxSegments}));
+		if (segmentCount > 1) {
+			segmentEnd = pdoc->LineStartPosition(start + (end - start)/segmentCount);
+		}
+	}
+
+	if (segmentEnd < end) {
+		segmentEnd = NextValidCheckpoint(segmentEnd, end);
+	}
+	background = std::make_unique<BackgroundLexer>(instance.get(), *pdoc, start, segmentEnd);
+	if (!background->Start()) {
+		return false;
+	}
+	for (uint32_t segment = 2; segment <= segmentCount && segmentEnd < end; segment++) {
+		const Sci::Position segmentStart = segmentEnd;
+		segmentEnd = (segment == segmentCount) ? end : pdoc->LineStartPosition(start + (end - start)*segment/segmentCount);
+		if (segmentEnd < end) {
+			segmentEnd = NextValidCheckpoint(segmentEnd, end);
+		}
+		if (segmentEnd <= segmentStart) {
+			segmentEnd = segmentStart;
+		} else {
+			const BackgroundLexer::Checkpoint assumed = BackgroundLexer::DocumentCheckpoint(*pdoc, segmentStart);
+			auto job = std::make_unique<BackgroundLexer>(instance.get(), *pdoc, segmentStart, segmentEnd, &assumed);
+			if (!job->Start()) {
+				break;
+			}
+			speculative.push_back(std::move(job));
+		}
+	}
+	return true;
+}
+
+// Lexer with section checkpoint (e.g. HTML with embedded script) only restarts from checkpoint
+// at section start lines, which are found from current document styles and line states.
+bool LexInterface::ValidCheckpoint(Sci::Position position) {
+	if ((lineCheckpoint & lineCheckpointSection) == 0) {
+		return true;
+	}
+	const BackgroundLexer::Checkpoint checkpoint = BackgroundLexer::DocumentCheckpoint(*pdoc, position);
+	int values[2] = {checkpoint.style, checkpoint.lineState};
+	return instance->PrivateCall(lexerCallSectionStart, values) != nullptr;
+}
+
+// Returns first line start from position with valid checkpoint, or end when not found.
+Sci::Position LexInterface::NextValidCheckpoint(Sci::Position position, Sci::Position end) {
+	if ((lineCheckpoint & lineCheckpointSection) == 0) {
+		return position;
+	}
+	Sci::Line line = pdoc->SciLineFromPosition(position);
+	const Sci::Line lineEnd = std::min(line + backgroundSectionSearchLines, pdoc->SciLineFromPosition(end));
+	while (line < lineEnd) {
+		position = pdoc->LineStart(line);
+		if (ValidCheckpoint(position)) {
+			return position;
+		}
+		++line;
+	}
+	return end;
+}
+
+void LexInterface::CommitBackground(bool wait) {
+	const Sci::Position start = background->CommittedTo();
+	if (background->IsStale() || pdoc->GetEndStyled() != start) {
+		// document or styling changed after the job started
+		DiscardBackground();
+		backgroundDiscardTime = GetTickCount64();
+		return;
+	}
+	performingStyle = true;
+	// job also folded the text, levels are valid when they were valid at its start
+	const bool folded = pdoc->GetEndFolded() >= start;
+	const Sci::Position end = background->Commit(*pdoc, wait);
+	if (end > start) {
+		if (folded) {
+			pdoc->SetEndFolded(end);
+		}
+		pdoc->IncrementStyleClock();
+		if (enableUrlHighlight) {
+			pdoc->HighlightUrl(start, end - start, urlIgnoreStyle);
+		}
+	}
+	performingStyle = false;
+}
+
+// Continue with next speculative segment when styling reaches a line where its checkpoint
+// matches the document, otherwise restyle from first divergent checkpoint until they converge.
+void LexInterface::StitchBackground() {
+	while (!speculative.empty()) {
+		BackgroundLexer &next = *speculative.front();
+		const Sci::Position position = background->CommittedTo();
+		if (next.Failed()) {
+			speculative.clear();
+			return;
+		}
+		if (position >= next.EndGoal()) {
+			// segment restyled without convergence
+			speculative.erase(speculative.begin());
+			continue;
+		}
+		BackgroundLexer::Checkpoint checkpoint;
+		if (position < next.StartPosition() || !next.CheckpointAt(position, checkpoint)) {
+			return;
+		}
+		if (!checkpoint.Same(BackgroundLexer::DocumentCheckpoint(*pdoc, position), lineCheckpoint) || !ValidCheckpoint(position)) {
+			if (background->Done()) {
+				background = std::make_unique<BackgroundLexer>(instance.get(), *pdoc, position, next.EndGoal());
+				if (!background->Start()) {
+					backgroundFailed = true;
+					DiscardBackground();
+				}
+			}
+			return;
+		}
+		background->Stop();
+		next.Resume(position);
+		background = std::move(speculative.front());
+		speculative.erase(speculative.begin());
+		CommitBackground(false);
+		if (!background) {
+			return;
+		}
+	}
+}
+
+// Wait for the chunk being lexed and commit finished chunks.
+void LexInterface::StopBackground() {
+	if (background && !performingStyle) {
+		speculative.clear();
+		background->Stop();
+		CommitBackground(true);
+		background.reset();
+	}
+}
+
+void LexInterface::DiscardBackground() noexcept {
+	speculative.clear();
+	background.reset();
+}
+
 bool LexInterface::UseContainerLexing() const noexcept {
 	return !instance;
 }
@@ -123,10 +353,16 @@ void ActionDuration::AddSample(Sci::Position numberActions, double durationOfAct
 	const double duration_ = alpha * durationOne + (1.0 - alpha) * duration;
 	//duration = Clamp(duration_, minDuration, maxDuration);
 	duration = std::max(duration_, minDuration);
+	measured = true;
 	//printf("%s actions=%.9f / %zd, one=%.9f, value=%.9f, [%.9f, %.8f, %.6f]\n", __func__,
 	//	durationOfActions, numberActions, durationOne, duration_, duration, minDuration, maxDuration);
 }
 
+void ActionDuration::Set(double durationOne) noexcept {
+	duration = std::clamp(durationOne, minDuration, maxDuration);
+	measured = false;
+}
+
 int ActionDuration::ActionsInAllowedTime(double secondsAllowed) const noexcept {
 	const int actions = std::clamp(static_cast<int>(secondsAllowed / duration), 8, 0x10000);
 	return actions * unitBytes;
@@ -148,7 +384,7 @@ CharacterExtracted::CharacterExtracted(const unsigned char *charBytes, size_t wi
 }
 
 Document::Document(DocumentOption options) :
-	cb(!FlagSet(options, DocumentOption::StylesNone), FlagSet(options, DocumentOption::TextLarge)),
+	cb(!FlagSet(options, DocumentOption::StylesNone), FlagSet(options, DocumentOption::TextLarge), FlagSet(options, DocumentOption::StylesRuns)),
 	durationStyleOneUnit(1e-6),
 	decorations{DecorationListCreate(IsLarge())} {
 
@@ -161,6 +397,15 @@ Document::Document(DocumentOption options) :
 
 	cb.SetPerLine(this);
 	cb.SetUTF8Substance(CpUtf8 == dbcsCodePage);
+	if (FlagSet(options, DocumentOption::SearchIndex)) {
+		searchIndex = std::make_unique<SearchIndex>();
+	}
+	if (FlagSet(options, DocumentOption::CharacterBlockIndex)) {
+		characterIndex = std::make_unique<CharacterBlockIndex>();
+	}
+	if (FlagSet(options, DocumentOption::BraceIndex)) {
+		braceIndex = std::make_unique<BraceIndex>();
+	}
 }
 
 Document::~Document() {
@@ -226,6 +471,25 @@ LineLevels *Document::Levels() const noexcept {
 	return static_cast<LineLevels *>(perLineData[ldLevels].get());
 }
 
+size_t Document::MemoryUsed(Scintilla::MemoryUsage usage) const noexcept {
+	switch (usage) {
+	case Scintilla::MemoryUsage::Decoration:
+		return decorations->MemoryUsage();
+	case Scintilla::MemoryUsage::Marker:
+		return Markers()->MemoryUsage();
+	case Scintilla::MemoryUsage::FoldLevel:
+		return Levels()->MemoryUsage();
+	case Scintilla::MemoryUsage::SearchIndex:
+		return searchIndex ? searchIndex->MemoryUsage() : 0;
+	case Scintilla::MemoryUsage::CharacterBlockIndex:
+		return characterIndex ? characterIndex->MemoryUsage() : 0;
+	case Scintilla::MemoryUsage::BraceIndex:
+		return braceIndex ? braceIndex->MemoryUsage() : 0;
+	default:
+		return cb.MemoryUsed(usage);
+	}
+}
+
 LineState *Document::States() const noexcept {
 	return static_cast<LineState *>(perLineData[ldState].get());
 }
@@ -285,6 +549,16 @@ bool Document::SetDBCSCodePage(int dbcsCodePage_) {
 		regex.reset();
 		cb.SetLineEndTypes(lineEndBitSet & LineEndTypesSupported());
 		cb.SetUTF8Substance(CpUtf8 == dbcsCodePage);
+		if (characterIndex) {
+			characterIndex->Clear();
+		}
+		if (braceIndex) {
+			braceIndex->Clear();
+		}
+		dbcsIndex.reset();
+		if (dbcsCodePage && CpUtf8 != dbcsCodePage) {
+			dbcsIndex = std::make_unique<DBCSBoundaryIndex>();
+		}
 		ModifiedAt(0);	// Need to restyle whole document
 		return true;
 	}
@@ -309,6 +583,27 @@ void Document::SetSavePoint() {
 	NotifySavePoint(true);
 }
 
+namespace {
+
+// undo or redo groups with at least this many steps notify watchers once for the whole group
+constexpr int coalescedReplaySteps = 1024;
+
+struct WithoutPerLine {
+	CellBuffer *cb;
+	PerLine *pl;
+	WithoutPerLine(CellBuffer *cb_, PerLine *pl_) noexcept : cb(cb_), pl(pl_) {
+		cb->SetPerLine(nullptr);
+	}
+	const char *InsertString(Sci::Position position, const char *s, Sci::Position insertLength, bool &startSequence) const {
+		return cb->InsertString(position, s, insertLength, startSequence);
+	}
+	~WithoutPerLine() {
+		cb->SetPerLine(pl);
+	}
+};
+
+}
+
 void Document::TentativeUndo() {
 	if (!TentativeActive())
 		return;
@@ -334,7 +629,12 @@ void Document::TentativeUndo() {
 					NotifyModified(DocModification(
 						ModificationFlags::BeforeDelete | ModificationFlags::Undo, action));
 				}
-				cb.PerformUndoStep();
+				if (action.transform) {
+					const WithoutPerLine withoutPerLine(&cb, this);
+					cb.PerformUndoStep();
+				} else {
+					cb.PerformUndoStep();
+				}
 				if (action.at != ActionType::container) {
 					ModifiedAt(action.position);
 				}
@@ -458,6 +758,10 @@ Sci::Line Document::MarkerNext(Sci::Line lineStart, MarkerMask mask) const noexc
 	return Markers()->MarkerNext(lineStart, mask);
 }
 
+Sci::Line Document::MarkerPrevious(Sci::Line lineStart, MarkerMask mask) const noexcept {
+	return Markers()->MarkerPrevious(lineStart, mask);
+}
+
 int Document::AddMark(Sci::Line line, int markerNum) {
 	const Sci::Line lines = LinesTotal();
 	if (IsValidIndex(line, lines)) {
@@ -646,6 +950,7 @@ constexpr bool IsSubordinate(FoldLevel levelStart, FoldLevel levelTry) noexcept
 
 Sci::Line Document::GetLastChild(Sci::Line lineParent, FoldLevel level, Sci::Line lastLine) {
 	if (level == FoldLevel::None) {
+		EnsureLineFolded(lineParent);
 		level = GetFoldLevel(lineParent);
 	}
 	const FoldLevel levelStart = LevelNumberPart(level);
@@ -653,14 +958,14 @@ Sci::Line Document::GetLastChild(Sci::Line lineParent, FoldLevel level, Sci::Lin
 	if (lastLine < 0 || lastLine > maxLine) {
 		lastLine = maxLine;
 	}
-	Sci::Line lineEndStyled = SciLineFromPosition(GetEndStyled()) - 1;
+	Sci::Line lineEndFolded = SciLineFromPosition(GetEndFolded()) - 1;
 	Sci::Line lineMaxSubord = lineParent;
 	while (lineMaxSubord < maxLine) {
-		if (lineMaxSubord >= lineEndStyled) {
+		if (lineMaxSubord >= lineEndFolded) {
 			// two or more lines are required to make stable fold for most lexer
-			EnsureStyledTo(LineStart(lineMaxSubord + 2 + 1));
+			EnsureFoldedTo(LineStart(lineMaxSubord + 2 + 1));
 			// LexerBase::Fold() already moved one line back
-			lineEndStyled = SciLineFromPosition(GetEndStyled()) - 1;
+			lineEndFolded = SciLineFromPosition(GetEndFolded()) - 1;
 		}
 		if (!IsSubordinate(levelStart, GetFoldLevel(lineMaxSubord + 1)))
 			break;
@@ -871,11 +1176,7 @@ Sci::Position Document::MovePositionOutsideChar(Sci::Position pos, int moveDir,
 				// Else invalid UTF-8 so return position of isolated trail byte
 			}
 		} else {
-			// Step back until a non-lead-byte is found.
-			Sci::Position posCheck = pos;
-			while ((posCheck > 0) && IsDBCSLeadByteNoExcept(cb.CharAt(posCheck - 1))) {
-				posCheck--;
-			}
+			Sci::Position posCheck = DBCSCharacterBoundaryBefore(pos);
 
 			// Check from known start of character.
 			while (posCheck < pos) {
@@ -964,7 +1265,21 @@ Sci::Position Document::NextPosition(Sci::Position pos, int moveDir) const noexc
 				} else {
 					// Otherwise, step back until a non-lead-byte is found.
 					Sci::Position posTemp = pos - 1;
+					const Sci::Position limit = posTemp - DBCSBoundaryIndex::blockSize;
 					while (--posTemp >= 0 && IsDBCSLeadByteNoExcept(cb.CharAt(posTemp))) {
+						if (posTemp == limit) {
+							// long run of lead bytes, walk forward from boundary near block start
+							Sci::Position posCheck = DBCSBlockBoundary(pos - 1);
+							if (posCheck >= 0) {
+								while (true) {
+									const Sci::Position posNext = posCheck + (IsDBCSDualByteAt(posCheck) ? 2 : 1);
+									if (posNext >= pos) {
+										return posCheck;
+									}
+									posCheck = posNext;
+								}
+							}
+						}
 					}
 					// Now posTemp+1 must point to the beginning of a character,
 					// so figure out whether we went back an even or an odd
@@ -985,6 +1300,80 @@ Sci::Position Document::NextPosition(Sci::Position pos, int moveDir) const noexc
 	return pos;
 }
 
+/**
+ * Find character boundary at or before pos in DBCS document, scanning back to a byte that can't
+ * be lead byte, or resynchronizing from nearest block start after long run of lead bytes.
+ */
+Sci::Position Document::DBCSCharacterBoundaryBefore(Sci::Position pos) const noexcept {
+	const Sci::Position limit = pos - DBCSBoundaryIndex::blockSize;
+	Sci::Position posCheck = pos;
+	while ((posCheck > 0) && IsDBCSLeadByteNoExcept(cb.CharAt(posCheck - 1))) {
+		posCheck--;
+		if (posCheck == limit) {
+			const Sci::Position boundary = DBCSBlockBoundary(pos);
+			if (boundary >= 0) {
+				return boundary;
+			}
+		}
+	}
+	return posCheck;
+}
+
+/**
+ * Character boundary at start of the block containing pos (or previous block when the first
+ * boundary is after pos), computed from nearest known block or byte before a block that can't
+ * be lead byte. Returns -1 when the index is not available.
+ */
+Sci::Position Document::DBCSBlockBoundary(Sci::Position pos) const noexcept {
+	if (!dbcsIndex) {
+		return -1;
+	}
+	constexpr Sci::Position blockSize = DBCSBoundaryIndex::blockSize;
+	const LockGuard<NativeMutex> guard(dbcsIndex->mutex);
+	Sci::Position block = pos / blockSize;
+	if (block != 0 && block*blockSize + 1 > pos && dbcsIndex->Offset(block) != 0) {
+		// pos is block start, first boundary may be after it
+		block--;
+	}
+	Sci::Position first = block;
+	Sci::Position boundary = 0;
+	bool known = false;
+	while (first != 0) {
+		const int offset = dbcsIndex->Offset(first);
+		const Sci::Position start = first*blockSize;
+		if (offset >= 0) {
+			boundary = start + offset;
+			known = true;
+			break;
+		}
+		// step back until a non-lead-byte is found inside previous block
+		Sci::Position posCheck = start;
+		while (posCheck > start - blockSize && IsDBCSLeadByteNoExcept(cb.CharAt(posCheck - 1))) {
+			posCheck--;
+		}
+		if (posCheck > start - blockSize || posCheck == 0) {
+			boundary = posCheck;
+			break;
+		}
+		first--;
+	}
+	try {
+		for (Sci::Position index = first; index <= block; index++) {
+			const Sci::Position start = index*blockSize;
+			if (!(index == first && known)) {
+				while (boundary < start) {
+					boundary += IsDBCSDualByteAt(boundary) ? 2 : 1;
+				}
+				dbcsIndex->SetOffset(index, static_cast<int>(boundary - start));
+			}
+		}
+	} catch (...) {
+		// walk forward without saving offsets
+		return -1;
+	}
+	return boundary;
+}
+
 bool Document::NextCharacter(Sci::Position &pos, int moveDir) const noexcept {
 	// Returns true if pos changed
 	const Sci::Position posNext = NextPosition(pos, moveDir);
@@ -1058,9 +1447,29 @@ CharacterExtracted Document::CharacterBefore(Sci::Position position) const noexc
 	}
 }
 
+// Move forward over characterOffset characters (or UTF-16 code units) in bulk, return -1 on out-of-bounds.
+Sci::Position Document::MoveForwardUTF8(Sci::Position positionStart, Sci::Position characterOffset, bool utf16) const noexcept {
+	// first step moves out of the character when starting inside it
+	Sci::Position pos = NextPosition(positionStart, 1);
+	if (pos == positionStart) {
+		return Sci::invalidPosition;
+	}
+	Sci::Position remaining = characterOffset - ((utf16 && pos - positionStart == UTF8MaxBytes) ? 2 : 1);
+	if (remaining > 0) {
+		pos = cb.MoveCharactersUTF8(pos, remaining, utf16);
+	}
+	return (remaining == 0) ? pos : Sci::invalidPosition;
+}
+
 // Return -1  on out-of-bounds
 Sci_Position SCI_METHOD Document::GetRelativePosition(Sci_Position positionStart, Sci_Position characterOffset) const noexcept {
 	Sci::Position pos = positionStart;
+	if (UseCharacterIndex(positionStart, characterOffset)) {
+		return characterIndex->RelativePosition(cb, positionStart, characterOffset, false);
+	}
+	if (CpUtf8 == dbcsCodePage && characterOffset > 0) {
+		return MoveForwardUTF8(positionStart, characterOffset, false);
+	}
 	if (dbcsCodePage) {
 		const int increment = (characterOffset > 0) ? 1 : -1;
 		while (characterOffset != 0) {
@@ -1080,6 +1489,12 @@ Sci_Position SCI_METHOD Document::GetRelativePosition(Sci_Position positionStart
 
 Sci::Position Document::GetRelativePositionUTF16(Sci::Position positionStart, Sci::Position characterOffset) const noexcept {
 	Sci::Position pos = positionStart;
+	if (UseCharacterIndex(positionStart, characterOffset)) {
+		return characterIndex->RelativePosition(cb, positionStart, characterOffset, true);
+	}
+	if (CpUtf8 == dbcsCodePage && characterOffset > 0) {
+		return MoveForwardUTF8(positionStart, characterOffset, true);
+	}
 	if (dbcsCodePage) {
 		const int increment = (characterOffset > 0) ? 1 : -1;
 		while (characterOffset != 0) {
@@ -1295,6 +1710,8 @@ EncodingFamily Document::CodePageFamily() const noexcept {
 void Document::ModifiedAt(Sci::Position pos) noexcept {
 	if (endStyled > pos)
 		endStyled = pos;
+	if (endFolded > pos)
+		endFolded = pos;
 }
 
 void Document::CheckReadOnly() noexcept {
@@ -1362,23 +1779,6 @@ bool Document::DeleteChars(Sci::Position pos, Sci::Position len) {
 	return !cb.IsReadOnly();
 }
 
-namespace {
-
-struct WithoutPerLine {
-	CellBuffer *cb;
-	PerLine *pl;
-	constexpr WithoutPerLine(CellBuffer *cb_, PerLine *pl_) noexcept : cb(cb_), pl(pl_) {}
-	const char *InsertString(Sci::Position position, const char *s, Sci::Position insertLength, bool &startSequence) const {
-		cb->SetPerLine(nullptr);
-		return cb->InsertString(position, s, insertLength, startSequence);
-	}
-	~WithoutPerLine() {
-		cb->SetPerLine(pl);
-	}
-};
-
-}
-
 /**
  * Insert a string with a length.
  */
@@ -1449,6 +1849,37 @@ Sci::Position Document::InsertString(Sci::Position position, std::string_view sv
 	return InsertString(position, sv.data(), sv.length());
 }
 
+/**
+ * Replace a range with text as a single undo group. When number of lines is unchanged,
+ * per line data (markers, line states, etc.) stays on its line, also on undo and redo.
+ */
+Sci::Position Document::ReplaceRange(Sci::Position position, Sci::Position deleteLength, std::string_view text) {
+	const UndoGroup ug(this);
+	const int action = cb.UndoCurrent();
+	const Sci::Line prevLinesTotal = LinesTotal();
+	Sci::Position lengthInserted = 0;
+	{
+		const WithoutPerLine withoutPerLine(&cb, this);
+		DeleteChars(position, deleteLength);
+		lengthInserted = InsertString(position, text);
+	}
+	const Sci::Line linesAdded = LinesTotal() - prevLinesTotal;
+	if (linesAdded == 0) {
+		cb.SetUndoTransform(action);
+	} else {
+		// keep per line data in sync with lines, undo and redo will update it as usual
+		const Sci::Line line = SciLineFromPosition(position) + 1;
+		if (linesAdded > 0) {
+			InsertLines(line, linesAdded);
+		} else {
+			for (Sci::Line lineRemove = linesAdded; lineRemove < 0; lineRemove++) {
+				RemoveLine(line);
+			}
+		}
+	}
+	return lengthInserted;
+}
+
 void Document::ChangeInsertion(const char *s, Sci::Position length) {
 	insertionSet = true;
 	insertion.assign(s, length);
@@ -1470,6 +1901,25 @@ void * SCI_METHOD Document::ConvertToDocument() noexcept {
 	return AsDocumentEditable();
 }
 
+// Copy settings that affect how text is stored or edited from other document.
+void Document::CopyTextSettings(const Document &other) {
+	SetDBCSCodePage(other.dbcsCodePage);
+	SetLineEndTypesAllowed(other.lineEndBitSet);
+	eolMode = other.eolMode;
+	cb.SetUndoMemoryBudget(other.cb.UndoMemoryBudget());
+}
+
+// Take over text, styles and line starts of other document (this document must be empty),
+// other document is left empty. Used to change document options without copying the text.
+void Document::AdoptText(Document &other) {
+	CopyTextSettings(other);
+	const Sci::Position length = other.LengthNoExcept();
+	cb.AdoptText(other.cb);
+	other.decorations->DeleteRange(0, length);
+	decorations->InsertSpace(0, length);
+	other.endStyled = 0;
+}
+
 Sci::Position Document::Undo() {
 	Sci::Position newPos = -1;
 	CheckReadOnly();
@@ -1478,8 +1928,12 @@ Sci::Position Document::Undo() {
 		if (!cb.IsReadOnly()) {
 			const bool startSavePoint = cb.IsSavePoint();
 			bool multiLine = false;
-			const int steps = cb.StartUndo();
+			int steps = cb.StartUndo();
 			//Platform::DebugPrintf("Steps=%d\n", steps);
+			if (steps >= coalescedReplaySteps) {
+				newPos = ReplayCoalesced(steps, false);
+				steps = 0;
+			}
 			Range coalescedRemove;	// Default is empty at 0
 			for (int step = 0; step < steps; step++) {
 				const Sci::Line prevLinesTotal = LinesTotal();
@@ -1495,7 +1949,12 @@ Sci::Position Document::Undo() {
 					NotifyModified(DocModification(
 						ModificationFlags::BeforeDelete | ModificationFlags::Undo, action));
 				}
-				cb.PerformUndoStep();
+				if (action.transform) {
+					const WithoutPerLine withoutPerLine(&cb, this);
+					cb.PerformUndoStep();
+				} else {
+					cb.PerformUndoStep();
+				}
 				if (action.at != ActionType::container) {
 					if ((action.at == ActionType::insert) && (action.position >= LengthNoExcept()) && (action.position > 0))
 						ModifiedAt(action.position - 1);
@@ -1550,7 +2009,11 @@ Sci::Position Document::Redo() {
 		if (!cb.IsReadOnly()) {
 			const bool startSavePoint = cb.IsSavePoint();
 			bool multiLine = false;
-			const int steps = cb.StartRedo();
+			int steps = cb.StartRedo();
+			if (steps >= coalescedReplaySteps) {
+				newPos = ReplayCoalesced(steps, true);
+				steps = 0;
+			}
 			for (int step = 0; step < steps; step++) {
 				const Sci::Line prevLinesTotal = LinesTotal();
 				const Action action = cb.GetRedoStep();
@@ -1565,7 +2028,12 @@ Sci::Position Document::Redo() {
 					NotifyModified(DocModification(
 						ModificationFlags::BeforeDelete | ModificationFlags::Redo, action));
 				}
-				cb.PerformRedoStep();
+				if (action.transform) {
+					const WithoutPerLine withoutPerLine(&cb, this);
+					cb.PerformRedoStep();
+				} else {
+					cb.PerformRedoStep();
+				}
 				if (action.at != ActionType::container) {
 					ModifiedAt(action.position);
 					newPos = action.position;
@@ -1602,6 +2070,113 @@ Sci::Position Document::Redo() {
 	return newPos;
 }
 
+bool Document::ReplaysCoalesced(bool redo) noexcept {
+	if (redo ? !cb.CanRedo() : !cb.CanUndo()) {
+		return false;
+	}
+	return (redo ? cb.StartRedo() : cb.StartUndo()) >= coalescedReplaySteps;
+}
+
+// Replay a large undo or redo group: text changes are still performed step by step, but indexes,
+// decorations and watchers are updated once for the whole changed range, reported as deletion of
+// the text before the group followed by insertion of the text after it.
+Sci::Position Document::ReplayCoalesced(int steps, bool redo) {
+	const ModificationFlags direction = redo ? ModificationFlags::Redo : ModificationFlags::Undo;
+	const Sci::Position lengthBefore = LengthNoExcept();
+	const Sci::Line linesBefore = LinesTotal();
+	// rebuilt lazily instead of being updated for every step
+	ReleaseIndexes();
+
+	Sci::Position newPos = -1;
+	Sci::Position changeStart = -1;
+	Sci::Position changeEnd = -1;
+	bool multiLine = false;
+	Range coalescedRemove;
+	for (int step = 0; step < steps; step++) {
+		const Action action = redo ? cb.GetRedoStep() : cb.GetUndoStep();
+		if (action.at == ActionType::container) {
+			DocModification dm(ModificationFlags::Container | direction);
+			dm.token = action.position;
+			NotifyModified(dm);
+			continue;
+		}
+
+		const Sci::Line prevLinesTotal = LinesTotal();
+		if (action.transform) {
+			const WithoutPerLine withoutPerLine(&cb, this);
+			if (redo) {
+				cb.PerformRedoStep();
+			} else {
+				cb.PerformUndoStep();
+			}
+		} else if (redo) {
+			cb.PerformRedoStep();
+		} else {
+			cb.PerformUndoStep();
+		}
+		if (LinesTotal() != prevLinesTotal) {
+			multiLine = true;
+		}
+
+		const Sci::Position position = action.position;
+		const Sci::Position length = action.lenData;
+		newPos = position;
+		// undo of a removal and redo of an insertion both insert text
+		if ((action.at == ActionType::insert) == redo) {
+			newPos += length;
+			if (!redo) {
+				if (coalescedRemove.Contains(position)) {
+					coalescedRemove.end += length;
+					newPos = coalescedRemove.end;
+				} else {
+					coalescedRemove = Range(position, position + length);
+				}
+			}
+			if (changeStart < 0) {
+				changeStart = position;
+				changeEnd = position + length;
+			} else {
+				const Sci::Position end = (changeEnd >= position) ? changeEnd + length : changeEnd;
+				changeStart = std::min(changeStart, position);
+				changeEnd = std::max(end, position + length);
+			}
+		} else {
+			coalescedRemove = Range();
+			if (changeStart < 0) {
+				changeStart = position;
+				changeEnd = position;
+			} else {
+				Sci::Position end = changeEnd;
+				if (end > position) {
+					end = std::max(end - length, position);
+				}
+				changeStart = std::min(changeStart, position);
+				changeEnd = std::max(end, position);
+			}
+		}
+	}
+
+	if (changeStart >= 0) {
+		const Sci::Position lengthAfter = changeEnd - changeStart;
+		const Sci::Line linesAfter = SciLineFromPosition(changeEnd) - SciLineFromPosition(changeStart);
+		const Sci::Line linesAdded = LinesTotal() - linesBefore;
+		if ((changeStart >= LengthNoExcept()) && (changeStart > 0))
+			ModifiedAt(changeStart - 1);
+		else
+			ModifiedAt(changeStart);
+
+		const ModificationFlags modFlags = direction | ModificationFlags::MultiStepUndoRedo;
+		NotifyModified(DocModification(modFlags | ModificationFlags::DeleteText, changeStart,
+			lengthAfter - (LengthNoExcept() - lengthBefore), linesAdded - linesAfter, nullptr));
+		ModificationFlags lastFlags = modFlags | ModificationFlags::InsertText | ModificationFlags::LastStepInUndoRedo;
+		if (multiLine)
+			lastFlags |= ModificationFlags::MultilineUndoRedo;
+		NotifyModified(DocModification(lastFlags, changeStart, lengthAfter, linesAfter,
+			RangePointer(changeStart, lengthAfter)));
+	}
+	return newPos;
+}
+
 void Document::EndUndoAction() noexcept {
 	cb.EndUndoAction();
 	if (UndoSequenceDepth() == 0) {
@@ -1687,12 +2262,83 @@ Sci::Position Document::GetLineIndentPosition(Sci::Line line) const noexcept {
 	return pos;
 }
 
+const LineColumnCache::Checkpoint *LineColumnCache::FindOffset(Sci::Position offset) const noexcept {
+	size_t index = std::min(static_cast<size_t>(offset / checkpointSize), checkpoints.size());
+	while (index != 0 && checkpoints[index - 1].offset > offset) {
+		--index;
+	}
+	return (index == 0) ? nullptr : &checkpoints[index - 1];
+}
+
+const LineColumnCache::Checkpoint *LineColumnCache::FindColumn(Sci::Position column) const noexcept {
+	const auto it = std::upper_bound(checkpoints.begin(), checkpoints.end(), column, [](Sci::Position value, const Checkpoint &checkpoint) noexcept {
+		return value < checkpoint.column;
+	});
+	return (it == checkpoints.begin()) ? nullptr : &*(it - 1);
+}
+
+LineColumnCache *Document::ColumnCacheForLine(Sci::Line line) const noexcept {
+	for (LineColumnCache &cache : columnCache) {
+		if (cache.line == line && cache.tabInChars == tabInChars && cache.dbcsCodePage == dbcsCodePage) {
+			return &cache;
+		}
+	}
+	LineColumnCache &cache = columnCache[columnCacheNext];
+	columnCacheNext = (columnCacheNext + 1) % columnCacheCount;
+	cache.Invalidate();
+	cache.line = line;
+	cache.tabInChars = tabInChars;
+	cache.dbcsCodePage = dbcsCodePage;
+	return &cache;
+}
+
+// checkpoints before modified position are still valid, lines after it are renumbered when lines added or removed.
+void Document::ColumnCacheModified(Sci::Position position, Sci::Line linesAdded) noexcept {
+	Sci::Line lineModified = -1;
+	for (LineColumnCache &cache : columnCache) {
+		if (cache.line < 0) {
+			continue;
+		}
+		if (lineModified < 0) {
+			lineModified = SciLineFromPosition(position);
+		}
+		if (cache.line > lineModified && linesAdded == 0) {
+			continue;
+		}
+		if (cache.line == lineModified && linesAdded == 0) {
+			const Sci::Position offset = position - LineStart(lineModified);
+			while (!cache.checkpoints.empty() && cache.checkpoints.back().offset > offset) {
+				cache.checkpoints.pop_back();
+			}
+		} else if (cache.line >= lineModified) {
+			cache.Invalidate();
+		}
+	}
+}
+
 Sci::Position Document::GetColumn(Sci::Position pos) const noexcept {
 	Sci::Position column = 0;
 	const Sci::Line line = SciLineFromPosition(pos);
 	if (IsValidIndex(line, LinesTotal())) {
 		const Sci::Position length = LengthNoExcept();
-		for (Sci::Position i = cb.LineStart(line); i < pos;) {
+		const Sci::Position lineStart = cb.LineStart(line);
+		Sci::Position i = lineStart;
+		LineColumnCache *cache = nullptr;
+		Sci::Position nextCheckpoint = length + 1;
+		if (pos - lineStart >= LineColumnCache::checkpointSize) {
+			cache = ColumnCacheForLine(line);
+			const LineColumnCache::Checkpoint *checkpoint = cache->FindOffset(pos - lineStart);
+			if (checkpoint) {
+				i = lineStart + checkpoint->offset;
+				column = checkpoint->column;
+			}
+			nextCheckpoint = lineStart + cache->NextOffset();
+		}
+		while (i < pos) {
+			if (i >= nextCheckpoint) {
+				cache->Add(i - lineStart, column);
+				nextCheckpoint = lineStart + cache->NextOffset();
+			}
 			const char ch = cb.CharAt(i);
 			if (ch == '\t') {
 				column = NextTab(column, tabInChars);
@@ -1715,39 +2361,149 @@ Sci::Position Document::GetColumn(Sci::Position pos) const noexcept {
 	return column;
 }
 
-Sci::Position Document::CountCharacters(Sci::Position startPos, Sci::Position endPos) const noexcept {
-	startPos = MovePositionOutsideChar(startPos, 1, false);
-	endPos = MovePositionOutsideChar(endPos, -1, false);
-	Sci::Position count = 0;
-	Sci::Position i = startPos;
-	while (i < endPos) {
-		count++;
-		i = NextPosition(i, 1);
+/**
+ * Build character block index for UTF-8 document created with DocumentOption::CharacterBlockIndex,
+ * returns whether counting is done with the index.
+ */
+bool Document::BuildCharacterIndex() noexcept {
+	if (characterIndex && CpUtf8 == dbcsCodePage) {
+		if (!characterIndex->Built()) {
+			characterIndex->Build(cb);
+		}
+		return characterIndex->Built();
 	}
-	return count;
+	return false;
+}
+
+/**
+ * Free search, character block and brace indexes, they are built again on next use.
+ */
+void Document::ReleaseIndexes() noexcept {
+	if (searchIndex) {
+		searchIndex->Clear();
+	}
+	if (characterIndex) {
+		characterIndex->Clear();
+	}
+	if (braceIndex) {
+		braceIndex->Clear();
+	}
+	if (dbcsIndex) {
+		dbcsIndex->Clear();
+	}
+}
+
+// stepping over many characters from a character boundary is replaced with index lookup.
+bool Document::UseCharacterIndex(Sci::Position position, Sci::Position characterOffset) const noexcept {
+	return characterIndex && CpUtf8 == dbcsCodePage && characterIndex->Built()
+		&& std::abs(characterOffset) >= CharacterBlockIndex::blockSize
+		&& MovePositionOutsideChar(position, 1, false) == position;
+}
+
+/**
+ * Count characters and UTF-16 code units inside [startPos, endPos), both must be at character boundary.
+ * Safe to be called from multiple threads on different ranges.
+ */
+void Document::CountCharactersAndUTF16(Sci::Position startPos, Sci::Position endPos, Sci::Position &countCharacters, Sci::Position &countUTF16) const noexcept {
+	if (!dbcsCodePage) {
+		countCharacters = endPos - startPos;
+		countUTF16 = countCharacters;
+		return;
+	}
+
+	if (CpUtf8 == dbcsCodePage) {
+		if (characterIndex && characterIndex->Built() && (endPos - startPos) >= 2*CharacterBlockIndex::blockSize) {
+			Sci::Position countStart;
+			Sci::Position countUTF16Start;
+			characterIndex->CountBefore(cb, startPos, countStart, countUTF16Start);
+			characterIndex->CountBefore(cb, endPos, countCharacters, countUTF16);
+			countCharacters -= countStart;
+			countUTF16 -= countUTF16Start;
+		} else {
+			Sci::Position countSupplementary = 0;
+			countCharacters = 0;
+			cb.CountCharactersUTF8(startPos, endPos, countCharacters, countSupplementary);
+			countUTF16 = countCharacters + countSupplementary;
+		}
+		return;
+	}
+
+	const SplitView cbView = cb.AllView();
+	const DBCSByteMask &byteMask = dbcsCharClass->GetByteMask();
+	Sci::Position count = 0;
+	Sci::Position pos = startPos;
+	while (pos < endPos) {
+		const unsigned char ch = cbView[pos];
+		// same as IsDBCSDualByteAt() without bound check for each byte
+		pos += (byteMask.IsLeadByte(ch) && byteMask.IsTrailByte(cbView.CharAt(pos + 1))) ? 2 : 1;
+		count++;
+	}
+	countCharacters = count;
+	countUTF16 = count;
 }
 
+Sci::Position Document::CountCharacters(Sci::Position startPos, Sci::Position endPos) const noexcept {
+	startPos = MovePositionOutsideChar(startPos, 1, false);
+	endPos = MovePositionOutsideChar(endPos, -1, false);
+	Sci::Position count = 0;
+	Sci::Position countUTF16 = 0;
+	if (startPos < endPos) {
+		CountCharactersAndUTF16(startPos, endPos, count, countUTF16);
+	}
+	return count;
+}
+
+namespace {
+
+// find tab inside [pos, endPos), returns endPos when not found.
+Sci::Position FindTab(const SplitView &cbView, Sci::Position pos, Sci::Position endPos) noexcept {
+	if (pos < static_cast<Sci::Position>(cbView.length1)) {
+		const Sci::Position last = std::min<Sci::Position>(endPos, cbView.length1);
+		const char *tab = static_cast<const char *>(memchr(cbView.segment1 + pos, '\t', last - pos));
+		if (tab) {
+			return tab - cbView.segment1;
+		}
+		pos = last;
+	}
+	if (pos < endPos) {
+		const char *tab = static_cast<const char *>(memchr(cbView.segment2 + pos, '\t', endPos - pos));
+		if (tab) {
+			return tab - cbView.segment2;
+		}
+	}
+	return endPos;
+}
+
+}
+
+/**
+ * Count characters and columns inside [chrg.cpMin, chrg.cpMax), continue from count and column in chrgText.
+ * Text between tabs is counted in bulk, as each character other than tab takes one column.
+ */
 void Document::CountCharactersAndColumns(sptr_t lParam) const noexcept {
 	TextToFindFull *ft = AsPointer<TextToFindFull *>(lParam);
 	const Sci::Position startPos = ft->chrg.cpMin;
-	const Sci::Position endPos = ft->chrg.cpMax;
+	const Sci::Position endPos = std::min<Sci::Position>(ft->chrg.cpMax, LengthNoExcept());
 	Sci::Position count = ft->chrgText.cpMin;
 	Sci::Position column = ft->chrgText.cpMax;
 
-	Sci::Position i = startPos;
-	while (i < endPos) {
-		const unsigned char ch = cb.UCharAt(i);
-		if (ch == '\t') {
+	const SplitView cbView = cb.AllView();
+	Sci::Position pos = startPos;
+	while (pos < endPos) {
+		// tab is never part of a multi-byte character
+		const Sci::Position tab = FindTab(cbView, pos, endPos);
+		if (pos < tab) {
+			Sci::Position countRun = 0;
+			Sci::Position countUTF16 = 0;
+			CountCharactersAndUTF16(pos, tab, countRun, countUTF16);
+			count += countRun;
+			column += countRun;
+		}
+		if (tab < endPos) {
 			column = NextTab(column, tabInChars);
-			i++;
-		} else if (UTF8IsAscii(ch)) {
-			column++;
-			i++;
-		} else {
-			column++;
-			i = NextPosition(i, 1);
+			count++;
 		}
-		count++;
+		pos = tab + 1;
 	}
 
 	ft->chrgText.cpMin = count;
@@ -1758,23 +2514,36 @@ Sci::Position Document::CountUTF16(Sci::Position startPos, Sci::Position endPos)
 	startPos = MovePositionOutsideChar(startPos, 1, false);
 	endPos = MovePositionOutsideChar(endPos, -1, false);
 	Sci::Position count = 0;
-	Sci::Position i = startPos;
-	while (i < endPos) {
-		count++;
-		const Sci::Position next = NextPosition(i, 1);
-		if ((next - i) > 3)
-			count++;
-		i = next;
+	Sci::Position countUTF16 = 0;
+	if (startPos < endPos) {
+		CountCharactersAndUTF16(startPos, endPos, count, countUTF16);
 	}
-	return count;
+	return countUTF16;
 }
 
 Sci::Position Document::FindColumn(Sci::Line line, Sci::Position column) const noexcept {
 	Sci::Position position = LineStart(line);
 	if (IsValidIndex(line, LinesTotal())) {
 		const Sci::Position length = LengthNoExcept();
+		const Sci::Position lineStart = position;
 		Sci::Position columnCurrent = 0;
+		LineColumnCache *cache = nullptr;
+		Sci::Position nextCheckpoint = length + 1;
+		// column is not less than bytes before it
+		if (column >= LineColumnCache::checkpointSize) {
+			cache = ColumnCacheForLine(line);
+			const LineColumnCache::Checkpoint *checkpoint = cache->FindColumn(column);
+			if (checkpoint) {
+				position = lineStart + checkpoint->offset;
+				columnCurrent = checkpoint->column;
+			}
+			nextCheckpoint = lineStart + cache->NextOffset();
+		}
 		while ((columnCurrent < column) && (position < length)) {
+			if (position >= nextCheckpoint) {
+				cache->Add(position - lineStart, columnCurrent);
+				nextCheckpoint = lineStart + cache->NextOffset();
+			}
 			const char ch = cb.CharAt(position);
 			if (ch == '\t') {
 				columnCurrent = NextTab(columnCurrent, tabInChars);
@@ -1828,57 +2597,112 @@ constexpr std::string_view EOLForMode(EndOfLine eolMode) noexcept {
 
 // Convert line endings for a piece of text to a particular mode.
 // Stop at len or when a NUL is found.
+namespace {
+
+// find CR or LF inside [ptr, end), returns end when not found.
+const char *FindLineEndChar(const char *ptr, const char *end) noexcept {
+#if NP2_USE_AVX2
+	const __m256i vectCR = _mm256_set1_epi8('\r');
+	const __m256i vectLF = _mm256_set1_epi8('\n');
+	while (ptr + sizeof(__m256i) <= end) {
+		const __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(ptr));
+		const uint32_t mask = mm256_movemask_epi8(_mm256_or_si256(_mm256_cmpeq_epi8(chunk, vectCR), _mm256_cmpeq_epi8(chunk, vectLF)));
+		if (mask) {
+			return ptr + np2::ctz(mask);
+		}
+		ptr += sizeof(__m256i);
+	}
+	// end NP2_USE_AVX2
+#elif NP2_USE_SSE2
+	const __m128i vectCR = _mm_set1_epi8('\r');
+	const __m128i vectLF = _mm_set1_epi8('\n');
+	while (ptr + sizeof(__m128i) <= end) {
+		const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i *>(ptr));
+		const uint32_t mask = mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(chunk, vectCR), _mm_cmpeq_epi8(chunk, vectLF)));
+		if (mask) {
+			return ptr + np2::ctz(mask);
+		}
+		ptr += sizeof(__m128i);
+	}
+	// end NP2_USE_SSE2
+#endif
+	while (ptr < end && !IsEOLCharacter(*ptr)) {
+		ptr++;
+	}
+	return ptr;
+}
+
+// find CR or LF inside [pos, endPos), returns endPos when not found.
+Sci::Position FindLineEndChar(const SplitView &cbView, Sci::Position pos, Sci::Position endPos) noexcept {
+	if (pos < static_cast<Sci::Position>(cbView.length1)) {
+		const Sci::Position last = std::min<Sci::Position>(endPos, cbView.length1);
+		const char * const ptr = FindLineEndChar(cbView.segment1 + pos, cbView.segment1 + last);
+		pos = ptr - cbView.segment1;
+		if (pos < last) {
+			return pos;
+		}
+	}
+	if (pos < endPos) {
+		const char * const ptr = FindLineEndChar(cbView.segment2 + pos, cbView.segment2 + endPos);
+		pos = ptr - cbView.segment2;
+	}
+	return pos;
+}
+
+}
+
 std::string Document::TransformLineEnds(const char *s, size_t len, EndOfLine eolModeWanted) {
-	std::string dest;
 	const std::string_view eol = EOLForMode(eolModeWanted);
-	for (size_t i = 0; (i < len) && (s[i]); i++) {
-		if (IsEOLCharacter(s[i])) {
-			dest.append(eol);
-			if ((s[i] == '\r') && (i + 1 < len) && (s[i + 1] == '\n')) {
-				i++;
-			}
-		} else {
-			dest.push_back(s[i]);
+	const char * const end = s + strnlen(s, len);
+	std::string dest;
+	dest.reserve(end - s);
+	while (s < end) {
+		const char * const ptr = FindLineEndChar(s, end);
+		dest.append(s, ptr);
+		if (ptr == end) {
+			break;
+		}
+		dest.append(eol);
+		s = ptr + 1;
+		if (*ptr == '\r' && s < end && *s == '\n') {
+			s++;
 		}
 	}
 	return dest;
 }
 
 void Document::ConvertLineEnds(EndOfLine eolModeSet) {
-	const UndoGroup ug(this);
-
-	for (Sci::Position pos = 0; pos < LengthNoExcept(); pos++) {
-		const char ch = cb.CharAt(pos);
-		if (ch == '\r') {
-			if (cb.CharAt(pos + 1) == '\n') {
-				// CRLF
-				if (eolModeSet == EndOfLine::Cr) {
-					DeleteChars(pos + 1, 1); // Delete the LF
-				} else if (eolModeSet == EndOfLine::Lf) {
-					DeleteChars(pos, 1); // Delete the CR
-				} else {
-					pos++;
-				}
+	// build converted text from first to last changed line end, then replace it as one block,
+	// instead of an insertion or deletion (and undo action) for every line.
+	// CR and LF are found by scanning the text directly, Unicode line ends are kept.
+	const std::string_view eol = EOLForMode(eolModeSet);
+	const SplitView cbView = cb.AllView();
+	const Sci::Position length = LengthNoExcept();
+	Sci::Position start = -1;
+	Sci::Position end = 0;
+	Sci::Position pos = 0;
+	std::string converted;
+	while ((pos = FindLineEndChar(cbView, pos, length)) < length) {
+		const char ch = cbView[pos];
+		Sci::Position next = pos + 1;
+		if (ch == '\r' && cbView.CharAt(next) == '\n') {
+			next++;
+		}
+		if (ch != eol.front() || static_cast<size_t>(next - pos) != eol.length()) {
+			if (start < 0) {
+				start = pos;
 			} else {
-				// CR
-				if (eolModeSet == EndOfLine::CrLf) {
-					pos += InsertString(pos + 1, "\n", 1); // Insert LF
-				} else if (eolModeSet == EndOfLine::Lf) {
-					pos += InsertString(pos, "\n", 1); // Insert LF
-					DeleteChars(pos, 1); // Delete CR
-					pos--;
-				}
-			}
-		} else if (ch == '\n') {
-			// LF
-			if (eolModeSet == EndOfLine::CrLf) {
-				pos += InsertString(pos, "\r", 1); // Insert CR
-			} else if (eolModeSet == EndOfLine::Cr) {
-				pos += InsertString(pos, "\r", 1); // Insert CR
-				DeleteChars(pos, 1); // Delete LF
-				pos--;
+				const size_t offset = converted.length();
+				converted.resize(offset + pos - end);
+				cb.GetCharRange(converted.data() + offset, end, pos - end);
 			}
+			converted += eol;
+			end = next;
 		}
+		pos = next;
+	}
+	if (start >= 0) {
+		ReplaceRange(start, end - start, converted);
 	}
 }
 
@@ -1888,7 +2712,11 @@ std::string_view Document::EOLString() const noexcept {
 
 DocumentOption Document::Options() const noexcept {
 	return (IsLarge() ? DocumentOption::TextLarge : DocumentOption::Default) |
-		(cb.HasStyles() ? DocumentOption::Default : DocumentOption::StylesNone);
+		(cb.HasStyles() ? DocumentOption::Default : DocumentOption::StylesNone) |
+		(cb.HasStyleRuns() ? DocumentOption::StylesRuns : DocumentOption::Default) |
+		(searchIndex ? DocumentOption::SearchIndex : DocumentOption::Default) |
+		(characterIndex ? DocumentOption::CharacterBlockIndex : DocumentOption::Default) |
+		(braceIndex ? DocumentOption::BraceIndex : DocumentOption::Default);
 }
 
 bool Document::IsWhiteLine(Sci::Line line) const noexcept {
@@ -1945,6 +2773,51 @@ CharacterClass SCI_METHOD Document::GetCharacterClass(unsigned int ch) const noe
 	return charClass.GetClass(static_cast<unsigned char>(ch));
 }
 
+/**
+ * Skip characters of class ccSkip forwards (delta >= 0) or backwards (delta < 0) from pos.
+ * Single byte characters are classified directly from the text without extracting character,
+ * byte before pos in DBCS may be trail byte of a double byte character.
+ */
+Sci::Position Document::SkipCharacterClass(Sci::Position pos, CharacterClass ccSkip, int delta) const noexcept {
+	const SplitView cbView = cb.AllView();
+	if (delta < 0) {
+		const bool asciiBefore = CpUtf8 == dbcsCodePage;
+		while (pos > 0) {
+			const unsigned char ch = cbView[pos - 1];
+			if (!dbcsCodePage || (asciiBefore && UTF8IsAscii(ch))) {
+				if (charClass.GetClass(ch) != ccSkip) {
+					break;
+				}
+				pos--;
+			} else {
+				const CharacterExtracted ce = CharacterBefore(pos);
+				if (WordCharacterClass(ce.character) != ccSkip) {
+					break;
+				}
+				pos -= ce.widthBytes;
+			}
+		}
+	} else {
+		const Sci::Position length = LengthNoExcept();
+		while (pos < length) {
+			const unsigned char ch = cbView[pos];
+			if (!dbcsCodePage || UTF8IsAscii(ch)) {
+				if (charClass.GetClass(ch) != ccSkip) {
+					break;
+				}
+				pos++;
+			} else {
+				const CharacterExtracted ce = CharacterAfter(pos);
+				if (WordCharacterClass(ce.character) != ccSkip) {
+					break;
+				}
+				pos += ce.widthBytes;
+			}
+		}
+	}
+	return pos;
+}
+
 /**
  * Used by commands that want to select whole words.
  * Finds the start of word at pos when delta < 0 or the end of the word when delta >= 0.
@@ -1962,13 +2835,7 @@ Sci::Position Document::ExtendWordSelect(Sci::Position pos, int delta, bool only
 				return MovePositionOutsideChar(pos, delta, true);
 			}
 		}
-		//const int style = StyleIndexAt(pos);
-		while (pos > 0) {
-			const CharacterExtracted ce = CharacterBefore(pos);
-			if (/*StyleIndexAt(pos - 1) != style || */WordCharacterClass(ce.character) != ccStart)
-				break;
-			pos -= ce.widthBytes;
-		}
+		pos = SkipCharacterClass(pos, ccStart, delta);
 	} else {
 		if (pos < LengthNoExcept()) {
 			const CharacterExtracted ce = CharacterAfter(pos);
@@ -1980,13 +2847,7 @@ Sci::Position Document::ExtendWordSelect(Sci::Position pos, int delta, bool only
 				return MovePositionOutsideChar(pos, delta, true);
 			}
 		}
-		//const int style = StyleIndexAt(pos - 1);
-		while (pos < LengthNoExcept()) {
-			const CharacterExtracted ce = CharacterAfter(pos);
-			if (/*StyleIndexAt(pos) != style || */WordCharacterClass(ce.character) != ccStart)
-				break;
-			pos += ce.widthBytes;
-		}
+		pos = SkipCharacterClass(pos, ccStart, delta);
 	}
 	return MovePositionOutsideChar(pos, delta, true);
 }
@@ -2000,37 +2861,17 @@ Sci::Position Document::ExtendWordSelect(Sci::Position pos, int delta, bool only
  */
 Sci::Position Document::NextWordStart(Sci::Position pos, int delta) const noexcept {
 	if (delta < 0) {
-		while (pos > 0) {
-			const CharacterExtracted ce = CharacterBefore(pos);
-			if (WordCharacterClass(ce.character) != CharacterClass::space)
-				break;
-			pos -= ce.widthBytes;
-		}
+		pos = SkipCharacterClass(pos, CharacterClass::space, delta);
 		if (pos > 0) {
-			CharacterExtracted ce = CharacterBefore(pos);
-			const CharacterClass ccStart = WordCharacterClass(ce.character);
-			while (pos > 0) {
-				ce = CharacterBefore(pos);
-				if (WordCharacterClass(ce.character) != ccStart)
-					break;
-				pos -= ce.widthBytes;
-			}
+			const CharacterClass ccStart = WordCharacterClass(CharacterBefore(pos).character);
+			pos = SkipCharacterClass(pos, ccStart, delta);
 		}
 	} else {
-		CharacterExtracted ce = CharacterAfter(pos);
-		const CharacterClass ccStart = WordCharacterClass(ce.character);
-		while (pos < LengthNoExcept()) {
-			ce = CharacterAfter(pos);
-			if (WordCharacterClass(ce.character) != ccStart)
-				break;
-			pos += ce.widthBytes;
-		}
-		while (pos < LengthNoExcept()) {
-			ce = CharacterAfter(pos);
-			if (WordCharacterClass(ce.character) != CharacterClass::space)
-				break;
-			pos += ce.widthBytes;
+		if (pos < LengthNoExcept()) {
+			const CharacterClass ccStart = WordCharacterClass(CharacterAfter(pos).character);
+			pos = SkipCharacterClass(pos, ccStart, delta);
 		}
+		pos = SkipCharacterClass(pos, CharacterClass::space, delta);
 	}
 	return pos;
 }
@@ -2045,39 +2886,17 @@ Sci::Position Document::NextWordStart(Sci::Position pos, int delta) const noexce
 Sci::Position Document::NextWordEnd(Sci::Position pos, int delta) const noexcept {
 	if (delta < 0) {
 		if (pos > 0) {
-			CharacterExtracted ce = CharacterBefore(pos);
-			const CharacterClass ccStart = WordCharacterClass(ce.character);
+			const CharacterClass ccStart = WordCharacterClass(CharacterBefore(pos).character);
 			if (ccStart != CharacterClass::space) {
-				while (pos > 0) {
-					ce = CharacterBefore(pos);
-					if (WordCharacterClass(ce.character) != ccStart)
-						break;
-					pos -= ce.widthBytes;
-				}
-			}
-			while (pos > 0) {
-				ce = CharacterBefore(pos);
-				if (WordCharacterClass(ce.character) != CharacterClass::space)
-					break;
-				pos -= ce.widthBytes;
+				pos = SkipCharacterClass(pos, ccStart, delta);
 			}
+			pos = SkipCharacterClass(pos, CharacterClass::space, delta);
 		}
 	} else {
-		while (pos < LengthNoExcept()) {
-			const CharacterExtracted ce = CharacterAfter(pos);
-			if (WordCharacterClass(ce.character) != CharacterClass::space)
-				break;
-			pos += ce.widthBytes;
-		}
+		pos = SkipCharacterClass(pos, CharacterClass::space, delta);
 		if (pos < LengthNoExcept()) {
-			CharacterExtracted ce = CharacterAfter(pos);
-			const CharacterClass ccStart = WordCharacterClass(ce.character);
-			while (pos < LengthNoExcept()) {
-				ce = CharacterAfter(pos);
-				if (WordCharacterClass(ce.character) != ccStart)
-					break;
-				pos += ce.widthBytes;
-			}
+			const CharacterClass ccStart = WordCharacterClass(CharacterAfter(pos).character);
+			pos = SkipCharacterClass(pos, ccStart, delta);
 		}
 	}
 	return pos;
@@ -2126,6 +2945,157 @@ public:
 	}
 };
 
+// Find first match of needle that starts inside [first, last), the needle must fit in the
+// segment for every start position, i.e. last + length - 1 is not past the segment end.
+// Generic SIMD algorithm: compare first and last byte of the needle for a block of start
+// positions, then verify candidates with memcmp.
+// http://0x80.pl/articles/simd-strfind.html
+const char *SearchLiteral(const char *first, const char *last, const char *needle, size_t length) noexcept {
+	const char chFirst = needle[0];
+	if (length == 1) {
+		return static_cast<const char *>(memchr(first, static_cast<unsigned char>(chFirst), last - first));
+	}
+
+	const char chLast = needle[length - 1];
+	const size_t lengthMiddle = length - 2;
+#if NP2_USE_AVX2
+	const __m256i mmFirst = mm256_set1_epi8(chFirst);
+	const __m256i mmLast = mm256_set1_epi8(chLast);
+	while (first + sizeof(__m256i) <= last) {
+		const __m256i chunkFirst = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(first));
+		const __m256i chunkLast = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(first + length - 1));
+		uint32_t mask = mm256_movemask_epi8(_mm256_and_si256(_mm256_cmpeq_epi8(chunkFirst, mmFirst), _mm256_cmpeq_epi8(chunkLast, mmLast)));
+		while (mask) {
+			const char * const ptr = first + np2::ctz(mask);
+			if (memcmp(ptr + 1, needle + 1, lengthMiddle) == 0) {
+				return ptr;
+			}
+			mask &= mask - 1;
+		}
+		first += sizeof(__m256i);
+	}
+	// end NP2_USE_AVX2
+#elif NP2_USE_SSE2
+	const __m128i mmFirst = _mm_set1_epi8(chFirst);
+	const __m128i mmLast = _mm_set1_epi8(chLast);
+	while (first + sizeof(__m128i) <= last) {
+		const __m128i chunkFirst = _mm_loadu_si128(reinterpret_cast<const __m128i *>(first));
+		const __m128i chunkLast = _mm_loadu_si128(reinterpret_cast<const __m128i *>(first + length - 1));
+		uint32_t mask = mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(chunkFirst, mmFirst), _mm_cmpeq_epi8(chunkLast, mmLast)));
+		while (mask) {
+			const char * const ptr = first + np2::ctz(mask);
+			if (memcmp(ptr + 1, needle + 1, lengthMiddle) == 0) {
+				return ptr;
+			}
+			mask &= mask - 1;
+		}
+		first += sizeof(__m128i);
+	}
+	// end NP2_USE_SSE2
+#endif
+	while (first < last) {
+		if (first[0] == chFirst && first[length - 1] == chLast && memcmp(first + 1, needle + 1, lengthMiddle) == 0) {
+			return first;
+		}
+		first++;
+	}
+	return nullptr;
+}
+
+// Find first match of needle that starts inside [pos, endSearch] of the document,
+// search first (before gap) and second segment directly, check matches across the gap byte by byte.
+Sci::Position SearchLiteral(const SplitView &cbView, Sci::Position pos, Sci::Position endSearch, const char *needle, Sci::Position length) noexcept {
+	const Sci::Position segmentLength = cbView.length1;
+	while (pos <= endSearch) {
+		if (pos >= segmentLength || pos + length <= segmentLength) {
+			const bool scanFirst = pos < segmentLength;
+			const char * const segment = scanFirst ? cbView.segment1 : cbView.segment2;
+			const Sci::Position last = scanFirst ? std::min(endSearch, segmentLength - length) : endSearch;
+			const char * const ptr = SearchLiteral(segment + pos, segment + last + 1, needle, length);
+			if (ptr != nullptr) {
+				return ptr - segment;
+			}
+			pos = last + 1;
+		} else {
+			Sci::Position indexSearch = 0;
+			while (indexSearch < length && cbView[pos + indexSearch] == needle[indexSearch]) {
+				indexSearch++;
+			}
+			if (indexSearch == length) {
+				return pos;
+			}
+			pos++;
+		}
+	}
+	return -1;
+}
+
+// Skip positions that can't start a case insensitive match: ASCII byte that differs from
+// first byte of the folded needle. ASCII letters fold to lower case, so a letter is compared
+// after OR 0x20. Any non-ASCII byte must be checked with the case folder.
+class CaseInsensitivePrefilter {
+	const char chFolded;
+	const char orMask;
+public:
+	explicit CaseInsensitivePrefilter(unsigned char ch) noexcept : chFolded(ch), orMask(IsLowerCase(ch) ? 0x20 : 0) {}
+	const char *Find(const char *first, const char *last) const noexcept;
+	Sci::Position Next(const SplitView &cbView, Sci::Position pos, Sci::Position endPos) const noexcept;
+};
+
+const char *CaseInsensitivePrefilter::Find(const char *first, const char *last) const noexcept {
+#if NP2_USE_AVX2
+	const __m256i mmFolded = mm256_set1_epi8(chFolded);
+	const __m256i mmOrMask = mm256_set1_epi8(orMask);
+	while (first + sizeof(__m256i) <= last) {
+		const __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(first));
+		const __m256i result = _mm256_cmpeq_epi8(_mm256_or_si256(chunk, mmOrMask), mmFolded);
+		const uint32_t mask = mm256_movemask_epi8(_mm256_or_si256(result, chunk));
+		if (mask) {
+			return first + np2::ctz(mask);
+		}
+		first += sizeof(__m256i);
+	}
+	// end NP2_USE_AVX2
+#elif NP2_USE_SSE2
+	const __m128i mmFolded = _mm_set1_epi8(chFolded);
+	const __m128i mmOrMask = _mm_set1_epi8(orMask);
+	while (first + sizeof(__m128i) <= last) {
+		const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i *>(first));
+		const __m128i result = _mm_cmpeq_epi8(_mm_or_si128(chunk, mmOrMask), mmFolded);
+		const uint32_t mask = mm_movemask_epi8(_mm_or_si128(result, chunk));
+		if (mask) {
+			return first + np2::ctz(mask);
+		}
+		first += sizeof(__m128i);
+	}
+	// end NP2_USE_SSE2
+#endif
+	while (first < last) {
+		const char ch = *first;
+		if (!UTF8IsAscii(ch) || (ch | orMask) == chFolded) {
+			return first;
+		}
+		first++;
+	}
+	return last;
+}
+
+// only skip single byte characters, returned position is still at character boundary.
+Sci::Position CaseInsensitivePrefilter::Next(const SplitView &cbView, Sci::Position pos, Sci::Position endPos) const noexcept {
+	const Sci::Position segmentLength = cbView.length1;
+	if (pos < segmentLength) {
+		const Sci::Position end = std::min(endPos, segmentLength);
+		pos = Find(cbView.segment1 + pos, cbView.segment1 + end) - cbView.segment1;
+		if (pos < end) {
+			return pos;
+		}
+	}
+	if (pos < endPos) {
+		pos = Find(cbView.segment2 + pos, cbView.segment2 + endPos) - cbView.segment2;
+	}
+	return pos;
+}
+
 }
 
 /**
@@ -2226,6 +3196,41 @@ void Document::ExtractCharacter(Sci::Position position, CharacterWideInfo &charI
 	}
 }
 
+/**
+ * Build trigram index for document created with DocumentOption::SearchIndex,
+ * must be called before searching the document from multiple threads.
+ */
+void Document::BuildSearchIndex() noexcept {
+	if (searchIndex && !searchIndex->Built()) {
+		searchIndex->Build(cb);
+	}
+}
+
+/**
+ * Find bytes of text inside [pos, endPos), returns -1 when not found.
+ * Used by regex search to locate literal part of the pattern.
+ */
+Sci::Position Document::FindLiteral(Sci::Position pos, Sci::Position endPos, const char *text, Sci::Position length) const noexcept {
+	const SplitView cbView = cb.AllView();
+	const Sci::Position endSearch = endPos - length;
+	if (length >= 3 && searchIndex && searchIndex->Built()) {
+		// only search blocks that contain all trigrams of text
+		while (pos <= endSearch) {
+			Sci::Position last = endSearch;
+			if (!searchIndex->NextCandidate(pos, last, text, length)) {
+				break;
+			}
+			const Sci::Position found = SearchLiteral(cbView, pos, last, text, length);
+			if (found >= 0) {
+				return found;
+			}
+			pos = last + 1;
+		}
+		return -1;
+	}
+	return SearchLiteral(cbView, pos, endSearch, text, length);
+}
+
 /**
  * Find text in document, supporting both forward and backward
  * searches (just pass minPos > maxPos to do a backward search)
@@ -2235,6 +3240,7 @@ Sci::Position Document::FindText(Sci::Position minPos, Sci::Position maxPos, con
 	if (*length <= 0) {
 		return minPos;
 	}
+	BuildSearchIndex();
 	if (FlagSet(flags, FindOption::RegExp)) {
 		if (!regex) {
 			regex = std::unique_ptr<RegexSearchBase>(CreateRegexSearch(&charClass));
@@ -2267,7 +3273,21 @@ Sci::Position Document::FindText(Sci::Position minPos, Sci::Position maxPos, con
 		}
 		const SplitView cbView = cb.AllView();
 		SearchThing searchThing;
-		if (FlagSet(flags, FindOption::MatchCase)) {
+		if (FlagSet(flags, FindOption::MatchCase) && direction >= 0
+			&& (!dbcsCodePage || (CpUtf8 == dbcsCodePage && !UTF8IsTrailByte(static_cast<unsigned char>(search[0]))))) {
+			// byte match is always at character boundary, as the needle doesn't start with trail byte.
+			const Sci::Position endSearch = endPos - lengthFind;
+			while (pos <= endSearch) {
+				pos = FindLiteral(pos, endPos, search, lengthFind);
+				if (pos < 0) {
+					break;
+				}
+				if (MatchesWordOptions(flags, pos, lengthFind)) {
+					return pos;
+				}
+				pos++;
+			}
+		} else if (FlagSet(flags, FindOption::MatchCase)) {
 			const unsigned char * const searchData = reinterpret_cast<const unsigned char *>(search);
 			// Boyer-Moore-Horspool-Sunday Algorithm / Quick Search Algorithm
 			// https://www-igm.univ-mlv.fr/~lecroq/string/index.html
@@ -2339,8 +3359,15 @@ Sci::Position Document::FindText(Sci::Position minPos, Sci::Position maxPos, con
 			searchThing.Allocate((lengthFind + UTF8MaxBytes) * maxFoldingExpansion + 1);
 			const size_t lenSearch = pcf->Fold(searchThing.data(), searchThing.size(), search, lengthFind);
 			const unsigned char * const searchData = reinterpret_cast<const unsigned char *>(searchThing.data());
+			const CaseInsensitivePrefilter prefilter(searchData[0]);
 			//while (forward ? (pos < endPos) : (pos >= endPos)) {
 			while ((direction ^ (pos - endPos)) < 0) {
+				if (direction >= 0) {
+					pos = prefilter.Next(cbView, pos, endPos);
+					if (pos >= endPos) {
+						break;
+					}
+				}
 				int widthFirstCharacter = 1;
 				Sci::Position posIndexDocument = pos;
 				size_t indexSearch = 0;
@@ -2403,8 +3430,16 @@ Sci::Position Document::FindText(Sci::Position minPos, Sci::Position maxPos, con
 			const CaseFolderTable * const folder = down_cast<CaseFolderTable *>(pcf.get());
 			const size_t lenSearch = folder->Fold(searchThing.data(), searchThing.size(), search, lengthFind);
 			const unsigned char * const searchData = reinterpret_cast<const unsigned char *>(searchThing.data());
+			// ASCII byte at character boundary is always single byte character
+			const CaseInsensitivePrefilter prefilter(searchData[0]);
 			//while (forward ? (pos < endPos) : (pos >= endPos)) {
 			while ((direction ^ (pos - endPos)) < 0) {
+				if (direction >= 0) {
+					pos = prefilter.Next(cbView, pos, endPos);
+					if (pos >= endPos) {
+						break;
+					}
+				}
 				int widthFirstCharacter = 1;
 				Sci::Position indexDocument = pos;
 				size_t indexSearch = 0;
@@ -2471,8 +3506,15 @@ Sci::Position Document::FindText(Sci::Position minPos, Sci::Position maxPos, con
 			const CaseFolderTable * const folder = down_cast<CaseFolderTable *>(pcf.get());
 			folder->Fold(searchThing.data(), searchThing.size(), search, lengthFind);
 			const char * const searchData = searchThing.data();
+			const CaseInsensitivePrefilter prefilter(searchData[0]);
 			//while (forward ? (pos < endSearch) : (pos >= endSearch)) {
 			while ((direction ^ (pos - endSearch)) < 0) {
+				if (direction >= 0) {
+					pos = prefilter.Next(cbView, pos, endSearch);
+					if (pos >= endSearch) {
+						break;
+					}
+				}
 				bool found = (pos + lengthFind) <= limitPos;
 				for (Sci::Position indexSearch = 0; (indexSearch < lengthFind) && found; indexSearch++) {
 					const char ch = cbView[pos + indexSearch];
@@ -2513,16 +3555,30 @@ void Document::AllocateLines(Sci::Line lines) {
 	cb.AllocateLines(lines);
 }
 
+void Document::SetLineStartsHint(Sci::Line lines, const Sci::Position *lineStarts) noexcept {
+	cb.SetLineStartsHint(lines, lineStarts);
+}
+
 void Document::SetDefaultCharClasses(bool includeWordClass) noexcept {
 	charClass.SetDefaultCharClasses(includeWordClass);
+	if (regex) {
+		// compiled patterns depend on character classification
+		regex->ClearCache();
+	}
 }
 
 void Document::SetCharClasses(const unsigned char *chars, CharacterClass newCharClass) noexcept {
 	charClass.SetCharClasses(chars, newCharClass);
+	if (regex) {
+		regex->ClearCache();
+	}
 }
 
 void Document::SetCharClassesEx(const unsigned char *chars, size_t length) noexcept {
 	charClass.SetCharClassesEx(chars, length);
+	if (regex) {
+		regex->ClearCache();
+	}
 }
 
 int Document::GetCharsOfClass(CharacterClass characterClass, unsigned char *buffer) const noexcept {
@@ -2541,6 +3597,7 @@ int Document::CharacterCategoryOptimization() const noexcept {
 
 void SCI_METHOD Document::StartStyling(Sci_Position position) noexcept {
 	endStyled = position;
+	endFolded = std::min(endFolded, position);
 }
 
 bool SCI_METHOD Document::SetStyleFor(Sci_Position length, unsigned char style) {
@@ -2578,9 +3635,14 @@ bool SCI_METHOD Document::SetStyles(Sci_Position length, const unsigned char *st
 void Document::EnsureStyledTo(Sci::Position pos) {
 	if ((enteredStyling == 0) && (pos > GetEndStyled())) {
 		IncrementStyleClock();
+		const Sci::Position stylingStart = GetEndStyled();
+		const ElapsedPeriod epStyling;
 		if (pli && !pli->UseContainerLexing()) {
-			const Sci::Position endStyledTo = LineStartPosition(GetEndStyled());
-			pli->Colourise(endStyledTo, pos);
+			pli->StopBackground();
+			if (pos > GetEndStyled()) {
+				const Sci::Position endStyledTo = LineStartPosition(GetEndStyled());
+				pli->Colourise(endStyledTo, pos);
+			}
 		} else {
 			// Ask the watchers to style, and stop as soon as one responds.
 			for (auto it = watchers.begin();
@@ -2588,21 +3650,278 @@ void Document::EnsureStyledTo(Sci::Position pos) {
 				it->watcher->NotifyStyleNeeded(this, it->userData, pos);
 			}
 		}
+		styledDuration += epStyling.Duration();
+		styledBytes += std::max<Sci::Position>(GetEndStyled() - stylingStart, 0);
+	}
+}
+
+namespace {
+
+// fold at least this length of styled text to avoid folding line by line
+constexpr Sci::Position foldMinimumLength = 64*1024;
+
+}
+
+// Folding is decoupled from styling, it runs for visible lines on painting
+// and for lines required by fold commands.
+void Document::EnsureFoldedTo(Sci::Position pos) {
+	if (pos > endFolded) {
+		EnsureStyledTo(pos);
+		const Sci::Position start = endFolded;
+		pos = std::min(std::max(pos, start + foldMinimumLength), GetEndStyled());
+		if (pos > start) {
+			if (pli && !pli->UseContainerLexing() && !pli->Fold(LineStartPosition(start), pos)) {
+				return;
+			}
+			// background job committed while folding may go further
+			endFolded = std::max(endFolded, pos);
+		}
+	}
+}
+
+void Document::StyleToAdjustingLineDuration(Sci::Position pos) {
+	const Sci::Position stylingStart = GetEndStyled();
+	const ElapsedPeriod epStyling;
+	EnsureStyledTo(pos);
+	const Sci::Position bytesBeingStyled = GetEndStyled() - stylingStart;
+	durationStyleOneUnit.AddSample(bytesBeingStyled, epStyling.Duration());
+}
+
+bool Document::StyleInBackground(Sci::Position pos, uint32_t threadCount) {
+	if (enteredStyling != 0 || !pli || pli->UseContainerLexing()) {
+		return false;
+	}
+	const Sci::Position stylingStart = GetEndStyled();
+	const bool running = pli->ColouriseInBackground(pos, threadCount);
+	styledBytes += std::max<Sci::Position>(GetEndStyled() - stylingStart, 0);
+	return running;
+}
+
+void Document::LexerChanged(bool hasStyles_) { //! removed in Scintilla 5.3
+	if (cb.EnsureStyleBuffer(hasStyles_)) {
+		endStyled = 0;
+		endFolded = 0;
+	}
+}
+
+namespace {
+
+// Styling cache: header, styles as runs of (style byte, length), then fold levels
+// and line states as runs of (zigzag delta from previous run value, line count).
+// Lengths, deltas and counts are LEB128 variable length integers.
+constexpr uint32_t stylingCacheMagic = 0x43534E53; // 'SNSC'
+constexpr uint32_t stylingCacheVersion = 1;
+
+struct StylingCacheHeader {
+	uint32_t magic;
+	uint32_t version;
+	uint64_t length;
+	uint64_t lines;
+	uint64_t foldedLines;
+	uint64_t styleSize;
+	uint64_t levelSize;
+	uint64_t stateSize;
+};
+
+void AppendVarint(std::string &data, uint64_t value) {
+	while (value >= 0x80) {
+		data.push_back(static_cast<char>((value & 0x7f) | 0x80));
+		value >>= 7;
+	}
+	data.push_back(static_cast<char>(value));
+}
+
+template <typename ValueAt>
+void AppendLineRuns(std::string &data, Sci::Line lines, ValueAt valueAt) {
+	int64_t prev = 0;
+	Sci::Line line = 0;
+	while (line < lines) {
+		const int value = valueAt(line);
+		Sci::Line next = line + 1;
+		while (next < lines && valueAt(next) == value) {
+			++next;
+		}
+		const int64_t delta = value - prev;
+		AppendVarint(data, (static_cast<uint64_t>(delta) << 1) ^ static_cast<uint64_t>(delta >> 63));
+		AppendVarint(data, next - line);
+		prev = value;
+		line = next;
+	}
+}
+
+class VarintReader {
+	const uint8_t *ptr;
+	const uint8_t *end;
+public:
+	VarintReader(const char *data, uint64_t length) noexcept :
+		ptr{reinterpret_cast<const uint8_t *>(data)}, end{ptr + length} {}
+	bool Done() const noexcept {
+		return ptr == end;
+	}
+	bool ReadByte(uint8_t &value) noexcept {
+		if (ptr == end) {
+			return false;
+		}
+		value = *ptr++;
+		return true;
+	}
+	bool Read(uint64_t &value) noexcept {
+		value = 0;
+		for (unsigned shift = 0; ptr != end && shift < 64; shift += 7) {
+			const uint8_t ch = *ptr++;
+			value |= static_cast<uint64_t>(ch & 0x7f) << shift;
+			if (ch < 0x80) {
+				return true;
+			}
+		}
+		return false;
+	}
+	template <typename SetValue>
+	bool ReadLineRuns(Sci::Line lines, SetValue setValue) {
+		int64_t value = 0;
+		Sci::Line line = 0;
+		while (line < lines) {
+			uint64_t delta;
+			uint64_t count;
+			if (!Read(delta) || !Read(count) || count == 0 || count > static_cast<uint64_t>(lines - line)) {
+				return false;
+			}
+			value += static_cast<int64_t>((delta >> 1) ^ (~(delta & 1) + 1));
+			const Sci::Line next = line + static_cast<Sci::Line>(count);
+			for (; line < next; line++) {
+				setValue(line, static_cast<int>(value));
+			}
+		}
+		return Done();
+	}
+};
+
+}
+
+// Serialize styles, fold levels and line states of fully styled document, so they can be restored
+// with SetStylingCache() when same text is loaded again. Returns empty string when not fully styled.
+std::string Document::GetStylingCache() const {
+	const Sci::Position length = LengthNoExcept();
+	std::string data;
+	if (!cb.HasStyles() || enteredStyling != 0 || endStyled < length) {
+		return data;
+	}
+
+	const Sci::Line lines = LinesTotal();
+	StylingCacheHeader header{};
+	header.magic = stylingCacheMagic;
+	header.version = stylingCacheVersion;
+	header.length = length;
+	header.lines = lines;
+	header.foldedLines = (endFolded >= length) ? lines : SciLineFromPosition(endFolded);
+	data.resize(sizeof(header));
+
+	constexpr Sci::Position chunkSize = 64*1024;
+	std::unique_ptr<unsigned char[]> styles = std::make_unique<unsigned char[]>(chunkSize);
+	unsigned char style = 0;
+	Sci::Position runLength = 0;
+	for (Sci::Position position = 0; position < length; position += chunkSize) {
+		const Sci::Position count = std::min(chunkSize, length - position);
+		cb.GetStyleRange(styles.get(), position, count);
+		for (Sci::Position i = 0; i < count; i++) {
+			if (styles[i] != style) {
+				if (runLength != 0) {
+					data.push_back(static_cast<char>(style));
+					AppendVarint(data, runLength);
+				}
+				style = styles[i];
+				runLength = 0;
+			}
+			++runLength;
+		}
 	}
-}
+	if (runLength != 0) {
+		data.push_back(static_cast<char>(style));
+		AppendVarint(data, runLength);
+	}
+	header.styleSize = data.length() - sizeof(header);
 
-void Document::StyleToAdjustingLineDuration(Sci::Position pos) {
-	const Sci::Position stylingStart = GetEndStyled();
-	const ElapsedPeriod epStyling;
-	EnsureStyledTo(pos);
-	const Sci::Position bytesBeingStyled = GetEndStyled() - stylingStart;
-	durationStyleOneUnit.AddSample(bytesBeingStyled, epStyling.Duration());
+	const LineLevels *levels = Levels();
+	AppendLineRuns(data, static_cast<Sci::Line>(header.foldedLines), [levels](Sci::Line line) noexcept {
+		return levels->GetLevel(line);
+	});
+	header.levelSize = data.length() - sizeof(header) - header.styleSize;
+
+	const LineState *states = States();
+	AppendLineRuns(data, lines, [states](Sci::Line line) noexcept {
+		return states->GetLineState(line);
+	});
+	header.stateSize = data.length() - sizeof(header) - header.styleSize - header.levelSize;
+
+	memcpy(data.data(), &header, sizeof(header));
+	return data;
 }
 
-void Document::LexerChanged(bool hasStyles_) { //! removed in Scintilla 5.3
-	if (cb.EnsureStyleBuffer(hasStyles_)) {
-		endStyled = 0;
+// Restore output of GetStylingCache() for same text, the document is then styled and folded
+// without running the lexer. On failure styling restarts from document start.
+bool Document::SetStylingCache(const char *data, size_t length) {
+	StylingCacheHeader header;
+	if (data == nullptr || length < sizeof(header) || !cb.HasStyles() || enteredStyling != 0) {
+		return false;
+	}
+	memcpy(&header, data, sizeof(header));
+	const Sci::Position lengthDoc = LengthNoExcept();
+	const Sci::Line lines = LinesTotal();
+	if (header.magic != stylingCacheMagic || header.version != stylingCacheVersion
+		|| header.length != static_cast<uint64_t>(lengthDoc) || header.lines != static_cast<uint64_t>(lines)
+		|| header.foldedLines > header.lines
+		|| header.styleSize > length - sizeof(header)
+		|| header.levelSize > length - sizeof(header) - header.styleSize
+		|| header.stateSize != length - sizeof(header) - header.styleSize - header.levelSize) {
+		return false;
+	}
+
+	enteredStyling++;
+	data += sizeof(header);
+	VarintReader styleReader{data, header.styleSize};
+	Sci::Position position = 0;
+	bool ok = true;
+	while (ok && position < lengthDoc) {
+		uint8_t style;
+		uint64_t runLength;
+		ok = styleReader.ReadByte(style) && styleReader.Read(runLength)
+			&& runLength != 0 && runLength <= static_cast<uint64_t>(lengthDoc - position);
+		if (ok) {
+			cb.SetStyleFor(position, static_cast<Sci::Position>(runLength), static_cast<char>(style));
+			position += static_cast<Sci::Position>(runLength);
+		}
+	}
+	ok = ok && styleReader.Done();
+
+	if (ok) {
+		data += header.styleSize;
+		LineLevels *levels = Levels();
+		VarintReader levelReader{data, header.levelSize};
+		ok = levelReader.ReadLineRuns(static_cast<Sci::Line>(header.foldedLines), [levels, lines](Sci::Line line, int level) {
+			if (level != levels->GetLevel(line)) {
+				levels->SetLevel(line, level, lines);
+			}
+		});
+	}
+	if (ok) {
+		data += header.levelSize;
+		LineState *states = States();
+		VarintReader stateReader{data, header.stateSize};
+		ok = stateReader.ReadLineRuns(lines, [states, lines](Sci::Line line, int state) {
+			// avoid allocating line states for lexer not using them
+			if (state != states->GetLineState(line)) {
+				states->SetLineState(line, state, lines);
+			}
+		});
 	}
+
+	// partially restored styles and levels are overwritten by lexer
+	endStyled = ok ? lengthDoc : 0;
+	endFolded = ok ? LineStart(static_cast<Sci::Line>(header.foldedLines)) : 0;
+	enteredStyling--;
+	const DocModification mh(ModificationFlags::ChangeStyle | ModificationFlags::ChangeLineState, 0, lengthDoc);
+	NotifyModified(mh);
+	return ok;
 }
 
 LexInterface *Document::GetLexInterface() const noexcept {
@@ -2809,6 +4128,15 @@ void SCI_METHOD Document::DecorationFillRange(Sci_Position position, int value,
 	}
 }
 
+void Document::DecorationFillRanges(const Sci::Position *ranges, size_t count, int value) {
+	const FillResult<Sci::Position> fr = decorations->FillRanges(ranges, count, value);
+	if (fr.changed) {
+		const DocModification mh(ModificationFlags::ChangeIndicator | ModificationFlags::User,
+			fr.position, fr.fillLength);
+		NotifyModified(mh);
+	}
+}
+
 bool Document::AddWatcher(DocWatcher *watcher, void *userData) {
 	const WatcherWithUserData wwud(watcher, userData);
 	const auto it = std::find(watchers.begin(), watchers.end(), wwud);
@@ -2870,8 +4198,38 @@ void Document::NotifyGroupCompleted() noexcept {
 void Document::NotifyModified(DocModification mh) {
 	if (FlagSet(mh.modificationType, ModificationFlags::InsertText)) {
 		decorations->InsertSpace(mh.position, mh.length);
+		if (searchIndex) {
+			searchIndex->InsertText(cb, mh.position, mh.length);
+		}
+		if (characterIndex) {
+			characterIndex->InsertText(cb, mh.position, mh.length);
+		}
+		if (braceIndex) {
+			braceIndex->InsertText(mh.position, mh.length);
+		}
+		if (dbcsIndex) {
+			dbcsIndex->Invalidate(mh.position);
+		}
+		ColumnCacheModified(mh.position, mh.linesAdded);
 	} else if (FlagSet(mh.modificationType, ModificationFlags::DeleteText)) {
 		decorations->DeleteRange(mh.position, mh.length);
+		if (searchIndex) {
+			searchIndex->DeleteText(cb, mh.position, mh.length);
+		}
+		if (characterIndex) {
+			characterIndex->DeleteText(cb, mh.position, mh.length);
+		}
+		if (braceIndex) {
+			braceIndex->DeleteText(mh.position, mh.length);
+		}
+		if (dbcsIndex) {
+			dbcsIndex->Invalidate(mh.position);
+		}
+		ColumnCacheModified(mh.position, mh.linesAdded);
+	} else if (FlagSet(mh.modificationType, ModificationFlags::ChangeStyle)) {
+		if (braceIndex) {
+			braceIndex->ChangeStyle(mh.position, mh.length);
+		}
 	}
 	for (const auto &watcher : watchers) {
 		watcher.watcher->NotifyModified(this, mh, watcher.userData);
@@ -3027,6 +4385,113 @@ constexpr char BraceOpposite(char ch) noexcept {
 	return '\0';
 }
 
+// index of brace pair in BraceIndex::Summary
+constexpr int BracePairIndex(unsigned char chOpen) noexcept {
+	return (chOpen == '(') ? 0 : ((chOpen == '[') ? 1 : ((chOpen == '{') ? 2 : 3));
+}
+
+}
+
+/**
+ * Compute depth summaries of all brace pairs and styles inside the block of brace index.
+ */
+bool Document::SummarizeBraceBlock(Sci::Position block) const noexcept {
+	if (braceIndex->Summarized(block)) {
+		return true;
+	}
+	const Sci::Position start = braceIndex->BlockStart(block);
+	const Sci::Position end = braceIndex->BlockStart(block + 1);
+	const SplitView cbView = cb.AllView();
+	const unsigned char safeChar = asciiBackwardSafeChar;
+	try {
+		std::vector<BraceIndex::Summary> summaries;
+		for (Sci::Position pos = start; pos < end; pos++) {
+			const unsigned char ch = cbView[pos];
+			const unsigned char chOpposite = BraceOpposite(ch);
+			if (chOpposite == '\0' || (ch > safeChar && pos != MovePositionOutsideChar(pos, 1, false))) {
+				continue;
+			}
+			const bool opening = ch < chOpposite;
+			const int pair = BracePairIndex(opening ? ch : chOpposite);
+			const int style = StyleIndexAt(pos);
+			auto it = std::find_if(summaries.begin(), summaries.end(), [pair, style](const BraceIndex::Summary &summary) noexcept {
+				return summary.pair == pair && summary.style == style;
+			});
+			if (it == summaries.end()) {
+				it = summaries.insert(it, {static_cast<uint8_t>(pair), static_cast<uint8_t>(style), 0, 0});
+			}
+			it->net += opening ? 1 : -1;
+			it->minPrefix = std::min(it->minPrefix, it->net);
+		}
+		braceIndex->SetSummaries(block, std::move(summaries));
+		return true;
+	} catch (...) {
+		return false;
+	}
+}
+
+/**
+ * Match brace with brace index: scan current block, then skip following blocks whose summary shows
+ * depth never reaches zero inside it. Blocks after styled range are scanned like the unindexed path.
+ */
+Sci::Position Document::BraceMatchIndexed(Sci::Position position, unsigned char chBrace, unsigned char chSeek, int styBrace, Sci::Position endStylePos) const noexcept {
+	if (!IsValidIndex(position, LengthNoExcept())) {
+		return -1;
+	}
+
+	const int direction = (chBrace < chSeek) ? 1 : -1;
+	const int pair = BracePairIndex(std::min(chBrace, chSeek));
+	const unsigned char safeChar = asciiBackwardSafeChar;
+	const SplitView cbView = cb.AllView();
+	int depth = 1;
+	// scan from pos (inclusive) to end (exclusive) in the search direction
+	const auto scan = [&](Sci::Position pos, Sci::Position end) noexcept {
+		while (pos != end) {
+			const unsigned char chAtPos = cbView[pos];
+			if (AnyOf(chAtPos, chBrace, chSeek)) {
+				if ((pos > endStylePos || StyleIndexAt(pos) == styBrace) &&
+					(chAtPos <= safeChar || pos == MovePositionOutsideChar(pos, direction, false))) {
+					depth += (chAtPos == chBrace) ? 1 : -1;
+					if (depth == 0) {
+						return pos;
+					}
+				}
+			}
+			pos += direction;
+		}
+		return Sci::invalidPosition;
+	};
+
+	const Sci::Position blockCount = braceIndex->Blocks();
+	Sci::Position block = braceIndex->BlockFromPosition(position);
+	Sci::Position found = scan(position, (direction > 0) ? braceIndex->BlockStart(block + 1) : braceIndex->BlockStart(block) - 1);
+	block += direction;
+	while (found < 0 && block >= 0 && block < blockCount) {
+		const Sci::Position start = braceIndex->BlockStart(block);
+		const Sci::Position end = braceIndex->BlockStart(block + 1);
+		bool inside = true;
+		if (end - 1 <= endStylePos && SummarizeBraceBlock(block)) {
+			const BraceIndex::Summary *summary = braceIndex->Find(block, pair, styBrace);
+			if (summary == nullptr) {
+				inside = false;
+			} else if (direction > 0) {
+				inside = depth + summary->minPrefix <= 0;
+				if (!inside) {
+					depth += summary->net;
+				}
+			} else {
+				inside = depth <= summary->net - summary->minPrefix;
+				if (!inside) {
+					depth -= summary->net;
+				}
+			}
+		}
+		if (inside) {
+			found = (direction > 0) ? scan(start, end) : scan(end - 1, start - 1);
+		}
+		block += direction;
+	}
+	return found;
 }
 
 // TODO: should be able to extend styled region to find matching brace
@@ -3041,6 +4506,14 @@ Sci::Position Document::BraceMatch(Sci::Position position, Sci::Position /*maxRe
 	const unsigned char safeChar = asciiBackwardSafeChar;
 	position = useStartPos ? startPos : position + direction;
 	const Sci::Position endStylePos = GetEndStyled();
+	if (braceIndex) {
+		if (!braceIndex->Built()) {
+			braceIndex->Build(LengthNoExcept());
+		}
+		if (braceIndex->Built()) {
+			return BraceMatchIndexed(position, chBrace, chSeek, styBrace, endStylePos);
+		}
+	}
 	const Sci::Position length = LengthNoExcept();
 	const SplitView cbView = cb.AllView();
 	int depth = 1;
@@ -3367,9 +4840,49 @@ public:
 	[[nodiscard]] Sci::Position MovePositionOutsideChar(Sci::Position pos, int moveDir) const noexcept override {
 		return pdoc->MovePositionOutsideChar(pos, moveDir, false);
 	}
+
+	[[nodiscard]] Sci::Position FindLiteral(Sci::Position pos, Sci::Position endPos, const char *text, size_t length) const noexcept override {
+		return pdoc->FindLiteral(pos, std::min(endPos, end), text, length);
+	}
 };
 
 class RESearchRange;
+
+#if defined(PCRE2_REGEX)
+/**
+ * Optional PCRE2 engine with JIT compilation for UTF-8 and single byte documents,
+ * used with FindOption::RegexJit when built with PCRE2_REGEX.
+ * Text is matched in place on each side of the gap, a partial match at the gap
+ * is retried on a copy of the text around the gap.
+ */
+class Pcre2Search {
+	FindOption flags = FindOption::None;
+	int codePage = 0;
+	uint32_t maxLookbehind = 0;
+	std::string pattern;
+	pcre2_code *code = nullptr;
+	pcre2_match_data *matchData = nullptr;
+	pcre2_match_context *matchContext = nullptr;
+	pcre2_jit_stack *jitStack = nullptr;
+	std::string window;
+public:
+	Pcre2Search() noexcept = default;
+	// Deleted so Pcre2Search objects can not be copied.
+	Pcre2Search(const Pcre2Search &) = delete;
+	Pcre2Search(Pcre2Search &&) = delete;
+	Pcre2Search &operator=(const Pcre2Search &) = delete;
+	Pcre2Search &operator=(Pcre2Search &&) = delete;
+	~Pcre2Search();
+	void Clear() noexcept;
+	void Compile(const Document *doc, const char *text, size_t length, FindOption flags_);
+	bool FindText(const Document *doc, const RESearchRange &resr, RESearch &search);
+private:
+	Sci::Position ContextStart(const Document *doc, Sci::Position position, Sci::Position lowest) const noexcept;
+	int Match(const Document *doc, const char *text, Sci::Position textStart, Sci::Position textEnd, Sci::Position from, bool partial) noexcept;
+	bool FindForward(const Document *doc, Sci::Position from, Sci::Position end, RESearch &search);
+};
+#endif
+
 /**
  * Implementation of RegexSearchBase for the default built-in regular expression engine
  */
@@ -3381,21 +4894,36 @@ public:
 
 	const char *SubstituteByPosition(const Document *doc, const char *text, Sci::Position *length) override;
 
+	void ClearCache() noexcept override;
+
 #if defined(BOOST_REGEX_STANDALONE) || !defined(NO_CXX11_REGEX)
 	Sci::Position CxxRegexFindText(const Document *doc, const RESearchRange &resr, const char *pattern, FindOption flags, Sci::Position *length);
 #endif
+#if defined(PCRE2_REGEX)
+	Sci::Position Pcre2FindText(const Document *doc, const RESearchRange &resr, const char *pattern, FindOption flags, Sci::Position *length);
+#endif
 
 private:
 #if defined(BOOST_REGEX_STANDALONE)
-	boost::wregex regexUTF8;
+	using WideRegex = boost::wregex;
 #elif !defined(NO_CXX11_REGEX)
-	std::wregex regexUTF8;
+	using WideRegex = std::wregex;
 #endif
 	RESearch search;
 #if defined(BOOST_REGEX_STANDALONE) || !defined(NO_CXX11_REGEX)
-	// cache for previous pattern to avoid recompile
-	FindOption previousFlags = FindOption::None;
-	std::string cachedPattern;
+	// recently compiled patterns to avoid recompile, most recently used first
+	struct CompiledRegex {
+		FindOption flags;
+		int codePage;
+		std::string pattern;
+		WideRegex regex;
+	};
+	static constexpr size_t regexCacheSize = 4;
+	std::vector<CompiledRegex> regexCache;
+	const WideRegex &CompileRegex(const Document *doc, const char *pattern, size_t length, FindOption flags, WideRegex::flag_type flagsRe);
+#endif
+#if defined(PCRE2_REGEX)
+	Pcre2Search pcre;
 #endif
 	std::string substituted;
 };
@@ -3440,6 +4968,163 @@ public:
 	}
 };
 
+#if defined(PCRE2_REGEX)
+
+Pcre2Search::~Pcre2Search() {
+	Clear();
+	pcre2_match_context_free(matchContext);
+	pcre2_jit_stack_free(jitStack);
+}
+
+void Pcre2Search::Clear() noexcept {
+	pcre2_match_data_free(matchData);
+	pcre2_code_free(code);
+	matchData = nullptr;
+	code = nullptr;
+	pattern.clear();
+	window.clear();
+	window.shrink_to_fit();
+}
+
+void Pcre2Search::Compile(const Document *doc, const char *text, size_t length, FindOption flags_) {
+	const std::string_view sv(text, length);
+	if (code && flags == flags_ && codePage == doc->dbcsCodePage && pattern == sv) {
+		return;
+	}
+
+	Clear();
+	uint32_t options = PCRE2_MULTILINE;
+	if (CpUtf8 == doc->dbcsCodePage) {
+		// invalid UTF-8 in document never matches instead of failing the search
+		options |= PCRE2_UTF | PCRE2_UCP | PCRE2_MATCH_INVALID_UTF;
+	}
+	if (!FlagSet(flags_, FindOption::MatchCase)) {
+		options |= PCRE2_CASELESS;
+	}
+	if (FlagSet(flags_, FindOption::RegexDotAll)) {
+		options |= PCRE2_DOTALL;
+	}
+	pcre2_compile_context *compileContext = pcre2_compile_context_create(nullptr);
+	pcre2_set_newline(compileContext, PCRE2_NEWLINE_ANYCRLF);
+	int errorCode = 0;
+	PCRE2_SIZE errorOffset = 0;
+	code = pcre2_compile(reinterpret_cast<PCRE2_SPTR>(text), length, options, &errorCode, &errorOffset, compileContext);
+	pcre2_compile_context_free(compileContext);
+	if (!code) {
+		throw RegexError();
+	}
+	// interpreter is used when JIT is not available
+	pcre2_jit_compile(code, PCRE2_JIT_COMPLETE | PCRE2_JIT_PARTIAL_HARD);
+	matchData = pcre2_match_data_create_from_pattern(code, nullptr);
+	if (!matchContext) {
+		matchContext = pcre2_match_context_create(nullptr);
+		jitStack = pcre2_jit_stack_create(32*1024, 1024*1024, nullptr);
+		pcre2_jit_stack_assign(matchContext, nullptr, jitStack);
+	}
+	if (pcre2_pattern_info(code, PCRE2_INFO_MAXLOOKBEHIND, &maxLookbehind) != 0) {
+		maxLookbehind = 0;
+	}
+	flags = flags_;
+	codePage = doc->dbcsCodePage;
+	pattern = sv;
+}
+
+// Subject starts before match start for look behind and word boundary, but not before lowest.
+Sci::Position Pcre2Search::ContextStart(const Document *doc, Sci::Position position, Sci::Position lowest) const noexcept {
+	const Sci::Position context = (maxLookbehind + 1)*UTF8MaxBytes;
+	if (position - lowest <= context) {
+		return lowest;
+	}
+	return std::max(lowest, doc->MovePositionOutsideChar(position - context, -1, false));
+}
+
+int Pcre2Search::Match(const Document *doc, const char *text, Sci::Position textStart, Sci::Position textEnd, Sci::Position from, bool partial) noexcept {
+	uint32_t options = partial ? PCRE2_PARTIAL_HARD : 0;
+	if (from == textStart && from != doc->LineStart(doc->SciLineFromPosition(from))) {
+		options |= PCRE2_NOTBOL;
+	}
+	if (!partial && textEnd != doc->LineEnd(doc->SciLineFromPosition(textEnd))) {
+		options |= PCRE2_NOTEOL;
+	}
+	return pcre2_match(code, reinterpret_cast<PCRE2_SPTR>(text), textEnd - textStart, from - textStart,
+		options, matchData, matchContext);
+}
+
+bool Pcre2Search::FindForward(const Document *doc, Sci::Position from, Sci::Position end, RESearch &search) {
+	constexpr Sci::Position minWindowSize = 64*1024;
+	const Sci::Position gap = doc->GapPosition();
+	const PCRE2_SIZE *ovector = pcre2_get_ovector_pointer(matchData);
+	while (true) {
+		const bool beforeGap = from < gap;
+		Sci::Position textStart = ContextStart(doc, from, beforeGap ? 0 : gap);
+		Sci::Position textEnd = (beforeGap && end > gap) ? gap : end;
+		const char *text = doc->ContiguousRangePointer(textStart, textEnd - textStart);
+		int rc = Match(doc, text, textStart, textEnd, from, textEnd < end);
+		if (rc == PCRE2_ERROR_PARTIAL) {
+			// match may continue after the gap, retry on copy of the text with growing window
+			do {
+				const Sci::Position partialStart = textStart + ovector[0];
+				textStart = ContextStart(doc, partialStart, 0);
+				textEnd = std::min(end, textEnd + std::max(textEnd - partialStart, minWindowSize));
+				window.resize(textEnd - textStart);
+				doc->GetCharRange(window.data(), textStart, textEnd - textStart);
+				rc = Match(doc, window.data(), textStart, textEnd, partialStart, textEnd < end);
+			} while (rc == PCRE2_ERROR_PARTIAL);
+		}
+		if (rc > 0) {
+			const int maxTag = std::min(rc, RESearch::MAXTAG);
+			for (int co = 0; co < maxTag; co++) {
+				if (ovector[2*co] != PCRE2_UNSET) {
+					search.bopat[co] = textStart + ovector[2*co];
+					search.eopat[co] = textStart + ovector[2*co + 1];
+				}
+			}
+			return true;
+		}
+		if (rc != PCRE2_ERROR_NOMATCH || textEnd == end) {
+			return false;
+		}
+		// no match starts before textEnd
+		from = textEnd;
+	}
+}
+
+bool Pcre2Search::FindText(const Document *doc, const RESearchRange &resr, RESearch &search) {
+	if (resr.increment > 0) {
+		return FindForward(doc, resr.startPos, resr.endPos, search);
+	}
+	// Line by line, last match on the line.
+	for (Sci::Line line = resr.lineRangeStart; line != resr.lineRangeBreak; line += resr.increment) {
+		const Range lineRange = resr.LineRange(line, doc->LineStart(line), doc->LineEnd(line));
+		Sci::Position pos = lineRange.start;
+		bool matched = false;
+		RESearch::MatchPositions bopat{};
+		RESearch::MatchPositions eopat{};
+		while (FindForward(doc, pos, lineRange.end, search)) {
+			matched = true;
+			bopat = search.bopat;
+			eopat = search.eopat;
+			if (eopat[0] > bopat[0]) {
+				pos = eopat[0];
+			} else if (bopat[0] < lineRange.end) {
+				// empty match
+				pos = doc->NextPosition(bopat[0], 1);
+			} else {
+				break;
+			}
+			search.Clear();
+		}
+		if (matched) {
+			search.bopat = bopat;
+			search.eopat = eopat;
+			return true;
+		}
+	}
+	return false;
+}
+
+#endif
+
 #if defined(BOOST_REGEX_STANDALONE) || !defined(NO_CXX11_REGEX)
 
 // On Windows, wchar_t is 16 bits wide and on Unix it is 32 bits wide.
@@ -3530,6 +5215,111 @@ private:
 	}
 };
 
+// Search range lying on one side of the gap, read directly instead of through CellBuffer.
+// The gap is not moved as document may be searched from multiple threads.
+struct ContiguousText {
+	const Document *doc;
+	const char *text = nullptr;
+	Sci::Position start;
+	Sci::Position end;
+	ContiguousText(const Document *doc_, const RESearchRange &resr) noexcept : doc(doc_) {
+		start = std::min(resr.startPos, resr.endPos);
+		end = std::max(resr.startPos, resr.endPos);
+		if (end > start) {
+			text = doc->ContiguousRangePointer(start, end - start);
+		}
+	}
+};
+
+// Same as UTF8Iterator, but characters inside the contiguous range are decoded from pointer.
+class ContiguousUTF8Iterator {
+	const ContiguousText *source;
+	Sci::Position position;
+	unsigned int characterIndex = 0;
+	CharacterWideInfo charInfo;
+public:
+	using iterator_category = std::bidirectional_iterator_tag;
+	using value_type = wchar_t;
+	using difference_type = ptrdiff_t;
+	using pointer = wchar_t*;
+	using reference = wchar_t&;
+
+	explicit ContiguousUTF8Iterator(const ContiguousText *source_ = nullptr, Sci::Position position_ = 0, bool start = false) noexcept :
+		source(source_), position(position_) {
+		if (start) {
+			ReadCharacter();
+		}
+	}
+	wchar_t operator*() const noexcept {
+		assert(charInfo.lenCharacters != 0);
+		return charInfo.buffer[characterIndex];
+	}
+	ContiguousUTF8Iterator &operator++() noexcept {
+		if ((characterIndex + 1) < (charInfo.lenCharacters)) {
+			characterIndex++;
+		} else {
+			position += charInfo.lenBytes;
+			ReadCharacter();
+			characterIndex = 0;
+		}
+		return *this;
+	}
+	ContiguousUTF8Iterator operator++(int) noexcept {
+		ContiguousUTF8Iterator retVal(*this);
+		++*this;
+		return retVal;
+	}
+	ContiguousUTF8Iterator &operator--() noexcept {
+		if (characterIndex) {
+			characterIndex--;
+		} else {
+			position = source->doc->NextPosition(position, -1);
+			ReadCharacter();
+			characterIndex = charInfo.lenCharacters - 1;
+		}
+		return *this;
+	}
+	bool operator==(const ContiguousUTF8Iterator &other) const noexcept {
+		return position == other.position &&
+			characterIndex == other.characterIndex;
+	}
+	bool operator!=(const ContiguousUTF8Iterator &other) const noexcept {
+		return position != other.position ||
+			characterIndex != other.characterIndex;
+	}
+	[[nodiscard]] Sci::Position Pos() const noexcept {
+		return position;
+	}
+	[[nodiscard]] Sci::Position PosRoundUp() const noexcept {
+		if (characterIndex)
+			return position + charInfo.lenBytes;	// Force to end of character
+		else
+			return position;
+	}
+private:
+	void ReadCharacter() noexcept {
+		const ContiguousText &contiguous = *source;
+		if (position >= contiguous.start && position < contiguous.end) {
+			const unsigned char *charBytes = reinterpret_cast<const unsigned char *>(contiguous.text + (position - contiguous.start));
+			const unsigned char leadByte = *charBytes;
+			if (UTF8IsAscii(leadByte)) {
+				charInfo.buffer[0] = leadByte;
+				charInfo.lenCharacters = 1;
+				charInfo.lenBytes = 1;
+				return;
+			}
+			// bytes after end of the range may be across the gap
+			if (CpUtf8 == contiguous.doc->dbcsCodePage && position + UTF8MaxBytes <= contiguous.end) {
+				const CharacterExtracted charExtracted = CharacterExtracted(charBytes, UTF8BytesOfLead(leadByte));
+				charInfo.lenCharacters = UTF16FromUTF32Character(charExtracted.character, charInfo.buffer);
+				charInfo.lenBytes = charExtracted.widthBytes;
+				return;
+			}
+		}
+		contiguous.doc->ExtractCharacter(position, charInfo);
+	}
+};
+
 // On Unix, report non-BMP characters as single characters
 
 std::wstring WStringFromMultiByte(int codePage, const char *pattern, size_t patternLen) {
@@ -3556,16 +5346,16 @@ boost::regex_constants::match_flag_type MatchFlags(const Document *doc, Sci::Pos
 	return flagsMatch;
 }
 
-template<typename Iterator, typename Regex>
-bool MatchOnLines(const Document *doc, const Regex &regexp, const RESearchRange &resr, RESearch &search, FindOption flags) {
+template<typename Iterator, typename Source, typename Regex>
+bool MatchOnLines(const Document *doc, Source source, const Regex &regexp, const RESearchRange &resr, RESearch &search, FindOption flags) {
 	boost::match_results<Iterator> match;
 
 	bool matched = false;
 	if (resr.increment > 0) {
 		const Sci::Position lineStartPos = doc->LineStart(resr.lineRangeStart);
 		const Sci::Position lineEndPos = doc->LineEnd(resr.lineRangeEnd);
-		const Iterator itStart(doc, resr.startPos, true);
-		const Iterator itEnd(doc, resr.endPos);
+		const Iterator itStart(source, resr.startPos, true);
+		const Iterator itEnd(source, resr.endPos);
 		boost::regex_constants::match_flag_type flagsMatch = MatchFlags(doc, resr.startPos, resr.endPos, lineStartPos, lineEndPos);
 		if (FlagSet(flags, FindOption::RegexDotAll)) {
 			flagsMatch = flagsMatch & ~boost::regex_constants::match_not_dot_newline;
@@ -3577,8 +5367,8 @@ bool MatchOnLines(const Document *doc, const Regex &regexp, const RESearchRange
 			const Sci::Position lineStartPos = doc->LineStart(line);
 			const Sci::Position lineEndPos = doc->LineEnd(line);
 			const Range lineRange = resr.LineRange(line, lineStartPos, lineEndPos);
-			const Iterator itStart(doc, lineRange.start, true);
-			const Iterator itEnd(doc, lineRange.end);
+			const Iterator itStart(source, lineRange.start, true);
+			const Iterator itEnd(source, lineRange.end);
 			const boost::regex_constants::match_flag_type flagsMatch = MatchFlags(doc, lineRange.start, lineRange.end, lineStartPos, lineEndPos);
 			boost::regex_iterator<Iterator> it(itStart, itEnd, regexp, flagsMatch);
 			for (const boost::regex_iterator<Iterator> last; it != last; ++it) {
@@ -3610,18 +5400,12 @@ Sci::Position BuiltinRegex::CxxRegexFindText(const Document *doc, const RESearch
 		// Clear the RESearch so can fill in matches
 		search.Clear();
 
-		const size_t patternLen = *length;
-		bool matched = flags != previousFlags || patternLen != cachedPattern.length()
-			|| memcmp(pattern, cachedPattern.data(), patternLen) != 0;
-		if (matched) {
-			const std::wstring ws = WStringFromMultiByte(doc->dbcsCodePage, pattern, patternLen);
-			regexUTF8.assign(ws, flagsRe);
-			previousFlags = flags;
-			cachedPattern.assign(pattern, patternLen);
-		}
-
+		const WideRegex &regexUTF8 = CompileRegex(doc, pattern, *length, flags, flagsRe);
 		Sci::Position posMatch = -1;
-		matched = MatchOnLines<UTF8Iterator>(doc, regexUTF8, resr, search, flags);
+		const ContiguousText contiguous(doc, resr);
+		const bool matched = contiguous.text
+			? MatchOnLines<ContiguousUTF8Iterator>(doc, &contiguous, regexUTF8, resr, search, flags)
+			: MatchOnLines<UTF8Iterator>(doc, doc, regexUTF8, resr, search, flags);
 		if (matched) {
 			posMatch = search.bopat[0];
 			*length = search.eopat[0] - search.bopat[0];
@@ -3663,8 +5447,8 @@ std::regex_constants::match_flag_type MatchFlags(const Document *doc, Sci::Posit
 	return flagsMatch;
 }
 
-template<typename Iterator, typename Regex>
-bool MatchOnLines(const Document *doc, const Regex &regexp, const RESearchRange &resr, RESearch &search) {
+template<typename Iterator, typename Source, typename Regex>
+bool MatchOnLines(const Document *doc, Source source, const Regex &regexp, const RESearchRange &resr, RESearch &search) {
 	std::match_results<Iterator> match;
 
 	// MSVC and libc++ have problems with ^ and $ matching line ends inside a range.
@@ -3679,8 +5463,8 @@ bool MatchOnLines(const Document *doc, const Regex &regexp, const RESearchRange
 	if (resr.increment > 0) {
 		const Sci::Position lineStartPos = doc->LineStart(resr.lineRangeStart);
 		const Sci::Position lineEndPos = doc->LineEnd(resr.lineRangeEnd);
-		const Iterator itStart(doc, resr.startPos, true);
-		const Iterator itEnd(doc, resr.endPos);
+		const Iterator itStart(source, resr.startPos, true);
+		const Iterator itEnd(source, resr.endPos);
 		const std::regex_constants::match_flag_type flagsMatch = MatchFlags(doc, resr.startPos, resr.endPos, lineStartPos, lineEndPos);
 		matched = std::regex_search(itStart, itEnd, match, regexp, flagsMatch);
 		goto labelMatched;
@@ -3692,8 +5476,8 @@ bool MatchOnLines(const Document *doc, const Regex &regexp, const RESearchRange
 			const Sci::Position lineStartPos = doc->LineStart(line);
 			const Sci::Position lineEndPos = doc->LineEnd(line);
 			const Range lineRange = resr.LineRange(line, lineStartPos, lineEndPos);
-			const Iterator itStart(doc, lineRange.start, true);
-			const Iterator itEnd(doc, lineRange.end);
+			const Iterator itStart(source, lineRange.start, true);
+			const Iterator itEnd(source, lineRange.end);
 			const std::regex_constants::match_flag_type flagsMatch = MatchFlags(doc, lineRange.start, lineRange.end, lineStartPos, lineEndPos);
 			std::regex_iterator<Iterator> it(itStart, itEnd, regexp, flagsMatch);
 			for (const std::regex_iterator<Iterator> last; it != last; ++it) {
@@ -3740,18 +5524,12 @@ Sci::Position BuiltinRegex::CxxRegexFindText(const Document *doc, const RESearch
 		// Clear the RESearch so can fill in matches
 		search.Clear();
 
-		const size_t patternLen = *length;
-		bool matched = flags != previousFlags || patternLen != cachedPattern.length()
-			|| memcmp(pattern, cachedPattern.data(), patternLen) != 0;
-		if (matched) {
-			const std::wstring ws = WStringFromMultiByte(doc->dbcsCodePage, pattern, patternLen);
-			regexUTF8.assign(ws, flagsRe);
-			previousFlags = flags;
-			cachedPattern.assign(pattern, patternLen);
-		}
-
+		const WideRegex &regexUTF8 = CompileRegex(doc, pattern, *length, flags, flagsRe);
 		Sci::Position posMatch = -1;
-		matched = MatchOnLines<UTF8Iterator>(doc, regexUTF8, resr, search);
+		const ContiguousText contiguous(doc, resr);
+		const bool matched = contiguous.text
+			? MatchOnLines<ContiguousUTF8Iterator>(doc, &contiguous, regexUTF8, resr, search)
+			: MatchOnLines<UTF8Iterator>(doc, doc, regexUTF8, resr, search);
 		if (matched) {
 			posMatch = search.bopat[0];
 			*length = search.eopat[0] - search.bopat[0];
@@ -3775,8 +5553,60 @@ Sci::Position BuiltinRegex::CxxRegexFindText(const Document *doc, const RESearch
 
 #endif // BOOST_REGEX_STANDALONE || !NO_CXX11_REGEX
 
+#if defined(PCRE2_REGEX)
+Sci::Position BuiltinRegex::Pcre2FindText(const Document *doc, const RESearchRange &resr, const char *pattern, FindOption flags, Sci::Position *length) {
+	// Clear the RESearch so can fill in matches
+	search.Clear();
+	pcre.Compile(doc, pattern, *length, flags);
+	Sci::Position posMatch = -1;
+	if (pcre.FindText(doc, resr, search)) {
+		posMatch = search.bopat[0];
+		*length = search.eopat[0] - search.bopat[0];
+	}
+	return posMatch;
+}
+#endif
+
+#if defined(BOOST_REGEX_STANDALONE) || !defined(NO_CXX11_REGEX)
+// constructing wregex is expensive, reuse it for same pattern, search flags and code page.
+const BuiltinRegex::WideRegex &BuiltinRegex::CompileRegex(const Document *doc, const char *pattern, size_t length, FindOption flags, WideRegex::flag_type flagsRe) {
+	const std::string_view text(pattern, length);
+	const int codePage = doc->dbcsCodePage;
+	for (auto it = regexCache.begin(); it != regexCache.end(); ++it) {
+		if (it->flags == flags && it->codePage == codePage && it->pattern == text) {
+			std::rotate(regexCache.begin(), it, it + 1);
+			return regexCache.front().regex;
+		}
+	}
+
+	const std::wstring ws = WStringFromMultiByte(codePage, pattern, length);
+	WideRegex regex(ws, flagsRe);
+	if (regexCache.size() == regexCacheSize) {
+		regexCache.pop_back();
+	}
+	regexCache.insert(regexCache.begin(), { flags, codePage, std::string(text), std::move(regex) });
+	return regexCache.front().regex;
+}
+#endif
+
+void BuiltinRegex::ClearCache() noexcept {
+	search.ClearCache();
+#if defined(BOOST_REGEX_STANDALONE) || !defined(NO_CXX11_REGEX)
+	regexCache.clear();
+#endif
+#if defined(PCRE2_REGEX)
+	pcre.Clear();
+#endif
+}
+
 Sci::Position BuiltinRegex::FindText(const Document *doc, Sci::Position minPos, Sci::Position maxPos, const char *pattern, FindOption flags, Sci::Position *length) {
 	const RESearchRange resr(doc, minPos, maxPos);
+#if defined(PCRE2_REGEX)
+	// DBCS documents use other engines
+	if (FlagSet(flags, FindOption::RegexJit) && (doc->dbcsCodePage == 0 || doc->dbcsCodePage == CpUtf8)) {
+		return Pcre2FindText(doc, resr, pattern, flags, length);
+	}
+#endif
 #if defined(BOOST_REGEX_STANDALONE) || !defined(NO_CXX11_REGEX)
 	if (FlagSet(flags, FindOption::Cxx11RegEx)) {
 		return CxxRegexFindText(doc, resr, pattern, flags, length);
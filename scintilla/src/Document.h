@@ -15,6 +15,11 @@ class LineMarkers;
 class LineLevels;
 class LineState;
 class LineAnnotation;
+class SearchIndex;
+class CharacterBlockIndex;
+class BraceIndex;
+class DBCSBoundaryIndex;
+class BackgroundLexer;
 
 enum class EncodingFamily {
 	eightBit, unicode, dbcs
@@ -102,6 +107,9 @@ public:
 
 	///@return String with the substitutions, must remain valid until the next call or destruction
 	virtual const char *SubstituteByPosition(const Document *doc, const char *text, Sci::Position *length) = 0;
+
+	/// Drop compiled patterns, called when character classification changed
+	virtual void ClearCache() noexcept {}
 };
 
 /// Factory function for RegexSearchBase
@@ -195,6 +203,9 @@ struct LexerReleaser {
 
 using LexerInstance = std::unique_ptr<Scintilla::ILexer5, LexerReleaser>;
 
+// Same as SciFnLineStyler, fills styles for one line from its text.
+using LineStyler = void (*)(const char *text, unsigned char *styles, Sci::Position length);
+
 // LexInterface defines the interface to ILexer used in Document.
 // The LexState subclass is actually created and that is used within ScintillaBase
 // to provide more methods that are exposed through Scintilla's external API.
@@ -202,10 +213,21 @@ class LexInterface {
 protected:
 	Document *pdoc;
 	LexerInstance instance;
+	std::unique_ptr<BackgroundLexer> background;
+	// following segments lexed on other threads from assumed checkpoints, in document order
+	std::vector<std::unique_ptr<BackgroundLexer>> speculative;
 	bool performingStyle = false;	///< Prevent reentrance
 	bool enableUrlHighlight = false;
+	bool backgroundFailed = false;
 	int lexerLanguage = 0;
+	int lineCheckpoint = 0;
+	uint64_t backgroundDiscardTime = 0;
 	uint32_t urlIgnoreStyle[8];
+	bool StartBackground(Sci::Position start, Sci::Position end, uint32_t threadCount);
+	bool ValidCheckpoint(Sci::Position position);
+	Sci::Position NextValidCheckpoint(Sci::Position position, Sci::Position end);
+	void CommitBackground(bool wait);
+	void StitchBackground();
 public:
 	explicit LexInterface(Document *pdoc_) noexcept;
 	LexInterface(const LexInterface &) = delete;
@@ -214,6 +236,10 @@ public:
 	LexInterface &operator=(LexInterface &&) = delete;
 	virtual ~LexInterface() noexcept;
 	void Colourise(Sci::Position start, Sci::Position end);
+	bool Fold(Sci::Position start, Sci::Position end);
+	bool ColouriseInBackground(Sci::Position end, uint32_t threadCount);
+	void StopBackground();
+	void DiscardBackground() noexcept;
 	virtual Scintilla::LineEndType LineEndTypesSupported() const noexcept;
 	bool UseContainerLexing() const noexcept;
 };
@@ -234,6 +260,8 @@ struct RegexError final : public std::runtime_error {
 
 class ActionDuration {
 	double duration;
+	// whether any sample was added since construction or Set()
+	bool measured = false;
 	static constexpr double minDuration = 1e-7;
 	static constexpr double maxDuration = 1e-4;
 	// measure time in KiB instead of byte.
@@ -242,9 +270,14 @@ public:
 	static constexpr int InitialBytes = 1024*1024;
 	ActionDuration(double initial) noexcept : duration{initial} {}
 	void AddSample(Sci::Position numberActions, double durationOfActions) noexcept;
+	// restore duration remembered from previous session
+	void Set(double durationOne) noexcept;
 	double Duration() const noexcept {
 		return duration;
 	}
+	bool Measured() const noexcept {
+		return measured;
+	}
 	int ActionsInAllowedTime(double secondsAllowed) const noexcept;
 };
 
@@ -277,6 +310,41 @@ struct CharacterWideInfo {
 	wchar_t buffer[2]{};
 };
 
+/**
+ * Column checkpoints on a long line for Document::GetColumn() and FindColumn(),
+ * the i-th checkpoint is at first character boundary after (i + 1)*checkpointSize bytes.
+ * Checkpoints are added when scanning passes them, and dropped after modified position.
+ */
+struct LineColumnCache {
+	static constexpr Sci::Position checkpointSize = 4096;
+	struct Checkpoint {
+		Sci::Position offset;	// from line start
+		Sci::Position column;
+	};
+
+	Sci::Line line = -1;
+	int tabInChars = 0;
+	int dbcsCodePage = 0;
+	std::vector<Checkpoint> checkpoints;
+
+	Sci::Position NextOffset() const noexcept {
+		return static_cast<Sci::Position>(checkpoints.size() + 1)*checkpointSize;
+	}
+	void Add(Sci::Position offset, Sci::Position column) noexcept {
+		try {
+			checkpoints.push_back({offset, column});
+		} catch (...) {
+			// scan from line start or earlier checkpoint
+		}
+	}
+	const Checkpoint *FindOffset(Sci::Position offset) const noexcept;
+	const Checkpoint *FindColumn(Sci::Position column) const noexcept;
+	void Invalidate() noexcept {
+		line = -1;
+		checkpoints.clear();
+	}
+};
+
 /**
  */
 class Document : PerLine, public Scintilla::IDocument, public Scintilla::ILoader, public Scintilla::IDocumentEditable {
@@ -302,6 +370,8 @@ private:
 #endif
 	std::unique_ptr<CaseFolder> pcf;
 	Sci::Position endStyled = 0;
+	// fold levels are valid for lines before the line contains endFolded, never after endStyled
+	Sci::Position endFolded = 0;
 	int styleClock = 0;
 	int enteredModification = 0;
 	int enteredStyling = 0;
@@ -326,7 +396,15 @@ private:
 	LineAnnotation *EOLAnnotations() const noexcept;
 
 	std::unique_ptr<RegexSearchBase> regex;
+	std::unique_ptr<SearchIndex> searchIndex;
+	std::unique_ptr<CharacterBlockIndex> characterIndex;
+	std::unique_ptr<BraceIndex> braceIndex;
+	std::unique_ptr<DBCSBoundaryIndex> dbcsIndex;
+	static constexpr size_t columnCacheCount = 4;
+	mutable LineColumnCache columnCache[columnCacheCount];
+	mutable size_t columnCacheNext = 0;
 	std::unique_ptr<LexInterface> pli;
+	LineStyler lineStyler = nullptr;
 	std::unique_ptr<DBCSCharClassify> dbcsCharClass;
 
 	//std::map<void *, ViewStateShared> viewData;
@@ -350,6 +428,9 @@ public:
 	uint8_t asciiForwardSafeChar = 0xff;
 	uint8_t asciiBackwardSafeChar = 0xff;
 	ActionDuration durationStyleOneUnit;
+	// total time spent in and bytes styled by the lexer
+	double styledDuration = 0;
+	Sci::Position styledBytes = 0;
 
 	const std::unique_ptr<IDecorationList> decorations;
 
@@ -363,6 +444,9 @@ public:
 
 	int SCI_METHOD AddRef() noexcept override;
 	int SCI_METHOD Release() noexcept override;
+	bool IsShared() const noexcept {
+		return refCount > 1;
+	}
 
 	// From PerLine
 	void Init() override;
@@ -405,7 +489,9 @@ public:
 	bool NextCharacter(Sci::Position &pos, int moveDir) const noexcept;	// Returns true if pos changed
 	CharacterExtracted CharacterAfter(Sci::Position position) const noexcept;
 	CharacterExtracted CharacterBefore(Sci::Position position) const noexcept;
+	Sci::Position MoveForwardUTF8(Sci::Position positionStart, Sci::Position characterOffset, bool utf16) const noexcept;
 	Sci_Position SCI_METHOD GetRelativePosition(Sci_Position positionStart, Sci_Position characterOffset) const noexcept override;
+	bool UseCharacterIndex(Sci::Position position, Sci::Position characterOffset) const noexcept;
 	Sci::Position GetRelativePositionUTF16(Sci::Position positionStart, Sci::Position characterOffset) const noexcept;
 	int SCI_METHOD GetCharacterAndWidth(Sci_Position position, Sci_Position *pWidth) const noexcept override;
 	CharacterClass SCI_METHOD GetCharacterClass(unsigned int ch) const noexcept override;
@@ -433,6 +519,13 @@ public:
 	bool DeleteChars(Sci::Position pos, Sci::Position len);
 	Sci::Position InsertString(Sci::Position position, const char *s, Sci::Position insertLength);
 	Sci::Position InsertString(Sci::Position position, std::string_view sv);
+	Sci::Position ReplaceRange(Sci::Position position, Sci::Position deleteLength, std::string_view text);
+	Scintilla::IDocumentSnapshot *CreateSnapshot() {
+		return cb.CreateSnapshot();
+	}
+	Scintilla::IDocumentSnapshot *CreateSnapshot(Sci::Position start, Sci::Position length) {
+		return cb.CreateSnapshot(start, length);
+	}
 	void ChangeInsertion(const char *s, Sci::Position length);
 	int SCI_METHOD AddData(const char *data, Sci_Position length) override;
 	IDocumentEditable *AsDocumentEditable() noexcept {
@@ -441,6 +534,7 @@ public:
 	void * SCI_METHOD ConvertToDocument() noexcept override;
 	Sci::Position Undo();
 	Sci::Position Redo();
+	bool ReplaysCoalesced(bool redo) noexcept;
 	bool CanUndo() const noexcept {
 		return cb.CanUndo();
 	}
@@ -456,6 +550,16 @@ public:
 	bool IsCollectingUndo() const noexcept {
 		return cb.IsCollectingUndo();
 	}
+	void SetUndoMemoryBudget(size_t budget) noexcept {
+		cb.SetUndoMemoryBudget(budget);
+	}
+	size_t UndoMemoryBudget() const noexcept {
+		return cb.UndoMemoryBudget();
+	}
+	void ReleaseUndoMemory() noexcept {
+		cb.ReleaseUndoMemory();
+	}
+	size_t MemoryUsed(Scintilla::MemoryUsage usage) const noexcept;
 	void BeginUndoAction(bool coalesceWithPrior = false) noexcept {
 		cb.BeginUndoAction(coalesceWithPrior);
 	}
@@ -522,6 +626,9 @@ public:
 	const char *RangePointer(Sci::Position position, Sci::Position rangeLength) noexcept {
 		return cb.RangePointer(position, rangeLength);
 	}
+	const char * SCI_METHOD ContiguousRangePointer(Sci_Position position, Sci_Position rangeLength) const noexcept override {
+		return cb.ContiguousRangePointer(position, rangeLength);
+	}
 	Sci::Position GapPosition() const noexcept {
 		return cb.GapPosition();
 	}
@@ -530,6 +637,7 @@ public:
 	Sci::Position SetLineIndentation(Sci::Line line, Sci::Position indent);
 	Sci::Position GetLineIndentPosition(Sci::Line line) const noexcept;
 	Sci::Position GetColumn(Sci::Position pos) const noexcept;
+	void CountCharactersAndUTF16(Sci::Position startPos, Sci::Position endPos, Sci::Position &countCharacters, Sci::Position &countUTF16) const noexcept;
 	Sci::Position CountCharacters(Sci::Position startPos, Sci::Position endPos) const noexcept;
 	void CountCharactersAndColumns(Scintilla::sptr_t lParam) const noexcept;
 	Sci::Position CountUTF16(Sci::Position startPos, Sci::Position endPos) const noexcept;
@@ -573,8 +681,19 @@ public:
 	int CheckRange(const char *chars, const char *styles, Sci::Position position, Sci::Position rangeLength) const noexcept {
 		return cb.CheckRange(chars, styles, position, rangeLength);
 	}
+	LineStyler GetLineStyler() const noexcept {
+		return lineStyler;
+	}
+	void SetLineStyler(LineStyler styler) noexcept {
+		lineStyler = styler;
+	}
+	// styles computed from line text while laying out, never stored in the style buffer
+	LineStyler RenderStyler() const noexcept {
+		return cb.HasStyles() ? nullptr : lineStyler;
+	}
 	MarkerMask GetMark(Sci::Line line, bool includeChangeHistory) const noexcept;
 	Sci::Line MarkerNext(Sci::Line lineStart, MarkerMask mask) const noexcept;
+	Sci::Line MarkerPrevious(Sci::Line lineStart, MarkerMask mask) const noexcept;
 	int AddMark(Sci::Line line, int markerNum);
 	void AddMarkSet(Sci::Line line, MarkerMask valueSet);
 	void DeleteMark(Sci::Line line, int markerNum);
@@ -604,6 +723,7 @@ public:
 	Sci::Line GetFoldParent(Sci::Line line) const noexcept;
 	void GetHighlightDelimiters(HighlightDelimiter &highlightDelimiter, Sci::Line line, Sci::Line lastLine);
 
+	Sci::Position SkipCharacterClass(Sci::Position pos, CharacterClass ccSkip, int delta) const noexcept;
 	Sci::Position ExtendWordSelect(Sci::Position pos, int delta, bool onlyWordCharacters = false) const noexcept;
 	Sci::Position NextWordStart(Sci::Position pos, int delta) const noexcept;
 	Sci::Position NextWordEnd(Sci::Position pos, int delta) const noexcept;
@@ -616,6 +736,8 @@ public:
 	void Allocate(Sci::Position newSize) {
 		cb.Allocate(newSize);
 	}
+	void CopyTextSettings(const Document &other);
+	void AdoptText(Document &other);
 
 	void ExtractCharacter(Sci::Position position, CharacterWideInfo &charInfo) const noexcept;
 
@@ -626,6 +748,10 @@ public:
 	bool MatchesWordOptions(Scintilla::FindOption flags, Sci::Position pos, Sci::Position length) const noexcept;
 	bool HasCaseFolder() const noexcept;
 	void SetCaseFolder(std::unique_ptr<CaseFolder> pcf_) noexcept;
+	void BuildSearchIndex() noexcept;
+	bool BuildCharacterIndex() noexcept;
+	void ReleaseIndexes() noexcept;
+	Sci::Position FindLiteral(Sci::Position pos, Sci::Position endPos, const char *text, Sci::Position length) const noexcept;
 	Sci::Position FindText(Sci::Position minPos, Sci::Position maxPos, const char *search, Scintilla::FindOption flags, Sci::Position *length);
 	const char *SubstituteByPosition(const char *text, Sci::Position *length);
 	Scintilla::LineCharacterIndexType LineCharacterIndex() const noexcept;
@@ -635,6 +761,7 @@ public:
 		return cb.Lines();
 	}
 	void AllocateLines(Sci::Line lines);
+	void SetLineStartsHint(Sci::Line lines, const Sci::Position *lineStarts) noexcept;
 
 	void SetDefaultCharClasses(bool includeWordClass) noexcept;
 	void SetCharClasses(const unsigned char *chars, CharacterClass newCharClass) noexcept;
@@ -651,8 +778,21 @@ public:
 		return endStyled;
 	}
 	void EnsureStyledTo(Sci::Position pos);
+	Sci::Position GetEndFolded() const noexcept {
+		return endFolded;
+	}
+	void SetEndFolded(Sci::Position pos) noexcept {
+		endFolded = pos;
+	}
+	void EnsureFoldedTo(Sci::Position pos);
+	void EnsureLineFolded(Sci::Line line) {
+		EnsureFoldedTo(LineStart(line + 1));
+	}
 	void StyleToAdjustingLineDuration(Sci::Position pos);
+	bool StyleInBackground(Sci::Position pos, uint32_t threadCount);
 	void LexerChanged(bool hasStyles_);
+	std::string GetStylingCache() const;
+	bool SetStylingCache(const char *data, size_t length);
 	bool EnableUrlHighlight() const noexcept;
 	void HighlightUrl(Sci_PositionU startPos, Sci_Position lengthDoc, const uint32_t (&urlIgnoreStyle)[8]);
 	int GetStyleClock() const noexcept {
@@ -661,6 +801,7 @@ public:
 	void IncrementStyleClock() noexcept;
 	void SCI_METHOD DecorationSetCurrentIndicator(int indicator) noexcept override;
 	void SCI_METHOD DecorationFillRange(Sci_Position position, int value, Sci_Position fillLength) override;
+	void DecorationFillRanges(const Sci::Position *ranges, size_t count, int value);
 	LexInterface *GetLexInterface() const noexcept;
 	void SetLexInterface(std::unique_ptr<LexInterface> pLexInterface) noexcept;
 
@@ -706,6 +847,10 @@ public:
 	int IndentSize() const noexcept {
 		return actualIndentInChars;
 	}
+	Sci::Position DBCSBlockBoundary(Sci::Position pos) const noexcept;
+	Sci::Position DBCSCharacterBoundaryBefore(Sci::Position pos) const noexcept;
+	bool SummarizeBraceBlock(Sci::Position block) const noexcept;
+	Sci::Position BraceMatchIndexed(Sci::Position position, unsigned char chBrace, unsigned char chSeek, int styBrace, Sci::Position endStylePos) const noexcept;
 	Sci::Position BraceMatch(Sci::Position position, Sci::Position maxReStyle, Sci::Position startPos, bool useStartPos) const noexcept;
 
 private:
@@ -713,6 +858,9 @@ private:
 	void NotifySavePoint(bool atSavePoint) noexcept;
 	void NotifyGroupCompleted() noexcept;
 	void NotifyModified(DocModification mh);
+	Sci::Position ReplayCoalesced(int steps, bool redo);
+	LineColumnCache *ColumnCacheForLine(Sci::Line line) const noexcept;
+	void ColumnCacheModified(Sci::Position position, Sci::Line linesAdded) noexcept;
 };
 
 class DelaySavePoint {
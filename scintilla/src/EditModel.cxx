@@ -130,6 +130,7 @@ EditModel::EditModel() :
 	GetNativeSystemInfo(&info);
 	hardwareConcurrency = info.dwNumberOfProcessors;
 #endif
+	workerPool.SetThreadCount(hardwareConcurrency);
 	idleTaskTimer = CreateWaitableTimer(nullptr, true, nullptr);
 	SetIdleTaskTime(IdleLineWrapTime);
 	UpdateParallelLayoutThreshold();
@@ -94,6 +94,7 @@ public:
 	static constexpr uint32_t MaxPaintTextTime = 16; // 60Hz
 	static constexpr uint32_t ParallelLayoutBlockSize = 4096;
 	void *idleTaskTimer;
+	mutable WorkerPool workerPool;
 
 	EditModel();
 	// Deleted so EditModel objects can not be copied.
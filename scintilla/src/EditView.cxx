@@ -360,6 +360,26 @@ inline void UpdateMaximum(std::atomic<T> &maximum, const T &value) noexcept {
 	while(prev < value && !maximum.compare_exchange_weak(prev, value)) {}
 }
 
+// measurement surface cached for each thread of the worker pool.
+// GDI needs its own DC, DirectWrite measurement only uses the shared (thread-safe) factory and
+// the font's text format, so a surface without render target is enough for all Direct2D technologies.
+Surface *MeasurementSurface(const EditModel &model, const ViewStyle &vstyle, Surface *sharedSurface) {
+	const Technology technology = (vstyle.technology == Technology::Default) ? Technology::Default : Technology::DirectWrite;
+	thread_local std::unique_ptr<Surface> surf;
+	thread_local Technology surfTechnology = Technology::Default;
+	if (!surf || surfTechnology != technology) {
+		std::unique_ptr<Surface> surface = Surface::Allocate(technology);
+		if (technology != Technology::Default && !surface->SupportsFeature(Supports::ThreadSafeMeasureWidths)) {
+			return sharedSurface;
+		}
+		surface->Init(nullptr);
+		surf = std::move(surface);
+		surfTechnology = technology;
+	}
+	surf->SetMode(model.CurrentSurfaceMode());
+	return surf.get();
+}
+
 struct LayoutWorker {
 	LineLayout * const ll;
 	const ViewStyle &vstyle;
@@ -450,28 +470,11 @@ struct LayoutWorker {
 
 		maxPosInLine = static_cast<int>(posInLine);
 		const uint32_t length = bfLayout.CurrentPos() - startPos;
+		ll->EnsurePositions(bfLayout.CurrentPos());
 		if (length >= model.minParallelLayoutLength && model.hardwareConcurrency > 1) {
 			segmentCount = static_cast<uint32_t>(segmentList.size());
 			const uint32_t threadCount = std::min(length/(blockSize/2), model.hardwareConcurrency);
-#if USE_STD_ASYNC_FUTURE
-			std::vector<std::future<void>> features;
-			for (uint32_t i = 0; i < threadCount; i++) {
-				features.push_back(std::async(std::launch::async, [this] {
-					DoWork();
-				}));
-			}
-			for (auto &f : features) {
-				f.wait();
-			}
-
-#elif USE_WIN32_PTP_WORK
-			PTP_WORK work = CreateThreadpoolWork(WorkCallback, this, nullptr);
-			for (uint32_t i = 0; i < threadCount; i++) {
-				SubmitThreadpoolWork(work);
-			}
-			WaitForThreadpoolWorkCallbacks(work, FALSE);
-			CloseThreadpoolWork(work);
-#endif // USE_WIN32_PTP_WORK
+			model.workerPool.Run(WorkCallback, this, threadCount);
 			return threadCount;
 		}
 
@@ -498,22 +501,10 @@ struct LayoutWorker {
 		return 1;
 	}
 
-	std::unique_ptr<Surface> CreateMeasurementSurface() const {
-		// if (!surface->SupportsFeature(Supports::ThreadSafeMeasureWidths))
-		if (vstyle.technology == Technology::Default) {
-			std::unique_ptr<Surface> surf = Surface::Allocate(Technology::Default);
-			surf->Init(nullptr);
-			surf->SetMode(model.CurrentSurfaceMode());
-			return surf;
-		}
-		return {};
-	}
-
 	void DoWork() {
 		uint32_t finished = 0;
 		void * const idleTaskTimer = model.idleTaskTimer;
-		const std::unique_ptr<Surface> surf{CreateMeasurementSurface()};
-		Surface * const surface = surf ? surf.get() : sharedSurface;
+		Surface * const surface = MeasurementSurface(model, vstyle, sharedSurface);
 
 		int processed = 0;
 		while (true) {
@@ -537,16 +528,125 @@ struct LayoutWorker {
 		UpdateMaximum(finishedCount, finished);
 	}
 
-#if USE_WIN32_PTP_WORK
-	static VOID CALLBACK WorkCallback([[maybe_unused]] PTP_CALLBACK_INSTANCE instance, PVOID context, [[maybe_unused]] PTP_WORK work) {
+	static void WorkCallback(void *context) {
 		LayoutWorker *worker = static_cast<LayoutWorker *>(context);
 		worker->DoWork();
 	}
-#endif
+};
+
+struct WrapWorker {
+	EditView &view;
+	const EditModel &model;
+	const ViewStyle &vstyle;
+	Surface * const sharedSurface;
+	const int width;
+	const Sci::Line lineStart;
+	int * const linesAfterWrap;
+	const uint32_t lineCount;
+	std::atomic<uint32_t> nextIndex = 0;
+
+	static constexpr uint32_t batchSize = 64;
+
+	void DoWork() {
+		Surface * const surface = MeasurementSurface(model, vstyle, sharedSurface);
+		// scratch layout reused for every line wrapped by this thread
+		std::unique_ptr<LineLayout> ll;
+		while (true) {
+			const uint32_t index = nextIndex.fetch_add(batchSize, std::memory_order_relaxed);
+			if (index >= lineCount) {
+				break;
+			}
+
+			const uint32_t indexEnd = std::min(index + batchSize, lineCount);
+			for (uint32_t i = index; i < indexEnd; i++) {
+				if (linesAfterWrap[i] != 0) {
+					continue;
+				}
+				const Sci::Line line = lineStart + i;
+				const int lengthLine = static_cast<int>(model.pdoc->LineStart(line + 1) - model.pdoc->LineStart(line));
+				if (ll) {
+					ll->Reset(line, lengthLine);
+				} else {
+					ll = std::make_unique<LineLayout>(line, lengthLine);
+				}
+				view.LayoutLine(model, surface, vstyle, ll.get(), width, LayoutLineOption::IdleUpdate);
+				linesAfterWrap[i] = ll->lines;
+			}
+		}
+	}
+
+	static void WorkCallback(void *context) {
+		WrapWorker *worker = static_cast<WrapWorker *>(context);
+		worker->DoWork();
+	}
 };
 
 }
 
+/**
+* Fill in positions for the rest of a line that only contains graphic ASCII and tab characters,
+* when all styles use the same fixed character width (ViewStyle::uniformMonospace).
+* A gigantic line is only laid out to a large block after @a posInLine, the rest is laid out on demand.
+* Returns false without changing anything when the line contains other characters.
+*/
+bool EditView::LayoutMonospaceLine(const EditModel &model, const ViewStyle &vstyle, LineLayout *ll, int posInLine) const {
+	const int startPos = ll->lastSegmentEnd;
+	int endPos = ll->numCharsInLine;
+	if (endPos - startPos > LineLayout::largeLineLength*2) {
+		posInLine = std::max({posInLine, startPos, ll->caretPosition}) + LineLayout::largeLineLength;
+		endPos = std::min(endPos, posInLine);
+	}
+	const char * const chars = ll->chars.get();
+	const bool tabStop = vstyle.tabDrawMode != TabDrawMode::ControlChar && model.reprs->MayContains('\t');
+	for (int i = startPos; i < endPos; i++) {
+		const unsigned char ch = chars[i];
+		if (ch == '\t') {
+			if (!tabStop) {
+				return false;
+			}
+		} else if (ch < ' ' || ch > '~' || model.reprs->MayContains(ch)) {
+			return false;
+		}
+	}
+
+	ll->EnsurePositions(endPos);
+	const Sci::Line line = ll->LineNumber();
+	const XYPOSITION characterWidth = vstyle.aveCharWidth;
+	XYPOSITION * const positions = ll->positions.get();
+	XYPOSITION xBeginRun = positions[startPos];
+	int count = 0;
+	for (int i = startPos; i < endPos; i++) {
+		if (chars[i] == '\t') {
+			xBeginRun = NextTabstopPos(line, xBeginRun + count*characterWidth, vstyle.tabWidth);
+			count = 0;
+			positions[i + 1] = xBeginRun;
+		} else {
+			++count;
+			positions[i + 1] = xBeginRun + count*characterWidth;
+		}
+	}
+	const char chLast = chars[endPos - 1];
+	if (endPos == ll->numCharsInLine && chLast != ' ' && chLast != '\t' && vstyle.styles[ll->styles[endPos - 1]].italic) {
+		positions[endPos] += vstyle.lastSegItalicsOffset;
+	}
+	ll->lastSegmentEnd = endPos;
+	return true;
+}
+
+/**
+* Wrap lines in [@a lineStart, @a lineStart + @a lineCount) whose @a linesAfterWrap entry is zero
+* with multiple threads, each line is laid out into a per thread scratch LineLayout.
+* Lines must be short enough to be laid out completely without parallel layout inside the line.
+* Returns number of threads used.
+*/
+uint32_t EditView::WrapLinesParallel(const EditModel &model, Surface *surface, const ViewStyle &vstyle, int width,
+	Sci::Line lineStart, int *linesAfterWrap, uint32_t lineCount) {
+	WrapWorker worker{ *this, model, vstyle, surface, width, lineStart, linesAfterWrap, lineCount };
+	const uint32_t threadCount = std::min((lineCount + WrapWorker::batchSize - 1)/WrapWorker::batchSize, model.hardwareConcurrency);
+	model.workerPool.Run(WrapWorker::WorkCallback, &worker, threadCount);
+	return threadCount;
+}
+
 /**
 * Fill in the LineLayout data for the given line.
 * Copy the given @a line and its styles from the document into local arrays.
@@ -579,8 +679,11 @@ uint32_t EditView::LayoutLine(const EditModel &model, Surface *surface, const Vi
 				allSame = model.pdoc->CheckRange(ll->chars.get(), reinterpret_cast<const char *>(styles), posLineStart, lineLength);
 			}
 
-			const int styleByteLast = (posLineEnd == posLineStart) ? 0 : model.pdoc->StyleIndexAt(posLineEnd - 1);
-			allSame |= styles[lineLength] ^ styleByteLast; // For eolFilled
+			// render styles only depend on line text, they are the same when text is unchanged
+			if (!model.pdoc->RenderStyler()) {
+				const int styleByteLast = (posLineEnd == posLineStart) ? 0 : model.pdoc->StyleIndexAt(posLineEnd - 1);
+				allSame |= styles[lineLength] ^ styleByteLast; // For eolFilled
+			}
 			//const double duration = period.Duration()*1e3;
 			//printf("check line=%zd (%zd) allSame=%d, duration=%f\n", line + 1, lineLength, allSame, duration);
 			if (allSame == 0) {
@@ -592,7 +695,12 @@ uint32_t EditView::LayoutLine(const EditModel &model, Surface *surface, const Vi
 		// Fill base line layout
 		const int lineLength = static_cast<int>(posLineEnd - posLineStart);
 		model.pdoc->GetCharRange(ll->chars.get(), posLineStart, lineLength);
-		model.pdoc->GetStyleRange(ll->styles.get(), posLineStart, lineLength);
+		if (const LineStyler styler = model.pdoc->RenderStyler()) {
+			memset(ll->styles.get(), 0, lineLength);
+			styler(ll->chars.get(), ll->styles.get(), lineLength);
+		} else {
+			model.pdoc->GetStyleRange(ll->styles.get(), posLineStart, lineLength);
+		}
 		const int numCharsBeforeEOL = static_cast<int>(model.pdoc->LineEnd(line) - posLineStart);
 		const int numCharsInLine = vstyle.viewEOL ? lineLength : numCharsBeforeEOL;
 		const unsigned char styleByteLast = (lineLength == 0) ? 0 : ll->styles[lineLength - 1];
@@ -634,48 +742,53 @@ uint32_t EditView::LayoutLine(const EditModel &model, Surface *surface, const Vi
 		//}
 		//const ElapsedPeriod period;
 		//posInLine = ll->numCharsInLine; // whole line
-		LayoutWorker worker{ ll, vstyle, surface, posCache, model, {}};
-		const uint32_t threadCount = worker.Start(posLineStart, posInLine, option);
-
-		// Accumulate absolute positions from relative positions within segments and expand tabs
-		const uint32_t finishedCount = worker.finishedCount.load(std::memory_order_relaxed);
-		uint32_t iByte = ll->lastSegmentEnd;
-		XYPOSITION xPosition = ll->positions[iByte++];
-		for (auto it = worker.segmentList.begin(); it != worker.segmentList.begin() + finishedCount; ++it) {
-			const TextSegment &ts = *it;
-			if (ts.representation && ll->chars[ts.start] == '\t' &&
-				vstyle.tabDrawMode != TabDrawMode::ControlChar && vstyle.styles[ll->styles[ts.start]].visible) {
-				// Simple visible tab, go to next tab stop
-				const XYPOSITION startTab = ll->positions[ts.start];
-				const XYPOSITION nextTab = NextTabstopPos(line, startTab, vstyle.tabWidth);
-				xPosition += nextTab - startTab;
-			}
-
-			const XYPOSITION xBeginSegment = xPosition;
-			for (int i = 0; i < ts.length; i++) {
-				xPosition = ll->positions[iByte] + xBeginSegment;
-				ll->positions[iByte++] = xPosition;
-			}
-		}
-
-		const TextSegment &ts = worker.segmentList[finishedCount - 1];
-		const int endPos = ts.end();
-		const uint32_t bytes = endPos - ll->lastSegmentEnd;
-		wrappedBytes = bytes / threadCount;
+		const int startPos = ll->lastSegmentEnd;
+		if (vstyle.uniformMonospace && !model.BidirectionalEnabled() && LayoutMonospaceLine(model, vstyle, ll, posInLine)) {
+			wrappedBytes = ll->lastSegmentEnd - startPos;
+		} else {
+			LayoutWorker worker{ ll, vstyle, surface, posCache, model, {}};
+			const uint32_t threadCount = worker.Start(posLineStart, posInLine, option);
+
+			// Accumulate absolute positions from relative positions within segments and expand tabs
+			const uint32_t finishedCount = worker.finishedCount.load(std::memory_order_relaxed);
+			uint32_t iByte = ll->lastSegmentEnd;
+			XYPOSITION xPosition = ll->positions[iByte++];
+			for (auto it = worker.segmentList.begin(); it != worker.segmentList.begin() + finishedCount; ++it) {
+				const TextSegment &ts = *it;
+				if (ts.representation && ll->chars[ts.start] == '\t' &&
+					vstyle.tabDrawMode != TabDrawMode::ControlChar && vstyle.styles[ll->styles[ts.start]].visible) {
+					// Simple visible tab, go to next tab stop
+					const XYPOSITION startTab = ll->positions[ts.start];
+					const XYPOSITION nextTab = NextTabstopPos(line, startTab, vstyle.tabWidth);
+					xPosition += nextTab - startTab;
+				}
+
+				const XYPOSITION xBeginSegment = xPosition;
+				for (int i = 0; i < ts.length; i++) {
+					xPosition = ll->positions[iByte] + xBeginSegment;
+					ll->positions[iByte++] = xPosition;
+				}
+			}
+
+			const TextSegment &ts = worker.segmentList[finishedCount - 1];
+			const int endPos = ts.end();
+			const uint32_t bytes = endPos - ll->lastSegmentEnd;
+			wrappedBytes = bytes / threadCount;
 #if 0
-		if (bytes > LayoutWorker::blockSize) {
-			const double duration = period.Duration()*1e3;
-			printf("layout line=%zd segment=(%u / %zu), posInLine=(%d / %d) (%u / %u, %u), duration=%f, %f\n", line + 1,
-				finishedCount, worker.segmentList.size(), worker.maxPosInLine, ll->maxLineLength,
-				bytes, threadCount, wrappedBytes, duration, model.durationWrapOneUnit.Duration()*1e3);
-		}
+			if (bytes > LayoutWorker::blockSize) {
+				const double duration = period.Duration()*1e3;
+				printf("layout line=%zd segment=(%u / %zu), posInLine=(%d / %d) (%u / %u, %u), duration=%f, %f\n", line + 1,
+					finishedCount, worker.segmentList.size(), worker.maxPosInLine, ll->maxLineLength,
+					bytes, threadCount, wrappedBytes, duration, model.durationWrapOneUnit.Duration()*1e3);
+			}
 #endif
-		ll->lastSegmentEnd = endPos;
-		if (endPos == ll->numCharsInLine) {
-			// Small hack to make lines that end with italics not cut off the edge of the last character
-			// Not quite the same as before which would effectively ignore trailing invisible segments
-			if (!ts.representation && (ll->chars[endPos - 1] != ' ') && vstyle.styles[ll->styles[ts.start]].italic) {
-				ll->positions[endPos] += vstyle.lastSegItalicsOffset;
+			ll->lastSegmentEnd = endPos;
+			if (endPos == ll->numCharsInLine) {
+				// Small hack to make lines that end with italics not cut off the edge of the last character
+				// Not quite the same as before which would effectively ignore trailing invisible segments
+				if (!ts.representation && (ll->chars[endPos - 1] != ' ') && vstyle.styles[ll->styles[ts.start]].italic) {
+					ll->positions[endPos] += vstyle.lastSegItalicsOffset;
+				}
 			}
 		}
 		validity = LineLayout::ValidLevel::positions;
@@ -905,12 +1018,65 @@ SelectionPosition EditView::SPositionFromLocation(Surface *surface, const EditMo
 	return SelectionPosition(canReturnInvalid ? Sci::invalidPosition : posLineStart);
 }
 
+/**
+* Find the position for x on an unwrapped line without laying out the line, when all styles use
+* the same fixed character width and the line only contains graphic ASCII and tab characters before x.
+* Positions are same as from LayoutMonospaceLine(), so rectangular selection over millions of lines
+* does not need to fill line layout cache. Returns false for other lines.
+*/
+bool EditView::SPositionFromLineXMonospace(const EditModel &model, Sci::Line lineDoc, int x, const ViewStyle &vs, SelectionPosition &result) const noexcept {
+	if (!vs.uniformMonospace || vs.wrap.state != Wrap::None || vs.viewEOL || model.BidirectionalEnabled()) {
+		return false;
+	}
+
+	const Document * const pdoc = model.pdoc;
+	const Sci::Position posLineStart = pdoc->LineStart(lineDoc);
+	const Sci::Position posLineEnd = pdoc->LineEnd(lineDoc);
+	const bool tabStop = vs.tabDrawMode != TabDrawMode::ControlChar && model.reprs->MayContains('\t');
+	const XYPOSITION characterWidth = vs.aveCharWidth;
+	XYPOSITION xPosition = 0;
+	unsigned char ch = 0;
+	for (Sci::Position pos = posLineStart; pos < posLineEnd; pos++) {
+		ch = pdoc->CharAt(pos);
+		XYPOSITION xNext;
+		if (ch == '\t') {
+			if (!tabStop) {
+				return false;
+			}
+			xNext = NextTabstopPos(lineDoc, xPosition, vs.tabWidth);
+		} else if (ch < ' ' || ch > '~' || model.reprs->MayContains(ch)) {
+			return false;
+		} else {
+			xNext = xPosition + characterWidth;
+		}
+		// same as LineLayout::FindPositionFromX() with charPosition = false
+		if (x < (xPosition + xNext) / 2) {
+			result = SelectionPosition(pos);
+			return true;
+		}
+		xPosition = xNext;
+	}
+
+	const int endStyle = pdoc->StyleIndexAt(std::max(posLineEnd - 1, posLineStart));
+	if (posLineEnd > posLineStart && ch != ' ' && ch != '\t' && vs.styles[endStyle].italic) {
+		xPosition += vs.lastSegItalicsOffset;
+	}
+	const XYPOSITION spaceWidth = vs.styles[endStyle].spaceWidth;
+	const int spaceOffset = static_cast<int>((x - xPosition + spaceWidth / 2) / spaceWidth);
+	result = SelectionPosition(posLineEnd, spaceOffset);
+	return true;
+}
+
 /**
 * Find the document position corresponding to an x coordinate on a particular document line.
 * Ensure is between whole characters when document is in multi-byte or UTF-8 mode.
 * This method is used for rectangular selections and does not work on wrapped lines.
 */
 SelectionPosition EditView::SPositionFromLineX(Surface *surface, const EditModel &model, Sci::Line lineDoc, int x, const ViewStyle &vs) {
+	SelectionPosition result;
+	if (SPositionFromLineXMonospace(model, lineDoc, x, vs, result)) {
+		return result;
+	}
 	if (surface) {
 		LineLayout * const ll = RetrieveLineLayout(lineDoc, model);
 		LayoutLine(model, surface, vs, ll, model.wrapWidth, LayoutLineOption::AutoUpdate);
@@ -2153,27 +2319,23 @@ void DrawIndicators(Surface *surface, const EditModel &model, const ViewStyle &v
 	const Sci::Position posLineStart = model.pdoc->LineStart(line);
 	const Sci::Position lineStart = ll->LineStart(subLine);
 	const Sci::Position posLineEnd = posLineStart + lineEnd;
-
-	for (const auto *deco : model.pdoc->decorations->View()) {
-		if (under == vsDraw.indicators[deco->Indicator()].under) {
-			Sci::Position startPos = posLineStart + lineStart;
-			while (startPos < posLineEnd) {
-				const Range rangeRun(deco->StartRun(startPos), deco->EndRun(startPos));
-				const Sci::Position endPos = std::min(rangeRun.end, posLineEnd);
-				const int value = deco->ValueAt(startPos);
-				if (value) {
-					const bool hover = vsDraw.indicators[deco->Indicator()].IsDynamic() &&
-						rangeRun.ContainsCharacter(model.hoverIndicatorPos);
-					const Indicator::State state = hover ? Indicator::State::hover : Indicator::State::normal;
-					const Sci::Position posSecond = model.pdoc->MovePositionOutsideChar(rangeRun.First() + 1, 1);
-					DrawIndicator(deco->Indicator(), startPos - posLineStart, endPos - posLineStart,
-						surface, vsDraw, ll, xStart, rcLine, posSecond - posLineStart, subLine, state,
-						value, model.BidirectionalEnabled(), tabWidthMinimumPixels);
-				}
-				startPos = endPos;
-			}
-		}
-	}
+	const Sci::Position posSubLineStart = posLineStart + lineStart;
+
+	const std::vector<DecorationRun> &runs = model.pdoc->decorations->RunsInRange(posSubLineStart, posLineEnd);
+	ForEachDecorationRun(runs, posSubLineStart, posLineEnd, [&](const DecorationRun &run) {
+		const Indicator &indicator = vsDraw.indicators[run.indicator];
+		if (under == indicator.under) {
+			const Range rangeRun(run.start, run.end);
+			const Sci::Position startPos = std::max(run.start, posSubLineStart);
+			const Sci::Position endPos = std::min(run.end, posLineEnd);
+			const bool hover = indicator.IsDynamic() && rangeRun.ContainsCharacter(model.hoverIndicatorPos);
+			const Indicator::State state = hover ? Indicator::State::hover : Indicator::State::normal;
+			const Sci::Position posSecond = model.pdoc->MovePositionOutsideChar(rangeRun.First() + 1, 1);
+			DrawIndicator(run.indicator, startPos - posLineStart, endPos - posLineStart,
+				surface, vsDraw, ll, xStart, rcLine, posSecond - posLineStart, subLine, state,
+				run.value, model.BidirectionalEnabled(), tabWidthMinimumPixels);
+		}
+	});
 
 	// Use indicators to highlight matching braces
 	if ((vsDraw.braceHighlightIndicatorSet && (model.bracesMatchStyle == StyleBraceLight)) ||
@@ -2316,6 +2478,7 @@ void EditView::DrawForeground(Surface *surface, const EditModel &model, const Vi
 	const BreakFinder::BreakFor breakFor = (((phasesDraw == PhasesDraw::One) && selBackDrawn) || vsDraw.SelectionTextDrawn())
 		? BreakFinder::BreakFor::ForegroundAndSelection : BreakFinder::BreakFor::Foreground;
 	BreakFinder bfFore(ll, &model.sel, lineRange, posLineStart, xStartVisible, breakFor, model, &vsDraw, 0);
+	const std::vector<DecorationRun> &decorationRuns = model.pdoc->decorations->RunsInRange(posLineStart + lineRange.start, posLineStart + lineRange.end);
 
 	while (bfFore.More()) {
 
@@ -2341,31 +2504,24 @@ void EditView::DrawForeground(Surface *surface, const EditModel &model, const Vi
 			}
 			if (vsDraw.indicatorsSetFore) {
 				// At least one indicator sets the text colour so see if it applies to this segment
-				for (const auto *deco : model.pdoc->decorations->View()) {
-					const int indicatorValue = deco->ValueAt(ts.start + posLineStart);
-					if (indicatorValue) {
-						const Indicator &indicator = vsDraw.indicators[deco->Indicator()];
-						bool hover = false;
-						if (indicator.IsDynamic()) {
-							const Sci::Position startPos = ts.start + posLineStart;
-							const Range rangeRun(deco->StartRun(startPos), deco->EndRun(startPos));
-							hover =	rangeRun.ContainsCharacter(model.hoverIndicatorPos);
+				const Sci::Position startPos = ts.start + posLineStart;
+				ForEachDecorationRun(decorationRuns, startPos, startPos + 1, [&](const DecorationRun &run) {
+					const Indicator &indicator = vsDraw.indicators[run.indicator];
+					const bool hover = indicator.IsDynamic() && Range(run.start, run.end).ContainsCharacter(model.hoverIndicatorPos);
+					if (hover) {
+						if (indicator.sacHover.style == IndicatorStyle::TextFore) {
+							textFore = indicator.sacHover.fore;
+							hoverUnderline = indicator.hoverUnderline;
 						}
-						if (hover) {
-							if (indicator.sacHover.style == IndicatorStyle::TextFore) {
-								textFore = indicator.sacHover.fore;
-								hoverUnderline = indicator.hoverUnderline;
-							}
-						} else {
-							if (indicator.sacNormal.style == IndicatorStyle::TextFore) {
-								if (FlagSet(indicator.Flags(), IndicFlag::ValueFore))
-									textFore = ColourRGBA::FromRGB(indicatorValue & static_cast<int>(IndicValue::Mask));
-								else
-									textFore = indicator.sacNormal.fore;
-							}
+					} else {
+						if (indicator.sacNormal.style == IndicatorStyle::TextFore) {
+							if (FlagSet(indicator.Flags(), IndicFlag::ValueFore))
+								textFore = ColourRGBA::FromRGB(run.value & static_cast<int>(IndicValue::Mask));
+							else
+								textFore = indicator.sacNormal.fore;
 						}
 					}
-				}
+				});
 			}
 			InSelection inSelection = vsDraw.selection.visible ? model.sel.CharacterInSelection(iDoc) : InSelection::inNone;
 			if (FlagSet(vsDraw.caret.style, CaretStyle::Curses) && (inSelection == InSelection::inMain))
@@ -2725,6 +2881,19 @@ void EditView::PaintText(Surface *surfaceWindow, const EditModel &model, const V
 		const bool bracesIgnoreStyle = ((vsDraw.braceHighlightIndicatorSet && (model.bracesMatchStyle == StyleBraceLight)) ||
 			(vsDraw.braceBadLightIndicatorSet && (model.bracesMatchStyle == StyleBraceBad)));
 
+		// Collect decoration runs of painted lines once, lines then look up the merged list
+		// instead of each decoration.
+		if (!model.pdoc->decorations->View().empty()) {
+			const Sci::Line linesDisplayed = model.pcs->LinesDisplayed();
+			const Sci::Line lineVisibleFirst = model.TopLineOfMain() + screenLinePaintFirst;
+			if (lineVisibleFirst < linesDisplayed) {
+				const Sci::Line lineVisibleLast = std::min(model.TopLineOfMain() + static_cast<int>(rcArea.bottom) / vsDraw.lineHeight, linesDisplayed - 1);
+				const Sci::Position posStart = model.pdoc->LineStart(model.pcs->DocFromDisplay(lineVisibleFirst));
+				const Sci::Position posEnd = model.pdoc->LineStart(model.pcs->DocFromDisplay(lineVisibleLast) + 1);
+				model.pdoc->decorations->RunsInRange(posStart, posEnd);
+			}
+		}
+
 		Sci::Line lineDocPrevious = -1;	// Used to avoid laying out one document line multiple times
 		LineLayout *ll = nullptr;
 		DrawPhase phase = DrawPhase::all;
@@ -135,6 +135,8 @@ public:
 	LineLayout *RetrieveLineLayout(Sci::Line lineNumber, const EditModel &model);
 	uint32_t LayoutLine(const EditModel &model, Surface *surface, const ViewStyle &vstyle,
 		LineLayout *ll, int width, LayoutLineOption option, int posInLine = 0);
+	uint32_t WrapLinesParallel(const EditModel &model, Surface *surface, const ViewStyle &vstyle, int width,
+		Sci::Line lineStart, int *linesAfterWrap, uint32_t lineCount);
 
 	static void UpdateBidiData(const EditModel &model, const ViewStyle &vstyle, LineLayout *ll);
 
@@ -149,6 +151,8 @@ public:
 
 private:
 	void UpdateMaxWidth(XYPOSITION width) noexcept;
+	bool LayoutMonospaceLine(const EditModel &model, const ViewStyle &vstyle, LineLayout *ll, int posInLine) const;
+	bool SPositionFromLineXMonospace(const EditModel &model, Sci::Line lineDoc, int x, const ViewStyle &vs, SelectionPosition &result) const noexcept;
 	void SCICALL DrawEOL(Surface *surface, const EditModel &model, const ViewStyle &vsDraw, const LineLayout *ll,
 		Sci::Line line, int xStart, PRectangle rcLine, int subLine, Sci::Position lineEnd, XYPOSITION subLineStart, ColourOptional background) const;
 	void SCICALL DrawFoldDisplayText(Surface *surface, const EditModel &model, const ViewStyle &vsDraw, const LineLayout *ll,
@@ -24,6 +24,7 @@
 #include <algorithm>
 #include <iterator>
 #include <memory>
+#include <atomic>
 
 #include "ParallelSupport.h"
 #include "ScintillaTypes.h"
@@ -175,6 +176,8 @@ Editor::Editor() {
 	verticalScrollBarVisible = true;
 	xCaretMargin = 50;
 	scrollWidth = 2000;
+	scrollWidthPendingStart = 0;
+	scrollWidthPendingEnd = 0;
 	endAtLastLine = 1;
 	caretSticky = CaretSticky::Off;
 	marginOptions = MarginOption::None;
@@ -199,8 +202,10 @@ Editor::Editor() {
 	paintAbandonedByStyling = false;
 	paintingAllText = false;
 	willRedrawAll = false;
+	scrollBlit = false;
 	idleStyling = IdleStyling::None;
 	needIdleStyling = false;
+	backgroundStyling = false;
 
 	recordingMacro = false;
 	convertPastes = true;
@@ -249,6 +254,21 @@ void Editor::InvalidateStyleRedraw() noexcept {
 	Redraw();
 }
 
+/**
+ * Free memory that is rebuilt on demand, each level includes lower levels.
+ */
+void Editor::ReleaseCaches(ReleaseCache level) noexcept {
+	// layouts of visible lines are recreated on next paint
+	view.llc.Deallocate();
+	view.posCache.Clear();
+	if (level >= ReleaseCache::Index) {
+		pdoc->ReleaseIndexes();
+	}
+	if (level >= ReleaseCache::Undo) {
+		pdoc->ReleaseUndoMemory();
+	}
+}
+
 void Editor::RefreshStyleData() {
 	if (!stylesValid) {
 		stylesValid = true;
@@ -857,7 +877,8 @@ void Editor::MovedCaret(SelectionPosition newPos, SelectionPosition previousPos,
 	if (ensureVisible) {
 		// In case in need of wrapping to ensure DisplayFromDoc works.
 		if (currentLine >= wrapPending.start) {
-			if (WrapLines(WrapScope::wsAll)) {
+			const bool estimated = EstimateWrapPending();
+			if (WrapLines(WrapScope::wsAll) || estimated) {
 				Redraw();
 			}
 		}
@@ -1516,6 +1537,33 @@ void Editor::InvalidateCaret() {
 	UpdateSystemCaret();
 }
 
+// Blinking only toggles the caret pixels, so for a thin line caret invalidate the caret cell
+// instead of the whole line. Painting then lays out the line from cache and clips drawing to the cell.
+void Editor::InvalidateCaretBlink() {
+	if (redrawPendingText) {
+		return;
+	}
+	if (posDrag.IsValid() || inOverstrike || view.imeCaretBlockOverride || Wrapping() || BidirectionalEnabled()
+		|| ((vs.caret.style & CaretStyle::InsMask) != CaretStyle::Line) || FlagSet(vs.caret.style, CaretStyle::Curses)) {
+		InvalidateCaret();
+		return;
+	}
+
+	const int overlap = view.LinesOverlap() ? vs.lineOverlap : 0;
+	const XYPOSITION textLeft = static_cast<XYPOSITION>(vs.textStart - 1);
+	for (size_t r = 0; r < sel.Count(); r++) {
+		const Point pt = LocationFromPosition(sel.Range(r).caret);
+		PRectangle rc;
+		// line caret is drawn from round(x - 0.51) with caret.width, add one pixel for anti-aliasing
+		rc.left = std::max(std::floor(pt.x) - 2, textLeft);
+		rc.right = std::ceil(pt.x) + static_cast<XYPOSITION>(vs.caret.width + 1);
+		rc.top = pt.y - overlap;
+		rc.bottom = pt.y + vs.lineHeight + overlap;
+		RedrawRect(rc);
+	}
+	UpdateSystemCaret();
+}
+
 bool Editor::Wrapping() const noexcept {
 	return vs.wrap.state != Wrap::None;
 }
@@ -1531,6 +1579,91 @@ void Editor::NeedWrapping(Sci::Line docLineStart, Sci::Line docLineEnd, bool inv
 	}
 }
 
+void Editor::NeedScrollWidth(Sci::Line docLineStart, Sci::Line docLineEnd) noexcept {
+	if (scrollWidthPendingStart < scrollWidthPendingEnd) {
+		scrollWidthPendingStart = std::min(scrollWidthPendingStart, docLineStart);
+		scrollWidthPendingEnd = std::max(scrollWidthPendingEnd, docLineEnd);
+	} else {
+		scrollWidthPendingStart = docLineStart;
+		scrollWidthPendingEnd = docLineEnd;
+	}
+	if (ScrollWidthPending()) {
+		SetIdle(true);
+	}
+}
+
+bool Editor::ScrollWidthPending() const noexcept {
+	return trackLineWidth && horizontalScrollBarVisible && !Wrapping()
+		&& scrollWidthPendingStart < scrollWidthPendingEnd;
+}
+
+/**
+ * Widen the scroll width in idle time for lines not yet painted.
+ * A block of pending lines is scanned for the few with most bytes, then only
+ * these lines are laid out; very long lines are estimated from average character width.
+ */
+void Editor::IdleScrollWidth() {
+	constexpr Sci::Line blockLines = 0x10000;
+	constexpr size_t longestCount = 8;
+	constexpr Sci::Position maxMeasureLength = 0x10000;
+
+	const Sci::Line linesTotal = pdoc->LinesTotal();
+	const Sci::Line lineStart = std::min(scrollWidthPendingStart, linesTotal);
+	const Sci::Line lineEnd = std::min({scrollWidthPendingEnd, linesTotal, lineStart + blockLines});
+	scrollWidthPendingStart = lineEnd;
+	if (lineEnd >= std::min(scrollWidthPendingEnd, linesTotal)) {
+		scrollWidthPendingStart = 0;
+		scrollWidthPendingEnd = 0;
+	}
+
+	// longest lines in byte length, sorted in descending order
+	std::array<std::pair<Sci::Position, Sci::Line>, longestCount> longest{};
+	Sci::Position posLineEnd = pdoc->LineStart(lineStart);
+	for (Sci::Line line = lineStart; line < lineEnd; line++) {
+		const Sci::Position posLineStart = posLineEnd;
+		posLineEnd = pdoc->LineStart(line + 1);
+		const Sci::Position lengthLine = posLineEnd - posLineStart;
+		if (lengthLine > longest.back().first) {
+			size_t index = longestCount - 1;
+			while (index != 0 && longest[index - 1].first < lengthLine) {
+				longest[index] = longest[index - 1];
+				--index;
+			}
+			longest[index] = { lengthLine, line };
+		}
+	}
+
+	const AutoSurface surface(this);
+	if (!surface) {
+		return;
+	}
+	XYPOSITION widthMax = 0;
+	std::unique_ptr<LineLayout> ll;
+	for (const auto &[lengthLine, line] : longest) {
+		if (lengthLine == 0) {
+			break;
+		}
+		if (lengthLine > maxMeasureLength) {
+			widthMax = std::max(widthMax, static_cast<XYPOSITION>(lengthLine) * vs.aveCharWidth);
+			continue;
+		}
+		if (ll) {
+			ll->Reset(line, lengthLine);
+		} else {
+			ll = std::make_unique<LineLayout>(line, static_cast<int>(lengthLine));
+		}
+		do {
+			view.LayoutLine(*this, surface, vs, ll.get(), LineLayout::wrapWidthInfinite, LayoutLineOption::IdleUpdate);
+		} while (ll->PartialPosition());
+		widthMax = std::max(widthMax, ll->positions[ll->numCharsInLine]);
+	}
+	view.lineWidthMaxSeen = std::max(view.lineWidthMaxSeen, static_cast<int>(widthMax));
+	if (view.lineWidthMaxSeen > scrollWidth) {
+		scrollWidth = view.lineWidthMaxSeen;
+		SetScrollBars();
+	}
+}
+
 bool Editor::WrapOneLine(Surface *surface, Sci::Position positionInsert) {
 	const Sci::Line lineToWrap = pdoc->SciLineFromPosition(positionInsert);
 	const int posInLine = static_cast<int>(positionInsert - pdoc->LineStart(lineToWrap));
@@ -1575,14 +1708,24 @@ bool Editor::WrapBlock(Surface *surface, Sci::Line lineToWrap, Sci::Line lineToW
 	const ElapsedPeriod epWrapping;
 	SetIdleTaskTime(IdleLineWrapTime);
 
-	// Wrap all the long lines in the main thread.
+	// Short lines not kept in the layout cache are left for the thread pool when the block is large enough.
+	const bool multiThreaded = hardwareConcurrency > 1
+		&& pdoc->LineStart(lineToWrapEnd) - pdoc->LineStart(lineToWrap) >= minParallelLayoutLength;
+	uint32_t parallelBytes = 0;
+
+	// Wrap all the long lines and significant lines in the main thread.
 	// LayoutLine may then multi-thread over segments in each line.
 	uint32_t wrappedBytesAllThread = 0;
-	for (size_t index = 0; index < linesBeingWrapped; index++) {
+	size_t index = 0;
+	for (; index < linesBeingWrapped; index++) {
 		const Sci::Line lineNumber = lineToWrap + index;
 		const Sci::Position lineStart = pdoc->LineStart(lineNumber);
 		const Sci::Position lineEnd = pdoc->LineStart(lineNumber + 1);
 		const int lengthLine = static_cast<int>(lineEnd - lineStart);
+		if (multiThreaded && lengthLine < static_cast<int>(ParallelLayoutBlockSize) && !significantLines.LineMayCache(lineNumber)) {
+			parallelBytes += lengthLine;
+			continue;
+		}
 		LineLayout * const ll = view.llc.Retrieve(lineNumber, significantLines, lengthLine);
 		if (lineNumber == significantLines.lineCaret) {
 			ll->caretPosition = static_cast<int>(caretPosition - lineStart);
@@ -1597,13 +1740,19 @@ bool Editor::WrapBlock(Surface *surface, Sci::Line lineToWrap, Sci::Line lineToW
 			break;
 		}
 	}
+	if (parallelBytes != 0) {
+		// lines after the partial line are wrapped in next block
+		const uint32_t lineCount = static_cast<uint32_t>(std::min(index + 1, linesBeingWrapped));
+		const uint32_t threadCount = view.WrapLinesParallel(*this, surface, vs, wrapWidth, lineToWrap, linesAfterWrap.get(), lineCount);
+		wrappedBytesAllThread += parallelBytes / threadCount;
+	}
 
 	const double duration = epWrapping.Duration();
 	durationWrapOneUnit.AddSample(wrappedBytesAllThread, duration);
 	UpdateParallelLayoutThreshold();
 
 	bool wrapOccurred = false;
-	for (size_t index = 0; index < linesBeingWrapped; index++) {
+	for (index = 0; index < linesBeingWrapped; index++) {
 		const Sci::Line lineNumber = lineToWrap + index;
 		int linesWrapped = linesAfterWrap[index];
 		if (vs.annotationVisible != AnnotationVisible::Hidden) {
@@ -1620,6 +1769,49 @@ bool Editor::WrapBlock(Surface *surface, Sci::Line lineToWrap, Sci::Line lineToW
 	return wrapOccurred;
 }
 
+// Give lines still waiting to be wrapped a height estimated from their length, so positions
+// after them are close to final and going to a line does not need to wrap all lines before it.
+// Exact heights are set when the lines are wrapped during idle or painting.
+bool Editor::EstimateWrapPending() {
+	const Sci::Line lineStart = std::max(wrapPending.start, wrapPending.estimated);
+	const Sci::Line lineEnd = std::min(wrapPending.end, pdoc->LinesTotal());
+	if (!Wrapping() || lineStart >= lineEnd) {
+		return false;
+	}
+	wrapPending.estimated = lineEnd;
+
+	PRectangle rcTextArea = GetClientRectangle();
+	rcTextArea.left = static_cast<XYPOSITION>(vs.textStart);
+	rcTextArea.right -= vs.rightMarginWidth;
+	const Sci::Position charsPerLine = std::max(static_cast<Sci::Position>(rcTextArea.Width() / vs.aveCharWidth), static_cast<Sci::Position>(1));
+	const bool annotationVisible = vs.annotationVisible != AnnotationVisible::Hidden;
+
+	const Sci::Line lineDocTop = pcs->DocFromDisplay(topLine);
+	const Sci::Line subLineTop = topLine - pcs->DisplayFromDoc(lineDocTop);
+	bool changed = false;
+	Sci::Position posLineStart = pdoc->LineStart(lineStart);
+	for (Sci::Line line = lineStart; line < lineEnd; line++) {
+		const Sci::Position posLineEnd = pdoc->LineStart(line + 1);
+		int height = 1 + static_cast<int>(std::max<Sci::Position>(posLineEnd - posLineStart - 1, 0) / charsPerLine);
+		if (annotationVisible) {
+			height += pdoc->AnnotationLines(line);
+		}
+		if (pcs->SetHeight(line, height)) {
+			changed = true;
+		}
+		posLineStart = posLineEnd;
+	}
+
+	if (changed) {
+		insideWrapScroll = true;
+		SetScrollBars();
+		SetTopLine(std::clamp<Sci::Line>(pcs->DisplayFromDocSub(lineDocTop, subLineTop), 0, MaxScrollPos()));
+		SetVerticalScrollPos();
+		insideWrapScroll = false;
+	}
+	return changed;
+}
+
 // Perform  wrapping for a subset of the lines needing wrapping.
 // wsAll: wrap all lines which need wrapping in this single call
 // wsVisible: wrap currently visible lines
@@ -1682,6 +1874,13 @@ bool Editor::WrapLines(WrapScope ws) {
 			constexpr double secondsAllowed = 0.01;
 			const int actionsInAllowedTime = durationWrapOneUnit.ActionsInAllowedTime(secondsAllowed);
 			lineToWrapEnd = pdoc->LineFromPositionAfter(lineToWrap, actionsInAllowedTime);
+			if (hardwareConcurrency > 1) {
+				// short lines already styled are wrapped by all threads in the same time
+				const Sci::Line lineStyled = pdoc->SciLineFromPosition(pdoc->GetEndStyled());
+				const Sci::Line lineParallel = pdoc->LineFromPositionAfter(lineToWrap,
+					static_cast<Sci::Position>(actionsInAllowedTime) * hardwareConcurrency);
+				lineToWrapEnd = std::max(lineToWrapEnd, std::min(lineParallel, lineStyled));
+			}
 		}
 
 		lineToWrapEnd = std::min(lineToWrapEnd, lineEndNeedWrap);
@@ -1698,7 +1897,10 @@ bool Editor::WrapLines(WrapScope ws) {
 			const AutoSurface surface(this);
 			if (surface) {
 				//Platform::DebugPrintf("Wraplines: scope=%0d need=%0d..%0d perform=%0d..%0d\n", ws, wrapPending.start, wrapPending.end, lineToWrap, lineToWrapEnd);
+				const ElapsedPeriod epWrap;
 				wrapOccurred = WrapBlock(surface, lineToWrap, lineToWrapEnd, partialLine);
+				frameCurrent.wrapDuration += epWrap.Duration();
+				frameCurrent.wrapLines += lineToWrapEnd - lineToWrap;
 				goodTopLine = pcs->DisplayFromDocSub(lineScrollTo.lineDoc, lineScrollTo.subLine);
 			}
 		}
@@ -1830,6 +2032,7 @@ void Editor::RefreshPixMaps(Surface *surfaceWindow) {
 }
 
 void Editor::Paint(Surface *surfaceWindow, PRectangle rcArea) {
+	const ElapsedPeriod epPaint;
 	redrawPendingText = false;
 	redrawPendingMargin = false;
 
@@ -1918,9 +2121,52 @@ void Editor::Paint(Surface *surfaceWindow, PRectangle rcArea) {
 	if (!view.bufferedDraw)
 		surfaceWindow->PopClip();
 
+	EndFrame(rcArea, epPaint.Duration());
 	NotifyPainted();
 }
 
+void Editor::EndFrame(PRectangle rcArea, double paintDuration) noexcept {
+	frameLast = frameCurrent;
+	frameLast.paintDuration = paintDuration;
+	// styling counters in current frame are totals of the document when previous frame ended
+	frameLast.styleDuration = std::max(pdoc->styledDuration - frameCurrent.styleDuration, 0.0);
+	frameLast.styleBytes = std::max<Sci::Position>(pdoc->styledBytes - frameCurrent.styleBytes, 0);
+	const Sci::Line linesDisplayed = pcs->LinesDisplayed();
+	const Sci::Line lineTop = TopLineOfMain();
+	const Sci::Line displayStart = std::min(lineTop + static_cast<Sci::Line>(rcArea.top) / vs.lineHeight, linesDisplayed);
+	const Sci::Line displayEnd = std::min(lineTop + static_cast<Sci::Line>(rcArea.bottom - 1) / vs.lineHeight + 1, linesDisplayed);
+	frameLast.paintLineStart = pcs->DocFromDisplay(displayStart);
+	frameLast.paintLineEnd = (displayEnd > displayStart) ? pcs->DocFromDisplay(displayEnd - 1) + 1 : frameLast.paintLineStart;
+
+	frameCurrent = {};
+	frameCurrent.styleDuration = pdoc->styledDuration;
+	frameCurrent.styleBytes = pdoc->styledBytes;
+}
+
+Sci::Position Editor::FrameStatistic(Scintilla::FrameStatistic statistic) const noexcept {
+	constexpr double scale = 1e6; // microsecond
+	switch (statistic) {
+	case FrameStatistic::PaintTime:
+		return static_cast<Sci::Position>(frameLast.paintDuration * scale);
+	case FrameStatistic::PaintLineStart:
+		return frameLast.paintLineStart;
+	case FrameStatistic::PaintLineEnd:
+		return frameLast.paintLineEnd;
+	case FrameStatistic::WrapTime:
+		return static_cast<Sci::Position>(frameLast.wrapDuration * scale);
+	case FrameStatistic::WrapLines:
+		return frameLast.wrapLines;
+	case FrameStatistic::StyleTime:
+		return static_cast<Sci::Position>(frameLast.styleDuration * scale);
+	case FrameStatistic::StyleBytes:
+		return frameLast.styleBytes;
+	case FrameStatistic::IdleTime:
+		return static_cast<Sci::Position>(frameLast.idleDuration * scale);
+	default:
+		return 0;
+	}
+}
+
 // This is mostly copied from the Paint method but with some things omitted
 // such as the margin markers, line numbers, selection and caret
 // Should be merged back into a combined Draw method.
@@ -2049,10 +2295,13 @@ void Editor::InsertCharacter(std::string_view sv, CharacterSource charSource) {
 		}
 
 		// Vector elements point into selection in order to change selection.
-		const std::vector<SelectionRange *> selPtrs = sel.SortedRanges();
-		// Loop in reverse to avoid disturbing positions of selections yet to be processed.
-		for (auto rit = selPtrs.rbegin(); rit != selPtrs.rend(); ++rit) {
-			SelectionRange *currentSel = *rit;
+		const bool batch = sel.BeginBatchEdit();
+		const std::vector<SelectionRange *> selPtrs = batch ? std::vector<SelectionRange *>() : sel.SortedRanges();
+		const size_t count = sel.Count();
+		// Loop in reverse to avoid disturbing positions of selections yet to be processed,
+		// batch edit loops forward as ranges are already sorted and moved on demand.
+		for (size_t index = 0; index < count; index++) {
+			SelectionRange *currentSel = batch ? &sel.BatchEditRange(index) : selPtrs[count - 1 - index];
 			if (!RangeContainsProtected(*currentSel)) {
 				Sci::Position positionInsert = currentSel->Start().Position();
 				std::string text;
@@ -2108,6 +2357,9 @@ void Editor::InsertCharacter(std::string_view sv, CharacterSource charSource) {
 				}
 			}
 		}
+		if (batch) {
+			sel.EndBatchEdit();
+		}
 
 		ThinRectangularRange();
 	}
@@ -2191,7 +2443,11 @@ void Editor::InsertPaste(const char *text, Sci::Position len) {
 		}
 	} else {
 		// MultiPaste::Each
+		const bool batch = sel.BeginBatchEdit();
 		for (size_t r = 0; r < sel.Count(); r++) {
+			if (batch) {
+				sel.BatchEditRange(r);
+			}
 			if (!RangeContainsProtected(sel.Range(r))) {
 				Sci::Position positionInsert = sel.Range(r).Start().Position();
 				ClearSelectionRange(sel.Range(r));
@@ -2203,6 +2459,9 @@ void Editor::InsertPaste(const char *text, Sci::Position len) {
 				sel.Range(r).ClearVirtualSpace();
 			}
 		}
+		if (batch) {
+			sel.EndBatchEdit();
+		}
 	}
 }
 
@@ -2238,7 +2497,11 @@ void Editor::ClearSelection(bool retainMultipleSelections) {
 	if (!sel.IsRectangular() && !retainMultipleSelections)
 		FilterSelections();
 	const UndoGroup ug(pdoc);
+	const bool batch = sel.BeginBatchEdit();
 	for (size_t r = 0; r < sel.Count(); r++) {
+		if (batch) {
+			sel.BatchEditRange(r);
+		}
 		if (!sel.Range(r).Empty()) {
 			SelectionRange rangeNew = sel.Range(r);
 			if (sel.selType == Selection::SelTypes::lines && sel.Count() == 1) {
@@ -2252,6 +2515,9 @@ void Editor::ClearSelection(bool retainMultipleSelections) {
 			}
 		}
 	}
+	if (batch) {
+		sel.EndBatchEdit();
+	}
 	ThinRectangularRange();
 	sel.RemoveDuplicates();
 	ClaimSelection();
@@ -2378,7 +2644,11 @@ void Editor::Clear() {
 			singleVirtual = true;
 		}
 		const UndoGroup ug(pdoc, (sel.Count() > 1) || singleVirtual);
+		const bool batch = sel.BeginBatchEdit();
 		for (size_t r = 0; r < sel.Count(); r++) {
+			if (batch) {
+				sel.BatchEditRange(r);
+			}
 			const Sci::Position caretPosition = sel.Range(r).caret.Position();
 			if (!RangeContainsProtected(caretPosition, caretPosition + 1)) {
 				if (sel.Range(r).Start().VirtualSpace()) {
@@ -2395,6 +2665,9 @@ void Editor::Clear() {
 				sel.Range(r).ClearVirtualSpace();
 			}
 		}
+		if (batch) {
+			sel.EndBatchEdit();
+		}
 	} else {
 		ClearSelection();
 	}
@@ -2441,14 +2714,27 @@ void Editor::RestoreSelection(Sci::Position newPos, UndoRedo history) {
 void Editor::Undo() {
 	if (pdoc->CanUndo()) {
 		InvalidateCaret();
-		const Sci::Position newPos = pdoc->Undo();
+		Sci::Position newPos;
+		if (pdoc->ReplaysCoalesced(false)) {
+			// repaint and notify container once for the coalesced replay
+			const BatchUpdateGroup group(this);
+			newPos = pdoc->Undo();
+		} else {
+			newPos = pdoc->Undo();
+		}
 		RestoreSelection(newPos, UndoRedo::undo);
 	}
 }
 
 void Editor::Redo() {
 	if (pdoc->CanRedo()) {
-		const Sci::Position newPos = pdoc->Redo();
+		Sci::Position newPos;
+		if (pdoc->ReplaysCoalesced(true)) {
+			const BatchUpdateGroup group(this);
+			newPos = pdoc->Redo();
+		} else {
+			newPos = pdoc->Redo();
+		}
 		RestoreSelection(newPos, UndoRedo::redo);
 	}
 }
@@ -2497,7 +2783,11 @@ void Editor::DelCharBack(bool allowLineStartDeletion) {
 		allowLineStartDeletion = false;
 	const UndoGroup ug(pdoc, (sel.Count() > 1) || !sel.Empty());
 	if (sel.Empty()) {
+		const bool batch = sel.BeginBatchEdit();
 		for (size_t r = 0; r < sel.Count(); r++) {
+			if (batch) {
+				sel.BatchEditRange(r);
+			}
 			const Sci::Position caretPosition = sel.Range(r).caret.Position();
 			if (!RangeContainsProtected(caretPosition - 1, caretPosition)) {
 				if (sel.Range(r).caret.VirtualSpace()) {
@@ -2519,6 +2809,9 @@ void Editor::DelCharBack(bool allowLineStartDeletion) {
 				sel.Range(r).ClearVirtualSpace();
 			}
 		}
+		if (batch) {
+			sel.EndBatchEdit();
+		}
 		ThinRectangularRange();
 	} else {
 		ClearSelection();
@@ -2670,6 +2963,7 @@ bool Editor::NotifyMarginClick(Point pt, KeyMod modifiers) {
 			const bool ctrl = FlagSet(modifiers, KeyMod::Ctrl);
 			const bool shift = FlagSet(modifiers, KeyMod::Shift);
 			const Sci::Line lineClick = pdoc->SciLineFromPosition(position);
+			pdoc->EnsureLineFolded(lineClick);
 			if (shift && ctrl) {
 				FoldAll(FoldAction::Toggle);
 			} else {
@@ -2801,9 +3095,33 @@ constexpr Sci::Position MovePositionForDeletion(Sci::Position position, Sci::Pos
 
 }
 
+void Editor::BatchUpdateModified(const DocModification &mh) noexcept {
+	BatchUpdateSavedState &state = batchUpdateState;
+	const Sci::Position position = mh.position;
+	const Sci::Position length = mh.length;
+	if (state.changeStart < 0) {
+		state.changeStart = position;
+		state.changeEnd = FlagSet(mh.modificationType, ModificationFlags::InsertText) ? position + length : position;
+	} else if (FlagSet(mh.modificationType, ModificationFlags::InsertText)) {
+		const Sci::Position end = (state.changeEnd >= position) ? state.changeEnd + length : state.changeEnd;
+		state.changeStart = std::min(state.changeStart, position);
+		state.changeEnd = std::max(end, position + length);
+	} else {
+		Sci::Position end = state.changeEnd;
+		if (end > position) {
+			end = std::max(end - length, position);
+		}
+		state.changeStart = std::min(state.changeStart, position);
+		state.changeEnd = std::max(end, position);
+	}
+}
+
 void Editor::NotifyModified(Document *, DocModification mh, void *) {
 	if (FlagSet(mh.modificationType, ModificationFlags::InsertText | ModificationFlags::DeleteText)) {
 		ContainerNeedsUpdate(Update::Content);
+		if (batchUpdateDepth != 0) {
+			BatchUpdateModified(mh);
+		}
 	}
 	if (paintState == PaintState::painting) {
 		CheckForChangeOutsidePaint(Range(mh.position, mh.position + mh.length));
@@ -2847,7 +3165,8 @@ void Editor::NotifyModified(Document *, DocModification mh, void *) {
 	} else {
 		if (FlagSet(undoSelectionHistoryOption, UndoSelectionHistoryOption::Enabled) &&
 			FlagSet(mh.modificationType, ModificationFlags::User)) {
-			if (FlagSet(mh.modificationType, ModificationFlags::BeforeInsert | ModificationFlags::BeforeDelete)) {
+			// inside batch edit, only selection before the first modification can be restored.
+			if (FlagSet(mh.modificationType, ModificationFlags::BeforeInsert | ModificationFlags::BeforeDelete) && !sel.BatchEditModified()) {
 				RememberSelectionForUndo(pdoc->UndoCurrent());
 			}
 			if (FlagSet(mh.modificationType, ModificationFlags::InsertText | ModificationFlags::DeleteText)) {
@@ -2908,6 +3227,14 @@ void Editor::NotifyModified(Document *, DocModification mh, void *) {
 					}
 				}
 				NeedWrapping(lineDoc, lineDoc + lines + 1);
+			} else if (trackLineWidth) {
+				if (scrollWidthPendingStart < scrollWidthPendingEnd && lineDoc < scrollWidthPendingEnd) {
+					scrollWidthPendingEnd += mh.linesAdded;
+				}
+				if (lines != 0) {
+					// single line edits are measured when painted
+					NeedScrollWidth(lineDoc, lineDoc + lines + 1);
+				}
 			}
 			RefreshStyleData();
 			// Fix up annotation heights
@@ -2923,14 +3250,15 @@ void Editor::NotifyModified(Document *, DocModification mh, void *) {
 				}
 			}
 
-			if (paintState == PaintState::notPainting && !CanDeferToLastStep(mh)) {
+			// window is repainted once at the end of batch update
+			if (batchUpdateDepth == 0 && paintState == PaintState::notPainting && !CanDeferToLastStep(mh)) {
 				if (SynchronousStylingToVisible()) {
 					QueueIdleWork(WorkItems::style, pdoc->LengthNoExcept());
 				}
 				Redraw();
 			}
 		} else {
-			if (paintState == PaintState::notPainting && mh.length && !CanEliminate(mh)) {
+			if (batchUpdateDepth == 0 && paintState == PaintState::notPainting && mh.length && !CanEliminate(mh)) {
 				if (SynchronousStylingToVisible()) {
 					QueueIdleWork(WorkItems::style, mh.position + mh.length);
 				}
@@ -2942,7 +3270,7 @@ void Editor::NotifyModified(Document *, DocModification mh, void *) {
 		}
 	}
 
-	if (mh.linesAdded != 0 && !CanDeferToLastStep(mh)) {
+	if (mh.linesAdded != 0 && batchUpdateDepth == 0 && !CanDeferToLastStep(mh)) {
 		SetScrollBars();
 	}
 
@@ -4260,6 +4588,75 @@ std::unique_ptr<CaseFolder> Editor::CaseFolderForEncoding() const {
 	return std::make_unique<CaseFolderTable>();
 }
 
+namespace {
+
+// search line aligned chunks in parallel, matches for text without line break never cross chunk boundary.
+struct FindAllWorker {
+	struct Chunk {
+		Sci::Position start;
+		Sci::Position end;
+		Sci::Position resume = 0;	// where search stopped
+		bool failed = false;
+		std::vector<Sci::Position> ranges {};
+	};
+
+	Document * const pdoc;
+	const char * const search;
+	const Sci::Position lengthSearch;
+	const FindOption flags;
+	const Sci::Position maxCount;
+	std::vector<Chunk> chunks;
+	std::atomic<uint32_t> nextIndex = 0;
+
+	static constexpr Sci::Position blockSize = 1024*1024;
+
+	void Search(Chunk &chunk) const {
+		Sci::Position pos = chunk.start;
+		Sci::Position count = 0;
+		while (pos < chunk.end && count < maxCount) {
+			Sci::Position lengthFound = lengthSearch;
+			const Sci::Position found = pdoc->FindText(pos, chunk.end, search, flags, &lengthFound);
+			if (found < 0) {
+				pos = chunk.end;
+				break;
+			}
+			Sci::Position endFound = found + lengthFound;
+			if (FlagSet(flags, FindOption::MatchToWordEnd)) {
+				endFound = pdoc->ExtendWordSelect(endFound, 1, true);
+			}
+			chunk.ranges.push_back(found);
+			chunk.ranges.push_back(endFound - found);
+			++count;
+			// skip a character after empty match
+			pos = (endFound == found) ? pdoc->NextPosition(found, 1) : endFound;
+		}
+		chunk.resume = std::min(pos, chunk.end);
+	}
+
+	void DoWork() noexcept {
+		const uint32_t chunkCount = static_cast<uint32_t>(chunks.size());
+		while (true) {
+			const uint32_t index = nextIndex.fetch_add(1, std::memory_order_relaxed);
+			if (index >= chunkCount) {
+				break;
+			}
+			Chunk &chunk = chunks[index];
+			try {
+				Search(chunk);
+			} catch (...) {
+				chunk.failed = true;
+			}
+		}
+	}
+
+	static void WorkCallback(void *context) {
+		FindAllWorker *worker = static_cast<FindAllWorker *>(context);
+		worker->DoWork();
+	}
+};
+
+}
+
 /**
  * Search of a text in the document, in the given range.
  * @return The position of the found text, -1 if not found.
@@ -4413,6 +4810,268 @@ Sci::Position Editor::SearchInTarget(const char *text, Sci::Position length) {
 	}
 }
 
+/**
+ * Search all occurrences of a text in the document, in the given forward range.
+ * Plain text without line break is searched on line aligned chunks in parallel.
+ * @return The number of ranges stored in @c TextToFindAllFull::ranges.
+ */
+Sci::Position Editor::FindAllFull(uptr_t wParam, sptr_t lParam) {
+	TextToFindAllFull *ft = AsPointer<TextToFindAllFull *>(lParam);
+	const FindOption flags = static_cast<FindOption>(wParam);
+	const Sci::Position minPos = ft->chrg.cpMin;
+	const Sci::Position maxPos = std::min(ft->chrg.cpMax, pdoc->LengthNoExcept());
+	const Sci::Position maxCount = ft->maxCount;
+	const Sci::Position lengthSearch = strlen(ft->lpstrText);
+	if (minPos >= maxPos || maxCount <= 0 || lengthSearch == 0) {
+		return 0;
+	}
+	if (!pdoc->HasCaseFolder())
+		pdoc->SetCaseFolder(CaseFolderForEncoding());
+	pdoc->BuildSearchIndex();
+
+	FindAllWorker worker{pdoc, ft->lpstrText, lengthSearch, flags, maxCount, {}};
+	// regex engine has search state, text with line break may match across chunks.
+	const bool parallel = hardwareConcurrency > 1 && !FlagSet(flags, FindOption::RegExp)
+		&& (maxPos - minPos) >= 2*FindAllWorker::blockSize
+		&& ft->lpstrText[strcspn(ft->lpstrText, "\r\n")] == '\0';
+	try {
+		if (parallel) {
+			const Sci::Position chunkCount = std::min<Sci::Position>((maxPos - minPos)/FindAllWorker::blockSize, 4*hardwareConcurrency);
+			const Sci::Position chunkSize = (maxPos - minPos)/chunkCount;
+			Sci::Position start = minPos;
+			for (Sci::Position i = 1; i < chunkCount && start < maxPos; i++) {
+				const Sci::Position end = std::min(pdoc->LineStart(pdoc->SciLineFromPosition(minPos + i*chunkSize) + 1), maxPos);
+				if (end > start) {
+					worker.chunks.push_back({start, end});
+					start = end;
+				}
+			}
+			if (start < maxPos) {
+				worker.chunks.push_back({start, maxPos});
+			}
+		} else {
+			worker.chunks.push_back({minPos, maxPos});
+		}
+
+		const uint32_t threadCount = std::min(static_cast<uint32_t>(worker.chunks.size()), hardwareConcurrency);
+		if (threadCount > 1) {
+			workerPool.Run(FindAllWorker::WorkCallback, &worker, threadCount);
+		} else {
+			worker.Search(worker.chunks.front());
+		}
+	} catch (const RegexError &) {
+		errorStatus = Status::RegEx;
+		ft->chrg.cpMin = maxPos;
+		return 0;
+	}
+
+	// merge sorted ranges from each chunk, stop at first unfinished chunk.
+	Sci::Position count = 0;
+	Sci::Position resume = maxPos;
+	for (const auto &chunk : worker.chunks) {
+		if (chunk.failed) {
+			// out of memory in worker thread, give up remaining range
+			errorStatus = Status::BadAlloc;
+			break;
+		}
+		const Sci::Position found = chunk.ranges.size()/2;
+		const Sci::Position stored = std::min(found, maxCount - count);
+		std::copy_n(chunk.ranges.data(), stored*2, ft->ranges + count*2);
+		count += stored;
+		if (stored < found) {
+			const Sci::Position *range = ft->ranges + (count - 1)*2;
+			resume = range[0] + range[1];
+			if (range[1] == 0) {
+				resume = pdoc->NextPosition(resume, 1);
+			}
+			break;
+		}
+		if (chunk.resume < chunk.end) {
+			resume = chunk.resume;
+			break;
+		}
+	}
+	ft->chrg.cpMin = resume;
+	return count;
+}
+
+namespace {
+
+// count characters and UTF-16 code units on character aligned chunks in parallel.
+struct CountCharactersWorker {
+	struct Chunk {
+		Sci::Position start;
+		Sci::Position end;
+		Sci::Position count;
+		Sci::Position countUTF16;
+	};
+
+	static constexpr Sci::Position blockSize = 16*1024*1024;
+	static constexpr uint32_t maxChunkCount = 64;
+
+	const Document * const pdoc;
+	uint32_t chunkCount = 0;
+	std::atomic<uint32_t> nextIndex = 0;
+	Chunk chunks[maxChunkCount] {};
+
+	void Count(Chunk &chunk) const noexcept {
+		pdoc->CountCharactersAndUTF16(chunk.start, chunk.end, chunk.count, chunk.countUTF16);
+	}
+
+	void DoWork() noexcept {
+		while (true) {
+			const uint32_t index = nextIndex.fetch_add(1, std::memory_order_relaxed);
+			if (index >= chunkCount) {
+				break;
+			}
+			Count(chunks[index]);
+		}
+	}
+
+	static void WorkCallback(void *context) {
+		CountCharactersWorker *worker = static_cast<CountCharactersWorker *>(context);
+		worker->DoWork();
+	}
+};
+
+}
+
+/**
+ * Count characters (or UTF-16 code units when @a utf16 is true) between two positions.
+ * Huge UTF-8 range is counted with character block index when the document has it,
+ * otherwise split at character boundary and counted in parallel.
+ */
+Sci::Position Editor::CountCharacters(Sci::Position startPos, Sci::Position endPos, bool utf16) const {
+	startPos = pdoc->MovePositionOutsideChar(startPos, 1, false);
+	endPos = pdoc->MovePositionOutsideChar(endPos, -1, false);
+	if (startPos >= endPos) {
+		return 0;
+	}
+
+	const bool indexed = pdoc->BuildCharacterIndex();
+	CountCharactersWorker worker{pdoc};
+	Sci::Position chunkCount = 1;
+	if (!indexed && hardwareConcurrency > 1 && pdoc->dbcsCodePage == CpUtf8 && (endPos - startPos) >= 2*CountCharactersWorker::blockSize) {
+		chunkCount = std::min<Sci::Position>({(endPos - startPos)/CountCharactersWorker::blockSize, 4*hardwareConcurrency, CountCharactersWorker::maxChunkCount});
+	}
+	const Sci::Position chunkSize = (endPos - startPos)/chunkCount;
+	Sci::Position start = startPos;
+	for (Sci::Position i = 1; i < chunkCount; i++) {
+		const Sci::Position end = pdoc->MovePositionOutsideChar(startPos + i*chunkSize, 1, false);
+		if (end > start && end < endPos) {
+			worker.chunks[worker.chunkCount++] = {start, end, 0, 0};
+			start = end;
+		}
+	}
+	worker.chunks[worker.chunkCount++] = {start, endPos, 0, 0};
+
+	const uint32_t threadCount = std::min(worker.chunkCount, hardwareConcurrency);
+	if (threadCount > 1) {
+		workerPool.Run(CountCharactersWorker::WorkCallback, &worker, threadCount);
+	} else {
+		worker.Count(worker.chunks[0]);
+	}
+
+	Sci::Position count = 0;
+	for (uint32_t i = 0; i < worker.chunkCount; i++) {
+		const auto &chunk = worker.chunks[i];
+		count += utf16 ? chunk.countUTF16 : chunk.count;
+	}
+	return count;
+}
+
+Sci::Position Editor::ReplaceAllInTarget(bool replacePatterns, const char *search, const char *text) {
+	const Sci::Position lengthSearch = strlen(search);
+	if (lengthSearch == 0) {
+		return 0;
+	}
+	const std::string_view replacement(text);
+	if (!pdoc->HasCaseFolder())
+		pdoc->SetCaseFolder(CaseFolderForEncoding());
+
+	// document is not changed while searching, replaced text is built from the first to the last match
+	const Sci::Position endSearch = targetRange.end.Position();
+	Sci::Position start = targetRange.start.Position();
+	Sci::Position startReplace = 0;
+	Sci::Position copied = 0;
+	Sci::Position count = 0;
+	std::string replaced;
+	// caret and anchor are moved as if each match was replaced separately,
+	// a position inside a match is moved to start of its replacement.
+	const bool singleSelection = sel.Count() == 1 && !sel.IsRectangular();
+	Sci::Position tracked[2] = { sel.MainCaret(), sel.MainAnchor() };
+	bool trackedDone[2] = { false, false };
+	Sci::Position shift = 0;
+	try {
+		for (;;) {
+			Sci::Position lengthFound = lengthSearch;
+			const Sci::Position pos = pdoc->FindText(start, endSearch, search, searchFlags, &lengthFound);
+			if (pos < 0) {
+				break;
+			}
+			if (count == 0) {
+				startReplace = pos;
+				copied = pos;
+				replaced.reserve(endSearch - pos);
+			}
+			const Sci::Position offset = replaced.length();
+			replaced.resize(offset + pos - copied);
+			pdoc->GetCharRange(replaced.data() + offset, copied, pos - copied);
+			copied = pos + lengthFound;
+			for (int i = 0; i < 2; i++) {
+				if (!trackedDone[i] && tracked[i] < copied) {
+					tracked[i] = std::min(tracked[i], pos) + shift;
+					trackedDone[i] = true;
+				}
+			}
+			const size_t lengthBefore = replaced.length();
+			if (replacePatterns) {
+				Sci::Position length = replacement.length();
+				const char *p = pdoc->SubstituteByPosition(replacement.data(), &length);
+				if (p) {
+					replaced.append(p, length);
+				} else {
+					// keep the match like ReplaceTargetRE
+					replaced.append(RangeText(pos, copied));
+				}
+			} else {
+				replaced.append(replacement);
+			}
+			shift += static_cast<Sci::Position>(replaced.length() - lengthBefore) - lengthFound;
+			++count;
+
+			start = copied;
+			if (start >= endSearch) {
+				break;
+			}
+			if (lengthFound == 0) {
+				// skip a character after empty match
+				start = pdoc->NextPosition(start, 1);
+				if (start > endSearch) {
+					break;
+				}
+			}
+		}
+	} catch (const RegexError &) {
+		errorStatus = Status::RegEx;
+		return 0;
+	}
+
+	if (count != 0) {
+		const Sci::Position lengthInserted = pdoc->ReplaceRange(startReplace, copied - startReplace, replaced);
+		targetRange = SelectionSegment(SelectionPosition(startReplace), SelectionPosition(startReplace + lengthInserted));
+		if (singleSelection) {
+			for (int i = 0; i < 2; i++) {
+				if (!trackedDone[i]) {
+					tracked[i] += shift;
+				}
+			}
+			SetSelection(tracked[0], tracked[1]);
+		}
+	}
+	return count;
+}
+
 void Editor::GoToLine(Sci::Line lineNo) {
 	lineNo = std::clamp<Sci::Line>(lineNo, 0, pdoc->LinesTotal());
 	SetEmptySelection(pdoc->LineStart(lineNo));
@@ -4478,8 +5137,20 @@ void Editor::CopySelectionRange(SelectionText &ss, bool allowLineCopy) const {
 				separator = copySeparator;
 			}
 		}
+		// copy all parts into one buffer, a rectangular selection may span millions of lines
+		size_t totalLength = 0;
+		for (const SelectionRange *range : rangesInOrder) {
+			totalLength += range->Length() + separator.length();
+		}
+		text.reserve(totalLength);
 		for (size_t part = 0; part < rangesInOrder.size();) {
-			text.append(RangeText(rangesInOrder[part]->Start().Position(), rangesInOrder[part]->End().Position()));
+			const Sci::Position start = rangesInOrder[part]->Start().Position();
+			const Sci::Position length = rangesInOrder[part]->End().Position() - start;
+			if (length > 0) {
+				const size_t offset = text.length();
+				text.resize(offset + length);
+				pdoc->GetCharRange(text.data() + offset, start, length);
+			}
 			++part;
 			if (separate && part < rangesInOrder.size()) {
 				// Append unless simple selection or last part of multiple selection
@@ -5253,6 +5924,7 @@ void Editor::ButtonUpWithModifiers(Point pt, unsigned int curTime, KeyMod modifi
 }
 
 bool Editor::Idle() {
+	const ElapsedPeriod epIdle;
 	NotifyUpdateUI();
 
 	bool needWrap = Wrapping() && wrapPending.NeedsWrap();
@@ -5264,6 +5936,8 @@ bool Editor::Idle() {
 		needWrap = wrapPending.NeedsWrap();
 	} else if (needIdleStyling) {
 		IdleStyle();
+	} else if (ScrollWidthPending()) {
+		IdleScrollWidth();
 	}
 
 	// Add more idle things to do here, but make sure idleDone is
@@ -5271,8 +5945,9 @@ bool Editor::Idle() {
 	// false will stop calling this idle function until SetIdle() is
 	// called again.
 
-	const bool idleDone = !needWrap && !needIdleStyling; // && thatDone && theOtherThingDone...
+	const bool idleDone = !needWrap && !needIdleStyling && !ScrollWidthPending(); // && thatDone && theOtherThingDone...
 
+	frameCurrent.idleDuration += epIdle.Duration();
 	return !idleDone;
 }
 
@@ -5281,7 +5956,7 @@ void Editor::TickFor(TickReason reason) {
 	case TickReason::caret:
 		caret.on = !caret.on;
 		if (caret.active) {
-			InvalidateCaret();
+			InvalidateCaretBlink();
 		}
 		break;
 	case TickReason::scroll:
@@ -5407,6 +6082,7 @@ void Editor::StyleAreaBounded(PRectangle rcArea, bool scrolling) {
 		// Can style all wanted now.
 		StyleToPositionInView(posAfterArea);
 	}
+	pdoc->EnsureFoldedTo(std::min(posAfterArea, pdoc->GetEndStyled()));
 	StartIdleStyling(posAfterMax < posAfterArea);
 }
 
@@ -5414,6 +6090,10 @@ void Editor::IdleStyle() {
 	const Sci::Position posAfterArea = PositionAfterArea(GetClientRectangle());
 	const Sci::Position endGoal = (idleStyling >= IdleStyling::AfterVisible) ?
 		pdoc->LengthNoExcept() : posAfterArea;
+	if (backgroundStyling && idleStyling >= IdleStyling::AfterVisible && pdoc->StyleInBackground(endGoal, hardwareConcurrency)) {
+		// keep idle running to commit finished chunks
+		return;
+	}
 	const Sci::Position posAfterMax = PositionAfterMaxStyling(endGoal, false);
 	pdoc->StyleToAdjustingLineDuration(posAfterMax);
 	if (pdoc->GetEndStyled() >= endGoal) {
@@ -5533,6 +6213,8 @@ void Editor::SetDocPointer(Document *document) {
 	pdoc->AddRef();
 	modelState.reset();
 	pcs = ContractionStateCreate(pdoc->IsLarge());
+	frameCurrent.styleDuration = pdoc->styledDuration;
+	frameCurrent.styleBytes = pdoc->styledBytes;
 
 	// Ensure all positions within document
 	sel.Clear();
@@ -5553,6 +6235,7 @@ void Editor::SetDocPointer(Document *document) {
 	SetAnnotationHeights(0, pdoc->LinesTotal());
 	view.llc.Deallocate();
 	NeedWrapping();
+	NeedScrollWidth(0, pdoc->LinesTotal());
 
 	hotspot = Range(Sci::invalidPosition);
 	hoverIndicatorPos = Sci::invalidPosition;
@@ -5564,6 +6247,27 @@ void Editor::SetDocPointer(Document *document) {
 	Redraw();
 }
 
+void Editor::SetDocumentOptions(DocumentOption options) {
+	if (options == pdoc->Options()) {
+		return;
+	}
+	Document *document = new Document(options);
+	document->AddRef();
+	if (pdoc->IsShared()) {
+		// text is still used by other views
+		document->CopyTextSettings(*pdoc);
+		const Sci::Position length = pdoc->Length();
+		document->Allocate(length + 1);
+		document->SetUndoCollection(false);
+		document->InsertString(0, pdoc->BufferPointer(), length);
+		document->SetUndoCollection(true);
+	} else {
+		document->AdoptText(*pdoc);
+	}
+	SetDocPointer(document);
+	document->Release();
+}
+
 void Editor::SetAnnotationVisible(AnnotationVisible visible) {
 	if (vs.annotationVisible != visible) {
 		const bool changedFromOrToHidden = ((vs.annotationVisible != AnnotationVisible::Hidden) != (visible != AnnotationVisible::Hidden));
@@ -5626,6 +6330,7 @@ void Editor::SetFoldExpanded(Sci::Line lineDoc, bool expanded) {
 
 void Editor::FoldLine(Sci::Line line, FoldAction action) {
 	if (line >= 0) {
+		pdoc->EnsureLineFolded(line);
 		FoldLevel level = pdoc->GetFoldLevel(line);
 		if (action == FoldAction::Toggle) {
 			if (!LevelIsHeader(level)) {
@@ -5715,12 +6420,14 @@ Sci::Line Editor::ContractedFoldNext(Sci::Line lineStart) const noexcept {
 void Editor::EnsureLineVisible(Sci::Line lineDoc, bool enforcePolicy) {
 	// In case in need of wrapping to ensure DisplayFromDoc works.
 	if (lineDoc >= wrapPending.start) {
-		if (WrapLines(WrapScope::wsAll)) {
+		const bool estimated = EstimateWrapPending();
+		if (WrapLines(WrapScope::wsAll) || estimated) {
 			Redraw();
 		}
 	}
 
 	if (!pcs->GetVisible(lineDoc)) {
+		pdoc->EnsureLineFolded(lineDoc);
 		// Back up to find a non-blank line
 		Sci::Line lookLine = lineDoc;
 		FoldLevel lookLineLevel = pdoc->GetFoldLevel(lookLine);
@@ -5771,7 +6478,7 @@ void Editor::FoldAll(FoldAction action) {
 	action = static_cast<FoldAction>(static_cast<int>(action) & ~static_cast<int>(FoldAction::ContractEveryLevel));
 	bool expanding = action == FoldAction::Expand;
 	if (!expanding) {
-		pdoc->EnsureStyledTo(pdoc->LengthNoExcept());
+		pdoc->EnsureFoldedTo(pdoc->LengthNoExcept());
 	}
 
 	Sci::Line line = 0;
@@ -5789,9 +6496,13 @@ void Editor::FoldAll(FoldAction action) {
 		}
 	}
 	if (expanding) {
-		pcs->SetVisible(0, maxLine - 1, true);
+		pcs->SetHiddenRanges(nullptr, 0);
 		pcs->ExpandAll();
 	} else {
+		// collect contracted headers and hidden lines as (start, length) pairs then apply them in bulk
+		std::vector<ptrdiff_t> headers;
+		std::vector<ptrdiff_t> hidden;
+		Sci::Line hiddenEnd = 0;
 		FoldLevel topLevel = FoldLevel::NumberMask;
 		for (; line < maxLine; line++) {
 			const FoldLevel level = pdoc->GetFoldLevel(line);
@@ -5801,8 +6512,13 @@ void Editor::FoldAll(FoldAction action) {
 					topLevel = levelNum;
 					const Sci::Line lineMaxSubord = pdoc->GetLastChild(line, level);
 					if (lineMaxSubord > line) {
-						pcs->SetExpanded(line, false);
-						pcs->SetVisible(line + 1, lineMaxSubord, false);
+						headers.push_back(line);
+						headers.push_back(1);
+						if (line >= hiddenEnd) {
+							hidden.push_back(line + 1);
+							hidden.push_back(lineMaxSubord - line);
+							hiddenEnd = lineMaxSubord + 1;
+						}
 						if (!contractAll) {
 							line = lineMaxSubord;
 						}
@@ -5810,17 +6526,79 @@ void Editor::FoldAll(FoldAction action) {
 				} else if (contractAll) {
 					const FoldLevel levelNext = pdoc->GetFoldLevel(line + 1);
 					if (levelNum < LevelNumberPart(levelNext)) {
-						pcs->SetExpanded(line, false);
+						headers.push_back(line);
+						headers.push_back(1);
 					}
 				}
 			}
 		}
+		pcs->SetExpandedRanges(headers.data(), headers.size()/2, false);
+		pcs->SetHiddenRanges(hidden.data(), hidden.size()/2);
 	}
 
 	SetScrollBars();
 	Redraw();
 }
 
+void Editor::FoldAtLevel(FoldAction action, int level) {
+	const Sci::Line maxLine = pdoc->LinesTotal();
+	const bool nestingDepth = FlagSet(action, FoldAction::NestingDepth);
+	action = static_cast<FoldAction>(static_cast<int>(action) & (static_cast<int>(FoldAction::Toggle) | static_cast<int>(FoldAction::Expand)));
+	bool expanding = action == FoldAction::Expand;
+	pdoc->EnsureFoldedTo(pdoc->LengthNoExcept());
+
+	// headers having children at the level
+	std::vector<ptrdiff_t> ranges;
+	std::vector<FoldLevel> levelStack;
+	for (Sci::Line line = 0; line < maxLine; line++) {
+		const FoldLevel levelLine = pdoc->GetFoldLevel(line);
+		if (LevelIsHeader(levelLine)) {
+			const FoldLevel levelNum = LevelNumberPart(levelLine);
+			int depth;
+			if (nestingDepth) {
+				while (!levelStack.empty() && levelNum <= levelStack.back()) {
+					levelStack.pop_back();
+				}
+				levelStack.push_back(levelNum);
+				depth = static_cast<int>(levelStack.size()) - 1;
+			} else {
+				depth = LevelNumber(levelLine) - LevelNumber(FoldLevel::Base);
+			}
+			if ((level < 0 || depth == level) && levelNum < LevelNumberPart(pdoc->GetFoldLevel(line + 1))) {
+				if (action == FoldAction::Toggle) {
+					// first header decides the state for all
+					expanding = !pcs->GetExpanded(line);
+					action = expanding ? FoldAction::Expand : FoldAction::Contract;
+				}
+				ranges.push_back(line);
+				ranges.push_back(1);
+			}
+		}
+	}
+	if (ranges.empty()) {
+		return;
+	}
+	pcs->SetExpandedRanges(ranges.data(), ranges.size()/2, expanding);
+
+	// a line is hidden when it is a child of any contracted header
+	ranges.clear();
+	for (Sci::Line line = 0; line < maxLine; line++) {
+		const FoldLevel levelLine = pdoc->GetFoldLevel(line);
+		if (LevelIsHeader(levelLine) && !pcs->GetExpanded(line)) {
+			const Sci::Line lineMaxSubord = pdoc->GetLastChild(line, levelLine);
+			if (lineMaxSubord > line) {
+				ranges.push_back(line + 1);
+				ranges.push_back(lineMaxSubord - line);
+				line = lineMaxSubord;
+			}
+		}
+	}
+	pcs->SetHiddenRanges(ranges.data(), ranges.size()/2);
+
+	SetScrollBars();
+	Redraw();
+}
+
 void Editor::FoldChanged(Sci::Line line, FoldLevel levelNow, FoldLevel levelPrev) {
 	if (LevelIsHeader(levelNow)) {
 		if (!LevelIsHeader(levelPrev)) {
@@ -5930,6 +6708,15 @@ Sci::Position Editor::ReplaceTarget(Message iMessage, uptr_t wParam, sptr_t lPar
 	// Make a copy of targetRange in case callbacks use target
 	SelectionSegment replaceRange = targetRange;
 
+	if (iMessage == Message::ReplaceTargetMinimal && !replaceRange.start.VirtualSpace()) {
+		// Replace as one block so per line data is kept when number of lines is unchanged
+		const Sci::Position lengthInserted = pdoc->ReplaceRange(replaceRange.start.Position(), replaceRange.Length(), text);
+		replaceRange.end = replaceRange.start;
+		replaceRange.end.SetPosition(replaceRange.start.Position() + lengthInserted);
+		targetRange = replaceRange;
+		return text.length();
+	}
+
 	// Remove the text inside the range
 	if (replaceRange.Length() > 0) {
 		pdoc->DeleteChars(replaceRange.start.Position(), replaceRange.Length());
@@ -6410,6 +7197,10 @@ sptr_t Editor::WndProc(Message iMessage, uptr_t wParam, sptr_t lParam) {
 		pdoc->AllocateLines(wParam);
 		break;
 
+	case Message::SetLineStartsHint:
+		pdoc->SetLineStartsHint(wParam, AsPointer<const Sci::Position *>(lParam));
+		break;
+
 	case Message::GetModify:
 		return !pdoc->IsSavePoint();
 
@@ -6536,6 +7327,11 @@ sptr_t Editor::WndProc(Message iMessage, uptr_t wParam, sptr_t lParam) {
 		PLATFORM_ASSERT(lParam);
 		return SearchInTarget(ConstCharPtrFromSPtr(lParam), PositionFromUPtr(wParam));
 
+	case Message::ReplaceAllInTarget:
+	case Message::ReplaceAllInTargetRE:
+		PLATFORM_ASSERT(wParam && lParam);
+		return ReplaceAllInTarget(iMessage == Message::ReplaceAllInTargetRE, ConstCharPtrFromUPtr(wParam), ConstCharPtrFromSPtr(lParam));
+
 	case Message::SetSearchFlags:
 		searchFlags = static_cast<FindOption>(wParam);
 		break;
@@ -6624,6 +7420,9 @@ sptr_t Editor::WndProc(Message iMessage, uptr_t wParam, sptr_t lParam) {
 	case Message::FindTextFull:
 		return FindTextFull(wParam, lParam);
 
+	case Message::FindAllFull:
+		return FindAllFull(wParam, lParam);
+
 	case Message::GetTextRangeFull:
 		if (const TextRangeFull *tr = AsPointer<const TextRangeFull *>(lParam)) {
 			return GetTextRange(tr->lpstrText, tr->chrg.cpMin, tr->chrg.cpMax);
@@ -6720,6 +7519,13 @@ sptr_t Editor::WndProc(Message iMessage, uptr_t wParam, sptr_t lParam) {
 	case Message::GetUndoCollection:
 		return pdoc->IsCollectingUndo();
 
+	case Message::SetUndoMemoryBudget:
+		pdoc->SetUndoMemoryBudget(wParam);
+		break;
+
+	case Message::GetUndoMemoryBudget:
+		return pdoc->UndoMemoryBudget();
+
 	case Message::BeginUndoAction:
 		if (wParam == 0) {
 			pdoc->BeginUndoAction();
@@ -7072,6 +7878,13 @@ sptr_t Editor::WndProc(Message iMessage, uptr_t wParam, sptr_t lParam) {
 	case Message::GetBufferedDraw:
 		return view.bufferedDraw;
 
+	case Message::SetScrollBlit:
+		scrollBlit = wParam != 0;
+		break;
+
+	case Message::GetScrollBlit:
+		return scrollBlit;
+
 	case Message::GetDragDropEnabled:
 		return dragDropEnabled;
 
@@ -7203,6 +8016,32 @@ sptr_t Editor::WndProc(Message iMessage, uptr_t wParam, sptr_t lParam) {
 	case Message::GetIdleStyling:
 		return static_cast<sptr_t>(idleStyling);
 
+	case Message::SetBackgroundStyling:
+		backgroundStyling = wParam != 0;
+		break;
+
+	case Message::GetBackgroundStyling:
+		return backgroundStyling;
+
+	case Message::SetLineStyler: {
+		const LineStyler styler = reinterpret_cast<LineStyler>(lParam);
+		if (styler != pdoc->GetLineStyler()) {
+			pdoc->SetLineStyler(styler);
+			InvalidateStyleRedraw();
+		}
+	} break;
+
+	case Message::GetLineStyler:
+		return reinterpret_cast<sptr_t>(pdoc->GetLineStyler());
+
+	case Message::GetStylingCache: {
+		const std::string cache = pdoc->GetStylingCache();
+		return BytesResult(lParam, cache);
+	}
+
+	case Message::SetStylingCache:
+		return pdoc->SetStylingCache(ConstCharPtrFromSPtr(lParam), PositionFromUPtr(wParam));
+
 	case Message::SetWrapMode:
 		if (vs.SetWrapState(static_cast<Wrap>(wParam))) {
 			xOffset = 0;
@@ -7270,12 +8109,29 @@ sptr_t Editor::WndProc(Message iMessage, uptr_t wParam, sptr_t lParam) {
 	case Message::GetPositionCache:
 		return view.posCache.GetSize();
 
+	case Message::GetPositionCacheStatistic:
+		return view.posCache.Statistic(static_cast<PositionCacheStatistic>(wParam), static_cast<int>(lParam));
+
+	case Message::GetFrameStatistic:
+		return FrameStatistic(static_cast<Scintilla::FrameStatistic>(wParam));
+
+	case Message::SetLayoutCacheBudget:
+		view.llc.SetLongCacheBudget(wParam);
+		break;
+
+	case Message::GetLayoutCacheBudget:
+		return view.llc.GetLongCacheBudget();
+
+	case Message::GetLayoutCacheStatistic:
+		return view.llc.Statistic(static_cast<LayoutCacheStatistic>(wParam));
+
 	case Message::SetScrollWidth:
 		PLATFORM_ASSERT(wParam > 0);
 		if ((wParam > 0) && (wParam != static_cast<unsigned int>(scrollWidth))) {
 			view.lineWidthMaxSeen = 0;
 			scrollWidth = static_cast<int>(wParam);
 			SetScrollBars();
+			NeedScrollWidth(0, pdoc->LinesTotal());
 		}
 		break;
 
@@ -7284,6 +8140,7 @@ sptr_t Editor::WndProc(Message iMessage, uptr_t wParam, sptr_t lParam) {
 
 	case Message::SetScrollWidthTracking:
 		trackLineWidth = wParam != 0;
+		NeedScrollWidth(0, pdoc->LinesTotal());
 		break;
 
 	case Message::GetScrollWidthTracking:
@@ -7510,8 +8367,12 @@ sptr_t Editor::WndProc(Message iMessage, uptr_t wParam, sptr_t lParam) {
 		return pdoc->MarkerNext(LineFromUPtr(wParam), static_cast<MarkerMask>(lParam));
 
 	case Message::MarkerPrevious: {
+			const MarkerMask mask = static_cast<MarkerMask>(lParam);
+			if ((mask & MaskHistory) == 0 || !FlagSet(changeHistoryOption, ChangeHistoryOption::Markers)) {
+				return pdoc->MarkerPrevious(LineFromUPtr(wParam), mask);
+			}
 			for (Sci::Line iLine = LineFromUPtr(wParam); iLine >= 0; iLine--) {
-				if ((GetMark(iLine) & lParam) != 0)
+				if ((GetMark(iLine) & mask) != 0)
 					return iLine;
 			}
 		}
@@ -7784,12 +8645,14 @@ sptr_t Editor::WndProc(Message iMessage, uptr_t wParam, sptr_t lParam) {
 		}
 
 	case Message::GetFoldLevel:
+		pdoc->EnsureLineFolded(LineFromUPtr(wParam));
 		return pdoc->GetLevel(LineFromUPtr(wParam));
 
 	case Message::GetLastChild:
 		return pdoc->GetLastChild(LineFromUPtr(wParam), (lParam < 0 ? FoldLevel::None : static_cast<FoldLevel>(lParam)));
 
 	case Message::GetFoldParent:
+		pdoc->EnsureLineFolded(LineFromUPtr(wParam));
 		return pdoc->GetFoldParent(LineFromUPtr(wParam));
 
 	case Message::ShowLines:
@@ -7861,6 +8724,7 @@ sptr_t Editor::WndProc(Message iMessage, uptr_t wParam, sptr_t lParam) {
 		break;
 
 	case Message::FoldChildren:
+		pdoc->EnsureLineFolded(LineFromUPtr(wParam));
 		FoldExpand(LineFromUPtr(wParam), static_cast<FoldAction>(lParam), pdoc->GetFoldLevel(wParam));
 		break;
 
@@ -7868,6 +8732,10 @@ sptr_t Editor::WndProc(Message iMessage, uptr_t wParam, sptr_t lParam) {
 		FoldAll(static_cast<FoldAction>(wParam));
 		break;
 
+	case Message::FoldAtLevel:
+		FoldAtLevel(static_cast<FoldAction>(wParam), static_cast<int>(lParam));
+		break;
+
 	case Message::ExpandChildren:
 		FoldExpand(LineFromUPtr(wParam), FoldAction::Expand, static_cast<FoldLevel>(lParam));
 		break;
@@ -8084,6 +8952,11 @@ sptr_t Editor::WndProc(Message iMessage, uptr_t wParam, sptr_t lParam) {
 		pdoc->DecorationFillRange(PositionFromUPtr(wParam), 0, lParam);
 		break;
 
+	case Message::IndicatorFillRanges:
+		pdoc->DecorationFillRanges(AsPointer<const Sci::Position *>(lParam), wParam,
+			pdoc->decorations->GetCurrentValue());
+		break;
+
 	case Message::IndicatorAllOnFor:
 		return pdoc->decorations->AllOnFor(PositionFromUPtr(wParam));
 
@@ -8346,6 +9219,10 @@ sptr_t Editor::WndProc(Message iMessage, uptr_t wParam, sptr_t lParam) {
 	case Message::GetDocumentOptions:
 		return static_cast<sptr_t>(pdoc->Options());
 
+	case Message::SetDocumentOptions:
+		SetDocumentOptions(static_cast<DocumentOption>(wParam));
+		break;
+
 	case Message::CreateLoader: {
 			Document *doc = new Document(static_cast<DocumentOption>(lParam));
 			doc->AddRef();
@@ -8355,6 +9232,33 @@ sptr_t Editor::WndProc(Message iMessage, uptr_t wParam, sptr_t lParam) {
 			return AsInteger<sptr_t>(doc);
 		}
 
+	case Message::CreateDocumentSnapshot:
+		return AsInteger<sptr_t>(pdoc->CreateSnapshot());
+
+	case Message::GetMemoryUsage:
+		switch (static_cast<Scintilla::MemoryUsage>(wParam)) {
+		case Scintilla::MemoryUsage::LineLayout:
+			return view.llc.MemoryUsage();
+		case Scintilla::MemoryUsage::PositionCache:
+			return view.posCache.MemoryUsage();
+		default:
+			return pdoc->MemoryUsed(static_cast<Scintilla::MemoryUsage>(wParam));
+		}
+
+	case Message::ReleaseCaches:
+		ReleaseCaches(static_cast<ReleaseCache>(wParam));
+		break;
+
+	case Message::SetStylingDuration:
+		pdoc->durationStyleOneUnit.Set(static_cast<int>(wParam) * 1e-9);
+		break;
+
+	case Message::GetStylingDuration:
+		if (pdoc->durationStyleOneUnit.Measured()) {
+			return std::lround(pdoc->durationStyleOneUnit.Duration() * 1e9);
+		}
+		return 0;
+
 	case Message::SetModEventMask:
 		modEventMask = static_cast<ModificationFlags>(wParam);
 		return 0;
@@ -8398,10 +9302,23 @@ sptr_t Editor::WndProc(Message iMessage, uptr_t wParam, sptr_t lParam) {
 		return sel.MoveExtends();
 	case Message::GetLineSelStartPosition:
 	case Message::GetLineSelEndPosition: {
-			const SelectionSegment segmentLine(
-				pdoc->LineStart(LineFromUPtr(wParam)),
-				pdoc->LineEnd(LineFromUPtr(wParam)));
-			for (size_t r=0; r<sel.Count(); r++) {
+			const Sci::Line line = LineFromUPtr(wParam);
+			const SelectionSegment segmentLine(pdoc->LineStart(line), pdoc->LineEnd(line));
+			size_t r = 0;
+			size_t count = sel.Count();
+			if (sel.IsRectangular()) {
+				// ranges are one per line from anchor line to caret line, see SetRectangularRange()
+				const Sci::Line lineAnchor = pdoc->SciLineFromPosition(sel.Rectangular().anchor.Position());
+				const Sci::Line lineCaret = pdoc->SciLineFromPosition(sel.Rectangular().caret.Position());
+				if (static_cast<size_t>(std::abs(lineCaret - lineAnchor)) + 1 == count) {
+					if ((line < lineAnchor && line < lineCaret) || (line > lineAnchor && line > lineCaret)) {
+						return Sci::invalidPosition;
+					}
+					r = static_cast<size_t>(std::abs(line - lineAnchor));
+					count = r + 1;
+				}
+			}
+			for (; r < count; r++) {
 				const SelectionSegment portion = sel.Range(r).Intersect(segmentLine);
 				if (portion.start.IsValid()) {
 					return (iMessage == Message::GetLineSelStartPosition) ? portion.start.Position() : portion.end.Position();
@@ -8967,14 +9884,14 @@ sptr_t Editor::WndProc(Message iMessage, uptr_t wParam, sptr_t lParam) {
 		break;
 
 	case Message::CountCharacters:
-		return pdoc->CountCharacters(PositionFromUPtr(wParam), lParam);
+		return CountCharacters(PositionFromUPtr(wParam), lParam, false);
 
 	case Message::CountCharactersAndColumns:
 		pdoc->CountCharactersAndColumns(lParam);
 		break;
 
 	case Message::CountCodeUnits:
-		return pdoc->CountUTF16(PositionFromUPtr(wParam), lParam);
+		return CountCharacters(PositionFromUPtr(wParam), lParam, true);
 
 	default:
 		return DefWndProc(iMessage, wParam, lParam);
@@ -117,13 +117,16 @@ struct WrapPending {
 	};
 	Sci::Line start;	// When there are wraps pending, will be in document range
 	Sci::Line end;	// May be lineLarge to indicate all of the document after start
+	Sci::Line estimated;	// Lines before this have estimated or wrapped height
 	WrapPending() noexcept {
 		start = lineLarge;
 		end = lineLarge;
+		estimated = 0;
 	}
 	void Reset() noexcept {
 		start = lineLarge;
 		end = lineLarge;
+		estimated = 0;
 	}
 	void Wrapped(Sci::Line line) noexcept {
 		if (start == line)
@@ -180,6 +183,18 @@ constexpr XYScrollOptions operator|(XYScrollOptions a, XYScrollOptions b) noexce
 	return static_cast<XYScrollOptions>(static_cast<int>(a) | static_cast<int>(b));
 }
 
+// Work done for a frame, wrapping and idle time are accumulated between paints.
+struct FrameStatistics {
+	double paintDuration = 0;
+	double wrapDuration = 0;
+	double styleDuration = 0;
+	double idleDuration = 0;
+	Sci::Line paintLineStart = 0;
+	Sci::Line paintLineEnd = 0;
+	Sci::Line wrapLines = 0;
+	Sci::Position styleBytes = 0;
+};
+
 /**
  */
 class Editor : public EditModel, public DocWatcher {
@@ -271,9 +286,13 @@ protected:	// ScintillaBase subclass needs access to much of Editor
 	bool paintAbandonedByStyling;
 	bool paintingAllText;
 	bool willRedrawAll;
+	bool scrollBlit;
+	FrameStatistics frameCurrent;
+	FrameStatistics frameLast;
 	WorkNeeded workNeeded;
 	Scintilla::IdleStyling idleStyling;
 	bool needIdleStyling;
+	bool backgroundStyling;
 
 	bool recordingMacro;
 	bool convertPastes;
@@ -293,14 +312,20 @@ protected:	// ScintillaBase subclass needs access to much of Editor
 	int batchUpdateDepth;
 	struct BatchUpdateSavedState {
 		ModificationFlags modEventMask;
-		int actions;
 		Sci::Line lines;
+		Sci::Position length;
+		// coalesced range of text changed inside the batch, in current positions
+		Sci::Position changeStart;
+		Sci::Position changeEnd;
 	};
 	BatchUpdateSavedState batchUpdateState;
 
 	// Wrapping support
 	WrapPending wrapPending;
 	bool insideWrapScroll;
+	// Inserted lines not yet scanned in idle time for the longest line
+	Sci::Line scrollWidthPendingStart;
+	Sci::Line scrollWidthPendingEnd;
 	struct LineDocSub {
 		Scintilla::Line lineDoc = 0;
 		Scintilla::Line subLine = 0;
@@ -314,6 +339,7 @@ protected:	// ScintillaBase subclass needs access to much of Editor
 
 	void InvalidateStyleData() noexcept;
 	void InvalidateStyleRedraw() noexcept;
+	void ReleaseCaches(Scintilla::ReleaseCache level) noexcept;
 	void RefreshStyleData();
 	void SetRepresentations();
 	void DropGraphics() noexcept;
@@ -417,6 +443,7 @@ protected:	// ScintillaBase subclass needs access to much of Editor
 	void DropCaret();
 	void CaretSetPeriod(int period);
 	void InvalidateCaret();
+	void InvalidateCaretBlink();
 	virtual void NotifyCaretMove() const noexcept = 0;
 	virtual void UpdateSystemCaret() = 0;
 
@@ -424,6 +451,10 @@ protected:	// ScintillaBase subclass needs access to much of Editor
 	void NeedWrapping(Sci::Line docLineStart = 0, Sci::Line docLineEnd = WrapPending::lineLarge, bool invalidate = true) noexcept;
 	bool WrapOneLine(Surface *surface, Sci::Position positionInsert);
 	bool WrapBlock(Surface *surface, Sci::Line lineToWrap, Sci::Line lineToWrapEnd, Sci::Line &partialLine);
+	bool EstimateWrapPending();
+	void NeedScrollWidth(Sci::Line docLineStart, Sci::Line docLineEnd) noexcept;
+	bool ScrollWidthPending() const noexcept;
+	void IdleScrollWidth();
 	enum class WrapScope {
 		wsAll, wsVisible, wsIdle
 	};
@@ -434,6 +465,8 @@ protected:	// ScintillaBase subclass needs access to much of Editor
 	void SCICALL PaintSelMargin(Surface *surfaceWindow, PRectangle rc);
 	void RefreshPixMaps(Surface *surfaceWindow);
 	void SCICALL Paint(Surface *surfaceWindow, PRectangle rcArea);
+	void EndFrame(PRectangle rcArea, double paintDuration) noexcept;
+	Sci::Position FrameStatistic(Scintilla::FrameStatistic statistic) const noexcept;
 	Sci::Position FormatRange(Scintilla::Message iMessage, Scintilla::uptr_t wParam, Scintilla::sptr_t lParam);
 	long TextWidth(Scintilla::uptr_t style, const char *text);
 
@@ -544,9 +577,12 @@ protected:	// ScintillaBase subclass needs access to much of Editor
 
 	virtual std::unique_ptr<CaseFolder> CaseFolderForEncoding() const;
 	Sci::Position FindTextFull(Scintilla::uptr_t wParam, Scintilla::sptr_t lParam);
+	Sci::Position FindAllFull(Scintilla::uptr_t wParam, Scintilla::sptr_t lParam);
+	Sci::Position CountCharacters(Sci::Position startPos, Sci::Position endPos, bool utf16) const;
 	void SearchAnchor() noexcept;
 	Sci::Position SearchText(Scintilla::Message iMessage, Scintilla::uptr_t wParam, Scintilla::sptr_t lParam);
 	Sci::Position SearchInTarget(const char *text, Sci::Position length);
+	Sci::Position ReplaceAllInTarget(bool replacePatterns, const char *search, const char *text);
 	void GoToLine(Sci::Line lineNo);
 
 	virtual void CopyToClipboard(const SelectionText &selectedText) const = 0;
@@ -613,6 +649,7 @@ protected:	// ScintillaBase subclass needs access to much of Editor
 
 	void SetAnnotationHeights(Sci::Line start, Sci::Line end);
 	virtual void SetDocPointer(Document *document);
+	void SetDocumentOptions(Scintilla::DocumentOption options);
 
 	void SetAnnotationVisible(Scintilla::AnnotationVisible visible);
 	void SetEOLAnnotationVisible(Scintilla::EOLAnnotationVisible visible) noexcept;
@@ -626,6 +663,7 @@ protected:	// ScintillaBase subclass needs access to much of Editor
 	void FoldChanged(Sci::Line line, Scintilla::FoldLevel levelNow, Scintilla::FoldLevel levelPrev);
 	void NeedShown(Sci::Position pos, Sci::Position len);
 	void FoldAll(Scintilla::FoldAction action);
+	void FoldAtLevel(Scintilla::FoldAction action, int level);
 
 	Sci::Position GetTag(char *tagValue, int tagNumber);
 	Sci::Position ReplaceTarget(Scintilla::Message iMessage, Scintilla::uptr_t wParam, Scintilla::sptr_t lParam);
@@ -721,6 +759,7 @@ public:
 	virtual Scintilla::sptr_t WndProc(Scintilla::Message iMessage, Scintilla::uptr_t wParam, Scintilla::sptr_t lParam);
 	void BeginBatchUpdate() noexcept;
 	void EndBatchUpdate() noexcept;
+	void BatchUpdateModified(const DocModification &mh) noexcept;
 	// Public so scintilla_set_id can use it.
 	int ctrlID;
 	// Public so COM methods for drag and drop can set it.
@@ -371,7 +371,9 @@ void MarginView::PaintOneMargin(Surface *surface, PRectangle rc, PRectangle rcOn
 			if (firstSubLine) {
 				char number[32]{};
 				std::string_view sNumber = FormatNumber(number, static_cast<size_t>(lineDoc + 1));
+				XYPOSITION digitWidth = vs.lineNumberDigitWidth;
 				if (FlagSet(model.foldFlags, (FoldFlag::LevelNumbers | FoldFlag::LineState))) {
+					digitWidth = 0;
 					unsigned length;
 					if (FlagSet(model.foldFlags, FoldFlag::LevelNumbers)) {
 						const FoldLevel lev = model.pdoc->GetFoldLevel(lineDoc);
@@ -389,7 +391,8 @@ void MarginView::PaintOneMargin(Surface *surface, PRectangle rc, PRectangle rcOn
 				}
 				PRectangle rcNumber = rcMarker;
 				// Right justify
-				const XYPOSITION width = surface->WidthText(lineNumberStyle.font.get(), sNumber);
+				const XYPOSITION width = (digitWidth > 0) ? digitWidth * static_cast<XYPOSITION>(sNumber.length())
+					: surface->WidthText(lineNumberStyle.font.get(), sNumber);
 				const XYPOSITION xpos = rcNumber.right - width - vs.marginNumberPadding;
 				rcNumber.left = xpos;
 				DrawTextNoClipPhase(surface, rcNumber, lineNumberStyle,
@@ -22,6 +22,9 @@ inline bool WaitableTimerExpired(HANDLE timer) noexcept {
 #define _Acquires_lock_(x)
 #define _Releases_lock_(x)
 #endif
+#ifndef _When_
+#define _When_(expr, annotes)
+#endif
 #ifndef _Acquires_shared_lock_
 #define _Acquires_shared_lock_(x)
 #define _Releases_shared_lock_(x)
@@ -35,6 +38,10 @@ public:
 	void lock() noexcept {
 		AcquireSRWLockExclusive(&srwLock);
 	}
+	_When_(return != 0, _Acquires_lock_(this->srwLock))
+	bool try_lock() noexcept {
+		return TryAcquireSRWLockExclusive(&srwLock) != 0;
+	}
 	_Releases_lock_(this->srwLock)
 	void unlock() noexcept {
 		ReleaseSRWLockExclusive(&srwLock);
@@ -66,6 +73,34 @@ public:
 	LockGuard& operator=(LockGuard const&&) = delete;
 };
 
+// std::unique_lock with std::try_to_lock when not wait
+template <class Mutex>
+class TryLockGuard {
+	Mutex &mutex;
+	const bool owns;
+	static bool Lock(Mutex &m, bool wait) noexcept {
+		if (wait) {
+			m.lock();
+			return true;
+		}
+		return m.try_lock();
+	}
+public:
+	TryLockGuard(Mutex& m, bool wait) noexcept : mutex{m}, owns{Lock(m, wait)} {}
+	~TryLockGuard() {
+		if (owns) {
+			mutex.unlock();
+		}
+	}
+	bool OwnsLock() const noexcept {
+		return owns;
+	}
+	TryLockGuard(TryLockGuard const&) = delete;
+	TryLockGuard(TryLockGuard const&&) = delete;
+	TryLockGuard& operator=(TryLockGuard const&) = delete;
+	TryLockGuard& operator=(TryLockGuard const&&) = delete;
+};
+
 // https://stackoverflow.com/questions/13206414/why-slim-reader-writer-exclusive-lock-outperformance-the-shared-one
 #if 0
 template <class Mutex>
@@ -85,4 +120,104 @@ public:
 };
 #endif
 
+// private thread pool kept for the lifetime of owner, threads are created on first use
+// and stay alive, so per thread data (e.g. thread_local measurement surface) is reused.
+// work is divided by callback itself (e.g. atomic index), each thread takes next piece when done.
+class WorkerPool {
+public:
+	using WorkFunction = void (*)(void *context);
+private:
+#if USE_WIN32_PTP_WORK
+	PTP_POOL pool = nullptr;
+	PTP_WORK work = nullptr;
+	TP_CALLBACK_ENVIRON callbackEnviron {};
+	uint32_t maxThreads = 0;
+	volatile LONG busy = 0;
+#endif
+	WorkFunction function = nullptr;
+	void *context = nullptr;
+
+#if USE_WIN32_PTP_WORK
+	static VOID CALLBACK WorkCallback([[maybe_unused]] PTP_CALLBACK_INSTANCE instance, PVOID parameter, [[maybe_unused]] PTP_WORK work_) {
+		const WorkerPool *self = static_cast<const WorkerPool *>(parameter);
+		self->function(self->context);
+	}
+
+	bool EnsureThreads() noexcept {
+		if (work) {
+			return true;
+		}
+		if (maxThreads == 0) {
+			return false;
+		}
+		pool = CreateThreadpool(nullptr);
+		if (pool) {
+			SetThreadpoolThreadMaximum(pool, maxThreads);
+			if (SetThreadpoolThreadMinimum(pool, maxThreads)) {
+				InitializeThreadpoolEnvironment(&callbackEnviron);
+				SetThreadpoolCallbackPool(&callbackEnviron, pool);
+				work = CreateThreadpoolWork(WorkCallback, this, &callbackEnviron);
+				if (work) {
+					return true;
+				}
+				DestroyThreadpoolEnvironment(&callbackEnviron);
+			}
+			CloseThreadpool(pool);
+			pool = nullptr;
+		}
+		maxThreads = 0; // don't retry
+		return false;
+	}
+#endif
+
+public:
+	WorkerPool() noexcept = default;
+	WorkerPool(const WorkerPool &) = delete;
+	WorkerPool(WorkerPool &&) = delete;
+	WorkerPool &operator=(const WorkerPool &) = delete;
+	WorkerPool &operator=(WorkerPool &&) = delete;
+	~WorkerPool() {
+		Release();
+	}
+
+	void SetThreadCount([[maybe_unused]] uint32_t threadCount) noexcept {
+#if USE_WIN32_PTP_WORK
+		maxThreads = (threadCount > 1) ? threadCount : 0;
+#endif
+	}
+
+	void Release() noexcept {
+#if USE_WIN32_PTP_WORK
+		if (work) {
+			CloseThreadpoolWork(work);
+			work = nullptr;
+			DestroyThreadpoolEnvironment(&callbackEnviron);
+			CloseThreadpool(pool);
+			pool = nullptr;
+		}
+#endif
+	}
+
+	// run function(context) on threadCount threads and wait for all of them,
+	// function runs once on current thread when pool is not available or is already running.
+	void Run(WorkFunction function_, void *context_, uint32_t threadCount) noexcept {
+#if USE_WIN32_PTP_WORK
+		if (threadCount > 1 && InterlockedCompareExchange(&busy, 1, 0) == 0) {
+			if (EnsureThreads()) {
+				function = function_;
+				context = context_;
+				for (uint32_t i = 0; i < threadCount; i++) {
+					SubmitThreadpoolWork(work);
+				}
+				WaitForThreadpoolWorkCallbacks(work, FALSE);
+				InterlockedExchange(&busy, 0);
+				return;
+			}
+			InterlockedExchange(&busy, 0);
+		}
+#endif
+		function_(context_);
+	}
+};
+
 }
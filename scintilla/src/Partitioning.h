@@ -8,6 +8,10 @@
 
 namespace Scintilla::Internal {
 
+/// Add delta to elements in [data, data + length), vectorized for int and Sci::Position.
+template <typename T>
+void AddDelta(T *data, ptrdiff_t length, T delta) noexcept;
+
 /// Divide an interval into multiple partitions.
 /// Useful for breaking a document down into sections such as lines.
 /// A 0 length interval has a single 0 length partition, numbered 0
@@ -27,26 +31,17 @@ private:
 	void RangeAddDelta(T start, T end, T delta) noexcept {
 		// end is 1 past end, so end-start is number of elements to change
 		const ptrdiff_t position = start;
-		ptrdiff_t i = 0;
 		const ptrdiff_t rangeLength = end - position;
-		ptrdiff_t range1Length = rangeLength;
-		const ptrdiff_t part1Left = body.GapPosition() - position;
-		if (range1Length > part1Left) {
-			range1Length = part1Left;
+		if (rangeLength <= 0) {
+			return;
 		}
-		T *writer = &body[position];
-		while (i < range1Length) {
-			*writer += delta;
-			writer++;
-			i++;
+		// split into up to 2 contiguous ranges, before and after the gap
+		const ptrdiff_t range1Length = std::clamp<ptrdiff_t>(body.GapPosition() - position, 0, rangeLength);
+		if (range1Length != 0) {
+			AddDelta(&body[position], range1Length, delta);
 		}
-		if (i < rangeLength) {
-			T *writer2 = &body[position + i];
-			while (i < rangeLength) {
-				*writer2 += delta;
-				writer2++;
-				i++;
-			}
+		if (range1Length < rangeLength) {
+			AddDelta(&body[position + range1Length], rangeLength - range1Length, delta);
 		}
 	}
 
@@ -80,6 +75,10 @@ public:
 		return static_cast<T>(body.Length()) - 1;
 	}
 
+	size_t MemoryUsage() const noexcept {
+		return body.MemoryUsage();
+	}
+
 	void ReAllocate(ptrdiff_t newSize) {
 		// + 1 accounts for initial element that is always 0.
 		// + 2 to avoid reallocation.
@@ -127,8 +126,20 @@ public:
 		stepPartition += static_cast<T>(length);
 	}
 
+	// Replace all partitions, return pointer to start position of partition 1 to be filled in bulk
+	// with an ascending sequence, the last one is end of the last partition.
+	T *ResetPartitions(T partitions) {
+		stepPartition = partitions;
+		stepLength = 0;
+		body.DeleteRange(1, body.Length() - 1);
+		return body.InsertEmpty(1, partitions);
+	}
+
 	void SetPartitionStartPosition(T partition, T pos) noexcept {
-		ApplyStep(partition + 1);
+		// partitions before the step already have it applied, don't move step backward
+		if (partition > stepPartition) {
+			ApplyStep(partition);
+		}
 		if (!IsValidIndex(partition, body.Length())) {
 			return;
 		}
@@ -167,6 +178,14 @@ public:
 		body.Delete(partition);
 	}
 
+	void RemovePartitions(T partition, T count) {
+		if (partition > stepPartition) {
+			ApplyStep(partition);
+		}
+		stepPartition = (stepPartition >= partition + count) ? (stepPartition - count) : (partition - 1);
+		body.DeleteRange(partition, count);
+	}
+
 	T PositionFromPartition(T partition) const noexcept {
 		PLATFORM_ASSERT(partition >= 0);
 		PLATFORM_ASSERT(partition < body.Length());
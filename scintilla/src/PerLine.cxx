@@ -21,6 +21,7 @@
 #include "ScintillaTypes.h"
 
 #include "Debugging.h"
+#include "VectorISA.h"
 #include "Geometry.h"
 #include "Platform.h"
 
@@ -64,6 +65,12 @@ MarkerHandleNumber const *MarkerHandleSet::GetMarkerHandleNumber(int which) cons
 	return nullptr;
 }
 
+size_t MarkerHandleSet::MemoryUsage() const noexcept {
+	// each node of forward_list holds the next pointer and the value
+	constexpr size_t nodeSize = sizeof(void *) + sizeof(MarkerHandleNumber);
+	return sizeof(MarkerHandleSet) + nodeSize * std::distance(mhList.begin(), mhList.end());
+}
+
 bool MarkerHandleSet::InsertHandle(int handle, int markerNum) {
 	mhList.emplace_front(handle, markerNum);
 	return true;
@@ -91,6 +98,7 @@ void MarkerHandleSet::CombineWith(MarkerHandleSet *other) noexcept {
 
 void LineMarkers::Init() {
 	markers.DeleteAll();
+	masks.DeleteAll();
 }
 
 bool LineMarkers::IsActive() const noexcept {
@@ -100,12 +108,14 @@ bool LineMarkers::IsActive() const noexcept {
 void LineMarkers::InsertLine(Sci::Line line) {
 	if (markers.Length()) {
 		markers.Insert(line, nullptr);
+		masks.Insert(line, 0);
 	}
 }
 
 void LineMarkers::InsertLines(Sci::Line line, Sci::Line lines) {
 	if (markers.Length()) {
 		markers.InsertEmpty(line, lines);
+		masks.InsertEmpty(line, lines);
 	}
 }
 
@@ -116,6 +126,7 @@ void LineMarkers::RemoveLine(Sci::Line line) {
 			MergeMarkers(line - 1);
 		}
 		markers.Delete(line);
+		masks.Delete(line);
 	}
 }
 
@@ -144,30 +155,147 @@ int LineMarkers::NumberFromLine(Sci::Line line, int which) const noexcept {
 	return -1;
 }
 
+size_t LineMarkers::MemoryUsage() const noexcept {
+	size_t usage = markers.MemoryUsage() + masks.MemoryUsage();
+	for (Sci::Line line = 0; line < markers.Length(); line++) {
+		if (markers[line]) {
+			usage += markers[line]->MemoryUsage();
+		}
+	}
+	return usage;
+}
+
 void LineMarkers::MergeMarkers(Sci::Line line) {
 	if (markers[line + 1]) {
 		if (!markers[line])
 			markers[line] = std::make_unique<MarkerHandleSet>();
 		markers[line]->CombineWith(markers[line + 1].get());
 		markers[line + 1].reset();
+		masks[line] |= masks[line + 1];
+		masks[line + 1] = 0;
 	}
 }
 
 MarkerMask LineMarkers::MarkValue(Sci::Line line) const noexcept {
-	if (IsValidIndex(line, markers.Length()) && markers[line])
-		return markers[line]->MarkValue();
-	else
-		return 0;
+	return masks.ValueAt(line);
+}
+
+namespace {
+
+// index of first value in [0, count) having any marker in mask, or -1
+ptrdiff_t FindMarkerForward(const MarkerMask *values, ptrdiff_t count, MarkerMask mask) noexcept {
+	ptrdiff_t index = 0;
+#if NP2_USE_AVX2
+	const __m256i vectMask = _mm256_set1_epi32(mask);
+	for (; index + 8 <= count; index += 8) {
+		const __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(values + index));
+		const __m256i empty = _mm256_cmpeq_epi32(_mm256_and_si256(chunk, vectMask), _mm256_setzero_si256());
+		const uint32_t found = ~mm256_movemask_epi8(empty);
+		if (found) {
+			return index + np2_ctz(found)/sizeof(MarkerMask);
+		}
+	}
+	// end NP2_USE_AVX2
+#elif NP2_USE_SSE2
+	const __m128i vectMask = _mm_set1_epi32(mask);
+	for (; index + 4 <= count; index += 4) {
+		const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i *>(values + index));
+		const __m128i empty = _mm_cmpeq_epi32(_mm_and_si128(chunk, vectMask), _mm_setzero_si128());
+		const uint32_t found = mm_movemask_epi8(empty) ^ 0xffff;
+		if (found) {
+			return index + np2_ctz(found)/sizeof(MarkerMask);
+		}
+	}
+	// end NP2_USE_SSE2
+#endif
+	for (; index < count; index++) {
+		if (values[index] & mask) {
+			return index;
+		}
+	}
+	return -1;
+}
+
+// index of last value in [0, count) having any marker in mask, or -1
+ptrdiff_t FindMarkerBackward(const MarkerMask *values, ptrdiff_t count, MarkerMask mask) noexcept {
+	ptrdiff_t index = count;
+#if NP2_USE_AVX2
+	const __m256i vectMask = _mm256_set1_epi32(mask);
+	for (; index >= 8; index -= 8) {
+		const __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(values + index - 8));
+		const __m256i empty = _mm256_cmpeq_epi32(_mm256_and_si256(chunk, vectMask), _mm256_setzero_si256());
+		const uint32_t found = ~mm256_movemask_epi8(empty);
+		if (found) {
+			return index - 8 + np2_bsr(found)/sizeof(MarkerMask);
+		}
+	}
+	// end NP2_USE_AVX2
+#elif NP2_USE_SSE2
+	const __m128i vectMask = _mm_set1_epi32(mask);
+	for (; index >= 4; index -= 4) {
+		const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i *>(values + index - 4));
+		const __m128i empty = _mm_cmpeq_epi32(_mm_and_si128(chunk, vectMask), _mm_setzero_si128());
+		const uint32_t found = mm_movemask_epi8(empty) ^ 0xffff;
+		if (found) {
+			return index - 4 + np2_bsr(found)/sizeof(MarkerMask);
+		}
+	}
+	// end NP2_USE_SSE2
+#endif
+	while (index > 0) {
+		--index;
+		if (values[index] & mask) {
+			return index;
+		}
+	}
+	return -1;
+}
+
 }
 
 Sci::Line LineMarkers::MarkerNext(Sci::Line lineStart, MarkerMask mask) const noexcept {
-	if (lineStart < 0)
-		lineStart = 0;
-	const Sci::Line length = markers.Length();
-	for (Sci::Line iLine = lineStart; iLine < length; iLine++) {
-		const MarkerHandleSet *onLine = markers[iLine].get();
-		if (onLine && ((onLine->MarkValue() & mask) != 0))
-			return iLine;
+	lineStart = std::max<Sci::Line>(lineStart, 0);
+	const Sci::Line length = masks.Length();
+	if (mask == 0 || lineStart >= length) {
+		return -1;
+	}
+	// scan each side of the gap in place
+	const Sci::Line gap = masks.GapPosition();
+	if (lineStart < gap) {
+		const ptrdiff_t index = FindMarkerForward(masks.ElementPointer(lineStart), gap - lineStart, mask);
+		if (index >= 0) {
+			return lineStart + index;
+		}
+		lineStart = gap;
+	}
+	if (lineStart < length) {
+		const ptrdiff_t index = FindMarkerForward(masks.ElementPointer(lineStart), length - lineStart, mask);
+		if (index >= 0) {
+			return lineStart + index;
+		}
+	}
+	return -1;
+}
+
+Sci::Line LineMarkers::MarkerPrevious(Sci::Line lineStart, MarkerMask mask) const noexcept {
+	const Sci::Line length = masks.Length();
+	lineStart = std::min(lineStart, length - 1);
+	if (mask == 0 || lineStart < 0) {
+		return -1;
+	}
+	const Sci::Line gap = masks.GapPosition();
+	if (lineStart >= gap) {
+		const ptrdiff_t index = FindMarkerBackward(masks.ElementPointer(gap), lineStart + 1 - gap, mask);
+		if (index >= 0) {
+			return gap + index;
+		}
+		lineStart = gap - 1;
+	}
+	if (lineStart >= 0) {
+		const ptrdiff_t index = FindMarkerBackward(masks.ElementPointer(0), lineStart + 1, mask);
+		if (index >= 0) {
+			return index;
+		}
 	}
 	return -1;
 }
@@ -176,6 +304,7 @@ int LineMarkers::AddMark(Sci::Line line, int markerNum, Sci::Line lines) {
 	if (!markers.Length()) {
 		// No existing markers so allocate one element per line
 		markers.InsertEmpty(0, lines);
+		masks.InsertEmpty(0, lines);
 	}
 	if (!markers[line]) {
 		// Need new structure to hold marker handle
@@ -184,6 +313,7 @@ int LineMarkers::AddMark(Sci::Line line, int markerNum, Sci::Line lines) {
 
 	handleCurrent++;
 	markers[line]->InsertHandle(handleCurrent, markerNum);
+	masks[line] |= 1U << markerNum;
 	return handleCurrent;
 }
 
@@ -193,10 +323,14 @@ bool LineMarkers::DeleteMark(Sci::Line line, int markerNum, bool all) {
 		if (markerNum < 0) {
 			someChanges = true;
 			markers[line].reset();
+			masks[line] = 0;
 		} else {
 			someChanges = markers[line]->RemoveNumber(markerNum, all);
 			if (markers[line]->Empty()) {
 				markers[line].reset();
+				masks[line] = 0;
+			} else {
+				masks[line] = markers[line]->MarkValue();
 			}
 		}
 	}
@@ -209,12 +343,16 @@ void LineMarkers::DeleteMarkFromHandle(int markerHandle) {
 		markers[line]->RemoveHandle(markerHandle);
 		if (markers[line]->Empty()) {
 			markers[line].reset();
+			masks[line] = 0;
+		} else {
+			masks[line] = markers[line]->MarkValue();
 		}
 	}
 }
 
 void LineLevels::Init() {
 	levels.DeleteAll();
+	headersValid = false;
 }
 
 bool LineLevels::IsActive() const noexcept {
@@ -225,6 +363,7 @@ void LineLevels::InsertLine(Sci::Line line) {
 	if (levels.Length()) {
 		const int level = (line < levels.Length()) ? levels[line] : static_cast<int>(Scintilla::FoldLevel::Base);
 		levels.Insert(line, level);
+		headersValid = false;
 	}
 }
 
@@ -232,6 +371,7 @@ void LineLevels::InsertLines(Sci::Line line, Sci::Line lines) {
 	if (levels.Length()) {
 		const int level = (line < levels.Length()) ? levels[line] : static_cast<int>(Scintilla::FoldLevel::Base);
 		levels.InsertValue(line, lines, level);
+		headersValid = false;
 	}
 }
 
@@ -245,6 +385,7 @@ void LineLevels::RemoveLine(Sci::Line line) {
 			levels[line - 1] &= ~static_cast<int>(Scintilla::FoldLevel::HeaderFlag);
 		else if (line > 0)
 			levels[line - 1] |= firstHeader;
+		headersValid = false;
 	}
 }
 
@@ -254,6 +395,7 @@ void LineLevels::ExpandLevels(Sci::Line sizeNew) {
 
 void LineLevels::ClearLevels() {
 	levels.DeleteAll();
+	headersValid = false;
 }
 
 int LineLevels::SetLevel(Sci::Line line, int level, Sci::Line lines) {
@@ -261,7 +403,11 @@ int LineLevels::SetLevel(Sci::Line line, int level, Sci::Line lines) {
 		if (!levels.Length()) {
 			ExpandLevels(lines + 1);
 		}
-		return levels.ReplaceValueAt(line, level);
+		const int prev = levels.ReplaceValueAt(line, level);
+		if (prev != level && ((prev | level) & static_cast<int>(Scintilla::FoldLevel::HeaderFlag))) {
+			headersValid = false;
+		}
+		return prev;
 	}
 	return level;
 }
@@ -277,6 +423,31 @@ Scintilla::FoldLevel LineLevels::GetFoldLevel(Sci::Line line) const noexcept {
 	return static_cast<Scintilla::FoldLevel>(levels[line]);
 }
 
+bool LineLevels::BuildHeaders() const noexcept {
+	try {
+		headers.clear();
+		const Sci::Line length = levels.Length();
+		for (Sci::Line line = 0; line < length; line++) {
+			const FoldLevel level = GetFoldLevel(line);
+			if (LevelIsHeader(level)) {
+				// parent is the nearest previous header with lower level, found by walking
+				// up from previous header, this is amortized constant for each header.
+				const FoldLevel levelNum = LevelNumberPart(level);
+				ptrdiff_t parent = static_cast<ptrdiff_t>(headers.size()) - 1;
+				while (parent >= 0 && headers[parent].level >= levelNum) {
+					parent = headers[parent].parent;
+				}
+				headers.push_back({line, parent, levelNum});
+			}
+		}
+		headersValid = true;
+	} catch (...) {
+		headers.clear();
+		headersValid = false;
+	}
+	return headersValid;
+}
+
 Sci::Line LineLevels::GetFoldParent(Sci::Line line) const noexcept {
 	if (IsValidIndex(line, levels.Length())) {
 		const FoldLevel level = LevelNumberPart(GetFoldLevel(line));
@@ -287,6 +458,17 @@ Sci::Line LineLevels::GetFoldParent(Sci::Line line) const noexcept {
 		if (level <= FoldLevel::Base) {
 			return -1;
 		}
+		if (headersValid || BuildHeaders()) {
+			// the parent is an ancestor of the nearest header before the line
+			const auto it = std::lower_bound(headers.begin(), headers.end(), line, [](const FoldHeader &header, Sci::Line value) noexcept {
+				return header.line < value;
+			});
+			ptrdiff_t index = (it - headers.begin()) - 1;
+			while (index >= 0 && headers[index].level >= level) {
+				index = headers[index].parent;
+			}
+			return (index >= 0) ? headers[index].line : -1;
+		}
 		for (Sci::Line lineLook = line - 1; lineLook >= 0; lineLook--) {
 			const FoldLevel levelTry = GetFoldLevel(lineLook);
 			if (LevelIsHeader(levelTry) && LevelNumberPart(levelTry) < level) {
@@ -297,47 +479,95 @@ Sci::Line LineLevels::GetFoldParent(Sci::Line line) const noexcept {
 	return -1;
 }
 
+namespace {
+
+template <typename T, typename U>
+void CopyLineStates(SplitVector<T> &dest, SplitVector<U> &source) {
+	const Sci::Line length = source.Length();
+	if (length != 0) {
+		T *ptr = dest.InsertEmpty(0, length);
+		const U *states = source.RangePointer(0, length);
+		std::copy(states, states + length, ptr);
+	}
+	source = {};
+}
+
+}
+
+void LineState::Widen(int bytes) {
+	if (stateBytes == 1) {
+		if (bytes == 2) {
+			CopyLineStates(states16, states8);
+		} else {
+			CopyLineStates(states32, states8);
+		}
+	} else {
+		CopyLineStates(states32, states16);
+	}
+	stateBytes = bytes;
+}
+
 void LineState::Init() {
-	lineStates.DeleteAll();
+	states8 = {};
+	states16 = {};
+	states32 = {};
+	stateBytes = 1;
 }
 
 bool LineState::IsActive() const noexcept {
-	return lineStates.Length() != 0;
+	return (states8.Length() | states16.Length() | states32.Length()) != 0;
 }
 
 void LineState::InsertLine(Sci::Line line) {
-	if (lineStates.Length()) {
-		const int val = (line < lineStates.Length()) ? lineStates[line] : 0;
-		lineStates.Insert(line, val);
-	}
+	Visit([line](auto &states) {
+		if (states.Length()) {
+			const auto val = states.ValueAt(line);
+			states.Insert(line, val);
+		}
+	});
 }
 
 void LineState::InsertLines(Sci::Line line, Sci::Line lines) {
-	if (lineStates.Length()) {
-		const int val = (line < lineStates.Length()) ? lineStates[line] : 0;
-		lineStates.InsertValue(line, lines, val);
-	}
+	Visit([line, lines](auto &states) {
+		if (states.Length()) {
+			const auto val = states.ValueAt(line);
+			states.InsertValue(line, lines, val);
+		}
+	});
 }
 
 void LineState::RemoveLine(Sci::Line line) {
-	if (lineStates.Length() > line) {
-		lineStates.Delete(line);
-	}
+	Visit([line](auto &states) {
+		if (states.Length() > line) {
+			states.Delete(line);
+		}
+	});
 }
 
 int LineState::SetLineState(Sci::Line line, int state, Sci::Line lines) {
 	if (IsValidIndex(line, lines)) {
-		lineStates.EnsureLength(lines + 1);
-		return lineStates.ReplaceValueAt(line, state);
+		const uint32_t value = state;
+		const int bytes = (value <= UINT8_MAX) ? 1 : ((value <= UINT16_MAX) ? 2 : 4);
+		if (bytes > stateBytes) {
+			Widen(bytes);
+		}
+		return Visit([line, lines, value](auto &states) {
+			using T = std::remove_reference_t<decltype(states[0])>;
+			states.EnsureLength(lines + 1);
+			return static_cast<int>(states.ReplaceValueAt(line, static_cast<T>(value)));
+		});
 	}
 	return state;
 }
 
 int LineState::GetLineState(Sci::Line line) const noexcept {
-	if (IsValidIndex(line, lineStates.Length())) {
-		return lineStates[line];
+	if (stateBytes == 1) {
+		return IsValidIndex(line, states8.Length()) ? states8[line] : 0;
 	}
-	return 0;
+	if (stateBytes == 2) {
+		return IsValidIndex(line, states16.Length()) ? states16[line] : 0;
+	}
+	return IsValidIndex(line, states32.Length()) ? static_cast<int>(states32[line]) : 0;
 }
 
 // Each allocated LineAnnotation is a char array which starts with an AnnotationHeader
@@ -34,10 +34,13 @@ public:
 	bool RemoveNumber(int markerNum, bool all);
 	void CombineWith(MarkerHandleSet *other) noexcept;
 	MarkerHandleNumber const *GetMarkerHandleNumber(int which) const noexcept;
+	size_t MemoryUsage() const noexcept;
 };
 
 class LineMarkers final : public PerLine {
 	SplitVector<std::unique_ptr<MarkerHandleSet>> markers;
+	/// Marker numbers on each line, scanned by MarkerNext and MarkerPrevious without visiting handle sets.
+	SplitVector<MarkerMask> masks;
 	/// Handles are allocated sequentially and should never have to be reused as 32 bit ints are very big.
 	int handleCurrent;
 public:
@@ -50,6 +53,7 @@ public:
 
 	MarkerMask MarkValue(Sci::Line line) const noexcept;
 	Sci::Line MarkerNext(Sci::Line lineStart, MarkerMask mask) const noexcept;
+	Sci::Line MarkerPrevious(Sci::Line lineStart, MarkerMask mask) const noexcept;
 	int AddMark(Sci::Line line, int markerNum, Sci::Line lines);
 	void MergeMarkers(Sci::Line line);
 	bool DeleteMark(Sci::Line line, int markerNum, bool all);
@@ -57,11 +61,26 @@ public:
 	Sci::Line LineFromHandle(int markerHandle) const noexcept;
 	int HandleFromLine(Sci::Line line, int which) const noexcept;
 	int NumberFromLine(Sci::Line line, int which) const noexcept;
+	size_t MemoryUsage() const noexcept;
+};
+
+/**
+ * A fold header with the index of its parent header in the header table.
+ */
+struct FoldHeader {
+	Sci::Line line;
+	ptrdiff_t parent;
+	Scintilla::FoldLevel level;	///< Level number part.
 };
 
 class LineLevels final : public PerLine {
 	SplitVector<int> levels;
+	/// Fold headers in line order, built on demand by GetFoldParent and discarded
+	/// when lines are inserted or removed or when a header line changes.
+	mutable std::vector<FoldHeader> headers;
+	mutable bool headersValid = false;
 	Scintilla::FoldLevel GetFoldLevel(Sci::Line line) const noexcept;
+	bool BuildHeaders() const noexcept;
 public:
 	LineLevels() noexcept = default;
 	void Init() override;
@@ -75,10 +94,31 @@ public:
 	int SetLevel(Sci::Line line, int level, Sci::Line lines);
 	int GetLevel(Sci::Line line) const noexcept;
 	Sci::Line GetFoldParent(Sci::Line line) const noexcept;
+	size_t MemoryUsage() const noexcept {
+		return levels.MemoryUsage() + headers.capacity()*sizeof(FoldHeader);
+	}
 };
 
+/**
+ * Line states are stored in the narrowest unsigned type that holds every value set,
+ * most lexers only keep a few low bits per line. Storage is widened on demand.
+ */
 class LineState final : public PerLine {
-	SplitVector<int> lineStates;
+	SplitVector<uint8_t> states8;
+	SplitVector<uint16_t> states16;
+	SplitVector<uint32_t> states32;
+	int stateBytes = 1;
+	template <typename Func>
+	auto Visit(Func func) {
+		if (stateBytes == 1) {
+			return func(states8);
+		}
+		if (stateBytes == 2) {
+			return func(states16);
+		}
+		return func(states32);
+	}
+	void Widen(int bytes);
 public:
 	LineState() noexcept = default;
 	void Init() override;
@@ -355,6 +355,7 @@ public:
 	virtual int GetSelection() const noexcept = 0;
 	virtual int Find(const char *prefix) const noexcept = 0;
 	virtual std::string GetValue(int n) const = 0;
+	virtual std::string_view GetText(int n) const noexcept = 0;
 	virtual void RegisterImage(int type, const char *xpm_data) = 0;
 	virtual void RegisterRGBAImage(int type, int width, int height, const unsigned char *pixelsImage) = 0;
 	virtual void ClearRegisteredImages() noexcept = 0;
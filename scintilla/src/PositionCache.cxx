@@ -69,6 +69,27 @@ void BidiData::Resize(size_t maxLineLength_) {
 	widthReprs.resize(maxLineLength_ + 1);
 }
 
+void LinePositions::Allocate(size_t length_) {
+	data = std::make_unique<XYPOSITION[]>(length_);
+	length = length_;
+}
+
+void LinePositions::Grow(size_t length_, size_t maxLength) {
+	if (length_ > length) {
+		length_ = std::min(std::max(length_, length*2), maxLength);
+		auto data_ = std::make_unique<XYPOSITION[]>(length_);
+		if (length != 0) {
+			memcpy(data_.get(), data.get(), length*sizeof(XYPOSITION));
+		}
+		data.swap(data_);
+		length = length_;
+	}
+}
+
+void LinePositions::Clear() const noexcept {
+	memset(data.get(), 0, length*sizeof(XYPOSITION));
+}
+
 LineLayout::LineLayout(Sci::Line lineNumber_, int maxLineLength_) :
 	lineNumber(lineNumber_),
 	lenLineStarts(0),
@@ -99,8 +120,7 @@ void LineLayout::Resize(int maxLineLength_) {
 		styles.swap(styles_);
 		// Extra position allocated as sometimes the Windows
 		// GetTextExtentExPoint API writes an extra element.
-		auto positions_ = std::make_unique<XYPOSITION[]>(lineAllocation);
-		positions.swap(positions_);
+		positions.Allocate(std::min<size_t>(lineAllocation, largeLineLength));
 		lineStarts.reset();
 		bidiData.reset();
 		lenLineStarts = 0;
@@ -123,8 +143,12 @@ void LineLayout::EnsureBidiData() {
 }
 
 void LineLayout::ClearPositions() const noexcept {
-	//std::fill_n(positions.get(), maxLineLength + sizeof(int), 0.0f);
-	memset(positions.get(), 0, (maxLineLength + sizeof(int)) * sizeof(XYPOSITION));
+	positions.Clear();
+}
+
+void LineLayout::EnsurePositions(int endPos) {
+	constexpr size_t sentinel = sizeof(int);
+	positions.Grow(endPos + 1 + sentinel, maxLineLength + sentinel);
 }
 
 void LineLayout::Invalidate(ValidLevel validity_) noexcept {
@@ -132,6 +156,19 @@ void LineLayout::Invalidate(ValidLevel validity_) noexcept {
 		validity = validity_;
 }
 
+size_t LineLayout::MemoryUsage() const noexcept {
+	size_t usage = sizeof(LineLayout) + lenLineStarts*sizeof(int);
+	if (chars) {
+		constexpr size_t sentinel = sizeof(int);
+		usage += (maxLineLength + sentinel)*(sizeof(char) + sizeof(unsigned char)) + positions.Length()*sizeof(XYPOSITION);
+	}
+	if (bidiData) {
+		usage += sizeof(BidiData) + bidiData->stylesFonts.capacity()*sizeof(std::shared_ptr<Font>)
+			+ bidiData->widthReprs.capacity()*sizeof(XYPOSITION);
+	}
+	return usage;
+}
+
 bool LineLayout::CanHold(Sci::Line lineDoc, int lineLength_) const noexcept {
 	return (lineNumber == lineDoc) && (lineLength_ <= maxLineLength);
 }
@@ -569,8 +606,21 @@ bool SignificantLines::LineMayCache(Sci::Line line) const noexcept {
 	}
 }
 
+namespace {
+
+// a 5 MiB line takes about 30 MiB
+#if defined(_WIN64)
+constexpr size_t longLineCacheBudget = 512*1024*1024;
+#else
+constexpr size_t longLineCacheBudget = 64*1024*1024;
+#endif
+
+}
+
 LineLayoutCache::LineLayoutCache() noexcept:
 	lastCaretSlot(SIZE_MAX),
+	longCacheBudget(longLineCacheBudget),
+	hits(0), misses(0), evictions(0),
 	level(LineCache::None),
 	maxValidity(LineLayout::ValidLevel::invalid), styleClock(-1) {
 }
@@ -722,9 +772,71 @@ void LineLayoutCache::AllocateForLevel(Sci::Line linesOnScreen, Sci::Line linesI
 	PLATFORM_ASSERT(shortCache.size() >= lengthForLevel);
 }
 
+size_t LineLayoutCache::MemoryUsage() const noexcept {
+	size_t usage = (shortCache.capacity() + longCache.capacity())*sizeof(std::unique_ptr<LineLayout>);
+	for (const auto &ll : shortCache) {
+		if (ll) {
+			usage += ll->MemoryUsage();
+		}
+	}
+	for (const auto &ll : longCache) {
+		if (ll) {
+			usage += ll->MemoryUsage();
+		}
+	}
+	return usage;
+}
+
+size_t LineLayoutCache::LongCacheUsage() const noexcept {
+	size_t usage = 0;
+	for (const auto &ll : longCache) {
+		usage += ll->MemoryUsage();
+	}
+	return usage;
+}
+
+void LineLayoutCache::TrimLongCache() noexcept {
+	// most recently used layout is always kept as it's returned by Retrieve()
+	size_t usage = LongCacheUsage();
+	size_t count = 0;
+	while (usage > longCacheBudget && count + 1 < longCache.size()) {
+		usage -= longCache[count]->MemoryUsage();
+		++count;
+	}
+	if (count != 0) {
+		evictions += count;
+		longCache.erase(longCache.begin(), longCache.begin() + count);
+	}
+}
+
+void LineLayoutCache::SetLongCacheBudget(size_t budget) noexcept {
+	longCacheBudget = budget;
+	TrimLongCache();
+}
+
+size_t LineLayoutCache::Statistic(LayoutCacheStatistic statistic) const noexcept {
+	switch (statistic) {
+	case LayoutCacheStatistic::Hits:
+		return hits;
+	case LayoutCacheStatistic::Misses:
+		return misses;
+	case LayoutCacheStatistic::Evictions:
+		return evictions;
+	case LayoutCacheStatistic::LongLines:
+		return longCache.size();
+	case LayoutCacheStatistic::LongBytes:
+		return LongCacheUsage();
+	default:
+		return 0;
+	}
+}
+
 void LineLayoutCache::Deallocate() noexcept {
 	maxValidity = LineLayout::ValidLevel::invalid;
 	lastCaretSlot = SIZE_MAX;
+	hits = 0;
+	misses = 0;
+	evictions = 0;
 	shortCache.clear();
 	longCache.clear();
 }
@@ -768,11 +880,13 @@ LineLayout *LineLayoutCache::Retrieve(Sci::Line lineNumber, Sci::Line lineCaret,
 	LineLayout *ret = nullptr;
 	const int useLongCache = UseLongCache(maxChars);
 	if (useLongCache) {
-		for (const auto &ll : longCache) {
-			if (ll->LineNumber() == lineNumber) {
-				ret = ll.get();
-				break;
-			}
+		const auto it = std::find_if(longCache.begin(), longCache.end(), [lineNumber](const auto &ll) noexcept {
+			return ll->LineNumber() == lineNumber;
+		});
+		if (it != longCache.end()) {
+			// move to most recently used
+			std::rotate(it, it + 1, longCache.end());
+			ret = longCache.back().get();
 		}
 	} else if (level == LineCache::Page) {
 		// two arenas, each with two pages to ensure cache efficiency on scrolling.
@@ -807,19 +921,26 @@ LineLayout *LineLayoutCache::Retrieve(Sci::Line lineNumber, Sci::Line lineCaret,
 		if (!ret->CanHold(lineNumber, maxChars)) {
 			//printf("USE line=%zd/%zd, caret=%zd/%zd top=%zd, pos=%zu, clock=%d\n",
 			//	lineNumber, ret->LineNumber(), lineCaret, lastCaretSlot, topLine, pos, styleClock_);
+			++misses;
 			ret->~LineLayout();
 			::new (ret) LineLayout(lineNumber, maxChars);
+			if (useLongCache) {
+				TrimLongCache();
+			}
 		} else {
+			++hits;
 			//printf("HIT line=%zd, caret=%zd/%zd top=%zd, pos=%zu, clock=%d, validity=%d\n",
 			//	lineNumber, lineCaret, lastCaretSlot, topLine, pos, styleClock_, ret->validity);
 		}
 	} else {
 		//printf("NEW line=%zd, caret=%zd/%zd top=%zd, pos=%zu, clock=%d\n",
 		//	lineNumber, lineCaret, lastCaretSlot, topLine, pos, styleClock_);
+		++misses;
 		auto ll = std::make_unique<LineLayout>(lineNumber, maxChars);
 		ret = ll.get();
 		if (useLongCache) {
 			longCache.push_back(std::move(ll));
+			TrimLongCache();
 		} else {
 			shortCache[pos].swap(ll);
 		}
@@ -1079,15 +1200,19 @@ BreakFinder::BreakFinder(const LineLayout *ll_, const Selection *psel, Range lin
 		}
 	}
 	if (FlagSet(breakFor, BreakFor::Foreground) && pvsDraw->indicatorsSetFore) {
-		for (const auto *const deco : pdoc->decorations->View()) {
-			if (pvsDraw->indicators[deco->Indicator()].OverridesTextFore()) {
-				Sci::Position startPos = deco->EndRun(posLineStart);
-				while (startPos < (posLineStart + endPos)) {
-					Insert(startPos - posLineStart);
-					startPos = deco->EndRun(startPos);
+		// Break at each boundary of runs that change text colour
+		const Sci::Position posLineEnd = posLineStart + endPos;
+		const std::vector<DecorationRun> &runs = pdoc->decorations->RunsInRange(posLineStart, posLineEnd);
+		ForEachDecorationRun(runs, posLineStart, posLineEnd, [&](const DecorationRun &run) {
+			if (pvsDraw->indicators[run.indicator].OverridesTextFore()) {
+				if (run.start > posLineStart) {
+					Insert(run.start - posLineStart);
+				}
+				if (run.end < posLineEnd) {
+					Insert(run.end - posLineStart);
 				}
 			}
-		}
+		});
 	}
 	Insert(ll->edgeColumn);
 	Insert(endPos);
@@ -1193,11 +1318,23 @@ void PositionCacheEntry::Clear() noexcept {
 	positions.reset();
 }
 
+void PositionCacheEntry::Store(char *data, const XYPOSITION *positions_, size_t length) noexcept {
+	for (size_t i = 0; i < length; i++) {
+		const CachedPosition position = static_cast<CachedPosition>(positions_[i]);
+		memcpy(data + i*sizeof(CachedPosition), &position, sizeof(CachedPosition));
+	}
+}
+
 bool PositionCacheEntry::Retrieve(uint16_t styleNumber_, std::string_view sv, XYPOSITION *positions_) const noexcept {
 	if (styleNumber == styleNumber_ && len == sv.length()) {
-		const size_t offset = sv.length()*sizeof(XYPOSITION);
+		const size_t offset = sv.length()*sizeof(CachedPosition);
 		if (memcmp(&positions[offset], sv.data(), sv.length()) == 0) {
-			memcpy(positions_, &positions[0], offset);
+			const char *data = positions.get();
+			for (size_t i = 0; i < sv.length(); i++) {
+				CachedPosition position;
+				memcpy(&position, data + i*sizeof(CachedPosition), sizeof(CachedPosition));
+				positions_[i] = position;
+			}
 			return true;
 		}
 	}
@@ -1240,13 +1377,18 @@ void PositionCacheEntry::ResetClock() noexcept {
 PositionCache::PositionCache() = default;
 
 void PositionCache::Clear() noexcept {
-	if (!allClear) {
-		for (auto &pce : pces) {
-			pce.Clear();
+	const size_t shardSize = pces.size()/shardCount;
+	for (size_t index = 0; index < shardCount; index++) {
+		Shard &shard = shards[index];
+		if (!shard.allClear) {
+			PositionCacheEntry * const entries = ShardEntries(index);
+			for (size_t i = 0; i < shardSize; i++) {
+				entries[i].Clear();
+			}
 		}
+		shard.clock = 1;
+		shard.allClear = true;
 	}
-	clock = 1;
-	allClear = true;
 }
 
 void PositionCache::SetSize(size_t size_) {
@@ -1255,12 +1397,52 @@ void PositionCache::SetSize(size_t size_) {
 		size_ = NextPowerOfTwo(size_);
 	}
 	pces.resize(size_);
+	// keep at least 64 entries in each shard
+	shardCount = std::clamp<size_t>(size_/64, 1, maxShardCount);
+	for (Shard &shard : shards) {
+		shard.hits = 0;
+		shard.misses = 0;
+	}
 }
 
 size_t PositionCache::GetSize() const noexcept {
 	return pces.size();
 }
 
+size_t PositionCache::MemoryUsage() const noexcept {
+	size_t usage = pces.capacity()*sizeof(PositionCacheEntry);
+	const size_t shardSize = pces.size()/shardCount;
+	for (size_t index = 0; index < shardCount; index++) {
+		if (!shards[index].allClear) {
+			const PositionCacheEntry * const entries = pces.data() + index*shardSize;
+			for (size_t i = 0; i < shardSize; i++) {
+				usage += entries[i].MemoryUsage();
+			}
+		}
+	}
+	return usage;
+}
+
+size_t PositionCache::Statistic(PositionCacheStatistic statistic, int shard) const noexcept {
+	if (statistic == PositionCacheStatistic::Shards) {
+		return shardCount;
+	}
+	size_t first = 0;
+	size_t last = shardCount;
+	if (shard >= 0) {
+		if (static_cast<size_t>(shard) >= shardCount) {
+			return 0;
+		}
+		first = shard;
+		last = first + 1;
+	}
+	size_t count = 0;
+	for (; first < last; first++) {
+		count += (statistic == PositionCacheStatistic::Hits) ? shards[first].hits : shards[first].misses;
+	}
+	return count;
+}
+
 void PositionCache::MeasureWidths(Surface *surface, const Style &style, unsigned styleNumber_, std::string_view sv, XYPOSITION *positions) {
 	if (style.monospaceASCII && AllGraphicASCII(sv)) {
 		XYPOSITION characterWidth = style.aveCharWidth;
@@ -1320,28 +1502,28 @@ void PositionCache::MeasureWidths(Surface *surface, const Style &style, unsigned
 
 	PositionCacheEntry *entry = nullptr;
 	PositionCacheEntry *entry2 = nullptr;
+	Shard *shard = nullptr;
 	const uint16_t styleNumber = styleNumber_ & UINT16_MAX;
-	constexpr size_t maxLength = (512 - 16)/(sizeof(XYPOSITION) + 1);
+	constexpr size_t maxLength = (512 - 16)/(sizeof(PositionCacheEntry::CachedPosition) + 1);
 	if (sv.length() <= maxLength) {
 		// Only store short strings in the cache so it doesn't churn with
 		// long comments with only a single comment.
 
-		// Two way associative: try two probe positions.
+		// Two way associative: try two probe positions inside the shard chosen by high bits of hash.
 		const size_t hashValue = PositionCacheEntry::Hash(styleNumber, sv);
-		const size_t mask = pces.size() - 1;
-		const size_t probe = hashValue & mask;
-		entry = &pces[probe];
-
-		const LockGuard<NativeMutex> readLock(cacheLock);
-		if (entry->Retrieve(styleNumber, sv, positions)) {
-			return;
-		}
-
-		const size_t probe2 = (hashValue * 37) & mask;
-		entry2 = &pces[probe2];
-		if (entry2->Retrieve(styleNumber, sv, positions)) {
+		const size_t index = (hashValue >> 24) & (shardCount - 1);
+		const size_t mask = pces.size()/shardCount - 1;
+		PositionCacheEntry * const entries = ShardEntries(index);
+		shard = &shards[index];
+		entry = &entries[hashValue & mask];
+		entry2 = &entries[(hashValue * 37) & mask];
+
+		const LockGuard<NativeMutex> readLock(shard->cacheLock);
+		if (entry->Retrieve(styleNumber, sv, positions) || entry2->Retrieve(styleNumber, sv, positions)) {
+			shard->hits++;
 			return;
 		}
+		shard->misses++;
 	}
 
 	if (styleNumber_ & (1 << 16)) {
@@ -1352,28 +1534,30 @@ void PositionCache::MeasureWidths(Surface *surface, const Style &style, unsigned
 	if (entry) {
 		// constructed here to reduce lock time
 		const size_t length = sv.length();
-		const size_t offset = length*sizeof(XYPOSITION);
+		const size_t offset = length*sizeof(PositionCacheEntry::CachedPosition);
 		std::unique_ptr<char[]> positions_ = std::make_unique_for_overwrite<char[]>(offset + length);
-		memcpy(&positions_[0], positions, offset);
+		PositionCacheEntry::Store(positions_.get(), positions, length);
 		memcpy(&positions_[offset], sv.data(), length);
 
 		// Store into cache
-		const LockGuard<NativeMutex> writeLock(cacheLock);
+		const LockGuard<NativeMutex> writeLock(shard->cacheLock);
 		// Choose the oldest of the two slots to replace
 		if (entry->NewerThan(*entry2)) {
 			entry = entry2;
 		}
 
-		clock++;
-		if (clock > UINT16_MAX) {
+		shard->clock++;
+		if (shard->clock > UINT16_MAX) {
 			// Since there are only 16 bits for the clock, wrap it round and
-			// reset all cache entries so none get stuck with a high clock.
-			for (PositionCacheEntry &pce : pces) {
-				pce.ResetClock();
+			// reset all cache entries in the shard so none get stuck with a high clock.
+			PositionCacheEntry * const entries = ShardEntries(shard - shards.data());
+			const size_t shardSize = pces.size()/shardCount;
+			for (size_t i = 0; i < shardSize; i++) {
+				entries[i].ResetClock();
 			}
-			clock = 2;
+			shard->clock = 2;
 		}
-		allClear = false;
-		entry->Set(styleNumber, length, positions_, clock);
+		shard->allClear = false;
+		entry->Set(styleNumber, length, positions_, shard->clock);
 	}
 }
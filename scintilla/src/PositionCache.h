@@ -40,6 +40,38 @@ public:
 	void Resize(size_t maxLineLength_);
 };
 
+/**
+* Character positions of a line layout.
+* Positions beyond the allocated length read as zero, so a gigantic line only
+* needs to allocate positions for the part that has been laid out.
+*/
+class LinePositions final {
+	std::unique_ptr<XYPOSITION[]> data;
+	size_t length = 0;
+public:
+	void Allocate(size_t length_);
+	void Grow(size_t length_, size_t maxLength);
+	void Clear() const noexcept;
+	size_t Length() const noexcept {
+		return length;
+	}
+	XYPOSITION *get() const noexcept {
+		return data.get();
+	}
+	XYPOSITION operator[](size_t index) const noexcept {
+		return (index < length) ? data[index] : 0;
+	}
+	XYPOSITION &operator[](size_t index) noexcept {
+		if (index < length) {
+			return data[index];
+		}
+		// only written after Grow(), reads of unallocated positions get zero
+		thread_local XYPOSITION zero;
+		zero = 0;
+		return zero;
+	}
+};
+
 /**
  */
 class LineLayout final {
@@ -50,7 +82,9 @@ private:
 	int lenLineStarts;
 public:
 	enum {
-		wrapWidthInfinite = 0x7ffffff
+		wrapWidthInfinite = 0x7ffffff,
+		// positions of longer lines are allocated as layout progresses
+		largeLineLength = 1024*1024,
 	};
 
 	int maxLineLength;
@@ -68,7 +102,7 @@ public:
 	int caretPosition;
 	std::unique_ptr<char[]> chars;
 	std::unique_ptr<unsigned char[]> styles;
-	std::unique_ptr<XYPOSITION[]> positions;
+	LinePositions positions;
 
 	std::unique_ptr<BidiData> bidiData;
 
@@ -82,6 +116,7 @@ public:
 	void Reset(Sci::Line lineNumber_, Sci::Position maxLineLength_);
 	void EnsureBidiData();
 	void ClearPositions() const noexcept;
+	void EnsurePositions(int endPos);
 	void Invalidate(ValidLevel validity_) noexcept;
 	Sci::Line LineNumber() const noexcept {
 		return lineNumber;
@@ -112,6 +147,7 @@ public:
 	int EndLineStyle() const noexcept;
 	[[nodiscard]] int LastStyle() const noexcept;
 	void SCICALL WrapLine(const Document *pdoc, Sci::Position posLineStart, Wrap wrapState, XYPOSITION wrapWidth, XYPOSITION wrapIndent_, bool partialLine);
+	[[nodiscard]] size_t MemoryUsage() const noexcept;
 };
 
 struct ScreenLine final : public IScreenLine {
@@ -159,12 +195,19 @@ struct SignificantLines {
 class LineLayoutCache final {
 private:
 	std::vector<std::unique_ptr<LineLayout>> shortCache;
+	// ordered from least recently used to most recently used
 	std::vector<std::unique_ptr<LineLayout>> longCache;
 	size_t lastCaretSlot;
+	size_t longCacheBudget;
+	size_t hits;
+	size_t misses;
+	size_t evictions;
 	Scintilla::LineCache level;
 	LineLayout::ValidLevel maxValidity;
 	int styleClock;
 	void AllocateForLevel(Sci::Line linesOnScreen, Sci::Line linesInDoc);
+	[[nodiscard]] size_t LongCacheUsage() const noexcept;
+	void TrimLongCache() noexcept;
 public:
 	LineLayoutCache() noexcept;
 	// Deleted so LineLayoutCache objects can not be copied.
@@ -179,6 +222,10 @@ public:
 	Scintilla::LineCache GetLevel() const noexcept {
 		return level;
 	}
+	void SetLongCacheBudget(size_t budget) noexcept;
+	size_t GetLongCacheBudget() const noexcept {
+		return longCacheBudget;
+	}
 	LineLayout* SCICALL Retrieve(Sci::Line lineNumber, Sci::Line lineCaret, int maxChars, int styleClock_,
 		Sci::Line linesOnScreen, Sci::Line linesInDoc, Sci::Line topLine);
 	LineLayout* Retrieve(Sci::Line lineNumber, const SignificantLines &significantLines, int maxChars) {
@@ -190,6 +237,8 @@ public:
 	static constexpr int UseLongCache(unsigned maxChars) noexcept {
 		return maxChars >> (20 + 1); // 2MiB
 	}
+	[[nodiscard]] size_t MemoryUsage() const noexcept;
+	[[nodiscard]] size_t Statistic(Scintilla::LayoutCacheStatistic statistic) const noexcept;
 };
 
 class PositionCacheEntry {
@@ -198,12 +247,20 @@ class PositionCacheEntry {
 	uint32_t len = 0;
 	std::unique_ptr<char[]> positions;
 public:
+	// positions within a short segment are stored as float which keeps far more than
+	// sub-pixel precision, platform layers measure in float (DirectWrite) or integer (GDI).
+	using CachedPosition = float;
+	static void Store(char *data, const XYPOSITION *positions_, size_t length) noexcept;
 	void Set(uint16_t styleNumber_, size_t length, std::unique_ptr<char[]> &positions_, uint32_t clock_) noexcept;
 	void Clear() noexcept;
 	bool Retrieve(uint16_t styleNumber_, std::string_view sv, XYPOSITION *positions_) const noexcept;
 	static size_t Hash(uint16_t styleNumber_, std::string_view sv) noexcept;
 	[[nodiscard]] bool NewerThan(const PositionCacheEntry &other) const noexcept;
 	void ResetClock() noexcept;
+	[[nodiscard]] size_t MemoryUsage() const noexcept {
+		// positions followed by text
+		return positions ? (len * (sizeof(CachedPosition) + 1)) : 0;
+	}
 };
 
 class Representation {
@@ -315,10 +372,22 @@ public:
 constexpr size_t positionCacheDefaultSize = 0x400;
 
 class PositionCache {
+	// entries are divided into shards, each shard is locked independently
+	// so that threads measuring different strings rarely wait for each other.
+	struct alignas(64) Shard {
+		NativeMutex cacheLock;
+		uint32_t clock = 1;
+		bool allClear = true;
+		size_t hits = 0;
+		size_t misses = 0;
+	};
+	static constexpr size_t maxShardCount = 16;
 	std::vector<PositionCacheEntry> pces { positionCacheDefaultSize };
-	NativeMutex cacheLock;
-	uint32_t clock = 1;
-	bool allClear = true;
+	std::array<Shard, maxShardCount> shards;
+	size_t shardCount = maxShardCount;
+	PositionCacheEntry *ShardEntries(size_t shard) noexcept {
+		return pces.data() + shard*(pces.size()/shardCount);
+	}
 public:
 	PositionCache();
 	// Deleted so PositionCache objects can not be copied.
@@ -331,6 +400,8 @@ public:
 	void Clear() noexcept;
 	void SetSize(size_t size_);
 	[[nodiscard]] size_t GetSize() const noexcept;
+	[[nodiscard]] size_t MemoryUsage() const noexcept;
+	[[nodiscard]] size_t Statistic(Scintilla::PositionCacheStatistic statistic, int shard) const noexcept;
 	void MeasureWidths(Surface *surface, const Style &style, unsigned styleNumber_, std::string_view sv, XYPOSITION *positions);
 };
 
@@ -206,6 +206,8 @@
 
 #include <stdexcept>
 #include <string>
+#include <string_view>
+#include <vector>
 #include <array>
 #include <algorithm>
 #include <iterator>
@@ -263,7 +265,6 @@ RESearch::RESearch(const CharClassify *charClassTable) noexcept {
 	lineStartPos = 0;
 	lineEndPos = 0;
 	sta = NOP;                  /* status of lastpat */
-	previousFlags = FindOption::None;
 	memset(nfa, END, 4);
 	memset(bittab, 0, BITBLK);
 	Clear();
@@ -274,6 +275,11 @@ void RESearch::Clear() noexcept {
 	eopat.fill(NOTFOUND);
 }
 
+void RESearch::ClearCache() noexcept {
+	sta = NOP;
+	cache.clear();
+}
+
 void RESearch::ChSet(unsigned char c) noexcept {
 	bittab[c >> 3] |= 1 << (c & BITIND);
 }
@@ -471,16 +477,27 @@ int RESearch::GetBackslashExpression(const char *pattern, int &incr) noexcept {
 }
 
 const char *RESearch::Compile(const char *pattern, size_t length, FindOption flags) {
-	if (sta == OKP && (flags == previousFlags
-		&& length == cachedPattern.length()
-		&& memcmp(pattern, cachedPattern.data(), length) == 0)) {
-		return nullptr;
+	const std::string_view text(pattern, length);
+	for (auto it = cache.begin(); it != cache.end(); ++it) {
+		if (it->flags == flags && it->pattern == text) {
+			if (sta != OKP || it != cache.begin()) {
+				memcpy(nfa, it->nfa.data(), MAXNFA);
+				sta = OKP;
+				std::rotate(cache.begin(), it, it + 1);
+				useDfa = FlagSet(flags, FindOption::RegexDfa) && dfa.Build(nfa, charClass);
+			}
+			return nullptr;
+		}
 	}
 
+	useDfa = false;
 	const char * const errmsg = DoCompile(pattern, length, flags);
 	if (errmsg == nullptr) {
-		previousFlags = flags;
-		cachedPattern.assign(pattern, length);
+		if (cache.size() == cacheSize) {
+			cache.pop_back();
+		}
+		cache.insert(cache.begin(), { flags, std::string(text), std::string(nfa, MAXNFA) });
+		useDfa = FlagSet(flags, FindOption::RegexDfa) && dfa.Build(nfa, charClass);
 	}
 	return errmsg;
 }
@@ -804,6 +821,13 @@ int RESearch::Execute(const CharacterIndexer &ci, Sci::Position lp, Sci::Positio
 	const char * const ap = nfa;
 
 	Clear();
+	if (useDfa) {
+		if (!dfa.Execute(ci, lp, endp, lineStartPos, lineEndPos, bopat.data(), eopat.data())) {
+			return 0;
+		}
+		eopat[0] = ci.MovePositionOutsideChar(eopat[0], 1);
+		return 1;
+	}
 
 	switch (*ap) {
 
@@ -1023,3 +1047,388 @@ Sci::Position RESearch::PMatch(const CharacterIndexer &ci, Sci::Position lp, Sci
 	}
 	return lp;
 }
+
+Sci::Position CharacterIndexer::FindLiteral(Sci::Position pos, Sci::Position endPos, const char *text, size_t length) const noexcept {
+	const Sci::Position endSearch = endPos - length;
+	for (; pos <= endSearch; pos++) {
+		size_t index = 0;
+		while (index < length && CharAt(pos + index) == text[index]) {
+			index++;
+		}
+		if (index == length) {
+			return pos;
+		}
+	}
+	return -1;
+}
+
+/*
+ * RegexDfa: decode compiled nfa into a list of items, each item is an atom
+ * (CHR, ANY or CCL) with optional closure (CLQ or CLO), or a zero width
+ * assertion (BOL, EOL, BOW, EOW) or tag (BOT, EOT). Bit i of a state mask
+ * means items before i have been matched, bit itemCount means accept.
+ */
+
+namespace {
+
+static_assert(RegexDfa::MaxTag == RESearch::MAXTAG);
+
+constexpr uint64_t Closure(uint64_t state, uint64_t skip) noexcept {
+	uint64_t next;
+	while ((next = state | ((state & skip) << 1)) != state) {
+		state = next;
+	}
+	return state;
+}
+
+struct DfaThread {
+	Sci::Position bopat[RegexDfa::MaxTag];
+	Sci::Position eopat[RegexDfa::MaxTag];
+};
+
+}
+
+bool RegexDfa::Build(const char *nfa, const CharClassify *charClass) {
+	itemCount = 0;
+	starMask = 0;
+	passMask = 0;
+	bolMask = 0;
+	eolMask = 0;
+	bowMask = 0;
+	eowMask = 0;
+	botMask = 0;
+	charMask.fill(0);
+	tagIndex.fill(0);
+	literal.clear();
+	literalPrefix = false;
+	ResetCache();
+
+	std::string run;
+	int runStart = 0;
+	int firstItem = -1;	// first item that is not a tag
+	const char *ap = nfa;
+	uint8_t op;
+	while ((op = *ap++) != END) {
+		if (itemCount == maxItems) {
+			return false;
+		}
+		const uint64_t bit = UINT64_C(1) << itemCount;
+		uint8_t closure = END;
+		if (op == CLO || op == CLQ) {
+			closure = op;
+			op = *ap++;
+		}
+		bool literalChar = false;
+		switch (op) {
+		case CHR: {
+			const unsigned char ch = *ap++;
+			charMask[ch] |= bit;
+			literalChar = closure == END;
+			if (literalChar) {
+				if (run.empty()) {
+					runStart = itemCount;
+				}
+				run.push_back(static_cast<char>(ch));
+			}
+		} break;
+		case ANY:
+			for (auto &mask : charMask) {
+				mask |= bit;
+			}
+			break;
+		case CCL:
+			for (int ch = 0; ch < RESearch::MAXCHR; ch++) {
+				if (isinset(ap, static_cast<unsigned char>(ch))) {
+					charMask[ch] |= bit;
+				}
+			}
+			ap += RESearch::BITBLK;
+			break;
+		case BOL:
+			bolMask |= bit;
+			break;
+		case EOL:
+			eolMask |= bit;
+			break;
+		case BOW:
+			bowMask |= bit;
+			break;
+		case EOW:
+			eowMask |= bit;
+			break;
+		case BOT:
+		case EOT: {
+			// tags are zero width, don't break literal run
+			const int n = static_cast<uint8_t>(*ap++);
+			tagIndex[itemCount] = static_cast<int8_t>((op == BOT) ? n : -n);
+			passMask |= bit;
+			if (op == BOT) {
+				botMask |= bit;
+			}
+			literalChar = !run.empty();
+		} break;
+		default:
+			// REF and LCLO are not supported
+			return false;
+		}
+		if (closure != END) {
+			ap++; // END after closure atom
+			passMask |= bit;
+			if (closure == CLO) {
+				starMask |= bit;
+			}
+		}
+		if (firstItem < 0 && (op != BOT && op != EOT)) {
+			firstItem = itemCount;
+		}
+		if (!literalChar && !run.empty()) {
+			if (run.length() > literal.length()) {
+				literal = run;
+				literalPrefix = runStart == firstItem;
+			}
+			run.clear();
+		}
+		++itemCount;
+	}
+	if (run.length() > literal.length()) {
+		literal = run;
+		literalPrefix = runStart == firstItem;
+	}
+
+	acceptBit = UINT64_C(1) << itemCount;
+	anchored = (bolMask & 1) != 0;
+	startAtEnd = ((eolMask | eowMask) & 1) != 0;
+	for (int ch = 0; ch < RESearch::MAXCHR; ch++) {
+		wordChar[ch] = charClass->IsWord(static_cast<unsigned char>(ch));
+	}
+	return true;
+}
+
+uint64_t RegexDfa::SkipMask(bool atStart, bool atEnd, bool prevWord, bool nextWord) const noexcept {
+	uint64_t skip = passMask;
+	if (atStart) {
+		skip |= bolMask;
+	}
+	if (atEnd) {
+		skip |= eolMask;
+	}
+	if ((atStart || !prevWord) && nextWord) {
+		skip |= bowMask;
+	}
+	if (!atStart && prevWord && !nextWord) {
+		skip |= eowMask;
+	}
+	return skip;
+}
+
+void RegexDfa::ResetCache() {
+	stateKeys.clear();
+	transitions.clear();
+	hashTable.assign(1 << hashBits, -1);
+}
+
+int32_t RegexDfa::StateIndex(uint64_t key) {
+	constexpr size_t hashMask = (1 << hashBits) - 1;
+	size_t hash = static_cast<size_t>((key * UINT64_C(0x9E3779B97F4A7C15)) >> (64 - hashBits));
+	while (true) {
+		const int32_t index = hashTable[hash];
+		if (index < 0) {
+			break;
+		}
+		if (stateKeys[index] == key) {
+			return index;
+		}
+		hash = (hash + 1) & hashMask;
+	}
+	if (stateKeys.size() == maxStates) {
+		// drop all cached states, caller must not use previous state index
+		ResetCache();
+		return StateIndex(key);
+	}
+	const int32_t index = static_cast<int32_t>(stateKeys.size());
+	hashTable[hash] = index;
+	stateKeys.push_back(key);
+	transitions.resize(transitions.size() + RESearch::MAXCHR, -1);
+	return index;
+}
+
+int32_t RegexDfa::Transition(int32_t index, unsigned char ch) {
+	const uint64_t key = stateKeys[index];
+	const bool nextWord = wordChar[ch];
+	uint64_t state = key & ~wordBit;
+	if (!anchored) {
+		state |= 1;
+	}
+	state = Closure(state, SkipMask(false, false, (key & wordBit) != 0, nextWord));
+	const int32_t accept = (state & acceptBit) != 0;
+	const uint64_t matched = state & charMask[ch];
+	state = ((matched & ~starMask) << 1) | (matched & starMask);
+	if (nextWord) {
+		state |= wordBit;
+	}
+	const size_t count = stateKeys.size();
+	const int32_t next = (StateIndex(state) << 1) | accept;
+	if (count <= stateKeys.size()) {
+		transitions[index*RESearch::MAXCHR + ch] = next;
+	}
+	return next;
+}
+
+// whether any match ends inside [pos, endp], is a superset of Match()
+bool RegexDfa::Scan(const CharacterIndexer &ci, Sci::Position pos, Sci::Position endp, Sci::Position lineStartPos, Sci::Position lineEndPos) {
+	bool prevWord = pos != lineStartPos && wordChar[static_cast<unsigned char>(ci.CharAt(pos - 1))];
+	uint64_t state = 0;
+	bool startAllowed = anchored ? (pos == lineStartPos) : (startAtEnd && endp == lineEndPos);
+	if (pos == lineStartPos && pos < endp) {
+		// line start is only checked on first position
+		const unsigned char ch = ci.CharAt(pos);
+		state = Closure(1, SkipMask(true, pos >= lineEndPos, prevWord, wordChar[ch]));
+		if (state & acceptBit) {
+			return true;
+		}
+		const uint64_t matched = state & charMask[ch];
+		state = ((matched & ~starMask) << 1) | (matched & starMask);
+		prevWord = wordChar[ch];
+		startAllowed = !anchored && startAtEnd && endp == lineEndPos;
+		++pos;
+	}
+	if (pos < endp) {
+		int32_t index = StateIndex(state | (prevWord ? wordBit : 0));
+		while (pos < endp) {
+			if (anchored && (stateKeys[index] & ~wordBit) == 0) {
+				return false;
+			}
+			const unsigned char ch = ci.CharAt(pos);
+			int32_t next = transitions[index*RESearch::MAXCHR + ch];
+			if (next < 0) {
+				next = Transition(index, ch);
+			}
+			if (next & 1) {
+				return true;
+			}
+			index = next >> 1;
+			++pos;
+		}
+		state = stateKeys[index];
+		prevWord = (state & wordBit) != 0;
+		state &= ~wordBit;
+		startAllowed = !anchored && startAtEnd && endp == lineEndPos;
+	}
+	if (startAllowed) {
+		state |= 1;
+	}
+	const bool nextWord = wordChar[static_cast<unsigned char>(ci.CharAt(endp))];
+	state = Closure(state, SkipMask(pos == lineStartPos, endp >= lineEndPos, prevWord, nextWord));
+	return (state & acceptBit) != 0;
+}
+
+// find leftmost longest match, each item keeps the thread with smallest start.
+bool RegexDfa::Match(const CharacterIndexer &ci, Sci::Position pos, Sci::Position endp, Sci::Position lineStartPos, Sci::Position lineEndPos,
+	Sci::Position *bopat, Sci::Position *eopat) const {
+	const int count = itemCount + 1;
+	std::vector<DfaThread> threads(2*count);
+	DfaThread *current = threads.data();
+	DfaThread *next = current + count;
+	uint64_t active = 0;
+	Sci::Position bestEnd = RESearch::NOTFOUND;
+	const Sci::Position startPos = pos;
+	bool prevWord = pos != lineStartPos && wordChar[static_cast<unsigned char>(ci.CharAt(pos - 1))];
+	while (true) {
+		const bool atStart = pos == lineStartPos;
+		const unsigned char ch = ci.CharAt(pos);
+		const bool nextWord = wordChar[ch];
+		if (bestEnd < 0 && (active & 1) == 0 && ci.MovePositionOutsideChar(pos, -1) == pos
+			&& (anchored ? (pos == startPos) : (pos < endp || (startAtEnd && endp == lineEndPos)))) {
+			DfaThread &thread = current[0];
+			std::fill_n(thread.bopat, MaxTag, RESearch::NOTFOUND);
+			std::fill_n(thread.eopat, MaxTag, RESearch::NOTFOUND);
+			thread.bopat[0] = pos;
+			active |= 1;
+		}
+
+		const uint64_t skip = SkipMask(atStart, pos >= lineEndPos, prevWord, nextWord);
+		for (int i = 0; i < itemCount; i++) {
+			const uint64_t bit = UINT64_C(1) << i;
+			if ((active & skip & bit) == 0) {
+				continue;
+			}
+			const DfaThread &thread = current[i];
+			if ((active & (bit << 1)) != 0 && current[i + 1].bopat[0] <= thread.bopat[0]) {
+				continue;
+			}
+			if ((botMask & bit) != 0 && ci.MovePositionOutsideChar(pos, -1) != pos) {
+				continue;
+			}
+			DfaThread &target = current[i + 1];
+			target = thread;
+			const int tag = tagIndex[i];
+			if (tag > 0) {
+				target.bopat[tag] = pos;
+			} else if (tag < 0) {
+				target.eopat[-tag] = ci.MovePositionOutsideChar(pos, 1);
+			}
+			active |= bit << 1;
+		}
+
+		if (active & acceptBit) {
+			const DfaThread &thread = current[itemCount];
+			// later end with same start is longer
+			if (bestEnd < 0 || thread.bopat[0] <= bopat[0]) {
+				std::copy_n(thread.bopat, MaxTag, bopat);
+				std::copy_n(thread.eopat, MaxTag, eopat);
+				bestEnd = pos;
+				eopat[0] = pos;
+			}
+			for (int i = 0; i < itemCount; i++) {
+				if (current[i].bopat[0] > bopat[0]) {
+					active &= ~(UINT64_C(1) << i);
+				}
+			}
+		}
+		if (pos >= endp) {
+			break;
+		}
+
+		uint64_t nextActive = 0;
+		const uint64_t matched = active & charMask[ch];
+		for (int i = 0; i < itemCount; i++) {
+			const uint64_t bit = UINT64_C(1) << i;
+			if (matched & bit) {
+				const int target = (starMask & bit) ? i : i + 1;
+				const uint64_t targetBit = UINT64_C(1) << target;
+				if ((nextActive & targetBit) == 0 || current[i].bopat[0] < next[target].bopat[0]) {
+					next[target] = current[i];
+					nextActive |= targetBit;
+				}
+			}
+		}
+		std::swap(current, next);
+		active = nextActive;
+		prevWord = nextWord;
+		++pos;
+		if (active == 0 && (bestEnd >= 0 || anchored)) {
+			break;
+		}
+	}
+	return bestEnd >= 0;
+}
+
+bool RegexDfa::Execute(const CharacterIndexer &ci, Sci::Position lp, Sci::Position endp, Sci::Position lineStartPos, Sci::Position lineEndPos,
+	Sci::Position *bopat, Sci::Position *eopat) {
+	if (anchored && lp != lineStartPos) {
+		return false;
+	}
+	if (!literal.empty()) {
+		const Sci::Position pos = ci.FindLiteral(lp, endp, literal.data(), literal.length());
+		if (pos < 0) {
+			return false;
+		}
+		if (literalPrefix) {
+			lp = pos;
+		}
+	}
+	if (!Scan(ci, lp, endp, lineStartPos, lineEndPos)) {
+		return false;
+	}
+	return Match(ci, lp, endp, lineStartPos, lineEndPos, bopat, eopat);
+}
@@ -13,14 +13,66 @@ class CharacterIndexer {
 public:
 	virtual char CharAt(Sci::Position index) const noexcept = 0;
 	virtual Sci::Position MovePositionOutsideChar(Sci::Position pos, int moveDir) const noexcept = 0;
+	// find first start of text inside [pos, endPos), returns -1 when not found.
+	virtual Sci::Position FindLiteral(Sci::Position pos, Sci::Position endPos, const char *text, size_t length) const noexcept;
+};
+
+/**
+ * Lazy DFA for compiled pattern without back reference and lazy closure.
+ * Each item of the pattern is a NFA state, so state set fits in a 64-bit mask.
+ * A line is first scanned with cached DFA transitions to reject it quickly, then the
+ * leftmost longest match is found by a simulation that tracks start of each state.
+ */
+class RegexDfa {
+public:
+	static constexpr int MaxTag = 10;
+	bool Build(const char *nfa, const CharClassify *charClass);
+	bool Execute(const CharacterIndexer &ci, Sci::Position lp, Sci::Position endp, Sci::Position lineStartPos, Sci::Position lineEndPos,
+		Sci::Position *bopat, Sci::Position *eopat);
+
+private:
+	static constexpr int maxItems = 62;
+	static constexpr uint64_t wordBit = UINT64_C(1) << 63;
+	static constexpr size_t maxStates = 1024;
+	static constexpr int hashBits = 11;
+
+	int itemCount = 0;
+	bool anchored = false;		// start with ^
+	bool startAtEnd = false;	// start with $ or \>, can match at line end
+	bool literalPrefix = false;
+	uint64_t acceptBit = 0;
+	uint64_t starMask = 0;		// items with * closure
+	uint64_t passMask = 0;		// items can be skipped without condition: ?, * and tags
+	uint64_t bolMask = 0;
+	uint64_t eolMask = 0;
+	uint64_t bowMask = 0;
+	uint64_t eowMask = 0;
+	uint64_t botMask = 0;
+	std::array<uint64_t, 256> charMask{};	// items can consume the byte
+	std::array<bool, 256> wordChar{};
+	std::array<int8_t, maxItems> tagIndex{};	// tag number for BOT and EOT, negative for EOT
+	std::string literal;		// longest literal run, required for any match
+
+	// cached DFA states, key is NFA state mask with wordBit for previous character.
+	std::vector<uint64_t> stateKeys;
+	std::vector<int32_t> transitions;	// (next state << 1) | accept before the byte, -1 for not computed
+	std::vector<int32_t> hashTable;
+
+	uint64_t SkipMask(bool atStart, bool atEnd, bool prevWord, bool nextWord) const noexcept;
+	void ResetCache();
+	int32_t StateIndex(uint64_t key);
+	int32_t Transition(int32_t index, unsigned char ch);
+	bool Scan(const CharacterIndexer &ci, Sci::Position pos, Sci::Position endp, Sci::Position lineStartPos, Sci::Position lineEndPos);
+	bool Match(const CharacterIndexer &ci, Sci::Position pos, Sci::Position endp, Sci::Position lineStartPos, Sci::Position lineEndPos,
+		Sci::Position *bopat, Sci::Position *eopat) const;
 };
 
 class RESearch {
 public:
 	explicit RESearch(const CharClassify *charClassTable) noexcept;
-	// No dynamic allocation so default copy constructor and assignment operator are OK.
 	void Clear() noexcept;
 	const char *Compile(const char *pattern, size_t length, Scintilla::FindOption flags);
+	void ClearCache() noexcept;
 	int Execute(const CharacterIndexer &ci, Sci::Position lp, Sci::Position endp);
 	void SetLineRange(Sci::Position startPos, Sci::Position endPos) noexcept {
 		lineStartPos = startPos;
@@ -35,11 +87,13 @@ public:
 	MatchPositions eopat;
 
 private:
+	friend class RegexDfa;
 	static constexpr int MAXNFA = 4096;
 	// The following constants are not meant to be changeable.
 	static constexpr int MAXCHR = 256;
 	static constexpr int CHRBIT = 8;
 	static constexpr int BITBLK = MAXCHR / CHRBIT;
+	static constexpr size_t cacheSize = 4;
 
 	void ChSet(unsigned char c) noexcept;
 	void ChSetWithCase(unsigned char c, bool caseSensitive) noexcept;
@@ -54,9 +108,16 @@ private:
 	char nfa[MAXNFA];    /* automaton */
 	int sta;
 
-	// cache for previous pattern to avoid recompile
-	Scintilla::FindOption previousFlags;
-	std::string cachedPattern;
+	// recently compiled patterns to avoid recompile, most recently used first,
+	// the first one is current automaton when sta is OKP.
+	struct CompiledPattern {
+		Scintilla::FindOption flags;
+		std::string pattern;
+		std::string nfa;
+	};
+	std::vector<CompiledPattern> cache;
+	bool useDfa = false;
+	RegexDfa dfa;
 
 	unsigned char bittab[BITBLK]; /* bit table for CCL pre-set bits */
 	const CharClassify *charClass;
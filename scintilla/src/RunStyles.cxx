@@ -192,6 +192,112 @@ FillResult<DISTANCE> RunStyles<DISTANCE, STYLE>::FillRange(DISTANCE position, ST
 	return resultNoChange;
 }
 
+template <typename DISTANCE, typename STYLE>
+FillResult<DISTANCE> RunStyles<DISTANCE, STYLE>::FillRanges(const ptrdiff_t *ranges, size_t count, STYLE value) {
+	FillResult<DISTANCE> result{ false, 0, 0 };
+	const DISTANCE length = Length();
+	bool sorted = true;
+	ptrdiff_t spanStart = -1;
+	ptrdiff_t spanEnd = 0;
+	ptrdiff_t prevEnd = 0;
+	for (size_t i = 0; i < count*2; i += 2) {
+		const ptrdiff_t start = ranges[i];
+		const ptrdiff_t end = start + ranges[i + 1];
+		if (start < prevEnd || end > length || start > end) {
+			sorted = false;
+			break;
+		}
+		prevEnd = end;
+		if (start < end) {
+			if (spanStart < 0) {
+				spanStart = start;
+			}
+			spanEnd = end;
+		}
+	}
+
+	if (!sorted) {
+		// fill each range, as FillRange() does not require any order.
+		DISTANCE changedEnd = 0;
+		for (size_t i = 0; i < count*2; i += 2) {
+			const FillResult<DISTANCE> fr = FillRange(static_cast<DISTANCE>(ranges[i]), value, static_cast<DISTANCE>(ranges[i + 1]));
+			if (fr.changed) {
+				if (!result.changed) {
+					result.position = fr.position;
+					changedEnd = fr.position + fr.fillLength;
+				} else {
+					result.position = std::min(result.position, fr.position);
+					changedEnd = std::max(changedEnd, fr.position + fr.fillLength);
+				}
+				result.changed = true;
+			}
+		}
+		result.fillLength = changedEnd - result.position;
+		return result;
+	}
+	if (spanStart < 0) {
+		return result;
+	}
+
+	// merge existing runs inside [spanStart, spanEnd) with ranges to build new runs
+	const DISTANCE runStart = RunFromPosition(static_cast<DISTANCE>(spanStart));
+	const DISTANCE runLast = RunFromPosition(static_cast<DISTANCE>(spanEnd - 1));
+	std::vector<DISTANCE> positions;
+	std::vector<STYLE> values;
+	ptrdiff_t changedStart = -1;
+	ptrdiff_t changedEnd = 0;
+	size_t index = 0;
+	for (DISTANCE run = runStart; run <= runLast; run++) {
+		const STYLE valueRun = styles.ValueAt(run);
+		ptrdiff_t pos = std::max<ptrdiff_t>(starts.PositionFromPartition(run), spanStart);
+		const ptrdiff_t runEnd = std::min<ptrdiff_t>(starts.PositionFromPartition(run + 1), spanEnd);
+		while (pos < runEnd) {
+			while (index < count*2 && ranges[index] + ranges[index + 1] <= pos) {
+				index += 2;
+			}
+			ptrdiff_t next = runEnd;
+			STYLE valueNext = valueRun;
+			if (index < count*2 && ranges[index] <= pos) {
+				next = std::min<ptrdiff_t>(ranges[index] + ranges[index + 1], runEnd);
+				valueNext = value;
+				if (valueRun != value) {
+					if (changedStart < 0) {
+						changedStart = pos;
+					}
+					changedEnd = next;
+				}
+			} else if (index < count*2) {
+				next = std::min<ptrdiff_t>(ranges[index], runEnd);
+			}
+			if (values.empty() || values.back() != valueNext) {
+				positions.push_back(static_cast<DISTANCE>(pos));
+				values.push_back(valueNext);
+			}
+			pos = next;
+		}
+	}
+	if (changedStart < 0) {
+		return result;
+	}
+
+	// replace runs over the span, the first new run starts at spanStart
+	const DISTANCE first = SplitRun(static_cast<DISTANCE>(spanStart));
+	const DISTANCE last = (spanEnd < length) ? SplitRun(static_cast<DISTANCE>(spanEnd)) : starts.Partitions();
+	if (last - first > 1) {
+		starts.RemovePartitions(first + 1, last - first - 1);
+	}
+	styles.DeleteRange(first, last - first);
+	starts.InsertPartitions(first + 1, positions.data() + 1, positions.size() - 1);
+	styles.InsertFromArray(first, values.data(), values.size());
+	const DISTANCE runEnd = first + static_cast<DISTANCE>(values.size());
+	RemoveRunIfSameAsPrevious(runEnd);
+	RemoveRunIfSameAsPrevious(first);
+	result.changed = true;
+	result.position = static_cast<DISTANCE>(changedStart);
+	result.fillLength = static_cast<DISTANCE>(changedEnd - changedStart);
+	return result;
+}
+
 template <typename DISTANCE, typename STYLE>
 void RunStyles<DISTANCE, STYLE>::SetValueAt(DISTANCE position, STYLE value) {
 	FillRange(position, value, 1);
@@ -260,6 +366,26 @@ DISTANCE RunStyles<DISTANCE, STYLE>::Runs() const noexcept {
 	return starts.Partitions();
 }
 
+template <typename DISTANCE, typename STYLE>
+DISTANCE RunStyles<DISTANCE, STYLE>::RunContaining(DISTANCE position) const noexcept {
+	return starts.PartitionFromPosition(position);
+}
+
+template <typename DISTANCE, typename STYLE>
+DISTANCE RunStyles<DISTANCE, STYLE>::PositionFromRun(DISTANCE run) const noexcept {
+	return starts.PositionFromPartition(run);
+}
+
+template <typename DISTANCE, typename STYLE>
+STYLE RunStyles<DISTANCE, STYLE>::ValueOfRun(DISTANCE run) const noexcept {
+	return styles.ValueAt(run);
+}
+
+template <typename DISTANCE, typename STYLE>
+size_t RunStyles<DISTANCE, STYLE>::MemoryUsage() const noexcept {
+	return starts.MemoryUsage() + styles.MemoryUsage();
+}
+
 template <typename DISTANCE, typename STYLE>
 bool RunStyles<DISTANCE, STYLE>::AllSame() const noexcept {
 	for (DISTANCE run = 1; run < starts.Partitions(); run++) {
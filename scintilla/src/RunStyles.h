@@ -39,14 +39,21 @@ public:
 	DISTANCE EndRun(DISTANCE position) const noexcept;
 	// Returns changed=true if some values may have changed
 	FillResult<DISTANCE> FillRange(DISTANCE position, STYLE value, DISTANCE fillLength);
+	// Fill count pairs of start position and length sorted by position, returns union of changed range
+	FillResult<DISTANCE> FillRanges(const ptrdiff_t *ranges, size_t count, STYLE value);
 	void SetValueAt(DISTANCE position, STYLE value);
 	void InsertSpace(DISTANCE position, DISTANCE insertLength);
 	void DeleteAll();
 	void DeleteRange(DISTANCE position, DISTANCE deleteLength);
 	DISTANCE Runs() const noexcept;
+	// Access runs by index, so consecutive runs are visited with one position lookup
+	DISTANCE RunContaining(DISTANCE position) const noexcept;
+	DISTANCE PositionFromRun(DISTANCE run) const noexcept;
+	STYLE ValueOfRun(DISTANCE run) const noexcept;
 	bool AllSame() const noexcept;
 	bool AllSameAs(STYLE value) const noexcept;
 	DISTANCE Find(STYLE value, DISTANCE start) const noexcept;
+	size_t MemoryUsage() const noexcept;
 
 #ifdef CHECK_CORRECTNESS
 	void Check() const;
@@ -244,10 +244,10 @@ void ScintillaBase::MoveImeCarets(Sci::Position offset) noexcept {
 	}
 }
 
-void ScintillaBase::DrawImeIndicator(int indicator, Sci::Position len) {
+void ScintillaBase::DrawImeIndicator(int indicator, Sci::Position len, Sci::Position before) {
 	// Emulate the visual style of IME characters with indicators.
-	// Draw an indicator on the character before caret by the character bytes of len
-	// so it should be called after InsertCharacter().
+	// Draw an indicator on the character before caret by the character bytes of len,
+	// or on the run ending before bytes ahead of caret, so it should be called after InsertCharacter().
 	// It does not affect caret positions.
 	if (indicator < 8 || indicator > IndicatorMax) {
 		return;
@@ -255,7 +255,7 @@ void ScintillaBase::DrawImeIndicator(int indicator, Sci::Position len) {
 	pdoc->DecorationSetCurrentIndicator(indicator);
 	for (size_t r = 0; r < sel.Count(); r++) {
 		const Sci::Position positionInsert = sel.Range(r).Start().Position();
-		pdoc->DecorationFillRange(positionInsert - len, 1, len);
+		pdoc->DecorationFillRange(positionInsert - before - len, 1, len);
 	}
 }
 
@@ -690,6 +690,8 @@ LexState::LexState(Document *pdoc_) noexcept : LexInterface(pdoc_) {
 }
 
 void LexState::SetInstance(ILexer5 *instance_) {
+	DiscardBackground();
+	backgroundFailed = false;
 	instance.reset(instance_);
 	const int language = instance_ ? instance_->GetIdentifier() : SCLEX_CONTAINER;
 	lexerLanguage = language;
@@ -704,6 +706,8 @@ LexState *ScintillaBase::DocumentLexState() {
 }
 
 void LexState::SetLexer(int language) { //! removed in Scintilla 5
+	DiscardBackground();
+	backgroundFailed = false;
 	ILexer5 *instance_ = nullptr;
 	if (language != SCLEX_CONTAINER) {
 		const LexerModule *lex = LexerModule::Find(language);
@@ -724,6 +728,7 @@ const char *LexState::DescribeWordListSets() const noexcept {
 
 void LexState::SetWordList(int n, int attribute, const char *wl) {
 	if (instance) {
+		DiscardBackground();
 		const Sci_Position firstModification = instance->WordListSet(n, attribute, wl);
 		if (firstModification >= 0) {
 			pdoc->ModifiedAt(firstModification);
@@ -744,6 +749,7 @@ const char *LexState::GetName() const noexcept {
 
 void *LexState::PrivateCall(int operation, void *pointer) {
 	if (instance) {
+		DiscardBackground();
 		return instance->PrivateCall(operation, pointer);
 	}
 	return nullptr;
@@ -772,6 +778,7 @@ const char *LexState::DescribeProperty(const char *name) const {
 
 void LexState::PropSet(const char *key, const char *val) {
 	if (instance) {
+		DiscardBackground();
 		const Sci_Position firstModification = instance->PropertySet(key, val);
 		if (firstModification >= 0) {
 			pdoc->ModifiedAt(firstModification);
@@ -805,6 +812,7 @@ LineEndType LexState::LineEndTypesSupported() const noexcept {
 
 int LexState::AllocateSubStyles(int styleBase, int numberStyles) {
 	if (instance) {
+		DiscardBackground();
 		return instance->AllocateSubStyles(styleBase, numberStyles);
 	}
 	return -1;
@@ -840,12 +848,14 @@ int LexState::PrimaryStyleFromStyle(int style) const noexcept {
 
 void LexState::FreeSubStyles() noexcept {
 	if (instance) {
+		DiscardBackground();
 		instance->FreeSubStyles();
 	}
 }
 
 void LexState::SetIdentifiers(int style, const char *identifiers) {
 	if (instance) {
+		DiscardBackground();
 		instance->SetIdentifiers(style, identifiers);
 		pdoc->ModifiedAt(0);
 	}
@@ -1138,7 +1148,7 @@ sptr_t ScintillaBase::WndProc(Message iMessage, uptr_t wParam, sptr_t lParam) {
 		return DocumentLexState()->GetIdentifier();
 
 	case Message::Colourise:
-		pdoc->EnsureStyledTo((lParam < 0) ? pdoc->LengthNoExcept() : pdoc->LineStart(pdoc->SciLineFromPosition(lParam - 1) + 1));
+		pdoc->EnsureFoldedTo((lParam < 0) ? pdoc->LengthNoExcept() : pdoc->LineStart(pdoc->SciLineFromPosition(lParam - 1) + 1));
 #if 0
 		if (DocumentLexState()->UseContainerLexing()) {
 			pdoc->ModifiedAt(PositionFromUPtr(wParam));
@@ -68,7 +68,7 @@ protected:
 	int KeyCommand(Scintilla::Message iMessage) override;
 
 	void MoveImeCarets(Sci::Position offset) noexcept;
-	void DrawImeIndicator(int indicator, Sci::Position len);
+	void DrawImeIndicator(int indicator, Sci::Position len, Sci::Position before = 0);
 
 	void AutoCompleteInsert(Sci::Position startPos, Sci::Position removeLen, std::string_view text);
 	void AutoCompleteStart(Sci::Position lenEntered, const char *list);
@@ -0,0 +1,236 @@
+// Scintilla source code edit control
+/** @file SearchIndex.cxx
+ ** Trigram index to skip text blocks when searching literal in large document.
+ **/
+// This file is part of Notepad4.
+// See License.txt for details about distribution and modification.
+
+#include <cstddef>
+#include <cstdlib>
+#include <cstdint>
+#include <cassert>
+#include <cstring>
+
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <array>
+#include <algorithm>
+#include <atomic>
+#include <memory>
+
+#include "ParallelSupport.h"
+#include "ScintillaTypes.h"
+
+#include "Debugging.h"
+
+#include "Position.h"
+#include "SplitVector.h"
+#include "Partitioning.h"
+#include "RunStyles.h"
+#include "CellBuffer.h"
+#include "SearchIndex.h"
+
+using namespace Scintilla::Internal;
+
+namespace {
+
+constexpr uint32_t TrigramHash(uint8_t first, uint8_t second, uint8_t third) noexcept {
+	constexpr int shift = 32 - 13;
+	static_assert((1 << (32 - shift)) == SearchIndex::bitsPerBlock);
+	return ((first | (second << 8) | (third << 16)) * UINT32_C(0x9E3779B1)) >> shift;
+}
+
+void HashBlock(uint64_t *words, const char *text, Sci::Position length) noexcept {
+	for (Sci::Position i = 0; i + 2 < length; i++) {
+		const uint32_t hash = TrigramHash(text[i], text[i + 1], text[i + 2]);
+		words[hash >> 6] |= UINT64_C(1) << (hash & 63);
+	}
+}
+
+struct IndexWorker {
+	const CellBuffer &cb;
+	uint64_t *bits;
+	Sci::Position blockCount;
+	std::atomic<Sci::Position> nextBlock = 0;
+	std::atomic<bool> failed = false;
+
+	void DoWork() noexcept {
+		const Sci::Position length = cb.Length();
+		std::unique_ptr<char[]> buffer;
+		try {
+			buffer = std::make_unique<char[]>(SearchIndex::blockSize + 2);
+		} catch (...) {
+			failed = true;
+			return;
+		}
+		while (true) {
+			const Sci::Position block = nextBlock.fetch_add(1, std::memory_order_relaxed);
+			if (block >= blockCount) {
+				break;
+			}
+			// include two bytes after the block for trigrams start near the end
+			const Sci::Position start = block*SearchIndex::blockSize;
+			const Sci::Position count = std::min(SearchIndex::blockSize + 2, length - start);
+			cb.GetCharRange(buffer.get(), start, count);
+			HashBlock(bits + block*(SearchIndex::bitsPerBlock / 64), buffer.get(), count);
+		}
+	}
+
+#if USE_WIN32_PTP_WORK
+	static VOID CALLBACK WorkCallback([[maybe_unused]] PTP_CALLBACK_INSTANCE instance, PVOID context, [[maybe_unused]] PTP_WORK work) {
+		IndexWorker *worker = static_cast<IndexWorker *>(context);
+		worker->DoWork();
+	}
+#endif
+};
+
+uint32_t ProcessorCount() noexcept {
+#if _WIN32_WINNT >= _WIN32_WINNT_WIN7
+	return GetActiveProcessorCount(ALL_PROCESSOR_GROUPS);
+#else
+	SYSTEM_INFO info;
+	GetNativeSystemInfo(&info);
+	return info.dwNumberOfProcessors;
+#endif
+}
+
+}
+
+void SearchIndex::Build(const CellBuffer &cb) noexcept {
+	const Sci::Position length = cb.Length();
+	const Sci::Position blockCount = std::max<Sci::Position>(1, (length + blockSize - 1) / blockSize);
+	try {
+		bits.assign(blockCount*wordsPerBlock, 0);
+		Sci::Position *positions = starts.ResetPartitions(blockCount);
+		for (Sci::Position block = 1; block <= blockCount; block++) {
+			*positions++ = std::min(block*blockSize, length);
+		}
+	} catch (...) {
+		Clear();
+		return;
+	}
+
+	IndexWorker worker{cb, bits.data(), blockCount};
+	const uint32_t threadCount = static_cast<uint32_t>(std::min<Sci::Position>(blockCount / 4, ProcessorCount()));
+	if (threadCount > 1) {
+#if USE_WIN32_PTP_WORK
+		PTP_WORK work = CreateThreadpoolWork(IndexWorker::WorkCallback, &worker, nullptr);
+		if (work) {
+			for (uint32_t i = 0; i < threadCount; i++) {
+				SubmitThreadpoolWork(work);
+			}
+			WaitForThreadpoolWorkCallbacks(work, FALSE);
+			CloseThreadpoolWork(work);
+		}
+#endif // USE_WIN32_PTP_WORK
+	}
+	// index remaining blocks when thread pool is not available
+	worker.DoWork();
+	if (worker.failed) {
+		Clear();
+	}
+}
+
+void SearchIndex::Clear() noexcept {
+	std::vector<uint64_t>().swap(bits);
+}
+
+void SearchIndex::AddTrigrams(const CellBuffer &cb, Sci::Position start, Sci::Position end) noexcept {
+	start = std::max<Sci::Position>(start, 0);
+	end = std::min(end, cb.Length() - 2);
+	for (Sci::Position pos = start; pos < end; pos++) {
+		const Sci::Position block = starts.PartitionFromPosition(pos);
+		const uint32_t hash = TrigramHash(cb.CharAt(pos), cb.CharAt(pos + 1), cb.CharAt(pos + 2));
+		bits[block*wordsPerBlock + (hash >> 6)] |= UINT64_C(1) << (hash & 63);
+	}
+}
+
+void SearchIndex::InsertText(const CellBuffer &cb, Sci::Position position, Sci::Position insertLength) noexcept {
+	if (!Built()) {
+		return;
+	}
+	const Sci::Position block = starts.PartitionFromPosition(position);
+	const Sci::Position blockLength = starts.PositionFromPartition(block + 1) - starts.PositionFromPartition(block);
+	if (blockLength + insertLength > maxBlockLength) {
+		// bitmap for long block is useless, rebuild whole index on next search
+		Clear();
+		return;
+	}
+	starts.InsertText(block, insertLength);
+	// trigrams that contain inserted text
+	AddTrigrams(cb, position - 2, position + insertLength);
+}
+
+void SearchIndex::DeleteText(const CellBuffer &cb, Sci::Position position, Sci::Position deleteLength) noexcept {
+	if (!Built()) {
+		return;
+	}
+	// blocks inside deleted range become empty, text before and after it is kept in the first and last block.
+	const Sci::Position first = starts.PartitionFromPosition(position);
+	const Sci::Position last = starts.PartitionFromPosition(position + deleteLength);
+	for (Sci::Position block = first + 1; block <= last; block++) {
+		starts.SetPartitionStartPosition(block, position + deleteLength);
+		if (block != last) {
+			std::fill_n(bits.begin() + block*wordsPerBlock, wordsPerBlock, 0);
+		}
+	}
+	starts.InsertText(first, -deleteLength);
+	// trigrams across the joint
+	AddTrigrams(cb, position - 2, position);
+}
+
+bool SearchIndex::MayContain(Sci::Position block, const uint32_t *hashes, int count, Sci::Position length) const noexcept {
+	// trigrams of text starts in the block may span following blocks
+	const Sci::Position end = starts.PositionFromPartition(block + 1) + length - 4;
+	const Sci::Position lastBlock = starts.PartitionFromPosition(end);
+	for (int i = 0; i < count; i++) {
+		const uint32_t hash = hashes[i];
+		const uint64_t mask = UINT64_C(1) << (hash & 63);
+		Sci::Position index = block;
+		while (index <= lastBlock && (bits[index*wordsPerBlock + (hash >> 6)] & mask) == 0) {
+			++index;
+		}
+		if (index > lastBlock) {
+			return false;
+		}
+	}
+	return true;
+}
+
+bool SearchIndex::NextCandidate(Sci::Position &pos, Sci::Position &last, const char *text, Sci::Position length) const noexcept {
+	uint32_t hashes[maxTrigrams];
+	int count = 0;
+	for (Sci::Position i = 0; i + 2 < length && count < maxTrigrams; i++) {
+		const uint32_t hash = TrigramHash(text[i], text[i + 1], text[i + 2]);
+		if (std::find(hashes, hashes + count, hash) == hashes + count) {
+			hashes[count++] = hash;
+		}
+	}
+
+	const Sci::Position blockCount = starts.Partitions();
+	Sci::Position block = starts.PartitionFromPosition(pos);
+	while (block < blockCount) {
+		const Sci::Position blockStart = starts.PositionFromPartition(block);
+		if (blockStart > last) {
+			break;
+		}
+		Sci::Position blockEnd = starts.PositionFromPartition(block + 1);
+		if (blockEnd > blockStart && MayContain(block, hashes, count, length)) {
+			pos = std::max(pos, blockStart);
+			// merge following candidate blocks, empty block is skipped
+			while (blockEnd <= last && ++block < blockCount) {
+				const Sci::Position nextEnd = starts.PositionFromPartition(block + 1);
+				if (nextEnd > blockEnd && !MayContain(block, hashes, count, length)) {
+					break;
+				}
+				blockEnd = nextEnd;
+			}
+			last = std::min(last, blockEnd - 1);
+			return true;
+		}
+		++block;
+	}
+	return false;
+}
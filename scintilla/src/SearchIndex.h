@@ -0,0 +1,46 @@
+// Scintilla source code edit control
+/** @file SearchIndex.h
+ ** Trigram index to skip text blocks when searching literal in large document.
+ **/
+// This file is part of Notepad4.
+// See License.txt for details about distribution and modification.
+#pragma once
+
+namespace Scintilla::Internal {
+
+/**
+ * Document is split into blocks, each block has a bitmap of hashed trigrams that start inside it.
+ * A literal can only start in a block when all its trigrams are found in the block or following
+ * blocks it may span. On modification, entries for changed text are added and block bounds are
+ * moved, so each bitmap is a superset of the text; blocks are rebuilt only after large insertion.
+ */
+class SearchIndex {
+public:
+	static constexpr Sci::Position blockSize = 32*1024;
+	static constexpr Sci::Position maxBlockLength = 4*blockSize;
+	static constexpr int bitsPerBlock = 8192;
+	static constexpr int maxTrigrams = 16;
+
+	bool Built() const noexcept {
+		return !bits.empty();
+	}
+	size_t MemoryUsage() const noexcept {
+		return bits.capacity()*sizeof(uint64_t) + starts.MemoryUsage();
+	}
+	void Build(const CellBuffer &cb) noexcept;
+	void Clear() noexcept;
+	void InsertText(const CellBuffer &cb, Sci::Position position, Sci::Position insertLength) noexcept;
+	void DeleteText(const CellBuffer &cb, Sci::Position position, Sci::Position deleteLength) noexcept;
+	// restrict [pos, last] to first run of blocks which may contain start of text.
+	bool NextCandidate(Sci::Position &pos, Sci::Position &last, const char *text, Sci::Position length) const noexcept;
+
+private:
+	static constexpr int wordsPerBlock = bitsPerBlock / 64;
+	Partitioning<Sci::Position> starts;
+	std::vector<uint64_t> bits;
+
+	void AddTrigrams(const CellBuffer &cb, Sci::Position start, Sci::Position end) noexcept;
+	bool MayContain(Sci::Position block, const uint32_t *hashes, int count, Sci::Position length) const noexcept;
+};
+
+}
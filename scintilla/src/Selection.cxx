@@ -458,6 +458,7 @@ void Selection::SetMain(size_t r) noexcept {
 }
 
 SelectionRange &Selection::Range(size_t r) noexcept {
+	RangesChanged();
 	return ranges[r];
 }
 
@@ -466,6 +467,7 @@ const SelectionRange &Selection::Range(size_t r) const noexcept {
 }
 
 SelectionRange &Selection::RangeMain() noexcept {
+	RangesChanged();
 	return ranges[mainRange];
 }
 
@@ -516,8 +518,23 @@ Sci::Position Selection::Length() const noexcept {
 }
 
 void Selection::MovePositions(bool insertion, Sci::Position startChange, Sci::Position length) noexcept {
-	for (auto &range : ranges) {
-		range.MoveForInsertDelete(insertion, startChange, length);
+	RangesChanged();
+	if (batchEdit) {
+		// ranges after current range are shifted by BatchEditRange(),
+		// previous ranges are not affected unless the change starts before them.
+		batchModified = true;
+		batchDelta += insertion ? length : -length;
+		size_t r = batchCurrent;
+		if (r != 0 && startChange < ranges[r - 1].End().Position()) {
+			r = 0;
+		}
+		for (; r <= batchCurrent; r++) {
+			ranges[r].MoveForInsertDelete(insertion, startChange, length);
+		}
+	} else {
+		for (auto &range : ranges) {
+			range.MoveForInsertDelete(insertion, startChange, length);
+		}
 	}
 	if (selType == SelTypes::rectangle) {
 		rangeRectangular.MoveForInsertDelete(insertion, startChange, length);
@@ -525,6 +542,7 @@ void Selection::MovePositions(bool insertion, Sci::Position startChange, Sci::Po
 }
 
 void Selection::TrimSelection(SelectionRange range) noexcept {
+	RangesChanged();
 	for (size_t i = 0; i < ranges.size();) {
 		if ((i != mainRange) && (ranges[i].Trim(range))) {
 			// Trimmed to empty so remove
@@ -541,6 +559,7 @@ void Selection::TrimSelection(SelectionRange range) noexcept {
 }
 
 void Selection::TrimOtherSelections(size_t r, SelectionRange range) noexcept {
+	RangesChanged();
 	for (size_t i = 0; i < ranges.size(); ++i) {
 		if (i != r) {
 			ranges[i].Trim(range);
@@ -554,15 +573,24 @@ void Selection::SetSelection(SelectionRange range) noexcept {
 	}
 	ranges[0] = range;
 	mainRange = 0;
+	RangesChanged();
+	lastEnd = range.End();
 }
 
 void Selection::AddSelection(SelectionRange range) {
-	TrimSelection(range);
+	// nothing to trim when ranges are added in document order, e.g. selecting all occurrences.
+	const bool ordered = lastEnd.Position() >= 0 && lastEnd < range.Start();
+	if (!ordered) {
+		TrimSelection(range);
+	}
 	ranges.push_back(range);
 	mainRange = ranges.size() - 1;
+	spans.clear();
+	lastEnd = ordered ? range.End() : Last();
 }
 
 void Selection::AddSelectionWithoutTrim(SelectionRange range) {
+	RangesChanged();
 	ranges.push_back(range);
 	mainRange = ranges.size() - 1;
 }
@@ -579,6 +607,7 @@ void Selection::DropSelection(size_t r) noexcept {
 		}
 		ranges.erase(ranges.begin() + r);
 		mainRange = mainNew;
+		RangesChanged();
 	}
 }
 
@@ -591,6 +620,7 @@ void Selection::TentativeSelection(SelectionRange range) {
 		rangesSaved = ranges;
 	}
 	ranges = rangesSaved;
+	RangesChanged();
 	AddSelection(range);
 	TrimSelection(ranges[mainRange]);
 	tentativeMain = true;
@@ -606,11 +636,49 @@ InSelection Selection::RangeType(size_t r) const noexcept {
 }
 
 InSelection Selection::CharacterInSelection(Sci::Position posCharacter) const noexcept {
-	for (size_t i = 0; i < ranges.size(); i++) {
-		if (ranges[i].ContainsCharacter(posCharacter))
-			return RangeType(i);
+	if (ranges.size() < minIndexedCount) {
+		for (size_t i = 0; i < ranges.size(); i++) {
+			if (ranges[i].ContainsCharacter(posCharacter))
+				return RangeType(i);
+		}
+		return InSelection::inNone;
 	}
-	return InSelection::inNone;
+
+	if (spans.empty()) {
+		try {
+			spans.reserve(ranges.size());
+			for (size_t i = 0; i < ranges.size(); i++) {
+				spans.push_back({ ranges[i].Start().Position(), ranges[i].End().Position(), 0, i });
+			}
+		} catch (...) {
+			spans.clear();
+			return ranges[mainRange].ContainsCharacter(posCharacter) ? InSelection::inMain : InSelection::inNone;
+		}
+		std::sort(spans.begin(), spans.end(), [](const SelectionSpan &a, const SelectionSpan &b) noexcept {
+			return a.start < b.start || (a.start == b.start && a.index < b.index);
+		});
+		Sci::Position maxEnd = 0;
+		for (SelectionSpan &span : spans) {
+			maxEnd = std::max(maxEnd, span.end);
+			span.maxEnd = maxEnd;
+		}
+	}
+
+	// last span starts at or before posCharacter, walk back over spans that may still contain it.
+	auto it = std::upper_bound(spans.begin(), spans.end(), posCharacter, [](Sci::Position pos, const SelectionSpan &span) noexcept {
+		return pos < span.start;
+	});
+	size_t found = ranges.size();
+	while (it != spans.begin()) {
+		--it;
+		if (it->maxEnd <= posCharacter) {
+			break;
+		}
+		if (posCharacter < it->end) {
+			found = std::min(found, it->index);
+		}
+	}
+	return (found < ranges.size()) ? RangeType(found) : InSelection::inNone;
 }
 
 InSelection Selection::InSelectionForEOL(Sci::Position pos) const noexcept {
@@ -633,6 +701,7 @@ Sci::Position Selection::VirtualSpaceFor(Sci::Position pos) const noexcept {
 }
 
 void Selection::Clear() noexcept {
+	RangesChanged();
 	if (ranges.size() > 1) {
 		ranges.erase(ranges.begin() + 1, ranges.end());
 	}
@@ -653,19 +722,60 @@ void Selection::Reset() noexcept {
 }
 
 void Selection::RemoveDuplicates() noexcept {
-	for (size_t i = 0; i < ranges.size() - 1; i++) {
-		if (ranges[i].Empty()) {
-			size_t j = i + 1;
-			while (j < ranges.size()) {
-				if (ranges[i] == ranges[j]) {
-					ranges.erase(ranges.begin() + j);
-					if (mainRange >= j)
-						mainRange--;
-				} else {
-					j++;
+	RangesChanged();
+	if (ranges.size() < minIndexedCount) {
+		for (size_t i = 0; i < ranges.size() - 1; i++) {
+			if (ranges[i].Empty()) {
+				size_t j = i + 1;
+				while (j < ranges.size()) {
+					if (ranges[i] == ranges[j]) {
+						ranges.erase(ranges.begin() + j);
+						if (mainRange >= j)
+							mainRange--;
+					} else {
+						j++;
+					}
+				}
+			}
+		}
+	} else {
+		// sort empty ranges to find duplicates, then keep the first one in index order.
+		std::vector<size_t> empty;
+		try {
+			for (size_t i = 0; i < ranges.size(); i++) {
+				if (ranges[i].Empty()) {
+					empty.push_back(i);
+				}
+			}
+		} catch (...) {
+			Reset();
+			return;
+		}
+		std::sort(empty.begin(), empty.end(), [this](size_t a, size_t b) noexcept {
+			return ranges[a] < ranges[b] || (ranges[a] == ranges[b] && a < b);
+		});
+		size_t first = 0;
+		for (size_t k = 1; k < empty.size(); k++) {
+			if (ranges[empty[k]] == ranges[empty[first]]) {
+				// mark duplicate for removal, the first one has smallest index.
+				ranges[empty[k]].caret = SelectionPosition(Sci::invalidPosition);
+			} else {
+				first = k;
+			}
+		}
+		size_t mainNew = mainRange;
+		size_t j = 0;
+		for (size_t i = 0; i < ranges.size(); i++) {
+			if (ranges[i].caret.Position() == Sci::invalidPosition) {
+				if (i <= mainRange) {
+					mainNew--;
 				}
+			} else {
+				ranges[j++] = ranges[i];
 			}
 		}
+		ranges.resize(j);
+		mainRange = mainNew;
 	}
 	Reset();
 }
@@ -675,20 +785,73 @@ void Selection::RotateMain() noexcept {
 }
 
 std::vector<SelectionRange *> Selection::SortedRanges() {
+	RangesChanged();
 	std::vector<SelectionRange *> selPtrs;
+	selPtrs.reserve(ranges.size());
 	for (SelectionRange &range : ranges) {
 		selPtrs.push_back(&range);
 	}
 	if (selPtrs.size() > 1) {
-		std::sort(selPtrs.begin(), selPtrs.end(), [](const SelectionRange *a, const SelectionRange *b) noexcept {
+		const auto less = [](const SelectionRange *a, const SelectionRange *b) noexcept {
 			return *a < *b;
-		});
+		};
+		// ranges of rectangular selection are already in line order, either downward or upward
+		if (std::is_sorted(selPtrs.rbegin(), selPtrs.rend(), less)) {
+			std::reverse(selPtrs.begin(), selPtrs.end());
+		} else if (!std::is_sorted(selPtrs.begin(), selPtrs.end(), less)) {
+			std::sort(selPtrs.begin(), selPtrs.end(), less);
+		}
 	}
 	return selPtrs;
 }
 
 void Selection::SetRanges(const Ranges &rangesToSet) {
 	ranges = rangesToSet;
+	RangesChanged();
+}
+
+void Selection::ShiftRange(size_t r, Sci::Position delta) noexcept {
+	ranges[r].caret.Add(delta);
+	ranges[r].anchor.Add(delta);
+}
+
+bool Selection::BeginBatchEdit() noexcept {
+	if (ranges.size() < minIndexedCount) {
+		return false;
+	}
+	for (size_t r = 1; r < ranges.size(); r++) {
+		if (ranges[r - 1].End().Position() >= ranges[r].Start().Position()) {
+			return false;
+		}
+	}
+	batchEdit = true;
+	batchModified = false;
+	batchCurrent = 0;
+	batchDelta = 0;
+	return true;
+}
+
+SelectionRange &Selection::BatchEditRange(size_t r) noexcept {
+	RangesChanged();
+	// apply length change of edits on previous ranges
+	for (size_t i = batchCurrent + 1; i <= r; i++) {
+		ShiftRange(i, batchDelta);
+	}
+	if (r >= batchCurrent + 1) {
+		batchCurrent = r;
+	}
+	return ranges[r];
+}
+
+void Selection::EndBatchEdit() noexcept {
+	RangesChanged();
+	for (size_t r = batchCurrent + 1; r < ranges.size(); r++) {
+		ShiftRange(r, batchDelta);
+	}
+	batchEdit = false;
+	batchModified = false;
+	batchCurrent = 0;
+	batchDelta = 0;
 }
 
 void Selection::Truncate(Sci::Position length) noexcept {
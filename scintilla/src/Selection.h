@@ -172,7 +172,29 @@ class Selection {
 	size_t mainRange;
 	bool moveExtends;
 	bool tentativeMain;
+	// state for editing many ranges in document order, see BeginBatchEdit()
+	bool batchEdit = false;
+	bool batchModified = false;
+	size_t batchCurrent = 0;
+	Sci::Position batchDelta = 0;
+	// maximum end of all ranges for AddSelection(), invalid when position is negative
+	SelectionPosition lastEnd;
+	// ranges sorted by start position, lazily built for CharacterInSelection() with many ranges
+	struct SelectionSpan {
+		Sci::Position start;
+		Sci::Position end;
+		Sci::Position maxEnd;	// maximum end of this and all previous spans
+		size_t index;
+	};
+	mutable std::vector<SelectionSpan> spans;
+	void RangesChanged() noexcept {
+		lastEnd = {};
+		spans.clear();
+	}
+	void ShiftRange(size_t r, Sci::Position delta) noexcept;
 public:
+	// minimum number of ranges for BeginBatchEdit() and indexed CharacterInSelection()
+	static constexpr size_t minIndexedCount = 64;
 	enum class SelTypes {
 		none, stream, rectangle, lines, thin
 	};
@@ -231,6 +253,14 @@ public:
 	}
 #endif
 	void SetRanges(const Ranges &rangesToSet);
+	// Edit ranges in index order without moving all ranges on each modification,
+	// only available when ranges are in document order without touching each other.
+	bool BeginBatchEdit() noexcept;
+	SelectionRange &BatchEditRange(size_t r) noexcept;
+	void EndBatchEdit() noexcept;
+	bool BatchEditModified() const noexcept {
+		return batchModified;
+	}
 	void Truncate(Sci::Position length) noexcept;
 	std::string ToString() const;
 };
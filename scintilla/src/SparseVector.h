@@ -37,6 +37,10 @@ public:
 		return starts.Partitions();
 	}
 
+	size_t MemoryUsage() const noexcept {
+		return starts.MemoryUsage() + values.MemoryUsage();
+	}
+
 	Sci::Position PositionOfElement(Sci::Position element) const noexcept {
 		return starts.PositionFromPartition(element);
 	}
@@ -55,10 +55,17 @@ public:
 #endif
 };
 
-template <typename T>
+/// Whether the storage can be resized to newSize without copying elements into a new buffer,
+/// SplitVector then only moves elements after the gap.
+template <typename T, typename A>
+constexpr bool CanGrowInPlace(const std::vector<T, A> &body, size_t newSize) noexcept {
+	return newSize <= body.capacity();
+}
+
+template <typename T, typename Storage = std::vector<T, default_init_allocator<T>>>
 class SplitVector {
 	// std::vector<T> body;
-	std::vector<T, default_init_allocator<T>> body;
+	Storage body;
 	ptrdiff_t lengthBody = 0;
 	ptrdiff_t part1Length = 0;
 	ptrdiff_t gapLength = 0;	/// invariant: gapLength == body.size() - lengthBody
@@ -125,6 +132,15 @@ public:
 	size_t capacity() const noexcept {
 		return body.capacity();
 	}
+	/// Bytes allocated for the buffer, including the gap.
+	size_t MemoryUsage() const noexcept {
+		return body.capacity() * sizeof(T);
+	}
+
+	/// Storage for the buffer, used to configure how it's allocated.
+	Storage &BodyStorage() noexcept {
+		return body;
+	}
 
 	size_t GetGrowSize() const noexcept {
 		return growSize;
@@ -147,14 +163,38 @@ public:
 			printf("before %s(%td, %zu) part1Length=%td, gapLength=%td, lengthBody=%td, growSize=%zu\n",
 				__func__, newSize, size, part1Length, gapLength, lengthBody, growSize);
 #endif
-			// Move the gap to the end
-			GapTo(lengthBody);
-			gapLength += newSize - size - sentinel;
-			// RoomFor implements a growth strategy but so does vector::resize so
-			// ensure vector::resize allocates exactly the amount wanted by
-			// calling reserve first.
-			body.reserve(newSize);
-			body.resize(newSize);
+			const ptrdiff_t newGapLength = gapLength + newSize - size - sentinel;
+			if (gapLength != 0 && part1Length != lengthBody && CanGrowInPlace(body, newSize)) {
+				// extend the buffer and move elements after the gap to the end.
+				body.resize(newSize);
+				T * const data = body.data();
+				std::move_backward(
+					data + part1Length + gapLength,
+					data + gapLength + lengthBody,
+					data + newGapLength + lengthBody);
+				gapLength = newGapLength;
+			} else if (gapLength != 0 && part1Length != lengthBody) {
+				// copy both parts into new buffer and keep the gap in place, avoids moving
+				// the gap to the end and then back to the editing position, each would
+				// move elements after the gap.
+				decltype(body) newBody;
+				newBody.reserve(newSize);
+				newBody.resize(newSize);
+				T * const data = body.data();
+				std::move(data, data + part1Length, newBody.data());
+				std::move(data + part1Length + gapLength, data + gapLength + lengthBody, newBody.data() + part1Length + newGapLength);
+				body.swap(newBody);
+				gapLength = newGapLength;
+			} else {
+				// Move the gap to the end
+				GapTo(lengthBody);
+				gapLength = newGapLength;
+				// RoomFor implements a growth strategy but so does vector::resize so
+				// ensure vector::resize allocates exactly the amount wanted by
+				// calling reserve first.
+				body.reserve(newSize);
+				body.resize(newSize);
+			}
 #if ENABLE_SHOW_DEBUG_INFO
 			printf("after %s(%td, %zu) part1Length=%td, gapLength=%td, lengthBody=%td, growSize=%zu\n",
 				__func__, newSize, size, part1Length, gapLength, lengthBody, growSize);
@@ -427,6 +467,20 @@ public:
 		return data;
 	}
 
+	/// Return a pointer to a range of elements without rearranging the buffer,
+	/// or nullptr when the range overlaps gap.
+	const T *ContiguousRangePointer(ptrdiff_t position, ptrdiff_t rangeLength) const noexcept {
+		const T *data = body.data() + position;
+		if (position < part1Length) {
+			if ((position + rangeLength) > part1Length) {
+				return nullptr;
+			}
+		} else {
+			data += gapLength;
+		}
+		return data;
+	}
+
 	T *ElementPointer(ptrdiff_t position) noexcept {
 		T *data = body.data() + position;
 		if (position >= part1Length) {
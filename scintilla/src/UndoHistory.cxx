@@ -201,6 +201,10 @@ void ScaledVector::PushBack() {
 	bytes.resize(bytes.size() + element.size);
 }
 
+size_t ScaledVector::MemoryUsage() const noexcept {
+	return bytes.capacity();
+}
+
 size_t ScaledVector::SizeInBytes() const noexcept {
 	return bytes.size();
 }
@@ -230,9 +234,14 @@ intptr_t UndoActions::SSize() const noexcept {
 	return types.size();
 }
 
+size_t UndoActions::MemoryUsage() const noexcept {
+	return types.capacity() * sizeof(UndoActionType) + positions.MemoryUsage() + lengths.MemoryUsage();
+}
+
 void UndoActions::Create(size_t index, ActionType at_, Sci::Position position_, Sci::Position lenData_, bool mayCoalesce_) {
 	types[index].at = at_;
 	types[index].mayCoalesce = mayCoalesce_;
+	types[index].transform = false;
 	positions.SetValueAt(index, position_);
 	lengths.SetValueAt(index, lenData_);
 }
@@ -260,18 +269,85 @@ Sci::Position UndoActions::Length(int action) const noexcept {
 	return lengths.SignedValueAt(action);
 }
 
+namespace {
+
+bool SeekScrapFile(FILE *fp, size_t offset) noexcept {
+#if defined(_WIN32)
+	return _fseeki64(fp, offset, SEEK_SET) == 0;
+#else
+	return fseeko(fp, offset, SEEK_SET) == 0;
+#endif
+}
+
+}
+
+ScrapStack::~ScrapStack() noexcept {
+	if (file) {
+		fclose(file);
+	}
+}
+
 void ScrapStack::Clear() noexcept {
 	stack.clear();
 	current = 0;
+	base = 0;
+	total = 0;
+	fileLength = 0;
+}
+
+bool ScrapStack::Write(size_t end) noexcept {
+	// write text in window up to end into file
+	if (end <= fileLength) {
+		return true;
+	}
+	if (file == nullptr) {
+		file = tmpfile();
+		if (file == nullptr) {
+			return false;
+		}
+	}
+	const size_t length = end - fileLength;
+	if (SeekScrapFile(file, fileLength) && fwrite(stack.data() + (fileLength - base), 1, length, file) == length) {
+		fileLength = end;
+		return true;
+	}
+	return false;
+}
+
+void ScrapStack::Spill(size_t keep) noexcept {
+	if (keep >= stack.length()) {
+		return;
+	}
+	const size_t newBase = base + stack.length() - keep;
+	if (Write(newBase)) {
+		stack.erase(0, newBase - base);
+		base = newBase;
+	}
 }
 
 const char *ScrapStack::Push(const char *text, size_t length) {
-	if (current < stack.length()) {
-		stack.resize(current);
+	if (current < total) {
+		total = current;
+		fileLength = std::min(fileLength, current);
+	}
+	if (current < base || current > base + stack.length()) {
+		// window not contains current, text before current is in file
+		stack.clear();
+		base = current;
+	} else {
+		stack.resize(current - base);
 	}
 	stack.append(text, length);
-	current = stack.length();
-	return stack.data() + current - length;
+	total += length;
+	current = total;
+	if (memoryBudget != 0 && stack.length() > memoryBudget) {
+		// keep latest text in memory as its pointer is returned
+		Spill(std::max(memoryBudget / 2, length));
+		if (stack.capacity() > 2*memoryBudget + length) {
+			stack.shrink_to_fit();
+		}
+	}
+	return stack.data() + (current - base) - length;
 }
 
 void ScrapStack::SetCurrent(size_t position) noexcept {
@@ -279,7 +355,7 @@ void ScrapStack::SetCurrent(size_t position) noexcept {
 }
 
 void ScrapStack::MoveForward(size_t length) noexcept {
-	if ((current + length) <= stack.length()) {
+	if ((current + length) <= total) {
 		current += length;
 	}
 }
@@ -290,12 +366,50 @@ void ScrapStack::MoveBack(size_t length) noexcept {
 	}
 }
 
-const char *ScrapStack::CurrentText() const noexcept {
-	return stack.data() + current;
+const char *ScrapStack::CurrentText(size_t length) noexcept {
+	return TextAt(current, length);
+}
+
+const char *ScrapStack::PreviousText(size_t length) noexcept {
+	return TextAt(current - length, length);
+}
+
+const char *ScrapStack::TextAt(size_t position, size_t length) noexcept {
+	if (position >= base && position + length <= base + stack.length()) {
+		return stack.data() + (position - base);
+	}
+	// move window to cover the range, all text is in file after writing current window.
+	// current window is kept when paging fails, nullptr makes the undo or redo step fail.
+	if (!Write(base + stack.length())) {
+		return nullptr;
+	}
+	const size_t window = std::max(memoryBudget / 2, length);
+	size_t newBase = position;
+	if (position < base) {
+		// undo goes backward, keep more text before position
+		newBase = (position + length > window) ? position + length - window : 0;
+	}
+	const size_t end = std::min(newBase + window, total);
+	std::string text(end - newBase, '\0');
+	if (!(file && SeekScrapFile(file, newBase) && fread(text.data(), 1, text.length(), file) == text.length())) {
+		return nullptr;
+	}
+	stack.swap(text);
+	base = newBase;
+	return stack.data() + (position - base);
+}
+
+void ScrapStack::SetMemoryBudget(size_t budget) noexcept {
+	// applied on next push
+	memoryBudget = budget;
 }
 
-const char *ScrapStack::TextAt(size_t position) const noexcept {
-	return stack.data() + position;
+void ScrapStack::Release() noexcept {
+	// write all text into file, it's read back on undo or redo
+	Spill(0);
+	if (stack.empty()) {
+		std::string().swap(stack);
+	}
 }
 
 // The undo history stores a sequence of user operations that represent the user's view of the
@@ -585,8 +699,11 @@ std::string_view UndoHistory::Text(int action) noexcept {
 		position += actions.Length(act);
 	}
 	const size_t length = actions.Length(action);
-	const char *scrap = scraps->TextAt(position);
+	const char *scrap = scraps->TextAt(position, length);
 	memory = {action, position};
+	if (scrap == nullptr) {
+		return {};
+	}
 	return {scrap, length};
 }
 
@@ -602,6 +719,29 @@ void UndoHistory::ChangeLastUndoActionText(size_t length, const char *text) {
 	scraps->Push(text, length);
 }
 
+void UndoHistory::SetTransform(int action) noexcept {
+	// mark actions from action to current
+	for (; action < currentAction; action++) {
+		actions.types[action].transform = true;
+	}
+}
+
+void UndoHistory::SetMemoryBudget(size_t budget) noexcept {
+	scraps->SetMemoryBudget(budget);
+}
+
+size_t UndoHistory::MemoryBudget() const noexcept {
+	return scraps->MemoryBudget();
+}
+
+void UndoHistory::ReleaseMemory() noexcept {
+	scraps->Release();
+}
+
+size_t UndoHistory::MemoryUsage() const noexcept {
+	return actions.MemoryUsage() + scraps->MemoryUsage();
+}
+
 void UndoHistory::SetTentative(int action) noexcept {
 	tentativePoint = action;
 }
@@ -657,10 +797,11 @@ Action UndoHistory::GetUndoStep() const noexcept {
 		actions.types[previousAction].mayCoalesce,
 		actions.Position(previousAction),
 		nullptr,
-		actions.Length(previousAction)
+		actions.Length(previousAction),
+		actions.types[previousAction].transform
 	};
 	if (acta.lenData) {
-		acta.data = scraps->CurrentText() - acta.lenData;
+		acta.data = scraps->PreviousText(acta.lenData);
 	}
 	return acta;
 }
@@ -700,10 +841,11 @@ Action UndoHistory::GetRedoStep() const noexcept {
 		actions.types[currentAction].mayCoalesce,
 		actions.Position(currentAction),
 		nullptr,
-		actions.Length(currentAction)
+		actions.Length(currentAction),
+		actions.types[currentAction].transform
 	};
 	if (acta.lenData) {
-		acta.data = scraps->CurrentText();
+		acta.data = scraps->CurrentText(acta.lenData);
 	}
 	return acta;
 }
@@ -34,6 +34,8 @@ public:
 	void ReSize(size_t length);
 	void PushBack();
 
+	[[nodiscard]] size_t MemoryUsage() const noexcept;
+
 	// For testing
 	[[nodiscard]] size_t SizeInBytes() const noexcept;
 };
@@ -42,6 +44,8 @@ class UndoActionType {
 public:
 	ActionType at = ActionType::insert;
 	bool mayCoalesce = false;
+	// part of a block replacement that keeps number of lines, undo and redo keep per line data.
+	bool transform = false;
 };
 
 struct UndoActions {
@@ -59,19 +63,48 @@ struct UndoActions {
 	[[nodiscard]] size_t LengthTo(size_t index) const noexcept;
 	[[nodiscard]] Sci::Position Position(int action) const noexcept;
 	[[nodiscard]] Sci::Position Length(int action) const noexcept;
+	[[nodiscard]] size_t MemoryUsage() const noexcept;
 };
 
+// When memory budget is set, older text is written into a temporary file,
+// stack only holds a window of text starting at base, and is paged back on access.
+// Text before fileLength is always in the file, text after the window is in the file
+// when window is not at the end.
 class ScrapStack {
 	std::string stack;
 	size_t current = 0;
+	size_t base = 0;
+	size_t total = 0;
+	size_t memoryBudget = 0;
+	size_t fileLength = 0;
+	FILE *file = nullptr;
+	bool Write(size_t end) noexcept;
+	void Spill(size_t keep) noexcept;
 public:
+	ScrapStack() noexcept = default;
+	// Deleted so ScrapStack objects can not be copied.
+	ScrapStack(const ScrapStack &) = delete;
+	ScrapStack(ScrapStack &&) = delete;
+	ScrapStack &operator=(const ScrapStack &) = delete;
+	ScrapStack &operator=(ScrapStack &&) = delete;
+	~ScrapStack() noexcept;
 	void Clear() noexcept;
 	const char *Push(const char *text, size_t length);
 	void SetCurrent(size_t position) noexcept;
 	void MoveForward(size_t length) noexcept;
 	void MoveBack(size_t length) noexcept;
-	[[nodiscard]] const char *CurrentText() const noexcept;
-	[[nodiscard]] const char *TextAt(size_t position) const noexcept;
+	[[nodiscard]] const char *CurrentText(size_t length) noexcept;
+	[[nodiscard]] const char *PreviousText(size_t length) noexcept;
+	[[nodiscard]] const char *TextAt(size_t position, size_t length) noexcept;
+	void SetMemoryBudget(size_t budget) noexcept;
+	[[nodiscard]] size_t MemoryBudget() const noexcept {
+		return memoryBudget;
+	}
+	void Release() noexcept;
+	// text spilled into temporary file is not counted
+	[[nodiscard]] size_t MemoryUsage() const noexcept {
+		return stack.capacity();
+	}
 };
 
 constexpr int coalesceFlag = 0x100;
@@ -134,6 +167,14 @@ public:
 	[[nodiscard]] std::string_view Text(int action) noexcept;
 	void PushUndoActionType(int type, Sci::Position position);
 	void ChangeLastUndoActionText(size_t length, const char *text);
+	void SetTransform(int action) noexcept;
+
+	/// Maximum bytes of undo text kept in memory, older text is written into temporary file, 0 for no limit.
+	void SetMemoryBudget(size_t budget) noexcept;
+	[[nodiscard]] size_t MemoryBudget() const noexcept;
+	[[nodiscard]] size_t MemoryUsage() const noexcept;
+	/// Move undo text held in memory into temporary file.
+	void ReleaseMemory() noexcept;
 
 	// Tentative actions are used for input composition so that it can be undone cleanly
 	void SetTentative(int action) noexcept;
@@ -12,14 +12,39 @@
 #include <string>
 #include <string_view>
 
+#include "VectorISA.h"
 #include "UniConversion.h"
 
 namespace Scintilla::Internal {
 
 size_t UTF8Length(std::wstring_view wsv) noexcept {
 	size_t len = 0;
-	for (size_t i = 0; i < wsv.length() && wsv[i];) {
+	size_t i = 0;
+	while (i < wsv.length()) {
+#if NP2_USE_SSE2
+		if (i + 8 <= wsv.length()) {
+			// units before first NUL or surrogate in block of 8: 3 bytes for each unit,
+			// minus one for unit below 0x800, minus another one for unit below 0x80.
+			const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i *>(wsv.data() + i));
+			const __m128i zero = _mm_setzero_si128();
+			const __m128i surrogate = _mm_cmpeq_epi16(_mm_and_si128(chunk, _mm_set1_epi16(-0x800)), _mm_set1_epi16(-0x2800));
+			const uint32_t stop = mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi16(chunk, zero), surrogate));
+			const uint32_t count = (stop == 0) ? 16 : np2_ctz(stop);
+			const uint32_t keep = (1U << count) - 1;
+			const uint32_t below80 = mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(chunk, _mm_set1_epi16(-0x80)), zero)) & keep;
+			const uint32_t below800 = mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(chunk, _mm_set1_epi16(-0x800)), zero)) & keep;
+			len += 3*(count/2) - (np2::popcount(below80) + np2::popcount(below800))/2;
+			i += count/2;
+			if (stop == 0) {
+				continue;
+			}
+			// NUL or surrogate pair is handled below, then retry next block
+		}
+#endif
 		const unsigned int uch = wsv[i];
+		if (uch == 0) {
+			break;
+		}
 		if (uch < 0x80) {
 			len++;
 		} else if (uch < 0x800) {
@@ -54,6 +79,21 @@ size_t UTF8PositionFromUTF16Position(std::string_view u8Text, size_t positionUTF
 void UTF8FromUTF16(std::wstring_view wsv, char *putf, size_t len) noexcept {
 	size_t k = 0;
 	for (size_t i = 0; i < wsv.length() && wsv[i];) {
+#if NP2_USE_SSE2
+		if (i + 8 <= wsv.length()) {
+			// block of 8 ASCII characters without NUL
+			const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i *>(wsv.data() + i));
+			const __m128i zero = _mm_setzero_si128();
+			const __m128i ascii = _mm_cmpeq_epi16(_mm_and_si128(chunk, _mm_set1_epi16(-0x80)), zero);
+			const uint32_t mask = mm_movemask_epi8(_mm_andnot_si128(_mm_cmpeq_epi16(chunk, zero), ascii));
+			if (mask == 0xffff) {
+				_mm_storel_epi64(reinterpret_cast<__m128i *>(putf + k), _mm_packus_epi16(chunk, chunk));
+				k += 8;
+				i += 8;
+				continue;
+			}
+		}
+#endif
 		const unsigned int uch = wsv[i];
 		if (uch < 0x80) {
 			putf[k++] = static_cast<char>(uch);
@@ -104,6 +144,59 @@ size_t UTF16Length(std::string_view svu8) noexcept {
 	size_t ulen = 0;
 	size_t i = 0;
 	unsigned int byteCount = 0;
+#if NP2_USE_AVX2 || NP2_USE_SSE2
+	// Block of 32 bytes where every trail byte belongs to the preceding lead byte is counted by
+	// number of non-trail bytes, same as stepping with UTF8BytesOfLead().
+	constexpr uint32_t blockSize = 32;
+	const unsigned char * const us = reinterpret_cast<const unsigned char *>(svu8.data());
+	while (i + blockSize <= svu8.length()) {
+#if NP2_USE_AVX2
+		const __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(us + i));
+		const uint32_t nonAscii = mm256_movemask_epi8(chunk);
+		const auto ge = [chunk](uint8_t value) noexcept {
+			return mm256_movemask_epi8(mm256_cmpge_epu8(chunk, mm256_set1_epi8(value)));
+		};
+#else
+		const __m128i chunk1 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(us + i));
+		const __m128i chunk2 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(us + i + sizeof(__m128i)));
+		const uint32_t nonAscii = mm_movemask_epi8(chunk1) | (mm_movemask_epi8(chunk2) << 16);
+		const auto ge = [chunk1, chunk2](uint8_t value) noexcept {
+			const __m128i mmValue = _mm_set1_epi8(static_cast<char>(value));
+			return mm_movemask_epi8(mm_cmpge_epu8(chunk1, mmValue)) | (mm_movemask_epi8(mm_cmpge_epu8(chunk2, mmValue)) << 16);
+		};
+#endif
+		if (nonAscii == 0) {
+			ulen += blockSize;
+			i += blockSize;
+			continue;
+		}
+
+		const uint32_t geE0 = ge(0xE0);
+		const uint32_t geF0 = ge(0xF0);
+		const uint32_t geF5 = ge(0xF5);
+		const uint32_t trail = nonAscii & ~ge(0xC0);
+		const uint32_t lead2 = ge(0xC2) & ~geE0;
+		const uint32_t lead3 = geE0 & ~geF0;
+		const uint32_t lead4 = geF0 & ~geF5;
+		// stop before the sequence that doesn't end inside the block
+		const uint32_t straddle = (lead2 & 0x80000000U) | (lead3 & 0xC0000000U) | (lead4 & 0xE0000000U);
+		const uint32_t span = straddle ? np2::ctz(straddle) : blockSize;
+		const uint32_t keep = (span == blockSize) ? UINT32_MAX : ((1U << span) - 1);
+		const uint32_t lead34 = (lead3 | lead4) & keep;
+		const uint32_t expected = (((lead2 & keep) | lead34) << 1) | (lead34 << 2) | ((lead4 & keep) << 3);
+		if (expected == (trail & keep)) {
+			ulen += np2::popcount(~trail & keep) + np2::popcount(lead4 & keep);
+			i += span;
+		} else {
+			const size_t end = i + span;
+			while (i < end) {
+				byteCount = UTF8BytesOfLead(us[i]);
+				i += byteCount;
+				ulen += UTF16LengthFromUTF8ByteCount(byteCount);
+			}
+		}
+	}
+#endif
 	while (i < svu8.length()) {
 		const unsigned char ch = svu8[i];
 		byteCount = UTF8BytesOfLead(ch);
@@ -123,6 +216,22 @@ size_t UTF16FromUTF8(std::string_view svu8, wchar_t *tbuf, size_t tlen) noexcept
 	const unsigned char *ptr = reinterpret_cast<const unsigned char *>(svu8.data());
 	const unsigned char * const end = ptr + svu8.length();
 	while (ptr < end) {
+#if NP2_USE_SSE2
+		if (ptr + sizeof(__m128i) <= end && ui + sizeof(__m128i) <= tlen) {
+			// widen ASCII prefix of the block
+			const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i *>(ptr));
+			const __m128i zero = _mm_setzero_si128();
+			_mm_storeu_si128(reinterpret_cast<__m128i *>(tbuf + ui), _mm_unpacklo_epi8(chunk, zero));
+			_mm_storeu_si128(reinterpret_cast<__m128i *>(tbuf + ui + 8), _mm_unpackhi_epi8(chunk, zero));
+			const uint32_t mask = mm_movemask_epi8(chunk);
+			const uint32_t count = mask ? np2::ctz(mask) : sizeof(__m128i);
+			ptr += count;
+			ui += count;
+			if (mask == 0) {
+				continue;
+			}
+		}
+#endif
 		unsigned char ch = *ptr;
 		const unsigned int byteCount = UTF8BytesOfLead(ch);
 		unsigned int value;
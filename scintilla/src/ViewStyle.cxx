@@ -278,6 +278,8 @@ ViewStyle::ViewStyle(size_t stylesSize_):
 
 	someStylesProtected = false;
 	someStylesForceCase = false;
+	uniformMonospace = false;
+	lineNumberDigitWidth = 0;
 	extraFontFlag = FontQuality::QualityDefault;
 	extraAscent = 0;
 	extraDescent = 0;
@@ -353,6 +355,8 @@ ViewStyle::ViewStyle(const ViewStyle &source) : ViewStyle(source.styles.size())
 
 	someStylesProtected = false;
 	someStylesForceCase = false;
+	uniformMonospace = false;
+	lineNumberDigitWidth = 0;
 	extraFontFlag = source.extraFontFlag;
 	extraAscent = source.extraAscent;
 	extraDescent = source.extraDescent;
@@ -417,6 +421,8 @@ void ViewStyle::CalculateMarginWidthAndMask() noexcept {
 void ViewStyle::Refresh(Surface &surface, int tabInChars) {
 	if (!fontsValid) {
 		fontsValid = true;
+		const FontRealisedKey key{surface.LogPixelsY(), zoomLevel, technology};
+		FontMap fontsOld = std::move(fonts);
 		fonts.clear();
 
 		// Apply the extra font flag which controls text drawing quality to each style.
@@ -427,10 +433,28 @@ void ViewStyle::Refresh(Surface &surface, int tabInChars) {
 			CreateAndAddFont(style);
 		}
 
-		// Ask platform to allocate each unique font.
-		for (const auto &font : fonts) {
+		// Ask platform to allocate each unique font, unless it was realised with same key.
+		FontMap *fontsReuse = nullptr;
+		if (key == fontsKey) {
+			fontsReuse = &fontsOld;
+		} else if (key == fontsPreviousKey) {
+			fontsReuse = &fontsPrevious;
+		}
+		for (auto &font : fonts) {
+			if (fontsReuse) {
+				const auto it = fontsReuse->find(font.first);
+				if (it != fontsReuse->end() && it->second) {
+					font.second = std::move(it->second);
+					continue;
+				}
+			}
 			font.second->Realise(surface, zoomLevel, technology, font.first, localeName.c_str());
 		}
+		if (!(key == fontsKey)) {
+			fontsPrevious = std::move(fontsOld);
+			fontsPreviousKey = fontsKey;
+			fontsKey = key;
+		}
 
 		// Set the platform font handle and measurements for each style.
 		for (auto &style : styles) {
@@ -480,6 +504,17 @@ void ViewStyle::Refresh(Surface &surface, int tabInChars) {
 	someStylesProtected = flagProtected;
 	someStylesForceCase = flagForceCase;
 
+	// every ASCII character has same width in all styles, see EditView::LayoutMonospaceLine()
+	bool flagMonospace = true;
+	for (const auto &style : styles) {
+		if (!style.visible || !style.monospaceASCII || style.aveCharWidth != aveCharWidth
+			|| std::abs(style.spaceWidth - aveCharWidth) > 0.01) {
+			flagMonospace = false;
+			break;
+		}
+	}
+	uniformMonospace = flagMonospace;
+
 	tabWidth = aveCharWidth * tabInChars;
 
 	controlCharWidth = 0.0;
@@ -488,6 +523,22 @@ void ViewStyle::Refresh(Surface &surface, int tabInChars) {
 		controlCharWidth = surface.WidthText(styles[StyleControlChar].font.get(), cc);
 	}
 
+	// with tabular digits line number is measured without calling into the font, see MarginView::PaintOneMargin()
+	lineNumberDigitWidth = 0;
+	{
+		constexpr std::string_view digits = "0123456789";
+		XYPOSITION positions[digits.length()];
+		surface.MeasureWidths(styles[StyleLineNumber].font.get(), digits, positions);
+		const XYPOSITION width = positions[0];
+		bool tabular = width > 0;
+		for (size_t i = 1; tabular && i < digits.length(); i++) {
+			tabular = std::abs(positions[i] - positions[i - 1] - width) < 0.001;
+		}
+		if (tabular) {
+			lineNumberDigitWidth = width;
+		}
+	}
+
 	CalculateMarginWidthAndMask();
 	textStart = marginInside ? fixedColumnWidth : leftMarginWidth;
 }
@@ -559,6 +610,10 @@ void ViewStyle::SetStyleFontName(int styleIndex, const char *name) {
 void ViewStyle::SetFontLocaleName(const char *name) {
 	fontsValid = false;
 	localeName = name;
+	// fonts realised with old locale can not be reused
+	fontsPrevious.clear();
+	fontsKey = {};
+	fontsPreviousKey = {};
 }
 
 bool ViewStyle::ProtectionActive() const noexcept {
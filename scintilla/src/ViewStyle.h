@@ -35,6 +35,16 @@ public:
 };
 
 using FontMap = std::map<FontSpecification, std::unique_ptr<FontRealised>>;
+
+// realised font only depends on its specification and these properties
+struct FontRealisedKey {
+	int dpi = 0;
+	int zoomLevel = 0;
+	Scintilla::Technology technology = Scintilla::Technology::Default;
+	constexpr bool operator==(const FontRealisedKey &other) const noexcept {
+		return dpi == other.dpi && zoomLevel == other.zoomLevel && technology == other.technology;
+	}
+};
 using ColourOptional = std::optional<ColourRGBA>;
 
 constexpr int GetFontSizeZoomed(int size, int zoomLevel) noexcept {
@@ -116,6 +126,10 @@ enum StyleIndices {
 class ViewStyle final {
 	UniqueStringSet fontNames;
 	FontMap fonts;
+	// fonts realised for previous DPI (or zoom level), reused when window is moved back to that monitor
+	FontMap fontsPrevious;
+	FontRealisedKey fontsKey;
+	FontRealisedKey fontsPreviousKey;
 public:
 	std::vector<Style> styles;
 	std::vector<LineMarker> markers;
@@ -166,6 +180,8 @@ public:
 
 	bool someStylesProtected;
 	bool someStylesForceCase;
+	bool uniformMonospace;
+	XYPOSITION lineNumberDigitWidth;
 	Scintilla::FontQuality extraFontFlag;
 	int extraAscent;
 	int extraDescent;
@@ -0,0 +1,626 @@
+// This file is part of Notepad4.
+// See License.txt for details about distribution and modification.
+#define _CRT_SECURE_NO_WARNINGS
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <cstdio>
+#include <cassert>
+#include <climits>
+#include <chrono>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <optional>
+#include <algorithm>
+#include <memory>
+#include <atomic>
+
+#include "ScintillaTypes.h"
+#include "ILoader.h"
+#include "ILexer.h"
+
+#include "Debugging.h"
+
+#include "CharacterSet.h"
+#include "Position.h"
+#include "SplitVector.h"
+#include "Partitioning.h"
+#include "RunStyles.h"
+#include "CellBuffer.h"
+#include "CharClassify.h"
+#include "Decoration.h"
+#include "CaseFolder.h"
+#include "Document.h"
+#include "UniConversion.h"
+#include "ElapsedPeriod.h"
+
+// Measure core data structures of Scintilla: ns/op, heap allocation count and bytes of the best round.
+// the corpus is either synthetic (mixed ASCII, CJK and emoji lines, reproducible with -seed) or a real file
+// repeated to the requested size.
+// <sources> are these files prefixed with ../src/: CellBuffer.cxx ChangeHistory.cxx UndoHistory.cxx PerLine.cxx RunStyles.cxx
+// Decoration.cxx CharClassify.cxx CaseFolder.cxx CaseConvert.cxx Document.cxx RESearch.cxx SearchIndex.cxx
+// CharacterBlockIndex.cxx BraceIndex.cxx BackgroundLexer.cxx UniConversion.cxx
+// Document also references Document::HighlightUrl() from ScintillaBase.cxx and QueryPerformanceCounter() from
+// ../win32/PlatWin.cxx, both pull in the whole editor, they are replaced below as no lexer is set by the benchmark.
+// only kernel32 is used (linked by default), e.g. thread pool for BackgroundLexer and MultiByteToWideChar for DBCS.
+// cl /utf-8 /EHsc /std:c++20 /DNDEBUG /O2 /GS- /GR- /W4 /arch:AVX2 /I../include /I../lexlib /I../src CoreBenchmark.cpp <sources>
+// clang-cl /utf-8 /EHsc /std:c++20 /DNDEBUG /O2 /GS- /GR- /W4 -march=x86-64-v3 /I../include /I../lexlib /I../src CoreBenchmark.cpp <sources>
+// g++ -std=gnu++20 -DNDEBUG -O2 -Wall -Wextra -march=x86-64-v3 -I../include -I../lexlib -I../src CoreBenchmark.cpp <sources>
+// CoreBenchmark [-file path] [-size MiB] [-seed value] [-rounds count] [-json file] [benchmark...]
+// -json writes results as JSON array for tracking, benchmark names can be given as prefix, e.g. CellBuffer.
+
+namespace {
+
+size_t allocationCount = 0;
+size_t allocationBytes = 0;
+
+}
+
+void *operator new(size_t size) {
+	++allocationCount;
+	allocationBytes += size;
+	void *ptr = malloc(size ? size : 1);
+	if (ptr == nullptr) {
+		throw std::bad_alloc();
+	}
+	return ptr;
+}
+
+void *operator new[](size_t size) {
+	return operator new(size);
+}
+
+void operator delete(void *ptr) noexcept {
+	free(ptr);
+}
+
+void operator delete[](void *ptr) noexcept {
+	free(ptr);
+}
+
+void operator delete(void *ptr, size_t) noexcept {
+	free(ptr);
+}
+
+void operator delete[](void *ptr, size_t) noexcept {
+	free(ptr);
+}
+
+namespace Scintilla::Internal {
+
+void Document::HighlightUrl(Sci_PositionU, Sci_Position, const uint32_t (&)[8]) {
+}
+
+int64_t QueryPerformanceFrequency() noexcept {
+	return std::chrono::steady_clock::period::den / std::chrono::steady_clock::period::num;
+}
+
+int64_t QueryPerformanceCounter() noexcept {
+	return std::chrono::steady_clock::now().time_since_epoch().count();
+}
+
+}
+
+namespace {
+
+using namespace Scintilla;
+using namespace Scintilla::Internal;
+
+// https://www.pcg-random.org/download.html
+struct PCG32Random {
+	uint64_t state;
+	uint64_t inc;
+	PCG32Random(uint64_t seed, uint64_t seq = 1) noexcept: state{seed}, inc{seq | 1} {}
+	uint32_t Next() noexcept {
+		const uint64_t oldstate = state;
+		state = oldstate * UINT64_C(6364136223846793005) + inc;
+		const uint32_t xorshifted = static_cast<uint32_t>(((oldstate >> 18) ^ oldstate) >> 27);
+		const int rot = oldstate >> 59;
+		return (xorshifted >> rot) | (xorshifted << ((-rot) & 31));
+	}
+	// value in [0, bound)
+	size_t Below(size_t bound) noexcept {
+		return static_cast<size_t>((static_cast<uint64_t>(Next()) * bound) >> 32);
+	}
+};
+
+struct BenchResult {
+	const char *name;
+	size_t ops = 0;
+	double nsPerOp = 0;
+	size_t allocations = 0;
+	size_t bytes = 0;
+};
+
+// records time and allocations for the measured part of a benchmark round
+class Measure {
+	const size_t count;
+	const size_t bytes;
+	const std::chrono::steady_clock::time_point start;
+public:
+	Measure() noexcept : count{allocationCount}, bytes{allocationBytes}, start{std::chrono::steady_clock::now()} {}
+	void Finish(BenchResult &result, size_t ops) const noexcept {
+		const auto end = std::chrono::steady_clock::now();
+		const double duration = std::chrono::duration<double, std::nano>(end - start).count();
+		const double nsPerOp = (ops != 0) ? duration / ops : 0;
+		if (result.ops == 0 || nsPerOp < result.nsPerOp) {
+			result.ops = ops;
+			result.nsPerOp = nsPerOp;
+			result.allocations = allocationCount - count;
+			result.bytes = allocationBytes - bytes;
+		}
+	}
+};
+
+struct Corpus {
+	std::string text;
+	uint64_t seed;
+};
+
+using BenchFunction = void (*)(const Corpus &corpus, BenchResult &result);
+
+constexpr size_t RandomOperationCount = 100'000;
+constexpr size_t EditLength = 16;
+
+std::string MakeSyntheticCorpus(size_t size, uint64_t seed) {
+	static constexpr const char *words[] = {
+		"int", "return", "static", "const", "value", "position", "length", "document", "(", ")", "{", "}", ";", "=",
+		"\xe4\xb8\xad\xe6\x96\x87", "\xe6\x97\xa5\xe6\x9c\xac\xe8\xaa\x9e", "\xc3\xa9t\xc3\xa9", "\xce\xb1\xce\xb2\xce\xb3", "\xf0\x9f\x98\x84",
+	};
+	constexpr size_t wordCount = sizeof(words)/sizeof(words[0]);
+	PCG32Random rng{seed};
+	std::string text;
+	text.reserve(size + 128);
+	while (text.size() < size) {
+		text.append(rng.Below(8), '\t');
+		const size_t count = rng.Below(12);
+		for (size_t i = 0; i < count; i++) {
+			text += words[rng.Below(wordCount)];
+			text += ' ';
+		}
+		text += (rng.Below(4) == 0) ? "\r\n" : "\n";
+	}
+	return text;
+}
+
+std::string LoadCorpusFile(const char *path, size_t size) {
+	std::string content;
+	FILE *fp = fopen(path, "rb");
+	if (fp == nullptr) {
+		return content;
+	}
+	char buffer[64*1024];
+	size_t length;
+	while ((length = fread(buffer, 1, sizeof(buffer), fp)) != 0) {
+		content.append(buffer, length);
+	}
+	fclose(fp);
+	if (content.empty()) {
+		return content;
+	}
+	std::string text;
+	text.reserve(size + content.size());
+	while (text.size() < size) {
+		text += content;
+	}
+	return text;
+}
+
+Sci::Position RandomPosition(PCG32Random &rng, Sci::Position length) noexcept {
+	return static_cast<Sci::Position>(rng.Below(length + 1));
+}
+
+// ops is MiB of text, so ns/op is ns/MiB
+size_t MegaBytes(size_t length) noexcept {
+	return std::max<size_t>(length >> 20, 1);
+}
+
+void LoadCellBuffer(CellBuffer &cb, const std::string &text) {
+	bool startSequence = false;
+	cb.SetUndoCollection(false);
+	cb.Allocate(text.size());
+	cb.InsertString(0, text.data(), text.size(), startSequence);
+}
+
+// insert whole corpus at once as loading a file, mostly line end scanning
+void BenchCellBufferLoad(const Corpus &corpus, BenchResult &result) {
+	CellBuffer cb{true, false, false};
+	const Measure measure;
+	LoadCellBuffer(cb, corpus.text);
+	measure.Finish(result, MegaBytes(corpus.text.size()));
+}
+
+// append corpus in small pieces, as typing or loading a file in blocks
+void BenchCellBufferInsertSequential(const Corpus &corpus, BenchResult &result) {
+	CellBuffer cb{true, false, false};
+	cb.SetUndoCollection(false);
+	constexpr size_t blockSize = 64;
+	const std::string &text = corpus.text;
+	bool startSequence = false;
+	size_t ops = 0;
+	const Measure measure;
+	for (size_t position = 0; position < text.size(); position += blockSize) {
+		const size_t length = std::min(blockSize, text.size() - position);
+		cb.InsertString(position, text.data() + position, length, startSequence);
+		++ops;
+	}
+	measure.Finish(result, ops);
+}
+
+void BenchCellBufferInsertRandom(const Corpus &corpus, BenchResult &result) {
+	CellBuffer cb{true, false, false};
+	LoadCellBuffer(cb, corpus.text);
+	PCG32Random rng{corpus.seed};
+	bool startSequence = false;
+	const Measure measure;
+	for (size_t i = 0; i < RandomOperationCount; i++) {
+		const Sci::Position position = RandomPosition(rng, cb.Length());
+		cb.InsertString(position, corpus.text.data() + rng.Below(corpus.text.size() - EditLength), EditLength, startSequence);
+	}
+	measure.Finish(result, RandomOperationCount);
+}
+
+void BenchCellBufferDeleteRandom(const Corpus &corpus, BenchResult &result) {
+	CellBuffer cb{true, false, false};
+	LoadCellBuffer(cb, corpus.text);
+	PCG32Random rng{corpus.seed};
+	bool startSequence = false;
+	const size_t ops = std::min(RandomOperationCount, corpus.text.size() / (2*EditLength));
+	const Measure measure;
+	for (size_t i = 0; i < ops; i++) {
+		const Sci::Position position = RandomPosition(rng, cb.Length() - EditLength);
+		cb.DeleteChars(position, EditLength, startSequence);
+	}
+	measure.Finish(result, ops);
+}
+
+// single character edits alternating between start and end, each moves the gap over whole buffer
+void BenchSplitVectorGapTo(const Corpus &corpus, BenchResult &result) {
+	SplitVector<char> sv;
+	sv.InsertFromArray(0, corpus.text.data(), corpus.text.size());
+	constexpr size_t ops = 256;
+	const Measure measure;
+	for (size_t i = 0; i < ops; i++) {
+		const ptrdiff_t position = (i & 1) ? sv.Length() - 1 : 1;
+		sv.Insert(position, 'x');
+	}
+	measure.Finish(result, ops);
+}
+
+std::vector<Sci::Position> LineStarts(const std::string &text) {
+	std::vector<Sci::Position> starts;
+	for (size_t i = 0; i < text.size(); i++) {
+		if (text[i] == '\n') {
+			starts.push_back(i + 1);
+		}
+	}
+	if (starts.empty() || starts.back() != static_cast<Sci::Position>(text.size())) {
+		starts.push_back(text.size());
+	}
+	return starts;
+}
+
+// insert text alternating between first and last lines, each applies the step over all lines
+void BenchPartitioningInsertText(const Corpus &corpus, BenchResult &result) {
+	const std::vector<Sci::Position> starts = LineStarts(corpus.text);
+	Partitioning<Sci::Position> partitioning{1024};
+	partitioning.InsertPartitions(1, starts.data(), starts.size() - 1);
+	partitioning.InsertText(static_cast<Sci::Position>(starts.size()) - 1, 0);
+	const Sci::Position lines = partitioning.Partitions();
+	constexpr size_t ops = 1024;
+	const Measure measure;
+	for (size_t i = 0; i < ops; i++) {
+		const Sci::Position line = (i & 1) ? lines - 1 : 0;
+		partitioning.InsertText(line, 1);
+	}
+	measure.Finish(result, ops);
+}
+
+void BenchPartitioningFromPosition(const Corpus &corpus, BenchResult &result) {
+	const std::vector<Sci::Position> starts = LineStarts(corpus.text);
+	Partitioning<Sci::Position> partitioning{1024};
+	partitioning.InsertPartitions(1, starts.data(), starts.size() - 1);
+	PCG32Random rng{corpus.seed};
+	const Sci::Position length = partitioning.Length();
+	Sci::Position sum = 0;
+	const Measure measure;
+	for (size_t i = 0; i < RandomOperationCount; i++) {
+		sum += partitioning.PartitionFromPosition(RandomPosition(rng, length));
+	}
+	measure.Finish(result, RandomOperationCount);
+	if (sum < 0) {
+		printf("unexpected line sum %zd\n", static_cast<size_t>(sum));
+	}
+}
+
+void BenchRunStylesFillRange(const Corpus &corpus, BenchResult &result) {
+	RunStyles<Sci::Position, int> rs;
+	const Sci::Position length = corpus.text.size();
+	rs.InsertSpace(0, length);
+	PCG32Random rng{corpus.seed};
+	const Measure measure;
+	for (size_t i = 0; i < RandomOperationCount; i++) {
+		const Sci::Position position = RandomPosition(rng, length - 256);
+		rs.FillRange(position, static_cast<int>(rng.Below(4)), 1 + static_cast<Sci::Position>(rng.Below(255)));
+	}
+	measure.Finish(result, RandomOperationCount);
+}
+
+void BenchDecorationFillRange(const Corpus &corpus, BenchResult &result) {
+	std::unique_ptr<IDecorationList> decorations = DecorationListCreate(false);
+	const Sci::Position length = corpus.text.size();
+	decorations->InsertSpace(0, length);
+	PCG32Random rng{corpus.seed};
+	const Measure measure;
+	for (size_t i = 0; i < RandomOperationCount; i++) {
+		decorations->SetCurrentIndicator(8 + static_cast<int>(i & 3));
+		const Sci::Position position = RandomPosition(rng, length - 256);
+		decorations->FillRange(position, 1, 1 + static_cast<Sci::Position>(rng.Below(255)));
+	}
+	measure.Finish(result, RandomOperationCount);
+}
+
+// each insertion as separate undo action, then undo all
+void BenchUndoHistory(const Corpus &corpus, BenchResult &result) {
+	CellBuffer cb{true, false, false};
+	LoadCellBuffer(cb, corpus.text);
+	cb.SetUndoCollection(true);
+	PCG32Random rng{corpus.seed};
+	bool startSequence = false;
+	const Measure measure;
+	for (size_t i = 0; i < RandomOperationCount; i++) {
+		const Sci::Position position = RandomPosition(rng, cb.Length());
+		cb.BeginUndoAction();
+		cb.InsertString(position, corpus.text.data() + rng.Below(corpus.text.size() - EditLength), EditLength, startSequence);
+		cb.EndUndoAction();
+	}
+	size_t ops = RandomOperationCount;
+	while (cb.CanUndo()) {
+		const int steps = cb.StartUndo();
+		for (int step = 0; step < steps; step++) {
+			cb.PerformUndoStep();
+		}
+		++ops;
+	}
+	measure.Finish(result, ops);
+}
+
+void BenchChangeHistory(const Corpus &corpus, BenchResult &result) {
+	CellBuffer cb{true, false, false};
+	LoadCellBuffer(cb, corpus.text);
+	cb.SetUndoCollection(true);
+	cb.ChangeHistorySet(true);
+	PCG32Random rng{corpus.seed};
+	bool startSequence = false;
+	const Measure measure;
+	for (size_t i = 0; i < RandomOperationCount; i++) {
+		const Sci::Position position = RandomPosition(rng, cb.Length() - EditLength);
+		if (i & 1) {
+			cb.DeleteChars(position, EditLength, startSequence);
+		} else {
+			cb.InsertString(position, corpus.text.data() + rng.Below(corpus.text.size() - EditLength), EditLength, startSequence);
+		}
+	}
+	measure.Finish(result, RandomOperationCount);
+}
+
+struct DocumentHolder {
+	Document *pdoc;
+	explicit DocumentHolder(const std::string &text) : pdoc{new Document(DocumentOption::Default)} {
+		pdoc->AddRef();
+		pdoc->SetDBCSCodePage(CpUtf8);
+		pdoc->SetCaseFolder(std::make_unique<CaseFolderUnicode>());
+		pdoc->SetUndoCollection(false);
+		pdoc->InsertString(0, text.data(), text.size());
+	}
+	DocumentHolder(const DocumentHolder &) = delete;
+	DocumentHolder &operator=(const DocumentHolder &) = delete;
+	~DocumentHolder() {
+		pdoc->Release();
+	}
+};
+
+// search forward through whole document, ops is number of matches (at least 1)
+void BenchFindText(const Corpus &corpus, BenchResult &result, const char *pattern, FindOption flags) {
+	const DocumentHolder holder{corpus.text};
+	Document *pdoc = holder.pdoc;
+	const Sci::Position length = pdoc->LengthNoExcept();
+	size_t ops = 0;
+	const Measure measure;
+	Sci::Position position = 0;
+	while (position < length) {
+		Sci::Position lengthFound = static_cast<Sci::Position>(strlen(pattern));
+		const Sci::Position found = pdoc->FindText(position, length, pattern, flags, &lengthFound);
+		if (found < 0) {
+			break;
+		}
+		++ops;
+		position = found + std::max<Sci::Position>(lengthFound, 1);
+	}
+	measure.Finish(result, std::max<size_t>(ops, 1));
+}
+
+void BenchFindTextLiteral(const Corpus &corpus, BenchResult &result) {
+	BenchFindText(corpus, result, "document", FindOption::MatchCase);
+}
+
+void BenchFindTextIgnoreCase(const Corpus &corpus, BenchResult &result) {
+	BenchFindText(corpus, result, "DOCUMENT", FindOption::None);
+}
+
+void BenchFindTextRegex(const Corpus &corpus, BenchResult &result) {
+	BenchFindText(corpus, result, "pos[a-z]+ion", FindOption::RegExp | FindOption::MatchCase);
+}
+
+void BenchCountCharacters(const Corpus &corpus, BenchResult &result) {
+	const DocumentHolder holder{corpus.text};
+	const Document *pdoc = holder.pdoc;
+	const Sci::Position length = pdoc->LengthNoExcept();
+	const Measure measure;
+	const Sci::Position count = pdoc->CountCharacters(0, length);
+	const Sci::Position countUTF16 = pdoc->CountUTF16(0, length);
+	measure.Finish(result, 2*MegaBytes(length));
+	if (count > countUTF16) {
+		printf("unexpected character count %zd > %zd\n", static_cast<size_t>(count), static_cast<size_t>(countUTF16));
+	}
+}
+
+void BenchUTF16FromUTF8(const Corpus &corpus, BenchResult &result) {
+	const std::string_view text{corpus.text};
+	std::unique_ptr<wchar_t[]> buffer = std::make_unique_for_overwrite<wchar_t[]>(text.size() + 1);
+	const Measure measure;
+	const size_t length = UTF16Length(text);
+	UTF16FromUTF8(text, buffer.get(), length);
+	measure.Finish(result, MegaBytes(text.size()));
+}
+
+void BenchUTF8FromUTF16(const Corpus &corpus, BenchResult &result) {
+	const std::wstring wtext = WStringFromUTF8(corpus.text);
+	std::unique_ptr<char[]> buffer = std::make_unique_for_overwrite<char[]>(corpus.text.size() + 1);
+	const Measure measure;
+	const size_t length = UTF8Length(wtext);
+	UTF8FromUTF16(wtext, buffer.get(), length);
+	measure.Finish(result, MegaBytes(corpus.text.size()));
+}
+
+void BenchUTF32FromUTF8(const Corpus &corpus, BenchResult &result) {
+	const std::string_view text{corpus.text};
+	std::unique_ptr<unsigned int[]> buffer = std::make_unique_for_overwrite<unsigned int[]>(text.size() + 1);
+	const Measure measure;
+	const size_t length = UTF32Length(text);
+	UTF32FromUTF8(text, buffer.get(), length);
+	measure.Finish(result, MegaBytes(text.size()));
+}
+
+void BenchUTF8IsValid(const Corpus &corpus, BenchResult &result) {
+	const Measure measure;
+	const bool valid = UTF8IsValid(corpus.text);
+	measure.Finish(result, MegaBytes(corpus.text.size()));
+	if (!valid) {
+		printf("corpus is not valid UTF-8\n");
+	}
+}
+
+struct BenchEntry {
+	const char *name;
+	BenchFunction function;
+};
+
+constexpr BenchEntry benchList[] = {
+	{"CellBuffer.Load", BenchCellBufferLoad},					// per MiB
+	{"CellBuffer.InsertSequential", BenchCellBufferInsertSequential},
+	{"CellBuffer.InsertRandom", BenchCellBufferInsertRandom},
+	{"CellBuffer.DeleteRandom", BenchCellBufferDeleteRandom},
+	{"SplitVector.GapTo", BenchSplitVectorGapTo},
+	{"Partitioning.InsertText", BenchPartitioningInsertText},
+	{"Partitioning.FromPosition", BenchPartitioningFromPosition},
+	{"RunStyles.FillRange", BenchRunStylesFillRange},
+	{"Decoration.FillRange", BenchDecorationFillRange},
+	{"UndoHistory.PushUndo", BenchUndoHistory},
+	{"ChangeHistory.Edit", BenchChangeHistory},
+	{"Document.FindLiteral", BenchFindTextLiteral},
+	{"Document.FindIgnoreCase", BenchFindTextIgnoreCase},
+	{"Document.FindRegex", BenchFindTextRegex},
+	{"Document.CountCharacters", BenchCountCharacters},		// per MiB
+	{"UTF16FromUTF8", BenchUTF16FromUTF8},					// per MiB
+	{"UTF8FromUTF16", BenchUTF8FromUTF16},					// per MiB
+	{"UTF32FromUTF8", BenchUTF32FromUTF8},					// per MiB
+	{"UTF8IsValid", BenchUTF8IsValid},						// per MiB
+};
+
+bool Selected(const BenchEntry &entry, const std::vector<std::string_view> &names) noexcept {
+	if (names.empty()) {
+		return true;
+	}
+	const std::string_view name{entry.name};
+	return std::any_of(names.begin(), names.end(), [name](std::string_view prefix) noexcept {
+		return name.starts_with(prefix);
+	});
+}
+
+bool WriteJson(const char *path, const char *corpusName, size_t corpusSize, const std::vector<BenchResult> &results) {
+	FILE *fp = fopen(path, "w");
+	if (fp == nullptr) {
+		return false;
+	}
+	fprintf(fp, "{\n\t\"corpus\": \"%s\",\n\t\"size\": %zu,\n\t\"results\": [\n", corpusName, corpusSize);
+	for (size_t i = 0; i < results.size(); i++) {
+		const BenchResult &result = results[i];
+		fprintf(fp, "\t\t{\"name\": \"%s\", \"ops\": %zu, \"ns_per_op\": %.2f, \"allocations\": %zu, \"bytes\": %zu}%s\n",
+			result.name, result.ops, result.nsPerOp, result.allocations, result.bytes, (i + 1 < results.size()) ? "," : "");
+	}
+	fprintf(fp, "\t]\n}\n");
+	fclose(fp);
+	return true;
+}
+
+}
+
+int main(int argc, char *argv[]) {
+	const char *corpusPath = nullptr;
+	size_t size = 16;
+	uint64_t seed = 1;
+	int rounds = 3;
+	const char *jsonPath = nullptr;
+	std::vector<std::string_view> names;
+	for (int i = 1; i < argc; i++) {
+		const std::string_view arg{argv[i]};
+		if (i + 1 < argc && arg[0] == '-') {
+			const char *value = argv[++i];
+			if (arg == "-file") {
+				corpusPath = value;
+			} else if (arg == "-size") {
+				size = std::max<size_t>(1, strtoul(value, nullptr, 10));
+			} else if (arg == "-seed") {
+				seed = strtoull(value, nullptr, 10);
+			} else if (arg == "-rounds") {
+				rounds = std::max(1, atoi(value));
+			} else if (arg == "-json") {
+				jsonPath = value;
+			} else {
+				printf("unknown option %s\n", argv[i - 1]);
+				return 2;
+			}
+		} else {
+			names.push_back(arg);
+		}
+	}
+
+	Corpus corpus;
+	corpus.seed = seed;
+	if (corpusPath) {
+		corpus.text = LoadCorpusFile(corpusPath, size*1024*1024);
+		if (corpus.text.empty()) {
+			printf("cannot read corpus %s\n", corpusPath);
+			return 2;
+		}
+	} else {
+		corpus.text = MakeSyntheticCorpus(size*1024*1024, seed);
+	}
+
+	const char *corpusName = corpusPath ? corpusPath : "synthetic";
+	printf("corpus %s, %zu bytes\n", corpusName, corpus.text.size());
+	printf("%-28s %10s %14s %12s %14s\n", "benchmark", "ops", "ns/op", "allocations", "bytes");
+	std::vector<BenchResult> results;
+	for (const BenchEntry &entry : benchList) {
+		if (!Selected(entry, names)) {
+			continue;
+		}
+		BenchResult result{entry.name};
+		for (int round = 0; round < rounds; round++) {
+			entry.function(corpus, result);
+		}
+		printf("%-28s %10zu %14.2f %12zu %14zu\n", result.name, result.ops, result.nsPerOp, result.allocations, result.bytes);
+		results.push_back(result);
+	}
+
+	if (jsonPath && !WriteJson(jsonPath, corpusName, corpus.text.size(), results)) {
+		printf("cannot write %s\n", jsonPath);
+		return 2;
+	}
+	return 0;
+}
@@ -0,0 +1,490 @@
+// This file is part of Notepad4.
+// See License.txt for details about distribution and modification.
+#define _CRT_SECURE_NO_WARNINGS
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <cstdio>
+#include <chrono>
+#include <new>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <algorithm>
+#include <filesystem>
+
+#include "ILexer.h"
+#include "Scintilla.h"
+#include "SciLexer.h"
+#include "LexerModule.h"
+
+// Measure styling and folding throughput of each lexer over a corpus built from files in this repository,
+// so the corpus is reproducible for same revision, keyword lists are not set.
+// cl /utf-8 /EHsc /std:c++20 /DNDEBUG /O2 /GS- /GR- /W4 /arch:AVX2 /I../include /I../lexlib LexerBenchmark.cpp ../lexlib/*.cxx ../lexers/*.cxx
+// clang-cl /utf-8 /EHsc /std:c++20 /DNDEBUG /O2 /GS- /GR- /W4 -march=x86-64-v3 /I../include /I../lexlib LexerBenchmark.cpp ../lexlib/*.cxx ../lexers/*.cxx
+// g++ -std=gnu++20 -DNDEBUG -O2 -Wall -Wextra -march=x86-64-v3 -I../include -I../lexlib LexerBenchmark.cpp ../lexlib/*.cxx ../lexers/*.cxx
+// LexerBenchmark [-root dir] [-size MiB] [-rounds count] [-save file] [-check file] [-threshold percent] [lexer...]
+// -save writes MB/s of each lexer into baseline file, -check fails when a lexer is slower than baseline by threshold percent.
+
+namespace {
+
+size_t allocationCount = 0;
+size_t allocationBytes = 0;
+
+}
+
+void *operator new(size_t size) {
+	++allocationCount;
+	allocationBytes += size;
+	void *ptr = malloc(size ? size : 1);
+	if (ptr == nullptr) {
+		throw std::bad_alloc();
+	}
+	return ptr;
+}
+
+void *operator new[](size_t size) {
+	return operator new(size);
+}
+
+void operator delete(void *ptr) noexcept {
+	free(ptr);
+}
+
+void operator delete[](void *ptr) noexcept {
+	free(ptr);
+}
+
+void operator delete(void *ptr, size_t) noexcept {
+	free(ptr);
+}
+
+void operator delete[](void *ptr, size_t) noexcept {
+	free(ptr);
+}
+
+namespace {
+
+using namespace Lexilla;
+
+// minimal single buffer document with UTF-8 text
+class BenchDocument final : public Scintilla::IDocument {
+	std::string text;
+	std::vector<unsigned char> styles;
+	std::vector<int> levels;
+	std::vector<int> lineStates;
+	std::vector<Sci_Position> lineStarts;
+	Sci_Position endStyled = 0;
+
+public:
+	explicit BenchDocument(std::string &&text_): text{std::move(text_)} {
+		lineStarts.push_back(0);
+		const Sci_Position length = text.length();
+		for (Sci_Position i = 0; i < length; i++) {
+			const char ch = text[i];
+			if (ch == '\n' || (ch == '\r' && (i + 1 == length || text[i + 1] != '\n'))) {
+				lineStarts.push_back(i + 1);
+			}
+		}
+		lineStarts.push_back(length);
+		styles.resize(length);
+		levels.resize(lineStarts.size() - 1);
+		lineStates.resize(lineStarts.size() - 1);
+		Reset();
+	}
+	void Reset() noexcept {
+		memset(styles.data(), 0, styles.size());
+		std::fill(levels.begin(), levels.end(), SC_FOLDLEVELBASE);
+		std::fill(lineStates.begin(), lineStates.end(), 0);
+		endStyled = 0;
+	}
+	Sci_Line LinesTotal() const noexcept {
+		return levels.size();
+	}
+	Sci_Position EndStyled() const noexcept {
+		return endStyled;
+	}
+
+	int SCI_METHOD Version() const noexcept override {
+		return Scintilla::dvRelease4;
+	}
+	void SCI_METHOD SetErrorStatus(int) noexcept override {}
+	Sci_Position SCI_METHOD Length() const noexcept override {
+		return text.length();
+	}
+	void SCI_METHOD GetCharRange(char *buffer, Sci_Position position, Sci_Position lengthRetrieve) const noexcept override {
+		memcpy(buffer, text.data() + position, lengthRetrieve);
+	}
+	unsigned char SCI_METHOD StyleAt(Sci_Position position) const noexcept override {
+		return (position >= 0 && position < Length()) ? styles[position] : 0;
+	}
+	Sci_Line SCI_METHOD LineFromPosition(Sci_Position position) const noexcept override {
+		const auto it = std::upper_bound(lineStarts.begin() + 1, lineStarts.end() - 1, position);
+		return it - lineStarts.begin() - 1;
+	}
+	Sci_Position SCI_METHOD LineStart(Sci_Line line) const noexcept override {
+		if (line < 0) {
+			return 0;
+		}
+		return (line < LinesTotal()) ? lineStarts[line] : Length();
+	}
+	int SCI_METHOD GetLevel(Sci_Line line) const noexcept override {
+		return (line >= 0 && line < LinesTotal()) ? levels[line] : SC_FOLDLEVELBASE;
+	}
+	int SCI_METHOD SetLevel(Sci_Line line, int level) override {
+		const int prev = GetLevel(line);
+		if (line >= 0 && line < LinesTotal()) {
+			levels[line] = level;
+		}
+		return prev;
+	}
+	int SCI_METHOD GetLineState(Sci_Line line) const noexcept override {
+		return (line >= 0 && line < LinesTotal()) ? lineStates[line] : 0;
+	}
+	int SCI_METHOD SetLineState(Sci_Line line, int state) override {
+		const int prev = GetLineState(line);
+		if (line >= 0 && line < LinesTotal()) {
+			lineStates[line] = state;
+		}
+		return prev;
+	}
+	void SCI_METHOD StartStyling(Sci_Position position) noexcept override {
+		endStyled = position;
+	}
+	bool SCI_METHOD SetStyleFor(Sci_Position length, unsigned char style) override {
+		length = std::min(length, Length() - endStyled);
+		memset(styles.data() + endStyled, style, length);
+		endStyled += length;
+		return true;
+	}
+	bool SCI_METHOD SetStyles(Sci_Position length, const unsigned char *styles_) override {
+		length = std::min(length, Length() - endStyled);
+		memcpy(styles.data() + endStyled, styles_, length);
+		endStyled += length;
+		return true;
+	}
+	void SCI_METHOD DecorationSetCurrentIndicator(int) noexcept override {}
+	void SCI_METHOD DecorationFillRange(Sci_Position, int, Sci_Position) override {}
+	void SCI_METHOD ChangeLexerState(Sci_Position, Sci_Position) override {}
+	int SCI_METHOD CodePage() const noexcept override {
+		return SC_CP_UTF8;
+	}
+	bool SCI_METHOD IsDBCSLeadByte(unsigned char) const noexcept override {
+		return false;
+	}
+	const char * SCI_METHOD BufferPointer() noexcept override {
+		return text.c_str();
+	}
+	const char * SCI_METHOD ContiguousRangePointer(Sci_Position position, [[maybe_unused]] Sci_Position rangeLength) const noexcept override {
+		return text.data() + position;
+	}
+	int SCI_METHOD GetLineIndentation(Sci_Line line) const noexcept override {
+		int indent = 0;
+		for (Sci_Position pos = LineStart(line); pos < Length(); pos++) {
+			const char ch = text[pos];
+			if (ch == ' ') {
+				indent++;
+			} else if (ch == '\t') {
+				indent = (indent / 4 + 1) * 4;
+			} else {
+				break;
+			}
+		}
+		return indent;
+	}
+	Sci_Position SCI_METHOD LineEnd(Sci_Line line) const noexcept override {
+		Sci_Position pos = LineStart(line + 1);
+		const Sci_Position start = LineStart(line);
+		if (pos > start && text[pos - 1] == '\n') {
+			--pos;
+		}
+		if (pos > start && text[pos - 1] == '\r') {
+			--pos;
+		}
+		return pos;
+	}
+	Sci_Position SCI_METHOD GetRelativePosition(Sci_Position positionStart, Sci_Position characterOffset) const noexcept override {
+		Sci_Position pos = positionStart;
+		while (characterOffset != 0) {
+			if (characterOffset > 0) {
+				if (pos >= Length()) {
+					return -1;
+				}
+				Sci_Position width = 1;
+				GetCharacterAndWidth(pos, &width);
+				pos += width;
+				--characterOffset;
+			} else {
+				if (pos <= 0) {
+					return -1;
+				}
+				--pos;
+				while (pos > 0 && (static_cast<unsigned char>(text[pos]) & 0xc0) == 0x80) {
+					--pos;
+				}
+				++characterOffset;
+			}
+		}
+		return pos;
+	}
+	int SCI_METHOD GetCharacterAndWidth(Sci_Position position, Sci_Position *pWidth) const noexcept override {
+		const Sci_Position length = Length();
+		int ch = static_cast<unsigned char>(text[position]);
+		Sci_Position width = 1;
+		if (ch >= 0xc2 && ch < 0xf5) {
+			const Sci_Position count = (ch < 0xe0) ? 2 : ((ch < 0xf0) ? 3 : 4);
+			if (position + count <= length) {
+				int value = ch & (0x7f >> count);
+				Sci_Position index = 1;
+				for (; index < count; index++) {
+					const unsigned char trail = text[position + index];
+					if ((trail & 0xc0) != 0x80) {
+						break;
+					}
+					value = (value << 6) | (trail & 0x3f);
+				}
+				if (index == count) {
+					ch = value;
+					width = count;
+				}
+			}
+		}
+		if (pWidth) {
+			*pWidth = width;
+		}
+		return ch;
+	}
+	Scintilla::CharacterClass SCI_METHOD GetCharacterClass(unsigned int character) const noexcept override {
+		if (character >= 0x80) {
+			return Scintilla::CharacterClass::word;
+		}
+		if (character == '\r' || character == '\n') {
+			return Scintilla::CharacterClass::newLine;
+		}
+		if (character <= ' ') {
+			return Scintilla::CharacterClass::space;
+		}
+		if ((character >= '0' && character <= '9') || ((character | 0x20) >= 'a' && (character | 0x20) <= 'z') || character == '_') {
+			return Scintilla::CharacterClass::word;
+		}
+		return Scintilla::CharacterClass::punctuation;
+	}
+};
+
+// files relative to repository root, "dir/*.ext" matches files with the extension in dir.
+struct CorpusEntry {
+	int language;
+	const char *name;
+	const char *files[4];
+};
+
+const CorpusEntry corpusList[] = {
+	{ SCLEX_CPP, "cpp", { "scintilla/src/*.cxx", "scintilla/lexers/*.cxx", "src/*.cpp", "tools/lang/CPP.cpp" } },
+	{ SCLEX_PYTHON, "python", { "scintilla/scripts/*.py", "tools/*.py", "build/*.py", "tools/lang/Python.py" } },
+	{ SCLEX_HTML, "hypertext", { "doc/*.html", "doc/utf8-dfa/*.html", "tools/lang/html.html" } },
+	{ SCLEX_PHPSCRIPT, "php", { "tools/lang/PHP.php" } },
+	{ SCLEX_XML, "xml", { "build/VisualStudio/*.vcxproj", "build/VisualStudio/*.filters", "tools/lang/XML.xml" } },
+	{ SCLEX_MARKDOWN, "markdown", { "readme.md", "doc/release.md", "FEATURE_REQUESTS.md" } },
+	{ SCLEX_BATCH, "batch", { "build/*.bat", "build/VisualStudio/*.bat", "tools/lang/Batch.bat" } },
+	{ SCLEX_BASH, "bash", { "version.sh", "tools/lang/Bash.sh" } },
+	{ SCLEX_SQL, "sql", { "tools/lang/*.sql" } },
+	{ SCLEX_MAKEFILE, "makefile", { "build/mingw/*.mk" } },
+	{ SCLEX_PROPERTIES, "props", { "doc/*.ini", "matepath/doc/*.ini" } },
+	{ SCLEX_YAML, "yaml", { "appveyor.yml", ".github/workflows/main.yml" } },
+	{ SCLEX_CSS, "css", { "tools/lang/CSS.css", "tools/lang/Less.less", "tools/lang/SCSS.scss" } },
+	{ SCLEX_JAVASCRIPT, "js", { "tools/lang/JavaScript.js", "tools/lang/TypeScript.ts" } },
+	{ SCLEX_JAVA, "java", { "tools/lang/Java.java" } },
+	{ SCLEX_CSHARP, "csharp", { "tools/lang/CSharp.cs" } },
+	{ SCLEX_GO, "go", { "tools/lang/Go.go" } },
+	{ SCLEX_RUST, "rust", { "tools/lang/Rust.rs" } },
+	{ SCLEX_LUA, "lua", { "tools/lang/Lua.lua" } },
+	{ SCLEX_PERL, "perl", { "tools/lang/Perl.pl" } },
+	{ SCLEX_RUBY, "ruby", { "tools/lang/Ruby.rb" } },
+	{ SCLEX_RLANG, "r", { "tools/lang/R.r" } },
+	{ SCLEX_POWERSHELL, "powershell", { "tools/lang/PowerShell.ps1" } },
+	{ SCLEX_VISUALBASIC, "vb", { "tools/lang/VB.NET.vb", "tools/lang/VBA.bas", "tools/lang/VBScript.vbs" } },
+	{ SCLEX_SWIFT, "swift", { "tools/lang/Swift.swift" } },
+	{ SCLEX_KOTLIN, "kotlin", { "tools/lang/Kotlin.kt" } },
+	{ SCLEX_CMAKE, "cmake", { "tools/lang/CMake.cmake" } },
+};
+
+bool ReadFile(const std::filesystem::path &path, std::string &text) {
+	FILE *fp = fopen(path.string().c_str(), "rb");
+	if (fp == nullptr) {
+		return false;
+	}
+	char buffer[16*1024];
+	size_t length;
+	while ((length = fread(buffer, 1, sizeof(buffer), fp)) != 0) {
+		text.append(buffer, length);
+	}
+	fclose(fp);
+	return true;
+}
+
+// concatenate corpus files in sorted order, then repeat them to reach minimum size.
+std::string LoadCorpus(const std::filesystem::path &root, const CorpusEntry &entry, size_t minSize) {
+	std::vector<std::filesystem::path> paths;
+	for (const char *pattern : entry.files) {
+		if (pattern == nullptr) {
+			break;
+		}
+		const std::string_view sv{pattern};
+		const size_t star = sv.find("/*.");
+		if (star == std::string_view::npos) {
+			paths.push_back(root / sv);
+			continue;
+		}
+		const std::filesystem::path dir = root / sv.substr(0, star);
+		const std::string_view ext = sv.substr(star + 2);
+		std::vector<std::filesystem::path> found;
+		std::error_code ec;
+		for (const auto &item : std::filesystem::directory_iterator(dir, ec)) {
+			if (item.is_regular_file() && item.path().extension() == ext) {
+				found.push_back(item.path());
+			}
+		}
+		std::sort(found.begin(), found.end());
+		paths.insert(paths.end(), found.begin(), found.end());
+	}
+
+	std::string text;
+	for (const auto &path : paths) {
+		if (ReadFile(path, text) && !text.empty() && text.back() != '\n') {
+			text.push_back('\n');
+		}
+	}
+	if (!text.empty()) {
+		const size_t unit = text.length();
+		while (text.length() < minSize) {
+			text.append(text, 0, unit);
+		}
+	}
+	return text;
+}
+
+struct BenchResult {
+	const char *name;
+	double mbps;
+	size_t allocations;
+	size_t bytes;
+};
+
+BenchResult RunLexer(const CorpusEntry &entry, BenchDocument &doc, int rounds) {
+	const LexerModule *module = LexerModule::Find(entry.language);
+	Scintilla::ILexer5 *lexer = module->Create();
+	lexer->PropertySet("fold", "1");
+	const Sci_Position length = doc.Length();
+	double best = 0;
+	BenchResult result{ entry.name, 0, 0, 0 };
+	for (int round = 0; round < rounds; round++) {
+		doc.Reset();
+		const size_t count = allocationCount;
+		const size_t bytes = allocationBytes;
+		const auto start = std::chrono::steady_clock::now();
+		lexer->Lex(0, length, 0, &doc);
+		lexer->Fold(0, length, 0, &doc);
+		const auto end = std::chrono::steady_clock::now();
+		const double duration = std::chrono::duration<double>(end - start).count();
+		if (round == 0 || duration < best) {
+			best = duration;
+		}
+		result.allocations = allocationCount - count;
+		result.bytes = allocationBytes - bytes;
+	}
+	lexer->Release();
+	if (doc.EndStyled() != length) {
+		printf("%-12s styled to %zd of %zd\n", entry.name, static_cast<size_t>(doc.EndStyled()), static_cast<size_t>(length));
+	}
+	result.mbps = (best > 0) ? length / best / (1024*1024) : 0;
+	return result;
+}
+
+bool Selected(const CorpusEntry &entry, const std::vector<std::string_view> &names) noexcept {
+	return names.empty() || std::find(names.begin(), names.end(), entry.name) != names.end();
+}
+
+}
+
+int main(int argc, char *argv[]) {
+	std::filesystem::path root{"../.."};
+	size_t minSize = 8;
+	int rounds = 5;
+	const char *savePath = nullptr;
+	const char *checkPath = nullptr;
+	double threshold = 10;
+	std::vector<std::string_view> names;
+	for (int i = 1; i < argc; i++) {
+		const std::string_view arg{argv[i]};
+		if (i + 1 < argc && arg[0] == '-') {
+			const char *value = argv[++i];
+			if (arg == "-root") {
+				root = value;
+			} else if (arg == "-size") {
+				minSize = strtoul(value, nullptr, 10);
+			} else if (arg == "-rounds") {
+				rounds = std::max(1, atoi(value));
+			} else if (arg == "-save") {
+				savePath = value;
+			} else if (arg == "-check") {
+				checkPath = value;
+			} else if (arg == "-threshold") {
+				threshold = atof(value);
+			} else {
+				printf("unknown option %s\n", argv[i - 1]);
+				return 2;
+			}
+		} else {
+			names.push_back(arg);
+		}
+	}
+
+	std::vector<BenchResult> results;
+	printf("%-12s %10s %10s %12s %14s\n", "lexer", "size", "MB/s", "allocations", "bytes");
+	for (const CorpusEntry &entry : corpusList) {
+		if (!Selected(entry, names)) {
+			continue;
+		}
+		std::string text = LoadCorpus(root, entry, minSize*1024*1024);
+		if (text.empty()) {
+			printf("%-12s no corpus file under %s\n", entry.name, root.string().c_str());
+			continue;
+		}
+		BenchDocument doc{std::move(text)};
+		const BenchResult result = RunLexer(entry, doc, rounds);
+		printf("%-12s %10zu %10.2f %12zu %14zu\n", result.name, static_cast<size_t>(doc.Length()), result.mbps, result.allocations, result.bytes);
+		results.push_back(result);
+	}
+
+	int status = 0;
+	if (checkPath) {
+		FILE *fp = fopen(checkPath, "r");
+		if (fp == nullptr) {
+			printf("cannot read baseline %s\n", checkPath);
+			return 2;
+		}
+		char name[64];
+		double baseline;
+		while (fscanf(fp, "%63s %lf", name, &baseline) == 2) {
+			for (const BenchResult &result : results) {
+				if (strcmp(result.name, name) == 0 && result.mbps < baseline * (1 - threshold/100)) {
+					printf("regression %-12s %.2f MB/s, baseline %.2f MB/s\n", name, result.mbps, baseline);
+					status = 1;
+				}
+			}
+		}
+		fclose(fp);
+	}
+	if (savePath) {
+		FILE *fp = fopen(savePath, "w");
+		if (fp == nullptr) {
+			printf("cannot write baseline %s\n", savePath);
+			return 2;
+		}
+		for (const BenchResult &result : results) {
+			fprintf(fp, "%s %.2f\n", result.name, result.mbps);
+		}
+		fclose(fp);
+	}
+	return status;
+}
@@ -3,4043 +3,4101 @@
 #pragma once
 
 //LaTeX hash++Autogenerated -- start of section automatically generated
-#define LaTeXMinInitialCharacter	'0'
-#define LaTeXMaxInitialCharacter	'z'
-#define LaTeXDoubleCharacterCount	23
-#define LaTeXHashBit		15
-#define LaTeXHashMask		0x7fff
-#define LaTeXLengthBit		6
-#define LaTeXLengthMask		63
-#define LaTeXFirstSubCharacter	'!'
-#define LaTeXFirstSubBit		6
-#define LaTeXFirstSubMask		63
-#define LaTeXSecondSubCharacter	'-'
-#define LaTeXSecondSubBit		3
-#define LaTeXSecondSubMask		7
+static constexpr uint32_t PerfectHashBasis = 0x811c9dc5;
+static constexpr uint32_t PerfectHashPrime = 0x01000193;
+static constexpr uint32_t PerfectHashMixMultiplier = 0x9e3779b1;
 
-static const uint32_t LaTeXIndexTable[] = {
-0x00180017, 0x00220018, 0x00240022, 0x00270024, 0x00280027, 0x002a0028, 0x00000000, 0x002b002a, 0x00000000, 0x00000000,
-0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0031002b, 0x00340031, 0x00390034,
-0x00490039, 0x004f0049, 0x0050004f, 0x00520050, 0x00530052, 0x00550053, 0x00000000, 0x00570055, 0x006e0057, 0x0070006e,
-0x007d0070, 0x0082007d, 0x00880082, 0x00890088, 0x009c0089, 0x00a7009c, 0x00ac00a7, 0x00b300ac, 0x00b800b3, 0x00000000,
-0x00b900b8, 0x00ba00b9, 0x00bc00ba, 0x00000000, 0x00000000, 0x00000000, 0x010400bc, 0x012a0104, 0x00000000, 0x0146012a,
-0x04270146, 0x04700427, 0x04bd0470, 0x04ed04bd, 0x053004ed, 0x05570530, 0x056b0557, 0x0632056b, 0x06350632, 0x06380635,
-0x06ad0638, 0x06df06ad, 0x074706df, 0x076e0747, 0x07a2076e, 0x07a607a2, 0x07ee07a6, 0x08e507ee, 0x096608e5, 0x09960966,
-0x09ce0996, 0x09e109ce, 0x09e409e1, 0x09e609e4, 0x09e709e6,
-};
-
-static const uint16_t LaTeXOffsetTable[] = {
-0x0000, 0x0004, 0x002c, 0x0034, 0x0040, 0x0044, 0x0000, 0x004c, 0x0000, 0x0000,
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0050, 0x006f, 0x007f,
-0x0099, 0x0155, 0x017a, 0x017f, 0x018a, 0x018c, 0x0000, 0x0194, 0x01a0, 0x02be,
-0x02ce, 0x0396, 0x03ab, 0x03ca, 0x03ce, 0x04be, 0x0502, 0x0519, 0x0560, 0x0000,
-0x057e, 0x0581, 0x0585, 0x0000, 0x0000, 0x0000, 0x058f, 0x0699, 0x0000, 0x071c,
-0x07eb, 0x1e54, 0x214a, 0x2446, 0x25fb, 0x27b6, 0x28c8, 0x298d, 0x2eb1, 0x2ec4,
-0x2ede, 0x33f1, 0x3615, 0x3a49, 0x3bba, 0x3d7d, 0x3da3, 0x40e2, 0x4871, 0x4c39,
-0x4e58, 0x50ad, 0x5195, 0x51a1, 0x51aa,
+static const uint16_t LaTeXHashSeedTable[] = {
+0x0000, 0x0000, 0x0004, 0x0006, 0x0000, 0x0000, 0x0037, 0x000b, 0x0003, 0x0024,
+0x0001, 0x000d, 0x0005, 0x0000, 0x0000, 0x000d, 0x0000, 0x0009, 0x0002, 0x0000,
+0x0018, 0x0002, 0x0004, 0x0000, 0x0042, 0x0000, 0x0002, 0x0012, 0x0000, 0x0026,
+0x001a, 0x0006, 0x0001, 0x0024, 0x001b, 0x0039, 0x0010, 0x0005, 0x001e, 0x0004,
+0x0012, 0x0005, 0x0007, 0x0001, 0x0003, 0x0008, 0x0017, 0x0004, 0x0003, 0x001f,
+0x0000, 0x0005, 0x0033, 0x0000, 0x000b, 0x0006, 0x0003, 0x0000, 0x0003, 0x0000,
+0x0004, 0x0024, 0x0011, 0x0001, 0x0002, 0x0012, 0x0001, 0x0007, 0x0000, 0x0000,
+0x0006, 0x0036, 0x0000, 0x0000, 0x0007, 0x0002, 0x0012, 0x0010, 0x0002, 0x0014,
+0x001a, 0x0001, 0x002c, 0x0008, 0x0006, 0x000a, 0x0003, 0x0003, 0x0008, 0x0015,
+0x000d, 0x0008, 0x0009, 0x0002, 0x0000, 0x0029, 0x0000, 0x002f, 0x0002, 0x0007,
+0x0025, 0x0002, 0x0002, 0x0019, 0x0009, 0x0008, 0x000d, 0x0006, 0x000c, 0x0020,
+0x0000, 0x0002, 0x0001, 0x0070, 0x000e, 0x0000, 0x0001, 0x0006, 0x0000, 0x001d,
+0x0027, 0x0000, 0x0003, 0x000c, 0x0001, 0x0005, 0x006d, 0x0011, 0x0002, 0x0010,
+0x0031, 0x0007, 0x0041, 0x001a, 0x0002, 0x000f, 0x0001, 0x0004, 0x000b, 0x0037,
+0x000f, 0x0012, 0x0001, 0x0003, 0x0021, 0x0004, 0x0000, 0x0000, 0x0005, 0x0013,
+0x0013, 0x001f, 0x001d, 0x0002, 0x0024, 0x0027, 0x0006, 0x0019, 0x0000, 0x0003,
+0x0000, 0x0002, 0x000b, 0x0002, 0x000f, 0x001c, 0x0000, 0x0092, 0x0008, 0x0001,
+0x0000, 0x0000, 0x0000, 0x0007, 0x0030, 0x0026, 0x0016, 0x0000, 0x0000, 0x0017,
+0x0008, 0x0008, 0x001d, 0x0014, 0x001c, 0x0015, 0x0002, 0x0001, 0x0020, 0x0000,
+0x0001, 0x0003, 0x0008, 0x0042, 0x0009, 0x0010, 0x000c, 0x0001, 0x0019, 0x0009,
+0x008e, 0x0000, 0x002b, 0x00b6, 0x0010, 0x0000, 0x001d, 0x006f, 0x000a, 0x0000,
+0x0011, 0x000e, 0x0013, 0x00af, 0x0016, 0x0002, 0x001c, 0x0001, 0x0018, 0x0000,
+0x0003, 0x001a, 0x0009, 0x000b, 0x008d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002,
+0x0000, 0x0032, 0x0007, 0x0027, 0x000d, 0x0045, 0x0002, 0x0003, 0x0007, 0x0003,
+0x001f, 0x0037, 0x000e, 0x0000, 0x0078, 0x0000, 0x0000, 0x0000, 0x000a, 0x0008,
+0x0006, 0x002e, 0x00a0, 0x0006, 0x0001, 0x0006, 0x0026, 0x0005, 0x0042, 0x0003,
+0x0049, 0x0020, 0x0000, 0x0010, 0x0007, 0x0001, 0x0000, 0x0011, 0x002a, 0x0003,
+0x0019, 0x0006, 0x0000, 0x001d, 0x0008, 0x0003, 0x0004, 0x0000, 0x0000, 0x0000,
+0x0000, 0x000a, 0x0000, 0x0049, 0x000b, 0x0001, 0x0005, 0x0004, 0x0007, 0x0008,
+0x0001, 0x0003, 0x0006, 0x0086, 0x0004, 0x0002, 0x0002, 0x0000, 0x003f, 0x0040,
+0x0006, 0x0005, 0x0017, 0x0019, 0x0003, 0x002b, 0x0024, 0x0008, 0x000f, 0x0000,
+0x0002, 0x0000, 0x001c, 0x0000, 0x0004, 0x0003, 0x000e, 0x0010, 0x0011, 0x0005,
+0x0016, 0x003f, 0x0000, 0x0004, 0x0000, 0x0004, 0x0060, 0x000b, 0x003a, 0x0000,
+0x0032, 0x0005, 0x002a, 0x000b, 0x002b, 0x0000, 0x0000, 0x000d, 0x0017, 0x0017,
+0x0061, 0x0000, 0x0020, 0x0047, 0x0003, 0x0015, 0x001a, 0x0017, 0x0005, 0x0007,
+0x002c, 0x0008, 0x000a, 0x00b4, 0x0001, 0x0023, 0x000a, 0x0014, 0x0000, 0x003f,
+0x0009, 0x0013, 0x0007, 0x0000, 0x0000, 0x0011, 0x0001, 0x0001, 0x001d, 0x0022,
+0x0001, 0x0013, 0x006c, 0x0026, 0x0004, 0x000f, 0x002f, 0x0000, 0x000e, 0x0004,
+0x0016, 0x0008, 0x0081, 0x0003, 0x0032, 0x0009, 0x0001, 0x002b, 0x0025, 0x0000,
+0x0004, 0x0003, 0x000a, 0x0031, 0x0000, 0x0007, 0x0005, 0x0000, 0x000f, 0x001e,
+0x0000, 0x0026, 0x0030, 0x0011, 0x000c, 0x0000, 0x0017, 0x0000, 0x0040, 0x0000,
+0x0001, 0x0002, 0x001f, 0x001e, 0x0002, 0x0000, 0x0004, 0x0000, 0x003d, 0x0017,
+0x0000, 0x000b, 0x0020, 0x0000, 0x0003, 0x0009, 0x0046, 0x0006, 0x0006, 0x0017,
+0x0019, 0x0033, 0x0001, 0x0000, 0x0000, 0x0020, 0x0011, 0x0001, 0x0054, 0x0070,
+0x004b, 0x000f, 0x000f, 0x0000, 0x006f, 0x0022, 0x0014, 0x0007, 0x0001, 0x0013,
+0x0000, 0x0073, 0x0003, 0x000d, 0x000a, 0x0000, 0x0005, 0x0009, 0x001b, 0x0026,
+0x002b, 0x001f, 0x0002, 0x0021, 0x0013, 0x0027, 0x0000, 0x0026, 0x0057, 0x0096,
+0x003b, 0x002b, 0x0075, 0x0002, 0x0007, 0x0052, 0x0018, 0x0000, 0x0000, 0x0004,
+0x0000, 0x0000, 0x0051, 0x0017, 0x0012, 0x0000, 0x0000, 0x0002, 0x0038, 0x0002,
+0x0000, 0x0054, 0x0003, 0x0000, 0x000e, 0x0011, 0x008b, 0x0005, 0x000a, 0x0000,
+0x0001, 0x0005, 0x0050, 0x0002, 0x0000, 0x000e, 0x006e, 0x0000, 0x00e4, 0x0014,
+0x002f, 0x0073, 0x0001, 0x0002, 0x0054, 0x0068, 0x0000, 0x000e, 0x0034, 0x0001,
+0x003f, 0x0006, 0x0053, 0x0004, 0x0000, 0x0079, 0x0008, 0x0128, 0x0000, 0x0000,
+0x001e, 0x0001, 0x0000, 0x0044, 0x0020, 0x0012, 0x0024, 0x0007, 0x0000, 0x0026,
+0x0010, 0x0005, 0x0028, 0x0003, 0x0007, 0x0018, 0x00f8, 0x0001, 0x0004, 0x0003,
+0x002d, 0x008b, 0x0024, 0x0090, 0x00d3, 0x0012, 0x0008, 0x0019, 0x0002, 0x0002,
+0x010f, 0x00a1, 0x000c, 0x000b, 0x0017, 0x0000, 0x0028, 0x00b0, 0x00ae, 0x0036,
+0x00cd, 0x0027, 0x0000, 0x0002, 0x0003, 0x0006, 0x0001, 0x0051, 0x018b, 0x003c,
+0x0004, 0x004b, 0x0000, 0x0002, 0x0025, 0x0002, 0x0008, 0x0033, 0x002c, 0x0000,
+0x0000, 0x001a, 0x0014, 0x0003, 0x005d, 0x000d, 0x0026, 0x0071, 0x0071, 0x0000,
+0x0056, 0x000a, 0x0009, 0x001a, 0x0003, 0x0004, 0x0083, 0x002a, 0x0087, 0x00a7,
+0x00f3, 0x0008, 0x0003, 0x0014, 0x0005, 0x000e, 0x0004, 0x0087, 0x0000, 0x002b,
+0x0041, 0x0001, 0x0080, 0x0001, 0x0040, 0x0040, 0x0000, 0x000d, 0x0001, 0x0000,
+0x0002, 0x000e, 0x0080, 0x0016, 0x0000, 0x000d, 0x0007, 0x0005, 0x0166, 0x001a,
+0x0009, 0x0008, 0x0000, 0x0024, 0x0082, 0x00bb, 0x000b, 0x0003, 0x004a, 0x0000,
+0x0003, 0x00a3, 0x000e, 0x0048, 0x0052, 0x0007, 0x0048, 0x00b5, 0x0000, 0x0008,
+0x000f, 0x000a, 0x002f, 0x000d, 0x00ba, 0x0016, 0x0001, 0x0011, 0x0001, 0x0009,
+0x0123, 0x0022, 0x000c, 0x0105, 0x005d, 0x017c, 0x0009, 0x00fa, 0x0003, 0x007e,
+0x023b, 0x0007, 0x0014, 0x0027, 0x009e, 0x0000, 0x0005, 0x0000, 0x0042, 0x0027,
+0x0017, 0x0000, 0x000b, 0x005a, 0x0035, 0x0040, 0x0019, 0x0018, 0x0103, 0x00ad,
+0x000d, 0x0017, 0x0009, 0x00a8, 0x0001, 0x009b, 0x0007, 0x0013, 0x045d, 0x0001,
+0x0133, 0x0000, 0x001c, 0x0000, 0x0004, 0x0012, 0x0003, 0x0010, 0x0000, 0x007c,
+0x02f2, 0x00bf, 0x0000, 0x0000, 0x0004, 0x0006, 0x0003, 0x0008, 0x0094, 0x003d,
+0x000e, 0x001d, 0x0002, 0x0054, 0x000a, 0x010d, 0x0007, 0x0075, 0x0006, 0x0044,
+0x0001, 0x0069, 0x01e5, 0x0003, 0x0015, 0x00b1, 0x0066, 0x0014, 0x039f, 0x0150,
+0x0017, 0x00fa, 0x004c, 0x00aa, 0x0032, 0x01c1, 0x0008, 0x0002, 0x00fb, 0x0001,
+0x0014, 0x0004, 0x000d, 0x004e, 0x0027, 0x005c, 0x0014, 0x00ff, 0x0000, 0x042d,
+0x0008, 0x0175, 0x0245, 0x0000, 0x0000, 0x000d, 0x0109, 0x0056, 0x00fc, 0x000a,
+0x002d, 0x0005, 0x003e, 0x00f6, 0x0071, 0x004e, 0x0002, 0x0057, 0x0006, 0x0004,
+0x004a, 0x005d, 0x0000, 0x0024, 0x0002, 0x001f, 0x004e, 0x009f, 0x0000, 0x0038,
+0x000a, 0x070b, 0x07c8, 0x00d5, 0x0101, 0x0003, 0x0002, 0x003f, 0x0311, 0x02a6,
+0x0052, 0x000a, 0x0007, 0x018f, 0x0000, 0x0053, 0x0006, 0x012b, 0x01b5, 0x014c,
+0x0039, 0x0000, 0x0011, 0x0030, 0x00bd, 0x0017, 0x0015, 0x0103, 0x02f2, 0x0076,
+0x0020, 0x0023, 0x00a6, 0x0738, 0x0000, 0x001f, 0x05ea,
 };
 //LaTeX hash--Autogenerated -- end of section automatically generated
 
-static const uint32_t LaTeXInputSequenceList[] = {
+static const InputSequence LaTeXInputSequenceList[] = {
 //LaTeX list++Autogenerated -- start of section automatically generated
-0x0338'2242, // ≂̸, \neqsim, Minus Tilde + Combining Long Solidus Overlay / Non-Spacing Long Slash Overlay
-0x0338'224E, // ≎̸, \nBumpeq, Geometrically Equivalent To + Combining Long Solidus Overlay / Non-Spacing Long Slash Overlay
-0x0338'224F, // ≏̸, \nbumpeq, Difference Between + Combining Long Solidus Overlay / Non-Spacing Long Slash Overlay
-0xFE00'2268, // ≨︀, \lvertneqq, Less-Than But Not Equal To / Less Than But Not Equal To + Variation Selector-1
-0xFE00'2269, // ≩︀, \gvertneqq, Greater-Than But Not Equal To / Greater Than But Not Equal To + Variation Selector-1
-0x0338'226A, // ≪̸, \NotLessLess, Much Less-Than / Much Less Than + Combining Long Solidus Overlay / Non-Spacing Long Slash Overlay
-0x0338'226B, // ≫̸, \NotGreaterGreater, Much Greater-Than / Much Greater Than + Combining Long Solidus Overlay / Non-Spacing Long Slash Overlay
-0x0338'227E, // ≾̸, \nprecsim, Precedes Or Equivalent To + Combining Long Solidus Overlay / Non-Spacing Long Slash Overlay
-0x0338'227F, // ≿̸, \nsuccsim, Succeeds Or Equivalent To + Combining Long Solidus Overlay / Non-Spacing Long Slash Overlay
-0xFE00'228A, // ⊊︀, \varsubsetneqq, Subset Of With Not Equal To / Subset Of Or Not Equal To + Variation Selector-1
-0xFE00'228B, // ⊋︀, \varsupsetneq, Superset Of With Not Equal To / Superset Of Or Not Equal To + Variation Selector-1
-0x0338'228F, // ⊏̸, \NotSquareSubset, Square Image Of + Combining Long Solidus Overlay / Non-Spacing Long Slash Overlay
-0x0338'2290, // ⊐̸, \NotSquareSuperset, Square Original Of + Combining Long Solidus Overlay / Non-Spacing Long Slash Overlay
-0x0338'29CF, // ⧏̸, \NotLeftTriangleBar, Left Triangle Beside Vertical Bar + Combining Long Solidus Overlay / Non-Spacing Long Slash Overlay
-0x0338'29D0, // ⧐̸, \NotRightTriangleBar, Vertical Bar Beside Right Triangle + Combining Long Solidus Overlay / Non-Spacing Long Slash Overlay
-0x0338'2A7D, // ⩽̸, \nleqslant, Less-Than Or Slanted Equal To + Combining Long Solidus Overlay / Non-Spacing Long Slash Overlay
-0x0338'2A7E, // ⩾̸, \ngeqslant, Greater-Than Or Slanted Equal To + Combining Long Solidus Overlay / Non-Spacing Long Slash Overlay
-0x0338'2AA1, // ⪡̸, \NotNestedLessLess, Double Nested Less-Than + Combining Long Solidus Overlay / Non-Spacing Long Slash Overlay
-0x0338'2AA2, // ⪢̸, \NotNestedGreaterGreater, Double Nested Greater-Than + Combining Long Solidus Overlay / Non-Spacing Long Slash Overlay
-0x0338'2AAF, // ⪯̸, \npreceq, Precedes Above Single-Line Equals Sign + Combining Long Solidus Overlay / Non-Spacing Long Slash Overlay
-0x0338'2AB0, // ⪰̸, \nsucceq, Succeeds Above Single-Line Equals Sign + Combining Long Solidus Overlay / Non-Spacing Long Slash Overlay
-0x0338'2AC5, // ⫅̸, \nsubseteqq, Subset Of Above Equals Sign + Combining Long Solidus Overlay / Non-Spacing Long Slash Overlay
-0x0338'2AC6, // ⫆̸, \nsupseteqq, Superset Of Above Equals Sign + Combining Long Solidus Overlay / Non-Spacing Long Slash Overlay
-0x10c4a484, // U+02189 ↉, \0/3, Vulgar Fraction Zero Thirds
-0x10af8383, // U+0215F ⅟, \1/, Fraction Numerator One
-0x10a943c5, // U+02152 ⅒, \1/10, Vulgar Fraction One Tenth
-0x005ea444, // U+000BD ½, \1/2, Vulgar Fraction One Half / Fraction One Half
-0x10a9a484, // U+02153 ⅓, \1/3, Vulgar Fraction One Third / Fraction One Third
-0x005e24c4, // U+000BC ¼, \1/4, Vulgar Fraction One Quarter / Fraction One Quarter
-0x10aaa504, // U+02155 ⅕, \1/5, Vulgar Fraction One Fifth / Fraction One Fifth
-0x10aca544, // U+02159 ⅙, \1/6, Vulgar Fraction One Sixth / Fraction One Sixth
-0x10a82584, // U+02150 ⅐, \1/7, Vulgar Fraction One Seventh
-0x10ada5c4, // U+0215B ⅛, \1/8, Vulgar Fraction One Eighth / Fraction One Eighth
-0x10a8a604, // U+02151 ⅑, \1/9, Vulgar Fraction One Ninth
-0x10aa2484, // U+02154 ⅔, \2/3, Vulgar Fraction Two Thirds / Fraction Two Thirds
-0x10ab2504, // U+02156 ⅖, \2/5, Vulgar Fraction Two Fifths / Fraction Two Fifths
-0x005f24c4, // U+000BE ¾, \3/4, Vulgar Fraction Three Quarters / Fraction Three Quarters
-0x10aba504, // U+02157 ⅗, \3/5, Vulgar Fraction Three Fifths / Fraction Three Fifths
-0x10ae25c4, // U+0215C ⅜, \3/8, Vulgar Fraction Three Eighths / Fraction Three Eighths
-0x10ac2504, // U+02158 ⅘, \4/5, Vulgar Fraction Four Fifths / Fraction Four Fifths
-0x10ad2544, // U+0215A ⅚, \5/6, Vulgar Fraction Five Sixths / Fraction Five Sixths
-0x10aea5c4, // U+0215D ⅝, \5/8, Vulgar Fraction Five Eighths / Fraction Five Eighths
-0x10af25c4, // U+0215E ⅞, \7/8, Vulgar Fraction Seven Eighths / Fraction Seven Eighths
-0x00628803, // U+000C5 Å, \AA, Latin Capital Letter A With Ring Above / Latin Capital Letter A Ring
-0x00630903, // U+000C6 Æ, \AE, Latin Capital Letter Ae / Latin Capital Letter A E
-0x01c8b006, // U+00391 Α, \Alpha, Greek Capital Letter Alpha
-0x152990c4, // U+02A53 ⩓, \And, Double Logical And
-0x14ce7106, // U+0299C ⦜, \Angle, Right Angle Variant With Square
-0x1095a309, // U+0212B Å, \Angstrom, Angstrom Sign / Angstrom Unit
-0x01c97005, // U+00392 Β, \Beta, Greek Capital Letter Beta
-0x1575a4c4, // U+02AEB ⫫, \Bot, Double Up Tack
-0x11270407, // U+0224E ≎, \Bumpeq, Geometrically Equivalent To
-0x116943c4, // U+022D2 ⋒, \Cap, Double Intersection
-0x01d3b204, // U+003A7 Χ, \Chi, Greek Capital Letter Chi
-0x111ba346, // U+02237 ∷, \Colon, Proportion
-0x153a0408, // U+02A74 ⩴, \Coloneq, Double Colon Equal
-0x116983c4, // U+022D3 ⋓, \Cup, Double Union
-0x13f8a58b, // U+027F1 ⟱, \DDownarrow, Downwards Quadruple Arrow
-0x006809c3, // U+000D0 Ð, \DH, Latin Capital Letter Eth
-0x00880a43, // U+00110 Đ, \DJ, Latin Capital Letter D With Stroke / Latin Capital Letter D Bar
-0x15723546, // U+02AE4 ⫤, \Dashv, Vertical Bar Double Left Turnstile
-0x1485a58b, // U+0290B ⤋, \Ddownarrow, Downwards Triple Arrow
-0x01ca7006, // U+00394 Δ, \Delta, Greek Capital Letter Delta
-0x01ee0008, // U+003DC Ϝ, \Digamma, Greek Letter Digamma / Greek Capital Letter Digamma
-0x11288406, // U+02251 ≑, \Doteq, Geometrically Equal To
-0x1489c44d, // U+02913 ⤓, \DownArrowBar, Downwards Arrow To Bar
-0x10faa591, // U+021F5 ⇵, \DownArrowUpArrow, Downwards Arrow Leftwards Of Upwards Arrow
-0x14a82454, // U+02950 ⥐, \DownLeftRightVector, Left Barb Down Right Barb Down Harpoon
-0x14af2452, // U+0295E ⥞, \DownLeftTeeVector, Leftwards Harpoon With Barb Down From Bar
-0x14ab4452, // U+02956 ⥖, \DownLeftVectorBar, Leftwards Harpoon With Barb Down To Bar
-0x14afa453, // U+0295F ⥟, \DownRightTeeVector, Rightwards Harpoon With Barb Down From Bar
-0x14abc453, // U+02957 ⥗, \DownRightVectorBar, Rightwards Harpoon With Barb Down To Bar
-0x10e9a58a, // U+021D3 ⇓, \Downarrow, Downwards Double Arrow / Down Double Arrow
-0x152b2445, // U+02A56 ⩖, \ElOr, Two Intersecting Logical Or
-0x14c31188, // U+02986 ⦆, \Elroang, Right White Parenthesis
-0x01caa348, // U+00395 Ε, \Epsilon, Greek Capital Letter Epsilon
-0x153ac2c6, // U+02A75 ⩵, \Equal, Two Consecutive Equals Signs
-0x1131c546, // U+02263 ≣, \Equiv, Strictly Equivalent To
-0x01cbf004, // U+00397 Η, \Eta, Greek Capital Letter Eta
-0x10991545, // U+02132 Ⅎ, \Finv, Turned Capital F / Turned F
-0x10a08105, // U+02141 ⅁, \Game, Turned Sans-Serif Capital G
-0x01c98006, // U+00393 Γ, \Gamma, Greek Capital Letter Gamma
-0x018589c2, // U+0030B ̋, \H, Combining Double Acute Accent / Non-Spacing Double Acute
-0x10888303, // U+02111 ℑ, \Im, Black-Letter Capital I / Black-Letter I
-0x01ccf005, // U+00399 Ι, \Iota, Greek Capital Letter Iota
-0x01cd3006, // U+0039A Κ, \Kappa, Greek Capital Letter Kappa
-0x01ef3006, // U+003DE Ϟ, \Koppa, Greek Letter Koppa / Greek Capital Letter Koppa
-0x00a08ac2, // U+00141 Ł, \L, Latin Capital Letter L With Stroke / Latin Capital Letter L Slash
-0x15a2a58b, // U+02B45 ⭅, \LLeftarrow, Leftwards Quadruple Arrow
-0x01cdf007, // U+0039B Λ, \Lambda, Greek Capital Letter Lamda / Greek Capital Letter Lambda
-0x14e543c4, // U+029CA ⧊, \Lap, Triangle With Dot Above
-0x10d961c5, // U+021B2 ↲, \Ldsh, Downwards Arrow With Tip Leftwards / Down Arrow With Tip Left
-0x14b0a452, // U+02961 ⥡, \LeftDownTeeVector, Downwards Harpoon With Barb Left From Bar
-0x14acc452, // U+02959 ⥙, \LeftDownVectorBar, Downwards Harpoon With Barb Left To Bar
-0x14a72450, // U+0294E ⥎, \LeftRightVector, Left Barb Up Right Barb Up Harpoon
-0x14ad244e, // U+0295A ⥚, \LeftTeeVector, Leftwards Harpoon With Barb Up From Bar
-0x14e7c450, // U+029CF ⧏, \LeftTriangleBar, Left Triangle Beside Vertical Bar
-0x14a8a451, // U+02951 ⥑, \LeftUpDownVector, Up Barb Left Down Barb Left Harpoon
-0x14b02450, // U+02960 ⥠, \LeftUpTeeVector, Upwards Harpoon With Barb Left From Bar
-0x14ac4450, // U+02958 ⥘, \LeftUpVectorBar, Upwards Harpoon With Barb Left To Bar
-0x14a9444e, // U+02952 ⥒, \LeftVectorBar, Leftwards Harpoon With Barb Up To Bar
-0x10e8258a, // U+021D0 ⇐, \Leftarrow, Leftwards Double Arrow / Left Double Arrow
-0x10ea258f, // U+021D4 ⇔, \Leftrightarrow, Left Right Double Arrow
-0x10ed258b, // U+021DA ⇚, \Lleftarrow, Leftwards Triple Arrow / Left Triple Arrow
-0x13fc258e, // U+027F8 ⟸, \Longleftarrow, Long Leftwards Double Arrow
-0x13fd2593, // U+027FA ⟺, \Longleftrightarrow, Long Left Right Double Arrow
-0x13fea30d, // U+027FD ⟽, \Longmapsfrom, Long Leftwards Double Arrow From Bar
-0x13ff738b, // U+027FE ⟾, \Longmapsto, Long Rightwards Double Arrow From Bar
-0x13fca58f, // U+027F9 ⟹, \Longrightarrow, Long Rightwards Double Arrow
-0x10d861c4, // U+021B0 ↰, \Lsh, Upwards Arrow With Tip Leftwards / Up Arrow With Tip Left
-0x14832309, // U+02906 ⤆, \Mapsfrom, Leftwards Double Arrow From Bar
-0x1483f387, // U+02907 ⤇, \Mapsto, Rightwards Double Arrow From Bar
-0x00a50983, // U+0014A Ŋ, \NG, Latin Capital Letter Eng
-0x10eba588, // U+021D7 ⇗, \Nearrow, North East Double Arrow / Upper Right Double Arrow
-0x15510455, // U+02AA2 ⪢, \NestedGreaterGreater, Double Nested Greater-Than
-0x1550e48f, // U+02AA1 ⪡, \NestedLessLess, Double Nested Less-Than
-0x00030452, // U+00006 ≫̸, \NotGreaterGreater, Much Greater-Than / Much Greater Than + Combining Long Solidus Overlay / Non-Spacing Long Slash Overlay
-0x0006c453, // U+0000D ⧏̸, \NotLeftTriangleBar, Left Triangle Beside Vertical Bar + Combining Long Solidus Overlay / Non-Spacing Long Slash Overlay
-0x0002e48c, // U+00005 ≪̸, \NotLessLess, Much Less-Than / Much Less Than + Combining Long Solidus Overlay / Non-Spacing Long Slash Overlay
-0x00090458, // U+00012 ⪢̸, \NotNestedGreaterGreater, Double Nested Greater-Than + Combining Long Solidus Overlay / Non-Spacing Long Slash Overlay
-0x0008e492, // U+00011 ⪡̸, \NotNestedLessLess, Double Nested Less-Than + Combining Long Solidus Overlay / Non-Spacing Long Slash Overlay
-0x00074454, // U+0000E ⧐̸, \NotRightTriangleBar, Vertical Bar Beside Right Triangle + Combining Long Solidus Overlay / Non-Spacing Long Slash Overlay
-0x000584d0, // U+0000B ⊏̸, \NotSquareSubset, Square Image Of + Combining Long Solidus Overlay / Non-Spacing Long Slash Overlay
-0x000604d2, // U+0000C ⊐̸, \NotSquareSuperset, Square Original Of + Combining Long Solidus Overlay / Non-Spacing Long Slash Overlay
-0x10eb2588, // U+021D6 ⇖, \Nwarrow, North West Double Arrow / Upper Left Double Arrow
-0x006c0b82, // U+000D8 Ø, \O, Latin Capital Letter O With Stroke / Latin Capital Letter O Slash
-0x00a90903, // U+00152 Œ, \OE, Latin Capital Ligature Oe / Latin Capital Letter O E
-0x01d4a006, // U+003A9 Ω, \Omega, Greek Capital Letter Omega
-0x152a0443, // U+02A54 ⩔, \Or, Double Logical Or
-0x151b8487, // U+02A37 ⨷, \Otimes, Multiplication Sign In Double Circle
-0x005b0bc2, // U+000B6 ¶, \P, Pilcrow Sign / Paragraph Sign
-0x01d33204, // U+003A6 Φ, \Phi, Greek Capital Letter Phi
-0x01d00203, // U+003A0 Π, \Pi, Greek Capital Letter Pi
-0x155d8085, // U+02ABB ⪻, \Prec, Double Precedes
-0x10a5110d, // U+0214A ⅊, \PropertyLine, Property Line
-0x01d46204, // U+003A8 Ψ, \Psi, Greek Capital Letter Psi
-0x110708c4, // U+0220E ∎, \QED, End Of Proof
-0x15a3258c, // U+02B46 ⭆, \RRightarrow, Rightwards Quadruple Arrow
-0x10d9e1c5, // U+021B3 ↳, \Rdsh, Downwards Arrow With Tip Rightwards / Down Arrow With Tip Right
-0x108e0103, // U+0211C ℜ, \Re, Black-Letter Capital R / Black-Letter R
-0x14b78315, // U+0296F ⥯, \ReverseUpEquilibrium, Downwards Harpoon With Barb Left Beside Upwards Harpoon With Barb Right
-0x01d0b384, // U+003A1 Ρ, \Rho, Greek Capital Letter Rho
-0x14aea453, // U+0295D ⥝, \RightDownTeeVector, Downwards Harpoon With Barb Right From Bar
-0x14aac453, // U+02955 ⥕, \RightDownVectorBar, Downwards Harpoon With Barb Right To Bar
-0x14ada44f, // U+0295B ⥛, \RightTeeVector, Rightwards Harpoon With Barb Up From Bar
-0x14e84451, // U+029D0 ⧐, \RightTriangleBar, Vertical Bar Beside Right Triangle
-0x14a7a452, // U+0294F ⥏, \RightUpDownVector, Up Barb Right Down Barb Right Harpoon
-0x14ae2451, // U+0295C ⥜, \RightUpTeeVector, Upwards Harpoon With Barb Right From Bar
-0x14aa4451, // U+02954 ⥔, \RightUpVectorBar, Upwards Harpoon With Barb Right To Bar
-0x14a9c44f, // U+02953 ⥓, \RightVectorBar, Rightwards Harpoon With Barb Up To Bar
-0x10e9258b, // U+021D2 ⇒, \Rightarrow, Rightwards Double Arrow / Right Double Arrow
-0x14a15446, // U+02942 ⥂, \Rlarr, Rightwards Arrow Above Short Leftwards Arrow
-0x14b8048d, // U+02970 ⥰, \RoundImplies, Right Double Arrow With Rounded Head
-0x10eda58c, // U+021DB ⇛, \Rrightarrow, Rightwards Triple Arrow / Right Triple Arrow
-0x10d8e1c4, // U+021B1 ↱, \Rsh, Upwards Arrow With Tip Rightwards / Up Arrow With Tip Right
-0x14fa00cc, // U+029F4 ⧴, \RuleDelayed, Rule-Delayed
-0x00538c82, // U+000A7 §, \S, Section Sign
-0x01f03206, // U+003E0 Ϡ, \Sampi, Greek Letter Sampi / Greek Capital Letter Sampi
-0x10ec2588, // U+021D8 ⇘, \Searrow, South East Double Arrow / Lower Right Double Arrow
-0x01d18006, // U+003A3 Σ, \Sigma, Greek Capital Letter Sigma
-0x152743c6, // U+02A4E ⩎, \Sqcap, Double Square Intersection
-0x152783c6, // U+02A4F ⩏, \Sqcup, Double Square Union
-0x01ed0007, // U+003DA Ϛ, \Stigma, Greek Letter Stigma / Greek Capital Letter Stigma
-0x116804c7, // U+022D0 ⋐, \Subset, Double Subset
-0x155e6085, // U+02ABC ⪼, \Succ, Double Succeeds
-0x116884c7, // U+022D1 ⋑, \Supset, Double Superset
-0x10eca588, // U+021D9 ⇙, \Swarrow, South West Double Arrow / Lower Left Double Arrow
-0x006f09c3, // U+000DE Þ, \TH, Latin Capital Letter Thorn
-0x01d24504, // U+003A4 Τ, \Tau, Greek Capital Letter Tau
-0x01cc7006, // U+00398 Θ, \Theta, Greek Capital Letter Theta
-0x15178486, // U+02A2F ⨯, \Times, Vector Or Cross Product
-0x157523c4, // U+02AEA ⫪, \Top, Double Down Tack
-0x13f82589, // U+027F0 ⟰, \UUparrow, Upwards Quadruple Arrow
-0x1489444b, // U+02912 ⤒, \UpArrowBar, Upwards Arrow To Bar
-0x14b7030e, // U+0296E ⥮, \UpEquilibrium, Upwards Harpoon With Barb Left Beside Downwards Harpoon With Barb Right
-0x10e8a588, // U+021D1 ⇑, \Uparrow, Upwards Double Arrow / Up Double Arrow
-0x10eaa58c, // U+021D5 ⇕, \Updownarrow, Up Down Double Arrow
-0x01d2a348, // U+003A5 Υ, \Upsilon, Greek Capital Letter Upsilon
-0x14852589, // U+0290A ⤊, \Uuparrow, Upwards Triple Arrow
-0x1155e1c6, // U+022AB ⊫, \VDash, Double Vertical Bar Double Right Turnstile
-0x1154e1c6, // U+022A9 ⊩, \Vdash, Forces
-0x100b54c5, // U+02016 ‖, \Vert, Double Vertical Line / Double Vertical Bar
-0x115561c7, // U+022AA ⊪, \Vvdash, Triple Vertical Bar Right Turnstile
-0x14c054c6, // U+02980 ⦀, \Vvert, Triple Vertical Bar Delimiter
-0x01cf0203, // U+0039E Ξ, \Xi, Greek Capital Letter Xi
-0x10a203c4, // U+02144 ⅄, \Yup, Turned Sans-Serif Capital Y
-0x00dac445, // U+001B5 Ƶ, \Zbar, Latin Capital Letter Z With Stroke / Latin Capital Letter Z Bar
-0x01cb7005, // U+00396 Ζ, \Zeta, Greek Capital Letter Zeta
-0x538e8003, // U+0A71D ꜝ, \^!, Modifier Letter Raised Exclamation Mark
-0x103e81c3, // U+0207D ⁽, \^(, Superscript Left Parenthesis / Superscript Opening Parenthesis
-0x103f0203, // U+0207E ⁾, \^), Superscript Right Parenthesis / Superscript Closing Parenthesis
-0x103d0283, // U+0207A ⁺, \^+, Superscript Plus Sign
-0x103d8303, // U+0207B ⁻, \^-, Superscript Minus / Superscript Hyphen-Minus
-0x103803c3, // U+02070 ⁰, \^0, Superscript Zero / Superscript Digit Zero
-0x005c8403, // U+000B9 ¹, \^1, Superscript One / Superscript Digit One
-0x00590443, // U+000B2 ², \^2, Superscript Two / Superscript Digit Two
-0x00598483, // U+000B3 ³, \^3, Superscript Three / Superscript Digit Three
-0x103a04c3, // U+02074 ⁴, \^4, Superscript Four / Superscript Digit Four
-0x103a8503, // U+02075 ⁵, \^5, Superscript Five / Superscript Digit Five
-0x103b0543, // U+02076 ⁶, \^6, Superscript Six / Superscript Digit Six
-0x103b8583, // U+02077 ⁷, \^7, Superscript Seven / Superscript Digit Seven
-0x103c05c3, // U+02078 ⁸, \^8, Superscript Eight / Superscript Digit Eight
-0x103c8603, // U+02079 ⁹, \^9, Superscript Nine / Superscript Digit Nine
-0x103e0703, // U+0207C ⁼, \^=, Superscript Equals Sign
-0x0e960803, // U+01D2C ᴬ, \^A, Modifier Letter Capital A
-0x0e970843, // U+01D2E ᴮ, \^B, Modifier Letter Capital B
-0x0e9808c3, // U+01D30 ᴰ, \^D, Modifier Letter Capital D
-0x0e988903, // U+01D31 ᴱ, \^E, Modifier Letter Capital E
-0x0e998983, // U+01D33 ᴳ, \^G, Modifier Letter Capital G
-0x0e9a09c3, // U+01D34 ᴴ, \^H, Modifier Letter Capital H
-0x0e9a8a03, // U+01D35 ᴵ, \^I, Modifier Letter Capital I
-0x0e9b0a43, // U+01D36 ᴶ, \^J, Modifier Letter Capital J
-0x0e9b8a83, // U+01D37 ᴷ, \^K, Modifier Letter Capital K
-0x0e9c0ac3, // U+01D38 ᴸ, \^L, Modifier Letter Capital L
-0x0e9c8b03, // U+01D39 ᴹ, \^M, Modifier Letter Capital M
-0x0e9d0b43, // U+01D3A ᴺ, \^N, Modifier Letter Capital N
-0x0e9e0b83, // U+01D3C ᴼ, \^O, Modifier Letter Capital O
-0x0e9f0bc3, // U+01D3E ᴾ, \^P, Modifier Letter Capital P
-0x0e9f8c43, // U+01D3F ᴿ, \^R, Modifier Letter Capital R
-0x0ea00cc3, // U+01D40 ᵀ, \^T, Modifier Letter Capital T
-0x0ea08d03, // U+01D41 ᵁ, \^U, Modifier Letter Capital U
-0x163e8d43, // U+02C7D ⱽ, \^V, Modifier Letter Capital V
-0x0ea10d83, // U+01D42 ᵂ, \^W, Modifier Letter Capital W
-0x0ea18003, // U+01D43 ᵃ, \^a, Modifier Letter Small A
-0x0ea2b007, // U+01D45 ᵅ, \^alpha, Modifier Letter Small Alpha
-0x0ea38043, // U+01D47 ᵇ, \^b, Modifier Letter Small B
-0x0eaef006, // U+01D5D ᵝ, \^beta, Modifier Letter Small Beta
-0x0ece0083, // U+01D9C ᶜ, \^c, Modifier Letter Small C
-0x0eb0b205, // U+01D61 ᵡ, \^chi, Modifier Letter Small Chi
-0x0ea400c3, // U+01D48 ᵈ, \^d, Modifier Letter Small D
-0x0eaff007, // U+01D5F ᵟ, \^delta, Modifier Letter Small Delta
-0x538e258b, // U+0A71C ꜜ, \^downarrow, Modifier Letter Raised Down Arrow
-0x0ea48103, // U+01D49 ᵉ, \^e, Modifier Letter Small E
-0x0ea5a349, // U+01D4B ᵋ, \^epsilon, Modifier Letter Small Open E
-0x0ed00143, // U+01DA0 ᶠ, \^f, Modifier Letter Small F
-0x0ea68183, // U+01D4D ᵍ, \^g, Modifier Letter Small G
-0x0eaf0007, // U+01D5E ᵞ, \^gamma, Modifier Letter Small Greek Gamma
-0x015801c3, // U+002B0 ʰ, \^h, Modifier Letter Small H
-0x10388203, // U+02071 ⁱ, \^i, Superscript Latin Small Letter I
-0x0ed2f006, // U+01DA5 ᶥ, \^iota, Modifier Letter Small Iota
-0x01590243, // U+002B2 ʲ, \^j, Modifier Letter Small J
-0x0ea78283, // U+01D4F ᵏ, \^k, Modifier Letter Small K
-0x017082c3, // U+002E1 ˡ, \^l, Modifier Letter Small L
-0x0ed93207, // U+01DB2 ᶲ, \^ltphi, Modifier Letter Small Phi
-0x0ea80303, // U+01D50 ᵐ, \^m, Modifier Letter Small M
-0x103f8343, // U+0207F ⁿ, \^n, Superscript Latin Small Letter N
-0x0ea90383, // U+01D52 ᵒ, \^o, Modifier Letter Small O
-0x0eab03c3, // U+01D56 ᵖ, \^p, Modifier Letter Small P
-0x0eb03205, // U+01D60 ᵠ, \^phi, Modifier Letter Small Greek Phi
-0x01598443, // U+002B3 ʳ, \^r, Modifier Letter Small R
-0x01710483, // U+002E2 ˢ, \^s, Modifier Letter Small S
-0x0eab84c3, // U+01D57 ᵗ, \^t, Modifier Letter Small T
-0x0edff007, // U+01DBF ᶿ, \^theta, Modifier Letter Small Theta
-0x0eac0503, // U+01D58 ᵘ, \^u, Modifier Letter Small U
-0x538da589, // U+0A71B ꜛ, \^uparrow, Modifier Letter Raised Up Arrow
-0x0ead8543, // U+01D5B ᵛ, \^v, Modifier Letter Small V
-0x015b8583, // U+002B7 ʷ, \^w, Modifier Letter Small W
-0x017185c3, // U+002E3 ˣ, \^x, Modifier Letter Small X
-0x015c0603, // U+002B8 ʸ, \^y, Modifier Letter Small Y
-0x0edd8643, // U+01DBB ᶻ, \^z, Modifier Letter Small Z
-0x104681c3, // U+0208D ₍, \_(, Subscript Left Parenthesis / Subscript Opening Parenthesis
-0x10470203, // U+0208E ₎, \_), Subscript Right Parenthesis / Subscript Closing Parenthesis
-0x10450283, // U+0208A ₊, \_+, Subscript Plus Sign
-0x10458303, // U+0208B ₋, \_-, Subscript Minus / Subscript Hyphen-Minus
-0x104003c3, // U+02080 ₀, \_0, Subscript Zero / Subscript Digit Zero
-0x10408403, // U+02081 ₁, \_1, Subscript One / Subscript Digit One
-0x10410443, // U+02082 ₂, \_2, Subscript Two / Subscript Digit Two
-0x10418483, // U+02083 ₃, \_3, Subscript Three / Subscript Digit Three
-0x104204c3, // U+02084 ₄, \_4, Subscript Four / Subscript Digit Four
-0x10428503, // U+02085 ₅, \_5, Subscript Five / Subscript Digit Five
-0x10430543, // U+02086 ₆, \_6, Subscript Six / Subscript Digit Six
-0x10438583, // U+02087 ₇, \_7, Subscript Seven / Subscript Digit Seven
-0x104405c3, // U+02088 ₈, \_8, Subscript Eight / Subscript Digit Eight
-0x10448603, // U+02089 ₉, \_9, Subscript Nine / Subscript Digit Nine
-0x10460703, // U+0208C ₌, \_=, Subscript Equals Sign
-0x10480003, // U+02090 ₐ, \_a, Latin Subscript Small Letter A
-0x0eb37006, // U+01D66 ᵦ, \_beta, Greek Subscript Small Letter Beta
-0x0eb53205, // U+01D6A ᵪ, \_chi, Greek Subscript Small Letter Chi
-0x10488103, // U+02091 ₑ, \_e, Latin Subscript Small Letter E
-0x0eb38007, // U+01D67 ᵧ, \_gamma, Greek Subscript Small Letter Gamma
-0x104a81c3, // U+02095 ₕ, \_h, Latin Subscript Small Letter H
-0x0eb10203, // U+01D62 ᵢ, \_i, Latin Subscript Small Letter I
-0x163e0243, // U+02C7C ⱼ, \_j, Latin Subscript Small Letter J
-0x104b0283, // U+02096 ₖ, \_k, Latin Subscript Small Letter K
-0x104b82c3, // U+02097 ₗ, \_l, Latin Subscript Small Letter L
-0x104c0303, // U+02098 ₘ, \_m, Latin Subscript Small Letter M
-0x104c8343, // U+02099 ₙ, \_n, Latin Subscript Small Letter N
-0x10490383, // U+02092 ₒ, \_o, Latin Subscript Small Letter O
-0x104d03c3, // U+0209A ₚ, \_p, Latin Subscript Small Letter P
-0x0eb4b205, // U+01D69 ᵩ, \_phi, Greek Subscript Small Letter Phi
-0x0eb18443, // U+01D63 ᵣ, \_r, Latin Subscript Small Letter R
-0x0eb43385, // U+01D68 ᵨ, \_rho, Greek Subscript Small Letter Rho
-0x104d8483, // U+0209B ₛ, \_s, Latin Subscript Small Letter S
-0x104a2007, // U+02094 ₔ, \_schwa, Latin Subscript Small Letter Schwa
-0x104e04c3, // U+0209C ₜ, \_t, Latin Subscript Small Letter T
-0x0eb20503, // U+01D64 ᵤ, \_u, Latin Subscript Small Letter U
-0x0eb28543, // U+01D65 ᵥ, \_v, Latin Subscript Small Letter V
-0x104985c3, // U+02093 ₓ, \_x, Latin Subscript Small Letter X
-0x00728003, // U+000E5 å, \aa, Latin Small Letter A With Ring Above / Latin Small Letter A Ring
-0x11f314ca, // U+023E6 ⏦, \accurrent, Ac Current
-0x133f0109, // U+0267E ♾, \acidfree, Permanent Paper Sign
-0x0180f106, // U+00301 ́, \acute, Combining Acute Accent / Non-Spacing Acute
-0x11787486, // U+022F0 ⋰, \adots, Up Right Diagonal Ellipsis
-0x00730103, // U+000E6 æ, \ae, Latin Small Letter Ae / Latin Small Letter A E
-0x109ab1c6, // U+02135 ℵ, \aleph, Alef Symbol / First Transfinite Cardinal
-0x112642c9, // U+0224C ≌, \allequal, All Equal To
-0x01d8b006, // U+003B1 α, \alpha, Greek Small Letter Alpha
-0x151ff186, // U+02A3F ⨿, \amalg, Amalgamation Or Coproduct
-0x14cf9447, // U+0299F ⦟, \angdnr, Acute Angle
-0x11107106, // U+02220 ∠, \angle, Angle
-0x14cf0487, // U+0299E ⦞, \angles, Angle With S Inside
-0x14d2444a, // U+029A4 ⦤, \angleubar, Angle With Underbar
-0x1073f608, // U+020E7 ⃧, \annuity, Combining Annuity Symbol
-0x112425c7, // U+02248 ≈, \approx, Almost Equal To
-0x11250409, // U+0224A ≊, \approxeq, Almost Equal Or Equal To
-0x1538440a, // U+02A70 ⩰, \approxeqq, Approximately Equal Or Equal To
-0x112342cf, // U+02246 ≆, \approxnotequal, Approximately But Not Actually Equal To
-0x13290489, // U+02652 ♒, \aquarius, Aquarius
-0x112c0406, // U+02258 ≘, \arceq, Corresponds To
-0x13240486, // U+02648 ♈, \aries, Aries
-0x110be4c4, // U+02217 ∗, \ast, Asterisk Operator
-0x15370406, // U+02A6E ⩮, \asteq, Equals With Asterisk
-0x107814cc, // U+020F0 ⃰, \asteraccent, Combining Asterisk Above
-0x13048349, // U+02609 ☉, \astrosun, Sun
-0x112683c6, // U+0224D ≍, \asymp, Equivalent To
-0x150894c6, // U+02A11 ⨑, \awint, Anticlockwise Integration
-0x01fb234c, // U+003F6 ϶, \backepsilon, Greek Reversed Lunate Epsilon Symbol
-0x101b810c, // U+02037 ‷, \backppprime, Reversed Triple Prime
-0x101b010b, // U+02036 ‶, \backpprime, Reversed Double Prime
-0x101a810a, // U+02035 ‵, \backprime, Reversed Prime
-0x111ec308, // U+0223D ∽, \backsim, Reversed Tilde
-0x1166840a, // U+022CD ⋍, \backsimeq, Reversed Tilde Equals
-0x117f844a, // U+022FF ⋿, \bagmember, Z Notation Bag Membership
-0x01824444, // U+00304 ̄, \bar, Combining Macron / Non-Spacing Macron
-0x1521c3c7, // U+02A43 ⩃, \barcap, Intersection With Overbar
-0x152103c7, // U+02A42 ⩂, \barcup, Union With Overbar
-0x10f2258d, // U+021E4 ⇤, \barleftarrow, Leftwards Arrow To Bar / Left Arrow To Bar
-0x10dcc45a, // U+021B9 ↹, \barleftarrowrightarrowbar, Leftwards Arrow To Bar Over Rightwards Arrow To Bar / Left Arrow To Bar Over Right Arrow To Bar
-0x10dc2596, // U+021B8 ↸, \barovernorthwestarrow, North West Arrow To Long Bar / Upper Left Arrow To Long Bar
-0x149010d5, // U+02920 ⤠, \barrightarrowdiamond, Rightwards Arrow From Bar To Black Diamond
-0x115e8107, // U+022BD ⊽, \barvee, Nor
-0x115e2109, // U+022BC ⊼, \barwedge, Nand
-0xea9c5804, // U+1D538 𝔸, \bbA, Mathematical Double-Struck Capital A
-0xea9cd844, // U+1D539 𝔹, \bbB, Mathematical Double-Struck Capital B
-0x10815884, // U+02102 ℂ, \bbC, Double-Struck Capital C / Double-Struck C
-0xea9dd8c4, // U+1D53B 𝔻, \bbD, Mathematical Double-Struck Capital D
-0xea9e5904, // U+1D53C 𝔼, \bbE, Mathematical Double-Struck Capital E
-0xea9ed944, // U+1D53D 𝔽, \bbF, Mathematical Double-Struck Capital F
-0xea9f5984, // U+1D53E 𝔾, \bbG, Mathematical Double-Struck Capital G
-0x109f0008, // U+0213E ℾ, \bbGamma, Double-Struck Capital Gamma
-0x1086d9c4, // U+0210D ℍ, \bbH, Double-Struck Capital H / Double-Struck H
-0xeaa05a04, // U+1D540 𝕀, \bbI, Mathematical Double-Struck Capital I
-0xeaa0da44, // U+1D541 𝕁, \bbJ, Mathematical Double-Struck Capital J
-0xeaa15a84, // U+1D542 𝕂, \bbK, Mathematical Double-Struck Capital K
-0xeaa1dac4, // U+1D543 𝕃, \bbL, Mathematical Double-Struck Capital L
-0xeaa25b04, // U+1D544 𝕄, \bbM, Mathematical Double-Struck Capital M
-0x108adb44, // U+02115 ℕ, \bbN, Double-Struck Capital N / Double-Struck N
-0xeaa35b84, // U+1D546 𝕆, \bbO, Mathematical Double-Struck Capital O
-0x108cdbc4, // U+02119 ℙ, \bbP, Double-Struck Capital P / Double-Struck P
-0x109fb205, // U+0213F ℿ, \bbPi, Double-Struck Capital Pi
-0x108d5c04, // U+0211A ℚ, \bbQ, Double-Struck Capital Q / Double-Struck Q
-0x108edc44, // U+0211D ℝ, \bbR, Double-Struck Capital R / Double-Struck R
-0xeaa55c84, // U+1D54A 𝕊, \bbS, Mathematical Double-Struck Capital S
-0xeaa5dcc4, // U+1D54B 𝕋, \bbT, Mathematical Double-Struck Capital T
-0xeaa65d04, // U+1D54C 𝕌, \bbU, Mathematical Double-Struck Capital U
-0xeaa6dd44, // U+1D54D 𝕍, \bbV, Mathematical Double-Struck Capital V
-0xeaa75d84, // U+1D54E 𝕎, \bbW, Mathematical Double-Struck Capital W
-0xeaa7ddc4, // U+1D54F 𝕏, \bbX, Mathematical Double-Struck Capital X
-0xeaa85e04, // U+1D550 𝕐, \bbY, Mathematical Double-Struck Capital Y
-0x10925e44, // U+02124 ℤ, \bbZ, Double-Struck Capital Z / Double-Struck Z
-0xeaa95004, // U+1D552 𝕒, \bba, Mathematical Double-Struck Small A
-0xeaa9d044, // U+1D553 𝕓, \bbb, Mathematical Double-Struck Small B
-0xeaaa5084, // U+1D554 𝕔, \bbc, Mathematical Double-Struck Small C
-0xeaaad0c4, // U+1D555 𝕕, \bbd, Mathematical Double-Struck Small D
-0xeaab5104, // U+1D556 𝕖, \bbe, Mathematical Double-Struck Small E
-0xebf034c8, // U+1D7E0 𝟠, \bbeight, Mathematical Double-Struck Digit Eight
-0xeaabd144, // U+1D557 𝕗, \bbf, Mathematical Double-Struck Small F
-0xebee9107, // U+1D7DD 𝟝, \bbfive, Mathematical Double-Struck Digit Five
-0xebee0447, // U+1D7DC 𝟜, \bbfour, Mathematical Double-Struck Digit Four
-0xeaac5184, // U+1D558 𝕘, \bbg, Mathematical Double-Struck Small G
-0x109e8008, // U+0213D ℽ, \bbgamma, Double-Struck Small Gamma
-0xeaacd1c4, // U+1D559 𝕙, \bbh, Mathematical Double-Struck Small H
-0xeaad5204, // U+1D55A 𝕚, \bbi, Mathematical Double-Struck Small I
-0x10a2c8c5, // U+02145 ⅅ, \bbiD, Double-Struck Italic Capital D
-0x10a340c5, // U+02146 ⅆ, \bbid, Double-Struck Italic Small D
-0x10a3c105, // U+02147 ⅇ, \bbie, Double-Struck Italic Small E
-0x10a44205, // U+02148 ⅈ, \bbii, Double-Struck Italic Small I
-0x10a4c245, // U+02149 ⅉ, \bbij, Double-Struck Italic Small J
-0xeaadd244, // U+1D55B 𝕛, \bbj, Mathematical Double-Struck Small J
-0xeaae5284, // U+1D55C 𝕜, \bbk, Mathematical Double-Struck Small K
-0xeaaed2c4, // U+1D55D 𝕝, \bbl, Mathematical Double-Struck Small L
-0xeaaf5304, // U+1D55E 𝕞, \bbm, Mathematical Double-Struck Small M
-0xeaafd344, // U+1D55F 𝕟, \bbn, Mathematical Double-Struck Small N
-0xebf09107, // U+1D7E1 𝟡, \bbnine, Mathematical Double-Struck Digit Nine
-0xeab05384, // U+1D560 𝕠, \bbo, Mathematical Double-Struck Small O
-0xebec9106, // U+1D7D9 𝟙, \bbone, Mathematical Double-Struck Digit One
-0xeab0d3c4, // U+1D561 𝕡, \bbp, Mathematical Double-Struck Small P
-0x109e3205, // U+0213C ℼ, \bbpi, Double-Struck Small Pi
-0xeab15404, // U+1D562 𝕢, \bbq, Mathematical Double-Struck Small Q
-0xeab1d444, // U+1D563 𝕣, \bbr, Mathematical Double-Struck Small R
-0x11db5289, // U+023B6 ⎶, \bbrktbrk, Bottom Square Bracket Over Top Square Bracket
-0xeab25484, // U+1D564 𝕤, \bbs, Mathematical Double-Struck Small S
-0x150f8207, // U+02A1F ⨟, \bbsemi, Z Notation Schema Composition
-0xebef8348, // U+1D7DF 𝟟, \bbseven, Mathematical Double-Struck Digit Seven
-0xebef45c6, // U+1D7DE 𝟞, \bbsix, Mathematical Double-Struck Digit Six
-0x10a00306, // U+02140 ⅀, \bbsum, Double-Struck N-Ary Summation
-0xeab2d4c4, // U+1D565 𝕥, \bbt, Mathematical Double-Struck Small T
-0xebed8108, // U+1D7DB 𝟛, \bbthree, Mathematical Double-Struck Digit Three
-0xebed2386, // U+1D7DA 𝟚, \bbtwo, Mathematical Double-Struck Digit Two
-0xeab35504, // U+1D566 𝕦, \bbu, Mathematical Double-Struck Small U
-0xeab3d544, // U+1D567 𝕧, \bbv, Mathematical Double-Struck Small V
-0xeab45584, // U+1D568 𝕨, \bbw, Mathematical Double-Struck Small W
-0xeab4d5c4, // U+1D569 𝕩, \bbx, Mathematical Double-Struck Small X
-0xeab55604, // U+1D56A 𝕪, \bby, Mathematical Double-Struck Small Y
-0xeab5d644, // U+1D56B 𝕫, \bbz, Mathematical Double-Struck Small Z
-0xebec5387, // U+1D7D8 𝟘, \bbzero, Mathematical Double-Struck Digit Zero
-0x111ae108, // U+02235 ∵, \because, Because
-0x11f19448, // U+023E3 ⏣, \benzenr, Benzene Ring With Circle
-0x01d97005, // U+003B2 β, \beta, Greek Small Letter Beta
-0x109b71c5, // U+02136 ℶ, \beth, Bet Symbol / Second Transfinite Cardinal
-0x11360348, // U+0226C ≬, \between, Between
-0xea001804, // U+1D400 𝐀, \bfA, Mathematical Bold Capital A
-0xeb543008, // U+1D6A8 𝚨, \bfAlpha, Mathematical Bold Capital Alpha
-0xea009844, // U+1D401 𝐁, \bfB, Mathematical Bold Capital B
-0xeb54f007, // U+1D6A9 𝚩, \bfBeta, Mathematical Bold Capital Beta
-0xea011884, // U+1D402 𝐂, \bfC, Mathematical Bold Capital C
-0xeb5f3206, // U+1D6BE 𝚾, \bfChi, Mathematical Bold Capital Chi
-0xea0198c4, // U+1D403 𝐃, \bfD, Mathematical Bold Capital D
-0xeb55f008, // U+1D6AB 𝚫, \bfDelta, Mathematical Bold Capital Delta
-0xebe5000a, // U+1D7CA 𝟊, \bfDigamma, Mathematical Bold Capital Digamma
-0xea021904, // U+1D404 𝐄, \bfE, Mathematical Bold Capital E
-0xeb56234a, // U+1D6AC 𝚬, \bfEpsilon, Mathematical Bold Capital Epsilon
-0xeb577006, // U+1D6AE 𝚮, \bfEta, Mathematical Bold Capital Eta
-0xea029944, // U+1D405 𝐅, \bfF, Mathematical Bold Capital F
-0xea031984, // U+1D406 𝐆, \bfG, Mathematical Bold Capital G
-0xeb550008, // U+1D6AA 𝚪, \bfGamma, Mathematical Bold Capital Gamma
-0xea0399c4, // U+1D407 𝐇, \bfH, Mathematical Bold Capital H
-0xea041a04, // U+1D408 𝐈, \bfI, Mathematical Bold Capital I
-0xeb587007, // U+1D6B0 𝚰, \bfIota, Mathematical Bold Capital Iota
-0xea049a44, // U+1D409 𝐉, \bfJ, Mathematical Bold Capital J
-0xea051a84, // U+1D40A 𝐊, \bfK, Mathematical Bold Capital K
-0xeb58b008, // U+1D6B1 𝚱, \bfKappa, Mathematical Bold Capital Kappa
-0xea059ac4, // U+1D40B 𝐋, \bfL, Mathematical Bold Capital L
-0xeb597009, // U+1D6B2 𝚲, \bfLambda, Mathematical Bold Capital Lamda
-0xea061b04, // U+1D40C 𝐌, \bfM, Mathematical Bold Capital M
-0xeb598505, // U+1D6B3 𝚳, \bfMu, Mathematical Bold Capital Mu
-0xea069b44, // U+1D40D 𝐍, \bfN, Mathematical Bold Capital N
-0xeb5a1505, // U+1D6B4 𝚴, \bfNu, Mathematical Bold Capital Nu
-0xea071b84, // U+1D40E 𝐎, \bfO, Mathematical Bold Capital O
-0xeb602008, // U+1D6C0 𝛀, \bfOmega, Mathematical Bold Capital Omega
-0xeb5b234a, // U+1D6B6 𝚶, \bfOmicron, Mathematical Bold Capital Omicron
-0xea079bc4, // U+1D40F 𝐏, \bfP, Mathematical Bold Capital P
-0xeb5eb206, // U+1D6BD 𝚽, \bfPhi, Mathematical Bold Capital Phi
-0xeb5bb205, // U+1D6B7 𝚷, \bfPi, Mathematical Bold Capital Pi
-0xeb5fe206, // U+1D6BF 𝚿, \bfPsi, Mathematical Bold Capital Psi
-0xea081c04, // U+1D410 𝐐, \bfQ, Mathematical Bold Capital Q
-0xea089c44, // U+1D411 𝐑, \bfR, Mathematical Bold Capital R
-0xeb5c3386, // U+1D6B8 𝚸, \bfRho, Mathematical Bold Capital Rho
-0xea091c84, // U+1D412 𝐒, \bfS, Mathematical Bold Capital S
-0xeb5d0008, // U+1D6BA 𝚺, \bfSigma, Mathematical Bold Capital Sigma
-0xea099cc4, // U+1D413 𝐓, \bfT, Mathematical Bold Capital T
-0xeb5dc506, // U+1D6BB 𝚻, \bfTau, Mathematical Bold Capital Tau
-0xeb57f008, // U+1D6AF 𝚯, \bfTheta, Mathematical Bold Capital Theta
-0xea0a1d04, // U+1D414 𝐔, \bfU, Mathematical Bold Capital U
-0xeb5e234a, // U+1D6BC 𝚼, \bfUpsilon, Mathematical Bold Capital Upsilon
-0xea0a9d44, // U+1D415 𝐕, \bfV, Mathematical Bold Capital V
-0xea0b1d84, // U+1D416 𝐖, \bfW, Mathematical Bold Capital W
-0xea0b9dc4, // U+1D417 𝐗, \bfX, Mathematical Bold Capital X
-0xeb5ab205, // U+1D6B5 𝚵, \bfXi, Mathematical Bold Capital Xi
-0xea0c1e04, // U+1D418 𝐘, \bfY, Mathematical Bold Capital Y
-0xea0c9e44, // U+1D419 𝐙, \bfZ, Mathematical Bold Capital Z
-0xeb56f007, // U+1D6AD 𝚭, \bfZeta, Mathematical Bold Capital Zeta
-0xea0d1004, // U+1D41A 𝐚, \bfa, Mathematical Bold Small A
-0xeb613008, // U+1D6C2 𝛂, \bfalpha, Mathematical Bold Small Alpha
-0xea0d9044, // U+1D41B 𝐛, \bfb, Mathematical Bold Small B
-0xeb61f007, // U+1D6C3 𝛃, \bfbeta, Mathematical Bold Small Beta
-0xea0e1084, // U+1D41C 𝐜, \bfc, Mathematical Bold Small C
-0xeb6c3206, // U+1D6D8 𝛘, \bfchi, Mathematical Bold Small Chi
-0xea0e90c4, // U+1D41D 𝐝, \bfd, Mathematical Bold Small D
-0xeb62f008, // U+1D6C5 𝛅, \bfdelta, Mathematical Bold Small Delta
-0xebe5800a, // U+1D7CB 𝟋, \bfdigamma, Mathematical Bold Small Digamma
-0xea0f1104, // U+1D41E 𝐞, \bfe, Mathematical Bold Small E
-0xebeb34c8, // U+1D7D6 𝟖, \bfeight, Mathematical Bold Digit Eight
-0xeb6e234a, // U+1D6DC 𝛜, \bfepsilon, Mathematical Bold Epsilon Symbol
-0xeb647006, // U+1D6C8 𝛈, \bfeta, Mathematical Bold Small Eta
-0xea0f9144, // U+1D41F 𝐟, \bff, Mathematical Bold Small F
-0xebe99107, // U+1D7D3 𝟓, \bffive, Mathematical Bold Digit Five
-0xebe90447, // U+1D7D2 𝟒, \bffour, Mathematical Bold Digit Four
-0xea101184, // U+1D420 𝐠, \bfg, Mathematical Bold Small G
-0xeb620008, // U+1D6C4 𝛄, \bfgamma, Mathematical Bold Small Gamma
-0xea1091c4, // U+1D421 𝐡, \bfh, Mathematical Bold Small H
-0xea111204, // U+1D422 𝐢, \bfi, Mathematical Bold Small I
-0xeb657007, // U+1D6CA 𝛊, \bfiota, Mathematical Bold Small Iota
-0xea119244, // U+1D423 𝐣, \bfj, Mathematical Bold Small J
-0xea121284, // U+1D424 𝐤, \bfk, Mathematical Bold Small K
-0xeb65b008, // U+1D6CB 𝛋, \bfkappa, Mathematical Bold Small Kappa
-0xea1292c4, // U+1D425 𝐥, \bfl, Mathematical Bold Small L
-0xeb667009, // U+1D6CC 𝛌, \bflambda, Mathematical Bold Small Lamda
-0xea131304, // U+1D426 𝐦, \bfm, Mathematical Bold Small M
-0xeb668505, // U+1D6CD 𝛍, \bfmu, Mathematical Bold Small Mu
-0xea139344, // U+1D427 𝐧, \bfn, Mathematical Bold Small N
-0xeb60f008, // U+1D6C1 𝛁, \bfnabla, Mathematical Bold Nabla
-0xebeb9107, // U+1D7D7 𝟗, \bfnine, Mathematical Bold Digit Nine
-0xeb671505, // U+1D6CE 𝛎, \bfnu, Mathematical Bold Small Nu
-0xea141384, // U+1D428 𝐨, \bfo, Mathematical Bold Small O
-0xeb6d2008, // U+1D6DA 𝛚, \bfomega, Mathematical Bold Small Omega
-0xeb68234a, // U+1D6D0 𝛐, \bfomicron, Mathematical Bold Small Omicron
-0xebe79106, // U+1D7CF 𝟏, \bfone, Mathematical Bold Digit One
-0xea1493c4, // U+1D429 𝐩, \bfp, Mathematical Bold Small P
-0xeb6dc2ca, // U+1D6DB 𝛛, \bfpartial, Mathematical Bold Partial Differential
-0xeb6fb206, // U+1D6DF 𝛟, \bfphi, Mathematical Bold Phi Symbol
-0xeb68b205, // U+1D6D1 𝛑, \bfpi, Mathematical Bold Small Pi
-0xeb6ce206, // U+1D6D9 𝛙, \bfpsi, Mathematical Bold Small Psi
-0xea151404, // U+1D42A 𝐪, \bfq, Mathematical Bold Small Q
-0xea159444, // U+1D42B 𝐫, \bfr, Mathematical Bold Small R
-0xeab66807, // U+1D56C 𝕬, \bfrakA, Mathematical Bold Fraktur Capital A
-0xeab6e847, // U+1D56D 𝕭, \bfrakB, Mathematical Bold Fraktur Capital B
-0xeab76887, // U+1D56E 𝕮, \bfrakC, Mathematical Bold Fraktur Capital C
-0xeab7e8c7, // U+1D56F 𝕯, \bfrakD, Mathematical Bold Fraktur Capital D
-0xeab86907, // U+1D570 𝕰, \bfrakE, Mathematical Bold Fraktur Capital E
-0xeab8e947, // U+1D571 𝕱, \bfrakF, Mathematical Bold Fraktur Capital F
-0xeab96987, // U+1D572 𝕲, \bfrakG, Mathematical Bold Fraktur Capital G
-0xeab9e9c7, // U+1D573 𝕳, \bfrakH, Mathematical Bold Fraktur Capital H
-0xeaba6a07, // U+1D574 𝕴, \bfrakI, Mathematical Bold Fraktur Capital I
-0xeabaea47, // U+1D575 𝕵, \bfrakJ, Mathematical Bold Fraktur Capital J
-0xeabb6a87, // U+1D576 𝕶, \bfrakK, Mathematical Bold Fraktur Capital K
-0xeabbeac7, // U+1D577 𝕷, \bfrakL, Mathematical Bold Fraktur Capital L
-0xeabc6b07, // U+1D578 𝕸, \bfrakM, Mathematical Bold Fraktur Capital M
-0xeabceb47, // U+1D579 𝕹, \bfrakN, Mathematical Bold Fraktur Capital N
-0xeabd6b87, // U+1D57A 𝕺, \bfrakO, Mathematical Bold Fraktur Capital O
-0xeabdebc7, // U+1D57B 𝕻, \bfrakP, Mathematical Bold Fraktur Capital P
-0xeabe6c07, // U+1D57C 𝕼, \bfrakQ, Mathematical Bold Fraktur Capital Q
-0xeabeec47, // U+1D57D 𝕽, \bfrakR, Mathematical Bold Fraktur Capital R
-0xeabf6c87, // U+1D57E 𝕾, \bfrakS, Mathematical Bold Fraktur Capital S
-0xeabfecc7, // U+1D57F 𝕿, \bfrakT, Mathematical Bold Fraktur Capital T
-0xeac06d07, // U+1D580 𝖀, \bfrakU, Mathematical Bold Fraktur Capital U
-0xeac0ed47, // U+1D581 𝖁, \bfrakV, Mathematical Bold Fraktur Capital V
-0xeac16d87, // U+1D582 𝖂, \bfrakW, Mathematical Bold Fraktur Capital W
-0xeac1edc7, // U+1D583 𝖃, \bfrakX, Mathematical Bold Fraktur Capital X
-0xeac26e07, // U+1D584 𝖄, \bfrakY, Mathematical Bold Fraktur Capital Y
-0xeac2ee47, // U+1D585 𝖅, \bfrakZ, Mathematical Bold Fraktur Capital Z
-0xeac36007, // U+1D586 𝖆, \bfraka, Mathematical Bold Fraktur Small A
-0xeac3e047, // U+1D587 𝖇, \bfrakb, Mathematical Bold Fraktur Small B
-0xeac46087, // U+1D588 𝖈, \bfrakc, Mathematical Bold Fraktur Small C
-0xeac4e0c7, // U+1D589 𝖉, \bfrakd, Mathematical Bold Fraktur Small D
-0xeac56107, // U+1D58A 𝖊, \bfrake, Mathematical Bold Fraktur Small E
-0xeac5e147, // U+1D58B 𝖋, \bfrakf, Mathematical Bold Fraktur Small F
-0xeac66187, // U+1D58C 𝖌, \bfrakg, Mathematical Bold Fraktur Small G
-0xeac6e1c7, // U+1D58D 𝖍, \bfrakh, Mathematical Bold Fraktur Small H
-0xeac76207, // U+1D58E 𝖎, \bfraki, Mathematical Bold Fraktur Small I
-0xeac7e247, // U+1D58F 𝖏, \bfrakj, Mathematical Bold Fraktur Small J
-0xeac86287, // U+1D590 𝖐, \bfrakk, Mathematical Bold Fraktur Small K
-0xeac8e2c7, // U+1D591 𝖑, \bfrakl, Mathematical Bold Fraktur Small L
-0xeac96307, // U+1D592 𝖒, \bfrakm, Mathematical Bold Fraktur Small M
-0xeac9e347, // U+1D593 𝖓, \bfrakn, Mathematical Bold Fraktur Small N
-0xeaca6387, // U+1D594 𝖔, \bfrako, Mathematical Bold Fraktur Small O
-0xeacae3c7, // U+1D595 𝖕, \bfrakp, Mathematical Bold Fraktur Small P
-0xeacb6407, // U+1D596 𝖖, \bfrakq, Mathematical Bold Fraktur Small Q
-0xeacbe447, // U+1D597 𝖗, \bfrakr, Mathematical Bold Fraktur Small R
-0xeacc6487, // U+1D598 𝖘, \bfraks, Mathematical Bold Fraktur Small S
-0xeacce4c7, // U+1D599 𝖙, \bfrakt, Mathematical Bold Fraktur Small T
-0xeacd6507, // U+1D59A 𝖚, \bfraku, Mathematical Bold Fraktur Small U
-0xeacde547, // U+1D59B 𝖛, \bfrakv, Mathematical Bold Fraktur Small V
-0xeace6587, // U+1D59C 𝖜, \bfrakw, Mathematical Bold Fraktur Small W
-0xeacee5c7, // U+1D59D 𝖝, \bfrakx, Mathematical Bold Fraktur Small X
-0xeacf6607, // U+1D59E 𝖞, \bfraky, Mathematical Bold Fraktur Small Y
-0xeacfe647, // U+1D59F 𝖟, \bfrakz, Mathematical Bold Fraktur Small Z
-0xeb693386, // U+1D6D2 𝛒, \bfrho, Mathematical Bold Small Rho
-0xea161484, // U+1D42C 𝐬, \bfs, Mathematical Bold Small S
-0xebea8348, // U+1D7D5 𝟕, \bfseven, Mathematical Bold Digit Seven
-0xeb6a0008, // U+1D6D4 𝛔, \bfsigma, Mathematical Bold Small Sigma
-0xebea45c6, // U+1D7D4 𝟔, \bfsix, Mathematical Bold Digit Six
-0xea1694c4, // U+1D42D 𝐭, \bft, Mathematical Bold Small T
-0xeb6ac506, // U+1D6D5 𝛕, \bftau, Mathematical Bold Small Tau
-0xeb64f008, // U+1D6C9 𝛉, \bftheta, Mathematical Bold Small Theta
-0xebe88108, // U+1D7D1 𝟑, \bfthree, Mathematical Bold Digit Three
-0xebe82386, // U+1D7D0 𝟐, \bftwo, Mathematical Bold Digit Two
-0xea171504, // U+1D42E 𝐮, \bfu, Mathematical Bold Small U
-0xeb6b234a, // U+1D6D6 𝛖, \bfupsilon, Mathematical Bold Small Upsilon
-0xea179544, // U+1D42F 𝐯, \bfv, Mathematical Bold Small V
-0xeb5cf00b, // U+1D6B9 𝚹, \bfvarTheta, Mathematical Bold Capital Theta Symbol
-0xeb63234d, // U+1D6C6 𝛆, \bfvarepsilon, Mathematical Bold Small Epsilon
-0xeb6f300b, // U+1D6DE 𝛞, \bfvarkappa, Mathematical Bold Kappa Symbol
-0xeb6bb209, // U+1D6D7 𝛗, \bfvarphi, Mathematical Bold Small Phi
-0xeb70b208, // U+1D6E1 𝛡, \bfvarpi, Mathematical Bold Pi Symbol
-0xeb703389, // U+1D6E0 𝛠, \bfvarrho, Mathematical Bold Rho Symbol
-0xeb69800b, // U+1D6D3 𝛓, \bfvarsigma, Mathematical Bold Small Final Sigma
-0xeb6ef00b, // U+1D6DD 𝛝, \bfvartheta, Mathematical Bold Theta Symbol
-0xea181584, // U+1D430 𝐰, \bfw, Mathematical Bold Small W
-0xea1895c4, // U+1D431 𝐱, \bfx, Mathematical Bold Small X
-0xeb67b205, // U+1D6CF 𝛏, \bfxi, Mathematical Bold Small Xi
-0xea191604, // U+1D432 𝐲, \bfy, Mathematical Bold Small Y
-0xea199644, // U+1D433 𝐳, \bfz, Mathematical Bold Small Z
-0xebe75387, // U+1D7CE 𝟎, \bfzero, Mathematical Bold Digit Zero
-0xeb63f007, // U+1D6C7 𝛇, \bfzeta, Mathematical Bold Small Zeta
-0xea344804, // U+1D468 𝑨, \biA, Mathematical Bold Italic Capital A
-0xeb8e3008, // U+1D71C 𝜜, \biAlpha, Mathematical Bold Italic Capital Alpha
-0xea34c844, // U+1D469 𝑩, \biB, Mathematical Bold Italic Capital B
-0xeb8ef007, // U+1D71D 𝜝, \biBeta, Mathematical Bold Italic Capital Beta
-0xea354884, // U+1D46A 𝑪, \biC, Mathematical Bold Italic Capital C
-0xeb993206, // U+1D732 𝜲, \biChi, Mathematical Bold Italic Capital Chi
-0xea35c8c4, // U+1D46B 𝑫, \biD, Mathematical Bold Italic Capital D
-0xeb8ff008, // U+1D71F 𝜟, \biDelta, Mathematical Bold Italic Capital Delta
-0xea364904, // U+1D46C 𝑬, \biE, Mathematical Bold Italic Capital E
-0xeb90234a, // U+1D720 𝜠, \biEpsilon, Mathematical Bold Italic Capital Epsilon
-0xeb917006, // U+1D722 𝜢, \biEta, Mathematical Bold Italic Capital Eta
-0xea36c944, // U+1D46D 𝑭, \biF, Mathematical Bold Italic Capital F
-0xea374984, // U+1D46E 𝑮, \biG, Mathematical Bold Italic Capital G
-0xeb8f0008, // U+1D71E 𝜞, \biGamma, Mathematical Bold Italic Capital Gamma
-0xea37c9c4, // U+1D46F 𝑯, \biH, Mathematical Bold Italic Capital H
-0xea384a04, // U+1D470 𝑰, \biI, Mathematical Bold Italic Capital I
-0xeb927007, // U+1D724 𝜤, \biIota, Mathematical Bold Italic Capital Iota
-0xea38ca44, // U+1D471 𝑱, \biJ, Mathematical Bold Italic Capital J
-0xea394a84, // U+1D472 𝑲, \biK, Mathematical Bold Italic Capital K
-0xeb92b008, // U+1D725 𝜥, \biKappa, Mathematical Bold Italic Capital Kappa
-0xea39cac4, // U+1D473 𝑳, \biL, Mathematical Bold Italic Capital L
-0xeb937009, // U+1D726 𝜦, \biLambda, Mathematical Bold Italic Capital Lamda
-0xea3a4b04, // U+1D474 𝑴, \biM, Mathematical Bold Italic Capital M
-0xeb938505, // U+1D727 𝜧, \biMu, Mathematical Bold Italic Capital Mu
-0xea3acb44, // U+1D475 𝑵, \biN, Mathematical Bold Italic Capital N
-0xeb941505, // U+1D728 𝜨, \biNu, Mathematical Bold Italic Capital Nu
-0xea3b4b84, // U+1D476 𝑶, \biO, Mathematical Bold Italic Capital O
-0xeb9a2008, // U+1D734 𝜴, \biOmega, Mathematical Bold Italic Capital Omega
-0xeb95234a, // U+1D72A 𝜪, \biOmicron, Mathematical Bold Italic Capital Omicron
-0xea3bcbc4, // U+1D477 𝑷, \biP, Mathematical Bold Italic Capital P
-0xeb98b206, // U+1D731 𝜱, \biPhi, Mathematical Bold Italic Capital Phi
-0xeb95b205, // U+1D72B 𝜫, \biPi, Mathematical Bold Italic Capital Pi
-0xeb99e206, // U+1D733 𝜳, \biPsi, Mathematical Bold Italic Capital Psi
-0xea3c4c04, // U+1D478 𝑸, \biQ, Mathematical Bold Italic Capital Q
-0xea3ccc44, // U+1D479 𝑹, \biR, Mathematical Bold Italic Capital R
-0xeb963386, // U+1D72C 𝜬, \biRho, Mathematical Bold Italic Capital Rho
-0xea3d4c84, // U+1D47A 𝑺, \biS, Mathematical Bold Italic Capital S
-0xeb970008, // U+1D72E 𝜮, \biSigma, Mathematical Bold Italic Capital Sigma
-0xea3dccc4, // U+1D47B 𝑻, \biT, Mathematical Bold Italic Capital T
-0xeb97c506, // U+1D72F 𝜯, \biTau, Mathematical Bold Italic Capital Tau
-0xeb91f008, // U+1D723 𝜣, \biTheta, Mathematical Bold Italic Capital Theta
-0xea3e4d04, // U+1D47C 𝑼, \biU, Mathematical Bold Italic Capital U
-0xeb98234a, // U+1D730 𝜰, \biUpsilon, Mathematical Bold Italic Capital Upsilon
-0xea3ecd44, // U+1D47D 𝑽, \biV, Mathematical Bold Italic Capital V
-0xea3f4d84, // U+1D47E 𝑾, \biW, Mathematical Bold Italic Capital W
-0xea3fcdc4, // U+1D47F 𝑿, \biX, Mathematical Bold Italic Capital X
-0xeb94b205, // U+1D729 𝜩, \biXi, Mathematical Bold Italic Capital Xi
-0xea404e04, // U+1D480 𝒀, \biY, Mathematical Bold Italic Capital Y
-0xea40ce44, // U+1D481 𝒁, \biZ, Mathematical Bold Italic Capital Z
-0xeb90f007, // U+1D721 𝜡, \biZeta, Mathematical Bold Italic Capital Zeta
-0xea414004, // U+1D482 𝒂, \bia, Mathematical Bold Italic Small A
-0xeb9b3008, // U+1D736 𝜶, \bialpha, Mathematical Bold Italic Small Alpha
-0xea41c044, // U+1D483 𝒃, \bib, Mathematical Bold Italic Small B
-0xeb9bf007, // U+1D737 𝜷, \bibeta, Mathematical Bold Italic Small Beta
-0xea424084, // U+1D484 𝒄, \bic, Mathematical Bold Italic Small C
-0xeba63206, // U+1D74C 𝝌, \bichi, Mathematical Bold Italic Small Chi
-0xea42c0c4, // U+1D485 𝒅, \bid, Mathematical Bold Italic Small D
-0xeb9cf008, // U+1D739 𝜹, \bidelta, Mathematical Bold Italic Small Delta
-0xea434104, // U+1D486 𝒆, \bie, Mathematical Bold Italic Small E
-0xeba8234a, // U+1D750 𝝐, \biepsilon, Mathematical Bold Italic Epsilon Symbol
-0xeb9e7006, // U+1D73C 𝜼, \bieta, Mathematical Bold Italic Small Eta
-0xea43c144, // U+1D487 𝒇, \bif, Mathematical Bold Italic Small F
-0xea444184, // U+1D488 𝒈, \big, Mathematical Bold Italic Small G
-0xeb9c0008, // U+1D738 𝜸, \bigamma, Mathematical Bold Italic Small Gamma
-0x12de2355, // U+025BC ▼, \bigblacktriangledown, Black Down-Pointing Triangle / Black Down Pointing Triangle
-0x12d903d3, // U+025B2 ▲, \bigblacktriangleup, Black Up-Pointing Triangle / Black Up Pointing Triangle
-0x13ec24c7, // U+027D8 ⟘, \bigbot, Large Up Tack
-0x116143c7, // U+022C2 ⋂, \bigcap, N-Ary Intersection
-0x12e5d088, // U+025CB ○, \bigcirc, White Circle
-0x116183c7, // U+022C3 ⋃, \bigcup, N-Ary Union
-0x1501a4ca, // U+02A03 ⨃, \bigcupdot, N-Ary Union Operator With Dot
-0x150024c8, // U+02A00 ⨀, \bigodot, N-Ary Circled Dot Operator
-0x15008489, // U+02A01 ⨁, \bigoplus, N-Ary Circled Plus Operator
-0x1501048a, // U+02A02 ⨂, \bigotimes, N-Ary Circled Times Operator
-0x152b810d, // U+02A57 ⩗, \bigslopedvee, Sloping Large Or
-0x152c210f, // U+02A58 ⩘, \bigslopedwedge, Sloping Large And
-0x1502c3c9, // U+02A05 ⨅, \bigsqcap, N-Ary Square Intersection Operator
-0x150303c9, // U+02A06 ⨆, \bigsqcup, N-Ary Square Union Operator
-0x1302c448, // U+02605 ★, \bigstar, Black Star
-0x15048489, // U+02A09 ⨉, \bigtimes, N-Ary Times Operator
-0x13eca3c7, // U+027D9 ⟙, \bigtop, Large Down Tack
-0x12dea350, // U+025BD ▽, \bigtriangledown, White Down-Pointing Triangle / White Down Pointing Triangle
-0x12d983ce, // U+025B3 △, \bigtriangleup, White Up-Pointing Triangle / White Up Pointing Triangle
-0x15020489, // U+02A04 ⨄, \biguplus, N-Ary Union Operator With Plus
-0x11608107, // U+022C1 ⋁, \bigvee, N-Ary Logical Or
-0x11602109, // U+022C0 ⋀, \bigwedge, N-Ary Logical And
-0x1303444d, // U+02606 ☆, \bigwhitestar, White Star
-0xea44c1c4, // U+1D489 𝒉, \bih, Mathematical Bold Italic Small H
-0xea454204, // U+1D48A 𝒊, \bii, Mathematical Bold Italic Small I
-0xeb9f7007, // U+1D73E 𝜾, \biiota, Mathematical Bold Italic Small Iota
-0xea45c244, // U+1D48B 𝒋, \bij, Mathematical Bold Italic Small J
-0xea464284, // U+1D48C 𝒌, \bik, Mathematical Bold Italic Small K
-0xeb9fb008, // U+1D73F 𝜿, \bikappa, Mathematical Bold Italic Small Kappa
-0xea46c2c4, // U+1D48D 𝒍, \bil, Mathematical Bold Italic Small L
-0xeba07009, // U+1D740 𝝀, \bilambda, Mathematical Bold Italic Small Lamda
-0xea474304, // U+1D48E 𝒎, \bim, Mathematical Bold Italic Small M
-0xeba08505, // U+1D741 𝝁, \bimu, Mathematical Bold Italic Small Mu
-0xea47c344, // U+1D48F 𝒏, \bin, Mathematical Bold Italic Small N
-0xeb9af008, // U+1D735 𝜵, \binabla, Mathematical Bold Italic Nabla
-0xeba11505, // U+1D742 𝝂, \binu, Mathematical Bold Italic Small Nu
-0xea484384, // U+1D490 𝒐, \bio, Mathematical Bold Italic Small O
-0xeba72008, // U+1D74E 𝝎, \biomega, Mathematical Bold Italic Small Omega
-0xeba2234a, // U+1D744 𝝄, \biomicron, Mathematical Bold Italic Small Omicron
-0xea48c3c4, // U+1D491 𝒑, \bip, Mathematical Bold Italic Small P
-0xeba7c2ca, // U+1D74F 𝝏, \bipartial, Mathematical Bold Italic Partial Differential
-0xeba9b206, // U+1D753 𝝓, \biphi, Mathematical Bold Italic Phi Symbol
-0xeba2b205, // U+1D745 𝝅, \bipi, Mathematical Bold Italic Small Pi
-0xeba6e206, // U+1D74D 𝝍, \bipsi, Mathematical Bold Italic Small Psi
-0xea494404, // U+1D492 𝒒, \biq, Mathematical Bold Italic Small Q
-0xea49c444, // U+1D493 𝒓, \bir, Mathematical Bold Italic Small R
-0xeba33386, // U+1D746 𝝆, \birho, Mathematical Bold Italic Small Rho
-0xea4a4484, // U+1D494 𝒔, \bis, Mathematical Bold Italic Small S
-0xeb1e6808, // U+1D63C 𝘼, \bisansA, Mathematical Sans-Serif Bold Italic Capital A
-0xebc8300c, // U+1D790 𝞐, \bisansAlpha, Mathematical Sans-Serif Bold Italic Capital Alpha
-0xeb1ee848, // U+1D63D 𝘽, \bisansB, Mathematical Sans-Serif Bold Italic Capital B
-0xebc8f00b, // U+1D791 𝞑, \bisansBeta, Mathematical Sans-Serif Bold Italic Capital Beta
-0xeb1f6888, // U+1D63E 𝘾, \bisansC, Mathematical Sans-Serif Bold Italic Capital C
-0xebd3320a, // U+1D7A6 𝞦, \bisansChi, Mathematical Sans-Serif Bold Italic Capital Chi
-0xeb1fe8c8, // U+1D63F 𝘿, \bisansD, Mathematical Sans-Serif Bold Italic Capital D
-0xebc9f00c, // U+1D793 𝞓, \bisansDelta, Mathematical Sans-Serif Bold Italic Capital Delta
-0xeb206908, // U+1D640 𝙀, \bisansE, Mathematical Sans-Serif Bold Italic Capital E
-0xebca234e, // U+1D794 𝞔, \bisansEpsilon, Mathematical Sans-Serif Bold Italic Capital Epsilon
-0xebcb700a, // U+1D796 𝞖, \bisansEta, Mathematical Sans-Serif Bold Italic Capital Eta
-0xeb20e948, // U+1D641 𝙁, \bisansF, Mathematical Sans-Serif Bold Italic Capital F
-0xeb216988, // U+1D642 𝙂, \bisansG, Mathematical Sans-Serif Bold Italic Capital G
-0xebc9000c, // U+1D792 𝞒, \bisansGamma, Mathematical Sans-Serif Bold Italic Capital Gamma
-0xeb21e9c8, // U+1D643 𝙃, \bisansH, Mathematical Sans-Serif Bold Italic Capital H
-0xeb226a08, // U+1D644 𝙄, \bisansI, Mathematical Sans-Serif Bold Italic Capital I
-0xebcc700b, // U+1D798 𝞘, \bisansIota, Mathematical Sans-Serif Bold Italic Capital Iota
-0xeb22ea48, // U+1D645 𝙅, \bisansJ, Mathematical Sans-Serif Bold Italic Capital J
-0xeb236a88, // U+1D646 𝙆, \bisansK, Mathematical Sans-Serif Bold Italic Capital K
-0xebccb00c, // U+1D799 𝞙, \bisansKappa, Mathematical Sans-Serif Bold Italic Capital Kappa
-0xeb23eac8, // U+1D647 𝙇, \bisansL, Mathematical Sans-Serif Bold Italic Capital L
-0xebcd700d, // U+1D79A 𝞚, \bisansLambda, Mathematical Sans-Serif Bold Italic Capital Lamda
-0xeb246b08, // U+1D648 𝙈, \bisansM, Mathematical Sans-Serif Bold Italic Capital M
-0xebcd8509, // U+1D79B 𝞛, \bisansMu, Mathematical Sans-Serif Bold Italic Capital Mu
-0xeb24eb48, // U+1D649 𝙉, \bisansN, Mathematical Sans-Serif Bold Italic Capital N
-0xebce1509, // U+1D79C 𝞜, \bisansNu, Mathematical Sans-Serif Bold Italic Capital Nu
-0xeb256b88, // U+1D64A 𝙊, \bisansO, Mathematical Sans-Serif Bold Italic Capital O
-0xebd4200c, // U+1D7A8 𝞨, \bisansOmega, Mathematical Sans-Serif Bold Italic Capital Omega
-0xebcf234e, // U+1D79E 𝞞, \bisansOmicron, Mathematical Sans-Serif Bold Italic Capital Omicron
-0xeb25ebc8, // U+1D64B 𝙋, \bisansP, Mathematical Sans-Serif Bold Italic Capital P
-0xebd2b20a, // U+1D7A5 𝞥, \bisansPhi, Mathematical Sans-Serif Bold Italic Capital Phi
-0xebcfb209, // U+1D79F 𝞟, \bisansPi, Mathematical Sans-Serif Bold Italic Capital Pi
-0xebd3e20a, // U+1D7A7 𝞧, \bisansPsi, Mathematical Sans-Serif Bold Italic Capital Psi
-0xeb266c08, // U+1D64C 𝙌, \bisansQ, Mathematical Sans-Serif Bold Italic Capital Q
-0xeb26ec48, // U+1D64D 𝙍, \bisansR, Mathematical Sans-Serif Bold Italic Capital R
-0xebd0338a, // U+1D7A0 𝞠, \bisansRho, Mathematical Sans-Serif Bold Italic Capital Rho
-0xeb276c88, // U+1D64E 𝙎, \bisansS, Mathematical Sans-Serif Bold Italic Capital S
-0xebd1000c, // U+1D7A2 𝞢, \bisansSigma, Mathematical Sans-Serif Bold Italic Capital Sigma
-0xeb27ecc8, // U+1D64F 𝙏, \bisansT, Mathematical Sans-Serif Bold Italic Capital T
-0xebd1c50a, // U+1D7A3 𝞣, \bisansTau, Mathematical Sans-Serif Bold Italic Capital Tau
-0xebcbf00c, // U+1D797 𝞗, \bisansTheta, Mathematical Sans-Serif Bold Italic Capital Theta
-0xeb286d08, // U+1D650 𝙐, \bisansU, Mathematical Sans-Serif Bold Italic Capital U
-0xebd2234e, // U+1D7A4 𝞤, \bisansUpsilon, Mathematical Sans-Serif Bold Italic Capital Upsilon
-0xeb28ed48, // U+1D651 𝙑, \bisansV, Mathematical Sans-Serif Bold Italic Capital V
-0xeb296d88, // U+1D652 𝙒, \bisansW, Mathematical Sans-Serif Bold Italic Capital W
-0xeb29edc8, // U+1D653 𝙓, \bisansX, Mathematical Sans-Serif Bold Italic Capital X
-0xebceb209, // U+1D79D 𝞝, \bisansXi, Mathematical Sans-Serif Bold Italic Capital Xi
-0xeb2a6e08, // U+1D654 𝙔, \bisansY, Mathematical Sans-Serif Bold Italic Capital Y
-0xeb2aee48, // U+1D655 𝙕, \bisansZ, Mathematical Sans-Serif Bold Italic Capital Z
-0xebcaf00b, // U+1D795 𝞕, \bisansZeta, Mathematical Sans-Serif Bold Italic Capital Zeta
-0xeb2b6008, // U+1D656 𝙖, \bisansa, Mathematical Sans-Serif Bold Italic Small A
-0xebd5300c, // U+1D7AA 𝞪, \bisansalpha, Mathematical Sans-Serif Bold Italic Small Alpha
-0xeb2be048, // U+1D657 𝙗, \bisansb, Mathematical Sans-Serif Bold Italic Small B
-0xebd5f00b, // U+1D7AB 𝞫, \bisansbeta, Mathematical Sans-Serif Bold Italic Small Beta
-0xeb2c6088, // U+1D658 𝙘, \bisansc, Mathematical Sans-Serif Bold Italic Small C
-0xebe0320a, // U+1D7C0 𝟀, \bisanschi, Mathematical Sans-Serif Bold Italic Small Chi
-0xeb2ce0c8, // U+1D659 𝙙, \bisansd, Mathematical Sans-Serif Bold Italic Small D
-0xebd6f00c, // U+1D7AD 𝞭, \bisansdelta, Mathematical Sans-Serif Bold Italic Small Delta
-0xeb2d6108, // U+1D65A 𝙚, \bisanse, Mathematical Sans-Serif Bold Italic Small E
-0xebe2234e, // U+1D7C4 𝟄, \bisansepsilon, Mathematical Sans-Serif Bold Italic Epsilon Symbol
-0xebd8700a, // U+1D7B0 𝞰, \bisanseta, Mathematical Sans-Serif Bold Italic Small Eta
-0xeb2de148, // U+1D65B 𝙛, \bisansf, Mathematical Sans-Serif Bold Italic Small F
-0xeb2e6188, // U+1D65C 𝙜, \bisansg, Mathematical Sans-Serif Bold Italic Small G
-0xebd6000c, // U+1D7AC 𝞬, \bisansgamma, Mathematical Sans-Serif Bold Italic Small Gamma
-0xeb2ee1c8, // U+1D65D 𝙝, \bisansh, Mathematical Sans-Serif Bold Italic Small H
-0xeb2f6208, // U+1D65E 𝙞, \bisansi, Mathematical Sans-Serif Bold Italic Small I
-0xebd9700b, // U+1D7B2 𝞲, \bisansiota, Mathematical Sans-Serif Bold Italic Small Iota
-0xeb2fe248, // U+1D65F 𝙟, \bisansj, Mathematical Sans-Serif Bold Italic Small J
-0xeb306288, // U+1D660 𝙠, \bisansk, Mathematical Sans-Serif Bold Italic Small K
-0xebd9b00c, // U+1D7B3 𝞳, \bisanskappa, Mathematical Sans-Serif Bold Italic Small Kappa
-0xeb30e2c8, // U+1D661 𝙡, \bisansl, Mathematical Sans-Serif Bold Italic Small L
-0xebda700d, // U+1D7B4 𝞴, \bisanslambda, Mathematical Sans-Serif Bold Italic Small Lamda
-0xeb316308, // U+1D662 𝙢, \bisansm, Mathematical Sans-Serif Bold Italic Small M
-0xebda8509, // U+1D7B5 𝞵, \bisansmu, Mathematical Sans-Serif Bold Italic Small Mu
-0xeb31e348, // U+1D663 𝙣, \bisansn, Mathematical Sans-Serif Bold Italic Small N
-0xebd4f00c, // U+1D7A9 𝞩, \bisansnabla, Mathematical Sans-Serif Bold Italic Nabla
-0xebdb1509, // U+1D7B6 𝞶, \bisansnu, Mathematical Sans-Serif Bold Italic Small Nu
-0xeb326388, // U+1D664 𝙤, \bisanso, Mathematical Sans-Serif Bold Italic Small O
-0xebe1200c, // U+1D7C2 𝟂, \bisansomega, Mathematical Sans-Serif Bold Italic Small Omega
-0xebdc234e, // U+1D7B8 𝞸, \bisansomicron, Mathematical Sans-Serif Bold Italic Small Omicron
-0xeb32e3c8, // U+1D665 𝙥, \bisansp, Mathematical Sans-Serif Bold Italic Small P
-0xebe1c2ce, // U+1D7C3 𝟃, \bisanspartial, Mathematical Sans-Serif Bold Italic Partial Differential
-0xebe3b20a, // U+1D7C7 𝟇, \bisansphi, Mathematical Sans-Serif Bold Italic Phi Symbol
-0xebdcb209, // U+1D7B9 𝞹, \bisanspi, Mathematical Sans-Serif Bold Italic Small Pi
-0xebe0e20a, // U+1D7C1 𝟁, \bisanspsi, Mathematical Sans-Serif Bold Italic Small Psi
-0xeb336408, // U+1D666 𝙦, \bisansq, Mathematical Sans-Serif Bold Italic Small Q
-0xeb33e448, // U+1D667 𝙧, \bisansr, Mathematical Sans-Serif Bold Italic Small R
-0xebdd338a, // U+1D7BA 𝞺, \bisansrho, Mathematical Sans-Serif Bold Italic Small Rho
-0xeb346488, // U+1D668 𝙨, \bisanss, Mathematical Sans-Serif Bold Italic Small S
-0xebde000c, // U+1D7BC 𝞼, \bisanssigma, Mathematical Sans-Serif Bold Italic Small Sigma
-0xeb34e4c8, // U+1D669 𝙩, \bisanst, Mathematical Sans-Serif Bold Italic Small T
-0xebdec50a, // U+1D7BD 𝞽, \bisanstau, Mathematical Sans-Serif Bold Italic Small Tau
-0xebd8f00c, // U+1D7B1 𝞱, \bisanstheta, Mathematical Sans-Serif Bold Italic Small Theta
-0xeb356508, // U+1D66A 𝙪, \bisansu, Mathematical Sans-Serif Bold Italic Small U
-0xebdf234e, // U+1D7BE 𝞾, \bisansupsilon, Mathematical Sans-Serif Bold Italic Small Upsilon
-0xeb35e548, // U+1D66B 𝙫, \bisansv, Mathematical Sans-Serif Bold Italic Small V
-0xebd0f00f, // U+1D7A1 𝞡, \bisansvarTheta, Mathematical Sans-Serif Bold Italic Capital Theta Symbol
-0xebd72351, // U+1D7AE 𝞮, \bisansvarepsilon, Mathematical Sans-Serif Bold Italic Small Epsilon
-0xebe3300f, // U+1D7C6 𝟆, \bisansvarkappa, Mathematical Sans-Serif Bold Italic Kappa Symbol
-0xebdfb20d, // U+1D7BF 𝞿, \bisansvarphi, Mathematical Sans-Serif Bold Italic Small Phi
-0xebe4b20c, // U+1D7C9 𝟉, \bisansvarpi, Mathematical Sans-Serif Bold Italic Pi Symbol
-0xebe4338d, // U+1D7C8 𝟈, \bisansvarrho, Mathematical Sans-Serif Bold Italic Rho Symbol
-0xebdd800f, // U+1D7BB 𝞻, \bisansvarsigma, Mathematical Sans-Serif Bold Italic Small Final Sigma
-0xebe2f00f, // U+1D7C5 𝟅, \bisansvartheta, Mathematical Sans-Serif Bold Italic Theta Symbol
-0xeb366588, // U+1D66C 𝙬, \bisansw, Mathematical Sans-Serif Bold Italic Small W
-0xeb36e5c8, // U+1D66D 𝙭, \bisansx, Mathematical Sans-Serif Bold Italic Small X
-0xebdbb209, // U+1D7B7 𝞷, \bisansxi, Mathematical Sans-Serif Bold Italic Small Xi
-0xeb376608, // U+1D66E 𝙮, \bisansy, Mathematical Sans-Serif Bold Italic Small Y
-0xeb37e648, // U+1D66F 𝙯, \bisansz, Mathematical Sans-Serif Bold Italic Small Z
-0xebd7f00b, // U+1D7AF 𝞯, \bisanszeta, Mathematical Sans-Serif Bold Italic Small Zeta
-0xeba40008, // U+1D748 𝝈, \bisigma, Mathematical Bold Italic Small Sigma
-0xea4ac4c4, // U+1D495 𝒕, \bit, Mathematical Bold Italic Small T
-0xeba4c506, // U+1D749 𝝉, \bitau, Mathematical Bold Italic Small Tau
-0xeb9ef008, // U+1D73D 𝜽, \bitheta, Mathematical Bold Italic Small Theta
-0xea4b4504, // U+1D496 𝒖, \biu, Mathematical Bold Italic Small U
-0xeba5234a, // U+1D74A 𝝊, \biupsilon, Mathematical Bold Italic Small Upsilon
-0xea4bc544, // U+1D497 𝒗, \biv, Mathematical Bold Italic Small V
-0xeb96f00b, // U+1D72D 𝜭, \bivarTheta, Mathematical Bold Italic Capital Theta Symbol
-0xeb9d234d, // U+1D73A 𝜺, \bivarepsilon, Mathematical Bold Italic Small Epsilon
-0xeba9300b, // U+1D752 𝝒, \bivarkappa, Mathematical Bold Italic Kappa Symbol
-0xeba5b209, // U+1D74B 𝝋, \bivarphi, Mathematical Bold Italic Small Phi
-0xebaab208, // U+1D755 𝝕, \bivarpi, Mathematical Bold Italic Pi Symbol
-0xebaa3389, // U+1D754 𝝔, \bivarrho, Mathematical Bold Italic Rho Symbol
-0xeba3800b, // U+1D747 𝝇, \bivarsigma, Mathematical Bold Italic Small Final Sigma
-0xeba8f00b, // U+1D751 𝝑, \bivartheta, Mathematical Bold Italic Theta Symbol
-0xea4c4584, // U+1D498 𝒘, \biw, Mathematical Bold Italic Small W
-0xea4cc5c4, // U+1D499 𝒙, \bix, Mathematical Bold Italic Small X
-0xeba1b205, // U+1D743 𝝃, \bixi, Mathematical Bold Italic Small Xi
-0xea4d4604, // U+1D49A 𝒚, \biy, Mathematical Bold Italic Small Y
-0xea4dc644, // U+1D49B 𝒛, \biz, Mathematical Bold Italic Small Z
-0xeb9df007, // U+1D73B 𝜻, \bizeta, Mathematical Bold Italic Small Zeta
-0x1486a587, // U+0290D ⤍, \bkarow, Rightwards Double Dash Arrow
-0x134424d5, // U+02688 ⚈, \blackcircledrightdot, Black Circle With White Dot Right
-0x1344f494, // U+02689 ⚉, \blackcircledtwodots, Black Circle With Two White Dots
-0x12eaf117, // U+025D5 ◕, \blackcircleulquadwhite, Circle With All But Upper Left Quadrant Black
-0x12e410d4, // U+025C8 ◈, \blackinwhitediamond, White Diamond Containing Black Small Diamond
-0x12d1d113, // U+025A3 ▣, \blackinwhitesquare, White Square Containing Black Small Square
-0x12eb7114, // U+025D6 ◖, \blacklefthalfcircle, Left Half Black Circle
-0x14f5a10d, // U+029EB ⧫, \blacklozenge, Black Lozenge
-0x12e214d1, // U+025C4 ◄, \blackpointerleft, Black Left-Pointing Pointer / Black Left Pointing Pointer
-0x12dd34d2, // U+025BA ►, \blackpointerright, Black Right-Pointing Pointer / Black Right Pointing Pointer
-0x12ebf115, // U+025D7 ◗, \blackrighthalfcircle, Right Half Black Circle
-0x131d860c, // U+0263B ☻, \blacksmiley, Black Smiling Face
-0x12d0510c, // U+025A0 ■, \blacksquare, Black Square
-0x12da710e, // U+025B4 ▴, \blacktriangle, Black Up-Pointing Small Triangle / Black Up Pointing Small Triangle
-0x12df2352, // U+025BE ▾, \blacktriangledown, Black Down-Pointing Small Triangle / Black Down Pointing Small Triangle
-0x12e014d2, // U+025C0 ◀, \blacktriangleleft, Black Left-Pointing Triangle / Black Left Pointing Triangle
-0x12db34d3, // U+025B6 ▶, \blacktriangleright, Black Right-Pointing Triangle / Black Right Pointing Triangle
-0x121122cc, // U+02422 ␢, \blanksymbol, Blank Symbol / Blank
-0x159642cc, // U+02B2C ⬬, \blkhorzoval, Black Horizontal Ellipse
-0x159742cc, // U+02B2E ⬮, \blkvertoval, Black Vertical Ellipse
-0x12c472ca, // U+02588 █, \blockfull, Full Block
-0x12c900d0, // U+02592 ▒, \blockhalfshaded, Medium Shade
-0x12c6714e, // U+0258C ▌, \blocklefthalf, Left Half Block
-0x12c2714d, // U+02584 ▄, \blocklowhalf, Lower Half Block
-0x12c880cf, // U+02591 ░, \blockqtrshaded, Light Shade
-0x12c8714f, // U+02590 ▐, \blockrighthalf, Right Half Block
-0x12c980d4, // U+02593 ▓, \blockthreeqtrshaded, Dark Shade
-0x12c0714c, // U+02580 ▀, \blockuphalf, Upper Half Block
-0x1152a4c4, // U+022A5 ⊥, \bot, Up Tack
-0x12f0f10e, // U+025E1 ◡, \botsemicircle, Lower Half Circle
-0x11644107, // U+022C8 ⋈, \bowtie, Bowtie
-0x14e364c7, // U+029C6 ⧆, \boxast, Squared Asterisk
-0x12f5c447, // U+025EB ◫, \boxbar, White Square With Vertical Bisecting Line
-0x14e2e1ca, // U+029C5 ⧅, \boxbslash, Squared Falling Diagonal Slash
-0x14e3f10a, // U+029C7 ⧇, \boxcircle, Squared Small Circle
-0x14e24188, // U+029C4 ⧄, \boxdiag, Squared Rising Diagonal Slash
-0x1150a4c7, // U+022A1 ⊡, \boxdot, Squared Dot Operator
-0x114f8489, // U+0229F ⊟, \boxminus, Squared Minus
-0x114f0488, // U+0229E ⊞, \boxplus, Squared Plus
-0x11b8234c, // U+02370 ⍰, \boxquestion, Apl Functional Symbol Quad Question
-0x11500489, // U+022A0 ⊠, \boxtimes, Squared Times
-0x11a984cb, // U+02353 ⍓, \boxupcaret, Apl Functional Symbol Quad Up Caret
-0x01831106, // U+00306 ̆, \breve, Combining Breve / Non-Spacing Breve
-0x0053444a, // U+000A6 ¦, \brokenbar, Broken Bar / Broken Vertical Bar
-0xeaea6807, // U+1D5D4 𝗔, \bsansA, Mathematical Sans-Serif Bold Capital A
-0xebab300b, // U+1D756 𝝖, \bsansAlpha, Mathematical Sans-Serif Bold Capital Alpha
-0xeaeae847, // U+1D5D5 𝗕, \bsansB, Mathematical Sans-Serif Bold Capital B
-0xebabf00a, // U+1D757 𝝗, \bsansBeta, Mathematical Sans-Serif Bold Capital Beta
-0xeaeb6887, // U+1D5D6 𝗖, \bsansC, Mathematical Sans-Serif Bold Capital C
-0xebb63209, // U+1D76C 𝝬, \bsansChi, Mathematical Sans-Serif Bold Capital Chi
-0xeaebe8c7, // U+1D5D7 𝗗, \bsansD, Mathematical Sans-Serif Bold Capital D
-0xebacf00b, // U+1D759 𝝙, \bsansDelta, Mathematical Sans-Serif Bold Capital Delta
-0xeaec6907, // U+1D5D8 𝗘, \bsansE, Mathematical Sans-Serif Bold Capital E
-0xebad234d, // U+1D75A 𝝚, \bsansEpsilon, Mathematical Sans-Serif Bold Capital Epsilon
-0xebae7009, // U+1D75C 𝝜, \bsansEta, Mathematical Sans-Serif Bold Capital Eta
-0xeaece947, // U+1D5D9 𝗙, \bsansF, Mathematical Sans-Serif Bold Capital F
-0xeaed6987, // U+1D5DA 𝗚, \bsansG, Mathematical Sans-Serif Bold Capital G
-0xebac000b, // U+1D758 𝝘, \bsansGamma, Mathematical Sans-Serif Bold Capital Gamma
-0xeaede9c7, // U+1D5DB 𝗛, \bsansH, Mathematical Sans-Serif Bold Capital H
-0xeaee6a07, // U+1D5DC 𝗜, \bsansI, Mathematical Sans-Serif Bold Capital I
-0xebaf700a, // U+1D75E 𝝞, \bsansIota, Mathematical Sans-Serif Bold Capital Iota
-0xeaeeea47, // U+1D5DD 𝗝, \bsansJ, Mathematical Sans-Serif Bold Capital J
-0xeaef6a87, // U+1D5DE 𝗞, \bsansK, Mathematical Sans-Serif Bold Capital K
-0xebafb00b, // U+1D75F 𝝟, \bsansKappa, Mathematical Sans-Serif Bold Capital Kappa
-0xeaefeac7, // U+1D5DF 𝗟, \bsansL, Mathematical Sans-Serif Bold Capital L
-0xebb0700c, // U+1D760 𝝠, \bsansLambda, Mathematical Sans-Serif Bold Capital Lamda
-0xeaf06b07, // U+1D5E0 𝗠, \bsansM, Mathematical Sans-Serif Bold Capital M
-0xebb08508, // U+1D761 𝝡, \bsansMu, Mathematical Sans-Serif Bold Capital Mu
-0xeaf0eb47, // U+1D5E1 𝗡, \bsansN, Mathematical Sans-Serif Bold Capital N
-0xebb11508, // U+1D762 𝝢, \bsansNu, Mathematical Sans-Serif Bold Capital Nu
-0xeaf16b87, // U+1D5E2 𝗢, \bsansO, Mathematical Sans-Serif Bold Capital O
-0xebb7200b, // U+1D76E 𝝮, \bsansOmega, Mathematical Sans-Serif Bold Capital Omega
-0xebb2234d, // U+1D764 𝝤, \bsansOmicron, Mathematical Sans-Serif Bold Capital Omicron
-0xeaf1ebc7, // U+1D5E3 𝗣, \bsansP, Mathematical Sans-Serif Bold Capital P
-0xebb5b209, // U+1D76B 𝝫, \bsansPhi, Mathematical Sans-Serif Bold Capital Phi
-0xebb2b208, // U+1D765 𝝥, \bsansPi, Mathematical Sans-Serif Bold Capital Pi
-0xebb6e209, // U+1D76D 𝝭, \bsansPsi, Mathematical Sans-Serif Bold Capital Psi
-0xeaf26c07, // U+1D5E4 𝗤, \bsansQ, Mathematical Sans-Serif Bold Capital Q
-0xeaf2ec47, // U+1D5E5 𝗥, \bsansR, Mathematical Sans-Serif Bold Capital R
-0xebb33389, // U+1D766 𝝦, \bsansRho, Mathematical Sans-Serif Bold Capital Rho
-0xeaf36c87, // U+1D5E6 𝗦, \bsansS, Mathematical Sans-Serif Bold Capital S
-0xebb4000b, // U+1D768 𝝨, \bsansSigma, Mathematical Sans-Serif Bold Capital Sigma
-0xeaf3ecc7, // U+1D5E7 𝗧, \bsansT, Mathematical Sans-Serif Bold Capital T
-0xebb4c509, // U+1D769 𝝩, \bsansTau, Mathematical Sans-Serif Bold Capital Tau
-0xebaef00b, // U+1D75D 𝝝, \bsansTheta, Mathematical Sans-Serif Bold Capital Theta
-0xeaf46d07, // U+1D5E8 𝗨, \bsansU, Mathematical Sans-Serif Bold Capital U
-0xebb5234d, // U+1D76A 𝝪, \bsansUpsilon, Mathematical Sans-Serif Bold Capital Upsilon
-0xeaf4ed47, // U+1D5E9 𝗩, \bsansV, Mathematical Sans-Serif Bold Capital V
-0xeaf56d87, // U+1D5EA 𝗪, \bsansW, Mathematical Sans-Serif Bold Capital W
-0xeaf5edc7, // U+1D5EB 𝗫, \bsansX, Mathematical Sans-Serif Bold Capital X
-0xebb1b208, // U+1D763 𝝣, \bsansXi, Mathematical Sans-Serif Bold Capital Xi
-0xeaf66e07, // U+1D5EC 𝗬, \bsansY, Mathematical Sans-Serif Bold Capital Y
-0xeaf6ee47, // U+1D5ED 𝗭, \bsansZ, Mathematical Sans-Serif Bold Capital Z
-0xebadf00a, // U+1D75B 𝝛, \bsansZeta, Mathematical Sans-Serif Bold Capital Zeta
-0xeaf76007, // U+1D5EE 𝗮, \bsansa, Mathematical Sans-Serif Bold Small A
-0xebb8300b, // U+1D770 𝝰, \bsansalpha, Mathematical Sans-Serif Bold Small Alpha
-0xeaf7e047, // U+1D5EF 𝗯, \bsansb, Mathematical Sans-Serif Bold Small B
-0xebb8f00a, // U+1D771 𝝱, \bsansbeta, Mathematical Sans-Serif Bold Small Beta
-0xeaf86087, // U+1D5F0 𝗰, \bsansc, Mathematical Sans-Serif Bold Small C
-0xebc33209, // U+1D786 𝞆, \bsanschi, Mathematical Sans-Serif Bold Small Chi
-0xeaf8e0c7, // U+1D5F1 𝗱, \bsansd, Mathematical Sans-Serif Bold Small D
-0xebb9f00b, // U+1D773 𝝳, \bsansdelta, Mathematical Sans-Serif Bold Small Delta
-0xeaf96107, // U+1D5F2 𝗲, \bsanse, Mathematical Sans-Serif Bold Small E
-0xebfa34cb, // U+1D7F4 𝟴, \bsanseight, Mathematical Sans-Serif Bold Digit Eight
-0xebc5234d, // U+1D78A 𝞊, \bsansepsilon, Mathematical Sans-Serif Bold Epsilon Symbol
-0xebbb7009, // U+1D776 𝝶, \bsanseta, Mathematical Sans-Serif Bold Small Eta
-0xeaf9e147, // U+1D5F3 𝗳, \bsansf, Mathematical Sans-Serif Bold Small F
-0xebf8910a, // U+1D7F1 𝟱, \bsansfive, Mathematical Sans-Serif Bold Digit Five
-0xebf8044a, // U+1D7F0 𝟰, \bsansfour, Mathematical Sans-Serif Bold Digit Four
-0xeafa6187, // U+1D5F4 𝗴, \bsansg, Mathematical Sans-Serif Bold Small G
-0xebb9000b, // U+1D772 𝝲, \bsansgamma, Mathematical Sans-Serif Bold Small Gamma
-0xeafae1c7, // U+1D5F5 𝗵, \bsansh, Mathematical Sans-Serif Bold Small H
-0xeafb6207, // U+1D5F6 𝗶, \bsansi, Mathematical Sans-Serif Bold Small I
-0xebbc700a, // U+1D778 𝝸, \bsansiota, Mathematical Sans-Serif Bold Small Iota
-0xeafbe247, // U+1D5F7 𝗷, \bsansj, Mathematical Sans-Serif Bold Small J
-0xeafc6287, // U+1D5F8 𝗸, \bsansk, Mathematical Sans-Serif Bold Small K
-0xebbcb00b, // U+1D779 𝝹, \bsanskappa, Mathematical Sans-Serif Bold Small Kappa
-0xeafce2c7, // U+1D5F9 𝗹, \bsansl, Mathematical Sans-Serif Bold Small L
-0xebbd700c, // U+1D77A 𝝺, \bsanslambda, Mathematical Sans-Serif Bold Small Lamda
-0xeafd6307, // U+1D5FA 𝗺, \bsansm, Mathematical Sans-Serif Bold Small M
-0xebbd8508, // U+1D77B 𝝻, \bsansmu, Mathematical Sans-Serif Bold Small Mu
-0xeafde347, // U+1D5FB 𝗻, \bsansn, Mathematical Sans-Serif Bold Small N
-0xebb7f00b, // U+1D76F 𝝯, \bsansnabla, Mathematical Sans-Serif Bold Nabla
-0xebfa910a, // U+1D7F5 𝟵, \bsansnine, Mathematical Sans-Serif Bold Digit Nine
-0xebbe1508, // U+1D77C 𝝼, \bsansnu, Mathematical Sans-Serif Bold Small Nu
-0xeafe6387, // U+1D5FC 𝗼, \bsanso, Mathematical Sans-Serif Bold Small O
-0xebc4200b, // U+1D788 𝞈, \bsansomega, Mathematical Sans-Serif Bold Small Omega
-0xebbf234d, // U+1D77E 𝝾, \bsansomicron, Mathematical Sans-Serif Bold Small Omicron
-0xebf69109, // U+1D7ED 𝟭, \bsansone, Mathematical Sans-Serif Bold Digit One
-0xeafee3c7, // U+1D5FD 𝗽, \bsansp, Mathematical Sans-Serif Bold Small P
-0xebc4c2cd, // U+1D789 𝞉, \bsanspartial, Mathematical Sans-Serif Bold Partial Differential
-0xebc6b209, // U+1D78D 𝞍, \bsansphi, Mathematical Sans-Serif Bold Phi Symbol
-0xebbfb208, // U+1D77F 𝝿, \bsanspi, Mathematical Sans-Serif Bold Small Pi
-0xebc3e209, // U+1D787 𝞇, \bsanspsi, Mathematical Sans-Serif Bold Small Psi
-0xeaff6407, // U+1D5FE 𝗾, \bsansq, Mathematical Sans-Serif Bold Small Q
-0xeaffe447, // U+1D5FF 𝗿, \bsansr, Mathematical Sans-Serif Bold Small R
-0xebc03389, // U+1D780 𝞀, \bsansrho, Mathematical Sans-Serif Bold Small Rho
-0xeb006487, // U+1D600 𝘀, \bsanss, Mathematical Sans-Serif Bold Small S
-0xebf9834b, // U+1D7F3 𝟳, \bsansseven, Mathematical Sans-Serif Bold Digit Seven
-0xebc1000b, // U+1D782 𝞂, \bsanssigma, Mathematical Sans-Serif Bold Small Sigma
-0xebf945c9, // U+1D7F2 𝟲, \bsanssix, Mathematical Sans-Serif Bold Digit Six
-0xeb00e4c7, // U+1D601 𝘁, \bsanst, Mathematical Sans-Serif Bold Small T
-0xebc1c509, // U+1D783 𝞃, \bsanstau, Mathematical Sans-Serif Bold Small Tau
-0xebbbf00b, // U+1D777 𝝷, \bsanstheta, Mathematical Sans-Serif Bold Small Theta
-0xebf7810b, // U+1D7EF 𝟯, \bsansthree, Mathematical Sans-Serif Bold Digit Three
-0xebf72389, // U+1D7EE 𝟮, \bsanstwo, Mathematical Sans-Serif Bold Digit Two
-0xeb016507, // U+1D602 𝘂, \bsansu, Mathematical Sans-Serif Bold Small U
-0xebc2234d, // U+1D784 𝞄, \bsansupsilon, Mathematical Sans-Serif Bold Small Upsilon
-0xeb01e547, // U+1D603 𝘃, \bsansv, Mathematical Sans-Serif Bold Small V
-0xebb3f00e, // U+1D767 𝝧, \bsansvarTheta, Mathematical Sans-Serif Bold Capital Theta Symbol
-0xebba2350, // U+1D774 𝝴, \bsansvarepsilon, Mathematical Sans-Serif Bold Small Epsilon
-0xebc6300e, // U+1D78C 𝞌, \bsansvarkappa, Mathematical Sans-Serif Bold Kappa Symbol
-0xebc2b20c, // U+1D785 𝞅, \bsansvarphi, Mathematical Sans-Serif Bold Small Phi
-0xebc7b20b, // U+1D78F 𝞏, \bsansvarpi, Mathematical Sans-Serif Bold Pi Symbol
-0xebc7338c, // U+1D78E 𝞎, \bsansvarrho, Mathematical Sans-Serif Bold Rho Symbol
-0xebc0800e, // U+1D781 𝞁, \bsansvarsigma, Mathematical Sans-Serif Bold Small Final Sigma
-0xebc5f00e, // U+1D78B 𝞋, \bsansvartheta, Mathematical Sans-Serif Bold Theta Symbol
-0xeb026587, // U+1D604 𝘄, \bsansw, Mathematical Sans-Serif Bold Small W
-0xeb02e5c7, // U+1D605 𝘅, \bsansx, Mathematical Sans-Serif Bold Small X
-0xebbeb208, // U+1D77D 𝝽, \bsansxi, Mathematical Sans-Serif Bold Small Xi
-0xeb036607, // U+1D606 𝘆, \bsansy, Mathematical Sans-Serif Bold Small Y
-0xeb03e647, // U+1D607 𝘇, \bsansz, Mathematical Sans-Serif Bold Small Z
-0xebf6538a, // U+1D7EC 𝟬, \bsanszero, Mathematical Sans-Serif Bold Digit Zero
-0xebbaf00a, // U+1D775 𝝵, \bsanszeta, Mathematical Sans-Serif Bold Small Zeta
-0xea685806, // U+1D4D0 𝓐, \bscrA, Mathematical Bold Script Capital A
-0xea68d846, // U+1D4D1 𝓑, \bscrB, Mathematical Bold Script Capital B
-0xea695886, // U+1D4D2 𝓒, \bscrC, Mathematical Bold Script Capital C
-0xea69d8c6, // U+1D4D3 𝓓, \bscrD, Mathematical Bold Script Capital D
-0xea6a5906, // U+1D4D4 𝓔, \bscrE, Mathematical Bold Script Capital E
-0xea6ad946, // U+1D4D5 𝓕, \bscrF, Mathematical Bold Script Capital F
-0xea6b5986, // U+1D4D6 𝓖, \bscrG, Mathematical Bold Script Capital G
-0xea6bd9c6, // U+1D4D7 𝓗, \bscrH, Mathematical Bold Script Capital H
-0xea6c5a06, // U+1D4D8 𝓘, \bscrI, Mathematical Bold Script Capital I
-0xea6cda46, // U+1D4D9 𝓙, \bscrJ, Mathematical Bold Script Capital J
-0xea6d5a86, // U+1D4DA 𝓚, \bscrK, Mathematical Bold Script Capital K
-0xea6ddac6, // U+1D4DB 𝓛, \bscrL, Mathematical Bold Script Capital L
-0xea6e5b06, // U+1D4DC 𝓜, \bscrM, Mathematical Bold Script Capital M
-0xea6edb46, // U+1D4DD 𝓝, \bscrN, Mathematical Bold Script Capital N
-0xea6f5b86, // U+1D4DE 𝓞, \bscrO, Mathematical Bold Script Capital O
-0xea6fdbc6, // U+1D4DF 𝓟, \bscrP, Mathematical Bold Script Capital P
-0xea705c06, // U+1D4E0 𝓠, \bscrQ, Mathematical Bold Script Capital Q
-0xea70dc46, // U+1D4E1 𝓡, \bscrR, Mathematical Bold Script Capital R
-0xea715c86, // U+1D4E2 𝓢, \bscrS, Mathematical Bold Script Capital S
-0xea71dcc6, // U+1D4E3 𝓣, \bscrT, Mathematical Bold Script Capital T
-0xea725d06, // U+1D4E4 𝓤, \bscrU, Mathematical Bold Script Capital U
-0xea72dd46, // U+1D4E5 𝓥, \bscrV, Mathematical Bold Script Capital V
-0xea735d86, // U+1D4E6 𝓦, \bscrW, Mathematical Bold Script Capital W
-0xea73ddc6, // U+1D4E7 𝓧, \bscrX, Mathematical Bold Script Capital X
-0xea745e06, // U+1D4E8 𝓨, \bscrY, Mathematical Bold Script Capital Y
-0xea74de46, // U+1D4E9 𝓩, \bscrZ, Mathematical Bold Script Capital Z
-0xea755006, // U+1D4EA 𝓪, \bscra, Mathematical Bold Script Small A
-0xea75d046, // U+1D4EB 𝓫, \bscrb, Mathematical Bold Script Small B
-0xea765086, // U+1D4EC 𝓬, \bscrc, Mathematical Bold Script Small C
-0xea76d0c6, // U+1D4ED 𝓭, \bscrd, Mathematical Bold Script Small D
-0xea775106, // U+1D4EE 𝓮, \bscre, Mathematical Bold Script Small E
-0xea77d146, // U+1D4EF 𝓯, \bscrf, Mathematical Bold Script Small F
-0xea785186, // U+1D4F0 𝓰, \bscrg, Mathematical Bold Script Small G
-0xea78d1c6, // U+1D4F1 𝓱, \bscrh, Mathematical Bold Script Small H
-0xea795206, // U+1D4F2 𝓲, \bscri, Mathematical Bold Script Small I
-0xea79d246, // U+1D4F3 𝓳, \bscrj, Mathematical Bold Script Small J
-0xea7a5286, // U+1D4F4 𝓴, \bscrk, Mathematical Bold Script Small K
-0xea7ad2c6, // U+1D4F5 𝓵, \bscrl, Mathematical Bold Script Small L
-0xea7b5306, // U+1D4F6 𝓶, \bscrm, Mathematical Bold Script Small M
-0xea7bd346, // U+1D4F7 𝓷, \bscrn, Mathematical Bold Script Small N
-0xea7c5386, // U+1D4F8 𝓸, \bscro, Mathematical Bold Script Small O
-0xea7cd3c6, // U+1D4F9 𝓹, \bscrp, Mathematical Bold Script Small P
-0xea7d5406, // U+1D4FA 𝓺, \bscrq, Mathematical Bold Script Small Q
-0xea7dd446, // U+1D4FB 𝓻, \bscrr, Mathematical Bold Script Small R
-0xea7e5486, // U+1D4FC 𝓼, \bscrs, Mathematical Bold Script Small S
-0xea7ed4c6, // U+1D4FD 𝓽, \bscrt, Mathematical Bold Script Small T
-0xea7f5506, // U+1D4FE 𝓾, \bscru, Mathematical Bold Script Small U
-0xea7fd546, // U+1D4FF 𝓿, \bscrv, Mathematical Bold Script Small V
-0xea805586, // U+1D500 𝔀, \bscrw, Mathematical Bold Script Small W
-0xea80d5c6, // U+1D501 𝔁, \bscrx, Mathematical Bold Script Small X
-0xea815606, // U+1D502 𝔂, \bscry, Mathematical Bold Script Small Y
-0xea81d646, // U+1D503 𝔃, \bscrz, Mathematical Bold Script Small Z
-0x15a0a592, // U+02B41 ⭁, \bsimilarleftarrow, Reverse Tilde Operator Above Leftwards Arrow
-0x15a3a593, // U+02B47 ⭇, \bsimilarrightarrow, Reverse Tilde Operator Above Rightwards Arrow
-0x13e40049, // U+027C8 ⟈, \bsolhsub, Reverse Solidus Preceding Subset
-0x013672c5, // U+0026C ɬ, \btdl, Latin Small Letter L With Belt / Latin Small Letter L Belt
-0x15190487, // U+02A32 ⨲, \btimes, Semidirect Product With Bottom Closed
-0x101104c7, // U+02022 •, \bullet, Bullet
-0x12e74109, // U+025CE ◎, \bullseye, Bullseye
-0x11278407, // U+0224F ≏, \bumpeq, Difference Between
-0x15574408, // U+02AAE ⪮, \bumpeqq, Equals Sign With Bumpy Above
-0x01938082, // U+00327 ̧, \c, Combining Cedilla / Non-Spacing Cedilla
-0x13258447, // U+0264B ♋, \cancer, Cancer
-0x01885007, // U+00310 ̐, \candra, Combining Candrabindu / Non-Spacing Candrabindu
-0x1114c3c4, // U+02229 ∩, \cap, Intersection
-0x152024c7, // U+02A40 ⩀, \capdot, Intersection With Dot
-0x1328848c, // U+02651 ♑, \capricornus, Capricorn
-0x15222109, // U+02A44 ⩄, \capwedge, Intersection With Logical And
-0x10dad34f, // U+021B5 ↵, \carriagereturn, Downwards Arrow With Corner Leftwards / Down Arrow With Corner Left
-0x110dd4c5, // U+0221B ∛, \cbrt, Cube Root
-0x1162a4c5, // U+022C5 ⋅, \cdot, Dot Operator
-0x005bf3c6, // U+000B7 ·, \cdotp, Middle Dot
-0x1177f486, // U+022EF ⋯, \cdots, Midline Horizontal Ellipsis
-0x01866286, // U+0030C ̌, \check, Combining Caron / Non-Spacing Hacek
-0x1389d28a, // U+02713 ✓, \checkmark, Check Mark
-0x01e3b204, // U+003C7 χ, \chi, Greek Small Letter Chi
-0x110c5085, // U+02218 ∘, \circ, Ring Operator
-0x112b8407, // U+02257 ≗, \circeq, Ring Equal To
-0x10dd14d0, // U+021BA ↺, \circlearrowleft, Anticlockwise Open Circle Arrow
-0x10ddb4d1, // U+021BB ↻, \circlearrowright, Clockwise Open Circle Arrow
-0x00577c49, // U+000AE ®, \circledR, Registered Sign / Registered Trade Mark Sign
-0x12647c89, // U+024C8 Ⓢ, \circledS, Circled Latin Capital Letter S
-0x114de4cb, // U+0229B ⊛, \circledast, Circled Asterisk Operator
-0x14df84ce, // U+029BF ⦿, \circledbullet, Circled Bullet
-0x114d508c, // U+0229A ⊚, \circledcirc, Circled Ring Operator
-0x114ee1cc, // U+0229D ⊝, \circleddash, Circled Dash
-0x114e42cd, // U+0229C ⊜, \circledequal, Circled Equals
-0x14db82d0, // U+029B7 ⦷, \circledparallel, Circled Parallel
-0x134324d0, // U+02686 ⚆, \circledrightdot, White Circle With Dot Right
-0x1395444c, // U+0272A ✪, \circledstar, Circled White Star
-0x1343f48f, // U+02687 ⚇, \circledtwodots, White Circle With Two Dots
-0x14df04d3, // U+029BE ⦾, \circledwhitebullet, Circled White Bullet
-0x12fac0cd, // U+025F5 ◵, \circlellquad, White Circle With Lower Left Quadrant
-0x12fb40cd, // U+025F6 ◶, \circlelrquad, White Circle With Lower Right Quadrant
-0x15982592, // U+02B30 ⬰, \circleonleftarrow, Left Arrow With Small Circle
-0x10fa2593, // U+021F4 ⇴, \circleonrightarrow, Right Arrow With Small Circle
-0x12e9e293, // U+025D3 ◓, \circletophalfblack, Circle With Upper Half Black
-0x12fa40cd, // U+025F4 ◴, \circleulquad, White Circle With Upper Left Quadrant
-0x12fbc0cd, // U+025F7 ◷, \circleurquad, White Circle With Upper Right Quadrant
-0x12ea6292, // U+025D4 ◔, \circleurquadblack, Circle With Upper Right Quadrant Black
-0x12e6f2cf, // U+025CD ◍, \circlevertfill, Circle With Vertical Fill
-0x12e91046, // U+025D2 ◒, \cirfb, Circle With Lower Half Black
-0x12e812c6, // U+025D0 ◐, \cirfl, Circle With Left Half Black
-0x150814c9, // U+02A10 ⨐, \cirfnint, Circulation Function
-0x12e89446, // U+025D1 ◑, \cirfr, Circle With Right Half Black
-0x150794ca, // U+02A0F ⨏, \clockoint, Integral Average With Slash
-0x013b8187, // U+00277 ɷ, \clomeg, Latin Small Letter Closed Omega
-0x1526c3cd, // U+02A4D ⩍, \closedvarcap, Closed Intersection With Serifs
-0x152603cd, // U+02A4C ⩌, \closedvarcup, Closed Union With Serifs
-0x152820d6, // U+02A50 ⩐, \closedvarcupsmashprod, Closed Union With Serifs And Smash Product
-0x1331c4c9, // U+02663 ♣, \clubsuit, Black Club Suit
-0x1118c2cc, // U+02231 ∱, \clwintegral, Clockwise Integral
-0x112a0408, // U+02254 ≔, \coloneq, Colon Equals / Colon Equal
-0x1514848b, // U+02A29 ⨩, \commaminus, Minus Sign With Comma Above
-0x110094cb, // U+02201 ∁, \complement, Complement
-0x11229185, // U+02245 ≅, \cong, Approximately Equal To
-0x1536a4c8, // U+02A6D ⩭, \congdot, Congruent With Dot Above
-0x1199044b, // U+02332 ⌲, \conictaper, Conical Taper
-0x150394ca, // U+02A07 ⨇, \conjquant, Two Logical And Operator
-0x110820c7, // U+02210 ∐, \coprod, N-Ary Coproduct
-0x0054b4ca, // U+000A9 ©, \copyright, Copyright Sign
-0x15678045, // U+02ACF ⫏, \csub, Closed Subset
-0x1568d106, // U+02AD1 ⫑, \csube, Closed Subset Or Equal To
-0x156803c5, // U+02AD0 ⫐, \csup, Closed Superset
-0x15693106, // U+02AD2 ⫒, \csupe, Closed Superset Or Equal To
-0x111503c4, // U+0222A ∪, \cup, Union
-0x1146a4c7, // U+0228D ⊍, \cupdot, Multiset Multiplication
-0x15228107, // U+02A45 ⩅, \cupvee, Union With Logical Or
-0x116f008c, // U+022DE ⋞, \curlyeqprec, Equal To Or Precedes
-0x116fe08c, // U+022DF ⋟, \curlyeqsucc, Equal To Or Succeeds
-0x11670109, // U+022CE ⋎, \curlyvee, Curly Logical Or
-0x1167a10b, // U+022CF ⋏, \curlywedge, Curly Logical And
-0x10db14cf, // U+021B6 ↶, \curvearrowleft, Anticlockwise Top Semicircle Arrow
-0x10dbb4d0, // U+021B7 ↷, \curvearrowright, Clockwise Top Semicircle Arrow
-0x10100447, // U+02020 †, \dagger, Dagger
-0x109c71c7, // U+02138 ℸ, \daleth, Dalet Symbol / Fourth Transfinite Cardinal
-0x13108447, // U+02621 ☡, \danger, Caution Sign
-0x1571bd46, // U+02AE3 ⫣, \dashV, Double Vertical Bar Left Turnstile
-0x14b5a354, // U+0296B ⥫, \dashleftharpoondown, Leftwards Harpoon With Barb Down Below Long Dash
-0x14b6a355, // U+0296D ⥭, \dashrightharpoondown, Rightwards Harpoon With Barb Down Below Long Dash
-0x1151b546, // U+022A3 ⊣, \dashv, Left Tack
-0x1487a588, // U+0290F ⤏, \dbkarow, Rightwards Triple Dash Arrow
-0x10e2a34f, // U+021C5 ⇅, \dblarrowupdown, Upwards Arrow Leftwards Of Downwards Arrow / Up Arrow Left Of Down Arrow
-0x10108448, // U+02021 ‡, \ddagger, Double Dagger
-0x106e24c7, // U+020DC ⃜, \ddddot, Combining Four Dots Above / Non-Spacing Four Dots Above
-0x106da4c6, // U+020DB ⃛, \dddot, Combining Three Dots Above / Non-Spacing Three Dots Above
-0x14cc9086, // U+02999 ⦙, \ddfnc, Dotted Fence
-0x018424c5, // U+00308 ̈, \ddot, Combining Diaeresis / Non-Spacing Diaeresis
-0x1178f486, // U+022F1 ⋱, \ddots, Down Right Diagonal Ellipsis
-0x153b8408, // U+02A77 ⩷, \ddotseq, Equals Sign With Two Dots Above And Two Dots Below
-0x14e5c486, // U+029CB ⧋, \defas, Triangle With Underbar
-0x00580107, // U+000B0 °, \degree, Degree Sign
-0x110382c4, // U+02207 ∇, \del, Nabla
-0x01da7006, // U+003B4 δ, \delta, Greek Small Letter Delta
-0x007801c3, // U+000F0 ð, \dh, Latin Small Letter Eth
-0x12b92349, // U+02572 ╲, \diagdown, Box Drawings Light Diagonal Upper Left To Lower Right / Forms Light Diagonal Upper Left To Lower Right
-0x12b883c7, // U+02571 ╱, \diagup, Box Drawings Light Diagonal Upper Right To Lower Left / Forms Light Diagonal Upper Right To Lower Left
-0x11800449, // U+02300 ⌀, \diameter, Diameter Sign
-0x116210c8, // U+022C4 ⋄, \diamond, Diamond Operator
-0x158ce290, // U+02B19 ⬙, \diamondbotblack, Diamond With Bottom Half Black
-0x148ea591, // U+0291D ⤝, \diamondleftarrow, Leftwards Arrow To Black Diamond
-0x148fc454, // U+0291F ⤟, \diamondleftarrowbar, Leftwards Arrow From Bar To Black Diamond
-0x158b6291, // U+02B16 ⬖, \diamondleftblack, Diamond With Left Half Black
-0x158be292, // U+02B17 ⬗, \diamondrightblack, Diamond With Right Half Black
-0x133144cc, // U+02662 ♢, \diamondsuit, White Diamond Suit
-0x158c6290, // U+02B18 ⬘, \diamondtopblack, Diamond With Top Half Black
-0x13400206, // U+02680 ⚀, \dicei, Die Face-1
-0x1340c207, // U+02681 ⚁, \diceii, Die Face-2
-0x13414208, // U+02682 ⚂, \diceiii, Die Face-3
-0x1341c547, // U+02683 ⚃, \diceiv, Die Face-4
-0x13420546, // U+02684 ⚄, \dicev, Die Face-5
-0x13429207, // U+02685 ⚅, \dicevi, Die Face-6
-0x01ee8008, // U+003DD ϝ, \digamma, Greek Small Letter Digamma
-0x139ee28d, // U+0273D ✽, \dingasterisk, Heavy Teardrop-Spoked Asterisk
-0x11794346, // U+022F2 ⋲, \disin, Element Of With Long Horizontal Stroke
-0x150414ca, // U+02A08 ⨈, \disjquant, Two Logical Or Operator
-0x007bc544, // U+000F7 ÷, \div, Division Sign
-0x1163848e, // U+022C7 ⋇, \divideontimes, Division Times
-0x00888243, // U+00111 đ, \dj, Latin Small Letter D With Stroke / Latin Small Letter D Bar
-0x11d1d347, // U+023A3 ⎣, \dlcorn, Left Square Bracket Lower Corner
-0x0183a4c4, // U+00307 ̇, \dot, Combining Dot Above / Non-Spacing Dot Above
-0x11280406, // U+02250 ≐, \doteq, Approaches The Limit
-0x1533c549, // U+02A67 ⩧, \dotequiv, Identical With Dot Above
-0x111c0489, // U+02238 ∸, \dotminus, Dot Minus
-0x110a0488, // U+02214 ∔, \dotplus, Dot Plus
-0x10137485, // U+02026 …, \dots, Horizontal Ellipsis
-0x15354307, // U+02A6A ⩪, \dotsim, Tilde Operator With Dot Above
-0x111d748e, // U+0223A ∺, \dotsminusdots, Geometric Proportion
-0x12e6710d, // U+025CC ◌, \dottedcircle, Dotted Circle
-0x158d510d, // U+02B1A ⬚, \dottedsquare, Dotted Square
-0x15180489, // U+02A30 ⨰, \dottimes, Multiplication Sign With Dot Above
-0x1531010d, // U+02A62 ⩢, \doublebarvee, Logical Or With Double Overbar
-0x00e1310b, // U+001C2 ǂ, \doublepipe, Latin Letter Alveolar Click / Latin Letter Pipe Double Bar
-0x14fd048b, // U+029FA ⧺, \doubleplus, Double Plus
-0x10c9a58a, // U+02193 ↓, \downarrow, Downwards Arrow / Down Arrow
-0x148400d0, // U+02908 ⤈, \downarrowbarred, Downwards Arrow With Horizontal Stroke
-0x10f1a58e, // U+021E3 ⇣, \downdasharrow, Downwards Dashed Arrow / Down Dashed Arrow
-0x10e5248f, // U+021CA ⇊, \downdownarrows, Downwards Paired Arrows / Down Paired Arrows
-0x10e194d0, // U+021C3 ⇃, \downharpoonleft, Downwards Harpoon With Barb Leftwards / Down Harpoon With Barb Left
-0x10e134d1, // U+021C2 ⇂, \downharpoonright, Downwards Harpoon With Barb Rightwards / Down Harpoon With Barb Right
-0x14b2b4d6, // U+02965 ⥥, \downharpoonsleftright, Downwards Harpoon With Barb Left Beside Downwards Harpoon With Barb Right
-0x157561ca, // U+02AEA ⫪, \downvDash, Double Down Tack
-0x10f4a58f, // U+021E9 ⇩, \downwhitearrow, Downwards White Arrow / White Down Arrow
-0x10d7a590, // U+021AF ↯, \downzigzagarrow, Downwards Zigzag Arrow / Down Zigzag Arrow
-0x13cda58e, // U+0279B ➛, \draftingarrow, Drafting Point Rightwards Arrow / Drafting Point Right Arrow
-0x1488258a, // U+02910 ⤐, \drbkarrow, Rightwards Two-Headed Triple Dash Arrow
-0x018d1187, // U+0031A ̚, \droang, Combining Left Angle Above / Non-Spacing Left Angle Above
-0x12831087, // U+02506 ┆, \dshfnc, Box Drawings Light Triple Dash Vertical / Forms Light Triple Dash Vertical
-0x14fb22c5, // U+029F6 ⧶, \dsol, Solidus With Overbar
-0x14efc3c8, // U+029DF ⧟, \dualmap, Double-Ended Multimap
-0x015221c6, // U+002A4 ʤ, \dyogh, Latin Small Letter Dezh Digraph / Latin Small Letter D Yogh
-0x154c24c7, // U+02A98 ⪘, \egsdot, Slanted Equal To Or Greater-Than With Dot Inside
-0x1335710b, // U+0266A ♪, \eighthnote, Eighth Note
-0x11f3d489, // U+023E7 ⏧, \elinters, Electrical Intersection
-0x1089f2c4, // U+02113 ℓ, \ell, Script Small L
-0x154ba4c7, // U+02A97 ⪗, \elsdot, Slanted Equal To Or Less-Than With Dot Inside
-0x100a61c7, // U+02014 —, \emdash, Em Dash
-0x110284c9, // U+02205 ∅, \emptyset, Empty Set
-0x14d9d44d, // U+029B3 ⦳, \emptysetoarr, Empty Set With Right Arrow Above
-0x14da52ce, // U+029B4 ⦴, \emptysetoarrl, Empty Set With Left Arrow Above
-0x14d8c44d, // U+029B1 ⦱, \emptysetobar, Empty Set With Overbar
-0x14d9508e, // U+029B2 ⦲, \emptysetocirc, Empty Set With Small Circle Above
-0x106ef10e, // U+020DD ⃝, \enclosecircle, Combining Enclosing Circle / Enclosing Circle
-0x106f90cf, // U+020DF ⃟, \enclosediamond, Combining Enclosing Diamond / Enclosing Diamond
-0x106f510e, // U+020DE ⃞, \enclosesquare, Combining Enclosing Square / Enclosing Square
-0x10727110, // U+020E4 ⃤, \enclosetriangle, Combining Enclosing Upward Pointing Triangle
-0x1009e1c7, // U+02013 –, \endash, En Dash
-0x10016108, // U+02002  , \enspace, En Space
-0x14f1e2c7, // U+029E3 ⧣, \eparsl, Equals Sign And Slanted Parallel
-0x01faa348, // U+003F5 ϵ, \epsilon, Greek Lunate Epsilon Symbol
-0x112b5087, // U+02256 ≖, \eqcirc, Ring In Equal To
-0x112aa348, // U+02255 ≕, \eqcolon, Equals Colon / Equal Colon
-0x112e8146, // U+0225D ≝, \eqdef, Equal To By Definition
-0x153324c6, // U+02A66 ⩦, \eqdot, Equals Sign With Dot Below
-0x153b0407, // U+02A76 ⩶, \eqeqeq, Three Consecutive Equals Signs
-0x116ef446, // U+022DD ⋝, \eqgtr, Equal To Or Greater-Than / Equal To Or Greater Than
-0x116e6487, // U+022DC ⋜, \eqless, Equal To Or Less-Than / Equal To Or Less Than
-0x154d7447, // U+02A9A ⪚, \eqqgtr, Double-Line Equal To Or Greater-Than
-0x154ce488, // U+02A99 ⪙, \eqqless, Double-Line Equal To Or Less-Than
-0x15388488, // U+02A71 ⩱, \eqqplus, Equals Sign Above Plus Sign
-0x1539c307, // U+02A73 ⩳, \eqqsim, Equals Sign Above Tilde Operator
-0x154e744c, // U+02A9C ⪜, \eqqslantgtr, Double-Line Slanted Equal To Or Greater-Than
-0x154de48d, // U+02A9B ⪛, \eqqslantless, Double-Line Slanted Equal To Or Less-Than
-0x11214306, // U+02242 ≂, \eqsim, Minus Tilde
-0x154b744b, // U+02A96 ⪖, \eqslantgtr, Slanted Equal To Or Greater-Than
-0x154ae48c, // U+02A95 ⪕, \eqslantless, Slanted Equal To Or Less-Than
-0x15a0258f, // U+02B40 ⭀, \equalleftarrow, Equals Sign Above Leftwards Arrow
-0x116a82ce, // U+022D5 ⋕, \equalparallel, Equal And Parallel To
-0x1130c546, // U+02261 ≡, \equiv, Identical To
-0x153c78c8, // U+02A78 ⩸, \equivDD, Equivalent With Four Dots Above
-0x14f2e2c9, // U+029E5 ⧥, \eqvparsl, Identical To And Slanted Parallel
-0x0141e1c4, // U+00283 ʃ, \esh, Latin Small Letter Esh
-0x01dbf004, // U+003B7 η, \eta, Greek Small Letter Eta
-0x007871c4, // U+000F0 ð, \eth, Latin Small Letter Eth
-0x10978446, // U+0212F ℯ, \euler, Script Small E
-0x10839210, // U+02107 ℇ, \eulermascheroni, Euler Constant / Eulers
-0x10565385, // U+020AC €, \euro, Euro Sign
-0x0050a34b, // U+000A1 ¡, \exclamdown, Inverted Exclamation Mark
-0x1101f487, // U+02203 ∃, \exists, There Exists
-0x1129040e, // U+02252 ≒, \fallingdotseq, Approximately Equal To Or The Image Of
-0x1497a58f, // U+0292F ⤯, \fdiagovnearrow, Falling Diagonal Crossing North East Arrow
-0x1496418d, // U+0292C ⤬, \fdiagovrdiag, Falling Diagonal Crossing Rising Diagonal
-0x13207107, // U+02640 ♀, \female, Female Sign
-0x013f3444, // U+0027E ɾ, \fhr, Latin Small Letter R With Fishhook / Latin Small Letter Fishhook R
-0x12e4c108, // U+025C9 ◉, \fisheye, Fisheye
-0x1336c4c5, // U+0266D ♭, \flat, Music Flat Sign / Flat
-0x11f29486, // U+023E5 ⏥, \fltns, Flatness
-0x110072c7, // U+02200 ∀, \forall, For All
-0x156e6486, // U+02ADC ⫝̸, \forks, Forking
-0x156ea4c9, // U+02ADD ⫝, \forksnot, Nonforking
-0x156ce546, // U+02AD9 ⫙, \forkv, Element Of Opening Downwards
-0x110e24cb, // U+0221C ∜, \fourthroot, Fourth Root
-0xea826806, // U+1D504 𝔄, \frakA, Mathematical Fraktur Capital A
-0xea82e846, // U+1D505 𝔅, \frakB, Mathematical Fraktur Capital B
-0x1096e886, // U+0212D ℭ, \frakC, Black-Letter Capital C / Black-Letter C
-0xea83e8c6, // U+1D507 𝔇, \frakD, Mathematical Fraktur Capital D
-0xea846906, // U+1D508 𝔈, \frakE, Mathematical Fraktur Capital E
-0xea84e946, // U+1D509 𝔉, \frakF, Mathematical Fraktur Capital F
-0xea856986, // U+1D50A 𝔊, \frakG, Mathematical Fraktur Capital G
-0x108669c6, // U+0210C ℌ, \frakH, Black-Letter Capital H / Black-Letter H
-0x1088ea06, // U+02111 ℑ, \frakI, Black-Letter Capital I / Black-Letter I
-0xea86ea46, // U+1D50D 𝔍, \frakJ, Mathematical Fraktur Capital J
-0xea876a86, // U+1D50E 𝔎, \frakK, Mathematical Fraktur Capital K
-0xea87eac6, // U+1D50F 𝔏, \frakL, Mathematical Fraktur Capital L
-0xea886b06, // U+1D510 𝔐, \frakM, Mathematical Fraktur Capital M
-0xea88eb46, // U+1D511 𝔑, \frakN, Mathematical Fraktur Capital N
-0xea896b86, // U+1D512 𝔒, \frakO, Mathematical Fraktur Capital O
-0xea89ebc6, // U+1D513 𝔓, \frakP, Mathematical Fraktur Capital P
-0xea8a6c06, // U+1D514 𝔔, \frakQ, Mathematical Fraktur Capital Q
-0x108e6c46, // U+0211C ℜ, \frakR, Black-Letter Capital R / Black-Letter R
-0xea8b6c86, // U+1D516 𝔖, \frakS, Mathematical Fraktur Capital S
-0xea8becc6, // U+1D517 𝔗, \frakT, Mathematical Fraktur Capital T
-0xea8c6d06, // U+1D518 𝔘, \frakU, Mathematical Fraktur Capital U
-0xea8ced46, // U+1D519 𝔙, \frakV, Mathematical Fraktur Capital V
-0xea8d6d86, // U+1D51A 𝔚, \frakW, Mathematical Fraktur Capital W
-0xea8dedc6, // U+1D51B 𝔛, \frakX, Mathematical Fraktur Capital X
-0xea8e6e06, // U+1D51C 𝔜, \frakY, Mathematical Fraktur Capital Y
-0x10946e46, // U+02128 ℨ, \frakZ, Black-Letter Capital Z / Black-Letter Z
-0xea8f6006, // U+1D51E 𝔞, \fraka, Mathematical Fraktur Small A
-0xea8fe046, // U+1D51F 𝔟, \frakb, Mathematical Fraktur Small B
-0xea906086, // U+1D520 𝔠, \frakc, Mathematical Fraktur Small C
-0xea90e0c6, // U+1D521 𝔡, \frakd, Mathematical Fraktur Small D
-0xea916106, // U+1D522 𝔢, \frake, Mathematical Fraktur Small E
-0xea91e146, // U+1D523 𝔣, \frakf, Mathematical Fraktur Small F
-0xea926186, // U+1D524 𝔤, \frakg, Mathematical Fraktur Small G
-0xea92e1c6, // U+1D525 𝔥, \frakh, Mathematical Fraktur Small H
-0xea936206, // U+1D526 𝔦, \fraki, Mathematical Fraktur Small I
-0xea93e246, // U+1D527 𝔧, \frakj, Mathematical Fraktur Small J
-0xea946286, // U+1D528 𝔨, \frakk, Mathematical Fraktur Small K
-0xea94e2c6, // U+1D529 𝔩, \frakl, Mathematical Fraktur Small L
-0xea956306, // U+1D52A 𝔪, \frakm, Mathematical Fraktur Small M
-0xea95e346, // U+1D52B 𝔫, \frakn, Mathematical Fraktur Small N
-0xea966386, // U+1D52C 𝔬, \frako, Mathematical Fraktur Small O
-0xea96e3c6, // U+1D52D 𝔭, \frakp, Mathematical Fraktur Small P
-0xea976406, // U+1D52E 𝔮, \frakq, Mathematical Fraktur Small Q
-0xea97e446, // U+1D52F 𝔯, \frakr, Mathematical Fraktur Small R
-0xea986486, // U+1D530 𝔰, \fraks, Mathematical Fraktur Small S
-0xea98e4c6, // U+1D531 𝔱, \frakt, Mathematical Fraktur Small T
-0xea996506, // U+1D532 𝔲, \fraku, Mathematical Fraktur Small U
-0xea99e546, // U+1D533 𝔳, \frakv, Mathematical Fraktur Small V
-0xea9a6586, // U+1D534 𝔴, \frakw, Mathematical Fraktur Small W
-0xea9ae5c6, // U+1D535 𝔵, \frakx, Mathematical Fraktur Small X
-0xea9b6606, // U+1D536 𝔶, \fraky, Mathematical Fraktur Small Y
-0xea9be646, // U+1D537 𝔷, \frakz, Mathematical Fraktur Small Z
-0x11912346, // U+02322 ⌢, \frown, Frown
-0x13ebc34e, // U+027D7 ⟗, \fullouterjoin, Full Outer Join
-0x01d98006, // U+003B3 γ, \gamma, Greek Small Letter Gamma
-0x11328103, // U+02265 ≥, \ge, Greater-Than Or Equal To / Greater Than Or Equal To
-0x13251207, // U+0264A ♊, \gemini, Gemini
-0x11328404, // U+02265 ≥, \geq, Greater-Than Or Equal To / Greater Than Or Equal To
-0x1133c405, // U+02267 ≧, \geqq, Greater-Than Over Equal To / Greater Than Over Equal To
-0x157d14ca, // U+02AFA ⫺, \geqqslant, Double-Line Slanted Greater-Than Or Equal To
-0x153f14c9, // U+02A7E ⩾, \geqslant, Greater-Than Or Slanted Equal To
-0x1554e086, // U+02AA9 ⪩, \gescc, Greater-Than Closed By Curve Above Slanted Equal
-0x154024c7, // U+02A80 ⪀, \gesdot, Greater-Than Or Slanted Equal To With Dot Inside
-0x15417388, // U+02A82 ⪂, \gesdoto, Greater-Than Or Slanted Equal To With Dot Above
-0x154222c9, // U+02A84 ⪄, \gesdotol, Greater-Than Or Slanted Equal To With Dot Above Left
-0x154a0487, // U+02A94 ⪔, \gesles, Greater-Than Above Slanted Equal Above Less-Than Above Slanted Equal
-0x11358183, // U+0226B ≫, \gg, Much Greater-Than / Much Greater Than
-0x116ca184, // U+022D9 ⋙, \ggg, Very Much Greater-Than / Very Much Greater Than
-0x157c64c8, // U+02AF8 ⫸, \gggnest, Triple Nested Greater-Than
-0x109b82c6, // U+02137 ℷ, \gimel, Gimel Symbol / Third Transfinite Cardinal
-0x15497904, // U+02A92 ⪒, \glE, Greater-Than Above Less-Than Above Double-Line Equal
-0x1552f004, // U+02AA5 ⪥, \gla, Greater-Than Beside Less-Than
-0x15527244, // U+02AA4 ⪤, \glj, Greater-Than Overlapping Less-Than
-0x014a64c5, // U+00294 ʔ, \glst, Latin Letter Glottal Stop
-0x154525c9, // U+02A8A ⪊, \gnapprox, Greater-Than And Not Approximate
-0x15440405, // U+02A88 ⪈, \gneq, Greater-Than And Single-Line Not Equal To
-0x1134c406, // U+02269 ≩, \gneqq, Greater-Than But Not Equal To / Greater Than But Not Equal To
-0x1173c306, // U+022E7 ⋧, \gnsim, Greater-Than But Not Equivalent To / Greater Than But Not Equivalent To
-0x01801106, // U+00300 ̀, \grave, Combining Grave Accent / Non-Spacing Grave
-0x15470106, // U+02A8E ⪎, \gsime, Greater-Than Above Similar Or Equal
-0x154802c6, // U+02A90 ⪐, \gsiml, Greater-Than Above Similar Above Less-Than
-0x1553e085, // U+02AA7 ⪧, \gtcc, Greater-Than Closed By Curve
-0x153d4446, // U+02A7A ⩺, \gtcir, Greater-Than With Circle Inside
-0x153e64c8, // U+02A7C ⩼, \gtquest, Greater-Than With Question Mark Above
-0x154325ca, // U+02A86 ⪆, \gtrapprox, Greater-Than Or Approximate
-0x116ba4c7, // U+022D7 ⋗, \gtrdot, Greater-Than With Dot / Greater Than With Dot
-0x116de48a, // U+022DB ⋛, \gtreqless, Greater-Than Equal To Or Less-Than / Greater Than Equal To Or Less Than
-0x1546648b, // U+02A8C ⪌, \gtreqqless, Greater-Than Above Double-Line Equal Above Less-Than
-0x113be488, // U+02277 ≷, \gtrless, Greater-Than Or Less-Than / Greater Than Or Less Than
-0x1139c307, // U+02273 ≳, \gtrsim, Greater-Than Or Equivalent To / Greater Than Or Equivalent To
-0x101c94ce, // U+02039 ‹, \guilsinglleft, Single Left-Pointing Angle Quotation Mark / Left Pointing Single Guillemet
-0x101d34cf, // U+0203A ›, \guilsinglright, Single Right-Pointing Angle Quotation Mark / Right Pointing Single Guillemet
-0x0002440a, // U+00004 ≩︀, \gvertneqq, Greater-Than But Not Equal To / Greater Than But Not Equal To + Variation Selector-1
-0x018144c4, // U+00302 ̂, \hat, Combining Circumflex Accent / Non-Spacing Circumflex
-0x1537a5ca, // U+02A6F ⩯, \hatapprox, Almost Equal To With Circumflex Accent
-0x0093c445, // U+00127 ħ, \hbar, Latin Small Letter H With Stroke / Latin Small Letter H Bar
-0x1330c4ca, // U+02661 ♡, \heartsuit, White Heart Suit
-0x1352f10e, // U+026A5 ⚥, \hermaphrodite, Male And Female Sign
-0x115cc5d1, // U+022B9 ⊹, \hermitconjmatrix, Hermitian Conjugate Matrix
-0x11ca2348, // U+02394 ⎔, \hexagon, Software-Function Symbol
-0x1591e28d, // U+02B23 ⬣, \hexagonblack, Horizontal Black Hexagon
-0x0057848a, // U+000AF ¯, \highminus, Macron / Spacing Macron
-0x1492a589, // U+02925 ⤥, \hksearow, South East Arrow With Hook
-0x14932589, // U+02926 ⤦, \hkswarow, South West Arrow With Hook
-0x0168d286, // U+002D1 ˑ, \hlmrk, Modifier Letter Half Triangular Colon
-0x10d4a58e, // U+021A9 ↩, \hookleftarrow, Leftwards Arrow With Hook / Left Arrow With Hook
-0x10d5258f, // U+021AA ↪, \hookrightarrow, Rightwards Arrow With Hook / Right Arrow With Hook
-0x11816106, // U+02302 ⌂, \house, House
-0x12d6f10b, // U+025AD ▭, \hrectangle, White Rectangle
-0x12d66290, // U+025AC ▬, \hrectangleblack, Black Rectangle
-0x1087e1c7, // U+0210F ℏ, \hslash, Planck Constant Over Two Pi / Planck Constant Over 2 Pi
-0x10056107, // U+0200A  , \hspace, Hair Space
-0x00cac186, // U+00195 ƕ, \hvlig, Latin Small Letter Hv / Latin Small Letter H V
-0x13fd1144, // U+027FA ⟺, \iff, Long Left Right Double Arrow
-0x150614c7, // U+02A0C ⨌, \iiiint, Quadruple Integral Operator
-0x111694c6, // U+0222D ∭, \iiint, Triple Integral
-0x111614c5, // U+0222C ∬, \iint, Double Integral
-0x115ba106, // U+022B7 ⊷, \image, Image Of
-0x0098f1c6, // U+00131 ı, \imath, Latin Small Letter Dotless I
-0x13fc560a, // U+027F8 ⟸, \impliedby, Long Leftwards Double Arrow
-0x13fc8488, // U+027F9 ⟹, \implies, Long Rightwards Double Arrow
-0x11040343, // U+02208 ∈, \in, Element Of
-0x110314ca, // U+02206 ∆, \increment, Increment
-0x157583c6, // U+02AEB ⫫, \indep, Double Up Tack
-0x110f7606, // U+0221E ∞, \infty, Infinity
-0x014b64c7, // U+00296 ʖ, \inglst, Latin Letter Inverted Glottal Stop
-0x111594c4, // U+0222B ∫, \int, Integral
-0x15074447, // U+02A0E ⨎, \intBar, Integral With Double Stroke
-0x1506c447, // U+02A0D ⨍, \intbar, Finite Part Integral
-0x150cc3c7, // U+02A19 ⨙, \intcap, Integral With Intersection
-0x150d03c7, // U+02A1A ⨚, \intcup, Integral With Union
-0x115d42c9, // U+022BA ⊺, \intercal, Intercalate
-0x157a110b, // U+02AF4 ⫴, \interleave, Triple Vertical Bar Binary Relation
-0x151e20c8, // U+02A3C ⨼, \intprod, Interior Product
-0x151ef449, // U+02A3D ⨽, \intprodr, Righthand Interior Product
-0x150c75c5, // U+02A18 ⨘, \intx, Integral With Times Sign
-0x12ecf113, // U+025D9 ◙, \inversewhitecircle, Inverse White Circle
-0x118824c7, // U+02310 ⌐, \invnot, Reversed Not Sign
-0x01461545, // U+0028C ʌ, \invv, Latin Small Letter Turned V
-0x01469585, // U+0028D ʍ, \invw, Latin Small Letter Turned W
-0x12edf118, // U+025DB ◛, \invwhitelowerhalfcircle, Lower Half Inverse White Circle
-0x12ed7118, // U+025DA ◚, \invwhiteupperhalfcircle, Upper Half Inverse White Circle
-0x01dcf005, // U+003B9 ι, \iota, Greek Small Letter Iota
-0xeb046807, // U+1D608 𝘈, \isansA, Mathematical Sans-Serif Italic Capital A
-0xeb04e847, // U+1D609 𝘉, \isansB, Mathematical Sans-Serif Italic Capital B
-0xeb056887, // U+1D60A 𝘊, \isansC, Mathematical Sans-Serif Italic Capital C
-0xeb05e8c7, // U+1D60B 𝘋, \isansD, Mathematical Sans-Serif Italic Capital D
-0xeb066907, // U+1D60C 𝘌, \isansE, Mathematical Sans-Serif Italic Capital E
-0xeb06e947, // U+1D60D 𝘍, \isansF, Mathematical Sans-Serif Italic Capital F
-0xeb076987, // U+1D60E 𝘎, \isansG, Mathematical Sans-Serif Italic Capital G
-0xeb07e9c7, // U+1D60F 𝘏, \isansH, Mathematical Sans-Serif Italic Capital H
-0xeb086a07, // U+1D610 𝘐, \isansI, Mathematical Sans-Serif Italic Capital I
-0xeb08ea47, // U+1D611 𝘑, \isansJ, Mathematical Sans-Serif Italic Capital J
-0xeb096a87, // U+1D612 𝘒, \isansK, Mathematical Sans-Serif Italic Capital K
-0xeb09eac7, // U+1D613 𝘓, \isansL, Mathematical Sans-Serif Italic Capital L
-0xeb0a6b07, // U+1D614 𝘔, \isansM, Mathematical Sans-Serif Italic Capital M
-0xeb0aeb47, // U+1D615 𝘕, \isansN, Mathematical Sans-Serif Italic Capital N
-0xeb0b6b87, // U+1D616 𝘖, \isansO, Mathematical Sans-Serif Italic Capital O
-0xeb0bebc7, // U+1D617 𝘗, \isansP, Mathematical Sans-Serif Italic Capital P
-0xeb0c6c07, // U+1D618 𝘘, \isansQ, Mathematical Sans-Serif Italic Capital Q
-0xeb0cec47, // U+1D619 𝘙, \isansR, Mathematical Sans-Serif Italic Capital R
-0xeb0d6c87, // U+1D61A 𝘚, \isansS, Mathematical Sans-Serif Italic Capital S
-0xeb0decc7, // U+1D61B 𝘛, \isansT, Mathematical Sans-Serif Italic Capital T
-0xeb0e6d07, // U+1D61C 𝘜, \isansU, Mathematical Sans-Serif Italic Capital U
-0xeb0eed47, // U+1D61D 𝘝, \isansV, Mathematical Sans-Serif Italic Capital V
-0xeb0f6d87, // U+1D61E 𝘞, \isansW, Mathematical Sans-Serif Italic Capital W
-0xeb0fedc7, // U+1D61F 𝘟, \isansX, Mathematical Sans-Serif Italic Capital X
-0xeb106e07, // U+1D620 𝘠, \isansY, Mathematical Sans-Serif Italic Capital Y
-0xeb10ee47, // U+1D621 𝘡, \isansZ, Mathematical Sans-Serif Italic Capital Z
-0xeb116007, // U+1D622 𝘢, \isansa, Mathematical Sans-Serif Italic Small A
-0xeb11e047, // U+1D623 𝘣, \isansb, Mathematical Sans-Serif Italic Small B
-0xeb126087, // U+1D624 𝘤, \isansc, Mathematical Sans-Serif Italic Small C
-0xeb12e0c7, // U+1D625 𝘥, \isansd, Mathematical Sans-Serif Italic Small D
-0xeb136107, // U+1D626 𝘦, \isanse, Mathematical Sans-Serif Italic Small E
-0xeb13e147, // U+1D627 𝘧, \isansf, Mathematical Sans-Serif Italic Small F
-0xeb146187, // U+1D628 𝘨, \isansg, Mathematical Sans-Serif Italic Small G
-0xeb14e1c7, // U+1D629 𝘩, \isansh, Mathematical Sans-Serif Italic Small H
-0xeb156207, // U+1D62A 𝘪, \isansi, Mathematical Sans-Serif Italic Small I
-0xeb15e247, // U+1D62B 𝘫, \isansj, Mathematical Sans-Serif Italic Small J
-0xeb166287, // U+1D62C 𝘬, \isansk, Mathematical Sans-Serif Italic Small K
-0xeb16e2c7, // U+1D62D 𝘭, \isansl, Mathematical Sans-Serif Italic Small L
-0xeb176307, // U+1D62E 𝘮, \isansm, Mathematical Sans-Serif Italic Small M
-0xeb17e347, // U+1D62F 𝘯, \isansn, Mathematical Sans-Serif Italic Small N
-0xeb186387, // U+1D630 𝘰, \isanso, Mathematical Sans-Serif Italic Small O
-0xeb18e3c7, // U+1D631 𝘱, \isansp, Mathematical Sans-Serif Italic Small P
-0xeb196407, // U+1D632 𝘲, \isansq, Mathematical Sans-Serif Italic Small Q
-0xeb19e447, // U+1D633 𝘳, \isansr, Mathematical Sans-Serif Italic Small R
-0xeb1a6487, // U+1D634 𝘴, \isanss, Mathematical Sans-Serif Italic Small S
-0xeb1ae4c7, // U+1D635 𝘵, \isanst, Mathematical Sans-Serif Italic Small T
-0xeb1b6507, // U+1D636 𝘶, \isansu, Mathematical Sans-Serif Italic Small U
-0xeb1be547, // U+1D637 𝘷, \isansv, Mathematical Sans-Serif Italic Small V
-0xeb1c6587, // U+1D638 𝘸, \isansw, Mathematical Sans-Serif Italic Small W
-0xeb1ce5c7, // U+1D639 𝘹, \isansx, Mathematical Sans-Serif Italic Small X
-0xeb1d6607, // U+1D63A 𝘺, \isansy, Mathematical Sans-Serif Italic Small Y
-0xeb1de647, // U+1D63B 𝘻, \isansz, Mathematical Sans-Serif Italic Small Z
-0x117c9906, // U+022F9 ⋹, \isinE, Element Of With Two Horizontal Strokes
-0x117aa4c8, // U+022F5 ⋵, \isindot, Element Of With Dot Above
-0x117bc449, // U+022F7 ⋷, \isinobar, Small Element Of With Overbar
-0x117a1486, // U+022F4 ⋴, \isins, Small Element Of With Vertical Bar At End Of Horizontal Stroke
-0x117c1047, // U+022F8 ⋸, \isinvb, Element Of With Underbar
-0xea1a7804, // U+1D434 𝐴, \itA, Mathematical Italic Capital A
-0xeb713008, // U+1D6E2 𝛢, \itAlpha, Mathematical Italic Capital Alpha
-0xea1af844, // U+1D435 𝐵, \itB, Mathematical Italic Capital B
-0xeb71f007, // U+1D6E3 𝛣, \itBeta, Mathematical Italic Capital Beta
-0xea1b7884, // U+1D436 𝐶, \itC, Mathematical Italic Capital C
-0xeb7c3206, // U+1D6F8 𝛸, \itChi, Mathematical Italic Capital Chi
-0xea1bf8c4, // U+1D437 𝐷, \itD, Mathematical Italic Capital D
-0xeb72f008, // U+1D6E5 𝛥, \itDelta, Mathematical Italic Capital Delta
-0xea1c7904, // U+1D438 𝐸, \itE, Mathematical Italic Capital E
-0xeb73234a, // U+1D6E6 𝛦, \itEpsilon, Mathematical Italic Capital Epsilon
-0xeb747006, // U+1D6E8 𝛨, \itEta, Mathematical Italic Capital Eta
-0xea1cf944, // U+1D439 𝐹, \itF, Mathematical Italic Capital F
-0xea1d7984, // U+1D43A 𝐺, \itG, Mathematical Italic Capital G
-0xeb720008, // U+1D6E4 𝛤, \itGamma, Mathematical Italic Capital Gamma
-0xea1df9c4, // U+1D43B 𝐻, \itH, Mathematical Italic Capital H
-0xea1e7a04, // U+1D43C 𝐼, \itI, Mathematical Italic Capital I
-0xeb757007, // U+1D6EA 𝛪, \itIota, Mathematical Italic Capital Iota
-0xea1efa44, // U+1D43D 𝐽, \itJ, Mathematical Italic Capital J
-0xea1f7a84, // U+1D43E 𝐾, \itK, Mathematical Italic Capital K
-0xeb75b008, // U+1D6EB 𝛫, \itKappa, Mathematical Italic Capital Kappa
-0xea1ffac4, // U+1D43F 𝐿, \itL, Mathematical Italic Capital L
-0xeb767009, // U+1D6EC 𝛬, \itLambda, Mathematical Italic Capital Lamda
-0xea207b04, // U+1D440 𝑀, \itM, Mathematical Italic Capital M
-0xeb768505, // U+1D6ED 𝛭, \itMu, Mathematical Italic Capital Mu
-0xea20fb44, // U+1D441 𝑁, \itN, Mathematical Italic Capital N
-0xeb771505, // U+1D6EE 𝛮, \itNu, Mathematical Italic Capital Nu
-0xea217b84, // U+1D442 𝑂, \itO, Mathematical Italic Capital O
-0xeb7d2008, // U+1D6FA 𝛺, \itOmega, Mathematical Italic Capital Omega
-0xeb78234a, // U+1D6F0 𝛰, \itOmicron, Mathematical Italic Capital Omicron
-0xea21fbc4, // U+1D443 𝑃, \itP, Mathematical Italic Capital P
-0xeb7bb206, // U+1D6F7 𝛷, \itPhi, Mathematical Italic Capital Phi
-0xeb78b205, // U+1D6F1 𝛱, \itPi, Mathematical Italic Capital Pi
-0xeb7ce206, // U+1D6F9 𝛹, \itPsi, Mathematical Italic Capital Psi
-0xea227c04, // U+1D444 𝑄, \itQ, Mathematical Italic Capital Q
-0xea22fc44, // U+1D445 𝑅, \itR, Mathematical Italic Capital R
-0xeb793386, // U+1D6F2 𝛲, \itRho, Mathematical Italic Capital Rho
-0xea237c84, // U+1D446 𝑆, \itS, Mathematical Italic Capital S
-0xeb7a0008, // U+1D6F4 𝛴, \itSigma, Mathematical Italic Capital Sigma
-0xea23fcc4, // U+1D447 𝑇, \itT, Mathematical Italic Capital T
-0xeb7ac506, // U+1D6F5 𝛵, \itTau, Mathematical Italic Capital Tau
-0xeb74f008, // U+1D6E9 𝛩, \itTheta, Mathematical Italic Capital Theta
-0xea247d04, // U+1D448 𝑈, \itU, Mathematical Italic Capital U
-0xeb7b234a, // U+1D6F6 𝛶, \itUpsilon, Mathematical Italic Capital Upsilon
-0xea24fd44, // U+1D449 𝑉, \itV, Mathematical Italic Capital V
-0xea257d84, // U+1D44A 𝑊, \itW, Mathematical Italic Capital W
-0xea25fdc4, // U+1D44B 𝑋, \itX, Mathematical Italic Capital X
-0xeb77b205, // U+1D6EF 𝛯, \itXi, Mathematical Italic Capital Xi
-0xea267e04, // U+1D44C 𝑌, \itY, Mathematical Italic Capital Y
-0xea26fe44, // U+1D44D 𝑍, \itZ, Mathematical Italic Capital Z
-0xeb73f007, // U+1D6E7 𝛧, \itZeta, Mathematical Italic Capital Zeta
-0xea277004, // U+1D44E 𝑎, \ita, Mathematical Italic Small A
-0xeb7e3008, // U+1D6FC 𝛼, \italpha, Mathematical Italic Small Alpha
-0xea27f044, // U+1D44F 𝑏, \itb, Mathematical Italic Small B
-0xeb7ef007, // U+1D6FD 𝛽, \itbeta, Mathematical Italic Small Beta
-0xea287084, // U+1D450 𝑐, \itc, Mathematical Italic Small C
-0xeb893206, // U+1D712 𝜒, \itchi, Mathematical Italic Small Chi
-0xea28f0c4, // U+1D451 𝑑, \itd, Mathematical Italic Small D
-0xeb7ff008, // U+1D6FF 𝛿, \itdelta, Mathematical Italic Small Delta
-0xea297104, // U+1D452 𝑒, \ite, Mathematical Italic Small E
-0xeb8b234a, // U+1D716 𝜖, \itepsilon, Mathematical Italic Epsilon Symbol
-0xeb817006, // U+1D702 𝜂, \iteta, Mathematical Italic Small Eta
-0xea29f144, // U+1D453 𝑓, \itf, Mathematical Italic Small F
-0xea2a7184, // U+1D454 𝑔, \itg, Mathematical Italic Small G
-0xeb7f0008, // U+1D6FE 𝛾, \itgamma, Mathematical Italic Small Gamma
-0x108771c4, // U+0210E ℎ, \ith, Planck Constant
-0xea2b7204, // U+1D456 𝑖, \iti, Mathematical Italic Small I
-0xeb5271c8, // U+1D6A4 𝚤, \itimath, Mathematical Italic Small Dotless I
-0xeb827007, // U+1D704 𝜄, \itiota, Mathematical Italic Small Iota
-0xea2bf244, // U+1D457 𝑗, \itj, Mathematical Italic Small J
-0xeb52f1c8, // U+1D6A5 𝚥, \itjmath, Mathematical Italic Small Dotless J
-0xea2c7284, // U+1D458 𝑘, \itk, Mathematical Italic Small K
-0xeb82b008, // U+1D705 𝜅, \itkappa, Mathematical Italic Small Kappa
-0xea2cf2c4, // U+1D459 𝑙, \itl, Mathematical Italic Small L
-0xeb837009, // U+1D706 𝜆, \itlambda, Mathematical Italic Small Lamda
-0xea2d7304, // U+1D45A 𝑚, \itm, Mathematical Italic Small M
-0xeb838505, // U+1D707 𝜇, \itmu, Mathematical Italic Small Mu
-0xea2df344, // U+1D45B 𝑛, \itn, Mathematical Italic Small N
-0xeb7df008, // U+1D6FB 𝛻, \itnabla, Mathematical Italic Nabla
-0xeb841505, // U+1D708 𝜈, \itnu, Mathematical Italic Small Nu
-0xea2e7384, // U+1D45C 𝑜, \ito, Mathematical Italic Small O
-0xeb8a2008, // U+1D714 𝜔, \itomega, Mathematical Italic Small Omega
-0xeb85234a, // U+1D70A 𝜊, \itomicron, Mathematical Italic Small Omicron
-0xea2ef3c4, // U+1D45D 𝑝, \itp, Mathematical Italic Small P
-0xeb8ac2ca, // U+1D715 𝜕, \itpartial, Mathematical Italic Partial Differential
-0xeb8cb206, // U+1D719 𝜙, \itphi, Mathematical Italic Phi Symbol
-0xeb85b205, // U+1D70B 𝜋, \itpi, Mathematical Italic Small Pi
-0xeb89e206, // U+1D713 𝜓, \itpsi, Mathematical Italic Small Psi
-0xea2f7404, // U+1D45E 𝑞, \itq, Mathematical Italic Small Q
-0xea2ff444, // U+1D45F 𝑟, \itr, Mathematical Italic Small R
-0xeb863386, // U+1D70C 𝜌, \itrho, Mathematical Italic Small Rho
-0xea307484, // U+1D460 𝑠, \its, Mathematical Italic Small S
-0xeb870008, // U+1D70E 𝜎, \itsigma, Mathematical Italic Small Sigma
-0xea30f4c4, // U+1D461 𝑡, \itt, Mathematical Italic Small T
-0xeb87c506, // U+1D70F 𝜏, \ittau, Mathematical Italic Small Tau
-0xeb81f008, // U+1D703 𝜃, \ittheta, Mathematical Italic Small Theta
-0xea317504, // U+1D462 𝑢, \itu, Mathematical Italic Small U
-0xeb88234a, // U+1D710 𝜐, \itupsilon, Mathematical Italic Small Upsilon
-0xea31f544, // U+1D463 𝑣, \itv, Mathematical Italic Small V
-0xeb79f00b, // U+1D6F3 𝛳, \itvarTheta, Mathematical Italic Capital Theta Symbol
-0xeb80234d, // U+1D700 𝜀, \itvarepsilon, Mathematical Italic Small Epsilon
-0xeb8c300b, // U+1D718 𝜘, \itvarkappa, Mathematical Italic Kappa Symbol
-0xeb88b209, // U+1D711 𝜑, \itvarphi, Mathematical Italic Small Phi
-0xeb8db208, // U+1D71B 𝜛, \itvarpi, Mathematical Italic Pi Symbol
-0xeb8d3389, // U+1D71A 𝜚, \itvarrho, Mathematical Italic Rho Symbol
-0xeb86800b, // U+1D70D 𝜍, \itvarsigma, Mathematical Italic Small Final Sigma
-0xeb8bf00b, // U+1D717 𝜗, \itvartheta, Mathematical Italic Theta Symbol
-0xea327584, // U+1D464 𝑤, \itw, Mathematical Italic Small W
-0xea32f5c4, // U+1D465 𝑥, \itx, Mathematical Italic Small X
-0xeb84b205, // U+1D709 𝜉, \itxi, Mathematical Italic Small Xi
-0xea337604, // U+1D466 𝑦, \ity, Mathematical Italic Small Y
-0xea33f644, // U+1D467 𝑧, \itz, Mathematical Italic Small Z
-0xeb80f007, // U+1D701 𝜁, \itzeta, Mathematical Italic Small Zeta
-0x011bf1c6, // U+00237 ȷ, \jmath, Latin Small Letter Dotless J
-0x150ec345, // U+02A1D ⨝, \join, Join
-0x13218448, // U+02643 ♃, \jupiter, Jupiter
-0x01940282, // U+00328 ̨, \k, Combining Ogonek / Non-Spacing Ogonek
-0x01dd3006, // U+003BA κ, \kappa, Greek Small Letter Kappa
-0x111da352, // U+0223B ∻, \kernelcontraction, Homothetic
-0x00a102c2, // U+00142 ł, \l, Latin Small Letter L With Stroke / Latin Small Letter L Slash
-0x01ddf007, // U+003BB λ, \lambda, Greek Small Letter Lamda / Greek Small Letter Lambda
-0x13f47107, // U+027E8 ⟨, \langle, Mathematical Left Angle Bracket
-0x1555c4c4, // U+02AAB ⪫, \lat, Larger Than
-0x1556f105, // U+02AAD ⪭, \late, Larger Than Or Equal To
-0x111f1549, // U+0223E ∾, \lazysinv, Inverted Lazy S
-0x118442c6, // U+02308 ⌈, \lceil, Left Ceiling
-0x10137486, // U+02026 …, \ldots, Horizontal Ellipsis
-0x100e7404, // U+0201C “, \ldq, Left Double Quotation Mark / Double Turned Comma Quotation Mark
-0x11320103, // U+02264 ≤, \le, Less-Than Or Equal To / Less Than Or Equal To
-0x10c8258a, // U+02190 ←, \leftarrow, Leftwards Arrow / Left Arrow
-0x15a525d0, // U+02B4A ⭊, \leftarrowapprox, Leftwards Arrow Above Almost Equal To
-0x15a125d4, // U+02B42 ⭂, \leftarrowbackapprox, Leftwards Arrow Above Reverse Almost Equal To
-0x15a5c452, // U+02B4B ⭋, \leftarrowbsimilar, Leftwards Arrow Above Reverse Tilde Operator
-0x14bbe48e, // U+02977 ⥷, \leftarrowless, Leftwards Arrow Through Less-Than
-0x15990491, // U+02B32 ⬲, \leftarrowonoplus, Left Arrow With Circled Plus
-0x14a3048e, // U+02946 ⥆, \leftarrowplus, Leftwards Arrow With Plus Below
-0x14bd04d0, // U+0297A ⥺, \leftarrowsubset, Leftwards Arrow Through Subset
-0x10d142ce, // U+021A2 ↢, \leftarrowtail, Leftwards Arrow With Tail / Left Arrow With Tail
-0x10fef112, // U+021FD ⇽, \leftarrowtriangle, Leftwards Open-Headed Arrow
-0x159f25cb, // U+02B3E ⬾, \leftarrowx, Leftwards Arrow Through X
-0x1486258c, // U+0290C ⤌, \leftbkarrow, Leftwards Double Dash Arrow
-0x159fa590, // U+02B3F ⬿, \leftcurvedarrow, Wave Arrow Pointing Directly Left
-0x10f0258e, // U+021E0 ⇠, \leftdasharrow, Leftwards Dashed Arrow / Left Dashed Arrow
-0x1487258d, // U+0290E ⤎, \leftdbkarrow, Leftwards Triple Dash Arrow
-0x159c258d, // U+02B38 ⬸, \leftdotarrow, Leftwards Arrow With Dotted Stem
-0x106814d2, // U+020D0 ⃐, \leftharpoonaccent, Combining Left Harpoon Above / Non-Spacing Left Harpoon Above
-0x10dea350, // U+021BD ↽, \leftharpoondown, Leftwards Harpoon With Barb Downwards / Left Harpoon With Barb Down
-0x14b12353, // U+02962 ⥢, \leftharpoonsupdown, Leftwards Harpoon With Barb Up Above Leftwards Harpoon With Barb Down
-0x10de03ce, // U+021BC ↼, \leftharpoonup, Leftwards Harpoon With Barb Upwards / Left Harpoon With Barb Up
-0x14b561d2, // U+0296A ⥪, \leftharpoonupdash, Leftwards Harpoon With Barb Up Above Long Dash
-0x10e3a48f, // U+021C7 ⇇, \leftleftarrows, Leftwards Paired Arrows / Left Paired Arrows
-0x131f2349, // U+0263E ☾, \leftmoon, Last Quarter Moon
-0x13eac34e, // U+027D5 ⟕, \leftouterjoin, Left Outer Join
-0x10ca258f, // U+02194 ↔, \leftrightarrow, Left Right Arrow
-0x14a47115, // U+02948 ⥈, \leftrightarrowcircle, Left Right Arrow Through Small Circle
-0x10e32490, // U+021C6 ⇆, \leftrightarrows, Leftwards Arrow Over Rightwards Arrow / Left Arrow Over Right Arrow
-0x10fff117, // U+021FF ⇿, \leftrightarrowtriangle, Left Right Open-Headed Arrow
-0x14a583d7, // U+0294B ⥋, \leftrightharpoondownup, Left Barb Down Right Barb Up Harpoon
-0x10e59492, // U+021CB ⇋, \leftrightharpoons, Leftwards Harpoon Over Rightwards Harpoon / Left Harpoon Over Right Harpoon
-0x14b3a356, // U+02967 ⥧, \leftrightharpoonsdown, Leftwards Harpoon With Barb Down Above Rightwards Harpoon With Barb Down
-0x14b303d4, // U+02966 ⥦, \leftrightharpoonsup, Leftwards Harpoon With Barb Up Above Rightwards Harpoon With Barb Up
-0x14a52357, // U+0294A ⥊, \leftrightharpoonupdown, Left Barb Up Right Barb Down Harpoon
-0x10d6a594, // U+021AD ↭, \leftrightsquigarrow, Left Right Wave Arrow
-0x10ee258f, // U+021DC ⇜, \leftsquigarrow, Leftwards Squiggle Arrow / Left Squiggle Arrow
-0x1598a490, // U+02B31 ⬱, \leftthreearrows, Three Leftwards Arrows
-0x1165848f, // U+022CB ⋋, \leftthreetimes, Left Semidirect Product
-0x10ce258e, // U+0219C ↜, \leftwavearrow, Leftwards Wave Arrow / Left Wave Arrow
-0x10f3258f, // U+021E6 ⇦, \leftwhitearrow, Leftwards White Arrow / White Left Arrow
-0x13260384, // U+0264C ♌, \leo, Leo
-0x11320404, // U+02264 ≤, \leq, Less-Than Or Equal To / Less Than Or Equal To
-0x11334405, // U+02266 ≦, \leqq, Less-Than Over Equal To / Less Than Over Equal To
-0x157c94ca, // U+02AF9 ⫹, \leqqslant, Double-Line Slanted Less-Than Or Equal To
-0x153e94c9, // U+02A7D ⩽, \leqslant, Less-Than Or Slanted Equal To
-0x15546086, // U+02AA8 ⪨, \lescc, Less-Than Closed By Curve Above Slanted Equal
-0x153fa4c7, // U+02A7F ⩿, \lesdot, Less-Than Or Slanted Equal To With Dot Inside
-0x1540f388, // U+02A81 ⪁, \lesdoto, Less-Than Or Slanted Equal To With Dot Above
-0x1541a449, // U+02A83 ⪃, \lesdotor, Less-Than Or Slanted Equal To With Dot Above Right
-0x15498487, // U+02A93 ⪓, \lesges, Less-Than Above Slanted Equal Above Greater-Than Above Slanted Equal
-0x1542a5cb, // U+02A85 ⪅, \lessapprox, Less-Than Or Approximate
-0x116b24c8, // U+022D6 ⋖, \lessdot, Less-Than With Dot / Less Than With Dot
-0x116d744a, // U+022DA ⋚, \lesseqgtr, Less-Than Equal To Or Greater-Than / Less Than Equal To Or Greater Than
-0x1545f44b, // U+02A8B ⪋, \lesseqqgtr, Less-Than Above Double-Line Equal Above Greater-Than
-0x113b7448, // U+02276 ≶, \lessgtr, Less-Than Or Greater-Than / Less Than Or Greater Than
-0x11394308, // U+02272 ≲, \lesssim, Less-Than Or Equivalent To / Less Than Or Equivalent To
-0x11852447, // U+0230A ⌊, \lfloor, Left Floor
-0x1548a904, // U+02A91 ⪑, \lgE, Less-Than Above Greater-Than Above Double-Line Equal
-0x1592710c, // U+02B24 ⬤, \lgblkcircle, Black Large Circle
-0x158dd10c, // U+02B1B ⬛, \lgblksquare, Black Large Square
-0x12f7f10c, // U+025EF ◯, \lgwhtcircle, Large Circle
-0x158e510c, // U+02B1C ⬜, \lgwhtsquare, White Large Square
-0x13275006, // U+0264E ♎, \libra, Libra
-0x10da00c9, // U+021B4 ↴, \linefeed, Rightwards Arrow With Corner Downwards / Right Arrow With Corner Down
-0x113502c3, // U+0226A ≪, \ll, Much Less-Than / Much Less Than
-0x12efd086, // U+025DF ◟, \llarc, Lower Left Quadrant Circular Arc
-0x12f1f110, // U+025E3 ◣, \llblacktriangle, Black Lower Left Triangle
-0x13f304ca, // U+027E6 ⟦, \llbracket, Mathematical Left White Square Bracket
-0x118f0449, // U+0231E ⌞, \llcorner, Bottom Left Corner
-0x157be4c8, // U+02AF7 ⫷, \lllnest, Triple Nested Less-Than
-0x12fd710b, // U+025FA ◺, \lltriangle, Lower Left Triangle
-0x11d8310b, // U+023B0 ⎰, \lmoustache, Upper Left Or Lower Right Curly Bracket Section
-0x01685285, // U+002D0 ː, \lmrk, Modifier Letter Triangular Colon
-0x1544a5c9, // U+02A89 ⪉, \lnapprox, Less-Than And Not Approximate
-0x15438405, // U+02A87 ⪇, \lneq, Less-Than And Single-Line Not Equal To
-0x11344406, // U+02268 ≨, \lneqq, Less-Than But Not Equal To / Less Than But Not Equal To
-0x11734306, // U+022E6 ⋦, \lnsim, Less-Than But Not Equivalent To / Less Than But Not Equivalent To
-0x13faa58e, // U+027F5 ⟵, \longleftarrow, Long Leftwards Arrow
-0x13fba593, // U+027F7 ⟷, \longleftrightarrow, Long Left Right Arrow
-0x1599a593, // U+02B33 ⬳, \longleftsquigarrow, Long Leftwards Squiggle Arrow
-0x13fda30d, // U+027FB ⟻, \longmapsfrom, Long Leftwards Arrow From Bar
-0x13fe738b, // U+027FC ⟼, \longmapsto, Long Rightwards Arrow From Bar
-0x13fb258f, // U+027F6 ⟶, \longrightarrow, Long Rightwards Arrow
-0x13ffa594, // U+027FF ⟿, \longrightsquigarrow, Long Rightwards Squiggle Arrow
-0x10d594ce, // U+021AB ↫, \looparrowleft, Leftwards Arrow With Loop / Left Arrow With Loop
-0x10d634cf, // U+021AC ↬, \looparrowright, Rightwards Arrow With Loop / Right Arrow With Loop
-0x016aa584, // U+002D5 ˕, \low, Modifier Letter Down Tack
-0x150e14c7, // U+02A1C ⨜, \lowint, Integral With Underbar
-0x12e52108, // U+025CA ◊, \lozenge, Lozenge
-0x14d024c7, // U+029A0 ⦠, \lpargt, Spherical Angle Opening Left
-0x100c0403, // U+02018 ‘, \lq, Left Single Quotation Mark / Single Turned Comma Quotation Mark
-0x12ef5086, // U+025DE ◞, \lrarc, Lower Right Quadrant Circular Arc
-0x12f17110, // U+025E2 ◢, \lrblacktriangle, Black Lower Right Triangle
-0x118f8449, // U+0231F ⌟, \lrcorner, Bottom Right Corner
-0x12fff10b, // U+025FF ◿, \lrtriangle, Lower Right Triangle
-0x14f0840d, // U+029E1 ⧡, \lrtriangleeq, Increases As
-0x15468106, // U+02A8D ⪍, \lsime, Less-Than Above Similar Or Equal
-0x15478186, // U+02A8F ⪏, \lsimg, Less-Than Above Similar Above Greater-Than
-0x1566a288, // U+02ACD ⫍, \lsqhook, Square Left Open Box Operator
-0x15536085, // U+02AA6 ⪦, \ltcc, Less-Than Closed By Curve
-0x153cc446, // U+02A79 ⩹, \ltcir, Less-Than With Circle Inside
-0x11648487, // U+022C9 ⋉, \ltimes, Left Normal Factor Semidirect Product
-0x01388446, // U+00271 ɱ, \ltlmr, Latin Small Letter M With Hook / Latin Small Letter M Hook
-0x01397345, // U+00272 ɲ, \ltln, Latin Small Letter N With Left Hook / Latin Small Letter N Hook
-0x013c3206, // U+00278 ɸ, \ltphi, Latin Small Letter Phi
-0x153de4c8, // U+02A7B ⩻, \ltquest, Less-Than With Question Mark Above
-0x11dc110a, // U+023B8 ⎸, \lvboxline, Left Vertical Box Line
-0x0001c40a, // U+00003 ≨︀, \lvertneqq, Less-Than But Not Equal To / Less Than But Not Equal To + Variation Selector-1
-0x13217105, // U+02642 ♂, \male, Male Sign
-0x13906108, // U+02720 ✠, \maltese, Maltese Cross
-0x10d3a349, // U+021A7 ↧, \mapsdown, Downwards Arrow From Bar / Down Arrow From Bar
-0x10d22309, // U+021A4 ↤, \mapsfrom, Leftwards Arrow From Bar / Left Arrow From Bar
-0x10d37387, // U+021A6 ↦, \mapsto, Rightwards Arrow From Bar / Right Arrow From Bar
-0x10d283c7, // U+021A5 ↥, \mapsup, Upwards Arrow From Bar / Up Arrow From Bar
-0x13215485, // U+02642 ♂, \mars, Male Sign
-0x1355f10c, // U+026AB ⚫, \mdblkcircle, Medium Black Circle
-0x159290cd, // U+02B25 ⬥, \mdblkdiamond, Black Medium Diamond
-0x1593a10d, // U+02B27 ⬧, \mdblklozenge, Black Medium Lozenge
-0x12fe510c, // U+025FC ◼, \mdblksquare, Black Medium Square
-0x12e7f10e, // U+025CF ●, \mdlgblkcircle, Black Circle
-0x12e310cf, // U+025C6 ◆, \mdlgblkdiamond, Black Diamond
-0x12e390cf, // U+025C7 ◇, \mdlgwhtdiamond, White Diamond
-0x12ff510e, // U+025FE ◾, \mdsmblksquare, Black Medium Small Square
-0x1356710e, // U+026AC ⚬, \mdsmwhtcircle, Medium Small White Circle
-0x12fed10e, // U+025FD ◽, \mdsmwhtsquare, White Medium Small Square
-0x1355710c, // U+026AA ⚪, \mdwhtcircle, Medium White Circle
-0x159310cd, // U+02B26 ⬦, \mdwhtdiamond, White Medium Diamond
-0x1594210d, // U+02B28 ⬨, \mdwhtlozenge, White Medium Lozenge
-0x12fdd10c, // U+025FB ◻, \mdwhtsquare, White Medium Square
-0x14d7e590, // U+029AF ⦯, \measangledltosw, Measured Angle With Open Arm Ending In Arrow Pointing Left And Down
-0x14d76110, // U+029AE ⦮, \measangledrtose, Measured Angle With Open Arm Ending In Arrow Pointing Right And Down
-0x14d5e590, // U+029AB ⦫, \measangleldtosw, Measured Angle With Open Arm Ending In Arrow Pointing Down And Left
-0x14d49590, // U+029A9 ⦩, \measanglelutonw, Measured Angle With Open Arm Ending In Arrow Pointing Up And Left
-0x14d56110, // U+029AA ⦪, \measanglerdtose, Measured Angle With Open Arm Ending In Arrow Pointing Down And Right
-0x14d41110, // U+029A8 ⦨, \measanglerutone, Measured Angle With Open Arm Ending In Arrow Pointing Up And Right
-0x14d69590, // U+029AD ⦭, \measangleultonw, Measured Angle With Open Arm Ending In Arrow Pointing Left And Up
-0x14d61110, // U+029AC ⦬, \measangleurtone, Measured Angle With Open Arm Ending In Arrow Pointing Right And Up
-0x112f0407, // U+0225E ≞, \measeq, Measured By
-0x1110f10e, // U+02221 ∡, \measuredangle, Measured Angle
-0x14cd94d2, // U+0299B ⦛, \measuredangleleft, Measured Angle Opening Left
-0x15a8c44d, // U+02B51 ⭑, \medblackstar, Black Small Star
-0x15a8444d, // U+02B50 ⭐, \medwhitestar, White Medium Star
-0x131fd608, // U+0263F ☿, \mercury, Mercury
-0x1093b384, // U+02127 ℧, \mho, Inverted Ohm Sign / Mho
-0x1111c0c4, // U+02223 ∣, \mid, Divides
-0x152e810a, // U+02A5D ⩝, \midbarvee, Logical Or With Horizontal Dash
-0x152e210c, // U+02A5C ⩜, \midbarwedge, Logical And With Horizontal Dash
-0x152fc4c7, // U+02A5F ⩟, \minhat, Logical And With Underbar
-0x11090486, // U+02212 −, \minus, Minus Sign
-0x151524c9, // U+02A2A ⨪, \minusdot, Minus Sign With Dot Below
-0x1515f48b, // U+02A2B ⨫, \minusfdots, Minus Sign With Falling Dots
-0x1516748b, // U+02A2C ⨬, \minusrdots, Minus Sign With Rising Dots
-0x156de3c5, // U+02ADB ⫛, \mlcp, Transversal Intersection
-0x1153f487, // U+022A7 ⊧, \models, Models
-0x1505030a, // U+02A0A ⨊, \modtwosum, Modulo Two Sum
-0x110983c3, // U+02213 ∓, \mp, Minus-Or-Plus Sign
-0x01de0503, // U+003BC μ, \mu, Greek Small Letter Mu
-0x115c43c9, // U+022B8 ⊸, \multimap, Multimap
-0x00008408, // U+00001 ≎̸, \nBumpeq, Geometrically Equivalent To + Combining Long Solidus Overlay / Non-Spacing Long Slash Overlay
-0x10efa58c, // U+021DF ⇟, \nHdownarrow, Downwards Arrow With Double Stroke / Down Arrow With Double Stroke
-0x10ef258a, // U+021DE ⇞, \nHuparrow, Upwards Arrow With Double Stroke / Up Arrow With Double Stroke
-0x10e6a58b, // U+021CD ⇍, \nLeftarrow, Leftwards Double Arrow With Stroke / Left Double Arrow With Stroke
-0x10e72590, // U+021CE ⇎, \nLeftrightarrow, Left Right Double Arrow With Stroke
-0x10e7a58c, // U+021CF ⇏, \nRightarrow, Rightwards Double Arrow With Stroke / Right Double Arrow With Stroke
-0x1157e1c7, // U+022AF ⊯, \nVDash, Negated Double Vertical Bar Double Right Turnstile
-0x115761c7, // U+022AE ⊮, \nVdash, Does Not Force
-0x10fd258c, // U+021FA ⇺, \nVleftarrow, Leftwards Arrow With Double Vertical Stroke
-0x159d42d0, // U+02B3A ⬺, \nVleftarrowtail, Leftwards Arrow With Tail With Double Vertical Stroke
-0x10fe2591, // U+021FC ⇼, \nVleftrightarrow, Left Right Arrow With Double Vertical Stroke
-0x10fda58d, // U+021FB ⇻, \nVrightarrow, Rightwards Arrow With Double Vertical Stroke
-0x148ac2d1, // U+02915 ⤕, \nVrightarrowtail, Rightwards Arrow With Tail With Double Vertical Stroke
-0x159aa593, // U+02B35 ⬵, \nVtwoheadleftarrow, Leftwards Two-Headed Arrow With Double Vertical Stroke
-0x159ec2d7, // U+02B3D ⬽, \nVtwoheadleftarrowtail, Leftwards Two-Headed Arrow With Tail With Double Vertical Stroke
-0x1480a594, // U+02901 ⤁, \nVtwoheadrightarrow, Rightwards Two-Headed Arrow With Double Vertical Stroke
-0x148c42d8, // U+02918 ⤘, \nVtwoheadrightarrowtail, Rightwards Two-Headed Arrow With Tail With Double Vertical Stroke
-0x1103f006, // U+02207 ∇, \nabla, Nabla
-0x115e10c5, // U+022BC ⊼, \nand, Nand
-0x1124a5c8, // U+02249 ≉, \napprox, Not Almost Equal To
-0x113683c7, // U+0226D ≭, \nasymp, Not Equivalent To
-0x133742c8, // U+0266E ♮, \natural, Music Natural Sign / Natural
-0x00010408, // U+00002 ≏̸, \nbumpeq, Difference Between + Combining Long Solidus Overlay / Non-Spacing Long Slash Overlay
-0x11239186, // U+02247 ≇, \ncong, Neither Approximately Nor Actually Equal To
-0x11300103, // U+02260 ≠, \ne, Not Equal To
-0x10cba588, // U+02197 ↗, \nearrow, North East Arrow / Upper Right Arrow
-0x00560184, // U+000AC ¬, \neg, Not Sign
-0x1498a58c, // U+02931 ⤱, \neovnwarrow, North East Arrow Crossing North West Arrow
-0x1497258c, // U+0292E ⤮, \neovsearrow, North East Arrow Crossing South East Arrow
-0x13231108, // U+02646 ♆, \neptune, Neptune
-0x11300404, // U+02260 ≠, \neq, Not Equal To
-0x00004307, // U+00000 ≂̸, \neqsim, Minus Tilde + Combining Long Solidus Overlay / Non-Spacing Long Slash Overlay
-0x11314547, // U+02262 ≢, \nequiv, Not Identical To
-0x13590447, // U+026B2 ⚲, \neuter, Neuter
-0x11027488, // U+02204 ∄, \nexists, There Does Not Exist
-0x00a58183, // U+0014B ŋ, \ng, Latin Small Letter Eng
-0x11388405, // U+02271 ≱, \ngeq, Neither Greater-Than Nor Equal To / Neither Greater Than Nor Equal To
-0x000814ca, // U+00010 ⩾̸, \ngeqslant, Greater-Than Or Slanted Equal To + Combining Long Solidus Overlay / Non-Spacing Long Slash Overlay
-0x1137f445, // U+0226F ≯, \ngtr, Not Greater-Than / Not Greater Than
-0x113ac308, // U+02275 ≵, \ngtrsim, Neither Greater-Than Nor Equivalent To / Neither Greater Than Nor Equivalent To
-0x11058203, // U+0220B ∋, \ni, Contains As Member
-0x117f4447, // U+022FE ⋾, \niobar, Small Contains With Overbar
-0x117e4484, // U+022FC ⋼, \nis, Small Contains With Vertical Bar At End Of Horizontal Stroke
-0x117d60c5, // U+022FA ⋺, \nisd, Contains With Long Horizontal Stroke
-0x10cd258b, // U+0219A ↚, \nleftarrow, Leftwards Arrow With Stroke / Left Arrow With Stroke
-0x10d72590, // U+021AE ↮, \nleftrightarrow, Left Right Arrow With Stroke
-0x11380405, // U+02270 ≰, \nleq, Neither Less-Than Nor Equal To / Neither Less Than Nor Equal To
-0x000794ca, // U+0000F ⩽̸, \nleqslant, Less-Than Or Slanted Equal To + Combining Long Solidus Overlay / Non-Spacing Long Slash Overlay
-0x11376486, // U+0226E ≮, \nless, Not Less-Than / Not Less Than
-0x113a4309, // U+02274 ≴, \nlesssim, Neither Less-Than Nor Equivalent To / Neither Less Than Nor Equivalent To
-0x111240c5, // U+02224 ∤, \nmid, Does Not Divide
-0x11061204, // U+0220C ∌, \nni, Does Not Contain As Member
-0x1030428c, // U+02060 ⁠, \nolinebreak, Word Joiner
-0x115ea444, // U+022BD ⊽, \nor, Nor
-0x019c24c4, // U+00338 ̸, \not, Combining Long Solidus Overlay / Non-Spacing Long Slash Overlay
-0x11a061cd, // U+02340 ⍀, \notbackslash, Apl Functional Symbol Backslash Bar
-0x113ce48f, // U+02279 ≹, \notgreaterless, Neither Greater-Than Nor Less-Than / Neither Greater Than Nor Less Than
-0x1104c346, // U+02209 ∉, \notin, Not An Element Of
-0x113c044f, // U+02278 ≸, \notlessgreater, Neither Less-Than Nor Greater-Than / Neither Less Than Nor Greater Than
-0x119fe1c9, // U+0233F ⌿, \notslash, Apl Functional Symbol Slash Bar
-0x111302ca, // U+02226 ∦, \nparallel, Not Parallel To
-0x150a14c8, // U+02A14 ⨔, \npolint, Line Integration Not Including The Pole
-0x11400086, // U+02280 ⊀, \nprec, Does Not Precede
-0x1170040d, // U+022E0 ⋠, \npreccurlyeq, Does Not Precede Or Equal
-0x00098408, // U+00013 ⪯̸, \npreceq, Precedes Above Single-Line Equals Sign + Combining Long Solidus Overlay / Non-Spacing Long Slash Overlay
-0x0003c309, // U+00007 ≾̸, \nprecsim, Precedes Or Equivalent To + Combining Long Solidus Overlay / Non-Spacing Long Slash Overlay
-0x10cda58c, // U+0219B ↛, \nrightarrow, Rightwards Arrow With Stroke / Right Arrow With Stroke
-0x00cf0186, // U+0019E ƞ, \nrleg, Latin Small Letter N With Long Right Leg
-0x1120c305, // U+02241 ≁, \nsim, Not Tilde
-0x11220106, // U+02244 ≄, \nsime, Not Asymptotically Equal To
-0x1171040c, // U+022E2 ⋢, \nsqsubseteq, Not Square Image Of Or Equal To
-0x1171840c, // U+022E3 ⋣, \nsqsupseteq, Not Square Original Of Or Equal To
-0x114204c8, // U+02284 ⊄, \nsubset, Not A Subset Of
-0x1144040a, // U+02288 ⊈, \nsubseteq, Neither A Subset Of Nor Equal To
-0x000ac40b, // U+00015 ⫅̸, \nsubseteqq, Subset Of Above Equals Sign + Combining Long Solidus Overlay / Non-Spacing Long Slash Overlay
-0x1140e086, // U+02281 ⊁, \nsucc, Does Not Succeed
-0x1170840d, // U+022E1 ⋡, \nsucccurlyeq, Does Not Succeed Or Equal
-0x000a0408, // U+00014 ⪰̸, \nsucceq, Succeeds Above Single-Line Equals Sign + Combining Long Solidus Overlay / Non-Spacing Long Slash Overlay
-0x00044309, // U+00008 ≿̸, \nsuccsim, Succeeds Or Equivalent To + Combining Long Solidus Overlay / Non-Spacing Long Slash Overlay
-0x114284c8, // U+02285 ⊅, \nsupset, Not A Superset Of
-0x1144840a, // U+02289 ⊉, \nsupseteq, Neither A Superset Of Nor Equal To
-0x000b440b, // U+00016 ⫆̸, \nsupseteqq, Superset Of Above Equals Sign + Combining Long Solidus Overlay / Non-Spacing Long Slash Overlay
-0x117514ce, // U+022EA ⋪, \ntriangleleft, Not Normal Subgroup Of
-0x11760410, // U+022EC ⋬, \ntrianglelefteq, Not Normal Subgroup Of Or Equal To
-0x1175b4cf, // U+022EB ⋫, \ntriangleright, Does Not Contain As Normal Subgroup
-0x11768411, // U+022ED ⋭, \ntrianglerighteq, Does Not Contain As Normal Subgroup Or Equal
-0x01de8503, // U+003BD ν, \nu, Greek Small Letter Nu
-0x108b5387, // U+02116 №, \numero, Numero Sign / Numero
-0x1156e1c7, // U+022AD ⊭, \nvDash, Not True
-0x1481258c, // U+02902 ⤂, \nvLeftarrow, Leftwards Double Arrow With Vertical Stroke
-0x14822591, // U+02904 ⤄, \nvLeftrightarrow, Left Right Double Arrow With Vertical Stroke
-0x1481a58d, // U+02903 ⤃, \nvRightarrow, Rightwards Double Arrow With Vertical Stroke
-0x115661c7, // U+022AC ⊬, \nvdash, Does Not Prove
-0x10fba58c, // U+021F7 ⇷, \nvleftarrow, Leftwards Arrow With Vertical Stroke
-0x159cc2d0, // U+02B39 ⬹, \nvleftarrowtail, Leftwards Arrow With Tail With Vertical Stroke
-0x10fca591, // U+021F9 ⇹, \nvleftrightarrow, Left Right Arrow With Vertical Stroke
-0x10fc258d, // U+021F8 ⇸, \nvrightarrow, Rightwards Arrow With Vertical Stroke
-0x148a42d1, // U+02914 ⤔, \nvrightarrowtail, Rightwards Arrow With Tail With Vertical Stroke
-0x159a2593, // U+02B34 ⬴, \nvtwoheadleftarrow, Leftwards Two-Headed Arrow With Vertical Stroke
-0x159e42d7, // U+02B3C ⬼, \nvtwoheadleftarrowtail, Leftwards Two-Headed Arrow With Tail With Vertical Stroke
-0x14802594, // U+02900 ⤀, \nvtwoheadrightarrow, Rightwards Two-Headed Arrow With Vertical Stroke
-0x148bc2d8, // U+02917 ⤗, \nvtwoheadrightarrowtail, Rightwards Two-Headed Arrow With Tail With Vertical Stroke
-0x10cb2588, // U+02196 ↖, \nwarrow, North West Arrow / Upper Left Arrow
-0x1499258c, // U+02932 ⤲, \nwovnearrow, North West Arrow Crossing North East Arrow
-0x007c0382, // U+000F8 ø, \o, Latin Small Letter O With Stroke / Latin Small Letter O Slash
-0x119ec445, // U+0233D ⌽, \obar, Apl Functional Symbol Circle Stile
-0x14dc61c8, // U+029B8 ⦸, \obslash, Circled Reverse Solidus
-0x01855086, // U+0030A ̊, \ocirc, Combining Ring Above / Non-Spacing Ring Above
-0x018ab4cf, // U+00315 ̕, \ocommatopright, Combining Comma Above Right / Non-Spacing Comma Above Right
-0x151c4545, // U+02A38 ⨸, \odiv, Circled Division Sign
-0x114ca4c5, // U+02299 ⊙, \odot, Circled Dot Operator
-0x14de24cd, // U+029BC ⦼, \odotslashdot, Circled Anticlockwise-Rotated Division Sign
-0x00a98103, // U+00153 œ, \oe, Latin Small Ligature Oe / Latin Small Letter O E
-0x14e0c34d, // U+029C1 ⧁, \ogreaterthan, Circled Greater-Than
-0x10933304, // U+02126 Ω, \ohm, Ohm Sign / Ohm
-0x111814c7, // U+02230 ∰, \oiiint, Volume Integral
-0x111794c6, // U+0222F ∯, \oiint, Surface Integral
-0x111714c5, // U+0222E ∮, \oint, Contour Integral
-0x1119e111, // U+02233 ∳, \ointctrclockwise, Anticlockwise Contour Integral
-0x14e0434a, // U+029C0 ⧀, \olessthan, Circled Less-Than
-0x01e4a006, // U+003C9 ω, \omega, Greek Small Letter Omega
-0x114b0487, // U+02296 ⊖, \ominus, Circled Minus
-0x13f314d0, // U+027E6 ⟦, \openbracketleft, Mathematical Left White Square Bracket
-0x13f3b4d1, // U+027E7 ⟧, \openbracketright, Mathematical Right White Square Bracket
-0x012a1386, // U+00254 ɔ, \openo, Latin Small Letter Open O
-0x114a8486, // U+02295 ⊕, \oplus, Circled Plus
-0x1516c30b, // U+02A2D ⨭, \opluslhrim, Plus Sign In Left Half Circle
-0x1517430b, // U+02A2E ⨮, \oplusrhrim, Plus Sign In Right Half Circle
-0x0055110c, // U+000AA ª, \ordfeminine, Feminine Ordinal Indicator
-0x005d110d, // U+000BA º, \ordmasculine, Masculine Ordinal Indicator
-0x115b42c9, // U+022B6 ⊶, \original, Original Of
-0x114c61c7, // U+02298 ⊘, \oslash, Circled Division Slash
-0x114b8487, // U+02297 ⊗, \otimes, Circled Times
-0x151b44ca, // U+02A36 ⨶, \otimeshat, Circled Multiplication Sign With Circumflex Accent
-0x151a430c, // U+02A34 ⨴, \otimeslhrim, Multiplication Sign In Left Half Circle
-0x151ac30c, // U+02A35 ⨵, \otimesrhrim, Multiplication Sign In Right Half Circle
-0x0189000d, // U+00312 ̒, \oturnedcomma, Combining Turned Comma Above / Non-Spacing Turned Comma Above
-0x0182c448, // U+00305 ̅, \overbar, Combining Overline / Non-Spacing Overscore
-0x11ef610a, // U+023DE ⏞, \overbrace, Top Curly Bracket
-0x11da04cc, // U+023B4 ⎴, \overbracket, Top Square Bracket
-0x106b258e, // U+020D6 ⃖, \overleftarrow, Combining Left Arrow Above / Non-Spacing Left Arrow Above
-0x1070a593, // U+020E1 ⃡, \overleftrightarrow, Combining Left Right Arrow Above / Non-Spacing Left Right Arrow Above
-0x0184a287, // U+00309 ̉, \ovhook, Combining Hook Above / Non-Spacing Hook Above
-0x0190f1c5, // U+00321 ̡, \palh, Combining Palatalized Hook Below / Non-Spacing Palatalized Hook Below
-0x111282c9, // U+02225 ∥, \parallel, Parallel To
-0x12d8c30e, // U+025B1 ▱, \parallelogram, White Parallelogram
-0x12d86293, // U+025B0 ▰, \parallelogramblack, Black Parallelogram
-0x110142c8, // U+02202 ∂, \partial, Partial Differential
-0x1551a357, // U+02AA3 ⪣, \partialmeetcontraction, Double Nested Less-Than With Underbar
-0x01324306, // U+00264 ɤ, \pbgam, Latin Small Letter Rams Horn / Latin Small Letter Baby Gamma
-0x15902349, // U+02B20 ⬠, \pentagon, White Pentagon
-0x158fe28e, // U+02B1F ⬟, \pentagonblack, Black Pentagon
-0x13e153c5, // U+027C2 ⟂, \perp, Perpendicular
-0x152f10d0, // U+02A5E ⩞, \perspcorrespond, Logical And With Double Overbar
-0x101890cf, // U+02031 ‱, \pertenthousand, Per Ten Thousand Sign
-0x101810cc, // U+02030 ‰, \perthousand, Per Mille Sign
-0x10538484, // U+020A7 ₧, \pes, Peseta Sign
-0x01318007, // U+00263 ɣ, \pgamma, Latin Small Letter Gamma
-0x01eab204, // U+003D5 ϕ, \phi, Greek Phi Symbol / Greek Small Letter Script Phi
-0x01e00203, // U+003C0 π, \pi, Greek Small Letter Pi
-0x13298487, // U+02653 ♓, \pisces, Pisces
-0x116a528a, // U+022D4 ⋔, \pitchfork, Pitchfork
-0x10876287, // U+0210E ℎ, \planck, Planck Constant
-0x1512a4c8, // U+02A25 ⨥, \plusdot, Plus Sign With Dot Below
-0x15394408, // U+02A72 ⩲, \pluseqq, Plus Sign Above Equals Sign
-0x1511c4c8, // U+02A23 ⨣, \plushat, Plus Sign With Circumflex Accent Above
-0x15134308, // U+02A26 ⨦, \plussim, Plus Sign With Tilde Below
-0x1513a38b, // U+02A27 ⨧, \plussubtwo, Plus Sign With Subscript Two
-0x15144149, // U+02A28 ⨨, \plustrif, Plus Sign With Black Triangle
-0x1323f386, // U+02647 ♇, \pluto, Pluto
-0x00588303, // U+000B1 ±, \pm, Plus-Minus Sign / Plus-Or-Minus Sign
-0x150a94c9, // U+02A15 ⨕, \pointint, Integral Around A Point Operator
-0x1809528b, // U+03012 〒, \postalmark, Postal Mark
-0x102b8109, // U+02057 ⁗, \pppprime, Quadruple Prime
-0x101a0108, // U+02034 ‴, \ppprime, Triple Prime
-0x10198107, // U+02033 ″, \pprime, Double Prime
-0x113d0085, // U+0227A ≺, \prec, Precedes
-0x155ba5cb, // U+02AB7 ⪷, \precapprox, Precedes Above Almost Equal To
-0x113e040c, // U+0227C ≼, \preccurlyeq, Precedes Or Equal To
-0x15578407, // U+02AAF ⪯, \preceq, Precedes Above Single-Line Equals Sign
-0x1559c408, // U+02AB3 ⪳, \preceqq, Precedes Above Equals Sign
-0x155ca5cc, // U+02AB9 ⪹, \precnapprox, Precedes Above Not Almost Equal To
-0x15588408, // U+02AB1 ⪱, \precneq, Precedes Above Single-Line Not Equal To
-0x155ac409, // U+02AB5 ⪵, \precneqq, Precedes Above Not Equal To
-0x11744309, // U+022E8 ⋨, \precnsim, Precedes But Not Equivalent To
-0x113f4308, // U+0227E ≾, \precsim, Precedes Or Equivalent To
-0x10190106, // U+02032 ′, \prime, Prime
-0x1107a0c5, // U+0220F ∏, \prod, N-Ary Product
-0x11891109, // U+02312 ⌒, \profline, Arc
-0x1189d149, // U+02313 ⌓, \profsurf, Segment
-0x110ef387, // U+0221D ∝, \propto, Proportional To
-0x115802c7, // U+022B0 ⊰, \prurel, Precedes Under Relation
-0x0145d546, // U+0028B ʋ, \pscrv, Latin Small Letter V With Hook / Latin Small Letter Script V
-0x01e46204, // U+003C8 ψ, \psi, Greek Small Letter Psi
-0x014542c7, // U+0028A ʊ, \pupsil, Latin Small Letter Upsilon
-0x1001c0c5, // U+02003  , \quad, Em Space
-0x1334f10c, // U+02669 ♩, \quarternote, Quarter Note
-0x112f8408, // U+0225F ≟, \questeq, Questioned Equal To
-0x005fa34d, // U+000BF ¿, \questiondown, Inverted Question Mark
-0x14a25446, // U+02944 ⥄, \rLarr, Short Rightwards Arrow Above Leftwards Arrow
-0x016a4485, // U+002D4 ˔, \rais, Modifier Letter Up Tack
-0x13f4f107, // U+027E9 ⟩, \rangle, Mathematical Right Angle Bracket
-0x14a3d5c6, // U+02947 ⥇, \rarrx, Rightwards Arrow Through X
-0x015e63c5, // U+002BC ʼ, \rasp, Modifier Letter Apostrophe
-0x1184c2c6, // U+02309 ⌉, \rceil, Right Ceiling
-0x1495c18d, // U+0292B ⤫, \rdiagovfdiag, Rising Diagonal Crossing Falling Diagonal
-0x1498258f, // U+02930 ⤰, \rdiagovsearrow, Rising Diagonal Crossing South East Arrow
-0x100ef404, // U+0201D ”, \rdq, Right Double Quotation Mark / Double Comma Quotation Mark
-0x100da487, // U+0201B ‛, \reapos, Single High-Reversed-9 Quotation Mark / Single Reversed Comma Quotation Mark
-0x118a8449, // U+02315 ⌕, \recorder, Telephone Recorder
-0x014ae4c7, // U+00295 ʕ, \reglst, Latin Letter Pharyngeal Voiced Fricative / Latin Letter Reversed Glottal Stop
-0x14d1f109, // U+029A3 ⦣, \revangle, Reversed Angle
-0x14d2c44d, // U+029A5 ⦥, \revangleubar, Reversed Angle With Underbar
-0x14d804cc, // U+029B0 ⦰, \revemptyset, Reversed Empty Set
-0x1185a447, // U+0230B ⌋, \rfloor, Right Floor
-0x019101c3, // U+00322 ̢, \rh, Combining Retroflex Hook Below / Non-Spacing Retroflex Hook Below
-0x01e0b384, // U+003C1 ρ, \rho, Greek Small Letter Rho
-0x110ff10b, // U+0221F ∟, \rightangle, Right Angle
-0x115f508e, // U+022BE ⊾, \rightanglearc, Right Angle With Arc
-0x14cea4cf, // U+0299D ⦝, \rightanglemdot, Measured Right Angle With Dot
-0x10c9258b, // U+02192 →, \rightarrow, Rightwards Arrow / Right Arrow
-0x15a425d5, // U+02B48 ⭈, \rightarrowbackapprox, Rightwards Arrow Above Reverse Almost Equal To
-0x10f2c44e, // U+021E5 ⇥, \rightarrowbar, Rightwards Arrow To Bar / Right Arrow To Bar
-0x15a64453, // U+02B4C ⭌, \rightarrowbsimilar, Rightwards Arrow Above Reverse Tilde Operator
-0x148f10d2, // U+0291E ⤞, \rightarrowdiamond, Rightwards Arrow To Black Diamond
-0x15a1f44e, // U+02B43 ⭃, \rightarrowgtr, Rightwards Arrow Through Greater-Than
-0x14a2848f, // U+02945 ⥅, \rightarrowplus, Rightwards Arrow With Plus Below
-0x15a204d1, // U+02B44 ⭄, \rightarrowsupset, Rightwards Arrow Through Superset
-0x10d1c2cf, // U+021A3 ↣, \rightarrowtail, Rightwards Arrow With Tail / Right Arrow With Tail
-0x10ff7113, // U+021FE ⇾, \rightarrowtriangle, Rightwards Open-Headed Arrow
-0x10f1258f, // U+021E2 ⇢, \rightdasharrow, Rightwards Dashed Arrow / Right Dashed Arrow
-0x1488a58e, // U+02911 ⤑, \rightdotarrow, Rightwards Arrow With Dotted Stem
-0x106894d3, // U+020D1 ⃑, \rightharpoonaccent, Combining Right Harpoon Above / Non-Spacing Right Harpoon Above
-0x10e0a351, // U+021C1 ⇁, \rightharpoondown, Rightwards Harpoon With Barb Downwards / Right Harpoon With Barb Down
-0x14b22354, // U+02964 ⥤, \rightharpoonsupdown, Rightwards Harpoon With Barb Up Above Rightwards Harpoon With Barb Down
-0x10e003cf, // U+021C0 ⇀, \rightharpoonup, Rightwards Harpoon With Barb Upwards / Right Harpoon With Barb Up
-0x14b661d3, // U+0296C ⥬, \rightharpoonupdash, Rightwards Harpoon With Barb Up Above Long Dash
-0x10e22490, // U+021C4 ⇄, \rightleftarrows, Rightwards Arrow Over Leftwards Arrow / Right Arrow Over Left Arrow
-0x10e61492, // U+021CC ⇌, \rightleftharpoons, Rightwards Harpoon Over Leftwards Harpoon / Right Harpoon Over Left Harpoon
-0x14b4a356, // U+02969 ⥩, \rightleftharpoonsdown, Rightwards Harpoon With Barb Down Above Leftwards Harpoon With Barb Down
-0x14b403d4, // U+02968 ⥨, \rightleftharpoonsup, Rightwards Harpoon With Barb Up Above Leftwards Harpoon With Barb Up
-0x131ea34a, // U+0263D ☽, \rightmoon, First Quarter Moon
-0x13eb434f, // U+027D6 ⟖, \rightouterjoin, Right Outer Join
-0x15aa234e, // U+02B54 ⭔, \rightpentagon, White Right-Pointing Pentagon
-0x15a9e293, // U+02B53 ⭓, \rightpentagonblack, Black Right-Pointing Pentagon
-0x10e4a491, // U+021C9 ⇉, \rightrightarrows, Rightwards Paired Arrows / Right Paired Arrows
-0x10eea590, // U+021DD ⇝, \rightsquigarrow, Rightwards Squiggle Arrow / Right Squiggle Arrow
-0x10fb2491, // U+021F6 ⇶, \rightthreearrows, Three Rightwards Arrows
-0x11660490, // U+022CC ⋌, \rightthreetimes, Right Semidirect Product
-0x10cea58f, // U+0219D ↝, \rightwavearrow, Rightwards Wave Arrow / Right Wave Arrow
-0x10f42590, // U+021E8 ⇨, \rightwhitearrow, Rightwards White Arrow / White Right Arrow
-0x15110489, // U+02A22 ⨢, \ringplus, Plus Sign With Small Circle Above
-0x1129840d, // U+02253 ≓, \risingdotseq, Image Of Or Approximately Equal To
-0x013e02c3, // U+0027C ɼ, \rl, Latin Small Letter R With Long Leg
-0x11d8b10b, // U+023B1 ⎱, \rmoustache, Upper Right Or Lower Left Curly Bracket Section
-0x150914c9, // U+02A12 ⨒, \rppolint, Line Integration With Rectangular Path Around Pole
-0x100c8403, // U+02019 ’, \rq, Right Single Quotation Mark / Single Comma Quotation Mark
-0x13f384ca, // U+027E7 ⟧, \rrbracket, Mathematical Right White Square Bracket
-0x14fbc448, // U+029F7 ⧷, \rsolbar, Reverse Solidus With Horizontal Stroke
-0x15672288, // U+02ACE ⫎, \rsqhook, Square Right Open Box Operator
-0x11650487, // U+022CA ⋊, \rtimes, Right Normal Factor Semidirect Product
-0x012b70c5, // U+00256 ɖ, \rtld, Latin Small Letter D With Tail / Latin Small Letter D Retroflex Hook
-0x0136f2c5, // U+0026D ɭ, \rtll, Latin Small Letter L With Retroflex Hook / Latin Small Letter L Retroflex Hook
-0x0139f345, // U+00273 ɳ, \rtln, Latin Small Letter N With Retroflex Hook / Latin Small Letter N Retroflex Hook
-0x013ef445, // U+0027D ɽ, \rtlr, Latin Small Letter R With Tail / Latin Small Letter R Hook
-0x01417485, // U+00282 ʂ, \rtls, Latin Small Letter S With Hook / Latin Small Letter S Hook
-0x014474c5, // U+00288 ʈ, \rtlt, Latin Small Letter T With Retroflex Hook / Latin Small Letter T Retroflex Hook
-0x01487645, // U+00290 ʐ, \rtlz, Latin Small Letter Z With Retroflex Hook / Latin Small Letter Z Retroflex Hook
-0x013d9447, // U+0027B ɻ, \rttrnr, Latin Small Letter Turned R With Hook / Latin Small Letter Turned R Hook
-0x11dc910a, // U+023B9 ⎹, \rvboxline, Right Vertical Box Line
-0x12ec72c7, // U+025D8 ◘, \rvbull, Inverse Bullet
-0x1328048c, // U+02650 ♐, \sagittarius, Sagittarius
-0xead06806, // U+1D5A0 𝖠, \sansA, Mathematical Sans-Serif Capital A
-0xead0e846, // U+1D5A1 𝖡, \sansB, Mathematical Sans-Serif Capital B
-0xead16886, // U+1D5A2 𝖢, \sansC, Mathematical Sans-Serif Capital C
-0xead1e8c6, // U+1D5A3 𝖣, \sansD, Mathematical Sans-Serif Capital D
-0xead26906, // U+1D5A4 𝖤, \sansE, Mathematical Sans-Serif Capital E
-0xead2e946, // U+1D5A5 𝖥, \sansF, Mathematical Sans-Serif Capital F
-0xead36986, // U+1D5A6 𝖦, \sansG, Mathematical Sans-Serif Capital G
-0xead3e9c6, // U+1D5A7 𝖧, \sansH, Mathematical Sans-Serif Capital H
-0xead46a06, // U+1D5A8 𝖨, \sansI, Mathematical Sans-Serif Capital I
-0xead4ea46, // U+1D5A9 𝖩, \sansJ, Mathematical Sans-Serif Capital J
-0xead56a86, // U+1D5AA 𝖪, \sansK, Mathematical Sans-Serif Capital K
-0xead5eac6, // U+1D5AB 𝖫, \sansL, Mathematical Sans-Serif Capital L
-0x10a180ce, // U+02143 ⅃, \sansLmirrored, Reversed Sans-Serif Capital L
-0x10a100cc, // U+02142 ⅂, \sansLturned, Turned Sans-Serif Capital L
-0xead66b06, // U+1D5AC 𝖬, \sansM, Mathematical Sans-Serif Capital M
-0xead6eb46, // U+1D5AD 𝖭, \sansN, Mathematical Sans-Serif Capital N
-0xead76b86, // U+1D5AE 𝖮, \sansO, Mathematical Sans-Serif Capital O
-0xead7ebc6, // U+1D5AF 𝖯, \sansP, Mathematical Sans-Serif Capital P
-0xead86c06, // U+1D5B0 𝖰, \sansQ, Mathematical Sans-Serif Capital Q
-0xead8ec46, // U+1D5B1 𝖱, \sansR, Mathematical Sans-Serif Capital R
-0xead96c86, // U+1D5B2 𝖲, \sansS, Mathematical Sans-Serif Capital S
-0xead9ecc6, // U+1D5B3 𝖳, \sansT, Mathematical Sans-Serif Capital T
-0xeada6d06, // U+1D5B4 𝖴, \sansU, Mathematical Sans-Serif Capital U
-0xeadaed46, // U+1D5B5 𝖵, \sansV, Mathematical Sans-Serif Capital V
-0xeadb6d86, // U+1D5B6 𝖶, \sansW, Mathematical Sans-Serif Capital W
-0xeadbedc6, // U+1D5B7 𝖷, \sansX, Mathematical Sans-Serif Capital X
-0xeadc6e06, // U+1D5B8 𝖸, \sansY, Mathematical Sans-Serif Capital Y
-0xeadcee46, // U+1D5B9 𝖹, \sansZ, Mathematical Sans-Serif Capital Z
-0xeadd6006, // U+1D5BA 𝖺, \sansa, Mathematical Sans-Serif Small A
-0xeadde046, // U+1D5BB 𝖻, \sansb, Mathematical Sans-Serif Small B
-0xeade6086, // U+1D5BC 𝖼, \sansc, Mathematical Sans-Serif Small C
-0xeadee0c6, // U+1D5BD 𝖽, \sansd, Mathematical Sans-Serif Small D
-0xeadf6106, // U+1D5BE 𝖾, \sanse, Mathematical Sans-Serif Small E
-0xebf534ca, // U+1D7EA 𝟪, \sanseight, Mathematical Sans-Serif Digit Eight
-0xeadfe146, // U+1D5BF 𝖿, \sansf, Mathematical Sans-Serif Small F
-0xebf39109, // U+1D7E7 𝟧, \sansfive, Mathematical Sans-Serif Digit Five
-0xebf30449, // U+1D7E6 𝟦, \sansfour, Mathematical Sans-Serif Digit Four
-0xeae06186, // U+1D5C0 𝗀, \sansg, Mathematical Sans-Serif Small G
-0xeae0e1c6, // U+1D5C1 𝗁, \sansh, Mathematical Sans-Serif Small H
-0xeae16206, // U+1D5C2 𝗂, \sansi, Mathematical Sans-Serif Small I
-0xeae1e246, // U+1D5C3 𝗃, \sansj, Mathematical Sans-Serif Small J
-0xeae26286, // U+1D5C4 𝗄, \sansk, Mathematical Sans-Serif Small K
-0xeae2e2c6, // U+1D5C5 𝗅, \sansl, Mathematical Sans-Serif Small L
-0xeae36306, // U+1D5C6 𝗆, \sansm, Mathematical Sans-Serif Small M
-0xeae3e346, // U+1D5C7 𝗇, \sansn, Mathematical Sans-Serif Small N
-0xebf59109, // U+1D7EB 𝟫, \sansnine, Mathematical Sans-Serif Digit Nine
-0xeae46386, // U+1D5C8 𝗈, \sanso, Mathematical Sans-Serif Small O
-0xebf19108, // U+1D7E3 𝟣, \sansone, Mathematical Sans-Serif Digit One
-0xeae4e3c6, // U+1D5C9 𝗉, \sansp, Mathematical Sans-Serif Small P
-0xeae56406, // U+1D5CA 𝗊, \sansq, Mathematical Sans-Serif Small Q
-0xeae5e446, // U+1D5CB 𝗋, \sansr, Mathematical Sans-Serif Small R
-0xeae66486, // U+1D5CC 𝗌, \sanss, Mathematical Sans-Serif Small S
-0xebf4834a, // U+1D7E9 𝟩, \sansseven, Mathematical Sans-Serif Digit Seven
-0xebf445c8, // U+1D7E8 𝟨, \sanssix, Mathematical Sans-Serif Digit Six
-0xeae6e4c6, // U+1D5CD 𝗍, \sanst, Mathematical Sans-Serif Small T
-0xebf2810a, // U+1D7E5 𝟥, \sansthree, Mathematical Sans-Serif Digit Three
-0xebf22388, // U+1D7E4 𝟤, \sanstwo, Mathematical Sans-Serif Digit Two
-0xeae76506, // U+1D5CE 𝗎, \sansu, Mathematical Sans-Serif Small U
-0xeae7e546, // U+1D5CF 𝗏, \sansv, Mathematical Sans-Serif Small V
-0xeae86586, // U+1D5D0 𝗐, \sansw, Mathematical Sans-Serif Small W
-0xeae8e5c6, // U+1D5D1 𝗑, \sansx, Mathematical Sans-Serif Small X
-0xeae96606, // U+1D5D2 𝗒, \sansy, Mathematical Sans-Serif Small Y
-0xeae9e646, // U+1D5D3 𝗓, \sansz, Mathematical Sans-Serif Small Z
-0xebf15389, // U+1D7E2 𝟢, \sanszero, Mathematical Sans-Serif Digit Zero
-0x13225347, // U+02644 ♄, \saturn, Saturn
-0x01955186, // U+0032A ̪, \sbbrg, Combining Bridge Below / Non-Spacing Bridge Below
-0x0169b446, // U+002D3 ˓, \sblhr, Modifier Letter Centred Left Half Ring / Modifier Letter Centered Left Half Ring
-0x01693446, // U+002D2 ˒, \sbrhr, Modifier Letter Centred Right Half Ring / Modifier Letter Centered Right Half Ring
-0x012ca006, // U+00259 ə, \schwa, Latin Small Letter Schwa
-0x1327c388, // U+0264F ♏, \scorpio, Scorpius
-0x150994c9, // U+02A13 ⨓, \scpolint, Line Integration With Semicircular Path Around Pole
-0xea4e5805, // U+1D49C 𝒜, \scrA, Mathematical Script Capital A
-0x10965845, // U+0212C ℬ, \scrB, Script Capital B / Script B
-0xea4f5885, // U+1D49E 𝒞, \scrC, Mathematical Script Capital C
-0xea4fd8c5, // U+1D49F 𝒟, \scrD, Mathematical Script Capital D
-0x10985905, // U+02130 ℰ, \scrE, Script Capital E / Script E
-0x1098d945, // U+02131 ℱ, \scrF, Script Capital F / Script F
-0xea515985, // U+1D4A2 𝒢, \scrG, Mathematical Script Capital G
-0x1085d9c5, // U+0210B ℋ, \scrH, Script Capital H / Script H
-0x10885a05, // U+02110 ℐ, \scrI, Script Capital I / Script I
-0xea52da45, // U+1D4A5 𝒥, \scrJ, Mathematical Script Capital J
-0xea535a85, // U+1D4A6 𝒦, \scrK, Mathematical Script Capital K
-0x10895ac5, // U+02112 ℒ, \scrL, Script Capital L / Script L
-0x1099db05, // U+02133 ℳ, \scrM, Script Capital M / Script M
-0xea54db45, // U+1D4A9 𝒩, \scrN, Mathematical Script Capital N
-0xea555b85, // U+1D4AA 𝒪, \scrO, Mathematical Script Capital O
-0xea55dbc5, // U+1D4AB 𝒫, \scrP, Mathematical Script Capital P
-0xea565c05, // U+1D4AC 𝒬, \scrQ, Mathematical Script Capital Q
-0x108ddc45, // U+0211B ℛ, \scrR, Script Capital R / Script R
-0xea575c85, // U+1D4AE 𝒮, \scrS, Mathematical Script Capital S
-0xea57dcc5, // U+1D4AF 𝒯, \scrT, Mathematical Script Capital T
-0xea585d05, // U+1D4B0 𝒰, \scrU, Mathematical Script Capital U
-0xea58dd45, // U+1D4B1 𝒱, \scrV, Mathematical Script Capital V
-0xea595d85, // U+1D4B2 𝒲, \scrW, Mathematical Script Capital W
-0xea59ddc5, // U+1D4B3 𝒳, \scrX, Mathematical Script Capital X
-0xea5a5e05, // U+1D4B4 𝒴, \scrY, Mathematical Script Capital Y
-0xea5ade45, // U+1D4B5 𝒵, \scrZ, Mathematical Script Capital Z
-0xea5b5005, // U+1D4B6 𝒶, \scra, Mathematical Script Small A
-0xea5bd045, // U+1D4B7 𝒷, \scrb, Mathematical Script Small B
-0xea5c5085, // U+1D4B8 𝒸, \scrc, Mathematical Script Small C
-0xea5cd0c5, // U+1D4B9 𝒹, \scrd, Mathematical Script Small D
-0x1097d105, // U+0212F ℯ, \scre, Script Small E
-0xea5dd145, // U+1D4BB 𝒻, \scrf, Mathematical Script Small F
-0x10855185, // U+0210A ℊ, \scrg, Script Small G
-0xea5ed1c5, // U+1D4BD 𝒽, \scrh, Mathematical Script Small H
-0xea5f5205, // U+1D4BE 𝒾, \scri, Mathematical Script Small I
-0xea5fd245, // U+1D4BF 𝒿, \scrj, Mathematical Script Small J
-0xea605285, // U+1D4C0 𝓀, \scrk, Mathematical Script Small K
-0xea60d2c5, // U+1D4C1 𝓁, \scrl, Mathematical Script Small L
-0xea615305, // U+1D4C2 𝓂, \scrm, Mathematical Script Small M
-0xea61d345, // U+1D4C3 𝓃, \scrn, Mathematical Script Small N
-0x109a5385, // U+02134 ℴ, \scro, Script Small O
-0xea62d3c5, // U+1D4C5 𝓅, \scrp, Mathematical Script Small P
-0xea635405, // U+1D4C6 𝓆, \scrq, Mathematical Script Small Q
-0xea63d445, // U+1D4C7 𝓇, \scrr, Mathematical Script Small R
-0xea645485, // U+1D4C8 𝓈, \scrs, Mathematical Script Small S
-0xea64d4c5, // U+1D4C9 𝓉, \scrt, Mathematical Script Small T
-0xea655505, // U+1D4CA 𝓊, \scru, Mathematical Script Small U
-0xea65d545, // U+1D4CB 𝓋, \scrv, Mathematical Script Small V
-0xea665585, // U+1D4CC 𝓌, \scrw, Mathematical Script Small W
-0xea66d5c5, // U+1D4CD 𝓍, \scrx, Mathematical Script Small X
-0xea675605, // U+1D4CE 𝓎, \scry, Mathematical Script Small Y
-0xea67d645, // U+1D4CF 𝓏, \scrz, Mathematical Script Small Z
-0x115882c7, // U+022B1 ⊱, \scurel, Succeeds Under Relation
-0x10cc2588, // U+02198 ↘, \searrow, South East Arrow / Lower Right Arrow
-0x1496a58c, // U+0292D ⤭, \seovnearrow, South East Arrow Crossing North East Arrow
-0x110b0489, // U+02216 ∖, \setminus, Set Minus
-0x1337d3c6, // U+0266F ♯, \sharp, Music Sharp Sign / Sharp
-0x14f17108, // U+029E2 ⧢, \shuffle, Shuffle Product
-0x01e18006, // U+003C3 σ, \sigma, Greek Small Letter Sigma
-0x111e4304, // U+0223C ∼, \sim, Tilde Operator
-0x11218406, // U+02243 ≃, \simeq, Asymptotically Equal To
-0x15502906, // U+02AA0 ⪠, \simgE, Similar Above Greater-Than Above Equals Sign
-0x154f7447, // U+02A9E ⪞, \simgtr, Similar Or Greater-Than
-0x15a4a591, // U+02B49 ⭉, \similarleftarrow, Tilde Operator Above Leftwards Arrow
-0x154ff906, // U+02A9F ⪟, \simlE, Similar Above Less-Than Above Equals Sign
-0x154ee488, // U+02A9D ⪝, \simless, Similar Or Less-Than
-0x1536430c, // U+02A6C ⩬, \simminussim, Similar Minus Similar
-0x15120488, // U+02A24 ⨤, \simplus, Plus Sign With Tilde Above
-0x1535f489, // U+02A6B ⩫, \simrdots, Tilde Operator With Rising Dots
-0x111f9109, // U+0223F ∿, \sinewave, Sine Wave
-0x12e114d7, // U+025C2 ◂, \smallblacktriangleleft, Black Left-Pointing Small Triangle / Black Left Pointing Small Triangle
-0x12dc34d8, // U+025B8 ▸, \smallblacktriangleright, Black Right-Pointing Small Triangle / Black Right Pointing Small Triangle
-0x11054348, // U+0220A ∊, \smallin, Small Element Of
-0x11069208, // U+0220D ∍, \smallni, Small Contains As Member
-0x12e194d2, // U+025C3 ◃, \smalltriangleleft, White Left-Pointing Small Triangle / White Left Pointing Small Triangle
-0x12dcb4d3, // U+025B9 ▹, \smalltriangleright, White Right-Pointing Small Triangle / White Right Pointing Small Triangle
-0x1519848b, // U+02A33 ⨳, \smashtimes, Smash Product
-0x159490cd, // U+02B29 ⬩, \smblkdiamond, Black Small Diamond
-0x1595210d, // U+02B2A ⬪, \smblklozenge, Black Small Lozenge
-0x12d5510c, // U+025AA ▪, \smblksquare, Black Small Square
-0x14f262c9, // U+029E4 ⧤, \smeparsl, Equals Sign And Slanted Parallel With Tilde Above
-0x1191f106, // U+02323 ⌣, \smile, Smile
-0x155504c4, // U+02AAA ⪪, \smt, Smaller Than
-0x15567105, // U+02AAC ⪬, \smte, Smaller Than Or Equal To
-0x15a9444c, // U+02B52 ⭒, \smwhitestar, White Small Star
-0x12f3710c, // U+025E6 ◦, \smwhtcircle, White Bullet
-0x1595a10d, // U+02B2B ⬫, \smwhtlozenge, White Small Lozenge
-0x12d5d10c, // U+025AB ▫, \smwhtsquare, White Small Square
-0x019b04c5, // U+00336 ̶, \sout, Combining Long Stroke Overlay / Non-Spacing Long Bar Overlay
-0x133044ca, // U+02660 ♠, \spadesuit, Black Spade Suit
-0x1111710f, // U+02222 ∢, \sphericalangle, Spherical Angle
-0x14d083d1, // U+029A1 ⦡, \sphericalangleup, Spherical Angle Opening Up
-0x1149c3c6, // U+02293 ⊓, \sqcap, Square Cap
-0x114a03c6, // U+02294 ⊔, \sqcup, Square Cup
-0x12f392c5, // U+025E7 ◧, \sqfl, Square With Left Half Black
-0x128c9586, // U+02519 ┙, \sqfnw, Box Drawings Up Light And Left Heavy / Forms Up Light And Left Heavy
-0x12f41445, // U+025E8 ◨, \sqfr, Square With Right Half Black
-0x12f56106, // U+025EA ◪, \sqfse, Square With Lower Right Diagonal Half Black
-0x1188a10a, // U+02311 ⌑, \sqlozenge, Square Lozenge
-0x150b14c7, // U+02A16 ⨖, \sqrint, Quaternion Integral Operator
-0x110d54c5, // U+0221A √, \sqrt, Square Root
-0x11dba30b, // U+023B7 ⎷, \sqrtbottom, Radical Symbol Bottom
-0x114784c9, // U+0228F ⊏, \sqsubset, Square Image Of
-0x1148840b, // U+02291 ⊑, \sqsubseteq, Square Image Of Or Equal To
-0x1172040c, // U+022E4 ⋤, \sqsubsetneq, Square Image Of Or Not Equal To
-0x114804c9, // U+02290 ⊐, \sqsupset, Square Original Of
-0x1149040b, // U+02292 ⊒, \sqsupseteq, Square Original Of Or Equal To
-0x1172840c, // U+022E5 ⋥, \sqsupsetneq, Square Original Of Or Not Equal To
-0x12d0d107, // U+025A1 □, \square, White Square
-0x1589e28f, // U+02B13 ⬓, \squarebotblack, Square With Bottom Half Black
-0x12d4f2d0, // U+025A9 ▩, \squarecrossfill, Square With Diagonal Crosshatch Fill
-0x12d272cc, // U+025A4 ▤, \squarehfill, Square With Horizontal Fill
-0x12d372cd, // U+025A6 ▦, \squarehvfill, Square With Orthogonal Crosshatch Fill
-0x158ae28e, // U+02B15 ⬕, \squarellblack, Square With Lower Left Diagonal Half Black
-0x12f8c0cd, // U+025F1 ◱, \squarellquad, White Square With Lower Left Quadrant
-0x12f940cd, // U+025F2 ◲, \squarelrquad, White Square With Lower Right Quadrant
-0x12d472cf, // U+025A8 ▨, \squareneswfill, Square With Upper Right To Lower Left Fill
-0x12d3f2cf, // U+025A7 ▧, \squarenwsefill, Square With Upper Left To Lower Right Fill
-0x1589628f, // U+02B12 ⬒, \squaretopblack, Square With Top Half Black
-0x12f4e28e, // U+025E9 ◩, \squareulblack, Square With Upper Left Diagonal Half Black
-0x12f840cd, // U+025F0 ◰, \squareulquad, White Square With Upper Left Quadrant
-0x158a628e, // U+02B14 ⬔, \squareurblack, Square With Upper Right Diagonal Half Black
-0x12f9c0cd, // U+025F3 ◳, \squareurquad, White Square With Upper Right Quadrant
-0x12d2f2cc, // U+025A5 ▥, \squarevfill, Square With Vertical Fill
-0x12d142c8, // U+025A2 ▢, \squoval, White Square With Rounded Corners
-0x006f8483, // U+000DF ß, \ss, Latin Small Letter Sharp S
-0x11634445, // U+022C6 ⋆, \star, Star Operator
-0x112dc2ca, // U+0225B ≛, \starequal, Star Equals
-0x00519189, // U+000A3 £, \sterling, Pound Sign
-0x019b6107, // U+00336 ̶, \strike, Combining Long Stroke Overlay / Non-Spacing Long Bar Overlay
-0x11f21486, // U+023E4 ⏤, \strns, Straightness
-0x1561a4c8, // U+02AC3 ⫃, \subedot, Subset Of Or Equal To With Dot Above
-0x1560f4c8, // U+02AC1 ⫁, \submult, Subset With Multiplication Sign Below
-0x114104c7, // U+02282 ⊂, \subset, Subset Of
-0x1564a5cd, // U+02AC9 ⫉, \subsetapprox, Subset Of Above Almost Equal To
-0x155ea4ca, // U+02ABD ⪽, \subsetdot, Subset With Dot
-0x11430409, // U+02286 ⊆, \subseteq, Subset Of Or Equal To
-0x1562c40a, // U+02AC5 ⫅, \subseteqq, Subset Of Above Equals Sign
-0x1145040a, // U+0228A ⊊, \subsetneq, Subset Of With Not Equal To / Subset Of Or Not Equal To
-0x1565c40b, // U+02ACB ⫋, \subsetneqq, Subset Of Above Not Equal To
-0x155f848b, // U+02ABF ⪿, \subsetplus, Subset With Plus Sign Below
-0x1563c307, // U+02AC7 ⫇, \subsim, Subset Of Above Tilde Operator
-0x156a8047, // U+02AD5 ⫕, \subsub, Subset Above Subset
-0x156983c7, // U+02AD3 ⫓, \subsup, Subset Above Superset
-0x113de085, // U+0227B ≻, \succ, Succeeds
-0x155c25cb, // U+02AB8 ⪸, \succapprox, Succeeds Above Almost Equal To
-0x113e840c, // U+0227D ≽, \succcurlyeq, Succeeds Or Equal To
-0x15580407, // U+02AB0 ⪰, \succeq, Succeeds Above Single-Line Equals Sign
-0x155a4408, // U+02AB4 ⪴, \succeqq, Succeeds Above Equals Sign
-0x155d25cc, // U+02ABA ⪺, \succnapprox, Succeeds Above Not Almost Equal To
-0x15590408, // U+02AB2 ⪲, \succneq, Succeeds Above Single-Line Not Equal To
-0x155b4409, // U+02AB6 ⪶, \succneqq, Succeeds Above Not Equal To
-0x1174c309, // U+022E9 ⋩, \succnsim, Succeeds But Not Equivalent To
-0x113fc308, // U+0227F ≿, \succsim, Succeeds Or Equivalent To
-0x11088304, // U+02211 ∑, \sum, N-Ary Summation
-0x150594c7, // U+02A0B ⨋, \sumint, Summation With Integral
-0x131e0344, // U+0263C ☼, \sun, White Sun With Rays
-0x156c0048, // U+02AD8 ⫘, \supdsub, Superset Beside And Joined By Dash With Subset
-0x156224c8, // U+02AC4 ⫄, \supedot, Superset Of Or Equal To With Dot Above
-0x13e4a2c8, // U+027C9 ⟉, \suphsol, Superset Preceding Solidus
-0x156b8048, // U+02AD7 ⫗, \suphsub, Superset Beside Subset
-0x156174c8, // U+02AC2 ⫂, \supmult, Superset With Multiplication Sign Below
-0x114184c7, // U+02283 ⊃, \supset, Superset Of
-0x156525cd, // U+02ACA ⫊, \supsetapprox, Superset Of Above Almost Equal To
-0x155f24ca, // U+02ABE ⪾, \supsetdot, Superset With Dot
-0x11438409, // U+02287 ⊇, \supseteq, Superset Of Or Equal To
-0x1563440a, // U+02AC6 ⫆, \supseteqq, Superset Of Above Equals Sign
-0x1145840a, // U+0228B ⊋, \supsetneq, Superset Of With Not Equal To / Superset Of Or Not Equal To
-0x1566440b, // U+02ACC ⫌, \supsetneqq, Superset Of Above Not Equal To
-0x1560048b, // U+02AC0 ⫀, \supsetplus, Superset With Plus Sign Below
-0x15644307, // U+02AC8 ⫈, \supsim, Superset Of Above Tilde Operator
-0x156a0047, // U+02AD4 ⫔, \supsub, Superset Above Subset
-0x156b03c7, // U+02AD6 ⫖, \supsup, Superset Above Superset
-0x110d50c5, // U+0221A √, \surd, Square Root
-0x10cca588, // U+02199 ↙, \swarrow, South West Arrow / Lower Left Arrow
-0x01e24504, // U+003C4 τ, \tau, Greek Small Letter Tau
-0x13248487, // U+02649 ♉, \taurus, Taurus
-0x157b22c6, // U+02AF6 ⫶, \tdcol, Triple Colon Operator
-0x0153e1c5, // U+002A7 ʧ, \tesh, Latin Small Letter Tesh Digraph / Latin Small Letter T Esh
-0x007f01c3, // U+000FE þ, \th, Latin Small Letter Thorn
-0x111a510a, // U+02234 ∴, \therefore, Therefore
-0x01dc7006, // U+003B8 θ, \theta, Greek Small Letter Theta
-0x1002e10b, // U+02005  , \thickspace, Four-Per-Em Space
-0x1004e10a, // U+02009  , \thinspace, Thin Space
-0x13e0710c, // U+027C0 ⟀, \threedangle, Three Dimensional Angle
-0x107424ce, // U+020E8 ⃨, \threeunderdot, Combining Triple Underdot
-0x102044ca, // U+02040 ⁀, \tieconcat, Character Tie
-0x0181f106, // U+00303 ̃, \tilde, Combining Tilde / Non-Spacing Tilde
-0x016e2589, // U+002DC ˜, \tildelow, Small Tilde / Spacing Tilde
-0x1125b2ca, // U+0224B ≋, \tildetrpl, Triple Tilde
-0x006b8486, // U+000D7 ×, \times, Multiplication Sign
-0x1518c449, // U+02A31 ⨱, \timesbar, Multiplication Sign With Underbar
-0x10c90383, // U+02192 →, \to, Rightwards Arrow / Right Arrow
-0x14940005, // U+02928 ⤨, \toea, North East Arrow And South East Arrow
-0x14939005, // U+02927 ⤧, \tona, North West Arrow And North East Arrow
-0x115223c4, // U+022A4 ⊤, \top, Down Tack
-0x119b24c7, // U+02336 ⌶, \topbot, Apl Functional Symbol I-Beam
-0x12f0710e, // U+025E0 ◠, \topsemicircle, Upper Half Circle
-0x1494e005, // U+02929 ⤩, \tosa, South East Arrow And South West Arrow
-0x14952005, // U+0292A ⤪, \towa, South West Arrow And North West Arrow
-0x1091528a, // U+02122 ™, \trademark, Trade Mark Sign / Trademark
-0x11f1030a, // U+023E2 ⏢, \trapezium, White Trapezium
-0x12f624cd, // U+025EC ◬, \trianglecdot, White Up-Pointing Triangle With Dot / White Up Pointing Triangle With Dot
-0x12dfa34d, // U+025BF ▿, \triangledown, White Down-Pointing Small Triangle / White Down Pointing Small Triangle
-0x12e094cd, // U+025C1 ◁, \triangleleft, White Left-Pointing Triangle / White Left Pointing Triangle
-0x12f6e292, // U+025ED ◭, \triangleleftblack, Up-Pointing Triangle With Left Half Black / Up Pointing Triangle With Left Half Black
-0x115a040f, // U+022B4 ⊴, \trianglelefteq, Normal Subgroup Of Or Equal To
-0x151d048e, // U+02A3A ⨺, \triangleminus, Minus Sign In Triangle
-0x151c848d, // U+02A39 ⨹, \triangleplus, Plus Sign In Triangle
-0x112e040a, // U+0225C ≜, \triangleq, Delta Equal To
-0x12dbb4ce, // U+025B7 ▷, \triangleright, White Right-Pointing Triangle / White Right Pointing Triangle
-0x12f76293, // U+025EE ◮, \trianglerightblack, Up-Pointing Triangle With Right Half Black / Up Pointing Triangle With Right Half Black
-0x115a8410, // U+022B5 ⊵, \trianglerighteq, Contains As Normal Subgroup Or Equal To
-0x151d848e, // U+02A3B ⨻, \triangletimes, Multiplication Sign In Triangle
-0x102ea349, // U+0205D ⁝, \tricolon, Tricolon
-0x14fd848b, // U+029FB ⧻, \tripleplus, Triple Plus
-0x01281005, // U+00250 ɐ, \trna, Latin Small Letter Turned A
-0x013291c5, // U+00265 ɥ, \trnh, Latin Small Letter Turned H
-0x01379305, // U+0026F ɯ, \trnm, Latin Small Letter Turned M
-0x01387447, // U+00270 ɰ, \trnmlr, Latin Small Letter Turned M With Long Leg
-0x013c9445, // U+00279 ɹ, \trnr, Latin Small Letter Turned R
-0x013d52c6, // U+0027A ɺ, \trnrl, Latin Small Letter Turned R With Long Leg
-0x01296006, // U+00252 ɒ, \trnsa, Latin Small Letter Turned Alpha / Latin Small Letter Turned Script A
-0x014394c5, // U+00287 ʇ, \trnt, Latin Small Letter Turned T
-0x01471605, // U+0028E ʎ, \trny, Latin Small Letter Turned Y
-0xeb387804, // U+1D670 𝙰, \ttA, Mathematical Monospace Capital A
-0xeb38f844, // U+1D671 𝙱, \ttB, Mathematical Monospace Capital B
-0xeb397884, // U+1D672 𝙲, \ttC, Mathematical Monospace Capital C
-0xeb39f8c4, // U+1D673 𝙳, \ttD, Mathematical Monospace Capital D
-0xeb3a7904, // U+1D674 𝙴, \ttE, Mathematical Monospace Capital E
-0xeb3af944, // U+1D675 𝙵, \ttF, Mathematical Monospace Capital F
-0xeb3b7984, // U+1D676 𝙶, \ttG, Mathematical Monospace Capital G
-0xeb3bf9c4, // U+1D677 𝙷, \ttH, Mathematical Monospace Capital H
-0xeb3c7a04, // U+1D678 𝙸, \ttI, Mathematical Monospace Capital I
-0xeb3cfa44, // U+1D679 𝙹, \ttJ, Mathematical Monospace Capital J
-0xeb3d7a84, // U+1D67A 𝙺, \ttK, Mathematical Monospace Capital K
-0xeb3dfac4, // U+1D67B 𝙻, \ttL, Mathematical Monospace Capital L
-0xeb3e7b04, // U+1D67C 𝙼, \ttM, Mathematical Monospace Capital M
-0xeb3efb44, // U+1D67D 𝙽, \ttN, Mathematical Monospace Capital N
-0xeb3f7b84, // U+1D67E 𝙾, \ttO, Mathematical Monospace Capital O
-0xeb3ffbc4, // U+1D67F 𝙿, \ttP, Mathematical Monospace Capital P
-0xeb407c04, // U+1D680 𝚀, \ttQ, Mathematical Monospace Capital Q
-0xeb40fc44, // U+1D681 𝚁, \ttR, Mathematical Monospace Capital R
-0xeb417c84, // U+1D682 𝚂, \ttS, Mathematical Monospace Capital S
-0xeb41fcc4, // U+1D683 𝚃, \ttT, Mathematical Monospace Capital T
-0xeb427d04, // U+1D684 𝚄, \ttU, Mathematical Monospace Capital U
-0xeb42fd44, // U+1D685 𝚅, \ttV, Mathematical Monospace Capital V
-0xeb437d84, // U+1D686 𝚆, \ttW, Mathematical Monospace Capital W
-0xeb43fdc4, // U+1D687 𝚇, \ttX, Mathematical Monospace Capital X
-0xeb447e04, // U+1D688 𝚈, \ttY, Mathematical Monospace Capital Y
-0xeb44fe44, // U+1D689 𝚉, \ttZ, Mathematical Monospace Capital Z
-0xeb457004, // U+1D68A 𝚊, \tta, Mathematical Monospace Small A
-0xeb45f044, // U+1D68B 𝚋, \ttb, Mathematical Monospace Small B
-0xeb467084, // U+1D68C 𝚌, \ttc, Mathematical Monospace Small C
-0xeb46f0c4, // U+1D68D 𝚍, \ttd, Mathematical Monospace Small D
-0xeb477104, // U+1D68E 𝚎, \tte, Mathematical Monospace Small E
-0xebff34c8, // U+1D7FE 𝟾, \tteight, Mathematical Monospace Digit Eight
-0xeb47f144, // U+1D68F 𝚏, \ttf, Mathematical Monospace Small F
-0xebfd9107, // U+1D7FB 𝟻, \ttfive, Mathematical Monospace Digit Five
-0xebfd0447, // U+1D7FA 𝟺, \ttfour, Mathematical Monospace Digit Four
-0xeb487184, // U+1D690 𝚐, \ttg, Mathematical Monospace Small G
-0xeb48f1c4, // U+1D691 𝚑, \tth, Mathematical Monospace Small H
-0xeb497204, // U+1D692 𝚒, \tti, Mathematical Monospace Small I
-0xeb49f244, // U+1D693 𝚓, \ttj, Mathematical Monospace Small J
-0xeb4a7284, // U+1D694 𝚔, \ttk, Mathematical Monospace Small K
-0xeb4af2c4, // U+1D695 𝚕, \ttl, Mathematical Monospace Small L
-0xeb4b7304, // U+1D696 𝚖, \ttm, Mathematical Monospace Small M
-0xeb4bf344, // U+1D697 𝚗, \ttn, Mathematical Monospace Small N
-0xebff9107, // U+1D7FF 𝟿, \ttnine, Mathematical Monospace Digit Nine
-0xeb4c7384, // U+1D698 𝚘, \tto, Mathematical Monospace Small O
-0xebfb9106, // U+1D7F7 𝟷, \ttone, Mathematical Monospace Digit One
-0xeb4cf3c4, // U+1D699 𝚙, \ttp, Mathematical Monospace Small P
-0xeb4d7404, // U+1D69A 𝚚, \ttq, Mathematical Monospace Small Q
-0xeb4df444, // U+1D69B 𝚛, \ttr, Mathematical Monospace Small R
-0xeb4e7484, // U+1D69C 𝚜, \tts, Mathematical Monospace Small S
-0xebfe8348, // U+1D7FD 𝟽, \ttseven, Mathematical Monospace Digit Seven
-0xebfe45c6, // U+1D7FC 𝟼, \ttsix, Mathematical Monospace Digit Six
-0xeb4ef4c4, // U+1D69D 𝚝, \ttt, Mathematical Monospace Small T
-0xebfc8108, // U+1D7F9 𝟹, \ttthree, Mathematical Monospace Digit Three
-0xebfc2386, // U+1D7F8 𝟸, \tttwo, Mathematical Monospace Digit Two
-0xeb4f7504, // U+1D69E 𝚞, \ttu, Mathematical Monospace Small U
-0xeb4ff544, // U+1D69F 𝚟, \ttv, Mathematical Monospace Small V
-0xeb507584, // U+1D6A0 𝚠, \ttw, Mathematical Monospace Small W
-0xeb50f5c4, // U+1D6A1 𝚡, \ttx, Mathematical Monospace Small X
-0xeb517604, // U+1D6A2 𝚢, \tty, Mathematical Monospace Small Y
-0xeb51f644, // U+1D6A3 𝚣, \ttz, Mathematical Monospace Small Z
-0xebfb5387, // U+1D7F6 𝟶, \ttzero, Mathematical Monospace Digit Zero
-0x14d1710a, // U+029A2 ⦢, \turnangle, Turned Angle
-0x1094f00b, // U+02129 ℩, \turnediota, Turned Greek Small Letter Iota
-0x118ca4ca, // U+02319 ⌙, \turnednot, Turned Not Sign
-0x014f1286, // U+0029E ʞ, \turnk, Latin Small Letter Turned K
-0x1525b488, // U+02A4B ⩋, \twocaps, Intersection Beside And Joined With Intersection
-0x15253488, // U+02A4A ⩊, \twocups, Union Beside And Joined With Union
-0x10d0a591, // U+021A1 ↡, \twoheaddownarrow, Downwards Two Headed Arrow / Down Two Headed Arrow
-0x10cf2591, // U+0219E ↞, \twoheadleftarrow, Leftwards Two Headed Arrow / Left Two Headed Arrow
-0x159dc2d5, // U+02B3B ⬻, \twoheadleftarrowtail, Leftwards Two-Headed Arrow With Tail
-0x159ba594, // U+02B37 ⬷, \twoheadleftdbkarrow, Leftwards Two-Headed Triple Dash Arrow
-0x159b2310, // U+02B36 ⬶, \twoheadmapsfrom, Leftwards Two-Headed Arrow From Bar
-0x1482f38e, // U+02905 ⤅, \twoheadmapsto, Rightwards Two-Headed Arrow From Bar
-0x10d02592, // U+021A0 ↠, \twoheadrightarrow, Rightwards Two Headed Arrow / Right Two Headed Arrow
-0x148b42d6, // U+02916 ⤖, \twoheadrightarrowtail, Rightwards Two-Headed Arrow With Tail
-0x10cfa58f, // U+0219F ↟, \twoheaduparrow, Upwards Two Headed Arrow / Up Two Headed Arrow
-0x14a4f115, // U+02949 ⥉, \twoheaduparrowcircle, Upwards Two-Headed Arrow From Small Circle
-0x13358489, // U+0266B ♫, \twonotes, Beamed Eighth Notes / Barred Eighth Notes
-0x016c0502, // U+002D8 ˘, \u, Breve / Spacing Breve
-0x12ee5086, // U+025DC ◜, \ularc, Upper Left Quadrant Circular Arc
-0x12f27110, // U+025E4 ◤, \ulblacktriangle, Black Upper Left Triangle
-0x118e0449, // U+0231C ⌜, \ulcorner, Top Left Corner
-0x12fc710b, // U+025F8 ◸, \ultriangle, Upper Left Triangle
-0x15208487, // U+02A41 ⩁, \uminus, Union With Minus Sign
-0x01994449, // U+00332 ̲, \underbar, Combining Low Line / Non-Spacing Underscore
-0x11efe10b, // U+023DF ⏟, \underbrace, Bottom Curly Bracket
-0x11da84cd, // U+023B5 ⎵, \underbracket, Bottom Square Bracket
-0x1077258f, // U+020EE ⃮, \underleftarrow, Combining Left Arrow Below
-0x1076a355, // U+020ED ⃭, \underleftharpoondown, Combining Leftwards Harpoon With Barb Downwards
-0x01a6a594, // U+0034D ͍, \underleftrightarrow, Combining Left Right Arrow Below
-0x1077a590, // U+020EF ⃯, \underrightarrow, Combining Right Arrow Below
-0x10762356, // U+020EC ⃬, \underrightharpoondown, Combining Rightwards Harpoon With Barb Downwards
-0x01ce0505, // U+0039C Μ, \upMu, Greek Capital Letter Mu
-0x01ce9505, // U+0039D Ν, \upNu, Greek Capital Letter Nu
-0x01cfa34a, // U+0039F Ο, \upOmicron, Greek Capital Letter Omicron
-0x10a590c6, // U+0214B ⅋, \upand, Turned Ampersand
-0x10c8a588, // U+02191 ↑, \uparrow, Upwards Arrow / Up Arrow
-0x148480ce, // U+02909 ⤉, \uparrowbarred, Upwards Arrow With Horizontal Stroke
-0x10f0a58c, // U+021E1 ⇡, \updasharrow, Upwards Dashed Arrow / Up Dashed Arrow
-0x10caa58c, // U+02195 ↕, \updownarrow, Up Down Arrow
-0x10d4444f, // U+021A8 ↨, \updownarrowbar, Up Down Arrow With Base
-0x14a6b4d7, // U+0294D ⥍, \updownharpoonleftright, Up Barb Left Down Barb Right Harpoon
-0x14a614d7, // U+0294C ⥌, \updownharpoonrightleft, Up Barb Right Down Barb Left Harpoon
-0x01daa34a, // U+003B5 ε, \upepsilon, Greek Small Letter Epsilon
-0x10df94ce, // U+021BF ↿, \upharpoonleft, Upwards Harpoon With Barb Leftwards / Up Harpoon With Barb Left
-0x10df34cf, // U+021BE ↾, \upharpoonright, Upwards Harpoon With Barb Rightwards / Up Harpoon With Barb Right
-0x14b1b4d4, // U+02963 ⥣, \upharpoonsleftright, Upwards Harpoon With Barb Left Beside Upwards Harpoon With Barb Right
-0x13e94345, // U+027D2 ⟒, \upin, Element Of Opening Upwards
-0x150d94c6, // U+02A1B ⨛, \upint, Integral With Overbar
-0x01efb008, // U+003DF ϟ, \upkoppa, Greek Small Letter Koppa
-0x11470486, // U+0228E ⊎, \uplus, Multiset Union
-0x01ec300b, // U+003D8 Ϙ, \upoldKoppa, Greek Letter Archaic Koppa
-0x01ecb00b, // U+003D9 ϙ, \upoldkoppa, Greek Small Letter Archaic Koppa
-0x01dfa34a, // U+003BF ο, \upomicron, Greek Small Letter Omicron
-0x01f0b208, // U+003E1 ϡ, \upsampi, Greek Small Letter Sampi
-0x01e2a348, // U+003C5 υ, \upsilon, Greek Small Letter Upsilon
-0x01ed8009, // U+003DB ϛ, \upstigma, Greek Small Letter Stigma
-0x10e4248b, // U+021C8 ⇈, \upuparrows, Upwards Paired Arrows / Up Paired Arrows
-0x1575e1c8, // U+02AEB ⫫, \upvDash, Double Up Tack
-0x01e8700a, // U+003D0 ϐ, \upvarbeta, Greek Beta Symbol / Greek Small Letter Curled Beta
-0x10f3a58d, // U+021E7 ⇧, \upwhitearrow, Upwards White Arrow / White Up Arrow
-0x13228487, // U+02645 ♅, \uranus, Uranus
-0x12eed086, // U+025DD ◝, \urarc, Upper Right Quadrant Circular Arc
-0x12f2f110, // U+025E5 ◥, \urblacktriangle, Black Upper Right Triangle
-0x118e8449, // U+0231D ⌝, \urcorner, Top Right Corner
-0x12fcf10b, // U+025F9 ◹, \urtriangle, Upper Right Triangle
-0x115461c6, // U+022A8 ⊨, \vDash, True
-0x01fa7009, // U+003F4 ϴ, \varTheta, Greek Capital Theta Symbol
-0x1182a10c, // U+02305 ⌅, \varbarwedge, Projective
-0x11e75352, // U+023CE ⏎, \varcarriagereturn, Return Symbol
-0x1333c4cc, // U+02667 ♧, \varclubsuit, White Club Suit
-0x133344cf, // U+02666 ♦, \vardiamondsuit, Black Diamond Suit
-0x11832112, // U+02306 ⌆, \vardoublebarwedge, Perspective
-0x01daa34b, // U+003B5 ε, \varepsilon, Greek Small Letter Epsilon
-0x1332c4cd, // U+02665 ♥, \varheartsuit, Black Heart Suit
-0x1590a34b, // U+02B21 ⬡, \varhexagon, White Hexagon
-0x15916290, // U+02B22 ⬢, \varhexagonblack, Black Hexagon
-0x11967492, // U+0232C ⌬, \varhexagonlrbonds, Benzene Ring
-0x117b444c, // U+022F6 ⋶, \varisinobar, Element Of With Overbar
-0x11799489, // U+022F3 ⋳, \varisins, Element Of With Vertical Bar At End Of Horizontal Stroke
-0x01f83009, // U+003F0 ϰ, \varkappa, Greek Kappa Symbol / Greek Small Letter Script Kappa
-0x115ff10e, // U+022BF ⊿, \varlrtriangle, Right Triangle
-0x117ec44a, // U+022FD ⋽, \varniobar, Contains With Overbar
-0x117dc487, // U+022FB ⋻, \varnis, Contains With Vertical Bar At End Of Horizontal Stroke
-0x1102918b, // U+02205 ∅, \varnothing, Empty Set
-0x11196111, // U+02232 ∲, \varointclockwise, Clockwise Contour Integral
-0x01e33207, // U+003C6 φ, \varphi, Greek Small Letter Phi
-0x01eb3206, // U+003D6 ϖ, \varpi, Greek Pi Symbol / Greek Small Letter Omega Pi
-0x01f8b387, // U+003F1 ϱ, \varrho, Greek Rho Symbol / Greek Small Letter Tailed Rho
-0x01e10009, // U+003C2 ς, \varsigma, Greek Small Letter Final Sigma
-0x133244cd, // U+02664 ♤, \varspadesuit, White Spade Suit
-0x139b4448, // U+02736 ✶, \varstar, Six Pointed Black Star
-0x0004c40e, // U+00009 ⊊︀, \varsubsetneqq, Subset Of With Not Equal To / Subset Of Or Not Equal To + Variation Selector-1
-0x0005040d, // U+0000A ⊋︀, \varsupsetneq, Superset Of With Not Equal To / Superset Of Or Not Equal To + Variation Selector-1
-0x01e8f009, // U+003D1 ϑ, \vartheta, Greek Theta Symbol / Greek Small Letter Script Theta
-0x12daf10c, // U+025B5 ▵, \vartriangle, White Up-Pointing Small Triangle / White Up Pointing Small Triangle
-0x115914d0, // U+022B2 ⊲, \vartriangleleft, Normal Subgroup Of
-0x1159b4d1, // U+022B3 ⊳, \vartriangleright, Contains As Normal Subgroup
-0x1530c44a, // U+02A61 ⩡, \varveebar, Small Vee With Underbar
-0x115161c6, // U+022A2 ⊢, \vdash, Right Tack
-0x11777486, // U+022EE ⋮, \vdots, Vertical Ellipsis
-0x106b8084, // U+020D7 ⃗, \vec, Combining Right Arrow Above / Non-Spacing Right Arrow Above
-0x11140104, // U+02228 ∨, \vee, Logical Or
-0x115dc447, // U+022BB ⊻, \veebar, Xor
-0x13e3a4c7, // U+027C7 ⟇, \veedot, Or With Dot Inside
-0x1531c44d, // U+02A63 ⩣, \veedoublebar, Logical Or With Double Underbar
-0x112d0406, // U+0225A ≚, \veeeq, Equiangular To
-0x152dd4cb, // U+02A5B ⩛, \veemidvert, Logical Or With Middle Stem
-0x152924c8, // U+02A52 ⩒, \veeodot, Logical Or With Dot Above
-0x13200486, // U+02640 ♀, \venus, Female Sign
-0x01667206, // U+002CC ˌ, \verti, Modifier Letter Low Vertical Line
-0x1069460c, // U+020D2 ⃒, \vertoverlay, Combining Long Vertical Line Overlay / Non-Spacing Long Vertical Bar Overlay
-0x01647486, // U+002C8 ˈ, \verts, Modifier Letter Vertical Line
-0x116c648d, // U+022D8 ⋘, \verymuchless, Very Much Less-Than / Very Much Less Than
-0x118bf009, // U+02317 ⌗, \viewdata, Viewdata Square
-0x1326a386, // U+0264D ♍, \virgo, Virgo
-0x1211e10d, // U+02423 ␣, \visiblespace, Open Box
-0x12d76290, // U+025AE ▮, \vrectangleblack, Black Vertical Rectangle
-0x12d7f387, // U+025AF ▯, \vrecto, White Vertical Rectangle
-0x110cf10e, // U+02219 ∙, \vysmblkcircle, Bullet Operator
-0x158ed10e, // U+02B1D ⬝, \vysmblksquare, Black Very Small Square
-0x158f510e, // U+02B1E ⬞, \vysmwhtsquare, White Very Small Square
-0x1113a106, // U+02227 ∧, \wedge, Logical And
-0x13e8a4c9, // U+027D1 ⟑, \wedgedot, And With Dot
-0x1530444f, // U+02A60 ⩠, \wedgedoublebar, Logical And With Double Underbar
-0x152d54cd, // U+02A5A ⩚, \wedgemidvert, Logical And With Middle Stem
-0x1528a4ca, // U+02A51 ⩑, \wedgeodot, Logical And With Dot Above
-0x152aa10d, // U+02A55 ⩕, \wedgeonwedge, Two Intersecting Logical And
-0x112c8407, // U+02259 ≙, \wedgeq, Estimates
-0x10f54454, // U+021EA ⇪, \whitearrowupfrombar, Upwards White Arrow From Bar / White Up Arrow From Bar
-0x13e0f115, // U+027C1 ⟁, \whiteinwhitetriangle, White Triangle Containing Small White Triangle
-0x12e294d1, // U+025C5 ◅, \whitepointerleft, White Left-Pointing Pointer / White Left Pointing Pointer
-0x12ddb4d2, // U+025BB ▻, \whitepointerright, White Right-Pointing Pointer / White Right Pointing Pointer
-0x1596c2cc, // U+02B2D ⬭, \whthorzoval, White Horizontal Ellipse
-0x1597c2cc, // U+02B2F ⬯, \whtvertoval, White Vertical Ellipse
-0x14d3234e, // U+029A6 ⦦, \wideangledown, Oblique Angle Opening Up
-0x14d383cc, // U+029A7 ⦧, \wideangleup, Oblique Angle Opening Down
-0x10749110, // U+020E9 ⃩, \widebridgeabove, Combining Wide Bridge Above
-0x0198710b, // U+00330 ̰, \wideutilde, Combining Tilde Below / Non-Spacing Tilde Below
-0x108c03c3, // U+02118 ℘, \wp, Script Capital P / Script P
-0x11200443, // U+02240 ≀, \wr, Wreath Product
-0x01df0203, // U+003BE ξ, \xi, Greek Small Letter Xi
-0x115da444, // U+022BB ⊻, \xor, Xor
-0x108f44c5, // U+0211E ℞, \xrat, Prescription Take
-0x00528344, // U+000A5 ¥, \yen, Yen Sign
-0x014921c5, // U+00292 ʒ, \yogh, Latin Small Letter Ezh / Latin Small Letter Yogh
-0x01db7005, // U+003B6 ζ, \zeta, Greek Small Letter Zeta
+{0x730b, 0x45e7, 0x22E5}, // ⋥, \sqsupsetneq, Square Original Of Or Not Equal To
+{0x6207, 0x13d0, 0xDE5E'D835}, // U+1D65E, 𝙞, \bisansi, Mathematical Sans-Serif Bold Italic Small I
+{0x6f0f, 0x3ad3, 0x27E6}, // ⟦, \openbracketleft, Mathematical Left White Square Bracket
+{0x6205, 0x1df6, 0xDD03'D835}, // U+1D503, 𝔃, \bscrz, Mathematical Bold Script Small Z
+{0x6c12, 0x3022, 0x2962}, // ⥢, \leftharpoonsupdown, Leftwards Harpoon With Barb Up Above Leftwards Harpoon With Barb Down
+{0x6906, 0x2b96, 0xDE2F'D835}, // U+1D62F, 𝘯, \isansn, Mathematical Sans-Serif Italic Small N
+{0x3503, 0x0049, 0x215D}, // ⅝, \5/8, Vulgar Fraction Five Eighths / Fraction Five Eighths
+{0x6203, 0x0b2c, 0xDC16'D835}, // U+1D416, 𝐖, \bfW, Mathematical Bold Capital W
+{0x4303, 0x0096, 0x22D3}, // ⋓, \Cup, Double Union
+{0x5f05, 0x06ca, 0x1D66}, // ᵦ, \_beta, Greek Subscript Small Letter Beta
+{0x7213, 0x3fa8, 0x2968}, // ⥨, \rightleftharpoonsup, Rightwards Harpoon With Barb Up Above Leftwards Harpoon With Barb Up
+{0x730c, 0x4806, 0x2ACA}, // ⫊, \supsetapprox, Superset Of Above Almost Equal To
+{0x5210, 0x0431, 0x29D0}, // ⧐, \RightTriangleBar, Vertical Bar Beside Right Triangle
+{0x6c04, 0x3197, 0x2266}, // ≦, \leqq, Less-Than Over Equal To / Less Than Over Equal To
+{0x620c, 0x1b56, 0xDF7E'D835}, // U+1D77E, 𝝾, \bsansomicron, Mathematical Sans-Serif Bold Small Omicron
+{0x6205, 0x1159, 0xDF46'D835}, // U+1D746, 𝝆, \birho, Mathematical Bold Italic Small Rho
+{0x7008, 0x3cbd, 0x2A15}, // ⨕, \pointint, Integral Around A Point Operator
+{0x5305, 0x04c1, 0x03E0}, // Ϡ, \Sampi, Greek Letter Sampi / Greek Capital Letter Sampi
+{0x4105, 0x0061, 0x299C}, // ⦜, \Angle, Right Angle Variant With Square
+{0x7304, 0x43a2, 0xDCC7'D835}, // U+1D4C7, 𝓇, \scrr, Mathematical Script Small R
+{0x7008, 0x3d28, 0x2AB5}, // ⪵, \precneqq, Precedes Above Not Equal To
+{0x6c0b, 0x322f, 0x25EF}, // ◯, \lgwhtcircle, Large Circle
+{0x6203, 0x09d7, 0xDD65'D835}, // U+1D565, 𝕥, \bbt, Mathematical Double-Struck Small T
+{0x6206, 0x09bc, 0x2A1F}, // ⨟, \bbsemi, Z Notation Schema Composition
+{0x6907, 0x2ca8, 0xDEFA'D835}, // U+1D6FA, 𝛺, \itOmega, Mathematical Italic Capital Omega
+{0x650b, 0x2583, 0x2A95}, // ⪕, \eqslantless, Slanted Equal To Or Less-Than
+{0x660a, 0x2660, 0x221C}, // ∜, \fourthroot, Fourth Root
+{0x620d, 0x1456, 0xDFB8'D835}, // U+1D7B8, 𝞸, \bisansomicron, Mathematical Sans-Serif Bold Italic Small Omicron
+{0x6e12, 0x36b4, 0x2B35}, // ⬵, \nVtwoheadleftarrow, Leftwards Two-Headed Arrow With Double Vertical Stroke
+{0x7403, 0x4a8d, 0xDE87'D835}, // U+1D687, 𝚇, \ttX, Mathematical Monospace Capital X
+{0x7012, 0x3bd7, 0x25B0}, // ▰, \parallelogramblack, Black Parallelogram
+{0x7004, 0x3bbb, 0x0321}, // ̡, \palh, Combining Palatalized Hook Below / Non-Spacing Palatalized Hook Below
+{0x720a, 0x3e56, 0x2192}, // →, \rightarrow, Rightwards Arrow / Right Arrow
+{0x6206, 0x0d53, 0xDD92'D835}, // U+1D592, 𝖒, \bfrakm, Mathematical Bold Fraktur Small M
+{0x620a, 0x19c4, 0xDF68'D835}, // U+1D768, 𝝨, \bsansSigma, Mathematical Sans-Serif Bold Capital Sigma
+{0x700d, 0x3bc9, 0x25B1}, // ▱, \parallelogram, White Parallelogram
+{0x6203, 0x0efa, 0xDC74'D835}, // U+1D474, 𝑴, \biM, Mathematical Bold Italic Capital M
+{0x3103, 0x000d, 0x00BD}, // ½, \1/2, Vulgar Fraction One Half / Fraction One Half
+{0x6507, 0x254a, 0x2A71}, // ⩱, \eqqplus, Equals Sign Above Plus Sign
+{0x3203, 0x0031, 0x2156}, // ⅖, \2/5, Vulgar Fraction Two Fifths / Fraction Two Fifths
+{0x630c, 0x1fdb, 0x25F4}, // ◴, \circleulquad, White Circle With Upper Left Quadrant
+{0x6213, 0x17de, 0x2593}, // ▓, \blockthreeqtrshaded, Dark Shade
+{0x5e02, 0x0672, 0x02E2}, // ˢ, \^s, Modifier Letter Small S
+{0x6e0f, 0x3675, 0x2B3A}, // ⬺, \nVleftarrowtail, Leftwards Arrow With Tail With Double Vertical Stroke
+{0x7501, 0x4c3a, 0x02D8}, // ˘, \u, Breve / Spacing Breve
+{0x5604, 0x056d, 0x2016}, // ‖, \Vert, Double Vertical Line / Double Vertical Bar
+{0x5301, 0x04bf, 0x00A7}, // §, \S, Section Sign
+{0x750c, 0x4c81, 0x23B5}, // ⎵, \underbracket, Bottom Square Bracket
+{0x6d0c, 0x3592, 0x2B50}, // ⭐, \medwhitestar, White Medium Star
+{0x5210, 0x0465, 0x2954}, // ⥔, \RightUpVectorBar, Upwards Harpoon With Barb Right To Bar
+{0x6205, 0x1ce2, 0xDCD5'D835}, // U+1D4D5, 𝓕, \bscrF, Mathematical Bold Script Capital F
+{0x6206, 0x0c73, 0xDD72'D835}, // U+1D572, 𝕲, \bfrakG, Mathematical Bold Fraktur Capital G
+{0x6906, 0x29ed, 0x2A0D}, // ⨍, \intbar, Finite Part Integral
+{0x6e09, 0x38bf, 0x2288}, // ⊈, \nsubseteq, Neither A Subset Of Nor Equal To
+{0x7305, 0x4238, 0xDDCB'D835}, // U+1D5CB, 𝗋, \sansr, Mathematical Sans-Serif Small R
+{0x6203, 0x08e9, 0xDD46'D835}, // U+1D546, 𝕆, \bbO, Mathematical Double-Struck Capital O
+{0x4704, 0x0180, 0x2141}, // ⅁, \Game, Turned Sans-Serif Capital G
+{0x5e02, 0x0645, 0x2071}, // ⁱ, \^i, Superscript Latin Small Letter I
+{0x770d, 0x515b, 0x29A6}, // ⦦, \wideangledown, Oblique Angle Opening Up
+{0x6209, 0x14a7, 0xDFBA'D835}, // U+1D7BA, 𝞺, \bisansrho, Mathematical Sans-Serif Bold Italic Small Rho
+{0x6206, 0x1e2f, 0x2A32}, // ⨲, \btimes, Semidirect Product With Bottom Closed
+{0x6907, 0x2bf7, 0x22F5}, // ⋵, \isindot, Element Of With Dot Above
+{0x6206, 0x0d61, 0xDD94'D835}, // U+1D594, 𝖔, \bfrako, Mathematical Bold Fraktur Small O
+{0x6e03, 0x380a, 0x22BD}, // ⊽, \nor, Nor
+{0x640d, 0x2323, 0x223A}, // ∺, \dotsminusdots, Geometric Proportion
+{0x7309, 0x471d, 0x2ABD}, // ⪽, \subsetdot, Subset With Dot
+{0x6506, 0x2466, 0x2A97}, // ⪗, \elsdot, Slanted Equal To Or Less-Than With Dot Inside
+{0x6e08, 0x38ef, 0x0338'227F}, // ≿̸, \nsuccsim, Succeeds Or Equivalent To + Combining Long Solidus Overlay / Non-Spacing Long Slash Overlay
+{0x5403, 0x0516, 0x2AEA}, // ⫪, \Top, Double Down Tack
+{0x6203, 0x08b9, 0xDD3C'D835}, // U+1D53C, 𝔼, \bbE, Mathematical Double-Struck Capital E
+{0x6304, 0x1e94, 0x221B}, // ∛, \cbrt, Cube Root
+{0x7710, 0x5120, 0x25C5}, // ◅, \whitepointerleft, White Left-Pointing Pointer / White Left Pointing Pointer
+{0x6506, 0x24fd, 0x29E3}, // ⧣, \eparsl, Equals Sign And Slanted Parallel
+{0x700a, 0x3cee, 0x2AB7}, // ⪷, \precapprox, Precedes Above Almost Equal To
+{0x6108, 0x072a, 0x267E}, // ♾, \acidfree, Permanent Paper Sign
+{0x6206, 0x19ad, 0xDDE5'D835}, // U+1D5E5, 𝗥, \bsansR, Mathematical Sans-Serif Bold Capital R
+{0x6e0e, 0x381f, 0x2279}, // ≹, \notgreaterless, Neither Greater-Than Nor Less-Than / Neither Greater Than Nor Less Than
+{0x6e07, 0x3782, 0x2204}, // ∄, \nexists, There Does Not Exist
+{0x7508, 0x4e45, 0x231D}, // ⌝, \urcorner, Top Right Corner
+{0x4412, 0x0126, 0x295F}, // ⥟, \DownRightTeeVector, Rightwards Harpoon With Barb Down From Bar
+{0x6406, 0x22ec, 0x23A3}, // ⎣, \dlcorn, Left Square Bracket Lower Corner
+{0x6203, 0x0fbe, 0xDC86'D835}, // U+1D486, 𝒆, \bie, Mathematical Bold Italic Small E
+{0x6207, 0x0f95, 0xDF36'D835}, // U+1D736, 𝜶, \bialpha, Mathematical Bold Italic Small Alpha
+{0x6908, 0x2a1e, 0x2A3D}, // ⨽, \intprodr, Righthand Interior Product
+{0x650a, 0x25ea, 0x00A1}, // ¡, \exclamdown, Inverted Exclamation Mark
+{0x6304, 0x20e3, 0x2AD0}, // ⫐, \csup, Closed Superset
+{0x6204, 0x0960, 0x2145}, // ⅅ, \bbiD, Double-Struck Italic Capital D
+{0x6f04, 0x3a6e, 0x2A38}, // ⨸, \odiv, Circled Division Sign
+{0x7507, 0x4db7, 0x03DF}, // ϟ, \upkoppa, Greek Small Letter Koppa
+{0x6207, 0x1238, 0xDE48'D835}, // U+1D648, 𝙈, \bisansM, Mathematical Sans-Serif Bold Italic Capital M
+{0x6207, 0x1839, 0x29C4}, // ⧄, \boxdiag, Squared Rising Diagonal Slash
+{0x620b, 0x13f3, 0xDFB3'D835}, // U+1D7B3, 𝞳, \bisanskappa, Mathematical Sans-Serif Bold Italic Small Kappa
+{0x7304, 0x43c0, 0xDCCD'D835}, // U+1D4CD, 𝓍, \scrx, Mathematical Script Small X
+{0x6203, 0x15b0, 0xDC95'D835}, // U+1D495, 𝒕, \bit, Mathematical Bold Italic Small T
+{0x6e05, 0x37e6, 0x226E}, // ≮, \nless, Not Less-Than / Not Less Than
+{0x6203, 0x0989, 0xDD5F'D835}, // U+1D55F, 𝕟, \bbn, Mathematical Double-Struck Small N
+{0x6e06, 0x37ac, 0x22FE}, // ⋾, \niobar, Small Contains With Overbar
+{0x6206, 0x0c88, 0xDD75'D835}, // U+1D575, 𝕵, \bfrakJ, Mathematical Bold Fraktur Capital J
+{0x620b, 0x17f2, 0x2580}, // ▀, \blockuphalf, Upper Half Block
+{0x3403, 0x0041, 0x2158}, // ⅘, \4/5, Vulgar Fraction Four Fifths / Fraction Four Fifths
+{0x7209, 0x40d2, 0x23B9}, // ⎹, \rvboxline, Right Vertical Box Line
+{0x7304, 0x430c, 0xDCA9'D835}, // U+1D4A9, 𝒩, \scrN, Mathematical Script Capital N
+{0x7309, 0x4730, 0x2AC5}, // ⫅, \subseteqq, Subset Of Above Equals Sign
+{0x7608, 0x4f04, 0x22F3}, // ⋳, \varisins, Element Of With Vertical Bar At End Of Horizontal Stroke
+{0x6907, 0x2da1, 0xDF05'D835}, // U+1D705, 𝜅, \itkappa, Mathematical Italic Small Kappa
+{0x620a, 0x159d, 0xDFAF'D835}, // U+1D7AF, 𝞯, \bisanszeta, Mathematical Sans-Serif Bold Italic Small Zeta
+{0x7204, 0x40c6, 0x0290}, // ʐ, \rtlz, Latin Small Letter Z With Retroflex Hook / Latin Small Letter Z Retroflex Hook
+{0x6906, 0x2d39, 0xDEFD'D835}, // U+1D6FD, 𝛽, \itbeta, Mathematical Italic Small Beta
+{0x770e, 0x50bd, 0x2A60}, // ⩠, \wedgedoublebar, Logical And With Double Underbar
+{0x6e0f, 0x39a1, 0x2B39}, // ⬹, \nvleftarrowtail, Leftwards Arrow With Tail With Vertical Stroke
+{0x6f04, 0x3a4c, 0x233D}, // ⌽, \obar, Apl Functional Symbol Circle Stile
+{0x6909, 0x29b0, 0x27F8}, // ⟸, \impliedby, Long Leftwards Double Arrow
+{0x6e04, 0x379c, 0x226F}, // ≯, \ngtr, Not Greater-Than / Not Greater Than
+{0x640a, 0x2361, 0x01C2}, // ǂ, \doublepipe, Latin Letter Alveolar Click / Latin Letter Pipe Double Bar
+{0x6203, 0x0c41, 0xDC2A'D835}, // U+1D42A, 𝐪, \bfq, Mathematical Bold Small Q
+{0x610e, 0x079d, 0x2246}, // ≆, \approxnotequal, Approximately But Not Actually Equal To
+{0x6e06, 0x376d, 0x0338'2242}, // ≂̸, \neqsim, Minus Tilde + Combining Long Solidus Overlay / Non-Spacing Long Slash Overlay
+{0x6203, 0x0aba, 0xDC0D'D835}, // U+1D40D, 𝐍, \bfN, Mathematical Bold Capital N
+{0x7305, 0x4209, 0xDDC6'D835}, // U+1D5C6, 𝗆, \sansm, Mathematical Sans-Serif Small M
+{0x6312, 0x1fb5, 0x21F4}, // ⇴, \circleonrightarrow, Right Arrow With Small Circle
+{0x7404, 0x4883, 0x02A7}, // ʧ, \tesh, Latin Small Letter Tesh Digraph / Latin Small Letter T Esh
+{0x6904, 0x2a46, 0x028C}, // ʌ, \invv, Latin Small Letter Turned V
+{0x720e, 0x3e47, 0x299D}, // ⦝, \rightanglemdot, Measured Right Angle With Dot
+{0x6903, 0x2cfb, 0xDC48'D835}, // U+1D448, 𝑈, \itU, Mathematical Italic Capital U
+{0x7a04, 0x51ab, 0x03B6}, // ζ, \zeta, Greek Small Letter Zeta
+{0x5f02, 0x0707, 0x209B}, // ₛ, \_s, Latin Subscript Small Letter S
+{0x6206, 0x0899, 0x22BD}, // ⊽, \barvee, Nor
+{0x7403, 0x4a35, 0xDE71'D835}, // U+1D671, 𝙱, \ttB, Mathematical Monospace Capital B
+{0x6c05, 0x3259, 0x25DF}, // ◟, \llarc, Lower Left Quadrant Circular Arc
+{0x6907, 0x2a16, 0x2A3C}, // ⨼, \intprod, Interior Product
+{0x6e06, 0x3662, 0x22AE}, // ⊮, \nVdash, Does Not Force
+{0x7308, 0x41dc, 0xDFE6'D835}, // U+1D7E6, 𝟦, \sansfour, Mathematical Sans-Serif Digit Four
+{0x6206, 0x0c57, 0xDD6E'D835}, // U+1D56E, 𝕮, \bfrakC, Mathematical Bold Fraktur Capital C
+{0x6208, 0x1240, 0xDF9B'D835}, // U+1D79B, 𝞛, \bisansMu, Mathematical Sans-Serif Bold Italic Capital Mu
+{0x7308, 0x41d3, 0xDFE7'D835}, // U+1D7E7, 𝟧, \sansfive, Mathematical Sans-Serif Digit Five
+{0x7305, 0x4570, 0x2293}, // ⊓, \sqcap, Square Cap
+{0x6904, 0x2dcb, 0xDF08'D835}, // U+1D708, 𝜈, \itnu, Mathematical Italic Small Nu
+{0x7213, 0x3f3a, 0x2964}, // ⥤, \rightharpoonsupdown, Rightwards Harpoon With Barb Up Above Rightwards Harpoon With Barb Down
+{0x6308, 0x1eeb, 0x00AE}, // ®, \circledR, Registered Sign / Registered Trade Mark Sign
+{0x7305, 0x412b, 0xDDAA'D835}, // U+1D5AA, 𝖪, \sansK, Mathematical Sans-Serif Capital K
+{0x750a, 0x4dd0, 0x03D9}, // ϙ, \upoldkoppa, Greek Small Letter Archaic Koppa
+{0x7307, 0x47ef, 0x2AD7}, // ⫗, \suphsub, Superset Beside Subset
+{0x6205, 0x1cfa, 0xDCD9'D835}, // U+1D4D9, 𝓙, \bscrJ, Mathematical Bold Script Capital J
+{0x7606, 0x507d, 0x25AF}, // ▯, \vrecto, White Vertical Rectangle
+{0x7308, 0x4451, 0x2A6B}, // ⩫, \simrdots, Tilde Operator With Rising Dots
+{0x4e14, 0x02da, 0x2AA2}, // ⪢, \NestedGreaterGreater, Double Nested Greater-Than
+{0x6903, 0x2c2c, 0xDC36'D835}, // U+1D436, 𝐶, \itC, Mathematical Italic Capital C
+{0x7507, 0x4e09, 0x2AEB}, // ⫫, \upvDash, Double Up Tack
+{0x6207, 0x0a08, 0x2235}, // ∵, \because, Because
+{0x6306, 0x20f9, 0x2A45}, // ⩅, \cupvee, Union With Logical Or
+{0x6405, 0x21da, 0x29CB}, // ⧋, \defas, Triangle With Underbar
+{0x7407, 0x4b08, 0xDFFD'D835}, // U+1D7FD, 𝟽, \ttseven, Mathematical Monospace Digit Seven
+{0x6311, 0x1fa3, 0x2B30}, // ⬰, \circleonleftarrow, Left Arrow With Small Circle
+{0x6605, 0x2761, 0xDD2D'D835}, // U+1D52D, 𝔭, \frakp, Mathematical Fraktur Small P
+{0x6207, 0x0950, 0x213D}, // ℽ, \bbgamma, Double-Struck Small Gamma
+{0x5f02, 0x069a, 0x208D}, // ₍, \_(, Subscript Left Parenthesis / Subscript Opening Parenthesis
+{0x6c05, 0x33c5, 0x0271}, // ɱ, \ltlmr, Latin Small Letter M With Hook / Latin Small Letter M Hook
+{0x6205, 0x0ae8, 0xDEBF'D835}, // U+1D6BF, 𝚿, \bfPsi, Mathematical Bold Capital Psi
+{0x5204, 0x03db, 0x21B3}, // ↳, \Rdsh, Downwards Arrow With Tip Rightwards / Down Arrow With Tip Right
+{0x6e09, 0x362a, 0x21DE}, // ⇞, \nHuparrow, Upwards Arrow With Double Stroke / Up Arrow With Double Stroke
+{0x7514, 0x4c9d, 0x20ED}, // ⃭, \underleftharpoondown, Combining Leftwards Harpoon With Barb Downwards
+{0x6c09, 0x33de, 0x23B8}, // ⎸, \lvboxline, Left Vertical Box Line
+{0x6108, 0x078a, 0x224A}, // ≊, \approxeq, Almost Equal Or Equal To
+{0x6205, 0x1dba, 0xDCF9'D835}, // U+1D4F9, 𝓹, \bscrp, Mathematical Bold Script Small P
+{0x6709, 0x287e, 0x22DB}, // ⋛, \gtreqless, Greater-Than Equal To Or Less-Than / Greater Than Equal To Or Less Than
+{0x6c0b, 0x3217, 0x2B24}, // ⬤, \lgblkcircle, Black Large Circle
+{0x6506, 0x250c, 0x2256}, // ≖, \eqcirc, Ring In Equal To
+{0x760d, 0x5092, 0x2B1D}, // ⬝, \vysmblksquare, Black Very Small Square
+{0x720f, 0x3f70, 0x21C4}, // ⇄, \rightleftarrows, Rightwards Arrow Over Leftwards Arrow / Right Arrow Over Left Arrow
+{0x6904, 0x2d15, 0xDEEF'D835}, // U+1D6EF, 𝛯, \itXi, Mathematical Italic Capital Xi
+{0x6903, 0x2e05, 0xDC5E'D835}, // U+1D45E, 𝑞, \itq, Mathematical Italic Small Q
+{0x6203, 0x0c06, 0xDC28'D835}, // U+1D428, 𝐨, \bfo, Mathematical Bold Small O
+{0x6205, 0x09d1, 0x2140}, // ⅀, \bbsum, Double-Struck N-Ary Summation
+{0x4b05, 0x019b, 0x03DE}, // Ϟ, \Koppa, Greek Letter Koppa / Greek Capital Letter Koppa
+{0x7304, 0x432a, 0xDCAF'D835}, // U+1D4AF, 𝒯, \scrT, Mathematical Script Capital T
+{0x650c, 0x247d, 0x29B3}, // ⦳, \emptysetoarr, Empty Set With Right Arrow Above
+{0x4e0e, 0x02ef, 0x2AA1}, // ⪡, \NestedLessLess, Double Nested Less-Than
+{0x6f0c, 0x3b68, 0x0312}, // ̒, \oturnedcomma, Combining Turned Comma Above / Non-Spacing Turned Comma Above
+{0x4c0f, 0x0200, 0x29CF}, // ⧏, \LeftTriangleBar, Left Triangle Beside Vertical Bar
+{0x5e02, 0x05ea, 0x1D3F}, // ᴿ, \^R, Modifier Letter Capital R
+{0x7405, 0x4a1b, 0x027A}, // ɺ, \trnrl, Latin Small Letter Turned R With Long Leg
+{0x6e06, 0x398e, 0x22AC}, // ⊬, \nvdash, Does Not Prove
+{0x6c01, 0x2edf, 0x0142}, // ł, \l, Latin Small Letter L With Stroke / Latin Small Letter L Slash
+{0x6206, 0x19ea, 0xDDE8'D835}, // U+1D5E8, 𝗨, \bsansU, Mathematical Sans-Serif Bold Capital U
+{0x7509, 0x4cf6, 0x039F}, // Ο, \upOmicron, Greek Capital Letter Omicron
+{0x6203, 0x0a98, 0xDC0A'D835}, // U+1D40A, 𝐊, \bfK, Mathematical Bold Capital K
+{0x6f07, 0x3b75, 0x0305}, // ̅, \overbar, Combining Overline / Non-Spacing Overscore
+{0x7204, 0x3dbc, 0x02BC}, // ʼ, \rasp, Modifier Letter Apostrophe
+{0x6e04, 0x3710, 0x22BC}, // ⊼, \nand, Nand
+{0x3103, 0x0011, 0x2153}, // ⅓, \1/3, Vulgar Fraction One Third / Fraction One Third
+{0x7304, 0x43c5, 0xDCCE'D835}, // U+1D4CE, 𝓎, \scry, Mathematical Script Small Y
+{0x700b, 0x3d14, 0x2AB9}, // ⪹, \precnapprox, Precedes Above Not Almost Equal To
+{0x7610, 0x4fc3, 0x22B3}, // ⊳, \vartriangleright, Contains As Normal Subgroup
+{0x6203, 0x0994, 0xDD60'D835}, // U+1D560, 𝕠, \bbo, Mathematical Double-Struck Small O
+{0x640a, 0x236c, 0x29FA}, // ⧺, \doubleplus, Double Plus
+{0x740c, 0x4996, 0x2A39}, // ⨹, \triangleplus, Plus Sign In Triangle
+{0x620a, 0x1ac2, 0xDF72'D835}, // U+1D772, 𝝲, \bsansgamma, Mathematical Sans-Serif Bold Small Gamma
+{0x6406, 0x21e0, 0x00B0}, // °, \degree, Degree Sign
+{0x7304, 0x42e4, 0x2131}, // ℱ, \scrF, Script Capital F / Script F
+{0x7202, 0x4084, 0x2019}, // ’, \rq, Right Single Quotation Mark / Single Comma Quotation Mark
+{0x6f0a, 0x3b0b, 0x2A2E}, // ⨮, \oplusrhrim, Plus Sign In Right Half Circle
+{0x7307, 0x46f9, 0x2AC3}, // ⫃, \subedot, Subset Of Or Equal To With Dot Above
+{0x620b, 0x1c64, 0xDF8E'D835}, // U+1D78E, 𝞎, \bsansvarrho, Mathematical Sans-Serif Bold Rho Symbol
+{0x6415, 0x23cf, 0x2965}, // ⥥, \downharpoonsleftright, Downwards Harpoon With Barb Left Beside Downwards Harpoon With Barb Right
+{0x6207, 0x149f, 0xDE67'D835}, // U+1D667, 𝙧, \bisansr, Mathematical Sans-Serif Bold Italic Small R
+{0x6c07, 0x33d6, 0x2A7B}, // ⩻, \ltquest, Less-Than With Question Mark Above
+{0x7004, 0x3ce9, 0x227A}, // ≺, \prec, Precedes
+{0x650a, 0x2578, 0x2A96}, // ⪖, \eqslantgtr, Slanted Equal To Or Greater-Than
+{0x6d0c, 0x34b8, 0x2B26}, // ⬦, \mdwhtdiamond, White Medium Diamond
+{0x6208, 0x1b91, 0xDF87'D835}, // U+1D787, 𝞇, \bsanspsi, Mathematical Sans-Serif Bold Small Psi
+{0x6404, 0x21c7, 0x0308}, // ̈, \ddot, Combining Diaeresis / Non-Spacing Diaeresis
+{0x6207, 0x0bf2, 0xDEC1'D835}, // U+1D6C1, 𝛁, \bfnabla, Mathematical Bold Nabla
+{0x7309, 0x4244, 0xDFE9'D835}, // U+1D7E9, 𝟩, \sansseven, Mathematical Sans-Serif Digit Seven
+{0x6206, 0x0c96, 0xDD77'D835}, // U+1D577, 𝕷, \bfrakL, Mathematical Bold Fraktur Capital L
+{0x6206, 0x0cd5, 0xDD80'D835}, // U+1D580, 𝖀, \bfrakU, Mathematical Bold Fraktur Capital U
+{0x7304, 0x4375, 0xDCBE'D835}, // U+1D4BE, 𝒾, \scri, Mathematical Script Small I
+{0x7608, 0x4f65, 0x03C2}, // ς, \varsigma, Greek Small Letter Final Sigma
+{0x6f09, 0x3b46, 0x2A36}, // ⨶, \otimeshat, Circled Multiplication Sign With Circumflex Accent
+{0x6206, 0x1c06, 0xDE02'D835}, // U+1D602, 𝘂, \bsansu, Mathematical Sans-Serif Bold Small U
+{0x6203, 0x0f63, 0xDC7C'D835}, // U+1D47C, 𝑼, \biU, Mathematical Bold Italic Capital U
+{0x6605, 0x2785, 0xDD33'D835}, // U+1D533, 𝔳, \frakv, Mathematical Fraktur Small V
+{0x6605, 0x2725, 0xDD23'D835}, // U+1D523, 𝔣, \frakf, Mathematical Fraktur Small F
+{0x730b, 0x4535, 0x25AB}, // ▫, \smwhtsquare, White Small Square
+{0x730d, 0x4137, 0x2143}, // ⅃, \sansLmirrored, Reversed Sans-Serif Capital L
+{0x620a, 0x1bb8, 0xDFF3'D835}, // U+1D7F3, 𝟳, \bsansseven, Mathematical Sans-Serif Bold Digit Seven
+{0x6207, 0x0dc7, 0xDED4'D835}, // U+1D6D4, 𝛔, \bfsigma, Mathematical Bold Small Sigma
+{0x7304, 0x435c, 0xDCB9'D835}, // U+1D4B9, 𝒹, \scrd, Mathematical Script Small D
+{0x6207, 0x0a9c, 0xDEB1'D835}, // U+1D6B1, 𝚱, \bfKappa, Mathematical Bold Capital Kappa
+{0x6205, 0x1d60, 0xDCEA'D835}, // U+1D4EA, 𝓪, \bscra, Mathematical Bold Script Small A
+{0x7211, 0x3f80, 0x21CC}, // ⇌, \rightleftharpoons, Rightwards Harpoon Over Leftwards Harpoon / Right Harpoon Over Left Harpoon
+{0x6206, 0x0bfa, 0xDFD7'D835}, // U+1D7D7, 𝟗, \bfnine, Mathematical Bold Digit Nine
+{0x6207, 0x1303, 0xDE51'D835}, // U+1D651, 𝙑, \bisansV, Mathematical Sans-Serif Bold Italic Capital V
+{0x6605, 0x278b, 0xDD34'D835}, // U+1D534, 𝔴, \frakw, Mathematical Fraktur Small W
+{0x6207, 0x194f, 0xDF61'D835}, // U+1D761, 𝝡, \bsansMu, Mathematical Sans-Serif Bold Capital Mu
+{0x6205, 0x1dae, 0xDCF7'D835}, // U+1D4F7, 𝓷, \bscrn, Mathematical Bold Script Small N
+{0x6907, 0x2e29, 0xDF03'D835}, // U+1D703, 𝜃, \ittheta, Mathematical Italic Small Theta
+{0x760a, 0x4f35, 0x2205}, // ∅, \varnothing, Empty Set
+{0x6203, 0x090e, 0xDD4E'D835}, // U+1D54E, 𝕎, \bbW, Mathematical Double-Struck Capital W
+{0x6d04, 0x341f, 0x2642}, // ♂, \mars, Male Sign
+{0x6209, 0x1cba, 0xDF75'D835}, // U+1D775, 𝝵, \bsanszeta, Mathematical Sans-Serif Bold Small Zeta
+{0x6906, 0x2b8f, 0xDE2E'D835}, // U+1D62E, 𝘮, \isansm, Mathematical Sans-Serif Italic Small M
+{0x7305, 0x420f, 0xDDC7'D835}, // U+1D5C7, 𝗇, \sansn, Mathematical Sans-Serif Small N
+{0x6203, 0x0c22, 0xDC29'D835}, // U+1D429, 𝐩, \bfp, Mathematical Bold Small P
+{0x6604, 0x2639, 0x266D}, // ♭, \flat, Music Flat Sign / Flat
+{0x6c11, 0x3043, 0x296A}, // ⥪, \leftharpoonupdash, Leftwards Harpoon With Barb Up Above Long Dash
+{0x6906, 0x2ae7, 0xDE16'D835}, // U+1D616, 𝘖, \isansO, Mathematical Sans-Serif Italic Capital O
+{0x6207, 0x1207, 0xDE45'D835}, // U+1D645, 𝙅, \bisansJ, Mathematical Sans-Serif Bold Italic Capital J
+{0x750a, 0x4c5b, 0x25F8}, // ◸, \ultriangle, Upper Left Triangle
+{0x5211, 0x0442, 0x294F}, // ⥏, \RightUpDownVector, Up Barb Right Down Barb Right Harpoon
+{0x6205, 0x0db5, 0xDED2'D835}, // U+1D6D2, 𝛒, \bfrho, Mathematical Bold Small Rho
+{0x6904, 0x2c96, 0xDEED'D835}, // U+1D6ED, 𝛭, \itMu, Mathematical Italic Capital Mu
+{0x6c0a, 0x3295, 0x23B0}, // ⎰, \lmoustache, Upper Left Or Lower Right Curly Bracket Section
+{0x6203, 0x110b, 0xDC8F'D835}, // U+1D48F, 𝒏, \bin, Mathematical Bold Italic Small N
+{0x6105, 0x07b5, 0x2258}, // ≘, \arceq, Corresponds To
+{0x6205, 0x1dd2, 0xDCFD'D835}, // U+1D4FD, 𝓽, \bscrt, Mathematical Bold Script Small T
+{0x7208, 0x3dee, 0x2315}, // ⌕, \recorder, Telephone Recorder
+{0x630c, 0x1f2e, 0x229C}, // ⊜, \circledequal, Circled Equals
+{0x6e05, 0x3899, 0x2244}, // ≄, \nsime, Not Asymptotically Equal To
+{0x6506, 0x25f5, 0x2203}, // ∃, \exists, There Exists
+{0x6507, 0x2504, 0x03F5}, // ϵ, \epsilon, Greek Lunate Epsilon Symbol
+{0x6912, 0x2a2c, 0x25D9}, // ◙, \inversewhitecircle, Inverse White Circle
+{0x6203, 0x092e, 0xDD56'D835}, // U+1D556, 𝕖, \bbe, Mathematical Double-Struck Small E
+{0x6305, 0x20dd, 0x2AD1}, // ⫑, \csube, Closed Subset Or Equal To
+{0x7403, 0x4ab5, 0xDE8F'D835}, // U+1D68F, 𝚏, \ttf, Mathematical Monospace Small F
+{0x6208, 0x128e, 0xDF9F'D835}, // U+1D79F, 𝞟, \bisansPi, Mathematical Sans-Serif Bold Italic Capital Pi
+{0x6506, 0x2447, 0x2A98}, // ⪘, \egsdot, Slanted Equal To Or Greater-Than With Dot Inside
+{0x6203, 0x0fb2, 0xDC85'D835}, // U+1D485, 𝒅, \bid, Mathematical Bold Italic Small D
+{0x7611, 0x4ee6, 0x232C}, // ⌬, \varhexagonlrbonds, Benzene Ring
+{0x6906, 0x2bc7, 0xDE36'D835}, // U+1D636, 𝘶, \isansu, Mathematical Sans-Serif Italic Small U
+{0x6206, 0x0d8b, 0xDD9A'D835}, // U+1D59A, 𝖚, \bfraku, Mathematical Bold Fraktur Small U
+{0x6307, 0x20aa, 0x2A6D}, // ⩭, \congdot, Congruent With Dot Above
+{0x5e02, 0x05a8, 0x00B3}, // ³, \^3, Superscript Three / Superscript Digit Three
+{0x6207, 0x13ff, 0xDE61'D835}, // U+1D661, 𝙡, \bisansl, Mathematical Sans-Serif Bold Italic Small L
+{0x6203, 0x0bcc, 0xDC24'D835}, // U+1D424, 𝐤, \bfk, Mathematical Bold Small K
+{0x630f, 0x1f3b, 0x29B7}, // ⦷, \circledparallel, Circled Parallel
+{0x6305, 0x1ea4, 0x22EF}, // ⋯, \cdots, Midline Horizontal Ellipsis
+{0x6105, 0x07c5, 0x2A6E}, // ⩮, \asteq, Equals With Asterisk
+{0x7404, 0x4a27, 0x0287}, // ʇ, \trnt, Latin Small Letter Turned T
+{0x6203, 0x0a4b, 0xDC03'D835}, // U+1D403, 𝐃, \bfD, Mathematical Bold Capital D
+{0x6205, 0x1dde, 0xDCFF'D835}, // U+1D4FF, 𝓿, \bscrv, Mathematical Bold Script Small V
+{0x6105, 0x0764, 0x2220}, // ∠, \angle, Angle
+{0x6206, 0x1020, 0x22C3}, // ⋃, \bigcup, N-Ary Union
+{0x5f02, 0x06c1, 0x2089}, // ₉, \_9, Subscript Nine / Subscript Digit Nine
+{0x7310, 0x455f, 0x29A1}, // ⦡, \sphericalangleup, Spherical Angle Opening Up
+{0x6410, 0x23be, 0x21C2}, // ⇂, \downharpoonright, Downwards Harpoon With Barb Rightwards / Down Harpoon With Barb Right
+{0x6e0c, 0x38da, 0x22E1}, // ⋡, \nsucccurlyeq, Does Not Succeed Or Equal
+{0x7305, 0x410d, 0xDDA5'D835}, // U+1D5A5, 𝖥, \sansF, Mathematical Sans-Serif Capital F
+{0x700a, 0x3cc6, 0x3012}, // 〒, \postalmark, Postal Mark
+{0x620a, 0x0e07, 0xDEB9'D835}, // U+1D6B9, 𝚹, \bfvarTheta, Mathematical Bold Capital Theta Symbol
+{0x4c0e, 0x0259, 0x21D4}, // ⇔, \Leftrightarrow, Left Right Double Arrow
+{0x6207, 0x12a9, 0xDE4D'D835}, // U+1D64D, 𝙍, \bisansR, Mathematical Sans-Serif Bold Italic Capital R
+{0x5306, 0x04e1, 0x03DA}, // Ϛ, \Stigma, Greek Letter Stigma / Greek Capital Letter Stigma
+{0x6203, 0x0f0c, 0xDC76'D835}, // U+1D476, 𝑶, \biO, Mathematical Bold Italic Capital O
+{0x5305, 0x04db, 0x2A4F}, // ⩏, \Sqcup, Double Square Union
+{0x650c, 0x2498, 0x29B1}, // ⦱, \emptysetobar, Empty Set With Overbar
+{0x6204, 0x0a1d, 0x2136}, // ℶ, \beth, Bet Symbol / Second Transfinite Cardinal
+{0x6203, 0x09f5, 0xDD69'D835}, // U+1D569, 𝕩, \bbx, Mathematical Double-Struck Small X
+{0x6203, 0x0912, 0xDD4F'D835}, // U+1D54F, 𝕏, \bbX, Mathematical Double-Struck Capital X
+{0x6209, 0x148d, 0xDFC1'D835}, // U+1D7C1, 𝟁, \bisanspsi, Mathematical Sans-Serif Bold Italic Small Psi
+{0x6605, 0x266b, 0xDD04'D835}, // U+1D504, 𝔄, \frakA, Mathematical Fraktur Capital A
+{0x7006, 0x3d66, 0x22B0}, // ⊰, \prurel, Precedes Under Relation
+{0x620a, 0x0e1f, 0xDEDE'D835}, // U+1D6DE, 𝛞, \bfvarkappa, Mathematical Bold Kappa Symbol
+{0x6605, 0x26d7, 0xDD16'D835}, // U+1D516, 𝔖, \frakS, Mathematical Fraktur Capital S
+{0x7210, 0x3f29, 0x21C1}, // ⇁, \rightharpoondown, Rightwards Harpoon With Barb Downwards / Right Harpoon With Barb Down
+{0x6906, 0x2bc0, 0xDE35'D835}, // U+1D635, 𝘵, \isanst, Mathematical Sans-Serif Italic Small T
+{0x7306, 0x47ff, 0x2283}, // ⊃, \supset, Superset Of
+{0x7308, 0x46e3, 0x00A3}, // £, \sterling, Pound Sign
+{0x6105, 0x0757, 0x2A3F}, // ⨿, \amalg, Amalgamation Or Coproduct
+{0x5307, 0x04fb, 0x21D9}, // ⇙, \Swarrow, South West Double Arrow / Lower Left Double Arrow
+{0x6206, 0x1ad4, 0xDDF6'D835}, // U+1D5F6, 𝗶, \bsansi, Mathematical Sans-Serif Bold Small I
+{0x7406, 0x4b40, 0xDFF6'D835}, // U+1D7F6, 𝟶, \ttzero, Mathematical Monospace Digit Zero
+{0x5e0a, 0x061e, 0xA71C}, // ꜜ, \^downarrow, Modifier Letter Raised Down Arrow
+{0x7403, 0x4b2c, 0xDE9F'D835}, // U+1D69F, 𝚟, \ttv, Mathematical Monospace Small V
+{0x6207, 0x119c, 0xDE3F'D835}, // U+1D63F, 𝘿, \bisansD, Mathematical Sans-Serif Bold Italic Capital D
+{0x6205, 0x1d24, 0xDCE0'D835}, // U+1D4E0, 𝓠, \bscrQ, Mathematical Bold Script Capital Q
+{0x6206, 0x19cf, 0xDDE7'D835}, // U+1D5E7, 𝗧, \bsansT, Mathematical Sans-Serif Bold Capital T
+{0x670a, 0x2888, 0x2A8C}, // ⪌, \gtreqqless, Greater-Than Above Double-Line Equal Above Less-Than
+{0x7605, 0x4fde, 0x22A2}, // ⊢, \vdash, Right Tack
+{0x3003, 0x0001, 0x2189}, // ↉, \0/3, Vulgar Fraction Zero Thirds
+{0x6206, 0x1904, 0xDDDB'D835}, // U+1D5DB, 𝗛, \bsansH, Mathematical Sans-Serif Bold Capital H
+{0x6206, 0x1a0c, 0xDDEB'D835}, // U+1D5EB, 𝗫, \bsansX, Mathematical Sans-Serif Bold Capital X
+{0x7305, 0x41b1, 0xDDBC'D835}, // U+1D5BC, 𝖼, \sansc, Mathematical Sans-Serif Small C
+{0x6e06, 0x365b, 0x22AF}, // ⊯, \nVDash, Negated Double Vertical Bar Double Right Turnstile
+{0x6304, 0x20d8, 0x2ACF}, // ⫏, \csub, Closed Subset
+{0x6906, 0x29db, 0x0296}, // ʖ, \inglst, Latin Letter Inverted Glottal Stop
+{0x7304, 0x4361, 0x212F}, // ℯ, \scre, Script Small E
+{0x6d08, 0x33ff, 0x21A7}, // ↧, \mapsdown, Downwards Arrow From Bar / Down Arrow From Bar
+{0x7403, 0x4acf, 0xDE92'D835}, // U+1D692, 𝚒, \tti, Mathematical Monospace Small I
+{0x750a, 0x4dc5, 0x03D8}, // Ϙ, \upoldKoppa, Greek Letter Archaic Koppa
+{0x6903, 0x2c79, 0xDC3E'D835}, // U+1D43E, 𝐾, \itK, Mathematical Italic Capital K
+{0x6306, 0x1e5e, 0x0310}, // ̐, \candra, Combining Candrabindu / Non-Spacing Candrabindu
+{0x7507, 0x4d06, 0x2191}, // ↑, \uparrow, Upwards Arrow / Up Arrow
+{0x7304, 0x4352, 0xDCB7'D835}, // U+1D4B7, 𝒷, \scrb, Mathematical Script Small B
+{0x6c06, 0x33be, 0x22C9}, // ⋉, \ltimes, Left Normal Factor Semidirect Product
+{0x7403, 0x4a4d, 0xDE77'D835}, // U+1D677, 𝙷, \ttH, Mathematical Monospace Capital H
+{0x6b05, 0x2ec7, 0x03BA}, // κ, \kappa, Greek Small Letter Kappa
+{0x5e05, 0x0648, 0x1DA5}, // ᶥ, \^iota, Modifier Letter Small Iota
+{0x6d0b, 0x34d2, 0x25FB}, // ◻, \mdwhtsquare, White Medium Square
+{0x4c12, 0x0281, 0x27FA}, // ⟺, \Longleftrightarrow, Long Left Right Double Arrow
+{0x6212, 0x169e, 0x25A3}, // ▣, \blackinwhitesquare, White Square Containing Black Small Square
+{0x6206, 0x0d29, 0xDD8C'D835}, // U+1D58C, 𝖌, \bfrakg, Mathematical Bold Fraktur Small G
+{0x6203, 0x08ed, 0x2119}, // ℙ, \bbP, Double-Struck Capital P / Double-Struck P
+{0x6907, 0x2dc3, 0xDEFB'D835}, // U+1D6FB, 𝛻, \itnabla, Mathematical Italic Nabla
+{0x4c0d, 0x0273, 0x27F8}, // ⟸, \Longleftarrow, Long Leftwards Double Arrow
+{0x6205, 0x1d4e, 0xDCE7'D835}, // U+1D4E7, 𝓧, \bscrX, Mathematical Bold Script Capital X
+{0x6406, 0x231c, 0x2A6A}, // ⩪, \dotsim, Tilde Operator With Dot Above
+{0x7304, 0x4325, 0xDCAE'D835}, // U+1D4AE, 𝒮, \scrS, Mathematical Script Capital S
+{0x6209, 0x0b8b, 0xDEDC'D835}, // U+1D6DC, 𝛜, \bfepsilon, Mathematical Bold Epsilon Symbol
+{0x6207, 0x14c5, 0xDE69'D835}, // U+1D669, 𝙩, \bisanst, Mathematical Sans-Serif Bold Italic Small T
+{0x6605, 0x2791, 0xDD35'D835}, // U+1D535, 𝔵, \frakx, Mathematical Fraktur Small X
+{0x6f06, 0x3b3f, 0x2297}, // ⊗, \otimes, Circled Times
+{0x6207, 0x107a, 0x2605}, // ★, \bigstar, Black Star
+{0x760f, 0x4fb3, 0x22B2}, // ⊲, \vartriangleleft, Normal Subgroup Of
+{0x6203, 0x091e, 0xDD52'D835}, // U+1D552, 𝕒, \bba, Mathematical Double-Struck Small A
+{0x6e0b, 0x364f, 0x21CF}, // ⇏, \nRightarrow, Rightwards Double Arrow With Stroke / Right Double Arrow With Stroke
+{0x6205, 0x0998, 0xDFD9'D835}, // U+1D7D9, 𝟙, \bbone, Mathematical Double-Struck Digit One
+{0x7413, 0x4bb3, 0x2B37}, // ⬷, \twoheadleftdbkarrow, Leftwards Two-Headed Triple Dash Arrow
+{0x6e07, 0x38e7, 0x0338'2AB0}, // ⪰̸, \nsucceq, Succeeds Above Single-Line Equals Sign + Combining Long Solidus Overlay / Non-Spacing Long Slash Overlay
+{0x6f05, 0x3afa, 0x2295}, // ⊕, \oplus, Circled Plus
+{0x6c0b, 0x3223, 0x2B1B}, // ⬛, \lgblksquare, Black Large Square
+{0x7404, 0x4a00, 0x0250}, // ɐ, \trna, Latin Small Letter Turned A
+{0x6207, 0x1442, 0xDE64'D835}, // U+1D664, 𝙤, \bisanso, Mathematical Sans-Serif Bold Italic Small O
+{0x6206, 0x1935, 0xDDDF'D835}, // U+1D5DF, 𝗟, \bsansL, Mathematical Sans-Serif Bold Capital L
+{0x6207, 0x15ba, 0xDF3D'D835}, // U+1D73D, 𝜽, \bitheta, Mathematical Bold Italic Small Theta
+{0x630b, 0x207b, 0x2231}, // ∱, \clwintegral, Clockwise Integral
+{0x6219, 0x0854, 0x21B9}, // ↹, \barleftarrowrightarrowbar, Leftwards Arrow To Bar Over Rightwards Arrow To Bar / Left Arrow To Bar Over Right Arrow To Bar
+{0x750f, 0x4e35, 0x25E5}, // ◥, \urblacktriangle, Black Upper Right Triangle
+{0x6409, 0x22cd, 0x2A08}, // ⨈, \disjquant, Two Logical Or Operator
+{0x6c06, 0x2ee1, 0x03BB}, // λ, \lambda, Greek Small Letter Lamda / Greek Small Letter Lambda
+{0x7304, 0x4307, 0x2133}, // ℳ, \scrM, Script Capital M / Script M
+{0x6203, 0x0dbb, 0xDC2C'D835}, // U+1D42C, 𝐬, \bfs, Mathematical Bold Small S
+{0x6306, 0x203b, 0x0277}, // ɷ, \clomeg, Latin Small Letter Closed Omega
+{0x5e02, 0x0675, 0x1D57}, // ᵗ, \^t, Modifier Letter Small T
+{0x5f02, 0x06b5, 0x2085}, // ₅, \_5, Subscript Five / Subscript Digit Five
+{0x7505, 0x4e2f, 0x25DD}, // ◝, \urarc, Upper Right Quadrant Circular Arc
+{0x5e04, 0x060f, 0x1D61}, // ᵡ, \^chi, Modifier Letter Small Chi
+{0x6206, 0x1a56, 0xDDF0'D835}, // U+1D5F0, 𝗰, \bsansc, Mathematical Sans-Serif Bold Small C
+{0x7305, 0x4125, 0xDDA9'D835}, // U+1D5A9, 𝖩, \sansJ, Mathematical Sans-Serif Capital J
+{0x6903, 0x2c5a, 0xDC3A'D835}, // U+1D43A, 𝐺, \itG, Mathematical Italic Capital G
+{0x7307, 0x424e, 0xDFE8'D835}, // U+1D7E8, 𝟨, \sanssix, Mathematical Sans-Serif Digit Six
+{0x6206, 0x0d7d, 0xDD98'D835}, // U+1D598, 𝖘, \bfraks, Mathematical Bold Fraktur Small S
+{0x6205, 0x1d9c, 0xDCF4'D835}, // U+1D4F4, 𝓴, \bscrk, Mathematical Bold Script Small K
+{0x6206, 0x0b58, 0xDEC3'D835}, // U+1D6C3, 𝛃, \bfbeta, Mathematical Bold Small Beta
+{0x5214, 0x03e3, 0x296F}, // ⥯, \ReverseUpEquilibrium, Downwards Harpoon With Barb Left Beside Upwards Harpoon With Barb Right
+{0x6c03, 0x334b, 0x02D5}, // ˕, \low, Modifier Letter Down Tack
+{0x6805, 0x2988, 0x0195}, // ƕ, \hvlig, Latin Small Letter Hv / Latin Small Letter H V
+{0x4407, 0x00c2, 0x03DC}, // Ϝ, \Digamma, Greek Letter Digamma / Greek Capital Letter Digamma
+{0x7306, 0x478b, 0x2AB0}, // ⪰, \succeq, Succeeds Above Single-Line Equals Sign
+{0x6306, 0x1e57, 0x264B}, // ♋, \cancer, Cancer
+{0x6e07, 0x3856, 0x2A14}, // ⨔, \npolint, Line Integration Not Including The Pole
+{0x6905, 0x2c08, 0x22F4}, // ⋴, \isins, Small Element Of With Vertical Bar At End Of Horizontal Stroke
+{0x6203, 0x0f03, 0xDC75'D835}, // U+1D475, 𝑵, \biN, Mathematical Bold Italic Capital N
+{0x6605, 0x2767, 0xDD2E'D835}, // U+1D52E, 𝔮, \frakq, Mathematical Fraktur Small Q
+{0x6203, 0x099e, 0xDD61'D835}, // U+1D561, 𝕡, \bbp, Mathematical Double-Struck Small P
+{0x3303, 0x0035, 0x00BE}, // ¾, \3/4, Vulgar Fraction Three Quarters / Fraction Three Quarters
+{0x4d08, 0x02bf, 0x2906}, // ⤆, \Mapsfrom, Leftwards Double Arrow From Bar
+{0x6207, 0x0ea2, 0xDF1F'D835}, // U+1D71F, 𝜟, \biDelta, Mathematical Bold Italic Capital Delta
+{0x6906, 0x2aee, 0xDE17'D835}, // U+1D617, 𝘗, \isansP, Mathematical Sans-Serif Italic Capital P
+{0x620b, 0x11a4, 0xDF93'D835}, // U+1D793, 𝞓, \bisansDelta, Mathematical Sans-Serif Bold Italic Capital Delta
+{0x6608, 0x2651, 0x2ADD}, // ⫝, \forksnot, Nonforking
+{0x620a, 0x1b27, 0xDF6F'D835}, // U+1D76F, 𝝯, \bsansnabla, Mathematical Sans-Serif Bold Nabla
+{0x610b, 0x07cb, 0x20F0}, // ⃰, \asteraccent, Combining Asterisk Above
+{0x6e03, 0x37fa, 0x220C}, // ∌, \nni, Does Not Contain As Member
+{0x6c08, 0x32a5, 0x2A89}, // ⪉, \lnapprox, Less-Than And Not Approximate
+{0x6205, 0x0e98, 0xDF32'D835}, // U+1D732, 𝜲, \biChi, Mathematical Bold Italic Capital Chi
+{0x6209, 0x11c6, 0xDF96'D835}, // U+1D796, 𝞖, \bisansEta, Mathematical Sans-Serif Bold Italic Capital Eta
+{0x7215, 0x3f92, 0x2969}, // ⥩, \rightleftharpoonsdown, Rightwards Harpoon With Barb Down Above Leftwards Harpoon With Barb Down
+{0x6207, 0x1464, 0xDE65'D835}, // U+1D665, 𝙥, \bisansp, Mathematical Sans-Serif Bold Italic Small P
+{0x7305, 0x423e, 0xDDCC'D835}, // U+1D5CC, 𝗌, \sanss, Mathematical Sans-Serif Small S
+{0x6906, 0x2af5, 0xDE18'D835}, // U+1D618, 𝘘, \isansQ, Mathematical Sans-Serif Italic Capital Q
+{0x7305, 0x4203, 0xDDC5'D835}, // U+1D5C5, 𝗅, \sansl, Mathematical Sans-Serif Small L
+{0x6905, 0x29aa, 0x0131}, // ı, \imath, Latin Small Letter Dotless I
+{0x7304, 0x476f, 0x227B}, // ≻, \succ, Succeeds
+{0x7305, 0x41e5, 0xDDC0'D835}, // U+1D5C0, 𝗀, \sansg, Mathematical Sans-Serif Small G
+{0x7305, 0x42a2, 0x032A}, // ̪, \sbbrg, Combining Bridge Below / Non-Spacing Bridge Below
+{0x6908, 0x2bff, 0x22F7}, // ⋷, \isinobar, Small Element Of With Overbar
+{0x6204, 0x0e62, 0xDECF'D835}, // U+1D6CF, 𝛏, \bfxi, Mathematical Bold Small Xi
+{0x6d0d, 0x349e, 0x25FD}, // ◽, \mdsmwhtsquare, White Medium Small Square
+{0x6207, 0x195e, 0xDF62'D835}, // U+1D762, 𝝢, \bsansNu, Mathematical Sans-Serif Bold Capital Nu
+{0x4402, 0x00a5, 0x00D0}, // Ð, \DH, Latin Capital Letter Eth
+{0x6703, 0x281d, 0x2A92}, // ⪒, \glE, Greater-Than Above Less-Than Above Double-Line Equal
+{0x7711, 0x5131, 0x25BB}, // ▻, \whitepointerright, White Right-Pointing Pointer / White Right Pointing Pointer
+{0x760d, 0x5084, 0x2219}, // ∙, \vysmblkcircle, Bullet Operator
+{0x5e02, 0x0694, 0x02B8}, // ʸ, \^y, Modifier Letter Small Y
+{0x650f, 0x24de, 0x20E4}, // ⃤, \enclosetriangle, Combining Enclosing Upward Pointing Triangle
+{0x4c0e, 0x02ac, 0x27F9}, // ⟹, \Longrightarrow, Long Rightwards Double Arrow
+{0x6207, 0x0932, 0xDFE0'D835}, // U+1D7E0, 𝟠, \bbeight, Mathematical Double-Struck Digit Eight
+{0x6707, 0x2893, 0x2277}, // ≷, \gtrless, Greater-Than Or Less-Than / Greater Than Or Less Than
+{0x6e02, 0x373a, 0x2260}, // ≠, \ne, Not Equal To
+{0x6209, 0x12b1, 0xDFA0'D835}, // U+1D7A0, 𝞠, \bisansRho, Mathematical Sans-Serif Bold Italic Capital Rho
+{0x6c12, 0x32cd, 0x27F7}, // ⟷, \longleftrightarrow, Long Left Right Arrow
+{0x6207, 0x120f, 0xDE46'D835}, // U+1D646, 𝙆, \bisansK, Mathematical Sans-Serif Bold Italic Capital K
+{0x620b, 0x14b9, 0xDFBC'D835}, // U+1D7BC, 𝞼, \bisanssigma, Mathematical Sans-Serif Bold Italic Small Sigma
+{0x7403, 0x4af8, 0xDE99'D835}, // U+1D699, 𝚙, \ttp, Mathematical Monospace Small P
+{0x5203, 0x03f8, 0x03A1}, // Ρ, \Rho, Greek Capital Letter Rho
+{0x6203, 0x15d0, 0xDC97'D835}, // U+1D497, 𝒗, \biv, Mathematical Bold Italic Small V
+{0x760a, 0x4eb3, 0x03B5}, // ε, \varepsilon, Greek Small Letter Epsilon
+{0x6207, 0x13b4, 0xDE5C'D835}, // U+1D65C, 𝙜, \bisansg, Mathematical Sans-Serif Bold Italic Small G
+{0x6903, 0x2c21, 0xDC35'D835}, // U+1D435, 𝐵, \itB, Mathematical Italic Capital B
+{0x3303, 0x0039, 0x2157}, // ⅗, \3/5, Vulgar Fraction Three Fifths / Fraction Three Fifths
+{0x6209, 0x1136, 0xDF4F'D835}, // U+1D74F, 𝝏, \bipartial, Mathematical Bold Italic Partial Differential
+{0x620b, 0x14d7, 0xDFB1'D835}, // U+1D7B1, 𝞱, \bisanstheta, Mathematical Sans-Serif Bold Italic Small Theta
+{0x630b, 0x1e70, 0x2651}, // ♑, \capricornus, Capricorn
+{0x5210, 0x0454, 0x295C}, // ⥜, \RightUpTeeVector, Upwards Harpoon With Barb Right From Bar
+{0x6206, 0x0d45, 0xDD90'D835}, // U+1D590, 𝖐, \bfrakk, Mathematical Bold Fraktur Small K
+{0x6207, 0x1031, 0x2A00}, // ⨀, \bigodot, N-Ary Circled Dot Operator
+{0x6808, 0x2924, 0x2925}, // ⤥, \hksearow, South East Arrow With Hook
+{0x6203, 0x0a75, 0xDC05'D835}, // U+1D405, 𝐅, \bfF, Mathematical Bold Capital F
+{0x6605, 0x2749, 0xDD29'D835}, // U+1D529, 𝔩, \frakl, Mathematical Fraktur Small L
+{0x5e02, 0x05b4, 0x2077}, // ⁷, \^7, Superscript Seven / Superscript Digit Seven
+{0x6206, 0x100a, 0x27D8}, // ⟘, \bigbot, Large Up Tack
+{0x7304, 0x457c, 0x25E7}, // ◧, \sqfl, Square With Left Half Black
+{0x6c14, 0x308a, 0x2948}, // ⥈, \leftrightarrowcircle, Left Right Arrow Through Small Circle
+{0x6903, 0x2d11, 0xDC4B'D835}, // U+1D44B, 𝑋, \itX, Mathematical Italic Capital X
+{0x6906, 0x2b2d, 0xDE20'D835}, // U+1D620, 𝘠, \isansY, Mathematical Sans-Serif Italic Capital Y
+{0x6c08, 0x324d, 0x21B4}, // ↴, \linefeed, Rightwards Arrow With Corner Downwards / Right Arrow With Corner Down
+{0x6c0b, 0x323b, 0x2B1C}, // ⬜, \lgwhtsquare, White Large Square
+{0x6c0f, 0x3012, 0x21BD}, // ↽, \leftharpoondown, Leftwards Harpoon With Barb Downwards / Left Harpoon With Barb Down
+{0x7403, 0x4aee, 0xDE98'D835}, // U+1D698, 𝚘, \tto, Mathematical Monospace Small O
+{0x6203, 0x0e9e, 0xDC6B'D835}, // U+1D46B, 𝑫, \biD, Mathematical Bold Italic Capital D
+{0x6407, 0x22b2, 0x03DD}, // ϝ, \digamma, Greek Small Letter Digamma
+{0x7204, 0x3daa, 0x02D4}, // ˔, \rais, Modifier Letter Up Tack
+{0x6215, 0x086e, 0x21B8}, // ↸, \barovernorthwestarrow, North West Arrow To Long Bar / Upper Left Arrow To Long Bar
+{0x6909, 0x2d5a, 0xDF16'D835}, // U+1D716, 𝜖, \itepsilon, Mathematical Italic Epsilon Symbol
+{0x6f10, 0x3ae3, 0x27E7}, // ⟧, \openbracketright, Mathematical Right White Square Bracket
+{0x6906, 0x2b34, 0xDE21'D835}, // U+1D621, 𝘡, \isansZ, Mathematical Sans-Serif Italic Capital Z
+{0x3103, 0x0015, 0x00BC}, // ¼, \1/4, Vulgar Fraction One Quarter / Fraction One Quarter
+{0x5e02, 0x05e1, 0x1D3A}, // ᴺ, \^N, Modifier Letter Capital N
+{0x6906, 0x2992, 0x2A0C}, // ⨌, \iiiint, Quadruple Integral Operator
+{0x7204, 0x40a8, 0x0256}, // ɖ, \rtld, Latin Small Letter D With Tail / Latin Small Letter D Retroflex Hook
+{0x7104, 0x3d7e, 0x2003}, //  , \quad, Em Space
+{0x6207, 0x0bb1, 0xDEC4'D835}, // U+1D6C4, 𝛄, \bfgamma, Mathematical Bold Small Gamma
+{0x6904, 0x2cc4, 0xDEF1'D835}, // U+1D6F1, 𝛱, \itPi, Mathematical Italic Capital Pi
+{0x6f0a, 0x3b00, 0x2A2D}, // ⨭, \opluslhrim, Plus Sign In Left Half Circle
+{0x690a, 0x2e80, 0xDF0D'D835}, // U+1D70D, 𝜍, \itvarsigma, Mathematical Italic Small Final Sigma
+{0x760b, 0x4e86, 0x2667}, // ♧, \varclubsuit, White Club Suit
+{0x6209, 0x18a2, 0xDF57'D835}, // U+1D757, 𝝗, \bsansBeta, Mathematical Sans-Serif Bold Capital Beta
+{0x650d, 0x24a5, 0x29B2}, // ⦲, \emptysetocirc, Empty Set With Small Circle Above
+{0x6c06, 0x31b5, 0x2A7F}, // ⩿, \lesdot, Less-Than Or Slanted Equal To With Dot Inside
+{0x6109, 0x0720, 0x23E6}, // ⏦, \accurrent, Ac Current
+{0x6206, 0x1948, 0xDDE0'D835}, // U+1D5E0, 𝗠, \bsansM, Mathematical Sans-Serif Bold Capital M
+{0x6903, 0x2ea7, 0xDC67'D835}, // U+1D467, 𝑧, \itz, Mathematical Italic Small Z
+{0x6706, 0x2801, 0x2A94}, // ⪔, \gesles, Greater-Than Above Slanted Equal Above Less-Than Above Slanted Equal
+{0x640c, 0x233e, 0x2B1A}, // ⬚, \dottedsquare, Dotted Square
+{0x6607, 0x2631, 0x25C9}, // ◉, \fisheye, Fisheye
+{0x6906, 0x2b42, 0xDE23'D835}, // U+1D623, 𝘣, \isansb, Mathematical Sans-Serif Italic Small B
+{0x6f05, 0x3aa0, 0x222F}, // ∯, \oiint, Surface Integral
+{0x6405, 0x21eb, 0x03B4}, // δ, \delta, Greek Small Letter Delta
+{0x6907, 0x2d72, 0xDEFE'D835}, // U+1D6FE, 𝛾, \itgamma, Mathematical Italic Small Gamma
+{0x7305, 0x417b, 0xDDB3'D835}, // U+1D5B3, 𝖳, \sansT, Mathematical Sans-Serif Capital T
+{0x6c0c, 0x3392, 0x29E1}, // ⧡, \lrtriangleeq, Increases As
+{0x6206, 0x1889, 0xDDD4'D835}, // U+1D5D4, 𝗔, \bsansA, Mathematical Sans-Serif Bold Capital A
+{0x7605, 0x4e59, 0x22A8}, // ⊨, \vDash, True
+{0x7305, 0x4119, 0xDDA7'D835}, // U+1D5A7, 𝖧, \sansH, Mathematical Sans-Serif Capital H
+{0x6203, 0x0f82, 0xDC80'D835}, // U+1D480, 𝒀, \biY, Mathematical Bold Italic Capital Y
+{0x6203, 0x1634, 0xDC9A'D835}, // U+1D49A, 𝒚, \biy, Mathematical Bold Italic Small Y
+{0x760b, 0x4fa7, 0x25B5}, // ▵, \vartriangle, White Up-Pointing Small Triangle / White Up Pointing Small Triangle
+{0x6705, 0x27e3, 0x2AA9}, // ⪩, \gescc, Greater-Than Closed By Curve Above Slanted Equal
+{0x620f, 0x1092, 0x25BD}, // ▽, \bigtriangledown, White Down-Pointing Triangle / White Down Pointing Triangle
+{0x6e02, 0x37a9, 0x220B}, // ∋, \ni, Contains As Member
+{0x5508, 0x051a, 0x27F0}, // ⟰, \UUparrow, Upwards Quadruple Arrow
+{0x7412, 0x49bb, 0x25EE}, // ◮, \trianglerightblack, Up-Pointing Triangle With Right Half Black / Up Pointing Triangle With Right Half Black
+{0x7403, 0x4b30, 0xDEA0'D835}, // U+1D6A0, 𝚠, \ttw, Mathematical Monospace Small W
+{0x6207, 0x0ee5, 0xDF25'D835}, // U+1D725, 𝜥, \biKappa, Mathematical Bold Italic Capital Kappa
+{0x6f05, 0x3af4, 0x0254}, // ɔ, \openo, Latin Small Letter Open O
+{0x7206, 0x40cb, 0x027B}, // ɻ, \rttrnr, Latin Small Letter Turned R With Hook / Latin Small Letter Turned R Hook
+{0x6906, 0x2b26, 0xDE1F'D835}, // U+1D61F, 𝘟, \isansX, Mathematical Sans-Serif Italic Capital X
+{0x6605, 0x2773, 0xDD30'D835}, // U+1D530, 𝔰, \fraks, Mathematical Fraktur Small S
+{0x6203, 0x0a41, 0xDC02'D835}, // U+1D402, 𝐂, \bfC, Mathematical Bold Capital C
+{0x6907, 0x2c19, 0xDEE2'D835}, // U+1D6E2, 𝛢, \itAlpha, Mathematical Italic Capital Alpha
+{0x6208, 0x19b4, 0xDF66'D835}, // U+1D766, 𝝦, \bsansRho, Mathematical Sans-Serif Bold Capital Rho
+{0x7209, 0x3fbc, 0x263D}, // ☽, \rightmoon, First Quarter Moon
+{0x620a, 0x0e4f, 0xDEDD'D835}, // U+1D6DD, 𝛝, \bfvartheta, Mathematical Bold Theta Symbol
+{0x6c08, 0x337e, 0x231F}, // ⌟, \lrcorner, Bottom Right Corner
+{0x6905, 0x2c50, 0xDEE8'D835}, // U+1D6E8, 𝛨, \itEta, Mathematical Italic Capital Eta
+{0x5a04, 0x0586, 0x01B5}, // Ƶ, \Zbar, Latin Capital Letter Z With Stroke / Latin Capital Letter Z Bar
+{0x6503, 0x2462, 0x2113}, // ℓ, \ell, Script Small L
+{0x7210, 0x3ec6, 0x2B44}, // ⭄, \rightarrowsupset, Rightwards Arrow Through Superset
+{0x7305, 0x458c, 0x25EA}, // ◪, \sqfse, Square With Lower Right Diagonal Half Black
+{0x6e0c, 0x39c2, 0x21F8}, // ⇸, \nvrightarrow, Rightwards Arrow With Vertical Stroke
+{0x5003, 0x03ae, 0x03A6}, // Φ, \Phi, Greek Capital Letter Phi
+{0x700f, 0x3c2b, 0x2A5E}, // ⩞, \perspcorrespond, Logical And With Double Overbar
+{0x7004, 0x3d48, 0x220F}, // ∏, \prod, N-Ary Product
+{0x5304, 0x04ef, 0x2ABC}, // ⪼, \Succ, Double Succeeds
+{0x770c, 0x50cc, 0x2A5A}, // ⩚, \wedgemidvert, Logical And With Middle Stem
+{0x730b, 0x451c, 0x25E6}, // ◦, \smwhtcircle, White Bullet
+{0x6208, 0x10f9, 0xDF40'D835}, // U+1D740, 𝝀, \bilambda, Mathematical Bold Italic Small Lamda
+{0x5f02, 0x06ee, 0x2098}, // ₘ, \_m, Latin Subscript Small Letter M
+{0x5e02, 0x05d5, 0x1D36}, // ᴶ, \^J, Modifier Letter Capital J
+{0x740d, 0x48bc, 0x20E8}, // ⃨, \threeunderdot, Combining Triple Underdot
+{0x6e09, 0x3900, 0x2289}, // ⊉, \nsupseteq, Neither A Superset Of Nor Equal To
+{0x7306, 0x4761, 0x2AD5}, // ⫕, \subsub, Subset Above Subset
+{0x5e02, 0x0661, 0x207F}, // ⁿ, \^n, Superscript Latin Small Letter N
+{0x7306, 0x459c, 0x2A16}, // ⨖, \sqrint, Quaternion Integral Operator
+{0x640e, 0x219d, 0x21C5}, // ⇅, \dblarrowupdown, Upwards Arrow Leftwards Of Downwards Arrow / Up Arrow Left Of Down Arrow
+{0x6203, 0x095c, 0xDD5A'D835}, // U+1D55A, 𝕚, \bbi, Mathematical Double-Struck Small I
+{0x6204, 0x08f1, 0x213F}, // ℿ, \bbPi, Double-Struck Capital Pi
+{0x6605, 0x26bf, 0xDD12'D835}, // U+1D512, 𝔒, \frakO, Mathematical Fraktur Capital O
+{0x6903, 0x2ccf, 0xDC44'D835}, // U+1D444, 𝑄, \itQ, Mathematical Italic Capital Q
+{0x6203, 0x1151, 0xDC92'D835}, // U+1D492, 𝒒, \biq, Mathematical Bold Italic Small Q
+{0x7304, 0x42da, 0xDC9F'D835}, // U+1D49F, 𝒟, \scrD, Mathematical Script Capital D
+{0x6203, 0x0bc8, 0xDC23'D835}, // U+1D423, 𝐣, \bfj, Mathematical Bold Small J
+{0x6208, 0x198c, 0xDF6B'D835}, // U+1D76B, 𝝫, \bsansPhi, Mathematical Sans-Serif Bold Capital Phi
+{0x7708, 0x50b4, 0x27D1}, // ⟑, \wedgedot, And With Dot
+{0x7409, 0x48e3, 0x224B}, // ≋, \tildetrpl, Triple Tilde
+{0x6208, 0x1e3d, 0x25CE}, // ◎, \bullseye, Bullseye
+{0x6204, 0x0abe, 0xDEB4'D835}, // U+1D6B4, 𝚴, \bfNu, Mathematical Bold Capital Nu
+{0x4c11, 0x01d0, 0x2959}, // ⥙, \LeftDownVectorBar, Downwards Harpoon With Barb Left To Bar
+{0x6203, 0x0e5a, 0xDC30'D835}, // U+1D430, 𝐰, \bfw, Mathematical Bold Small W
+{0x620a, 0x1a3a, 0xDF70'D835}, // U+1D770, 𝝰, \bsansalpha, Mathematical Sans-Serif Bold Small Alpha
+{0x620c, 0x18d5, 0xDF5A'D835}, // U+1D75A, 𝝚, \bsansEpsilon, Mathematical Sans-Serif Bold Capital Epsilon
+{0x6205, 0x1df0, 0xDD02'D835}, // U+1D502, 𝔂, \bscry, Mathematical Bold Script Small Y
+{0x620b, 0x177f, 0x2B2E}, // ⬮, \blkvertoval, Black Vertical Ellipse
+{0x7305, 0x427a, 0xDDD0'D835}, // U+1D5D0, 𝗐, \sansw, Mathematical Sans-Serif Small W
+{0x6203, 0x0ad9, 0xDC0F'D835}, // U+1D40F, 𝐏, \bfP, Mathematical Bold Capital P
+{0x6203, 0x0926, 0xDD54'D835}, // U+1D554, 𝕔, \bbc, Mathematical Double-Struck Small C
+{0x6203, 0x08b1, 0x2102}, // ℂ, \bbC, Double-Struck Capital C / Double-Struck C
+{0x6203, 0x0e67, 0xDC32'D835}, // U+1D432, 𝐲, \bfy, Mathematical Bold Small Y
+{0x740d, 0x49ad, 0x25B7}, // ▷, \triangleright, White Right-Pointing Triangle / White Right Pointing Triangle
+{0x7405, 0x48d4, 0x0303}, // ̃, \tilde, Combining Tilde / Non-Spacing Tilde
+{0x620c, 0x0847, 0x21E4}, // ⇤, \barleftarrow, Leftwards Arrow To Bar / Left Arrow To Bar
+{0x6213, 0x16b1, 0x25D6}, // ◖, \blacklefthalfcircle, Left Half Black Circle
+{0x6205, 0x1d48, 0xDCE6'D835}, // U+1D4E6, 𝓦, \bscrW, Mathematical Bold Script Capital W
+{0x6c0f, 0x309f, 0x21C6}, // ⇆, \leftrightarrows, Leftwards Arrow Over Rightwards Arrow / Left Arrow Over Right Arrow
+{0x6214, 0x164a, 0x2688}, // ⚈, \blackcircledrightdot, Black Circle With White Dot Right
+{0x7309, 0x4826, 0x2AC6}, // ⫆, \supseteqq, Superset Of Above Equals Sign
+{0x770b, 0x5143, 0x2B2D}, // ⬭, \whthorzoval, White Horizontal Ellipse
+{0x7505, 0x4db1, 0x2A1B}, // ⨛, \upint, Integral With Overbar
+{0x6c0f, 0x2f81, 0x297A}, // ⥺, \leftarrowsubset, Leftwards Arrow Through Subset
+{0x7307, 0x4701, 0x2AC1}, // ⫁, \submult, Subset With Multiplication Sign Below
+{0x6208, 0x18b3, 0xDF6C'D835}, // U+1D76C, 𝝬, \bsansChi, Mathematical Sans-Serif Bold Capital Chi
+{0x6206, 0x1a22, 0xDDED'D835}, // U+1D5ED, 𝗭, \bsansZ, Mathematical Sans-Serif Bold Capital Z
+{0x650e, 0x258f, 0x2B40}, // ⭀, \equalleftarrow, Equals Sign Above Leftwards Arrow
+{0x6413, 0x2166, 0x296B}, // ⥫, \dashleftharpoondown, Leftwards Harpoon With Barb Down Below Long Dash
+{0x720f, 0x4007, 0x21DD}, // ⇝, \rightsquigarrow, Rightwards Squiggle Arrow / Right Squiggle Arrow
+{0x6205, 0x1d06, 0xDCDB'D835}, // U+1D4DB, 𝓛, \bscrL, Mathematical Bold Script Capital L
+{0x7305, 0x442f, 0x2A9F}, // ⪟, \simlE, Similar Above Less-Than Above Equals Sign
+{0x6c0d, 0x2f54, 0x2977}, // ⥷, \leftarrowless, Leftwards Arrow Through Less-Than
+{0x6c05, 0x33d0, 0x0278}, // ɸ, \ltphi, Latin Small Letter Phi
+{0x6205, 0x1d78, 0xDCEE'D835}, // U+1D4EE, 𝓮, \bscre, Mathematical Bold Script Small E
+{0x6f08, 0x3b2f, 0x22B6}, // ⊶, \original, Original Of
+{0x6d07, 0x33f7, 0x2720}, // ✠, \maltese, Maltese Cross
+{0x5e02, 0x060c, 0x1D9C}, // ᶜ, \^c, Modifier Letter Small C
+{0x6203, 0x0af2, 0xDC11'D835}, // U+1D411, 𝐑, \bfR, Mathematical Bold Capital R
+{0x6c09, 0x319c, 0x2AF9}, // ⫹, \leqqslant, Double-Line Slanted Less-Than Or Equal To
+{0x7402, 0x4888, 0x00FE}, // þ, \th, Latin Small Letter Thorn
+{0x6207, 0x10ed, 0xDF3F'D835}, // U+1D73F, 𝜿, \bikappa, Mathematical Bold Italic Small Kappa
+{0x5e02, 0x0638, 0x1D4D}, // ᵍ, \^g, Modifier Letter Small G
+{0x6c13, 0x331a, 0x27FF}, // ⟿, \longrightsquigarrow, Long Rightwards Squiggle Arrow
+{0x6d02, 0x3607, 0x2213}, // ∓, \mp, Minus-Or-Plus Sign
+{0x5f02, 0x06ff, 0x1D63}, // ᵣ, \_r, Latin Subscript Small Letter R
+{0x6203, 0x0f37, 0xDC78'D835}, // U+1D478, 𝑸, \biQ, Mathematical Bold Italic Capital Q
+{0x6203, 0x090a, 0xDD4D'D835}, // U+1D54D, 𝕍, \bbV, Mathematical Double-Struck Capital V
+{0x6906, 0x2bb2, 0xDE33'D835}, // U+1D633, 𝘳, \isansr, Mathematical Sans-Serif Italic Small R
+{0x6206, 0x18bc, 0xDDD7'D835}, // U+1D5D7, 𝗗, \bsansD, Mathematical Sans-Serif Bold Capital D
+{0x5e02, 0x05e7, 0x1D3E}, // ᴾ, \^P, Modifier Letter Capital P
+{0x6c03, 0x3193, 0x2264}, // ≤, \leq, Less-Than Or Equal To / Less Than Or Equal To
+{0x6207, 0x0dbf, 0xDFD5'D835}, // U+1D7D5, 𝟕, \bfseven, Mathematical Bold Digit Seven
+{0x7513, 0x4cb2, 0x034D}, // ͍, \underleftrightarrow, Combining Left Right Arrow Below
+{0x6c0d, 0x2fd8, 0x21E0}, // ⇠, \leftdasharrow, Leftwards Dashed Arrow / Left Dashed Arrow
+{0x730b, 0x4510, 0x2B52}, // ⭒, \smwhitestar, White Small Star
+{0x6906, 0x2bab, 0xDE32'D835}, // U+1D632, 𝘲, \isansq, Mathematical Sans-Serif Italic Small Q
+{0x620a, 0x161c, 0xDF51'D835}, // U+1D751, 𝝑, \bivartheta, Mathematical Bold Italic Theta Symbol
+{0x5305, 0x04cf, 0x03A3}, // Σ, \Sigma, Greek Capital Letter Sigma
+{0x6209, 0x12d7, 0xDFA3'D835}, // U+1D7A3, 𝞣, \bisansTau, Mathematical Sans-Serif Bold Italic Capital Tau
+{0x6207, 0x1a13, 0xDF63'D835}, // U+1D763, 𝝣, \bsansXi, Mathematical Sans-Serif Bold Capital Xi
+{0x4413, 0x00ee, 0x2950}, // ⥐, \DownLeftRightVector, Left Barb Down Right Barb Down Harpoon
+{0x6206, 0x19fe, 0xDDE9'D835}, // U+1D5E9, 𝗩, \bsansV, Mathematical Sans-Serif Bold Capital V
+{0x5e02, 0x05c0, 0x1D2C}, // ᴬ, \^A, Modifier Letter Capital A
+{0x6204, 0x1e2a, 0x026C}, // ɬ, \btdl, Latin Small Letter L With Belt / Latin Small Letter L Belt
+{0x750b, 0x4d28, 0x2195}, // ↕, \updownarrow, Up Down Arrow
+{0x6908, 0x2dad, 0xDF06'D835}, // U+1D706, 𝜆, \itlambda, Mathematical Italic Small Lamda
+{0x6908, 0x2e77, 0xDF1A'D835}, // U+1D71A, 𝜚, \itvarrho, Mathematical Italic Rho Symbol
+{0x6207, 0x1e4d, 0x2AAE}, // ⪮, \bumpeqq, Equals Sign With Bumpy Above
+{0x7307, 0x47d7, 0x2AD8}, // ⫘, \supdsub, Superset Beside And Joined By Dash With Subset
+{0x620b, 0x07f8, 0x2037}, // ‷, \backppprime, Reversed Triple Prime
+{0x6206, 0x1e36, 0x2022}, // •, \bullet, Bullet
+{0x6208, 0x18e2, 0xDF5C'D835}, // U+1D75C, 𝝜, \bsansEta, Mathematical Sans-Serif Bold Capital Eta
+{0x7308, 0x445a, 0x223F}, // ∿, \sinewave, Sine Wave
+{0x6203, 0x0aee, 0xDC10'D835}, // U+1D410, 𝐐, \bfQ, Mathematical Bold Capital Q
+{0x6905, 0x2e23, 0xDF0F'D835}, // U+1D70F, 𝜏, \ittau, Mathematical Italic Small Tau
+{0x6206, 0x0d37, 0xDD8E'D835}, // U+1D58E, 𝖎, \bfraki, Mathematical Bold Fraktur Small I
+{0x6903, 0x2d29, 0xDC4E'D835}, // U+1D44E, 𝑎, \ita, Mathematical Italic Small A
+{0x4505, 0x016b, 0x2A75}, // ⩵, \Equal, Two Consecutive Equals Signs
+{0x7403, 0x4a31, 0xDE70'D835}, // U+1D670, 𝙰, \ttA, Mathematical Monospace Capital A
+{0x730c, 0x4640, 0x25F1}, // ◱, \squarellquad, White Square With Lower Left Quadrant
+{0x6e0b, 0x3a3e, 0x2932}, // ⤲, \nwovnearrow, North West Arrow Crossing North East Arrow
+{0x6903, 0x2d56, 0xDC52'D835}, // U+1D452, 𝑒, \ite, Mathematical Italic Small E
+{0x7305, 0x4256, 0xDDCD'D835}, // U+1D5CD, 𝗍, \sanst, Mathematical Sans-Serif Small T
+{0x6805, 0x2959, 0x2302}, // ⌂, \house, House
+{0x6c09, 0x2f14, 0x2190}, // ←, \leftarrow, Leftwards Arrow / Left Arrow
+{0x620b, 0x144a, 0xDFC2'D835}, // U+1D7C2, 𝟂, \bisansomega, Mathematical Sans-Serif Bold Italic Small Omega
+{0x6705, 0x2817, 0x2137}, // ℷ, \gimel, Gimel Symbol / Third Transfinite Cardinal
+{0x6106, 0x075d, 0x299F}, // ⦟, \angdnr, Acute Angle
+{0x6405, 0x218f, 0x22A3}, // ⊣, \dashv, Left Tack
+{0x6f02, 0x3a85, 0x0153}, // œ, \oe, Latin Small Ligature Oe / Latin Small Letter O E
+{0x6206, 0x108b, 0x27D9}, // ⟙, \bigtop, Large Down Tack
+{0x6c0d, 0x2f91, 0x21A2}, // ↢, \leftarrowtail, Leftwards Arrow With Tail / Left Arrow With Tail
+{0x7006, 0x3c79, 0x210E}, // ℎ, \planck, Planck Constant
+{0x6e12, 0x39e0, 0x2B34}, // ⬴, \nvtwoheadleftarrow, Leftwards Two-Headed Arrow With Vertical Stroke
+{0x6309, 0x2031, 0x2A0F}, // ⨏, \clockoint, Integral Average With Slash
+{0x7403, 0x4a89, 0xDE86'D835}, // U+1D686, 𝚆, \ttW, Mathematical Monospace Capital W
+{0x6205, 0x1da8, 0xDCF6'D835}, // U+1D4F6, 𝓶, \bscrm, Mathematical Bold Script Small M
+{0x730c, 0x44df, 0x2B2A}, // ⬪, \smblklozenge, Black Small Lozenge
+{0x6205, 0x1d42, 0xDCE5'D835}, // U+1D4E5, 𝓥, \bscrV, Mathematical Bold Script Capital V
+{0x750a, 0x4dfe, 0x21C8}, // ⇈, \upuparrows, Upwards Paired Arrows / Up Paired Arrows
+{0x760c, 0x4f91, 0xFE00'228B}, // ⊋︀, \varsupsetneq, Superset Of With Not Equal To / Superset Of Or Not Equal To + Variation Selector-1
+{0x7312, 0x44b4, 0x25B9}, // ▹, \smalltriangleright, White Right-Pointing Small Triangle / White Right Pointing Small Triangle
+{0x6906, 0x2afc, 0xDE19'D835}, // U+1D619, 𝘙, \isansR, Mathematical Sans-Serif Italic Capital R
+{0x6605, 0x2677, 0x212D}, // ℭ, \frakC, Black-Letter Capital C / Black-Letter C
+{0x6c0e, 0x333c, 0x21AC}, // ↬, \looparrowright, Rightwards Arrow With Loop / Right Arrow With Loop
+{0x6203, 0x0bb9, 0xDC21'D835}, // U+1D421, 𝐡, \bfh, Mathematical Bold Small H
+{0x6904, 0x2c9f, 0xDEEE'D835}, // U+1D6EE, 𝛮, \itNu, Mathematical Italic Capital Nu
+{0x6708, 0x27da, 0x2A7E}, // ⩾, \geqslant, Greater-Than Or Slanted Equal To
+{0x6903, 0x2ce9, 0xDC47'D835}, // U+1D447, 𝑇, \itT, Mathematical Italic Capital T
+{0x6205, 0x1ce8, 0xDCD6'D835}, // U+1D4D6, 𝓖, \bscrG, Mathematical Bold Script Capital G
+{0x5e02, 0x05bd, 0x207C}, // ⁼, \^=, Superscript Equals Sign
+{0x6209, 0x0b75, 0xDFCB'D835}, // U+1D7CB, 𝟋, \bfdigamma, Mathematical Bold Small Digamma
+{0x6d06, 0x35f6, 0x22A7}, // ⊧, \models, Models
+{0x6e0f, 0x37c7, 0x21AE}, // ↮, \nleftrightarrow, Left Right Arrow With Stroke
+{0x6f09, 0x3b7d, 0x23DE}, // ⏞, \overbrace, Top Curly Bracket
+{0x620a, 0x1a6d, 0xDF73'D835}, // U+1D773, 𝝳, \bsansdelta, Mathematical Sans-Serif Bold Small Delta
+{0x720d, 0x3fd5, 0x2B54}, // ⭔, \rightpentagon, White Right-Pointing Pentagon
+{0x6203, 0x0b39, 0xDC18'D835}, // U+1D418, 𝐘, \bfY, Mathematical Bold Capital Y
+{0x6e07, 0x3871, 0x0338'2AAF}, // ⪯̸, \npreceq, Precedes Above Single-Line Equals Sign + Combining Long Solidus Overlay / Non-Spacing Long Slash Overlay
+{0x4c0d, 0x01f2, 0x295A}, // ⥚, \LeftTeeVector, Leftwards Harpoon With Barb Up From Bar
+{0x6505, 0x251b, 0x225D}, // ≝, \eqdef, Equal To By Definition
+{0x5e02, 0x064e, 0x02B2}, // ʲ, \^j, Modifier Letter Small J
+{0x7509, 0x4e11, 0x03D0}, // ϐ, \upvarbeta, Greek Beta Symbol / Greek Small Letter Curled Beta
+{0x6707, 0x2865, 0x2A7C}, // ⩼, \gtquest, Greater-Than With Question Mark Above
+{0x6207, 0x1223, 0xDE47'D835}, // U+1D647, 𝙇, \bisansL, Mathematical Sans-Serif Bold Italic Capital L
+{0x6903, 0x2c92, 0xDC40'D835}, // U+1D440, 𝑀, \itM, Mathematical Italic Capital M
+{0x7403, 0x4ae3, 0xDE97'D835}, // U+1D697, 𝚗, \ttn, Mathematical Monospace Small N
+{0x620a, 0x1c59, 0xDF8F'D835}, // U+1D78F, 𝞏, \bsansvarpi, Mathematical Sans-Serif Bold Pi Symbol
+{0x730a, 0x4744, 0x2ACB}, // ⫋, \subsetneqq, Subset Of Above Not Equal To
+{0x6906, 0x2c6e, 0xDEEA'D835}, // U+1D6EA, 𝛪, \itIota, Mathematical Italic Capital Iota
+{0x4c0a, 0x0268, 0x21DA}, // ⇚, \Lleftarrow, Leftwards Triple Arrow / Left Triple Arrow
+{0x6207, 0x157c, 0xDE6D'D835}, // U+1D66D, 𝙭, \bisansx, Mathematical Sans-Serif Bold Italic Small X
+{0x5e02, 0x059c, 0x207B}, // ⁻, \^-, Superscript Minus / Superscript Hyphen-Minus
+{0x5212, 0x040f, 0x2955}, // ⥕, \RightDownVectorBar, Downwards Harpoon With Barb Right To Bar
+{0x6203, 0x0b3d, 0xDC19'D835}, // U+1D419, 𝐙, \bfZ, Mathematical Bold Capital Z
+{0x6408, 0x234b, 0x2A30}, // ⨰, \dottimes, Multiplication Sign With Dot Above
+{0x740a, 0x4b51, 0x2129}, // ℩, \turnediota, Turned Greek Small Letter Iota
+{0x6203, 0x08fa, 0x211D}, // ℝ, \bbR, Double-Struck Capital R / Double-Struck R
+{0x6c0e, 0x3163, 0x22CB}, // ⋋, \leftthreetimes, Left Semidirect Product
+{0x6210, 0x16d2, 0x25C4}, // ◄, \blackpointerleft, Black Left-Pointing Pointer / Black Left Pointing Pointer
+{0x4409, 0x014c, 0x21D3}, // ⇓, \Downarrow, Downwards Double Arrow / Down Double Arrow
+{0x620a, 0x15d4, 0xDF2D'D835}, // U+1D72D, 𝜭, \bivarTheta, Mathematical Bold Italic Capital Theta Symbol
+{0x6e0b, 0x3964, 0x2902}, // ⤂, \nvLeftarrow, Leftwards Double Arrow With Vertical Stroke
+{0x6206, 0x0d84, 0xDD99'D835}, // U+1D599, 𝖙, \bfrakt, Mathematical Bold Fraktur Small T
+{0x6906, 0x2aaf, 0xDE0E'D835}, // U+1D60E, 𝘎, \isansG, Mathematical Sans-Serif Italic Capital G
+{0x7307, 0x4224, 0xDFE3'D835}, // U+1D7E3, 𝟣, \sansone, Mathematical Sans-Serif Digit One
+{0x5305, 0x04d5, 0x2A4E}, // ⩎, \Sqcap, Double Square Intersection
+{0x6207, 0x1b18, 0xDF7B'D835}, // U+1D77B, 𝝻, \bsansmu, Mathematical Sans-Serif Bold Small Mu
+{0x4e02, 0x02cf, 0x014A}, // Ŋ, \NG, Latin Capital Letter Eng
+{0x6704, 0x2829, 0x0294}, // ʔ, \glst, Latin Letter Glottal Stop
+{0x6208, 0x0e3b, 0xDEE0'D835}, // U+1D6E0, 𝛠, \bfvarrho, Mathematical Bold Rho Symbol
+{0x5f02, 0x06c4, 0x208C}, // ₌, \_=, Subscript Equals Sign
+{0x6205, 0x0f3f, 0xDF2C'D835}, // U+1D72C, 𝜬, \biRho, Mathematical Bold Italic Capital Rho
+{0x6205, 0x1db4, 0xDCF8'D835}, // U+1D4F8, 𝓸, \bscro, Mathematical Bold Script Small O
+{0x7305, 0x4151, 0xDDAC'D835}, // U+1D5AC, 𝖬, \sansM, Mathematical Sans-Serif Capital M
+{0x7304, 0x45a3, 0x221A}, // √, \sqrt, Square Root
+{0x760a, 0x5013, 0x2A5B}, // ⩛, \veemidvert, Logical Or With Middle Stem
+{0x5802, 0x057f, 0x039E}, // Ξ, \Xi, Greek Capital Letter Xi
+{0x6206, 0x0cb2, 0xDD7B'D835}, // U+1D57B, 𝕻, \bfrakP, Mathematical Bold Fraktur Capital P
+{0x6906, 0x2b0a, 0xDE1B'D835}, // U+1D61B, 𝘛, \isansT, Mathematical Sans-Serif Italic Capital T
+{0x6906, 0x2eab, 0xDF01'D835}, // U+1D701, 𝜁, \itzeta, Mathematical Italic Small Zeta
+{0x620d, 0x1c7e, 0xDF8B'D835}, // U+1D78B, 𝞋, \bsansvartheta, Mathematical Sans-Serif Bold Theta Symbol
+{0x6e07, 0x3a36, 0x2196}, // ↖, \nwarrow, North West Arrow / Upper Left Arrow
+{0x6203, 0x0e03, 0xDC2F'D835}, // U+1D42F, 𝐯, \bfv, Mathematical Bold Small V
+{0x730e, 0x4678, 0x2B12}, // ⬒, \squaretopblack, Square With Top Half Black
+{0x6d05, 0x35cc, 0x2212}, // −, \minus, Minus Sign
+{0x5e02, 0x05a5, 0x00B2}, // ², \^2, Superscript Two / Superscript Digit Two
+{0x7402, 0x48fc, 0x2192}, // →, \to, Rightwards Arrow / Right Arrow
+{0x620d, 0x10a2, 0x25B3}, // △, \bigtriangleup, White Up-Pointing Triangle / White Up Pointing Triangle
+{0x7309, 0x473a, 0x228A}, // ⊊, \subsetneq, Subset Of With Not Equal To / Subset Of Or Not Equal To
+{0x6207, 0x1b89, 0xDF7F'D835}, // U+1D77F, 𝝿, \bsanspi, Mathematical Sans-Serif Bold Small Pi
+{0x6205, 0x1da2, 0xDCF5'D835}, // U+1D4F5, 𝓵, \bscrl, Mathematical Bold Script Small L
+{0x7307, 0x43d6, 0x2198}, // ↘, \searrow, South East Arrow / Lower Right Arrow
+{0x6903, 0x2d7e, 0xDC56'D835}, // U+1D456, 𝑖, \iti, Mathematical Italic Small I
+{0x6208, 0x1439, 0xDFB6'D835}, // U+1D7B6, 𝞶, \bisansnu, Mathematical Sans-Serif Bold Italic Small Nu
+{0x7508, 0x4c6d, 0x0332}, // ̲, \underbar, Combining Low Line / Non-Spacing Underscore
+{0x6210, 0x1510, 0xDFAE'D835}, // U+1D7AE, 𝞮, \bisansvarepsilon, Mathematical Sans-Serif Bold Italic Small Epsilon
+{0x720c, 0x3e07, 0x29A5}, // ⦥, \revangleubar, Reversed Angle With Underbar
+{0x720d, 0x3e76, 0x21E5}, // ⇥, \rightarrowbar, Rightwards Arrow To Bar / Right Arrow To Bar
+{0x6903, 0x29e2, 0x222B}, // ∫, \int, Integral
+{0x6305, 0x202b, 0x25D1}, // ◑, \cirfr, Circle With Right Half Black
+{0x6c05, 0x3247, 0x264E}, // ♎, \libra, Libra
+{0x7310, 0x441e, 0x2B49}, // ⭉, \similarleftarrow, Tilde Operator Above Leftwards Arrow
+{0x7003, 0x3d73, 0x03C8}, // ψ, \psi, Greek Small Letter Psi
+{0x6c0f, 0x3153, 0x2B31}, // ⬱, \leftthreearrows, Three Leftwards Arrows
+{0x6204, 0x0ab5, 0xDEB3'D835}, // U+1D6B3, 𝚳, \bfMu, Mathematical Bold Capital Mu
+{0x7408, 0x4c31, 0x266B}, // ♫, \twonotes, Beamed Eighth Notes / Barred Eighth Notes
+{0x6203, 0x0ece, 0xDC6F'D835}, // U+1D46F, 𝑯, \biH, Mathematical Bold Italic Capital H
+{0x5e06, 0x0678, 0x1DBF}, // ᶿ, \^theta, Modifier Letter Small Theta
+{0x620a, 0x19df, 0xDF5D'D835}, // U+1D75D, 𝝝, \bsansTheta, Mathematical Sans-Serif Bold Capital Theta
+{0x6702, 0x2808, 0x226B}, // ≫, \gg, Much Greater-Than / Much Greater Than
+{0x5004, 0x03b5, 0x2ABB}, // ⪻, \Prec, Double Precedes
+{0x630a, 0x209a, 0x2201}, // ∁, \complement, Complement
+{0x6d0f, 0x352e, 0x29A8}, // ⦨, \measanglerutone, Measured Angle With Open Arm Ending In Arrow Pointing Up And Right
+{0x7405, 0x4a21, 0x0252}, // ɒ, \trnsa, Latin Small Letter Turned Alpha / Latin Small Letter Turned Script A
+{0x5e02, 0x05c6, 0x1D30}, // ᴰ, \^D, Modifier Letter Capital D
+{0x6d03, 0x35ab, 0x2223}, // ∣, \mid, Divides
+{0x4108, 0x0067, 0x212B}, // Å, \Angstrom, Angstrom Sign / Angstrom Unit
+{0x6402, 0x21f1, 0x00F0}, // ð, \dh, Latin Small Letter Eth
+{0x630c, 0x1f89, 0x25F5}, // ◵, \circlellquad, White Circle With Lower Left Quadrant
+{0x750f, 0x4cc6, 0x20EF}, // ⃯, \underrightarrow, Combining Right Arrow Below
+{0x6205, 0x1d00, 0xDCDA'D835}, // U+1D4DA, 𝓚, \bscrK, Mathematical Bold Script Capital K
+{0x7406, 0x4ab9, 0xDFFB'D835}, // U+1D7FB, 𝟻, \ttfive, Mathematical Monospace Digit Five
+{0x620f, 0x1c2f, 0xDF74'D835}, // U+1D774, 𝝴, \bsansvarepsilon, Mathematical Sans-Serif Bold Small Epsilon
+{0x7006, 0x3c68, 0x2653}, // ♓, \pisces, Pisces
+{0x7403, 0x4ad3, 0xDE93'D835}, // U+1D693, 𝚓, \ttj, Mathematical Monospace Small J
+{0x6203, 0x0e89, 0xDC69'D835}, // U+1D469, 𝑩, \biB, Mathematical Bold Italic Capital B
+{0x6605, 0x267d, 0xDD07'D835}, // U+1D507, 𝔇, \frakD, Mathematical Fraktur Capital D
+{0x6203, 0x0f9d, 0xDC83'D835}, // U+1D483, 𝒃, \bib, Mathematical Bold Italic Small B
+{0x6206, 0x0d06, 0xDD87'D835}, // U+1D587, 𝖇, \bfrakb, Mathematical Bold Fraktur Small B
+{0x6708, 0x27f8, 0x2A84}, // ⪄, \gesdotol, Greater-Than Or Slanted Equal To With Dot Above Left
+{0x6f06, 0x3bb4, 0x0309}, // ̉, \ovhook, Combining Hook Above / Non-Spacing Hook Above
+{0x6205, 0x1cca, 0xDCD1'D835}, // U+1D4D1, 𝓑, \bscrB, Mathematical Bold Script Capital B
+{0x640f, 0x23fe, 0x21AF}, // ↯, \downzigzagarrow, Downwards Zigzag Arrow / Down Zigzag Arrow
+{0x620e, 0x1556, 0xDFBB'D835}, // U+1D7BB, 𝞻, \bisansvarsigma, Mathematical Sans-Serif Bold Italic Small Final Sigma
+{0x6e0d, 0x3915, 0x22EA}, // ⋪, \ntriangleleft, Not Normal Subgroup Of
+{0x7003, 0x3c56, 0x20A7}, // ₧, \pes, Peseta Sign
+{0x6206, 0x0c5e, 0xDD6F'D835}, // U+1D56F, 𝕯, \bfrakD, Mathematical Bold Fraktur Capital D
+{0x7403, 0x4872, 0x03C4}, // τ, \tau, Greek Small Letter Tau
+{0x7004, 0x3c26, 0x27C2}, // ⟂, \perp, Perpendicular
+{0x6203, 0x0f91, 0xDC82'D835}, // U+1D482, 𝒂, \bia, Mathematical Bold Italic Small A
+{0x6205, 0x0c3b, 0xDED9'D835}, // U+1D6D9, 𝛙, \bfpsi, Mathematical Bold Small Psi
+{0x640c, 0x2331, 0x25CC}, // ◌, \dottedcircle, Dotted Circle
+{0x6c08, 0x31a6, 0x2A7D}, // ⩽, \leqslant, Less-Than Or Slanted Equal To
+{0x7007, 0x3c80, 0x2A25}, // ⨥, \plusdot, Plus Sign With Dot Below
+{0x730a, 0x4845, 0x2AC0}, // ⫀, \supsetplus, Superset With Plus Sign Below
+{0x7404, 0x4922, 0x2929}, // ⤩, \tosa, South East Arrow And South West Arrow
+{0x730c, 0x464d, 0x25F2}, // ◲, \squarelrquad, White Square With Lower Right Quadrant
+{0x7709, 0x50d9, 0x2A51}, // ⩑, \wedgeodot, Logical And With Dot Above
+{0x7305, 0x40fb, 0xDDA2'D835}, // U+1D5A2, 𝖢, \sansC, Mathematical Sans-Serif Capital C
+{0x6903, 0x2d6e, 0xDC54'D835}, // U+1D454, 𝑔, \itg, Mathematical Italic Small G
+{0x7305, 0x4501, 0x2323}, // ⌣, \smile, Smile
+{0x6c0f, 0x336e, 0x25E2}, // ◢, \lrblacktriangle, Black Lower Right Triangle
+{0x6107, 0x077b, 0x20E7}, // ⃧, \annuity, Combining Annuity Symbol
+{0x6205, 0x1dc6, 0xDCFB'D835}, // U+1D4FB, 𝓻, \bscrr, Mathematical Bold Script Small R
+{0x620c, 0x1c0d, 0xDF84'D835}, // U+1D784, 𝞄, \bsansupsilon, Mathematical Sans-Serif Bold Small Upsilon
+{0x7611, 0x4e74, 0x23CE}, // ⏎, \varcarriagereturn, Return Symbol
+{0x6206, 0x0d5a, 0xDD93'D835}, // U+1D593, 𝖓, \bfrakn, Mathematical Bold Fraktur Small N
+{0x6d0f, 0x34de, 0x29AF}, // ⦯, \measangledltosw, Measured Angle With Open Arm Ending In Arrow Pointing Left And Down
+{0x5307, 0x04c7, 0x21D8}, // ⇘, \Searrow, South East Double Arrow / Lower Right Double Arrow
+{0x6209, 0x0eae, 0xDF20'D835}, // U+1D720, 𝜠, \biEpsilon, Mathematical Bold Italic Capital Epsilon
+{0x6207, 0x127c, 0xDE4B'D835}, // U+1D64B, 𝙋, \bisansP, Mathematical Sans-Serif Bold Italic Capital P
+{0x7305, 0x40f5, 0xDDA1'D835}, // U+1D5A1, 𝖡, \sansB, Mathematical Sans-Serif Capital B
+{0x6203, 0x1627, 0xDC98'D835}, // U+1D498, 𝒘, \biw, Mathematical Bold Italic Small W
+{0x6f0b, 0x3b16, 0x00AA}, // ª, \ordfeminine, Feminine Ordinal Indicator
+{0x6205, 0x1d30, 0xDCE2'D835}, // U+1D4E2, 𝓢, \bscrS, Mathematical Bold Script Capital S
+{0x5e02, 0x05ba, 0x2079}, // ⁹, \^9, Superscript Nine / Superscript Digit Nine
+{0x7304, 0x434d, 0xDCB6'D835}, // U+1D4B6, 𝒶, \scra, Mathematical Script Small A
+{0x7403, 0x4a61, 0xDE7C'D835}, // U+1D67C, 𝙼, \ttM, Mathematical Monospace Capital M
+{0x7008, 0x3d31, 0x22E8}, // ⋨, \precnsim, Precedes But Not Equivalent To
+{0x6f04, 0x3aa6, 0x222E}, // ∮, \oint, Contour Integral
+{0x6203, 0x0b1a, 0xDC14'D835}, // U+1D414, 𝐔, \bfU, Mathematical Bold Capital U
+{0x4d06, 0x02c8, 0x2907}, // ⤇, \Mapsto, Rightwards Double Arrow From Bar
+{0x620d, 0x1802, 0x25E1}, // ◡, \botsemicircle, Lower Half Circle
+{0x6206, 0x1643, 0x290D}, // ⤍, \bkarow, Rightwards Double Dash Arrow
+{0x7403, 0x4b38, 0xDEA2'D835}, // U+1D6A2, 𝚢, \tty, Mathematical Monospace Small Y
+{0x7403, 0x4a5d, 0xDE7B'D835}, // U+1D67B, 𝙻, \ttL, Mathematical Monospace Capital L
+{0x6605, 0x269b, 0x2111}, // ℑ, \frakI, Black-Letter Capital I / Black-Letter I
+{0x6209, 0x1aa7, 0xDFF1'D835}, // U+1D7F1, 𝟱, \bsansfive, Mathematical Sans-Serif Bold Digit Five
+{0x7605, 0x503e, 0x02C8}, // ˈ, \verts, Modifier Letter Vertical Line
+{0x7316, 0x4463, 0x25C2}, // ◂, \smallblacktriangleleft, Black Left-Pointing Small Triangle / Black Left Pointing Small Triangle
+{0x6207, 0x0b00, 0xDEBA'D835}, // U+1D6BA, 𝚺, \bfSigma, Mathematical Bold Capital Sigma
+{0x660c, 0x2619, 0x292C}, // ⤬, \fdiagovrdiag, Falling Diagonal Crossing Rising Diagonal
+{0x6903, 0x2cba, 0xDC43'D835}, // U+1D443, 𝑃, \itP, Mathematical Italic Capital P
+{0x6206, 0x1a78, 0xDDF2'D835}, // U+1D5F2, 𝗲, \bsanse, Mathematical Sans-Serif Bold Small E
+{0x6e09, 0x384c, 0x2226}, // ∦, \nparallel, Not Parallel To
+{0x620c, 0x1978, 0xDF64'D835}, // U+1D764, 𝝤, \bsansOmicron, Mathematical Sans-Serif Bold Capital Omicron
+{0x7508, 0x4c52, 0x231C}, // ⌜, \ulcorner, Top Left Corner
+{0x4e12, 0x0310, 0x0338'29CF}, // ⧏̸, \NotLeftTriangleBar, Left Triangle Beside Vertical Bar + Combining Long Solidus Overlay / Non-Spacing Long Slash Overlay
+{0x5e02, 0x05cc, 0x1D33}, // ᴳ, \^G, Modifier Letter Capital G
+{0x6205, 0x0f31, 0xDF33'D835}, // U+1D733, 𝜳, \biPsi, Mathematical Bold Italic Capital Psi
+{0x6204, 0x0965, 0x2146}, // ⅆ, \bbid, Double-Struck Italic Small D
+{0x6906, 0x2abd, 0xDE10'D835}, // U+1D610, 𝘐, \isansI, Mathematical Sans-Serif Italic Capital I
+{0x6903, 0x2c66, 0xDC3B'D835}, // U+1D43B, 𝐻, \itH, Mathematical Italic Capital H
+{0x6907, 0x2d2d, 0xDEFC'D835}, // U+1D6FC, 𝛼, \italpha, Mathematical Italic Small Alpha
+{0x6206, 0x0d76, 0xDD97'D835}, // U+1D597, 𝖗, \bfrakr, Mathematical Bold Fraktur Small R
+{0x7607, 0x501e, 0x2A52}, // ⩒, \veeodot, Logical Or With Dot Above
+{0x6206, 0x0cea, 0xDD83'D835}, // U+1D583, 𝖃, \bfrakX, Mathematical Bold Fraktur Capital X
+{0x6e07, 0x38f8, 0x2285}, // ⊅, \nsupset, Not A Superset Of
+{0x6207, 0x13ac, 0xDE5B'D835}, // U+1D65B, 𝙛, \bisansf, Mathematical Sans-Serif Bold Italic Small F
+{0x6208, 0x0ef1, 0xDF26'D835}, // U+1D726, 𝜦, \biLambda, Mathematical Bold Italic Capital Lamda
+{0x7304, 0x439d, 0xDCC6'D835}, // U+1D4C6, 𝓆, \scrq, Mathematical Script Small Q
+{0x700b, 0x3c4a, 0x2030}, // ‰, \perthousand, Per Mille Sign
+{0x5f02, 0x0714, 0x1D64}, // ᵤ, \_u, Latin Subscript Small Letter U
+{0x5e02, 0x0691, 0x02E3}, // ˣ, \^x, Modifier Letter Small X
+{0x6203, 0x08c1, 0xDD3E'D835}, // U+1D53E, 𝔾, \bbG, Mathematical Double-Struck Capital G
+{0x6206, 0x0d0d, 0xDD88'D835}, // U+1D588, 𝖈, \bfrakc, Mathematical Bold Fraktur Small C
+{0x6404, 0x2434, 0x29F6}, // ⧶, \dsol, Solidus With Overbar
+{0x6206, 0x1a05, 0xDDEA'D835}, // U+1D5EA, 𝗪, \bsansW, Mathematical Sans-Serif Bold Capital W
+{0x6207, 0x1425, 0xDE63'D835}, // U+1D663, 𝙣, \bisansn, Mathematical Sans-Serif Bold Italic Small N
+{0x770b, 0x514f, 0x2B2F}, // ⬯, \whtvertoval, White Vertical Ellipse
+{0x7305, 0x42ae, 0x02D2}, // ˒, \sbrhr, Modifier Letter Centred Right Half Ring / Modifier Letter Centered Right Half Ring
+{0x5e08, 0x062c, 0x1D4B}, // ᵋ, \^epsilon, Modifier Letter Small Open E
+{0x7903, 0x51a2, 0x00A5}, // ¥, \yen, Yen Sign
+{0x6906, 0x2a8c, 0xDE09'D835}, // U+1D609, 𝘉, \isansB, Mathematical Sans-Serif Italic Capital B
+{0x6906, 0x2d8a, 0xDF04'D835}, // U+1D704, 𝜄, \itiota, Mathematical Italic Small Iota
+{0x7406, 0x4ac0, 0xDFFA'D835}, // U+1D7FA, 𝟺, \ttfour, Mathematical Monospace Digit Four
+{0x7605, 0x505a, 0x264D}, // ♍, \virgo, Virgo
+{0x7008, 0x3d56, 0x2313}, // ⌓, \profsurf, Segment
+{0x7404, 0x48ff, 0x2928}, // ⤨, \toea, North East Arrow And South East Arrow
+{0x6c11, 0x2f9f, 0x21FD}, // ⇽, \leftarrowtriangle, Leftwards Open-Headed Arrow
+{0x6208, 0x131b, 0xDF9D'D835}, // U+1D79D, 𝞝, \bisansXi, Mathematical Sans-Serif Bold Italic Capital Xi
+{0x6207, 0x1c9a, 0xDF7D'D835}, // U+1D77D, 𝝽, \bsansxi, Mathematical Sans-Serif Bold Small Xi
+{0x6209, 0x1ab1, 0xDFF0'D835}, // U+1D7F0, 𝟰, \bsansfour, Mathematical Sans-Serif Bold Digit Four
+{0x6907, 0x2e17, 0xDF0E'D835}, // U+1D70E, 𝜎, \itsigma, Mathematical Italic Small Sigma
+{0x6e07, 0x3616, 0x0338'224E}, // ≎̸, \nBumpeq, Geometrically Equivalent To + Combining Long Solidus Overlay / Non-Spacing Long Slash Overlay
+{0x620a, 0x18f9, 0xDF58'D835}, // U+1D758, 𝝘, \bsansGamma, Mathematical Sans-Serif Bold Capital Gamma
+{0x6e08, 0x3843, 0x233F}, // ⌿, \notslash, Apl Functional Symbol Slash Bar
+{0x7405, 0x4895, 0x03B8}, // θ, \theta, Greek Small Letter Theta
+{0x7303, 0x4507, 0x2AAA}, // ⪪, \smt, Smaller Than
+{0x720e, 0x3ed7, 0x21A3}, // ↣, \rightarrowtail, Rightwards Arrow With Tail / Right Arrow With Tail
+{0x6d08, 0x3408, 0x21A4}, // ↤, \mapsfrom, Leftwards Arrow From Bar / Left Arrow From Bar
+{0x620a, 0x1611, 0xDF47'D835}, // U+1D747, 𝝇, \bivarsigma, Mathematical Bold Italic Small Final Sigma
+{0x6506, 0x24ee, 0x2013}, // –, \endash, En Dash
+{0x6211, 0x1742, 0x25C0}, // ◀, \blacktriangleleft, Black Left-Pointing Triangle / Black Left Pointing Triangle
+{0x7212, 0x3f5d, 0x296C}, // ⥬, \rightharpoonupdash, Rightwards Harpoon With Barb Up Above Long Dash
+{0x6c0d, 0x332e, 0x21AB}, // ↫, \looparrowleft, Leftwards Arrow With Loop / Left Arrow With Loop
+{0x6206, 0x0d1b, 0xDD8A'D835}, // U+1D58A, 𝖊, \bfrake, Mathematical Bold Fraktur Small E
+{0x7304, 0x43bb, 0xDCCC'D835}, // U+1D4CC, 𝓌, \scrw, Mathematical Script Small W
+{0x6206, 0x1aec, 0xDDF8'D835}, // U+1D5F8, 𝗸, \bsansk, Mathematical Sans-Serif Bold Small K
+{0x770c, 0x50e3, 0x2A55}, // ⩕, \wedgeonwedge, Two Intersecting Logical And
+{0x4c10, 0x0210, 0x2951}, // ⥑, \LeftUpDownVector, Up Barb Left Down Barb Left Harpoon
+{0x6c09, 0x31e7, 0x22DA}, // ⋚, \lesseqgtr, Less-Than Equal To Or Greater-Than / Less Than Equal To Or Greater Than
+{0x7409, 0x4b47, 0x29A2}, // ⦢, \turnangle, Turned Angle
+{0x6206, 0x1e46, 0x224F}, // ≏, \bumpeq, Difference Between
+{0x7304, 0x4343, 0xDCB4'D835}, // U+1D4B4, 𝒴, \scrY, Mathematical Script Capital Y
+{0x7506, 0x4e28, 0x2645}, // ♅, \uranus, Uranus
+{0x6705, 0x285f, 0x2A7A}, // ⩺, \gtcir, Greater-Than With Circle Inside
+{0x7603, 0x4fee, 0x2228}, // ∨, \vee, Logical Or
+{0x7202, 0x3e27, 0x0322}, // ̢, \rh, Combining Retroflex Hook Below / Non-Spacing Retroflex Hook Below
+{0x6507, 0x2542, 0x2A99}, // ⪙, \eqqless, Double-Line Equal To Or Less-Than
+{0x720a, 0x3e2e, 0x221F}, // ∟, \rightangle, Right Angle
+{0x7107, 0x3d8f, 0x225F}, // ≟, \questeq, Questioned Equal To
+{0x7513, 0x4d98, 0x2963}, // ⥣, \upharpoonsleftright, Upwards Harpoon With Barb Left Beside Upwards Harpoon With Barb Right
+{0x6c04, 0x33b3, 0x2AA6}, // ⪦, \ltcc, Less-Than Closed By Curve
+{0x6203, 0x115f, 0xDC94'D835}, // U+1D494, 𝒔, \bis, Mathematical Bold Italic Small S
+{0x6203, 0x1638, 0xDC9B'D835}, // U+1D49B, 𝒛, \biz, Mathematical Bold Italic Small Z
+{0x5f02, 0x06d5, 0x2091}, // ₑ, \_e, Latin Subscript Small Letter E
+{0x630b, 0x210c, 0x22DF}, // ⋟, \curlyeqsucc, Equal To Or Succeeds
+{0x6e10, 0x39b1, 0x21F9}, // ⇹, \nvleftrightarrow, Left Right Arrow With Vertical Stroke
+{0x640d, 0x240e, 0x279B}, // ➛, \draftingarrow, Drafting Point Rightwards Arrow / Drafting Point Right Arrow
+{0x6206, 0x0d92, 0xDD9B'D835}, // U+1D59B, 𝖛, \bfrakv, Mathematical Bold Fraktur Small V
+{0x760f, 0x506d, 0x25AE}, // ▮, \vrectangleblack, Black Vertical Rectangle
+{0x7209, 0x4087, 0x27E7}, // ⟧, \rrbracket, Mathematical Right White Square Bracket
+{0x6203, 0x0958, 0xDD59'D835}, // U+1D559, 𝕙, \bbh, Mathematical Double-Struck Small H
+{0x7305, 0x40ef, 0xDDA0'D835}, // U+1D5A0, 𝖠, \sansA, Mathematical Sans-Serif Capital A
+{0x7307, 0x47e7, 0x27C9}, // ⟉, \suphsol, Superset Preceding Solidus
+{0x5903, 0x0582, 0x2144}, // ⅄, \Yup, Turned Sans-Serif Capital Y
+{0x6207, 0x0fb6, 0xDF39'D835}, // U+1D739, 𝜹, \bidelta, Mathematical Bold Italic Small Delta
+{0x6207, 0x12bb, 0xDE4E'D835}, // U+1D64E, 𝙎, \bisansS, Mathematical Sans-Serif Bold Italic Capital S
+{0x6906, 0x2b50, 0xDE25'D835}, // U+1D625, 𝘥, \isansd, Mathematical Sans-Serif Italic Small D
+{0x6506, 0x246d, 0x2014}, // —, \emdash, Em Dash
+{0x6907, 0x29ba, 0x27F9}, // ⟹, \implies, Long Rightwards Double Arrow
+{0x7507, 0x4ded, 0x03C5}, // υ, \upsilon, Greek Small Letter Upsilon
+{0x6606, 0x2644, 0x2200}, // ∀, \forall, For All
+{0x6208, 0x0e2a, 0xDED7'D835}, // U+1D6D7, 𝛗, \bfvarphi, Mathematical Bold Small Phi
+{0x7309, 0x4546, 0x2660}, // ♠, \spadesuit, Black Spade Suit
+{0x6311, 0x1ff5, 0x25D4}, // ◔, \circleurquadblack, Circle With Upper Right Quadrant Black
+{0x6906, 0x2be3, 0xDE3A'D835}, // U+1D63A, 𝘺, \isansy, Mathematical Sans-Serif Italic Small Y
+{0x6d08, 0x360d, 0x22B8}, // ⊸, \multimap, Multimap
+{0x6f0b, 0x3b50, 0x2A34}, // ⨴, \otimeslhrim, Multiplication Sign In Left Half Circle
+{0x7516, 0x4d43, 0x294D}, // ⥍, \updownharpoonleftright, Up Barb Left Down Barb Right Harpoon
+{0x6402, 0x22e9, 0x0111}, // đ, \dj, Latin Small Letter D With Stroke / Latin Small Letter D Bar
+{0x5e02, 0x059f, 0x2070}, // ⁰, \^0, Superscript Zero / Superscript Digit Zero
+{0x640f, 0x2215, 0x2B19}, // ⬙, \diamondbotblack, Diamond With Bottom Half Black
+{0x5403, 0x0506, 0x03A4}, // Τ, \Tau, Greek Capital Letter Tau
+{0x6d06, 0x3418, 0x21A5}, // ↥, \mapsup, Upwards Arrow From Bar / Up Arrow From Bar
+{0x6e0b, 0x3669, 0x21FA}, // ⇺, \nVleftarrow, Leftwards Arrow With Double Vertical Stroke
+{0x620f, 0x1795, 0x2592}, // ▒, \blockhalfshaded, Medium Shade
+{0x650d, 0x248a, 0x29B4}, // ⦴, \emptysetoarrl, Empty Set With Left Arrow Above
+{0x6208, 0x1b80, 0xDF8D'D835}, // U+1D78D, 𝞍, \bsansphi, Mathematical Sans-Serif Bold Phi Symbol
+{0x740d, 0x4988, 0x2A3A}, // ⨺, \triangleminus, Minus Sign In Triangle
+{0x7206, 0x3daf, 0x27E9}, // ⟩, \rangle, Mathematical Right Angle Bracket
+{0x5e02, 0x05b7, 0x2078}, // ⁸, \^8, Superscript Eight / Superscript Digit Eight
+{0x6406, 0x21fd, 0x2571}, // ╱, \diagup, Box Drawings Light Diagonal Upper Right To Lower Left / Forms Light Diagonal Upper Right To Lower Left
+{0x6906, 0x2b5e, 0xDE27'D835}, // U+1D627, 𝘧, \isansf, Mathematical Sans-Serif Italic Small F
+{0x7309, 0x4830, 0x228B}, // ⊋, \supsetneq, Superset Of With Not Equal To / Superset Of Or Not Equal To
+{0x6909, 0x29c5, 0x2206}, // ∆, \increment, Increment
+{0x6407, 0x21ac, 0x2021}, // ‡, \ddagger, Double Dagger
+{0x7714, 0x510b, 0x27C1}, // ⟁, \whiteinwhitetriangle, White Triangle Containing Small White Triangle
+{0x6d06, 0x35c5, 0x2A5F}, // ⩟, \minhat, Logical And With Underbar
+{0x6206, 0x093e, 0xDFDD'D835}, // U+1D7DD, 𝟝, \bbfive, Mathematical Double-Struck Digit Five
+{0x6404, 0x2317, 0x2026}, // …, \dots, Horizontal Ellipsis
+{0x6209, 0x0fc2, 0xDF50'D835}, // U+1D750, 𝝐, \biepsilon, Mathematical Bold Italic Epsilon Symbol
+{0x7304, 0x4366, 0xDCBB'D835}, // U+1D4BB, 𝒻, \scrf, Mathematical Script Small F
+{0x6206, 0x0f8a, 0xDF21'D835}, // U+1D721, 𝜡, \biZeta, Mathematical Bold Italic Capital Zeta
+{0x7306, 0x4850, 0x2AC8}, // ⫈, \supsim, Superset Of Above Tilde Operator
+{0x4c11, 0x01be, 0x2961}, // ⥡, \LeftDownTeeVector, Downwards Harpoon With Barb Left From Bar
+{0x7307, 0x46c9, 0x25A2}, // ▢, \squoval, White Square With Rounded Corners
+{0x720e, 0x3f4e, 0x21C0}, // ⇀, \rightharpoonup, Rightwards Harpoon With Barb Upwards / Right Harpoon With Barb Up
+{0x6203, 0x08d1, 0xDD40'D835}, // U+1D540, 𝕀, \bbI, Mathematical Double-Struck Capital I
+{0x6410, 0x224a, 0x2B16}, // ⬖, \diamondleftblack, Diamond With Left Half Black
+{0x6d09, 0x35fd, 0x2A0A}, // ⨊, \modtwosum, Modulo Two Sum
+{0x6205, 0x1dea, 0xDD01'D835}, // U+1D501, 𝔁, \bscrx, Mathematical Bold Script Small X
+{0x6203, 0x0ac3, 0xDC0E'D835}, // U+1D40E, 𝐎, \bfO, Mathematical Bold Capital O
+{0x6203, 0x09b8, 0xDD64'D835}, // U+1D564, 𝕤, \bbs, Mathematical Double-Struck Small S
+{0x5e02, 0x0635, 0x1DA0}, // ᶠ, \^f, Modifier Letter Small F
+{0x6207, 0x1120, 0xDF4E'D835}, // U+1D74E, 𝝎, \biomega, Mathematical Bold Italic Small Omega
+{0x6e03, 0x3745, 0x00AC}, // ¬, \neg, Not Sign
+{0x6206, 0x1a33, 0xDDEE'D835}, // U+1D5EE, 𝗮, \bsansa, Mathematical Sans-Serif Bold Small A
+{0x6903, 0x2c6a, 0xDC3C'D835}, // U+1D43C, 𝐼, \itI, Mathematical Italic Capital I
+{0x7007, 0x3bea, 0x2202}, // ∂, \partial, Partial Differential
+{0x7713, 0x50f7, 0x21EA}, // ⇪, \whitearrowupfrombar, Upwards White Arrow From Bar / White Up Arrow From Bar
+{0x6c0d, 0x2f73, 0x2946}, // ⥆, \leftarrowplus, Leftwards Arrow With Plus Below
+{0x6605, 0x2671, 0xDD05'D835}, // U+1D505, 𝔅, \frakB, Mathematical Fraktur Capital B
+{0x730b, 0x4145, 0x2142}, // ⅂, \sansLturned, Turned Sans-Serif Capital L
+{0x6207, 0x0b4c, 0xDEC2'D835}, // U+1D6C2, 𝛂, \bfalpha, Mathematical Bold Small Alpha
+{0x3703, 0x004d, 0x215E}, // ⅞, \7/8, Vulgar Fraction Seven Eighths / Fraction Seven Eighths
+{0x6605, 0x26e9, 0xDD19'D835}, // U+1D519, 𝔙, \frakV, Mathematical Fraktur Capital V
+{0x630e, 0x1f67, 0x2687}, // ⚇, \circledtwodots, White Circle With Two Dots
+{0x6308, 0x2072, 0x2663}, // ♣, \clubsuit, Black Club Suit
+{0x730b, 0x4619, 0x25A4}, // ▤, \squarehfill, Square With Horizontal Fill
+{0x6203, 0x093a, 0xDD57'D835}, // U+1D557, 𝕗, \bbf, Mathematical Double-Struck Small F
+{0x6504, 0x25e5, 0x20AC}, // €, \euro, Euro Sign
+{0x6204, 0x1117, 0xDF42'D835}, // U+1D742, 𝝂, \binu, Mathematical Bold Italic Small Nu
+{0x6206, 0x0a8d, 0xDEB0'D835}, // U+1D6B0, 𝚰, \bfIota, Mathematical Bold Capital Iota
+{0x7006, 0x3d5f, 0x221D}, // ∝, \propto, Proportional To
+{0x6605, 0x2731, 0xDD25'D835}, // U+1D525, 𝔥, \frakh, Mathematical Fraktur Small H
+{0x7605, 0x502c, 0x02CC}, // ˌ, \verti, Modifier Letter Low Vertical Line
+{0x6205, 0x0c1c, 0xDFCF'D835}, // U+1D7CF, 𝟏, \bfone, Mathematical Bold Digit One
+{0x6205, 0x1dd8, 0xDCFE'D835}, // U+1D4FE, 𝓾, \bscru, Mathematical Bold Script Small U
+{0x620b, 0x170a, 0x263B}, // ☻, \blacksmiley, Black Smiling Face
+{0x6e0b, 0x3882, 0x219B}, // ↛, \nrightarrow, Rightwards Arrow With Stroke / Right Arrow With Stroke
+{0x6203, 0x09f1, 0xDD68'D835}, // U+1D568, 𝕨, \bbw, Mathematical Double-Struck Small W
+{0x650f, 0x25d5, 0x2107}, // ℇ, \eulermascheroni, Euler Constant / Eulers
+{0x7403, 0x4a65, 0xDE7D'D835}, // U+1D67D, 𝙽, \ttN, Mathematical Monospace Capital N
+{0x5508, 0x0558, 0x290A}, // ⤊, \Uuparrow, Upwards Triple Arrow
+{0x6909, 0x2cb0, 0xDEF0'D835}, // U+1D6F0, 𝛰, \itOmicron, Mathematical Italic Capital Omicron
+{0x6207, 0x1249, 0xDE49'D835}, // U+1D649, 𝙉, \bisansN, Mathematical Sans-Serif Bold Italic Capital N
+{0x7305, 0x4576, 0x2294}, // ⊔, \sqcup, Square Cup
+{0x620c, 0x15df, 0xDF3A'D835}, // U+1D73A, 𝜺, \bivarepsilon, Mathematical Bold Italic Small Epsilon
+{0x5f02, 0x06df, 0x2095}, // ₕ, \_h, Latin Subscript Small Letter H
+{0x6905, 0x2cbe, 0xDEF7'D835}, // U+1D6F7, 𝛷, \itPhi, Mathematical Italic Capital Phi
+{0x6e0c, 0x3981, 0x2903}, // ⤃, \nvRightarrow, Rightwards Double Arrow With Vertical Stroke
+{0x7311, 0x44a2, 0x25C3}, // ◃, \smalltriangleleft, White Left-Pointing Small Triangle / White Left Pointing Small Triangle
+{0x6207, 0x08c5, 0x213E}, // ℾ, \bbGamma, Double-Struck Capital Gamma
+{0x6206, 0x1a45, 0xDDEF'D835}, // U+1D5EF, 𝗯, \bsansb, Mathematical Sans-Serif Bold Small B
+{0x4507, 0x015b, 0x2986}, // ⦆, \Elroang, Right White Parenthesis
+{0x7403, 0x4a99, 0xDE8A'D835}, // U+1D68A, 𝚊, \tta, Mathematical Monospace Small A
+{0x6605, 0x2707, 0xDD1E'D835}, // U+1D51E, 𝔞, \fraka, Mathematical Fraktur Small A
+{0x7304, 0x4311, 0xDCAA'D835}, // U+1D4AA, 𝒪, \scrO, Mathematical Script Capital O
+{0x700a, 0x3ca0, 0x2A27}, // ⨧, \plussubtwo, Plus Sign With Subscript Two
+{0x6c04, 0x2ef3, 0x2AAD}, // ⪭, \late, Larger Than Or Equal To
+{0x6407, 0x21d2, 0x2A77}, // ⩷, \ddotseq, Equals Sign With Two Dots Above And Two Dots Below
+{0x4902, 0x018d, 0x2111}, // ℑ, \Im, Black-Letter Capital I / Black-Letter I
+{0x550a, 0x0523, 0x2912}, // ⤒, \UpArrowBar, Upwards Arrow To Bar
+{0x4410, 0x00dd, 0x21F5}, // ⇵, \DownArrowUpArrow, Downwards Arrow Leftwards Of Upwards Arrow
+{0x6203, 0x08e1, 0xDD44'D835}, // U+1D544, 𝕄, \bbM, Mathematical Double-Struck Capital M
+{0x620a, 0x1bf2, 0xDFEF'D835}, // U+1D7EF, 𝟯, \bsansthree, Mathematical Sans-Serif Bold Digit Three
+{0x7305, 0x4101, 0xDDA3'D835}, // U+1D5A3, 𝖣, \sansD, Mathematical Sans-Serif Capital D
+{0x6208, 0x1039, 0x2A01}, // ⨁, \bigoplus, N-Ary Circled Plus Operator
+{0x6306, 0x20c7, 0x2210}, // ∐, \coprod, N-Ary Coproduct
+{0x5e02, 0x05e4, 0x1D3C}, // ᴼ, \^O, Modifier Letter Capital O
+{0x620c, 0x1b73, 0xDF89'D835}, // U+1D789, 𝞉, \bsanspartial, Mathematical Sans-Serif Bold Partial Differential
+{0x620a, 0x13d8, 0xDFB2'D835}, // U+1D7B2, 𝞲, \bisansiota, Mathematical Sans-Serif Bold Italic Small Iota
+{0x6309, 0x20bd, 0x2A07}, // ⨇, \conjquant, Two Logical And Operator
+{0x7405, 0x487d, 0x2AF6}, // ⫶, \tdcol, Triple Colon Operator
+{0x6c15, 0x30ef, 0x2967}, // ⥧, \leftrightharpoonsdown, Leftwards Harpoon With Barb Down Above Rightwards Harpoon With Barb Down
+{0x750f, 0x4c42, 0x25E4}, // ◤, \ulblacktriangle, Black Upper Left Triangle
+{0x5f02, 0x0717, 0x1D65}, // ᵥ, \_v, Latin Subscript Small Letter V
+{0x6903, 0x2d4a, 0xDC51'D835}, // U+1D451, 𝑑, \itd, Mathematical Italic Small D
+{0x4c04, 0x01b9, 0x21B2}, // ↲, \Ldsh, Downwards Arrow With Tip Leftwards / Down Arrow With Tip Left
+{0x7305, 0x418d, 0xDDB6'D835}, // U+1D5B6, 𝖶, \sansW, Mathematical Sans-Serif Capital W
+{0x440c, 0x00d0, 0x2913}, // ⤓, \DownArrowBar, Downwards Arrow To Bar
+{0x7202, 0x406d, 0x027C}, // ɼ, \rl, Latin Small Letter R With Long Leg
+{0x6805, 0x2936, 0x02D1}, // ˑ, \hlmrk, Modifier Letter Half Triangular Colon
+{0x6207, 0x1497, 0xDE66'D835}, // U+1D666, 𝙦, \bisansq, Mathematical Sans-Serif Bold Italic Small Q
+{0x7002, 0x3cba, 0x00B1}, // ±, \pm, Plus-Minus Sign / Plus-Or-Minus Sign
+{0x5e02, 0x0593, 0x207D}, // ⁽, \^(, Superscript Left Parenthesis / Superscript Opening Parenthesis
+{0x5f02, 0x069d, 0x208E}, // ₎, \_), Subscript Right Parenthesis / Subscript Closing Parenthesis
+{0x6c06, 0x335e, 0x29A0}, // ⦠, \lpargt, Spherical Angle Opening Left
+{0x4405, 0x00bc, 0x0394}, // Δ, \Delta, Greek Capital Letter Delta
+{0x7305, 0x41cd, 0xDDBF'D835}, // U+1D5BF, 𝖿, \sansf, Mathematical Sans-Serif Small F
+{0x6207, 0x0b83, 0xDFD6'D835}, // U+1D7D6, 𝟖, \bfeight, Mathematical Bold Digit Eight
+{0x750d, 0x4d7b, 0x21BF}, // ↿, \upharpoonleft, Upwards Harpoon With Barb Leftwards / Up Harpoon With Barb Left
+{0x6209, 0x1297, 0xDFA7'D835}, // U+1D7A7, 𝞧, \bisansPsi, Mathematical Sans-Serif Bold Italic Capital Psi
+{0x6203, 0x0aa4, 0xDC0B'D835}, // U+1D40B, 𝐋, \bfL, Mathematical Bold Capital L
+{0x7305, 0x428c, 0xDDD3'D835}, // U+1D5D3, 𝗓, \sansz, Mathematical Sans-Serif Small Z
+{0x7509, 0x4ddb, 0x03BF}, // ο, \upomicron, Greek Small Letter Omicron
+{0x6206, 0x0cc7, 0xDD7E'D835}, // U+1D57E, 𝕾, \bfrakS, Mathematical Bold Fraktur Capital S
+{0x640c, 0x22ba, 0x273D}, // ✽, \dingasterisk, Heavy Teardrop-Spoked Asterisk
+{0x6207, 0x0ec6, 0xDF1E'D835}, // U+1D71E, 𝜞, \biGamma, Mathematical Bold Italic Capital Gamma
+{0x7608, 0x4f0d, 0x03F0}, // ϰ, \varkappa, Greek Kappa Symbol / Greek Small Letter Script Kappa
+{0x6203, 0x0fd2, 0xDC87'D835}, // U+1D487, 𝒇, \bif, Mathematical Bold Italic Small F
+{0x7304, 0x4339, 0xDCB2'D835}, // U+1D4B2, 𝒲, \scrW, Mathematical Script Capital W
+{0x6705, 0x2854, 0x2A90}, // ⪐, \gsiml, Greater-Than Above Similar Above Less-Than
+{0x700b, 0x3cf9, 0x227C}, // ≼, \preccurlyeq, Precedes Or Equal To
+{0x7006, 0x3c5a, 0x0263}, // ɣ, \pgamma, Latin Small Letter Gamma
+{0x7608, 0x4f9e, 0x03D1}, // ϑ, \vartheta, Greek Theta Symbol / Greek Small Letter Script Theta
+{0x6206, 0x1817, 0x29C6}, // ⧆, \boxast, Squared Asterisk
+{0x7409, 0x488b, 0x2234}, // ∴, \therefore, Therefore
+{0x5f02, 0x06f4, 0x2092}, // ₒ, \_o, Latin Subscript Small Letter O
+{0x6206, 0x1b44, 0xDDFC'D835}, // U+1D5FC, 𝗼, \bsanso, Mathematical Sans-Serif Bold Small O
+{0x6d11, 0x3573, 0x299B}, // ⦛, \measuredangleleft, Measured Angle Opening Left
+{0x5f02, 0x06a0, 0x208A}, // ₊, \_+, Subscript Plus Sign
+{0x7002, 0x3c65, 0x03C0}, // π, \pi, Greek Small Letter Pi
+{0x6204, 0x162f, 0xDF43'D835}, // U+1D743, 𝝃, \bixi, Mathematical Bold Italic Small Xi
+{0x6207, 0x13c8, 0xDE5D'D835}, // U+1D65D, 𝙝, \bisansh, Mathematical Sans-Serif Bold Italic Small H
+{0x6605, 0x26e3, 0xDD18'D835}, // U+1D518, 𝔘, \frakU, Mathematical Fraktur Capital U
+{0x6e0c, 0x3696, 0x21FB}, // ⇻, \nVrightarrow, Rightwards Arrow With Double Vertical Stroke
+{0x6904, 0x2e9e, 0xDF09'D835}, // U+1D709, 𝜉, \itxi, Mathematical Italic Small Xi
+{0x6c05, 0x33b8, 0x2A79}, // ⩹, \ltcir, Less-Than With Circle Inside
+{0x5e02, 0x0599, 0x207A}, // ⁺, \^+, Superscript Plus Sign
+{0x6903, 0x2da9, 0xDC59'D835}, // U+1D459, 𝑙, \itl, Mathematical Italic Small L
+{0x6205, 0x0dd9, 0xDED5'D835}, // U+1D6D5, 𝛕, \bftau, Mathematical Bold Small Tau
+{0x7609, 0x4fd4, 0x2A61}, // ⩡, \varveebar, Small Vee With Underbar
+{0x6d06, 0x3411, 0x21A6}, // ↦, \mapsto, Rightwards Arrow From Bar / Right Arrow From Bar
+{0x730d, 0x46a2, 0x2B14}, // ⬔, \squareurblack, Square With Upper Right Diagonal Half Black
+{0x6c08, 0x3279, 0x231E}, // ⌞, \llcorner, Bottom Left Corner
+{0x6c16, 0x3119, 0x294A}, // ⥊, \leftrightharpoonupdown, Left Barb Up Right Barb Down Harpoon
+{0x6907, 0x2c3a, 0xDEE5'D835}, // U+1D6E5, 𝛥, \itDelta, Mathematical Italic Capital Delta
+{0x6906, 0x2ac4, 0xDE11'D835}, // U+1D611, 𝘑, \isansJ, Mathematical Sans-Serif Italic Capital J
+{0x6903, 0x2d0d, 0xDC4A'D835}, // U+1D44A, 𝑊, \itW, Mathematical Italic Capital W
+{0x6205, 0x1d2a, 0xDCE1'D835}, // U+1D4E1, 𝓡, \bscrR, Mathematical Bold Script Capital R
+{0x5507, 0x0550, 0x03A5}, // Υ, \Upsilon, Greek Capital Letter Upsilon
+{0x6e0a, 0x38c9, 0x0338'2AC5}, // ⫅̸, \nsubseteqq, Subset Of Above Equals Sign + Combining Long Solidus Overlay / Non-Spacing Long Slash Overlay
+{0x6c06, 0x320c, 0x230A}, // ⌊, \lfloor, Left Floor
+{0x6209, 0x0acf, 0xDEB6'D835}, // U+1D6B6, 𝚶, \bfOmicron, Mathematical Bold Capital Omicron
+{0x730a, 0x45dc, 0x2292}, // ⊒, \sqsupseteq, Square Original Of Or Equal To
+{0x6705, 0x2848, 0x0300}, // ̀, \grave, Combining Grave Accent / Non-Spacing Grave
+{0x7304, 0x42d0, 0x212C}, // ℬ, \scrB, Script Capital B / Script B
+{0x6207, 0x1595, 0xDE6F'D835}, // U+1D66F, 𝙯, \bisansz, Mathematical Sans-Serif Bold Italic Small Z
+{0x7304, 0x4587, 0x25E8}, // ◨, \sqfr, Square With Right Half Black
+{0x6d04, 0x35f1, 0x2ADB}, // ⫛, \mlcp, Transversal Intersection
+{0x620b, 0x142d, 0xDFA9'D835}, // U+1D7A9, 𝞩, \bisansnabla, Mathematical Sans-Serif Bold Italic Nabla
+{0x6208, 0x09af, 0x23B6}, // ⎶, \bbrktbrk, Bottom Square Bracket Over Top Square Bracket
+{0x5f02, 0x06f7, 0x209A}, // ₚ, \_p, Latin Subscript Small Letter P
+{0x6206, 0x1aa0, 0xDDF3'D835}, // U+1D5F3, 𝗳, \bsansf, Mathematical Sans-Serif Bold Small F
+{0x6206, 0x1c1a, 0xDE03'D835}, // U+1D603, 𝘃, \bsansv, Mathematical Sans-Serif Bold Small V
+{0x6207, 0x0b6d, 0xDEC5'D835}, // U+1D6C5, 𝛅, \bfdelta, Mathematical Bold Small Delta
+{0x6703, 0x280b, 0x22D9}, // ⋙, \ggg, Very Much Greater-Than / Very Much Greater Than
+{0x620a, 0x117f, 0xDF91'D835}, // U+1D791, 𝞑, \bisansBeta, Mathematical Sans-Serif Bold Italic Capital Beta
+{0x6c05, 0x339f, 0x2A8D}, // ⪍, \lsime, Less-Than Above Similar Or Equal
+{0x6b11, 0x2ecd, 0x223B}, // ∻, \kernelcontraction, Homothetic
+{0x7308, 0x43ea, 0x2216}, // ∖, \setminus, Set Minus
+{0x6c12, 0x32e0, 0x2B33}, // ⬳, \longleftsquigarrow, Long Leftwards Squiggle Arrow
+{0x5e06, 0x05fc, 0x1D45}, // ᵅ, \^alpha, Modifier Letter Small Alpha
+{0x660d, 0x25fc, 0x2252}, // ≒, \fallingdotseq, Approximately Equal To Or The Image Of
+{0x6203, 0x0bd8, 0xDC25'D835}, // U+1D425, 𝐥, \bfl, Mathematical Bold Small L
+{0x680f, 0x296a, 0x25AC}, // ▬, \hrectangleblack, Black Rectangle
+{0x6906, 0x2ab6, 0xDE0F'D835}, // U+1D60F, 𝘏, \isansH, Mathematical Sans-Serif Italic Capital H
+{0x6203, 0x0ed2, 0xDC70'D835}, // U+1D470, 𝑰, \biI, Mathematical Bold Italic Capital I
+{0x6e0b, 0x361e, 0x21DF}, // ⇟, \nHdownarrow, Downwards Arrow With Double Stroke / Down Arrow With Double Stroke
+{0x6605, 0x270d, 0xDD1F'D835}, // U+1D51F, 𝔟, \frakb, Mathematical Fraktur Small B
+{0x620a, 0x18c3, 0xDF59'D835}, // U+1D759, 𝝙, \bsansDelta, Mathematical Sans-Serif Bold Capital Delta
+{0x6705, 0x27b7, 0x03B3}, // γ, \gamma, Greek Small Letter Gamma
+{0x7304, 0x42df, 0x2130}, // ℰ, \scrE, Script Capital E / Script E
+{0x6906, 0x2ad9, 0xDE14'D835}, // U+1D614, 𝘔, \isansM, Mathematical Sans-Serif Italic Capital M
+{0x6903, 0x2c36, 0xDC37'D835}, // U+1D437, 𝐷, \itD, Mathematical Italic Capital D
+{0x6207, 0x11ec, 0xDE43'D835}, // U+1D643, 𝙃, \bisansH, Mathematical Sans-Serif Bold Italic Capital H
+{0x6e04, 0x37f5, 0x2224}, // ∤, \nmid, Does Not Divide
+{0x7305, 0x41fd, 0xDDC4'D835}, // U+1D5C4, 𝗄, \sansk, Mathematical Sans-Serif Small K
+{0x6d03, 0x35a7, 0x2127}, // ℧, \mho, Inverted Ohm Sign / Mho
+{0x6c03, 0x3213, 0x2A91}, // ⪑, \lgE, Less-Than Above Greater-Than Above Double-Line Equal
+{0x6105, 0x07e6, 0x2A11}, // ⨑, \awint, Anticlockwise Integration
+{0x620c, 0x0e12, 0xDEC6'D835}, // U+1D6C6, 𝛆, \bfvarepsilon, Mathematical Bold Small Epsilon
+{0x7307, 0x4792, 0x2AB4}, // ⪴, \succeqq, Succeeds Above Equals Sign
+{0x4e11, 0x037d, 0x0338'2290}, // ⊐̸, \NotSquareSuperset, Square Original Of + Combining Long Solidus Overlay / Non-Spacing Long Slash Overlay
+{0x4c03, 0x02bb, 0x21B0}, // ↰, \Lsh, Upwards Arrow With Tip Leftwards / Up Arrow With Tip Left
+{0x6905, 0x2e0d, 0xDF0C'D835}, // U+1D70C, 𝜌, \itrho, Mathematical Italic Small Rho
+{0x620b, 0x1c4d, 0xDF85'D835}, // U+1D785, 𝞅, \bsansvarphi, Mathematical Sans-Serif Bold Small Phi
+{0x7403, 0x4b16, 0xDE9D'D835}, // U+1D69D, 𝚝, \ttt, Mathematical Monospace Small T
+{0x6206, 0x18ac, 0xDDD6'D835}, // U+1D5D6, 𝗖, \bsansC, Mathematical Sans-Serif Bold Capital C
+{0x630c, 0x204f, 0x2A4C}, // ⩌, \closedvarcup, Closed Union With Serifs
+{0x6c07, 0x3204, 0x2272}, // ≲, \lesssim, Less-Than Or Equivalent To / Less Than Or Equivalent To
+{0x7404, 0x4a05, 0x0265}, // ɥ, \trnh, Latin Small Letter Turned H
+{0x7307, 0x47a6, 0x2AB2}, // ⪲, \succneq, Succeeds Above Single-Line Not Equal To
+{0x5e02, 0x05f9, 0x1D43}, // ᵃ, \^a, Modifier Letter Small A
+{0x6203, 0x0ab1, 0xDC0C'D835}, // U+1D40C, 𝐌, \bfM, Mathematical Bold Capital M
+{0x7705, 0x50ae, 0x2227}, // ∧, \wedge, Logical And
+{0x6906, 0x2b18, 0xDE1D'D835}, // U+1D61D, 𝘝, \isansV, Mathematical Sans-Serif Italic Capital V
+{0x6105, 0x0733, 0x0301}, // ́, \acute, Combining Acute Accent / Non-Spacing Acute
+{0x6907, 0x2e6f, 0xDF1B'D835}, // U+1D71B, 𝜛, \itvarpi, Mathematical Italic Pi Symbol
+{0x630c, 0x1fe8, 0x25F7}, // ◷, \circleurquad, White Circle With Upper Right Quadrant
+{0x740d, 0x49de, 0x2A3B}, // ⨻, \triangletimes, Multiplication Sign In Triangle
+{0x6e0a, 0x37bc, 0x219A}, // ↚, \nleftarrow, Leftwards Arrow With Stroke / Left Arrow With Stroke
+{0x6606, 0x2626, 0x2640}, // ♀, \female, Female Sign
+{0x730e, 0x4669, 0x25A7}, // ▧, \squarenwsefill, Square With Upper Left To Lower Right Fill
+{0x720c, 0x3dc7, 0x292B}, // ⤫, \rdiagovfdiag, Rising Diagonal Crossing Falling Diagonal
+{0x7411, 0x4967, 0x25ED}, // ◭, \triangleleftblack, Up-Pointing Triangle With Left Half Black / Up Pointing Triangle With Left Half Black
+{0x6904, 0x2dba, 0xDF07'D835}, // U+1D707, 𝜇, \itmu, Mathematical Italic Small Mu
+{0x6205, 0x0def, 0xDFD0'D835}, // U+1D7D0, 𝟐, \bftwo, Mathematical Bold Digit Two
+{0x6207, 0x0f5b, 0xDF23'D835}, // U+1D723, 𝜣, \biTheta, Mathematical Bold Italic Capital Theta
+{0x6206, 0x0cce, 0xDD7F'D835}, // U+1D57F, 𝕿, \bfrakT, Mathematical Bold Fraktur Capital T
+{0x6209, 0x1027, 0x2A03}, // ⨃, \bigcupdot, N-Ary Union Operator With Dot
+{0x6903, 0x2db6, 0xDC5A'D835}, // U+1D45A, 𝑚, \itm, Mathematical Italic Small M
+{0x6211, 0x1730, 0x25BE}, // ▾, \blacktriangledown, Black Down-Pointing Small Triangle / Black Down Pointing Small Triangle
+{0x6c0d, 0x32bf, 0x27F5}, // ⟵, \longleftarrow, Long Leftwards Arrow
+{0x6203, 0x10d6, 0xDC89'D835}, // U+1D489, 𝒉, \bih, Mathematical Bold Italic Small H
+{0x6208, 0x1e21, 0x27C8}, // ⟈, \bsolhsub, Reverse Solidus Preceding Subset
+{0x7306, 0x475a, 0x2AC7}, // ⫇, \subsim, Subset Of Above Tilde Operator
+{0x5e02, 0x0664, 0x1D52}, // ᵒ, \^o, Modifier Letter Small O
+{0x7008, 0x3c0f, 0x2B20}, // ⬠, \pentagon, White Pentagon
+{0x6c05, 0x32b3, 0x2268}, // ≨, \lneqq, Less-Than But Not Equal To / Less Than But Not Equal To
+{0x6207, 0x11f4, 0xDE44'D835}, // U+1D644, 𝙄, \bisansI, Mathematical Sans-Serif Bold Italic Capital I
+{0x6206, 0x1c93, 0xDE05'D835}, // U+1D605, 𝘅, \bsansx, Mathematical Sans-Serif Bold Small X
+{0x6207, 0x158d, 0xDE6E'D835}, // U+1D66E, 𝙮, \bisansy, Mathematical Sans-Serif Bold Italic Small Y
+{0x6706, 0x289b, 0x2273}, // ≳, \gtrsim, Greater-Than Or Equivalent To / Greater Than Or Equivalent To
+{0x5002, 0x03b2, 0x03A0}, // Π, \Pi, Greek Capital Letter Pi
+{0x6d0d, 0x3490, 0x26AC}, // ⚬, \mdsmwhtcircle, Medium Small White Circle
+{0x6e0f, 0x3923, 0x22EC}, // ⋬, \ntrianglelefteq, Not Normal Subgroup Of Or Equal To
+{0x6c04, 0x33cb, 0x0272}, // ɲ, \ltln, Latin Small Letter N With Left Hook / Latin Small Letter N Hook
+{0x7306, 0x45f3, 0x25A1}, // □, \square, White Square
+{0x5f06, 0x06d8, 0x1D67}, // ᵧ, \_gamma, Greek Subscript Small Letter Gamma
+{0x6906, 0x29f4, 0x2A19}, // ⨙, \intcap, Integral With Intersection
+{0x6207, 0x0819, 0x223D}, // ∽, \backsim, Reversed Tilde
+{0x7309, 0x4592, 0x2311}, // ⌑, \sqlozenge, Square Lozenge
+{0x6207, 0x13e3, 0xDE5F'D835}, // U+1D65F, 𝙟, \bisansj, Mathematical Sans-Serif Bold Italic Small J
+{0x7305, 0x41bd, 0xDDBE'D835}, // U+1D5BE, 𝖾, \sanse, Mathematical Sans-Serif Small E
+{0x6203, 0x0ec2, 0xDC6E'D835}, // U+1D46E, 𝑮, \biG, Mathematical Bold Italic Capital G
+{0x6208, 0x1071, 0x2A06}, // ⨆, \bigsqcup, N-Ary Square Union Operator
+{0x6605, 0x2695, 0x210C}, // ℌ, \frakH, Black-Letter Capital H / Black-Letter H
+{0x6505, 0x25cf, 0x212F}, // ℯ, \euler, Script Small E
+{0x6c0d, 0x3035, 0x21BC}, // ↼, \leftharpoonup, Leftwards Harpoon With Barb Upwards / Left Harpoon With Barb Up
+{0x4e0f, 0x036d, 0x0338'228F}, // ⊏̸, \NotSquareSubset, Square Image Of + Combining Long Solidus Overlay / Non-Spacing Long Slash Overlay
+{0x620d, 0x11b8, 0xDF94'D835}, // U+1D794, 𝞔, \bisansEpsilon, Mathematical Sans-Serif Bold Italic Capital Epsilon
+{0x620b, 0x116b, 0xDF90'D835}, // U+1D790, 𝞐, \bisansAlpha, Mathematical Sans-Serif Bold Italic Capital Alpha
+{0x6206, 0x0d99, 0xDD9C'D835}, // U+1D59C, 𝖜, \bfrakw, Mathematical Bold Fraktur Small W
+{0x740e, 0x4979, 0x22B4}, // ⊴, \trianglelefteq, Normal Subgroup Of Or Equal To
+{0x5605, 0x0567, 0x22A9}, // ⊩, \Vdash, Forces
+{0x6c0e, 0x330b, 0x27F6}, // ⟶, \longrightarrow, Long Rightwards Arrow
+{0x6203, 0x0f71, 0xDC7D'D835}, // U+1D47D, 𝑽, \biV, Mathematical Bold Italic Capital V
+{0x5e02, 0x068b, 0x1D5B}, // ᵛ, \^v, Modifier Letter Small V
+{0x6906, 0x2ba4, 0xDE31'D835}, // U+1D631, 𝘱, \isansp, Mathematical Sans-Serif Italic Small P
+{0x3103, 0x0019, 0x2155}, // ⅕, \1/5, Vulgar Fraction One Fifth / Fraction One Fifth
+{0x7504, 0x4dac, 0x27D2}, // ⟒, \upin, Element Of Opening Upwards
+{0x6906, 0x2bdc, 0xDE39'D835}, // U+1D639, 𝘹, \isansx, Mathematical Sans-Serif Italic Small X
+{0x7606, 0x4ff9, 0x27C7}, // ⟇, \veedot, Or With Dot Inside
+{0x660e, 0x260a, 0x292F}, // ⤯, \fdiagovnearrow, Falling Diagonal Crossing North East Arrow
+{0x6213, 0x165f, 0x2689}, // ⚉, \blackcircledtwodots, Black Circle With Two White Dots
+{0x6803, 0x28c9, 0x0302}, // ̂, \hat, Combining Circumflex Accent / Non-Spacing Circumflex
+{0x6203, 0x0c45, 0xDC2B'D835}, // U+1D42B, 𝐫, \bfr, Mathematical Bold Small R
+{0x6205, 0x0f55, 0xDF2F'D835}, // U+1D72F, 𝜯, \biTau, Mathematical Bold Italic Capital Tau
+{0x6304, 0x20a5, 0x2245}, // ≅, \cong, Approximately Equal To
+{0x6906, 0x2aa8, 0xDE0D'D835}, // U+1D60D, 𝘍, \isansF, Mathematical Sans-Serif Italic Capital F
+{0x4203, 0x0075, 0x2AEB}, // ⫫, \Bot, Double Up Tack
+{0x6207, 0x1313, 0xDE53'D835}, // U+1D653, 𝙓, \bisansX, Mathematical Sans-Serif Bold Italic Capital X
+{0x6c07, 0x31bc, 0x2A81}, // ⪁, \lesdoto, Less-Than Or Slanted Equal To With Dot Above
+{0x620c, 0x17b3, 0x2584}, // ▄, \blocklowhalf, Lower Half Block
+{0x5e02, 0x05f0, 0x1D41}, // ᵁ, \^U, Modifier Letter Capital U
+{0x6e10, 0x39cf, 0x2914}, // ⤔, \nvrightarrowtail, Rightwards Arrow With Tail With Vertical Stroke
+{0x6603, 0x262d, 0x027E}, // ɾ, \fhr, Latin Small Letter R With Fishhook / Latin Small Letter Fishhook R
+{0x760c, 0x5060, 0x2423}, // ␣, \visiblespace, Open Box
+{0x640f, 0x23ae, 0x21C3}, // ⇃, \downharpoonleft, Downwards Harpoon With Barb Leftwards / Down Harpoon With Barb Left
+{0x6203, 0x10f5, 0xDC8D'D835}, // U+1D48D, 𝒍, \bil, Mathematical Bold Italic Small L
+{0x6405, 0x22a5, 0x2684}, // ⚄, \dicev, Die Face-5
+{0x6d0d, 0x3565, 0x2221}, // ∡, \measuredangle, Measured Angle
+{0x7307, 0x4435, 0x2A9D}, // ⪝, \simless, Similar Or Less-Than
+{0x5e02, 0x05ab, 0x2074}, // ⁴, \^4, Superscript Four / Superscript Digit Four
+{0x6310, 0x1eda, 0x21BB}, // ↻, \circlearrowright, Clockwise Open Circle Arrow
+{0x6809, 0x291a, 0x00AF}, // ¯, \highminus, Macron / Spacing Macron
+{0x710b, 0x3d83, 0x2669}, // ♩, \quarternote, Quarter Note
+{0x6209, 0x0821, 0x22CD}, // ⋍, \backsimeq, Reversed Tilde Equals
+{0x5f04, 0x0702, 0x1D68}, // ᵨ, \_rho, Greek Subscript Small Letter Rho
+{0x7406, 0x4a0f, 0x0270}, // ɰ, \trnmlr, Latin Small Letter Turned M With Long Leg
+{0x6508, 0x2459, 0x23E7}, // ⏧, \elinters, Electrical Intersection
+{0x6206, 0x1c8c, 0xDE04'D835}, // U+1D604, 𝘄, \bsansw, Mathematical Sans-Serif Bold Small W
+{0x6906, 0x2b49, 0xDE24'D835}, // U+1D624, 𝘤, \isansc, Mathematical Sans-Serif Italic Small C
+{0x3103, 0x0025, 0x215B}, // ⅛, \1/8, Vulgar Fraction One Eighth / Fraction One Eighth
+{0x6f0b, 0x3b87, 0x23B4}, // ⎴, \overbracket, Top Square Bracket
+{0x4303, 0x0080, 0x22D2}, // ⋒, \Cap, Double Intersection
+{0x7204, 0x40bc, 0x0282}, // ʂ, \rtls, Latin Small Letter S With Hook / Latin Small Letter S Hook
+{0x6903, 0x2d6a, 0xDC53'D835}, // U+1D453, 𝑓, \itf, Mathematical Italic Small F
+{0x7305, 0x4107, 0xDDA4'D835}, // U+1D5A4, 𝖤, \sansE, Mathematical Sans-Serif Capital E
+{0x5f02, 0x06a6, 0x2080}, // ₀, \_0, Subscript Zero / Subscript Digit Zero
+{0x6c0f, 0x325f, 0x25E3}, // ◣, \llblacktriangle, Black Lower Left Triangle
+{0x6206, 0x18eb, 0xDDD9'D835}, // U+1D5D9, 𝗙, \bsansF, Mathematical Sans-Serif Bold Capital F
+{0x750b, 0x4d1c, 0x21E1}, // ⇡, \updasharrow, Upwards Dashed Arrow / Up Dashed Arrow
+{0x4904, 0x0190, 0x0399}, // Ι, \Iota, Greek Capital Letter Iota
+{0x630e, 0x1e85, 0x21B5}, // ↵, \carriagereturn, Downwards Arrow With Corner Leftwards / Down Arrow With Corner Left
+{0x7206, 0x3de7, 0x201B}, // ‛, \reapos, Single High-Reversed-9 Quotation Mark / Single Reversed Comma Quotation Mark
+{0x7405, 0x4b22, 0xDFF8'D835}, // U+1D7F8, 𝟸, \tttwo, Mathematical Monospace Digit Two
+{0x6106, 0x0783, 0x2248}, // ≈, \approx, Almost Equal To
+{0x6907, 0x2d95, 0xDEA5'D835}, // U+1D6A5, 𝚥, \itjmath, Mathematical Italic Small Dotless J
+{0x730b, 0x479a, 0x2ABA}, // ⪺, \succnapprox, Succeeds Above Not Almost Equal To
+{0x6903, 0x2c42, 0xDC38'D835}, // U+1D438, 𝐸, \itE, Mathematical Italic Capital E
+{0x7303, 0x4407, 0x223C}, // ∼, \sim, Tilde Operator
+{0x6209, 0x147a, 0xDFC7'D835}, // U+1D7C7, 𝟇, \bisansphi, Mathematical Sans-Serif Bold Italic Phi Symbol
+{0x6209, 0x182f, 0x29C7}, // ⧇, \boxcircle, Squared Small Circle
+{0x6905, 0x2999, 0x222D}, // ∭, \iiint, Triple Integral
+{0x6103, 0x07c1, 0x2217}, // ∗, \ast, Asterisk Operator
+{0x630c, 0x2042, 0x2A4D}, // ⩍, \closedvarcap, Closed Intersection With Serifs
+{0x6206, 0x0c65, 0xDD70'D835}, // U+1D570, 𝕰, \bfrakE, Mathematical Bold Fraktur Capital E
+{0x7407, 0x4aad, 0xDFFE'D835}, // U+1D7FE, 𝟾, \tteight, Mathematical Monospace Digit Eight
+{0x6203, 0x0985, 0xDD5E'D835}, // U+1D55E, 𝕞, \bbm, Mathematical Double-Struck Small M
+{0x6304, 0x1ebe, 0x2218}, // ∘, \circ, Ring Operator
+{0x6203, 0x0979, 0xDD5B'D835}, // U+1D55B, 𝕛, \bbj, Mathematical Double-Struck Small J
+{0x7306, 0x47cc, 0x2A0B}, // ⨋, \sumint, Summation With Integral
+{0x6305, 0x1e9e, 0x00B7}, // ·, \cdotp, Middle Dot
+{0x7407, 0x4b1a, 0xDFF9'D835}, // U+1D7F9, 𝟹, \ttthree, Mathematical Monospace Digit Three
+{0x6f05, 0x3ac6, 0x03C9}, // ω, \omega, Greek Small Letter Omega
+{0x6204, 0x1106, 0xDF41'D835}, // U+1D741, 𝝁, \bimu, Mathematical Bold Italic Small Mu
+{0x730f, 0x4609, 0x25A9}, // ▩, \squarecrossfill, Square With Diagonal Crosshatch Fill
+{0x4705, 0x0185, 0x0393}, // Γ, \Gamma, Greek Capital Letter Gamma
+{0x6206, 0x0c50, 0xDD6D'D835}, // U+1D56D, 𝕭, \bfrakB, Mathematical Bold Fraktur Capital B
+{0x6207, 0x0a10, 0x23E3}, // ⏣, \benzenr, Benzene Ring With Circle
+{0x6206, 0x1ba1, 0xDDFF'D835}, // U+1D5FF, 𝗿, \bsansr, Mathematical Sans-Serif Bold Small R
+{0x500c, 0x03ba, 0x214A}, // ⅊, \PropertyLine, Property Line
+{0x6e0e, 0x3933, 0x22EB}, // ⋫, \ntriangleright, Does Not Contain As Normal Subgroup
+{0x7403, 0x4a3d, 0xDE73'D835}, // U+1D673, 𝙳, \ttD, Mathematical Monospace Capital D
+{0x6906, 0x2b65, 0xDE28'D835}, // U+1D628, 𝘨, \isansg, Mathematical Sans-Serif Italic Small G
+{0x6a05, 0x2eb2, 0x0237}, // ȷ, \jmath, Latin Small Letter Dotless J
+{0x6209, 0x1b32, 0xDFF5'D835}, // U+1D7F5, 𝟵, \bsansnine, Mathematical Sans-Serif Bold Digit Nine
+{0x6605, 0x26ad, 0xDD0F'D835}, // U+1D50F, 𝔏, \frakL, Mathematical Fraktur Capital L
+{0x6c06, 0x334f, 0x2A1C}, // ⨜, \lowint, Integral With Underbar
+{0x620d, 0x14eb, 0xDFBE'D835}, // U+1D7BE, 𝞾, \bisansupsilon, Mathematical Sans-Serif Bold Italic Small Upsilon
+{0x6903, 0x2c9b, 0xDC41'D835}, // U+1D441, 𝑁, \itN, Mathematical Italic Capital N
+{0x7403, 0x4a91, 0xDE88'D835}, // U+1D688, 𝚈, \ttY, Mathematical Monospace Capital Y
+{0x6206, 0x0da0, 0xDD9D'D835}, // U+1D59D, 𝖝, \bfrakx, Mathematical Bold Fraktur Small X
+{0x6206, 0x1bd7, 0xDE01'D835}, // U+1D601, 𝘁, \bsanst, Mathematical Sans-Serif Bold Small T
+{0x6206, 0x0e76, 0xDEC7'D835}, // U+1D6C7, 𝛇, \bfzeta, Mathematical Bold Small Zeta
+{0x6f06, 0x3acc, 0x2296}, // ⊖, \ominus, Circled Minus
+{0x6d0a, 0x35db, 0x2A2B}, // ⨫, \minusfdots, Minus Sign With Falling Dots
+{0x630a, 0x208f, 0x2A29}, // ⨩, \commaminus, Minus Sign With Comma Above
+{0x3103, 0x0021, 0x2150}, // ⅐, \1/7, Vulgar Fraction One Seventh
+{0x6207, 0x118a, 0xDE3E'D835}, // U+1D63E, 𝘾, \bisansC, Mathematical Sans-Serif Bold Italic Capital C
+{0x7410, 0x4b8d, 0x219E}, // ↞, \twoheadleftarrow, Leftwards Two Headed Arrow / Left Two Headed Arrow
+{0x6906, 0x2acb, 0xDE12'D835}, // U+1D612, 𝘒, \isansK, Mathematical Sans-Serif Italic Capital K
+{0x7403, 0x4a69, 0xDE7E'D835}, // U+1D67E, 𝙾, \ttO, Mathematical Monospace Capital O
+{0x630b, 0x2100, 0x22DE}, // ⋞, \curlyeqprec, Equal To Or Precedes
+{0x770b, 0x5169, 0x29A7}, // ⦧, \wideangleup, Oblique Angle Opening Down
+{0x6405, 0x22f7, 0x2250}, // ≐, \doteq, Approaches The Limit
+{0x6203, 0x09f9, 0xDD6A'D835}, // U+1D56A, 𝕪, \bby, Mathematical Double-Struck Small Y
+{0x620a, 0x186e, 0x2353}, // ⍓, \boxupcaret, Apl Functional Symbol Quad Up Caret
+{0x6206, 0x0d14, 0xDD89'D835}, // U+1D589, 𝖉, \bfrakd, Mathematical Bold Fraktur Small D
+{0x6208, 0x1a97, 0xDF76'D835}, // U+1D776, 𝝶, \bsanseta, Mathematical Sans-Serif Bold Small Eta
+{0x6917, 0x2a68, 0x25DA}, // ◚, \invwhiteupperhalfcircle, Upper Half Inverse White Circle
+{0x6506, 0x2552, 0x2A73}, // ⩳, \eqqsim, Equals Sign Above Tilde Operator
+{0x700d, 0x3c18, 0x2B1F}, // ⬟, \pentagonblack, Black Pentagon
+{0x6e17, 0x36f2, 0x2918}, // ⤘, \nVtwoheadrightarrowtail, Rightwards Two-Headed Arrow With Tail With Double Vertical Stroke
+{0x7305, 0x415d, 0xDDAE'D835}, // U+1D5AE, 𝖮, \sansO, Mathematical Sans-Serif Capital O
+{0x6903, 0x2c85, 0xDC3F'D835}, // U+1D43F, 𝐿, \itL, Mathematical Italic Capital L
+{0x6605, 0x2779, 0xDD31'D835}, // U+1D531, 𝔱, \frakt, Mathematical Fraktur Small T
+{0x630a, 0x2121, 0x22CF}, // ⋏, \curlywedge, Curly Logical And
+{0x6e10, 0x3942, 0x22ED}, // ⋭, \ntrianglerighteq, Does Not Contain As Normal Subgroup Or Equal
+{0x6e0b, 0x3755, 0x292E}, // ⤮, \neovsearrow, North East Arrow Crossing South East Arrow
+{0x6503, 0x25c3, 0x0283}, // ʃ, \esh, Latin Small Letter Esh
+{0x6f0c, 0x3a78, 0x29BC}, // ⦼, \odotslashdot, Circled Anticlockwise-Rotated Division Sign
+{0x6206, 0x0d3e, 0xDD8F'D835}, // U+1D58F, 𝖏, \bfrakj, Mathematical Bold Fraktur Small J
+{0x6206, 0x0e6f, 0xDFCE'D835}, // U+1D7CE, 𝟎, \bfzero, Mathematical Bold Digit Zero
+{0x6205, 0x0dcf, 0xDFD4'D835}, // U+1D7D4, 𝟔, \bfsix, Mathematical Bold Digit Six
+{0x6903, 0x2d9d, 0xDC58'D835}, // U+1D458, 𝑘, \itk, Mathematical Italic Small K
+{0x7303, 0x47c8, 0x2211}, // ∑, \sum, N-Ary Summation
+{0x5202, 0x03e0, 0x211C}, // ℜ, \Re, Black-Letter Capital R / Black-Letter R
+{0x6203, 0x0916, 0xDD50'D835}, // U+1D550, 𝕐, \bbY, Mathematical Double-Struck Capital Y
+{0x6206, 0x0b9f, 0xDFD3'D835}, // U+1D7D3, 𝟓, \bffive, Mathematical Bold Digit Five
+{0x6204, 0x0b34, 0xDEB5'D835}, // U+1D6B5, 𝚵, \bfXi, Mathematical Bold Capital Xi
+{0x730e, 0x4550, 0x2222}, // ∢, \sphericalangle, Spherical Angle
+{0x6e06, 0x395d, 0x22AD}, // ⊭, \nvDash, Not True
+{0x740b, 0x48b0, 0x27C0}, // ⟀, \threedangle, Three Dimensional Angle
+{0x6208, 0x1082, 0x2A09}, // ⨉, \bigtimes, N-Ary Times Operator
+{0x5606, 0x0572, 0x22AA}, // ⊪, \Vvdash, Triple Vertical Bar Right Turnstile
+{0x6d0f, 0x34fe, 0x29AB}, // ⦫, \measangleldtosw, Measured Angle With Open Arm Ending In Arrow Pointing Down And Left
+{0x6205, 0x1d36, 0xDCE3'D835}, // U+1D4E3, 𝓣, \bscrT, Mathematical Bold Script Capital T
+{0x6d08, 0x35d2, 0x2A2A}, // ⨪, \minusdot, Minus Sign With Dot Below
+{0x6903, 0x2d1e, 0xDC4D'D835}, // U+1D44D, 𝑍, \itZ, Mathematical Italic Capital Z
+{0x6408, 0x22fd, 0x2A67}, // ⩧, \dotequiv, Identical With Dot Above
+{0x6605, 0x271f, 0xDD22'D835}, // U+1D522, 𝔢, \frake, Mathematical Fraktur Small E
+{0x7408, 0x48da, 0x02DC}, // ˜, \tildelow, Small Tilde / Spacing Tilde
+{0x7304, 0x42d5, 0xDC9E'D835}, // U+1D49E, 𝒞, \scrC, Mathematical Script Capital C
+{0x6203, 0x111c, 0xDC90'D835}, // U+1D490, 𝒐, \bio, Mathematical Bold Italic Small O
+{0x6906, 0x2a3f, 0x2310}, // ⌐, \invnot, Reversed Not Sign
+{0x6b01, 0x2ec5, 0x0328}, // ̨, \k, Combining Ogonek / Non-Spacing Ogonek
+{0x6203, 0x0a89, 0xDC08'D835}, // U+1D408, 𝐈, \bfI, Mathematical Bold Capital I
+{0x6706, 0x27c0, 0x264A}, // ♊, \gemini, Gemini
+{0x6903, 0x298e, 0x27FA}, // ⟺, \iff, Long Left Right Double Arrow
+{0x7304, 0x433e, 0xDCB3'D835}, // U+1D4B3, 𝒳, \scrX, Mathematical Script Capital X
+{0x670d, 0x28a2, 0x2039}, // ‹, \guilsinglleft, Single Left-Pointing Angle Quotation Mark / Left Pointing Single Guillemet
+{0x6f09, 0x3abc, 0x29C0}, // ⧀, \olessthan, Circled Less-Than
+{0x6204, 0x0f7d, 0xDF29'D835}, // U+1D729, 𝜩, \biXi, Mathematical Bold Italic Capital Xi
+{0x6206, 0x0e8d, 0xDF1D'D835}, // U+1D71D, 𝜝, \biBeta, Mathematical Bold Italic Capital Beta
+{0x6205, 0x1d90, 0xDCF2'D835}, // U+1D4F2, 𝓲, \bscri, Mathematical Bold Script Small I
+{0x6205, 0x0b0c, 0xDEBB'D835}, // U+1D6BB, 𝚻, \bfTau, Mathematical Bold Capital Tau
+{0x6214, 0x0fe2, 0x25BC}, // ▼, \bigblacktriangledown, Black Down-Pointing Triangle / Black Down Pointing Triangle
+{0x620a, 0x1b4b, 0xDF88'D835}, // U+1D788, 𝞈, \bsansomega, Mathematical Sans-Serif Bold Small Omega
+{0x5f02, 0x06ac, 0x2082}, // ₂, \_2, Subscript Two / Subscript Digit Two
+{0x4e07, 0x038f, 0x21D6}, // ⇖, \Nwarrow, North West Double Arrow / Upper Left Double Arrow
+{0x5203, 0x04af, 0x21B1}, // ↱, \Rsh, Upwards Arrow With Tip Rightwards / Up Arrow With Tip Right
+{0x7212, 0x3ee6, 0x21FE}, // ⇾, \rightarrowtriangle, Rightwards Open-Headed Arrow
+{0x6c13, 0x2f2e, 0x2B42}, // ⭂, \leftarrowbackapprox, Leftwards Arrow Above Reverse Almost Equal To
+{0x7309, 0x4813, 0x2ABE}, // ⪾, \supsetdot, Superset With Dot
+{0x620a, 0x1bc3, 0xDF82'D835}, // U+1D782, 𝞂, \bsanssigma, Mathematical Sans-Serif Bold Small Sigma
+{0x6203, 0x09ab, 0xDD63'D835}, // U+1D563, 𝕣, \bbr, Mathematical Double-Struck Small R
+{0x750e, 0x4c8e, 0x20EE}, // ⃮, \underleftarrow, Combining Left Arrow Below
+{0x6203, 0x0a85, 0xDC07'D835}, // U+1D407, 𝐇, \bfH, Mathematical Bold Capital H
+{0x6203, 0x17fe, 0x22A5}, // ⊥, \bot, Up Tack
+{0x7212, 0x3e84, 0x2B4C}, // ⭌, \rightarrowbsimilar, Rightwards Arrow Above Reverse Tilde Operator
+{0x760c, 0x4f6e, 0x2664}, // ♤, \varspadesuit, White Spade Suit
+{0x6605, 0x268f, 0xDD0A'D835}, // U+1D50A, 𝔊, \frakG, Mathematical Fraktur Capital G
+{0x6e0a, 0x3634, 0x21CD}, // ⇍, \nLeftarrow, Leftwards Double Arrow With Stroke / Left Double Arrow With Stroke
+{0x7307, 0x4449, 0x2A24}, // ⨤, \simplus, Plus Sign With Tilde Above
+{0x6706, 0x27e9, 0x2A80}, // ⪀, \gesdot, Greater-Than Or Slanted Equal To With Dot Inside
+{0x5103, 0x03cb, 0x220E}, // ∎, \QED, End Of Proof
+{0x690a, 0x2a0b, 0x2AF4}, // ⫴, \interleave, Triple Vertical Bar Binary Relation
+{0x6206, 0x18f2, 0xDDDA'D835}, // U+1D5DA, 𝗚, \bsansG, Mathematical Sans-Serif Bold Capital G
+{0x6206, 0x0c7a, 0xDD73'D835}, // U+1D573, 𝕳, \bfrakH, Mathematical Bold Fraktur Capital H
+{0x6206, 0x1b20, 0xDDFB'D835}, // U+1D5FB, 𝗻, \bsansn, Mathematical Sans-Serif Bold Small N
+{0x7307, 0x4266, 0xDFE4'D835}, // U+1D7E4, 𝟤, \sanstwo, Mathematical Sans-Serif Digit Two
+{0x4c09, 0x024f, 0x21D0}, // ⇐, \Leftarrow, Leftwards Double Arrow / Left Double Arrow
+{0x7611, 0x4ea1, 0x2306}, // ⌆, \vardoublebarwedge, Perspective
+{0x6907, 0x2dd4, 0xDF14'D835}, // U+1D714, 𝜔, \itomega, Mathematical Italic Small Omega
+{0x5e02, 0x05ae, 0x2075}, // ⁵, \^5, Superscript Five / Superscript Digit Five
+{0x6904, 0x2dfa, 0xDF0B'D835}, // U+1D70B, 𝜋, \itpi, Mathematical Italic Small Pi
+{0x6d0b, 0x34ac, 0x26AA}, // ⚪, \mdwhtcircle, Medium White Circle
+{0x520c, 0x0496, 0x2970}, // ⥰, \RoundImplies, Right Double Arrow With Rounded Head
+{0x7904, 0x51a6, 0x0292}, // ʒ, \yogh, Latin Small Letter Ezh / Latin Small Letter Yogh
+{0x6205, 0x1cd6, 0xDCD3'D835}, // U+1D4D3, 𝓓, \bscrD, Mathematical Bold Script Capital D
+{0x6209, 0x0b1e, 0xDEBC'D835}, // U+1D6BC, 𝚼, \bfUpsilon, Mathematical Bold Capital Upsilon
+{0x7204, 0x40c1, 0x0288}, // ʈ, \rtlt, Latin Small Letter T With Retroflex Hook / Latin Small Letter T Retroflex Hook
+{0x6209, 0x0df9, 0xDED6'D835}, // U+1D6D6, 𝛖, \bfupsilon, Mathematical Bold Small Upsilon
+{0x5e02, 0x066f, 0x02B3}, // ʳ, \^r, Modifier Letter Small R
+{0x7016, 0x3bf2, 0x2AA3}, // ⪣, \partialmeetcontraction, Double Nested Less-Than With Underbar
+{0x5405, 0x050a, 0x0398}, // Θ, \Theta, Greek Capital Letter Theta
+{0x6208, 0x1ba8, 0xDF80'D835}, // U+1D780, 𝞀, \bsansrho, Mathematical Sans-Serif Bold Small Rho
+{0x7305, 0x42b4, 0x0259}, // ə, \schwa, Latin Small Letter Schwa
+{0x6206, 0x0a3a, 0xDEA9'D835}, // U+1D6A9, 𝚩, \bfBeta, Mathematical Bold Capital Beta
+{0x6206, 0x1a66, 0xDDF1'D835}, // U+1D5F1, 𝗱, \bsansd, Mathematical Sans-Serif Bold Small D
+{0x6605, 0x2755, 0xDD2B'D835}, // U+1D52B, 𝔫, \frakn, Mathematical Fraktur Small N
+{0x5f02, 0x06a3, 0x208B}, // ₋, \_-, Subscript Minus / Subscript Hyphen-Minus
+{0x5306, 0x04f4, 0x22D1}, // ⋑, \Supset, Double Superset
+{0x6407, 0x2296, 0x2682}, // ⚂, \diceiii, Die Face-3
+{0x6208, 0x1848, 0x229F}, // ⊟, \boxminus, Squared Minus
+{0x6903, 0x2de6, 0xDC5D'D835}, // U+1D45D, 𝑝, \itp, Mathematical Italic Small P
+{0x7509, 0x4d71, 0x03B5}, // ε, \upepsilon, Greek Small Letter Epsilon
+{0x6707, 0x27f0, 0x2A82}, // ⪂, \gesdoto, Greater-Than Or Slanted Equal To With Dot Above
+{0x7305, 0x41ab, 0xDDBB'D835}, // U+1D5BB, 𝖻, \sansb, Mathematical Sans-Serif Small B
+{0x620b, 0x1380, 0xDFAD'D835}, // U+1D7AD, 𝞭, \bisansdelta, Mathematical Sans-Serif Bold Italic Small Delta
+{0x7305, 0x4113, 0xDDA6'D835}, // U+1D5A6, 𝖦, \sansG, Mathematical Sans-Serif Capital G
+{0x7411, 0x4be5, 0x21A0}, // ↠, \twoheadrightarrow, Rightwards Two Headed Arrow / Right Two Headed Arrow
+{0x6605, 0x275b, 0xDD2C'D835}, // U+1D52C, 𝔬, \frako, Mathematical Fraktur Small O
+{0x740c, 0x4940, 0x25EC}, // ◬, \trianglecdot, White Up-Pointing Triangle With Dot / White Up Pointing Triangle With Dot
+{0x4c0d, 0x0241, 0x2952}, // ⥒, \LeftVectorBar, Leftwards Harpoon With Barb Up To Bar
+{0x6406, 0x2152, 0x2138}, // ℸ, \daleth, Dalet Symbol / Fourth Transfinite Cardinal
+{0x630e, 0x2007, 0x25CD}, // ◍, \circlevertfill, Circle With Vertical Fill
+{0x4411, 0x0102, 0x295E}, // ⥞, \DownLeftTeeVector, Leftwards Harpoon With Barb Down From Bar
+{0x6203, 0x08e5, 0x2115}, // ℕ, \bbN, Double-Struck Capital N / Double-Struck N
+{0x6206, 0x0c8f, 0xDD76'D835}, // U+1D576, 𝕶, \bfrakK, Mathematical Bold Fraktur Capital K
+{0x6206, 0x1966, 0xDDE2'D835}, // U+1D5E2, 𝗢, \bsansO, Mathematical Sans-Serif Bold Capital O
+{0x7505, 0x4dbf, 0x228E}, // ⊎, \uplus, Multiset Union
+{0x6f0c, 0x3a88, 0x29C1}, // ⧁, \ogreaterthan, Circled Greater-Than
+{0x6204, 0x1146, 0xDF45'D835}, // U+1D745, 𝝅, \bipi, Mathematical Bold Italic Small Pi
+{0x7208, 0x4057, 0x2A22}, // ⨢, \ringplus, Plus Sign With Small Circle Above
+{0x6905, 0x2c30, 0xDEF8'D835}, // U+1D6F8, 𝛸, \itChi, Mathematical Italic Capital Chi
+{0x6206, 0x19bd, 0xDDE6'D835}, // U+1D5E6, 𝗦, \bsansS, Mathematical Sans-Serif Bold Capital S
+{0x6209, 0x1adb, 0xDF78'D835}, // U+1D778, 𝝸, \bsansiota, Mathematical Sans-Serif Bold Small Iota
+{0x6206, 0x1ae5, 0xDDF7'D835}, // U+1D5F7, 𝗷, \bsansj, Mathematical Sans-Serif Bold Small J
+{0x6508, 0x25ba, 0x29E5}, // ⧥, \eqvparsl, Identical To And Slanted Parallel
+{0x620e, 0x1565, 0xDFC5'D835}, // U+1D7C5, 𝟅, \bisansvartheta, Mathematical Sans-Serif Bold Italic Theta Symbol
+{0x520b, 0x04a3, 0x21DB}, // ⇛, \Rrightarrow, Rightwards Triple Arrow / Right Triple Arrow
+{0x6c05, 0x32b9, 0x22E6}, // ⋦, \lnsim, Less-Than But Not Equivalent To / Less Than But Not Equivalent To
+{0x6208, 0x10b0, 0x2A04}, // ⨄, \biguplus, N-Ary Union Operator With Plus
+{0x6403, 0x22f3, 0x0307}, // ̇, \dot, Combining Dot Above / Non-Spacing Dot Above
+{0x4405, 0x00ca, 0x2251}, // ≑, \Doteq, Geometrically Equal To
+{0x3503, 0x0045, 0x215A}, // ⅚, \5/6, Vulgar Fraction Five Sixths / Fraction Five Sixths
+{0x7403, 0x4a75, 0xDE81'D835}, // U+1D681, 𝚁, \ttR, Mathematical Monospace Capital R
+{0x6e0b, 0x3749, 0x2931}, // ⤱, \neovnwarrow, North East Arrow Crossing North West Arrow
+{0x6c0c, 0x2ff3, 0x2B38}, // ⬸, \leftdotarrow, Leftwards Arrow With Dotted Stem
+{0x6c0a, 0x31f1, 0x2A8B}, // ⪋, \lesseqqgtr, Less-Than Above Double-Line Equal Above Greater-Than
+{0x7305, 0x4131, 0xDDAB'D835}, // U+1D5AB, 𝖫, \sansL, Mathematical Sans-Serif Capital L
+{0x6206, 0x1011, 0x22C2}, // ⋂, \bigcap, N-Ary Intersection
+{0x5306, 0x04e8, 0x22D0}, // ⋐, \Subset, Double Subset
+{0x6312, 0x1fc8, 0x25D3}, // ◓, \circletophalfblack, Circle With Upper Half Black
+{0x7304, 0x4398, 0xDCC5'D835}, // U+1D4C5, 𝓅, \scrp, Mathematical Script Small P
+{0x650d, 0x24b3, 0x20DD}, // ⃝, \enclosecircle, Combining Enclosing Circle / Enclosing Circle
+{0x6e13, 0x3a0a, 0x2900}, // ⤀, \nvtwoheadrightarrow, Rightwards Two-Headed Arrow With Vertical Stroke
+{0x6203, 0x0f3b, 0xDC79'D835}, // U+1D479, 𝑹, \biR, Mathematical Bold Italic Capital R
+{0x6204, 0x09a2, 0x213C}, // ℼ, \bbpi, Double-Struck Small Pi
+{0x700e, 0x3c3b, 0x2031}, // ‱, \pertenthousand, Per Ten Thousand Sign
+{0x6203, 0x0e6b, 0xDC33'D835}, // U+1D433, 𝐳, \bfz, Mathematical Bold Small Z
+{0x6907, 0x2d4e, 0xDEFF'D835}, // U+1D6FF, 𝛿, \itdelta, Mathematical Italic Small Delta
+{0x6108, 0x07ac, 0x2652}, // ♒, \aquarius, Aquarius
+{0x5001, 0x03ac, 0x00B6}, // ¶, \P, Pilcrow Sign / Paragraph Sign
+{0x6206, 0x19a6, 0xDDE4'D835}, // U+1D5E4, 𝗤, \bsansQ, Mathematical Sans-Serif Bold Capital Q
+{0x6605, 0x272b, 0xDD24'D835}, // U+1D524, 𝔤, \frakg, Mathematical Fraktur Small G
+{0x7008, 0x3d4d, 0x2312}, // ⌒, \profline, Arc
+{0x7403, 0x4a59, 0xDE7A'D835}, // U+1D67A, 𝙺, \ttK, Mathematical Monospace Capital K
+{0x5f06, 0x070a, 0x2094}, // ₔ, \_schwa, Latin Subscript Small Letter Schwa
+{0x620d, 0x1c3f, 0xDF8C'D835}, // U+1D78C, 𝞌, \bsansvarkappa, Mathematical Sans-Serif Bold Kappa Symbol
+{0x6605, 0x2743, 0xDD28'D835}, // U+1D528, 𝔨, \frakk, Mathematical Fraktur Small K
+{0x7306, 0x46ec, 0x0336}, // ̶, \strike, Combining Long Stroke Overlay / Non-Spacing Long Bar Overlay
+{0x6207, 0x12ed, 0xDE50'D835}, // U+1D650, 𝙐, \bisansU, Mathematical Sans-Serif Bold Italic Capital U
+{0x5f02, 0x06c7, 0x2090}, // ₐ, \_a, Latin Subscript Small Letter A
+{0x6203, 0x0eed, 0xDC73'D835}, // U+1D473, 𝑳, \biL, Mathematical Bold Italic Capital L
+{0x620d, 0x1394, 0xDFC4'D835}, // U+1D7C4, 𝟄, \bisansepsilon, Mathematical Sans-Serif Bold Italic Epsilon Symbol
+{0x6203, 0x0ee1, 0xDC72'D835}, // U+1D472, 𝑲, \biK, Mathematical Bold Italic Capital K
+{0x6205, 0x1d18, 0xDCDE'D835}, // U+1D4DE, 𝓞, \bscrO, Mathematical Bold Script Capital O
+{0x6903, 0x2cd3, 0xDC45'D835}, // U+1D445, 𝑅, \itR, Mathematical Italic Capital R
+{0x730c, 0x44d2, 0x2B29}, // ⬩, \smblkdiamond, Black Small Diamond
+{0x4e11, 0x02fe, 0x0338'226B}, // ≫̸, \NotGreaterGreater, Much Greater-Than / Much Greater Than + Combining Long Solidus Overlay / Non-Spacing Long Slash Overlay
+{0x7610, 0x4f40, 0x2232}, // ∲, \varointclockwise, Clockwise Contour Integral
+{0x6414, 0x217a, 0x296D}, // ⥭, \dashrightharpoondown, Rightwards Harpoon With Barb Down Below Long Dash
+{0x7405, 0x4af2, 0xDFF7'D835}, // U+1D7F7, 𝟷, \ttone, Mathematical Monospace Digit One
+{0x7304, 0x46d4, 0x22C6}, // ⋆, \star, Star Operator
+{0x5212, 0x03fc, 0x295D}, // ⥝, \RightDownTeeVector, Downwards Harpoon With Barb Right From Bar
+{0x7305, 0x4286, 0xDDD2'D835}, // U+1D5D2, 𝗒, \sansy, Mathematical Sans-Serif Small Y
+{0x6307, 0x2087, 0x2254}, // ≔, \coloneq, Colon Equals / Colon Equal
+{0x6205, 0x0add, 0xDEBD'D835}, // U+1D6BD, 𝚽, \bfPhi, Mathematical Bold Capital Phi
+{0x7304, 0x4357, 0xDCB8'D835}, // U+1D4B8, 𝒸, \scrc, Mathematical Script Small C
+{0x6903, 0x2ea3, 0xDC66'D835}, // U+1D466, 𝑦, \ity, Mathematical Italic Small Y
+{0x7606, 0x4f5e, 0x03F1}, // ϱ, \varrho, Greek Rho Symbol / Greek Small Letter Tailed Rho
+{0x730b, 0x43de, 0x292D}, // ⤭, \seovnearrow, South East Arrow Crossing North East Arrow
+{0x6209, 0x1825, 0x29C5}, // ⧅, \boxbslash, Squared Falling Diagonal Slash
+{0x6207, 0x14b1, 0xDE68'D835}, // U+1D668, 𝙨, \bisanss, Mathematical Sans-Serif Bold Italic Small S
+{0x7304, 0x437a, 0xDCBF'D835}, // U+1D4BF, 𝒿, \scrj, Mathematical Script Small J
+{0x6d0d, 0x3482, 0x25FE}, // ◾, \mdsmblksquare, Black Medium Small Square
+{0x770f, 0x5175, 0x20E9}, // ⃩, \widebridgeabove, Combining Wide Bridge Above
+{0x6206, 0x10de, 0xDF3E'D835}, // U+1D73E, 𝜾, \biiota, Mathematical Bold Italic Small Iota
+{0x7206, 0x3df7, 0x0295}, // ʕ, \reglst, Latin Letter Pharyngeal Voiced Fricative / Latin Letter Reversed Glottal Stop
+{0x620a, 0x0e44, 0xDED3'D835}, // U+1D6D3, 𝛓, \bfvarsigma, Mathematical Bold Small Final Sigma
+{0x7302, 0x46d1, 0x00DF}, // ß, \ss, Latin Small Letter Sharp S
+{0x6e03, 0x380e, 0x0338}, // ̸, \not, Combining Long Solidus Overlay / Non-Spacing Long Slash Overlay
+{0x6207, 0x0bd0, 0xDECB'D835}, // U+1D6CB, 𝛋, \bfkappa, Mathematical Bold Small Kappa
+{0x6305, 0x2016, 0x25D2}, // ◒, \cirfb, Circle With Lower Half Black
+{0x6203, 0x091a, 0x2124}, // ℤ, \bbZ, Double-Struck Capital Z / Double-Struck Z
+{0x6308, 0x2022, 0x2A10}, // ⨐, \cirfnint, Circulation Function
+{0x7403, 0x4ac7, 0xDE90'D835}, // U+1D690, 𝚐, \ttg, Mathematical Monospace Small G
+{0x6205, 0x0a6f, 0xDEAE'D835}, // U+1D6AE, 𝚮, \bfEta, Mathematical Bold Capital Eta
+{0x7409, 0x4936, 0x23E2}, // ⏢, \trapezium, White Trapezium
+{0x4505, 0x0171, 0x2263}, // ≣, \Equiv, Strictly Equivalent To
+{0x6203, 0x0f79, 0xDC7F'D835}, // U+1D47F, 𝑿, \biX, Mathematical Bold Italic Capital X
+{0x620c, 0x19f1, 0xDF6A'D835}, // U+1D76A, 𝝪, \bsansUpsilon, Mathematical Sans-Serif Bold Capital Upsilon
+{0x6605, 0x2713, 0xDD20'D835}, // U+1D520, 𝔠, \frakc, Mathematical Fraktur Small C
+{0x5405, 0x0510, 0x2A2F}, // ⨯, \Times, Vector Or Cross Product
+{0x6c05, 0x31af, 0x2AA8}, // ⪨, \lescc, Less-Than Closed By Curve Above Slanted Equal
+{0x440a, 0x009a, 0x27F1}, // ⟱, \DDownarrow, Downwards Quadruple Arrow
+{0x4c0a, 0x01a3, 0x2B45}, // ⭅, \LLeftarrow, Leftwards Quadruple Arrow
+{0x6203, 0x08d9, 0xDD42'D835}, // U+1D542, 𝕂, \bbK, Mathematical Double-Struck Capital K
+{0x7403, 0x4aa5, 0xDE8D'D835}, // U+1D68D, 𝚍, \ttd, Mathematical Monospace Small D
+{0x7305, 0x440b, 0x2243}, // ≃, \simeq, Asymptotically Equal To
+{0x7407, 0x4b6c, 0x2A4B}, // ⩋, \twocaps, Intersection Beside And Joined With Intersection
+{0x6907, 0x2cf3, 0xDEE9'D835}, // U+1D6E9, 𝛩, \itTheta, Mathematical Italic Capital Theta
+{0x6406, 0x21b4, 0x20DC}, // ⃜, \ddddot, Combining Four Dots Above / Non-Spacing Four Dots Above
+{0x7006, 0x3d77, 0x028A}, // ʊ, \pupsil, Latin Small Letter Upsilon
+{0x520e, 0x0422, 0x295B}, // ⥛, \RightTeeVector, Rightwards Harpoon With Barb Up From Bar
+{0x6c11, 0x3000, 0x20D0}, // ⃐, \leftharpoonaccent, Combining Left Harpoon Above / Non-Spacing Left Harpoon Above
+{0x6806, 0x297a, 0x210F}, // ℏ, \hslash, Planck Constant Over Two Pi / Planck Constant Over 2 Pi
+{0x6207, 0x1353, 0xDE57'D835}, // U+1D657, 𝙗, \bisansb, Mathematical Sans-Serif Bold Italic Small B
+{0x6903, 0x2d35, 0xDC4F'D835}, // U+1D44F, 𝑏, \itb, Mathematical Italic Small B
+{0x6209, 0x1128, 0xDF44'D835}, // U+1D744, 𝝄, \biomicron, Mathematical Bold Italic Small Omicron
+{0x4411, 0x0114, 0x2956}, // ⥖, \DownLeftVectorBar, Leftwards Harpoon With Barb Down To Bar
+{0x720c, 0x4060, 0x2253}, // ≓, \risingdotseq, Image Of Or Approximately Equal To
+{0x730b, 0x44ec, 0x25AA}, // ▪, \smblksquare, Black Small Square
+{0x6406, 0x2159, 0x2621}, // ☡, \danger, Caution Sign
+{0x6d0a, 0x35e6, 0x2A2C}, // ⨬, \minusrdots, Minus Sign With Rising Dots
+{0x7403, 0x4a71, 0xDE80'D835}, // U+1D680, 𝚀, \ttQ, Mathematical Monospace Capital Q
+{0x640f, 0x2279, 0x2B18}, // ⬘, \diamondtopblack, Diamond With Top Half Black
+{0x6605, 0x2719, 0xDD21'D835}, // U+1D521, 𝔡, \frakd, Mathematical Fraktur Small D
+{0x6d0e, 0x3464, 0x25C6}, // ◆, \mdlgblkdiamond, Black Diamond
+{0x7508, 0x4df5, 0x03DB}, // ϛ, \upstigma, Greek Small Letter Stigma
+{0x6c0e, 0x3055, 0x21C7}, // ⇇, \leftleftarrows, Leftwards Paired Arrows / Left Paired Arrows
+{0x730a, 0x483a, 0x2ACC}, // ⫌, \supsetneqq, Superset Of Above Not Equal To
+{0x7304, 0x450b, 0x2AAC}, // ⪬, \smte, Smaller Than Or Equal To
+{0x620a, 0x15ec, 0xDF52'D835}, // U+1D752, 𝝒, \bivarkappa, Mathematical Bold Italic Kappa Symbol
+{0x4c0f, 0x0221, 0x2960}, // ⥠, \LeftUpTeeVector, Upwards Harpoon With Barb Left From Bar
+{0x6507, 0x25b2, 0x2A78}, // ⩸, \equivDD, Equivalent With Four Dots Above
+{0x7309, 0x425c, 0xDFE5'D835}, // U+1D7E5, 𝟥, \sansthree, Mathematical Sans-Serif Digit Three
+{0x620d, 0x17a5, 0x258C}, // ▌, \blocklefthalf, Left Half Block
+{0x6206, 0x0d6f, 0xDD96'D835}, // U+1D596, 𝖖, \bfrakq, Mathematical Bold Fraktur Small Q
+{0x6c11, 0x2f42, 0x2B4B}, // ⭋, \leftarrowbsimilar, Leftwards Arrow Above Reverse Tilde Operator
+{0x7203, 0x3de3, 0x201D}, // ”, \rdq, Right Double Quotation Mark / Double Comma Quotation Mark
+{0x7305, 0x4280, 0xDDD1'D835}, // U+1D5D1, 𝗑, \sansx, Mathematical Sans-Serif Small X
+{0x550b, 0x0544, 0x21D5}, // ⇕, \Updownarrow, Up Down Double Arrow
+{0x6e05, 0x385e, 0x2280}, // ⊀, \nprec, Does Not Precede
+{0x6206, 0x0cf8, 0xDD85'D835}, // U+1D585, 𝖅, \bfrakZ, Mathematical Bold Fraktur Capital Z
+{0x6205, 0x1d54, 0xDCE8'D835}, // U+1D4E8, 𝓨, \bscrY, Mathematical Bold Script Capital Y
+{0x7304, 0x43b1, 0xDCCA'D835}, // U+1D4CA, 𝓊, \scru, Mathematical Script Small U
+{0x760d, 0x50a0, 0x2B1E}, // ⬞, \vysmwhtsquare, White Very Small Square
+{0x4f05, 0x039c, 0x03A9}, // Ω, \Omega, Greek Capital Letter Omega
+{0x7204, 0x40b2, 0x0273}, // ɳ, \rtln, Latin Small Letter N With Retroflex Hook / Latin Small Letter N Retroflex Hook
+{0x6c0f, 0x2f1e, 0x2B4A}, // ⭊, \leftarrowapprox, Leftwards Arrow Above Almost Equal To
+{0x6207, 0x0a7d, 0xDEAA'D835}, // U+1D6AA, 𝚪, \bfGamma, Mathematical Bold Capital Gamma
+{0x740e, 0x4c0d, 0x219F}, // ↟, \twoheaduparrow, Upwards Two Headed Arrow / Up Two Headed Arrow
+{0x6903, 0x2c56, 0xDC39'D835}, // U+1D439, 𝐹, \itF, Mathematical Italic Capital F
+{0x680a, 0x295f, 0x25AD}, // ▭, \hrectangle, White Rectangle
+{0x6905, 0x2df4, 0xDF19'D835}, // U+1D719, 𝜙, \itphi, Mathematical Italic Phi Symbol
+{0x6705, 0x2842, 0x22E7}, // ⋧, \gnsim, Greater-Than But Not Equivalent To / Greater Than But Not Equivalent To
+{0x6205, 0x09e3, 0xDFDA'D835}, // U+1D7DA, 𝟚, \bbtwo, Mathematical Double-Struck Digit Two
+{0x6605, 0x26f5, 0xDD1B'D835}, // U+1D51B, 𝔛, \frakX, Mathematical Fraktur Capital X
+{0x730c, 0x4625, 0x25A6}, // ▦, \squarehvfill, Square With Orthogonal Crosshatch Fill
+{0x4b05, 0x0195, 0x039A}, // Κ, \Kappa, Greek Capital Letter Kappa
+{0x6203, 0x0f45, 0xDC7A'D835}, // U+1D47A, 𝑺, \biS, Mathematical Bold Italic Capital S
+{0x7404, 0x4904, 0x2927}, // ⤧, \tona, North West Arrow And North East Arrow
+{0x6e0f, 0x363f, 0x21CE}, // ⇎, \nLeftrightarrow, Left Right Double Arrow With Stroke
+{0x6505, 0x2572, 0x2242}, // ≂, \eqsim, Minus Tilde
+{0x6207, 0x0a4f, 0xDEAB'D835}, // U+1D6AB, 𝚫, \bfDelta, Mathematical Bold Capital Delta
+{0x6205, 0x1d8a, 0xDCF1'D835}, // U+1D4F1, 𝓱, \bscrh, Mathematical Bold Script Small H
+{0x6203, 0x0df5, 0xDC2E'D835}, // U+1D42E, 𝐮, \bfu, Mathematical Bold Small U
+{0x7309, 0x46d9, 0x225B}, // ≛, \starequal, Star Equals
+{0x7206, 0x40a1, 0x22CA}, // ⋊, \rtimes, Right Normal Factor Semidirect Product
+{0x7304, 0x436b, 0x210A}, // ℊ, \scrg, Script Small G
+{0x7308, 0x47b7, 0x22E9}, // ⋩, \succnsim, Succeeds But Not Equivalent To
+{0x730c, 0x46b0, 0x25F3}, // ◳, \squareurquad, White Square With Upper Right Quadrant
+{0x6906, 0x2b6c, 0xDE29'D835}, // U+1D629, 𝘩, \isansh, Mathematical Sans-Serif Italic Small H
+{0x7606, 0x4f2e, 0x22FB}, // ⋻, \varnis, Contains With Vertical Bar At End Of Horizontal Stroke
+{0x6207, 0x0ac7, 0xDEC0'D835}, // U+1D6C0, 𝛀, \bfOmega, Mathematical Bold Capital Omega
+{0x6507, 0x24f5, 0x2002}, //  , \enspace, En Space
+{0x7702, 0x5193, 0x2240}, // ≀, \wr, Wreath Product
+{0x6203, 0x0b54, 0xDC1B'D835}, // U+1D41B, 𝐛, \bfb, Mathematical Bold Small B
+{0x6e05, 0x38d4, 0x2281}, // ⊁, \nsucc, Does Not Succeed
+{0x630c, 0x1f96, 0x25F6}, // ◶, \circlelrquad, White Circle With Lower Right Quadrant
+{0x6c08, 0x2ef8, 0x223E}, // ∾, \lazysinv, Inverted Lazy S
+{0x550d, 0x052e, 0x296E}, // ⥮, \UpEquilibrium, Upwards Harpoon With Barb Left Beside Downwards Harpoon With Barb Right
+{0x630f, 0x213b, 0x21B7}, // ↷, \curvearrowright, Clockwise Top Semicircle Arrow
+{0x6c07, 0x31df, 0x22D6}, // ⋖, \lessdot, Less-Than With Dot / Less Than With Dot
+{0x6205, 0x1140, 0xDF53'D835}, // U+1D753, 𝝓, \biphi, Mathematical Bold Italic Phi Symbol
+{0x6d09, 0x35af, 0x2A5D}, // ⩝, \midbarvee, Logical Or With Horizontal Dash
+{0x520b, 0x04b3, 0x29F4}, // ⧴, \RuleDelayed, Rule-Delayed
+{0x6205, 0x0f26, 0xDF31'D835}, // U+1D731, 𝜱, \biPhi, Mathematical Bold Italic Capital Phi
+{0x760b, 0x5032, 0x20D2}, // ⃒, \vertoverlay, Combining Long Vertical Line Overlay / Non-Spacing Long Vertical Bar Overlay
+{0x7305, 0x421e, 0xDDC8'D835}, // U+1D5C8, 𝗈, \sanso, Mathematical Sans-Serif Small O
+{0x6207, 0x1414, 0xDE62'D835}, // U+1D662, 𝙢, \bisansm, Mathematical Sans-Serif Bold Italic Small M
+{0x6205, 0x114b, 0xDF4D'D835}, // U+1D74D, 𝝍, \bipsi, Mathematical Bold Italic Small Psi
+{0x7304, 0x4334, 0xDCB1'D835}, // U+1D4B1, 𝒱, \scrV, Mathematical Script Capital V
+{0x6907, 0x2c7d, 0xDEEB'D835}, // U+1D6EB, 𝛫, \itKappa, Mathematical Italic Capital Kappa
+{0x670e, 0x28b0, 0x203A}, // ›, \guilsinglright, Single Right-Pointing Angle Quotation Mark / Right Pointing Single Guillemet
+{0x7204, 0x40b7, 0x027D}, // ɽ, \rtlr, Latin Small Letter R With Tail / Latin Small Letter R Hook
+{0x620c, 0x10c9, 0x2606}, // ☆, \bigwhitestar, White Star
+{0x6203, 0x094c, 0xDD58'D835}, // U+1D558, 𝕘, \bbg, Mathematical Double-Struck Small G
+{0x6909, 0x2cff, 0xDEF6'D835}, // U+1D6F6, 𝛶, \itUpsilon, Mathematical Italic Capital Upsilon
+{0x6205, 0x0b63, 0xDED8'D835}, // U+1D6D8, 𝛘, \bfchi, Mathematical Bold Small Chi
+{0x720e, 0x3eb7, 0x2945}, // ⥅, \rightarrowplus, Rightwards Arrow With Plus Below
+{0x6f0b, 0x3b5c, 0x2A35}, // ⨵, \otimesrhrim, Multiplication Sign In Right Half Circle
+{0x5e02, 0x05a2, 0x00B9}, // ¹, \^1, Superscript One / Superscript Digit One
+{0x6208, 0x1bde, 0xDF83'D835}, // U+1D783, 𝞃, \bsanstau, Mathematical Sans-Serif Bold Small Tau
+{0x6306, 0x1e69, 0x2A40}, // ⩀, \capdot, Intersection With Dot
+{0x6e17, 0x3a1e, 0x2917}, // ⤗, \nvtwoheadrightarrowtail, Rightwards Two-Headed Arrow With Tail With Vertical Stroke
+{0x7403, 0x4b28, 0xDE9E'D835}, // U+1D69E, 𝚞, \ttu, Mathematical Monospace Small U
+{0x6206, 0x189b, 0xDDD5'D835}, // U+1D5D5, 𝗕, \bsansB, Mathematical Sans-Serif Bold Capital B
+{0x5f02, 0x0711, 0x209C}, // ₜ, \_t, Latin Subscript Small Letter T
+{0x6106, 0x076a, 0x299E}, // ⦞, \angles, Angle With S Inside
+{0x4e11, 0x0347, 0x0338'2AA1}, // ⪡̸, \NotNestedLessLess, Double Nested Less-Than + Combining Long Solidus Overlay / Non-Spacing Long Slash Overlay
+{0x6207, 0x09c3, 0xDFDF'D835}, // U+1D7DF, 𝟟, \bbseven, Mathematical Double-Struck Digit Seven
+{0x6203, 0x0a2a, 0xDC00'D835}, // U+1D400, 𝐀, \bfA, Mathematical Bold Capital A
+{0x7802, 0x5196, 0x03BE}, // ξ, \xi, Greek Small Letter Xi
+{0x6407, 0x230f, 0x2214}, // ∔, \dotplus, Dot Plus
+{0x6c0f, 0x2fc8, 0x2B3F}, // ⬿, \leftcurvedarrow, Wave Arrow Pointing Directly Left
+{0x7403, 0x4a55, 0xDE79'D835}, // U+1D679, 𝙹, \ttJ, Mathematical Monospace Capital J
+{0x6704, 0x27cb, 0x2267}, // ≧, \geqq, Greater-Than Over Equal To / Greater Than Over Equal To
+{0x620c, 0x1407, 0xDFB4'D835}, // U+1D7B4, 𝞴, \bisanslambda, Mathematical Sans-Serif Bold Italic Small Lamda
+{0x6207, 0x1018, 0x25CB}, // ○, \bigcirc, White Circle
+{0x6207, 0x12cf, 0xDE4F'D835}, // U+1D64F, 𝙏, \bisansT, Mathematical Sans-Serif Bold Italic Capital T
+{0x6212, 0x1e0e, 0x2B47}, // ⭇, \bsimilarrightarrow, Reverse Tilde Operator Above Rightwards Arrow
+{0x7403, 0x4a85, 0xDE85'D835}, // U+1D685, 𝚅, \ttV, Mathematical Monospace Capital V
+{0x6209, 0x136e, 0xDFC0'D835}, // U+1D7C0, 𝟀, \bisanschi, Mathematical Sans-Serif Bold Italic Small Chi
+{0x7304, 0x42e9, 0xDCA2'D835}, // U+1D4A2, 𝒢, \scrG, Mathematical Script Capital G
+{0x7304, 0x42ee, 0x210B}, // ℋ, \scrH, Script Capital H / Script H
+{0x6209, 0x080f, 0x2035}, // ‵, \backprime, Reversed Prime
+{0x690c, 0x2e4e, 0xDF00'D835}, // U+1D700, 𝜀, \itvarepsilon, Mathematical Italic Small Epsilon
+{0x7409, 0x4b5c, 0x2319}, // ⌙, \turnednot, Turned Not Sign
+{0x6605, 0x276d, 0xDD2F'D835}, // U+1D52F, 𝔯, \frakr, Mathematical Fraktur Small R
+{0x750e, 0x4d89, 0x21BE}, // ↾, \upharpoonright, Upwards Harpoon With Barb Rightwards / Up Harpoon With Barb Right
+{0x6208, 0x1251, 0xDF9C'D835}, // U+1D79C, 𝞜, \bisansNu, Mathematical Sans-Serif Bold Italic Capital Nu
+{0x6203, 0x09fd, 0xDD6B'D835}, // U+1D56B, 𝕫, \bbz, Mathematical Double-Struck Small Z
+{0x6205, 0x1d66, 0xDCEB'D835}, // U+1D4EB, 𝓫, \bscrb, Mathematical Bold Script Small B
+{0x6306, 0x20f2, 0x228D}, // ⊍, \cupdot, Multiset Multiplication
+{0x6906, 0x2bce, 0xDE37'D835}, // U+1D637, 𝘷, \isansv, Mathematical Sans-Serif Italic Small V
+{0x640c, 0x2354, 0x2A62}, // ⩢, \doublebarvee, Logical Or With Double Overbar
+{0x6209, 0x082b, 0x22FF}, // ⋿, \bagmember, Z Notation Bag Membership
+{0x6207, 0x12a1, 0xDE4C'D835}, // U+1D64C, 𝙌, \bisansQ, Mathematical Sans-Serif Bold Italic Capital Q
+{0x6208, 0x1608, 0xDF54'D835}, // U+1D754, 𝝔, \bivarrho, Mathematical Bold Italic Rho Symbol
+{0x6e09, 0x3792, 0x0338'2A7E}, // ⩾̸, \ngeqslant, Greater-Than Or Slanted Equal To + Combining Long Solidus Overlay / Non-Spacing Long Slash Overlay
+{0x730a, 0x474f, 0x2ABF}, // ⪿, \subsetplus, Subset With Plus Sign Below
+{0x6e0c, 0x3812, 0x2340}, // ⍀, \notbackslash, Apl Functional Symbol Backslash Bar
+{0x680e, 0x294a, 0x21AA}, // ↪, \hookrightarrow, Rightwards Arrow With Hook / Right Arrow With Hook
+{0x6203, 0x0b30, 0xDC17'D835}, // U+1D417, 𝐗, \bfX, Mathematical Bold Capital X
+{0x6203, 0x097d, 0xDD5C'D835}, // U+1D55C, 𝕜, \bbk, Mathematical Double-Struck Small K
+{0x6205, 0x1dcc, 0xDCFC'D835}, // U+1D4FC, 𝓼, \bscrs, Mathematical Bold Script Small S
+{0x6206, 0x0840, 0x2A42}, // ⩂, \barcup, Union With Overbar
+{0x6907, 0x2ce1, 0xDEF4'D835}, // U+1D6F4, 𝛴, \itSigma, Mathematical Italic Capital Sigma
+{0x6904, 0x2a80, 0x03B9}, // ι, \iota, Greek Small Letter Iota
+{0x5e06, 0x0657, 0x1DB2}, // ᶲ, \^ltphi, Modifier Letter Small Phi
+{0x7304, 0x43a7, 0xDCC8'D835}, // U+1D4C8, 𝓈, \scrs, Mathematical Script Small S
+{0x6207, 0x0a22, 0x226C}, // ≬, \between, Between
+{0x6203, 0x08dd, 0xDD43'D835}, // U+1D543, 𝕃, \bbL, Mathematical Double-Struck Capital L
+{0x6206, 0x0da7, 0xDD9E'D835}, // U+1D59E, 𝖞, \bfraky, Mathematical Bold Fraktur Small Y
+{0x7605, 0x4f58, 0x03D6}, // ϖ, \varpi, Greek Pi Symbol / Greek Small Letter Omega Pi
+{0x6410, 0x2225, 0x291D}, // ⤝, \diamondleftarrow, Leftwards Arrow To Black Diamond
+{0x6207, 0x1995, 0xDF65'D835}, // U+1D765, 𝝥, \bsansPi, Mathematical Sans-Serif Bold Capital Pi
+{0x6203, 0x08cd, 0x210D}, // ℍ, \bbH, Double-Struck Capital H / Double-Struck H
+{0x6213, 0x168a, 0x25C8}, // ◈, \blackinwhitediamond, White Diamond Containing Black Small Diamond
+{0x6605, 0x274f, 0xDD2A'D835}, // U+1D52A, 𝔪, \frakm, Mathematical Fraktur Small M
+{0x750a, 0x4c76, 0x23DF}, // ⏟, \underbrace, Bottom Curly Bracket
+{0x620c, 0x1a8a, 0xDF8A'D835}, // U+1D78A, 𝞊, \bsansepsilon, Mathematical Sans-Serif Bold Epsilon Symbol
+{0x4402, 0x00a8, 0x0110}, // Đ, \DJ, Latin Capital Letter D With Stroke / Latin Capital Letter D Bar
+{0x7409, 0x48ca, 0x2040}, // ⁀, \tieconcat, Character Tie
+{0x6207, 0x1851, 0x229E}, // ⊞, \boxplus, Squared Plus
+{0x6605, 0x26cb, 0xDD14'D835}, // U+1D514, 𝔔, \frakQ, Mathematical Fraktur Capital Q
+{0x6909, 0x2ddc, 0xDF0A'D835}, // U+1D70A, 𝜊, \itomicron, Mathematical Italic Small Omicron
+{0x7405, 0x4b66, 0x029E}, // ʞ, \turnk, Latin Small Letter Turned K
+{0x6203, 0x0b9b, 0xDC1F'D835}, // U+1D41F, 𝐟, \bff, Mathematical Bold Small F
+{0x7403, 0x4a95, 0xDE89'D835}, // U+1D689, 𝚉, \ttZ, Mathematical Monospace Capital Z
+{0x6f05, 0x3a59, 0x030A}, // ̊, \ocirc, Combining Ring Above / Non-Spacing Ring Above
+{0x650d, 0x24d0, 0x20DE}, // ⃞, \enclosesquare, Combining Enclosing Square / Enclosing Square
+{0x7207, 0x4099, 0x2ACE}, // ⫎, \rsqhook, Square Right Open Box Operator
+{0x7306, 0x43cf, 0x22B1}, // ⊱, \scurel, Succeeds Under Relation
+{0x5e02, 0x068e, 0x02B7}, // ʷ, \^w, Modifier Letter Small W
+{0x6203, 0x0922, 0xDD53'D835}, // U+1D553, 𝕓, \bbb, Mathematical Double-Struck Small B
+{0x7505, 0x4c3c, 0x25DC}, // ◜, \ularc, Upper Left Quadrant Circular Arc
+{0x6605, 0x26b9, 0xDD11'D835}, // U+1D511, 𝔑, \frakN, Mathematical Fraktur Capital N
+{0x6207, 0x0c0a, 0xDEDA'D835}, // U+1D6DA, 𝛚, \bfomega, Mathematical Bold Small Omega
+{0x5e02, 0x05ed, 0x1D40}, // ᵀ, \^T, Modifier Letter Capital T
+{0x7214, 0x3e61, 0x2B48}, // ⭈, \rightarrowbackapprox, Rightwards Arrow Above Reverse Almost Equal To
+{0x7304, 0x431b, 0xDCAC'D835}, // U+1D4AC, 𝒬, \scrQ, Mathematical Script Capital Q
+{0x760d, 0x4f83, 0xFE00'228A}, // ⊊︀, \varsubsetneqq, Subset Of With Not Equal To / Subset Of Or Not Equal To + Variation Selector-1
+{0x620b, 0x07ec, 0x03F6}, // ϶, \backepsilon, Greek Reversed Lunate Epsilon Symbol
+{0x6204, 0x0ae3, 0xDEB7'D835}, // U+1D6B7, 𝚷, \bfPi, Mathematical Bold Capital Pi
+{0x5a04, 0x058b, 0x0396}, // Ζ, \Zeta, Greek Capital Letter Zeta
+{0x7210, 0x3ff6, 0x21C9}, // ⇉, \rightrightarrows, Rightwards Paired Arrows / Right Paired Arrows
+{0x6205, 0x0a45, 0xDEBE'D835}, // U+1D6BE, 𝚾, \bfChi, Mathematical Bold Capital Chi
+{0x7609, 0x4f24, 0x22FD}, // ⋽, \varniobar, Contains With Overbar
+{0x7403, 0x4adb, 0xDE95'D835}, // U+1D695, 𝚕, \ttl, Mathematical Monospace Small L
+{0x6209, 0x1a29, 0xDF5B'D835}, // U+1D75B, 𝝛, \bsansZeta, Mathematical Sans-Serif Bold Capital Zeta
+{0x6d0e, 0x3473, 0x25C7}, // ◇, \mdlgwhtdiamond, White Diamond
+{0x6e10, 0x36a3, 0x2915}, // ⤕, \nVrightarrowtail, Rightwards Arrow With Tail With Double Vertical Stroke
+{0x6305, 0x1eaa, 0x030C}, // ̌, \check, Combining Caron / Non-Spacing Hacek
+{0x7408, 0x48f3, 0x2A31}, // ⨱, \timesbar, Multiplication Sign With Underbar
+{0x520b, 0x03cf, 0x2B46}, // ⭆, \RRightarrow, Rightwards Quadruple Arrow
+{0x7404, 0x4a2c, 0x028E}, // ʎ, \trny, Latin Small Letter Turned Y
+{0x6203, 0x0bbd, 0xDC22'D835}, // U+1D422, 𝐢, \bfi, Mathematical Bold Small I
+{0x7308, 0x4292, 0xDFE2'D835}, // U+1D7E2, 𝟢, \sanszero, Mathematical Sans-Serif Digit Zero
+{0x6909, 0x2dea, 0xDF15'D835}, // U+1D715, 𝜕, \itpartial, Mathematical Italic Partial Differential
+{0x7305, 0x42a8, 0x02D3}, // ˓, \sblhr, Modifier Letter Centred Left Half Ring / Modifier Letter Centered Left Half Ring
+{0x6c13, 0x3105, 0x2966}, // ⥦, \leftrightharpoonsup, Leftwards Harpoon With Barb Up Above Rightwards Harpoon With Barb Up
+{0x6203, 0x10e5, 0xDC8B'D835}, // U+1D48B, 𝒋, \bij, Mathematical Bold Italic Small J
+{0x6203, 0x0a61, 0xDC04'D835}, // U+1D404, 𝐄, \bfE, Mathematical Bold Capital E
+{0x7307, 0x43f9, 0x29E2}, // ⧢, \shuffle, Shuffle Product
+{0x7306, 0x4709, 0x2282}, // ⊂, \subset, Subset Of
+{0x6906, 0x2c0e, 0x22F8}, // ⋸, \isinvb, Element Of With Underbar
+{0x620b, 0x1767, 0x2422}, // ␢, \blanksymbol, Blank Symbol / Blank
+{0x6214, 0x16f5, 0x25D7}, // ◗, \blackrighthalfcircle, Right Half Black Circle
+{0x6206, 0x10b9, 0x22C1}, // ⋁, \bigvee, N-Ary Logical Or
+{0x7403, 0x4909, 0x22A4}, // ⊤, \top, Down Tack
+{0x7206, 0x3e20, 0x230B}, // ⌋, \rfloor, Right Floor
+{0x5e02, 0x0697, 0x1DBB}, // ᶻ, \^z, Modifier Letter Small Z
+{0x6c05, 0x3368, 0x25DE}, // ◞, \lrarc, Lower Right Quadrant Circular Arc
+{0x6902, 0x29c2, 0x2208}, // ∈, \in, Element Of
+{0x6605, 0x26d1, 0x211C}, // ℜ, \frakR, Black-Letter Capital R / Black-Letter R
+{0x7304, 0x4302, 0x2112}, // ℒ, \scrL, Script Capital L / Script L
+{0x6909, 0x2e35, 0xDF10'D835}, // U+1D710, 𝜐, \itupsilon, Mathematical Italic Small Upsilon
+{0x6206, 0x0cf1, 0xDD84'D835}, // U+1D584, 𝖄, \bfrakY, Mathematical Bold Fraktur Capital Y
+{0x6e0b, 0x3995, 0x21F7}, // ⇷, \nvleftarrow, Leftwards Arrow With Vertical Stroke
+{0x6906, 0x2c25, 0xDEE3'D835}, // U+1D6E3, 𝛣, \itBeta, Mathematical Italic Capital Beta
+{0x6f03, 0x3a95, 0x2126}, // Ω, \ohm, Ohm Sign / Ohm
+{0x6c0b, 0x2fbc, 0x290C}, // ⤌, \leftbkarrow, Leftwards Double Dash Arrow
+{0x7403, 0x4a41, 0xDE74'D835}, // U+1D674, 𝙴, \ttE, Mathematical Monospace Capital E
+{0x6e0c, 0x3864, 0x22E0}, // ⋠, \npreccurlyeq, Does Not Precede Or Equal
+{0x5e02, 0x0651, 0x1D4F}, // ᵏ, \^k, Modifier Letter Small K
+{0x7403, 0x4a9d, 0xDE8B'D835}, // U+1D68B, 𝚋, \ttb, Mathematical Monospace Small B
+{0x7305, 0x416f, 0xDDB1'D835}, // U+1D5B1, 𝖱, \sansR, Mathematical Sans-Serif Capital R
+{0x6203, 0x0afc, 0xDC12'D835}, // U+1D412, 𝐒, \bfS, Mathematical Bold Capital S
+{0x7211, 0x3e97, 0x291E}, // ⤞, \rightarrowdiamond, Rightwards Arrow To Black Diamond
+{0x750a, 0x4e4e, 0x25F9}, // ◹, \urtriangle, Upper Right Triangle
+{0x6207, 0x0ddf, 0xDEC9'D835}, // U+1D6C9, 𝛉, \bftheta, Mathematical Bold Small Theta
+{0x6406, 0x214b, 0x2020}, // †, \dagger, Dagger
+{0x7305, 0x411f, 0xDDA8'D835}, // U+1D5A8, 𝖨, \sansI, Mathematical Sans-Serif Capital I
+{0x6906, 0x2a85, 0xDE08'D835}, // U+1D608, 𝘈, \isansA, Mathematical Sans-Serif Italic Capital A
+{0x7305, 0x41f7, 0xDDC3'D835}, // U+1D5C3, 𝗃, \sansj, Mathematical Sans-Serif Small J
+{0x7407, 0x4b74, 0x2A4A}, // ⩊, \twocups, Union Beside And Joined With Union
+{0x630e, 0x212c, 0x21B6}, // ↶, \curvearrowleft, Anticlockwise Top Semicircle Arrow
+{0x6d07, 0x359f, 0x263F}, // ☿, \mercury, Mercury
+{0x750e, 0x4d34, 0x21A8}, // ↨, \updownarrowbar, Up Down Arrow With Base
+{0x620b, 0x12c3, 0xDFA2'D835}, // U+1D7A2, 𝞢, \bisansSigma, Mathematical Sans-Serif Bold Italic Capital Sigma
+{0x3203, 0x002d, 0x2154}, // ⅔, \2/3, Vulgar Fraction Two Thirds / Fraction Two Thirds
+{0x7606, 0x4f51, 0x03C6}, // φ, \varphi, Greek Small Letter Phi
+{0x6903, 0x2e09, 0xDC5F'D835}, // U+1D45F, 𝑟, \itr, Mathematical Italic Small R
+{0x7007, 0x3cda, 0x2034}, // ‴, \ppprime, Triple Prime
+{0x7307, 0x4492, 0x220A}, // ∊, \smallin, Small Element Of
+{0x6203, 0x08a9, 0xDD38'D835}, // U+1D538, 𝔸, \bbA, Mathematical Double-Struck Capital A
+{0x7205, 0x3da4, 0x2944}, // ⥄, \rLarr, Short Rightwards Arrow Above Leftwards Arrow
+{0x7403, 0x4acb, 0xDE91'D835}, // U+1D691, 𝚑, \tth, Mathematical Monospace Small H
+{0x620b, 0x153d, 0xDFC9'D835}, // U+1D7C9, 𝟉, \bisansvarpi, Mathematical Sans-Serif Bold Italic Pi Symbol
+{0x730c, 0x4528, 0x2B2B}, // ⬫, \smwhtlozenge, White Small Lozenge
+{0x7304, 0x4393, 0x2134}, // ℴ, \scro, Script Small O
+{0x6206, 0x1b6c, 0xDDFD'D835}, // U+1D5FD, 𝗽, \bsansp, Mathematical Sans-Serif Bold Small P
+{0x690a, 0x2e8b, 0xDF17'D835}, // U+1D717, 𝜗, \itvartheta, Mathematical Italic Theta Symbol
+{0x6209, 0x178b, 0x2588}, // █, \blockfull, Full Block
+{0x620a, 0x1a7f, 0xDFF4'D835}, // U+1D7F4, 𝟴, \bsanseight, Mathematical Sans-Serif Bold Digit Eight
+{0x6409, 0x2377, 0x2193}, // ↓, \downarrow, Downwards Arrow / Down Arrow
+{0x5f02, 0x06bb, 0x2087}, // ₇, \_7, Subscript Seven / Subscript Digit Seven
+{0x6605, 0x2701, 0x2128}, // ℨ, \frakZ, Black-Letter Capital Z / Black-Letter Z
+{0x6605, 0x26a1, 0xDD0D'D835}, // U+1D50D, 𝔍, \frakJ, Mathematical Fraktur Capital J
+{0x7414, 0x4b9e, 0x2B3B}, // ⬻, \twoheadleftarrowtail, Leftwards Two-Headed Arrow With Tail
+{0x6c05, 0x33a5, 0x2A8F}, // ⪏, \lsimg, Less-Than Above Similar Above Greater-Than
+{0x7406, 0x490d, 0x2336}, // ⌶, \topbot, Apl Functional Symbol I-Beam
+{0x7706, 0x50f0, 0x2259}, // ≙, \wedgeq, Estimates
+{0x7307, 0x47df, 0x2AC4}, // ⫄, \supedot, Superset Of Or Equal To With Dot Above
+{0x6903, 0x2e9a, 0xDC65'D835}, // U+1D465, 𝑥, \itx, Mathematical Italic Small X
+{0x7304, 0x42cb, 0xDC9C'D835}, // U+1D49C, 𝒜, \scrA, Mathematical Script Capital A
+{0x740f, 0x49ce, 0x22B5}, // ⊵, \trianglerighteq, Contains As Normal Subgroup Or Equal To
+{0x720d, 0x3f08, 0x2911}, // ⤑, \rightdotarrow, Rightwards Arrow With Dotted Stem
+{0x4c01, 0x01a1, 0x0141}, // Ł, \L, Latin Capital Letter L With Stroke / Latin Capital Letter L Slash
+{0x6c0a, 0x3300, 0x27FC}, // ⟼, \longmapsto, Long Rightwards Arrow From Bar
+{0x6206, 0x1afe, 0xDDF9'D835}, // U+1D5F9, 𝗹, \bsansl, Mathematical Sans-Serif Bold Small L
+{0x7304, 0x432f, 0xDCB0'D835}, // U+1D4B0, 𝒰, \scrU, Mathematical Script Capital U
+{0x6917, 0x2a50, 0x25DB}, // ◛, \invwhitelowerhalfcircle, Lower Half Inverse White Circle
+{0x6206, 0x0ba6, 0xDFD2'D835}, // U+1D7D2, 𝟒, \bffour, Mathematical Bold Digit Four
+{0x6e10, 0x3685, 0x21FC}, // ⇼, \nVleftrightarrow, Left Right Arrow With Double Vertical Stroke
+{0x730b, 0x443d, 0x2A6C}, // ⩬, \simminussim, Similar Minus Similar
+{0x6e07, 0x37a1, 0x2275}, // ≵, \ngtrsim, Neither Greater-Than Nor Equivalent To / Neither Greater Than Nor Equivalent To
+{0x620d, 0x1c21, 0xDF67'D835}, // U+1D767, 𝝧, \bsansvarTheta, Mathematical Sans-Serif Bold Capital Theta Symbol
+{0x6203, 0x0dd5, 0xDC2D'D835}, // U+1D42D, 𝐭, \bft, Mathematical Bold Small T
+{0x7005, 0x3d6d, 0x028B}, // ʋ, \pscrv, Latin Small Letter V With Hook / Latin Small Letter Script V
+{0x7403, 0x4b34, 0xDEA1'D835}, // U+1D6A1, 𝚡, \ttx, Mathematical Monospace Small X
+{0x6206, 0x0dae, 0xDD9F'D835}, // U+1D59F, 𝖟, \bfrakz, Mathematical Bold Fraktur Small Z
+{0x5e02, 0x05d2, 0x1D35}, // ᴵ, \^I, Modifier Letter Capital I
+{0x6c13, 0x3130, 0x21AD}, // ↭, \leftrightsquigarrow, Left Right Wave Arrow
+{0x520a, 0x0485, 0x21D2}, // ⇒, \Rightarrow, Rightwards Double Arrow / Right Double Arrow
+{0x6903, 0x2d91, 0xDC57'D835}, // U+1D457, 𝑗, \itj, Mathematical Italic Small J
+{0x7008, 0x3cab, 0x2A28}, // ⨨, \plustrif, Plus Sign With Black Triangle
+{0x7304, 0x43ca, 0xDCCF'D835}, // U+1D4CF, 𝓏, \scrz, Mathematical Script Small Z
+{0x6906, 0x2b7a, 0xDE2B'D835}, // U+1D62B, 𝘫, \isansj, Mathematical Sans-Serif Italic Small J
+{0x7007, 0x3c98, 0x2A26}, // ⨦, \plussim, Plus Sign With Tilde Below
+{0x5f02, 0x06eb, 0x2097}, // ₗ, \_l, Latin Subscript Small Letter L
+{0x6203, 0x162b, 0xDC99'D835}, // U+1D499, 𝒙, \bix, Mathematical Bold Italic Small X
+{0x6203, 0x0ebe, 0xDC6D'D835}, // U+1D46D, 𝑭, \biF, Mathematical Bold Italic Capital F
+{0x6209, 0x13a2, 0xDFB0'D835}, // U+1D7B0, 𝞰, \bisanseta, Mathematical Sans-Serif Bold Italic Small Eta
+{0x620b, 0x1347, 0xDFAA'D835}, // U+1D7AA, 𝞪, \bisansalpha, Mathematical Sans-Serif Bold Italic Small Alpha
+{0x7305, 0x41a5, 0xDDBA'D835}, // U+1D5BA, 𝖺, \sansa, Mathematical Sans-Serif Small A
+{0x6e06, 0x371d, 0x226D}, // ≭, \nasymp, Not Equivalent To
+{0x7504, 0x4cec, 0x039C}, // Μ, \upMu, Greek Capital Letter Mu
+{0x4e0b, 0x0323, 0x0338'226A}, // ≪̸, \NotLessLess, Much Less-Than / Much Less Than + Combining Long Solidus Overlay / Non-Spacing Long Slash Overlay
+{0x6810, 0x28f4, 0x22B9}, // ⊹, \hermitconjmatrix, Hermitian Conjugate Matrix
+{0x6d02, 0x360a, 0x03BC}, // μ, \mu, Greek Small Letter Mu
+{0x6208, 0x141c, 0xDFB5'D835}, // U+1D7B5, 𝞵, \bisansmu, Mathematical Sans-Serif Bold Italic Small Mu
+{0x6208, 0x1484, 0xDFB9'D835}, // U+1D7B9, 𝞹, \bisanspi, Mathematical Sans-Serif Bold Italic Small Pi
+{0x7306, 0x4857, 0x2AD4}, // ⫔, \supsub, Superset Above Subset
+{0x6208, 0x1584, 0xDFB7'D835}, // U+1D7B7, 𝞷, \bisansxi, Mathematical Sans-Serif Bold Italic Small Xi
+{0x7404, 0x4927, 0x292A}, // ⤪, \towa, South West Arrow And North West Arrow
+{0x6e07, 0x3715, 0x2249}, // ≉, \napprox, Not Almost Equal To
+{0x6209, 0x0a57, 0xDFCA'D835}, // U+1D7CA, 𝟊, \bfDigamma, Mathematical Bold Capital Digamma
+{0x6206, 0x1810, 0x22C8}, // ⋈, \bowtie, Bowtie
+{0x640f, 0x2381, 0x2908}, // ⤈, \downarrowbarred, Downwards Arrow With Horizontal Stroke
+{0x6203, 0x08bd, 0xDD3D'D835}, // U+1D53D, 𝔽, \bbF, Mathematical Double-Struck Capital F
+{0x620e, 0x1501, 0xDFA1'D835}, // U+1D7A1, 𝞡, \bisansvarTheta, Mathematical Sans-Serif Bold Italic Capital Theta Symbol
+{0x6906, 0x2b03, 0xDE1A'D835}, // U+1D61A, 𝘚, \isansS, Mathematical Sans-Serif Italic Capital S
+{0x6207, 0x125a, 0xDE4A'D835}, // U+1D64A, 𝙊, \bisansO, Mathematical Sans-Serif Bold Italic Capital O
+{0x6906, 0x2b57, 0xDE26'D835}, // U+1D626, 𝘦, \isanse, Mathematical Sans-Serif Italic Small E
+{0x6703, 0x2821, 0x2AA5}, // ⪥, \gla, Greater-Than Beside Less-Than
+{0x6206, 0x0c6c, 0xDD71'D835}, // U+1D571, 𝕱, \bfrakF, Mathematical Bold Fraktur Capital F
+{0x6209, 0x14cd, 0xDFBD'D835}, // U+1D7BD, 𝞽, \bisanstau, Mathematical Sans-Serif Bold Italic Small Tau
+{0x6308, 0x2118, 0x22CE}, // ⋎, \curlyvee, Curly Logical Or
+{0x6507, 0x2513, 0x2255}, // ≕, \eqcolon, Equals Colon / Equal Colon
+{0x6c0e, 0x307b, 0x2194}, // ↔, \leftrightarrow, Left Right Arrow
+{0x620b, 0x1773, 0x2B2C}, // ⬬, \blkhorzoval, Black Horizontal Ellipse
+{0x4206, 0x0079, 0x224E}, // ≎, \Bumpeq, Geometrically Equivalent To
+{0x6d06, 0x355e, 0x225E}, // ≞, \measeq, Measured By
+{0x6204, 0x0a18, 0x03B2}, // β, \beta, Greek Small Letter Beta
+{0x7515, 0x4cd6, 0x20EC}, // ⃬, \underrightharpoondown, Combining Rightwards Harpoon With Barb Downwards
+{0x7306, 0x4768, 0x2AD3}, // ⫓, \subsup, Subset Above Superset
+{0x5e02, 0x0590, 0xA71D}, // ꜝ, \^!, Modifier Letter Raised Exclamation Mark
+{0x7307, 0x42ba, 0x264F}, // ♏, \scorpio, Scorpius
+{0x730b, 0x477f, 0x227D}, // ≽, \succcurlyeq, Succeeds Or Equal To
+{0x5e02, 0x0629, 0x1D49}, // ᵉ, \^e, Modifier Letter Small E
+{0x5e02, 0x05c9, 0x1D31}, // ᴱ, \^E, Modifier Letter Capital E
+{0x6e16, 0x39f3, 0x2B3C}, // ⬼, \nvtwoheadleftarrowtail, Leftwards Two-Headed Arrow With Tail With Vertical Stroke
+{0x6906, 0x2b81, 0xDE2C'D835}, // U+1D62C, 𝘬, \isansk, Mathematical Sans-Serif Italic Small K
+{0x6209, 0x1042, 0x2A02}, // ⨂, \bigotimes, N-Ary Circled Times Operator
+{0x520e, 0x0476, 0x2953}, // ⥓, \RightVectorBar, Rightwards Harpoon With Barb Up To Bar
+{0x6205, 0x0fac, 0xDF4C'D835}, // U+1D74C, 𝝌, \bichi, Mathematical Bold Italic Small Chi
+{0x5e06, 0x0617, 0x1D5F}, // ᵟ, \^delta, Modifier Letter Small Delta
+{0x7305, 0x41f1, 0xDDC2'D835}, // U+1D5C2, 𝗂, \sansi, Mathematical Sans-Serif Small I
+{0x6405, 0x2441, 0x02A4}, // ʤ, \dyogh, Latin Small Letter Dezh Digraph / Latin Small Letter D Yogh
+{0x6203, 0x0edd, 0xDC71'D835}, // U+1D471, 𝑱, \biJ, Mathematical Bold Italic Capital J
+{0x6605, 0x277f, 0xDD32'D835}, // U+1D532, 𝔲, \fraku, Mathematical Fraktur Small U
+{0x6903, 0x2c15, 0xDC34'D835}, // U+1D434, 𝐴, \itA, Mathematical Italic Capital A
+{0x7409, 0x48a6, 0x2009}, //  , \thinspace, Thin Space
+{0x6702, 0x27bd, 0x2265}, // ≥, \ge, Greater-Than Or Equal To / Greater Than Or Equal To
+{0x4c0c, 0x0294, 0x27FD}, // ⟽, \Longmapsfrom, Long Leftwards Double Arrow From Bar
+{0x7403, 0x4a45, 0xDE75'D835}, // U+1D675, 𝙵, \ttF, Mathematical Monospace Capital F
+{0x7603, 0x4fea, 0x20D7}, // ⃗, \vec, Combining Right Arrow Above / Non-Spacing Right Arrow Above
+{0x4c0a, 0x02a1, 0x27FE}, // ⟾, \Longmapsto, Long Rightwards Double Arrow From Bar
+{0x6203, 0x1102, 0xDC8E'D835}, // U+1D48E, 𝒎, \bim, Mathematical Bold Italic Small M
+{0x6709, 0x27d0, 0x2AFA}, // ⫺, \geqqslant, Double-Line Slanted Greater-Than Or Equal To
+{0x6203, 0x08f6, 0x211A}, // ℚ, \bbQ, Double-Struck Capital Q / Double-Struck Q
+{0x6c02, 0x2f11, 0x2264}, // ≤, \le, Less-Than Or Equal To / Less Than Or Equal To
+{0x7304, 0x4384, 0xDCC1'D835}, // U+1D4C1, 𝓁, \scrl, Mathematical Script Small L
+{0x6203, 0x10da, 0xDC8A'D835}, // U+1D48A, 𝒊, \bii, Mathematical Bold Italic Small I
+{0x7205, 0x3dc1, 0x2309}, // ⌉, \rceil, Right Ceiling
+{0x6704, 0x285a, 0x2AA7}, // ⪧, \gtcc, Greater-Than Closed By Curve
+{0x6605, 0x27a3, 0x2322}, // ⌢, \frown, Frown
+{0x6203, 0x08d5, 0xDD41'D835}, // U+1D541, 𝕁, \bbJ, Mathematical Double-Struck Capital J
+{0x4801, 0x018b, 0x030B}, // ̋, \H, Combining Double Acute Accent / Non-Spacing Double Acute
+{0x650c, 0x2565, 0x2A9B}, // ⪛, \eqqslantless, Double-Line Slanted Equal To Or Less-Than
+{0x6413, 0x2236, 0x291F}, // ⤟, \diamondleftarrowbar, Leftwards Arrow From Bar To Black Diamond
+{0x5e02, 0x05db, 0x1D38}, // ᴸ, \^L, Modifier Letter Capital L
+{0x6309, 0x1eb0, 0x2713}, // ✓, \checkmark, Check Mark
+{0x6205, 0x15b4, 0xDF49'D835}, // U+1D749, 𝝉, \bitau, Mathematical Bold Italic Small Tau
+{0x7305, 0x46f3, 0x23E4}, // ⏤, \strns, Straightness
+{0x6203, 0x0be5, 0xDC26'D835}, // U+1D426, 𝐦, \bfm, Mathematical Bold Small M
+{0x6205, 0x1d5a, 0xDCE9'D835}, // U+1D4E9, 𝓩, \bscrZ, Mathematical Bold Script Capital Z
+{0x6204, 0x0f07, 0xDF28'D835}, // U+1D728, 𝜨, \biNu, Mathematical Bold Italic Capital Nu
+{0x5f02, 0x06e2, 0x1D62}, // ᵢ, \_i, Latin Subscript Small Letter I
+{0x6203, 0x0e5e, 0xDC31'D835}, // U+1D431, 𝐱, \bfx, Mathematical Bold Small X
+{0x730d, 0x4687, 0x25E9}, // ◩, \squareulblack, Square With Upper Left Diagonal Half Black
+{0x6203, 0x0e94, 0xDC6A'D835}, // U+1D46A, 𝑪, \biC, Mathematical Bold Italic Capital C
+{0x6409, 0x241c, 0x2910}, // ⤐, \drbkarrow, Rightwards Two-Headed Triple Dash Arrow
+{0x6308, 0x1ef4, 0x24C8}, // Ⓢ, \circledS, Circled Latin Capital Letter S
+{0x6205, 0x1d84, 0xDCF0'D835}, // U+1D4F0, 𝓰, \bscrg, Mathematical Bold Script Small G
+{0x720d, 0x3ea9, 0x2B43}, // ⭃, \rightarrowgtr, Rightwards Arrow Through Greater-Than
+{0x6205, 0x1d6c, 0xDCEC'D835}, // U+1D4EC, 𝓬, \bscrc, Mathematical Bold Script Small C
+{0x6204, 0x096f, 0x2148}, // ⅈ, \bbii, Double-Struck Italic Small I
+{0x7516, 0x4d5a, 0x294C}, // ⥌, \updownharpoonrightleft, Up Barb Right Down Barb Left Harpoon
+{0x6605, 0x26fb, 0xDD1C'D835}, // U+1D51C, 𝔜, \frakY, Mathematical Fraktur Capital Y
+{0x6c04, 0x32ae, 0x2A87}, // ⪇, \lneq, Less-Than And Single-Line Not Equal To
+{0x7605, 0x4fe4, 0x22EE}, // ⋮, \vdots, Vertical Ellipsis
+{0x7403, 0x4b3c, 0xDEA3'D835}, // U+1D6A3, 𝚣, \ttz, Mathematical Monospace Small Z
+{0x6705, 0x284e, 0x2A8E}, // ⪎, \gsime, Greater-Than Above Similar Or Equal
+{0x7403, 0x4aa1, 0xDE8C'D835}, // U+1D68C, 𝚌, \ttc, Mathematical Monospace Small C
+{0x6205, 0x1d1e, 0xDCDF'D835}, // U+1D4DF, 𝓟, \bscrP, Mathematical Bold Script Capital P
+{0x6c03, 0x318f, 0x264C}, // ♌, \leo, Leo
+{0x730a, 0x44c7, 0x2A33}, // ⨳, \smashtimes, Smash Product
+{0x6503, 0x25cb, 0x00F0}, // ð, \eth, Latin Small Letter Eth
+{0x6907, 0x2d82, 0xDEA4'D835}, // U+1D6A4, 𝚤, \itimath, Mathematical Italic Small Dotless I
+{0x6208, 0x1068, 0x2A05}, // ⨅, \bigsqcap, N-Ary Square Intersection Operator
+{0x6906, 0x2bd5, 0xDE38'D835}, // U+1D638, 𝘸, \isansw, Mathematical Sans-Serif Italic Small W
+{0x6809, 0x28cd, 0x2A6F}, // ⩯, \hatapprox, Almost Equal To With Circumflex Accent
+{0x6406, 0x228f, 0x2681}, // ⚁, \diceii, Die Face-2
+{0x4102, 0x0054, 0x00C6}, // Æ, \AE, Latin Capital Letter Ae / Latin Capital Letter A E
+{0x4f01, 0x0397, 0x00D8}, // Ø, \O, Latin Capital Letter O With Stroke / Latin Capital Letter O Slash
+{0x6203, 0x0a94, 0xDC09'D835}, // U+1D409, 𝐉, \bfJ, Mathematical Bold Capital J
+{0x6903, 0x2ca4, 0xDC42'D835}, // U+1D442, 𝑂, \itO, Mathematical Italic Capital O
+{0x7204, 0x40ad, 0x026D}, // ɭ, \rtll, Latin Small Letter L With Retroflex Hook / Latin Small Letter L Retroflex Hook
+{0x6c02, 0x3365, 0x2018}, // ‘, \lq, Left Single Quotation Mark / Single Turned Comma Quotation Mark
+{0x6906, 0x2aa1, 0xDE0C'D835}, // U+1D60C, 𝘌, \isansE, Mathematical Sans-Serif Italic Capital E
+{0x640d, 0x2391, 0x21E3}, // ⇣, \downdasharrow, Downwards Dashed Arrow / Down Dashed Arrow
+{0x5003, 0x03c7, 0x03A8}, // Ψ, \Psi, Greek Capital Letter Psi
+{0x6906, 0x2ae0, 0xDE15'D835}, // U+1D615, 𝘕, \isansN, Mathematical Sans-Serif Italic Capital N
+{0x6206, 0x1acd, 0xDDF5'D835}, // U+1D5F5, 𝗵, \bsansh, Mathematical Sans-Serif Bold Small H
+{0x7308, 0x45d3, 0x2290}, // ⊐, \sqsupset, Square Original Of
+{0x7007, 0x3c90, 0x2A23}, // ⨣, \plushat, Plus Sign With Circumflex Accent Above
+{0x6c07, 0x31fc, 0x2276}, // ≶, \lessgtr, Less-Than Or Greater-Than / Less Than Or Greater Than
+{0x620d, 0x146c, 0xDFC3'D835}, // U+1D7C3, 𝟃, \bisanspartial, Mathematical Sans-Serif Bold Italic Partial Differential
+{0x5e02, 0x05cf, 0x1D34}, // ᴴ, \^H, Modifier Letter Capital H
+{0x6804, 0x28d7, 0x0127}, // ħ, \hbar, Latin Small Letter H With Stroke / Latin Small Letter H Bar
+{0x6206, 0x1abb, 0xDDF4'D835}, // U+1D5F4, 𝗴, \bsansg, Mathematical Sans-Serif Bold Small G
+{0x6203, 0x08fe, 0xDD4A'D835}, // U+1D54A, 𝕊, \bbS, Mathematical Double-Struck Capital S
+{0x6109, 0x0793, 0x2A70}, // ⩰, \approxeqq, Approximately Equal Or Equal To
+{0x6207, 0x1163, 0xDE3C'D835}, // U+1D63C, 𝘼, \bisansA, Mathematical Sans-Serif Bold Italic Capital A
+{0x6d0c, 0x343d, 0x2B27}, // ⬧, \mdblklozenge, Black Medium Lozenge
+{0x6205, 0x0af6, 0xDEB8'D835}, // U+1D6B8, 𝚸, \bfRho, Mathematical Bold Capital Rho
+{0x7308, 0x4215, 0xDFEB'D835}, // U+1D7EB, 𝟫, \sansnine, Mathematical Sans-Serif Digit Nine
+{0x4f06, 0x03a5, 0x2A37}, // ⨷, \Otimes, Multiplication Sign In Double Circle
+{0x6904, 0x2a4b, 0x028D}, // ʍ, \invw, Latin Small Letter Turned W
+{0x6903, 0x2d09, 0xDC49'D835}, // U+1D449, 𝑉, \itV, Mathematical Italic Capital V
+{0x6906, 0x2b9d, 0xDE30'D835}, // U+1D630, 𝘰, \isanso, Mathematical Sans-Serif Italic Small O
+{0x650e, 0x24c1, 0x20DF}, // ⃟, \enclosediamond, Combining Enclosing Diamond / Enclosing Diamond
+{0x6206, 0x0c9d, 0xDD78'D835}, // U+1D578, 𝕸, \bfrakM, Mathematical Bold Fraktur Capital M
+{0x4f02, 0x03a2, 0x2A54}, // ⩔, \Or, Double Logical Or
+{0x6903, 0x2c75, 0xDC3D'D835}, // U+1D43D, 𝐽, \itJ, Mathematical Italic Capital J
+{0x6204, 0x0c36, 0xDED1'D835}, // U+1D6D1, 𝛑, \bfpi, Mathematical Bold Small Pi
+{0x6206, 0x191c, 0xDDDD'D835}, // U+1D5DD, 𝗝, \bsansJ, Mathematical Sans-Serif Bold Capital J
+{0x6203, 0x0b7f, 0xDC1E'D835}, // U+1D41E, 𝐞, \bfe, Mathematical Bold Small E
+{0x680c, 0x290d, 0x2B23}, // ⬣, \hexagonblack, Horizontal Black Hexagon
+{0x620a, 0x192a, 0xDF5F'D835}, // U+1D75F, 𝝟, \bsansKappa, Mathematical Sans-Serif Bold Capital Kappa
+{0x7403, 0x4adf, 0xDE96'D835}, // U+1D696, 𝚖, \ttm, Mathematical Monospace Small M
+{0x6d0c, 0x34c5, 0x2B28}, // ⬨, \mdwhtlozenge, White Medium Lozenge
+{0x620c, 0x122b, 0xDF9A'D835}, // U+1D79A, 𝞚, \bisansLambda, Mathematical Sans-Serif Bold Italic Capital Lamda
+{0x6207, 0x130b, 0xDE52'D835}, // U+1D652, 𝙒, \bisansW, Mathematical Sans-Serif Bold Italic Capital W
+{0x7305, 0x4411, 0x2AA0}, // ⪠, \simgE, Similar Above Greater-Than Above Equals Sign
+{0x6206, 0x1b9a, 0xDDFE'D835}, // U+1D5FE, 𝗾, \bsansq, Mathematical Sans-Serif Bold Small Q
+{0x6207, 0x09db, 0xDFDB'D835}, // U+1D7DB, 𝟛, \bbthree, Mathematical Double-Struck Digit Three
+{0x6c0c, 0x32f3, 0x27FB}, // ⟻, \longmapsfrom, Long Leftwards Arrow From Bar
+{0x6e06, 0x377b, 0x26B2}, // ⚲, \neuter, Neuter
+{0x7308, 0x45b3, 0x228F}, // ⊏, \sqsubset, Square Image Of
+{0x6e08, 0x37ec, 0x2274}, // ≴, \nlesssim, Neither Less-Than Nor Equivalent To / Neither Less Than Nor Equivalent To
+{0x6c07, 0x33ab, 0x2ACD}, // ⫍, \lsqhook, Square Left Open Box Operator
+{0x7208, 0x407b, 0x2A12}, // ⨒, \rppolint, Line Integration With Rectangular Path Around Pole
+{0x6706, 0x2877, 0x22D7}, // ⋗, \gtrdot, Greater-Than With Dot / Greater Than With Dot
+{0x6e06, 0x3956, 0x2116}, // №, \numero, Numero Sign / Numero
+{0x6109, 0x0771, 0x29A4}, // ⦤, \angleubar, Angle With Underbar
+{0x6703, 0x2825, 0x2AA4}, // ⪤, \glj, Greater-Than Overlapping Less-Than
+{0x6203, 0x09ed, 0xDD67'D835}, // U+1D567, 𝕧, \bbv, Mathematical Double-Struck Small V
+{0x7403, 0x4a79, 0xDE82'D835}, // U+1D682, 𝚂, \ttS, Mathematical Monospace Capital S
+{0x7304, 0x43ac, 0xDCC9'D835}, // U+1D4C9, 𝓉, \scrt, Mathematical Script Small T
+{0x6e03, 0x37b3, 0x22FC}, // ⋼, \nis, Small Contains With Vertical Bar At End Of Horizontal Stroke
+{0x730e, 0x465a, 0x25A8}, // ▨, \squareneswfill, Square With Upper Right To Lower Left Fill
+{0x7003, 0x3c61, 0x03D5}, // ϕ, \phi, Greek Phi Symbol / Greek Small Letter Script Phi
+{0x6c0d, 0x306d, 0x27D5}, // ⟕, \leftouterjoin, Left Outer Join
+{0x6309, 0x20ce, 0x00A9}, // ©, \copyright, Copyright Sign
+{0x6407, 0x220d, 0x22C4}, // ⋄, \diamond, Diamond Operator
+{0x6c02, 0x3256, 0x226A}, // ≪, \ll, Much Less-Than / Much Less Than
+{0x620b, 0x1262, 0xDFA8'D835}, // U+1D7A8, 𝞨, \bisansOmega, Mathematical Sans-Serif Bold Italic Capital Omega
+{0x7007, 0x3d20, 0x2AB1}, // ⪱, \precneq, Precedes Above Single-Line Not Equal To
+{0x7307, 0x47c0, 0x227F}, // ≿, \succsim, Succeeds Or Equivalent To
+{0x6905, 0x2d44, 0xDF12'D835}, // U+1D712, 𝜒, \itchi, Mathematical Italic Small Chi
+{0x6406, 0x2426, 0x031A}, // ̚, \droang, Combining Left Angle Above / Non-Spacing Left Angle Above
+{0x620a, 0x1be7, 0xDF77'D835}, // U+1D777, 𝝷, \bsanstheta, Mathematical Sans-Serif Bold Small Theta
+{0x6605, 0x264b, 0x2ADC}, // ⫝̸, \forks, Forking
+{0x6a04, 0x2eb8, 0x2A1D}, // ⨝, \join, Join
+{0x6206, 0x0ed6, 0xDF24'D835}, // U+1D724, 𝜤, \biIota, Mathematical Bold Italic Capital Iota
+{0x6906, 0x2b11, 0xDE1C'D835}, // U+1D61C, 𝘜, \isansU, Mathematical Sans-Serif Italic Capital U
+{0x5e02, 0x067f, 0x1D58}, // ᵘ, \^u, Modifier Letter Small U
+{0x3104, 0x0008, 0x2152}, // ⅒, \1/10, Vulgar Fraction One Tenth
+{0x6905, 0x29d5, 0x221E}, // ∞, \infty, Infinity
+{0x6208, 0x199d, 0xDF6D'D835}, // U+1D76D, 𝝭, \bsansPsi, Mathematical Sans-Serif Bold Capital Psi
+{0x6207, 0x1366, 0xDE58'D835}, // U+1D658, 𝙘, \bisansc, Mathematical Sans-Serif Bold Italic Small C
+{0x4c0f, 0x01e2, 0x294E}, // ⥎, \LeftRightVector, Left Barb Up Right Barb Up Harpoon
+{0x7305, 0x4181, 0xDDB4'D835}, // U+1D5B4, 𝖴, \sansU, Mathematical Sans-Serif Capital U
+{0x730b, 0x45c7, 0x22E4}, // ⋤, \sqsubsetneq, Square Image Of Or Not Equal To
+{0x6f06, 0x3b38, 0x2298}, // ⊘, \oslash, Circled Division Slash
+{0x760f, 0x4ed6, 0x2B22}, // ⬢, \varhexagonblack, Black Hexagon
+{0x7804, 0x519d, 0x211E}, // ℞, \xrat, Prescription Take
+{0x680d, 0x28e6, 0x26A5}, // ⚥, \hermaphrodite, Male And Female Sign
+{0x6208, 0x1bce, 0xDFF2'D835}, // U+1D7F2, 𝟲, \bsanssix, Mathematical Sans-Serif Bold Digit Six
+{0x5e02, 0x0603, 0x1D47}, // ᵇ, \^b, Modifier Letter Small B
+{0x6907, 0x2c5e, 0xDEE4'D835}, // U+1D6E4, 𝛤, \itGamma, Mathematical Italic Capital Gamma
+{0x7303, 0x47d3, 0x263C}, // ☼, \sun, White Sun With Rays
+{0x6203, 0x09e9, 0xDD66'D835}, // U+1D566, 𝕦, \bbu, Mathematical Double-Struck Small U
+{0x7308, 0x42c2, 0x2A13}, // ⨓, \scpolint, Line Integration With Semicircular Path Around Pole
+{0x6205, 0x0fcc, 0xDF3C'D835}, // U+1D73C, 𝜼, \bieta, Mathematical Bold Italic Small Eta
+{0x6f0e, 0x3a5f, 0x0315}, // ̕, \ocommatopright, Combining Comma Above Right / Non-Spacing Comma Above Right
+{0x6205, 0x1cdc, 0xDCD4'D835}, // U+1D4D4, 𝓔, \bscrE, Mathematical Bold Script Capital E
+{0x6306, 0x1ec3, 0x2257}, // ≗, \circeq, Ring Equal To
+{0x6205, 0x1d12, 0xDCDD'D835}, // U+1D4DD, 𝓝, \bscrN, Mathematical Bold Script Capital N
+{0x6909, 0x2c46, 0xDEE6'D835}, // U+1D6E6, 𝛦, \itEpsilon, Mathematical Italic Capital Epsilon
+{0x3103, 0x001d, 0x2159}, // ⅙, \1/6, Vulgar Fraction One Sixth / Fraction One Sixth
+{0x6906, 0x2d22, 0xDEE7'D835}, // U+1D6E7, 𝛧, \itZeta, Mathematical Italic Capital Zeta
+{0x7210, 0x4017, 0x21F6}, // ⇶, \rightthreearrows, Three Rightwards Arrows
+{0x7305, 0x419f, 0xDDB9'D835}, // U+1D5B9, 𝖹, \sansZ, Mathematical Sans-Serif Capital Z
+{0x730a, 0x45bc, 0x2291}, // ⊑, \sqsubseteq, Square Image Of Or Equal To
+{0x620a, 0x135b, 0xDFAB'D835}, // U+1D7AB, 𝞫, \bisansbeta, Mathematical Sans-Serif Bold Italic Small Beta
+{0x6807, 0x2905, 0x2394}, // ⎔, \hexagon, Software-Function Symbol
+{0x6c10, 0x2f62, 0x2B32}, // ⬲, \leftarrowonoplus, Left Arrow With Circled Plus
+{0x6208, 0x1b63, 0xDFED'D835}, // U+1D7ED, 𝟭, \bsansone, Mathematical Sans-Serif Bold Digit One
+{0x7404, 0x4a0a, 0x026F}, // ɯ, \trnm, Latin Small Letter Turned M
+{0x6c03, 0x2eef, 0x2AAB}, // ⪫, \lat, Larger Than
+{0x6903, 0x2dd0, 0xDC5C'D835}, // U+1D45C, 𝑜, \ito, Mathematical Italic Small O
+{0x4c03, 0x01b5, 0x29CA}, // ⧊, \Lap, Triangle With Dot Above
+{0x7803, 0x5199, 0x22BB}, // ⊻, \xor, Xor
+{0x6d0f, 0x34ee, 0x29AE}, // ⦮, \measangledrtose, Measured Angle With Open Arm Ending In Arrow Pointing Right And Down
+{0x6203, 0x0fd6, 0xDC88'D835}, // U+1D488, 𝒈, \big, Mathematical Bold Italic Small G
+{0x6206, 0x0bc1, 0xDECA'D835}, // U+1D6CA, 𝛊, \bfiota, Mathematical Bold Small Iota
+{0x7305, 0x4274, 0xDDCF'D835}, // U+1D5CF, 𝗏, \sansv, Mathematical Sans-Serif Small V
+{0x7307, 0x486a, 0x2199}, // ↙, \swarrow, South West Arrow / Lower Left Arrow
+{0x620b, 0x1217, 0xDF99'D835}, // U+1D799, 𝞙, \bisansKappa, Mathematical Sans-Serif Bold Italic Capital Kappa
+{0x4103, 0x005d, 0x2A53}, // ⩓, \And, Double Logical And
+{0x3303, 0x003d, 0x215C}, // ⅜, \3/8, Vulgar Fraction Three Eighths / Fraction Three Eighths
+{0x6d0f, 0x351e, 0x29AA}, // ⦪, \measanglerdtose, Measured Angle With Open Arm Ending In Arrow Pointing Down And Right
+{0x6605, 0x2683, 0xDD08'D835}, // U+1D508, 𝔈, \frakE, Mathematical Fraktur Capital E
+{0x6205, 0x1cc4, 0xDCD0'D835}, // U+1D4D0, 𝓐, \bscrA, Mathematical Bold Script Capital A
+{0x7305, 0x41b7, 0xDDBD'D835}, // U+1D5BD, 𝖽, \sansd, Mathematical Sans-Serif Small D
+{0x7507, 0x4de5, 0x03E1}, // ϡ, \upsampi, Greek Small Letter Sampi
+{0x6206, 0x1957, 0xDDE1'D835}, // U+1D5E1, 𝗡, \bsansN, Mathematical Sans-Serif Bold Capital N
+{0x6c0e, 0x3144, 0x21DC}, // ⇜, \leftsquigarrow, Leftwards Squiggle Arrow / Left Squiggle Arrow
+{0x6c16, 0x30af, 0x21FF}, // ⇿, \leftrightarrowtriangle, Left Right Open-Headed Arrow
+{0x6204, 0x096a, 0x2147}, // ⅇ, \bbie, Double-Struck Italic Small E
+{0x6d0f, 0x353e, 0x29AD}, // ⦭, \measangleultonw, Measured Angle With Open Arm Ending In Arrow Pointing Left And Up
+{0x6206, 0x0d4c, 0xDD91'D835}, // U+1D591, 𝖑, \bfrakl, Mathematical Bold Fraktur Small L
+{0x6705, 0x283c, 0x2269}, // ≩, \gneqq, Greater-Than But Not Equal To / Greater Than But Not Equal To
+{0x7305, 0x426e, 0xDDCE'D835}, // U+1D5CE, 𝗎, \sansu, Mathematical Sans-Serif Small U
+{0x6304, 0x1e99, 0x22C5}, // ⋅, \cdot, Dot Operator
+{0x5f02, 0x06a9, 0x2081}, // ₁, \_1, Subscript One / Subscript Digit One
+{0x620a, 0x1af3, 0xDF79'D835}, // U+1D779, 𝝹, \bsanskappa, Mathematical Sans-Serif Bold Small Kappa
+{0x5e02, 0x0614, 0x1D48}, // ᵈ, \^d, Modifier Letter Small D
+{0x620b, 0x1b05, 0xDF7A'D835}, // U+1D77A, 𝝺, \bsanslambda, Mathematical Sans-Serif Bold Small Lamda
+{0x5f04, 0x06d0, 0x1D6A}, // ᵪ, \_chi, Greek Subscript Small Letter Chi
+{0x6905, 0x2cc9, 0xDEF9'D835}, // U+1D6F9, 𝛹, \itPsi, Mathematical Italic Capital Psi
+{0x6403, 0x22d7, 0x00F7}, // ÷, \div, Division Sign
+{0x6211, 0x16e3, 0x25BA}, // ►, \blackpointerright, Black Right-Pointing Pointer / Black Right Pointing Pointer
+{0x6207, 0x132c, 0xDE55'D835}, // U+1D655, 𝙕, \bisansZ, Mathematical Sans-Serif Bold Italic Capital Z
+{0x6108, 0x0748, 0x224C}, // ≌, \allequal, All Equal To
+{0x7305, 0x4401, 0x03C3}, // σ, \sigma, Greek Small Letter Sigma
+{0x6206, 0x1bb1, 0xDE00'D835}, // U+1D600, 𝘀, \bsanss, Mathematical Sans-Serif Bold Small S
+{0x5e02, 0x05f3, 0x2C7D}, // ⱽ, \^V, Modifier Letter Capital V
+{0x6209, 0x15c6, 0xDF4A'D835}, // U+1D74A, 𝝊, \biupsilon, Mathematical Bold Italic Small Upsilon
+{0x6209, 0x1192, 0xDFA6'D835}, // U+1D7A6, 𝞦, \bisansChi, Mathematical Sans-Serif Bold Italic Capital Chi
+{0x6e09, 0x37dc, 0x0338'2A7D}, // ⩽̸, \nleqslant, Less-Than Or Slanted Equal To + Combining Long Solidus Overlay / Non-Spacing Long Slash Overlay
+{0x6203, 0x0bad, 0xDC20'D835}, // U+1D420, 𝐠, \bfg, Mathematical Bold Small G
+{0x6207, 0x1324, 0xDE54'D835}, // U+1D654, 𝙔, \bisansY, Mathematical Sans-Serif Bold Italic Capital Y
+{0x6f01, 0x3a4a, 0x00F8}, // ø, \o, Latin Small Letter O With Stroke / Latin Small Letter O Slash
+{0x6c03, 0x2f0d, 0x201C}, // “, \ldq, Left Double Quotation Mark / Double Turned Comma Quotation Mark
+{0x6203, 0x1132, 0xDC91'D835}, // U+1D491, 𝒑, \bip, Mathematical Bold Italic Small P
+{0x620c, 0x16c5, 0x29EB}, // ⧫, \blacklozenge, Black Lozenge
+{0x620b, 0x13bc, 0xDFAC'D835}, // U+1D7AC, 𝞬, \bisansgamma, Mathematical Sans-Serif Bold Italic Small Gamma
+{0x6206, 0x0fa1, 0xDF37'D835}, // U+1D737, 𝜷, \bibeta, Mathematical Bold Italic Small Beta
+{0x740c, 0x494d, 0x25BF}, // ▿, \triangledown, White Down-Pointing Small Triangle / White Down Pointing Small Triangle
+{0x5f02, 0x071a, 0x2093}, // ₓ, \_x, Latin Subscript Small Letter X
+{0x6905, 0x2cd7, 0xDEF2'D835}, // U+1D6F2, 𝛲, \itRho, Mathematical Italic Capital Rho
+{0x6203, 0x10e9, 0xDC8C'D835}, // U+1D48C, 𝒌, \bik, Mathematical Bold Italic Small K
+{0x6203, 0x0b08, 0xDC13'D835}, // U+1D413, 𝐓, \bfT, Mathematical Bold Capital T
+{0x7306, 0x485e, 0x2AD6}, // ⫖, \supsup, Superset Above Superset
+{0x630b, 0x1f22, 0x229D}, // ⊝, \circleddash, Circled Dash
+{0x6305, 0x201c, 0x25D0}, // ◐, \cirfl, Circle With Left Half Black
+{0x4303, 0x0084, 0x03A7}, // Χ, \Chi, Greek Capital Letter Chi
+{0x6207, 0x11d0, 0xDE41'D835}, // U+1D641, 𝙁, \bisansF, Mathematical Sans-Serif Bold Italic Capital F
+{0x6c06, 0x2ee8, 0x27E8}, // ⟨, \langle, Mathematical Left Angle Bracket
+{0x6203, 0x0b48, 0xDC1A'D835}, // U+1D41A, 𝐚, \bfa, Mathematical Bold Small A
+{0x6e08, 0x3879, 0x0338'227E}, // ≾̸, \nprecsim, Precedes Or Equivalent To + Combining Long Solidus Overlay / Non-Spacing Long Slash Overlay
+{0x6906, 0x2b1f, 0xDE1E'D835}, // U+1D61E, 𝘞, \isansW, Mathematical Sans-Serif Italic Capital W
+{0x6405, 0x21bb, 0x20DB}, // ⃛, \dddot, Combining Three Dots Above / Non-Spacing Three Dots Above
+{0x6206, 0x1985, 0xDDE3'D835}, // U+1D5E3, 𝗣, \bsansP, Mathematical Sans-Serif Bold Capital P
+{0x6c11, 0x30dd, 0x21CB}, // ⇋, \leftrightharpoons, Leftwards Harpoon Over Rightwards Harpoon / Left Harpoon Over Right Harpoon
+{0x6207, 0x13eb, 0xDE60'D835}, // U+1D660, 𝙠, \bisansk, Mathematical Sans-Serif Bold Italic Small K
+{0x7308, 0x47ae, 0x2AB6}, // ⪶, \succneqq, Succeeds Above Not Equal To
+{0x6905, 0x2bf1, 0x22F9}, // ⋹, \isinE, Element Of With Two Horizontal Strokes
+{0x6906, 0x2ad2, 0xDE13'D835}, // U+1D613, 𝘓, \isansL, Mathematical Sans-Serif Italic Capital L
+{0x6408, 0x21f4, 0x2572}, // ╲, \diagdown, Box Drawings Light Diagonal Upper Left To Lower Right / Forms Light Diagonal Upper Left To Lower Right
+{0x4f02, 0x0399, 0x0152}, // Œ, \OE, Latin Capital Ligature Oe / Latin Capital Letter O E
+{0x620d, 0x1c70, 0xDF81'D835}, // U+1D781, 𝞁, \bsansvarsigma, Mathematical Sans-Serif Bold Small Final Sigma
+{0x6203, 0x0bee, 0xDC27'D835}, // U+1D427, 𝐧, \bfn, Mathematical Bold Small N
+{0x7305, 0x4193, 0xDDB7'D835}, // U+1D5B7, 𝖷, \sansX, Mathematical Sans-Serif Capital X
+{0x6d0b, 0x35b9, 0x2A5C}, // ⩜, \midbarwedge, Logical And With Horizontal Dash
+{0x6205, 0x1cf4, 0xDCD8'D835}, // U+1D4D8, 𝓘, \bscrI, Mathematical Bold Script Capital I
+{0x740a, 0x49f5, 0x29FB}, // ⧻, \tripleplus, Triple Plus
+{0x7409, 0x49a3, 0x225C}, // ≜, \triangleq, Delta Equal To
+{0x6908, 0x2c89, 0xDEEC'D835}, // U+1D6EC, 𝛬, \itLambda, Mathematical Italic Capital Lamda
+{0x6903, 0x2e1f, 0xDC61'D835}, // U+1D461, 𝑡, \itt, Mathematical Italic Small T
+{0x6905, 0x2ced, 0xDEF5'D835}, // U+1D6F5, 𝛵, \itTau, Mathematical Italic Capital Tau
+{0x6207, 0x1b3c, 0xDF7C'D835}, // U+1D77C, 𝝼, \bsansnu, Mathematical Sans-Serif Bold Small Nu
+{0x3102, 0x0005, 0x215F}, // ⅟, \1/, Fraction Numerator One
+{0x6406, 0x229e, 0x2683}, // ⚃, \diceiv, Die Face-4
+{0x6105, 0x0742, 0x2135}, // ℵ, \aleph, Alef Symbol / First Transfinite Cardinal
+{0x6207, 0x0de7, 0xDFD1'D835}, // U+1D7D1, 𝟑, \bfthree, Mathematical Bold Digit Three
+{0x6409, 0x23e5, 0x2AEA}, // ⫪, \downvDash, Double Down Tack
+{0x6407, 0x2195, 0x290F}, // ⤏, \dbkarow, Rightwards Triple Dash Arrow
+{0x6903, 0x2e31, 0xDC62'D835}, // U+1D462, 𝑢, \itu, Mathematical Italic Small U
+{0x6707, 0x280f, 0x2AF8}, // ⫸, \gggnest, Triple Nested Greater-Than
+{0x6c0e, 0x3180, 0x21E6}, // ⇦, \leftwhitearrow, Leftwards White Arrow / White Left Arrow
+{0x4604, 0x017b, 0x2132}, // Ⅎ, \Finv, Turned Capital F / Turned F
+{0x6205, 0x0c30, 0xDEDF'D835}, // U+1D6DF, 𝛟, \bfphi, Mathematical Bold Phi Symbol
+{0x6903, 0x2cdd, 0xDC46'D835}, // U+1D446, 𝑆, \itS, Mathematical Italic Capital S
+{0x6206, 0x0a01, 0xDFD8'D835}, // U+1D7D8, 𝟘, \bbzero, Mathematical Double-Struck Digit Zero
+{0x7208, 0x3dfe, 0x29A3}, // ⦣, \revangle, Reversed Angle
+{0x3103, 0x0029, 0x2151}, // ⅑, \1/9, Vulgar Fraction One Ninth
+{0x6205, 0x1de4, 0xDD00'D835}, // U+1D500, 𝔀, \bscrw, Mathematical Bold Script Small W
+{0x620d, 0x126e, 0xDF9E'D835}, // U+1D79E, 𝞞, \bisansOmicron, Mathematical Sans-Serif Bold Italic Capital Omicron
+{0x7304, 0x438e, 0xDCC3'D835}, // U+1D4C3, 𝓃, \scrn, Mathematical Script Small N
+{0x6105, 0x0751, 0x03B1}, // α, \alpha, Greek Small Letter Alpha
+{0x6206, 0x0d30, 0xDD8D'D835}, // U+1D58D, 𝖍, \bfrakh, Mathematical Bold Fraktur Small H
+{0x7305, 0x4157, 0xDDAD'D835}, // U+1D5AD, 𝖭, \sansN, Mathematical Sans-Serif Capital N
+{0x6904, 0x299f, 0x222C}, // ∬, \iint, Double Integral
+{0x6e07, 0x373d, 0x2197}, // ↗, \nearrow, North East Arrow / Upper Right Arrow
+{0x5f02, 0x06b2, 0x2084}, // ₄, \_4, Subscript Four / Subscript Digit Four
+{0x6203, 0x1155, 0xDC93'D835}, // U+1D493, 𝒓, \bir, Mathematical Bold Italic Small R
+{0x6209, 0x1cb0, 0xDFEC'D835}, // U+1D7EC, 𝟬, \bsanszero, Mathematical Sans-Serif Bold Digit Zero
+{0x4105, 0x0057, 0x0391}, // Α, \Alpha, Greek Capital Letter Alpha
+{0x660d, 0x27a9, 0x27D7}, // ⟗, \fullouterjoin, Full Outer Join
+{0x7608, 0x4e5f, 0x03F4}, // ϴ, \varTheta, Greek Capital Theta Symbol
+{0x6905, 0x29a4, 0x22B7}, // ⊷, \image, Image Of
+{0x6406, 0x242d, 0x2506}, // ┆, \dshfnc, Box Drawings Light Triple Dash Vertical / Forms Light Triple Dash Vertical
+{0x4e13, 0x0359, 0x0338'29D0}, // ⧐̸, \NotRightTriangleBar, Vertical Bar Beside Right Triangle + Combining Long Solidus Overlay / Non-Spacing Long Slash Overlay
+{0x6e04, 0x37d7, 0x2270}, // ≰, \nleq, Neither Less-Than Nor Equal To / Neither Less Than Nor Equal To
+{0x6105, 0x07e0, 0x224D}, // ≍, \asymp, Equivalent To
+{0x730a, 0x4774, 0x2AB8}, // ⪸, \succapprox, Succeeds Above Almost Equal To
+{0x7305, 0x4163, 0xDDAF'D835}, // U+1D5AF, 𝖯, \sansP, Mathematical Sans-Serif Capital P
+{0x6905, 0x2dff, 0xDF13'D835}, // U+1D713, 𝜓, \itpsi, Mathematical Italic Small Psi
+{0x6206, 0x0b41, 0xDEAD'D835}, // U+1D6AD, 𝚭, \bfZeta, Mathematical Bold Capital Zeta
+{0x6206, 0x1b11, 0xDDFA'D835}, // U+1D5FA, 𝗺, \bsansm, Mathematical Sans-Serif Bold Small M
+{0x6207, 0x1378, 0xDE59'D835}, // U+1D659, 𝙙, \bisansd, Mathematical Sans-Serif Bold Italic Small D
+{0x740a, 0x489b, 0x2005}, //  , \thickspace, Four-Per-Em Space
+{0x6206, 0x0c49, 0xDD6C'D835}, // U+1D56C, 𝕬, \bfrakA, Mathematical Bold Fraktur Capital A
+{0x7605, 0x5026, 0x2640}, // ♀, \venus, Female Sign
+{0x6e05, 0x3734, 0x2247}, // ≇, \ncong, Neither Approximately Nor Actually Equal To
+{0x630a, 0x1efd, 0x229B}, // ⊛, \circledast, Circled Asterisk Operator
+{0x4c0f, 0x0231, 0x2958}, // ⥘, \LeftUpVectorBar, Upwards Harpoon With Barb Left To Bar
+{0x6408, 0x2204, 0x2300}, // ⌀, \diameter, Diameter Sign
+{0x7305, 0x4175, 0xDDB2'D835}, // U+1D5B2, 𝖲, \sansS, Mathematical Sans-Serif Capital S
+{0x7307, 0x47f7, 0x2AC2}, // ⫂, \supmult, Superset With Multiplication Sign Below
+{0x6315, 0x205c, 0x2A50}, // ⩐, \closedvarcupsmashprod, Closed Union With Serifs And Smash Product
+{0x6605, 0x26a7, 0xDD0E'D835}, // U+1D50E, 𝔎, \frakK, Mathematical Fraktur Capital K
+{0x620b, 0x12e1, 0xDF97'D835}, // U+1D797, 𝞗, \bisansTheta, Mathematical Sans-Serif Bold Italic Capital Theta
+{0x730b, 0x40e3, 0x2650}, // ♐, \sagittarius, Sagittarius
+{0x6e02, 0x378a, 0x014B}, // ŋ, \ng, Latin Small Letter Eng
+{0x620c, 0x1549, 0xDFC8'D835}, // U+1D7C8, 𝟈, \bisansvarrho, Mathematical Sans-Serif Bold Italic Rho Symbol
+{0x6806, 0x2981, 0x200A}, //  , \hspace, Hair Space
+{0x6206, 0x0d22, 0xDD8B'D835}, // U+1D58B, 𝖋, \bfrakf, Mathematical Bold Fraktur Small F
+{0x6c07, 0x3282, 0x2AF7}, // ⫷, \lllnest, Triple Nested Less-Than
+{0x6204, 0x0efe, 0xDF27'D835}, // U+1D727, 𝜧, \biMu, Mathematical Bold Italic Capital Mu
+{0x6203, 0x0f75, 0xDC7E'D835}, // U+1D47E, 𝑾, \biW, Mathematical Bold Italic Capital W
+{0x6903, 0x2e3f, 0xDC63'D835}, // U+1D463, 𝑣, \itv, Mathematical Italic Small V
+{0x7207, 0x4091, 0x29F7}, // ⧷, \rsolbar, Reverse Solidus With Horizontal Stroke
+{0x6d0c, 0x3430, 0x2B25}, // ⬥, \mdblkdiamond, Black Medium Diamond
+{0x620e, 0x17cf, 0x2590}, // ▐, \blockrighthalf, Right Half Block
+{0x6206, 0x0cab, 0xDD7A'D835}, // U+1D57A, 𝕺, \bfrakO, Mathematical Bold Fraktur Capital O
+{0x760c, 0x5044, 0x22D8}, // ⋘, \verymuchless, Very Much Less-Than / Very Much Less Than
+{0x7305, 0x4199, 0xDDB8'D835}, // U+1D5B8, 𝖸, \sansY, Mathematical Sans-Serif Capital Y
+{0x7305, 0x422c, 0xDDC9'D835}, // U+1D5C9, 𝗉, \sansp, Mathematical Sans-Serif Small P
+{0x6214, 0x0884, 0x2920}, // ⤠, \barrightarrowdiamond, Rightwards Arrow From Bar To Black Diamond
+{0x7403, 0x4a39, 0xDE72'D835}, // U+1D672, 𝙲, \ttC, Mathematical Monospace Capital C
+{0x7007, 0x3c88, 0x2A72}, // ⩲, \pluseqq, Plus Sign Above Equals Sign
+{0x760b, 0x4e68, 0x2305}, // ⌅, \varbarwedge, Projective
+{0x6605, 0x2797, 0xDD36'D835}, // U+1D536, 𝔶, \fraky, Mathematical Fraktur Small Y
+{0x6605, 0x2737, 0xDD26'D835}, // U+1D526, 𝔦, \fraki, Mathematical Fraktur Small I
+{0x6e05, 0x388e, 0x019E}, // ƞ, \nrleg, Latin Small Letter N With Long Right Leg
+{0x7403, 0x4afc, 0xDE9A'D835}, // U+1D69A, 𝚚, \ttq, Mathematical Monospace Small Q
+{0x7305, 0x41eb, 0xDDC1'D835}, // U+1D5C1, 𝗁, \sansh, Mathematical Sans-Serif Small H
+{0x6709, 0x286d, 0x2A86}, // ⪆, \gtrapprox, Greater-Than Or Approximate
+{0x6903, 0x2d1a, 0xDC4C'D835}, // U+1D44C, 𝑌, \itY, Mathematical Italic Capital Y
+{0x7504, 0x4cf1, 0x039D}, // Ν, \upNu, Greek Capital Letter Nu
+{0x4503, 0x0177, 0x0397}, // Η, \Eta, Greek Capital Letter Eta
+{0x6e0b, 0x38ab, 0x22E3}, // ⋣, \nsqsupseteq, Not Square Original Of Or Equal To
+{0x6208, 0x08a0, 0x22BC}, // ⊼, \barwedge, Nand
+{0x740c, 0x495a, 0x25C1}, // ◁, \triangleleft, White Left-Pointing Triangle / White Left Pointing Triangle
+{0x6e04, 0x3894, 0x2241}, // ≁, \nsim, Not Tilde
+{0x6205, 0x1d0c, 0xDCDC'D835}, // U+1D4DC, 𝓜, \bscrM, Mathematical Bold Script Capital M
+{0x7608, 0x5051, 0x2317}, // ⌗, \viewdata, Viewdata Square
+{0x7304, 0x4316, 0xDCAB'D835}, // U+1D4AB, 𝒫, \scrP, Mathematical Script Capital P
+{0x5605, 0x0561, 0x22AB}, // ⊫, \VDash, Double Vertical Bar Double Right Turnstile
+{0x6505, 0x252e, 0x22DD}, // ⋝, \eqgtr, Equal To Or Greater-Than / Equal To Or Greater Than
+{0x6102, 0x073f, 0x00E6}, // æ, \ae, Latin Small Letter Ae / Latin Small Letter A E
+{0x7403, 0x4b04, 0xDE9C'D835}, // U+1D69C, 𝚜, \tts, Mathematical Monospace Small S
+{0x7306, 0x429b, 0x2644}, // ♄, \saturn, Saturn
+{0x6203, 0x0b5f, 0xDC1C'D835}, // U+1D41C, 𝐜, \bfc, Mathematical Bold Small C
+{0x6405, 0x21cc, 0x22F1}, // ⋱, \ddots, Down Right Diagonal Ellipsis
+{0x6203, 0x0f51, 0xDC7B'D835}, // U+1D47B, 𝑻, \biT, Mathematical Bold Italic Capital T
+{0x6e0b, 0x37fe, 0x2060}, // ⁠, \nolinebreak, Word Joiner
+{0x6605, 0x265a, 0x2AD9}, // ⫙, \forkv, Element Of Opening Downwards
+{0x6f10, 0x3aab, 0x2233}, // ∳, \ointctrclockwise, Anticlockwise Contour Integral
+{0x6808, 0x292d, 0x2926}, // ⤦, \hkswarow, South West Arrow With Hook
+{0x7403, 0x4ad7, 0xDE94'D835}, // U+1D694, 𝚔, \ttk, Mathematical Monospace Small K
+{0x6906, 0x2bea, 0xDE3B'D835}, // U+1D63B, 𝘻, \isansz, Mathematical Sans-Serif Italic Small Z
+{0x7305, 0x43f3, 0x266F}, // ♯, \sharp, Music Sharp Sign / Sharp
+{0x5e05, 0x0606, 0x1D5D}, // ᵝ, \^beta, Modifier Letter Small Beta
+{0x6206, 0x0c81, 0xDD74'D835}, // U+1D574, 𝕴, \bfrakI, Mathematical Bold Fraktur Capital I
+{0x6605, 0x26c5, 0xDD13'D835}, // U+1D513, 𝔓, \frakP, Mathematical Fraktur Capital P
+{0x7406, 0x4ae7, 0xDFFF'D835}, // U+1D7FF, 𝟿, \ttnine, Mathematical Monospace Digit Nine
+{0x6212, 0x0ff7, 0x25B2}, // ▲, \bigblacktriangleup, Black Up-Pointing Triangle / Black Up Pointing Triangle
+{0x650d, 0x259e, 0x22D5}, // ⋕, \equalparallel, Equal And Parallel To
+{0x7702, 0x5190, 0x2118}, // ℘, \wp, Script Capital P / Script P
+{0x6212, 0x1754, 0x25B6}, // ▶, \blacktriangleright, Black Right-Pointing Triangle / Black Right Pointing Triangle
+{0x630f, 0x1eca, 0x21BA}, // ↺, \circlearrowleft, Anticlockwise Open Circle Arrow
+{0x6605, 0x26b3, 0xDD10'D835}, // U+1D510, 𝔐, \frakM, Mathematical Fraktur Capital M
+{0x6203, 0x092a, 0xDD55'D835}, // U+1D555, 𝕕, \bbd, Mathematical Double-Struck Small D
+{0x6203, 0x0902, 0xDD4B'D835}, // U+1D54B, 𝕋, \bbT, Mathematical Double-Struck Capital T
+{0x7009, 0x3c6f, 0x22D4}, // ⋔, \pitchfork, Pitchfork
+{0x6208, 0x0aa8, 0xDEB2'D835}, // U+1D6B2, 𝚲, \bfLambda, Mathematical Bold Capital Lamda
+{0x6209, 0x1284, 0xDFA5'D835}, // U+1D7A5, 𝞥, \bisansPhi, Mathematical Sans-Serif Bold Italic Capital Phi
+{0x6205, 0x1d72, 0xDCED'D835}, // U+1D4ED, 𝓭, \bscrd, Mathematical Bold Script Small D
+{0x630f, 0x1f4b, 0x2686}, // ⚆, \circledrightdot, White Circle With Dot Right
+{0x6208, 0x15f7, 0xDF4B'D835}, // U+1D74B, 𝝋, \bivarphi, Mathematical Bold Italic Small Phi
+{0x640b, 0x226d, 0x2662}, // ♢, \diamondsuit, White Diamond Suit
+{0x6605, 0x279d, 0xDD37'D835}, // U+1D537, 𝔷, \frakz, Mathematical Fraktur Small Z
+{0x5e06, 0x063b, 0x1D5E}, // ᵞ, \^gamma, Modifier Letter Small Greek Gamma
+{0x6e0b, 0x389f, 0x22E2}, // ⋢, \nsqsubseteq, Not Square Image Of Or Equal To
+{0x6e13, 0x36de, 0x2901}, // ⤁, \nVtwoheadrightarrow, Rightwards Two-Headed Arrow With Double Vertical Stroke
+{0x5f02, 0x06af, 0x2083}, // ₃, \_3, Subscript Three / Subscript Digit Three
+{0x6204, 0x0c01, 0xDECE'D835}, // U+1D6CE, 𝛎, \bfnu, Mathematical Bold Small Nu
+{0x7304, 0x4370, 0xDCBD'D835}, // U+1D4BD, 𝒽, \scrh, Mathematical Script Small H
+{0x6206, 0x0cff, 0xDD86'D835}, // U+1D586, 𝖆, \bfraka, Mathematical Bold Fraktur Small A
+{0x6209, 0x1912, 0xDF5E'D835}, // U+1D75E, 𝝞, \bsansIota, Mathematical Sans-Serif Bold Capital Iota
+{0x6f0c, 0x3b22, 0x00BA}, // º, \ordmasculine, Masculine Ordinal Indicator
+{0x6e02, 0x3953, 0x03BD}, // ν, \nu, Greek Small Letter Nu
+{0x6206, 0x163c, 0xDF3B'D835}, // U+1D73B, 𝜻, \bizeta, Mathematical Bold Italic Small Zeta
+{0x5f02, 0x06b8, 0x2086}, // ₆, \_6, Subscript Six / Subscript Digit Six
+{0x5e08, 0x0682, 0xA71B}, // ꜛ, \^uparrow, Modifier Letter Raised Up Arrow
+{0x6e06, 0x3774, 0x2262}, // ≢, \nequiv, Not Identical To
+{0x6205, 0x0b95, 0xDEC8'D835}, // U+1D6C8, 𝛈, \bfeta, Mathematical Bold Small Eta
+{0x7403, 0x4a49, 0xDE76'D835}, // U+1D676, 𝙶, \ttG, Mathematical Monospace Capital G
+{0x7304, 0x437f, 0xDCC0'D835}, // U+1D4C0, 𝓀, \scrk, Mathematical Script Small K
+{0x6709, 0x28bf, 0xFE00'2269}, // ≩︀, \gvertneqq, Greater-Than But Not Equal To / Greater Than But Not Equal To + Variation Selector-1
+{0x7304, 0x42f3, 0x2110}, // ℐ, \scrI, Script Capital I / Script I
+{0x6207, 0x133f, 0xDE56'D835}, // U+1D656, 𝙖, \bisansa, Mathematical Sans-Serif Bold Italic Small A
+{0x760b, 0x4ef8, 0x22F6}, // ⋶, \varisinobar, Element Of With Overbar
+{0x6206, 0x1ca9, 0xDE07'D835}, // U+1D607, 𝘇, \bsansz, Mathematical Sans-Serif Bold Small Z
+{0x760c, 0x5000, 0x2A63}, // ⩣, \veedoublebar, Logical Or With Double Underbar
+{0x7317, 0x447a, 0x25B8}, // ▸, \smallblacktriangleright, Black Right-Pointing Small Triangle / Black Right Pointing Small Triangle
+{0x6f0d, 0x3b93, 0x20D6}, // ⃖, \overleftarrow, Combining Left Arrow Above / Non-Spacing Left Arrow Above
+{0x6e05, 0x382e, 0x2209}, // ∉, \notin, Not An Element Of
+{0x7212, 0x3fe3, 0x2B53}, // ⭓, \rightpentagonblack, Black Right-Pointing Pentagon
+{0x690a, 0x2e43, 0xDEF3'D835}, // U+1D6F3, 𝛳, \itvarTheta, Mathematical Italic Capital Theta Symbol
+{0x6e04, 0x378d, 0x2271}, // ≱, \ngeq, Neither Greater-Than Nor Equal To / Neither Greater Than Nor Equal To
+{0x6906, 0x29e6, 0x2A0E}, // ⨎, \intBar, Integral With Double Stroke
+{0x5e02, 0x05de, 0x1D39}, // ᴹ, \^M, Modifier Letter Capital M
+{0x640d, 0x22db, 0x22C7}, // ⋇, \divideontimes, Division Times
+{0x7403, 0x4a6d, 0xDE7F'D835}, // U+1D67F, 𝙿, \ttP, Mathematical Monospace Capital P
+{0x6c05, 0x2f07, 0x2026}, // …, \ldots, Horizontal Ellipsis
+{0x6906, 0x2a93, 0xDE0A'D835}, // U+1D60A, 𝘊, \isansC, Mathematical Sans-Serif Italic Capital C
+{0x6205, 0x1879, 0x0306}, // ̆, \breve, Combining Breve / Non-Spacing Breve
+{0x4102, 0x0051, 0x00C5}, // Å, \AA, Latin Capital Letter A With Ring Above / Latin Capital Letter A Ring
+{0x6405, 0x2289, 0x2680}, // ⚀, \dicei, Die Face-1
+{0x7203, 0x3e2a, 0x03C1}, // ρ, \rho, Greek Small Letter Rho
+{0x7309, 0x41c3, 0xDFEA'D835}, // U+1D7EA, 𝟪, \sanseight, Mathematical Sans-Serif Digit Eight
+{0x7305, 0x4169, 0xDDB0'D835}, // U+1D5B0, 𝖰, \sansQ, Mathematical Sans-Serif Capital Q
+{0x6905, 0x29cf, 0x2AEB}, // ⫫, \indep, Double Up Tack
+{0x6204, 0x0974, 0x2149}, // ⅉ, \bbij, Double-Struck Italic Small J
+{0x6207, 0x0fda, 0xDF38'D835}, // U+1D738, 𝜸, \bigamma, Mathematical Bold Italic Small Gamma
+{0x5402, 0x0503, 0x00DE}, // Þ, \TH, Latin Capital Letter Thorn
+{0x6209, 0x187f, 0x00A6}, // ¦, \brokenbar, Broken Bar / Broken Vertical Bar
+{0x6e10, 0x3970, 0x2904}, // ⤄, \nvLeftrightarrow, Left Right Double Arrow With Vertical Stroke
+{0x6d0c, 0x3585, 0x2B51}, // ⭑, \medblackstar, Black Small Star
+{0x4204, 0x0070, 0x0392}, // Β, \Beta, Greek Capital Letter Beta
+{0x6206, 0x1a1b, 0xDDEC'D835}, // U+1D5EC, 𝗬, \bsansY, Mathematical Sans-Serif Bold Capital Y
+{0x6206, 0x1ca2, 0xDE06'D835}, // U+1D606, 𝘆, \bsansy, Mathematical Sans-Serif Bold Small Y
+{0x6105, 0x07bb, 0x2648}, // ♈, \aries, Aries
+{0x620d, 0x1722, 0x25B4}, // ▴, \blacktriangle, Black Up-Pointing Small Triangle / Black Up Pointing Small Triangle
+{0x6312, 0x1f76, 0x29BE}, // ⦾, \circledwhitebullet, Circled White Bullet
+{0x6216, 0x1673, 0x25D5}, // ◕, \blackcircleulquadwhite, Circle With All But Upper Left Quadrant Black
+{0x5e02, 0x05d8, 0x1D37}, // ᴷ, \^K, Modifier Letter Capital K
+{0x6208, 0x1865, 0x22A0}, // ⊠, \boxtimes, Squared Times
+{0x5f02, 0x06f1, 0x2099}, // ₙ, \_n, Latin Subscript Small Letter N
+{0x6203, 0x08ad, 0xDD39'D835}, // U+1D539, 𝔹, \bbB, Mathematical Double-Struck Capital B
+{0x6207, 0x0b12, 0xDEAF'D835}, // U+1D6AF, 𝚯, \bfTheta, Mathematical Bold Capital Theta
+{0x7008, 0x3cd1, 0x2057}, // ⁗, \pppprime, Quadruple Prime
+{0x6209, 0x0f18, 0xDF2A'D835}, // U+1D72A, 𝜪, \biOmicron, Mathematical Bold Italic Capital Omicron
+{0x6906, 0x2b3b, 0xDE22'D835}, // U+1D622, 𝘢, \isansa, Mathematical Sans-Serif Italic Small A
+{0x440a, 0x00b1, 0x290B}, // ⤋, \Ddownarrow, Downwards Triple Arrow
+{0x630b, 0x1f16, 0x229A}, // ⊚, \circledcirc, Circled Ring Operator
+{0x6904, 0x2a27, 0x2A18}, // ⨘, \intx, Integral With Times Sign
+{0x6108, 0x07d7, 0x2609}, // ☉, \astrosun, Sun
+{0x730c, 0x4710, 0x2AC9}, // ⫉, \subsetapprox, Subset Of Above Almost Equal To
+{0x7306, 0x4417, 0x2A9E}, // ⪞, \simgtr, Similar Or Greater-Than
+{0x6c09, 0x33e8, 0xFE00'2268}, // ≨︀, \lvertneqq, Less-Than But Not Equal To / Less Than But Not Equal To + Variation Selector-1
+{0x7308, 0x4727, 0x2286}, // ⊆, \subseteq, Subset Of Or Equal To
+{0x6d0d, 0x3456, 0x25CF}, // ●, \mdlgblkcircle, Black Circle
+{0x6207, 0x1574, 0xDE6C'D835}, // U+1D66C, 𝙬, \bisansw, Mathematical Sans-Serif Bold Italic Small W
+{0x6206, 0x1923, 0xDDDE'D835}, // U+1D5DE, 𝗞, \bsansK, Mathematical Sans-Serif Bold Capital K
+{0x6203, 0x0b69, 0xDC1D'D835}, // U+1D41D, 𝐝, \bfd, Mathematical Bold Small D
+{0x7304, 0x4320, 0x211B}, // ℛ, \scrR, Script Capital R / Script R
+{0x6503, 0x25c7, 0x03B7}, // η, \eta, Greek Small Letter Eta
+{0x4305, 0x0088, 0x2237}, // ∷, \Colon, Proportion
+{0x6303, 0x1e65, 0x2229}, // ∩, \cap, Intersection
+{0x740d, 0x4914, 0x25E0}, // ◠, \topsemicircle, Upper Half Circle
+{0x6d0f, 0x354e, 0x29AC}, // ⦬, \measangleurtone, Measured Angle With Open Arm Ending In Arrow Pointing Right And Up
+{0x7006, 0x3ce2, 0x2033}, // ″, \pprime, Double Prime
+{0x6906, 0x2bb9, 0xDE34'D835}, // U+1D634, 𝘴, \isanss, Mathematical Sans-Serif Italic Small S
+{0x7308, 0x44f8, 0x29E4}, // ⧤, \smeparsl, Equals Sign And Slanted Parallel With Tilde Above
+{0x6204, 0x0f2c, 0xDF2B'D835}, // U+1D72B, 𝜫, \biPi, Mathematical Bold Italic Capital Pi
+{0x6205, 0x1cee, 0xDCD7'D835}, // U+1D4D7, 𝓗, \bscrH, Mathematical Bold Script Capital H
+{0x7304, 0x4865, 0x221A}, // √, \surd, Square Root
+{0x6207, 0x110f, 0xDF35'D835}, // U+1D735, 𝜵, \binabla, Mathematical Bold Italic Nabla
+{0x6303, 0x20ee, 0x222A}, // ∪, \cup, Union
+{0x6211, 0x1dfc, 0x2B41}, // ⭁, \bsimilarleftarrow, Reverse Tilde Operator Above Leftwards Arrow
+{0x630d, 0x1f08, 0x29BF}, // ⦿, \circledbullet, Circled Bullet
+{0x6c06, 0x31cd, 0x2A93}, // ⪓, \lesges, Less-Than Above Slanted Equal Above Greater-Than Above Slanted Equal
+{0x5e02, 0x05b1, 0x2076}, // ⁶, \^6, Superscript Six / Superscript Digit Six
+{0x6203, 0x09a7, 0xDD62'D835}, // U+1D562, 𝕢, \bbq, Mathematical Double-Struck Small Q
+{0x7415, 0x4bf7, 0x2916}, // ⤖, \twoheadrightarrowtail, Rightwards Two-Headed Arrow With Tail
+{0x6209, 0x0c12, 0xDED0'D835}, // U+1D6D0, 𝛐, \bfomicron, Mathematical Bold Small Omicron
+{0x6207, 0x0a2e, 0xDEA8'D835}, // U+1D6A8, 𝚨, \bfAlpha, Mathematical Bold Capital Alpha
+{0x6203, 0x0a36, 0xDC01'D835}, // U+1D401, 𝐁, \bfB, Mathematical Bold Capital B
+{0x6d0b, 0x3424, 0x26AB}, // ⚫, \mdblkcircle, Medium Black Circle
+{0x7206, 0x40dc, 0x25D8}, // ◘, \rvbull, Inverse Bullet
+{0x4507, 0x0163, 0x0395}, // Ε, \Epsilon, Greek Capital Letter Epsilon
+{0x6205, 0x0eb8, 0xDF22'D835}, // U+1D722, 𝜢, \biEta, Mathematical Bold Italic Capital Eta
+{0x6203, 0x0b28, 0xDC15'D835}, // U+1D415, 𝐕, \bfV, Mathematical Bold Capital V
+{0x6e04, 0x37b7, 0x22FA}, // ⋺, \nisd, Contains With Long Horizontal Stroke
+{0x6208, 0x0bdc, 0xDECC'D835}, // U+1D6CC, 𝛌, \bflambda, Mathematical Bold Small Lamda
+{0x6903, 0x2d7a, 0x210E}, // ℎ, \ith, Planck Constant
+{0x650b, 0x2559, 0x2A9C}, // ⪜, \eqqslantgtr, Double-Line Slanted Equal To Or Greater-Than
+{0x620c, 0x1530, 0xDFBF'D835}, // U+1D7BF, 𝞿, \bisansvarphi, Mathematical Sans-Serif Bold Italic Small Phi
+{0x6c0a, 0x2fb1, 0x2B3E}, // ⬾, \leftarrowx, Leftwards Arrow Through X
+{0x620e, 0x1059, 0x2A58}, // ⩘, \bigslopedwedge, Sloping Large And
+{0x6205, 0x1d96, 0xDCF3'D835}, // U+1D4F3, 𝓳, \bscrj, Mathematical Bold Script Small J
+{0x6305, 0x20e8, 0x2AD2}, // ⫒, \csupe, Closed Superset Or Equal To
+{0x6206, 0x0cdc, 0xDD81'D835}, // U+1D581, 𝖁, \bfrakV, Mathematical Bold Fraktur Capital V
+{0x7307, 0x449a, 0x220D}, // ∍, \smallni, Small Contains As Member
+{0x630b, 0x1f5b, 0x272A}, // ✪, \circledstar, Circled White Star
+{0x6206, 0x098d, 0xDFE1'D835}, // U+1D7E1, 𝟡, \bbnine, Mathematical Double-Struck Digit Nine
+{0x6c09, 0x326f, 0x27E6}, // ⟦, \llbracket, Mathematical Left White Square Bracket
+{0x6c16, 0x30c6, 0x294B}, // ⥋, \leftrightharpoondownup, Left Barb Down Right Barb Up Harpoon
+{0x4e07, 0x02d2, 0x21D7}, // ⇗, \Nearrow, North East Double Arrow / Upper Right Double Arrow
+{0x6d0b, 0x344a, 0x25FC}, // ◼, \mdblksquare, Black Medium Square
+{0x730d, 0x4632, 0x2B15}, // ⬕, \squarellblack, Square With Lower Left Diagonal Half Black
+{0x6207, 0x138c, 0xDE5A'D835}, // U+1D65A, 𝙚, \bisanse, Mathematical Sans-Serif Bold Italic Small E
+{0x6e03, 0x3769, 0x2260}, // ≠, \neq, Not Equal To
+{0x6906, 0x2a9a, 0xDE0B'D835}, // U+1D60B, 𝘋, \isansD, Mathematical Sans-Serif Italic Capital D
+{0x6206, 0x0ce3, 0xDD82'D835}, // U+1D582, 𝖂, \bfrakW, Mathematical Bold Fraktur Capital W
+{0x6208, 0x1bfd, 0xDFEE'D835}, // U+1D7EE, 𝟮, \bsanstwo, Mathematical Sans-Serif Bold Digit Two
+{0x7403, 0x4a81, 0xDE84'D835}, // U+1D684, 𝚄, \ttU, Mathematical Monospace Capital U
+{0x6105, 0x0739, 0x22F0}, // ⋰, \adots, Up Right Diagonal Ellipsis
+{0x6e0a, 0x390a, 0x0338'2AC6}, // ⫆̸, \nsupseteqq, Superset Of Above Equals Sign + Combining Long Solidus Overlay / Non-Spacing Long Slash Overlay
+{0x7414, 0x4c1c, 0x2949}, // ⥉, \twoheaduparrowcircle, Upwards Two-Headed Arrow From Small Circle
+{0x720e, 0x4038, 0x219D}, // ↝, \rightwavearrow, Rightwards Wave Arrow / Right Wave Arrow
+{0x730a, 0x45a8, 0x23B7}, // ⎷, \sqrtbottom, Radical Symbol Bottom
+{0x720f, 0x4047, 0x21E8}, // ⇨, \rightwhitearrow, Rightwards White Arrow / White Right Arrow
+{0x6206, 0x0d68, 0xDD95'D835}, // U+1D595, 𝖕, \bfrakp, Mathematical Bold Fraktur Small P
+{0x7404, 0x4a16, 0x0279}, // ɹ, \trnr, Latin Small Letter Turned R
+{0x620a, 0x1334, 0xDF95'D835}, // U+1D795, 𝞕, \bisansZeta, Mathematical Sans-Serif Bold Italic Capital Zeta
+{0x5e02, 0x05f6, 0x1D42}, // ᵂ, \^W, Modifier Letter Capital W
+{0x6c0c, 0x2fe6, 0x290E}, // ⤎, \leftdbkarrow, Leftwards Triple Dash Arrow
+{0x6c04, 0x32a0, 0x02D0}, // ː, \lmrk, Modifier Letter Triangular Colon
+{0x6207, 0x0e81, 0xDF1C'D835}, // U+1D71C, 𝜜, \biAlpha, Mathematical Bold Italic Capital Alpha
+{0x6605, 0x273d, 0xDD27'D835}, // U+1D527, 𝔧, \frakj, Mathematical Fraktur Small J
+{0x7304, 0x4541, 0x0336}, // ̶, \sout, Combining Long Stroke Overlay / Non-Spacing Long Bar Overlay
+{0x6205, 0x1dc0, 0xDCFA'D835}, // U+1D4FA, 𝓺, \bscrq, Mathematical Bold Script Small Q
+{0x7409, 0x492c, 0x2122}, // ™, \trademark, Trade Mark Sign / Trademark
+{0x620a, 0x11fc, 0xDF98'D835}, // U+1D798, 𝞘, \bisansIota, Mathematical Sans-Serif Bold Italic Capital Iota
+{0x7406, 0x4876, 0x2649}, // ♉, \taurus, Taurus
+{0x6205, 0x1d3c, 0xDCE4'D835}, // U+1D4E4, 𝓤, \bscrU, Mathematical Bold Script Capital U
+{0x6405, 0x2160, 0x2AE3}, // ⫣, \dashV, Double Vertical Bar Left Turnstile
+{0x720b, 0x3e14, 0x29B0}, // ⦰, \revemptyset, Reversed Empty Set
+{0x5f02, 0x06e5, 0x2C7C}, // ⱼ, \_j, Latin Subscript Small Letter J
+{0x6605, 0x263e, 0x23E5}, // ⏥, \fltns, Flatness
+{0x760d, 0x4f16, 0x22BF}, // ⊿, \varlrtriangle, Right Triangle
+{0x7405, 0x48ed, 0x00D7}, // ×, \times, Multiplication Sign
+{0x6206, 0x0945, 0xDFDC'D835}, // U+1D7DC, 𝟜, \bbfour, Mathematical Double-Struck Digit Four
+{0x730b, 0x46bd, 0x25A5}, // ▥, \squarevfill, Square With Vertical Fill
+{0x6207, 0x14e3, 0xDE6A'D835}, // U+1D66A, 𝙪, \bisansu, Mathematical Sans-Serif Bold Italic Small U
+{0x6506, 0x2534, 0x22DC}, // ⋜, \eqless, Equal To Or Less-Than / Equal To Or Less Than
+{0x5e02, 0x0654, 0x02E1}, // ˡ, \^l, Modifier Letter Small L
+{0x7408, 0x49ec, 0x205D}, // ⁝, \tricolon, Tricolon
+{0x6e07, 0x3724, 0x266E}, // ♮, \natural, Music Natural Sign / Natural
+{0x6605, 0x26dd, 0xDD17'D835}, // U+1D517, 𝔗, \frakT, Mathematical Fraktur Capital T
+{0x6206, 0x0cc0, 0xDD7D'D835}, // U+1D57D, 𝕽, \bfrakR, Mathematical Bold Fraktur Capital R
+{0x7403, 0x4b00, 0xDE9B'D835}, // U+1D69B, 𝚛, \ttr, Mathematical Monospace Small R
+{0x620a, 0x0804, 0x2036}, // ‶, \backpprime, Reversed Double Prime
+{0x6209, 0x0c26, 0xDEDB'D835}, // U+1D6DB, 𝛛, \bfpartial, Mathematical Bold Partial Differential
+{0x6205, 0x1cd0, 0xDCD2'D835}, // U+1D4D2, 𝓒, \bscrC, Mathematical Bold Script Capital C
+{0x6d04, 0x33f2, 0x2642}, // ♂, \male, Male Sign
+{0x6403, 0x21e7, 0x2207}, // ∇, \del, Nabla
+{0x740f, 0x4bc7, 0x2B36}, // ⬶, \twoheadmapsfrom, Leftwards Two-Headed Arrow From Bar
+{0x5e02, 0x065e, 0x1D50}, // ᵐ, \^m, Modifier Letter Small M
+{0x6207, 0x1177, 0xDE3D'D835}, // U+1D63D, 𝘽, \bisansB, Mathematical Sans-Serif Bold Italic Capital B
+{0x6205, 0x1d7e, 0xDCEF'D835}, // U+1D4EF, 𝓯, \bscrf, Mathematical Bold Script Small F
+{0x6903, 0x2dbf, 0xDC5B'D835}, // U+1D45B, 𝑛, \itn, Mathematical Italic Small N
+{0x6203, 0x0981, 0xDD5D'D835}, // U+1D55D, 𝕝, \bbl, Mathematical Double-Struck Small L
+{0x4412, 0x0139, 0x2957}, // ⥗, \DownRightVectorBar, Rightwards Harpoon With Barb Down To Bar
+{0x640e, 0x23ef, 0x21E9}, // ⇩, \downwhitearrow, Downwards White Arrow / White Down Arrow
+{0x4c06, 0x01ae, 0x039B}, // Λ, \Lambda, Greek Capital Letter Lamda / Greek Capital Letter Lambda
+{0x6905, 0x2d64, 0xDF02'D835}, // U+1D702, 𝜂, \iteta, Mathematical Italic Small Eta
+{0x6206, 0x181e, 0x25EB}, // ◫, \boxbar, White Square With Vertical Bisecting Line
+{0x7305, 0x4232, 0xDDCA'D835}, // U+1D5CA, 𝗊, \sansq, Mathematical Sans-Serif Small Q
+{0x6206, 0x0839, 0x2A43}, // ⩃, \barcap, Intersection With Overbar
+{0x7405, 0x4b10, 0xDFFC'D835}, // U+1D7FC, 𝟼, \ttsix, Mathematical Monospace Digit Six
+{0x620e, 0x17c0, 0x2591}, // ░, \blockqtrshaded, Light Shade
+{0x6206, 0x18ce, 0xDDD8'D835}, // U+1D5D8, 𝗘, \bsansE, Mathematical Sans-Serif Bold Capital E
+{0x6c07, 0x3356, 0x25CA}, // ◊, \lozenge, Lozenge
+{0x5e02, 0x0642, 0x02B0}, // ʰ, \^h, Modifier Letter Small H
+{0x620b, 0x11e0, 0xDF92'D835}, // U+1D792, 𝞒, \bisansGamma, Mathematical Sans-Serif Bold Italic Capital Gamma
+{0x6203, 0x0eaa, 0xDC6C'D835}, // U+1D46C, 𝑬, \biE, Mathematical Bold Italic Capital E
+{0x6203, 0x15c2, 0xDC96'D835}, // U+1D496, 𝒖, \biu, Mathematical Bold Italic Small U
+{0x6204, 0x0be9, 0xDECD'D835}, // U+1D6CD, 𝛍, \bfmu, Mathematical Bold Small Mu
+{0x620c, 0x104c, 0x2A57}, // ⩗, \bigslopedvee, Sloping Large Or
+{0x6303, 0x1eba, 0x03C7}, // χ, \chi, Greek Small Letter Chi
+{0x7606, 0x4ff2, 0x22BB}, // ⊻, \veebar, Xor
+{0x5605, 0x0579, 0x2980}, // ⦀, \Vvert, Triple Vertical Bar Delimiter
+{0x620b, 0x1716, 0x25A0}, // ■, \blacksquare, Black Square
+{0x6908, 0x2e66, 0xDF11'D835}, // U+1D711, 𝜑, \itvarphi, Mathematical Italic Small Phi
+{0x7410, 0x4b7c, 0x21A1}, // ↡, \twoheaddownarrow, Downwards Two Headed Arrow / Down Two Headed Arrow
+{0x6903, 0x2e96, 0xDC64'D835}, // U+1D464, 𝑤, \itw, Mathematical Italic Small W
+{0x6405, 0x21c1, 0x2999}, // ⦙, \ddfnc, Dotted Fence
+{0x690a, 0x2e5b, 0xDF18'D835}, // U+1D718, 𝜘, \itvarkappa, Mathematical Italic Kappa Symbol
+{0x7305, 0x4581, 0x2519}, // ┙, \sqfnw, Box Drawings Up Light And Left Heavy / Forms Up Light And Left Heavy
+{0x6605, 0x26ef, 0xDD1A'D835}, // U+1D51A, 𝔚, \frakW, Mathematical Fraktur Capital W
+{0x5507, 0x053c, 0x21D1}, // ⇑, \Uparrow, Upwards Double Arrow / Up Double Arrow
+{0x7607, 0x4f7b, 0x2736}, // ✶, \varstar, Six Pointed Black Star
+{0x740d, 0x4bd7, 0x2905}, // ⤅, \twoheadmapsto, Rightwards Two-Headed Arrow From Bar
+{0x6f12, 0x3ba1, 0x20E1}, // ⃡, \overleftrightarrow, Combining Left Right Arrow Above / Non-Spacing Left Right Arrow Above
+{0x6c0a, 0x31d4, 0x2A85}, // ⪅, \lessapprox, Less-Than Or Approximate
+{0x6506, 0x2527, 0x2A76}, // ⩶, \eqeqeq, Three Consecutive Equals Signs
+{0x5e02, 0x0596, 0x207E}, // ⁾, \^), Superscript Right Parenthesis / Superscript Closing Parenthesis
+{0x5205, 0x0490, 0x2942}, // ⥂, \Rlarr, Rightwards Arrow Above Short Leftwards Arrow
+{0x4e17, 0x032f, 0x0338'2AA2}, // ⪢̸, \NotNestedGreaterGreater, Double Nested Greater-Than + Combining Long Solidus Overlay / Non-Spacing Long Slash Overlay
+{0x6411, 0x225b, 0x2B17}, // ⬗, \diamondrightblack, Diamond With Right Half Black
+{0x6708, 0x282e, 0x2A8A}, // ⪊, \gnapprox, Greater-Than And Not Approximate
+{0x7008, 0x3bc0, 0x2225}, // ∥, \parallel, Parallel To
+{0x6208, 0x19d6, 0xDF69'D835}, // U+1D769, 𝝩, \bsansTau, Mathematical Sans-Serif Bold Capital Tau
+{0x6703, 0x27c7, 0x2265}, // ≥, \geq, Greater-Than Or Equal To / Greater Than Or Equal To
+{0x6407, 0x2439, 0x29DF}, // ⧟, \dualmap, Double-Ended Multimap
+{0x6c0d, 0x3172, 0x219C}, // ↜, \leftwavearrow, Leftwards Wave Arrow / Left Wave Arrow
+{0x6203, 0x08b5, 0xDD3B'D835}, // U+1D53B, 𝔻, \bbD, Mathematical Double-Struck Capital D
+{0x630a, 0x20b2, 0x2332}, // ⌲, \conictaper, Conical Taper
+{0x6209, 0x0a65, 0xDEAC'D835}, // U+1D6AC, 𝚬, \bfEpsilon, Mathematical Bold Capital Epsilon
+{0x7403, 0x4a7d, 0xDE83'D835}, // U+1D683, 𝚃, \ttT, Mathematical Monospace Capital T
+{0x6f07, 0x3a51, 0x29B8}, // ⦸, \obslash, Circled Reverse Solidus
+{0x6203, 0x0f86, 0xDC81'D835}, // U+1D481, 𝒁, \biZ, Mathematical Bold Italic Capital Z
+{0x620a, 0x196d, 0xDF6E'D835}, // U+1D76E, 𝝮, \bsansOmega, Mathematical Sans-Serif Bold Capital Omega
+{0x6508, 0x2474, 0x2205}, // ∅, \emptyset, Empty Set
+{0x750c, 0x4e1b, 0x21E7}, // ⇧, \upwhitearrow, Upwards White Arrow / White Up Arrow
+{0x6e07, 0x38b7, 0x2284}, // ⊄, \nsubset, Not A Subset Of
+{0x6506, 0x253b, 0x2A9A}, // ⪚, \eqqgtr, Double-Line Equal To Or Greater-Than
+{0x6203, 0x0906, 0xDD4C'D835}, // U+1D54C, 𝕌, \bbU, Mathematical Double-Struck Capital U
+{0x720a, 0x4070, 0x23B1}, // ⎱, \rmoustache, Upper Right Or Lower Left Curly Bracket Section
+{0x6c08, 0x31c4, 0x2A83}, // ⪃, \lesdotor, Less-Than Or Slanted Equal To With Dot Above Right
+{0x720e, 0x3dd4, 0x2930}, // ⤰, \rdiagovsearrow, Rising Diagonal Crossing South East Arrow
+{0x6203, 0x0a79, 0xDC06'D835}, // U+1D406, 𝐆, \bfG, Mathematical Bold Capital G
+{0x4504, 0x0156, 0x2A56}, // ⩖, \ElOr, Two Intersecting Logical Or
+{0x6c05, 0x2f01, 0x2308}, // ⌈, \lceil, Left Ceiling
+{0x7212, 0x3f16, 0x20D1}, // ⃑, \rightharpoonaccent, Combining Right Harpoon Above / Non-Spacing Right Harpoon Above
+{0x7506, 0x4c66, 0x2A41}, // ⩁, \uminus, Union With Minus Sign
+{0x6c0a, 0x328a, 0x25FA}, // ◺, \lltriangle, Lower Left Triangle
+{0x6d0f, 0x350e, 0x29A9}, // ⦩, \measanglelutonw, Measured Angle With Open Arm Ending In Arrow Pointing Up And Left
+{0x720f, 0x4028, 0x22CC}, // ⋌, \rightthreetimes, Right Semidirect Product
+{0x710c, 0x3d97, 0x00BF}, // ¿, \questiondown, Inverted Question Mark
+{0x6809, 0x28dc, 0x2661}, // ♡, \heartsuit, White Heart Suit
+{0x7007, 0x3d0c, 0x2AB3}, // ⪳, \preceqq, Precedes Above Equals Sign
+{0x6a07, 0x2ebd, 0x2643}, // ♃, \jupiter, Jupiter
+{0x6908, 0x2a02, 0x22BA}, // ⊺, \intercal, Intercalate
+{0x6406, 0x22ab, 0x2685}, // ⚅, \dicevi, Die Face-6
+{0x7403, 0x4a51, 0xDE78'D835}, // U+1D678, 𝙸, \ttI, Mathematical Monospace Capital I
+{0x5e02, 0x0667, 0x1D56}, // ᵖ, \^p, Modifier Letter Small P
+{0x7304, 0x4389, 0xDCC2'D835}, // U+1D4C2, 𝓂, \scrm, Mathematical Script Small M
+{0x6205, 0x09cb, 0xDFDE'D835}, // U+1D7DE, 𝟞, \bbsix, Mathematical Double-Struck Digit Six
+{0x6f04, 0x3a73, 0x2299}, // ⊙, \odot, Circled Dot Operator
+{0x6903, 0x2d40, 0xDC50'D835}, // U+1D450, 𝑐, \itc, Mathematical Italic Small C
+{0x6209, 0x0f67, 0xDF30'D835}, // U+1D730, 𝜰, \biUpsilon, Mathematical Bold Italic Capital Upsilon
+{0x7305, 0x4187, 0xDDB5'D835}, // U+1D5B5, 𝖵, \sansV, Mathematical Sans-Serif Capital V
+{0x6203, 0x0835, 0x0304}, // ̄, \bar, Combining Macron / Non-Spacing Macron
+{0x6203, 0x0fa8, 0xDC84'D835}, // U+1D484, 𝒄, \bic, Mathematical Bold Italic Small C
+{0x7304, 0x42f8, 0xDCA5'D835}, // U+1D4A5, 𝒥, \scrJ, Mathematical Script Capital J
+{0x7304, 0x4348, 0xDCB5'D835}, // U+1D4B5, 𝒵, \scrZ, Mathematical Script Capital Z
+{0x730c, 0x4695, 0x25F0}, // ◰, \squareulquad, White Square With Upper Left Quadrant
+{0x720e, 0x3ef9, 0x21E2}, // ⇢, \rightdasharrow, Rightwards Dashed Arrow / Right Dashed Arrow
+{0x7205, 0x3db6, 0x2947}, // ⥇, \rarrx, Rightwards Arrow Through X
+{0x6c0a, 0x3387, 0x25FF}, // ◿, \lrtriangle, Lower Right Triangle
+{0x6e07, 0x372c, 0x0338'224F}, // ≏̸, \nbumpeq, Difference Between + Combining Long Solidus Overlay / Non-Spacing Long Slash Overlay
+{0x6207, 0x11d8, 0xDE42'D835}, // U+1D642, 𝙂, \bisansG, Mathematical Sans-Serif Bold Italic Capital G
+{0x620e, 0x1521, 0xDFC6'D835}, // U+1D7C6, 𝟆, \bisansvarkappa, Mathematical Sans-Serif Bold Italic Kappa Symbol
+{0x680d, 0x293c, 0x21A9}, // ↩, \hookleftarrow, Leftwards Arrow With Hook / Left Arrow With Hook
+{0x7403, 0x4aa9, 0xDE8E'D835}, // U+1D68E, 𝚎, \tte, Mathematical Monospace Small E
+{0x6208, 0x1a5d, 0xDF86'D835}, // U+1D786, 𝞆, \bsanschi, Mathematical Sans-Serif Bold Small Chi
+{0x7304, 0x42fd, 0xDCA6'D835}, // U+1D4A6, 𝒦, \scrK, Mathematical Script Capital K
+{0x6e0e, 0x3834, 0x2278}, // ≸, \notlessgreater, Neither Less-Than Nor Greater-Than / Neither Less Than Nor Greater Than
+{0x6408, 0x2306, 0x2238}, // ∸, \dotminus, Dot Minus
+{0x7005, 0x3cb4, 0x2647}, // ♇, \pluto, Pluto
+{0x6301, 0x1e55, 0x0327}, // ̧, \c, Combining Cedilla / Non-Spacing Cedilla
+{0x620b, 0x1859, 0x2370}, // ⍰, \boxquestion, Apl Functional Symbol Quad Question
+{0x6206, 0x190b, 0xDDDC'D835}, // U+1D5DC, 𝗜, \bsansI, Mathematical Sans-Serif Bold Capital I
+{0x6605, 0x2689, 0xDD09'D835}, // U+1D509, 𝔉, \frakF, Mathematical Fraktur Capital F
+{0x5f02, 0x06e8, 0x2096}, // ₖ, \_k, Latin Subscript Small Letter K
+{0x760c, 0x4ebe, 0x2665}, // ♥, \varheartsuit, Black Heart Suit
+{0x6203, 0x0e7d, 0xDC68'D835}, // U+1D468, 𝑨, \biA, Mathematical Bold Italic Capital A
+{0x5e02, 0x05c3, 0x1D2E}, // ᴮ, \^B, Modifier Letter Capital B
+{0x6c08, 0x3064, 0x263E}, // ☾, \leftmoon, Last Quarter Moon
+{0x5f02, 0x06be, 0x2088}, // ₈, \_8, Subscript Eight / Subscript Digit Eight
+{0x620a, 0x1890, 0xDF56'D835}, // U+1D756, 𝝖, \bsansAlpha, Mathematical Sans-Serif Bold Capital Alpha
+{0x6206, 0x0cb9, 0xDD7C'D835}, // U+1D57C, 𝕼, \bfrakQ, Mathematical Bold Fraktur Capital Q
+{0x5e04, 0x066a, 0x1D60}, // ᵠ, \^phi, Modifier Letter Small Greek Phi
+{0x6903, 0x2e13, 0xDC60'D835}, // U+1D460, 𝑠, \its, Mathematical Italic Small S
+{0x6209, 0x1a4c, 0xDF71'D835}, // U+1D771, 𝝱, \bsansbeta, Mathematical Sans-Serif Bold Small Beta
+{0x760e, 0x4e92, 0x2666}, // ♦, \vardiamondsuit, Black Diamond Suit
+{0x4405, 0x00ab, 0x2AE4}, // ⫤, \Dashv, Vertical Bar Double Left Turnstile
+{0x6203, 0x0f22, 0xDC77'D835}, // U+1D477, 𝑷, \biP, Mathematical Bold Italic Capital P
+{0x4307, 0x008e, 0x2A74}, // ⩴, \Coloneq, Double Colon Equal
+{0x640e, 0x239f, 0x21CA}, // ⇊, \downdownarrows, Downwards Paired Arrows / Down Paired Arrows
+{0x6207, 0x11b0, 0xDE40'D835}, // U+1D640, 𝙀, \bisansE, Mathematical Sans-Serif Bold Italic Capital E
+{0x730e, 0x45fa, 0x2B13}, // ⬓, \squarebotblack, Square With Bottom Half Black
+{0x720e, 0x3fc6, 0x27D6}, // ⟖, \rightouterjoin, Right Outer Join
+{0x6206, 0x0ca4, 0xDD79'D835}, // U+1D579, 𝕹, \bfrakN, Mathematical Bold Fraktur Capital N
+{0x620b, 0x193c, 0xDF60'D835}, // U+1D760, 𝝠, \bsansLambda, Mathematical Sans-Serif Bold Capital Lamda
+{0x750d, 0x4d0e, 0x2909}, // ⤉, \uparrowbarred, Upwards Arrow With Horizontal Stroke
+{0x7505, 0x4d00, 0x214B}, // ⅋, \upand, Turned Ampersand
+{0x6207, 0x0f10, 0xDF34'D835}, // U+1D734, 𝜴, \biOmega, Mathematical Bold Italic Capital Omega
+{0x760a, 0x4ecb, 0x2B21}, // ⬡, \varhexagon, White Hexagon
+{0x7006, 0x3d05, 0x2AAF}, // ⪯, \preceq, Precedes Above Single-Line Equals Sign
+{0x6405, 0x22c7, 0x22F2}, // ⋲, \disin, Element Of With Long Horizontal Stroke
+{0x6207, 0x15a8, 0xDF48'D835}, // U+1D748, 𝝈, \bisigma, Mathematical Bold Italic Small Sigma
+{0x7304, 0x43b6, 0xDCCB'D835}, // U+1D4CB, 𝓋, \scrv, Mathematical Script Small V
+{0x6207, 0x0f49, 0xDF2E'D835}, // U+1D72E, 𝜮, \biSigma, Mathematical Bold Italic Capital Sigma
+{0x6207, 0x14f9, 0xDE6B'D835}, // U+1D66B, 𝙫, \bisansv, Mathematical Sans-Serif Bold Italic Small V
+{0x650a, 0x244e, 0x266A}, // ♪, \eighthnote, Eighth Note
+{0x7308, 0x481d, 0x2287}, // ⊇, \supseteq, Superset Of Or Equal To
+{0x6906, 0x29fb, 0x2A1A}, // ⨚, \intcup, Integral With Union
+{0x5f04, 0x06fa, 0x1D69}, // ᵩ, \_phi, Greek Subscript Small Letter Phi
+{0x6505, 0x2521, 0x2A66}, // ⩦, \eqdot, Equals Sign With Dot Below
+{0x6505, 0x25ac, 0x2261}, // ≡, \equiv, Identical To
+{0x720d, 0x3e39, 0x22BE}, // ⊾, \rightanglearc, Right Angle With Arc
+{0x6906, 0x2b88, 0xDE2D'D835}, // U+1D62D, 𝘭, \isansl, Mathematical Sans-Serif Italic Small L
+{0x6207, 0x0e33, 0xDEE1'D835}, // U+1D6E1, 𝛡, \bfvarpi, Mathematical Bold Pi Symbol
+{0x6e16, 0x36c7, 0x2B3D}, // ⬽, \nVtwoheadleftarrowtail, Leftwards Two-Headed Arrow With Tail With Double Vertical Stroke
+{0x6102, 0x071d, 0x00E5}, // å, \aa, Latin Small Letter A With Ring Above / Latin Small Letter A Ring
+{0x7005, 0x3c09, 0x0264}, // ɤ, \pbgam, Latin Small Letter Rams Horn / Latin Small Letter Baby Gamma
+{0x6704, 0x2837, 0x2A88}, // ⪈, \gneq, Greater-Than And Single-Line Not Equal To
+{0x620d, 0x12f5, 0xDFA4'D835}, // U+1D7A4, 𝞤, \bisansUpsilon, Mathematical Sans-Serif Bold Italic Capital Upsilon
+{0x6e05, 0x370a, 0x2207}, // ∇, \nabla, Nabla
+{0x6f06, 0x3a99, 0x2230}, // ∰, \oiiint, Volume Integral
+{0x7605, 0x500d, 0x225A}, // ≚, \veeeq, Equiangular To
+{0x6208, 0x10c0, 0x22C0}, // ⋀, \bigwedge, N-Ary Logical And
+{0x6207, 0x1600, 0xDF55'D835}, // U+1D755, 𝝕, \bivarpi, Mathematical Bold Italic Pi Symbol
+{0x7007, 0x3d3a, 0x227E}, // ≾, \precsim, Precedes Or Equivalent To
+{0x770a, 0x5185, 0x0330}, // ̰, \wideutilde, Combining Tilde Below / Non-Spacing Tilde Below
+{0x6308, 0x1e7c, 0x2A44}, // ⩄, \capwedge, Intersection With Logical And
+{0x7005, 0x3d42, 0x2032}, // ′, \prime, Prime
+{0x6e07, 0x3761, 0x2646}, // ♆, \neptune, Neptune
+{0x6906, 0x2b73, 0xDE2A'D835}, // U+1D62A, 𝘪, \isansi, Mathematical Sans-Serif Italic Small I
+{0x6206, 0x1841, 0x22A1}, // ⊡, \boxdot, Squared Dot Operator
 //LaTeX list--Autogenerated -- end of section automatically generated
 };
 
 #if NP2_ENABLE_LATEX_LIKE_EMOJI_INPUT
 //Emoji hash++Autogenerated -- start of section automatically generated
-#define EmojiMinInitialCharacter	'+'
-#define EmojiMaxInitialCharacter	'z'
-
-static const uint32_t EmojiIndexTable[] = {
-0x00010000, 0x00000000, 0x00020001, 0x00000000, 0x00000000, 0x00000000, 0x00040002, 0x00000000, 0x00000000, 0x00000000,
-0x00000000, 0x00000000, 0x00000000, 0x00050004, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x003f0005, 0x00b9003f, 0x014e00b9, 0x0180014e, 0x01a00180, 0x01f501a0,
-0x021c01f5, 0x0261021c, 0x02750261, 0x02820275, 0x02970282, 0x02e10297, 0x033a02e1, 0x035b033a, 0x0381035b, 0x03e60381,
-0x03e703e6, 0x042c03e7, 0x04e1042c, 0x052c04e1, 0x0540052c, 0x054c0540, 0x0587054c, 0x05890587, 0x05900589, 0x05960590,
-};
-
-static const uint16_t EmojiOffsetTable[] = {
-0x0000, 0x0000, 0x0003, 0x0000, 0x0000, 0x0000, 0x0006, 0x0000, 0x0000, 0x0000,
-0x0000, 0x0000, 0x0000, 0x000f, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-0x0000, 0x0000, 0x0000, 0x0000, 0x0015, 0x02af, 0x0818, 0x0df1, 0x1014, 0x117c,
-0x1609, 0x17a0, 0x1b13, 0x1c31, 0x1cad, 0x1d78, 0x2154, 0x255f, 0x26f3, 0x2864,
-0x2cf8, 0x2d01, 0x3043, 0x389b, 0x3bb3, 0x3c64, 0x3cd3, 0x3fa7, 0x3faf, 0x3fe5,
+static const uint16_t EmojiHashSeedTable[] = {
+0x0016, 0x0008, 0x0004, 0x0000, 0x0012, 0x000d, 0x0009, 0x0012, 0x002d, 0x0015,
+0x0045, 0x0001, 0x0000, 0x003e, 0x000c, 0x003a, 0x0000, 0x000d, 0x0000, 0x0001,
+0x0002, 0x001e, 0x0000, 0x0001, 0x0034, 0x002b, 0x001a, 0x000d, 0x0002, 0x0005,
+0x0000, 0x0000, 0x0000, 0x0005, 0x002b, 0x0000, 0x0002, 0x0032, 0x000a, 0x001b,
+0x0014, 0x0006, 0x0009, 0x001b, 0x0021, 0x0000, 0x001a, 0x0025, 0x0006, 0x0000,
+0x0006, 0x0001, 0x0000, 0x0004, 0x0002, 0x003b, 0x000b, 0x0009, 0x0008, 0x0014,
+0x0000, 0x0038, 0x000d, 0x0000, 0x0003, 0x0001, 0x0002, 0x0003, 0x0000, 0x0000,
+0x0003, 0x0001, 0x0000, 0x0003, 0x003f, 0x0021, 0x000c, 0x0004, 0x0023, 0x0003,
+0x000a, 0x0003, 0x0090, 0x0004, 0x0025, 0x0016, 0x000f, 0x0003, 0x0000, 0x0000,
+0x0001, 0x0018, 0x0000, 0x0040, 0x0001, 0x0005, 0x0016, 0x004b, 0x0025, 0x0000,
+0x001b, 0x0012, 0x0000, 0x0010, 0x000b, 0x0002, 0x000d, 0x0000, 0x000c, 0x0000,
+0x0005, 0x0001, 0x000c, 0x0001, 0x0003, 0x0011, 0x0000, 0x0017, 0x0013, 0x0044,
+0x000c, 0x0003, 0x0003, 0x0013, 0x0032, 0x008a, 0x0015, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0010, 0x0058, 0x0000, 0x000e, 0x000c, 0x0003, 0x0059, 0x0028, 0x0001,
+0x0040, 0x0000, 0x000a, 0x0001, 0x0001, 0x0009, 0x000a, 0x005d, 0x003d, 0x000c,
+0x0001, 0x0000, 0x0001, 0x0003, 0x0008, 0x0000, 0x0000, 0x0001, 0x0001, 0x0037,
+0x0037, 0x005f, 0x0000, 0x0001, 0x0013, 0x0000, 0x000c, 0x0053, 0x0003, 0x0000,
+0x0012, 0x0001, 0x0000, 0x0000, 0x0004, 0x0003, 0x0016, 0x0005, 0x0007, 0x0021,
+0x000f, 0x0019, 0x0008, 0x0000, 0x0025, 0x0033, 0x000d, 0x0024, 0x0043, 0x0033,
+0x0011, 0x0020, 0x00ba, 0x0020, 0x001f, 0x0006, 0x0001, 0x0006, 0x000f, 0x0002,
+0x0002, 0x000a, 0x0002, 0x0004, 0x0010, 0x0042, 0x000f, 0x0004, 0x0038, 0x003d,
+0x0004, 0x002a, 0x00ce, 0x0010, 0x001b, 0x001d, 0x0001, 0x0083, 0x004c, 0x0000,
+0x0037, 0x0011, 0x0007, 0x001d, 0x0012, 0x0004, 0x0033, 0x001b, 0x004f, 0x0002,
+0x0000, 0x0007, 0x0000, 0x0000, 0x0003, 0x0043, 0x001f, 0x000a, 0x006f, 0x00ac,
+0x0007, 0x0012, 0x000f, 0x0002, 0x0039, 0x000b, 0x0051, 0x0002, 0x0084, 0x0004,
+0x004f, 0x0000, 0x0000, 0x0000, 0x0050, 0x0006, 0x0032, 0x0000, 0x0009, 0x0001,
+0x000f, 0x0008, 0x000b, 0x0028, 0x0028, 0x0037, 0x000b, 0x000b, 0x000c, 0x0008,
+0x0041, 0x007c, 0x001c, 0x0000, 0x001e, 0x0000, 0x0016, 0x002d, 0x012a, 0x0130,
+0x0007, 0x0002, 0x0000, 0x0024, 0x000a, 0x003d, 0x000b, 0x0043, 0x0000, 0x0039,
+0x0045, 0x0000, 0x0005, 0x0006, 0x0005, 0x0005, 0x0009, 0x0005, 0x00da, 0x00dd,
+0x000b, 0x0026, 0x00af, 0x018f, 0x0026, 0x0002, 0x0009, 0x0006, 0x0000, 0x0008,
+0x0005, 0x0003, 0x001b, 0x0001, 0x0018, 0x0051, 0x0003, 0x0001, 0x0005, 0x00a5,
+0x00d8, 0x0008, 0x0007, 0x0046, 0x0006, 0x004e, 0x0001, 0x0007, 0x0040, 0x00f5,
+0x0038, 0x0002, 0x01ac, 0x0000, 0x00af, 0x008c, 0x00be, 0x00e1, 0x0001, 0x0007,
+0x0000, 0x0003, 0x010f, 0x000c, 0x0018, 0x0000, 0x001e, 0x0012, 0x0004, 0x0000,
+0x0011, 0x0099, 0x0044, 0x0000, 0x0017, 0x0010, 0x0044, 0x0000, 0x0053, 0x008b,
+0x0057, 0x000d, 0x0042, 0x0052, 0x0000, 0x005e, 0x0006, 0x0050, 0x0113, 0x0000,
+0x0021, 0x0002, 0x0002, 0x001d, 0x000a, 0x0000, 0x0012, 0x0000, 0x0031, 0x0024,
+0x0000, 0x0016, 0x0005, 0x002b, 0x0009, 0x0000, 0x0002, 0x002c, 0x0004, 0x0025,
+0x0060, 0x0272, 0x0024, 0x0023, 0x0005, 0x0047, 0x0000, 0x03f8, 0x00c2, 0x0057,
+0x0017, 0x003c, 0x0005, 0x00a0, 0x001a, 0x0019, 0x0071, 0x0033, 0x0015, 0x0025,
+0x0204, 0x0000, 0x000d, 0x0005, 0x0005, 0x0000, 0x0003, 0x0082, 0x0001, 0x0021,
+0x0033, 0x0006, 0x0102, 0x04fc, 0x0085, 0x0000, 0x00a7, 0x0000, 0x004f, 0x0024,
+0x0042, 0x0008, 0x0054, 0x0005, 0x0014, 0x0428, 0x0044, 0x0000, 0x00a0, 0x0193,
+0x0002, 0x005f, 0x0016, 0x0001, 0x0000, 0x0002, 0x006b, 0x000c, 0x0000, 0x0000,
+0x019e, 0x0001, 0x010e, 0x005c, 0x0004, 0x0026, 0x007e, 0x0072, 0x0016, 0x002d,
+0x0020, 0x000c, 0x0015, 0x0132, 0x0006, 0x0018, 0x00b5, 0x0007, 0x0004, 0x00bc,
+0x0086, 0x01d2, 0x01be, 0x00fb, 0x02f6, 0x0097,
 };
 //Emoji hash--Autogenerated -- end of section automatically generated
 
-static const uint32_t EmojiInputSequenceList[] = {
+static const InputSequence EmojiInputSequenceList[] = {
 //Emoji list++Autogenerated -- start of section automatically generated
-0xfa268403, // U+1F44D 👍, \:+1:, Thumbs Up Sign
-0xfa270403, // U+1F44E 👎, \:-1:, Thumbs Down Sign
-0xfa57b3c4, // U+1F4AF 💯, \:100:, Hundred Points Symbol
-0xfa9164c5, // U+1F522 🔢, \:1234:, Input Symbol For Numbers
-0xf9d8f2c6, // U+1F3B1 🎱, \:8ball:, Billiards
-0xf8b80002, // U+1F170 🅰, \:a:, Negative Squared Latin Capital Letter A
-0xf8c70043, // U+1F18E 🆎, \:ab:, Negative Squared Ab
-0xfcf70487, // U+1F9EE 🧮, \:abacus:, Abacus
-0xfa925084, // U+1F524 🔤, \:abc:, Input Symbol For Latin Letters
-0xfa90e0c5, // U+1F521 🔡, \:abcd:, Input Symbol For Latin Small Letters
-0xf928b4c7, // U+1F251 🉑, \:accept:, Circled Ideograph Accept
-0xfd4ba34a, // U+1FA97 🪗, \:accordion:, Accordion
-0xfd3ca111, // U+1FA79 🩹, \:adhesive_bandage:, Adhesive Bandage
-0xf9cff492, // U+1F39F 🎟, \:admission_tickets:, Admission Tickets
-0xfce8f4c6, // U+1F9D1 🧑, \:adult:, Adult
-0xfb50c60f, // U+1F6A1 🚡, \:aerial_tramway:, Aerial Tramway
-0x13841109, // U+02708 ✈, \:airplane:, Airplane
-0xfb761192, // U+1F6EC 🛬, \:airplane_arriving:, Airplane Arriving
-0xfb75d113, // U+1F6EB 🛫, \:airplane_departure:, Airplane Departure
-0x11f8628c, // U+023F0 ⏰, \:alarm_clock:, Alarm Clock
-0x134bc088, // U+02697 ⚗, \:alembic:, Alembic
-0xfa3e8346, // U+1F47D 👽, \:alien:, Extraterrestrial Alien
-0xfb48e10a, // U+1F691 🚑, \:ambulance:, Ambulance
-0xf9fd5008, // U+1F3FA 🏺, \:amphora:, Amphora
-0xfd6054d1, // U+1FAC0 🫀, \:anatomical_heart:, Anatomical Heart
-0x1349a447, // U+02693 ⚓, \:anchor:, Anchor
-0xfa3e02c6, // U+1F47C 👼, \:angel:, Baby Angel
-0xfa510446, // U+1F4A2 💢, \:anger:, Anger Symbol
-0xfb105606, // U+1F620 😠, \:angry:, Angry Face
-0xfb1380ca, // U+1F627 😧, \:anguished:, Anguished Face
-0xfa0e14c4, // U+1F41C 🐜, \:ant:, Ant
-0xf9a77106, // U+1F34E 🍎, \:apple:, Red Apple
-0x13290489, // U+02652 ♒, \:aquarius:, Aquarius
-0x13240486, // U+02648 ♈, \:aries:, Aries
-0x12e050cf, // U+025C0 ◀, \:arrow_backward:, Black Left-Pointing Triangle
-0x11f62352, // U+023EC ⏬, \:arrow_double_down:, Black Down-Pointing Double Triangle
-0x11f583d0, // U+023EB ⏫, \:arrow_double_up:, Black Up-Pointing Double Triangle
-0x1583a34b, // U+02B07 ⬇, \:arrow_down:, Downwards Black Arrow
-0xfa9ef2d1, // U+1F53D 🔽, \:arrow_down_small:, Down-Pointing Small Red Triangle
-0x12db50ce, // U+025B6 ▶, \:arrow_forward:, Black Right-Pointing Triangle
-0x149aa353, // U+02935 ⤵, \:arrow_heading_down:, Arrow Pointing Rightwards Then Curving Downwards
-0x149a03d1, // U+02934 ⤴, \:arrow_heading_up:, Arrow Pointing Rightwards Then Curving Upwards
-0x158294cb, // U+02B05 ⬅, \:arrow_left:, Leftwards Black Arrow
-0x10cc94d1, // U+02199 ↙, \:arrow_lower_left:, South West Arrow
-0x10cc34d2, // U+02198 ↘, \:arrow_lower_right:, South East Arrow
-0x13d0b4cc, // U+027A1 ➡, \:arrow_right:, Black Rightwards Arrow
-0x10d52291, // U+021AA ↪, \:arrow_right_hook:, Rightwards Arrow With Hook
-0x158303c9, // U+02B06 ⬆, \:arrow_up:, Upwards Black Arrow
-0x10caa34e, // U+02195 ↕, \:arrow_up_down:, Up Down Arrow
-0xfa9e72cf, // U+1F53C 🔼, \:arrow_up_small:, Up-Pointing Small Red Triangle
-0x10cb14d1, // U+02196 ↖, \:arrow_upper_left:, North West Arrow
-0x10cbb4d2, // U+02197 ↗, \:arrow_upper_right:, North East Arrow
-0xfa81e111, // U+1F503 🔃, \:arrows_clockwise:, Clockwise Downwards And Upwards Open Circle Arrows
-0xfa826118, // U+1F504 🔄, \:arrows_counterclockwise:, Anticlockwise Downwards And Upwards Open Circle Arrows
-0xf9d454c4, // U+1F3A8 🎨, \:art:, Artist Palette
-0xfb4dd612, // U+1F69B 🚛, \:articulated_lorry:, Articulated Lorry
-0xfb1900cb, // U+1F632 😲, \:astonished:, Astonished Face
-0xfa2fa10e, // U+1F45F 👟, \:athletic_shoe:, Athletic Shoe
-0xf9f3f304, // U+1F3E7 🏧, \:atm:, Automated Teller Machine
-0x134da2cc, // U+0269B ⚛, \:atom_symbol:, Atom Symbol
-0xfb7d458e, // U+1F6FA 🛺, \:auto_rickshaw:, Auto Rickshaw
-0xfca8f388, // U+1F951 🥑, \:avocado:, Avocado
-0xfd49b104, // U+1FA93 🪓, \:axe:, Axe
-0xf8b88042, // U+1F171 🅱, \:b:, Negative Squared Latin Capital Letter B
-0xfa3b5605, // U+1F476 👶, \:baby:, Baby
-0xf9be710c, // U+1F37C 🍼, \:baby_bottle:, Baby Bottle
-0xfa12628b, // U+1F424 🐤, \:baby_chick:, Baby Chick
-0xfb5e22cc, // U+1F6BC 🚼, \:baby_symbol:, Baby Symbol
-0xfa8ce285, // U+1F519 🔙, \:back:, Back With Leftwards Arrow Above
-0xfca9a346, // U+1F953 🥓, \:bacon:, Bacon
-0xfcd08447, // U+1F9A1 🦡, \:badger:, Badger
-0xf9fc62a2, // U+1F3F8 🏸, \:badminton_racquet_and_shuttlecock:, Badminton Racquet And Shuttlecock
-0xfcb782c6, // U+1F96F 🥯, \:bagel:, Bagel
-0xfb62430e, // U+1F6C4 🛄, \:baggage_claim:, Baggage Claim
-0xfcab40cf, // U+1F956 🥖, \:baguette_bread:, Baguette Bread
-0xfd38048d, // U+1FA70 🩰, \:ballet_shoes:, Ballet Shoes
-0xf9c42348, // U+1F388 🎈, \:balloon:, Balloon
-0xfaf9a4d7, // U+1F5F3 🗳, \:ballot_box_with_ballot:, Ballot Box With Ballot
-0x1308e296, // U+02611 ☑, \:ballot_box_with_check:, Ballot Box With Check
-0xf9c6a387, // U+1F38D 🎍, \:bamboo:, Pine Decoration
-0xf9a61007, // U+1F34C 🍌, \:banana:, Banana
-0x101e1189, // U+0203C ‼, \:bangbang:, Double Exclamation Mark
-0xfd4ad386, // U+1FA95 🪕, \:banjo:, Banjo
-0xf9f31285, // U+1F3E6 🏦, \:bank:, Bank
-0xfa6554ca, // U+1F4CA 📊, \:bar_chart:, Bar Chart
-0xfa440447, // U+1F488 💈, \:barber:, Barber Pole
-0xf992960d, // U+1F325 🌥, \:barely_sunny:, Sun Behind Large Cloud
-0x135f72c9, // U+026BE ⚾, \:baseball:, Baseball
-0xfcfd04c7, // U+1F9FA 🧺, \:basket:, Basket
-0xf9e072cb, // U+1F3C0 🏀, \:basketball:, Basketball And Hoop
-0xfcc3c4c4, // U+1F987 🦇, \:bat:, Bat
-0xfb6071c5, // U+1F6C0 🛀, \:bath:, Bath
-0xfb608048, // U+1F6C1 🛁, \:bathtub:, Bathtub
-0xfa85d608, // U+1F50B 🔋, \:battery:, Battery
-0xf9eb7014, // U+1F3D6 🏖, \:beach_with_umbrella:, Beach With Umbrella
-0xfd6c1486, // U+1FAD8 🫘, \:beans:, Beans
-0xfa1dc445, // U+1F43B 🐻, \:bear:, Bear Face
-0xfcea234f, // U+1F9D4 🧔, \:bearded_person:, Bearded Person
-0xfcd58447, // U+1F9AB 🦫, \:beaver:, Beaver
-0xfb6780c4, // U+1F6CF 🛏, \:bed:, Bed
-0xfa0e8104, // U+1F41D 🐝, \:bee:, Honeybee
-0xf9bd0445, // U+1F37A 🍺, \:beer:, Beer Mug
-0xf9bdd486, // U+1F37B 🍻, \:beers:, Clinking Beer Mugs
-0xfd597107, // U+1FAB2 🪲, \:beetle:, Beetle
-0xfa980449, // U+1F530 🔰, \:beginner:, Japanese Symbol For Beginner
-0xfa8a72c5, // U+1F514 🔔, \:bell:, Bell
-0xfd68844c, // U+1FAD1 🫑, \:bell_pepper:, Bell Pepper
-0xfb6772cd, // U+1F6CE 🛎, \:bellhop_bell:, Bellhop Bell
-0xf9b8f386, // U+1F371 🍱, \:bento:, Bento Box
-0xfce1a5cd, // U+1F9C3 🧃, \:beverage_box:, Beverage Box
-0xfb5a64ca, // U+1F6B4 🚴, \:bicyclist:, Bicyclist
-0xfb596105, // U+1F6B2 🚲, \:bike:, Bicycle
-0xfa2c9207, // U+1F459 👙, \:bikini:, Bikini
-0xfcf143cb, // U+1F9E2 🧢, \:billed_cap:, Billed Cap
-0x1311a34f, // U+02623 ☣, \:biohazard_sign:, Biohazard
-0xfa1350c5, // U+1F426 🐦, \:bird:, Bird
-0xf9c14609, // U+1F382 🎂, \:birthday:, Birthday Cake
-0xfcd62346, // U+1F9AC 🦬, \:bison:, Bison
-0xfd7343cb, // U+1FAE6 🫦, \:biting_lip:, Biting Lip
-0x1355f10d, // U+026AB ⚫, \:black_circle:, Medium Black Circle
-0x11fd50d8, // U+023FA ⏺, \:black_circle_for_record:, Record Button
-0xfad254cc, // U+1F5A4 🖤, \:black_heart:, Black Heart
-0xf867844c, // U+1F0CF 🃏, \:black_joker:, Playing Card Black Joker
-0x158dd113, // U+02B1B ⬛, \:black_large_square:, Black Large Square
-0x11f74476, // U+023EE ⏮, \:black_left_pointing_double_triangle_with_vertical_bar:, Last Track Button
-0x12ff511a, // U+025FE ◾, \:black_medium_small_square:, Black Medium Small Square
-0x12fe5114, // U+025FC ◼, \:black_medium_square:, Black Medium Square
-0x1389404a, // U+02712 ✒, \:black_nib:, Black Nib
-0x11f6c477, // U+023ED ⏭, \:black_right_pointing_double_triangle_with_vertical_bar:, Next Track Button
-0x11f7c477, // U+023EF ⏯, \:black_right_pointing_triangle_with_double_vertical_bar:, Play Or Pause Button
-0x12d55113, // U+025AA ▪, \:black_small_square:, Black Small Square
-0xfa992354, // U+1F532 🔲, \:black_square_button:, Black Square Button
-0x11fca3d6, // U+023F9 ⏹, \:black_square_for_stop:, Stop Button
-0xf99e2308, // U+1F33C 🌼, \:blossom:, Blossom
-0xfa10e1c9, // U+1F421 🐡, \:blowfish:, Blowfish
-0xfa6c228a, // U+1F4D8 📘, \:blue_book:, Blue Book
-0xfb4cc449, // U+1F699 🚙, \:blue_car:, Recreational Vehicle
-0xfa4cd4cb, // U+1F499 💙, \:blue_heart:, Blue Heart
-0xfd68048c, // U+1FAD0 🫐, \:blueberries:, Blueberries
-0xfb0561c6, // U+1F60A 😊, \:blush:, Smiling Face With Smiling Eyes
-0xfa0bc445, // U+1F417 🐗, \:boar:, Boar
-0x137ac4c5, // U+026F5 ⛵, \:boat:, Sailboat
-0xfa518045, // U+1F4A3 💣, \:bomb:, Bomb
-0xfcda1105, // U+1F9B4 🦴, \:bone:, Bone
-0xfa6b2285, // U+1F4D6 📖, \:book:, Open Book
-0xfa8b5289, // U+1F516 🔖, \:bookmark:, Bookmark
-0xfa68d48e, // U+1F4D1 📑, \:bookmark_tabs:, Bookmark Tabs
-0xfa6d6486, // U+1F4DA 📚, \:books:, Books
-0xfa52a305, // U+1F4A5 💥, \:boom:, Collision Symbol
-0xfd41918a, // U+1FA83 🪃, \:boomerang:, Boomerang
-0xfa3124c5, // U+1F462 👢, \:boot:, Womans Boots
-0xfa4804c8, // U+1F490 💐, \:bouquet:, Bouquet
-0xfb23a584, // U+1F647 🙇, \:bow:, Person Bowing Deeply
-0xf9fca58e, // U+1F3F9 🏹, \:bow_and_arrow:, Bow And Arrow
-0xfcb1a350, // U+1F963 🥣, \:bowl_with_spoon:, Bowl With Spoon
-0xf9d99188, // U+1F3B3 🎳, \:bowling:, Bowling
-0xfca5110d, // U+1F94A 🥊, \:boxing_glove:, Boxing Glove
-0xfa332604, // U+1F466 👦, \:boy:, Boy
-0xfcf04346, // U+1F9E0 🧠, \:brain:, Brain
-0xf9af40c6, // U+1F35E 🍞, \:bread:, Bread
-0xfc98918f, // U+1F931 🤱, \:breast-feeding:, Breast-Feeding
-0xfcf8e487, // U+1F9F1 🧱, \:bricks:, Brick
-0xfa3842d0, // U+1F470 👰, \:bride_with_veil:, Bride With Veil
-0xf984b4d0, // U+1F309 🌉, \:bridge_at_night:, Bridge At Night
-0xfa5e610a, // U+1F4BC 💼, \:briefcase:, Briefcase
-0xfd391487, // U+1FA72 🩲, \:briefs:, Briefs
-0xfcb37209, // U+1F966 🥦, \:broccoli:, Broccoli
-0xfa4a54cd, // U+1F494 💔, \:broken_heart:, Broken Heart
-0xfcfca306, // U+1F9F9 🧹, \:broom:, Broom
-0xfc8754cc, // U+1F90E 🤎, \:brown_heart:, Brown Heart
-0xfce5800b, // U+1F9CB 🧋, \:bubble_tea:, Bubble Tea
-0xfd738488, // U+1FAE7 🫧, \:bubbles:, Bubbles
-0xfd5184c7, // U+1FAA3 🪣, \:bucket:, Bucket
-0xfa0d8184, // U+1F41B 🐛, \:bug:, Bug
-0xf9eba356, // U+1F3D7 🏗, \:building_construction:, Building Construction
-0xfa50f045, // U+1F4A1 💡, \:bulb:, Electric Light Bulb
-0xfb4294d2, // U+1F685 🚅, \:bullettrain_front:, High-Speed Train With Bullet Nose
-0xfb427111, // U+1F684 🚄, \:bullettrain_side:, High-Speed Train
-0xf997f388, // U+1F32F 🌯, \:burrito:, Burrito
-0xfb460484, // U+1F68C 🚌, \:bus:, Bus
-0xfb47a3c8, // U+1F68F 🚏, \:busstop:, Bus Stop
-0xfa327113, // U+1F464 👤, \:bust_in_silhouette:, Bust In Silhouette
-0xfa32f114, // U+1F465 👥, \:busts_in_silhouette:, Busts In Silhouette
-0xfce40447, // U+1F9C8 🧈, \:butter:, Butter
-0xfcc5f60a, // U+1F98B 🦋, \:butterfly:, Butterfly
-0xf99a8487, // U+1F335 🌵, \:cactus:, Cactus
-0xf9b86105, // U+1F370 🍰, \:cake:, Shortcake
-0xfa634449, // U+1F4C6 📆, \:calendar:, Tear-Off Calendar
-0xfc8c90cd, // U+1F919 🤙, \:call_me_hand:, Call Me Hand
-0xfa791188, // U+1F4F2 📲, \:calling:, Mobile Phone With Rightwards Arrow At Left
-0xfa1582c6, // U+1F42B 🐫, \:camel:, Bactrian Camel
-0xfa7bd007, // U+1F4F7 📷, \:camera:, Camera
-0xfa7c61d2, // U+1F4F8 📸, \:camera_with_flash:, Camera With Flash
-0xf9ea9188, // U+1F3D5 🏕, \:camping:, Camping
-0x13258447, // U+0264B ♋, \:cancer:, Cancer
-0xfab7f107, // U+1F56F 🕯, \:candle:, Candle
-0xf9b67606, // U+1F36C 🍬, \:candy:, Candy
-0xfcb5a0cc, // U+1F96B 🥫, \:canned_food:, Canned Food
-0xfb7b2106, // U+1F6F6 🛶, \:canoe:, Canoe
-0xfa9060cd, // U+1F520 🔠, \:capital_abcd:, Input Symbol For Latin Capital Letters
-0x1328d34a, // U+02651 ♑, \:capricorn:, Capricorn
-0xfb4bc444, // U+1F697 🚗, \:car:, Automobile
-0xfae1a5ce, // U+1F5C3 🗃, \:card_file_box:, Card File Box
-0xfa6385cb, // U+1F4C7 📇, \:card_index:, Card Index
-0xfae15494, // U+1F5C2 🗂, \:card_index_dividers:, Card Index Dividers
-0xf9d0610f, // U+1F3A0 🎠, \:carousel_horse:, Carousel Horse
-0xfd4d458e, // U+1FA9A 🪚, \:carpentry_saw:, Carpentry Saw
-0xfcaaa4c7, // U+1F955 🥕, \:carrot:, Carrot
-0xfa18c4c4, // U+1F431 🐱, \:cat:, Cat Face
-0xfa047445, // U+1F408 🐈, \:cat2:, Cat
-0xfa5f80c3, // U+1F4BF 💿, \:cd:, Optical Disc
-0x13699487, // U+026D3 ⛓, \:chains:, Chains
-0xfd48c446, // U+1FA91 🪑, \:chair:, Chair
-0xf9bf110a, // U+1F37E 🍾, \:champagne:, Bottle With Popping Cork
-0xfa5cd4c6, // U+1F4B9 💹, \:chart:, Chart With Upwards Trend And Yen Sign
-0xfa6490db, // U+1F4C9 📉, \:chart_with_downwards_trend:, Chart With Downwards Trend
-0xfa6410d9, // U+1F4C8 📈, \:chart_with_upwards_trend:, Chart With Upwards Trend
-0xf9e0c18f, // U+1F3C1 🏁, \:checkered_flag:, Chequered Flag
-0xfce0210d, // U+1F9C0 🧀, \:cheese_wedge:, Cheese Wedge
-0xf9a90489, // U+1F352 🍒, \:cherries:, Cherries
-0xf99c230f, // U+1F338 🌸, \:cherry_blossom:, Cherry Blossom
-0x132fa34b, // U+0265F ♟, \:chess_pawn:, Chess Pawn
-0xf99804c9, // U+1F330 🌰, \:chestnut:, Chestnut
-0xfa0a0348, // U+1F414 🐔, \:chicken:, Chicken
-0xfce970c6, // U+1F9D2 🧒, \:child:, Child
-0xfb5c1192, // U+1F6B8 🚸, \:children_crossing:, Children Crossing
-0xfa1f9289, // U+1F43F 🐿, \:chipmunk:, Chipmunk
-0xf9b5c44e, // U+1F36B 🍫, \:chocolate_bar:, Chocolate Bar
-0xfcb1648b, // U+1F962 🥢, \:chopsticks:, Chopsticks
-0xf9c2010f, // U+1F384 🎄, \:christmas_tree:, Christmas Tree
-0x137561c7, // U+026EA ⛪, \:church:, Church
-0xf9d30007, // U+1F3A6 🎦, \:cinema:, Cinema
-0xf9d514cc, // U+1F3AA 🎪, \:circus_tent:, Circus Tent
-0xf983e10d, // U+1F307 🌇, \:city_sunrise:, Sunset Over Buildings
-0xf98304cc, // U+1F306 🌆, \:city_sunset:, Cityscape At Dusk
-0xf9ecb10a, // U+1F3D9 🏙, \:cityscape:, Cityscape
-0xf8c882c3, // U+1F191 🆑, \:cl:, Squared Cl
-0xfa27c3c5, // U+1F44F 👏, \:clap:, Clapping Hands Sign
-0xf9d60448, // U+1F3AC 🎬, \:clapper:, Clapper Board
-0xf9ed9193, // U+1F3DB 🏛, \:classical_building:, Classical Building
-0xfca10491, // U+1F942 🥂, \:clinking_glasses:, Clinking Glasses
-0xfa65d0ca, // U+1F4CB 📋, \:clipboard:, Clipboard
-0xfaa86407, // U+1F550 🕐, \:clock1:, Clock Face One Oclock
-0xfaacc3c8, // U+1F559 🕙, \:clock10:, Clock Face Ten Oclock
-0xfab2e3ca, // U+1F565 🕥, \:clock1030:, Clock Face Ten-Thirty
-0xfaad4408, // U+1F55A 🕚, \:clock11:, Clock Face Eleven Oclock
-0xfab363ca, // U+1F566 🕦, \:clock1130:, Clock Face Eleven-Thirty
-0xfaadc448, // U+1F55B 🕛, \:clock12:, Clock Face Twelve Oclock
-0xfab3e3ca, // U+1F567 🕧, \:clock1230:, Clock Face Twelve-Thirty
-0xfaae63c9, // U+1F55C 🕜, \:clock130:, Clock Face One-Thirty
-0xfaa8e447, // U+1F551 🕑, \:clock2:, Clock Face Two Oclock
-0xfaaee3c9, // U+1F55D 🕝, \:clock230:, Clock Face Two-Thirty
-0xfaa96487, // U+1F552 🕒, \:clock3:, Clock Face Three Oclock
-0xfaaf63c9, // U+1F55E 🕞, \:clock330:, Clock Face Three-Thirty
-0xfaa9e4c7, // U+1F553 🕓, \:clock4:, Clock Face Four Oclock
-0xfaafe3c9, // U+1F55F 🕟, \:clock430:, Clock Face Four-Thirty
-0xfaaa6507, // U+1F554 🕔, \:clock5:, Clock Face Five Oclock
-0xfab063c9, // U+1F560 🕠, \:clock530:, Clock Face Five-Thirty
-0xfaaae547, // U+1F555 🕕, \:clock6:, Clock Face Six Oclock
-0xfab0e3c9, // U+1F561 🕡, \:clock630:, Clock Face Six-Thirty
-0xfaab6587, // U+1F556 🕖, \:clock7:, Clock Face Seven Oclock
-0xfab163c9, // U+1F562 🕢, \:clock730:, Clock Face Seven-Thirty
-0xfaabe5c7, // U+1F557 🕗, \:clock8:, Clock Face Eight Oclock
-0xfab1e3c9, // U+1F563 🕣, \:clock830:, Clock Face Eight-Thirty
-0xfaac6607, // U+1F558 🕘, \:clock9:, Clock Face Nine Oclock
-0xfab263c9, // U+1F564 🕤, \:clock930:, Clock Face Nine-Thirty
-0xfa6aa28c, // U+1F4D5 📕, \:closed_book:, Closed Book
-0xfa880615, // U+1F510 🔐, \:closed_lock_with_key:, Closed Lock With Key
-0xf9817010, // U+1F302 🌂, \:closed_umbrella:, Closed Umbrella
-0x130080c6, // U+02601 ☁, \:cloud:, Cloud
-0xfc90e10b, // U+1F921 🤡, \:clown_face:, Clown Face
-0x1331d486, // U+02663 ♣, \:clubs:, Black Club Suit
-0xfcf2c4c5, // U+1F9E5 🧥, \:coat:, Coat
-0xfd59e1ca, // U+1FAB3 🪳, \:cockroach:, Cockroach
-0xf9bc42c9, // U+1F378 🍸, \:cocktail:, Cocktail Glass
-0xfcb284c8, // U+1F965 🥥, \:coconut:, Coconut
-0x130a8107, // U+02615 ☕, \:coffee:, Hot Beverage
-0x13584347, // U+026B0 ⚰, \:coffin:, Coffin
-0xfd4cc345, // U+1FA99 🪙, \:coin:, Coin
-0xfcbb610a, // U+1F976 🥶, \:cold_face:, Freezing Face
-0xfb1844cb, // U+1F630 😰, \:cold_sweat:, Face With Open Mouth And Cold Sweat
-0xfa52a34a, // U+1F4A5 💥, \:collision:, Collision Symbol
-0x130204c6, // U+02604 ☄, \:comet:, Comet
-0xfcf6e488, // U+1F9ED 🧭, \:compass:, Compass
-0xfaee234c, // U+1F5DC 🗜, \:compression:, Clamp
-0xfa5d8449, // U+1F4BB 💻, \:computer:, Personal Computer
-0xf9c572ce, // U+1F38A 🎊, \:confetti_ball:, Confetti Ball
-0xfb0b00cb, // U+1F616 😖, \:confounded:, Confounded Face
-0xfb0a80c9, // U+1F615 😕, \:confused:, Confused Face
-0x194b9490, // U+03297 ㊗, \:congratulations:, Circled Ideograph Congratulation
-0xfb53a34d, // U+1F6A7 🚧, \:construction:, Construction Sign
-0xfa3b8454, // U+1F477 👷, \:construction_worker:, Construction Worker
-0xf9cdd48e, // U+1F39B 🎛, \:control_knobs:, Control Knobs
-0xf9f55112, // U+1F3EA 🏪, \:convenience_store:, Convenience Store
-0xf9b54107, // U+1F36A 🍪, \:cookie:, Cookie
-0xf9b99188, // U+1F373 🍳, \:cooking:, Cooking
-0xf8c922c5, // U+1F192 🆒, \:cool:, Squared Cool
-0xfa3723c4, // U+1F46E 👮, \:cop:, Police Officer
-0x0054b4ca, // U+000A9 ©, \:copyright:, Copyright Sign
-0xfd5c42c6, // U+1FAB8 🪸, \:coral:, Coral
-0xf99ed345, // U+1F33D 🌽, \:corn:, Ear Of Maize
-0xfb6583cf, // U+1F6CB 🛋, \:couch_and_lamp:, Couch And Lamp
-0xfa35f107, // U+1F46B 👫, \:couple:, Man And Woman Holding Hands
-0xfa48d4d2, // U+1F491 💑, \:couple_with_heart:, Couple With Heart
-0xfa47e48b, // U+1F48F 💏, \:couplekiss:, Kiss
-0xfa172584, // U+1F42E 🐮, \:cow:, Cow Face
-0xfa022445, // U+1F404 🐄, \:cow2:, Cow
-0xfcc04045, // U+1F980 🦀, \:crab:, Crab
-0xfa59d0cc, // U+1F4B3 💳, \:credit_card:, Credit Card
-0xf98ca34e, // U+1F319 🌙, \:crescent_moon:, Crescent Moon
-0xfccb84c8, // U+1F997 🦗, \:cricket:, Cricket
-0xf9e7f2d5, // U+1F3CF 🏏, \:cricket_bat_and_ball:, Cricket Bat And Ball
-0xfa05710a, // U+1F40A 🐊, \:crocodile:, Crocodile
-0xfca814ca, // U+1F950 🥐, \:croissant:, Croissant
-0xfc8f5490, // U+1F91E 🤞, \:crossed_fingers:, Hand With Index And Middle Fingers Crossed
-0xf9c6248e, // U+1F38C 🎌, \:crossed_flags:, Crossed Flags
-0x134a748f, // U+02694 ⚔, \:crossed_swords:, Crossed Swords
-0xfa28a346, // U+1F451 👑, \:crown:, Crown
-0xfd3e61c7, // U+1FA7C 🩼, \:crutch:, Crutch
-0xfb115604, // U+1F622 😢, \:cry:, Crying Face
-0xfb1fe110, // U+1F63F 😿, \:crying_cat_face:, Crying Cat Face
-0xfa9772cd, // U+1F52E 🔮, \:crystal_ball:, Crystal Ball
-0xfca90449, // U+1F952 🥒, \:cucumber:, Cucumber
-0xfcb2458f, // U+1F964 🥤, \:cup_with_straw:, Cup With Straw
-0xfce0e108, // U+1F9C1 🧁, \:cupcake:, Cupcake
-0xfa4c40c6, // U+1F498 💘, \:cupid:, Heart With Arrow
-0xfca6110e, // U+1F94C 🥌, \:curling_stone:, Curling Stone
-0x13d823cb, // U+027B0 ➰, \:curly_loop:, Curly Loop
-0xfa58a112, // U+1F4B1 💱, \:currency_exchange:, Currency Exchange
-0xf9add606, // U+1F35B 🍛, \:curry:, Curry And Rice
-0xf9b750c8, // U+1F36E 🍮, \:custard:, Custard
-0xfb618488, // U+1F6C3 🛃, \:customs:, Customs
-0xfcb4c4cc, // U+1F969 🥩, \:cut_of_meat:, Cut Of Meat
-0xf9801108, // U+1F300 🌀, \:cyclone:, Cyclone
-0xfaf0910d, // U+1F5E1 🗡, \:dagger_knife:, Dagger
-0xfa418447, // U+1F483 💃, \:dancer:, Dancer
-0xfa37d488, // U+1F46F 👯, \:dancers:, Woman With Bunny Ears
-0xf9b0a386, // U+1F361 🍡, \:dango:, Dango
-0xfabb0490, // U+1F576 🕶, \:dark_sunglasses:, Sunglasses
-0xf9d7d4c5, // U+1F3AF 🎯, \:dart:, Direct Hit
-0xfa5461c5, // U+1F4A8 💨, \:dash:, Dash Symbol
-0xfa62f105, // U+1F4C5 📅, \:date:, Calendar
-0xfce7a34c, // U+1F9CF 🧏, \:deaf_person:, Deaf Person
-0xf999810f, // U+1F333 🌳, \:deciduous_tree:, Deciduous Tree
-0xfcc60445, // U+1F98C 🦌, \:deer:, Deer
-0xf9f65111, // U+1F3EC 🏬, \:department_store:, Department Store
-0xf9ed1198, // U+1F3DA 🏚, \:derelict_house_building:, Derelict House
-0xf9ee54c7, // U+1F3DC 🏜, \:desert:, Desert
-0xf9ee90ce, // U+1F3DD 🏝, \:desert_island:, Desert Island
-0xfad28451, // U+1F5A5 🖥, \:desktop_computer:, Desktop Computer
-0xfa507120, // U+1F4A0 💠, \:diamond_shape_with_a_dot_inside:, Diamond Shape With A Dot Inside
-0x13337489, // U+02666 ♦, \:diamonds:, Black Diamond Suit
-0xfb0f00cd, // U+1F61E 😞, \:disappointed:, Disappointed Face
-0xfb1280d6, // U+1F625 😥, \:disappointed_relieved:, Disappointed But Relieved Face
-0xfcbc610f, // U+1F978 🥸, \:disguised_face:, Disguised Face
-0xfc9fe28c, // U+1F93F 🤿, \:diving_mask:, Diving Mask
-0xfd4a03ca, // U+1FA94 🪔, \:diya_lamp:, Diya Lamp
-0xfa55d606, // U+1F4AB 💫, \:dizzy:, Dizzy Symbol
-0xfb1ae10b, // U+1F635 😵, \:dizzy_face:, Dizzy Face
-0xfcf61004, // U+1F9EC 🧬, \:dna:, Dna Double Helix
-0xfb57844e, // U+1F6AF 🚯, \:do_not_litter:, Do Not Litter Symbol
-0xfcd27385, // U+1F9A4 🦤, \:dodo:, Dodo
-0xfa1b2184, // U+1F436 🐶, \:dog:, Dog Face
-0xfa0aa445, // U+1F415 🐕, \:dog2:, Dog
-0xfa5ac447, // U+1F4B5 💵, \:dollar:, Banknote With Dollar Sign
-0xf9c77486, // U+1F38E 🎎, \:dolls:, Japanese Dolls
-0xfa164348, // U+1F42C 🐬, \:dolphin:, Dolphin
-0xfd678607, // U+1FACF 🫏, \:donkey:, Donkey
-0xfb552445, // U+1F6AA 🚪, \:door:, Door
-0xfd72e111, // U+1FAE5 🫥, \:dotted_line_face:, Dotted Line Face
-0x11fc4454, // U+023F8 ⏸, \:double_vertical_bar:, Pause Button
-0xf9b484c9, // U+1F369 🍩, \:doughnut:, Doughnut
-0xfaa5610e, // U+1F54A 🕊, \:dove_of_peace:, Dove
-0xfa04a347, // U+1F409 🐉, \:dragon:, Dragon
-0xfa19610c, // U+1F432 🐲, \:dragon_face:, Dragon Face
-0xfa2be486, // U+1F457 👗, \:dress:, Dress
-0xfa1502d0, // U+1F42A 🐪, \:dromedary_camel:, Dromedary Camel
-0xfc92610e, // U+1F924 🤤, \:drooling_face:, Drooling Face
-0xfd3c20ce, // U+1FA78 🩸, \:drop_of_blood:, Drop Of Blood
-0xfa5384c8, // U+1F4A7 💧, \:droplet:, Droplet
-0xfca0e495, // U+1F941 🥁, \:drum_with_drumsticks:, Drum With Drumsticks
-0xfcc36285, // U+1F986 🦆, \:duck:, Duck
-0xfcaf9189, // U+1F95F 🥟, \:dumpling:, Dumpling
-0xfa6010c4, // U+1F4C0 📀, \:dvd:, Dvd
-0xfa73c2c7, // U+1F4E7 📧, \:e-mail:, E-Mail Symbol
-0xfcc2f106, // U+1F985 🦅, \:eagle:, Eagle
-0xfa214444, // U+1F442 👂, \:ear:, Ear
-0xf99f610c, // U+1F33E 🌾, \:ear_of_rice:, Ear Of Rice
-0xfcddc0d5, // U+1F9BB 🦻, \:ear_with_hearing_aid:, Ear With Hearing Aid
-0xf986e00d, // U+1F30D 🌍, \:earth_africa:, Earth Globe Europe-Africa
-0xf987448f, // U+1F30E 🌎, \:earth_americas:, Earth Globe Americas
-0xf987c00b, // U+1F30F 🌏, \:earth_asia:, Earth Globe Asia-Australia
-0xfcad2184, // U+1F95A 🥚, \:egg:, Egg
-0xf9a314c9, // U+1F346 🍆, \:eggplant:, Aubergine
-0x139a4459, // U+02734 ✴, \:eight_pointed_black_star:, Eight Pointed Black Star
-0x1399e296, // U+02733 ✳, \:eight_spoked_asterisk:, Eight Spoked Asterisk
-0x11e7e4c6, // U+023CF ⏏, \:eject:, Eject Button
-0xfa86018e, // U+1F50C 🔌, \:electric_plug:, Electric Plug
-0xfa0c14c9, // U+1F418 🐘, \:elephant:, Elephant
-0xfb6ba449, // U+1F6D7 🛗, \:elevator:, Elevator
-0xfceef144, // U+1F9DD 🧝, \:elf:, Elf
-0x1384c2c6, // U+02709 ✉, \:email:, Envelope
-0xfd5ce4cb, // U+1FAB9 🪹, \:empty_nest:, Empty Nest
-0xfa8d10c4, // U+1F51A 🔚, \:end:, End With Leftwards Arrow Above
-0x1384b109, // U+02709 ✉, \:envelope:, Envelope
-0xfa74a594, // U+1F4E9 📩, \:envelope_with_arrow:, Envelope With Downwards Arrow Above
-0xfa5b5385, // U+1F4B6 💶, \:euro:, Banknote With Euro Sign
-0xf9f87110, // U+1F3F0 🏰, \:european_castle:, European Castle
-0xf9f26115, // U+1F3E4 🏤, \:european_post_office:, European Post Office
-0xf999010f, // U+1F332 🌲, \:evergreen_tree:, Evergreen Tree
-0x13aba34c, // U+02757 ❗, \:exclamation:, Heavy Exclamation Mark Symbol
-0xfc97c0cf, // U+1F92F 🤯, \:exploding_head:, Shocked Face With Exploding Head
-0xfb08e48f, // U+1F611 😑, \:expressionless:, Expressionless Face
-0xfa20c104, // U+1F441 👁, \:eye:, Eye
-0xfa29848b, // U+1F453 👓, \:eyeglasses:, Eyeglasses
-0xfa200485, // U+1F440 👀, \:eyes:, Eyes
-0xfcbcd498, // U+1F979 🥹, \:face_holding_back_tears:, Face Holding Back Tears
-0xfc93730a, // U+1F926 🤦, \:face_palm:, Face Palm
-0xfc97118e, // U+1F92E 🤮, \:face_vomiting:, Face With Open Mouth Vomiting
-0xfc9044d5, // U+1F920 🤠, \:face_with_cowboy_hat:, Face With Cowboy Hat
-0xfd7271d9, // U+1FAE4 🫤, \:face_with_diagonal_mouth:, Face With Diagonal Mouth
-0xfc95b4a6, // U+1F92B 🤫, \:face_with_finger_covering_closed_lips:, Face With Finger Covering Closed Lips
-0xfc96f1da, // U+1F92D 🤭, \:face_with_hand_over_mouth:, Smiling Face With Smiling Eyes And Hand Covering Mouth
-0xfc8aa117, // U+1F915 🤕, \:face_with_head_bandage:, Face With Head-Bandage
-0xfce87112, // U+1F9D0 🧐, \:face_with_monocle:, Face With Monocle
-0xfc9400dd, // U+1F928 🤨, \:face_with_one_eyebrow_raised:, Face With One Eyebrow Raised
-0xfd7171e8, // U+1FAE2 🫢, \:face_with_open_eyes_and_hand_over_mouth:, Face With Open Eyes And Hand Over Mouth
-0xfc97119e, // U+1F92E 🤮, \:face_with_open_mouth_vomiting:, Face With Open Mouth Vomiting
-0xfd71c116, // U+1FAE3 🫣, \:face_with_peeking_eye:, Face With Peeking Eye
-0xfc942599, // U+1F928 🤨, \:face_with_raised_eyebrow:, Face With One Eyebrow Raised
-0xfb220497, // U+1F644 🙄, \:face_with_rolling_eyes:, Face With Rolling Eyes
-0xfc9671db, // U+1F92C 🤬, \:face_with_symbols_on_mouth:, Serious Face With Symbols Covering Mouth
-0xfc890456, // U+1F912 🤒, \:face_with_thermometer:, Face With Thermometer
-0xfa2561ca, // U+1F44A 👊, \:facepunch:, Fisted Hand Sign
-0xf9f6d608, // U+1F3ED 🏭, \:factory:, Factory
-0xfced5606, // U+1F9DA 🧚, \:fairy:, Fairy
-0xfce302c8, // U+1F9C6 🧆, \:falafel:, Falafel
-0xf9a1414c, // U+1F342 🍂, \:fallen_leaf:, Fallen Leaf
-0xfa357607, // U+1F46A 👪, \:family:, Family
-0x11f4d0cd, // U+023E9 ⏩, \:fast_forward:, Black Right-Pointing Double Triangle
-0xfa7045c4, // U+1F4E0 📠, \:fax:, Fax Machine
-0xfb1402c8, // U+1F628 😨, \:fearful:, Fearful Face
-0xfd5b0448, // U+1FAB6 🪶, \:feather:, Feather
-0xfa1f04c5, // U+1F43E 🐾, \:feet:, Paw Prints
-0x1320234c, // U+02640 ♀, \:female_sign:, Female Sign
-0xfc9d0447, // U+1F93A 🤺, \:fencer:, Fencer
-0xf9d082cd, // U+1F3A1 🎡, \:ferris_wheel:, Ferris Wheel
-0x137a5606, // U+026F4 ⛴, \:ferry:, Ferry
-0xf9e8f2dc, // U+1F3D1 🏑, \:field_hockey_stick_and_ball:, Field Hockey Stick And Ball
-0xfae204cd, // U+1F5C4 🗄, \:file_cabinet:, File Cabinet
-0xfa60844c, // U+1F4C1 📁, \:file_folder:, File Folder
-0xf9cf048c, // U+1F39E 🎞, \:film_frames:, Film Frames
-0xfa7ea44f, // U+1F4FD 📽, \:film_projector:, Film Projector
-0xfa92d105, // U+1F525 🔥, \:fire:, Fire
-0xfb49110c, // U+1F692 🚒, \:fire_engine:, Fire Engine
-0xfcf78452, // U+1F9EF 🧯, \:fire_extinguisher:, Fire Extinguisher
-0xfcf4044c, // U+1F9E8 🧨, \:firecracker:, Firecracker
-0xf9c3648a, // U+1F386 🎆, \:fireworks:, Fireworks
-0xfca3c2d2, // U+1F947 🥇, \:first_place_medal:, First Place Medal
-0xf989a353, // U+1F313 🌓, \:first_quarter_moon:, First Quarter Moon Symbol
-0xf98de11d, // U+1F31B 🌛, \:first_quarter_moon_with_face:, First Quarter Moon With Face
-0xfa0fe1c5, // U+1F41F 🐟, \:fish:, Fish
-0xf9b2e10a, // U+1F365 🍥, \:fish_cake:, Fish Cake With Swirl Design
-0xf9d1e1d6, // U+1F3A3 🎣, \:fishing_pole_and_fish:, Fishing Pole And Fish
-0x138564c5, // U+0270A ✊, \:fist:, Raised Fist
-0xf9c7a486, // U+1F38F 🎏, \:flags:, Carp Streamer
-0xfcd4a389, // U+1F9A9 🦩, \:flamingo:, Flamingo
-0xfa9334cb, // U+1F526 🔦, \:flashlight:, Electric Torch
-0xfd69c0ca, // U+1FAD3 🫓, \:flatbread:, Flatbread
-0x134e448d, // U+0269C ⚜, \:fleur_de_lis:, Fleur-De-Lis
-0xfa160448, // U+1F42C 🐬, \:flipper:, Dolphin
-0xfa5f628c, // U+1F4BE 💾, \:floppy_disk:, Floppy Disk
-0xf9da7495, // U+1F3B4 🎴, \:flower_playing_cards:, Flower Playing Cards
-0xfb1980c8, // U+1F633 😳, \:flushed:, Flushed Face
-0xfd447106, // U+1FA88 🪈, \:flute:, Flute
-0xfd587604, // U+1FAB0 🪰, \:fly:, Fly
-0xfca7e08c, // U+1F94F 🥏, \:flying_disc:, Flying Disc
-0xfb7c044e, // U+1F6F8 🛸, \:flying_saucer:, Flying Saucer
-0xf995a184, // U+1F32B 🌫, \:fog:, Fog
-0xf980a606, // U+1F301 🌁, \:foggy:, Foggy
-0xfd56c351, // U+1FAAD 🪭, \:folding_hand_fan:, Folding Hand Fan
-0xfd6a8107, // U+1FAD5 🫕, \:fondue:, Fondue
-0xfcdb24c5, // U+1F9B6 🦶, \:foot:, Foot
-0xf9e472c9, // U+1F3C8 🏈, \:football:, American Football
-0xfa31f48b, // U+1F463 👣, \:footprints:, Footprints
-0xf9ba110f, // U+1F374 🍴, \:fork_and_knife:, Fork And Knife
-0xfcb0410f, // U+1F960 🥠, \:fortune_cookie:, Fortune Cookie
-0x13794349, // U+026F2 ⛲, \:fountain:, Fountain
-0xf9a00451, // U+1F340 🍀, \:four_leaf_clover:, Four Leaf Clover
-0xfcc56109, // U+1F98A 🦊, \:fox_face:, Fox Face
-0xfade5113, // U+1F5BC 🖼, \:frame_with_picture:, Framed Picture
-0xf8c98105, // U+1F193 🆓, \:free:, Squared Free
-0xf9b9a18a, // U+1F373 🍳, \:fried_egg:, Cooking
-0xf9b203cd, // U+1F364 🍤, \:fried_shrimp:, Fried Shrimp
-0xf9af8486, // U+1F35F 🍟, \:fries:, French Fries
-0xfa1c2185, // U+1F438 🐸, \:frog:, Frog Face
-0xfb131189, // U+1F626 😦, \:frowning:, Frowning Face With Open Mouth
-0x137e83c9, // U+026FD ⛽, \:fuelpump:, Fuel Pump
-0xf98aa34a, // U+1F315 🌕, \:full_moon:, Full Moon Symbol
-0xf98ee114, // U+1F31D 🌝, \:full_moon_with_face:, Full Moon With Face
-0x1358d34c, // U+026B1 ⚱, \:funeral_urn:, Funeral Urn
-0xf9d94109, // U+1F3B2 🎲, \:game_die:, Game Die
-0xfce24087, // U+1F9C4 🧄, \:garlic:, Garlic
-0x134cc445, // U+02699 ⚙, \:gear:, Gear
-0xfa470304, // U+1F48E 💎, \:gem:, Gem Stone
-0x13251207, // U+0264A ♊, \:gemini:, Gemini
-0xfcef4106, // U+1F9DE 🧞, \:genie:, Genie
-0xfa3de4c6, // U+1F47B 👻, \:ghost:, Ghost
-0xf9c094c5, // U+1F381 🎁, \:gift:, Wrapped Present
-0xfa4ed4cb, // U+1F49D 💝, \:gift_heart:, Heart With Ribbon
-0xfd6d24cc, // U+1FADA 🫚, \:ginger_root:, Ginger Root
-0xfcc9610d, // U+1F992 🦒, \:giraffe_face:, Giraffe Face
-0xfa33d2c5, // U+1F467 👧, \:girl:, Girl
-0xfcadf28e, // U+1F95B 🥛, \:glass_of_milk:, Glass Of Milk
-0xf9881495, // U+1F310 🌐, \:globe_with_meridians:, Globe With Meridians
-0xfcf20487, // U+1F9E4 🧤, \:gloves:, Gloves
-0xfca284c9, // U+1F945 🥅, \:goal_net:, Goal Net
-0xfa0844c5, // U+1F410 🐐, \:goat:, Goat
-0xfcbe8488, // U+1F97D 🥽, \:goggles:, Goggles
-0x1379f145, // U+026F3 ⛳, \:golf:, Flag In Hole
-0xf9e60447, // U+1F3CC 🏌, \:golfer:, Person Golfing
-0xfd5fe106, // U+1FABF 🪿, \:goose:, Goose
-0xfcc6f008, // U+1F98D 🦍, \:gorilla:, Gorilla
-0xf9a38487, // U+1F347 🍇, \:grapes:, Grapes
-0xf9a7f10c, // U+1F34F 🍏, \:green_apple:, Green Apple
-0xfa6ba28b, // U+1F4D7 📗, \:green_book:, Green Book
-0xfa4d54cc, // U+1F49A 💚, \:green_heart:, Green Heart
-0xfcabc0cc, // U+1F957 🥗, \:green_salad:, Green Salad
-0x13aaa351, // U+02755 ❕, \:grey_exclamation:, White Exclamation Mark Ornament
-0xfd3b54cb, // U+1FA76 🩶, \:grey_heart:, Grey Heart
-0x13aa234e, // U+02754 ❔, \:grey_question:, White Question Mark Ornament
-0xfb16118a, // U+1F62C 😬, \:grimacing:, Grimacing Face
-0xfb00c345, // U+1F601 😁, \:grin:, Grinning Face With Smiling Eyes
-0xfb001189, // U+1F600 😀, \:grinning:, Grinning Face
-0xfc95412f, // U+1F92A 🤪, \:grinning_face_with_one_large_and_one_small_eye:, Grinning Face With One Large And One Small Eye
-0xfc94849d, // U+1F929 🤩, \:grinning_face_with_star_eyes:, Grinning Face With Star Eyes
-0xfa41434a, // U+1F482 💂, \:guardsman:, Guardsman
-0xfcd7218a, // U+1F9AE 🦮, \:guide_dog:, Guide Dog
-0xf9dc4447, // U+1F3B8 🎸, \:guitar:, Guitar
-0xfa958344, // U+1F52B 🔫, \:gun:, Pistol
-0xfd57628a, // U+1FAAE 🪮, \:hair_pick:, Hair Pick
-0xfa4384c8, // U+1F487 💇, \:haircut:, Haircut
-0xf9aa044a, // U+1F354 🍔, \:hamburger:, Hamburger
-0xfa940447, // U+1F528 🔨, \:hammer:, Hammer
-0x13496290, // U+02692 ⚒, \:hammer_and_pick:, Hammer And Pick
-0xfb7061d2, // U+1F6E0 🛠, \:hammer_and_wrench:, Hammer And Wrench
-0xfd566006, // U+1FAAC 🪬, \:hamsa:, Hamsa
-0xfa1c8448, // U+1F439 🐹, \:hamster:, Hamster Face
-0x138590c5, // U+0270B ✋, \:hand:, Raised Hand
-0xfc8f00eb, // U+1F91E 🤞, \:hand_with_index_and_middle_fingers_crossed:, Hand With Index And Middle Fingers Crossed
-0xfd7800e9, // U+1FAF0 🫰, \:hand_with_index_finger_and_thumb_crossed:, Hand With Index Finger And Thumb Crossed
-0xfa2e4188, // U+1F45C 👜, \:handbag:, Handbag
-0xfc9f72c9, // U+1F93E 🤾, \:handball:, Handball
-0xfc8ee10a, // U+1F91D 🤝, \:handshake:, Handshake
-0xfa548607, // U+1F4A9 💩, \:hankey:, Pile Of Poo
-0xfa12e28e, // U+1F425 🐥, \:hatched_chick:, Front-Facing Baby Chick
-0xfa11e28f, // U+1F423 🐣, \:hatching_chick:, Hatching Chick
-0xf9d3848b, // U+1F3A7 🎧, \:headphones:, Headphone
-0xfd53110a, // U+1FAA6 🪦, \:headstone:, Headstone
-0xfb24c2cd, // U+1F649 🙉, \:hear_no_evil:, Hear-No-Evil Monkey
-0x13b254c6, // U+02764 ❤, \:heart:, Heavy Black Heart
-0xfa4fa351, // U+1F49F 💟, \:heart_decoration:, Heart Decoration
-0xfb06848b, // U+1F60D 😍, \:heart_eyes:, Smiling Face With Heart-Shaped Eyes
-0xfb1dc4cf, // U+1F63B 😻, \:heart_eyes_cat:, Smiling Cat Face With Heart-Shaped Eyes
-0xfd7b748c, // U+1FAF6 🫶, \:heart_hands:, Heart Hands
-0xfa49c4ca, // U+1F493 💓, \:heartbeat:, Beating Heart
-0xfa4be10b, // U+1F497 💗, \:heartpulse:, Growing Heart
-0x1332f487, // U+02665 ♥, \:hearts:, Black Heart Suit
-0x138a5291, // U+02714 ✔, \:heavy_check_mark:, Heavy Check Mark
-0x13cba354, // U+02797 ➗, \:heavy_division_sign:, Heavy Division Sign
-0xfa592352, // U+1F4B2 💲, \:heavy_dollar_sign:, Heavy Dollar Sign
-0xfbf82352, // U+1F7F0 🟰, \:heavy_equals_sign:, Heavy Equals Sign
-0x13abd297, // U+02757 ❗, \:heavy_exclamation_mark:, Heavy Exclamation Mark Symbol
-0x13b194e6, // U+02763 ❣, \:heavy_heart_exclamation_mark_ornament:, Heart Exclamation
-0x13cb2351, // U+02796 ➖, \:heavy_minus_sign:, Heavy Minus Sign
-0x138b25d7, // U+02716 ✖, \:heavy_multiplication_x:, Heavy Multiplication X
-0x13caa350, // U+02795 ➕, \:heavy_plus_sign:, Heavy Plus Sign
-0xfcca2189, // U+1F994 🦔, \:hedgehog:, Hedgehog
-0xfb40844b, // U+1F681 🚁, \:helicopter:, Helicopter
-0x1368e498, // U+026D1 ⛑, \:helmet_with_white_cross:, Rescue Worker’S Helmet
-0xf99fd045, // U+1F33F 🌿, \:herb:, Herb
-0xf99d0489, // U+1F33A 🌺, \:hibiscus:, Hibiscus
-0xfa836490, // U+1F506 🔆, \:high_brightness:, High Brightness Symbol
-0xfa3002ca, // U+1F460 👠, \:high_heel:, High-Heeled Shoe
-0xfcbf24cc, // U+1F97E 🥾, \:hiking_boot:, Hiking Boot
-0xfb6af10d, // U+1F6D5 🛕, \:hindu_temple:, Hindu Temple
-0xfccd848d, // U+1F99B 🦛, \:hippopotamus:, Hippopotamus
-0xfa953386, // U+1F52A 🔪, \:hocho:, Hocho
-0xfab9f105, // U+1F573 🕳, \:hole:, Hole
-0xf9b7a4ca, // U+1F36F 🍯, \:honey_pot:, Honey Pot
-0xfa0e8109, // U+1F41D 🐝, \:honeybee:, Honeybee
-0xfd4ea285, // U+1FA9D 🪝, \:hook:, Hook
-0xfa1a6106, // U+1F434 🐴, \:horse:, Horse Face
-0xf9e3918d, // U+1F3C7 🏇, \:horse_racing:, Horse Racing
-0xf9f2c2c9, // U+1F3E5 🏥, \:hospital:, Hospital
-0xfcbae109, // U+1F975 🥵, \:hot_face:, Overheated Face
-0xf99b044b, // U+1F336 🌶, \:hot_pepper:, Hot Pepper
-0xf996a187, // U+1F32D 🌭, \:hotdog:, Hot Dog
-0xf9f402c6, // U+1F3E8 🏨, \:hotel:, Hotel
-0x1334248b, // U+02668 ♨, \:hotsprings:, Hot Springs
-0x118de48a, // U+0231B ⌛, \:hourglass:, Hourglass
-0x11f990d7, // U+023F3 ⏳, \:hourglass_flowing_sand:, Hourglass With Flowing Sand
-0xf9f06106, // U+1F3E0 🏠, \:house:, House Building
-0xf9ec2490, // U+1F3D8 🏘, \:house_buildings:, Houses
-0xf9f08352, // U+1F3E1 🏡, \:house_with_garden:, House With Garden
-0xfc8be10d, // U+1F917 🤗, \:hugging_face:, Hugging Face
-0xfb1780c7, // U+1F62F 😯, \:hushed:, Hushed Face
-0xfb6b04c4, // U+1F6D6 🛖, \:hut:, Hut
-0xfd5df1c9, // U+1FABB 🪻, \:hyacinth:, Hyacinth
-0xfc8fa355, // U+1F91F 🤟, \:i_love_you_hand_sign:, I Love You Hand Sign
-0xf9b4430a, // U+1F368 🍨, \:ice_cream:, Ice Cream
-0xfce55109, // U+1F9CA 🧊, \:ice_cube:, Ice Cube
-0xf9e9629a, // U+1F3D2 🏒, \:ice_hockey_stick_and_puck:, Ice Hockey Stick And Puck
-0x137c710a, // U+026F8 ⛸, \:ice_skate:, Ice Skate
-0xf9b34309, // U+1F366 🍦, \:icecream:, Soft Ice Cream
-0xf8ca00c3, // U+1F194 🆔, \:id:, Squared Id
-0xfd5550d4, // U+1FAAA 🪪, \:identification_card:, Identification Card
-0xf9282114, // U+1F250 🉐, \:ideograph_advantage:, Circled Ideograph Advantage
-0xfa3f83c4, // U+1F47F 👿, \:imp:, Imp
-0xfa72c60b, // U+1F4E5 📥, \:inbox_tray:, Inbox Tray
-0xfa743112, // U+1F4E8 📨, \:incoming_envelope:, Incoming Envelope
-0xfd7a845d, // U+1FAF5 🫵, \:index_pointing_at_the_viewer:, Index Pointing At The Viewer
-0x133f7609, // U+0267E ♾, \:infinity:, Infinity
-0xfa40a358, // U+1F481 💁, \:information_desk_person:, Information Desk Person
-0x109ce113, // U+02139 ℹ, \:information_source:, Information Source
-0xfb0394c9, // U+1F607 😇, \:innocent:, Smiling Face With Halo
-0x1024918c, // U+02049 ⁉, \:interrobang:, Exclamation Question Mark
-0xfa789107, // U+1F4F1 📱, \:iphone:, Mobile Phone
-0xf9f75350, // U+1F3EE 🏮, \:izakaya_lantern:, Izakaya Lantern
-0xf9c1d34f, // U+1F383 🎃, \:jack_o_lantern:, Jack-O-Lantern
-0xfaff4346, // U+1F5FE 🗾, \:japan:, Silhouette Of Japan
-0xf9f7f110, // U+1F3EF 🏯, \:japanese_castle:, Japanese Castle
-0xfa3d4350, // U+1F47A 👺, \:japanese_goblin:, Japanese Goblin
-0xfa3cd10e, // U+1F479 👹, \:japanese_ogre:, Japanese Ogre
-0xfd6cc444, // U+1FAD9 🫙, \:jar:, Jar
-0xfa2b1486, // U+1F456 👖, \:jeans:, Jeans
-0xfd5e61ca, // U+1FABC 🪼, \:jellyfish:, Jellyfish
-0xfcf4c587, // U+1F9E9 🧩, \:jigsaw:, Jigsaw Puzzle Piece
-0xfb012604, // U+1F602 😂, \:joy:, Face With Tears Of Joy
-0xfb1cc4c8, // U+1F639 😹, \:joy_cat:, Cat Face With Tears Of Joy
-0xfabce289, // U+1F579 🕹, \:joystick:, Joystick
-0xfc9c9189, // U+1F939 🤹, \:juggling:, Juggling
-0xfaa5d006, // U+1F54B 🕋, \:kaaba:, Kaaba
-0xfccc2389, // U+1F998 🦘, \:kangaroo:, Kangaroo
-0xfa888604, // U+1F511 🔑, \:key:, Key
-0x119450c9, // U+02328 ⌨, \:keyboard:, Keyboard
-0xfa8f834b, // U+1F51F 🔟, \:keycap_ten:, Keycap Ten
-0xfd57f007, // U+1FAAF 🪯, \:khanda:, Khanda
-0xfa2c1387, // U+1F458 👘, \:kimono:, Kimono
-0xfa45e485, // U+1F48B 💋, \:kiss:, Kiss Mark
-0xfb0b9188, // U+1F617 😗, \:kissing:, Kissing Face
-0xfb1ec4cc, // U+1F63D 😽, \:kissing_cat:, Kissing Cat Face With Closed Eyes
-0xfb0d0494, // U+1F61A 😚, \:kissing_closed_eyes:, Kissing Face With Closed Eyes
-0xfb0c54ce, // U+1F618 😘, \:kissing_heart:, Face Throwing A Kiss
-0xfb0c8495, // U+1F619 😙, \:kissing_smiling_eyes:, Kissing Face With Smiling Eyes
-0xfd40f105, // U+1FA81 🪁, \:kite:, Kite
-0xfcaec4ca, // U+1F95D 🥝, \:kiwifruit:, Kiwifruit
-0xfce72350, // U+1F9CE 🧎, \:kneeling_person:, Kneeling Person
-0xfa951106, // U+1F52A 🔪, \:knife:, Hocho
-0xf9bef111, // U+1F37D 🍽, \:knife_fork_plate:, Fork And Knife With Plate
-0xfd5124c5, // U+1FAA2 🪢, \:knot:, Knot
-0xfa147006, // U+1F428 🐨, \:koala:, Koala
-0xf900e385, // U+1F201 🈁, \:koko:, Squared Katakana Koko
-0xfcbe44c9, // U+1F97C 🥼, \:lab_coat:, Lab Coat
-0xf9fb82c6, // U+1F3F7 🏷, \:label:, Label
-0xfca6e109, // U+1F94D 🥍, \:lacrosse:, Lacrosse Stick And Ball
-0xfd4e0447, // U+1FA9C 🪜, \:ladder:, Ladder
-0xfa0f710c, // U+1F41E 🐞, \:lady_beetle:, Lady Beetle
-0xfa0f0188, // U+1F41E 🐞, \:ladybug:, Lady Beetle
-0xf9f75348, // U+1F3EE 🏮, \:lantern:, Izakaya Lantern
-0xfa9af112, // U+1F535 🔵, \:large_blue_circle:, Large Blue Circle
-0xfa9b90d3, // U+1F537 🔷, \:large_blue_diamond:, Large Blue Diamond
-0xfbf35112, // U+1F7E6 🟦, \:large_blue_square:, Large Blue Square
-0xfbf27113, // U+1F7E4 🟤, \:large_brown_circle:, Large Brown Circle
-0xfbf5d113, // U+1F7EB 🟫, \:large_brown_square:, Large Brown Square
-0xfbf17113, // U+1F7E2 🟢, \:large_green_circle:, Large Green Circle
-0xfbf4d113, // U+1F7E9 🟩, \:large_green_square:, Large Green Square
-0xfbf07114, // U+1F7E0 🟠, \:large_orange_circle:, Large Orange Circle
-0xfa9b10d5, // U+1F536 🔶, \:large_orange_diamond:, Large Orange Diamond
-0xfbf3d114, // U+1F7E7 🟧, \:large_orange_square:, Large Orange Square
-0xfbf1f114, // U+1F7E3 🟣, \:large_purple_circle:, Large Purple Circle
-0xfbf55114, // U+1F7EA 🟪, \:large_purple_square:, Large Purple Square
-0xfbf2d111, // U+1F7E5 🟥, \:large_red_square:, Large Red Square
-0xfbf0f114, // U+1F7E1 🟡, \:large_yellow_circle:, Large Yellow Circle
-0xfbf45114, // U+1F7E8 🟨, \:large_yellow_square:, Large Yellow Square
-0xf98ba352, // U+1F317 🌗, \:last_quarter_moon:, Last Quarter Moon Symbol
-0xf98e611c, // U+1F31C 🌜, \:last_quarter_moon_with_face:, Last Quarter Moon With Face
-0x138ee48c, // U+0271D ✝, \:latin_cross:, Latin Cross
-0xfb031189, // U+1F606 😆, \:laughing:, Smiling Face With Open Mouth And Tightly-Closed Eyes
-0xfcb6034c, // U+1F96C 🥬, \:leafy_green:, Leafy Green
-0xf9a18487, // U+1F343 🍃, \:leaves:, Leaf Fluttering In Wind
-0xfa690447, // U+1F4D2 📒, \:ledger:, Ledger
-0xfc8de4d1, // U+1F91B 🤛, \:left-facing_fist:, Left-Facing Fist
-0xfb62a10d, // U+1F6C5 🛅, \:left_luggage:, Left Luggage
-0x10ca2591, // U+02194 ↔, \:left_right_arrow:, Left Right Arrow
-0xfaf47113, // U+1F5E8 🗨, \:left_speech_bubble:, Left Speech Bubble
-0x10d4a29a, // U+021A9 ↩, \:leftwards_arrow_with_hook:, Leftwards Arrow With Hook
-0xfd7910cf, // U+1FAF2 🫲, \:leftwards_hand:, Leftwards Hand
-0xfd7b90d7, // U+1FAF7 🫷, \:leftwards_pushing_hand:, Leftwards Pushing Hand
-0xfcda8184, // U+1F9B5 🦵, \:leg:, Leg
-0xf9a5a346, // U+1F34B 🍋, \:lemon:, Lemon
-0x13260384, // U+0264C ♌, \:leo:, Leo
-0xfa0350c8, // U+1F406 🐆, \:leopard:, Leopard
-0xf9cd044d, // U+1F39A 🎚, \:level_slider:, Level Slider
-0x13275006, // U+0264E ♎, \:libra:, Libra
-0xfd3ad4d1, // U+1FA75 🩵, \:light_blue_heart:, Light Blue Heart
-0xfb4442cb, // U+1F688 🚈, \:light_rail:, Light Rail
-0xf994918a, // U+1F329 🌩, \:lightning:, Cloud With Lightning
-0xf99480d0, // U+1F329 🌩, \:lightning_cloud:, Cloud With Lightning
-0xfa8b9285, // U+1F517 🔗, \:link:, Link Symbol
-0xfac3b492, // U+1F587 🖇, \:linked_paperclips:, Linked Paperclips
-0xfcc0e10a, // U+1F981 🦁, \:lion_face:, Lion Face
-0xfa223485, // U+1F444 👄, \:lips:, Mouth
-0xfa426289, // U+1F484 💄, \:lipstick:, Lipstick
-0xfcc750c7, // U+1F98E 🦎, \:lizard:, Lizard
-0xfccc8006, // U+1F999 🦙, \:llama:, Llama
-0xfccf0448, // U+1F99E 🦞, \:lobster:, Lobster
-0xfa896285, // U+1F512 🔒, \:lock:, Lock
-0xfa878352, // U+1F50F 🔏, \:lock_with_ink_pen:, Lock With Ink Pen
-0xf9b6a3c9, // U+1F36D 🍭, \:lollipop:, Lollipop
-0xfd4c030a, // U+1FA98 🪘, \:long_drum:, Long Drum
-0x13dfa3c5, // U+027BF ➿, \:loop:, Double Curly Loop
-0xfcfa710e, // U+1F9F4 🧴, \:lotion_bottle:, Lotion Bottle
-0xfd5b8486, // U+1FAB7 🪷, \:lotus:, Lotus
-0xfa8510cb, // U+1F50A 🔊, \:loud_sound:, Speaker With Three Sound Waves
-0xfa71044c, // U+1F4E2 📢, \:loudspeaker:, Public Address Loudspeaker
-0xf9f482cb, // U+1F3E9 🏩, \:love_hotel:, Love Hotel
-0xfa46044c, // U+1F48C 💌, \:love_letter:, Love Letter
-0xfd55d60c, // U+1FAAB 🪫, \:low_battery:, Low Battery
-0xfa82e48f, // U+1F505 🔅, \:low_brightness:, Low Brightness Symbol
-0xfac50359, // U+1F58A 🖊, \:lower_left_ballpoint_pen:, Pen
-0xfac6a352, // U+1F58D 🖍, \:lower_left_crayon:, Crayon
-0xfac58358, // U+1F58B 🖋, \:lower_left_fountain_pen:, Fountain Pen
-0xfac661d6, // U+1F58C 🖌, \:lower_left_paintbrush:, Paintbrush
-0xfcf9a108, // U+1F9F3 🧳, \:luggage:, Luggage
-0xfd60a486, // U+1FAC1 🫁, \:lungs:, Lungs
-0xfc92e10b, // U+1F925 🤥, \:lying_face:, Lying Face
-0x12610302, // U+024C2 Ⓜ, \:m:, Circled Latin Capital Letter M
-0xfa86c184, // U+1F50D 🔍, \:mag:, Left-Pointing Magnifying Glass
-0xfa8734ca, // U+1F50E 🔎, \:mag_right:, Right-Pointing Magnifying Glass
-0xfceca105, // U+1F9D9 🧙, \:mage:, Mage
-0xfd4210cb, // U+1FA84 🪄, \:magic_wand:, Magic Wand
-0xfcf904c7, // U+1F9F2 🧲, \:magnet:, Magnet
-0xf8021188, // U+1F004 🀄, \:mahjong:, Mahjong Tile Red Dragon
-0xfa75a5c8, // U+1F4EB 📫, \:mailbox:, Closed Mailbox With Raised Flag
-0xfa7500cf, // U+1F4EA 📪, \:mailbox_closed:, Closed Mailbox With Lowered Flag
-0xfa7642d2, // U+1F4EC 📬, \:mailbox_with_mail:, Open Mailbox With Raised Flag
-0xfa76c2d5, // U+1F4ED 📭, \:mailbox_with_no_mail:, Open Mailbox With Lowered Flag
-0x1321234a, // U+02642 ♂, \:male_sign:, Male Sign
-0xfcd1f1c8, // U+1F9A3 🦣, \:mammoth:, Mammoth
-0xfa344344, // U+1F468 👨, \:man:, Man
-0xfa35f49c, // U+1F46B 👫, \:man_and_woman_holding_hands:, Man And Woman Holding Hands
-0xfabd118c, // U+1F57A 🕺, \:man_dancing:, Man Dancing
-0xfaba11a0, // U+1F574 🕴, \:man_in_business_suit_levitating:, Person In Suit Levitating
-0xfa394394, // U+1F472 👲, \:man_with_gua_pi_mao:, Man With Gua Pi Mao
-0xfa39c350, // U+1F473 👳, \:man_with_turban:, Man With Turban
-0xfcb6a386, // U+1F96D 🥭, \:mango:, Mango
-0xfa2f210a, // U+1F45E 👞, \:mans_shoe:, Mans Shoe
-0xfab86292, // U+1F570 🕰, \:mantelpiece_clock:, Mantelpiece Clock
-0xfcdec452, // U+1F9BD 🦽, \:manual_wheelchair:, Manual Wheelchair
-0xf9a0c14b, // U+1F341 🍁, \:maple_leaf:, Maple Leaf
-0xfd43c488, // U+1FA87 🪇, \:maracas:, Maracas
-0xfca5d315, // U+1F94B 🥋, \:martial_arts_uniform:, Martial Arts Uniform
-0xfb1be285, // U+1F637 😷, \:mask:, Face With Medical Mask
-0xfa432108, // U+1F486 💆, \:massage:, Face Massage
-0xfce4928b, // U+1F9C9 🧉, \:mate_drink:, Mate Drink
-0xf9ab110d, // U+1F356 🍖, \:meat_on_bone:, Meat On Bone
-0xfcdf530f, // U+1F9BE 🦾, \:mechanical_arm:, Mechanical Arm
-0xfcdf818f, // U+1F9BF 🦿, \:mechanical_leg:, Mechanical Leg
-0xf9cb42c6, // U+1F396 🎖, \:medal:, Military Medal
-0x134aa2cf, // U+02695 ⚕, \:medical_symbol:, Medical Symbol
-0xfa71a005, // U+1F4E3 📣, \:mega:, Cheering Megaphone
-0xf9a42346, // U+1F348 🍈, \:melon:, Melon
-0xfd70610d, // U+1FAE0 🫠, \:melting_face:, Melting Face
-0xfa6e8385, // U+1F4DD 📝, \:memo:, Memo
-0xfa367492, // U+1F46C 👬, \:men_holding_hands:, Two Men Holding Hands
-0xfaa7049b, // U+1F54E 🕎, \:menorah_with_nine_branches:, Menorah With Nine Branches
-0xfb5c9485, // U+1F6B9 🚹, \:mens:, Mens Symbol
-0xfcee234a, // U+1F9DC 🧜, \:merperson:, Merperson
-0xfb43d386, // U+1F687 🚇, \:metro:, Metro
-0xfcd05108, // U+1F9A0 🦠, \:microbe:, Microbe
-0xf9d2110b, // U+1F3A4 🎤, \:microphone:, Microphone
-0xfa96310b, // U+1F52C 🔬, \:microscope:, Microscope
-0xfaca844e, // U+1F595 🖕, \:middle_finger:, Reversed Hand With Middle Finger Extended
-0xfd4b04d0, // U+1FA96 🪖, \:military_helmet:, Military Helmet
-0xf986460a, // U+1F30C 🌌, \:milky_way:, Milky Way
-0xfb480488, // U+1F690 🚐, \:minibus:, Minibus
-0xfa5ee089, // U+1F4BD 💽, \:minidisc:, Minidisc
-0xfd4f2447, // U+1FA9E 🪞, \:mirror:, Mirror
-0xfd54f2cc, // U+1FAA9 🪩, \:mirror_ball:, Mirror Ball
-0xfa7a1151, // U+1F4F4 📴, \:mobile_phone_off:, Mobile Phone Off
-0xfc88e111, // U+1F911 🤑, \:money_mouth_face:, Money-Mouth Face
-0xfa5c2491, // U+1F4B8 💸, \:money_with_wings:, Money With Wings
-0xfa584189, // U+1F4B0 💰, \:moneybag:, Money Bag
-0xfa090607, // U+1F412 🐒, \:monkey:, Monkey
-0xfa1ae10c, // U+1F435 🐵, \:monkey_face:, Monkey Face
-0xfb4ec2c9, // U+1F69D 🚝, \:monorail:, Monorail
-0xf98a2345, // U+1F314 🌔, \:moon:, Waxing Gibbous Moon Symbol
-0xfcb7610a, // U+1F96E 🥮, \:moon_cake:, Moon Cake
-0xfd676106, // U+1FACE 🫎, \:moose:, Moose
-0xf9c9d0cd, // U+1F393 🎓, \:mortar_board:, Graduation Cap
-0xfaa60107, // U+1F54C 🕌, \:mosque:, Mosque
-0xfccff389, // U+1F99F 🦟, \:mosquito:, Mosquito
-0xf992160d, // U+1F324 🌤, \:mostly_sunny:, Sun Behind Small Cloud
-0xfc9b4491, // U+1F936 🤶, \:mother_christmas:, Mother Christmas
-0xfb72c4cb, // U+1F6E5 🛥, \:motor_boat:, Motor Boat
-0xfb7a844e, // U+1F6F5 🛵, \:motor_scooter:, Motor Scooter
-0xfcde4455, // U+1F9BC 🦼, \:motorized_wheelchair:, Motorized Wheelchair
-0xfb71c609, // U+1F6E3 🛣, \:motorway:, Motorway
-0xfafdd20b, // U+1F5FB 🗻, \:mount_fuji:, Mount Fuji
-0x13784349, // U+026F0 ⛰, \:mountain:, Mountain
-0xfb5ae4d3, // U+1F6B5 🚵, \:mountain_bicyclist:, Mountain Bicyclist
-0xfb504612, // U+1F6A0 🚠, \:mountain_cableway:, Mountain Cableway
-0xfb4f4611, // U+1F69E 🚞, \:mountain_railway:, Mountain Railway
-0xfa16e106, // U+1F42D 🐭, \:mouse:, Mouse Face
-0xfa008447, // U+1F401 🐁, \:mouse2:, Mouse
-0xfd5243cb, // U+1FAA4 🪤, \:mouse_trap:, Mouse Trap
-0xf9d2d00d, // U+1F3A5 🎥, \:movie_camera:, Movie Camera
-0xfaffc206, // U+1F5FF 🗿, \:moyai:, Moyai
-0xfc9b048a, // U+1F936 🤶, \:mrs_claus:, Mother Christmas
-0xfa557107, // U+1F4AA 💪, \:muscle:, Flexed Biceps
-0xf9a22309, // U+1F344 🍄, \:mushroom:, Mushroom
-0xf9dcd0d1, // U+1F3B9 🎹, \:musical_keyboard:, Musical Keyboard
-0xf9daf10d, // U+1F3B5 🎵, \:musical_note:, Musical Note
-0xf9de510e, // U+1F3BC 🎼, \:musical_score:, Musical Score
-0xfa83f105, // U+1F507 🔇, \:mute:, Speaker With Cancellation Stroke
-0xfa42d10a, // U+1F485 💅, \:nail_care:, Nail Polish
-0xfa6da10b, // U+1F4DB 📛, \:name_badge:, Name Badge
-0xf9ef528e, // U+1F3DE 🏞, \:national_park:, National Park
-0xfc91610f, // U+1F922 🤢, \:nauseated_face:, Nauseated Face
-0xfcff84cd, // U+1F9FF 🧿, \:nazar_amulet:, Nazar Amulet
-0xfa2a4108, // U+1F454 👔, \:necktie:, Necktie
-0x13a7529c, // U+0274E ❎, \:negative_squared_cross_mark:, Negative Squared Cross Mark
-0xfc89e10a, // U+1F913 🤓, \:nerd_face:, Nerd Face
-0xfd5d248f, // U+1FABA 🪺, \:nest_with_eggs:, Nest With Eggs
-0xfd43748e, // U+1FA86 🪆, \:nesting_dolls:, Nesting Dolls
-0xfb08610d, // U+1F610 😐, \:neutral_face:, Neutral Face
-0xf8ca8584, // U+1F195 🆕, \:new:, Squared New
-0xf988a349, // U+1F311 🌑, \:new_moon:, New Moon Symbol
-0xf98d6113, // U+1F31A 🌚, \:new_moon_with_face:, New Moon With Face
-0xfa78044a, // U+1F4F0 📰, \:newspaper:, Newspaper
-0xf8cb0183, // U+1F196 🆖, \:ng:, Squared Ng
-0xf981d491, // U+1F303 🌃, \:night_with_stars:, Night With Stars
-0xfcbbd006, // U+1F977 🥷, \:ninja:, Ninja
-0xfa8af2c8, // U+1F515 🔕, \:no_bell:, Bell With Cancellation Stroke
-0xfb59848c, // U+1F6B3 🚳, \:no_bicycles:, No Bicycles
-0x136a5609, // U+026D4 ⛔, \:no_entry:, No Entry
-0xfb55a34e, // U+1F6AB 🚫, \:no_entry_sign:, No Entry Sign
-0xfb22a0c8, // U+1F645 🙅, \:no_good:, Face With No Good Gesture
-0xfa7a8491, // U+1F4F5 📵, \:no_mobile_phones:, No Mobile Phones
-0xfb1b71c9, // U+1F636 😶, \:no_mouth:, Face Without Mouth
-0xfb5b948f, // U+1F6B7 🚷, \:no_pedestrians:, No Pedestrians
-0xfb56918b, // U+1F6AD 🚭, \:no_smoking:, No Smoking Symbol
-0xfb588452, // U+1F6B1 🚱, \:non-potable_water:, Non-Potable Water Symbol
-0xfa21e105, // U+1F443 👃, \:nose:, Nose
-0xfa69a289, // U+1F4D3 📓, \:notebook:, Notebook
-0xfa6a045f, // U+1F4D4 📔, \:notebook_with_decorative_cover:, Notebook With Decorative Cover
-0xf9db0486, // U+1F3B6 🎶, \:notes:, Multiple Musical Notes
-0xfa94f4cd, // U+1F529 🔩, \:nut_and_bolt:, Nut And Bolt
-0x15aa8382, // U+02B55 ⭕, \:o:, Heavy Large Circle
-0xf8bf0443, // U+1F17E 🅾, \:o2:, Negative Squared Latin Capital Letter O
-0xf9854346, // U+1F30A 🌊, \:ocean:, Water Wave
-0xfb68a34f, // U+1F6D1 🛑, \:octagonal_sign:, Octagonal Sign
-0xfa0c8488, // U+1F419 🐙, \:octopus:, Octopus
-0xf9b10345, // U+1F362 🍢, \:oden:, Oden
-0xf9f16107, // U+1F3E2 🏢, \:office:, Office Building
-0xfb710309, // U+1F6E2 🛢, \:oil_drum:, Oil Drum
-0xf8cb8283, // U+1F197 🆗, \:ok:, Squared Ok
-0xfa2610c8, // U+1F44C 👌, \:ok_hand:, Ok Hand Sign
-0xfb234349, // U+1F646 🙆, \:ok_woman:, Face With Ok Gesture
-0xfaee8608, // U+1F5DD 🗝, \:old_key:, Old Key
-0xfce9f4cc, // U+1F9D3 🧓, \:older_adult:, Older Adult
-0xfa3a434a, // U+1F474 👴, \:older_man:, Older Man
-0xfa3ac34c, // U+1F475 👵, \:older_woman:, Older Woman
-0xfd691106, // U+1FAD2 🫒, \:olive:, Olive
-0xfaa4a2ca, // U+1F549 🕉, \:om_symbol:, Om
-0xfa8d8343, // U+1F51B 🔛, \:on:, On With Exclamation Mark With Left Right Arrow Above
-0xfb4c7114, // U+1F698 🚘, \:oncoming_automobile:, Oncoming Automobile
-0xfb46848d, // U+1F68D 🚍, \:oncoming_bus:, Oncoming Bus
-0xfb4a4454, // U+1F694 🚔, \:oncoming_police_car:, Oncoming Police Car
-0xfb4b320e, // U+1F696 🚖, \:oncoming_taxi:, Oncoming Taxi
-0xfd38c4d3, // U+1FA71 🩱, \:one-piece_swimsuit:, One-Piece Swimsuit
-0xfce2a346, // U+1F9C5 🧅, \:onion:, Onion
-0xfa6b228a, // U+1F4D6 📖, \:open_book:, Open Book
-0xfa610451, // U+1F4C2 📂, \:open_file_folder:, Open File Folder
-0xfa28748b, // U+1F450 👐, \:open_hands:, Open Hands Sign
-0xfb1771cb, // U+1F62E 😮, \:open_mouth:, Face With Open Mouth
-0x1367048a, // U+026CE ⛎, \:ophiuchus:, Ophiuchus
-0xfa6ca28c, // U+1F4D9 📙, \:orange_book:, Orange Book
-0xfcf0d4cd, // U+1F9E1 🧡, \:orange_heart:, Orange Heart
-0xfcd3c34a, // U+1F9A7 🦧, \:orangutan:, Orangutan
-0x1313648f, // U+02626 ☦, \:orthodox_cross:, Orthodox Cross
-0xfcd30446, // U+1F9A6 🦦, \:otter:, Otter
-0xfa72460c, // U+1F4E4 📤, \:outbox_tray:, Outbox Tray
-0xfcc4a2c4, // U+1F989 🦉, \:owl:, Owl
-0xfa0105c3, // U+1F402 🐂, \:ox:, Ox
-0xfcd50447, // U+1F9AA 🦪, \:oyster:, Oyster
-0xfa732108, // U+1F4E6 📦, \:package:, Package
-0xfa6203cf, // U+1F4C4 📄, \:page_facing_up:, Page Facing Up
-0xfa61d2cf, // U+1F4C3 📃, \:page_with_curl:, Page With Curl
-0xfa6f8446, // U+1F4DF 📟, \:pager:, Pager
-0xfd7990cf, // U+1FAF3 🫳, \:palm_down_hand:, Palm Down Hand
-0xf99a010a, // U+1F334 🌴, \:palm_tree:, Palm Tree
-0xfd7a10cd, // U+1FAF4 🫴, \:palm_up_hand:, Palm Up Hand
-0xfc990452, // U+1F932 🤲, \:palms_up_together:, Palms Up Together
-0xfcaf0489, // U+1F95E 🥞, \:pancakes:, Pancakes
-0xfa1e610b, // U+1F43C 🐼, \:panda_face:, Panda Face
-0xfa6743ca, // U+1F4CE 📎, \:paperclip:, Paperclip
-0xfd41710a, // U+1FA82 🪂, \:parachute:, Parachute
-0xf8bf9188, // U+1F17F 🅿, \:parking:, Negative Squared Latin Capital Letter P
-0xfcce24c7, // U+1F99C 🦜, \:parrot:, Parrot
-0x181ed296, // U+0303D 〽, \:part_alternation_mark:, Part Alternation Mark
-0x1362960d, // U+026C5 ⛅, \:partly_sunny:, Sun Behind Cloud
-0xf9934352, // U+1F326 🌦, \:partly_sunny_rain:, Sun Behind Rain Cloud
-0xfcb9e10e, // U+1F973 🥳, \:partying_face:, Face With Party Horn And Party Hat
-0xfb79c3cf, // U+1F6F3 🛳, \:passenger_ship:, Passenger Ship
-0xfb6122d1, // U+1F6C2 🛂, \:passport_control:, Passport Control
-0xfa1f748b, // U+1F43E 🐾, \:paw_prints:, Paw Prints
-0xfd6da0c8, // U+1FADB 🫛, \:pea_pod:, Pea Pod
-0x131722cd, // U+0262E ☮, \:peace_symbol:, Peace Symbol
-0xf9a8e1c6, // U+1F351 🍑, \:peach:, Peach
-0xfccd6288, // U+1F99A 🦚, \:peacock:, Peacock
-0xfcae7488, // U+1F95C 🥜, \:peanuts:, Peanuts
-0xf9a84445, // U+1F350 🍐, \:pear:, Pear
-0xfa6ec2c7, // U+1F4DD 📝, \:pencil:, Memo
-0x1387f448, // U+0270F ✏, \:pencil2:, Pencil
-0xfa13c348, // U+1F427 🐧, \:penguin:, Penguin
-0xfb0a1108, // U+1F614 😔, \:pensive:, Pensive Face
-0xfd61118f, // U+1FAC2 🫂, \:people_hugging:, People Hugging
-0xf9d6f490, // U+1F3AD 🎭, \:performing_arts:, Performing Arts
-0xfb11d10a, // U+1F623 😣, \:persevere:, Persevering Face
-0xfceb9190, // U+1F9D7 🧗, \:person_climbing:, Person Climbing
-0xfc9c02d7, // U+1F938 🤸, \:person_doing_cartwheel:, Person Doing Cartwheel
-0xfb269190, // U+1F64D 🙍, \:person_frowning:, Person Frowning
-0xfcec2359, // U+1F9D8 🧘, \:person_in_lotus_position:, Person In Lotus Position
-0xfceb2316, // U+1F9D6 🧖, \:person_in_steamy_room:, Person In Steamy Room
-0xfc9af391, // U+1F935 🤵, \:person_in_tuxedo:, Man In Tuxedo
-0x137cf2d1, // U+026F9 ⛹, \:person_with_ball:, Person Bouncing Ball
-0xfa38c457, // U+1F471 👱, \:person_with_blond_hair:, Person With Blond Hair
-0xfd62a352, // U+1FAC5 🫅, \:person_with_crown:, Person With Crown
-0xfcead156, // U+1F9D5 🧕, \:person_with_headscarf:, Person With Headscarf
-0xfb276119, // U+1F64E 🙎, \:person_with_pouting_face:, Person With Pouting Face
-0xfcf5e1cb, // U+1F9EB 🧫, \:petri_dish:, Petri Dish
-0x13071106, // U+0260E ☎, \:phone:, Black Telephone
-0x1367e285, // U+026CF ⛏, \:pick:, Pick
-0xfb7de28d, // U+1F6FB 🛻, \:pickup_truck:, Pickup Truck
-0xfcb3c104, // U+1F967 🥧, \:pie:, Pie
-0xfa1bc184, // U+1F437 🐷, \:pig:, Pig Face
-0xfa0b2445, // U+1F416 🐖, \:pig2:, Pig
-0xfa1ee109, // U+1F43D 🐽, \:pig_nose:, Pig Nose
-0xfa4572c5, // U+1F48A 💊, \:pill:, Pill
-0xfd42f007, // U+1FA85 🪅, \:pinata:, Pinata
-0xfc865490, // U+1F90C 🤌, \:pinched_fingers:, Pinched Fingers
-0xfc8790ce, // U+1F90F 🤏, \:pinching_hand:, Pinching Hand
-0xf9a6f10a, // U+1F34D 🍍, \:pineapple:, Pineapple
-0xfd3bd4cb, // U+1FA77 🩷, \:pink_heart:, Pink Heart
-0x13298487, // U+02653 ♓, \:pisces:, Pisces
-0xf9aad006, // U+1F355 🍕, \:pizza:, Slice Of Pizza
-0xfd53d0c8, // U+1FAA7 🪧, \:placard:, Placard
-0xfb6843d1, // U+1F6D0 🛐, \:place_of_worship:, Place Of Worship
-0xfb6ef111, // U+1F6DD 🛝, \:playground_slide:, Playground Slide
-0xfcbd610e, // U+1F97A 🥺, \:pleading_face:, Face With Pleading Eyes
-0xfd500448, // U+1FAA0 🪠, \:plunger:, Plunger
-0xfa23a34b, // U+1F447 👇, \:point_down:, White Down Pointing Backhand Index
-0xfa2414cb, // U+1F448 👈, \:point_left:, White Left Pointing Backhand Index
-0xfa24b4cc, // U+1F449 👉, \:point_right:, White Right Pointing Backhand Index
-0x130e83c9, // U+0261D ☝, \:point_up:, White Up Pointing Index
-0xfa23244b, // U+1F446 👆, \:point_up_2:, White Up Pointing Backhand Index
-0xfb49c44b, // U+1F693 🚓, \:police_car:, Police Car
-0xfa14f107, // U+1F429 🐩, \:poodle:, Poodle
-0xfa54a3c5, // U+1F4A9 💩, \:poop:, Pile Of Poo
-0xf9bfd348, // U+1F37F 🍿, \:popcorn:, Popcorn
-0xf9f1e10c, // U+1F3E3 🏣, \:post_office:, Japanese Post Office
-0xfa77d34c, // U+1F4EF 📯, \:postal_horn:, Postal Horn
-0xfa7725c8, // U+1F4EE 📮, \:postbox:, Postbox
-0xfb58044e, // U+1F6B0 🚰, \:potable_water:, Potable Water Symbol
-0xfcaa7387, // U+1F954 🥔, \:potato:, Potato
-0xfd5a14cd, // U+1FAB4 🪴, \:potted_plant:, Potted Plant
-0xfa2ee1c6, // U+1F45D 👝, \:pouch:, Pouch
-0xf9ab818c, // U+1F357 🍗, \:poultry_leg:, Poultry Leg
-0xfa5b90c6, // U+1F4B7 💷, \:pound:, Banknote With Pound Sign
-0xfd6bc0cf, // U+1FAD7 🫗, \:pouring_liquid:, Pouring Liquid
-0xfb1f44cc, // U+1F63E 😾, \:pouting_cat:, Pouting Cat Face
-0xfb27c605, // U+1F64F 🙏, \:pray:, Person With Folded Hands
-0xfa7ff48d, // U+1F4FF 📿, \:prayer_beads:, Prayer Beads
-0xfd61c34d, // U+1FAC3 🫃, \:pregnant_man:, Pregnant Man
-0xfd622350, // U+1FAC4 🫄, \:pregnant_person:, Pregnant Person
-0xfc98434f, // U+1F930 🤰, \:pregnant_woman:, Pregnant Woman
-0xfcb402c8, // U+1F968 🥨, \:pretzel:, Pretzel
-0xfc9a6107, // U+1F934 🤴, \:prince:, Prince
-0xfa3c6489, // U+1F478 👸, \:princess:, Princess
-0xfad40448, // U+1F5A8 🖨, \:printer:, Printer
-0xfcd7910d, // U+1F9AF 🦯, \:probing_cane:, Probing Cane
-0xfa2561c6, // U+1F44A 👊, \:punch:, Fisted Hand Sign
-0xfa4e54cd, // U+1F49C 💜, \:purple_heart:, Purple Heart
-0xfa2de106, // U+1F45B 👛, \:purse:, Purse
-0xfa664348, // U+1F4CC 📌, \:pushpin:, Pushpin
-0xfb576118, // U+1F6AE 🚮, \:put_litter_in_its_place:, Put Litter In Its Place Symbol
-0x13a9a349, // U+02753 ❓, \:question:, Black Question Mark Ornament
-0xfa1844c7, // U+1F430 🐰, \:rabbit:, Rabbit Face
-0xfa03f448, // U+1F407 🐇, \:rabbit2:, Rabbit
-0xfccea348, // U+1F99D 🦝, \:raccoon:, Raccoon
-0xfa07610a, // U+1F40E 🐎, \:racehorse:, Horse
-0xf9e7444b, // U+1F3CE 🏎, \:racing_car:, Racing Car
-0xf9e6f112, // U+1F3CD 🏍, \:racing_motorcycle:, Motorcycle
-0xfa7dc386, // U+1F4FB 📻, \:radio:, Radio
-0xfa8c234d, // U+1F518 🔘, \:radio_button:, Radio Button
-0x13112351, // U+02622 ☢, \:radioactive_sign:, Radioactive
-0xfb10a105, // U+1F621 😡, \:rage:, Pouting Face
-0xfb41c44c, // U+1F683 🚃, \:railway_car:, Railway Car
-0xfb72628e, // U+1F6E4 🛤, \:railway_track:, Railway Track
-0xf99380cb, // U+1F327 🌧, \:rain_cloud:, Cloud With Rain
-0xf9842588, // U+1F308 🌈, \:rainbow:, Rainbow
-0xfc8d10d4, // U+1F91A 🤚, \:raised_back_of_hand:, Raised Back Of Hand
-0x138590cc, // U+0270B ✋, \:raised_hand:, Raised Hand
-0xfac800e1, // U+1F590 🖐, \:raised_hand_with_fingers_splayed:, Hand With Fingers Splayed
-0xfb26748d, // U+1F64C 🙌, \:raised_hands:, Person Raising Both Hands In Celebration
-0xfb2590cd, // U+1F64B 🙋, \:raising_hand:, Happy Person Raising One Hand
-0xfa07c304, // U+1F40F 🐏, \:ram:, Ram
-0xf9ae0346, // U+1F35C 🍜, \:ramen:, Steaming Bowl
-0xfa0044c4, // U+1F400 🐀, \:rat:, Rat
-0xfd492446, // U+1FA92 🪒, \:razor:, Razor
-0xfcff34c8, // U+1F9FE 🧾, \:receipt:, Receipt
-0x133df108, // U+0267B ♻, \:recycle:, Black Universal Recycling Symbol
-0xfb4bc448, // U+1F697 🚗, \:red_car:, Automobile
-0xfa9a710b, // U+1F534 🔴, \:red_circle:, Large Red Circle
-0xfcf3b10d, // U+1F9E7 🧧, \:red_envelope:, Red Gift Envelope
-0x005700cb, // U+000AE ®, \:registered:, Registered Sign
-0x131d00c8, // U+0263A ☺, \:relaxed:, White Smiling Face
-0xfb0600c9, // U+1F60C 😌, \:relieved:, Relieved Face
-0xf9cba350, // U+1F397 🎗, \:reminder_ribbon:, Reminder Ribbon
-0xfa80c4c7, // U+1F501 🔁, \:repeat:, Clockwise Rightwards And Leftwards Open Circle Arrows
-0xfa81110b, // U+1F502 🔂, \:repeat_one:, Clockwise Rightwards And Leftwards Open Circle Arrows With Circled One Overlay
-0xfb5da309, // U+1F6BB 🚻, \:restroom:, Restroom
-0xfaca80ea, // U+1F595 🖕, \:reversed_hand_with_middle_finger_extended:, Reversed Hand With Middle Finger Extended
-0xfa4f7491, // U+1F49E 💞, \:revolving_hearts:, Revolving Hearts
-0x11f510c7, // U+023EA ⏪, \:rewind:, Black Left-Pointing Double Triangle
-0xfcc7a48b, // U+1F98F 🦏, \:rhinoceros:, Rhinoceros
-0xf9c02347, // U+1F380 🎀, \:ribbon:, Ribbon
-0xf9ad6105, // U+1F35A 🍚, \:rice:, Cooked Rice
-0xf9acf2ca, // U+1F359 🍙, \:rice_ball:, Rice Ball
-0xf9ac044d, // U+1F358 🍘, \:rice_cracker:, Rice Cracker
-0xf9c8910b, // U+1F391 🎑, \:rice_scene:, Moon Viewing Ceremony
-0xfc8e64d2, // U+1F91C 🤜, \:right-facing_fist:, Right-Facing Fist
-0xfaf7f113, // U+1F5EF 🗯, \:right_anger_bubble:, Right Anger Bubble
-0xfd7890d0, // U+1FAF1 🫱, \:rightwards_hand:, Rightwards Hand
-0xfd7c10d8, // U+1FAF8 🫸, \:rightwards_pushing_hand:, Rightwards Pushing Hand
-0xfa469185, // U+1F48D 💍, \:ring:, Ring
-0xfb6fa60a, // U+1F6DF 🛟, \:ring_buoy:, Ring Buoy
-0xfd4804ce, // U+1FA90 🪐, \:ringed_planet:, Ringed Planet
-0xfc8b610b, // U+1F916 🤖, \:robot_face:, Robot Face
-0xfd546285, // U+1FAA8 🪨, \:rock:, Rock
-0xfb4004c7, // U+1F680 🚀, \:rocket:, Rocket
-0xfcfd844e, // U+1F9FB 🧻, \:roll_of_paper:, Roll Of Paper
-0xfaef0454, // U+1F5DE 🗞, \:rolled_up_newspaper:, Rolled-Up Newspaper
-0xf9d1044f, // U+1F3A2 🎢, \:roller_coaster:, Roller Coaster
-0xfb7e710d, // U+1F6FC 🛼, \:roller_skate:, Roller Skate
-0xfc91919e, // U+1F923 🤣, \:rolling_on_the_floor_laughing:, Rolling On The Floor Laughing
-0xfa098448, // U+1F413 🐓, \:rooster:, Rooster
-0xf99ce105, // U+1F339 🌹, \:rose:, Rose
-0xf9faf108, // U+1F3F5 🏵, \:rosette:, Rosette
-0xfb5434cf, // U+1F6A8 🚨, \:rotating_light:, Police Cars Revolving Light
-0xfa66c34e, // U+1F4CD 📍, \:round_pushpin:, Round Pushpin
-0xfb51c4c8, // U+1F6A3 🚣, \:rowboat:, Rowboat
-0xf9e4f2cf, // U+1F3C9 🏉, \:rugby_football:, Rugby Football
-0xf9e18447, // U+1F3C3 🏃, \:runner:, Runner
-0xf9e19188, // U+1F3C3 🏃, \:running:, Runner
-0xf9dee1d8, // U+1F3BD 🎽, \:running_shirt_with_sash:, Running Shirt With Sash
-0xf9010003, // U+1F202 🈂, \:sa:, Squared Katakana Sa
-0xfcfbc34b, // U+1F9F7 🧷, \:safety_pin:, Safety Pin
-0xfcdd64cc, // U+1F9BA 🦺, \:safety_vest:, Safety Vest
-0x1328048c, // U+02650 ♐, \:sagittarius:, Sagittarius
-0x137ac4c9, // U+026F5 ⛵, \:sailboat:, Sailboat
-0xf9bb6105, // U+1F376 🍶, \:sake:, Sake Bottle And Cup
-0xfce174c5, // U+1F9C2 🧂, \:salt:, Salt Shaker
-0xfd70e10e, // U+1FAE1 🫡, \:saluting_face:, Saluting Face
-0xfa30c2c7, // U+1F461 👡, \:sandal:, Womans Sandal
-0xfcb561c9, // U+1F96A 🥪, \:sandwich:, Sandwich
-0xf9c2f006, // U+1F385 🎅, \:santa:, Father Christmas
-0xfcbdd205, // U+1F97B 🥻, \:sari:, Sari
-0xfb78710a, // U+1F6F0 🛰, \:satellite:, Satellite
-0xfa709012, // U+1F4E1 📡, \:satellite_antenna:, Satellite Antenna
-0xfb0300ca, // U+1F606 😆, \:satisfied:, Smiling Face With Open Mouth And Tightly-Closed Eyes
-0xfccaa0c9, // U+1F995 🦕, \:sauropod:, Sauropod
-0xf9db910a, // U+1F3B7 🎷, \:saxophone:, Saxophone
-0x134b0487, // U+02696 ⚖, \:scales:, Balance Scale
-0xfcf1d146, // U+1F9E3 🧣, \:scarf:, Scarf
-0xf9f5a2c7, // U+1F3EB 🏫, \:school:, School
-0xf9c902cf, // U+1F392 🎒, \:school_satchel:, School Satchel
-0x13815489, // U+02702 ✂, \:scissors:, Black Scissors
-0xfb7a0448, // U+1F6F4 🛴, \:scooter:, Scooter
-0xfcc12349, // U+1F982 🦂, \:scorpion:, Scorpion
-0x13278489, // U+0264F ♏, \:scorpius:, Scorpius
-0xfb18c307, // U+1F631 😱, \:scream:, Face Screaming In Fear
-0xfb2044cb, // U+1F640 🙀, \:scream_cat:, Weary Cat Face
-0xfd4d844c, // U+1FA9B 🪛, \:screwdriver:, Screwdriver
-0xfa6e72c7, // U+1F4DC 📜, \:scroll:, Scroll
-0xfcd6c2c5, // U+1F9AD 🦭, \:seal:, Seal
-0xfa5d44c5, // U+1F4BA 💺, \:seat:, Seat
-0xfca442d3, // U+1F948 🥈, \:second_place_medal:, Second Place Medal
-0x194c84c7, // U+03299 ㊙, \:secret:, Circled Ideograph Secret
-0xfb2442cc, // U+1F648 🙈, \:see_no_evil:, See-No-Evil Monkey
-0xf9989189, // U+1F331 🌱, \:seedling:, Seedling
-0xfc99c107, // U+1F933 🤳, \:selfie:, Selfie
-0xfc9671e9, // U+1F92C 🤬, \:serious_face_with_symbols_covering_mouth:, Serious Face With Symbols Covering Mouth
-0xfd50f10e, // U+1FAA1 🪡, \:sewing_needle:, Sewing Needle
-0xfd74610d, // U+1FAE8 🫨, \:shaking_face:, Shaking Face
-0xfcac20d4, // U+1F958 🥘, \:shallow_pan_of_food:, Shallow Pan Of Food
-0x130c6289, // U+02618 ☘, \:shamrock:, Shamrock
-0xfcc45286, // U+1F988 🦈, \:shark:, Shark
-0xf9b3e10b, // U+1F367 🍧, \:shaved_ice:, Shaved Ice
-0xfa0883c6, // U+1F411 🐑, \:sheep:, Sheep
-0xfa0d72c6, // U+1F41A 🐚, \:shell:, Spiral Shell
-0xfb70f0c7, // U+1F6E1 🛡, \:shield:, Shield
-0x1374910e, // U+026E9 ⛩, \:shinto_shrine:, Shinto Shrine
-0xfb5143c5, // U+1F6A2 🚢, \:ship:, Ship
-0xfa2ad4c6, // U+1F455 👕, \:shirt:, T-Shirt
-0xfa54c4c5, // U+1F4A9 💩, \:shit:, Pile Of Poo
-0xfc97c0e1, // U+1F92F 🤯, \:shocked_face_with_exploding_head:, Shocked Face With Exploding Head
-0xfa2f2105, // U+1F45E 👞, \:shoe:, Mans Shoe
-0xfb66a48e, // U+1F6CD 🛍, \:shopping_bags:, Shopping Bags
-0xfb690611, // U+1F6D2 🛒, \:shopping_trolley:, Shopping Trolley
-0xfd39f487, // U+1FA73 🩳, \:shorts:, Shorts
-0xfb5f8447, // U+1F6BF 🚿, \:shower:, Shower
-0xfcc803c7, // U+1F990 🦐, \:shrimp:, Shrimp
-0xfc9b8186, // U+1F937 🤷, \:shrug:, Shrug
-0xfc95e10e, // U+1F92B 🤫, \:shushing_face:, Face With Finger Covering Closed Lips
-0xfc8c1492, // U+1F918 🤘, \:sign_of_the_horns:, Sign Of The Horns
-0xfa7b71d0, // U+1F4F6 📶, \:signal_strength:, Antenna With Bars
-0xfa97c451, // U+1F52F 🔯, \:six_pointed_star:, Six Pointed Star With Middle Dot
-0xfb7cd0cb, // U+1F6F9 🛹, \:skateboard:, Skateboard
-0xf9dfe204, // U+1F3BF 🎿, \:ski:, Ski And Ski Boot
-0x137b8446, // U+026F7 ⛷, \:skier:, Skier
-0xf9fd844c, // U+1F3FB 🏻, \:skin-tone-2:, Emoji Modifier Fitzpatrick Type-1-2
-0xf9fe048c, // U+1F3FC 🏼, \:skin-tone-3:, Emoji Modifier Fitzpatrick Type-3
-0xf9fe84cc, // U+1F3FD 🏽, \:skin-tone-4:, Emoji Modifier Fitzpatrick Type-4
-0xf9ff050c, // U+1F3FE 🏾, \:skin-tone-5:, Emoji Modifier Fitzpatrick Type-5
-0xf9ff854c, // U+1F3FF 🏿, \:skin-tone-6:, Emoji Modifier Fitzpatrick Type-6
-0xfa4072c6, // U+1F480 💀, \:skull:, Skull
-0x13100495, // U+02620 ☠, \:skull_and_crossbones:, Skull And Crossbones
-0xfcd41286, // U+1F9A8 🦨, \:skunk:, Skunk
-0xfb7b80c5, // U+1F6F7 🛷, \:sled:, Sled
-0xfb1a1189, // U+1F634 😴, \:sleeping:, Sleeping Face
-0xfb662357, // U+1F6CC 🛌, \:sleeping_accommodation:, Sleeping Accommodation
-0xfb153607, // U+1F62A 😪, \:sleepy:, Sleepy Face
-0xfabab60e, // U+1F575 🕵, \:sleuth_or_spy:, Detective
-0xfb20e117, // U+1F641 🙁, \:slightly_frowning_face:, Slightly Frowning Face
-0xfb216116, // U+1F642 🙂, \:slightly_smiling_face:, Slightly Smiling Face
-0xf9d8110d, // U+1F3B0 🎰, \:slot_machine:, Slot Machine
-0xfcd2f1c6, // U+1F9A5 🦥, \:sloth:, Sloth
-0xfb74910f, // U+1F6E9 🛩, \:small_airplane:, Small Airplane
-0xfa9c90d3, // U+1F539 🔹, \:small_blue_diamond:, Small Blue Diamond
-0xfa9c10d5, // U+1F538 🔸, \:small_orange_diamond:, Small Orange Diamond
-0xfa9d7113, // U+1F53A 🔺, \:small_red_triangle:, Up-Pointing Red Triangle
-0xfa9da358, // U+1F53B 🔻, \:small_red_triangle_down:, Down-Pointing Red Triangle
-0xfb027106, // U+1F604 😄, \:smile:, Smiling Face With Open Mouth And Smiling Eyes
-0xfb1c44ca, // U+1F638 😸, \:smile_cat:, Grinning Cat Face With Smiling Eyes
-0xfb018607, // U+1F603 😃, \:smiley:, Smiling Face With Open Mouth
-0xfb1d44cb, // U+1F63A 😺, \:smiley_cat:, Smiling Cat Face With Open Mouth
-0xfcb8749b, // U+1F970 🥰, \:smiling_face_with_3_hearts:, Smiling Face With Smiling Eyes And Three Hearts
-0xfc96f1f7, // U+1F92D 🤭, \:smiling_face_with_smiling_eyes_and_hand_covering_mouth:, Smiling Face With Smiling Eyes And Hand Covering Mouth
-0xfcb94457, // U+1F972 🥲, \:smiling_face_with_tear:, Smiling Face With Tear
-0xfb0403cc, // U+1F608 😈, \:smiling_imp:, Smiling Face With Horns
-0xfb07d286, // U+1F60F 😏, \:smirk:, Smirking Face
-0xfb1e44ca, // U+1F63C 😼, \:smirk_cat:, Cat Face With Wry Smile
-0xfb561188, // U+1F6AC 🚬, \:smoking:, Smoking Symbol
-0xfa0642c6, // U+1F40C 🐌, \:snail:, Snail
-0xfa06e106, // U+1F40D 🐍, \:snake:, Snake
-0xfc93e10e, // U+1F927 🤧, \:sneezing_face:, Sneezing Face
-0xf9ea4355, // U+1F3D4 🏔, \:snow_capped_mountain:, Snow-Capped Mountain
-0xf99400cb, // U+1F328 🌨, \:snow_cloud:, Cloud With Snow
-0xf9e1044c, // U+1F3C2 🏂, \:snowboarder:, Snowboarder
-0x13a2610a, // U+02744 ❄, \:snowflake:, Snowflake
-0x1301c348, // U+02603 ☃, \:snowman:, Snowman
-0x13622595, // U+026C4 ⛄, \:snowman_without_snow:, Snowman Without Snow
-0xfcfe43c5, // U+1F9FC 🧼, \:soap:, Bar Of Soap
-0xfb16a044, // U+1F62D 😭, \:sob:, Loudly Crying Face
-0x135e8447, // U+026BD ⚽, \:soccer:, Soccer Ball
-0xfcf36486, // U+1F9E6 🧦, \:socks:, Socks
-0xfca772c9, // U+1F94E 🥎, \:softball:, Softball
-0xfa8e2345, // U+1F51C 🔜, \:soon:, Soon With Rightwards Arrow Above
-0xf8cc2484, // U+1F198 🆘, \:sos:, Squared Sos
-0xfa8490c6, // U+1F509 🔉, \:sound:, Speaker With One Sound Wave
-0xfa3f044e, // U+1F47E 👾, \:space_invader:, Alien Monster
-0x13300487, // U+02660 ♠, \:spades:, Black Spade Suit
-0xf9aef20a, // U+1F35D 🍝, \:spaghetti:, Spaghetti
-0x13a3f108, // U+02747 ❇, \:sparkle:, Sparkle
-0xf9c38449, // U+1F387 🎇, \:sparkler:, Firework Sparkler
-0x13940489, // U+02728 ✨, \:sparkles:, Sparkles
-0xfa4b54d0, // U+1F496 💖, \:sparkling_heart:, Sparkling Heart
-0xfb2542ce, // U+1F64A 🙊, \:speak_no_evil:, Speak-No-Evil Monkey
-0xfa840448, // U+1F508 🔈, \:speaker:, Speaker
-0xfaf1f11c, // U+1F5E3 🗣, \:speaking_head_in_silhouette:, Speaking Head
-0xfa56234f, // U+1F4AC 💬, \:speech_balloon:, Speech Balloon
-0xfb5244ca, // U+1F6A4 🚤, \:speedboat:, Speedboat
-0xfabb8447, // U+1F577 🕷, \:spider:, Spider
-0xfabc004b, // U+1F578 🕸, \:spider_web:, Spider Web
-0xfae9c0d4, // U+1F5D3 🗓, \:spiral_calendar_pad:, Spiral Calendar
-0xfae940d0, // U+1F5D2 🗒, \:spiral_note_pad:, Spiral Notepad
-0xfacb10cb, // U+1F596 🖖, \:spock-hand:, Raised Hand With Part Between Middle And Ring Fingers
-0xfcfea107, // U+1F9FD 🧽, \:sponge:, Sponge
-0xfca22346, // U+1F944 🥄, \:spoon:, Spoon
-0xf9e2c2cd, // U+1F3C5 🏅, \:sports_medal:, Sports Medal
-0xfcc8c0c6, // U+1F991 🦑, \:squid:, Squid
-0xf9ef8308, // U+1F3DF 🏟, \:stadium:, Stadium
-0x134a8495, // U+02695 ⚕, \:staff_of_aesculapius:, Medical Symbol
-0xfce6a350, // U+1F9CD 🧍, \:standing_person:, Standing Person
-0x15a84445, // U+02B50 ⭐, \:star:, White Medium Star
-0xfc94e28c, // U+1F929 🤩, \:star-struck:, Grinning Face With Star Eyes
-0xf98fd446, // U+1F31F 🌟, \:star2:, Glowing Star
-0x131514d2, // U+0262A ☪, \:star_and_crescent:, Star And Crescent
-0x1390c0ce, // U+02721 ✡, \:star_of_david:, Star Of David
-0xf9905486, // U+1F320 🌠, \:stars:, Shooting Star
-0xfb44a348, // U+1F689 🚉, \:station:, Station
-0xfafef612, // U+1F5FD 🗽, \:statue_of_liberty:, Statue Of Liberty
-0xfb411111, // U+1F682 🚂, \:steam_locomotive:, Steam Locomotive
-0xfd3d310c, // U+1FA7A 🩺, \:stethoscope:, Stethoscope
-0xf9b90585, // U+1F372 🍲, \:stew:, Pot Of Food
-0x11f8e1ca, // U+023F1 ⏱, \:stopwatch:, Stopwatch
-0xfa67844f, // U+1F4CF 📏, \:straight_ruler:, Straight Ruler
-0xf9a9d60b, // U+1F353 🍓, \:strawberry:, Strawberry
-0xfb0d8111, // U+1F61B 😛, \:stuck_out_tongue:, Face With Stuck-Out Tongue
-0xfb0e849d, // U+1F61D 😝, \:stuck_out_tongue_closed_eyes:, Face With Stuck-Out Tongue And Tightly-Closed Eyes
-0xfb0e411d, // U+1F61C 😜, \:stuck_out_tongue_winking_eye:, Face With Stuck-Out Tongue And Winking Eye
-0xf9cc9112, // U+1F399 🎙, \:studio_microphone:, Studio Microphone
-0xfcacc0d2, // U+1F959 🥙, \:stuffed_flatbread:, Stuffed Flatbread
-0xf99280d1, // U+1F325 🌥, \:sun_behind_cloud:, Sun Behind Large Cloud
-0xf99300d6, // U+1F326 🌦, \:sun_behind_rain_cloud:, Sun Behind Rain Cloud
-0xf99200d0, // U+1F324 🌤, \:sun_small_cloud:, Sun Behind Small Cloud
-0xf98f610e, // U+1F31E 🌞, \:sun_with_face:, Sun With Face
-0xf99d844a, // U+1F33B 🌻, \:sunflower:, Sunflower
-0xfb07048b, // U+1F60E 😎, \:sunglasses:, Smiling Face With Sunglasses
-0x13001606, // U+02600 ☀, \:sunny:, Black Sun With Rays
-0xf982e108, // U+1F305 🌅, \:sunrise:, Sunrise
-0xf9821497, // U+1F304 🌄, \:sunrise_over_mountains:, Sunrise Over Mountains
-0xfcdc538a, // U+1F9B8 🦸, \:superhero:, Superhero
-0xfcdcc34d, // U+1F9B9 🦹, \:supervillain:, Supervillain
-0xf9e20447, // U+1F3C4 🏄, \:surfer:, Surfer
-0xf9b1b206, // U+1F363 🍣, \:sushi:, Sushi
-0xfb4fc613, // U+1F69F 🚟, \:suspension_railway:, Suspension Railway
-0xfcd14345, // U+1F9A2 🦢, \:swan:, Swan
-0xfb09c4c6, // U+1F613 😓, \:sweat:, Face With Cold Sweat
-0xfa53348c, // U+1F4A6 💦, \:sweat_drops:, Splashing Sweat Symbol
-0xfb02f10c, // U+1F605 😅, \:sweat_smile:, Smiling Face With Open Mouth And Cold Sweat
-0xf9b0738d, // U+1F360 🍠, \:sweet_potato:, Roasted Sweet Potato
-0xf9e50448, // U+1F3CA 🏊, \:swimmer:, Swimmer
-0xfa91f488, // U+1F523 🔣, \:symbols:, Input Symbol For Symbols
-0xfaa6810a, // U+1F54D 🕍, \:synagogue:, Synagogue
-0xfa44a108, // U+1F489 💉, \:syringe:, Syringe
-0xfccb05c6, // U+1F996 🦖, \:t-rex:, T-Rex
-0xf9e9f2dd, // U+1F3D3 🏓, \:table_tennis_paddle_and_ball:, Table Tennis Paddle And Ball
-0xf9976385, // U+1F32E 🌮, \:taco:, Taco
-0xf9c4f005, // U+1F389 🎉, \:tada:, Party Popper
-0xfcb0a5cc, // U+1F961 🥡, \:takeout_box:, Takeout Box
-0xfd6a7107, // U+1FAD4 🫔, \:tamale:, Tamale
-0xf9c5810e, // U+1F38B 🎋, \:tanabata_tree:, Tanabata Tree
-0xf9a5110a, // U+1F34A 🍊, \:tangerine:, Tangerine
-0x13248487, // U+02649 ♉, \:taurus:, Taurus
-0xfb4ab205, // U+1F695 🚕, \:taxi:, Taxi
-0xf9ba8004, // U+1F375 🍵, \:tea:, Teacup Without Handle
-0xfd6b24c7, // U+1FAD6 🫖, \:teapot:, Teapot
-0xfcfc444b, // U+1F9F8 🧸, \:teddy_bear:, Teddy Bear
-0x1307110a, // U+0260E ☎, \:telephone:, Black Telephone
-0xfa6f0453, // U+1F4DE 📞, \:telephone_receiver:, Telephone Receiver
-0xfa96b10a, // U+1F52D 🔭, \:telescope:, Telescope
-0xf9df4487, // U+1F3BE 🎾, \:tennis:, Tennis Racquet And Ball
-0x137d14c5, // U+026FA ⛺, \:tent:, Tent
-0xfcf5510a, // U+1F9EA 🧪, \:test_tube:, Test Tube
-0xfc8c148a, // U+1F918 🤘, \:the_horns:, Sign Of The Horns
-0xf990844c, // U+1F321 🌡, \:thermometer:, Thermometer
-0xfc8a610e, // U+1F914 🤔, \:thinking_face:, Thinking Face
-0xfca4c2d2, // U+1F949 🥉, \:third_place_medal:, Third Place Medal
-0xfd3a42cd, // U+1FA74 🩴, \:thong_sandal:, Thong Sandal
-0xfa56a350, // U+1F4AD 💭, \:thought_balloon:, Thought Balloon
-0xfcfac0c7, // U+1F9F5 🧵, \:thread:, Spool Of Thread
-0xfad8e113, // U+1F5B1 🖱, \:three_button_mouse:, Computer Mouse
-0xfa27234b, // U+1F44E 👎, \:thumbsdown:, Thumbs Down Sign
-0xfa2683c9, // U+1F44D 👍, \:thumbsup:, Thumbs Up Sign
-0x13644357, // U+026C8 ⛈, \:thunder_cloud_and_rain:, Cloud With Lightning And Rain
-0xf9d584c7, // U+1F3AB 🎫, \:ticket:, Ticket
-0xfa178446, // U+1F42F 🐯, \:tiger:, Tiger Face
-0xfa02d447, // U+1F405 🐅, \:tiger2:, Tiger
-0x11f9628c, // U+023F2 ⏲, \:timer_clock:, Timer Clock
-0xfb15e10b, // U+1F62B 😫, \:tired_face:, Tired Face
-0x10910303, // U+02122 ™, \:tm:, Trade Mark Sign
-0xfb5e84c7, // U+1F6BD 🚽, \:toilet:, Toilet
-0xfafe044c, // U+1F5FC 🗼, \:tokyo_tower:, Tokyo Tower
-0xf9a2f387, // U+1F345 🍅, \:tomato:, Tomato
-0xfa228107, // U+1F445 👅, \:tongue:, Tongue
-0xfcf825c8, // U+1F9F0 🧰, \:toolbox:, Toolbox
-0xfcdbf1c6, // U+1F9B7 🦷, \:tooth:, Tooth
-0xfd52e1cb, // U+1FAA5 🪥, \:toothbrush:, Toothbrush
-0xfa8ea3c4, // U+1F51D 🔝, \:top:, Top With Upwards Arrow Above
-0xf9d4c4c7, // U+1F3A9 🎩, \:tophat:, Top Hat
-0xf9957388, // U+1F32A 🌪, \:tornado:, Tornado
-0xf99500ce, // U+1F32A 🌪, \:tornado_cloud:, Tornado
-0xfad972ca, // U+1F5B2 🖲, \:trackball:, Trackball
-0xfb4e2448, // U+1F69C 🚜, \:tractor:, Tractor
-0xfb52b4ce, // U+1F6A5 🚥, \:traffic_light:, Horizontal Traffic Light
-0xfb45c346, // U+1F68B 🚋, \:train:, Tram Car
-0xfb431447, // U+1F686 🚆, \:train2:, Train
-0xfb454305, // U+1F68A 🚊, \:tram:, Tram
-0x1353a2d3, // U+026A7 ⚧, \:transgender_symbol:, Transgender Symbol
-0xfb54e4d8, // U+1F6A9 🚩, \:triangular_flag_on_post:, Triangular Flag On Post
-0xfa680451, // U+1F4D0 📐, \:triangular_ruler:, Triangular Ruler
-0xfa9894c8, // U+1F531 🔱, \:trident:, Trident Emblem
-0xfb1231c8, // U+1F624 😤, \:triumph:, Face With Look Of Triumph
-0xfce672c6, // U+1F9CC 🧌, \:troll:, Troll
-0xfb47048b, // U+1F68E 🚎, \:trolleybus:, Trolleybus
-0xf9e33607, // U+1F3C6 🏆, \:trophy:, Trophy
-0xf9bc928f, // U+1F379 🍹, \:tropical_drink:, Tropical Drink
-0xfa1061ce, // U+1F420 🐠, \:tropical_fish:, Tropical Fish
-0xfb4d6286, // U+1F69A 🚚, \:truck:, Delivery Truck
-0xf9dd04c8, // U+1F3BA 🎺, \:trumpet:, Trumpet
-0xfa2ad4c7, // U+1F455 👕, \:tshirt:, T-Shirt
-0xf99bc3c6, // U+1F337 🌷, \:tulip:, Tulip
-0xfca1e48e, // U+1F943 🥃, \:tumbler_glass:, Tumbler Glass
-0xfcc18607, // U+1F983 🦃, \:turkey:, Turkey
-0xfa117107, // U+1F422 🐢, \:turtle:, Turtle
-0xfa7d0543, // U+1F4FA 📺, \:tv:, Television
-0xfa80249a, // U+1F500 🔀, \:twisted_rightwards_arrows:, Twisted Rightwards Arrows
-0xfa4af48b, // U+1F495 💕, \:two_hearts:, Two Hearts
-0xfa367496, // U+1F46C 👬, \:two_men_holding_hands:, Two Men Holding Hands
-0xfa36f498, // U+1F46D 👭, \:two_women_holding_hands:, Two Women Holding Hands
-0xf91ca446, // U+1F239 🈹, \:u5272:, Squared Cjk Unified Ideograph-5272
-0xf91a35c6, // U+1F234 🈴, \:u5408:, Squared Cjk Unified Ideograph-5408
-0xf91d5546, // U+1F23A 🈺, \:u55b6:, Squared Cjk Unified Ideograph-55B6
-0xf917b586, // U+1F22F 🈯, \:u6307:, Squared Cjk Unified Ideograph-6307
-0xf91bb5c6, // U+1F237 🈷, \:u6708:, Squared Cjk Unified Ideograph-6708
-0xf91b3606, // U+1F236 🈶, \:u6709:, Squared Cjk Unified Ideograph-6709
-0xf91ab3c6, // U+1F235 🈵, \:u6e80:, Squared Cjk Unified Ideograph-6E80
-0xf90d5406, // U+1F21A 🈚, \:u7121:, Squared Cjk Unified Ideograph-7121
-0xf91c6486, // U+1F238 🈸, \:u7533:, Squared Cjk Unified Ideograph-7533
-0xf9193406, // U+1F232 🈲, \:u7981:, Squared Cjk Unified Ideograph-7981
-0xf919a006, // U+1F233 🈳, \:u7a7a:, Squared Cjk Unified Ideograph-7A7A
-0x13017009, // U+02602 ☂, \:umbrella:, Umbrella
-0x137890d3, // U+026F1 ⛱, \:umbrella_on_ground:, Umbrella On Ground
-0x130a3499, // U+02614 ☔, \:umbrella_with_rain_drops:, Umbrella With Rain Drops
-0xfb0900c9, // U+1F612 😒, \:unamused:, Unamused Face
-0xfa8f2109, // U+1F51E 🔞, \:underage:, No One Under Eighteen Symbol
-0xfcc2610d, // U+1F984 🦄, \:unicorn_face:, Unicorn Face
-0xfa89e287, // U+1F513 🔓, \:unlock:, Open Lock
-0xf8cc83c3, // U+1F199 🆙, \:up:, Squared Up With Exclamation Mark
-0xfb21e111, // U+1F643 🙃, \:upside_down_face:, Upside-Down Face
-0x13860542, // U+0270C ✌, \:v:, Victory Hand
-0xfcedd108, // U+1F9DB 🧛, \:vampire:, Vampire
-0xfb5334d7, // U+1F6A6 🚦, \:vertical_traffic_light:, Vertical Traffic Light
-0xfa7e3484, // U+1F4FC 📼, \:vhs:, Videocassette
-0xfa79f10f, // U+1F4F3 📳, \:vibration_mode:, Vibration Mode
-0xfa7cd00d, // U+1F4F9 📹, \:video_camera:, Video Camera
-0xf9d7010b, // U+1F3AE 🎮, \:video_game:, Video Game
-0xf9ddc347, // U+1F3BB 🎻, \:violin:, Violin
-0x1326a386, // U+0264D ♍, \:virgo:, Virgo
-0xf9859388, // U+1F30B 🌋, \:volcano:, Volcano
-0xf9e872cb, // U+1F3D0 🏐, \:volleyball:, Volleyball
-0xf8cd0483, // U+1F19A 🆚, \:vs:, Squared Vs
-0xfce3f107, // U+1F9C7 🧇, \:waffle:, Waffle
-0xfb5b1188, // U+1F6B6 🚶, \:walking:, Pedestrian
-0xf98c2355, // U+1F318 🌘, \:waning_crescent_moon:, Waning Crescent Moon Symbol
-0xf98b2354, // U+1F316 🌖, \:waning_gibbous_moon:, Waning Gibbous Moon Symbol
-0x13501188, // U+026A0 ⚠, \:warning:, Warning Sign
-0xfae884cc, // U+1F5D1 🗑, \:wastebasket:, Wastebasket
-0x118d61c6, // U+0231A ⌚, \:watch:, Watch
-0xfa01f38e, // U+1F403 🐃, \:water_buffalo:, Water Buffalo
-0xfc9ef38b, // U+1F93D 🤽, \:water_polo:, Water Polo
-0xf9a4a34b, // U+1F349 🍉, \:watermelon:, Watermelon
-0xfa259105, // U+1F44B 👋, \:wave:, Waving Hand Sign
-0xf9fa4192, // U+1F3F4 🏴, \:waving_black_flag:, Waving Black Flag
-0xf9f9c192, // U+1F3F3 🏳, \:waving_white_flag:, White Flag
-0x181861ca, // U+03030 〰, \:wavy_dash:, Wavy Dash
-0xf9892355, // U+1F312 🌒, \:waxing_crescent_moon:, Waxing Crescent Moon Symbol
-0xf98a2354, // U+1F314 🌔, \:waxing_gibbous_moon:, Waxing Gibbous Moon Symbol
-0xfb5f0083, // U+1F6BE 🚾, \:wc:, Water Closet
-0xfb14d606, // U+1F629 😩, \:weary:, Weary Face
-0xfa491188, // U+1F492 💒, \:wedding:, Wedding
-0xf9e5844e, // U+1F3CB 🏋, \:weight_lifter:, Person Lifting Weights
-0xfa19f106, // U+1F433 🐳, \:whale:, Spouting Whale
-0xfa058447, // U+1F40B 🐋, \:whale2:, Whale
-0xfb6f02c6, // U+1F6DE 🛞, \:wheel:, Wheel
-0x131c0010, // U+02638 ☸, \:wheel_of_dharma:, Wheel Of Dharma
-0x133fc44b, // U+0267F ♿, \:wheelchair:, Wheelchair Symbol
-0x1382d291, // U+02705 ✅, \:white_check_mark:, White Heavy Check Mark
-0x1355710d, // U+026AA ⚪, \:white_circle:, Medium White Circle
-0xfa57044d, // U+1F4AE 💮, \:white_flower:, White Flower
-0x131ce114, // U+02639 ☹, \:white_frowning_face:, Frowning Face
-0xfc86d4cc, // U+1F90D 🤍, \:white_heart:, White Heart
-0x158e5113, // U+02B1C ⬜, \:white_large_square:, White Large Square
-0x12fed11a, // U+025FD ◽, \:white_medium_small_square:, White Medium Small Square
-0x12fdd114, // U+025FB ◻, \:white_medium_square:, White Medium Square
-0x12d5d113, // U+025AB ▫, \:white_small_square:, White Small Square
-0xfa99a354, // U+1F533 🔳, \:white_square_button:, White Square Button
-0xfca0044e, // U+1F940 🥀, \:wilted_flower:, Wilted Flower
-0xf9966112, // U+1F32C 🌬, \:wind_blowing_face:, Wind Face
-0xf9c8010b, // U+1F390 🎐, \:wind_chime:, Wind Chime
-0xfd4fa587, // U+1FA9F 🪟, \:window:, Window
-0xf9bbe48b, // U+1F377 🍷, \:wine_glass:, Wine Glass
-0xfd5e9185, // U+1FABD 🪽, \:wing:, Wing
-0xfb049285, // U+1F609 😉, \:wink:, Winking Face
-0xfb6e6489, // U+1F6DC 🛜, \:wireless:, Wireless
-0xfa1d7145, // U+1F43A 🐺, \:wolf:, Wolf Face
-0xfa34c346, // U+1F469 👩, \:woman:, Woman
-0xfa35f49c, // U+1F46B 👫, \:woman_and_man_holding_hands:, Man And Woman Holding Hands
-0xfa2d048f, // U+1F45A 👚, \:womans_clothes:, Womans Clothes
-0xfcbfa111, // U+1F97F 🥿, \:womans_flat_shoe:, Flat Shoe
-0xfa2944cb, // U+1F452 👒, \:womans_hat:, Womans Hat
-0xfa36f494, // U+1F46D 👭, \:women_holding_hands:, Two Women Holding Hands
-0xfb5d1487, // U+1F6BA 🚺, \:womens:, Womens Symbol
-0xfd5aa0c5, // U+1FAB5 🪵, \:wood:, Wood
-0xfcba610b, // U+1F974 🥴, \:woozy_face:, Face With Uneven Eyes And Wavy Mouth
-0xfafd43ca, // U+1F5FA 🗺, \:world_map:, World Map
-0xfd58d305, // U+1FAB1 🪱, \:worm:, Worm
-0xfb0f80c8, // U+1F61F 😟, \:worried:, Worried Face
-0xfa93e1c7, // U+1F527 🔧, \:wrench:, Wrench
-0xfc9e548a, // U+1F93C 🤼, \:wrestlers:, Wrestlers
-0x138690cd, // U+0270D ✍, \:writing_hand:, Writing Hand
-0x13a605c2, // U+0274C ❌, \:x:, Cross Mark
-0xfd3dc606, // U+1FA7B 🩻, \:x-ray:, X-Ray
-0xfcfb5345, // U+1F9F6 🧶, \:yarn:, Ball Of Yarn
-0xfcb8e10d, // U+1F971 🥱, \:yawning_face:, Yawning Face
-0xfa4dd4cd, // U+1F49B 💛, \:yellow_heart:, Yellow Heart
-0xfa5a0344, // U+1F4B4 💴, \:yen:, Banknote With Yen Sign
-0x13179189, // U+0262F ☯, \:yin_yang:, Yin Yang
-0xfd404386, // U+1FA80 🪀, \:yo-yo:, Yo-Yo
-0xfb058304, // U+1F60B 😋, \:yum:, Face Savouring Delicious Food
-0xfc95610a, // U+1F92A 🤪, \:zany_face:, Grinning Face With One Large And One Small Eye
-0x1350c3c4, // U+026A1 ⚡, \:zap:, High Voltage Sign
-0xfcc9e10b, // U+1F993 🦓, \:zebra_face:, Zebra Face
-0xfc886112, // U+1F910 🤐, \:zipper_mouth_face:, Zipper-Mouth Face
-0xfcefc107, // U+1F9DF 🧟, \:zombie:, Zombie
-0xfa525644, // U+1F4A4 💤, \:zzz:, Sleeping Symbol
+{0x7005, 0x2c34, 0xDCB7'D83D}, // U+1F4B7, 💷, \:pound:, Banknote With Pound Sign
+{0x6f0b, 0x284b, 0xDCE4'D83D}, // U+1F4E4, 📤, \:outbox_tray:, Outbox Tray
+{0x6404, 0x0e4e, 0xDD8C'D83E}, // U+1F98C, 🦌, \:deer:, Deer
+{0x720e, 0x2fe9, 0xDEA8'D83D}, // U+1F6A8, 🚨, \:rotating_light:, Police Cars Revolving Light
+{0x6b08, 0x1cb4, 0xDD98'D83E}, // U+1F998, 🦘, \:kangaroo:, Kangaroo
+{0x700c, 0x2c5a, 0xDCFF'D83D}, // U+1F4FF, 📿, \:prayer_beads:, Prayer Beads
+{0x6908, 0x1b33, 0xDDCA'D83E}, // U+1F9CA, 🧊, \:ice_cube:, Ice Cube
+{0x6d08, 0x2526, 0xDF44'D83C}, // U+1F344, 🍄, \:mushroom:, Mushroom
+{0x6111, 0x025b, 0xDE9B'D83D}, // U+1F69B, 🚛, \:articulated_lorry:, Articulated Lorry
+{0x7328, 0x318a, 0xDD2C'D83E}, // U+1F92C, 🤬, \:serious_face_with_symbols_covering_mouth:, Serious Face With Symbols Covering Mouth
+{0x6d09, 0x2515, 0xDD36'D83E}, // U+1F936, 🤶, \:mrs_claus:, Mother Christmas
+{0x7007, 0x29b5, 0xDE14'D83D}, // U+1F614, 😔, \:pensive:, Pensive Face
+{0x6b0f, 0x1d42, 0xDDCE'D83E}, // U+1F9CE, 🧎, \:kneeling_person:, Kneeling Person
+{0x6306, 0x08f5, 0xDD55'D83E}, // U+1F955, 🥕, \:carrot:, Carrot
+{0x7006, 0x28f9, 0xDD9C'D83E}, // U+1F99C, 🦜, \:parrot:, Parrot
+{0x7009, 0x2b29, 0xDF4D'D83C}, // U+1F34D, 🍍, \:pineapple:, Pineapple
+{0x6c0c, 0x1fca, 0xDF9A'D83C}, // U+1F39A, 🎚, \:level_slider:, Level Slider
+{0x6406, 0x0dff, 0xDC83'D83D}, // U+1F483, 💃, \:dancer:, Dancer
+{0x7006, 0x2b04, 0xDE85'D83E}, // U+1FA85, 🪅, \:pinata:, Pinata
+{0x6308, 0x0ada, 0xDD5F'D83D}, // U+1F55F, 🕟, \:clock430:, Clock Face Four-Thirty
+{0x6206, 0x0742, 0xDE72'D83E}, // U+1FA72, 🩲, \:briefs:, Briefs
+{0x6709, 0x178c, 0xDDAE'D83E}, // U+1F9AE, 🦮, \:guide_dog:, Guide Dog
+{0x6203, 0x07d5, 0xDE8C'D83D}, // U+1F68C, 🚌, \:bus:, Bus
+{0x6b06, 0x1cdc, 0xDC58'D83D}, // U+1F458, 👘, \:kimono:, Kimono
+{0x7009, 0x28a0, 0xDF34'D83C}, // U+1F334, 🌴, \:palm_tree:, Palm Tree
+{0x630d, 0x0bf0, 0xDF8A'D83C}, // U+1F38A, 🎊, \:confetti_ball:, Confetti Ball
+{0x6d06, 0x251f, 0xDCAA'D83D}, // U+1F4AA, 💪, \:muscle:, Flexed Biceps
+{0x620d, 0x0314, 0xDEC4'D83D}, // U+1F6C4, 🛄, \:baggage_claim:, Baggage Claim
+{0x6704, 0x165f, 0xDC67'D83D}, // U+1F467, 👧, \:girl:, Girl
+{0x630e, 0x0d3a, 0x2694}, // ⚔, \:crossed_swords:, Crossed Swords
+{0x6303, 0x08a7, 0xDE97'D83D}, // U+1F697, 🚗, \:car:, Automobile
+{0x6105, 0x00f2, 0xDE20'D83D}, // U+1F620, 😠, \:angry:, Angry Face
+{0x700e, 0x2891, 0xDEF3'D83E}, // U+1FAF3, 🫳, \:palm_down_hand:, Palm Down Hand
+{0x6203, 0x041c, 0xDECF'D83D}, // U+1F6CF, 🛏, \:bed:, Bed
+{0x650c, 0x1047, 0xDF0D'D83C}, // U+1F30D, 🌍, \:earth_africa:, Earth Globe Europe-Africa
+{0x620b, 0x0657, 0xDED0'D83E}, // U+1FAD0, 🫐, \:blueberries:, Blueberries
+{0x6309, 0x0d12, 0xDD50'D83E}, // U+1F950, 🥐, \:croissant:, Croissant
+{0x720c, 0x2fa9, 0xDEFC'D83D}, // U+1F6FC, 🛼, \:roller_skate:, Roller Skate
+{0x6e1e, 0x26c2, 0xDCD4'D83D}, // U+1F4D4, 📔, \:notebook_with_decorative_cover:, Notebook With Decorative Cover
+{0x6c11, 0x2018, 0xDD87'D83D}, // U+1F587, 🖇, \:linked_paperclips:, Linked Paperclips
+{0x680c, 0x1af3, 0xDD17'D83E}, // U+1F917, 🤗, \:hugging_face:, Hugging Face
+{0x6909, 0x1b29, 0xDF68'D83C}, // U+1F368, 🍨, \:ice_cream:, Ice Cream
+{0x6913, 0x1b80, 0xDE50'D83C}, // U+1F250, 🉐, \:ideograph_advantage:, Circled Ideograph Advantage
+{0x6804, 0x1a45, 0xDD73'D83D}, // U+1F573, 🕳, \:hole:, Hole
+{0x630c, 0x0968, 0xDDC0'D83E}, // U+1F9C0, 🧀, \:cheese_wedge:, Cheese Wedge
+{0x700e, 0x2c3a, 0xDED7'D83E}, // U+1FAD7, 🫗, \:pouring_liquid:, Pouring Liquid
+{0x6311, 0x0db6, 0xDCB1'D83D}, // U+1F4B1, 💱, \:currency_exchange:, Currency Exchange
+{0x6f01, 0x26f4, 0x2B55}, // ⭕, \:o:, Heavy Large Circle
+{0x6c13, 0x1e74, 0xDFE3'D83D}, // U+1F7E3, 🟣, \:large_purple_circle:, Large Purple Circle
+{0x6413, 0x0f76, 0x23F8}, // ⏸, \:double_vertical_bar:, Pause Button
+{0x6c13, 0x1e88, 0xDFEA'D83D}, // U+1F7EA, 🟪, \:large_purple_square:, Large Purple Square
+{0x6306, 0x0b9b, 0x2615}, // ☕, \:coffee:, Hot Beverage
+{0x6306, 0x0871, 0xDD6F'D83D}, // U+1F56F, 🕯, \:candle:, Candle
+{0x7505, 0x3be4, 0xDE38'D83C}, // U+1F238, 🈸, \:u7533:, Squared Cjk Unified Ideograph-7533
+{0x7305, 0x30e6, 0xDDE3'D83E}, // U+1F9E3, 🧣, \:scarf:, Scarf
+{0x620f, 0x0718, 0xDC70'D83D}, // U+1F470, 👰, \:bride_with_veil:, Bride With Veil
+{0x720a, 0x2ebe, 0xDD8F'D83E}, // U+1F98F, 🦏, \:rhinoceros:, Rhinoceros
+{0x7010, 0x2a4c, 0xDD35'D83E}, // U+1F935, 🤵, \:person_in_tuxedo:, Man In Tuxedo
+{0x6f0c, 0x2790, 0xDE8D'D83D}, // U+1F68D, 🚍, \:oncoming_bus:, Oncoming Bus
+{0x7311, 0x3782, 0xDD59'D83E}, // U+1F959, 🥙, \:stuffed_flatbread:, Stuffed Flatbread
+{0x720b, 0x2d69, 0xDE83'D83D}, // U+1F683, 🚃, \:railway_car:, Railway Car
+{0x6204, 0x06ae, 0xDC62'D83D}, // U+1F462, 👢, \:boot:, Womans Boots
+{0x750c, 0x3c3d, 0xDD84'D83E}, // U+1F984, 🦄, \:unicorn_face:, Unicorn Face
+{0x7205, 0x2df5, 0xDF5C'D83C}, // U+1F35C, 🍜, \:ramen:, Steaming Bowl
+{0x6310, 0x0a52, 0xDD42'D83E}, // U+1F942, 🥂, \:clinking_glasses:, Clinking Glasses
+{0x770b, 0x3e32, 0xDD0D'D83E}, // U+1F90D, 🤍, \:white_heart:, White Heart
+{0x740d, 0x3b19, 0xDC20'D83D}, // U+1F420, 🐠, \:tropical_fish:, Tropical Fish
+{0x6313, 0x0c2f, 0xDC77'D83D}, // U+1F477, 👷, \:construction_worker:, Construction Worker
+{0x7705, 0x3da9, 0xDE29'D83D}, // U+1F629, 😩, \:weary:, Weary Face
+{0x650b, 0x1026, 0xDF3E'D83C}, // U+1F33E, 🌾, \:ear_of_rice:, Ear Of Rice
+{0x7306, 0x30df, 0x2696}, // ⚖, \:scales:, Balance Scale
+{0x6e0c, 0x26e7, 0xDD29'D83D}, // U+1F529, 🔩, \:nut_and_bolt:, Nut And Bolt
+{0x7908, 0x3fd3, 0x262F}, // ☯, \:yin_yang:, Yin Yang
+{0x6a07, 0x1c94, 0xDE39'D83D}, // U+1F639, 😹, \:joy_cat:, Cat Face With Tears Of Joy
+{0x7305, 0x34cb, 0xDC0C'D83D}, // U+1F40C, 🐌, \:snail:, Snail
+{0x6104, 0x0026, 0xDD21'D83D}, // U+1F521, 🔡, \:abcd:, Input Symbol For Latin Small Letters
+{0x6807, 0x184d, 0xDC5C'D83D}, // U+1F45C, 👜, \:handbag:, Handbag
+{0x6703, 0x161f, 0xDC8E'D83D}, // U+1F48E, 💎, \:gem:, Gem Stone
+{0x6c08, 0x206e, 0xDF6D'D83C}, // U+1F36D, 🍭, \:lollipop:, Lollipop
+{0x700c, 0x28aa, 0xDEF4'D83E}, // U+1FAF4, 🫴, \:palm_up_hand:, Palm Up Hand
+{0x650d, 0x10b0, 0xDD0C'D83D}, // U+1F50C, 🔌, \:electric_plug:, Electric Plug
+{0x6c07, 0x1dac, 0xDFEE'D83C}, // U+1F3EE, 🏮, \:lantern:, Izakaya Lantern
+{0x6f0e, 0x26ff, 0xDED1'D83D}, // U+1F6D1, 🛑, \:octagonal_sign:, Octagonal Sign
+{0x6112, 0x0176, 0x2935}, // ⤵, \:arrow_heading_down:, Arrow Pointing Rightwards Then Curving Downwards
+{0x6c17, 0x210e, 0xDD8B'D83D}, // U+1F58B, 🖋, \:lower_left_fountain_pen:, Fountain Pen
+{0x7705, 0x3dc5, 0xDC33'D83D}, // U+1F433, 🐳, \:whale:, Spouting Whale
+{0x650f, 0x110b, 0xDFF0'D83C}, // U+1F3F0, 🏰, \:european_castle:, European Castle
+{0x7304, 0x324e, 0xDC5E'D83D}, // U+1F45E, 👞, \:shoe:, Mans Shoe
+{0x6207, 0x06dd, 0xDFB3'D83C}, // U+1F3B3, 🎳, \:bowling:, Bowling
+{0x7210, 0x2ea6, 0xDC9E'D83D}, // U+1F49E, 💞, \:revolving_hearts:, Revolving Hearts
+{0x7404, 0x38bf, 0xDF2E'D83C}, // U+1F32E, 🌮, \:taco:, Taco
+{0x640f, 0x0e14, 0xDD76'D83D}, // U+1F576, 🕶, \:dark_sunglasses:, Sunglasses
+{0x6d0f, 0x2383, 0xDE96'D83E}, // U+1FA96, 🪖, \:military_helmet:, Military Helmet
+{0x700d, 0x2c00, 0xDEB0'D83D}, // U+1F6B0, 🚰, \:potable_water:, Potable Water Symbol
+{0x6e10, 0x2624, 0xDF03'D83C}, // U+1F303, 🌃, \:night_with_stars:, Night With Stars
+{0x6207, 0x077c, 0xDEE7'D83E}, // U+1FAE7, 🫧, \:bubbles:, Bubbles
+{0x7311, 0x369f, 0x262A}, // ☪, \:star_and_crescent:, Star And Crescent
+{0x7307, 0x351b, 0x2603}, // ☃, \:snowman:, Snowman
+{0x7406, 0x3a33, 0xDC45'D83D}, // U+1F445, 👅, \:tongue:, Tongue
+{0x7204, 0x2d64, 0xDE21'D83D}, // U+1F621, 😡, \:rage:, Pouting Face
+{0x6410, 0x0e53, 0xDFEC'D83C}, // U+1F3EC, 🏬, \:department_store:, Department Store
+{0x6706, 0x1796, 0xDFB8'D83C}, // U+1F3B8, 🎸, \:guitar:, Guitar
+{0x630c, 0x082e, 0xDD19'D83E}, // U+1F919, 🤙, \:call_me_hand:, Call Me Hand
+{0x7307, 0x34c3, 0xDEAC'D83D}, // U+1F6AC, 🚬, \:smoking:, Smoking Symbol
+{0x731b, 0x35c5, 0xDDE3'D83D}, // U+1F5E3, 🗣, \:speaking_head_in_silhouette:, Speaking Head
+{0x6609, 0x15ac, 0xDF73'D83C}, // U+1F373, 🍳, \:fried_egg:, Cooking
+{0x730d, 0x35af, 0xDE4A'D83D}, // U+1F64A, 🙊, \:speak_no_evil:, Speak-No-Evil Monkey
+{0x730b, 0x305e, 0x2650}, // ♐, \:sagittarius:, Sagittarius
+{0x6106, 0x00df, 0x2693}, // ⚓, \:anchor:, Anchor
+{0x661c, 0x1244, 0xDD28'D83E}, // U+1F928, 🤨, \:face_with_one_eyebrow_raised:, Face With One Eyebrow Raised
+{0x6110, 0x01d4, 0x21AA}, // ↪, \:arrow_right_hook:, Rightwards Arrow With Hook
+{0x6a05, 0x1c79, 0xDC56'D83D}, // U+1F456, 👖, \:jeans:, Jeans
+{0x720c, 0x2edf, 0xDF58'D83C}, // U+1F358, 🍘, \:rice_cracker:, Rice Cracker
+{0x6809, 0x1a0f, 0xDC60'D83D}, // U+1F460, 👠, \:high_heel:, High-Heeled Shoe
+{0x6605, 0x1330, 0xDDDA'D83E}, // U+1F9DA, 🧚, \:fairy:, Fairy
+{0x6204, 0x02da, 0xDD19'D83D}, // U+1F519, 🔙, \:back:, Back With Leftwards Arrow Above
+{0x6a08, 0x1ca5, 0xDD39'D83E}, // U+1F939, 🤹, \:juggling:, Juggling
+{0x7505, 0x3bde, 0xDE1A'D83C}, // U+1F21A, 🈚, \:u7121:, Squared Cjk Unified Ideograph-7121
+{0x7707, 0x3daf, 0xDC92'D83D}, // U+1F492, 💒, \:wedding:, Wedding
+{0x7310, 0x3725, 0xDE1B'D83D}, // U+1F61B, 😛, \:stuck_out_tongue:, Face With Stuck-Out Tongue
+{0x7505, 0x3bf0, 0xDE33'D83C}, // U+1F233, 🈳, \:u7a7a:, Squared Cjk Unified Ideograph-7A7A
+{0x7011, 0x2a85, 0xDEC5'D83E}, // U+1FAC5, 🫅, \:person_with_crown:, Person With Crown
+{0x720b, 0x2daa, 0x270B}, // ✋, \:raised_hand:, Raised Hand
+{0x7505, 0x3bc0, 0xDE3A'D83C}, // U+1F23A, 🈺, \:u55b6:, Squared Cjk Unified Ideograph-55B6
+{0x610d, 0x0278, 0xDC5F'D83D}, // U+1F45F, 👟, \:athletic_shoe:, Athletic Shoe
+{0x7607, 0x3c67, 0xDDDB'D83E}, // U+1F9DB, 🧛, \:vampire:, Vampire
+{0x6208, 0x0749, 0xDD66'D83E}, // U+1F966, 🥦, \:broccoli:, Broccoli
+{0x6508, 0x10e9, 0x2709}, // ✉, \:envelope:, Envelope
+{0x6c07, 0x1fc2, 0xDC06'D83D}, // U+1F406, 🐆, \:leopard:, Leopard
+{0x6f04, 0x2716, 0xDF62'D83C}, // U+1F362, 🍢, \:oden:, Oden
+{0x620b, 0x02b7, 0xDF7C'D83C}, // U+1F37C, 🍼, \:baby_bottle:, Baby Bottle
+{0x6a0f, 0x1c47, 0xDFEF'D83C}, // U+1F3EF, 🏯, \:japanese_castle:, Japanese Castle
+{0x6c08, 0x1d88, 0xDD4D'D83E}, // U+1F94D, 🥍, \:lacrosse:, Lacrosse Stick And Ball
+{0x6308, 0x0aba, 0xDD5D'D83D}, // U+1F55D, 🕝, \:clock230:, Clock Face Two-Thirty
+{0x6c15, 0x2126, 0xDD8C'D83D}, // U+1F58C, 🖌, \:lower_left_paintbrush:, Paintbrush
+{0x6306, 0x0ad3, 0xDD53'D83D}, // U+1F553, 🕓, \:clock4:, Clock Face Four Oclock
+{0x6108, 0x01e5, 0x2B06}, // ⬆, \:arrow_up:, Upwards Black Arrow
+{0x6d0f, 0x2234, 0xDC73'D83D}, // U+1F473, 👳, \:man_with_turban:, Man With Turban
+{0x720d, 0x2f53, 0xDE90'D83E}, // U+1FA90, 🪐, \:ringed_planet:, Ringed Planet
+{0x620d, 0x06bf, 0xDFF9'D83C}, // U+1F3F9, 🏹, \:bow_and_arrow:, Bow And Arrow
+{0x6e0c, 0x2592, 0xDDFF'D83E}, // U+1F9FF, 🧿, \:nazar_amulet:, Nazar Amulet
+{0x7713, 0x3f48, 0xDC6D'D83D}, // U+1F46D, 👭, \:women_holding_hands:, Two Women Holding Hands
+{0x7003, 0x2aed, 0xDC37'D83D}, // U+1F437, 🐷, \:pig:, Pig Face
+{0x670d, 0x1710, 0x2754}, // ❔, \:grey_question:, White Question Mark Ornament
+{0x7311, 0x329b, 0xDD18'D83E}, // U+1F918, 🤘, \:sign_of_the_horns:, Sign Of The Horns
+{0x6e02, 0x2621, 0xDD96'D83C}, // U+1F196, 🆖, \:ng:, Squared Ng
+{0x6d11, 0x2315, 0xDC6C'D83D}, // U+1F46C, 👬, \:men_holding_hands:, Two Men Holding Hands
+{0x6404, 0x0f3f, 0xDC15'D83D}, // U+1F415, 🐕, \:dog2:, Dog
+{0x631a, 0x0925, 0xDCC9'D83D}, // U+1F4C9, 📉, \:chart_with_downwards_trend:, Chart With Downwards Trend
+{0x620a, 0x03c3, 0xDFC0'D83C}, // U+1F3C0, 🏀, \:basketball:, Basketball And Hoop
+{0x6d09, 0x2347, 0xDDDC'D83E}, // U+1F9DC, 🧜, \:merperson:, Merperson
+{0x770b, 0x3d14, 0xDDD1'D83D}, // U+1F5D1, 🗑, \:wastebasket:, Wastebasket
+{0x7408, 0x39cb, 0xDC4D'D83D}, // U+1F44D, 👍, \:thumbsup:, Thumbs Up Sign
+{0x630d, 0x09ca, 0xDF6B'D83C}, // U+1F36B, 🍫, \:chocolate_bar:, Chocolate Bar
+{0x7209, 0x2f49, 0xDEDF'D83D}, // U+1F6DF, 🛟, \:ring_buoy:, Ring Buoy
+{0x7005, 0x2c22, 0xDC5D'D83D}, // U+1F45D, 👝, \:pouch:, Pouch
+{0x7207, 0x2d8e, 0xDF08'D83C}, // U+1F308, 🌈, \:rainbow:, Rainbow
+{0x6e09, 0x25c3, 0xDD13'D83E}, // U+1F913, 🤓, \:nerd_face:, Nerd Face
+{0x6e12, 0x2604, 0xDF1A'D83C}, // U+1F31A, 🌚, \:new_moon_with_face:, New Moon With Face
+{0x6206, 0x0784, 0xDEA3'D83E}, // U+1FAA3, 🪣, \:bucket:, Bucket
+{0x6804, 0x1a5d, 0xDE9D'D83E}, // U+1FA9D, 🪝, \:hook:, Hook
+{0x6613, 0x15ea, 0xDF1D'D83C}, // U+1F31D, 🌝, \:full_moon_with_face:, Full Moon With Face
+{0x6105, 0x0106, 0xDF4E'D83C}, // U+1F34E, 🍎, \:apple:, Red Apple
+{0x7705, 0x3efb, 0xDC69'D83D}, // U+1F469, 👩, \:woman:, Woman
+{0x6706, 0x1687, 0xDDE4'D83E}, // U+1F9E4, 🧤, \:gloves:, Gloves
+{0x7006, 0x299e, 0xDCDD'D83D}, // U+1F4DD, 📝, \:pencil:, Memo
+{0x6d07, 0x21cc, 0xDDA3'D83E}, // U+1F9A3, 🦣, \:mammoth:, Mammoth
+{0x6a03, 0x1c90, 0xDE02'D83D}, // U+1F602, 😂, \:joy:, Face With Tears Of Joy
+{0x670a, 0x16d1, 0xDCD7'D83D}, // U+1F4D7, 📗, \:green_book:, Green Book
+{0x6e04, 0x26b4, 0xDC43'D83D}, // U+1F443, 👃, \:nose:, Nose
+{0x6110, 0x022e, 0xDD03'D83D}, // U+1F503, 🔃, \:arrows_clockwise:, Clockwise Downwards And Upwards Open Circle Arrows
+{0x6c12, 0x1deb, 0xDFE4'D83D}, // U+1F7E4, 🟤, \:large_brown_circle:, Large Brown Circle
+{0x6107, 0x00ae, 0x2697}, // ⚗, \:alembic:, Alembic
+{0x650a, 0x1063, 0xDF0F'D83C}, // U+1F30F, 🌏, \:earth_asia:, Earth Globe Asia-Australia
+{0x640f, 0x0fba, 0xDC2A'D83D}, // U+1F42A, 🐪, \:dromedary_camel:, Dromedary Camel
+{0x700b, 0x2ba1, 0xDC49'D83D}, // U+1F449, 👉, \:point_right:, White Right Pointing Backhand Index
+{0x6706, 0x1623, 0x264A}, // ♊, \:gemini:, Gemini
+{0x6d12, 0x24b4, 0xDEB5'D83D}, // U+1F6B5, 🚵, \:mountain_bicyclist:, Mountain Bicyclist
+{0x6606, 0x1383, 0xDD3A'D83E}, // U+1F93A, 🤺, \:fencer:, Fencer
+{0x630e, 0x097e, 0xDF38'D83C}, // U+1F338, 🌸, \:cherry_blossom:, Cherry Blossom
+{0x7312, 0x33f1, 0xDD3A'D83D}, // U+1F53A, 🔺, \:small_red_triangle:, Up-Pointing Red Triangle
+{0x7206, 0x301d, 0xDFC3'D83C}, // U+1F3C3, 🏃, \:runner:, Runner
+{0x6c0f, 0x2003, 0xDF29'D83C}, // U+1F329, 🌩, \:lightning_cloud:, Cloud With Lightning
+{0x7309, 0x30c2, 0xDE06'D83D}, // U+1F606, 😆, \:satisfied:, Smiling Face With Open Mouth And Tightly-Closed Eyes
+{0x630f, 0x0c12, 0x3297}, // ㊗, \:congratulations:, Circled Ideograph Congratulation
+{0x6d0c, 0x2303, 0xDEE0'D83E}, // U+1FAE0, 🫠, \:melting_face:, Melting Face
+{0x7306, 0x3272, 0xDE73'D83E}, // U+1FA73, 🩳, \:shorts:, Shorts
+{0x630f, 0x0b54, 0xDF02'D83C}, // U+1F302, 🌂, \:closed_umbrella:, Closed Umbrella
+{0x7015, 0x2900, 0x303D}, // 〽, \:part_alternation_mark:, Part Alternation Mark
+{0x7308, 0x311c, 0x264F}, // ♏, \:scorpius:, Scorpius
+{0x7508, 0x3bf6, 0x2602}, // ☂, \:umbrella:, Umbrella
+{0x7306, 0x363b, 0xDDFD'D83E}, // U+1F9FD, 🧽, \:sponge:, Sponge
+{0x6211, 0x07aa, 0xDE85'D83D}, // U+1F685, 🚅, \:bullettrain_front:, High-Speed Train With Bullet Nose
+{0x7308, 0x3345, 0xDE34'D83D}, // U+1F634, 😴, \:sleeping:, Sleeping Face
+{0x7406, 0x3a19, 0xDEBD'D83D}, // U+1F6BD, 🚽, \:toilet:, Toilet
+{0x6615, 0x1308, 0xDD12'D83E}, // U+1F912, 🤒, \:face_with_thermometer:, Face With Thermometer
+{0x730d, 0x37cb, 0xDF1E'D83C}, // U+1F31E, 🌞, \:sun_with_face:, Sun With Face
+{0x6209, 0x0470, 0xDEB4'D83D}, // U+1F6B4, 🚴, \:bicyclist:, Bicyclist
+{0x6a0e, 0x1c32, 0xDF83'D83C}, // U+1F383, 🎃, \:jack_o_lantern:, Jack-O-Lantern
+{0x7313, 0x360c, 0xDDD3'D83D}, // U+1F5D3, 🗓, \:spiral_calendar_pad:, Spiral Calendar
+{0x6203, 0x0420, 0xDC1D'D83D}, // U+1F41D, 🐝, \:bee:, Honeybee
+{0x7314, 0x3663, 0x2695}, // ⚕, \:staff_of_aesculapius:, Medical Symbol
+{0x6106, 0x002b, 0xDE51'D83C}, // U+1F251, 🉑, \:accept:, Circled Ideograph Accept
+{0x6c12, 0x1e24, 0xDFE9'D83D}, // U+1F7E9, 🟩, \:large_green_square:, Large Green Square
+{0x7713, 0x3e1e, 0x2639}, // ☹, \:white_frowning_face:, Frowning Face
+{0x6c0a, 0x20b1, 0xDFE9'D83C}, // U+1F3E9, 🏩, \:love_hotel:, Love Hotel
+{0x6813, 0x1918, 0x2797}, // ➗, \:heavy_division_sign:, Heavy Division Sign
+{0x7205, 0x2dff, 0xDE92'D83E}, // U+1FA92, 🪒, \:razor:, Razor
+{0x7314, 0x33dc, 0xDD38'D83D}, // U+1F538, 🔸, \:small_orange_diamond:, Small Orange Diamond
+{0x7309, 0x34b9, 0xDE3C'D83D}, // U+1F63C, 😼, \:smirk_cat:, Cat Face With Wry Smile
+{0x6708, 0x168e, 0xDD45'D83E}, // U+1F945, 🥅, \:goal_net:, Goal Net
+{0x720d, 0x2ff8, 0xDCCD'D83D}, // U+1F4CD, 📍, \:round_pushpin:, Round Pushpin
+{0x7211, 0x2ef7, 0xDD1C'D83E}, // U+1F91C, 🤜, \:right-facing_fist:, Right-Facing Fist
+{0x7209, 0x2ed5, 0xDF59'D83C}, // U+1F359, 🍙, \:rice_ball:, Rice Ball
+{0x7007, 0x2bd8, 0xDF7F'D83C}, // U+1F37F, 🍿, \:popcorn:, Popcorn
+{0x740b, 0x39ff, 0x23F2}, // ⏲, \:timer_clock:, Timer Clock
+{0x6c1b, 0x1ee7, 0xDF1C'D83C}, // U+1F31C, 🌜, \:last_quarter_moon_with_face:, Last Quarter Moon With Face
+{0x6d0c, 0x242e, 0xDF93'D83C}, // U+1F393, 🎓, \:mortar_board:, Graduation Cap
+{0x661d, 0x1289, 0xDD2E'D83E}, // U+1F92E, 🤮, \:face_with_open_mouth_vomiting:, Face With Open Mouth Vomiting
+{0x6503, 0x10e5, 0xDD1A'D83D}, // U+1F51A, 🔚, \:end:, End With Leftwards Arrow Above
+{0x7704, 0x3ee8, 0xDE09'D83D}, // U+1F609, 😉, \:wink:, Winking Face
+{0x7312, 0x33c9, 0xDD39'D83D}, // U+1F539, 🔹, \:small_blue_diamond:, Small Blue Diamond
+{0x620b, 0x02ce, 0xDEBC'D83D}, // U+1F6BC, 🚼, \:baby_symbol:, Baby Symbol
+{0x680c, 0x18a1, 0xDE49'D83D}, // U+1F649, 🙉, \:hear_no_evil:, Hear-No-Evil Monkey
+{0x6f05, 0x26f9, 0xDF0A'D83C}, // U+1F30A, 🌊, \:ocean:, Water Wave
+{0x6612, 0x1594, 0xDDBC'D83D}, // U+1F5BC, 🖼, \:frame_with_picture:, Framed Picture
+{0x7502, 0x3c51, 0xDD99'D83C}, // U+1F199, 🆙, \:up:, Squared Up With Exclamation Mark
+{0x670b, 0x16dc, 0xDC9A'D83D}, // U+1F49A, 💚, \:green_heart:, Green Heart
+{0x660b, 0x133e, 0xDF42'D83C}, // U+1F342, 🍂, \:fallen_leaf:, Fallen Leaf
+{0x6d05, 0x24ea, 0xDC2D'D83D}, // U+1F42D, 🐭, \:mouse:, Mouse Face
+{0x6305, 0x0b75, 0x2663}, // ♣, \:clubs:, Black Club Suit
+{0x7305, 0x32dd, 0x26F7}, // ⛷, \:skier:, Skier
+{0x6206, 0x042f, 0xDEB2'D83E}, // U+1FAB2, 🪲, \:beetle:, Beetle
+{0x6c0a, 0x209a, 0xDD0A'D83D}, // U+1F50A, 🔊, \:loud_sound:, Speaker With Three Sound Waves
+{0x7006, 0x2c9b, 0xDD34'D83E}, // U+1F934, 🤴, \:prince:, Prince
+{0x6610, 0x1522, 0xDEAD'D83E}, // U+1FAAD, 🪭, \:folding_hand_fan:, Folding Hand Fan
+{0x6e0d, 0x25dc, 0xDE86'D83E}, // U+1FA86, 🪆, \:nesting_dolls:, Nesting Dolls
+{0x6504, 0x1178, 0xDC40'D83D}, // U+1F440, 👀, \:eyes:, Eyes
+{0x6508, 0x10be, 0xDC18'D83D}, // U+1F418, 🐘, \:elephant:, Elephant
+{0x6103, 0x0102, 0xDC1C'D83D}, // U+1F41C, 🐜, \:ant:, Ant
+{0x7314, 0x3325, 0x2620}, // ☠, \:skull_and_crossbones:, Skull And Crossbones
+{0x7206, 0x2e61, 0xDD01'D83D}, // U+1F501, 🔁, \:repeat:, Clockwise Rightwards And Leftwards Open Circle Arrows
+{0x6c0d, 0x2086, 0xDDF4'D83E}, // U+1F9F4, 🧴, \:lotion_bottle:, Lotion Bottle
+{0x6616, 0x121b, 0xDD15'D83E}, // U+1F915, 🤕, \:face_with_head_bandage:, Face With Head-Bandage
+{0x6410, 0x0e91, 0xDDA5'D83D}, // U+1F5A5, 🖥, \:desktop_computer:, Desktop Computer
+{0x680e, 0x18d0, 0xDE3B'D83D}, // U+1F63B, 😻, \:heart_eyes_cat:, Smiling Cat Face With Heart-Shaped Eyes
+{0x7210, 0x2d53, 0x2622}, // ☢, \:radioactive_sign:, Radioactive
+{0x730d, 0x328d, 0xDD2B'D83E}, // U+1F92B, 🤫, \:shushing_face:, Face With Finger Covering Closed Lips
+{0x7406, 0x38f4, 0x2649}, // ♉, \:taurus:, Taurus
+{0x680a, 0x19ce, 0xDE81'D83D}, // U+1F681, 🚁, \:helicopter:, Helicopter
+{0x6808, 0x1b0b, 0xDEBB'D83E}, // U+1FABB, 🪻, \:hyacinth:, Hyacinth
+{0x770d, 0x3ea6, 0xDD40'D83E}, // U+1F940, 🥀, \:wilted_flower:, Wilted Flower
+{0x7704, 0x3d4a, 0xDC4B'D83D}, // U+1F44B, 👋, \:wave:, Waving Hand Sign
+{0x630a, 0x08b9, 0xDCC7'D83D}, // U+1F4C7, 📇, \:card_index:, Card Index
+{0x7207, 0x2d09, 0xDC07'D83D}, // U+1F407, 🐇, \:rabbit2:, Rabbit
+{0x7314, 0x3523, 0x26C4}, // ⛄, \:snowman_without_snow:, Snowman Without Snow
+{0x7308, 0x354e, 0xDD4E'D83E}, // U+1F94E, 🥎, \:softball:, Softball
+{0x691c, 0x1bb5, 0xDEF5'D83E}, // U+1FAF5, 🫵, \:index_pointing_at_the_viewer:, Index Pointing At The Viewer
+{0x6c13, 0x1e60, 0xDFE7'D83D}, // U+1F7E7, 🟧, \:large_orange_square:, Large Orange Square
+{0x6c0b, 0x1f18, 0xDD6C'D83E}, // U+1F96C, 🥬, \:leafy_green:, Leafy Green
+{0x6414, 0x0fee, 0xDD41'D83E}, // U+1F941, 🥁, \:drum_with_drumsticks:, Drum With Drumsticks
+{0x6704, 0x1728, 0xDE01'D83D}, // U+1F601, 😁, \:grin:, Grinning Face With Smiling Eyes
+{0x6303, 0x08fc, 0xDC31'D83D}, // U+1F431, 🐱, \:cat:, Cat Face
+{0x6d04, 0x22a0, 0xDE37'D83D}, // U+1F637, 😷, \:mask:, Face With Medical Mask
+{0x7305, 0x31eb, 0xDD88'D83E}, // U+1F988, 🦈, \:shark:, Shark
+{0x7405, 0x389c, 0xDD96'D83E}, // U+1F996, 🦖, \:t-rex:, T-Rex
+{0x6d0d, 0x254d, 0xDFBC'D83C}, // U+1F3BC, 🎼, \:musical_score:, Musical Score
+{0x6f07, 0x270e, 0xDC19'D83D}, // U+1F419, 🐙, \:octopus:, Octopus
+{0x6306, 0x0b23, 0xDD58'D83D}, // U+1F558, 🕘, \:clock9:, Clock Face Nine Oclock
+{0x770e, 0x3f1d, 0xDC5A'D83D}, // U+1F45A, 👚, \:womans_clothes:, Womans Clothes
+{0x7008, 0x28c9, 0xDD5E'D83E}, // U+1F95E, 🥞, \:pancakes:, Pancakes
+{0x7303, 0x355c, 0xDD98'D83C}, // U+1F198, 🆘, \:sos:, Squared Sos
+{0x6a0d, 0x1c67, 0xDC79'D83D}, // U+1F479, 👹, \:japanese_ogre:, Japanese Ogre
+{0x6304, 0x0b7b, 0xDDE5'D83E}, // U+1F9E5, 🧥, \:coat:, Coat
+{0x6612, 0x1438, 0xDF13'D83C}, // U+1F313, 🌓, \:first_quarter_moon:, First Quarter Moon Symbol
+{0x7702, 0x3da6, 0xDEBE'D83D}, // U+1F6BE, 🚾, \:wc:, Water Closet
+{0x7008, 0x2bad, 0x261D}, // ☝, \:point_up:, White Up Pointing Index
+{0x6d10, 0x23d2, 0xDD11'D83E}, // U+1F911, 🤑, \:money_mouth_face:, Money-Mouth Face
+{0x6809, 0x1a4a, 0xDF6F'D83C}, // U+1F36F, 🍯, \:honey_pot:, Honey Pot
+{0x770c, 0x3e04, 0x26AA}, // ⚪, \:white_circle:, Medium White Circle
+{0x6207, 0x07cd, 0xDF2F'D83C}, // U+1F32F, 🌯, \:burrito:, Burrito
+{0x731a, 0x343e, 0xDD70'D83E}, // U+1F970, 🥰, \:smiling_face_with_3_hearts:, Smiling Face With Smiling Eyes And Three Hearts
+{0x6216, 0x0346, 0xDDF3'D83D}, // U+1F5F3, 🗳, \:ballot_box_with_ballot:, Ballot Box With Ballot
+{0x6706, 0x16a9, 0xDFCC'D83C}, // U+1F3CC, 🏌, \:golfer:, Person Golfing
+{0x7311, 0x36cd, 0xDDFD'D83D}, // U+1F5FD, 🗽, \:statue_of_liberty:, Statue Of Liberty
+{0x650e, 0x1054, 0xDF0E'D83C}, // U+1F30E, 🌎, \:earth_americas:, Earth Globe Americas
+{0x6417, 0x0e64, 0xDFDA'D83C}, // U+1F3DA, 🏚, \:derelict_house_building:, Derelict House
+{0x6704, 0x161a, 0x2699}, // ⚙, \:gear:, Gear
+{0x7316, 0x37fc, 0xDF04'D83C}, // U+1F304, 🌄, \:sunrise_over_mountains:, Sunrise Over Mountains
+{0x6c06, 0x2042, 0xDD8E'D83E}, // U+1F98E, 🦎, \:lizard:, Lizard
+{0x6217, 0x04cc, 0x23FA}, // ⏺, \:black_circle_for_record:, Record Button
+{0x7713, 0x3e92, 0xDD33'D83D}, // U+1F533, 🔳, \:white_square_button:, White Square Button
+{0x6604, 0x1468, 0xDC1F'D83D}, // U+1F41F, 🐟, \:fish:, Fish
+{0x7005, 0x2cc0, 0xDC4A'D83D}, // U+1F44A, 👊, \:punch:, Fisted Hand Sign
+{0x6828, 0x1824, 0xDEF0'D83E}, // U+1FAF0, 🫰, \:hand_with_index_finger_and_thumb_crossed:, Hand With Index Finger And Thumb Crossed
+{0x6d08, 0x2442, 0xDD9F'D83E}, // U+1F99F, 🦟, \:mosquito:, Mosquito
+{0x7312, 0x3837, 0xDE9F'D83D}, // U+1F69F, 🚟, \:suspension_railway:, Suspension Railway
+{0x6603, 0x135e, 0xDCE0'D83D}, // U+1F4E0, 📠, \:fax:, Fax Machine
+{0x6b0a, 0x1cca, 0xDD1F'D83D}, // U+1F51F, 🔟, \:keycap_ten:, Keycap Ten
+{0x6518, 0x107b, 0x2734}, // ✴, \:eight_pointed_black_star:, Eight Pointed Black Star
+{0x7405, 0x3a42, 0xDDB7'D83E}, // U+1F9B7, 🦷, \:tooth:, Tooth
+{0x7005, 0x2983, 0xDF51'D83C}, // U+1F351, 🍑, \:peach:, Peach
+{0x6c05, 0x1d82, 0xDFF7'D83C}, // U+1F3F7, 🏷, \:label:, Label
+{0x7203, 0x2df1, 0xDC0F'D83D}, // U+1F40F, 🐏, \:ram:, Ram
+{0x660d, 0x150a, 0xDEF8'D83D}, // U+1F6F8, 🛸, \:flying_saucer:, Flying Saucer
+{0x7007, 0x2c93, 0xDD68'D83E}, // U+1F968, 🥨, \:pretzel:, Pretzel
+{0x730b, 0x3137, 0xDE9B'D83E}, // U+1FA9B, 🪛, \:screwdriver:, Screwdriver
+{0x6c08, 0x1f0f, 0xDE06'D83D}, // U+1F606, 😆, \:laughing:, Smiling Face With Open Mouth And Tightly-Closed Eyes
+{0x6604, 0x148d, 0x270A}, // ✊, \:fist:, Raised Fist
+{0x640d, 0x0fca, 0xDD24'D83E}, // U+1F924, 🤤, \:drooling_face:, Drooling Face
+{0x7403, 0x3a53, 0xDD1D'D83D}, // U+1F51D, 🔝, \:top:, Top With Upwards Arrow Above
+{0x730b, 0x3313, 0xDFFF'D83C}, // U+1F3FF, 🏿, \:skin-tone-6:, Emoji Modifier Fitzpatrick Type-6
+{0x7707, 0x3cdb, 0xDEB6'D83D}, // U+1F6B6, 🚶, \:walking:, Pedestrian
+{0x6302, 0x0a2f, 0xDD91'D83C}, // U+1F191, 🆑, \:cl:, Squared Cl
+{0x6d07, 0x217c, 0xDC04'D83C}, // U+1F004, 🀄, \:mahjong:, Mahjong Tile Red Dragon
+{0x6c11, 0x1dd9, 0xDFE6'D83D}, // U+1F7E6, 🟦, \:large_blue_square:, Large Blue Square
+{0x7603, 0x3c86, 0xDCFC'D83D}, // U+1F4FC, 📼, \:vhs:, Videocassette
+{0x6f02, 0x285b, 0xDC02'D83D}, // U+1F402, 🐂, \:ox:, Ox
+{0x7213, 0x2f86, 0xDDDE'D83D}, // U+1F5DE, 🗞, \:rolled_up_newspaper:, Rolled-Up Newspaper
+{0x6103, 0x0286, 0xDFE7'D83C}, // U+1F3E7, 🏧, \:atm:, Automated Teller Machine
+{0x6f07, 0x272e, 0xDC4C'D83D}, // U+1F44C, 👌, \:ok_hand:, Ok Hand Sign
+{0x6205, 0x02df, 0xDD53'D83E}, // U+1F953, 🥓, \:bacon:, Bacon
+{0x6409, 0x0f09, 0xDE94'D83E}, // U+1FA94, 🪔, \:diya_lamp:, Diya Lamp
+{0x700c, 0x2cb3, 0xDDAF'D83E}, // U+1F9AF, 🦯, \:probing_cane:, Probing Cane
+{0x640d, 0x0fd8, 0xDE78'D83E}, // U+1FA78, 🩸, \:drop_of_blood:, Drop Of Blood
+{0x7315, 0x3391, 0xDE42'D83D}, // U+1F642, 🙂, \:slightly_smiling_face:, Slightly Smiling Face
+{0x6c0a, 0x214a, 0xDD25'D83E}, // U+1F925, 🤥, \:lying_face:, Lying Face
+{0x6d1b, 0x21d8, 0xDC6B'D83D}, // U+1F46B, 👫, \:man_and_woman_holding_hands:, Man And Woman Holding Hands
+{0x730b, 0x3861, 0xDE05'D83D}, // U+1F605, 😅, \:sweat_smile:, Smiling Face With Open Mouth And Cold Sweat
+{0x670b, 0x1646, 0xDEDA'D83E}, // U+1FADA, 🫚, \:ginger_root:, Ginger Root
+{0x6c16, 0x1f9d, 0xDEF7'D83E}, // U+1FAF7, 🫷, \:leftwards_pushing_hand:, Leftwards Pushing Hand
+{0x7108, 0x2cf9, 0x2753}, // ❓, \:question:, Black Question Mark Ornament
+{0x7905, 0x3fdc, 0xDE80'D83E}, // U+1FA80, 🪀, \:yo-yo:, Yo-Yo
+{0x6d14, 0x2482, 0xDDBC'D83E}, // U+1F9BC, 🦼, \:motorized_wheelchair:, Motorized Wheelchair
+{0x6703, 0x179d, 0xDD2B'D83D}, // U+1F52B, 🔫, \:gun:, Pistol
+{0x730e, 0x35e1, 0xDCAC'D83D}, // U+1F4AC, 💬, \:speech_balloon:, Speech Balloon
+{0x6213, 0x03e7, 0xDFD6'D83C}, // U+1F3D6, 🏖, \:beach_with_umbrella:, Beach With Umbrella
+{0x770a, 0x3d3f, 0xDF49'D83C}, // U+1F349, 🍉, \:watermelon:, Watermelon
+{0x730c, 0x3648, 0xDFC5'D83C}, // U+1F3C5, 🏅, \:sports_medal:, Sports Medal
+{0x6311, 0x0850, 0xDCF8'D83D}, // U+1F4F8, 📸, \:camera_with_flash:, Camera With Flash
+{0x6811, 0x193e, 0xDFF0'D83D}, // U+1F7F0, 🟰, \:heavy_equals_sign:, Heavy Equals Sign
+{0x6d04, 0x255b, 0xDD07'D83D}, // U+1F507, 🔇, \:mute:, Speaker With Cancellation Stroke
+{0x620c, 0x04bf, 0x26AB}, // ⚫, \:black_circle:, Medium Black Circle
+{0x7402, 0x3a16, 0x2122}, // ™, \:tm:, Trade Mark Sign
+{0x6f08, 0x2722, 0xDEE2'D83D}, // U+1F6E2, 🛢, \:oil_drum:, Oil Drum
+{0x720c, 0x2de4, 0xDE4B'D83D}, // U+1F64B, 🙋, \:raising_hand:, Happy Person Raising One Hand
+{0x7010, 0x2a5d, 0x26F9}, // ⛹, \:person_with_ball:, Person Bouncing Ball
+{0x660b, 0x15fe, 0x26B1}, // ⚱, \:funeral_urn:, Funeral Urn
+{0x7706, 0x3cd4, 0xDDC7'D83E}, // U+1F9C7, 🧇, \:waffle:, Waffle
+{0x610b, 0x01c8, 0x27A1}, // ➡, \:arrow_right:, Black Rightwards Arrow
+{0x630e, 0x0d80, 0xDD64'D83E}, // U+1F964, 🥤, \:cup_with_straw:, Cup With Straw
+{0x6d1f, 0x2200, 0xDD74'D83D}, // U+1F574, 🕴, \:man_in_business_suit_levitating:, Person In Suit Levitating
+{0x730a, 0x371a, 0xDF53'D83C}, // U+1F353, 🍓, \:strawberry:, Strawberry
+{0x6c0b, 0x20a5, 0xDCE2'D83D}, // U+1F4E2, 📢, \:loudspeaker:, Public Address Loudspeaker
+{0x650b, 0x113f, 0x2757}, // ❗, \:exclamation:, Heavy Exclamation Mark Symbol
+{0x6308, 0x09c1, 0xDC3F'D83D}, // U+1F43F, 🐿, \:chipmunk:, Chipmunk
+{0x6204, 0x066e, 0x26F5}, // ⛵, \:boat:, Sailboat
+{0x6618, 0x12bd, 0xDD28'D83E}, // U+1F928, 🤨, \:face_with_raised_eyebrow:, Face With One Eyebrow Raised
+{0x6309, 0x0d08, 0xDC0A'D83D}, // U+1F40A, 🐊, \:crocodile:, Crocodile
+{0x6e0a, 0x2697, 0xDEAD'D83D}, // U+1F6AD, 🚭, \:no_smoking:, No Smoking Symbol
+{0x6314, 0x0cf3, 0xDFCF'D83C}, // U+1F3CF, 🏏, \:cricket_bat_and_ball:, Cricket Bat And Ball
+{0x740e, 0x3b0a, 0xDF79'D83C}, // U+1F379, 🍹, \:tropical_drink:, Tropical Drink
+{0x680c, 0x1a68, 0xDFC7'D83C}, // U+1F3C7, 🏇, \:horse_racing:, Horse Racing
+{0x6d04, 0x2419, 0xDF14'D83C}, // U+1F314, 🌔, \:moon:, Waxing Gibbous Moon Symbol
+{0x7015, 0x2a36, 0xDDD6'D83E}, // U+1F9D6, 🧖, \:person_in_steamy_room:, Person In Steamy Room
+{0x6304, 0x0c72, 0xDD92'D83C}, // U+1F192, 🆒, \:cool:, Squared Cool
+{0x6f12, 0x27bf, 0xDE71'D83E}, // U+1FA71, 🩱, \:one-piece_swimsuit:, One-Piece Swimsuit
+{0x6f05, 0x27d2, 0xDDC5'D83E}, // U+1F9C5, 🧅, \:onion:, Onion
+{0x6204, 0x07a5, 0xDCA1'D83D}, // U+1F4A1, 💡, \:bulb:, Electric Light Bulb
+{0x6e05, 0x2635, 0xDD77'D83E}, // U+1F977, 🥷, \:ninja:, Ninja
+{0x2b02, 0x0001, 0xDC4D'D83D}, // U+1F44D, 👍, \:+1:, Thumbs Up Sign
+{0x6209, 0x06a4, 0xDE83'D83E}, // U+1FA83, 🪃, \:boomerang:, Boomerang
+{0x6207, 0x0628, 0xDF3C'D83C}, // U+1F33C, 🌼, \:blossom:, Blossom
+{0x700a, 0x2b33, 0xDE77'D83E}, // U+1FA77, 🩷, \:pink_heart:, Pink Heart
+{0x6c0e, 0x1f8e, 0xDEF2'D83E}, // U+1FAF2, 🫲, \:leftwards_hand:, Leftwards Hand
+{0x700c, 0x2c15, 0xDEB4'D83E}, // U+1FAB4, 🪴, \:potted_plant:, Potted Plant
+{0x6404, 0x0e29, 0xDCA8'D83D}, // U+1F4A8, 💨, \:dash:, Dash Symbol
+{0x6404, 0x0e24, 0xDFAF'D83C}, // U+1F3AF, 🎯, \:dart:, Direct Hit
+{0x730b, 0x3052, 0xDDBA'D83E}, // U+1F9BA, 🦺, \:safety_vest:, Safety Vest
+{0x620c, 0x0450, 0xDECE'D83D}, // U+1F6CE, 🛎, \:bellhop_bell:, Bellhop Bell
+{0x6306, 0x086a, 0x264B}, // ♋, \:cancer:, Cancer
+{0x740a, 0x39c0, 0xDC4E'D83D}, // U+1F44E, 👎, \:thumbsdown:, Thumbs Down Sign
+{0x6c13, 0x1ead, 0xDFE1'D83D}, // U+1F7E1, 🟡, \:large_yellow_circle:, Large Yellow Circle
+{0x740c, 0x3989, 0xDE74'D83E}, // U+1FA74, 🩴, \:thong_sandal:, Thong Sandal
+{0x6c06, 0x1f24, 0xDF43'D83C}, // U+1F343, 🍃, \:leaves:, Leaf Fluttering In Wind
+{0x7017, 0x2ce1, 0xDEAE'D83D}, // U+1F6AE, 🚮, \:put_litter_in_its_place:, Put Litter In Its Place Symbol
+{0x6e07, 0x259f, 0xDC54'D83D}, // U+1F454, 👔, \:necktie:, Necktie
+{0x6d11, 0x2254, 0xDD70'D83D}, // U+1F570, 🕰, \:mantelpiece_clock:, Mantelpiece Clock
+{0x7405, 0x39f2, 0xDC2F'D83D}, // U+1F42F, 🐯, \:tiger:, Tiger Face
+{0x6d07, 0x239d, 0xDE90'D83D}, // U+1F690, 🚐, \:minibus:, Minibus
+{0x7207, 0x3024, 0xDFC3'D83C}, // U+1F3C3, 🏃, \:running:, Runner
+{0x6305, 0x0d97, 0xDC98'D83D}, // U+1F498, 💘, \:cupid:, Heart With Arrow
+{0x6307, 0x0d8f, 0xDDC1'D83E}, // U+1F9C1, 🧁, \:cupcake:, Cupcake
+{0x6306, 0x0c63, 0xDF6A'D83C}, // U+1F36A, 🍪, \:cookie:, Cookie
+{0x6305, 0x088a, 0xDEF6'D83D}, // U+1F6F6, 🛶, \:canoe:, Canoe
+{0x620e, 0x0491, 0x2623}, // ☣, \:biohazard_sign:, Biohazard
+{0x6805, 0x1acb, 0xDFE0'D83C}, // U+1F3E0, 🏠, \:house:, House Building
+{0x6204, 0x047a, 0xDEB2'D83D}, // U+1F6B2, 🚲, \:bike:, Bicycle
+{0x6314, 0x0b3f, 0xDD10'D83D}, // U+1F510, 🔐, \:closed_lock_with_key:, Closed Lock With Key
+{0x7706, 0x3f5c, 0xDEBA'D83D}, // U+1F6BA, 🚺, \:womens:, Womens Symbol
+{0x7305, 0x36bf, 0xDF20'D83C}, // U+1F320, 🌠, \:stars:, Shooting Star
+{0x6305, 0x0878, 0xDF6C'D83C}, // U+1F36C, 🍬, \:candy:, Candy
+{0x7304, 0x321d, 0xDEA2'D83D}, // U+1F6A2, 🚢, \:ship:, Ship
+{0x6f02, 0x272b, 0xDD97'D83C}, // U+1F197, 🆗, \:ok:, Squared Ok
+{0x720a, 0x2e35, 0x00AE}, // ®, \:registered:, Registered Sign
+{0x6305, 0x091f, 0xDCB9'D83D}, // U+1F4B9, 💹, \:chart:, Chart With Upwards Trend And Yen Sign
+{0x6e0d, 0x2658, 0xDEAB'D83D}, // U+1F6AB, 🚫, \:no_entry_sign:, No Entry Sign
+{0x6c04, 0x2013, 0xDD17'D83D}, // U+1F517, 🔗, \:link:, Link Symbol
+{0x680f, 0x1ad1, 0xDFD8'D83C}, // U+1F3D8, 🏘, \:house_buildings:, Houses
+{0x6d08, 0x23a5, 0xDCBD'D83D}, // U+1F4BD, 💽, \:minidisc:, Minidisc
+{0x7306, 0x3365, 0xDE2A'D83D}, // U+1F62A, 😪, \:sleepy:, Sleepy Face
+{0x7404, 0x3aa1, 0xDE8A'D83D}, // U+1F68A, 🚊, \:tram:, Tram
+{0x6d05, 0x250f, 0xDDFF'D83D}, // U+1F5FF, 🗿, \:moyai:, Moyai
+{0x740a, 0x3a48, 0xDEA5'D83E}, // U+1FAA5, 🪥, \:toothbrush:, Toothbrush
+{0x7212, 0x2f09, 0xDDEF'D83D}, // U+1F5EF, 🗯, \:right_anger_bubble:, Right Anger Bubble
+{0x650e, 0x115a, 0xDE11'D83D}, // U+1F611, 😑, \:expressionless:, Expressionless Face
+{0x730a, 0x3047, 0xDDF7'D83E}, // U+1F9F7, 🧷, \:safety_pin:, Safety Pin
+{0x6609, 0x131e, 0xDC4A'D83D}, // U+1F44A, 👊, \:facepunch:, Fisted Hand Sign
+{0x6207, 0x03df, 0xDD0B'D83D}, // U+1F50B, 🔋, \:battery:, Battery
+{0x630e, 0x09e3, 0xDF84'D83C}, // U+1F384, 🎄, \:christmas_tree:, Christmas Tree
+{0x7a03, 0x4018, 0xDCA4'D83D}, // U+1F4A4, 💤, \:zzz:, Sleeping Symbol
+{0x630c, 0x0d6a, 0xDD2E'D83D}, // U+1F52E, 🔮, \:crystal_ball:, Crystal Ball
+{0x700a, 0x2b8b, 0xDC47'D83D}, // U+1F447, 👇, \:point_down:, White Down Pointing Backhand Index
+{0x7307, 0x387a, 0xDFCA'D83C}, // U+1F3CA, 🏊, \:swimmer:, Swimmer
+{0x7015, 0x2a97, 0xDDD5'D83E}, // U+1F9D5, 🧕, \:person_with_headscarf:, Person With Headscarf
+{0x6204, 0x0678, 0xDDB4'D83E}, // U+1F9B4, 🦴, \:bone:, Bone
+{0x690a, 0x1b98, 0xDCE5'D83D}, // U+1F4E5, 📥, \:inbox_tray:, Inbox Tray
+{0x790c, 0x3fb5, 0xDD71'D83E}, // U+1F971, 🥱, \:yawning_face:, Yawning Face
+{0x630d, 0x08e7, 0xDE9A'D83E}, // U+1FA9A, 🪚, \:carpentry_saw:, Carpentry Saw
+{0x730f, 0x359f, 0xDC96'D83D}, // U+1F496, 💖, \:sparkling_heart:, Sparkling Heart
+{0x6105, 0x00ec, 0xDCA2'D83D}, // U+1F4A2, 💢, \:anger:, Anger Symbol
+{0x6614, 0x11ad, 0xDD20'D83E}, // U+1F920, 🤠, \:face_with_cowboy_hat:, Face With Cowboy Hat
+{0x700b, 0x2c28, 0xDF57'D83C}, // U+1F357, 🍗, \:poultry_leg:, Poultry Leg
+{0x730c, 0x386d, 0xDF60'D83C}, // U+1F360, 🍠, \:sweet_potato:, Roasted Sweet Potato
+{0x6205, 0x06f6, 0xDDE0'D83E}, // U+1F9E0, 🧠, \:brain:, Brain
+{0x630c, 0x0890, 0xDD20'D83D}, // U+1F520, 🔠, \:capital_abcd:, Input Symbol For Latin Capital Letters
+{0x6204, 0x0401, 0xDC3B'D83D}, // U+1F43B, 🐻, \:bear:, Bear Face
+{0x6215, 0x0612, 0x23F9}, // ⏹, \:black_square_for_stop:, Stop Button
+{0x610e, 0x011b, 0x25C0}, // ◀, \:arrow_backward:, Black Left-Pointing Triangle
+{0x6209, 0x0639, 0xDCD8'D83D}, // U+1F4D8, 📘, \:blue_book:, Blue Book
+{0x6304, 0x0ccc, 0xDD80'D83E}, // U+1F980, 🦀, \:crab:, Crab
+{0x6912, 0x1bf3, 0x2139}, // ℹ, \:information_source:, Information Source
+{0x7305, 0x341c, 0xDE04'D83D}, // U+1F604, 😄, \:smile:, Smiling Face With Open Mouth And Smiling Eyes
+{0x7320, 0x322d, 0xDD2F'D83E}, // U+1F92F, 🤯, \:shocked_face_with_exploding_head:, Shocked Face With Exploding Head
+{0x6607, 0x1336, 0xDDC6'D83E}, // U+1F9C6, 🧆, \:falafel:, Falafel
+{0x6110, 0x0157, 0xDD3D'D83D}, // U+1F53D, 🔽, \:arrow_down_small:, Down-Pointing Small Red Triangle
+{0x6c07, 0x213c, 0xDDF3'D83E}, // U+1F9F3, 🧳, \:luggage:, Luggage
+{0x6209, 0x0573, 0x2712}, // ✒, \:black_nib:, Black Nib
+{0x6110, 0x0189, 0x2934}, // ⤴, \:arrow_heading_up:, Arrow Pointing Rightwards Then Curving Upwards
+{0x7307, 0x35bd, 0xDD08'D83D}, // U+1F508, 🔈, \:speaker:, Speaker
+{0x6305, 0x0d49, 0xDC51'D83D}, // U+1F451, 👑, \:crown:, Crown
+{0x630b, 0x0a00, 0xDFAA'D83C}, // U+1F3AA, 🎪, \:circus_tent:, Circus Tent
+{0x6406, 0x0f59, 0xDECF'D83E}, // U+1FACF, 🫏, \:donkey:, Donkey
+{0x6a03, 0x1c75, 0xDED9'D83E}, // U+1FAD9, 🫙, \:jar:, Jar
+{0x6619, 0x1201, 0xDD2D'D83E}, // U+1F92D, 🤭, \:face_with_hand_over_mouth:, Smiling Face With Smiling Eyes And Hand Covering Mouth
+{0x7305, 0x384f, 0xDE13'D83D}, // U+1F613, 😓, \:sweat:, Face With Cold Sweat
+{0x730b, 0x32fb, 0xDFFD'D83C}, // U+1F3FD, 🏽, \:skin-tone-4:, Emoji Modifier Fitzpatrick Type-4
+{0x6b09, 0x1d38, 0xDD5D'D83E}, // U+1F95D, 🥝, \:kiwifruit:, Kiwifruit
+{0x740f, 0x3996, 0xDCAD'D83D}, // U+1F4AD, 💭, \:thought_balloon:, Thought Balloon
+{0x6708, 0x172d, 0xDE00'D83D}, // U+1F600, 😀, \:grinning:, Grinning Face
+{0x7512, 0x3bff, 0x26F1}, // ⛱, \:umbrella_on_ground:, Umbrella On Ground
+{0x6805, 0x1a3f, 0xDD2A'D83D}, // U+1F52A, 🔪, \:hocho:, Hocho
+{0x620b, 0x04f0, 0xDCCF'D83C}, // U+1F0CF, 🃏, \:black_joker:, Playing Card Black Joker
+{0x7714, 0x3d7d, 0xDF12'D83C}, // U+1F312, 🌒, \:waxing_crescent_moon:, Waxing Crescent Moon Symbol
+{0x6111, 0x01b6, 0x2198}, // ↘, \:arrow_lower_right:, South East Arrow
+{0x660b, 0x14fe, 0xDD4F'D83E}, // U+1F94F, 🥏, \:flying_disc:, Flying Disc
+{0x6308, 0x0afa, 0xDD61'D83D}, // U+1F561, 🕡, \:clock630:, Clock Face Six-Thirty
+{0x731c, 0x3753, 0xDE1C'D83D}, // U+1F61C, 😜, \:stuck_out_tongue_winking_eye:, Face With Stuck-Out Tongue And Winking Eye
+{0x730b, 0x36f0, 0xDE7A'D83E}, // U+1FA7A, 🩺, \:stethoscope:, Stethoscope
+{0x6309, 0x0bc3, 0xDCA5'D83D}, // U+1F4A5, 💥, \:collision:, Collision Symbol
+{0x7704, 0x3f7d, 0xDEB1'D83E}, // U+1FAB1, 🪱, \:worm:, Worm
+{0x7410, 0x3ad1, 0xDCD0'D83D}, // U+1F4D0, 📐, \:triangular_ruler:, Triangular Ruler
+{0x6307, 0x0b93, 0xDD65'D83E}, // U+1F965, 🥥, \:coconut:, Coconut
+{0x6304, 0x0a32, 0xDC4F'D83D}, // U+1F44F, 👏, \:clap:, Clapping Hands Sign
+{0x630e, 0x08d8, 0xDFA0'D83C}, // U+1F3A0, 🎠, \:carousel_horse:, Carousel Horse
+{0x661a, 0x12ed, 0xDD2C'D83E}, // U+1F92C, 🤬, \:face_with_symbols_on_mouth:, Serious Face With Symbols Covering Mouth
+{0x6307, 0x0a37, 0xDFAC'D83C}, // U+1F3AC, 🎬, \:clapper:, Clapper Board
+{0x7313, 0x31ce, 0xDD58'D83E}, // U+1F958, 🥘, \:shallow_pan_of_food:, Shallow Pan Of Food
+{0x740d, 0x3b42, 0xDD43'D83E}, // U+1F943, 🥃, \:tumbler_glass:, Tumbler Glass
+{0x7007, 0x2b4b, 0xDEA7'D83E}, // U+1FAA7, 🪧, \:placard:, Placard
+{0x6309, 0x0aa0, 0xDD67'D83D}, // U+1F567, 🕧, \:clock1230:, Clock Face Twelve-Thirty
+{0x6105, 0x00b6, 0xDC7D'D83D}, // U+1F47D, 👽, \:alien:, Extraterrestrial Alien
+{0x630a, 0x098d, 0x265F}, // ♟, \:chess_pawn:, Chess Pawn
+{0x6c08, 0x2039, 0xDC84'D83D}, // U+1F484, 💄, \:lipstick:, Lipstick
+{0x6206, 0x02e5, 0xDDA1'D83E}, // U+1F9A1, 🦡, \:badger:, Badger
+{0x7707, 0x3d0c, 0x26A0}, // ⚠, \:warning:, Warning Sign
+{0x6a06, 0x1c89, 0xDDE9'D83E}, // U+1F9E9, 🧩, \:jigsaw:, Jigsaw Puzzle Piece
+{0x720a, 0x2e1d, 0xDD34'D83D}, // U+1F534, 🔴, \:red_circle:, Large Red Circle
+{0x720d, 0x2f78, 0xDDFB'D83E}, // U+1F9FB, 🧻, \:roll_of_paper:, Roll Of Paper
+{0x6514, 0x111b, 0xDFE4'D83C}, // U+1F3E4, 🏤, \:european_post_office:, European Post Office
+{0x660c, 0x1351, 0x23E9}, // ⏩, \:fast_forward:, Black Right-Pointing Double Triangle
+{0x6d09, 0x224a, 0xDC5E'D83D}, // U+1F45E, 👞, \:mans_shoe:, Mans Shoe
+{0x7a03, 0x3ff0, 0x26A1}, // ⚡, \:zap:, High Voltage Sign
+{0x6204, 0x02b2, 0xDC76'D83D}, // U+1F476, 👶, \:baby:, Baby
+{0x6816, 0x1950, 0x2757}, // ❗, \:heavy_exclamation_mark:, Heavy Exclamation Mark Symbol
+{0x7016, 0x29f6, 0xDD38'D83E}, // U+1F938, 🤸, \:person_doing_cartwheel:, Person Doing Cartwheel
+{0x7217, 0x302c, 0xDFBD'D83C}, // U+1F3BD, 🎽, \:running_shirt_with_sash:, Running Shirt With Sash
+{0x6235, 0x050f, 0x23EE}, // ⏮, \:black_left_pointing_double_triangle_with_vertical_bar:, Last Track Button
+{0x6d04, 0x2342, 0xDEB9'D83D}, // U+1F6B9, 🚹, \:mens:, Mens Symbol
+{0x730b, 0x3307, 0xDFFE'D83C}, // U+1F3FE, 🏾, \:skin-tone-5:, Emoji Modifier Fitzpatrick Type-5
+{0x6b05, 0x1d52, 0xDD2A'D83D}, // U+1F52A, 🔪, \:knife:, Hocho
+{0x7316, 0x334e, 0xDECC'D83D}, // U+1F6CC, 🛌, \:sleeping_accommodation:, Sleeping Accommodation
+{0x7711, 0x3d4f, 0xDFF4'D83C}, // U+1F3F4, 🏴, \:waving_black_flag:, Waving Black Flag
+{0x7305, 0x3202, 0xDC1A'D83D}, // U+1F41A, 🐚, \:shell:, Spiral Shell
+{0x610d, 0x01ee, 0x2195}, // ↕, \:arrow_up_down:, Up Down Arrow
+{0x6e0e, 0x25cd, 0xDEBA'D83E}, // U+1FABA, 🪺, \:nest_with_eggs:, Nest With Eggs
+{0x6213, 0x055f, 0x25FC}, // ◼, \:black_medium_square:, Black Medium Square
+{0x6806, 0x17bd, 0xDD28'D83D}, // U+1F528, 🔨, \:hammer:, Hammer
+{0x7310, 0x36df, 0xDE82'D83D}, // U+1F682, 🚂, \:steam_locomotive:, Steam Locomotive
+{0x6203, 0x06f2, 0xDC66'D83D}, // U+1F466, 👦, \:boy:, Boy
+{0x6205, 0x03fb, 0xDED8'D83E}, // U+1FAD8, 🫘, \:beans:, Beans
+{0x6d08, 0x2497, 0xDEE3'D83D}, // U+1F6E3, 🛣, \:motorway:, Motorway
+{0x6e0c, 0x25ea, 0xDE10'D83D}, // U+1F610, 😐, \:neutral_face:, Neutral Face
+{0x6111, 0x021c, 0x2197}, // ↗, \:arrow_upper_right:, North East Arrow
+{0x7308, 0x306a, 0x26F5}, // ⛵, \:sailboat:, Sailboat
+{0x6205, 0x045d, 0xDF71'D83C}, // U+1F371, 🍱, \:bento:, Bento Box
+{0x6c0e, 0x20d4, 0xDD05'D83D}, // U+1F505, 🔅, \:low_brightness:, Low Brightness Symbol
+{0x7404, 0x38c4, 0xDF89'D83C}, // U+1F389, 🎉, \:tada:, Party Popper
+{0x680c, 0x1a25, 0xDED5'D83D}, // U+1F6D5, 🛕, \:hindu_temple:, Hindu Temple
+{0x6212, 0x07e1, 0xDC64'D83D}, // U+1F464, 👤, \:bust_in_silhouette:, Bust In Silhouette
+{0x7706, 0x3f8a, 0xDD27'D83D}, // U+1F527, 🔧, \:wrench:, Wrench
+{0x6709, 0x1782, 0xDC82'D83D}, // U+1F482, 💂, \:guardsman:, Guardsman
+{0x6307, 0x0a98, 0xDD5B'D83D}, // U+1F55B, 🕛, \:clock12:, Clock Face Twelve Oclock
+{0x7310, 0x3794, 0xDF25'D83C}, // U+1F325, 🌥, \:sun_behind_cloud:, Sun Behind Large Cloud
+{0x730a, 0x3601, 0xDD78'D83D}, // U+1F578, 🕸, \:spider_web:, Spider Web
+{0x6204, 0x03d2, 0xDEC0'D83D}, // U+1F6C0, 🛀, \:bath:, Bath
+{0x6a05, 0x1c41, 0xDDFE'D83D}, // U+1F5FE, 🗾, \:japan:, Silhouette Of Japan
+{0x6215, 0x035d, 0x2611}, // ☑, \:ballot_box_with_check:, Ballot Box With Check
+{0x6f07, 0x273f, 0xDDDD'D83D}, // U+1F5DD, 🗝, \:old_key:, Old Key
+{0x670d, 0x1664, 0xDD5B'D83E}, // U+1F95B, 🥛, \:glass_of_milk:, Glass Of Milk
+{0x6102, 0x0018, 0xDD8E'D83C}, // U+1F18E, 🆎, \:ab:, Negative Squared Ab
+{0x6504, 0x1106, 0xDCB6'D83D}, // U+1F4B6, 💶, \:euro:, Banknote With Euro Sign
+{0x670b, 0x16c5, 0xDF4F'D83C}, // U+1F34F, 🍏, \:green_apple:, Green Apple
+{0x7406, 0x39f8, 0xDC05'D83D}, // U+1F405, 🐅, \:tiger2:, Tiger
+{0x7207, 0x3006, 0xDEA3'D83D}, // U+1F6A3, 🚣, \:rowboat:, Rowboat
+{0x7417, 0x3b9c, 0xDC6D'D83D}, // U+1F46D, 👭, \:two_women_holding_hands:, Two Women Holding Hands
+{0x660a, 0x1548, 0xDC63'D83D}, // U+1F463, 👣, \:footprints:, Footprints
+{0x7708, 0x3eed, 0xDEDC'D83D}, // U+1F6DC, 🛜, \:wireless:, Wireless
+{0x7309, 0x35f0, 0xDEA4'D83D}, // U+1F6A4, 🚤, \:speedboat:, Speedboat
+{0x6808, 0x1a75, 0xDFE5'D83C}, // U+1F3E5, 🏥, \:hospital:, Hospital
+{0x730d, 0x36b1, 0x2721}, // ✡, \:star_of_david:, Star Of David
+{0x660b, 0x1410, 0xDDE8'D83E}, // U+1F9E8, 🧨, \:firecracker:, Firecracker
+{0x7405, 0x3a94, 0xDE8B'D83D}, // U+1F68B, 🚋, \:train:, Tram Car
+{0x7208, 0x2e48, 0xDE0C'D83D}, // U+1F60C, 😌, \:relieved:, Relieved Face
+{0x610f, 0x013c, 0x23EB}, // ⏫, \:arrow_double_up:, Black Up-Pointing Double Triangle
+{0x7308, 0x3092, 0xDD6A'D83E}, // U+1F96A, 🥪, \:sandwich:, Sandwich
+{0x6208, 0x0643, 0xDE99'D83D}, // U+1F699, 🚙, \:blue_car:, Recreational Vehicle
+{0x620e, 0x0322, 0xDD56'D83E}, // U+1F956, 🥖, \:baguette_bread:, Baguette Bread
+{0x630e, 0x0c90, 0xDECB'D83D}, // U+1F6CB, 🛋, \:couch_and_lamp:, Couch And Lamp
+{0x770f, 0x3dd8, 0x2638}, // ☸, \:wheel_of_dharma:, Wheel Of Dharma
+{0x6a09, 0x1c7f, 0xDEBC'D83E}, // U+1FABC, 🪼, \:jellyfish:, Jellyfish
+{0x7007, 0x296e, 0xDEDB'D83E}, // U+1FADB, 🫛, \:pea_pod:, Pea Pod
+{0x6603, 0x14fa, 0xDEB0'D83E}, // U+1FAB0, 🪰, \:fly:, Fly
+{0x7016, 0x2a6e, 0xDC71'D83D}, // U+1F471, 👱, \:person_with_blond_hair:, Person With Blond Hair
+{0x6f09, 0x282c, 0xDDA7'D83E}, // U+1F9A7, 🦧, \:orangutan:, Orangutan
+{0x6810, 0x1907, 0x2714}, // ✔, \:heavy_check_mark:, Heavy Check Mark
+{0x730d, 0x3253, 0xDECD'D83D}, // U+1F6CD, 🛍, \:shopping_bags:, Shopping Bags
+{0x7305, 0x34b3, 0xDE0F'D83D}, // U+1F60F, 😏, \:smirk:, Smirking Face
+{0x730b, 0x316e, 0xDE48'D83D}, // U+1F648, 🙈, \:see_no_evil:, See-No-Evil Monkey
+{0x6d10, 0x252f, 0xDFB9'D83C}, // U+1F3B9, 🎹, \:musical_keyboard:, Musical Keyboard
+{0x6303, 0x0cc3, 0xDC2E'D83D}, // U+1F42E, 🐮, \:cow:, Cow Face
+{0x7505, 0x3bb4, 0xDE39'D83C}, // U+1F239, 🈹, \:u5272:, Squared Cjk Unified Ideograph-5272
+{0x6503, 0x10d0, 0xDDDD'D83E}, // U+1F9DD, 🧝, \:elf:, Elf
+{0x7206, 0x2eb7, 0x23EA}, // ⏪, \:rewind:, Black Left-Pointing Double Triangle
+{0x771b, 0x3f01, 0xDC6B'D83D}, // U+1F46B, 👫, \:woman_and_man_holding_hands:, Man And Woman Holding Hands
+{0x6806, 0x1900, 0x2665}, // ♥, \:hearts:, Black Heart Suit
+{0x6d07, 0x22a5, 0xDC86'D83D}, // U+1F486, 💆, \:massage:, Face Massage
+{0x620e, 0x0702, 0xDD31'D83E}, // U+1F931, 🤱, \:breast-feeding:, Breast-Feeding
+{0x7004, 0x2af1, 0xDC16'D83D}, // U+1F416, 🐖, \:pig2:, Pig
+{0x6b05, 0x1cae, 0xDD4B'D83D}, // U+1F54B, 🕋, \:kaaba:, Kaaba
+{0x6c10, 0x1f32, 0xDD1B'D83E}, // U+1F91B, 🤛, \:left-facing_fist:, Left-Facing Fist
+{0x7719, 0x3e51, 0x25FD}, // ◽, \:white_medium_small_square:, White Medium Small Square
+{0x730a, 0x31f1, 0xDF67'D83C}, // U+1F367, 🍧, \:shaved_ice:, Shaved Ice
+{0x2d02, 0x0004, 0xDC4E'D83D}, // U+1F44E, 👎, \:-1:, Thumbs Down Sign
+{0x6308, 0x0998, 0xDF30'D83C}, // U+1F330, 🌰, \:chestnut:, Chestnut
+{0x7308, 0x31e2, 0x2618}, // ☘, \:shamrock:, Shamrock
+{0x6607, 0x14ec, 0xDE33'D83D}, // U+1F633, 😳, \:flushed:, Flushed Face
+{0x7304, 0x3340, 0xDEF7'D83D}, // U+1F6F7, 🛷, \:sled:, Sled
+{0x700d, 0x2935, 0xDD73'D83E}, // U+1F973, 🥳, \:partying_face:, Face With Party Horn And Party Hat
+{0x720a, 0x2d23, 0xDFCE'D83C}, // U+1F3CE, 🏎, \:racing_car:, Racing Car
+{0x730b, 0x3505, 0xDFC2'D83C}, // U+1F3C2, 🏂, \:snowboarder:, Snowboarder
+{0x6407, 0x0f51, 0xDC2C'D83D}, // U+1F42C, 🐬, \:dolphin:, Dolphin
+{0x6d06, 0x23fd, 0xDC12'D83D}, // U+1F412, 🐒, \:monkey:, Monkey
+{0x6f05, 0x2845, 0xDDA6'D83E}, // U+1F9A6, 🦦, \:otter:, Otter
+{0x700f, 0x29e6, 0xDDD7'D83E}, // U+1F9D7, 🧗, \:person_climbing:, Person Climbing
+{0x7305, 0x37ee, 0x2600}, // ☀, \:sunny:, Black Sun With Rays
+{0x7305, 0x3287, 0xDD37'D83E}, // U+1F937, 🤷, \:shrug:, Shrug
+{0x6d10, 0x2458, 0xDD36'D83E}, // U+1F936, 🤶, \:mother_christmas:, Mother Christmas
+{0x7207, 0x2d11, 0xDD9D'D83E}, // U+1F99D, 🦝, \:raccoon:, Raccoon
+{0x6608, 0x158b, 0xDD8A'D83E}, // U+1F98A, 🦊, \:fox_face:, Fox Face
+{0x6203, 0x078b, 0xDC1B'D83D}, // U+1F41B, 🐛, \:bug:, Bug
+{0x6303, 0x0c77, 0xDC6E'D83D}, // U+1F46E, 👮, \:cop:, Police Officer
+{0x7304, 0x3073, 0xDF76'D83C}, // U+1F376, 🍶, \:sake:, Sake Bottle And Cup
+{0x730d, 0x320f, 0x26E9}, // ⛩, \:shinto_shrine:, Shinto Shrine
+{0x6f13, 0x277c, 0xDE98'D83D}, // U+1F698, 🚘, \:oncoming_automobile:, Oncoming Automobile
+{0x6d0a, 0x2469, 0xDEE5'D83D}, // U+1F6E5, 🛥, \:motor_boat:, Motor Boat
+{0x6206, 0x047f, 0xDC59'D83D}, // U+1F459, 👙, \:bikini:, Bikini
+{0x6306, 0x0d4f, 0xDE7C'D83E}, // U+1FA7C, 🩼, \:crutch:, Crutch
+{0x6303, 0x0d56, 0xDE22'D83D}, // U+1F622, 😢, \:cry:, Crying Face
+{0x6e10, 0x266e, 0xDCF5'D83D}, // U+1F4F5, 📵, \:no_mobile_phones:, No Mobile Phones
+{0x6806, 0x1b00, 0xDE2F'D83D}, // U+1F62F, 😯, \:hushed:, Hushed Face
+{0x6308, 0x0d77, 0xDD52'D83E}, // U+1F952, 🥒, \:cucumber:, Cucumber
+{0x620a, 0x02c3, 0xDC24'D83D}, // U+1F424, 🐤, \:baby_chick:, Baby Chick
+{0x630a, 0x0dab, 0x27B0}, // ➰, \:curly_loop:, Curly Loop
+{0x790c, 0x3fc2, 0xDC9B'D83D}, // U+1F49B, 💛, \:yellow_heart:, Yellow Heart
+{0x6c10, 0x1fdd, 0xDE75'D83E}, // U+1FA75, 🩵, \:light_blue_heart:, Light Blue Heart
+{0x6f10, 0x27e2, 0xDCC2'D83D}, // U+1F4C2, 📂, \:open_file_folder:, Open File Folder
+{0x6817, 0x19d9, 0x26D1}, // ⛑, \:helmet_with_white_cross:, Rescue Worker’S Helmet
+{0x7711, 0x3d61, 0xDFF3'D83C}, // U+1F3F3, 🏳, \:waving_white_flag:, White Flag
+{0x7006, 0x2bcc, 0xDC29'D83D}, // U+1F429, 🐩, \:poodle:, Poodle
+{0x630e, 0x0959, 0xDFC1'D83C}, // U+1F3C1, 🏁, \:checkered_flag:, Chequered Flag
+{0x740d, 0x3a66, 0xDF2A'D83C}, // U+1F32A, 🌪, \:tornado_cloud:, Tornado
+{0x630c, 0x0c22, 0xDEA7'D83D}, // U+1F6A7, 🚧, \:construction:, Construction Sign
+{0x6d0a, 0x24a0, 0xDDFB'D83D}, // U+1F5FB, 🗻, \:mount_fuji:, Mount Fuji
+{0x6c03, 0x1fb4, 0xDDB5'D83E}, // U+1F9B5, 🦵, \:leg:, Leg
+{0x7007, 0x29a5, 0x270F}, // ✏, \:pencil2:, Pencil
+{0x7005, 0x288b, 0xDCDF'D83D}, // U+1F4DF, 📟, \:pager:, Pager
+{0x6825, 0x1967, 0x2763}, // ❣, \:heavy_heart_exclamation_mark_ornament:, Heart Exclamation
+{0x6c07, 0x1da4, 0xDC1E'D83D}, // U+1F41E, 🐞, \:ladybug:, Lady Beetle
+{0x6103, 0x02ac, 0xDE93'D83E}, // U+1FA93, 🪓, \:axe:, Axe
+{0x6c09, 0x202a, 0xDD81'D83E}, // U+1F981, 🦁, \:lion_face:, Lion Face
+{0x7a06, 0x4011, 0xDDDF'D83E}, // U+1F9DF, 🧟, \:zombie:, Zombie
+{0x7801, 0x3fa8, 0x274C}, // ❌, \:x:, Cross Mark
+{0x6609, 0x1195, 0xDD26'D83E}, // U+1F926, 🤦, \:face_palm:, Face Palm
+{0x700b, 0x2be0, 0xDFE3'D83C}, // U+1F3E3, 🏣, \:post_office:, Japanese Post Office
+{0x7311, 0x3770, 0xDF99'D83C}, // U+1F399, 🎙, \:studio_microphone:, Studio Microphone
+{0x620c, 0x03a6, 0xDF25'D83C}, // U+1F325, 🌥, \:barely_sunny:, Sun Behind Large Cloud
+{0x7306, 0x3208, 0xDEE1'D83D}, // U+1F6E1, 🛡, \:shield:, Shield
+{0x660b, 0x1377, 0x2640}, // ♀, \:female_sign:, Female Sign
+{0x6611, 0x1232, 0xDDD0'D83E}, // U+1F9D0, 🧐, \:face_with_monocle:, Face With Monocle
+{0x7307, 0x37f4, 0xDF05'D83C}, // U+1F305, 🌅, \:sunrise:, Sunrise
+{0x670a, 0x163b, 0xDC9D'D83D}, // U+1F49D, 💝, \:gift_heart:, Heart With Ribbon
+{0x6c0b, 0x20c8, 0xDEAB'D83E}, // U+1FAAB, 🪫, \:low_battery:, Low Battery
+{0x720c, 0x2d46, 0xDD18'D83D}, // U+1F518, 🔘, \:radio_button:, Radio Button
+{0x6d06, 0x23ae, 0xDE9E'D83E}, // U+1FA9E, 🪞, \:mirror:, Mirror
+{0x6816, 0x1ab4, 0x23F3}, // ⏳, \:hourglass_flowing_sand:, Hourglass With Flowing Sand
+{0x7206, 0x2f71, 0xDE80'D83D}, // U+1F680, 🚀, \:rocket:, Rocket
+{0x7304, 0x3538, 0xDDFC'D83E}, // U+1F9FC, 🧼, \:soap:, Bar Of Soap
+{0x770c, 0x3e11, 0xDCAE'D83D}, // U+1F4AE, 💮, \:white_flower:, White Flower
+{0x6305, 0x0bcd, 0x2604}, // ☄, \:comet:, Comet
+{0x6808, 0x19f6, 0xDF3A'D83C}, // U+1F33A, 🌺, \:hibiscus:, Hibiscus
+{0x6205, 0x04ae, 0xDDAC'D83E}, // U+1F9AC, 🦬, \:bison:, Bison
+{0x6b04, 0x1d33, 0xDE81'D83E}, // U+1FA81, 🪁, \:kite:, Kite
+{0x6e0d, 0x2575, 0xDFDE'D83C}, // U+1F3DE, 🏞, \:national_park:, National Park
+{0x6514, 0x1032, 0xDDBB'D83E}, // U+1F9BB, 🦻, \:ear_with_hearing_aid:, Ear With Hearing Aid
+{0x6608, 0x1498, 0xDDA9'D83E}, // U+1F9A9, 🦩, \:flamingo:, Flamingo
+{0x6605, 0x1492, 0xDF8F'D83C}, // U+1F38F, 🎏, \:flags:, Carp Streamer
+{0x7404, 0x38fb, 0xDE95'D83D}, // U+1F695, 🚕, \:taxi:, Taxi
+{0x7407, 0x3a7e, 0xDE9C'D83D}, // U+1F69C, 🚜, \:tractor:, Tractor
+{0x7406, 0x38d5, 0xDED4'D83E}, // U+1FAD4, 🫔, \:tamale:, Tamale
+{0x6705, 0x16b0, 0xDEBF'D83E}, // U+1FABF, 🪿, \:goose:, Goose
+{0x730c, 0x381d, 0xDDB9'D83E}, // U+1F9B9, 🦹, \:supervillain:, Supervillain
+{0x700a, 0x2bb6, 0xDC46'D83D}, // U+1F446, 👆, \:point_up_2:, White Up Pointing Backhand Index
+{0x6809, 0x1897, 0xDEA6'D83E}, // U+1FAA6, 🪦, \:headstone:, Headstone
+{0x7805, 0x3faa, 0xDE7B'D83E}, // U+1FA7B, 🩻, \:x-ray:, X-Ray
+{0x6305, 0x0843, 0xDC2B'D83D}, // U+1F42B, 🐫, \:camel:, Bactrian Camel
+{0x6808, 0x1a54, 0xDC1D'D83D}, // U+1F41D, 🐝, \:honeybee:, Honeybee
+{0x6d01, 0x2155, 0x24C2}, // Ⓜ, \:m:, Circled Latin Capital Letter M
+{0x6508, 0x10c7, 0xDED7'D83D}, // U+1F6D7, 🛗, \:elevator:, Elevator
+{0x760c, 0x3c99, 0xDCF9'D83D}, // U+1F4F9, 📹, \:video_camera:, Video Camera
+{0x6c05, 0x2094, 0xDEB7'D83E}, // U+1FAB7, 🪷, \:lotus:, Lotus
+{0x700b, 0x2bec, 0xDCEF'D83D}, // U+1F4EF, 📯, \:postal_horn:, Postal Horn
+{0x7007, 0x2cd9, 0xDCCC'D83D}, // U+1F4CC, 📌, \:pushpin:, Pushpin
+{0x6f0c, 0x281f, 0xDDE1'D83E}, // U+1F9E1, 🧡, \:orange_heart:, Orange Heart
+{0x6201, 0x02b0, 0xDD71'D83C}, // U+1F171, 🅱, \:b:, Negative Squared Latin Capital Letter B
+{0x7709, 0x3f73, 0xDDFA'D83D}, // U+1F5FA, 🗺, \:world_map:, World Map
+{0x7308, 0x3102, 0x2702}, // ✂, \:scissors:, Black Scissors
+{0x6415, 0x0ed8, 0xDE25'D83D}, // U+1F625, 😥, \:disappointed_relieved:, Disappointed But Relieved Face
+{0x7306, 0x30ec, 0xDFEB'D83C}, // U+1F3EB, 🏫, \:school:, School
+{0x7606, 0x3cb1, 0xDFBB'D83C}, // U+1F3BB, 🎻, \:violin:, Violin
+{0x770a, 0x3de8, 0x267F}, // ♿, \:wheelchair:, Wheelchair Symbol
+{0x670b, 0x16e8, 0xDD57'D83E}, // U+1F957, 🥗, \:green_salad:, Green Salad
+{0x610a, 0x019a, 0x2B05}, // ⬅, \:arrow_left:, Leftwards Black Arrow
+{0x6908, 0x1bd2, 0x267E}, // ♾, \:infinity:, Infinity
+{0x730d, 0x336c, 0xDD75'D83D}, // U+1F575, 🕵, \:sleuth_or_spy:, Detective
+{0x6704, 0x16a4, 0x26F3}, // ⛳, \:golf:, Flag In Hole
+{0x6d08, 0x23f4, 0xDCB0'D83D}, // U+1F4B0, 💰, \:moneybag:, Money Bag
+{0x7011, 0x28b7, 0xDD32'D83E}, // U+1F932, 🤲, \:palms_up_together:, Palms Up Together
+{0x7205, 0x2d40, 0xDCFB'D83D}, // U+1F4FB, 📻, \:radio:, Radio
+{0x7311, 0x30b0, 0xDCE1'D83D}, // U+1F4E1, 📡, \:satellite_antenna:, Satellite Antenna
+{0x6306, 0x09f2, 0x26EA}, // ⛪, \:church:, Church
+{0x6a08, 0x1c9c, 0xDD79'D83D}, // U+1F579, 🕹, \:joystick:, Joystick
+{0x730a, 0x312c, 0xDE40'D83D}, // U+1F640, 🙀, \:scream_cat:, Weary Cat Face
+{0x6404, 0x1003, 0xDD86'D83E}, // U+1F986, 🦆, \:duck:, Duck
+{0x7307, 0x3585, 0x2747}, // ❇, \:sparkle:, Sparkle
+{0x7306, 0x3279, 0xDEBF'D83D}, // U+1F6BF, 🚿, \:shower:, Shower
+{0x7305, 0x3548, 0xDDE6'D83E}, // U+1F9E6, 🧦, \:socks:, Socks
+{0x6209, 0x080f, 0xDD8B'D83E}, // U+1F98B, 🦋, \:butterfly:, Butterfly
+{0x7304, 0x3228, 0xDCA9'D83D}, // U+1F4A9, 💩, \:shit:, Pile Of Poo
+{0x6c0b, 0x1d98, 0xDC1E'D83D}, // U+1F41E, 🐞, \:lady_beetle:, Lady Beetle
+{0x730d, 0x31b3, 0xDEA1'D83E}, // U+1FAA1, 🪡, \:sewing_needle:, Sewing Needle
+{0x770a, 0x3ed8, 0xDF77'D83C}, // U+1F377, 🍷, \:wine_glass:, Wine Glass
+{0x6d0a, 0x22ad, 0xDDC9'D83E}, // U+1F9C9, 🧉, \:mate_drink:, Mate Drink
+{0x7303, 0x32d9, 0xDFBF'D83C}, // U+1F3BF, 🎿, \:ski:, Ski And Ski Boot
+{0x7009, 0x29dc, 0xDE23'D83D}, // U+1F623, 😣, \:persevere:, Persevering Face
+{0x7204, 0x2ed0, 0xDF5A'D83C}, // U+1F35A, 🍚, \:rice:, Cooked Rice
+{0x6108, 0x010c, 0x2652}, // ♒, \:aquarius:, Aquarius
+{0x7011, 0x2923, 0xDF26'D83C}, // U+1F326, 🌦, \:partly_sunny_rain:, Sun Behind Rain Cloud
+{0x700e, 0x286d, 0xDCC4'D83D}, // U+1F4C4, 📄, \:page_facing_up:, Page Facing Up
+{0x7a09, 0x3fe6, 0xDD2A'D83E}, // U+1F92A, 🤪, \:zany_face:, Grinning Face With One Large And One Small Eye
+{0x7713, 0x3cf8, 0xDF16'D83C}, // U+1F316, 🌖, \:waning_gibbous_moon:, Waning Gibbous Moon Symbol
+{0x6e0e, 0x2583, 0xDD22'D83E}, // U+1F922, 🤢, \:nauseated_face:, Nauseated Face
+{0x7505, 0x3bba, 0xDE34'D83C}, // U+1F234, 🈴, \:u5408:, Squared Cjk Unified Ideograph-5408
+{0x6605, 0x14f4, 0xDE88'D83E}, // U+1FA88, 🪈, \:flute:, Flute
+{0x7405, 0x3b3c, 0xDF37'D83C}, // U+1F337, 🌷, \:tulip:, Tulip
+{0x7903, 0x3fcf, 0xDCB4'D83D}, // U+1F4B4, 💴, \:yen:, Banknote With Yen Sign
+{0x7406, 0x3b57, 0xDC22'D83D}, // U+1F422, 🐢, \:turtle:, Turtle
+{0x6902, 0x1b69, 0xDD94'D83C}, // U+1F194, 🆔, \:id:, Squared Id
+{0x620f, 0x06cd, 0xDD63'D83E}, // U+1F963, 🥣, \:bowl_with_spoon:, Bowl With Spoon
+{0x7005, 0x2cd3, 0xDC5B'D83D}, // U+1F45B, 👛, \:purse:, Purse
+{0x620b, 0x04e4, 0xDDA4'D83D}, // U+1F5A4, 🖤, \:black_heart:, Black Heart
+{0x7305, 0x3699, 0xDF1F'D83C}, // U+1F31F, 🌟, \:star2:, Glowing Star
+{0x7402, 0x3b5e, 0xDCFA'D83D}, // U+1F4FA, 📺, \:tv:, Television
+{0x6308, 0x0aca, 0xDD5E'D83D}, // U+1F55E, 🕞, \:clock330:, Clock Face Three-Thirty
+{0x6d05, 0x22fd, 0xDF48'D83C}, // U+1F348, 🍈, \:melon:, Melon
+{0x730b, 0x34a7, 0xDE08'D83D}, // U+1F608, 😈, \:smiling_imp:, Smiling Face With Horns
+{0x7306, 0x382a, 0xDFC4'D83C}, // U+1F3C4, 🏄, \:surfer:, Surfer
+{0x7010, 0x2b53, 0xDED0'D83D}, // U+1F6D0, 🛐, \:place_of_worship:, Place Of Worship
+{0x6919, 0x1b3c, 0xDFD2'D83C}, // U+1F3D2, 🏒, \:ice_hockey_stick_and_puck:, Ice Hockey Stick And Puck
+{0x7505, 0x3bd2, 0xDE36'D83C}, // U+1F236, 🈶, \:u6709:, Squared Cjk Unified Ideograph-6709
+{0x6404, 0x0e2e, 0xDCC5'D83D}, // U+1F4C5, 📅, \:date:, Calendar
+{0x6d08, 0x2410, 0xDE9D'D83D}, // U+1F69D, 🚝, \:monorail:, Monorail
+{0x6206, 0x03bc, 0xDDFA'D83E}, // U+1F9FA, 🧺, \:basket:, Basket
+{0x6d0c, 0x2502, 0xDFA5'D83C}, // U+1F3A5, 🎥, \:movie_camera:, Movie Camera
+{0x6d13, 0x2220, 0xDC72'D83D}, // U+1F472, 👲, \:man_with_gua_pi_mao:, Man With Gua Pi Mao
+{0x680a, 0x188c, 0xDFA7'D83C}, // U+1F3A7, 🎧, \:headphones:, Headphone
+{0x7306, 0x3125, 0xDE31'D83D}, // U+1F631, 😱, \:scream:, Face Screaming In Fear
+{0x7710, 0x3df3, 0x2705}, // ✅, \:white_check_mark:, White Heavy Check Mark
+{0x7406, 0x3904, 0xDED6'D83E}, // U+1FAD6, 🫖, \:teapot:, Teapot
+{0x7306, 0x3280, 0xDD90'D83E}, // U+1F990, 🦐, \:shrimp:, Shrimp
+{0x6404, 0x0f60, 0xDEAA'D83D}, // U+1F6AA, 🚪, \:door:, Door
+{0x6c13, 0x1e37, 0xDFE0'D83D}, // U+1F7E0, 🟠, \:large_orange_circle:, Large Orange Circle
+{0x620c, 0x0463, 0xDDC3'D83E}, // U+1F9C3, 🧃, \:beverage_box:, Beverage Box
+{0x6d0a, 0x24f7, 0xDEA4'D83E}, // U+1FAA4, 🪤, \:mouse_trap:, Mouse Trap
+{0x6203, 0x06bb, 0xDE47'D83D}, // U+1F647, 🙇, \:bow:, Person Bowing Deeply
+{0x6304, 0x0ba9, 0xDE99'D83E}, // U+1FA99, 🪙, \:coin:, Coin
+{0x6807, 0x17ec, 0xDC39'D83D}, // U+1F439, 🐹, \:hamster:, Hamster Face
+{0x6d03, 0x2157, 0xDD0D'D83D}, // U+1F50D, 🔍, \:mag:, Left-Pointing Magnifying Glass
+{0x640d, 0x0f93, 0xDD4A'D83D}, // U+1F54A, 🕊, \:dove_of_peace:, Dove
+{0x630f, 0x0d5a, 0xDE3F'D83D}, // U+1F63F, 😿, \:crying_cat_face:, Crying Cat Face
+{0x7406, 0x3a9a, 0xDE86'D83D}, // U+1F686, 🚆, \:train2:, Train
+{0x6c04, 0x2034, 0xDC44'D83D}, // U+1F444, 👄, \:lips:, Mouth
+{0x7316, 0x337a, 0xDE41'D83D}, // U+1F641, 🙁, \:slightly_frowning_face:, Slightly Frowning Face
+{0x700e, 0x287c, 0xDCC3'D83D}, // U+1F4C3, 📃, \:page_with_curl:, Page With Curl
+{0x6d07, 0x2357, 0xDDA0'D83E}, // U+1F9A0, 🦠, \:microbe:, Microbe
+{0x7903, 0x3fe2, 0xDE0B'D83D}, // U+1F60B, 😋, \:yum:, Face Savouring Delicious Food
+{0x6809, 0x18eb, 0xDC93'D83D}, // U+1F493, 💓, \:heartbeat:, Beating Heart
+{0x620c, 0x0331, 0xDE70'D83E}, // U+1FA70, 🩰, \:ballet_shoes:, Ballet Shoes
+{0x6610, 0x157a, 0xDF40'D83C}, // U+1F340, 🍀, \:four_leaf_clover:, Four Leaf Clover
+{0x7007, 0x2b83, 0xDEA0'D83E}, // U+1FAA0, 🪠, \:plunger:, Plunger
+{0x6c04, 0x2081, 0x27BF}, // ➿, \:loop:, Double Curly Loop
+{0x660d, 0x119f, 0xDD2E'D83E}, // U+1F92E, 🤮, \:face_vomiting:, Face With Open Mouth Vomiting
+{0x660a, 0x14a1, 0xDD26'D83D}, // U+1F526, 🔦, \:flashlight:, Electric Torch
+{0x7010, 0x2b64, 0xDEDD'D83D}, // U+1F6DD, 🛝, \:playground_slide:, Playground Slide
+{0x660b, 0x14cb, 0xDCBE'D83D}, // U+1F4BE, 💾, \:floppy_disk:, Floppy Disk
+{0x7305, 0x34d1, 0xDC0D'D83D}, // U+1F40D, 🐍, \:snake:, Snake
+{0x6e09, 0x2617, 0xDCF0'D83D}, // U+1F4F0, 📰, \:newspaper:, Newspaper
+{0x6e11, 0x26a2, 0xDEB1'D83D}, // U+1F6B1, 🚱, \:non-potable_water:, Non-Potable Water Symbol
+{0x6c18, 0x20e3, 0xDD8A'D83D}, // U+1F58A, 🖊, \:lower_left_ballpoint_pen:, Pen
+{0x6914, 0x1b14, 0xDD1F'D83E}, // U+1F91F, 🤟, \:i_love_you_hand_sign:, I Love You Hand Sign
+{0x7007, 0x2bf8, 0xDCEE'D83D}, // U+1F4EE, 📮, \:postbox:, Postbox
+{0x6513, 0x10f2, 0xDCE9'D83D}, // U+1F4E9, 📩, \:envelope_with_arrow:, Envelope With Downwards Arrow Above
+{0x6d0a, 0x236a, 0xDD2C'D83D}, // U+1F52C, 🔬, \:microscope:, Microscope
+{0x650e, 0x114b, 0xDD2F'D83E}, // U+1F92F, 🤯, \:exploding_head:, Shocked Face With Exploding Head
+{0x730f, 0x32ad, 0xDCF6'D83D}, // U+1F4F6, 📶, \:signal_strength:, Antenna With Bars
+{0x6111, 0x012a, 0x23EC}, // ⏬, \:arrow_double_down:, Black Down-Pointing Double Triangle
+{0x7007, 0x2989, 0xDD9A'D83E}, // U+1F99A, 🦚, \:peacock:, Peacock
+{0x6d0e, 0x22e9, 0x2695}, // ⚕, \:medical_symbol:, Medical Symbol
+{0x7707, 0x3f82, 0xDE1F'D83D}, // U+1F61F, 😟, \:worried:, Worried Face
+{0x7416, 0x39d4, 0x26C8}, // ⛈, \:thunder_cloud_and_rain:, Cloud With Lightning And Rain
+{0x6106, 0x001b, 0xDDEE'D83E}, // U+1F9EE, 🧮, \:abacus:, Abacus
+{0x6f08, 0x2736, 0xDE46'D83D}, // U+1F646, 🙆, \:ok_woman:, Face With Ok Gesture
+{0x6607, 0x1328, 0xDFED'D83C}, // U+1F3ED, 🏭, \:factory:, Factory
+{0x6604, 0x1372, 0xDC3E'D83D}, // U+1F43E, 🐾, \:feet:, Paw Prints
+{0x6508, 0x1072, 0xDF46'D83C}, // U+1F346, 🍆, \:eggplant:, Aubergine
+{0x7409, 0x38ea, 0xDF4A'D83C}, // U+1F34A, 🍊, \:tangerine:, Tangerine
+{0x6110, 0x01a5, 0x2199}, // ↙, \:arrow_lower_left:, South West Arrow
+{0x6d06, 0x2175, 0xDDF2'D83E}, // U+1F9F2, 🧲, \:magnet:, Magnet
+{0x6608, 0x15d7, 0x26FD}, // ⛽, \:fuelpump:, Fuel Pump
+{0x6d07, 0x2184, 0xDCEB'D83D}, // U+1F4EB, 📫, \:mailbox:, Closed Mailbox With Raised Flag
+{0x7304, 0x3557, 0xDD1C'D83D}, // U+1F51C, 🔜, \:soon:, Soon With Rightwards Arrow Above
+{0x7412, 0x39ad, 0xDDB1'D83D}, // U+1F5B1, 🖱, \:three_button_mouse:, Computer Mouse
+{0x7308, 0x30cc, 0xDD95'D83E}, // U+1F995, 🦕, \:sauropod:, Sauropod
+{0x6101, 0x0016, 0xDD70'D83C}, // U+1F170, 🅰, \:a:, Negative Squared Latin Capital Letter A
+{0x7415, 0x3b86, 0xDC6C'D83D}, // U+1F46C, 👬, \:two_men_holding_hands:, Two Men Holding Hands
+{0x6d04, 0x2310, 0xDCDD'D83D}, // U+1F4DD, 📝, \:memo:, Memo
+{0x6307, 0x0dea, 0xDF00'D83C}, // U+1F300, 🌀, \:cyclone:, Cyclone
+{0x630c, 0x0a0c, 0xDF07'D83C}, // U+1F307, 🌇, \:city_sunrise:, Sunset Over Buildings
+{0x7336, 0x3459, 0xDD2D'D83E}, // U+1F92D, 🤭, \:smiling_face_with_smiling_eyes_and_hand_covering_mouth:, Smiling Face With Smiling Eyes And Hand Covering Mouth
+{0x670c, 0x1652, 0xDD92'D83E}, // U+1F992, 🦒, \:giraffe_face:, Giraffe Face
+{0x650a, 0x116d, 0xDC53'D83D}, // U+1F453, 👓, \:eyeglasses:, Eyeglasses
+{0x7009, 0x28e7, 0xDE82'D83E}, // U+1FA82, 🪂, \:parachute:, Parachute
+{0x7710, 0x3f2c, 0xDD7F'D83E}, // U+1F97F, 🥿, \:womans_flat_shoe:, Flat Shoe
+{0x6403, 0x0f3b, 0xDC36'D83D}, // U+1F436, 🐶, \:dog:, Dog Face
+{0x6808, 0x1855, 0xDD3E'D83E}, // U+1F93E, 🤾, \:handball:, Handball
+{0x680a, 0x1a87, 0xDF36'D83C}, // U+1F336, 🌶, \:hot_pepper:, Hot Pepper
+{0x730a, 0x3630, 0xDD96'D83D}, // U+1F596, 🖖, \:spock-hand:, Raised Hand With Part Between Middle And Ring Fingers
+{0x7220, 0x2db6, 0xDD90'D83D}, // U+1F590, 🖐, \:raised_hand_with_fingers_splayed:, Hand With Fingers Splayed
+{0x7309, 0x3701, 0x23F1}, // ⏱, \:stopwatch:, Stopwatch
+{0x7308, 0x358d, 0xDF87'D83C}, // U+1F387, 🎇, \:sparkler:, Firework Sparkler
+{0x7407, 0x3aea, 0xDE24'D83D}, // U+1F624, 😤, \:triumph:, Face With Look Of Triumph
+{0x7307, 0x310b, 0xDEF4'D83D}, // U+1F6F4, 🛴, \:scooter:, Scooter
+{0x7304, 0x384a, 0xDDA2'D83E}, // U+1F9A2, 🦢, \:swan:, Swan
+{0x640b, 0x0e33, 0xDDCF'D83E}, // U+1F9CF, 🧏, \:deaf_person:, Deaf Person
+{0x6302, 0x0905, 0xDCBF'D83D}, // U+1F4BF, 💿, \:cd:, Optical Disc
+{0x7306, 0x35fa, 0xDD77'D83D}, // U+1F577, 🕷, \:spider:, Spider
+{0x680f, 0x17c4, 0x2692}, // ⚒, \:hammer_and_pick:, Hammer And Pick
+{0x6206, 0x0415, 0xDDAB'D83E}, // U+1F9AB, 🦫, \:beaver:, Beaver
+{0x6606, 0x1533, 0xDED5'D83E}, // U+1FAD5, 🫕, \:fondue:, Fondue
+{0x640c, 0x0ecb, 0xDE1E'D83D}, // U+1F61E, 😞, \:disappointed:, Disappointed Face
+{0x7309, 0x3422, 0xDE38'D83D}, // U+1F638, 😸, \:smile_cat:, Grinning Cat Face With Smiling Eyes
+{0x6d0c, 0x2540, 0xDFB5'D83C}, // U+1F3B5, 🎵, \:musical_note:, Musical Note
+{0x6c11, 0x205c, 0xDD0F'D83D}, // U+1F50F, 🔏, \:lock_with_ink_pen:, Lock With Ink Pen
+{0x6206, 0x037a, 0xDF4C'D83C}, // U+1F34C, 🍌, \:banana:, Banana
+{0x7302, 0x3044, 0xDE02'D83C}, // U+1F202, 🈂, \:sa:, Squared Katakana Sa
+{0x720a, 0x2f61, 0xDD16'D83E}, // U+1F916, 🤖, \:robot_face:, Robot Face
+{0x6d0b, 0x2404, 0xDC35'D83D}, // U+1F435, 🐵, \:monkey_face:, Monkey Face
+{0x730e, 0x33ba, 0xDEE9'D83D}, // U+1F6E9, 🛩, \:small_airplane:, Small Airplane
+{0x6c0b, 0x1f03, 0x271D}, // ✝, \:latin_cross:, Latin Cross
+{0x7304, 0x3688, 0x2B50}, // ⭐, \:star:, White Medium Star
+{0x6f06, 0x271b, 0xDFE2'D83C}, // U+1F3E2, 🏢, \:office:, Office Building
+{0x6909, 0x1b56, 0x26F8}, // ⛸, \:ice_skate:, Ice Skate
+{0x6b08, 0x1cc1, 0x2328}, // ⌨, \:keyboard:, Keyboard
+{0x700c, 0x2c67, 0xDEC3'D83E}, // U+1FAC3, 🫃, \:pregnant_man:, Pregnant Man
+{0x7a0a, 0x3ff4, 0xDD93'D83E}, // U+1F993, 🦓, \:zebra_face:, Zebra Face
+{0x6707, 0x16b6, 0xDD8D'D83E}, // U+1F98D, 🦍, \:gorilla:, Gorilla
+{0x6311, 0x0ca6, 0xDC91'D83D}, // U+1F491, 💑, \:couple_with_heart:, Couple With Heart
+{0x6405, 0x0e0e, 0xDF61'D83C}, // U+1F361, 🍡, \:dango:, Dango
+{0x6305, 0x0dc8, 0xDF5B'D83C}, // U+1F35B, 🍛, \:curry:, Curry And Rice
+{0x6308, 0x0b2a, 0xDD64'D83D}, // U+1F564, 🕤, \:clock930:, Clock Face Nine-Thirty
+{0x6105, 0x00e6, 0xDC7C'D83D}, // U+1F47C, 👼, \:angel:, Baby Angel
+{0x7407, 0x3a3a, 0xDDF0'D83E}, // U+1F9F0, 🧰, \:toolbox:, Toolbox
+{0x7306, 0x3167, 0x3299}, // ㊙, \:secret:, Circled Ideograph Secret
+{0x6604, 0x13ed, 0xDD25'D83D}, // U+1F525, 🔥, \:fire:, Fire
+{0x6803, 0x1b07, 0xDED6'D83D}, // U+1F6D6, 🛖, \:hut:, Hut
+{0x6505, 0x10aa, 0x23CF}, // ⏏, \:eject:, Eject Button
+{0x730d, 0x34d7, 0xDD27'D83E}, // U+1F927, 🤧, \:sneezing_face:, Sneezing Face
+{0x6309, 0x0c7b, 0x00A9}, // ©, \:copyright:, Copyright Sign
+{0x6105, 0x005f, 0xDDD1'D83E}, // U+1F9D1, 🧑, \:adult:, Adult
+{0x7204, 0x2f6c, 0xDEA8'D83E}, // U+1FAA8, 🪨, \:rock:, Rock
+{0x680f, 0x19ff, 0xDD06'D83D}, // U+1F506, 🔆, \:high_brightness:, High Brightness Symbol
+{0x7505, 0x3bcc, 0xDE37'D83C}, // U+1F237, 🈷, \:u6708:, Squared Cjk Unified Ideograph-6708
+{0x6611, 0x1426, 0xDD47'D83E}, // U+1F947, 🥇, \:first_place_medal:, First Place Medal
+{0x720f, 0x2e51, 0xDF97'D83C}, // U+1F397, 🎗, \:reminder_ribbon:, Reminder Ribbon
+{0x630a, 0x0cb8, 0xDC8F'D83D}, // U+1F48F, 💏, \:couplekiss:, Kiss
+{0x6d11, 0x2266, 0xDDBD'D83E}, // U+1F9BD, 🦽, \:manual_wheelchair:, Manual Wheelchair
+{0x6305, 0x0b64, 0x2601}, // ☁, \:cloud:, Cloud
+{0x6c11, 0x1ed5, 0xDF17'D83C}, // U+1F317, 🌗, \:last_quarter_moon:, Last Quarter Moon Symbol
+{0x6205, 0x0663, 0xDE0A'D83D}, // U+1F60A, 😊, \:blush:, Smiling Face With Smiling Eyes
+{0x680d, 0x186f, 0xDC25'D83D}, // U+1F425, 🐥, \:hatched_chick:, Front-Facing Baby Chick
+{0x6b03, 0x1cbd, 0xDD11'D83D}, // U+1F511, 🔑, \:key:, Key
+{0x6f0a, 0x27fe, 0xDE2E'D83D}, // U+1F62E, 😮, \:open_mouth:, Face With Open Mouth
+{0x6306, 0x0b03, 0xDD56'D83D}, // U+1F556, 🕖, \:clock7:, Clock Face Seven Oclock
+{0x7704, 0x3f63, 0xDEB5'D83E}, // U+1FAB5, 🪵, \:wood:, Wood
+{0x7709, 0x3d73, 0x3030}, // 〰, \:wavy_dash:, Wavy Dash
+{0x7308, 0x3596, 0x2728}, // ✨, \:sparkles:, Sparkles
+{0x6208, 0x0381, 0x203C}, // ‼, \:bangbang:, Double Exclamation Mark
+{0x7419, 0x3b61, 0xDD00'D83D}, // U+1F500, 🔀, \:twisted_rightwards_arrows:, Twisted Rightwards Arrows
+{0x7712, 0x3e3e, 0x2B1C}, // ⬜, \:white_large_square:, White Large Square
+{0x6406, 0x0fa1, 0xDC09'D83D}, // U+1F409, 🐉, \:dragon:, Dragon
+{0x630d, 0x08ab, 0xDDC3'D83D}, // U+1F5C3, 🗃, \:card_file_box:, Card File Box
+{0x730f, 0x3678, 0xDDCD'D83E}, // U+1F9CD, 🧍, \:standing_person:, Standing Person
+{0x6311, 0x0c51, 0xDFEA'D83C}, // U+1F3EA, 🏪, \:convenience_store:, Convenience Store
+{0x6615, 0x1477, 0xDFA3'D83C}, // U+1F3A3, 🎣, \:fishing_pole_and_fish:, Fishing Pole And Fish
+{0x7304, 0x30a1, 0xDD7B'D83E}, // U+1F97B, 🥻, \:sari:, Sari
+{0x6c06, 0x1d91, 0xDE9C'D83E}, // U+1FA9C, 🪜, \:ladder:, Ladder
+{0x630d, 0x0cdd, 0xDF19'D83C}, // U+1F319, 🌙, \:crescent_moon:, Crescent Moon
+{0x720f, 0x2f1c, 0xDEF1'D83E}, // U+1FAF1, 🫱, \:rightwards_hand:, Rightwards Hand
+{0x6d11, 0x24c7, 0xDEA0'D83D}, // U+1F6A0, 🚠, \:mountain_cableway:, Mountain Cableway
+{0x6403, 0x1011, 0xDCC0'D83D}, // U+1F4C0, 📀, \:dvd:, Dvd
+{0x6805, 0x1a99, 0xDFE8'D83C}, // U+1F3E8, 🏨, \:hotel:, Hotel
+{0x730a, 0x3433, 0xDE3A'D83D}, // U+1F63A, 😺, \:smiley_cat:, Smiling Cat Face With Open Mouth
+{0x6c07, 0x204f, 0xDD9E'D83E}, // U+1F99E, 🦞, \:lobster:, Lobster
+{0x740b, 0x38c9, 0xDD61'D83E}, // U+1F961, 🥡, \:takeout_box:, Takeout Box
+{0x6e08, 0x264f, 0x26D4}, // ⛔, \:no_entry:, No Entry
+{0x7505, 0x3bc6, 0xDE2F'D83C}, // U+1F22F, 🈯, \:u6307:, Squared Cjk Unified Ideograph-6307
+{0x6f0d, 0x27b1, 0xDE96'D83D}, // U+1F696, 🚖, \:oncoming_taxi:, Oncoming Taxi
+{0x630b, 0x0dde, 0xDD69'D83E}, // U+1F969, 🥩, \:cut_of_meat:, Cut Of Meat
+{0x6c11, 0x1db4, 0xDD35'D83D}, // U+1F535, 🔵, \:large_blue_circle:, Large Blue Circle
+{0x6c04, 0x2057, 0xDD12'D83D}, // U+1F512, 🔒, \:lock:, Lock
+{0x6408, 0x0ec2, 0x2666}, // ♦, \:diamonds:, Black Diamond Suit
+{0x730b, 0x3855, 0xDCA6'D83D}, // U+1F4A6, 💦, \:sweat_drops:, Splashing Sweat Symbol
+{0x6706, 0x16be, 0xDF47'D83C}, // U+1F347, 🍇, \:grapes:, Grapes
+{0x7003, 0x2ae9, 0xDD67'D83E}, // U+1F967, 🥧, \:pie:, Pie
+{0x6408, 0x1008, 0xDD5F'D83E}, // U+1F95F, 🥟, \:dumpling:, Dumpling
+{0x620a, 0x04b4, 0xDEE6'D83E}, // U+1FAE6, 🫦, \:biting_lip:, Biting Lip
+{0x6607, 0x136a, 0xDEB6'D83E}, // U+1FAB6, 🪶, \:feather:, Feather
+{0x7405, 0x3af2, 0xDDCC'D83E}, // U+1F9CC, 🧌, \:troll:, Troll
+{0x7904, 0x3fb0, 0xDDF6'D83E}, // U+1F9F6, 🧶, \:yarn:, Ball Of Yarn
+{0x7208, 0x2e73, 0xDEBB'D83D}, // U+1F6BB, 🚻, \:restroom:, Restroom
+{0x730a, 0x34fa, 0xDF28'D83C}, // U+1F328, 🌨, \:snow_cloud:, Cloud With Snow
+{0x7305, 0x3222, 0xDC55'D83D}, // U+1F455, 👕, \:shirt:, T-Shirt
+{0x6306, 0x0908, 0x26D3}, // ⛓, \:chains:, Chains
+{0x760e, 0x3c8a, 0xDCF3'D83D}, // U+1F4F3, 📳, \:vibration_mode:, Vibration Mode
+{0x740d, 0x3a86, 0xDEA5'D83D}, // U+1F6A5, 🚥, \:traffic_light:, Horizontal Traffic Light
+{0x6611, 0x13fe, 0xDDEF'D83E}, // U+1F9EF, 🧯, \:fire_extinguisher:, Fire Extinguisher
+{0x6705, 0x1630, 0xDC7B'D83D}, // U+1F47B, 👻, \:ghost:, Ghost
+{0x671c, 0x1765, 0xDD29'D83E}, // U+1F929, 🤩, \:grinning_face_with_star_eyes:, Grinning Face With Star Eyes
+{0x680b, 0x18df, 0xDEF6'D83E}, // U+1FAF6, 🫶, \:heart_hands:, Heart Hands
+{0x700f, 0x2b0b, 0xDD0C'D83E}, // U+1F90C, 🤌, \:pinched_fingers:, Pinched Fingers
+{0x6313, 0x08c4, 0xDDC2'D83D}, // U+1F5C2, 🗂, \:card_index_dividers:, Card Index Dividers
+{0x6304, 0x0820, 0xDF70'D83C}, // U+1F370, 🍰, \:cake:, Shortcake
+{0x7305, 0x31fc, 0xDC11'D83D}, // U+1F411, 🐑, \:sheep:, Sheep
+{0x6205, 0x0429, 0xDF7B'D83C}, // U+1F37B, 🍻, \:beers:, Clinking Beer Mugs
+{0x6908, 0x1c06, 0xDE07'D83D}, // U+1F607, 😇, \:innocent:, Smiling Face With Halo
+{0x680e, 0x187d, 0xDC23'D83D}, // U+1F423, 🐣, \:hatching_chick:, Hatching Chick
+{0x6e03, 0x25f7, 0xDD95'D83C}, // U+1F195, 🆕, \:new:, Squared New
+{0x6714, 0x1672, 0xDF10'D83C}, // U+1F310, 🌐, \:globe_with_meridians:, Globe With Meridians
+{0x630d, 0x0d9d, 0xDD4C'D83E}, // U+1F94C, 🥌, \:curling_stone:, Curling Stone
+{0x6c13, 0x1ec1, 0xDFE8'D83D}, // U+1F7E8, 🟨, \:large_yellow_square:, Large Yellow Square
+{0x700e, 0x2943, 0xDEF3'D83D}, // U+1F6F3, 🛳, \:passenger_ship:, Passenger Ship
+{0x6208, 0x0436, 0xDD30'D83D}, // U+1F530, 🔰, \:beginner:, Japanese Symbol For Beginner
+{0x6318, 0x0940, 0xDCC8'D83D}, // U+1F4C8, 📈, \:chart_with_upwards_trend:, Chart With Upwards Trend
+{0x7307, 0x36c5, 0xDE89'D83D}, // U+1F689, 🚉, \:station:, Station
+{0x6204, 0x0424, 0xDF7A'D83C}, // U+1F37A, 🍺, \:beer:, Beer Mug
+{0x640b, 0x0efd, 0xDD3F'D83E}, // U+1F93F, 🤿, \:diving_mask:, Diving Mask
+{0x6609, 0x141c, 0xDF86'D83C}, // U+1F386, 🎆, \:fireworks:, Fireworks
+{0x660e, 0x13de, 0xDCFD'D83D}, // U+1F4FD, 📽, \:film_projector:, Film Projector
+{0x6209, 0x0738, 0xDCBC'D83D}, // U+1F4BC, 💼, \:briefcase:, Briefcase
+{0x6c0a, 0x1fee, 0xDE88'D83D}, // U+1F688, 🚈, \:light_rail:, Light Rail
+{0x730d, 0x307d, 0xDEE1'D83E}, // U+1FAE1, 🫡, \:saluting_face:, Saluting Face
+{0x6708, 0x160a, 0xDFB2'D83C}, // U+1F3B2, 🎲, \:game_die:, Game Die
+{0x6903, 0x1b94, 0xDC7F'D83D}, // U+1F47F, 👿, \:imp:, Imp
+{0x6307, 0x083b, 0xDCF2'D83D}, // U+1F4F2, 📲, \:calling:, Mobile Phone With Rightwards Arrow At Left
+{0x6236, 0x057d, 0x23ED}, // ⏭, \:black_right_pointing_double_triangle_with_vertical_bar:, Next Track Button
+{0x7406, 0x3a2c, 0xDF45'D83C}, // U+1F345, 🍅, \:tomato:, Tomato
+{0x7406, 0x3b35, 0xDC55'D83D}, // U+1F455, 👕, \:tshirt:, T-Shirt
+{0x7602, 0x3cd1, 0xDD9A'D83C}, // U+1F19A, 🆚, \:vs:, Squared Vs
+{0x770d, 0x3d26, 0xDC03'D83D}, // U+1F403, 🐃, \:water_buffalo:, Water Buffalo
+{0x6608, 0x1571, 0x26F2}, // ⛲, \:fountain:, Fountain
+{0x610b, 0x028a, 0x269B}, // ⚛, \:atom_symbol:, Atom Symbol
+{0x6f0a, 0x27f3, 0xDC50'D83D}, // U+1F450, 👐, \:open_hands:, Open Hands Sign
+{0x682a, 0x17f9, 0xDD1E'D83E}, // U+1F91E, 🤞, \:hand_with_index_and_middle_fingers_crossed:, Hand With Index And Middle Fingers Crossed
+{0x6e08, 0x26b9, 0xDCD3'D83D}, // U+1F4D3, 📓, \:notebook:, Notebook
+{0x6809, 0x17a1, 0xDEAE'D83E}, // U+1FAAE, 🪮, \:hair_pick:, Hair Pick
+{0x730e, 0x370b, 0xDCCF'D83D}, // U+1F4CF, 📏, \:straight_ruler:, Straight Ruler
+{0x6f09, 0x2753, 0xDC74'D83D}, // U+1F474, 👴, \:older_man:, Older Man
+{0x6615, 0x12a7, 0xDEE3'D83E}, // U+1FAE3, 🫣, \:face_with_peeking_eye:, Face With Peeking Eye
+{0x6805, 0x18ae, 0x2764}, // ❤, \:heart:, Heavy Black Heart
+{0x6806, 0x1a92, 0xDF2D'D83C}, // U+1F32D, 🌭, \:hotdog:, Hot Dog
+{0x6f0b, 0x2813, 0xDCD9'D83D}, // U+1F4D9, 📙, \:orange_book:, Orange Book
+{0x7706, 0x3ed1, 0xDE9F'D83E}, // U+1FA9F, 🪟, \:window:, Window
+{0x6607, 0x14c3, 0xDC2C'D83D}, // U+1F42C, 🐬, \:flipper:, Dolphin
+{0x7008, 0x2af6, 0xDC3D'D83D}, // U+1F43D, 🐽, \:pig_nose:, Pig Nose
+{0x6307, 0x0ceb, 0xDD97'D83E}, // U+1F997, 🦗, \:cricket:, Cricket
+{0x6e0a, 0x256a, 0xDCDB'D83D}, // U+1F4DB, 📛, \:name_badge:, Name Badge
+{0x6c05, 0x1fb8, 0xDF4B'D83C}, // U+1F34B, 🍋, \:lemon:, Lemon
+{0x630a, 0x09d8, 0xDD62'D83E}, // U+1F962, 🥢, \:chopsticks:, Chopsticks
+{0x641f, 0x0ea2, 0xDCA0'D83D}, // U+1F4A0, 💠, \:diamond_shape_with_a_dot_inside:, Diamond Shape With A Dot Inside
+{0x6b0b, 0x1cf0, 0xDE3D'D83D}, // U+1F63D, 😽, \:kissing_cat:, Kissing Cat Face With Closed Eyes
+{0x630a, 0x0b6a, 0xDD21'D83E}, // U+1F921, 🤡, \:clown_face:, Clown Face
+{0x661b, 0x139d, 0xDFD1'D83C}, // U+1F3D1, 🏑, \:field_hockey_stick_and_ball:, Field Hockey Stick And Ball
+{0x6d14, 0x21ad, 0xDCED'D83D}, // U+1F4ED, 📭, \:mailbox_with_no_mail:, Open Mailbox With Lowered Flag
+{0x6d08, 0x24ab, 0x26F0}, // ⛰, \:mountain:, Mountain
+{0x6d1a, 0x2327, 0xDD4E'D83D}, // U+1F54E, 🕎, \:menorah_with_nine_branches:, Menorah With Nine Branches
+{0x6808, 0x19c5, 0xDD94'D83E}, // U+1F994, 🦔, \:hedgehog:, Hedgehog
+{0x6505, 0x10d4, 0x2709}, // ✉, \:email:, Envelope
+{0x6c0b, 0x20bc, 0xDC8C'D83D}, // U+1F48C, 💌, \:love_letter:, Love Letter
+{0x6d0d, 0x2375, 0xDD95'D83D}, // U+1F595, 🖕, \:middle_finger:, Reversed Hand With Middle Finger Extended
+{0x680c, 0x1a32, 0xDD9B'D83E}, // U+1F99B, 🦛, \:hippopotamus:, Hippopotamus
+{0x7709, 0x3f91, 0xDD3C'D83E}, // U+1F93C, 🤼, \:wrestlers:, Wrestlers
+{0x740b, 0x3a20, 0xDDFC'D83D}, // U+1F5FC, 🗼, \:tokyo_tower:, Tokyo Tower
+{0x730a, 0x32ce, 0xDEF9'D83D}, // U+1F6F9, 🛹, \:skateboard:, Skateboard
+{0x6207, 0x06b3, 0xDC90'D83D}, // U+1F490, 💐, \:bouquet:, Bouquet
+{0x6f0b, 0x275d, 0xDC75'D83D}, // U+1F475, 👵, \:older_woman:, Older Woman
+{0x6109, 0x00bc, 0xDE91'D83D}, // U+1F691, 🚑, \:ambulance:, Ambulance
+{0x6306, 0x0b13, 0xDD57'D83D}, // U+1F557, 🕗, \:clock8:, Clock Face Eight Oclock
+{0x6604, 0x153a, 0xDDB6'D83E}, // U+1F9B6, 🦶, \:foot:, Foot
+{0x6406, 0x0e7c, 0xDFDC'D83C}, // U+1F3DC, 🏜, \:desert:, Desert
+{0x7303, 0x353d, 0xDE2D'D83D}, // U+1F62D, 😭, \:sob:, Loudly Crying Face
+{0x6809, 0x1aaa, 0x231B}, // ⌛, \:hourglass:, Hourglass
+{0x7305, 0x309b, 0xDF85'D83C}, // U+1F385, 🎅, \:santa:, Father Christmas
+{0x6d0a, 0x235f, 0xDFA4'D83C}, // U+1F3A4, 🎤, \:microphone:, Microphone
+{0x670a, 0x1705, 0xDE76'D83E}, // U+1FA76, 🩶, \:grey_heart:, Grey Heart
+{0x6d05, 0x22e3, 0xDF96'D83C}, // U+1F396, 🎖, \:medal:, Military Medal
+{0x7309, 0x30d5, 0xDFB7'D83C}, // U+1F3B7, 🎷, \:saxophone:, Saxophone
+{0x731c, 0x3736, 0xDE1D'D83D}, // U+1F61D, 😝, \:stuck_out_tongue_closed_eyes:, Face With Stuck-Out Tongue And Tightly-Closed Eyes
+{0x7713, 0x3d92, 0xDF14'D83C}, // U+1F314, 🌔, \:waxing_gibbous_moon:, Waxing Gibbous Moon Symbol
+{0x6213, 0x05fe, 0xDD32'D83D}, // U+1F532, 🔲, \:black_square_button:, Black Square Button
+{0x6705, 0x162a, 0xDDDE'D83E}, // U+1F9DE, 🧞, \:genie:, Genie
+{0x7305, 0x3831, 0xDF63'D83C}, // U+1F363, 🍣, \:sushi:, Sushi
+{0x7308, 0x317a, 0xDF31'D83C}, // U+1F331, 🌱, \:seedling:, Seedling
+{0x730c, 0x31c1, 0xDEE8'D83E}, // U+1FAE8, 🫨, \:shaking_face:, Shaking Face
+{0x6308, 0x0825, 0xDCC6'D83D}, // U+1F4C6, 📆, \:calendar:, Tear-Off Calendar
+{0x6206, 0x0373, 0xDF8D'D83C}, // U+1F38D, 🎍, \:bamboo:, Pine Decoration
+{0x720d, 0x2d75, 0xDEE4'D83D}, // U+1F6E4, 🛤, \:railway_track:, Railway Track
+{0x6207, 0x07d9, 0xDE8F'D83D}, // U+1F68F, 🚏, \:busstop:, Bus Stop
+{0x7207, 0x2e0d, 0x267B}, // ♻, \:recycle:, Black Universal Recycling Symbol
+{0x6208, 0x04a5, 0xDF82'D83C}, // U+1F382, 🎂, \:birthday:, Birthday Cake
+{0x6e08, 0x25fb, 0xDF11'D83C}, // U+1F311, 🌑, \:new_moon:, New Moon Symbol
+{0x680a, 0x1a9f, 0x2668}, // ♨, \:hotsprings:, Hot Springs
+{0x660c, 0x15b6, 0xDF64'D83C}, // U+1F364, 🍤, \:fried_shrimp:, Fried Shrimp
+{0x700f, 0x2a0d, 0xDE4D'D83D}, // U+1F64D, 🙍, \:person_frowning:, Person Frowning
+{0x730d, 0x3566, 0xDC7E'D83D}, // U+1F47E, 👾, \:space_invader:, Alien Monster
+{0x7306, 0x3143, 0xDCDC'D83D}, // U+1F4DC, 📜, \:scroll:, Scroll
+{0x680a, 0x18c5, 0xDE0D'D83D}, // U+1F60D, 😍, \:heart_eyes:, Smiling Face With Heart-Shaped Eyes
+{0x720a, 0x2e68, 0xDD02'D83D}, // U+1F502, 🔂, \:repeat_one:, Clockwise Rightwards And Leftwards Open Circle Arrows With Circled One Overlay
+{0x6304, 0x0cc7, 0xDC04'D83D}, // U+1F404, 🐄, \:cow2:, Cow
+{0x630f, 0x0d1c, 0xDD1E'D83E}, // U+1F91E, 🤞, \:crossed_fingers:, Hand With Index And Middle Fingers Crossed
+{0x6804, 0x19f1, 0xDF3F'D83C}, // U+1F33F, 🌿, \:herb:, Herb
+{0x700a, 0x2963, 0xDC3E'D83D}, // U+1F43E, 🐾, \:paw_prints:, Paw Prints
+{0x6307, 0x0862, 0xDFD5'D83C}, // U+1F3D5, 🏕, \:camping:, Camping
+{0x7704, 0x3ee3, 0xDEBD'D83E}, // U+1FABD, 🪽, \:wing:, Wing
+{0x6c12, 0x1f61, 0xDDE8'D83D}, // U+1F5E8, 🗨, \:left_speech_bubble:, Left Speech Bubble
+{0x6215, 0x078f, 0xDFD7'D83C}, // U+1F3D7, 🏗, \:building_construction:, Building Construction
+{0x6206, 0x039f, 0xDC88'D83D}, // U+1F488, 💈, \:barber:, Barber Pole
+{0x730b, 0x32ef, 0xDFFC'D83C}, // U+1F3FC, 🏼, \:skin-tone-3:, Emoji Modifier Fitzpatrick Type-3
+{0x6d0b, 0x21f4, 0xDD7A'D83D}, // U+1F57A, 🕺, \:man_dancing:, Man Dancing
+{0x6e0b, 0x2643, 0xDEB3'D83D}, // U+1F6B3, 🚳, \:no_bicycles:, No Bicycles
+{0x6c05, 0x1fd7, 0x264E}, // ♎, \:libra:, Libra
+{0x7309, 0x388a, 0xDD4D'D83D}, // U+1F54D, 🕍, \:synagogue:, Synagogue
+{0x640d, 0x0e83, 0xDFDD'D83C}, // U+1F3DD, 🏝, \:desert_island:, Desert Island
+{0x6506, 0x1015, 0xDCE7'D83D}, // U+1F4E7, 📧, \:e-mail:, E-Mail Symbol
+{0x6710, 0x16f4, 0x2755}, // ❕, \:grey_exclamation:, White Exclamation Mark Ornament
+{0x610b, 0x00a2, 0x23F0}, // ⏰, \:alarm_clock:, Alarm Clock
+{0x6309, 0x089d, 0x2651}, // ♑, \:capricorn:, Capricorn
+{0x740a, 0x3af8, 0xDE8E'D83D}, // U+1F68E, 🚎, \:trolleybus:, Trolleybus
+{0x650a, 0x10da, 0xDEB9'D83E}, // U+1FAB9, 🪹, \:empty_nest:, Empty Nest
+{0x700f, 0x29cc, 0xDFAD'D83C}, // U+1F3AD, 🎭, \:performing_arts:, Performing Arts
+{0x6306, 0x0c9f, 0xDC6B'D83D}, // U+1F46B, 👫, \:couple:, Man And Woman Holding Hands
+{0x7505, 0x3bd8, 0xDE35'D83C}, // U+1F235, 🈵, \:u6e80:, Squared Cjk Unified Ideograph-6E80
+{0x6d07, 0x2283, 0xDE87'D83E}, // U+1FA87, 🪇, \:maracas:, Maracas
+{0x7306, 0x3574, 0x2660}, // ♠, \:spades:, Black Spade Suit
+{0x6308, 0x0aaa, 0xDD5C'D83D}, // U+1F55C, 🕜, \:clock130:, Clock Face One-Thirty
+{0x7217, 0x2f2c, 0xDEF8'D83E}, // U+1FAF8, 🫸, \:rightwards_pushing_hand:, Rightwards Pushing Hand
+{0x7006, 0x2c0e, 0xDD54'D83E}, // U+1F954, 🥔, \:potato:, Potato
+{0x6503, 0x106e, 0xDD5A'D83E}, // U+1F95A, 🥚, \:egg:, Egg
+{0x6312, 0x0a3f, 0xDFDB'D83C}, // U+1F3DB, 🏛, \:classical_building:, Classical Building
+{0x6308, 0x0975, 0xDF52'D83C}, // U+1F352, 🍒, \:cherries:, Cherries
+{0x7406, 0x393d, 0xDFBE'D83C}, // U+1F3BE, 🎾, \:tennis:, Tennis Racquet And Ball
+{0x6d09, 0x21c2, 0x2642}, // ♂, \:male_sign:, Male Sign
+{0x6c05, 0x2049, 0xDD99'D83E}, // U+1F999, 🦙, \:llama:, Llama
+{0x6110, 0x00ce, 0xDEC0'D83E}, // U+1FAC0, 🫀, \:anatomical_heart:, Anatomical Heart
+{0x690f, 0x1c22, 0xDFEE'D83C}, // U+1F3EE, 🏮, \:izakaya_lantern:, Izakaya Lantern
+{0x7309, 0x30a6, 0xDEF0'D83D}, // U+1F6F0, 🛰, \:satellite:, Satellite
+{0x6204, 0x0390, 0xDFE6'D83C}, // U+1F3E6, 🏦, \:bank:, Bank
+{0x700a, 0x2ac6, 0xDDEB'D83E}, // U+1F9EB, 🧫, \:petri_dish:, Petri Dish
+{0x6307, 0x0a86, 0xDD5A'D83D}, // U+1F55A, 🕚, \:clock11:, Clock Face Eleven Oclock
+{0x740d, 0x38dc, 0xDF8B'D83C}, // U+1F38B, 🎋, \:tanabata_tree:, Tanabata Tree
+{0x6f09, 0x2809, 0x26CE}, // ⛎, \:ophiuchus:, Ophiuchus
+{0x700c, 0x2adc, 0xDEFB'D83D}, // U+1F6FB, 🛻, \:pickup_truck:, Pickup Truck
+{0x6304, 0x0900, 0xDC08'D83D}, // U+1F408, 🐈, \:cat2:, Cat
+{0x7518, 0x3c12, 0x2614}, // ☔, \:umbrella_with_rain_drops:, Umbrella With Rain Drops
+{0x6107, 0x02a4, 0xDD51'D83E}, // U+1F951, 🥑, \:avocado:, Avocado
+{0x7004, 0x2aff, 0xDC8A'D83D}, // U+1F48A, 💊, \:pill:, Pill
+{0x6103, 0x0257, 0xDFA8'D83C}, // U+1F3A8, 🎨, \:art:, Artist Palette
+{0x6305, 0x09a9, 0xDDD2'D83E}, // U+1F9D2, 🧒, \:child:, Child
+{0x770c, 0x3f9b, 0x270D}, // ✍, \:writing_hand:, Writing Hand
+{0x7010, 0x2952, 0xDEC2'D83D}, // U+1F6C2, 🛂, \:passport_control:, Passport Control
+{0x6609, 0x14ac, 0xDED3'D83E}, // U+1FAD3, 🫓, \:flatbread:, Flatbread
+{0x7407, 0x3a5e, 0xDF2A'D83C}, // U+1F32A, 🌪, \:tornado:, Tornado
+{0x6d0c, 0x22b8, 0xDF56'D83C}, // U+1F356, 🍖, \:meat_on_bone:, Meat On Bone
+{0x620d, 0x068b, 0xDCD1'D83D}, // U+1F4D1, 📑, \:bookmark_tabs:, Bookmark Tabs
+{0x6c09, 0x2077, 0xDE98'D83E}, // U+1FA98, 🪘, \:long_drum:, Long Drum
+{0x770a, 0x3d34, 0xDD3D'D83E}, // U+1F93D, 🤽, \:water_polo:, Water Polo
+{0x6b13, 0x1cfc, 0xDE1A'D83D}, // U+1F61A, 😚, \:kissing_closed_eyes:, Kissing Face With Closed Eyes
+{0x7510, 0x3c54, 0xDE43'D83D}, // U+1F643, 🙃, \:upside_down_face:, Upside-Down Face
+{0x6307, 0x0dd6, 0xDEC3'D83D}, // U+1F6C3, 🛃, \:customs:, Customs
+{0x7704, 0x3ef6, 0xDC3A'D83D}, // U+1F43A, 🐺, \:wolf:, Wolf Face
+{0x6605, 0x15c3, 0xDF5F'D83C}, // U+1F35F, 🍟, \:fries:, French Fries
+{0x6105, 0x0115, 0x2648}, // ♈, \:aries:, Aries
+{0x6606, 0x134a, 0xDC6A'D83D}, // U+1F46A, 👪, \:family:, Family
+{0x6d09, 0x215b, 0xDD0E'D83D}, // U+1F50E, 🔎, \:mag_right:, Right-Pointing Magnifying Glass
+{0x7018, 0x2aad, 0xDE4E'D83D}, // U+1F64E, 🙎, \:person_with_pouting_face:, Person With Pouting Face
+{0x6306, 0x0ac3, 0xDD52'D83D}, // U+1F552, 🕒, \:clock3:, Clock Face Three Oclock
+{0x660b, 0x13d2, 0xDF9E'D83C}, // U+1F39E, 🎞, \:film_frames:, Film Frames
+{0x6b04, 0x1ce3, 0xDC8B'D83D}, // U+1F48B, 💋, \:kiss:, Kiss Mark
+{0x6f09, 0x27d8, 0xDCD6'D83D}, // U+1F4D6, 📖, \:open_book:, Open Book
+{0x6607, 0x1362, 0xDE28'D83D}, // U+1F628, 😨, \:fearful:, Fearful Face
+{0x6410, 0x0f65, 0xDEE5'D83E}, // U+1FAE5, 🫥, \:dotted_line_face:, Dotted Line Face
+{0x7403, 0x3900, 0xDF75'D83C}, // U+1F375, 🍵, \:tea:, Teacup Without Handle
+{0x6704, 0x1697, 0xDC10'D83D}, // U+1F410, 🐐, \:goat:, Goat
+{0x6f13, 0x279d, 0xDE94'D83D}, // U+1F694, 🚔, \:oncoming_police_car:, Oncoming Police Car
+{0x640b, 0x0fa8, 0xDC32'D83D}, // U+1F432, 🐲, \:dragon_face:, Dragon Face
+{0x7712, 0x3e7f, 0x25AB}, // ▫, \:white_small_square:, White Small Square
+{0x700c, 0x2cc6, 0xDC9C'D83D}, // U+1F49C, 💜, \:purple_heart:, Purple Heart
+{0x700a, 0x28d2, 0xDC3C'D83D}, // U+1F43C, 🐼, \:panda_face:, Panda Face
+{0x6605, 0x151c, 0xDF01'D83C}, // U+1F301, 🌁, \:foggy:, Foggy
+{0x7307, 0x3882, 0xDD23'D83D}, // U+1F523, 🔣, \:symbols:, Input Symbol For Symbols
+{0x6306, 0x0ba2, 0x26B0}, // ⚰, \:coffin:, Coffin
+{0x6911, 0x1ba3, 0xDCE8'D83D}, // U+1F4E8, 📨, \:incoming_envelope:, Incoming Envelope
+{0x660e, 0x1553, 0xDF74'D83C}, // U+1F374, 🍴, \:fork_and_knife:, Fork And Knife
+{0x7417, 0x3ab9, 0xDEA9'D83D}, // U+1F6A9, 🚩, \:triangular_flag_on_post:, Triangular Flag On Post
+{0x620a, 0x0771, 0xDDCB'D83E}, // U+1F9CB, 🧋, \:bubble_tea:, Bubble Tea
+{0x6309, 0x0b80, 0xDEB3'D83E}, // U+1FAB3, 🪳, \:cockroach:, Cockroach
+{0x6811, 0x1ae1, 0xDFE1'D83C}, // U+1F3E1, 🏡, \:house_with_garden:, House With Garden
+{0x700d, 0x2b75, 0xDD7A'D83E}, // U+1F97A, 🥺, \:pleading_face:, Face With Pleading Eyes
+{0x6c09, 0x1ff9, 0xDF29'D83C}, // U+1F329, 🌩, \:lightning:, Cloud With Lightning
+{0x7304, 0x36fc, 0xDF72'D83C}, // U+1F372, 🍲, \:stew:, Pot Of Food
+{0x6b10, 0x1d58, 0xDF7D'D83C}, // U+1F37D, 🍽, \:knife_fork_plate:, Fork And Knife With Plate
+{0x6309, 0x0915, 0xDF7E'D83C}, // U+1F37E, 🍾, \:champagne:, Bottle With Popping Cork
+{0x6f06, 0x285e, 0xDDAA'D83E}, // U+1F9AA, 🦪, \:oyster:, Oyster
+{0x7308, 0x3113, 0xDD82'D83E}, // U+1F982, 🦂, \:scorpion:, Scorpion
+{0x610d, 0x0296, 0xDEFA'D83D}, // U+1F6FA, 🛺, \:auto_rickshaw:, Auto Rickshaw
+{0x610d, 0x0168, 0x25B6}, // ▶, \:arrow_forward:, Black Right-Pointing Triangle
+{0x660b, 0x13f2, 0xDE92'D83D}, // U+1F692, 🚒, \:fire_engine:, Fire Engine
+{0x6e07, 0x2666, 0xDE45'D83D}, // U+1F645, 🙅, \:no_good:, Face With No Good Gesture
+{0x7004, 0x2c55, 0xDE4F'D83D}, // U+1F64F, 🙏, \:pray:, Person With Folded Hands
+{0x7506, 0x3c4a, 0xDD13'D83D}, // U+1F513, 🔓, \:unlock:, Open Lock
+{0x7508, 0x3c2b, 0xDE12'D83D}, // U+1F612, 😒, \:unamused:, Unamused Face
+{0x6212, 0x04fc, 0x2B1B}, // ⬛, \:black_large_square:, Black Large Square
+{0x6309, 0x0bae, 0xDD76'D83E}, // U+1F976, 🥶, \:cold_face:, Freezing Face
+{0x6407, 0x0fe6, 0xDCA7'D83D}, // U+1F4A7, 💧, \:droplet:, Droplet
+{0x6110, 0x020b, 0x2196}, // ↖, \:arrow_upper_left:, North West Arrow
+{0x630a, 0x0bfe, 0xDE16'D83D}, // U+1F616, 😖, \:confounded:, Confounded Face
+{0x6c12, 0x1e11, 0xDFE2'D83D}, // U+1F7E2, 🟢, \:large_green_circle:, Large Green Circle
+{0x7315, 0x37a5, 0xDF26'D83C}, // U+1F326, 🌦, \:sun_behind_rain_cloud:, Sun Behind Rain Cloud
+{0x6810, 0x18b4, 0xDC9F'D83D}, // U+1F49F, 💟, \:heart_decoration:, Heart Decoration
+{0x6203, 0x03ce, 0xDD87'D83E}, // U+1F987, 🦇, \:bat:, Bat
+{0x6407, 0x0e06, 0xDC6F'D83D}, // U+1F46F, 👯, \:dancers:, Woman With Bunny Ears
+{0x660c, 0x13b9, 0xDDC4'D83D}, // U+1F5C4, 🗄, \:file_cabinet:, File Cabinet
+{0x6c0c, 0x1f43, 0xDEC5'D83D}, // U+1F6C5, 🛅, \:left_luggage:, Left Luggage
+{0x6307, 0x0c6a, 0xDF73'D83C}, // U+1F373, 🍳, \:cooking:, Cooking
+{0x640a, 0x0f19, 0xDE35'D83D}, // U+1F635, 😵, \:dizzy_face:, Dizzy Face
+{0x6209, 0x0395, 0xDCCA'D83D}, // U+1F4CA, 📊, \:bar_chart:, Bar Chart
+{0x721d, 0x2fb6, 0xDD23'D83E}, // U+1F923, 🤣, \:rolling_on_the_floor_laughing:, Rolling On The Floor Laughing
+{0x6204, 0x067d, 0xDCD6'D83D}, // U+1F4D6, 📖, \:book:, Open Book
+{0x6c08, 0x1d79, 0xDD7C'D83E}, // U+1F97C, 🥼, \:lab_coat:, Lab Coat
+{0x720e, 0x2f9a, 0xDFA2'D83C}, // U+1F3A2, 🎢, \:roller_coaster:, Roller Coaster
+{0x7508, 0x3c34, 0xDD1E'D83D}, // U+1F51E, 🔞, \:underage:, No One Under Eighteen Symbol
+{0x720a, 0x2d83, 0xDF27'D83C}, // U+1F327, 🌧, \:rain_cloud:, Cloud With Rain
+{0x6205, 0x038a, 0xDE95'D83E}, // U+1FA95, 🪕, \:banjo:, Banjo
+{0x760a, 0x3cc6, 0xDFD0'D83C}, // U+1F3D0, 🏐, \:volleyball:, Volleyball
+{0x770a, 0x3ec6, 0xDF90'D83C}, // U+1F390, 🎐, \:wind_chime:, Wind Chime
+{0x7005, 0x2ad1, 0x260E}, // ☎, \:phone:, Black Telephone
+{0x6308, 0x0b1a, 0xDD63'D83D}, // U+1F563, 🕣, \:clock830:, Clock Face Eight-Thirty
+{0x620e, 0x0406, 0xDDD4'D83E}, // U+1F9D4, 🧔, \:bearded_person:, Bearded Person
+{0x620b, 0x0444, 0xDED1'D83E}, // U+1FAD1, 🫑, \:bell_pepper:, Bell Pepper
+{0x7305, 0x3655, 0xDD91'D83E}, // U+1F991, 🦑, \:squid:, Squid
+{0x6109, 0x0032, 0xDE97'D83E}, // U+1FA97, 🪗, \:accordion:, Accordion
+{0x7306, 0x3541, 0x26BD}, // ⚽, \:soccer:, Soccer Ball
+{0x730f, 0x37bb, 0xDF24'D83C}, // U+1F324, 🌤, \:sun_small_cloud:, Sun Behind Small Cloud
+{0x3104, 0x000b, 0xDD22'D83D}, // U+1F522, 🔢, \:1234:, Input Symbol For Numbers
+{0x6107, 0x00c6, 0xDFFA'D83C}, // U+1F3FA, 🏺, \:amphora:, Amphora
+{0x6408, 0x0f8a, 0xDF69'D83C}, // U+1F369, 🍩, \:doughnut:, Doughnut
+{0x672e, 0x1736, 0xDD2A'D83E}, // U+1F92A, 🤪, \:grinning_face_with_one_large_and_one_small_eye:, Grinning Face With One Large And One Small Eye
+{0x630b, 0x0a19, 0xDF06'D83C}, // U+1F306, 🌆, \:city_sunset:, Cityscape At Dusk
+{0x700c, 0x2976, 0x262E}, // ☮, \:peace_symbol:, Peace Symbol
+{0x6f09, 0x276f, 0xDD49'D83D}, // U+1F549, 🕉, \:om_symbol:, Om
+{0x6806, 0x1868, 0xDCA9'D83D}, // U+1F4A9, 💩, \:hankey:, Pile Of Poo
+{0x7306, 0x342c, 0xDE03'D83D}, // U+1F603, 😃, \:smiley:, Smiling Face With Open Mouth
+{0x6604, 0x15a7, 0xDD93'D83C}, // U+1F193, 🆓, \:free:, Squared Free
+{0x730b, 0x32e3, 0xDFFB'D83C}, // U+1F3FB, 🏻, \:skin-tone-2:, Emoji Modifier Fitzpatrick Type-1-2
+{0x640e, 0x0eee, 0xDD78'D83E}, // U+1F978, 🥸, \:disguised_face:, Disguised Face
+{0x7406, 0x3b03, 0xDFC6'D83C}, // U+1F3C6, 🏆, \:trophy:, Trophy
+{0x6d05, 0x2428, 0xDECE'D83E}, // U+1FACE, 🫎, \:moose:, Moose
+{0x7207, 0x2fd4, 0xDC13'D83D}, // U+1F413, 🐓, \:rooster:, Rooster
+{0x770a, 0x3f3d, 0xDC52'D83D}, // U+1F452, 👒, \:womans_hat:, Womans Hat
+{0x730e, 0x30f3, 0xDF92'D83C}, // U+1F392, 🎒, \:school_satchel:, School Satchel
+{0x6210, 0x07bc, 0xDE84'D83D}, // U+1F684, 🚄, \:bullettrain_side:, High-Speed Train
+{0x7404, 0x3944, 0x26FA}, // ⛺, \:tent:, Tent
+{0x6d10, 0x23e3, 0xDCB8'D83D}, // U+1F4B8, 💸, \:money_with_wings:, Money With Wings
+{0x7309, 0x3813, 0xDDB8'D83E}, // U+1F9B8, 🦸, \:superhero:, Superhero
+{0x690b, 0x1c0f, 0x2049}, // ⁉, \:interrobang:, Exclamation Question Mark
+{0x7307, 0x3894, 0xDC89'D83D}, // U+1F489, 💉, \:syringe:, Syringe
+{0x720e, 0x300e, 0xDFC9'D83C}, // U+1F3C9, 🏉, \:rugby_football:, Rugby Football
+{0x7305, 0x331f, 0xDC80'D83D}, // U+1F480, 💀, \:skull:, Skull
+{0x7601, 0x3c65, 0x270C}, // ✌, \:v:, Victory Hand
+{0x7304, 0x314a, 0xDDAD'D83E}, // U+1F9AD, 🦭, \:seal:, Seal
+{0x730f, 0x3620, 0xDDD2'D83D}, // U+1F5D2, 🗒, \:spiral_note_pad:, Spiral Notepad
+{0x3103, 0x0007, 0xDCAF'D83D}, // U+1F4AF, 💯, \:100:, Hundred Points Symbol
+{0x6e1b, 0x25a7, 0x274E}, // ❎, \:negative_squared_cross_mark:, Negative Squared Cross Mark
+{0x6609, 0x146d, 0xDF65'D83C}, // U+1F365, 🍥, \:fish_cake:, Fish Cake With Swirl Design
+{0x6707, 0x169c, 0xDD7D'D83E}, // U+1F97D, 🥽, \:goggles:, Goggles
+{0x7207, 0x2fe1, 0xDFF5'D83C}, // U+1F3F5, 🏵, \:rosette:, Rosette
+{0x7a11, 0x3fff, 0xDD10'D83E}, // U+1F910, 🤐, \:zipper_mouth_face:, Zipper-Mouth Face
+{0x6d0b, 0x23b5, 0xDEA9'D83E}, // U+1FAA9, 🪩, \:mirror_ball:, Mirror Ball
+{0x630d, 0x0d2c, 0xDF8C'D83C}, // U+1F38C, 🎌, \:crossed_flags:, Crossed Flags
+{0x6309, 0x0a7c, 0xDD65'D83D}, // U+1F565, 🕥, \:clock1030:, Clock Face Ten-Thirty
+{0x6b07, 0x1ce8, 0xDE17'D83D}, // U+1F617, 😗, \:kissing:, Kissing Face
+{0x7206, 0x2ec9, 0xDF80'D83C}, // U+1F380, 🎀, \:ribbon:, Ribbon
+{0x660c, 0x138a, 0xDFA1'D83C}, // U+1F3A1, 🎡, \:ferris_wheel:, Ferris Wheel
+{0x6805, 0x1a62, 0xDC34'D83D}, // U+1F434, 🐴, \:horse:, Horse Face
+{0x6307, 0x0a74, 0xDD59'D83D}, // U+1F559, 🕙, \:clock10:, Clock Face Ten Oclock
+{0x7409, 0x3953, 0xDD18'D83E}, // U+1F918, 🤘, \:the_horns:, Sign Of The Horns
+{0x6406, 0x0f44, 0xDCB5'D83D}, // U+1F4B5, 💵, \:dollar:, Banknote With Dollar Sign
+{0x6c05, 0x2144, 0xDEC1'D83E}, // U+1FAC1, 🫁, \:lungs:, Lungs
+{0x7306, 0x3183, 0xDD33'D83E}, // U+1F933, 🤳, \:selfie:, Selfie
+{0x7316, 0x3490, 0xDD72'D83E}, // U+1F972, 🥲, \:smiling_face_with_tear:, Smiling Face With Tear
+{0x640c, 0x0df2, 0xDDE1'D83D}, // U+1F5E1, 🗡, \:dagger_knife:, Dagger
+{0x6311, 0x09af, 0xDEB8'D83D}, // U+1F6B8, 🚸, \:children_crossing:, Children Crossing
+{0x6d10, 0x24d9, 0xDE9E'D83D}, // U+1F69E, 🚞, \:mountain_railway:, Mountain Railway
+{0x7006, 0x2b3e, 0x2653}, // ♓, \:pisces:, Pisces
+{0x760a, 0x3ca6, 0xDFAE'D83C}, // U+1F3AE, 🎮, \:video_game:, Video Game
+{0x7007, 0x28f1, 0xDD7F'D83C}, // U+1F17F, 🅿, \:parking:, Negative Squared Latin Capital Letter P
+{0x6d0c, 0x244b, 0xDF24'D83C}, // U+1F324, 🌤, \:mostly_sunny:, Sun Behind Small Cloud
+{0x6307, 0x09a1, 0xDC14'D83D}, // U+1F414, 🐔, \:chicken:, Chicken
+{0x6205, 0x075f, 0xDDF9'D83E}, // U+1F9F9, 🧹, \:broom:, Broom
+{0x740a, 0x390b, 0xDDF8'D83E}, // U+1F9F8, 🧸, \:teddy_bear:, Teddy Bear
+{0x700d, 0x2b1b, 0xDD0F'D83E}, // U+1F90F, 🤏, \:pinching_hand:, Pinching Hand
+{0x660c, 0x14b6, 0x269C}, // ⚜, \:fleur_de_lis:, Fleur-De-Lis
+{0x6206, 0x0711, 0xDDF1'D83E}, // U+1F9F1, 🧱, \:bricks:, Brick
+{0x6604, 0x15c9, 0xDC38'D83D}, // U+1F438, 🐸, \:frog:, Frog Face
+{0x6b05, 0x1d6e, 0xDC28'D83D}, // U+1F428, 🐨, \:koala:, Koala
+{0x6404, 0x0f36, 0xDDA4'D83E}, // U+1F9A4, 🦤, \:dodo:, Dodo
+{0x7207, 0x2e40, 0x263A}, // ☺, \:relaxed:, White Smiling Face
+{0x7007, 0x2991, 0xDD5C'D83E}, // U+1F95C, 🥜, \:peanuts:, Peanuts
+{0x700a, 0x2bc1, 0xDE93'D83D}, // U+1F693, 🚓, \:police_car:, Police Car
+{0x6109, 0x00f8, 0xDE27'D83D}, // U+1F627, 😧, \:anguished:, Anguished Face
+{0x6112, 0x008f, 0xDEEB'D83D}, // U+1F6EB, 🛫, \:airplane_departure:, Airplane Departure
+{0x6205, 0x0699, 0xDCDA'D83D}, // U+1F4DA, 📚, \:books:, Books
+{0x6d05, 0x2351, 0xDE87'D83D}, // U+1F687, 🚇, \:metro:, Metro
+{0x6204, 0x043f, 0xDD14'D83D}, // U+1F514, 🔔, \:bell:, Bell
+{0x7711, 0x3eb4, 0xDF2C'D83C}, // U+1F32C, 🌬, \:wind_blowing_face:, Wind Face
+{0x7406, 0x3a57, 0xDFA9'D83C}, // U+1F3A9, 🎩, \:tophat:, Top Hat
+{0x6805, 0x17e6, 0xDEAC'D83E}, // U+1FAAC, 🪬, \:hamsa:, Hamsa
+{0x7407, 0x3ae2, 0xDD31'D83D}, // U+1F531, 🔱, \:trident:, Trident Emblem
+{0x6e09, 0x2560, 0xDC85'D83D}, // U+1F485, 💅, \:nail_care:, Nail Polish
+{0x6306, 0x09f9, 0xDFA6'D83C}, // U+1F3A6, 🎦, \:cinema:, Cinema
+{0x6d05, 0x2244, 0xDD6D'D83E}, // U+1F96D, 🥭, \:mango:, Mango
+{0x6405, 0x0f4b, 0xDF8E'D83C}, // U+1F38E, 🎎, \:dolls:, Japanese Dolls
+{0x730b, 0x368d, 0xDD29'D83E}, // U+1F929, 🤩, \:star-struck:, Grinning Face With Star Eyes
+{0x6b06, 0x1cd5, 0xDEAF'D83E}, // U+1FAAF, 🪯, \:khanda:, Khanda
+{0x6306, 0x0af3, 0xDD55'D83D}, // U+1F555, 🕕, \:clock6:, Clock Face Six Oclock
+{0x6e0e, 0x2688, 0xDEB7'D83D}, // U+1F6B7, 🚷, \:no_pedestrians:, No Pedestrians
+{0x680a, 0x18f5, 0xDC97'D83D}, // U+1F497, 💗, \:heartpulse:, Growing Heart
+{0x6618, 0x11c2, 0xDEE4'D83E}, // U+1FAE4, 🫤, \:face_with_diagonal_mouth:, Face With Diagonal Mouth
+{0x6608, 0x153f, 0xDFC8'D83C}, // U+1F3C8, 🏈, \:football:, American Football
+{0x7713, 0x3e6b, 0x25FB}, // ◻, \:white_medium_square:, White Medium Square
+{0x6304, 0x0c8b, 0xDF3D'D83C}, // U+1F33D, 🌽, \:corn:, Ear Of Maize
+{0x6111, 0x007d, 0xDEEC'D83D}, // U+1F6EC, 🛬, \:airplane_arriving:, Airplane Arriving
+{0x7310, 0x3261, 0xDED2'D83D}, // U+1F6D2, 🛒, \:shopping_trolley:, Shopping Trolley
+{0x7009, 0x28dd, 0xDCCE'D83D}, // U+1F4CE, 📎, \:paperclip:, Paperclip
+{0x6b0d, 0x1d10, 0xDE18'D83D}, // U+1F618, 😘, \:kissing_heart:, Face Throwing A Kiss
+{0x6913, 0x1b6c, 0xDEAA'D83E}, // U+1FAAA, 🪪, \:identification_card:, Identification Card
+{0x6d06, 0x243b, 0xDD4C'D83D}, // U+1F54C, 🕌, \:mosque:, Mosque
+{0x6308, 0x0be7, 0xDCBB'D83D}, // U+1F4BB, 💻, \:computer:, Personal Computer
+{0x6207, 0x03d7, 0xDEC1'D83D}, // U+1F6C1, 🛁, \:bathtub:, Bathtub
+{0x6213, 0x07f4, 0xDC65'D83D}, // U+1F465, 👥, \:busts_in_silhouette:, Busts In Silhouette
+{0x6208, 0x0630, 0xDC21'D83D}, // U+1F421, 🐡, \:blowfish:, Blowfish
+{0x680f, 0x19b5, 0x2795}, // ➕, \:heavy_plus_sign:, Heavy Plus Sign
+{0x7229, 0x2e7c, 0xDD95'D83D}, // U+1F595, 🖕, \:reversed_hand_with_middle_finger_extended:, Reversed Hand With Middle Finger Extended
+{0x6b04, 0x1d74, 0xDE01'D83C}, // U+1F201, 🈁, \:koko:, Squared Katakana Koko
+{0x6515, 0x1094, 0x2733}, // ✳, \:eight_spoked_asterisk:, Eight Spoked Asterisk
+{0x6306, 0x0ae3, 0xDD54'D83D}, // U+1F554, 🕔, \:clock5:, Clock Face Five Oclock
+{0x6110, 0x003c, 0xDE79'D83E}, // U+1FA79, 🩹, \:adhesive_bandage:, Adhesive Bandage
+{0x6d06, 0x24f0, 0xDC01'D83D}, // U+1F401, 🐁, \:mouse2:, Mouse
+{0x7406, 0x3b50, 0xDD83'D83E}, // U+1F983, 🦃, \:turkey:, Turkey
+{0x7207, 0x2e05, 0xDDFE'D83E}, // U+1F9FE, 🧾, \:receipt:, Receipt
+{0x7008, 0x2ca2, 0xDC78'D83D}, // U+1F478, 👸, \:princess:, Princess
+{0x6205, 0x06fc, 0xDF5E'D83C}, // U+1F35E, 🍞, \:bread:, Bread
+{0x6405, 0x0f13, 0xDCAB'D83D}, // U+1F4AB, 💫, \:dizzy:, Dizzy Symbol
+{0x6c12, 0x1dfe, 0xDFEB'D83D}, // U+1F7EB, 🟫, \:large_brown_square:, Large Brown Square
+{0x700a, 0x2b96, 0xDC48'D83D}, // U+1F448, 👈, \:point_left:, White Left Pointing Backhand Index
+{0x740a, 0x3a0b, 0xDE2B'D83D}, // U+1F62B, 😫, \:tired_face:, Tired Face
+{0x6236, 0x05b4, 0x23EF}, // ⏯, \:black_right_pointing_triangle_with_double_vertical_bar:, Play Or Pause Button
+{0x6e05, 0x26e1, 0xDFB6'D83C}, // U+1F3B6, 🎶, \:notes:, Multiple Musical Notes
+{0x7209, 0x2d19, 0xDC0E'D83D}, // U+1F40E, 🐎, \:racehorse:, Horse
+{0x6306, 0x0a6d, 0xDD50'D83D}, // U+1F550, 🕐, \:clock1:, Clock Face One Oclock
+{0x610e, 0x01fc, 0xDD3C'D83D}, // U+1F53C, 🔼, \:arrow_up_small:, Up-Pointing Small Red Triangle
+{0x7007, 0x2cab, 0xDDA8'D83D}, // U+1F5A8, 🖨, \:printer:, Printer
+{0x6205, 0x030e, 0xDD6F'D83E}, // U+1F96F, 🥯, \:bagel:, Bagel
+{0x7309, 0x3511, 0x2744}, // ❄, \:snowflake:, Snowflake
+{0x610a, 0x014c, 0x2B07}, // ⬇, \:arrow_down:, Downwards Black Arrow
+{0x7206, 0x2d02, 0xDC30'D83D}, // U+1F430, 🐰, \:rabbit:, Rabbit Face
+{0x6614, 0x14d7, 0xDFB4'D83C}, // U+1F3B4, 🎴, \:flower_playing_cards:, Flower Playing Cards
+{0x7411, 0x3977, 0xDD49'D83E}, // U+1F949, 🥉, \:third_place_medal:, Third Place Medal
+{0x6309, 0x0a8e, 0xDD66'D83D}, // U+1F566, 🕦, \:clock1130:, Clock Face Eleven-Thirty
+{0x630d, 0x0c43, 0xDF9B'D83C}, // U+1F39B, 🎛, \:control_knobs:, Control Knobs
+{0x6617, 0x117d, 0xDD79'D83E}, // U+1F979, 🥹, \:face_holding_back_tears:, Face Holding Back Tears
+{0x7207, 0x2e15, 0xDE97'D83D}, // U+1F697, 🚗, \:red_car:, Automobile
+{0x770a, 0x3f68, 0xDD74'D83E}, // U+1F974, 🥴, \:woozy_face:, Face With Uneven Eyes And Wavy Mouth
+{0x620b, 0x0765, 0xDD0E'D83E}, // U+1F90E, 🤎, \:brown_heart:, Brown Heart
+{0x620c, 0x0752, 0xDC94'D83D}, // U+1F494, 💔, \:broken_heart:, Broken Heart
+{0x6d0e, 0x22c5, 0xDDBE'D83E}, // U+1F9BE, 🦾, \:mechanical_arm:, Mechanical Arm
+{0x7305, 0x3642, 0xDD44'D83E}, // U+1F944, 🥄, \:spoon:, Spoon
+{0x6204, 0x04a0, 0xDC26'D83D}, // U+1F426, 🐦, \:bird:, Bird
+{0x6908, 0x1b60, 0xDF66'D83C}, // U+1F366, 🍦, \:icecream:, Soft Ice Cream
+{0x6f0e, 0x2836, 0x2626}, // ☦, \:orthodox_cross:, Orthodox Cross
+{0x720c, 0x2e28, 0xDDE7'D83E}, // U+1F9E7, 🧧, \:red_envelope:, Red Gift Envelope
+{0x660b, 0x13c6, 0xDCC1'D83D}, // U+1F4C1, 📁, \:file_folder:, File Folder
+{0x6d0d, 0x2474, 0xDEF5'D83D}, // U+1F6F5, 🛵, \:motor_scooter:, Motor Scooter
+{0x7705, 0x3dd2, 0xDEDE'D83D}, // U+1F6DE, 🛞, \:wheel:, Wheel
+{0x7007, 0x2865, 0xDCE6'D83D}, // U+1F4E6, 📦, \:package:, Package
+{0x7309, 0x357b, 0xDF5D'D83C}, // U+1F35D, 🍝, \:spaghetti:, Spaghetti
+{0x7305, 0x33b4, 0xDDA5'D83E}, // U+1F9A5, 🦥, \:sloth:, Sloth
+{0x6e07, 0x263b, 0xDD15'D83D}, // U+1F515, 🔕, \:no_bell:, Bell With Cancellation Stroke
+{0x640d, 0x0f28, 0xDEAF'D83D}, // U+1F6AF, 🚯, \:do_not_litter:, Do Not Litter Symbol
+{0x6804, 0x17f4, 0x270B}, // ✋, \:hand:, Raised Hand
+{0x700e, 0x29bd, 0xDEC2'D83E}, // U+1FAC2, 🫂, \:people_hugging:, People Hugging
+{0x6e08, 0x267f, 0xDE36'D83D}, // U+1F636, 😶, \:no_mouth:, Face Without Mouth
+{0x6d04, 0x2165, 0xDDD9'D83E}, // U+1F9D9, 🧙, \:mage:, Mage
+{0x6c10, 0x1e9c, 0xDFE5'D83D}, // U+1F7E5, 🟥, \:large_red_square:, Large Red Square
+{0x7412, 0x3920, 0xDCDE'D83D}, // U+1F4DE, 📞, \:telephone_receiver:, Telephone Receiver
+{0x630b, 0x087e, 0xDD6B'D83E}, // U+1F96B, 🥫, \:canned_food:, Canned Food
+{0x630b, 0x0b33, 0xDCD5'D83D}, // U+1F4D5, 📕, \:closed_book:, Closed Book
+{0x7406, 0x39a6, 0xDDF5'D83E}, // U+1F9F5, 🧵, \:thread:, Spool Of Thread
+{0x6308, 0x0b0a, 0xDD62'D83D}, // U+1F562, 🕢, \:clock730:, Clock Face Seven-Thirty
+{0x6808, 0x1a7e, 0xDD75'D83E}, // U+1F975, 🥵, \:hot_face:, Overheated Face
+{0x6505, 0x101c, 0xDD85'D83E}, // U+1F985, 🦅, \:eagle:, Eagle
+{0x7310, 0x32bd, 0xDD2F'D83D}, // U+1F52F, 🔯, \:six_pointed_star:, Six Pointed Star With Middle Dot
+{0x7309, 0x37d9, 0xDF3B'D83C}, // U+1F33B, 🌻, \:sunflower:, Sunflower
+{0x6816, 0x199e, 0x2716}, // ✖, \:heavy_multiplication_x:, Heavy Multiplication X
+{0x7304, 0x314f, 0xDCBA'D83D}, // U+1F4BA, 💺, \:seat:, Seat
+{0x6103, 0x0022, 0xDD24'D83D}, // U+1F524, 🔤, \:abc:, Input Symbol For Latin Letters
+{0x6308, 0x0aea, 0xDD60'D83D}, // U+1F560, 🕠, \:clock530:, Clock Face Five-Thirty
+{0x7304, 0x3078, 0xDDC2'D83E}, // U+1F9C2, 🧂, \:salt:, Salt Shaker
+{0x6307, 0x0bd3, 0xDDED'D83E}, // U+1F9ED, 🧭, \:compass:, Compass
+{0x7004, 0x2ad7, 0x26CF}, // ⛏, \:pick:, Pick
+{0x720c, 0x2dd7, 0xDE4C'D83D}, // U+1F64C, 🙌, \:raised_hands:, Person Raising Both Hands In Celebration
+{0x6503, 0x1022, 0xDC42'D83D}, // U+1F442, 👂, \:ear:, Ear
+{0x6d09, 0x241e, 0xDD6E'D83E}, // U+1F96E, 🥮, \:moon_cake:, Moon Cake
+{0x610e, 0x0065, 0xDEA1'D83D}, // U+1F6A1, 🚡, \:aerial_tramway:, Aerial Tramway
+{0x7306, 0x308b, 0xDC61'D83D}, // U+1F461, 👡, \:sandal:, Womans Sandal
+{0x660e, 0x1562, 0xDD60'D83E}, // U+1F960, 🥠, \:fortune_cookie:, Fortune Cookie
+{0x6111, 0x004d, 0xDF9F'D83C}, // U+1F39F, 🎟, \:admission_tickets:, Admission Tickets
+{0x6d10, 0x23c1, 0xDCF4'D83D}, // U+1F4F4, 📴, \:mobile_phone_off:, Mobile Phone Off
+{0x6809, 0x185e, 0xDD1D'D83E}, // U+1F91D, 🤝, \:handshake:, Handshake
+{0x6d0a, 0x216a, 0xDE84'D83E}, // U+1FA84, 🪄, \:magic_wand:, Magic Wand
+{0x6c06, 0x1f2b, 0xDCD2'D83D}, // U+1F4D2, 📒, \:ledger:, Ledger
+{0x6305, 0x0c85, 0xDEB8'D83E}, // U+1FAB8, 🪸, \:coral:, Coral
+{0x6906, 0x1c1b, 0xDCF1'D83D}, // U+1F4F1, 📱, \:iphone:, Mobile Phone
+{0x6616, 0x12d6, 0xDE44'D83D}, // U+1F644, 🙄, \:face_with_rolling_eyes:, Face With Rolling Eyes
+{0x7314, 0x34e5, 0xDFD4'D83C}, // U+1F3D4, 🏔, \:snow_capped_mountain:, Snow-Capped Mountain
+{0x6204, 0x069f, 0xDCA5'D83D}, // U+1F4A5, 💥, \:boom:, Collision Symbol
+{0x6306, 0x0849, 0xDCF7'D83D}, // U+1F4F7, 📷, \:camera:, Camera
+{0x6403, 0x0f24, 0xDDEC'D83E}, // U+1F9EC, 🧬, \:dna:, Dna Double Helix
+{0x6c10, 0x1f50, 0x2194}, // ↔, \:left_right_arrow:, Left Right Arrow
+{0x7305, 0x3560, 0xDD09'D83D}, // U+1F509, 🔉, \:sound:, Speaker With One Sound Wave
+{0x661c, 0x144b, 0xDF1B'D83C}, // U+1F31B, 🌛, \:first_quarter_moon_with_face:, First Quarter Moon With Face
+{0x6405, 0x0fb4, 0xDC57'D83D}, // U+1F457, 👗, \:dress:, Dress
+{0x6c14, 0x1e4b, 0xDD36'D83D}, // U+1F536, 🔶, \:large_orange_diamond:, Large Orange Diamond
+{0x700c, 0x2916, 0x26C5}, // ⛅, \:partly_sunny:, Sun Behind Cloud
+{0x680b, 0x1a19, 0xDD7E'D83E}, // U+1F97E, 🥾, \:hiking_boot:, Hiking Boot
+{0x6207, 0x033e, 0xDF88'D83C}, // U+1F388, 🎈, \:balloon:, Balloon
+{0x7004, 0x2bd3, 0xDCA9'D83D}, // U+1F4A9, 💩, \:poop:, Pile Of Poo
+{0x6221, 0x02ec, 0xDFF8'D83C}, // U+1F3F8, 🏸, \:badminton_racquet_and_shuttlecock:, Badminton Racquet And Shuttlecock
+{0x6c12, 0x1dc6, 0xDD37'D83D}, // U+1F537, 🔷, \:large_blue_diamond:, Large Blue Diamond
+{0x6c11, 0x20fc, 0xDD8D'D83D}, // U+1F58D, 🖍, \:lower_left_crayon:, Crayon
+{0x610a, 0x026d, 0xDE32'D83D}, // U+1F632, 😲, \:astonished:, Astonished Face
+{0x6108, 0x0074, 0x2708}, // ✈, \:airplane:, Airplane
+{0x620c, 0x06e5, 0xDD4A'D83E}, // U+1F94A, 🥊, \:boxing_glove:, Boxing Glove
+{0x7018, 0x2a1d, 0xDDD8'D83E}, // U+1F9D8, 🧘, \:person_in_lotus_position:, Person In Lotus Position
+{0x7706, 0x3dcb, 0xDC0B'D83D}, // U+1F40B, 🐋, \:whale2:, Whale
+{0x7505, 0x3bea, 0xDE32'D83C}, // U+1F232, 🈲, \:u7981:, Squared Cjk Unified Ideograph-7981
+{0x700e, 0x2c84, 0xDD30'D83E}, // U+1F930, 🤰, \:pregnant_woman:, Pregnant Woman
+{0x6706, 0x1613, 0xDDC4'D83E}, // U+1F9C4, 🧄, \:garlic:, Garlic
+{0x6c03, 0x1fbe, 0x264C}, // ♌, \:leo:, Leo
+{0x6212, 0x05eb, 0x25AA}, // ▪, \:black_small_square:, Black Small Square
+{0x7307, 0x365b, 0xDFDF'D83C}, // U+1F3DF, 🏟, \:stadium:, Stadium
+{0x6f02, 0x2779, 0xDD1B'D83D}, // U+1F51B, 🔛, \:on:, On With Exclamation Mark With Left Right Arrow Above
+{0x741c, 0x38a2, 0xDFD3'D83C}, // U+1F3D3, 🏓, \:table_tennis_paddle_and_ball:, Table Tennis Paddle And Ball
+{0x3805, 0x0010, 0xDFB1'D83C}, // U+1F3B1, 🎱, \:8ball:, Billiards
+{0x6307, 0x0dce, 0xDF6E'D83C}, // U+1F36E, 🍮, \:custard:, Custard
+{0x6d04, 0x22f8, 0xDCE3'D83D}, // U+1F4E3, 📣, \:mega:, Cheering Megaphone
+{0x6306, 0x0819, 0xDF35'D83C}, // U+1F335, 🌵, \:cactus:, Cactus
+{0x6204, 0x0673, 0xDCA3'D83D}, // U+1F4A3, 💣, \:bomb:, Bomb
+{0x6f05, 0x2769, 0xDED2'D83E}, // U+1FAD2, 🫒, \:olive:, Olive
+{0x700b, 0x2c49, 0xDE3E'D83D}, // U+1F63E, 😾, \:pouting_cat:, Pouting Cat Face
+{0x6625, 0x11db, 0xDD2B'D83E}, // U+1F92B, 🤫, \:face_with_finger_covering_closed_lips:, Face With Finger Covering Closed Lips
+{0x7213, 0x2d96, 0xDD1A'D83E}, // U+1F91A, 🤚, \:raised_back_of_hand:, Raised Back Of Hand
+{0x6807, 0x17ab, 0xDC87'D83D}, // U+1F487, 💇, \:haircut:, Haircut
+{0x6208, 0x0682, 0xDD16'D83D}, // U+1F516, 🔖, \:bookmark:, Bookmark
+{0x7714, 0x3ce3, 0xDF18'D83C}, // U+1F318, 🌘, \:waning_crescent_moon:, Waning Crescent Moon Symbol
+{0x7409, 0x3933, 0xDD2D'D83D}, // U+1F52D, 🔭, \:telescope:, Telescope
+{0x620a, 0x064c, 0xDC99'D83D}, // U+1F499, 💙, \:blue_heart:, Blue Heart
+{0x6810, 0x198d, 0x2796}, // ➖, \:heavy_minus_sign:, Heavy Minus Sign
+{0x6309, 0x0a25, 0xDFD9'D83C}, // U+1F3D9, 🏙, \:cityscape:, Cityscape
+{0x6204, 0x0669, 0xDC17'D83D}, // U+1F417, 🐗, \:boar:, Boar
+{0x6917, 0x1bdb, 0xDC81'D83D}, // U+1F481, 💁, \:information_desk_person:, Information Desk Person
+{0x6d0a, 0x2278, 0xDF41'D83C}, // U+1F341, 🍁, \:maple_leaf:, Maple Leaf
+{0x6b14, 0x1d1e, 0xDE19'D83D}, // U+1F619, 😙, \:kissing_smiling_eyes:, Kissing Face With Smiling Eyes
+{0x7607, 0x3cbe, 0xDF0B'D83C}, // U+1F30B, 🌋, \:volcano:, Volcano
+{0x7605, 0x3cb8, 0x264D}, // ♍, \:virgo:, Virgo
+{0x7004, 0x2999, 0xDF50'D83C}, // U+1F350, 🍐, \:pear:, Pear
+{0x6206, 0x0808, 0xDDC8'D83E}, // U+1F9C8, 🧈, \:butter:, Butter
+{0x700f, 0x2c74, 0xDEC4'D83E}, // U+1FAC4, 🫄, \:pregnant_person:, Pregnant Person
+{0x6305, 0x090f, 0xDE91'D83E}, // U+1FA91, 🪑, \:chair:, Chair
+{0x6709, 0x171e, 0xDE2C'D83D}, // U+1F62C, 😬, \:grimacing:, Grimacing Face
+{0x6627, 0x1261, 0xDEE2'D83E}, // U+1FAE2, 🫢, \:face_with_open_eyes_and_hand_over_mouth:, Face With Open Eyes And Hand Over Mouth
+{0x7305, 0x333a, 0xDDA8'D83E}, // U+1F9A8, 🦨, \:skunk:, Skunk
+{0x730c, 0x33a7, 0xDFB0'D83C}, // U+1F3B0, 🎰, \:slot_machine:, Slot Machine
+{0x740b, 0x395d, 0xDF21'D83C}, // U+1F321, 🌡, \:thermometer:, Thermometer
+{0x6608, 0x15ce, 0xDE26'D83D}, // U+1F626, 😦, \:frowning:, Frowning Face With Open Mouth
+{0x620f, 0x0728, 0xDF09'D83C}, // U+1F309, 🌉, \:bridge_at_night:, Bridge At Night
+{0x7211, 0x2d2e, 0xDFCD'D83C}, // U+1F3CD, 🏍, \:racing_motorcycle:, Motorcycle
+{0x7409, 0x3a74, 0xDDB2'D83D}, // U+1F5B2, 🖲, \:trackball:, Trackball
+{0x7204, 0x2fdc, 0xDF39'D83C}, // U+1F339, 🌹, \:rose:, Rose
+{0x7203, 0x2dfb, 0xDC00'D83D}, // U+1F400, 🐀, \:rat:, Rat
+{0x6308, 0x0c09, 0xDE15'D83D}, // U+1F615, 😕, \:confused:, Confused Face
+{0x6208, 0x03b3, 0x26BE}, // ⚾, \:baseball:, Baseball
+{0x6d03, 0x21d4, 0xDC68'D83D}, // U+1F468, 👨, \:man:, Man
+{0x640e, 0x0e3f, 0xDF33'D83C}, // U+1F333, 🌳, \:deciduous_tree:, Deciduous Tree
+{0x630b, 0x0bdb, 0xDDDC'D83D}, // U+1F5DC, 🗜, \:compression:, Clamp
+{0x7705, 0x3d20, 0x231A}, // ⌚, \:watch:, Watch
+{0x6609, 0x15e0, 0xDF15'D83C}, // U+1F315, 🌕, \:full_moon:, Full Moon Symbol
+{0x7204, 0x2f44, 0xDC8D'D83D}, // U+1F48D, 💍, \:ring:, Ring
+{0x740a, 0x3b7b, 0xDC95'D83D}, // U+1F495, 💕, \:two_hearts:, Two Hearts
+{0x6f02, 0x26f6, 0xDD7E'D83C}, // U+1F17E, 🅾, \:o2:, Negative Squared Latin Capital Letter O
+{0x7005, 0x2b45, 0xDF55'D83C}, // U+1F355, 🍕, \:pizza:, Slice Of Pizza
+{0x6c19, 0x1f74, 0x21A9}, // ↩, \:leftwards_arrow_with_hook:, Leftwards Arrow With Hook
+{0x630a, 0x0bb8, 0xDE30'D83D}, // U+1F630, 😰, \:cold_sweat:, Face With Open Mouth And Cold Sweat
+{0x6704, 0x1636, 0xDF81'D83C}, // U+1F381, 🎁, \:gift:, Wrapped Present
+{0x730a, 0x37e3, 0xDE0E'D83D}, // U+1F60E, 😎, \:sunglasses:, Smiling Face With Sunglasses
+{0x7616, 0x3c6f, 0xDEA6'D83D}, // U+1F6A6, 🚦, \:vertical_traffic_light:, Vertical Traffic Light
+{0x6503, 0x1169, 0xDC41'D83D}, // U+1F441, 👁, \:eye:, Eye
+{0x6219, 0x0545, 0x25FE}, // ◾, \:black_medium_small_square:, Black Medium Small Square
+{0x7412, 0x3aa6, 0x26A7}, // ⚧, \:transgender_symbol:, Transgender Symbol
+{0x7312, 0x3154, 0xDD48'D83E}, // U+1F948, 🥈, \:second_place_medal:, Second Place Medal
+{0x6a0f, 0x1c57, 0xDC7A'D83D}, // U+1F47A, 👺, \:japanese_goblin:, Japanese Goblin
+{0x6d09, 0x2393, 0xDF0C'D83C}, // U+1F30C, 🌌, \:milky_way:, Milky Way
+{0x740d, 0x3969, 0xDD14'D83E}, // U+1F914, 🤔, \:thinking_face:, Thinking Face
+{0x6309, 0x0a63, 0xDCCB'D83D}, // U+1F4CB, 📋, \:clipboard:, Clipboard
+{0x770d, 0x3db7, 0xDFCB'D83C}, // U+1F3CB, 🏋, \:weight_lifter:, Person Lifting Weights
+{0x6308, 0x0b8a, 0xDF78'D83C}, // U+1F378, 🍸, \:cocktail:, Cocktail Glass
+{0x7317, 0x3404, 0xDD3B'D83D}, // U+1F53B, 🔻, \:small_red_triangle_down:, Down-Pointing Red Triangle
+{0x620a, 0x0486, 0xDDE2'D83E}, // U+1F9E2, 🧢, \:billed_cap:, Billed Cap
+{0x7007, 0x29ad, 0xDC27'D83D}, // U+1F427, 🐧, \:penguin:, Penguin
+{0x720a, 0x2eec, 0xDF91'D83C}, // U+1F391, 🎑, \:rice_scene:, Moon Viewing Ceremony
+{0x7407, 0x3b2d, 0xDFBA'D83C}, // U+1F3BA, 🎺, \:trumpet:, Trumpet
+{0x6811, 0x192c, 0xDCB2'D83D}, // U+1F4B2, 💲, \:heavy_dollar_sign:, Heavy Dollar Sign
+{0x6811, 0x17d4, 0xDEE0'D83D}, // U+1F6E0, 🛠, \:hammer_and_wrench:, Hammer And Wrench
+{0x6f03, 0x2857, 0xDD89'D83E}, // U+1F989, 🦉, \:owl:, Owl
+{0x6306, 0x0ab3, 0xDD51'D83D}, // U+1F551, 🕑, \:clock2:, Clock Face Two Oclock
+{0x6f0b, 0x2747, 0xDDD3'D83E}, // U+1F9D3, 🧓, \:older_adult:, Older Adult
+{0x7409, 0x3949, 0xDDEA'D83E}, // U+1F9EA, 🧪, \:test_tube:, Test Tube
+{0x650e, 0x1130, 0xDF32'D83C}, // U+1F332, 🌲, \:evergreen_tree:, Evergreen Tree
+{0x6b04, 0x1d69, 0xDEA2'D83E}, // U+1FAA2, 🪢, \:knot:, Knot
+{0x7405, 0x3b27, 0xDE9A'D83D}, // U+1F69A, 🚚, \:truck:, Delivery Truck
+{0x6d14, 0x228b, 0xDD4B'D83E}, // U+1F94B, 🥋, \:martial_arts_uniform:, Martial Arts Uniform
+{0x6d0e, 0x22d4, 0xDDBF'D83E}, // U+1F9BF, 🦿, \:mechanical_leg:, Mechanical Leg
+{0x7406, 0x39eb, 0xDFAB'D83C}, // U+1F3AB, 🎫, \:ticket:, Ticket
+{0x7409, 0x3916, 0x260E}, // ☎, \:telephone:, Black Telephone
+{0x6d0e, 0x218c, 0xDCEA'D83D}, // U+1F4EA, 📪, \:mailbox_closed:, Closed Mailbox With Lowered Flag
+{0x6603, 0x1518, 0xDF2B'D83C}, // U+1F32B, 🌫, \:fog:, Fog
+{0x630b, 0x0cd1, 0xDCB3'D83D}, // U+1F4B3, 💳, \:credit_card:, Credit Card
+{0x6d11, 0x219b, 0xDCEC'D83D}, // U+1F4EC, 📬, \:mailbox_with_mail:, Open Mailbox With Raised Flag
+{0x6605, 0x1397, 0x26F4}, // ⛴, \:ferry:, Ferry
+{0x6809, 0x17b3, 0xDF54'D83C}, // U+1F354, 🍔, \:hamburger:, Hamburger
+{0x6117, 0x023f, 0xDD04'D83D}, // U+1F504, 🔄, \:arrows_counterclockwise:, Anticlockwise Downwards And Upwards Open Circle Arrows
 //Emoji list--Autogenerated -- end of section automatically generated
 };
 #endif // NP2_ENABLE_LATEX_LIKE_EMOJI_INPUT
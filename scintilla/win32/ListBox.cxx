@@ -210,6 +210,7 @@ public:
 	int GetSelection() const noexcept override;
 	int Find(const char *prefix) const noexcept override;
 	std::string GetValue(int n) const override;
+	std::string_view GetText(int n) const noexcept override;
 	void RegisterImage(int type, const char *xpm_data) override;
 	void RegisterRGBAImage(int type, int width, int height, const unsigned char *pixelsImage) override;
 	void ClearRegisteredImages() noexcept override;
@@ -381,8 +382,12 @@ int ListBoxX::Find(const char *) const noexcept {
 }
 
 std::string ListBoxX::GetValue(int n) const {
+	return std::string(GetText(n));
+}
+
+std::string_view ListBoxX::GetText(int n) const noexcept {
 	const ListItemData item = lti.Get(n);
-	return std::string(item.text, item.len);
+	return std::string_view(item.text, item.len);
 }
 
 void ListBoxX::RegisterImage(int type, const char *xpm_data) {
@@ -525,12 +530,9 @@ void ListBoxX::SetList(const char *list, const char separator, const char typese
 		AppendListItem(startword, numword, static_cast<unsigned int>(endword - startword));
 	}
 
-	// Finally populate the listbox itself with the correct number of items
-	const int count = lti.Count();
-	::SendMessage(lb, LB_INITSTORAGE, count, 0);
-	for (int j = 0; j < count; j++) {
-		ListBox_AddItemData(lb, j + 1);
-	}
+	// Finally set item count of the listbox itself, items are owner drawn from lti,
+	// so only visible rows are touched.
+	::SendMessage(lb, LB_SETCOUNT, lti.Count(), 0);
 	SetRedraw(true);
 }
 
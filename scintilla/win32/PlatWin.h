@@ -47,6 +47,7 @@ using Microsoft::WRL::ComPtr;
 #if _WIN32_WINNT >= _WIN32_WINNT_WIN7
 #include <d2d1_1.h>
 #include <d3d11_1.h>
+#include <dxgi1_3.h>
 #include <dwrite_1.h>
 #else
 #include <d2d1.h>
@@ -624,6 +624,8 @@ class ScintillaWin final :
 	CLIPFORMAT cfBorlandIDEBlockType;
 	CLIPFORMAT cfLineSelect;
 	CLIPFORMAT cfVSLineTag;
+	// copied text for delayed rendering, converted when the clipboard format is requested
+	mutable std::unique_ptr<SelectionText> clipboardText;
 
 #if EnableDrop_VisualStudioProjectItem
 	CLIPFORMAT cfVSStgProjectItem;
@@ -654,6 +656,10 @@ class ScintillaWin final :
 #if _WIN32_WINNT >= _WIN32_WINNT_WIN7
 	DirectDevice device;
 	ComPtr<IDXGISwapChain1> pDXGISwapChain;
+	// flags used to create pDXGISwapChain, ResizeBuffers() must be called with the same flags
+	UINT swapChainFlags = 0;
+	// signaled when the flip model swap chain is ready to accept a new frame
+	HANDLE frameLatencyWaitableObject = nullptr;
 #endif
 	RenderTargets targets;
 	// rendering parameters for current monitor
@@ -674,6 +680,8 @@ class ScintillaWin final :
 	HRESULT Create3D() noexcept;
 	HRESULT SetBackBuffer(IDXGISwapChain1 *pSwapChain) const noexcept;
 	HRESULT CreateSwapChain(HWND hwnd) noexcept;
+	void ReleaseSwapChain() noexcept;
+	void WaitForSwapChain() const noexcept;
 #endif
 	void EnsureRenderTarget(HDC hdc) noexcept;
 	void DropRenderTarget() noexcept {
@@ -772,6 +780,7 @@ class ScintillaWin final :
 	void Copy(bool asBinary) const override;
 	bool CanPaste() const noexcept override;
 	void Paste(bool asBinary) override;
+	void PasteStream(std::wstring_view wsv);
 	void SCICALL CreateCallTipWindow(PRectangle rc) noexcept override;
 #if SCI_EnablePopupMenu
 	void AddToPopUp(const char *label, int cmd = 0, bool enabled = true) const noexcept override;
@@ -786,6 +795,8 @@ class ScintillaWin final :
 	void GetMouseParameters() noexcept;
 	void CopyToGlobal(GlobalMemory &gmUnicode, const SelectionText &selectedText, CopyEncoding encoding) const;
 	void CopyToClipboard(const SelectionText &selectedText) const override;
+	void SetClipboardText(std::unique_ptr<SelectionText> selectedText) const;
+	void RenderClipboardFormat(UINT uFormat) const;
 	void ScrollMessage(WPARAM wParam);
 	void HorizontalScrollMessage(WPARAM wParam);
 	void FullPaint();
@@ -798,7 +809,7 @@ class ScintillaWin final :
 	bool GetScrollInfo(int nBar, LPSCROLLINFO lpsi) const noexcept;
 	bool ChangeScrollRange(int nBar, int nMin, int nMax, UINT nPage) const noexcept;
 	void ChangeScrollPos(int barType, Sci::Position pos);
-	sptr_t GetTextLength() const noexcept;
+	sptr_t GetTextLength() const;
 	sptr_t GetText(uptr_t wParam, sptr_t lParam) const;
 	Window::Cursor SCICALL ContextCursor(Point pt);
 #if SCI_EnablePopupMenu
@@ -943,6 +954,9 @@ void ScintillaWin::Finalise() noexcept {
 	}
 	SetIdle(false);
 	DropRenderTarget();
+#if _WIN32_WINNT >= _WIN32_WINNT_WIN7
+	ReleaseSwapChain();
+#endif
 	::RevokeDragDrop(MainHWND());
 }
 
@@ -1009,7 +1023,7 @@ HRESULT ScintillaWin::Create3D() noexcept {
 		return S_OK;
 	}
 	targets.Release();
-	pDXGISwapChain = nullptr;
+	ReleaseSwapChain();
 	device.Release();
 	const HRESULT hr = device.CreateDevice();
 	if (FAILED(hr)) {
@@ -1111,7 +1125,7 @@ HRESULT ScintillaWin::SetBackBuffer(IDXGISwapChain1 *pSwapChain) const noexcept
 HRESULT ScintillaWin::CreateSwapChain(HWND hwnd) noexcept {
 	// Sets pDXGISwapChain but only when each call succeeds
 	// Needs pDXGIDevice, pDirect3DDevice
-	pDXGISwapChain = nullptr;
+	ReleaseSwapChain();
 	assert(device.pDXGIDevice);
 
 	// At each stage, place object in a unique_ptr to ensure release occurs
@@ -1136,13 +1150,27 @@ HRESULT ScintillaWin::CreateSwapChain(HWND hwnd) noexcept {
 	swapChainDesc.BufferUsage = DXGI_USAGE_RENDER_TARGET_OUTPUT;
 	swapChainDesc.BufferCount = 2;
 	swapChainDesc.Scaling = DXGI_SCALING_STRETCH;
-	swapChainDesc.SwapEffect = DXGI_SWAP_EFFECT_DISCARD;
-	swapChainDesc.Flags = 0;
+	// flip model with dirty rectangles lets DWM compose only the repainted lines,
+	// the waitable object (Windows 8.1) limits queued frames to one.
+	swapChainDesc.SwapEffect = DXGI_SWAP_EFFECT_FLIP_SEQUENTIAL;
+	swapChainDesc.Flags = DXGI_SWAP_CHAIN_FLAG_FRAME_LATENCY_WAITABLE_OBJECT;
 
 	// DXGI swap chain for window
 	ComPtr<IDXGISwapChain1> pSwapChain;
 	hr = dxgiFactory->CreateSwapChainForHwnd(device.pDirect3DDevice.Get(), hwnd, &swapChainDesc,
 		nullptr, nullptr, pSwapChain.GetAddressOf());
+	if (FAILED(hr)) {
+		// waitable object is not supported before Windows 8.1
+		swapChainDesc.Flags = 0;
+		hr = dxgiFactory->CreateSwapChainForHwnd(device.pDirect3DDevice.Get(), hwnd, &swapChainDesc,
+			nullptr, nullptr, pSwapChain.ReleaseAndGetAddressOf());
+	}
+	if (FAILED(hr)) {
+		// flip model is not supported before Windows 8
+		swapChainDesc.SwapEffect = DXGI_SWAP_EFFECT_DISCARD;
+		hr = dxgiFactory->CreateSwapChainForHwnd(device.pDirect3DDevice.Get(), hwnd, &swapChainDesc,
+			nullptr, nullptr, pSwapChain.ReleaseAndGetAddressOf());
+	}
 	if (FAILED(hr))
 		return hr;
 
@@ -1150,10 +1178,35 @@ HRESULT ScintillaWin::CreateSwapChain(HWND hwnd) noexcept {
 	if (FAILED(hr))
 		return hr;
 
+	if (swapChainDesc.Flags & DXGI_SWAP_CHAIN_FLAG_FRAME_LATENCY_WAITABLE_OBJECT) {
+		ComPtr<IDXGISwapChain2> pSwapChain2;
+		if (SUCCEEDED(pSwapChain.As(&pSwapChain2))) {
+			pSwapChain2->SetMaximumFrameLatency(1);
+			frameLatencyWaitableObject = pSwapChain2->GetFrameLatencyWaitableObject();
+		}
+	}
+
 	// All successful so export swap chain for later presentation
+	swapChainFlags = swapChainDesc.Flags;
 	pDXGISwapChain = std::move(pSwapChain);
 	return S_OK;
 }
+
+void ScintillaWin::ReleaseSwapChain() noexcept {
+	if (frameLatencyWaitableObject) {
+		::CloseHandle(frameLatencyWaitableObject);
+		frameLatencyWaitableObject = nullptr;
+	}
+	swapChainFlags = 0;
+	pDXGISwapChain = nullptr;
+}
+
+void ScintillaWin::WaitForSwapChain() const noexcept {
+	if (frameLatencyWaitableObject) {
+		// bounded wait, a lost frame is better than a hung window
+		::WaitForSingleObjectEx(frameLatencyWaitableObject, 1000, TRUE);
+	}
+}
 #endif // _WIN32_WINNT >= _WIN32_WINNT_WIN7
 
 void ScintillaWin::EnsureRenderTarget(HDC hdc) noexcept {
@@ -1412,6 +1465,11 @@ bool ScintillaWin::PaintDC(HDC hdc) {
 			const AutoSurface surfaceWindow(pRenderTarget, this);
 			if (surfaceWindow) {
 				SetRenderingParams(surfaceWindow);
+#if _WIN32_WINNT >= _WIN32_WINNT_WIN7
+				if (technology == Technology::DirectWrite1) {
+					WaitForSwapChain();
+				}
+#endif
 				pRenderTarget->BeginDraw();
 				Paint(surfaceWindow, rcPaint);
 				surfaceWindow->Release();
@@ -1422,7 +1480,13 @@ bool ScintillaWin::PaintDC(HDC hdc) {
 				}
 #if _WIN32_WINNT >= _WIN32_WINNT_WIN7
 				if ((technology == Technology::DirectWrite1) && pDXGISwapChain) {
-					const DXGI_PRESENT_PARAMETERS parameters{};
+					// only lines inside rcPaint were drawn, flip model copies the rest from previous frame
+					RECT rcDirty = RectFromPRectangleEx(rcPaint);
+					DXGI_PRESENT_PARAMETERS parameters{};
+					if (!paintingAllText && rcDirty.right > rcDirty.left && rcDirty.bottom > rcDirty.top) {
+						parameters.DirtyRectsCount = 1;
+						parameters.pDirtyRects = &rcDirty;
+					}
 					const HRESULT hrPresent = pDXGISwapChain->Present1(1, 0, &parameters);
 					if (FAILED(hrPresent)) {
 						DropRenderTarget();
@@ -1741,14 +1805,41 @@ sptr_t ScintillaWin::HandleCompositionInline(uptr_t, sptr_t lParam) {
 		const UINT codePage = CodePageOfDocument();
 		const std::wstring_view wsv = wcs;
 		char inBufferCP[16];
-		for (size_t i = 0; i < wsv.size(); ) {
-			const size_t ucWidth = UTF16CharLength(wsv[i]);
-			const int size = MultiByteFromWideChar(codePage, wsv.substr(i, ucWidth), inBufferCP, sizeof(inBufferCP) - 1);
-			inBufferCP[size] = '\0';
-			InsertCharacter(std::string_view(inBufferCP, size), CharacterSource::TentativeInput);
+		if (inOverstrike) {
+			// each character overwrites one character
+			for (size_t i = 0; i < wsv.size(); ) {
+				const size_t ucWidth = UTF16CharLength(wsv[i]);
+				const int size = MultiByteFromWideChar(codePage, wsv.substr(i, ucWidth), inBufferCP, sizeof(inBufferCP) - 1);
+				inBufferCP[size] = '\0';
+				InsertCharacter(std::string_view(inBufferCP, size), CharacterSource::TentativeInput);
+
+				DrawImeIndicator(imeIndicator[i], size);
+				i += ucWidth;
+			}
+		} else {
+			// insert whole composition string at once, so a long line is wrapped and laid out
+			// once per composition update instead of once per character.
+			std::string text;
+			std::vector<std::pair<BYTE, Sci::Position>> indicatorRuns;
+			for (size_t i = 0; i < wsv.size(); ) {
+				const size_t ucWidth = UTF16CharLength(wsv[i]);
+				const int size = MultiByteFromWideChar(codePage, wsv.substr(i, ucWidth), inBufferCP, sizeof(inBufferCP) - 1);
+				text.append(inBufferCP, size);
+				if (!indicatorRuns.empty() && indicatorRuns.back().first == imeIndicator[i]) {
+					indicatorRuns.back().second += size;
+				} else {
+					indicatorRuns.emplace_back(imeIndicator[i], size);
+				}
+				i += ucWidth;
+			}
+			InsertCharacter(text, CharacterSource::TentativeInput);
 
-			DrawImeIndicator(imeIndicator[i], size);
-			i += ucWidth;
+			// runs are drawn backward from caret
+			Sci::Position before = 0;
+			for (auto it = indicatorRuns.rbegin(); it != indicatorRuns.rend(); ++it) {
+				DrawImeIndicator(it->first, it->second, before);
+				before += it->second;
+			}
 		}
 
 		// Japanese IME after pressing Space or Tab replaces input string with first candidate item (target string);
@@ -1834,14 +1925,14 @@ std::string ScintillaWin::EncodeWString(std::wstring_view wsv) const {
 	return StringEncode(wsv, CodePageOfDocument());
 }
 
-sptr_t ScintillaWin::GetTextLength() const noexcept {
-	return pdoc->CountUTF16(0, pdoc->LengthNoExcept());
-	// Count the number of UTF-16 code units line by line
+sptr_t ScintillaWin::GetTextLength() const {
+	// accessibility clients query the length repeatedly, counted with character block index when available
+	return CountCharacters(0, pdoc->LengthNoExcept(), true);
 }
 
 sptr_t ScintillaWin::GetText(uptr_t wParam, sptr_t lParam) const {
 	if (lParam == 0) {
-		return pdoc->CountUTF16(0, pdoc->LengthNoExcept());
+		return GetTextLength();
 	}
 	if (wParam == 0) {
 		return 0;
@@ -1852,11 +1943,32 @@ sptr_t ScintillaWin::GetText(uptr_t wParam, sptr_t lParam) const {
 		return 0;
 	}
 	const Sci::Position lengthWanted = wParam - 1;
+	if (IsUnicodeMode()) {
+		pdoc->BuildCharacterIndex();
+	}
 	Sci::Position sizeRequestedRange = pdoc->GetRelativePositionUTF16(0, lengthWanted);
 	if (sizeRequestedRange < 0) {
 		// Requested more text than there is in the document.
 		sizeRequestedRange = pdoc->LengthNoExcept();
 	}
+	if (IsUnicodeMode()) {
+		// convert requested range in slices, avoid copying the whole range into a temporary string
+		constexpr Sci::Position sliceSize = 1024*1024;
+		std::string docBytes(std::min(sizeRequestedRange, sliceSize + UTF8MaxBytes), '\0');
+		size_t lengthUTF16 = 0;
+		Sci::Position pos = 0;
+		while (pos < sizeRequestedRange && lengthUTF16 < static_cast<size_t>(lengthWanted)) {
+			Sci::Position end = sizeRequestedRange;
+			if (end - pos > sliceSize) {
+				end = pdoc->MovePositionOutsideChar(pos + sliceSize, 1, false);
+			}
+			pdoc->GetCharRange(docBytes.data(), pos, end - pos);
+			lengthUTF16 += UTF16FromUTF8(std::string_view(docBytes.data(), end - pos), ptr + lengthUTF16, lengthWanted - lengthUTF16);
+			pos = end;
+		}
+		ptr[lengthUTF16] = L'\0';
+		return static_cast<sptr_t>(lengthUTF16);
+	}
 	std::string docBytes(sizeRequestedRange, '\0');
 	pdoc->GetCharRange(docBytes.data(), 0, sizeRequestedRange);
 	// Convert to Unicode using the current Scintilla code page
@@ -1930,7 +2042,7 @@ void ScintillaWin::SizeWindow() {
 	if ((technology == Technology::DirectWrite1) && pDXGISwapChain && targets.pDeviceContext &&
 		(paintState == PaintState::notPainting)) {
 		targets.pDeviceContext->SetTarget(nullptr);	// ResizeBuffers fails if bitmap still owned by swap chain
-		hrResize = pDXGISwapChain->ResizeBuffers(0, 0, 0, DXGI_FORMAT_UNKNOWN, 0);
+		hrResize = pDXGISwapChain->ResizeBuffers(0, 0, 0, DXGI_FORMAT_UNKNOWN, swapChainFlags);
 		if (SUCCEEDED(hrResize)) {
 			hrResize = SetBackBuffer(pDXGISwapChain.Get());
 		} else {
@@ -2665,6 +2777,28 @@ sptr_t ScintillaWin::WndProc(Message iMessage, uptr_t wParam, sptr_t lParam) {
 			return ::DefWindowProc(MainHWND(), msg, wParam, lParam);
 #endif
 
+		case WM_RENDERFORMAT:
+			RenderClipboardFormat(static_cast<UINT>(wParam));
+			return 0;
+
+		case WM_RENDERALLFORMATS: {
+			// clipboard owner is about to be destroyed
+			const Clipboard clipboard(MainHWND());
+			if (clipboard && ::GetClipboardOwner() == MainHWND()) {
+				if (clipboardText) {
+					RenderClipboardFormat(clipboardText->asBinary ? CF_TEXT : CF_UNICODETEXT);
+				}
+				if (::IsClipboardFormatAvailable(cfBorlandIDEBlockType)) {
+					RenderClipboardFormat(cfBorlandIDEBlockType);
+				}
+			}
+		}
+		break;
+
+		case WM_DESTROYCLIPBOARD:
+			clipboardText.reset();
+			return 0;
+
 		case WM_GETTEXTLENGTH:
 			return GetTextLength();
 
@@ -2887,11 +3021,22 @@ bool ScintillaWin::PaintContains(PRectangle rc) const noexcept {
 	return true;
 }
 
-void ScintillaWin::ScrollText(Sci::Line /* linesToMove */) {
+void ScintillaWin::ScrollText(Sci::Line linesToMove) {
 	//Platform::DebugPrintf("ScintillaWin::ScrollText %d\n", linesToMove);
-	//::ScrollWindow(MainHWND(), 0,
-	//	vs.lineHeight * linesToMove, 0, 0);
-	//::UpdateWindow(MainHWND());
+	// Only GDI and DC render target draw into the window itself, so the previous frame
+	// can be moved; pending invalid areas were computed for the old top line.
+	if (scrollBlit && (technology == Technology::Default || technology == Technology::DirectWriteDC)
+		&& !::GetUpdateRect(MainHWND(), nullptr, FALSE)) {
+		const PRectangle rcClient = GetClientRectangle();
+		const int dy = static_cast<int>(vs.lineHeight * linesToMove);
+		if (std::abs(dy) < rcClient.Height()) {
+			// text and margins are moved together, exposed lines are invalidated and painted later
+			const RECT rc = RectFromPRectangleEx(rcClient);
+			::ScrollWindowEx(MainHWND(), 0, dy, &rc, &rc, nullptr, nullptr, SW_INVALIDATE);
+			UpdateSystemCaret();
+			return;
+		}
+	}
 	Redraw();
 	UpdateSystemCaret();
 }
@@ -3049,8 +3194,10 @@ void Editor::BeginBatchUpdate() noexcept {
 	if (batchUpdateDepth == 1) {
 		batchUpdateState.modEventMask = modEventMask;
 		modEventMask = ModificationFlags::None;
-		batchUpdateState.actions = pdoc->UndoActions();
 		batchUpdateState.lines = pdoc->LinesTotal();
+		batchUpdateState.length = pdoc->LengthNoExcept();
+		batchUpdateState.changeStart = -1;
+		batchUpdateState.changeEnd = -1;
 		::SendMessage(HwndFromWindow(wMain), WM_SETREDRAW, FALSE, 0);
 	}
 }
@@ -3061,9 +3208,20 @@ void Editor::EndBatchUpdate() noexcept {
 		modEventMask = batchUpdateState.modEventMask;
 		::SendMessage(HwndFromWindow(wMain), WM_SETREDRAW, TRUE, 0);
 		::InvalidateRect(HwndFromWindow(wMain), nullptr, TRUE);
-		if (batchUpdateState.actions != pdoc->UndoActions()) {
+		if (batchUpdateState.changeStart >= 0) {
+			// work skipped for each modification inside the batch
+			SetScrollBars();
+			if (SynchronousStylingToVisible()) {
+				QueueIdleWork(WorkItems::style, pdoc->LengthNoExcept());
+			}
+			// one notification for all modifications: text in [position, position + length)
+			// replaced lengthBefore bytes of text before the batch.
 			NotificationData scn = {};
 			scn.nmhdr.code = Notification::Modified;
+			scn.modificationType = ModificationFlags::BatchUpdate;
+			scn.position = batchUpdateState.changeStart;
+			scn.length = batchUpdateState.changeEnd - batchUpdateState.changeStart;
+			scn.lengthBefore = scn.length - (pdoc->LengthNoExcept() - batchUpdateState.length);
 			scn.linesAdded = pdoc->LinesTotal() - batchUpdateState.lines;
 			NotifyParent(scn);
 		}
@@ -3143,10 +3301,12 @@ CaseFolderDBCS::CaseFolderDBCS(int codePage, const DBCSCharClassify *dbcsCharCla
 
 	constexpr uint32_t minIndex = DBCSIndex(minLeadByte, minTrailByte);
 	constexpr uint32_t maxIndex = DBCSIndex(maxLeadByte, maxTrailByte) + 1;
+	const std::unique_ptr<uint8_t[]> classifyMap = std::make_unique<uint8_t[]>(0x8000);
+	dbcsCharClass->ExpandClassifyMap(classifyMap.get());
 #if NP2_USE_SSE2
 	constexpr uint32_t offset = NP2_align_down(minIndex, sizeof(__m128i));
 	constexpr uint32_t count = NP2_align_up(maxIndex - offset, sizeof(__m128i)) / sizeof(__m128i);
-	const __m128i * const charClass = reinterpret_cast<const __m128i *>(dbcsCharClass->GetClassifyMap() + offset);
+	const __m128i * const charClass = reinterpret_cast<const __m128i *>(classifyMap.get() + offset);
 	const __m128i mmWord = _mm_set1_epi8(static_cast<char>(CharacterClass::word));
 
 	for (uint32_t index = 0; index < count; index++) {
@@ -3185,7 +3345,7 @@ CaseFolderDBCS::CaseFolderDBCS(int codePage, const DBCSCharClassify *dbcsCharCla
 	}
 	// end NP2_USE_SSE2
 #else
-	const uint8_t * const charClass = dbcsCharClass->GetClassifyMap();
+	const uint8_t * const charClass = classifyMap.get();
 	for (uint32_t index = minIndex; index < maxIndex; index++) {
 		// skip case insensitive control, space, punctuation, CJK and private character
 		if (charClass[index] == static_cast<uint8_t>(CharacterClass::word)) {
@@ -3342,10 +3502,10 @@ std::string ScintillaWin::CaseMapString(const std::string &s, CaseMapping caseMa
 void ScintillaWin::Copy(bool asBinary) const {
 	//Platform::DebugPrintf("Copy\n");
 	if (!sel.Empty()) {
-		SelectionText selectedText;
-		selectedText.asBinary = asBinary;
-		CopySelectionRange(selectedText);
-		CopyToClipboard(selectedText);
+		auto selectedText = std::make_unique<SelectionText>();
+		selectedText->asBinary = asBinary;
+		CopySelectionRange(*selectedText);
+		SetClipboardText(std::move(selectedText));
 	}
 }
 
@@ -3456,6 +3616,11 @@ inline bool SupportedFormat(const FORMATETC *pFE) noexcept {
 		&& IsValidFormatEtc(pFE);
 }
 
+// text larger than this is placed on clipboard with delayed rendering
+constexpr size_t clipboardDelayRenderSize = 1024*1024;
+// text larger than this is converted and inserted in chunks on paste
+constexpr size_t pasteStreamChunkSize = 1024*1024;
+
 }
 
 void ScintillaWin::Paste(bool asBinary) {
@@ -3505,13 +3670,48 @@ void ScintillaWin::Paste(bool asBinary) {
 	// Use CF_UNICODETEXT if available
 	GlobalMemory memUSelection(::GetClipboardData(CF_UNICODETEXT));
 	if (const wchar_t *uptr = static_cast<const wchar_t *>(memUSelection.ptr)) {
-		const std::string putf = EncodeWString(uptr);
-		InsertPasteShape(putf.c_str(), putf.length(), pasteShape);
+		const std::wstring_view wsv(uptr, wcsnlen(uptr, memUSelection.Size() / sizeof(wchar_t)));
+		if (wsv.length() > pasteStreamChunkSize && pasteShape == PasteShape::stream
+			&& (multiPasteMode == MultiPaste::Once || sel.Count() == 1)) {
+			PasteStream(wsv);
+		} else {
+			const std::string putf = EncodeWString(wsv);
+			InsertPasteShape(putf.c_str(), putf.length(), pasteShape);
+		}
 		memUSelection.Unlock();
 	}
 	Redraw();
 }
 
+// Convert and insert large text chunk by chunk directly from clipboard memory,
+// without temporary copies of the whole text in document encoding.
+void ScintillaWin::PasteStream(std::wstring_view wsv) {
+	const SelectionPosition selStart = RealizeVirtualSpace(sel.Start());
+	Sci::Position position = selStart.Position();
+	const size_t estimated = IsUnicodeMode() ? UTF8Length(wsv) : wsv.length();
+	pdoc->Allocate(pdoc->LengthNoExcept() + estimated);
+
+	std::string converted;
+	while (!wsv.empty()) {
+		size_t count = std::min(wsv.length(), pasteStreamChunkSize);
+		if (count < wsv.length()) {
+			// keep surrogate pair and CR LF in same chunk
+			const wchar_t last = wsv[count - 1];
+			if (last == L'\r' || (last >= SURROGATE_LEAD_FIRST && last <= SURROGATE_LEAD_LAST)) {
+				count--;
+			}
+		}
+		std::string chunk = EncodeWString(wsv.substr(0, count));
+		wsv.remove_prefix(count);
+		if (convertPastes) {
+			converted = Document::TransformLineEnds(chunk.data(), chunk.length(), pdoc->eolMode);
+			chunk.swap(converted);
+		}
+		position += pdoc->InsertString(position, chunk.data(), chunk.length());
+	}
+	SetEmptySelection(position);
+}
+
 void ScintillaWin::CreateCallTipWindow(PRectangle) noexcept {
 	if (!ct.wCallTip.Created()) {
 		HWND wnd = ::CreateWindow(callClassName, callClassName,
@@ -3954,44 +4154,71 @@ void ScintillaWin::CopyToGlobal(GlobalMemory &gmUnicode, const SelectionText &se
 }
 
 void ScintillaWin::CopyToClipboard(const SelectionText &selectedText) const {
+	SetClipboardText(std::make_unique<SelectionText>(selectedText));
+}
+
+void ScintillaWin::SetClipboardText(std::unique_ptr<SelectionText> selectedText) const {
 	const Clipboard clipboard(MainHWND());
 	if (!clipboard) {
 		return;
 	}
+	// previous snapshot is released on WM_DESTROYCLIPBOARD
 	::EmptyClipboard();
 
-	GlobalMemory uniText;
-	CopyToGlobal(uniText, selectedText, selectedText.asBinary ? CopyEncoding::Binary : CopyEncoding::Unicode);
-
-	if (uniText) {
-		uniText.SetClip(selectedText.asBinary ? CF_TEXT : CF_UNICODETEXT);
+	const UINT uFormat = selectedText->asBinary ? CF_TEXT : CF_UNICODETEXT;
+	const bool delayRender = selectedText->Length() >= clipboardDelayRenderSize;
+	if (delayRender) {
+		// converted on WM_RENDERFORMAT only when some application pastes the text
+		::SetClipboardData(uFormat, {});
+	} else {
+		GlobalMemory uniText;
+		CopyToGlobal(uniText, *selectedText, selectedText->asBinary ? CopyEncoding::Binary : CopyEncoding::Unicode);
+		if (uniText) {
+			uniText.SetClip(uFormat);
 
-		if (selectedText.asBinary) {
-			// encode length information
+			if (selectedText->asBinary) {
+				// encode length information
+			}
 		}
 	}
 
-	if (selectedText.rectangular) {
+	if (selectedText->rectangular) {
 		::SetClipboardData(cfColumnSelect, {});
-
-		GlobalMemory borlandSelection;
-		borlandSelection.Allocate(1);
-		if (borlandSelection) {
-			static_cast<BYTE *>(borlandSelection.ptr)[0] = 0x02;
-			borlandSelection.SetClip(cfBorlandIDEBlockType);
-		}
+		// rendered on request
+		::SetClipboardData(cfBorlandIDEBlockType, {});
 	}
 
-	if (selectedText.lineCopy) {
+	if (selectedText->lineCopy) {
 		::SetClipboardData(cfLineSelect, {});
 		::SetClipboardData(cfVSLineTag, {});
 	}
 
+	if (delayRender) {
+		clipboardText = std::move(selectedText);
+	}
+
 	// TODO: notify data loss
 	//if (!selectedText.asBinary && ) {
 	//}
 }
 
+void ScintillaWin::RenderClipboardFormat(UINT uFormat) const {
+	GlobalMemory memory;
+	if (uFormat == cfBorlandIDEBlockType) {
+		memory.Allocate(1);
+		if (memory) {
+			static_cast<BYTE *>(memory.ptr)[0] = 0x02;
+		}
+	} else if (clipboardText && (uFormat == CF_UNICODETEXT || uFormat == CF_TEXT)) {
+		CopyToGlobal(memory, *clipboardText, clipboardText->asBinary ? CopyEncoding::Binary : CopyEncoding::Unicode);
+		// text format is rendered only once
+		clipboardText.reset();
+	}
+	if (memory) {
+		memory.SetClip(uFormat);
+	}
+}
+
 void ScintillaWin::ScrollMessage(WPARAM wParam) {
 	//DWORD dwStart = GetTickCount();
 	//Platform::DebugPrintf("Scroll %x %d\n", wParam, lParam);
@@ -44,6 +44,7 @@
 #include "XPM.h"
 #include "CharClassify.h"
 #include "UniConversion.h"
+#include "ParallelSupport.h"
 
 #include "WinTypes.h"
 #include "PlatWin.h"
@@ -1327,6 +1328,108 @@ std::unique_ptr<IScreenLineLayout> SurfaceD2D::Layout(const IScreenLine *screenL
 	return std::make_unique<ScreenLineLayout>(screenLine);
 }
 
+namespace {
+
+// Cache text layouts used for drawing, so painting same text again (e.g. when scrolling back and forth)
+// reuses shaping results. Two way associative like PositionCache, the least recently used entry is replaced.
+// Layout is measured in DIPs, font size and zoom are part of the text format.
+class TextLayoutCache {
+	struct Entry {
+		ComPtr<IDWriteTextFormat> format; // keep format alive, so the pointer can't be reused while cached
+		TextLayout layout;
+		std::wstring text;
+		FLOAT maxWidth = 0;
+		FLOAT maxHeight = 0;
+		uint32_t clock = 0;
+		bool Matches(std::wstring_view wsv, const IDWriteTextFormat *pTextFormat, FLOAT maxWidth_, FLOAT maxHeight_) const noexcept {
+			return layout && format.Get() == pTextFormat && maxWidth == maxWidth_ && maxHeight == maxHeight_
+				&& wsv == text;
+		}
+	};
+	static constexpr size_t cacheSize = 1024;
+	static constexpr size_t maxTextLength = 512;
+	// not freed in destructor, COM objects are released in ReleaseD2D() before DirectWrite is unloaded.
+	Entry *entries = nullptr;
+	NativeMutex cacheLock;
+	uint32_t clock = 0;
+
+	static size_t Hash(std::wstring_view wsv, const IDWriteTextFormat *pTextFormat, FLOAT maxWidth) noexcept {
+		// http://www.isthe.com/chongo/tech/comp/fnv/#FNV-1a
+		constexpr uint32_t FNV_offset_basis = 2166136261U;
+		constexpr uint32_t FNV_prime        = 16777619U;
+		uint32_t h = FNV_offset_basis;
+		for (const wchar_t ch : wsv) {
+			h ^= ch;
+			h *= FNV_prime;
+		}
+		h ^= static_cast<uint32_t>(reinterpret_cast<uintptr_t>(pTextFormat) >> 4);
+		h *= FNV_prime;
+		h ^= static_cast<uint32_t>(maxWidth);
+		h *= FNV_prime;
+		return h;
+	}
+
+	uint32_t NextClock() noexcept {
+		clock++;
+		if (clock == UINT32_MAX) {
+			for (size_t index = 0; index < cacheSize; index++) {
+				entries[index].clock = entries[index].clock != 0;
+			}
+			clock = 2;
+		}
+		return clock;
+	}
+
+public:
+	TextLayout Retrieve(std::wstring_view wsv, IDWriteTextFormat *pTextFormat, FLOAT maxWidth, FLOAT maxHeight) {
+		if (wsv.length() > maxTextLength) {
+			return LayoutCreate(wsv, pTextFormat, maxWidth, maxHeight);
+		}
+
+		const size_t hashValue = Hash(wsv, pTextFormat, maxWidth);
+		constexpr size_t mask = cacheSize - 1;
+		const size_t probe = hashValue & mask;
+		const size_t probe2 = (hashValue * 37) & mask;
+		{
+			const LockGuard<NativeMutex> readLock(cacheLock);
+			if (!entries) {
+				entries = new Entry[cacheSize];
+			}
+			for (const size_t index : { probe, probe2 }) {
+				Entry &entry = entries[index];
+				if (entry.Matches(wsv, pTextFormat, maxWidth, maxHeight)) {
+					entry.clock = NextClock();
+					return entry.layout;
+				}
+			}
+		}
+
+		TextLayout layout = LayoutCreate(wsv, pTextFormat, maxWidth, maxHeight);
+		if (layout) {
+			const LockGuard<NativeMutex> writeLock(cacheLock);
+			Entry &entry = (entries[probe].clock <= entries[probe2].clock) ? entries[probe] : entries[probe2];
+			entry.format = pTextFormat;
+			entry.layout = layout;
+			entry.text.assign(wsv);
+			entry.maxWidth = maxWidth;
+			entry.maxHeight = maxHeight;
+			entry.clock = NextClock();
+		}
+		return layout;
+	}
+
+	void Clear() noexcept {
+		const LockGuard<NativeMutex> lock(cacheLock);
+		delete[] entries;
+		entries = nullptr;
+		clock = 0;
+	}
+};
+
+TextLayoutCache textLayoutCache;
+
+}
+
 void SurfaceD2D::DrawTextCommon(PRectangle rc, const Font *font_, XYPOSITION ybase, std::string_view text, int codePageOverride, UINT fuOptions) {
 	const FontDirectWrite *pfm = down_cast<const FontDirectWrite *>(font_);
 	if (pfm->pTextFormat) {
@@ -1342,7 +1445,7 @@ void SurfaceD2D::DrawTextCommon(PRectangle rc, const Font *font_, XYPOSITION yba
 		//pfm->pTextFormat->SetReadingDirection(mode.bidiR2L ? DWRITE_READING_DIRECTION_RIGHT_TO_LEFT : DWRITE_READING_DIRECTION_LEFT_TO_RIGHT);
 
 		// Explicitly creating a text layout appears a little faster
-		const TextLayout pTextLayout = LayoutCreate(
+		const TextLayout pTextLayout = textLayoutCache.Retrieve(
 			tbuf.AsView(),
 			pfm->pTextFormat.Get(),
 			static_cast<FLOAT>(rc.Width()),
@@ -1782,6 +1885,7 @@ bool LoadD2D() noexcept {
 }
 
 void ReleaseD2D() noexcept {
+	textLayoutCache.Clear();
 	ReleaseUnknown(gdiInterop);
 	ReleaseUnknown(pIDWriteFactory);
 	ReleaseUnknown(pD2DFactory);
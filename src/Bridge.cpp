@@ -27,6 +27,7 @@
 #include <commctrl.h>
 #include <commdlg.h>
 #include <activscp.h>
+#include <cmath>
 #include <string>
 #include <string_view>
 #include <memory>
@@ -95,6 +96,106 @@ void EditPrintInit() noexcept {
 	}
 }
 
+// layout parameters used to paginate the print range
+struct PrintLayoutKey {
+	HANDLE docPointer;
+	Sci_Position startPos;
+	Sci_Position endPos;
+	RECT rc;
+	POINT ptDpi;
+	int zoom;
+	int colorMode;
+	int tabWidth;
+	int lineNumberWidth;
+};
+
+// page start positions from last pagination, reused when printing again with same layout.
+struct PrintPageCache {
+	PrintLayoutKey key;
+	std::unique_ptr<Sci_Position[]> pageStart;
+	UINT pageCount;
+	UINT capacity;
+
+	bool Match(const PrintLayoutKey &other) const noexcept {
+		return pageCount != 0 && memcmp(&key, &other, sizeof(PrintLayoutKey)) == 0;
+	}
+	void AddPage(Sci_Position position) {
+		if (pageCount == capacity) {
+			capacity = max(2*capacity, 256U);
+			std::unique_ptr<Sci_Position[]> buffer = std::make_unique_for_overwrite<Sci_Position[]>(capacity);
+			if (pageCount != 0) {
+				memcpy(buffer.get(), pageStart.get(), pageCount*sizeof(Sci_Position));
+			}
+			pageStart = std::move(buffer);
+		}
+		pageStart[pageCount++] = position;
+	}
+};
+
+PrintPageCache printPageCache;
+
+// dispatch paint messages between pages to keep window responsive, Esc to cancel printing.
+// like EditWaitFileWorker(), other messages are kept in the queue to avoid re-entering.
+bool PrintCanceled() noexcept {
+	bool canceled = false;
+	MSG msg;
+	while (PeekMessage(&msg, nullptr, WM_KEYFIRST, WM_KEYLAST, PM_REMOVE | PM_QS_INPUT)) {
+		if (msg.message == WM_KEYDOWN && msg.wParam == VK_ESCAPE) {
+			canceled = true;
+		}
+	}
+	while (PeekMessage(&msg, nullptr, WM_PAINT, WM_PAINT, PM_REMOVE | PM_QS_PAINT)) {
+		DispatchMessage(&msg);
+	}
+	return canceled;
+}
+
+void PrintShowProgress(LPCWSTR tchPageStatus, UINT pageNum, int percent) noexcept {
+	WCHAR tchNum[32];
+	FormatNumber(tchNum, pageNum);
+	WCHAR statusString[128 + 16];
+	const int length = wsprintf(statusString, tchPageStatus, tchNum);
+	wsprintf(statusString + length, L" %d%%", percent);
+	StatusSetText(hwndStatus, STATUS_HELP, statusString);
+	UpdateWindow(hwndStatus);
+}
+
+// find start position for each page with layout only pass, returns false when canceled.
+bool PaginatePrintRange(Sci_RangeToFormatFull &frPrint, const PrintLayoutKey &key, LPCWSTR tchPageStatus) noexcept {
+	PrintPageCache &cache = printPageCache;
+	cache.pageCount = 0;
+	Sci_Position position = key.startPos;
+	try {
+		do {
+			cache.AddPage(position);
+			frPrint.chrg.cpMin = position;
+			frPrint.chrg.cpMax = key.endPos;
+			const Sci_Position next = SciCall_FormatRangeFull(false, &frPrint);
+			if (next <= position) {
+				break; // nothing fits on the page
+			}
+			position = next;
+			if ((cache.pageCount & 15) == 0) {
+				const int percent = static_cast<int>((position - key.startPos)*100/(key.endPos - key.startPos));
+				PrintShowProgress(tchPageStatus, cache.pageCount, percent);
+				if (PrintCanceled()) {
+					cache.pageCount = 0;
+					return false;
+				}
+			}
+		} while (position < key.endPos);
+	} catch (...) {
+		cache.pageCount = 0;
+		return false;
+	}
+	cache.key = key;
+	return true;
+}
+
+}
+
+void EditPrintInvalidatePages() noexcept {
+	printPageCache.pageCount = 0;
 }
 
 //=============================================================================
@@ -319,8 +420,6 @@ bool EditPrint(HWND hwnd, LPCWSTR pszDocTitle, BOOL bDefault) noexcept {
 	frPrint.rc.top		+= headerLineHeight + headerLineHeight / 2;
 	frPrint.rc.bottom	-= footerLineHeight + footerLineHeight / 2;
 
-	// Print each page
-	UINT pageNum = 1;
 	WCHAR tchPageFormat[128];
 	WCHAR tchPageStatus[128];
 	GetString(IDS_PRINT_PAGENUM, tchPageFormat, COUNTOF(tchPageFormat));
@@ -328,113 +427,123 @@ bool EditPrint(HWND hwnd, LPCWSTR pszDocTitle, BOOL bDefault) noexcept {
 
 	// Show wait cursor...
 	BeginWaitCursor();
+	StatusSetSimple(hwndStatus, TRUE);
+
+	// Paginate first, page breaks are reused while document and layout are unchanged
+	PrintLayoutKey key;
+	memset(&key, 0, sizeof(key));
+	key.docPointer = SciCall_GetDocPointer();
+	key.startPos = lengthPrinted;
+	key.endPos = lengthDoc;
+	key.rc = {frPrint.rc.left, frPrint.rc.top, frPrint.rc.right, frPrint.rc.bottom};
+	key.ptDpi = ptDpi;
+	key.zoom = iPrintZoom;
+	key.colorMode = iPrintColor;
+	key.tabWidth = SciCall_GetTabWidth();
+	key.lineNumberWidth = SciCall_GetMarginWidth(MarginNumber_LineNumber);
+	bool canceled = false;
+	if (!printPageCache.Match(key)) {
+		canceled = !PaginatePrintRange(frPrint, key, tchPageStatus);
+	}
 
-	bool printEmpty = lengthPrinted == lengthDoc;
-	while (lengthPrinted < lengthDoc || printEmpty) {
-		printEmpty = false;
-		const bool printPage = !(pdlg.Flags & PD_PAGENUMS) || (pageNum >= pdlg.nFromPage && pageNum <= pdlg.nToPage);
+	// Print each page
+	UINT pageFirst = 1;
+	UINT pageLast = printPageCache.pageCount;
+	if (pdlg.Flags & PD_PAGENUMS) {
+		pageFirst = pdlg.nFromPage;
+		pageLast = min<UINT>(pageLast, pdlg.nToPage);
+	}
+	for (UINT pageNum = pageFirst; pageNum <= pageLast && !canceled; pageNum++) {
 		WCHAR tchNum[32];
 		FormatNumber(tchNum, pageNum);
 		WCHAR pageString[128];
 		wsprintf(pageString, tchPageFormat, tchNum);
 
-		if (printPage) {
-			// Display current page number in Statusbar
-			WCHAR statusString[128];
-			wsprintf(statusString, tchPageStatus, tchNum);
-
-			StatusSetText(hwndStatus, STATUS_HELP, statusString);
-			StatusSetSimple(hwndStatus, TRUE);
+		// Display current page number in Statusbar
+		PrintShowProgress(tchPageStatus, pageNum, MulDiv(pageNum - pageFirst + 1, 100, pageLast - pageFirst + 1));
 
-			InvalidateRect(hwndStatus, nullptr, TRUE);
-			UpdateWindow(hwndStatus);
+		StartPage(hdc);
 
-			StartPage(hdc);
+		SetTextColor(hdc, RGB(0, 0, 0));
+		SetBkColor(hdc, RGB(255, 255, 255));
+		SelectFont(hdc, fontHeader);
+		const UINT ta = SetTextAlign(hdc, TA_BOTTOM);
+		RECT rcw = {
+			frPrint.rc.left, frPrint.rc.top - headerLineHeight - headerLineHeight / 2,
+			frPrint.rc.right, frPrint.rc.top - headerLineHeight / 2
+		};
 
-			SetTextColor(hdc, RGB(0, 0, 0));
-			SetBkColor(hdc, RGB(255, 255, 255));
-			SelectFont(hdc, fontHeader);
-			const UINT ta = SetTextAlign(hdc, TA_BOTTOM);
-			RECT rcw = {
-				frPrint.rc.left, frPrint.rc.top - headerLineHeight - headerLineHeight / 2,
-				frPrint.rc.right, frPrint.rc.top - headerLineHeight / 2
-			};
-
-			if (iPrintHeader != PrintHeaderOption_LeaveBlank) {
-				ExtTextOut(hdc, rcw.left + 5, rcw.bottom,
-						   ETO_OPAQUE, &rcw, pszDocTitle,
-						   lstrlen(pszDocTitle), nullptr);
-			}
+		if (iPrintHeader != PrintHeaderOption_LeaveBlank) {
+			ExtTextOut(hdc, rcw.left + 5, rcw.bottom,
+					   ETO_OPAQUE, &rcw, pszDocTitle,
+					   lstrlen(pszDocTitle), nullptr);
+		}
 
-			// Print date in header
-			if (iPrintHeader == PrintHeaderOption_FilenameAndDateTime || iPrintHeader == PrintHeaderOption_FilenameAndDate) {
-				SIZE sizeInfo;
-				const int len = lstrlen(dateString);
-				SelectFont(hdc, fontFooter);
-				GetTextExtentPoint32(hdc, dateString, len, &sizeInfo);
-				rcw.left = frPrint.rc.right - 10 - sizeInfo.cx;
-				ExtTextOut(hdc, rcw.left + 5, rcw.bottom,
-						   ETO_OPAQUE, &rcw, dateString,
-						   len, nullptr);
-			}
+		// Print date in header
+		if (iPrintHeader == PrintHeaderOption_FilenameAndDateTime || iPrintHeader == PrintHeaderOption_FilenameAndDate) {
+			SIZE sizeInfo;
+			const int len = lstrlen(dateString);
+			SelectFont(hdc, fontFooter);
+			GetTextExtentPoint32(hdc, dateString, len, &sizeInfo);
+			rcw.left = frPrint.rc.right - 10 - sizeInfo.cx;
+			ExtTextOut(hdc, rcw.left + 5, rcw.bottom,
+					   ETO_OPAQUE, &rcw, dateString,
+					   len, nullptr);
+		}
 
-			SetTextAlign(hdc, ta);
-			if (iPrintHeader != PrintHeaderOption_LeaveBlank) {
-				HPEN pen = CreatePen(0, 1, RGB(0, 0, 0));
-				HPEN penOld = SelectPen(hdc, pen);
-				MoveToEx(hdc, frPrint.rc.left, frPrint.rc.top - headerLineHeight / 4, nullptr);
-				LineTo(hdc, frPrint.rc.right, frPrint.rc.top - headerLineHeight / 4);
-				SelectPen(hdc, penOld);
-				DeleteObject(pen);
-			}
+		SetTextAlign(hdc, ta);
+		if (iPrintHeader != PrintHeaderOption_LeaveBlank) {
+			HPEN pen = CreatePen(0, 1, RGB(0, 0, 0));
+			HPEN penOld = SelectPen(hdc, pen);
+			MoveToEx(hdc, frPrint.rc.left, frPrint.rc.top - headerLineHeight / 4, nullptr);
+			LineTo(hdc, frPrint.rc.right, frPrint.rc.top - headerLineHeight / 4);
+			SelectPen(hdc, penOld);
+			DeleteObject(pen);
 		}
 
-		frPrint.chrg.cpMin = lengthPrinted;
+		frPrint.chrg.cpMin = printPageCache.pageStart[pageNum - 1];
 		frPrint.chrg.cpMax = lengthDoc;
+		SciCall_FormatRangeFull(true, &frPrint);
 
-		lengthPrinted = SciCall_FormatRangeFull(printPage, &frPrint);
-
-		if (printPage) {
-			SetTextColor(hdc, RGB(0, 0, 0));
-			SetBkColor(hdc, RGB(255, 255, 255));
-
-			if (iPrintFooter == PrintFooterOption_PageNumber) {
-				SelectFont(hdc, fontFooter);
-				const UINT ta = SetTextAlign(hdc, TA_TOP);
-				const RECT rcw = {
-					frPrint.rc.left, frPrint.rc.bottom + footerLineHeight / 2,
-					frPrint.rc.right, frPrint.rc.bottom + footerLineHeight + footerLineHeight / 2
-				};
-
-				SIZE sizeFooter;
-				const int len = lstrlen(pageString);
-				GetTextExtentPoint32(hdc, pageString, len, &sizeFooter);
-				ExtTextOut(hdc, rcw.right - 5 - sizeFooter.cx, rcw.top,
-						   ETO_OPAQUE, &rcw, pageString,
-						   len, nullptr);
-
-				SetTextAlign(hdc, ta);
-				HPEN pen = ::CreatePen(0, 1, RGB(0, 0, 0));
-				HPEN penOld = SelectPen(hdc, pen);
-				SetBkColor(hdc, RGB(0, 0, 0));
-				MoveToEx(hdc, frPrint.rc.left, frPrint.rc.bottom + footerLineHeight / 4, nullptr);
-				LineTo(hdc, frPrint.rc.right, frPrint.rc.bottom + footerLineHeight / 4);
-				SelectPen(hdc, penOld);
-				DeleteObject(pen);
-			}
+		SetTextColor(hdc, RGB(0, 0, 0));
+		SetBkColor(hdc, RGB(255, 255, 255));
 
-			EndPage(hdc);
-		}
-		pageNum++;
+		if (iPrintFooter == PrintFooterOption_PageNumber) {
+			SelectFont(hdc, fontFooter);
+			const UINT ta = SetTextAlign(hdc, TA_TOP);
+			const RECT rcw = {
+				frPrint.rc.left, frPrint.rc.bottom + footerLineHeight / 2,
+				frPrint.rc.right, frPrint.rc.bottom + footerLineHeight + footerLineHeight / 2
+			};
 
-		if ((pdlg.Flags & PD_PAGENUMS) && (pageNum > pdlg.nToPage)) {
-			break;
+			SIZE sizeFooter;
+			const int len = lstrlen(pageString);
+			GetTextExtentPoint32(hdc, pageString, len, &sizeFooter);
+			ExtTextOut(hdc, rcw.right - 5 - sizeFooter.cx, rcw.top,
+					   ETO_OPAQUE, &rcw, pageString,
+					   len, nullptr);
+
+			SetTextAlign(hdc, ta);
+			HPEN pen = ::CreatePen(0, 1, RGB(0, 0, 0));
+			HPEN penOld = SelectPen(hdc, pen);
+			SetBkColor(hdc, RGB(0, 0, 0));
+			MoveToEx(hdc, frPrint.rc.left, frPrint.rc.bottom + footerLineHeight / 4, nullptr);
+			LineTo(hdc, frPrint.rc.right, frPrint.rc.bottom + footerLineHeight / 4);
+			SelectPen(hdc, penOld);
+			DeleteObject(pen);
 		}
+
+		EndPage(hdc);
+		canceled = PrintCanceled();
 	}
 
 	SciCall_FormatRangeFull(false, nullptr);
 
-	EndDoc(hdc);
+	if (canceled) {
+		AbortDoc(hdc);
+	} else {
+		EndDoc(hdc);
+	}
 	DeleteDC(hdc);
 	if (fontHeader) {
 		DeleteObject(fontHeader);
@@ -577,7 +686,7 @@ void EditPrintSetup(HWND hwnd) noexcept {
 	NP2HeapFree(pDlgTemplate);
 }
 
-namespace { // copy as RTF
+namespace { // copy as RTF and HTML
 
 struct DocumentStyledText {
 	std::unique_ptr<StyleDefinition[]> styleList;
@@ -585,6 +694,118 @@ struct DocumentStyledText {
 	UINT cpEdit;
 };
 
+// clipboard data written incrementally into movable global memory
+class GlobalOutput {
+	HGLOBAL handle = nullptr;
+	char *data = nullptr;
+	size_t length = 0;
+	size_t capacity = 0;
+
+	void Grow(size_t needed) {
+		const size_t newCapacity = max(max<size_t>(2*capacity, 64*1024), needed);
+		HGLOBAL newHandle;
+		if (handle) {
+			::GlobalUnlock(handle);
+			newHandle = ::GlobalReAlloc(handle, newCapacity, GMEM_MOVEABLE);
+		} else {
+			newHandle = ::GlobalAlloc(GMEM_MOVEABLE, newCapacity);
+		}
+		if (newHandle) {
+			handle = newHandle;
+			capacity = newCapacity;
+		}
+		data = handle ? static_cast<char *>(::GlobalLock(handle)) : nullptr;
+		if (newHandle == nullptr || data == nullptr) {
+			throw std::bad_alloc();
+		}
+	}
+
+public:
+	GlobalOutput() noexcept = default;
+	GlobalOutput(const GlobalOutput &) = delete;
+	GlobalOutput &operator=(const GlobalOutput &) = delete;
+	~GlobalOutput() {
+		if (handle) {
+			if (data) {
+				::GlobalUnlock(handle);
+			}
+			::GlobalFree(handle);
+		}
+	}
+
+	size_t Length() const noexcept {
+		return length;
+	}
+	char *Data() const noexcept {
+		return data;
+	}
+	GlobalOutput &operator+=(std::string_view sv) {
+		if (length + sv.length() > capacity) {
+			Grow(length + sv.length());
+		}
+		memcpy(data + length, sv.data(), sv.length());
+		length += sv.length();
+		return *this;
+	}
+	GlobalOutput &operator+=(char ch) {
+		if (length == capacity) {
+			Grow(length + 1);
+		}
+		data[length++] = ch;
+		return *this;
+	}
+	// append NUL and release ownership of the memory handle
+	HGLOBAL Detach() {
+		*this += '\0';
+		::GlobalUnlock(handle);
+		HGLOBAL result = ::GlobalReAlloc(handle, length, GMEM_MOVEABLE);
+		if (result == nullptr) {
+			result = handle;
+		}
+		handle = nullptr;
+		data = nullptr;
+		length = 0;
+		capacity = 0;
+		return result;
+	}
+};
+
+// read text and styles block by block instead of copying whole range.
+// block never ends inside a character or between CR and LF,
+// so character after current block is NUL.
+class StyledTextReader {
+	static constexpr Sci_Position blockSize = 64*1024;
+	const std::unique_ptr<char[]> buffer;
+	const Sci_Position endPos;
+public:
+	Sci_Position position;
+	size_t length = 0;
+	const char *styles = nullptr;
+	const char *text = nullptr;
+
+	StyledTextReader(Sci_Position startPos, Sci_Position endPos_):
+		buffer{std::make_unique_for_overwrite<char[]>(2*blockSize + 2)},
+		endPos{endPos_},
+		position{startPos} {}
+	bool Next() noexcept {
+		position += length;
+		if (position >= endPos) {
+			return false;
+		}
+		Sci_Position end = position + blockSize;
+		if (end >= endPos) {
+			end = endPos;
+		} else {
+			end = SciCall_PositionBefore(end + 1);
+		}
+		const Sci_TextRangeFull tr { { position, end }, buffer.get() };
+		length = SciCall_GetStyledTextFull(&tr);
+		styles = buffer.get();
+		text = styles + length + 1;
+		return true;
+	}
+};
+
 void GetStyleDefinitionFor(int style, StyleDefinition &definition) noexcept {
 	definition.fontSize = SciCall_StyleGetSizeFractional(style);
 	definition.foreColor = SciCall_StyleGetFore(style);
@@ -598,15 +819,18 @@ void GetStyleDefinitionFor(int style, StyleDefinition &definition) noexcept {
 	SciCall_StyleGetFont(style, definition.fontFace);
 }
 
-DocumentStyledText GetDocumentStyledText(uint8_t (&styleMap)[STYLE_MAX + 1], const char *styledText, size_t textLength) noexcept {
+DocumentStyledText GetDocumentStyledText(uint8_t (&styleMap)[STYLE_MAX + 1], Sci_Position startPos, Sci_Position endPos) {
 	uint32_t styleUsed[8]{}; // bitmap for styles used in the range
 	styleUsed[STYLE_DEFAULT >> 5] |= (1U << (STYLE_DEFAULT & 31));
 	unsigned maxStyle = STYLE_DEFAULT;
 
-	for (size_t offset = 0; offset < textLength; offset++) {
-		const uint8_t style = styledText[offset];
-		styleUsed[style >> 5] |= (1U << (style & 31));
-		maxStyle = max<unsigned>(style, maxStyle);
+	StyledTextReader reader(startPos, endPos);
+	while (reader.Next()) {
+		for (size_t offset = 0; offset < reader.length; offset++) {
+			const uint8_t style = reader.styles[offset];
+			styleUsed[style >> 5] |= (1U << (style & 31));
+			maxStyle = max<unsigned>(style, maxStyle);
+		}
 	}
 
 	++maxStyle;
@@ -688,6 +912,7 @@ DocumentStyledText GetDocumentStyledText(uint8_t (&styleMap)[STYLE_MAX + 1], con
 #ifndef CF_RTF
 #define CF_RTF TEXT("Rich Text Format")
 #endif
+#define CF_HTML TEXT("HTML Format")
 
 // extract the next RTF control word from *style
 void GetRTFNextControl(const char **style, char *control) noexcept {
@@ -732,10 +957,35 @@ constexpr int GetRTFFontSize(int size) noexcept {
 	return size / (SC_FONT_SIZE_MULTIPLIER / 2);
 }
 
-void SaveToStreamRTF(std::string &os, const char *styledText, size_t textLength, Sci_Position startPos, Sci_Position endPos) {
-	uint8_t styleMap[STYLE_MAX + 1];
-	const auto [styleList, styleCount, cpEdit] = GetDocumentStyledText(styleMap, styledText, textLength);
-	const std::unique_ptr<std::string[]> styles = std::make_unique_for_overwrite<std::string[]>(styleCount);
+// style change deltas cached for each (last, current) pair, last == styleCount for paragraph start.
+class RTFStyleChangeCache {
+	const std::unique_ptr<std::string[]> styles;
+	const std::unique_ptr<std::string[]> deltas;
+	const std::unique_ptr<bool[]> computed;
+	const unsigned styleCount;
+public:
+	explicit RTFStyleChangeCache(unsigned styleCount_):
+		styles{std::make_unique<std::string[]>(styleCount_)},
+		deltas{std::make_unique<std::string[]>((styleCount_ + 1)*styleCount_)},
+		computed{std::make_unique<bool[]>((styleCount_ + 1)*styleCount_)},
+		styleCount{styleCount_} {}
+	std::string &Style(unsigned style) const noexcept {
+		return styles[style];
+	}
+	const std::string &Delta(unsigned last, unsigned current) const {
+		const size_t index = (last*styleCount) + current;
+		std::string &delta = deltas[index];
+		if (!computed[index]) {
+			computed[index] = true;
+			GetRTFStyleChange(delta, (last == styleCount) ? "" : styles[last].c_str(), styles[current].c_str());
+		}
+		return delta;
+	}
+};
+
+void SaveToStreamRTF(GlobalOutput &os, const DocumentStyledText &data, const uint8_t (&styleMap)[STYLE_MAX + 1], Sci_Position startPos, Sci_Position endPos) {
+	const auto &[styleList, styleCount, cpEdit] = data;
+	RTFStyleChangeCache styles(styleCount);
 	const std::unique_ptr<LPCSTR[]> fontList = std::make_unique_for_overwrite<LPCSTR[]>(styleCount);
 	const std::unique_ptr<COLORREF[]> colorList = std::make_unique_for_overwrite<COLORREF[]>(2*styleCount);
 
@@ -801,12 +1051,12 @@ void SaveToStreamRTF(std::string &os, const char *styledText, size_t textLength,
 		fmtlen = sprintf(fmtbuf, RTF_SETFONTFACE "%d" RTF_SETFONTSIZE "%d" RTF_SETCOLOR "%d",
 			iFont, GetRTFFontSize(definition.fontSize), iFore + 1);
 
-		std::string osStyle(fmtbuf, fmtlen);
+		std::string &osStyle = styles.Style(styleIndex);
+		osStyle.assign(fmtbuf, fmtlen);
 		osStyle += ((definition.weight >= FW_SEMIBOLD) ? RTF_BOLD_ON : RTF_BOLD_OFF);
 		osStyle += (definition.italic ? RTF_ITALIC_ON : RTF_ITALIC_OFF);
 		osStyle += (definition.underline ? RTF_UNDERLINE_ON : RTF_UNDERLINE_OFF);
 		osStyle += (definition.strike ? RTF_STRIKE_ON : RTF_STRIKE_OFF);
-		styles[styleIndex] = std::move(osStyle);
 	}
 
 	os += RTF_FONTDEFCLOSE RTF_COLORDEFOPEN;
@@ -818,7 +1068,7 @@ void SaveToStreamRTF(std::string &os, const char *styledText, size_t textLength,
 	}
 	os += RTF_COLORDEFCLOSE RTF_HEADERCLOSE RTF_BODYOPEN;
 
-	const char *lastStyle = "";
+	unsigned lastStyle = styleCount;
 	unsigned styleCurrent = STYLE_MAX + 1;
 	unsigned column = 0;
 	// check eolFilled on first line
@@ -830,8 +1080,7 @@ void SaveToStreamRTF(std::string &os, const char *styledText, size_t textLength,
 		const Sci_Line line = SciCall_LineFromPosition(startPos);
 		const Sci_Position pos = SciCall_PositionFromLine(line + 1);
 		if (pos < endPos) {
-			uint8_t eolStyle = styledText[2*(pos - startPos) - 1];
-			eolStyle = styleMap[eolStyle];
+			const uint8_t eolStyle = styleMap[SciCall_GetStyleIndexAt(pos - 1)];
 			eolFilled = styleList[eolStyle].eolFilled;
 			if (eolFilled) {
 				background = styleList[eolStyle].backIndex;
@@ -841,98 +1090,288 @@ void SaveToStreamRTF(std::string &os, const char *styledText, size_t textLength,
 		os += std::string_view{fmtbuf, fmtlen};
 	}
 
-	const char * const textBuffer = styledText + textLength + 1;
-	for (size_t offset = 0; offset < textLength; offset++) {
-		uint8_t style = styledText[offset];
-		style = styleMap[style];
-		if (style != styleCurrent) {
-			styleCurrent = style;
-			const char * const currentStyle = styles[style].c_str();
-			GetRTFStyleChange(os, lastStyle, currentStyle);
-			lastStyle = currentStyle;
-			// detect background color change
-			unsigned backIndex = styleList[style].backIndex;
-			backIndex = (backIndex == background)? 0 : backIndex;
-			if (backIndex != highlight) {
-				highlight = backIndex;
-				fmtlen = sprintf(fmtbuf, RTF_SETBACKGROUND "%u ", backIndex);
-				os += std::string_view{fmtbuf, fmtlen};
+	StyledTextReader reader(startPos, endPos);
+	while (reader.Next()) {
+		const char * const styledText = reader.styles;
+		const char * const textBuffer = reader.text;
+		const size_t textLength = reader.length;
+		for (size_t offset = 0; offset < textLength; offset++) {
+			uint8_t style = styledText[offset];
+			style = styleMap[style];
+			if (style != styleCurrent) {
+				styleCurrent = style;
+				os += styles.Delta(lastStyle, style);
+				lastStyle = style;
+				// detect background color change
+				unsigned backIndex = styleList[style].backIndex;
+				backIndex = (backIndex == background)? 0 : backIndex;
+				if (backIndex != highlight) {
+					highlight = backIndex;
+					fmtlen = sprintf(fmtbuf, RTF_SETBACKGROUND "%u ", backIndex);
+					os += std::string_view{fmtbuf, fmtlen};
+				}
 			}
-		}
 
-		const char ch = textBuffer[offset];
-		std::string_view sv;
-		column++;
-		if (ch == '\t') {
-			if (!fvCurFile.bTabsAsSpaces) {
-				sv = RTF_TAB;
-			} else {
-				const unsigned tabWidth = fvCurFile.iTabWidth;
-				const unsigned padding = tabWidth - ((column - 1) % tabWidth);
-				column += padding;
-				for (unsigned itab = 0; itab < padding; itab++) {
-					os += ' ';
+			const char ch = textBuffer[offset];
+			std::string_view sv;
+			column++;
+			if (ch == '\t') {
+				if (!fvCurFile.bTabsAsSpaces) {
+					sv = RTF_TAB;
+				} else {
+					const unsigned tabWidth = fvCurFile.iTabWidth;
+					const unsigned padding = tabWidth - ((column - 1) % tabWidth);
+					column += padding;
+					for (unsigned itab = 0; itab < padding; itab++) {
+						os += ' ';
+					}
 				}
-			}
-		} else if (ch == '\r' || ch == '\n') {
-			sv = RTF_EOL;
-			column = 0;
-			if (ch == '\r' && textBuffer[offset + 1] == '\n') {
-				offset += 1;
-			}
-			// check eolFilled on next line
-			const Sci_Line line = SciCall_LineFromPosition(startPos + offset);
-			const Sci_Position pos = SciCall_PositionFromLine(line + 2);
-			if (pos < endPos) {
-				uint8_t eolStyle = styledText[2*(pos - startPos) - 1];
-				eolStyle = styleMap[eolStyle];
-				bool changed = styleList[eolStyle].eolFilled;
-				if (changed) {
-					eolFilled = true;
-					const unsigned backIndex = styleList[eolStyle].backIndex;
-					changed = backIndex != background;
-					background = backIndex;
-				} else if (eolFilled) {
-					changed = true;
-					eolFilled = false;
-					background = defaultBackground;
+			} else if (ch == '\r' || ch == '\n') {
+				sv = RTF_EOL;
+				column = 0;
+				if (ch == '\r' && textBuffer[offset + 1] == '\n') {
+					offset += 1;
 				}
-				if (changed) {
-					lastStyle = "";
-					styleCurrent = STYLE_MAX + 1;
-					highlight = 0;
-					fmtlen = sprintf(fmtbuf, RTF_PARAGRAPH_END RTF_PARAGRAPH_BEGIN, background);
-					sv = {fmtbuf, fmtlen};
+				// check eolFilled on next line
+				const Sci_Line line = SciCall_LineFromPosition(reader.position + offset);
+				const Sci_Position pos = SciCall_PositionFromLine(line + 2);
+				if (pos < endPos) {
+					const uint8_t eolStyle = styleMap[SciCall_GetStyleIndexAt(pos - 1)];
+					bool changed = styleList[eolStyle].eolFilled;
+					if (changed) {
+						eolFilled = true;
+						const unsigned backIndex = styleList[eolStyle].backIndex;
+						changed = backIndex != background;
+						background = backIndex;
+					} else if (eolFilled) {
+						changed = true;
+						eolFilled = false;
+						background = defaultBackground;
+					}
+					if (changed) {
+						lastStyle = styleCount;
+						styleCurrent = STYLE_MAX + 1;
+						highlight = 0;
+						fmtlen = sprintf(fmtbuf, RTF_PARAGRAPH_END RTF_PARAGRAPH_BEGIN, background);
+						sv = {fmtbuf, fmtlen};
+					}
+				}
+			} else if (static_cast<signed char>(ch) < 0 && cpEdit == SC_CP_UTF8) {
+				const Sci_Position pos = reader.position + offset;
+				Sci_Position width = 0;
+				const unsigned int u32 = SciCall_GetCharacterAndWidth(pos, &width);
+				offset += width - 1;
+				if (u32 < 0x10000) {
+					fmtlen = sprintf(fmtbuf, "\\u%d?", static_cast<short>(u32));
+				} else {
+					fmtlen = sprintf(fmtbuf, "\\u%d?\\u%d?",
+						static_cast<short>(((u32 - 0x10000) >> 10) + 0xD800),
+						static_cast<short>((u32 & 0x3ff) + 0xDC00));
 				}
+				sv = {fmtbuf, fmtlen};
 			}
-		} else if (static_cast<signed char>(ch) < 0 && cpEdit == SC_CP_UTF8) {
-			const Sci_Position pos = startPos + offset;
-			Sci_Position width = 0;
-			const unsigned int u32 = SciCall_GetCharacterAndWidth(pos, &width);
-			offset += width - 1;
-			if (u32 < 0x10000) {
-				fmtlen = sprintf(fmtbuf, "\\u%d?", static_cast<short>(u32));
+
+			if (sv.empty()) {
+				if (ch != '\t') {
+					if (ch == '{' || ch == '}' || ch == '\\') {
+						os += '\\';
+					}
+					os += ch;
+				}
 			} else {
-				fmtlen = sprintf(fmtbuf, "\\u%d?\\u%d?",
-					static_cast<short>(((u32 - 0x10000) >> 10) + 0xD800),
-					static_cast<short>((u32 & 0x3ff) + 0xDC00));
+				os += sv;
 			}
-			sv = {fmtbuf, fmtlen};
 		}
+	}
 
-		if (sv.empty()) {
-			if (ch != '\t') {
-				if (ch == '{' || ch == '}' || ch == '\\') {
-					os += '\\';
+	os += RTF_PARAGRAPH_END RTF_BODYCLOSE;
+}
+
+// HTML Clipboard Format
+// https://learn.microsoft.com/en-us/windows/win32/dataxchg/html-clipboard-format
+#define HTML_HEADER \
+	"Version:0.9\r\n" \
+	"StartHTML:0000000000\r\n" \
+	"EndHTML:0000000000\r\n" \
+	"StartFragment:0000000000\r\n" \
+	"EndFragment:0000000000\r\n"
+#define HTML_BODYOPEN "<html>\r\n<body>\r\n<!--StartFragment-->"
+#define HTML_BODYCLOSE "<!--EndFragment-->\r\n</body>\r\n</html>\r\n"
+
+inline void SetHTMLHeaderOffset(char *header, const char *name, size_t offset) noexcept {
+	char digits[16];
+	sprintf(digits, "%010u", static_cast<unsigned>(offset));
+	memcpy(strstr(header, name) + strlen(name), digits, 10);
+}
+
+void GetHTMLStyle(std::string &css, const StyleDefinition &definition, const StyleDefinition *base) {
+	char fmtbuf[LF_FACESIZE * kMaxMultiByteCount + 32];
+	if (base == nullptr || strcmp(definition.fontFace, base->fontFace) != 0) {
+		const unsigned fmtlen = sprintf(fmtbuf, "font-family:'%s';", definition.fontFace);
+		css.append(fmtbuf, fmtlen);
+	}
+	if (base == nullptr || definition.fontSize != base->fontSize) {
+		const unsigned fmtlen = sprintf(fmtbuf, "font-size:%.2fpt;", definition.fontSize/static_cast<double>(SC_FONT_SIZE_MULTIPLIER));
+		css.append(fmtbuf, fmtlen);
+	}
+	if (base == nullptr || definition.foreColor != base->foreColor) {
+		const COLORREF color = definition.foreColor;
+		const unsigned fmtlen = sprintf(fmtbuf, "color:#%02x%02x%02x;",
+			static_cast<int>(color & 0xff), static_cast<int>((color >> 8) & 0xff), static_cast<int>((color >> 16) & 0xff));
+		css.append(fmtbuf, fmtlen);
+	}
+	if (base == nullptr || definition.backColor != base->backColor) {
+		const COLORREF color = definition.backColor;
+		const unsigned fmtlen = sprintf(fmtbuf, "background:#%02x%02x%02x;",
+			static_cast<int>(color & 0xff), static_cast<int>((color >> 8) & 0xff), static_cast<int>((color >> 16) & 0xff));
+		css.append(fmtbuf, fmtlen);
+	}
+	if (base == nullptr || definition.weight != base->weight) {
+		const unsigned fmtlen = sprintf(fmtbuf, "font-weight:%d;", definition.weight);
+		css.append(fmtbuf, fmtlen);
+	}
+	if (base == nullptr || definition.italic != base->italic) {
+		css += definition.italic ? "font-style:italic;" : "font-style:normal;";
+	}
+	if (base == nullptr || definition.underline != base->underline || definition.strike != base->strike) {
+		css += "text-decoration:";
+		if (definition.underline) {
+			css += " underline";
+		}
+		if (definition.strike) {
+			css += " line-through";
+		}
+		if (!definition.underline && !definition.strike) {
+			css += "none";
+		}
+		css += ';';
+	}
+}
+
+// escape HTML special characters in UTF-8 text, EOL is written as LF
+void EscapeHTML(GlobalOutput &os, const char *text, size_t length) {
+	const char * const end = text + length;
+	const char *start = text;
+	while (text < end) {
+		std::string_view sv;
+		const char ch = *text;
+		switch (ch) {
+		case '&':
+			sv = "&amp;";
+			break;
+		case '<':
+			sv = "&lt;";
+			break;
+		case '>':
+			sv = "&gt;";
+			break;
+		case '\r':
+			sv = (text + 1 < end && text[1] == '\n') ? "" : "\n";
+			break;
+		default:
+			++text;
+			continue;
+		}
+		os += std::string_view{start, static_cast<size_t>(text - start)};
+		os += sv;
+		++text;
+		start = text;
+	}
+	os += std::string_view{start, static_cast<size_t>(end - start)};
+}
+
+void SaveToStreamHTML(GlobalOutput &os, const DocumentStyledText &data, const uint8_t (&styleMap)[STYLE_MAX + 1], Sci_Position startPos, Sci_Position endPos) {
+	const auto &[styleList, styleCount, cpEdit] = data;
+	const std::unique_ptr<std::string[]> spans = std::make_unique<std::string[]>(styleCount);
+	for (unsigned styleIndex = 1; styleIndex < styleCount; styleIndex++) {
+		std::string css;
+		GetHTMLStyle(css, styleList[styleIndex], &styleList[0]);
+		if (!css.empty()) {
+			spans[styleIndex] = "<span style=\"" + css + "\">";
+		}
+	}
+
+	os += HTML_HEADER;
+	const size_t startHTML = os.Length();
+	os += HTML_BODYOPEN;
+	const size_t startFragment = os.Length();
+	{
+		std::string css;
+		GetHTMLStyle(css, styleList[0], nullptr);
+		char fmtbuf[32];
+		const unsigned fmtlen = sprintf(fmtbuf, "tab-size:%d;", fvCurFile.iTabWidth);
+		css.append(fmtbuf, fmtlen);
+		os += "<pre style=\"";
+		os += css;
+		os += "\">";
+	}
+
+	std::string utf8Text;
+	std::unique_ptr<WCHAR[]> wchText;
+	size_t wchLength = 0;
+	StyledTextReader reader(startPos, endPos);
+	while (reader.Next()) {
+		size_t offset = 0;
+		while (offset < reader.length) {
+			const uint8_t style = styleMap[static_cast<uint8_t>(reader.styles[offset])];
+			const size_t runStart = offset;
+			do {
+				++offset;
+			} while (offset < reader.length && styleMap[static_cast<uint8_t>(reader.styles[offset])] == style);
+
+			const std::string &span = spans[style];
+			os += span;
+			const char *text = reader.text + runStart;
+			size_t length = offset - runStart;
+			if (cpEdit != SC_CP_UTF8) {
+				if (wchLength < length) {
+					wchLength = max(length, 2*wchLength);
+					wchText = std::make_unique_for_overwrite<WCHAR[]>(wchLength);
 				}
-				os += ch;
+				const int wlen = MultiByteToWideChar(cpEdit, 0, text, static_cast<int>(length), wchText.get(), static_cast<int>(wchLength));
+				utf8Text.resize(wlen * kMaxMultiByteCount);
+				length = WideCharToMultiByte(CP_UTF8, 0, wchText.get(), wlen, utf8Text.data(), static_cast<int>(utf8Text.size()), nullptr, nullptr);
+				text = utf8Text.data();
+			}
+			EscapeHTML(os, text, length);
+			if (!span.empty()) {
+				os += "</span>";
 			}
-		} else {
-			os += sv;
 		}
 	}
 
-	os += RTF_PARAGRAPH_END RTF_BODYCLOSE;
+	os += "</pre>";
+	const size_t endFragment = os.Length();
+	os += HTML_BODYCLOSE;
+	const size_t endHTML = os.Length();
+
+	char * const header = os.Data();
+	SetHTMLHeaderOffset(header, "StartHTML:", startHTML);
+	SetHTMLHeaderOffset(header, "EndHTML:", endHTML);
+	SetHTMLHeaderOffset(header, "StartFragment:", startFragment);
+	SetHTMLHeaderOffset(header, "EndFragment:", endFragment);
+}
+
+// put both RTF and HTML on clipboard, code from SciTEWin::CopyAsRTF()
+void CopyStyledText(Sci_Position startPos, Sci_Position endPos) {
+	uint8_t styleMap[STYLE_MAX + 1];
+	const DocumentStyledText data = GetDocumentStyledText(styleMap, startPos, endPos);
+	GlobalOutput rtf;
+	SaveToStreamRTF(rtf, data, styleMap, startPos, endPos);
+	GlobalOutput html;
+	SaveToStreamHTML(html, data, styleMap, startPos, endPos);
+
+	HGLOBAL hRTF = rtf.Detach();
+	HGLOBAL hHTML = html.Detach();
+	if (::OpenClipboard(hwndMain)) {
+		::EmptyClipboard();
+		::SetClipboardData(::RegisterClipboardFormat(CF_RTF), hRTF);
+		::SetClipboardData(::RegisterClipboardFormat(CF_HTML), hHTML);
+		::CloseClipboard();
+	} else {
+		::GlobalFree(hRTF);
+		::GlobalFree(hHTML);
+	}
 }
 
 }
@@ -980,10 +1419,52 @@ int AddStyleSeparator(LPCEDITLEXER pLex, int ch, int chPrev, int style) noexcept
 	return SpaceOption_None;
 }
 
+// length of style run starting at offset, the run ends at style change or line end.
+size_t GetStyleRunLength(const char *styledText, const char *textBuffer, size_t offset, size_t textLength, uint8_t style) noexcept {
+	size_t index = offset;
+#if NP2_USE_AVX2
+	const __m256i vectStyle = _mm256_set1_epi8(style);
+	const __m256i vectCR = _mm256_set1_epi8('\r');
+	const __m256i vectLF = _mm256_set1_epi8('\n');
+	while (index + sizeof(__m256i) <= textLength) {
+		const __m256i styles = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(styledText + index));
+		const __m256i chars = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(textBuffer + index));
+		const uint32_t mask = mm256_movemask_epi8(_mm256_or_si256(_mm256_cmpeq_epi8(chars, vectCR), _mm256_cmpeq_epi8(chars, vectLF)))
+			| ~mm256_movemask_epi8(_mm256_cmpeq_epi8(styles, vectStyle));
+		if (mask) {
+			return index + np2_ctz(mask) - offset;
+		}
+		index += sizeof(__m256i);
+	}
+	// end NP2_USE_AVX2
+#elif NP2_USE_SSE2
+	const __m128i vectStyle = _mm_set1_epi8(style);
+	const __m128i vectCR = _mm_set1_epi8('\r');
+	const __m128i vectLF = _mm_set1_epi8('\n');
+	while (index + sizeof(__m128i) <= textLength) {
+		const __m128i styles = _mm_loadu_si128(reinterpret_cast<const __m128i *>(styledText + index));
+		const __m128i chars = _mm_loadu_si128(reinterpret_cast<const __m128i *>(textBuffer + index));
+		const uint32_t mask = mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(chars, vectCR), _mm_cmpeq_epi8(chars, vectLF)))
+			| (mm_movemask_epi8(_mm_cmpeq_epi8(styles, vectStyle)) ^ 0xffff);
+		if (mask) {
+			return index + np2_ctz(mask) - offset;
+		}
+		index += sizeof(__m128i);
+	}
+	// end NP2_USE_SSE2
+#endif
+	while (index < textLength && static_cast<uint8_t>(styledText[index]) == style
+		&& textBuffer[index] != '\r' && textBuffer[index] != '\n') {
+		index++;
+	}
+	return index - offset;
+}
+
 void CodePretty(std::string &output, LPCEDITLEXER pLex, const char *styledText, size_t textLength) {
 	char fmtbuf[128];
 	std::string braceStack(1, '\0'); // sentinel
 	memset(fmtbuf, 0, 4);
+	output.reserve(textLength + textLength/2);
 
 	unsigned fmtlen = 0;
 	uint32_t blockLevel = 0;
@@ -1020,6 +1501,28 @@ void CodePretty(std::string &output, LPCEDITLEXER pLex, const char *styledText,
 			styleBefore = 0;
 			continue;
 		}
+		if (style == styleBefore && chPrev != '\n' && style > pLex->commentStyleMarker
+			&& style != pLex->operatorStyle && style != pLex->operatorStyle2) {
+			// no separator or indentation inside the run, copy it until line end
+			const size_t length = GetStyleRunLength(styledText, textBuffer, offset, textLength, style);
+			if (length != 0) {
+				const char * const run = textBuffer + offset;
+				output += std::string_view{fmtbuf, fmtlen};
+				output += std::string_view{run, length - 1};
+				for (size_t index = length; index != 0; index--) {
+					if (static_cast<uint8_t>(run[index - 1]) > ' ') {
+						chPrevNonWhite = run[index - 1];
+						break;
+					}
+				}
+				chPrev = run[length - 1];
+				fmtbuf[0] = static_cast<char>(chPrev);
+				fmtlen = 1;
+				offset += length - 1;
+				stylePrev = style;
+				continue;
+			}
+		}
 
 		int spaceOption = SpaceOption_None;
 		unsigned operatorLen = 0;
@@ -1299,6 +1802,11 @@ void EditFormatCode(int menu) noexcept {
 
 	try {
 		SciCall_EnsureStyledTo(endPos);
+		if (menu == IDM_EDIT_COPYRTF) {
+			CopyStyledText(startPos, endPos);
+			return;
+		}
+
 		const std::unique_ptr<char[]> styledText = std::make_unique_for_overwrite<char[]>(2*(endPos - startPos) + 2);
 		const Sci_TextRangeFull tr { { startPos, endPos }, styledText.get() };
 		const size_t textLength = SciCall_GetStyledTextFull(&tr);
@@ -1306,24 +1814,7 @@ void EditFormatCode(int menu) noexcept {
 		std::string_view result;
 		bool changed = false;
 
-		if (menu == IDM_EDIT_COPYRTF) {
-			// code from SciTEWin::CopyAsRTF()
-			SaveToStreamRTF(output, styledText.get(), textLength, startPos, endPos);
-			//printf("%s:\n%s\n", __func__, output.c_str());
-			const size_t len = output.length() + 1; // +1 for NUL
-			HGLOBAL handle = ::GlobalAlloc(GMEM_MOVEABLE | GMEM_ZEROINIT, len);
-			if (handle) {
-				::OpenClipboard(hwndMain);
-				::EmptyClipboard();
-				char *ptr = static_cast<char *>(::GlobalLock(handle));
-				if (ptr) {
-					memcpy(ptr, output.c_str(), len);
-					::GlobalUnlock(handle);
-				}
-				::SetClipboardData(::RegisterClipboardFormat(CF_RTF), handle);
-				::CloseClipboard();
-			}
-		} else if (menu == IDM_EDIT_CODE_COMPRESS) {
+		if (menu == IDM_EDIT_CODE_COMPRESS) {
 			size_t index = 0;
 			int chPrev = 0;
 			int stylePrev = static_cast<uint8_t>(styledText[0]);
@@ -1461,7 +1952,537 @@ struct CalcContext final : IActiveScriptSite {
 
 }
 
+namespace {
+
+// allocation free evaluator for JavaScript style arithmetic with Math functions and constants:
+// + - * / % ** | ^ & ~ << >> >>>, decimal, hex (0x), octal (0o or legacy 0), binary (0b) literals.
+// anything not understood fails the evaluation and is left to the script engine.
+class ExprEvaluator {
+	const char *ptr = nullptr;
+	const char *end = nullptr;
+	bool failed = false;
+
+	enum class MathFunction {
+		abs, acos, acosh, asin, asinh, atan, atan2, atanh, cbrt, ceil, cos, cosh, exp, expm1, floor,
+		hypot, log, log10, log1p, log2, max, min, pow, round, sign, sin, sinh, sqrt, tan, tanh, trunc,
+	};
+	struct MathName {
+		std::string_view name;
+		MathFunction function;
+		int arity; // -1 for any number of arguments
+	};
+	static constexpr MathName mathFunctions[] = {
+		{"abs", MathFunction::abs, 1},
+		{"acos", MathFunction::acos, 1},
+		{"acosh", MathFunction::acosh, 1},
+		{"asin", MathFunction::asin, 1},
+		{"asinh", MathFunction::asinh, 1},
+		{"atan", MathFunction::atan, 1},
+		{"atan2", MathFunction::atan2, 2},
+		{"atanh", MathFunction::atanh, 1},
+		{"cbrt", MathFunction::cbrt, 1},
+		{"ceil", MathFunction::ceil, 1},
+		{"cos", MathFunction::cos, 1},
+		{"cosh", MathFunction::cosh, 1},
+		{"exp", MathFunction::exp, 1},
+		{"expm1", MathFunction::expm1, 1},
+		{"floor", MathFunction::floor, 1},
+		{"hypot", MathFunction::hypot, -1},
+		{"log", MathFunction::log, 1},
+		{"log10", MathFunction::log10, 1},
+		{"log1p", MathFunction::log1p, 1},
+		{"log2", MathFunction::log2, 1},
+		{"max", MathFunction::max, -1},
+		{"min", MathFunction::min, -1},
+		{"pow", MathFunction::pow, 2},
+		{"round", MathFunction::round, 1},
+		{"sign", MathFunction::sign, 1},
+		{"sin", MathFunction::sin, 1},
+		{"sinh", MathFunction::sinh, 1},
+		{"sqrt", MathFunction::sqrt, 1},
+		{"tan", MathFunction::tan, 1},
+		{"tanh", MathFunction::tanh, 1},
+		{"trunc", MathFunction::trunc, 1},
+	};
+	struct MathConstant {
+		std::string_view name;
+		double value;
+	};
+	static constexpr MathConstant mathConstants[] = {
+		{"E", 2.718281828459045},
+		{"Infinity", HUGE_VAL},
+		{"LN10", 2.302585092994046},
+		{"LN2", 0.6931471805599453},
+		{"LOG10E", 0.4342944819032518},
+		{"LOG2E", 1.4426950408889634},
+		{"PI", 3.141592653589793},
+		{"SQRT1_2", 0.7071067811865476},
+		{"SQRT2", 1.4142135623730951},
+	};
+
+	static constexpr bool IsIdentifierChar(uint8_t ch) noexcept {
+		return IsAlphaNumeric(ch) || ch == '_' || ch == '$';
+	}
+
+	// ECMAScript ToInt32() and ToUint32()
+	static uint32_t ToUint32(double value) noexcept {
+		if (!std::isfinite(value)) {
+			return 0;
+		}
+		value = std::fmod(std::trunc(value), 4294967296.0);
+		if (value < 0) {
+			value += 4294967296.0;
+		}
+		return static_cast<uint32_t>(value);
+	}
+	static double ToInt32(double value) noexcept {
+		return static_cast<int32_t>(ToUint32(value));
+	}
+
+	void SkipSpace() noexcept {
+		while (ptr < end && IsASpace(*ptr)) {
+			++ptr;
+		}
+	}
+	bool Match(char ch) noexcept {
+		SkipSpace();
+		if (ptr < end && *ptr == ch) {
+			++ptr;
+			return true;
+		}
+		return false;
+	}
+	bool Match(std::string_view op) noexcept {
+		SkipSpace();
+		if (static_cast<size_t>(end - ptr) >= op.length() && memcmp(ptr, op.data(), op.length()) == 0) {
+			ptr += op.length();
+			return true;
+		}
+		return false;
+	}
+	bool MatchOperator(char ch) noexcept {
+		// single character operator not followed by same or '=' character
+		SkipSpace();
+		if (ptr < end && *ptr == ch && (ptr + 1 == end || (ptr[1] != ch && ptr[1] != '='))) {
+			++ptr;
+			return true;
+		}
+		return false;
+	}
+	double Fail() noexcept {
+		failed = true;
+		ptr = end;
+		return 0;
+	}
+
+	double ParseNumber() noexcept {
+		const char * const start = ptr;
+		int radix = 10;
+		if (*ptr == '0' && ptr + 1 < end) {
+			const uint8_t ch = UnsafeLower(ptr[1]);
+			radix = (ch == 'x') ? 16 : ((ch == 'o') ? 8 : ((ch == 'b') ? 2 : 10));
+			if (radix != 10) {
+				ptr += 2;
+			} else if (IsADigit(ch)) {
+				// legacy octal literal when all digits are octal
+				const char *p = ptr + 1;
+				while (p < end && IsOctalDigit(*p)) {
+					++p;
+				}
+				if (p == end || !(IsADigit(*p) || *p == '.' || UnsafeLower(*p) == 'e')) {
+					radix = 8;
+					++ptr;
+				}
+			}
+		}
+		if (radix != 10) {
+			double value = 0;
+			const char * const digits = ptr;
+			while (ptr < end) {
+				const int digit = GetHexDigit(*ptr);
+				if (digit < 0 || digit >= radix) {
+					break;
+				}
+				value = value*radix + digit;
+				++ptr;
+			}
+			if (ptr == digits || (ptr < end && IsIdentifierChar(*ptr))) {
+				return Fail();
+			}
+			return value;
+		}
+
+		while (ptr < end && IsADigit(*ptr)) {
+			++ptr;
+		}
+		if (ptr < end && *ptr == '.') {
+			++ptr;
+			while (ptr < end && IsADigit(*ptr)) {
+				++ptr;
+			}
+		}
+		if (ptr < end && UnsafeLower(*ptr) == 'e') {
+			const char *p = ptr + 1;
+			if (p < end && (*p == '+' || *p == '-')) {
+				++p;
+			}
+			if (p < end && IsADigit(*p)) {
+				while (p < end && IsADigit(*p)) {
+					++p;
+				}
+				ptr = p;
+			}
+		}
+		char buffer[64];
+		const size_t length = ptr - start;
+		if (length >= sizeof(buffer) || (ptr < end && IsIdentifierChar(*ptr))) {
+			return Fail();
+		}
+		memcpy(buffer, start, length);
+		buffer[length] = '\0';
+		return strtod(buffer, nullptr);
+	}
+
+	double CallFunction(MathFunction function, const double *args, int count) noexcept {
+		const double x = (count != 0) ? args[0] : NAN;
+		switch (function) {
+		case MathFunction::abs: return std::fabs(x);
+		case MathFunction::acos: return std::acos(x);
+		case MathFunction::acosh: return std::acosh(x);
+		case MathFunction::asin: return std::asin(x);
+		case MathFunction::asinh: return std::asinh(x);
+		case MathFunction::atan: return std::atan(x);
+		case MathFunction::atan2: return std::atan2(x, args[1]);
+		case MathFunction::atanh: return std::atanh(x);
+		case MathFunction::cbrt: return std::cbrt(x);
+		case MathFunction::ceil: return std::ceil(x);
+		case MathFunction::cos: return std::cos(x);
+		case MathFunction::cosh: return std::cosh(x);
+		case MathFunction::exp: return std::exp(x);
+		case MathFunction::expm1: return std::expm1(x);
+		case MathFunction::floor: return std::floor(x);
+		case MathFunction::log: return std::log(x);
+		case MathFunction::log10: return std::log10(x);
+		case MathFunction::log1p: return std::log1p(x);
+		case MathFunction::log2: return std::log2(x);
+		case MathFunction::pow: return std::pow(x, args[1]);
+		case MathFunction::round: return std::floor(x + 0.5);
+		case MathFunction::sign: return (x > 0) ? 1 : ((x < 0) ? -1 : x);
+		case MathFunction::sin: return std::sin(x);
+		case MathFunction::sinh: return std::sinh(x);
+		case MathFunction::sqrt: return std::sqrt(x);
+		case MathFunction::tan: return std::tan(x);
+		case MathFunction::tanh: return std::tanh(x);
+		case MathFunction::trunc: return std::trunc(x);
+		case MathFunction::hypot: {
+			double value = 0;
+			for (int i = 0; i < count; i++) {
+				value = std::hypot(value, args[i]);
+			}
+			return value;
+		}
+		case MathFunction::max:
+		case MathFunction::min: {
+			const bool maximum = function == MathFunction::max;
+			double value = maximum ? -HUGE_VAL : HUGE_VAL;
+			for (int i = 0; i < count; i++) {
+				if (std::isnan(args[i])) {
+					return NAN;
+				}
+				value = maximum ? max(value, args[i]) : min(value, args[i]);
+			}
+			return value;
+		}
+		}
+		return Fail();
+	}
+
+	double ParseIdentifier() noexcept {
+		const char *start = ptr;
+		while (ptr < end && IsIdentifierChar(*ptr)) {
+			++ptr;
+		}
+		std::string_view name{start, static_cast<size_t>(ptr - start)};
+		if (name == "Math" && ptr < end && *ptr == '.') {
+			start = ++ptr;
+			while (ptr < end && IsIdentifierChar(*ptr)) {
+				++ptr;
+			}
+			name = {start, static_cast<size_t>(ptr - start)};
+		}
+		if (name == "NaN") {
+			return NAN;
+		}
+		for (const MathConstant &constant : mathConstants) {
+			if (constant.name == name) {
+				return constant.value;
+			}
+		}
+		for (const MathName &entry : mathFunctions) {
+			if (entry.name == name) {
+				constexpr int maxArgumentCount = 16;
+				double args[maxArgumentCount];
+				int count = 0;
+				if (!Match('(')) {
+					return Fail();
+				}
+				if (!Match(')')) {
+					do {
+						if (count == maxArgumentCount) {
+							return Fail();
+						}
+						args[count++] = ParseExpression();
+					} while (Match(','));
+					if (!Match(')')) {
+						return Fail();
+					}
+				}
+				if (entry.arity >= 0 && count < entry.arity) {
+					// missing arguments are undefined
+					return NAN;
+				}
+				return CallFunction(entry.function, args, count);
+			}
+		}
+		return Fail();
+	}
+
+	double ParsePrimary() noexcept {
+		SkipSpace();
+		if (ptr == end) {
+			return Fail();
+		}
+		const uint8_t ch = *ptr;
+		if (ch == '(') {
+			++ptr;
+			const double value = ParseExpression();
+			if (!Match(')')) {
+				return Fail();
+			}
+			return value;
+		}
+		if (IsADigit(ch) || (ch == '.' && ptr + 1 < end && IsADigit(ptr[1]))) {
+			return ParseNumber();
+		}
+		if (IsIdentifierChar(ch)) {
+			return ParseIdentifier();
+		}
+		return Fail();
+	}
+
+	double ParseUnary() noexcept {
+		if (MatchOperator('-')) {
+			return -ParseUnary();
+		}
+		if (MatchOperator('+')) {
+			return ParseUnary();
+		}
+		if (Match('~')) {
+			return ~static_cast<int32_t>(ToUint32(ParseUnary()));
+		}
+		const double value = ParsePrimary();
+		if (Match("**")) {
+			// right associative
+			return std::pow(value, ParseUnary());
+		}
+		return value;
+	}
+
+	double ParseMultiplicative() noexcept {
+		double value = ParseUnary();
+		while (!failed) {
+			if (MatchOperator('*')) {
+				value *= ParseUnary();
+			} else if (MatchOperator('/')) {
+				value /= ParseUnary();
+			} else if (MatchOperator('%')) {
+				value = std::fmod(value, ParseUnary());
+			} else {
+				break;
+			}
+		}
+		return value;
+	}
+
+	double ParseAdditive() noexcept {
+		double value = ParseMultiplicative();
+		while (!failed) {
+			if (MatchOperator('+')) {
+				value += ParseMultiplicative();
+			} else if (MatchOperator('-')) {
+				value -= ParseMultiplicative();
+			} else {
+				break;
+			}
+		}
+		return value;
+	}
+
+	double ParseShift() noexcept {
+		double value = ParseAdditive();
+		while (!failed) {
+			if (Match(">>>")) {
+				value = ToUint32(value) >> (ToUint32(ParseAdditive()) & 31);
+			} else if (Match(">>")) {
+				value = static_cast<int32_t>(ToUint32(value)) >> (ToUint32(ParseAdditive()) & 31);
+			} else if (Match("<<")) {
+				value = static_cast<int32_t>(ToUint32(value) << (ToUint32(ParseAdditive()) & 31));
+			} else {
+				break;
+			}
+		}
+		return value;
+	}
+
+	double ParseBitAnd() noexcept {
+		double value = ParseShift();
+		while (!failed && MatchOperator('&')) {
+			value = static_cast<int32_t>(ToUint32(value) & ToUint32(ParseShift()));
+		}
+		return value;
+	}
+
+	double ParseBitXor() noexcept {
+		double value = ParseBitAnd();
+		while (!failed && MatchOperator('^')) {
+			value = static_cast<int32_t>(ToUint32(value) ^ ToUint32(ParseBitAnd()));
+		}
+		return value;
+	}
+
+	double ParseExpression() noexcept {
+		double value = ParseBitXor();
+		while (!failed && MatchOperator('|')) {
+			value = static_cast<int32_t>(ToUint32(value) | ToUint32(ParseBitXor()));
+		}
+		return value;
+	}
+
+public:
+	bool Evaluate(const char *text, size_t length, double &result) noexcept {
+		ptr = text;
+		end = text + length;
+		failed = false;
+		result = ParseExpression();
+		SkipSpace();
+		return !failed && ptr == end;
+	}
+};
+
+// format number like JavaScript Number.prototype.toString()
+int FormatExprResult(char *buffer, double value) noexcept {
+	if (std::isnan(value)) {
+		return sprintf(buffer, "NaN");
+	}
+	if (std::isinf(value)) {
+		return sprintf(buffer, (value > 0) ? "Infinity" : "-Infinity");
+	}
+	if (value == 0) {
+		return sprintf(buffer, "0");
+	}
+
+	char *ptr = buffer;
+	if (value < 0) {
+		*ptr++ = '-';
+		value = -value;
+	}
+	// shortest digits that round trip, as d.ddde[+-]x
+	char temp[32];
+	for (int precision = 0; precision <= 16; precision++) {
+		sprintf(temp, "%.*e", precision, value);
+		if (strtod(temp, nullptr) == value) {
+			break;
+		}
+	}
+	char digits[20];
+	int count = 0;
+	const char *p = temp;
+	for (; *p != 'e'; p++) {
+		if (*p != '.') {
+			digits[count++] = *p;
+		}
+	}
+	// value is 0.digits * 10^point
+	const int point = atoi(p + 1) + 1;
+	if (count <= point && point <= 21) {
+		// integer: digits followed by zeros
+		memcpy(ptr, digits, count);
+		ptr += count;
+		memset(ptr, '0', point - count);
+		ptr += point - count;
+	} else if (0 < point && point <= 21) {
+		memcpy(ptr, digits, point);
+		ptr += point;
+		*ptr++ = '.';
+		memcpy(ptr, digits + point, count - point);
+		ptr += count - point;
+	} else if (-6 < point && point <= 0) {
+		*ptr++ = '0';
+		*ptr++ = '.';
+		memset(ptr, '0', -point);
+		ptr += -point;
+		memcpy(ptr, digits, count);
+		ptr += count;
+	} else {
+		*ptr++ = digits[0];
+		if (count > 1) {
+			*ptr++ = '.';
+			memcpy(ptr, digits + 1, count - 1);
+			ptr += count - 1;
+		}
+		ptr += sprintf(ptr, "e%+d", point - 1);
+		return static_cast<int>(ptr - buffer);
+	}
+	*ptr = '\0';
+	return static_cast<int>(ptr - buffer);
+}
+
+// evaluate every selection with the built-in evaluator, result is inserted after each selection.
+// returns false when nothing could be evaluated, so script engine is used instead.
+bool EditCalculateExprNative() noexcept {
+	ExprEvaluator evaluator;
+	const size_t count = SciCall_GetSelectionCount();
+	char buffer[64];
+	buffer[0] = ' ';
+	bool changed = false;
+	for (size_t i = 0; i < count; i++) {
+		const Sci_Position iSelStart = SciCall_GetSelectionNStart(i);
+		const Sci_Position iSelEnd = SciCall_GetSelectionNEnd(i);
+		if (iSelStart == iSelEnd) {
+			continue;
+		}
+		double value;
+		const char * const pszText = SciCall_GetRangePointer(iSelStart, iSelEnd - iSelStart);
+		if (!evaluator.Evaluate(pszText, iSelEnd - iSelStart, value)) {
+			if (count == 1) {
+				return false;
+			}
+			continue;
+		}
+		const int length = FormatExprResult(buffer + 1, value) + 1;
+		if (!changed) {
+			changed = true;
+			if (count > 1) {
+				SciCall_BeginUndoAction();
+			}
+		}
+		SciCall_InsertText(iSelEnd, buffer);
+		if (count == 1) {
+			SciCall_SetSel(iSelEnd, iSelEnd + length);
+		}
+	}
+	if (changed && count > 1) {
+		SciCall_EndUndoAction();
+	}
+	return changed;
+}
+
+}
+
 void EditCalculateExpr(int menu) {
+	if (menu == CMD_CALCULATE_EXPR && EditCalculateExprNative()) {
+		return;
+	}
 	Sci_Position iSelCount = SciCall_GetSelTextLength();
 	if (iSelCount == 0) {
 		return;
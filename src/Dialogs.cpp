@@ -153,6 +153,20 @@ void DisplayCmdLineHelp(HWND hwnd) noexcept {
 	MessageBoxIndirect(&mbp);
 }
 
+void DisplayDocumentStatistics() noexcept {
+	constexpr int count = SC_MEMORYUSAGE_POSITION_CACHE + 1;
+	WCHAR tchSize[count + 1][32];
+	size_t total = 0;
+	for (int usage = 0; usage < count; usage++) {
+		const size_t bytes = SciCall_GetMemoryUsage(usage);
+		total += bytes;
+		StrFormatByteSize(bytes, tchSize[usage], COUNTOF(tchSize[usage]));
+	}
+	StrFormatByteSize(total, tchSize[count], COUNTOF(tchSize[count]));
+	MsgBoxInfo(MB_OK, IDS_DOCUMENT_STATISTICS, tchSize[0], tchSize[1], tchSize[2], tchSize[3],
+		tchSize[4], tchSize[5], tchSize[6], tchSize[7], tchSize[8], tchSize[9], tchSize[10], tchSize[11]);
+}
+
 void OpenHelpLink(HWND hwnd, int cmd) noexcept {
 	LPCWSTR link = nullptr;
 	switch (cmd) {
@@ -923,77 +937,235 @@ extern MRUList mruFile;
 extern bool bSaveRecentFiles;
 extern int iMaxRecentFiles;
 
-static DWORD WINAPI FileMRUIconThread(LPVOID lpParam) noexcept {
-	const BackgroundWorker * const worker = static_cast<const BackgroundWorker *>(lpParam);
+// icon and attributes of recent files are cached for the process lifetime, cached result is shown
+// immediately, then each file is probed again on a separate thread, so an unreachable path only
+// delays its own item.
+struct FileMRUIconEntry {
+	UINT hash;
+	bool pending;
+	UINT mask;
+	int iImage;
+	UINT state;
+	UINT stateMask;
+	WCHAR path[MAX_PATH];
+};
 
-	WCHAR tch[MAX_PATH] = L"";
+#define FILE_MRU_ICON_CACHE_SIZE	(MRU_MAXITEMS*2)
+static FileMRUIconEntry fileMRUIconCache[FILE_MRU_ICON_CACHE_SIZE];
+static UINT fileMRUIconCacheNext = 0;
+static SRWLOCK fileMRUIconLock = SRWLOCK_INIT;
+
+// shared by icon thread and probe threads of one view, freed by the last one.
+struct FileMRUIconContext {
+	HWND hwnd;
+	LONG refCount;
+	LONG cancelled;
+
+	void Release() noexcept {
+		if (InterlockedDecrement(&refCount) == 0) {
+			GlobalFree(this);
+		}
+	}
+};
+
+struct FileMRUProbeParam {
+	FileMRUIconContext *context;
+	int iItem;
+	WCHAR path[MAX_PATH];
+};
+
+static UINT FileMRUPathHash(LPCWSTR path) noexcept {
+	UINT hash = 0;
+	while (*path) {
+		hash = hash*31 + UnsafeLower(*path);
+		++path;
+	}
+	return hash;
+}
+
+// returns index of cache entry, entry is created when not found.
+static UINT FileMRUIconCacheFind(LPCWSTR path, bool &found) noexcept {
+	const UINT hash = FileMRUPathHash(path);
+	for (UINT index = 0; index < FILE_MRU_ICON_CACHE_SIZE; index++) {
+		const FileMRUIconEntry &entry = fileMRUIconCache[index];
+		if (entry.hash == hash && PathEqual(entry.path, path)) {
+			found = true;
+			return index;
+		}
+	}
+
+	found = false;
+	UINT index = fileMRUIconCacheNext;
+	fileMRUIconCacheNext = (fileMRUIconCacheNext + 1) % FILE_MRU_ICON_CACHE_SIZE;
+	FileMRUIconEntry &entry = fileMRUIconCache[index];
+	if (entry.pending) {
+		// probe for this entry is still running, don't evict it
+		for (UINT i = 0; i < FILE_MRU_ICON_CACHE_SIZE && fileMRUIconCache[index].pending; i++) {
+			index = (index + 1) % FILE_MRU_ICON_CACHE_SIZE;
+		}
+	}
+	FileMRUIconEntry &slot = fileMRUIconCache[index];
+	slot.hash = hash;
+	slot.pending = false;
+	lstrcpyn(slot.path, path, MAX_PATH);
+	return index;
+}
+
+static void FileMRUGetIconInfo(LPCWSTR path, LV_ITEM &lvi) noexcept {
 	DWORD dwFlags = SHGFI_SMALLICON | SHGFI_SYSICONINDEX | SHGFI_ATTRIBUTES | SHGFI_ATTR_SPECIFIED;
+	SHFILEINFO shfi;
+	DWORD dwAttr = 0;
+	if (PathIsUNC(path) || !PathIsFile(path)) {
+		dwFlags |= SHGFI_USEFILEATTRIBUTES;
+		dwAttr = FILE_ATTRIBUTE_NORMAL;
+		shfi.dwAttributes = 0;
+		SHGetFileInfo(PathFindFileName(path), dwAttr, &shfi, sizeof(SHFILEINFO), dwFlags);
+	} else {
+		shfi.dwAttributes = SFGAO_LINK | SFGAO_SHARE;
+		SHGetFileInfo(path, dwAttr, &shfi, sizeof(SHFILEINFO), dwFlags);
+	}
+
+	lvi.mask = LVIF_IMAGE;
+	lvi.iImage = shfi.iIcon;
+	lvi.stateMask = 0;
+	lvi.state = 0;
+
+	if (shfi.dwAttributes & SFGAO_LINK) {
+		lvi.mask |= LVIF_STATE;
+		lvi.stateMask |= LVIS_OVERLAYMASK;
+		lvi.state |= INDEXTOOVERLAYMASK(2);
+	}
+
+	if (shfi.dwAttributes & SFGAO_SHARE) {
+		lvi.mask |= LVIF_STATE;
+		lvi.stateMask |= LVIS_OVERLAYMASK;
+		lvi.state |= INDEXTOOVERLAYMASK(1);
+	}
+
+	if (PathIsUNC(path)) {
+		dwAttr = FILE_ATTRIBUTE_NORMAL;
+	} else {
+		dwAttr = GetFileAttributes(path);
+	}
+
+	if (!flagNoFadeHidden &&
+			dwAttr != INVALID_FILE_ATTRIBUTES &&
+			dwAttr & (FILE_ATTRIBUTE_HIDDEN | FILE_ATTRIBUTE_SYSTEM)) {
+		lvi.mask |= LVIF_STATE;
+		lvi.stateMask |= LVIS_CUT;
+		lvi.state |= LVIS_CUT;
+	}
+}
+
+static DWORD WINAPI FileMRUProbeThread(LPVOID lpParam) noexcept {
+	FileMRUProbeParam * const param = static_cast<FileMRUProbeParam *>(lpParam);
+	FileMRUIconContext * const context = param->context;
+
+	LV_ITEM lvi;
+	memset(&lvi, 0, sizeof(LV_ITEM));
+	FileMRUGetIconInfo(param->path, lvi);
+
+	AcquireSRWLockExclusive(&fileMRUIconLock);
+	bool found;
+	FileMRUIconEntry &entry = fileMRUIconCache[FileMRUIconCacheFind(param->path, found)];
+	entry.pending = false;
+	entry.mask = lvi.mask;
+	entry.iImage = lvi.iImage;
+	entry.state = lvi.state;
+	entry.stateMask = lvi.stateMask;
+	ReleaseSRWLockExclusive(&fileMRUIconLock);
+
+	if (!context->cancelled) {
+		lvi.iItem = param->iItem;
+		lvi.iSubItem = 0;
+		ListView_SetItem(context->hwnd, &lvi);
+	}
+	context->Release();
+	GlobalFree(param);
+	return 0;
+}
+
+static DWORD WINAPI FileMRUIconThread(LPVOID lpParam) noexcept {
+	FileMRUIconContext * const context = static_cast<FileMRUIconContext *>(lpParam);
 
-	HWND hwnd = worker->hwnd;
+	WCHAR tch[MAX_PATH] = L"";
+	HWND hwnd = context->hwnd;
 	const int iMaxItem = ListView_GetItemCount(hwnd);
 	int iItem = 0;
 
 	LV_ITEM lvi;
 	memset(&lvi, 0, sizeof(LV_ITEM));
 
-	while (iItem < iMaxItem && worker->Continue()) {
+	while (iItem < iMaxItem && !context->cancelled) {
 		lvi.mask = LVIF_TEXT;
 		lvi.pszText = tch;
 		lvi.cchTextMax = COUNTOF(tch);
 		lvi.iItem = iItem;
 		if (ListView_GetItem(hwnd, &lvi)) {
-			SHFILEINFO shfi;
-			DWORD dwAttr = 0;
-			if (PathIsUNC(tch) || !PathIsFile(tch)) {
-				dwFlags |= SHGFI_USEFILEATTRIBUTES;
-				dwAttr = FILE_ATTRIBUTE_NORMAL;
-				shfi.dwAttributes = 0;
-				SHGetFileInfo(PathFindFileName(tch), dwAttr, &shfi, sizeof(SHFILEINFO), dwFlags);
+			bool found;
+			bool probe = true;
+			AcquireSRWLockExclusive(&fileMRUIconLock);
+			FileMRUIconEntry &entry = fileMRUIconCache[FileMRUIconCacheFind(tch, found)];
+			if (found) {
+				lvi.mask = entry.mask;
+				lvi.iImage = entry.iImage;
+				lvi.state = entry.state;
+				lvi.stateMask = entry.stateMask;
+				probe = !entry.pending;
 			} else {
-				shfi.dwAttributes = SFGAO_LINK | SFGAO_SHARE;
-				SHGetFileInfo(tch, dwAttr, &shfi, sizeof(SHFILEINFO), dwFlags);
-			}
-
-			lvi.mask = LVIF_IMAGE;
-			lvi.iImage = shfi.iIcon;
-			lvi.stateMask = 0;
-			lvi.state = 0;
-
-			if (shfi.dwAttributes & SFGAO_LINK) {
-				lvi.mask |= LVIF_STATE;
-				lvi.stateMask |= LVIS_OVERLAYMASK;
-				lvi.state |= INDEXTOOVERLAYMASK(2);
-			}
-
-			if (shfi.dwAttributes & SFGAO_SHARE) {
-				lvi.mask |= LVIF_STATE;
-				lvi.stateMask |= LVIS_OVERLAYMASK;
-				lvi.state |= INDEXTOOVERLAYMASK(1);
-			}
-
-			if (PathIsUNC(tch)) {
-				dwAttr = FILE_ATTRIBUTE_NORMAL;
-			} else {
-				dwAttr = GetFileAttributes(tch);
-			}
-
-			if (!flagNoFadeHidden &&
-					dwAttr != INVALID_FILE_ATTRIBUTES &&
-					dwAttr & (FILE_ATTRIBUTE_HIDDEN | FILE_ATTRIBUTE_SYSTEM)) {
-				lvi.mask |= LVIF_STATE;
-				lvi.stateMask |= LVIS_CUT;
-				lvi.state |= LVIS_CUT;
-			}
+				// icon from extension without accessing the file
+				SHFILEINFO shfi;
+				SHGetFileInfo(PathFindFileName(tch), FILE_ATTRIBUTE_NORMAL, &shfi, sizeof(SHFILEINFO),
+					SHGFI_USEFILEATTRIBUTES | SHGFI_SMALLICON | SHGFI_SYSICONINDEX);
+				lvi.mask = LVIF_IMAGE;
+				lvi.iImage = shfi.iIcon;
+				lvi.state = 0;
+				lvi.stateMask = 0;
+				entry.mask = lvi.mask;
+				entry.iImage = lvi.iImage;
+				entry.state = 0;
+				entry.stateMask = 0;
+			}
+			entry.pending = true;
+			ReleaseSRWLockExclusive(&fileMRUIconLock);
 
 			lvi.iSubItem = 0;
 			ListView_SetItem(hwnd, &lvi);
+
+			if (probe) {
+				FileMRUProbeParam *param = static_cast<FileMRUProbeParam *>(GlobalAlloc(GPTR, sizeof(FileMRUProbeParam)));
+				param->context = context;
+				param->iItem = iItem;
+				lstrcpy(param->path, tch);
+				InterlockedIncrement(&context->refCount);
+				HANDLE hThread = CreateThread(nullptr, 0, FileMRUProbeThread, param, 0, nullptr);
+				if (hThread != nullptr) {
+					CloseHandle(hThread);
+				} else {
+					AcquireSRWLockExclusive(&fileMRUIconLock);
+					entry.pending = false;
+					ReleaseSRWLockExclusive(&fileMRUIconLock);
+					context->Release();
+					GlobalFree(param);
+				}
+			}
 		}
 		iItem++;
 	}
 
+	context->Release();
 	return 0;
 }
 
+static void FileMRUCancelIconThread(HWND hwnd) noexcept {
+	FileMRUIconContext *context = static_cast<FileMRUIconContext *>(GetProp(hwnd, L"it"));
+	if (context != nullptr) {
+		RemoveProp(hwnd, L"it");
+		InterlockedExchange(&context->cancelled, TRUE);
+		context->Release();
+	}
+}
+
 static INT_PTR CALLBACK FileMRUDlgProc(HWND hwnd, UINT umsg, WPARAM wParam, LPARAM lParam) noexcept {
 	static const DWORD controlDefinition[] = {
 		DeferCtlMove(IDC_RESIZEGRIP),
@@ -1013,10 +1185,6 @@ static INT_PTR CALLBACK FileMRUDlgProc(HWND hwnd, UINT umsg, WPARAM wParam, LPAR
 		HWND hwndLV = GetDlgItem(hwnd, IDC_FILEMRU);
 		InitWindowCommon(hwndLV);
 
-		BackgroundWorker *worker = static_cast<BackgroundWorker *>(GlobalAlloc(GPTR, sizeof(BackgroundWorker)));
-		SetProp(hwnd, L"it", worker);
-		worker->Init(hwndLV);
-
 		ResizeDlg_Init(hwnd, &positionRecord.cxFileMRUDlg, &positionRecord.cyFileMRUDlg, controlDefinition, COUNTOF(controlDefinition));
 
 		SHFILEINFO shfi;
@@ -1050,10 +1218,7 @@ static INT_PTR CALLBACK FileMRUDlgProc(HWND hwnd, UINT umsg, WPARAM wParam, LPAR
 	return TRUE;
 
 	case WM_DESTROY: {
-		BackgroundWorker *worker = static_cast<BackgroundWorker *>(GetProp(hwnd, L"it"));
-		worker->Destroy();
-		RemoveProp(hwnd, L"it");
-		GlobalFree(worker);
+		FileMRUCancelIconThread(hwnd);
 
 		bSaveRecentFiles = IsButtonChecked(hwnd, IDC_SAVEMRU);
 		iMaxRecentFiles = GetDlgItemInt(hwnd, IDC_MRU_COUNT_VALUE, nullptr, FALSE);
@@ -1150,8 +1315,7 @@ static INT_PTR CALLBACK FileMRUDlgProc(HWND hwnd, UINT umsg, WPARAM wParam, LPAR
 	case WM_COMMAND:
 		switch (LOWORD(wParam)) {
 		case IDC_FILEMRU_UPDATE_VIEW: {
-			BackgroundWorker *worker = static_cast<BackgroundWorker *>(GetProp(hwnd, L"it"));
-			worker->Cancel();
+			FileMRUCancelIconThread(hwnd);
 
 			HWND hwndLV = GetDlgItem(hwnd, IDC_FILEMRU);
 			ListView_DeleteAllItems(hwndLV);
@@ -1175,7 +1339,17 @@ static INT_PTR CALLBACK FileMRUDlgProc(HWND hwnd, UINT umsg, WPARAM wParam, LPAR
 			ListView_SetItemState(hwndLV, 0, LVIS_FOCUSED, LVIS_FOCUSED);
 			ListView_SetColumnWidth(hwndLV, 0, LVSCW_AUTOSIZE_USEHEADER);
 
-			worker->workerThread = CreateThread(nullptr, 0, FileMRUIconThread, worker, 0, nullptr);
+			FileMRUIconContext *context = static_cast<FileMRUIconContext *>(GlobalAlloc(GPTR, sizeof(FileMRUIconContext)));
+			context->hwnd = hwndLV;
+			// one for the dialog and one for icon thread
+			context->refCount = 2;
+			SetProp(hwnd, L"it", context);
+			HANDLE hThread = CreateThread(nullptr, 0, FileMRUIconThread, context, 0, nullptr);
+			if (hThread != nullptr) {
+				CloseHandle(hThread);
+			} else {
+				context->Release();
+			}
 		}
 		break;
 
@@ -2392,6 +2566,7 @@ static INT_PTR CALLBACK AutoCompletionSettingsDlgProc(HWND hwnd, UINT umsg, WPAR
 			autoCompletionConfig.fAutoInsertMask = mask;
 			autoCompletionConfig.iAsmLineCommentChar = GetCheckedRadioButton(hwnd, IDC_ASM_LINE_COMMENT_SEMICOLON, IDC_ASM_LINE_COMMENT_AT) - IDC_ASM_LINE_COMMENT_SEMICOLON;
 			EditCompleteUpdateConfig();
+			EditDocWordIndexReset();
 			SciCall_SetAutoInsertMask(mask);
 			EndDialog(hwnd, IDOK);
 		}
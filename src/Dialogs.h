@@ -33,6 +33,7 @@ int 	MsgBox(UINT uType, UINT uIdMsg, ...) noexcept;
 #define MsgBoxLastError(uType, uIdMsg, ...)	MsgBox(MB_ICONEXCLAMATION | MB_SERVICE_NOTIFICATION | (uType), (uIdMsg), ##__VA_ARGS__)
 
 void	DisplayCmdLineHelp(HWND hwnd) noexcept;
+void	DisplayDocumentStatistics() noexcept;
 void	OpenHelpLink(HWND hwnd, int cmd) noexcept;
 bool	GetDirectory(HWND hwndParent, int iTitle, LPWSTR pszFolder, LPCWSTR pszBase) noexcept;
 INT_PTR CALLBACK AboutDlgProc(HWND hwnd, UINT umsg, WPARAM wParam, LPARAM lParam) noexcept;
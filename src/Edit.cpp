@@ -43,8 +43,11 @@
 
 extern HWND hwndMain;
 extern HWND hwndEdit;
+extern HWND hwndStatus;
 extern DWORD dwLastIOError;
 extern HWND hDlgFindReplace;
+extern HWND hDlgFindAllResults;
+extern HWND hDlgFindInFiles;
 extern bool bReplaceInitialized;
 
 extern int iDefaultEOLMode;
@@ -134,10 +137,11 @@ extern bool bLargeFileMode;
 extern int iWrapColumn;
 extern int iWordWrapIndent;
 
-void EditSetNewText(LPCSTR lpstrText, DWORD cbText, size_t lineCount) noexcept {
+void EditSetNewText(LPCSTR lpstrText, size_t cbText, size_t lineCount, const Sci_Position *lineStarts) noexcept {
 	bFreezeAppTitle = true;
 	bReadOnlyMode = false;
 	iWrapColumn = 0;
+	EditFindAllResults_Clear();
 
 	SciCall_SetReadOnly(false);
 	SciCall_Cancel();
@@ -152,10 +156,15 @@ void EditSetNewText(LPCSTR lpstrText, DWORD cbText, size_t lineCount) noexcept {
 #if defined(_WIN64)
 	// enable conversion between line endings
 	if (bLargeFileMode || cbText + lineCount >= MAX_SMALL_FILE_SIZE) {
-		constexpr int mask = SC_DOCUMENTOPTION_TEXT_LARGE | SC_DOCUMENTOPTION_STYLES_NONE;
 		const int options = SciCall_GetDocumentOptions();
-		if ((options & mask) != mask) {
-			HANDLE pdoc = SciCall_CreateDocument(cbText + 1, options | mask);
+		int newOptions = (options & ~(SC_DOCUMENTOPTION_STYLES_RUNS | SC_DOCUMENTOPTION_SEARCH_INDEX | SC_DOCUMENTOPTION_CHARACTER_BLOCK_INDEX | SC_DOCUMENTOPTION_BRACE_INDEX)) | SC_DOCUMENTOPTION_TEXT_LARGE | SC_DOCUMENTOPTION_STYLES_NONE;
+		// store styles in runs for huge file, otherwise style buffer is as large as the text,
+		// also index it to avoid scanning whole file on repeated search or character count.
+		if (cbText >= MAX_SMALL_FILE_SIZE) {
+			newOptions |= SC_DOCUMENTOPTION_STYLES_RUNS | SC_DOCUMENTOPTION_SEARCH_INDEX | SC_DOCUMENTOPTION_CHARACTER_BLOCK_INDEX | SC_DOCUMENTOPTION_BRACE_INDEX;
+		}
+		if (options != newOptions) {
+			HANDLE pdoc = SciCall_CreateDocument(cbText + 1, newOptions);
 			EditReplaceDocument(pdoc);
 			bLargeFileMode = true;
 		}
@@ -172,6 +181,9 @@ void EditSetNewText(LPCSTR lpstrText, DWORD cbText, size_t lineCount) noexcept {
 		watch.Start();
 #endif
 		SciCall_AllocateLines(lineCount);
+		if (lineStarts != nullptr) {
+			SciCall_SetLineStartsHint(lineCount - 1, lineStarts);
+		}
 		SciCall_AppendText(cbText, lpstrText);
 #if 0
 		watch.Stop();
@@ -191,6 +203,50 @@ void EditSetNewText(LPCSTR lpstrText, DWORD cbText, size_t lineCount) noexcept {
 	bFreezeAppTitle = false;
 }
 
+// Convert text of range view to UTF-16, returns required size when cchWideChar is zero.
+static int EditRangeViewToWide(UINT codePage, const SciTextRangeView &view, LPWSTR lpWideCharStr, int cchWideChar) noexcept {
+	int count = 0;
+	for (int i = 0; i < 2; i++) {
+		if (view.length[i] > 0) {
+			count += MultiByteToWideChar(codePage, 0, view.text[i], static_cast<int>(view.length[i]),
+				(cchWideChar == 0) ? nullptr : lpWideCharStr + count, (cchWideChar == 0) ? 0 : cchWideChar - count);
+		}
+	}
+	return count;
+}
+
+// Convert text chunk by chunk into a new document, source text is read in place.
+static HANDLE EditConvertDocument(UINT cpSource, UINT cpDest, Sci_Position length) noexcept {
+	constexpr Sci_Position chunkSize = 1024*1024;
+	Scintilla::ILoader *loader = SciCall_CreateLoader(length + 1, SciCall_GetDocumentOptions());
+	WCHAR *pwchText = static_cast<WCHAR *>(NP2HeapAlloc(chunkSize * sizeof(WCHAR)));
+	char *pchText = static_cast<char *>(NP2HeapAlloc(chunkSize * kMaxMultiByteCount));
+	bool success = loader != nullptr && pwchText != nullptr && pchText != nullptr;
+	Sci_Position pos = 0;
+	while (success && pos < length) {
+		Sci_Position end = min(pos + chunkSize, length);
+		if (end < length) {
+			// start of character contains end
+			end = SciCall_PositionBefore(end + 1);
+		}
+		const SciTextRangeView view = SciCall_GetRangeView(pos, end);
+		const int cbwText = EditRangeViewToWide(cpSource, view, pwchText, chunkSize);
+		const int cbText = WideCharToMultiByte(cpDest, 0, pwchText, cbwText, pchText, chunkSize * kMaxMultiByteCount, nullptr, nullptr);
+		success = loader->AddData(pchText, cbText) == SC_STATUS_OK;
+		pos = end;
+	}
+
+	NP2HeapFree(pwchText);
+	NP2HeapFree(pchText);
+	if (success) {
+		return loader->ConvertToDocument();
+	}
+	if (loader != nullptr) {
+		loader->Release();
+	}
+	return nullptr;
+}
+
 //=============================================================================
 //
 // EditConvertText()
@@ -200,22 +256,13 @@ bool EditConvertText(UINT cpSource, UINT cpDest) noexcept {
 		return true;
 	}
 
-	const size_t length = SciCall_GetLength();
-	if (length >= MAX_NON_UTF8_SIZE) {
-		return true;
-	}
-
-	char *pchText = nullptr;
-	int cbText = 0;
+	const Sci_Position length = SciCall_GetLength();
+	HANDLE pdoc = nullptr;
 	if (length > 0) {
-		// DBCS: length -> WCHAR: sizeof(WCHAR) * (length / 2) -> UTF-8: kMaxMultiByteCount * (length / 2)
-		pchText = static_cast<char *>(NP2HeapAlloc((length + 1) * sizeof(WCHAR)));
-		SciCall_GetText(length, pchText);
-
-		WCHAR *pwchText = static_cast<WCHAR *>(NP2HeapAlloc((length + 1) * sizeof(WCHAR)));
-		const int cbwText = MultiByteToWideChar(cpSource, 0, pchText, static_cast<int>(length), pwchText, static_cast<int>(NP2HeapSize(pwchText) / sizeof(WCHAR)));
-		cbText = WideCharToMultiByte(cpDest, 0, pwchText, cbwText, pchText, static_cast<int>(NP2HeapSize(pchText)), nullptr, nullptr);
-		NP2HeapFree(pwchText);
+		pdoc = EditConvertDocument(cpSource, cpDest, length);
+		if (pdoc == nullptr) {
+			return true;
+		}
 	}
 
 	bReadOnlyMode = false;
@@ -225,20 +272,15 @@ bool EditConvertText(UINT cpSource, UINT cpDest) noexcept {
 	SciCall_SetUndoSelectionHistory(SC_UNDO_SELECTION_HISTORY_DISABLED);
 	SciCall_SetUndoCollection(false);
 	SciCall_EmptyUndoBuffer();
-	SciCall_ClearAll();
-	SciCall_ClearMarker();
-	SciCall_SetCodePage(cpDest);
-
-	if (cbText > 0) {
-		SendMessage(hwndEdit, WM_SETREDRAW, FALSE, 0);
-		SciCall_SetModEventMask(SC_MOD_NONE);
-		SciCall_AppendText(cbText, pchText);
-		SciCall_SetModEventMask(SC_MOD_INSERTTEXT | SC_MOD_DELETETEXT);
-		SendMessage(hwndEdit, WM_SETREDRAW, TRUE, 0);
-		InvalidateRect(hwndEdit, nullptr, TRUE);
-	}
-	if (pchText != nullptr) {
-		NP2HeapFree(pchText);
+	if (pdoc != nullptr) {
+		EditReplaceDocument(pdoc);
+		SciCall_SetCodePage(cpDest);
+		fvCurFile.Apply();
+		Style_SetLexer(pLexCurrent, true);
+	} else {
+		SciCall_ClearAll();
+		SciCall_ClearMarker();
+		SciCall_SetCodePage(cpDest);
 	}
 
 	SciCall_EmptyUndoBuffer();
@@ -254,20 +296,11 @@ bool EditConvertText(UINT cpSource, UINT cpDest) noexcept {
 
 #if defined(_WIN64)
 void EditConvertToLargeMode() noexcept {
-	int options = SciCall_GetDocumentOptions();
+	const int options = SciCall_GetDocumentOptions();
 	if (options & SC_DOCUMENTOPTION_TEXT_LARGE) {
 		return;
 	}
 
-	options |= SC_DOCUMENTOPTION_TEXT_LARGE;
-	const Sci_Position length = SciCall_GetLength();
-	HANDLE pdoc = SciCall_CreateDocument(length + 1, options);
-	char *pchText = nullptr;
-	if (length != 0) {
-		pchText = static_cast<char *>(NP2HeapAlloc(length + 1));
-		SciCall_GetText(length, pchText);
-	}
-
 	bReadOnlyMode = false;
 	SciCall_SetReadOnly(false);
 	SciCall_Cancel();
@@ -275,24 +308,12 @@ void EditConvertToLargeMode() noexcept {
 	SciCall_SetUndoSelectionHistory(SC_UNDO_SELECTION_HISTORY_DISABLED);
 	SciCall_SetUndoCollection(false);
 	SciCall_EmptyUndoBuffer();
-	SciCall_ClearAll();
 	SciCall_ClearMarker();
 
-	EditReplaceDocument(pdoc);
+	// move text into new large document without copying it
+	SciCall_SetDocumentOptions(options | SC_DOCUMENTOPTION_TEXT_LARGE);
 	fvCurFile.Apply();
 
-	if (length != 0) {
-		SendMessage(hwndEdit, WM_SETREDRAW, FALSE, 0);
-		SciCall_SetModEventMask(SC_MOD_NONE);
-		SciCall_AppendText(length, pchText);
-		SciCall_SetModEventMask(SC_MOD_INSERTTEXT | SC_MOD_DELETETEXT);
-		SendMessage(hwndEdit, WM_SETREDRAW, TRUE, 0);
-		InvalidateRect(hwndEdit, nullptr, TRUE);
-	}
-	if (pchText != nullptr) {
-		NP2HeapFree(pchText);
-	}
-
 	SciCall_SetUndoCollection(true);
 	SciCall_EmptyUndoBuffer();
 	SciCall_SetSavePoint();
@@ -319,9 +340,11 @@ char* EditGetClipboardText(HWND hwnd) noexcept {
 	const UINT cpEdit = SciCall_GetCodePage();
 	const int mlen = WideCharToMultiByte(cpEdit, 0, pwch, -1, nullptr, 0, nullptr, nullptr);
 	char *pmch = static_cast<char *>(LocalAlloc(LPTR, mlen*2));
-	char *ptmp = static_cast<char *>(NP2HeapAlloc(mlen));
 
-	if (pmch && ptmp) {
+	if (pmch) {
+		// convert into upper half, then normalize line endings forward in place,
+		// output never overtakes input as each byte expands to at most two bytes.
+		char *ptmp = pmch + mlen;
 		WideCharToMultiByte(cpEdit, 0, pwch, -1, ptmp, mlen, nullptr, nullptr);
 		const int iEOLMode = SciCall_GetEOLMode();
 		const char *s = ptmp;
@@ -352,7 +375,6 @@ char* EditGetClipboardText(HWND hwnd) noexcept {
 		*d++ = '\0';
 	}
 
-	NP2HeapFree(ptmp);
 	GlobalUnlock(hmem);
 	CloseClipboard();
 
@@ -415,31 +437,35 @@ bool EditCopyAppend(HWND hwnd) noexcept {
 		return true;
 	}
 
-	char *pszText;
+	char *pszText = nullptr;
+	SciTextRangeView view;
 	if (!SciCall_IsSelectionEmpty()) {
 		if (SciCall_IsRectangularSelection()) {
 			NotifyRectangularSelection();
 			return false;
 		}
-
-		const Sci_Position iSelCount = SciCall_GetSelTextLength();
-		pszText = static_cast<char *>(NP2HeapAlloc(iSelCount + 1));
-		SciCall_GetSelText(pszText);
+		if (SciCall_IsMultipleSelection()) {
+			// selections are joined with separator
+			const Sci_Position iSelCount = SciCall_GetSelTextLength();
+			pszText = static_cast<char *>(NP2HeapAlloc(iSelCount + 1));
+			SciCall_GetSelText(pszText);
+			view = { { pszText, nullptr }, { iSelCount, 0 } };
+		} else {
+			view = SciCall_GetRangeView(SciCall_GetSelectionStart(), SciCall_GetSelectionEnd());
+		}
 	} else {
-		const Sci_Position cchText = SciCall_GetLength();
-		pszText = static_cast<char *>(NP2HeapAlloc(cchText + 1));
-		SciCall_GetText(cchText, pszText);
+		view = SciCall_GetRangeView(0, SciCall_GetLength());
 	}
 
 	const UINT cpEdit = SciCall_GetCodePage();
-	const int cchTextW = MultiByteToWideChar(cpEdit, 0, pszText, -1, nullptr, 0);
+	const int cchTextW = EditRangeViewToWide(cpEdit, view, nullptr, 0);
 
 	WCHAR *pszTextW = nullptr;
 	if (cchTextW > 0) {
 		const WCHAR *pszSep = L"\r\n\r\n";
 		pszTextW = static_cast<WCHAR *>(NP2HeapAlloc(sizeof(WCHAR) * (CSTRLEN(L"\r\n\r\n") + cchTextW + 1)));
 		lstrcpy(pszTextW, pszSep);
-		MultiByteToWideChar(cpEdit, 0, pszText, -1, StrEnd(pszTextW), static_cast<int>(NP2HeapSize(pszTextW) / sizeof(WCHAR)));
+		EditRangeViewToWide(cpEdit, view, pszTextW + CSTRLEN(L"\r\n\r\n"), cchTextW);
 	}
 
 	NP2HeapFree(pszText);
@@ -472,11 +498,32 @@ bool EditCopyAppend(HWND hwnd) noexcept {
 	return succ;
 }
 
+static void EditSetEOLStatus(EditFileIOStatus &status, size_t lineCountCRLF, size_t lineCountCR, size_t lineCountLF) noexcept {
+	const size_t linesMax = max(max(lineCountCRLF, lineCountCR), lineCountLF);
+	status.linesCount[SC_EOL_CRLF] = lineCountCRLF;
+	status.linesCount[SC_EOL_CR] = lineCountCR;
+	status.linesCount[SC_EOL_LF] = lineCountLF;
+	int iEOLMode = status.iEOLMode;
+	if (linesMax != status.linesCount[iEOLMode]) {
+		if (linesMax == lineCountCRLF) {
+			iEOLMode = SC_EOL_CRLF;
+		} else if (linesMax == lineCountLF) {
+			iEOLMode = SC_EOL_LF;
+		} else {
+			iEOLMode = SC_EOL_CR;
+		}
+	}
+
+	status.iEOLMode = iEOLMode;
+	status.bInconsistent = ((!!lineCountCRLF) + (!!lineCountCR) + (!!lineCountLF)) > 1;
+	status.totalLineCount = lineCountCRLF + lineCountCR + lineCountLF + 1;
+}
+
 //=============================================================================
 //
 // EditDetectEOLMode()
 //
-void EditDetectEOLMode(LPCSTR lpData, DWORD cbData, EditFileIOStatus &status) noexcept {
+void EditDetectEOLMode(LPCSTR lpData, size_t cbData, EditFileIOStatus &status) noexcept {
 	/* '\r' and '\n' is not reused (e.g. as trailing byte in DBCS) by any known encoding,
 	it's safe to check whole data byte by byte.*/
 
@@ -486,7 +533,7 @@ void EditDetectEOLMode(LPCSTR lpData, DWORD cbData, EditFileIOStatus &status) no
 
 	const uint8_t *ptr = reinterpret_cast<const uint8_t *>(lpData);
 	// No NULL-terminated requirement for *ptr == '\n'
-#if NP2_USE_SSE2 || NP2_USE_AVX2
+#if NP2_USE_SSE2 || NP2_USE_AVX2 || NP2_USE_NEON
 	const uint8_t * const end = ptr + cbData;
 #else
 	const uint8_t * const end = ptr + cbData - 1;
@@ -779,6 +826,46 @@ void EditDetectEOLMode(LPCSTR lpData, DWORD cbData, EditFileIOStatus &status) no
 	}
 #endif
 	// end NP2_USE_SSE2
+#elif NP2_USE_NEON
+	uint64_t lastCR = 0;
+	const uint8x16_t vectCR = vdupq_n_u8('\r');
+	const uint8x16_t vectLF = vdupq_n_u8('\n');
+	// same as SSE2 path, with 4 bits for each byte, last chunk is padded with zero.
+	while (ptr < end) {
+		uint8x16_t chunk;
+		if (ptr + sizeof(uint8x16_t) <= end) {
+			chunk = vld1q_u8(ptr);
+		} else {
+			uint8_t buffer[sizeof(uint8x16_t)]{};
+			memcpy(buffer, ptr, end - ptr);
+			chunk = vld1q_u8(buffer);
+		}
+		ptr += sizeof(uint8x16_t);
+		uint64_t maskCR = neon_byte_mask(vceqq_u8(chunk, vectCR));
+		uint64_t maskLF = neon_byte_mask(vceqq_u8(chunk, vectLF));
+
+		if (maskCR | lastCR) {
+			const uint64_t carry = maskCR >> 60;
+			maskCR = (maskCR << 4) | lastCR;
+			lastCR = carry;
+
+			const uint64_t maskCRLF = maskCR & maskLF; // CR+LF
+			const uint64_t maskCR_LF = maskCR ^ maskLF;// CR alone or LF alone
+			maskLF = maskCR_LF & maskLF; // LF alone
+			maskCR = maskCR_LF ^ maskLF; // CR alone (with one position offset)
+			if (maskCRLF) {
+				lineCountCRLF += np2_popcount64(maskCRLF);
+			}
+			if (maskCR) {
+				lineCountCR += np2_popcount64(maskCR);
+			}
+		}
+		if (maskLF) {
+			lineCountLF += np2_popcount64(maskLF);
+		}
+	}
+	lineCountCR += lastCR;
+	// end NP2_USE_NEON
 #else
 
 #if defined(__clang__) || defined(__GNUC__) || defined(__ICL) || !defined(_MSC_VER)
@@ -840,48 +927,140 @@ void EditDetectEOLMode(LPCSTR lpData, DWORD cbData, EditFileIOStatus &status) no
 	}
 #endif
 
-	const size_t linesMax = max(max(lineCountCRLF, lineCountCR), lineCountLF);
-	status.linesCount[SC_EOL_CRLF] = lineCountCRLF;
-	status.linesCount[SC_EOL_CR] = lineCountCR;
-	status.linesCount[SC_EOL_LF] = lineCountLF;
-	int iEOLMode = status.iEOLMode;
-	if (linesMax != status.linesCount[iEOLMode]) {
-		if (linesMax == lineCountCRLF) {
-			iEOLMode = SC_EOL_CRLF;
-		} else if (linesMax == lineCountLF) {
-			iEOLMode = SC_EOL_LF;
-		} else {
-			iEOLMode = SC_EOL_CR;
+	EditSetEOLStatus(status, lineCountCRLF, lineCountCR, lineCountLF);
+}
+
+// find line ends on multiple threads for large file, line start positions are
+// passed to Scintilla with SCI_SETLINESTARTSHINT to avoid scanning the text again.
+#define NP2_PARALLEL_EOL_MIN_SIZE	(64U << 20)
+
+struct LineStartsBlock {
+	const char *lpData;
+	size_t startPos;
+	size_t endPos;
+	Sci_Position *lineStarts;	// nullptr to count line ends
+	size_t linesCount[3];
+};
+
+static void EditFindLineStarts(const char *lpData, size_t startPos, size_t endPos, Sci_Position *lineStarts) noexcept {
+	const uint8_t * const base = reinterpret_cast<const uint8_t *>(lpData);
+	const uint8_t *ptr = base + startPos;
+	const uint8_t * const end = base + endPos;
+	// skip LF of CR+LF
+	const uint8_t *skip = ptr;
+#if NP2_USE_SSE2
+	const __m128i vectCR = _mm_set1_epi8('\r');
+	const __m128i vectLF = _mm_set1_epi8('\n');
+	while (ptr + sizeof(__m128i) <= end) {
+		const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i *>(ptr));
+		uint32_t mask = _mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(chunk, vectCR), _mm_cmpeq_epi8(chunk, vectLF)));
+		while (mask != 0) {
+			const uint8_t *eol = ptr + np2_ctz(mask);
+			mask &= mask - 1;
+			if (eol >= skip) {
+				if (*eol == '\r' && eol[1] == '\n') {
+					++eol;
+					skip = eol + 1;
+				}
+				*lineStarts++ = eol + 1 - base;
+			}
 		}
+		ptr += sizeof(__m128i);
 	}
+	ptr = max(ptr, skip);
+#endif
+	while (ptr < end) {
+		const uint8_t ch = *ptr++;
+		if (ch == '\r' || ch == '\n') {
+			if (ch == '\r' && *ptr == '\n') {
+				++ptr;
+			}
+			*lineStarts++ = ptr - base;
+		}
+	}
+}
 
-	status.iEOLMode = iEOLMode;
-	status.bInconsistent = ((!!lineCountCRLF) + (!!lineCountCR) + (!!lineCountLF)) > 1;
-	status.totalLineCount = lineCountCRLF + lineCountCR + lineCountLF + 1;
+static DWORD WINAPI EditFindLineStartsThread(LPVOID lpParam) noexcept {
+	LineStartsBlock * const block = static_cast<LineStartsBlock *>(lpParam);
+	if (block->lineStarts == nullptr) {
+		EditFileIOStatus status {};
+		EditDetectEOLMode(block->lpData + block->startPos, block->endPos - block->startPos, status);
+		memcpy(block->linesCount, status.linesCount, sizeof(block->linesCount));
+	} else {
+		EditFindLineStarts(block->lpData, block->startPos, block->endPos, block->lineStarts);
+	}
+	return 0;
 }
 
-void EditDetectIndentation(LPCSTR lpData, DWORD cbData, EditFileVars &fv) noexcept {
-	if ((fv.mask & FV_MaskHasFileTabSettings) == FV_MaskHasFileTabSettings) {
-		return;
+// returns line start positions (totalLineCount - 1) for large file, or nullptr.
+static Sci_Position *EditDetectEOLModeParallel(LPCSTR lpData, size_t cbData, EditFileIOStatus &status) noexcept {
+	SYSTEM_INFO info;
+	GetSystemInfo(&info);
+	UINT count = static_cast<UINT>(min<size_t>(info.dwNumberOfProcessors, cbData / (NP2_PARALLEL_EOL_MIN_SIZE / 4)));
+	count = clamp<UINT>(count, 1, MAX_PARALLEL_WORKER_COUNT);
+	if (count == 1) {
+		EditDetectEOLMode(lpData, cbData, status);
+		return nullptr;
 	}
-	if (!tabSettings.bDetectIndentation) {
-		return;
+
+	LineStartsBlock blocks[MAX_PARALLEL_WORKER_COUNT];
+	const size_t blockSize = cbData / count;
+	size_t startPos = 0;
+	for (UINT i = 0; i < count; i++) {
+		size_t endPos = (i + 1 == count) ? cbData : startPos + blockSize;
+		// don't split CR+LF
+		if (endPos < cbData && lpData[endPos - 1] == '\r' && lpData[endPos] == '\n') {
+			++endPos;
+		}
+		blocks[i].lpData = lpData;
+		blocks[i].startPos = startPos;
+		blocks[i].endPos = endPos;
+		blocks[i].lineStarts = nullptr;
+		startPos = endPos;
 	}
 
-#if 0
-	StopWatch watch;
-	watch.Start();
-#endif
+	RunParallelWorker(EditFindLineStartsThread, blocks, sizeof(LineStartsBlock), count);
+	size_t linesCount[3] = {0, 0, 0};
+	for (UINT i = 0; i < count; i++) {
+		linesCount[SC_EOL_CRLF] += blocks[i].linesCount[SC_EOL_CRLF];
+		linesCount[SC_EOL_CR] += blocks[i].linesCount[SC_EOL_CR];
+		linesCount[SC_EOL_LF] += blocks[i].linesCount[SC_EOL_LF];
+	}
+	EditSetEOLStatus(status, linesCount[SC_EOL_CRLF], linesCount[SC_EOL_CR], linesCount[SC_EOL_LF]);
 
-	// code based on SciTEBase::DiscoverIndentSetting().
-	cbData = min<DWORD>(cbData, 1*1024*1024);
-	const uint8_t *ptr = reinterpret_cast<const uint8_t *>(lpData);
-	const uint8_t * const end = ptr + cbData;
-	#define MAX_DETECTED_TAB_WIDTH	8
+	const size_t lines = status.totalLineCount - 1;
+	Sci_Position * const lineStarts = (lines == 0) ? nullptr : static_cast<Sci_Position *>(NP2HeapAlloc(lines*sizeof(Sci_Position)));
+	if (lineStarts != nullptr) {
+		Sci_Position *positions = lineStarts;
+		for (UINT i = 0; i < count; i++) {
+			blocks[i].lineStarts = positions;
+			positions += blocks[i].linesCount[SC_EOL_CRLF] + blocks[i].linesCount[SC_EOL_CR] + blocks[i].linesCount[SC_EOL_LF];
+		}
+		RunParallelWorker(EditFindLineStartsThread, blocks, sizeof(LineStartsBlock), count);
+	}
+	return lineStarts;
+}
+
+// code based on SciTEBase::DiscoverIndentSetting().
+#define MAX_DETECTED_TAB_WIDTH	8
+// indentation is sampled from blocks at the beginning, at the end and evenly spaced between them.
+#define INDENTATION_SAMPLE_SIZE		(64U << 10)
+#define INDENTATION_SAMPLE_COUNT	16
+// stop sampling when the most used indentation is used by enough lines and much more than others.
+#define INDENTATION_CONFIDENT_LINES	4096
+#define INDENTATION_CONFIDENT_RATIO	8
+
+struct IndentationStat {
 	// line count for ambiguous lines, line indented by 1 to 8 spaces, line starts with tab.
-	uint32_t indentLineCount[1 + MAX_DETECTED_TAB_WIDTH + 1 + (6*NP2_USE_AVX2)]{};
-	int prevIndentCount = 0;
-	int prevTabWidth = 0;
+	uint32_t indentLineCount[1 + MAX_DETECTED_TAB_WIDTH + 1 + (6*NP2_USE_AVX2)];
+	int prevIndentCount;
+	int prevTabWidth;
+};
+
+static void EditDetectIndentationRange(IndentationStat &stat, const uint8_t *ptr, const uint8_t * const end) noexcept {
+	uint32_t * const indentLineCount = stat.indentLineCount;
+	int prevIndentCount = stat.prevIndentCount;
+	int prevTabWidth = stat.prevTabWidth;
 
 #if NP2_USE_AVX2
 	const __m256i vectCR = _mm256_set1_epi8('\r');
@@ -964,6 +1143,71 @@ labelStart:
 		}
 	}
 
+	stat.prevIndentCount = prevIndentCount;
+	stat.prevTabWidth = prevTabWidth;
+}
+
+static bool IsIndentationConfident(const IndentationStat &stat) noexcept {
+	uint32_t first = 0;
+	uint32_t second = 0;
+	for (int i = 1; i < MAX_DETECTED_TAB_WIDTH + 2; i++) {
+		const uint32_t count = stat.indentLineCount[i];
+		if (count > first) {
+			second = first;
+			first = count;
+		} else if (count > second) {
+			second = count;
+		}
+	}
+	return first >= INDENTATION_CONFIDENT_LINES && first >= second*INDENTATION_CONFIDENT_RATIO;
+}
+
+void EditDetectIndentation(LPCSTR lpData, size_t cbData, EditFileVars &fv) noexcept {
+	if ((fv.mask & FV_MaskHasFileTabSettings) == FV_MaskHasFileTabSettings) {
+		return;
+	}
+	if (!tabSettings.bDetectIndentation) {
+		return;
+	}
+
+#if 0
+	StopWatch watch;
+	watch.Start();
+#endif
+
+	IndentationStat stat{};
+	const uint8_t * const data = reinterpret_cast<const uint8_t *>(lpData);
+	if (cbData <= INDENTATION_SAMPLE_SIZE*INDENTATION_SAMPLE_COUNT) {
+		for (size_t offset = 0; offset < cbData; offset += INDENTATION_SAMPLE_SIZE) {
+			// continuous block, the last line may be split
+			EditDetectIndentationRange(stat, data + offset, data + min<size_t>(cbData, offset + INDENTATION_SAMPLE_SIZE));
+			if (IsIndentationConfident(stat)) {
+				break;
+			}
+		}
+	} else {
+		// first block, last block, then blocks between them
+		const size_t step = (cbData - INDENTATION_SAMPLE_SIZE) / (INDENTATION_SAMPLE_COUNT - 1);
+		for (UINT i = 0; i < INDENTATION_SAMPLE_COUNT; i++) {
+			const UINT index = (i == 0) ? 0 : ((i == 1) ? INDENTATION_SAMPLE_COUNT - 1 : i - 1);
+			const uint8_t *ptr = data + index*step;
+			const uint8_t * const end = ptr + INDENTATION_SAMPLE_SIZE;
+			if (index != 0) {
+				// skip partial line
+				while (ptr < end && *ptr != '\r' && *ptr != '\n') {
+					++ptr;
+				}
+				stat.prevIndentCount = 0;
+			}
+			EditDetectIndentationRange(stat, ptr, end);
+			if (IsIndentationConfident(stat)) {
+				break;
+			}
+		}
+	}
+
+	const uint32_t * const indentLineCount = stat.indentLineCount;
+	int prevTabWidth;
 	// reduce code size for the unrolled loop
 #if NP2_USE_AVX512
 	const __m512i chunk = _mm512_loadu_si512(indentLineCount);
@@ -971,8 +1215,8 @@ labelStart:
 	const uint32_t mask = _mm512_cmpeq_epu32_mask(chunk, maxAll);
 	prevTabWidth = np2_ctz(mask);
 #elif NP2_USE_AVX2
-	const __m256i chunk1 = _mm256_loadu_si256(reinterpret_cast<__m256i *>(indentLineCount));
-	const __m256i chunk2 = _mm256_loadu_si256(reinterpret_cast<__m256i *>(indentLineCount + 8));
+	const __m256i chunk1 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(indentLineCount));
+	const __m256i chunk2 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(indentLineCount + 8));
 	__m128i maxAll = _mm_max_epu32(_mm256_castsi256_si128(chunk1), _mm256_castsi256_si128(chunk2));
 	maxAll = _mm_max_epu32(maxAll, _mm256_extracti128_si256(chunk1, 1));
 	maxAll = _mm_max_epu32(maxAll, _mm_shuffle_epi32(maxAll, _MM_SHUFFLE(0, 1, 2, 3)));
@@ -1015,1581 +1259,2984 @@ labelStart:
 //
 // EditLoadFile()
 //
-bool EditLoadFile(LPWSTR pszFile, EditFileIOStatus &status) noexcept {
-	HANDLE hFile = CreateFile(pszFile,
-					   GENERIC_READ,
-					   FILE_SHARE_READ | FILE_SHARE_WRITE,
-					   nullptr, OPEN_EXISTING,
-					   FILE_ATTRIBUTE_NORMAL,
-					   nullptr);
-	dwLastIOError = GetLastError();
-
-	if (hFile == INVALID_HANDLE_VALUE) {
-		return false;
+extern DWORD dwFileMappingThreshold;
+extern DWORD dwAtomicSaveThreshold;
+extern DWORD dwInPlaceSaveThreshold;
+extern bool bBinaryFileHexView;
+extern bool bRetainFileData;
+
+// original bytes of last loaded remote file, reused by reload (e.g. with another encoding)
+// and compare with saved file while the file is unchanged, to avoid reading it again over network.
+// only changed on main thread, lock is acquired for write and for read from worker thread.
+static struct RetainedFileData {
+	char *lpData;
+	size_t cbData;
+	BY_HANDLE_FILE_INFORMATION info;
+	SRWLOCK lock;
+} retainedFile;
+
+static inline bool IsSameFileIdentity(const BY_HANDLE_FILE_INFORMATION &info, const BY_HANDLE_FILE_INFORMATION &other) noexcept {
+	return info.dwVolumeSerialNumber == other.dwVolumeSerialNumber
+		&& info.nFileIndexHigh == other.nFileIndexHigh && info.nFileIndexLow == other.nFileIndexLow
+		&& info.nFileSizeHigh == other.nFileSizeHigh && info.nFileSizeLow == other.nFileSizeLow
+		&& CompareFileTime(&info.ftLastWriteTime, &other.ftLastWriteTime) == 0;
+}
+
+void EditReleaseRetainedFile() noexcept {
+	if (retainedFile.lpData != nullptr) {
+		AcquireSRWLockExclusive(&retainedFile.lock);
+		NP2HeapFree(retainedFile.lpData);
+		retainedFile.lpData = nullptr;
+		retainedFile.cbData = 0;
+		ReleaseSRWLockExclusive(&retainedFile.lock);
+	}
+}
+
+static void EditRetainFile(const BY_HANDLE_FILE_INFORMATION &info, const char *lpData, size_t cbData) noexcept {
+	char * const lpCopy = static_cast<char *>(NP2HeapAlloc(cbData));
+	if (lpCopy != nullptr) {
+		memcpy(lpCopy, lpData, cbData);
+		AcquireSRWLockExclusive(&retainedFile.lock);
+		retainedFile.lpData = lpCopy;
+		retainedFile.cbData = cbData;
+		retainedFile.info = info;
+		ReleaseSRWLockExclusive(&retainedFile.lock);
+	}
+}
+
+static bool EditReadRetainedFile(const BY_HANDLE_FILE_INFORMATION &info, char *lpData, size_t cbData, size_t *cbRead) noexcept {
+	bool found = false;
+	AcquireSRWLockShared(&retainedFile.lock);
+	if (retainedFile.lpData != nullptr && retainedFile.cbData <= cbData && IsSameFileIdentity(info, retainedFile.info)) {
+		memcpy(lpData, retainedFile.lpData, retainedFile.cbData);
+		*cbRead = retainedFile.cbData;
+		found = true;
+	}
+	ReleaseSRWLockShared(&retainedFile.lock);
+	return found;
+}
+
+static inline void EditFreeFileData(char *lpData, bool bMapped) noexcept {
+	if (bMapped) {
+		UnmapViewOfFile(lpData);
+	} else {
+		NP2HeapFree(lpData);
 	}
+}
 
-	LARGE_INTEGER fileSize;
-	fileSize.QuadPart = 0;
-	if (!GetFileSizeEx(hFile, &fileSize)) {
-		dwLastIOError = GetLastError();
-		CloseHandle(hFile);
+static bool CanLoadFileMapped(LONGLONG fileSize) noexcept {
+	if (dwFileMappingThreshold == 0 || fileSize < (static_cast<LONGLONG>(dwFileMappingThreshold) << 20)) {
 		return false;
 	}
+	// encoding detection may read beyond the file size, bytes after end of file
+	// inside last page of the view are zero, check there are enough padding bytes.
+	SYSTEM_INFO info;
+	GetSystemInfo(&info);
+	const DWORD pageSize = info.dwPageSize;
+	const DWORD tail = static_cast<DWORD>(fileSize) & (pageSize - 1);
+	return tail != 0 && tail <= pageSize - NP2_ENCODING_DETECTION_PADDING;
+}
+
+// ReadFile() and WriteFile() take DWORD as byte count, large buffer is transferred in chunks.
+#define NP2_FILE_IO_CHUNK_SIZE	(64U << 20)
+
+static BOOL EditReadFile(HANDLE hFile, char *lpData, size_t cbData, size_t *cbRead) noexcept {
+	size_t total = 0;
+	BOOL bSuccess = TRUE;
+	while (total < cbData) {
+		const DWORD request = static_cast<DWORD>(min<size_t>(cbData - total, NP2_FILE_IO_CHUNK_SIZE));
+		DWORD dwRead = 0;
+		bSuccess = ReadFile(hFile, lpData + total, request, &dwRead, nullptr);
+		total += dwRead;
+		if (!bSuccess || dwRead == 0) {
+			break;
+		}
+	}
+	*cbRead = total;
+	return bSuccess;
+}
 
-	// display real path name
-	PathGetRealPath(hFile, pszFile, pszFile);
+static BOOL EditWriteFile(HANDLE hFile, const char *lpData, size_t cbData) noexcept {
+	while (cbData != 0) {
+		const DWORD request = static_cast<DWORD>(min<size_t>(cbData, NP2_FILE_IO_CHUNK_SIZE));
+		DWORD dwWritten = 0;
+		if (!WriteFile(hFile, lpData, request, &dwWritten, nullptr) || dwWritten != request) {
+			return FALSE;
+		}
+		lpData += request;
+		cbData -= request;
+	}
+	return TRUE;
+}
 
-	// Check if a warning message should be displayed for large files
-#if defined(_WIN64)
-	// less than 1/2 available physical memory:
-	//     1. Buffers we allocated below or when saving file, depends on encoding.
-	//     2. Scintilla's content buffer and style buffer, see CellBuffer class.
-	//        The style buffer is disabled when using SCLEX_NULL (Text File, 2nd Text File, ANSI Art).
-	//        i.e. when default scheme is Text File or 2nd Text File, memory required to load the file
-	//        is about fileSize*2, buffers we allocated below can be reused by system to served
-	//        as Scintilla's style buffer when calling SciCall_SetLexer() inside Style_SetLexer().
-	//     3. Extra memory when moving gaps on editing, it may require more than 2/3 physical memory.
-	// large file TODO: https://github.com/zufuliu/notepad4/issues/125
-	// [ ] [> 4 GiB] use SetFilePointerEx() and ReadFile()/WriteFile() to read/write file.
-	// [-] [> 1 GiB] fix encoding conversion with MultiByteToWideChar() and WideCharToMultiByte().
-	LONGLONG maxFileSize = INT64_C(4) << 30;
-#else
-	// 2 GiB: ptrdiff_t / Sci_Position used in Scintilla
-	LONGLONG maxFileSize = INT64_C(2) << 30;
-#endif
+// read large file on background thread to keep UI responsive, reading can be canceled with Esc.
+#define NP2_ASYNC_LOAD_MIN_SIZE		(16U << 20)
+#define NP2_ASYNC_LOAD_CHUNK_SIZE	(4U << 20)
+
+// wait for file I/O worker, shows progress on status bar, Esc to cancel.
+static void EditWaitFileWorker(HANDLE hThread, const BackgroundWorker &worker, const volatile LONG &progress, UINT uidFormat, LPCWSTR pszFile) noexcept {
+	WCHAR tchFormat[128];
+	WCHAR tchMessage[MAX_PATH + 128];
+	FormatString(tchMessage, tchFormat, uidFormat, pszFile);
+	const int length = lstrlen(tchMessage);
+	WCHAR tchStatus[MAX_PATH + 128 + 16];
+	LONG lastProgress = -1;
+	// only keyboard and paint messages are retrieved, other messages (including sent messages)
+	// are kept in the queue to avoid re-entering file I/O from commands, timers or WM_COPYDATA.
+	while (MsgWaitForMultipleObjects(1, &hThread, FALSE, USER_TIMER_MINIMUM*10, QS_KEY | QS_PAINT) != WAIT_OBJECT_0) {
+		MSG msg;
+		while (PeekMessage(&msg, nullptr, WM_KEYFIRST, WM_KEYLAST, PM_REMOVE | PM_QS_INPUT)) {
+			if (msg.message == WM_KEYDOWN && msg.wParam == VK_ESCAPE) {
+				SetEvent(worker.eventCancel);
+			}
+		}
+		while (PeekMessage(&msg, nullptr, WM_PAINT, WM_PAINT, PM_REMOVE | PM_QS_PAINT)) {
+			DispatchMessage(&msg);
+		}
+		const LONG current = progress;
+		if (current != lastProgress) {
+			lastProgress = current;
+			memcpy(tchStatus, tchMessage, length*sizeof(WCHAR));
+			wsprintf(tchStatus + length, L" %d%%", static_cast<int>(current));
+			StatusSetText(hwndStatus, STATUS_HELP, tchStatus);
+		}
+	}
+}
+
+struct FileReadWorker {
+	BackgroundWorker worker;
+	HANDLE hFile;
+	char *lpData;
+	size_t cbData;
+	size_t cbRead;
+	volatile LONG progress;	// percent of bytes read, updated by worker thread
+	BOOL bSuccess;
+	DWORD dwLastError;
+};
 
-	MEMORYSTATUSEX statex;
-	statex.dwLength = sizeof(statex);
-	statex.ullTotalPhys = 0;
-	GlobalMemoryStatusEx(&statex);
-	const ULONGLONG maxMem = statex.ullTotalPhys/2U;
-	if (maxMem < static_cast<ULONGLONG>(maxFileSize)) {
-		maxFileSize = static_cast<LONGLONG>(maxMem);
+static DWORD WINAPI EditReadFileThread(LPVOID lpParam) noexcept {
+	FileReadWorker * const reader = static_cast<FileReadWorker *>(lpParam);
+	const size_t cbData = reader->cbData;
+	size_t total = 0;
+	BOOL bSuccess = TRUE;
+	DWORD dwLastError = ERROR_SUCCESS;
+	while (total < cbData) {
+		if (!reader->worker.Continue()) {
+			bSuccess = FALSE;
+			dwLastError = ERROR_CANCELLED;
+			break;
+		}
+		const DWORD request = static_cast<DWORD>(min<size_t>(cbData - total, NP2_ASYNC_LOAD_CHUNK_SIZE));
+		DWORD dwRead = 0;
+		bSuccess = ReadFile(reader->hFile, reader->lpData + total, request, &dwRead, nullptr);
+		dwLastError = GetLastError();
+		total += dwRead;
+		if (!bSuccess || dwRead == 0) {
+			break;
+		}
+		InterlockedExchange(&reader->progress, static_cast<LONG>((static_cast<ULONGLONG>(total) * 100U) / cbData));
 	}
+	reader->cbRead = total;
+	reader->bSuccess = bSuccess;
+	reader->dwLastError = dwLastError;
+	return 0;
+}
 
-	if (fileSize.QuadPart > maxFileSize) {
-		CloseHandle(hFile);
-		status.bFileTooBig = true;
-		WCHAR tchDocSize[32];
-		WCHAR tchMaxSize[32];
-		WCHAR tchDocBytes[32];
-		WCHAR tchMaxBytes[32];
-		StrFormatByteSize(fileSize.QuadPart, tchDocSize, COUNTOF(tchDocSize));
-		StrFormatByteSize(maxFileSize, tchMaxSize, COUNTOF(tchMaxSize));
-		FormatNumber64(tchDocBytes, fileSize.QuadPart);
-		FormatNumber64(tchMaxBytes, maxFileSize);
-		MsgBoxWarn(MB_OK, IDS_WARNLOADBIGFILE, pszFile, tchDocSize, tchDocBytes, tchMaxSize, tchMaxBytes);
-		return false;
+static BOOL EditReadFileAsync(HANDLE hFile, LPCWSTR pszFile, char *lpData, size_t cbData, size_t *cbRead) noexcept {
+	FileReadWorker reader;
+	memset(&reader, 0, sizeof(reader));
+	reader.hFile = hFile;
+	reader.lpData = lpData;
+	reader.cbData = cbData;
+	reader.worker.Init(hwndMain);
+	HANDLE hThread = CreateThread(nullptr, 0, EditReadFileThread, &reader, 0, nullptr);
+	if (hThread == nullptr) {
+		reader.worker.Destroy();
+		return EditReadFile(hFile, lpData, cbData, cbRead);
 	}
 
-	char *lpData = static_cast<char *>(NP2HeapAlloc(static_cast<size_t>(fileSize.QuadPart) + NP2_ENCODING_DETECTION_PADDING*2));
-	char *lpDataUTF8 = reinterpret_cast<char *>(NP2_align_up(reinterpret_cast<uintptr_t>(lpData), NP2_ENCODING_DETECTION_PADDING));
-	DWORD cbData = 0;
-	const BOOL bReadSuccess = ReadFile(hFile, lpDataUTF8, static_cast<DWORD>(fileSize.QuadPart), &cbData, nullptr);
-	dwLastIOError = GetLastError();
-	CloseHandle(hFile);
+	EditWaitFileWorker(hThread, reader.worker, reader.progress, IDS_LOADFILE, pszFile);
+	CloseHandle(hThread);
+	CloseHandle(reader.worker.eventCancel);
+	*cbRead = reader.cbRead;
+	SetLastError(reader.dwLastError);
+	return reader.bSuccess;
+}
 
-	if (!bReadSuccess) {
-		NP2HeapFree(lpData);
-		return false;
-	}
+// convert UTF-8 document into UTF-16 or code page from mEncoding slice by slice to limit memory usage,
+// each slice ends at character boundary, so surrogate pair is not split.
+#define NP2_ENCODE_SLICE_SIZE	(1U << 20)
 
-	status.iEOLMode = GetScintillaEOLMode(iDefaultEOLMode);
-	status.bInconsistent = false;
-	status.totalLineCount = 1;
+struct TextEncoder {
+	UINT uCodePage;		// 0 for UTF-16
+	DWORD dwFlags;
+	bool bReverse;
+	LPWSTR lpWide;		// UTF-16 slice for code page conversion
 
-	int encodingFlag = EncodingFlag_None;
-	int iEncoding = EditDetermineEncoding(pszFile, lpDataUTF8, cbData, &encodingFlag);
-	if (iEncoding == CPI_DEFAULT && encodingFlag == EncodingFlag_UTF7) {
-		iEncoding = Encoding_GetAnsiIndex();
+	bool Init(int iEncoding) noexcept;
+	void Release() const noexcept {
+		if (lpWide != nullptr) {
+			NP2HeapFree(lpWide);
+		}
 	}
-	status.iEncoding = iEncoding;
-	status.bBinaryFile = encodingFlag & EncodingFlag_Binary;
-	UINT uFlags = mEncoding[iEncoding].uFlags;
+	size_t OutputSize() const noexcept {
+		// four bytes for each UTF-16 code unit, Encode() will enlarge the buffer when required
+		return NP2_ENCODE_SLICE_SIZE*sizeof(WCHAR)*((uCodePage == 0) ? 1 : 2);
+	}
+	bool HasDataLoss(const char *lpData, size_t cbData) const noexcept;
+	size_t Encode(const char *lpData, size_t cbData, char *&lpOutput, DWORD &cbOutput) const noexcept;
+};
 
-	if (cbData == 0) {
-		SciCall_SetCodePage((uFlags & NCP_DEFAULT) ? iDefaultCodePage : SC_CP_UTF8);
-		EditSetEmptyText();
-		SciCall_SetEOLMode(status.iEOLMode);
-		NP2HeapFree(lpData);
+static inline size_t GetUTF8SliceLength(const char *lpData, size_t cbData) noexcept {
+	if (cbData <= NP2_ENCODE_SLICE_SIZE) {
+		return cbData;
+	}
+	size_t length = NP2_ENCODE_SLICE_SIZE;
+	// move trailing bytes into next slice
+	for (UINT k = 0; k < kMaxMultiByteCount && (static_cast<uint8_t>(lpData[length]) & 0xC0) == 0x80; k++) {
+		--length;
+	}
+	return length;
+}
+
+bool TextEncoder::Init(int iEncoding) noexcept {
+	const UINT uFlags = mEncoding[iEncoding].uFlags;
+	lpWide = nullptr;
+	if (uFlags & NCP_UNICODE) {
+		uCodePage = 0;
+		dwFlags = 0;
+		bReverse = (uFlags & NCP_UNICODE_REVERSE) != 0;
 		return true;
 	}
 
-	DWORD offset = 0; // include BOM to make lpDataUTF8 aligned
-	if (uFlags & NCP_UTF8) {
-		if (uFlags & NCP_UTF8_SIGN) {
-			offset = 3;
-			lpDataUTF8 += 3;
-			cbData -= 3;
+	uCodePage = mEncoding[iEncoding].uCodePage;
+	dwFlags = IsZeroFlagsCodePage(uCodePage) ? 0 : WC_NO_BEST_FIT_CHARS;
+	bReverse = false;
+	lpWide = static_cast<LPWSTR>(NP2HeapAlloc(NP2_ENCODE_SLICE_SIZE*sizeof(WCHAR)));
+	return lpWide != nullptr;
+}
+
+bool TextEncoder::HasDataLoss(const char *lpData, size_t cbData) const noexcept {
+	if (dwFlags == 0) {
+		return false;
+	}
+	while (cbData != 0) {
+		const size_t length = GetUTF8SliceLength(lpData, cbData);
+		const int cchWide = MultiByteToWideChar(CP_UTF8, 0, lpData, static_cast<int>(length), lpWide, NP2_ENCODE_SLICE_SIZE);
+		BOOL bDataLoss = FALSE;
+		WideCharToMultiByte(uCodePage, dwFlags, lpWide, cchWide, nullptr, 0, nullptr, &bDataLoss);
+		if (bDataLoss) {
+			return true;
 		}
-	} else if (uFlags & NCP_UNICODE) {
-		LPCWSTR pszTextW = (uFlags & NCP_UNICODE_BOM) ? (reinterpret_cast<LPWSTR>(lpDataUTF8) + 1) : reinterpret_cast<LPWSTR>(lpDataUTF8);
-		// NOTE: requires two extra trailing NULL bytes.
-		const DWORD cchTextW = (uFlags & NCP_UNICODE_BOM) ? (cbData / sizeof(WCHAR)) : ((cbData / sizeof(WCHAR)) + 1);
-		if ((uFlags & NCP_UNICODE_REVERSE) != 0 && encodingFlag != EncodingFlag_Reversed) {
-			_swab(lpDataUTF8, lpDataUTF8, cbData);
+		lpData += length;
+		cbData -= length;
+	}
+	return false;
+}
+
+// returns number of bytes converted from lpData, or 0 on failure.
+size_t TextEncoder::Encode(const char *lpData, size_t cbData, char *&lpOutput, DWORD &cbOutput) const noexcept {
+	const size_t length = GetUTF8SliceLength(lpData, cbData);
+	if (uCodePage == 0) {
+		LPWSTR lpDataWide = reinterpret_cast<LPWSTR>(lpOutput);
+		const int cchWide = MultiByteToWideChar(CP_UTF8, 0, lpData, static_cast<int>(length), lpDataWide, NP2_ENCODE_SLICE_SIZE);
+		cbOutput = cchWide * sizeof(WCHAR);
+		if (bReverse) {
+			_swab(lpOutput, lpOutput, static_cast<int>(cbOutput));
 		}
-		// cbData/2 => WCHAR, WCHAR*3 => UTF-8
-		lpDataUTF8 = static_cast<char *>(NP2HeapAlloc((cbData + 1)*sizeof(WCHAR)));
-		const int size = static_cast<int>(NP2HeapSize(lpDataUTF8));
-		cbData = WideCharToMultiByte(CP_UTF8, 0, pszTextW, cchTextW, lpDataUTF8, size, nullptr, nullptr);
-		if (cbData == 0) {
-			const UINT legacyACP = mEncoding[CPI_DEFAULT].uCodePage;
-			cbData = WideCharToMultiByte(legacyACP, 0, pszTextW, -1, lpDataUTF8, size, nullptr, nullptr);
-			status.bUnicodeErr = true;
+		return (cchWide == 0) ? 0 : length;
+	}
+
+	const int cchWide = MultiByteToWideChar(CP_UTF8, 0, lpData, static_cast<int>(length), lpWide, NP2_ENCODE_SLICE_SIZE);
+	int cbConverted = WideCharToMultiByte(uCodePage, dwFlags, lpWide, cchWide, lpOutput, static_cast<int>(NP2HeapSize(lpOutput)), nullptr, nullptr);
+	if (cbConverted == 0 && GetLastError() == ERROR_INSUFFICIENT_BUFFER) {
+		const int cbSize = WideCharToMultiByte(uCodePage, dwFlags, lpWide, cchWide, nullptr, 0, nullptr, nullptr);
+		char * const lpBuffer = static_cast<char *>(NP2HeapReAlloc(lpOutput, cbSize));
+		if (lpBuffer == nullptr) {
+			SetLastError(ERROR_NOT_ENOUGH_MEMORY);
+			return 0;
 		}
-		if (cbData != 0) {
-			// remove the NULL terminator.
-			cbData -= 1;
+		lpOutput = lpBuffer;
+		cbConverted = WideCharToMultiByte(uCodePage, dwFlags, lpWide, cchWide, lpOutput, cbSize, nullptr, nullptr);
+	}
+	cbOutput = cbConverted;
+	return (cbConverted == 0) ? 0 : length;
+}
+
+static BOOL EditWriteFileEncoded(HANDLE hFile, const char *lpData, size_t cbData, const TextEncoder &encoder) noexcept {
+	char *lpOutput = static_cast<char *>(NP2HeapAlloc(encoder.OutputSize()));
+	if (lpOutput == nullptr) {
+		SetLastError(ERROR_NOT_ENOUGH_MEMORY);
+		return FALSE;
+	}
+	BOOL bSuccess = TRUE;
+	while (cbData != 0) {
+		DWORD cbOutput = 0;
+		const size_t length = encoder.Encode(lpData, cbData, lpOutput, cbOutput);
+		bSuccess = length != 0 && EditWriteFile(hFile, lpOutput, cbOutput);
+		if (!bSuccess) {
+			break;
 		}
+		lpData += length;
+		cbData -= length;
+	}
+	const DWORD dwLastError = GetLastError();
+	NP2HeapFree(lpOutput);
+	SetLastError(dwLastError);
+	return bSuccess;
+}
+
+// large file is written into a temporary file in same folder with overlapped I/O on background
+// thread, then the original file is replaced with it, the original is untouched when saving failed.
+#define NP2_ASYNC_SAVE_CHUNK_SIZE		(4U << 20)
+#define NP2_ASYNC_SAVE_PENDING_COUNT	2
+
+struct FileWriteWorker {
+	BackgroundWorker worker;
+	HANDLE hFile;
+	const char *lpData;
+	size_t cbData;
+	const TextEncoder *encoder;	// nullptr to write data without conversion
+	DWORD bom;
+	DWORD bomLength;
+	volatile LONG progress;	// percent of data written, updated by worker thread
+	BOOL bSuccess;
+	DWORD dwLastError;
+};
 
-		NP2HeapFree(lpData);
-		lpData = lpDataUTF8;
-		fvCurFile.Init(lpData, cbData);
-	} else if (uFlags & (NCP_8BIT | NCP_7BIT)) {
-		if (encodingFlag != EncodingFlag_UTF7 || (uFlags & NCP_7BIT) != 0) {
-			const UINT uCodePage = mEncoding[iEncoding].uCodePage;
-			lpDataUTF8 = RecodeAsUTF8(lpDataUTF8, &cbData, uCodePage, 0);
-			NP2HeapFree(lpData);
-			lpData = lpDataUTF8;
+static DWORD WINAPI EditWriteFileThread(LPVOID lpParam) noexcept {
+	FileWriteWorker * const writer = static_cast<FileWriteWorker *>(lpParam);
+	const TextEncoder * const encoder = writer->encoder;
+	const size_t cbData = writer->cbData;
+	OVERLAPPED overlapped[NP2_ASYNC_SAVE_PENDING_COUNT];
+	DWORD requested[NP2_ASYNC_SAVE_PENDING_COUNT];
+	size_t positions[NP2_ASYNC_SAVE_PENDING_COUNT];
+	char *buffers[NP2_ASYNC_SAVE_PENDING_COUNT];
+	memset(overlapped, 0, sizeof(overlapped));
+	memset(requested, 0, sizeof(requested));
+	memset(buffers, 0, sizeof(buffers));
+	BOOL bSuccess = TRUE;
+	DWORD dwLastError = ERROR_SUCCESS;
+	for (UINT i = 0; i < NP2_ASYNC_SAVE_PENDING_COUNT; i++) {
+		overlapped[i].hEvent = CreateEvent(nullptr, TRUE, FALSE, nullptr);
+		if (encoder != nullptr) {
+			buffers[i] = static_cast<char *>(NP2HeapAlloc(encoder->OutputSize()));
+			if (buffers[i] == nullptr) {
+				bSuccess = FALSE;
+				dwLastError = ERROR_NOT_ENOUGH_MEMORY;
+			}
+		}
+	}
+
+	ULONGLONG offset = 0;
+	size_t position = 0;
+	bool bomPending = writer->bomLength != 0;
+	UINT pending = 0;
+	UINT index = 0;
+	while (bSuccess && (bomPending || position < cbData || pending != 0)) {
+		OVERLAPPED * const ov = overlapped + index;
+		if (requested[index] != 0) {
+			DWORD dwWritten = 0;
+			bSuccess = GetOverlappedResult(writer->hFile, ov, &dwWritten, TRUE);
+			dwLastError = GetLastError();
+			--pending;
+			if (bSuccess && dwWritten != requested[index]) {
+				bSuccess = FALSE;
+				dwLastError = ERROR_WRITE_FAULT;
+			}
+			requested[index] = 0;
+			if (!bSuccess) {
+				break;
+			}
+			if (cbData != 0) {
+				InterlockedExchange(&writer->progress, static_cast<LONG>((static_cast<ULONGLONG>(positions[index]) * 100U) / cbData));
+			}
 		}
-	} else if (cbData < MAX_NON_UTF8_SIZE && (encodingFlag & (EncodingFlag_Binary | EncodingFlag_Invalid)) == 0
-		&& ((bLoadANSIasUTF8 && !(iSrcEncoding == CPI_DEFAULT || iWeakSrcEncoding == CPI_DEFAULT))
-		|| (GetACP() == CP_UTF8))) {
-		// try to load ANSI / unknown encoding as UTF-8
-		DWORD back = cbData;
-		const UINT legacyACP = mEncoding[CPI_DEFAULT].uCodePage;
-		char * const result = RecodeAsUTF8(lpDataUTF8, &back, legacyACP, MB_ERR_INVALID_CHARS);
-		if (result) {
-			NP2HeapFree(lpData);
-			lpDataUTF8 = result;
-			lpData = result;
-			cbData = back;
-			uFlags = 0;
-			status.iEncoding = Encoding_GetIndex(legacyACP);
+		if (bomPending || position < cbData) {
+			if (!writer->worker.Continue()) {
+				bSuccess = FALSE;
+				dwLastError = ERROR_CANCELLED;
+				break;
+			}
+			const char *buffer;
+			DWORD request;
+			if (bomPending) {
+				bomPending = false;
+				buffer = reinterpret_cast<const char *>(&writer->bom);
+				request = writer->bomLength;
+			} else if (encoder != nullptr) {
+				const size_t length = encoder->Encode(writer->lpData + position, cbData - position, buffers[index], request);
+				if (length == 0) {
+					bSuccess = FALSE;
+					dwLastError = GetLastError();
+					break;
+				}
+				buffer = buffers[index];
+				position += length;
+			} else {
+				buffer = writer->lpData + position;
+				request = static_cast<DWORD>(min<size_t>(cbData - position, NP2_ASYNC_SAVE_CHUNK_SIZE));
+				position += request;
+			}
+			positions[index] = position;
+			ov->Offset = static_cast<DWORD>(offset);
+			ov->OffsetHigh = static_cast<DWORD>(offset >> 32);
+			if (!WriteFile(writer->hFile, buffer, request, nullptr, ov) && GetLastError() != ERROR_IO_PENDING) {
+				bSuccess = FALSE;
+				dwLastError = GetLastError();
+				break;
+			}
+			requested[index] = request;
+			++pending;
+			offset += request;
 		}
+		index = (index + 1) % NP2_ASYNC_SAVE_PENDING_COUNT;
 	}
 
-	if (cbData) {
-		// StopWatch watch;
-		// watch.Start();
-		EditDetectEOLMode(lpDataUTF8 - offset, cbData + offset, status);
-		// watch.Stop();
-		// watch.ShowLog("EOL time");
-		// printf("CR+LF: %zu, LF: %zu, CR: %zu\n", status.linesCount[SC_EOL_CRLF], status.linesCount[SC_EOL_LF], status.linesCount[SC_EOL_CR]);
-		EditDetectIndentation(lpDataUTF8, cbData, fvCurFile);
+	if (pending != 0) {
+		CancelIo(writer->hFile);
+		for (UINT i = 0; i < NP2_ASYNC_SAVE_PENDING_COUNT; i++) {
+			if (requested[i] != 0) {
+				DWORD dwWritten;
+				GetOverlappedResult(writer->hFile, overlapped + i, &dwWritten, TRUE);
+			}
+		}
 	}
-	SciCall_SetCodePage((uFlags & NCP_DEFAULT) ? iDefaultCodePage : SC_CP_UTF8);
-	EditSetNewText(lpDataUTF8, cbData, status.totalLineCount);
-
-	NP2HeapFree(lpData);
-	return true;
+	for (UINT i = 0; i < NP2_ASYNC_SAVE_PENDING_COUNT; i++) {
+		CloseHandle(overlapped[i].hEvent);
+		if (buffers[i] != nullptr) {
+			NP2HeapFree(buffers[i]);
+		}
+	}
+	writer->bSuccess = bSuccess;
+	writer->dwLastError = dwLastError;
+	return 0;
 }
 
-//=============================================================================
-//
-// EditSaveFile()
-//
-bool EditSaveFile(HWND hwnd, LPCWSTR pszFile, int saveFlag, EditFileIOStatus &status) noexcept {
-	HANDLE hFile = CreateFile(pszFile,
-					   GENERIC_READ | GENERIC_WRITE,
-					   FILE_SHARE_READ | FILE_SHARE_WRITE,
-					   nullptr, OPEN_ALWAYS,
-					   FILE_ATTRIBUTE_NORMAL,
-					   nullptr);
-	dwLastIOError = GetLastError();
+static BOOL EditWriteFileAsync(HANDLE hFile, LPCWSTR pszFile, const char *lpData, size_t cbData, const TextEncoder *encoder, DWORD bom, DWORD bomLength, int saveFlag) noexcept {
+	FileWriteWorker writer;
+	memset(&writer, 0, sizeof(writer));
+	writer.hFile = hFile;
+	writer.lpData = lpData;
+	writer.cbData = cbData;
+	writer.encoder = encoder;
+	writer.bom = bom;
+	writer.bomLength = bomLength;
+	writer.worker.Init(hwndMain);
+	// message loop is not run while ending session
+	HANDLE hThread = (saveFlag & FileSaveFlag_EndSession) ? nullptr : CreateThread(nullptr, 0, EditWriteFileThread, &writer, 0, nullptr);
+	if (hThread == nullptr) {
+		EditWriteFileThread(&writer);
+	} else {
+		EditWaitFileWorker(hThread, writer.worker, writer.progress, IDS_SAVEFILE, pszFile);
+		CloseHandle(hThread);
+	}
+	CloseHandle(writer.worker.eventCancel);
+	SetLastError(writer.dwLastError);
+	return writer.bSuccess;
+}
 
-	// failure could be due to missing attributes (Windows 2000, XP)
-	if (hFile == INVALID_HANDLE_VALUE) {
-		DWORD dwAttributes = GetFileAttributes(pszFile);
-		if (dwAttributes != INVALID_FILE_ATTRIBUTES) {
-			dwAttributes = dwAttributes & (FILE_ATTRIBUTE_HIDDEN | FILE_ATTRIBUTE_SYSTEM);
-			hFile = CreateFile(pszFile,
-							   GENERIC_READ | GENERIC_WRITE,
-							   FILE_SHARE_READ | FILE_SHARE_WRITE,
-							   nullptr,
-							   OPEN_ALWAYS,
-							   FILE_ATTRIBUTE_NORMAL | dwAttributes,
-							   nullptr);
-			dwLastIOError = GetLastError();
-		}
+// returns handle to the temporary file when the existing file can be replaced.
+static HANDLE EditCreateTempFile(LPCWSTR pszFile, LPWSTR pszTempFile, int &saveFlag, FILE_BASIC_INFO &timestamp) noexcept {
+	if (dwAtomicSaveThreshold == 0 || SciCall_GetLength() < (static_cast<Sci_Position>(dwAtomicSaveThreshold) << 20)) {
+		return INVALID_HANDLE_VALUE;
 	}
 
+	HANDLE hFile = CreateFile(pszFile,
+					   FILE_READ_ATTRIBUTES,
+					   FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+					   nullptr, OPEN_EXISTING,
+					   FILE_FLAG_OPEN_REPARSE_POINT,
+					   nullptr);
 	if (hFile == INVALID_HANDLE_VALUE) {
-		return false;
+		return INVALID_HANDLE_VALUE;
 	}
-
-	FILE_BASIC_INFO timestamp;
-	if (saveFlag & FileSaveFlag_OriginalTimestamp) {
+	// replacing breaks hard link and symbolic link, read-only file is not saved
+	BY_HANDLE_FILE_INFORMATION info;
+	bool replaceable = GetFileInformationByHandle(hFile, &info) && info.nNumberOfLinks == 1
+		&& (info.dwFileAttributes & (FILE_ATTRIBUTE_READONLY | FILE_ATTRIBUTE_REPARSE_POINT)) == 0;
+	if (replaceable && (saveFlag & FileSaveFlag_OriginalTimestamp)) {
 		if (!GetFileInformationByHandleEx(hFile, FileBasicInfo, &timestamp, sizeof(timestamp))) {
 			saveFlag &= ~FileSaveFlag_OriginalTimestamp;
 		}
 	}
+	CloseHandle(hFile);
 
-	if (!(saveFlag & FileSaveFlag_EndSession) && !bReadOnlyMode) {
-		// ensure consistent line endings
-		if (bFixLineEndings) {
-			EditEnsureConsistentLineEndings();
-		}
+	WCHAR szFolder[MAX_PATH];
+	lstrcpyn(szFolder, pszFile, COUNTOF(szFolder));
+	PathRemoveFileSpec(szFolder);
+	replaceable = replaceable && GetTempFileName(szFolder, L"np4", 0, pszTempFile) != 0;
+	if (!replaceable) {
+		return INVALID_HANDLE_VALUE;
+	}
 
-		// strip trailing blanks
-		if (bAutoStripBlanks) {
-			EditStripTrailingBlanks(hwnd, true);
-		}
+	hFile = CreateFile(pszTempFile,
+					   GENERIC_WRITE,
+					   0,
+					   nullptr, CREATE_ALWAYS,
+					   FILE_ATTRIBUTE_NORMAL | FILE_FLAG_OVERLAPPED | FILE_FLAG_SEQUENTIAL_SCAN,
+					   nullptr);
+	if (hFile == INVALID_HANDLE_VALUE) {
+		DeleteFile(pszTempFile);
 	}
+	return hFile;
+}
 
-	// get text
-	DWORD cbData = static_cast<DWORD>(SciCall_GetLength());
-	char *lpData = nullptr;
-	const int iEncoding = status.iEncoding;
-	UINT uFlags = mEncoding[iEncoding].uFlags;
+// convert large UTF-16 text to UTF-8 in parallel: the first pass (with optional byte swap)
+// computes converted size for each part, then the second pass converts into exact sized buffer.
+#define NP2_PARALLEL_CONVERT_MIN_SIZE	(8U << 20)
+#define NP2_PARALLEL_CONVERT_MAX_PART	(1U << 28)
+#define NP2_PARALLEL_CONVERT_MAX_THREAD	MAX_PARALLEL_WORKER_COUNT
 
-	// get content and convert encoding
-	if (cbData != 0) {
-		if (cbData >= MAX_NON_UTF8_SIZE) {
-			// save as UTF-8 or ANSI
-			if (!(uFlags & (NCP_DEFAULT | NCP_UTF8))) {
-				// iEncoding = (uFlags & NCP_UNICODE_BOM) ? CPI_UTF8SIGN : CPI_UTF8;
-				// uFlags = mEncoding[iEncoding].uFlags;
-				uFlags = (uFlags & NCP_UNICODE_BOM) ? NCP_UTF8_SIGN : NCP_UTF8;
-			}
-		}
+struct UTF16ToUTF8Part {
+	LPWSTR lpText;
+	size_t cchText;
+	char *lpOutput;
+	size_t cbOutput;
+	bool bReverse;
+};
 
-		lpData = static_cast<char *>(NP2HeapAlloc(cbData + 1));
-		SciCall_GetText(cbData, lpData);
-#if 0
-		// FIXME: move checks in front of disk file access
-		if ((uFlags & (NCP_UNICODE | NCP_UTF8_SIGN)) == 0) {
-			EditFileVars fv;
-			fv.Init(lpData, cbData);
-			const int iAltEncoding = fv.GetEncoding();
-			if (iAltEncoding >= CPI_FIRST && iAltEncoding != iEncoding
-				&& !((uFlags & NCP_UTF8) && (mEncoding[iAltEncoding].uFlags & NCP_UTF8))) {
-				Encoding_GetLabel(iAltEncoding);
-				Encoding_GetLabel(iEncoding);
-				InfoBoxWarn(MB_OK, L"MsgEncodingMismatch", IDS_ENCODINGMISMATCH,
-					mEncoding[iAltEncoding].wchLabel,
-					mEncoding[iEncoding].wchLabel);
-			}
+static DWORD WINAPI UTF16ToUTF8Thread(LPVOID lpParam) noexcept {
+	UTF16ToUTF8Part * const part = static_cast<UTF16ToUTF8Part *>(lpParam);
+	const int cchText = static_cast<int>(part->cchText);
+	if (part->lpOutput == nullptr) {
+		if (part->bReverse) {
+			char * const lpData = reinterpret_cast<char *>(part->lpText);
+			_swab(lpData, lpData, cchText*static_cast<int>(sizeof(WCHAR)));
 		}
-#endif
-
-		if (uFlags & (NCP_UTF8 | NCP_DEFAULT)) {
-			// no encoding conversion for UTF-8 or ANSI
-		} else if (uFlags & NCP_UNICODE) {
-			LPWSTR lpDataWide = static_cast<LPWSTR>(NP2HeapAlloc(cbData * sizeof(WCHAR) + 16));
-			const int cbDataWide = MultiByteToWideChar(CP_UTF8, 0, lpData, cbData, lpDataWide, static_cast<int>(NP2HeapSize(lpDataWide) / sizeof(WCHAR)));
-			NP2HeapFree(lpData);
-			lpData = reinterpret_cast<char *>(lpDataWide);
-			cbData = cbDataWide * sizeof(WCHAR);
-
-			if (uFlags & NCP_UNICODE_REVERSE) {
-				_swab(lpData, lpData, cbData);
-			}
-		} else { // NCP_8BIT, NCP_7BIT
-			BOOL bCancelDataLoss = FALSE;
-			const UINT uCodePage = mEncoding[iEncoding].uCodePage;
+		part->cbOutput = WideCharToMultiByte(CP_UTF8, 0, part->lpText, cchText, nullptr, 0, nullptr, nullptr);
+	} else {
+		WideCharToMultiByte(CP_UTF8, 0, part->lpText, cchText, part->lpOutput, static_cast<int>(part->cbOutput), nullptr, nullptr);
+	}
+	return 0;
+}
 
-			LPWSTR lpDataWide = static_cast<LPWSTR>(NP2HeapAlloc(cbData * sizeof(WCHAR) + 16));
-			const int cbDataWide = MultiByteToWideChar(CP_UTF8, 0, lpData, cbData, lpDataWide, static_cast<int>(NP2HeapSize(lpDataWide) / sizeof(WCHAR)));
+static inline void UTF16ToUTF8RunParts(UTF16ToUTF8Part *parts, UINT count) noexcept {
+	RunParallelWorker(UTF16ToUTF8Thread, parts, sizeof(UTF16ToUTF8Part), count);
+}
 
-			if (IsZeroFlagsCodePage(uCodePage)) {
-				NP2HeapFree(lpData);
-				lpData = static_cast<char *>(NP2HeapAlloc(NP2HeapSize(lpDataWide) * 2));
-			} else {
-				memset(lpData, 0, NP2HeapSize(lpData));
-				cbData = WideCharToMultiByte(uCodePage, WC_NO_BEST_FIT_CHARS, lpDataWide, cbDataWide, lpData, static_cast<int>(NP2HeapSize(lpData)), nullptr, &bCancelDataLoss);
-			}
+static char *EditConvertUTF16ToUTF8(LPWSTR lpText, size_t cchText, bool bReverse, size_t *cbOutput) noexcept {
+	SYSTEM_INFO info;
+	GetSystemInfo(&info);
+	UINT count = static_cast<UINT>(min<size_t>(info.dwNumberOfProcessors, cchText / (NP2_PARALLEL_CONVERT_MIN_SIZE / 2)));
+	count = max<UINT>(count, static_cast<UINT>((cchText + NP2_PARALLEL_CONVERT_MAX_PART - 1) / NP2_PARALLEL_CONVERT_MAX_PART));
+	count = clamp<UINT>(count, 1, NP2_PARALLEL_CONVERT_MAX_THREAD);
 
-			if (!bCancelDataLoss) {
-				cbData = WideCharToMultiByte(uCodePage, 0, lpDataWide, cbDataWide, lpData, static_cast<int>(NP2HeapSize(lpData)), nullptr, nullptr);
+	UTF16ToUTF8Part parts[NP2_PARALLEL_CONVERT_MAX_THREAD];
+	memset(parts, 0, sizeof(parts));
+	const size_t partSize = cchText / count;
+	size_t start = 0;
+	for (UINT i = 0; i < count; i++) {
+		size_t end = (i + 1 == count) ? cchText : start + partSize;
+		if (end < cchText) {
+			// don't split surrogate pair, the text is not swapped yet.
+			WCHAR ch = lpText[end];
+			if (bReverse) {
+				ch = static_cast<WCHAR>((ch >> 8) | (ch << 8));
 			}
-			NP2HeapFree(lpDataWide);
-
-			if (bCancelDataLoss && InfoBoxWarn(MB_OKCANCEL, L"MsgConv3", IDS_ERR_UNICODE2) != IDOK) {
-				status.bCancelDataLoss = true;
-				CloseHandle(hFile);
-				NP2HeapFree(lpData);
-				return false;
+			if (IS_LOW_SURROGATE(ch)) {
+				++end;
 			}
 		}
+		parts[i].lpText = lpText + start;
+		parts[i].cchText = end - start;
+		parts[i].bReverse = bReverse;
+		start = end;
 	}
 
-	// write content
-	{
-		BOOL bWriteSuccess = SetEndOfFile(hFile);
-		DWORD dwBytesWritten;
-		// write encoding BOM
-		DWORD bom;
-		DWORD length = 0;
-		if (uFlags & NCP_UNICODE_BOM) {
-			bom = (uFlags & NCP_UNICODE_REVERSE) ? BOM_UTF16BE : BOM_UTF16LE;
-			length = 2;
-		} else if (uFlags & NCP_UTF8_SIGN) {
-			bom = BOM_UTF8;
-			length = 3;
-		}
-		if (length != 0) {
-			bWriteSuccess = WriteFile(hFile, &bom, length, &dwBytesWritten, nullptr);
-		}
-		dwLastIOError = GetLastError();
-		if (lpData != nullptr) {
-			bWriteSuccess = WriteFile(hFile, lpData, cbData, &dwBytesWritten, nullptr);
-			dwLastIOError = GetLastError();
-			NP2HeapFree(lpData);
-		}
-		if (saveFlag & FileSaveFlag_OriginalTimestamp) {
-			SetFileInformationByHandle(hFile, FileBasicInfo, &timestamp, sizeof(timestamp));
-		}
-		CloseHandle(hFile);
-		if (bWriteSuccess) {
-			if (!(saveFlag & FileSaveFlag_SaveCopy)) {
-				SciCall_SetSavePoint();
-			}
-			return true;
+	UTF16ToUTF8RunParts(parts, count);
+	size_t total = 0;
+	for (UINT i = 0; i < count; i++) {
+		total += parts[i].cbOutput;
+	}
+	char * const lpOutput = static_cast<char *>(NP2HeapAlloc(total + NP2_ENCODING_DETECTION_PADDING));
+	if (lpOutput != nullptr) {
+		total = 0;
+		for (UINT i = 0; i < count; i++) {
+			parts[i].lpOutput = lpOutput + total;
+			total += parts[i].cbOutput;
 		}
+		UTF16ToUTF8RunParts(parts, count);
 	}
-
-	return false;
+	*cbOutput = total;
+	return lpOutput;
 }
 
-void EditReplaceRange(Sci_Position iSelStart, Sci_Position iSelEnd, Sci_Position cchText, LPCSTR pszText) noexcept {
-	Sci_Position iCurPos = SciCall_GetCurrentPos();
-	Sci_Position iAnchorPos = SciCall_GetAnchor();
+// 8-bit and 7-bit encoded text is converted in chunks split after line feed,
+// as MultiByteToWideChar() and WideCharToMultiByte() take int sized length.
+#define NP2_RECODE_CHUNK_SIZE	(64U << 20)
 
-	if (iAnchorPos > iCurPos) {
-		iCurPos = iSelStart;
-		iAnchorPos = iSelStart + cchText;
-	} else {
-		iAnchorPos = iSelStart;
-		iCurPos = iSelStart + cchText;
+static size_t RecodeChunkLength(const char *lpData, size_t cbData) noexcept {
+	if (cbData <= NP2_RECODE_CHUNK_SIZE) {
+		return cbData;
 	}
-
-	SciCall_SetTargetRange(iSelStart, iSelEnd);
-	SciCall_ReplaceTarget(cchText, pszText);
-	SciCall_SetSel(iAnchorPos, iCurPos);
+	// line feed is never a trail byte of DBCS code page, and it ends UTF-7 shift sequence.
+	size_t length = NP2_RECODE_CHUNK_SIZE;
+	while (length != 0 && lpData[length - 1] != '\n') {
+		--length;
+	}
+	return (length != 0) ? length : NP2_RECODE_CHUNK_SIZE;
 }
 
-void EditReplaceMainSelection(Sci_Position cchText, LPCSTR pszText) noexcept {
-	EditReplaceRange(SciCall_GetSelectionStart(), SciCall_GetSelectionEnd(), cchText, pszText);
-}
+static char *EditRecodeAsUTF8(const char *lpData, size_t cbData, UINT codePage, size_t *cbOutput) noexcept {
+	LPWSTR lpWide = static_cast<LPWSTR>(NP2HeapAlloc(NP2_RECODE_CHUNK_SIZE*sizeof(WCHAR)));
+	if (lpWide == nullptr) {
+		*cbOutput = 0;
+		return nullptr;
+	}
 
-static inline char *EditGetTextRange(Sci_Position iStartPos, Sci_Position iEndPos) noexcept {
-	const Sci_Position len = iEndPos - iStartPos;
-	if (len <= 0) {
+	// first pass measures converted size, second pass converts into the output.
+	char *lpOutput = nullptr;
+	size_t total = 0;
+	bool bSuccess = true;
+	for (UINT pass = 0; bSuccess && pass < 2; pass++) {
+		size_t position = 0;
+		size_t written = 0;
+		while (position < cbData) {
+			const size_t length = RecodeChunkLength(lpData + position, cbData - position);
+			const int cchWide = MultiByteToWideChar(codePage, 0, lpData + position, static_cast<int>(length), lpWide, NP2_RECODE_CHUNK_SIZE);
+			if (cchWide == 0) {
+				bSuccess = false;
+				break;
+			}
+			char * const lpDest = (lpOutput == nullptr) ? nullptr : lpOutput + written;
+			const int cbDest = (lpOutput == nullptr) ? 0 : static_cast<int>(min<size_t>(total - written, INT_MAX));
+			written += WideCharToMultiByte(CP_UTF8, 0, lpWide, cchWide, lpDest, cbDest, nullptr, nullptr);
+			position += length;
+		}
+		if (bSuccess && pass == 0) {
+			total = written;
+			lpOutput = static_cast<char *>(NP2HeapAlloc(total + NP2_ENCODING_DETECTION_PADDING));
+			bSuccess = lpOutput != nullptr;
+		}
+	}
+
+	NP2HeapFree(lpWide);
+	if (!bSuccess) {
+		NP2HeapFree(lpOutput);
+		*cbOutput = 0;
 		return nullptr;
 	}
+	*cbOutput = total;
+	return lpOutput;
+}
 
-	char *mszBuf = static_cast<char *>(NP2HeapAlloc(len + 1));
-	const Sci_TextRangeFull tr = { { iStartPos, iEndPos }, mszBuf };
-	SciCall_GetTextRangeFull(&tr);
-	return mszBuf;
+// returns size of incomplete UTF-8 character at end of the data.
+static size_t GetUTF8IncompleteTailSize(const char *lpData, size_t cbData) noexcept {
+	for (size_t back = 1; back <= kMaxMultiByteCount + 1 && back <= cbData; back++) {
+		const uint8_t ch = lpData[cbData - back];
+		if ((ch & 0xC0) != 0x80) {
+			const size_t needed = (ch < 0xC0) ? 1 : ((ch < 0xE0) ? 2 : ((ch < 0xF0) ? 3 : 4));
+			return (needed > back) ? back : 0;
+		}
+	}
+	return 0;
 }
 
-// https://docs.microsoft.com/en-us/windows/win32/intl/transliteration-services
-#include <elscore.h>
-#if defined(__MINGW32__)
-#if defined(__has_include) && __has_include(<elssrvc.h>)
-#include <elssrvc.h>
-#else
-// {A3A8333B-F4FC-42f6-A0C4-0462FE7317CB}
-static const GUID ELS_GUID_TRANSLITERATION_HANT_TO_HANS =
-	{ 0xA3A8333B, 0xF4FC, 0x42f6, { 0xA0, 0xC4, 0x04, 0x62, 0xFE, 0x73, 0x17, 0xCB } };
+// validate whole file after UTF-8 encoding is detected from samples, APPM_INVALID_UTF8 is posted
+// to main window when invalid UTF-8 sequence is found.
+struct UTF8VerifyWorker {
+	BackgroundWorker worker;
+	WCHAR szFile[MAX_PATH];
+};
 
-// {3CACCDC8-5590-42dc-9A7B-B5A6B5B3B63B}
-static const GUID ELS_GUID_TRANSLITERATION_HANS_TO_HANT =
-	{ 0x3CACCDC8, 0x5590, 0x42dc, { 0x9A, 0x7B, 0xB5, 0xA6, 0xB5, 0xB3, 0xB6, 0x3B } };
+static UTF8VerifyWorker utf8Verifier;
 
-// {D8B983B1-F8BF-4a2b-BCD5-5B5EA20613E1}
-static const GUID ELS_GUID_TRANSLITERATION_MALAYALAM_TO_LATIN =
-	{ 0xD8B983B1, 0xF8BF, 0x4a2b, { 0xBC, 0xD5, 0x5B, 0x5E, 0xA2, 0x06, 0x13, 0xE1 } };
+static DWORD WINAPI EditVerifyUTF8Thread(LPVOID lpParam) noexcept {
+	UTF8VerifyWorker * const verifier = static_cast<UTF8VerifyWorker *>(lpParam);
+	const BackgroundWorker &worker = verifier->worker;
+	HANDLE hFile = CreateFile(verifier->szFile, GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE,
+		nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+	if (hFile == INVALID_HANDLE_VALUE) {
+		return 0;
+	}
 
-// {C4A4DCFE-2661-4d02-9835-F48187109803}
-static const GUID ELS_GUID_TRANSLITERATION_DEVANAGARI_TO_LATIN =
-	{ 0xC4A4DCFE, 0x2661, 0x4d02, { 0x98, 0x35, 0xF4, 0x81, 0x87, 0x10, 0x98, 0x03 } };
+	char * const buffer = static_cast<char *>(NP2HeapAlloc(NP2_ASYNC_LOAD_CHUNK_SIZE + kMaxMultiByteCount + 1));
+	bool valid = true;
+	if (buffer != nullptr) {
+		DWORD carry = 0;
+		while (valid && worker.Continue()) {
+			DWORD dwRead = 0;
+			if (!ReadFile(hFile, buffer + carry, NP2_ASYNC_LOAD_CHUNK_SIZE, &dwRead, nullptr) || dwRead == 0) {
+				// incomplete character at end of file
+				valid = carry == 0;
+				break;
+			}
+			DWORD length = carry + dwRead;
+			// keep incomplete character at chunk end for next chunk.
+			carry = static_cast<DWORD>(GetUTF8IncompleteTailSize(buffer, length));
+			length -= carry;
+			valid = IsUTF8(buffer, length);
+			memmove(buffer, buffer + length, carry);
+		}
+		NP2HeapFree(buffer);
+	}
+	CloseHandle(hFile);
 
-// {3DD12A98-5AFD-4903-A13F-E17E6C0BFE01}
-static const GUID ELS_GUID_TRANSLITERATION_CYRILLIC_TO_LATIN =
-	{ 0x3DD12A98, 0x5AFD, 0x4903, { 0xA1, 0x3F, 0xE1, 0x7E, 0x6C, 0x0B, 0xFE, 0x01 } };
+	if (!valid && worker.Continue()) {
+		PostMessage(worker.hwnd, APPM_INVALID_UTF8, 0, 0);
+	}
+	return 0;
+}
 
-// {F4DFD825-91A4-489f-855E-9AD9BEE55727}
-static const GUID ELS_GUID_TRANSLITERATION_BENGALI_TO_LATIN =
-	{ 0xF4DFD825, 0x91A4, 0x489f, { 0x85, 0x5E, 0x9A, 0xD9, 0xBE, 0xE5, 0x57, 0x27 } };
-#endif // __MINGW32__
-#else
-#include <elssrvc.h>
-#endif
+void EditVerifyUTF8Cancel() noexcept {
+	if (utf8Verifier.worker.eventCancel != nullptr) {
+		// worker thread only posts message, wait without dispatching messages.
+		SetEvent(utf8Verifier.worker.eventCancel);
+		HANDLE hThread = InterlockedExchangePointer(&utf8Verifier.worker.workerThread, nullptr);
+		if (hThread != nullptr) {
+			WaitForSingleObject(hThread, INFINITE);
+			CloseHandle(hThread);
+		}
+		ResetEvent(utf8Verifier.worker.eventCancel);
+		MSG msg;
+		PeekMessage(&msg, hwndMain, APPM_INVALID_UTF8, APPM_INVALID_UTF8, PM_REMOVE);
+	}
+}
 
-namespace {
+void EditVerifyUTF8Async(LPCWSTR pszFile) noexcept {
+	if (utf8Verifier.worker.eventCancel == nullptr) {
+		utf8Verifier.worker.Init(hwndMain);
+	} else {
+		EditVerifyUTF8Cancel();
+	}
+	lstrcpyn(utf8Verifier.szFile, pszFile, COUNTOF(utf8Verifier.szFile));
+	utf8Verifier.worker.workerThread = CreateThread(nullptr, 0, EditVerifyUTF8Thread, &utf8Verifier, 0, nullptr);
+}
+
+// read-only viewer for file too large to be loaded, only one part of the file is mapped and
+// loaded into the document, a sparse line index is built on background thread for goto line.
+#define NP2_VIEWER_PART_SIZE	(64U << 20)
+#define NP2_VIEWER_INDEX_STEP	(1U << 16)	// lines between two line index entries
+// binary file is shown as hex dump, line for each row is computed from file offset.
+#define NP2_VIEWER_HEX_PART_SIZE	(4U << 20)
+#define NP2_VIEWER_HEX_ROW_BYTES	16
+
+struct FileViewer {
+	BackgroundWorker worker;
+	HANDLE hFile;
+	HANDLE hMap;
+	DWORD dwGranularity;
+	LONGLONG fileSize;
+	LONGLONG dataStart;		// after BOM
+	LONGLONG partStart;		// file range for text in document
+	LONGLONG partEnd;
+	Sci_Line partLine;		// line number for partStart
+	LONGLONG *lineIndex;	// file offset for line i*NP2_VIEWER_INDEX_STEP
+	volatile LONG indexCount;
+	volatile LONG indexDone;
+	Sci_Line lineCount;		// valid after indexDone is set
+	bool hexView;			// show file as hex dump, no line index is required
+	int hexDigits;			// width for offset column
+};
 
-// {4BA2A721-E43D-41b7-B330-536AE1E48863}
-const GUID WIN10_ELS_GUID_TRANSLITERATION_HANGUL_DECOMPOSITION =
-	{ 0x4BA2A721, 0xE43D, 0x41b7, { 0xB3, 0x30, 0x53, 0x6A, 0xE1, 0xE4, 0x88, 0x63 } };
+static FileViewer fileViewer;
 
-int TransliterateText(const GUID *pGuid, LPCWSTR pszTextW, int cchTextW, LPWSTR &pszMappedW) noexcept {
-using MappingGetServicesSig = HRESULT (WINAPI *)(PMAPPING_ENUM_OPTIONS pOptions, PMAPPING_SERVICE_INFO *prgServices, DWORD *pdwServicesCount);
-using MappingFreeServicesSig = HRESULT (WINAPI *)(PMAPPING_SERVICE_INFO pServiceInfo);
-using MappingRecognizeTextSig = HRESULT (WINAPI *)(PMAPPING_SERVICE_INFO pServiceInfo, LPCWSTR pszText, DWORD dwLength, DWORD dwIndex, PMAPPING_OPTIONS pOptions, PMAPPING_PROPERTY_BAG pbag);
-using MappingFreePropertyBagSig = HRESULT (WINAPI *)(PMAPPING_PROPERTY_BAG pBag);
+static const char *EditViewerMapView(const FileViewer *viewer, LONGLONG offset, size_t length, size_t *delta) noexcept {
+	const LONGLONG base = offset & ~static_cast<LONGLONG>(viewer->dwGranularity - 1);
+	*delta = static_cast<size_t>(offset - base);
+	LPVOID view = MapViewOfFile(viewer->hMap, FILE_MAP_READ, static_cast<DWORD>(base >> 32), static_cast<DWORD>(base), *delta + length);
+	return static_cast<const char *>(view);
+}
 
-	static uint8_t triedLoadingELSCore = 0;
-	static MappingGetServicesSig pfnMappingGetServices;
-	static MappingFreeServicesSig pfnMappingFreeServices;
-	static MappingRecognizeTextSig pfnMappingRecognizeText;
-	static MappingFreePropertyBagSig pfnMappingFreePropertyBag;
+static inline void EditViewerUnmapView(const char *data, size_t delta) noexcept {
+	UnmapViewOfFile(data - delta);
+}
 
-	if (triedLoadingELSCore == 0) {
-		triedLoadingELSCore = 1;
-		HMODULE hDLL = LoadLibraryExW(L"elscore.dll", nullptr, kSystemLibraryLoadFlags);
-		if (hDLL != nullptr) {
-			pfnMappingGetServices = DLLFunction<MappingGetServicesSig>(hDLL, "MappingGetServices");
-			pfnMappingFreeServices = DLLFunction<MappingFreeServicesSig>(hDLL, "MappingFreeServices");
-			pfnMappingRecognizeText = DLLFunction<MappingRecognizeTextSig>(hDLL, "MappingRecognizeText");
-			pfnMappingFreePropertyBag = DLLFunction<MappingFreePropertyBagSig>(hDLL, "MappingFreePropertyBag");
-			if (pfnMappingGetServices == nullptr || pfnMappingFreeServices == nullptr || pfnMappingRecognizeText == nullptr || pfnMappingFreePropertyBag == nullptr) {
-				FreeLibrary(hDLL);
-				return 0;
+static DWORD WINAPI EditViewerIndexThread(LPVOID lpParam) noexcept {
+	FileViewer * const viewer = static_cast<FileViewer *>(lpParam);
+	const LONGLONG fileSize = viewer->fileSize;
+	LONGLONG offset = viewer->dataStart;
+	Sci_Line line = 0;
+	bool pendingCR = false;
+	while (offset < fileSize && viewer->worker.Continue()) {
+		const size_t length = static_cast<size_t>(min<LONGLONG>(fileSize - offset, NP2_VIEWER_PART_SIZE));
+		size_t delta;
+		const char * const view = EditViewerMapView(viewer, offset, length, &delta);
+		if (view == nullptr) {
+			return 0;
+		}
+
+		const uint8_t * const start = reinterpret_cast<const uint8_t *>(view + delta);
+		const uint8_t * const end = start + length;
+		const uint8_t *ptr = start;
+		while (true) {
+			if (pendingCR) {
+				pendingCR = false;
+				ptr += *ptr == '\n';
+			} else {
+#if NP2_USE_SSE2
+				const __m128i vectCR = _mm_set1_epi8('\r');
+				const __m128i vectLF = _mm_set1_epi8('\n');
+				while (ptr + sizeof(__m128i) <= end) {
+					const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i *>(ptr));
+					const uint32_t mask = _mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(chunk, vectCR), _mm_cmpeq_epi8(chunk, vectLF)));
+					if (mask) {
+						ptr += np2_ctz(mask);
+						break;
+					}
+					ptr += sizeof(__m128i);
+				}
+#endif
+				while (ptr < end && *ptr != '\r' && *ptr != '\n') {
+					++ptr;
+				}
+				if (ptr == end) {
+					break;
+				}
+				if (*ptr++ == '\r') {
+					if (ptr == end && offset + static_cast<LONGLONG>(length) < fileSize) {
+						// check CR+LF in next view
+						pendingCR = true;
+						break;
+					}
+					ptr += ptr < end && *ptr == '\n';
+				}
+			}
+			++line;
+			if ((line & (NP2_VIEWER_INDEX_STEP - 1)) == 0) {
+				const LONG index = static_cast<LONG>(line / NP2_VIEWER_INDEX_STEP);
+				viewer->lineIndex[index] = offset + (ptr - start);
+				InterlockedExchange(&viewer->indexCount, index + 1);
 			}
-			hELSCoreDLL = hDLL;
-			triedLoadingELSCore = 2;
 		}
+
+		EditViewerUnmapView(view, delta);
+		offset += length;
 	}
-	if (triedLoadingELSCore != 2) {
-		return 0;
+
+	if (offset >= fileSize) {
+		viewer->lineCount = line + 1;
+		InterlockedExchange(&viewer->indexDone, TRUE);
 	}
+	return 0;
+}
 
-	MAPPING_ENUM_OPTIONS enumOptions;
-	PMAPPING_SERVICE_INFO prgServices = nullptr;
-	DWORD dwServicesCount = 0;
+// find start offset for count lines after offset, returns -1 when reached end of file.
+static LONGLONG EditViewerFindLine(const FileViewer *viewer, LONGLONG offset, Sci_Line count) noexcept {
+	const LONGLONG fileSize = viewer->fileSize;
+	bool pendingCR = false;
+	while (count != 0 && offset < fileSize) {
+		const size_t length = static_cast<size_t>(min<LONGLONG>(fileSize - offset, NP2_VIEWER_PART_SIZE));
+		size_t delta;
+		const char * const view = EditViewerMapView(viewer, offset, length, &delta);
+		if (view == nullptr) {
+			return -1;
+		}
+
+		const char * const start = view + delta;
+		size_t index = 0;
+		if (pendingCR) {
+			pendingCR = false;
+			index += start[0] == '\n';
+			--count;
+		}
+		while (count != 0 && index < length) {
+			const char ch = start[index++];
+			if (ch == '\r') {
+				if (index == length) {
+					pendingCR = true;
+					break;
+				}
+				index += start[index] == '\n';
+				--count;
+			} else if (ch == '\n') {
+				--count;
+			}
+		}
 
-	memset(&enumOptions, 0, sizeof(MAPPING_ENUM_OPTIONS));
-	enumOptions.Size = sizeof(MAPPING_ENUM_OPTIONS);
-	enumOptions.pGuid = const_cast<GUID *>(pGuid);
+		EditViewerUnmapView(view, delta);
+		offset += index;
+	}
+	if (pendingCR) {
+		--count;
+	}
+	return (count == 0) ? offset : -1;
+}
 
-	HRESULT hr = pfnMappingGetServices(&enumOptions, &prgServices, &dwServicesCount);
-	dwServicesCount = 0;
-	if (SUCCEEDED(hr)) {
-		MAPPING_PROPERTY_BAG bag;
-		memset(&bag, 0, sizeof(MAPPING_PROPERTY_BAG));
-		bag.Size = sizeof (MAPPING_PROPERTY_BAG);
-		hr = pfnMappingRecognizeText(prgServices, pszTextW, cchTextW, 0, nullptr, &bag);
-		if (SUCCEEDED(hr)) {
-			const DWORD dwDataSize = bag.prgResultRanges[0].dwDataSize;
-			dwServicesCount = dwDataSize/sizeof(WCHAR);
-			pszTextW = static_cast<LPCWSTR>(bag.prgResultRanges[0].pData);
-			if (dwServicesCount != 0 && pszTextW[0] != L'\0') {
-				LPWSTR pszConvW = static_cast<LPWSTR>(NP2HeapAlloc(dwDataSize + sizeof(WCHAR)));
-				memcpy(pszConvW, pszTextW, dwDataSize);
-				pszMappedW = pszConvW;
+// format file range [start, end) as hex dump, start is aligned to row.
+static bool EditViewerLoadHexPart(LONGLONG start, LONGLONG end) noexcept {
+	FileViewer &viewer = fileViewer;
+	if (end < 0) {
+		end = start + NP2_VIEWER_HEX_PART_SIZE;
+	}
+	end = min(end, viewer.fileSize);
+	const size_t length = static_cast<size_t>(end - start);
+	size_t delta;
+	const char * const view = EditViewerMapView(&viewer, start, length, &delta);
+	if (view == nullptr) {
+		dwLastIOError = GetLastError();
+		return false;
+	}
+
+	// offset, two spaces, 16 bytes with an extra space in the middle, space, 16 characters and LF.
+	const size_t rows = (length + NP2_VIEWER_HEX_ROW_BYTES - 1) / NP2_VIEWER_HEX_ROW_BYTES;
+	const size_t width = viewer.hexDigits + 2 + NP2_VIEWER_HEX_ROW_BYTES*3 + 1 + 1 + NP2_VIEWER_HEX_ROW_BYTES + 1;
+	char * const text = static_cast<char *>(NP2HeapAlloc(rows*width + 1));
+	Sci_Position * const lineStarts = static_cast<Sci_Position *>(NP2HeapAlloc(rows*sizeof(Sci_Position)));
+	if (text == nullptr || lineStarts == nullptr) {
+		EditViewerUnmapView(view, delta);
+		NP2HeapFree(text);
+		NP2HeapFree(lineStarts);
+		dwLastIOError = ERROR_NOT_ENOUGH_MEMORY;
+		return false;
+	}
+
+	const uint8_t * const data = reinterpret_cast<const uint8_t *>(view + delta);
+	char *ptr = text;
+	for (size_t row = 0; row < rows; row++) {
+		const size_t index = row*NP2_VIEWER_HEX_ROW_BYTES;
+		const ULONGLONG offset = start + index;
+		for (int digit = viewer.hexDigits - 1; digit >= 0; digit--) {
+			*ptr++ = "0123456789ABCDEF"[(offset >> (digit*4)) & 15];
+		}
+		ptr[0] = ' ';
+		ptr[1] = ' ';
+		ptr += 2;
+		const size_t count = min<size_t>(length - index, NP2_VIEWER_HEX_ROW_BYTES);
+		const uint8_t * const bytes = data + index;
+		for (size_t i = 0; i < NP2_VIEWER_HEX_ROW_BYTES; i++) {
+			if (i < count) {
+				ptr[0] = "0123456789ABCDEF"[bytes[i] >> 4];
+				ptr[1] = "0123456789ABCDEF"[bytes[i] & 15];
+			} else {
+				ptr[0] = ' ';
+				ptr[1] = ' ';
+			}
+			ptr[2] = ' ';
+			ptr += 3;
+			if (i == NP2_VIEWER_HEX_ROW_BYTES/2 - 1) {
+				*ptr++ = ' ';
 			}
-			pfnMappingFreePropertyBag(&bag);
 		}
-		pfnMappingFreeServices(prgServices);
+		*ptr++ = ' ';
+		for (size_t i = 0; i < NP2_VIEWER_HEX_ROW_BYTES; i++) {
+			const uint8_t ch = (i < count) ? bytes[i] : ' ';
+			*ptr++ = (ch >= 0x20 && ch < 0x7f) ? static_cast<char>(ch) : '.';
+		}
+		*ptr++ = '\n';
+		lineStarts[row] = ptr - text;
 	}
+	EditViewerUnmapView(view, delta);
 
-	return dwServicesCount;
+	EditSetNewText(text, ptr - text, rows + 1, lineStarts);
+	NP2HeapFree(text);
+	NP2HeapFree(lineStarts);
+
+	bReadOnlyMode = true;
+	SciCall_SetReadOnly(true);
+	viewer.partStart = start;
+	viewer.partEnd = end;
+	return true;
 }
 
-int StringMapCase(LPCWSTR pszTextW, int cchTextW, DWORD flags, LPWSTR &pszMappedW) noexcept {
-	int charsConverted = LCMapStringEx(LOCALE_NAME_USER_DEFAULT, flags, pszTextW, cchTextW, nullptr, 0, nullptr, nullptr, 0);
-	if (charsConverted) {
-		pszMappedW = static_cast<LPWSTR>(NP2HeapAlloc((charsConverted + 1)*sizeof(WCHAR)));
-		charsConverted = LCMapStringEx(LOCALE_NAME_USER_DEFAULT, flags, pszTextW, cchTextW, pszMappedW, charsConverted, nullptr, nullptr, 0);
+// load file range [start, end) into document, when end is negative, the part
+// is ended after last line break before start + NP2_VIEWER_PART_SIZE.
+static bool EditViewerLoadPart(LONGLONG start, LONGLONG end, bool alignStart, EditFileIOStatus &status) noexcept {
+	FileViewer &viewer = fileViewer;
+	if (viewer.hexView) {
+		return EditViewerLoadHexPart(start, end);
 	}
-	return charsConverted;
+	const bool trimEnd = end < 0;
+	if (trimEnd) {
+		end = min<LONGLONG>(viewer.fileSize, start + NP2_VIEWER_PART_SIZE);
+	}
+	// one more byte to check CR+LF
+	const size_t mapped = static_cast<size_t>(min(viewer.fileSize, end + 1) - start);
+	size_t delta;
+	const char * const view = EditViewerMapView(&viewer, start, mapped, &delta);
+	if (view == nullptr) {
+		dwLastIOError = GetLastError();
+		return false;
+	}
+
+	const char *data = view + delta;
+	size_t length = static_cast<size_t>(end - start);
+	size_t first = 0;
+	if (alignStart) {
+		// skip partial line which belongs to previous part
+		while (first < length && data[first] != '\r' && data[first] != '\n') {
+			++first;
+		}
+		if (first < length) {
+			first += (data[first] == '\r' && first + 1 < mapped && data[first + 1] == '\n') ? 2 : 1;
+		} else {
+			first = 0;
+		}
+	}
+	if (trimEnd && end < viewer.fileSize) {
+		size_t last = length;
+		while (last > first && data[last - 1] != '\r' && data[last - 1] != '\n') {
+			--last;
+		}
+		if (last > first) {
+			last += data[last - 1] == '\r' && data[last] == '\n';
+			length = last;
+		}
+	}
+
+	data += first;
+	length -= first;
+	if (length != 0) {
+		// avoid reading after mapped view at end of file
+		EditDetectEOLMode(data, length - (start + first + length == viewer.fileSize), status);
+	}
+	EditSetNewText(data, length, status.totalLineCount);
+	EditViewerUnmapView(view, delta);
+
+	bReadOnlyMode = true;
+	SciCall_SetReadOnly(true);
+	viewer.partStart = start + first;
+	viewer.partEnd = viewer.partStart + length;
+	return true;
 }
 
-// TODO: Unicode Text Segmentation https://www.unicode.org/reports/tr29/
-constexpr wchar_t ToHalfwidth(wchar_t ch) noexcept {
-	if (ch > 0xFF00 && ch < 0xFF5F) {
-		return ch - 0xFEE0;
+bool EditViewerOpen(HANDLE hFile, LONGLONG fileSize, bool hexView, EditFileIOStatus &status) noexcept {
+	FileViewer &viewer = fileViewer;
+	EditViewerClose();
+	HANDLE hMap = CreateFileMapping(hFile, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	if (hMap == nullptr) {
+		dwLastIOError = GetLastError();
+		return false;
 	}
-	return ch;
+
+	SYSTEM_INFO info;
+	GetSystemInfo(&info);
+	viewer.hMap = hMap;
+	viewer.dwGranularity = info.dwAllocationGranularity;
+	viewer.fileSize = fileSize;
+	size_t delta;
+	if (!hexView && bBinaryFileHexView) {
+		const size_t length = static_cast<size_t>(min<LONGLONG>(fileSize, 1024));
+		const char * const data = EditViewerMapView(&viewer, 0, length, &delta);
+		if (data != nullptr) {
+			int encodingFlag = EncodingFlag_None;
+			hexView = MaybeBinaryFile(reinterpret_cast<const uint8_t *>(data + delta), static_cast<DWORD>(length), &encodingFlag);
+			EditViewerUnmapView(data, delta);
+		}
+	}
+	if (hexView) {
+		viewer.hFile = hFile;
+		viewer.hexView = true;
+		viewer.hexDigits = (fileSize > UINT32_MAX) ? 16 : 8;
+		viewer.lineCount = static_cast<Sci_Line>((fileSize + NP2_VIEWER_HEX_ROW_BYTES - 1) / NP2_VIEWER_HEX_ROW_BYTES) + 1;
+		viewer.indexDone = TRUE;
+		status.iEncoding = CPI_DEFAULT;
+		status.iEOLMode = SC_EOL_LF;
+		status.totalLineCount = 1;
+		SciCall_SetCodePage(iDefaultCodePage);
+		if (!EditViewerLoadPart(0, -1, false, status)) {
+			viewer.hFile = nullptr;
+			EditViewerClose();
+			return false;
+		}
+		status.bViewerMode = true;
+		return true;
+	}
+
+	const char * const view = EditViewerMapView(&viewer, 0, 4, &delta);
+	const uint8_t *bom = reinterpret_cast<const uint8_t *>(view);
+	if (bom == nullptr || (bom[0] == 0xFF && bom[1] == 0xFE) || (bom[0] == 0xFE && bom[1] == 0xFF)) {
+		// UTF-16 file requires conversion for whole file
+		dwLastIOError = (bom == nullptr) ? GetLastError() : ERROR_NOT_SUPPORTED;
+		if (bom != nullptr) {
+			EditViewerUnmapView(view, delta);
+		}
+		CloseHandle(hMap);
+		memset(&viewer, 0, sizeof(viewer));
+		return false;
+	}
+
+	const bool bBOM = bom[0] == 0xEF && bom[1] == 0xBB && bom[2] == 0xBF;
+	EditViewerUnmapView(view, delta);
+	viewer.lineIndex = static_cast<LONGLONG *>(NP2HeapAlloc(static_cast<size_t>(fileSize / NP2_VIEWER_INDEX_STEP + 2) * sizeof(LONGLONG)));
+	if (viewer.lineIndex == nullptr) {
+		dwLastIOError = ERROR_NOT_ENOUGH_MEMORY;
+		CloseHandle(hMap);
+		memset(&viewer, 0, sizeof(viewer));
+		return false;
+	}
+
+	viewer.hFile = hFile;
+	viewer.dataStart = bBOM ? 3 : 0;
+	viewer.lineIndex[0] = viewer.dataStart;
+	viewer.indexCount = 1;
+	viewer.lineCount = -1;
+
+	// detect encoding from the first part
+	int iEncoding = CPI_UTF8SIGN;
+	if (!bBOM) {
+		const size_t length = static_cast<size_t>(min<LONGLONG>(fileSize, NP2_VIEWER_PART_SIZE));
+		const char * const data = EditViewerMapView(&viewer, 0, length, &delta);
+		iEncoding = CPI_DEFAULT;
+		if (data != nullptr) {
+			if (IsUTF8(data + delta, GetUTF8SliceLength(data + delta, length))) {
+				iEncoding = CPI_UTF8;
+			}
+			EditViewerUnmapView(data, delta);
+		}
+	}
+	status.iEncoding = iEncoding;
+	SciCall_SetCodePage((iEncoding == CPI_DEFAULT) ? iDefaultCodePage : SC_CP_UTF8);
+	if (!EditViewerLoadPart(viewer.dataStart, -1, false, status)) {
+		viewer.hFile = nullptr;
+		EditViewerClose();
+		return false;
+	}
+
+	status.bViewerMode = true;
+	viewer.worker.Init(hwndMain);
+	viewer.worker.workerThread = CreateThread(nullptr, 0, EditViewerIndexThread, &viewer, 0, nullptr);
+	return true;
 }
 
-constexpr bool IsWordSingleQuote(wchar_t ch) noexcept {
-	return ch == L'\'' || ch == L'`'
-		|| ch == 0x00B4 // ACUTE ACCENT
-		|| ch == 0x0384 // GREEK TONOS
-		|| ch == 0x2018 // LEFT SINGLE QUOTATION MARK
-		|| ch == 0x2019 // RIGHT SINGLE QUOTATION MARK
-		;
+void EditViewerClose() noexcept {
+	FileViewer &viewer = fileViewer;
+	if (viewer.hMap == nullptr) {
+		return;
+	}
+	if (viewer.worker.eventCancel != nullptr) {
+		// index thread never posts message
+		SetEvent(viewer.worker.eventCancel);
+		if (viewer.worker.workerThread != nullptr) {
+			WaitForSingleObject(viewer.worker.workerThread, INFINITE);
+			CloseHandle(viewer.worker.workerThread);
+		}
+		CloseHandle(viewer.worker.eventCancel);
+	}
+	CloseHandle(viewer.hMap);
+	if (viewer.hFile != nullptr) {
+		CloseHandle(viewer.hFile);
+	}
+	if (viewer.lineIndex != nullptr) {
+		NP2HeapFree(viewer.lineIndex);
+	}
+	memset(&viewer, 0, sizeof(viewer));
 }
 
-constexpr bool IsWordSpace(wchar_t ch) noexcept {
-	ch = ToHalfwidth(ch);
-	return IsASpace(ch)
-		|| ch == L'[' || ch == L']' || ch == L'(' || ch == L')' || ch == L'{' || ch == L'}'
-		|| ch == 0x0085 // NEXT LINE
-		|| ch == 0x2028 // LINE SEPARATOR
-		|| ch == 0x2029 // PARAGRAPH SEPARATOR
-		;
+bool EditViewerActive() noexcept {
+	return fileViewer.hMap != nullptr;
 }
 
-constexpr bool IsSentenceTerminator(wchar_t ch) noexcept {
-	ch = ToHalfwidth(ch);
-	return ch == L'\r' || ch == L'\n'
-		|| ch == L'.' || ch == L';' || ch == L'!' || ch == L'?'
-		|| ch == 0x0085 // NEXT LINE
-		|| ch == 0x2028 // LINE SEPARATOR
-		|| ch == 0x2029 // PARAGRAPH SEPARATOR
-		;
+Sci_Line EditViewerFirstLine() noexcept {
+	return fileViewer.partLine;
+}
+
+Sci_Line EditViewerLineCount() noexcept {
+	const FileViewer &viewer = fileViewer;
+	if (viewer.indexDone) {
+		return viewer.lineCount;
+	}
+	const Sci_Line indexed = static_cast<Sci_Line>(viewer.indexCount)*NP2_VIEWER_INDEX_STEP;
+	return max(indexed, viewer.partLine + SciCall_GetLineCount());
+}
+
+void EditViewerMovePart(bool next) noexcept {
+	FileViewer &viewer = fileViewer;
+	if (viewer.hMap == nullptr) {
+		return;
+	}
+
+	EditFileIOStatus status{};
+	const Sci_Line line = viewer.partLine;
+	if (next) {
+		const Sci_Line lines = SciCall_GetLineCount() - 1;
+		if (viewer.partEnd >= viewer.fileSize || !EditViewerLoadPart(viewer.partEnd, -1, false, status)) {
+			MessageBeep(MB_OK);
+			return;
+		}
+		viewer.partLine = line + lines;
+	} else {
+		const LONGLONG partSize = viewer.hexView ? NP2_VIEWER_HEX_PART_SIZE : NP2_VIEWER_PART_SIZE;
+		const LONGLONG start = max(viewer.dataStart, viewer.partStart - partSize);
+		if (viewer.partStart <= viewer.dataStart || !EditViewerLoadPart(start, viewer.partStart, start > viewer.dataStart, status)) {
+			MessageBeep(MB_OK);
+			return;
+		}
+		viewer.partLine = line - (SciCall_GetLineCount() - 1);
+		SciCall_DocumentEnd();
+	}
 }
 
+// iNewLine is 1-based line number in whole file, returns false when the line is not indexed yet.
+bool EditViewerGotoLine(Sci_Line iNewLine, Sci_Position iNewCol) noexcept {
+	FileViewer &viewer = fileViewer;
+	const Sci_Line line = iNewLine - 1;
+	if (line < 0 || (viewer.indexDone && line >= viewer.lineCount)) {
+		return false;
+	}
+	if (line >= viewer.partLine && line - viewer.partLine < SciCall_GetLineCount()) {
+		EditJumpTo(line - viewer.partLine + 1, iNewCol);
+		return true;
+	}
+
+	EditFileIOStatus status{};
+	if (viewer.hexView) {
+		// line for a row is the offset divided by row size
+		const Sci_Line row = min<Sci_Line>(line, static_cast<Sci_Line>((viewer.fileSize - 1) / NP2_VIEWER_HEX_ROW_BYTES));
+		if (!EditViewerLoadPart(static_cast<LONGLONG>(row)*NP2_VIEWER_HEX_ROW_BYTES, -1, false, status)) {
+			return false;
+		}
+		viewer.partLine = row;
+		EditJumpTo(line - row + 1, iNewCol);
+		return true;
+	}
+
+	const LONG index = static_cast<LONG>(line / NP2_VIEWER_INDEX_STEP);
+	if (index >= viewer.indexCount) {
+		return false;
+	}
+	const LONGLONG offset = EditViewerFindLine(&viewer, viewer.lineIndex[index], line & (NP2_VIEWER_INDEX_STEP - 1));
+	if (offset < 0 || !EditViewerLoadPart(offset, -1, false, status)) {
+		return false;
+	}
+	viewer.partLine = line;
+	EditJumpTo(1, iNewCol);
+	return true;
 }
 
 //=============================================================================
 //
-// EditMapTextCase(), used by ScintillaWin::CaseMapString()
+// transparent gzip decompression for compressed logs, see RFC 1951 and RFC 1952.
+// multi-member files with BGZF block size extra field (bgzip, pigz --independent)
+// are inflated in parallel, other files are inflated on current thread.
 //
-char *EditMapTextCase(int menu, const char *pszText, size_t &iSelCount, UINT cpEdit) noexcept {
-	DWORD flags = 0;
-	const GUID *pGuid = nullptr;
-	switch (menu) {
-	case IDM_EDIT_SENTENCECASE:
-	case IDM_EDIT_TITLECASE:
-		flags = LCMAP_LINGUISTIC_CASING | LCMAP_LOWERCASE;
-		break;
-	case IDM_EDIT_MAP_FULLWIDTH:
-		flags = LCMAP_FULLWIDTH;
-		break;
-	case IDM_EDIT_MAP_HALFWIDTH:
-		flags = LCMAP_HALFWIDTH;
-		break;
-	case IDM_EDIT_MAP_SIMPLIFIED_CHINESE:
-		flags = LCMAP_SIMPLIFIED_CHINESE;
-		pGuid = &ELS_GUID_TRANSLITERATION_HANT_TO_HANS;
-		break;
-	case IDM_EDIT_MAP_TRADITIONAL_CHINESE:
-		flags = LCMAP_TRADITIONAL_CHINESE;
-		pGuid = &ELS_GUID_TRANSLITERATION_HANS_TO_HANT;
-		break;
-	case IDM_EDIT_MAP_HIRAGANA:
-		flags = LCMAP_HIRAGANA;
-		break;
-	case IDM_EDIT_MAP_KATAKANA:
-		flags = LCMAP_KATAKANA;
-		break;
-	case IDM_EDIT_MAP_MALAYALAM_LATIN:
-		pGuid = &ELS_GUID_TRANSLITERATION_MALAYALAM_TO_LATIN;
-		break;
-	case IDM_EDIT_MAP_DEVANAGARI_LATIN:
-		pGuid = &ELS_GUID_TRANSLITERATION_DEVANAGARI_TO_LATIN;
-		break;
-	case IDM_EDIT_MAP_CYRILLIC_LATIN:
-		pGuid = &ELS_GUID_TRANSLITERATION_CYRILLIC_TO_LATIN;
-		break;
-	case IDM_EDIT_MAP_BENGALI_LATIN:
-		pGuid = &ELS_GUID_TRANSLITERATION_BENGALI_TO_LATIN;
-		break;
-	case IDM_EDIT_MAP_HANGUL_DECOMPOSITION:
-		pGuid = &WIN10_ELS_GUID_TRANSLITERATION_HANGUL_DECOMPOSITION;
-		break;
-	case IDM_EDIT_INVERTCASE:
-	default:
-		break;
-	}
+#define NP2_GZIP_PARALLEL_MIN_SIZE	(4U << 20)
 
-	LPWSTR pszTextW = static_cast<LPWSTR>(NP2HeapAlloc((iSelCount + 1) * sizeof(WCHAR)));
-	int cchTextW = MultiByteToWideChar(cpEdit, 0, pszText, static_cast<int>(iSelCount), pszTextW, static_cast<int>(iSelCount + 1));
+namespace {
 
-	bool bChanged = false;
-	if (flags != 0 || pGuid != nullptr) {
-		int charsConverted = 0;
-		LPWSTR pszMappedW = nullptr;
-		if (pGuid != nullptr && IsWin7AndAbove()) {
-			charsConverted = TransliterateText(pGuid, pszTextW, cchTextW, pszMappedW);
+constexpr int HuffmanFastBits = 10;
+constexpr int HuffmanMaxBits = 15;
+
+struct HuffmanTable {
+	uint16_t fast[1 << HuffmanFastBits]; // symbol << 4 | length, zero for longer code
+	uint16_t count[HuffmanMaxBits + 1];
+	uint16_t symbol[288];
+
+	bool Build(const uint8_t *lengths, int n) noexcept;
+};
+
+bool HuffmanTable::Build(const uint8_t *lengths, int n) noexcept {
+	memset(count, 0, sizeof(count));
+	for (int sym = 0; sym < n; sym++) {
+		count[lengths[sym]]++;
+	}
+	count[0] = 0;
+	int left = 1;
+	for (int len = 1; len <= HuffmanMaxBits; len++) {
+		left = (left << 1) - count[len];
+		if (left < 0) {
+			// over-subscribed
+			return false;
 		}
-		if (pszMappedW == nullptr && flags != 0) {
-			charsConverted = StringMapCase(pszTextW, cchTextW, flags, pszMappedW);
-			if (charsConverted) {
-				if (menu == IDM_EDIT_TITLECASE) {
-					if (IsWin7AndAbove()) {
-						LPWSTR pszConvW = nullptr;
-						charsConverted = StringMapCase(pszMappedW, charsConverted, LCMAP_LINGUISTIC_CASING | LCMAP_TITLECASE, pszConvW);
-						NP2HeapFree(pszMappedW);
-						pszMappedW = pszConvW;
-					} else {
-						// BOOKMARK_EDITION
-						bool bNewWord = true;
-						bool bPrevWasSpace = true;
-						for (int i = 0; i < charsConverted; i++) {
-							const WCHAR ch = pszMappedW[i];
-							if (!IsCharAlphaNumeric(ch) && (!IsWordSingleQuote(ch) || bPrevWasSpace)) {
-								bNewWord = true;
-							} else {
-								if (bNewWord && IsCharLower(ch)) {
-									pszMappedW[i] = LOWORD(CharUpper(AsPointer<LPWSTR, LONG_PTR>(ch)));
-								}
-								bNewWord = false;
-							}
-							bPrevWasSpace = IsWordSpace(ch);
-						}
-					}
-				} else if (menu == IDM_EDIT_SENTENCECASE) {
-					bool bNewSentence = true;
-					for (int i = 0; i < charsConverted; i++) {
-						const WCHAR ch = pszMappedW[i];
-						if (IsSentenceTerminator(ch)) {
-							bNewSentence = true;
-						} else if (bNewSentence && IsCharAlphaNumeric(ch)) {
-							if (IsCharLower(ch)) {
-								pszMappedW[i] = LOWORD(CharUpper(AsPointer<LPWSTR, LONG_PTR>(ch)));
-							}
-							bNewSentence = false;
-						}
-					}
-				}
+	}
+
+	uint16_t offsets[HuffmanMaxBits + 2];
+	offsets[1] = 0;
+	for (int len = 1; len <= HuffmanMaxBits; len++) {
+		offsets[len + 1] = offsets[len] + count[len];
+	}
+	for (int sym = 0; sym < n; sym++) {
+		if (lengths[sym] != 0) {
+			symbol[offsets[lengths[sym]]++] = static_cast<uint16_t>(sym);
+		}
+	}
+
+	// codes are stored from most significant bit, but read from least significant bit
+	memset(fast, 0, sizeof(fast));
+	uint32_t code = 0;
+	int index = 0;
+	for (int len = 1; len <= HuffmanFastBits; len++) {
+		for (int i = 0; i < count[len]; i++) {
+			uint32_t reversed = 0;
+			for (int bit = 0; bit < len; bit++) {
+				reversed |= ((code >> bit) & 1) << (len - 1 - bit);
+			}
+			const uint16_t entry = static_cast<uint16_t>((symbol[index++] << 4) | len);
+			for (uint32_t k = reversed; k < (1U << HuffmanFastBits); k += 1U << len) {
+				fast[k] = entry;
 			}
+			++code;
 		}
+		code <<= 1;
+	}
+	return true;
+}
 
-		if (charsConverted == 0 || StrIsEmpty(pszMappedW) || StrEqual(pszTextW, pszMappedW)) {
-			NP2HeapFree(pszMappedW);
-		} else {
-			bChanged = true;
-			NP2HeapFree(pszTextW);
-			pszTextW = pszMappedW;
-			cchTextW = charsConverted;
+constexpr uint16_t lengthBase[29] = {
+	3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+	35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258,
+};
+constexpr uint8_t lengthExtra[29] = {
+	0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
+	3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0,
+};
+constexpr uint16_t distanceBase[30] = {
+	1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193,
+	257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577,
+};
+constexpr uint8_t distanceExtra[30] = {
+	0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6,
+	7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13,
+};
+
+// CRC-32 (ISO 3309) used by gzip trailer, slicing-by-8 tables.
+struct CRC32Table {
+	uint32_t table[8][256];
+
+	constexpr CRC32Table() noexcept : table{} {
+		for (uint32_t i = 0; i < 256; i++) {
+			uint32_t crc = i;
+			for (int k = 0; k < 8; k++) {
+				crc = (crc >> 1) ^ (0xEDB88320U & (0U - (crc & 1)));
+			}
+			table[0][i] = crc;
 		}
-	} else {
-		// invert case
-		for (int i = 0; i < cchTextW; i++) {
-			const WCHAR ch = pszTextW[i];
-			if (IsCharUpper(ch)) {
-				pszTextW[i] = LOWORD(CharLower(AsPointer<LPWSTR, LONG_PTR>(ch)));
-				bChanged = true;
-			} else if (IsCharLower(ch)) {
-				pszTextW[i] = LOWORD(CharUpper(AsPointer<LPWSTR, LONG_PTR>(ch)));
-				bChanged = true;
+		for (uint32_t i = 0; i < 256; i++) {
+			for (int k = 1; k < 8; k++) {
+				table[k][i] = (table[k - 1][i] >> 8) ^ table[0][table[k - 1][i] & 0xff];
 			}
 		}
 	}
+};
 
-	char *pszOut = nullptr;
-	if (bChanged) {
-		int cchText = cchTextW*kMaxMultiByteCount + 1;
-		pszOut = static_cast<char *>(NP2HeapAlloc(cchText));
-		cchText = WideCharToMultiByte(cpEdit, 0, pszTextW, cchTextW, pszOut, cchText, nullptr, nullptr);
-		iSelCount = cchText;
+constexpr CRC32Table crc32Table;
+
+uint32_t UpdateCRC32(uint32_t crc, const uint8_t *data, size_t length) noexcept {
+	const auto &table = crc32Table.table;
+	crc = ~crc;
+	const uint8_t * const end = data + length;
+	while (end - data >= 8) {
+		uint32_t low;
+		uint32_t high;
+		memcpy(&low, data, sizeof(low));
+		memcpy(&high, data + 4, sizeof(high));
+		low ^= crc;
+		crc = table[7][low & 0xff] ^ table[6][(low >> 8) & 0xff] ^ table[5][(low >> 16) & 0xff] ^ table[4][low >> 24]
+			^ table[3][high & 0xff] ^ table[2][(high >> 8) & 0xff] ^ table[1][(high >> 16) & 0xff] ^ table[0][high >> 24];
+		data += 8;
+	}
+	while (data < end) {
+		crc = table[0][(crc ^ *data++) & 0xff] ^ (crc >> 8);
+	}
+	return ~crc;
+}
+
+class GZipInflater {
+public:
+	const uint8_t *in;
+	const uint8_t *inEnd;
+	// output is written into [buffer + offset, buffer + offset + capacity), when growable
+	// the heap block is reallocated with NP2_ENCODING_DETECTION_PADDING aligned data.
+	char *buffer = nullptr;
+	size_t offset = 0;
+	size_t pos = 0;
+	size_t capacity = 0;
+	size_t limit = 0;
+	bool growable = false;
+
+	GZipInflater(const uint8_t *data, const uint8_t *end) noexcept : in{data}, inEnd{end} {}
+	// like gzip, trailing data (e.g. zero padding) after last member is ignored
+	bool HasMember() const noexcept {
+		return inEnd - in >= 2 && in[0] == 0x1f && in[1] == 0x8b;
+	}
+	bool InflateMember() noexcept;
+
+private:
+	uint64_t bitBuf = 0;
+	uint32_t bitCount = 0;
+	bool failed = false;
+	size_t memberStart = 0;
+	HuffmanTable lengthCodes;
+	HuffmanTable distanceCodes;
+
+	void Refill() noexcept {
+		while (bitCount <= 56 && in < inEnd) {
+			bitBuf |= static_cast<uint64_t>(*in++) << bitCount;
+			bitCount += 8;
+		}
+	}
+	uint32_t Bits(uint32_t n) noexcept {
+		if (bitCount < n) {
+			Refill();
+			if (bitCount < n) {
+				failed = true;
+				return 0;
+			}
+		}
+		const uint32_t value = static_cast<uint32_t>(bitBuf & ((UINT64_C(1) << n) - 1));
+		bitBuf >>= n;
+		bitCount -= n;
+		return value;
+	}
+	// move unused whole bytes in bit buffer back to input
+	void AlignToByte() noexcept {
+		in -= bitCount >> 3;
+		bitBuf = 0;
+		bitCount = 0;
 	}
+	int Decode(const HuffmanTable &table) noexcept;
+	bool Reserve(size_t n) noexcept;
+	bool InflateStored() noexcept;
+	bool InflateDynamic() noexcept;
+	bool InflateCodes() noexcept;
+};
 
-	NP2HeapFree(pszTextW);
-	return pszOut;
+int GZipInflater::Decode(const HuffmanTable &table) noexcept {
+	if (bitCount < HuffmanMaxBits) {
+		Refill();
+	}
+	const uint32_t entry = table.fast[bitBuf & ((1U << HuffmanFastBits) - 1)];
+	if (entry != 0 && (entry & 15) <= bitCount) {
+		bitBuf >>= entry & 15;
+		bitCount -= entry & 15;
+		return entry >> 4;
+	}
+	// canonical decoding for code longer than HuffmanFastBits
+	int code = 0;
+	int first = 0;
+	int index = 0;
+	const uint32_t maxBits = min<uint32_t>(bitCount, HuffmanMaxBits);
+	for (uint32_t len = 1; len <= maxBits; len++) {
+		code |= static_cast<int>((bitBuf >> (len - 1)) & 1);
+		const int count = table.count[len];
+		if (code - count < first) {
+			bitBuf >>= len;
+			bitCount -= len;
+			return table.symbol[index + (code - first)];
+		}
+		index += count;
+		first = (first + count) << 1;
+		code <<= 1;
+	}
+	failed = true;
+	return -1;
+}
+
+bool GZipInflater::Reserve(size_t n) noexcept {
+	if (pos + n <= capacity) {
+		return true;
+	}
+	if (!growable || pos + n > limit) {
+		return false;
+	}
+	const size_t newCapacity = min(max(capacity*2, pos + n), limit);
+	char * const block = static_cast<char *>(NP2HeapReAlloc(buffer, newCapacity + NP2_ENCODING_DETECTION_PADDING*3));
+	if (block == nullptr) {
+		return false;
+	}
+	const size_t newOffset = NP2_align_up(reinterpret_cast<uintptr_t>(block), NP2_ENCODING_DETECTION_PADDING) - reinterpret_cast<uintptr_t>(block);
+	if (newOffset != offset) {
+		memmove(block + newOffset, block + offset, pos);
+	}
+	buffer = block;
+	offset = newOffset;
+	capacity = newCapacity;
+	return true;
 }
 
-#ifndef URL_ESCAPE_AS_UTF8		// NTDDI_VERSION >= NTDDI_WIN7
-#define URL_ESCAPE_AS_UTF8		0x00040000
-#endif
-#ifndef URL_UNESCAPE_AS_UTF8	// NTDDI_VERSION >= NTDDI_WIN8
-#define URL_UNESCAPE_AS_UTF8	URL_ESCAPE_AS_UTF8
-#endif
-#ifndef URL_ESCAPE_ASCII_URI_COMPONENT	// NTDDI_VERSION >= NTDDI_WIN8
-#define URL_ESCAPE_ASCII_URI_COMPONENT	0x00080000
-#endif
-
-//=============================================================================
-//
-// EditURLEncode()
-//
-LPWSTR EditURLEncodeSelection(DWORD *cchEscapedW, bool component) noexcept {
-	*cchEscapedW = 0;
-	const Sci_Position iSelCount = SciCall_GetSelTextLength();
-	if (iSelCount == 0) {
-		return nullptr;
+bool GZipInflater::InflateStored() noexcept {
+	AlignToByte();
+	if (inEnd - in < 4) {
+		return false;
 	}
+	const uint32_t len = in[0] | (in[1] << 8);
+	const uint32_t nlen = in[2] | (in[3] << 8);
+	in += 4;
+	if (len != (~nlen & 0xffff) || static_cast<size_t>(inEnd - in) < len || !Reserve(len)) {
+		return false;
+	}
+	memcpy(buffer + offset + pos, in, len);
+	in += len;
+	pos += len;
+	return true;
+}
 
-	const size_t allocSize = NP2_align_up(iSelCount + 1, MEMORY_ALLOCATION_ALIGNMENT);
-	char * const pszText = static_cast<char *>(NP2HeapAlloc(allocSize * (sizeof(char) + sizeof(WCHAR))));
-	SciCall_GetSelText(pszText);
-
-	WCHAR * const pszTextW = reinterpret_cast<LPWSTR>(pszText + allocSize);
-	const UINT cpEdit = SciCall_GetCodePage();
-	MultiByteToWideChar(cpEdit, 0, pszText, static_cast<int>(iSelCount), pszTextW, static_cast<int>(allocSize));
-	// TODO: trim all C0 and C1 control characters.
-	StrTrim(pszTextW, L" \a\b\f\n\r\t\v");
-	if (StrIsEmpty(pszTextW)) {
-		NP2HeapFree(pszText);
-		return nullptr;
+bool GZipInflater::InflateDynamic() noexcept {
+	constexpr uint8_t order[19] = {16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15};
+	const uint32_t nlen = Bits(5) + 257;
+	const uint32_t ndist = Bits(5) + 1;
+	const uint32_t ncode = Bits(4) + 4;
+	if (failed || nlen > 286 || ndist > 30) {
+		return false;
 	}
 
-	// https://docs.microsoft.com/en-us/windows/desktop/api/shlwapi/nf-shlwapi-urlescapew
-	DWORD cchEscaped = static_cast<DWORD>(allocSize * kMaxMultiByteCount * 3); // '&', H1, H0
-	LPWSTR pszEscapedW = static_cast<LPWSTR>(NP2HeapAlloc(cchEscaped * sizeof(WCHAR))); // '&', H1, H0
+	uint8_t lengths[286 + 30]{};
+	for (uint32_t i = 0; i < ncode; i++) {
+		lengths[order[i]] = static_cast<uint8_t>(Bits(3));
+	}
+	if (failed || !lengthCodes.Build(lengths, 19)) {
+		return false;
+	}
 
-	const DWORD flags = component ? (URL_ESCAPE_AS_UTF8 | URL_ESCAPE_ASCII_URI_COMPONENT | URL_ESCAPE_SEGMENT_ONLY) : URL_ESCAPE_AS_UTF8;
-	UrlEscape(pszTextW, pszEscapedW, &cchEscaped, flags);
+	uint32_t index = 0;
+	memset(lengths, 0, 19);
+	while (index < nlen + ndist) {
+		const int sym = Decode(lengthCodes);
+		if (sym < 0) {
+			return false;
+		}
+		if (sym < 16) {
+			lengths[index++] = static_cast<uint8_t>(sym);
+			continue;
+		}
+		uint8_t len = 0;
+		uint32_t repeat;
+		if (sym == 16) {
+			if (index == 0) {
+				return false;
+			}
+			len = lengths[index - 1];
+			repeat = 3 + Bits(2);
+		} else if (sym == 17) {
+			repeat = 3 + Bits(3);
+		} else {
+			repeat = 11 + Bits(7);
+		}
+		if (failed || index + repeat > nlen + ndist) {
+			return false;
+		}
+		memset(lengths + index, len, repeat);
+		index += repeat;
+	}
+	if (lengths[256] == 0) {
+		// missing end-of-block code
+		return false;
+	}
+	return lengthCodes.Build(lengths, nlen) && distanceCodes.Build(lengths + nlen, ndist);
+}
 
-	NP2HeapFree(pszText);
-	*cchEscapedW = cchEscaped;
-	return pszEscapedW;
+bool GZipInflater::InflateCodes() noexcept {
+	while (true) {
+		int sym = Decode(lengthCodes);
+		if (sym < 256) {
+			if (sym < 0 || !Reserve(1)) {
+				return false;
+			}
+			buffer[offset + pos++] = static_cast<char>(sym);
+			continue;
+		}
+		if (sym == 256) {
+			return true;
+		}
+		sym -= 257;
+		if (sym >= 29) {
+			return false;
+		}
+		const uint32_t len = lengthBase[sym] + Bits(lengthExtra[sym]);
+		sym = Decode(distanceCodes);
+		if (sym < 0 || sym >= 30) {
+			return false;
+		}
+		const size_t dist = distanceBase[sym] + Bits(distanceExtra[sym]);
+		if (failed || dist > pos - memberStart || !Reserve(len)) {
+			return false;
+		}
+		char *dest = buffer + offset + pos;
+		const char *src = dest - dist;
+		pos += len;
+		if (dist >= len) {
+			memcpy(dest, src, len);
+		} else {
+			for (uint32_t i = 0; i < len; i++) {
+				dest[i] = src[i];
+			}
+		}
+	}
 }
 
-void EditURLEncode(bool component) noexcept {
-	const Sci_Position iSelCount = SciCall_GetSelTextLength();
-	if (iSelCount == 0) {
-		return;
+bool GZipInflater::InflateMember() noexcept {
+	// member header: ID1 ID2 CM FLG MTIME(4) XFL OS
+	if (inEnd - in < 18 || in[0] != 0x1f || in[1] != 0x8b || in[2] != 8) {
+		return false;
 	}
-	if (SciCall_IsRectangularSelection()) {
-		NotifyRectangularSelection();
-		return;
+	const uint8_t flags = in[3];
+	in += 10;
+	if (flags & 4) { // FEXTRA
+		const uint32_t xlen = in[0] | (in[1] << 8);
+		if (static_cast<size_t>(inEnd - in) < xlen + 2U) {
+			return false;
+		}
+		in += xlen + 2;
+	}
+	for (uint8_t mask = 8; mask <= 16; mask <<= 1) { // FNAME, FCOMMENT
+		if (flags & mask) {
+			in = static_cast<const uint8_t *>(memchr(in, 0, inEnd - in));
+			if (in == nullptr) {
+				return false;
+			}
+			++in;
+		}
+	}
+	if (flags & 2) { // FHCRC
+		in += 2;
+	}
+	if (in >= inEnd) {
+		return false;
 	}
 
-	DWORD cchEscapedW;
-	LPWSTR pszEscapedW = EditURLEncodeSelection(&cchEscapedW, component);
-	if (pszEscapedW == nullptr) {
-		return;
+	memberStart = pos;
+	bitBuf = 0;
+	bitCount = 0;
+	failed = false;
+	uint32_t last;
+	do {
+		last = Bits(1);
+		const uint32_t type = Bits(2);
+		bool success = false;
+		if (type == 0) {
+			success = InflateStored();
+		} else if (type == 1) {
+			uint8_t lengths[288 + 30];
+			memset(lengths, 8, 144);
+			memset(lengths + 144, 9, 112);
+			memset(lengths + 256, 7, 24);
+			memset(lengths + 280, 8, 8);
+			memset(lengths + 288, 5, 30);
+			success = lengthCodes.Build(lengths, 288) && distanceCodes.Build(lengths + 288, 30) && InflateCodes();
+		} else if (type == 2) {
+			success = InflateDynamic() && InflateCodes();
+		}
+		if (!success || failed) {
+			return false;
+		}
+	} while (!last);
+
+	// trailer: CRC32 ISIZE
+	AlignToByte();
+	if (inEnd - in < 8) {
+		return false;
 	}
+	const uint32_t crc = in[0] | (in[1] << 8) | (in[2] << 16) | (static_cast<uint32_t>(in[3]) << 24);
+	const uint32_t isize = in[4] | (in[5] << 8) | (in[6] << 16) | (static_cast<uint32_t>(in[7]) << 24);
+	in += 8;
+	const size_t length = pos - memberStart;
+	return isize == static_cast<uint32_t>(length)
+		&& crc == UpdateCRC32(0, reinterpret_cast<const uint8_t *>(buffer + offset + memberStart), length);
+}
 
-	const UINT cpEdit = SciCall_GetCodePage();
-	DWORD cchEscaped = cchEscapedW * kMaxMultiByteCount;
-	char *pszEscaped = static_cast<char *>(NP2HeapAlloc(cchEscaped));
-	cchEscaped = WideCharToMultiByte(cpEdit, 0, pszEscapedW, cchEscapedW, pszEscaped, cchEscaped, nullptr, nullptr);
-	EditReplaceMainSelection(cchEscaped, pszEscaped);
+// BGZF member stores total member size minus one in "BC" extra subfield.
+size_t GetBGZFMemberSize(const uint8_t *data, size_t size) noexcept {
+	if (size < 28 || data[0] != 0x1f || data[1] != 0x8b || data[2] != 8 || (data[3] & 4) == 0) {
+		return 0;
+	}
+	const uint32_t xlen = data[10] | (data[11] << 8);
+	const uint8_t *extra = data + 12;
+	const uint8_t * const extraEnd = extra + min<size_t>(xlen, size - 12);
+	while (extraEnd - extra >= 4) {
+		const uint32_t len = extra[2] | (extra[3] << 8);
+		if (extra[0] == 'B' && extra[1] == 'C' && len == 2 && extraEnd - extra >= 6) {
+			const size_t member = (extra[4] | (extra[5] << 8)) + 1;
+			return (member >= 28 && member <= size) ? member : 0;
+		}
+		extra += 4 + len;
+	}
+	return 0;
+}
 
-	NP2HeapFree(pszEscaped);
-	NP2HeapFree(pszEscapedW);
+struct GZipInflatePart {
+	const uint8_t *in;
+	const uint8_t *inEnd;
+	char *out;
+	size_t outSize;
+	bool success;
+};
+
+DWORD WINAPI GZipInflateThread(LPVOID lpParam) noexcept {
+	GZipInflatePart * const part = static_cast<GZipInflatePart *>(lpParam);
+	GZipInflater inflater{part->in, part->inEnd};
+	inflater.buffer = part->out;
+	inflater.capacity = part->outSize;
+	bool success = true;
+	while (success && inflater.in < inflater.inEnd) {
+		success = inflater.InflateMember();
+	}
+	part->success = success && inflater.pos == part->outSize;
+	return 0;
 }
 
-//=============================================================================
-//
-// EditURLDecode()
-//
-void EditURLDecode() noexcept {
-	const Sci_Position iSelCount = SciCall_GetSelTextLength();
-	if (iSelCount == 0) {
-		return;
+// inflate BGZF members on worker threads, each worker gets a run of whole members.
+char *GZipInflateParallel(const uint8_t *data, size_t size, size_t maxSize, size_t *outSize) noexcept {
+	size_t total = 0;
+	const uint8_t *ptr = data;
+	const uint8_t * const end = data + size;
+	while (ptr < end) {
+		const size_t member = GetBGZFMemberSize(ptr, end - ptr);
+		if (member == 0) {
+			return nullptr;
+		}
+		ptr += member;
+		total += ptr[-4] | (ptr[-3] << 8) | (ptr[-2] << 16) | (static_cast<uint32_t>(ptr[-1]) << 24);
 	}
-	if (SciCall_IsRectangularSelection()) {
-		NotifyRectangularSelection();
-		return;
+	if (total == 0 || total > maxSize) {
+		return nullptr;
+	}
+	char * const block = static_cast<char *>(NP2HeapAlloc(total + NP2_ENCODING_DETECTION_PADDING*3));
+	if (block == nullptr) {
+		return nullptr;
 	}
+	char * const output = reinterpret_cast<char *>(NP2_align_up(reinterpret_cast<uintptr_t>(block), NP2_ENCODING_DETECTION_PADDING));
 
-	size_t allocSize = NP2_align_up(iSelCount + 1, MEMORY_ALLOCATION_ALIGNMENT);
-	char * const pszText = static_cast<char *>(NP2HeapAlloc(allocSize * (sizeof(char) + sizeof(WCHAR))));
-	WCHAR * const pszTextW = reinterpret_cast<LPWSTR>(pszText + allocSize);
+	SYSTEM_INFO info;
+	GetSystemInfo(&info);
+	const UINT partCount = clamp<UINT>(info.dwNumberOfProcessors, 1, MAX_PARALLEL_WORKER_COUNT);
+	GZipInflatePart parts[MAX_PARALLEL_WORKER_COUNT];
+	UINT count = 0;
+	ptr = data;
+	size_t written = 0;
+	while (ptr < end) {
+		GZipInflatePart &part = parts[count];
+		part.in = ptr;
+		part.out = output + written;
+		const uint8_t * const target = data + size*(count + 1)/partCount;
+		size_t outputSize = 0;
+		do {
+			ptr += GetBGZFMemberSize(ptr, end - ptr);
+			outputSize += ptr[-4] | (ptr[-3] << 8) | (ptr[-2] << 16) | (static_cast<uint32_t>(ptr[-1]) << 24);
+		} while (ptr < end && (ptr < target || count + 1 == partCount));
+		part.inEnd = ptr;
+		part.outSize = outputSize;
+		part.success = false;
+		written += outputSize;
+		++count;
+	}
+	RunParallelWorker(GZipInflateThread, parts, sizeof(GZipInflatePart), count);
+	for (UINT i = 0; i < count; i++) {
+		if (!parts[i].success) {
+			NP2HeapFree(block);
+			return nullptr;
+		}
+	}
+	*outSize = total;
+	return block;
+}
+
+}
+
+// returns heap block with decompressed data at NP2_ENCODING_DETECTION_PADDING aligned address
+// followed by zero padding, or nullptr when data is not a valid gzip file or is too large.
+static char *EditDecompressGZip(const char *lpData, size_t cbData, size_t maxSize, size_t *outSize) noexcept {
+	const uint8_t * const data = reinterpret_cast<const uint8_t *>(lpData);
+	if (cbData < 18 || data[0] != 0x1f || data[1] != 0x8b || data[2] != 8) {
+		return nullptr;
+	}
+	if (cbData >= NP2_GZIP_PARALLEL_MIN_SIZE && GetBGZFMemberSize(data, cbData) != 0) {
+		char * const block = GZipInflateParallel(data, cbData, maxSize, outSize);
+		if (block != nullptr) {
+			return block;
+		}
+	}
 
-	SciCall_GetSelText(pszText);
-	const UINT cpEdit = SciCall_GetCodePage();
-	MultiByteToWideChar(cpEdit, 0, pszText, static_cast<int>(iSelCount), pszTextW, static_cast<int>(allocSize));
+	GZipInflater inflater{data, data + cbData};
+	// size of last member (modulo 2^32) as hint for single member file
+	const size_t isize = data[cbData - 4] | (data[cbData - 3] << 8) | (data[cbData - 2] << 16) | (static_cast<uint32_t>(data[cbData - 1]) << 24);
+	inflater.limit = maxSize;
+	inflater.capacity = min(max(isize, cbData*4), maxSize);
+	inflater.growable = true;
+	inflater.buffer = static_cast<char *>(NP2HeapAlloc(inflater.capacity + NP2_ENCODING_DETECTION_PADDING*3));
+	if (inflater.buffer == nullptr) {
+		return nullptr;
+	}
+	inflater.offset = NP2_align_up(reinterpret_cast<uintptr_t>(inflater.buffer), NP2_ENCODING_DETECTION_PADDING) - reinterpret_cast<uintptr_t>(inflater.buffer);
+	bool success = true;
+	while (success && inflater.HasMember()) {
+		success = inflater.InflateMember();
+	}
+	if (!success || inflater.pos == 0) {
+		NP2HeapFree(inflater.buffer);
+		return nullptr;
+	}
+	// clear bytes left by moving data for alignment
+	memset(inflater.buffer + inflater.offset + inflater.pos, 0, NP2_ENCODING_DETECTION_PADDING*2);
+	*outSize = inflater.pos;
+	return inflater.buffer;
+}
 
-	allocSize *= kMaxMultiByteCount;
-	char * const pszUnescaped = static_cast<char *>(NP2HeapAlloc(allocSize * (sizeof(char) + sizeof(WCHAR))));
-	WCHAR * const pszUnescapedW = reinterpret_cast<LPWSTR>(pszUnescaped + allocSize);
+// size of current file when the document is same as file content (without BOM),
+// used to append text written to end of the file, -1 when the file is converted.
+static LONGLONG loadedFileSize = -1;
 
-	DWORD cchUnescapedW = static_cast<DWORD>(allocSize);
-	int cchUnescaped = cchUnescapedW;
-	UrlUnescape(pszTextW, pszUnescapedW, &cchUnescapedW, URL_UNESCAPE_AS_UTF8);
-	if (!IsWin8AndAbove()) {
-		char *ptr = pszUnescaped;
-		LPCWSTR t = pszUnescapedW;
-		WCHAR ch;
-		while ((ch = *t++) != 0) {
-			if (ch > 0xff) {
-				break;
-			}
-			*ptr++ = static_cast<char>(ch);
+// byte spans changed by same length modifications since the file was loaded or saved,
+// only these spans are written back when saving huge unconverted file, see EditSaveFileInPlace().
+#define NP2_IN_PLACE_SAVE_MAX_SPANS		64
+#define NP2_IN_PLACE_SAVE_CHUNK_SIZE	(1U << 20)
+
+struct InPlaceSaveSpan {
+	Sci_Position start;
+	Sci_Position end;
+};
+
+static struct InPlaceSaveState {
+	bool valid;
+	// text deleted, waiting for insertion of same length at same position
+	bool pending;
+	int iEncoding;
+	UINT spanCount;
+	Sci_Position pendingPos;
+	Sci_Position pendingLen;
+	Sci_Position docLength;
+	BY_HANDLE_FILE_INFORMATION info;
+	InPlaceSaveSpan spans[NP2_IN_PLACE_SAVE_MAX_SPANS];
+} inPlaceSave;
+
+static void InPlaceSave_Arm(const BY_HANDLE_FILE_INFORMATION &info, int iEncoding) noexcept {
+	InPlaceSaveState &state = inPlaceSave;
+	state.valid = true;
+	state.pending = false;
+	state.iEncoding = iEncoding;
+	state.spanCount = 0;
+	state.docLength = SciCall_GetLength();
+	state.info = info;
+}
+
+static void InPlaceSave_AddSpan(Sci_Position start, Sci_Position end) noexcept {
+	InPlaceSaveState &state = inPlaceSave;
+	for (UINT i = 0; i < state.spanCount; i++) {
+		InPlaceSaveSpan &span = state.spans[i];
+		if (start <= span.end && end >= span.start) {
+			span.start = min(span.start, start);
+			span.end = max(span.end, end);
+			return;
 		}
-		*ptr = '\0';
-		if (ptr == pszUnescaped + cchUnescapedW && IsUTF8(pszUnescaped, cchUnescapedW)) {
-			cchUnescapedW = MultiByteToWideChar(CP_UTF8, 0, pszUnescaped, cchUnescapedW, pszUnescapedW, cchUnescaped);
+	}
+	if (state.spanCount == COUNTOF(state.spans)) {
+		// too many scattered changes, write them as one span
+		InPlaceSaveSpan &span = state.spans[0];
+		for (UINT i = 1; i < state.spanCount; i++) {
+			span.start = min(span.start, state.spans[i].start);
+			span.end = max(span.end, state.spans[i].end);
 		}
+		span.start = min(span.start, start);
+		span.end = max(span.end, end);
+		state.spanCount = 1;
+		return;
 	}
-
-	cchUnescaped = WideCharToMultiByte(cpEdit, 0, pszUnescapedW, cchUnescapedW, pszUnescaped, static_cast<int>(allocSize), nullptr, nullptr);
-	EditReplaceMainSelection(cchUnescaped, pszUnescaped);
-
-	NP2HeapFree(pszText);
-	NP2HeapFree(pszUnescaped);
+	state.spans[state.spanCount++] = { start, end };
 }
 
-//=============================================================================
-//
-// EditEscapeCChars()
-//
-void EditEscapeCChars(HWND hwnd) noexcept {
-	if (SciCall_IsSelectionEmpty()) {
+void EditInPlaceSaveModified(int modificationType, Sci_Position position, Sci_Position length, Sci_Position lengthBefore) noexcept {
+	InPlaceSaveState &state = inPlaceSave;
+	if (!state.valid) {
 		return;
 	}
-	if (SciCall_IsRectangularSelection()) {
-		NotifyRectangularSelection();
-		return;
+	// replacement is notified as deletion followed by insertion at same position
+	if (modificationType & SC_MOD_BATCHUPDATE) {
+		if (state.pending || length != lengthBefore) {
+			state.valid = false;
+		} else {
+			InPlaceSave_AddSpan(position, position + length);
+		}
+	} else if (modificationType & SC_MOD_DELETETEXT) {
+		if (state.pending) {
+			state.valid = false;
+		} else {
+			state.pending = true;
+			state.pendingPos = position;
+			state.pendingLen = length;
+		}
+	} else if (state.pending && position == state.pendingPos && length == state.pendingLen) {
+		state.pending = false;
+		InPlaceSave_AddSpan(position, position + length);
+	} else {
+		state.valid = false;
 	}
+}
 
-	EDITFINDREPLACE * const efr = static_cast<EDITFINDREPLACE *>(NP2HeapAlloc(sizeof(EDITFINDREPLACE)));
-	efr->hwnd = hwnd;
-	SciCall_BeginBatchUpdate();
-	const int rid = pLexCurrent->rid;
-
-	StrCpyEx(efr->szFind, "\\");
-	StrCpyEx(efr->szReplace, "\\\\");
-	EditReplaceAllInSelection(hwnd, efr);
+// write changed spans into the unchanged loaded file, returns false to do a full save.
+static bool EditSaveFileInPlace(LPCWSTR pszFile, int saveFlag, const EditFileIOStatus &status) noexcept {
+	InPlaceSaveState &state = inPlaceSave;
+	const Sci_Position length = SciCall_GetLength();
+	if (!state.valid || state.pending || dwInPlaceSaveThreshold == 0 || (saveFlag & FileSaveFlag_SaveCopy)
+		|| status.iEncoding != state.iEncoding || length != state.docLength
+		|| length < (static_cast<Sci_Position>(dwInPlaceSaveThreshold) << 20)) {
+		return false;
+	}
 
-	StrCpyEx(efr->szFind, "\"");
-	if (rid == NP2LEX_RESOURCESCRIPT) {
-		StrCpyEx(efr->szReplace, "\"\"");
-	} else {
-		StrCpyEx(efr->szReplace, "\\\"");
+	HANDLE hFile = CreateFile(pszFile,
+					   GENERIC_READ | GENERIC_WRITE,
+					   FILE_SHARE_READ,
+					   nullptr, OPEN_EXISTING,
+					   FILE_ATTRIBUTE_NORMAL,
+					   nullptr);
+	if (hFile == INVALID_HANDLE_VALUE) {
+		return false;
 	}
-	EditReplaceAllInSelection(hwnd, efr);
 
-	if (rid != NP2LEX_RESOURCESCRIPT) {
-		StrCpyEx(efr->szFind, "\'");
-		StrCpyEx(efr->szReplace, "\\\'");
-		EditReplaceAllInSelection(hwnd, efr);
+	BY_HANDLE_FILE_INFORMATION info;
+	FILE_BASIC_INFO timestamp;
+	bool bSuccess = GetFileInformationByHandle(hFile, &info) && IsSameFileIdentity(info, state.info);
+	if (bSuccess && (saveFlag & FileSaveFlag_OriginalTimestamp)) {
+		bSuccess = GetFileInformationByHandleEx(hFile, FileBasicInfo, &timestamp, sizeof(timestamp));
+	}
+	char *buffer = nullptr;
+	if (bSuccess) {
+		buffer = static_cast<char *>(NP2HeapAlloc(NP2_IN_PLACE_SAVE_CHUNK_SIZE + 1));
+		bSuccess = buffer != nullptr;
+	}
+
+	const ULONGLONG bomLength = (mEncoding[state.iEncoding].uFlags & NCP_UTF8_SIGN) ? 3 : 0;
+	for (UINT i = 0; bSuccess && i < state.spanCount; i++) {
+		Sci_Position start = state.spans[i].start;
+		const Sci_Position end = min(state.spans[i].end, length);
+		while (bSuccess && start < end) {
+			// copy text out instead of SciCall_GetRangePointer() to avoid moving the gap
+			const DWORD count = static_cast<DWORD>(min<Sci_Position>(end - start, NP2_IN_PLACE_SAVE_CHUNK_SIZE));
+			const Sci_TextRangeFull tr = { { start, start + count }, buffer };
+			SciCall_GetTextRangeFull(&tr);
+			const ULONGLONG offset = bomLength + start;
+			OVERLAPPED overlapped {};
+			overlapped.Offset = static_cast<DWORD>(offset);
+			overlapped.OffsetHigh = static_cast<DWORD>(offset >> 32);
+			DWORD dwWritten = 0;
+			bSuccess = WriteFile(hFile, buffer, count, &dwWritten, &overlapped) && dwWritten == count;
+			start += count;
+		}
+	}
+	if (bSuccess) {
+		bSuccess = FlushFileBuffers(hFile);
+	}
+	dwLastIOError = GetLastError();
+	if (bSuccess) {
+		if (saveFlag & FileSaveFlag_OriginalTimestamp) {
+			SetFileInformationByHandle(hFile, FileBasicInfo, &timestamp, sizeof(timestamp));
+		}
+		if (GetFileInformationByHandle(hFile, &info)) {
+			InPlaceSave_Arm(info, state.iEncoding);
+		} else {
+			state.valid = false;
+		}
 	}
+	NP2HeapFree(buffer);
+	CloseHandle(hFile);
+	return bSuccess;
+}
 
-	NP2HeapFree(efr);
-	SciCall_EndBatchUpdate();
+static void InPlaceSave_ArmSaved(LPCWSTR pszFile, int iEncoding) noexcept {
+	inPlaceSave.valid = false;
+	if (dwInPlaceSaveThreshold != 0 && (mEncoding[iEncoding].uFlags & (NCP_UTF8 | NCP_DEFAULT)) != 0) {
+		HANDLE hFile = CreateFile(pszFile, FILE_READ_ATTRIBUTES, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+			nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+		if (hFile != INVALID_HANDLE_VALUE) {
+			BY_HANDLE_FILE_INFORMATION info;
+			if (GetFileInformationByHandle(hFile, &info)) {
+				InPlaceSave_Arm(info, iEncoding);
+			}
+			CloseHandle(hFile);
+		}
+	}
 }
 
-//=============================================================================
-//
-// EditUnescapeCChars()
-//
-void EditUnescapeCChars(HWND hwnd) noexcept {
-	if (SciCall_IsSelectionEmpty()) {
-		return;
+bool EditLoadFile(LPWSTR pszFile, EditFileIOStatus &status) noexcept {
+	loadedFileSize = -1;
+	inPlaceSave.valid = false;
+	HANDLE hFile = CreateFile(pszFile,
+					   GENERIC_READ,
+					   FILE_SHARE_READ | FILE_SHARE_WRITE,
+					   nullptr, OPEN_EXISTING,
+					   FILE_ATTRIBUTE_NORMAL,
+					   nullptr);
+	dwLastIOError = GetLastError();
+
+	if (hFile == INVALID_HANDLE_VALUE) {
+		return false;
 	}
-	if (SciCall_IsRectangularSelection()) {
-		NotifyRectangularSelection();
-		return;
+
+	LARGE_INTEGER fileSize;
+	fileSize.QuadPart = 0;
+	if (!GetFileSizeEx(hFile, &fileSize)) {
+		dwLastIOError = GetLastError();
+		CloseHandle(hFile);
+		return false;
 	}
 
-	EDITFINDREPLACE * const efr = static_cast<EDITFINDREPLACE *>(NP2HeapAlloc(sizeof(EDITFINDREPLACE)));
-	efr->hwnd = hwnd;
-	SciCall_BeginBatchUpdate();
-	const int rid = pLexCurrent->rid;
+	// display real path name
+	PathGetRealPath(hFile, pszFile, pszFile);
 
-	StrCpyEx(efr->szFind, "\\\\");
-	StrCpyEx(efr->szReplace, "\\");
-	EditReplaceAllInSelection(hwnd, efr);
+	// Check if a warning message should be displayed for large files
+#if defined(_WIN64)
+	// less than 1/2 available physical memory:
+	//     1. Buffers we allocated below or when saving file, depends on encoding.
+	//     2. Scintilla's content buffer and style buffer, see CellBuffer class.
+	//        The style buffer is disabled when using SCLEX_NULL (Text File, 2nd Text File, ANSI Art).
+	//        i.e. when default scheme is Text File or 2nd Text File, memory required to load the file
+	//        is about fileSize*2, buffers we allocated below can be reused by system to served
+	//        as Scintilla's style buffer when calling SciCall_SetLexer() inside Style_SetLexer().
+	//     3. Extra memory when moving gaps on editing, it may require more than 2/3 physical memory.
+	// large file TODO: https://github.com/zufuliu/notepad4/issues/125
+	// [x] [> 4 GiB] use ReadFile()/WriteFile() in chunks to read/write file, see EditReadFile() and EditWriteFile().
+	// [-] [> 1 GiB] fix encoding conversion with MultiByteToWideChar() and WideCharToMultiByte().
+	//     UTF-16 file is converted in parts, see EditConvertUTF16ToUTF8().
+	LONGLONG maxFileSize = INT64_MAX;
+#else
+	// 2 GiB: ptrdiff_t / Sci_Position used in Scintilla
+	LONGLONG maxFileSize = INT64_C(2) << 30;
+#endif
 
-	if (rid == NP2LEX_RESOURCESCRIPT) {
-		StrCpyEx(efr->szFind, "\"\"");
-	} else {
-		StrCpyEx(efr->szFind, "\\\"");
+	// file loaded through copy-on-write view is backed by the file itself instead of page file,
+	// for UTF-8 and ANSI file, only Scintilla's content buffer is committed.
+	// remote file is read on background thread instead, as page faults on the view would block UI.
+	const bool bNetworkFile = PathIsNetworkPath(pszFile);
+	bool bMapFile = CanLoadFileMapped(fileSize.QuadPart) && !bNetworkFile;
+	MEMORYSTATUSEX statex;
+	statex.dwLength = sizeof(statex);
+	statex.ullTotalPhys = 0;
+	GlobalMemoryStatusEx(&statex);
+	// less than 2/3 physical memory for mapped file.
+	const ULONGLONG maxMem = bMapFile ? (statex.ullTotalPhys/3U)*2U : statex.ullTotalPhys/2U;
+	if (maxMem < static_cast<ULONGLONG>(maxFileSize)) {
+		maxFileSize = static_cast<LONGLONG>(maxMem);
 	}
-	StrCpyEx(efr->szReplace, "\"");
-	EditReplaceAllInSelection(hwnd, efr);
 
-	if (rid != NP2LEX_RESOURCESCRIPT) {
-		StrCpyEx(efr->szFind, "\\\'");
-		StrCpyEx(efr->szReplace, "\'");
-		EditReplaceAllInSelection(hwnd, efr);
+	if (fileSize.QuadPart > maxFileSize) {
+		status.bFileTooBig = true;
+		WCHAR tchDocSize[32];
+		WCHAR tchMaxSize[32];
+		WCHAR tchDocBytes[32];
+		WCHAR tchMaxBytes[32];
+		StrFormatByteSize(fileSize.QuadPart, tchDocSize, COUNTOF(tchDocSize));
+		StrFormatByteSize(maxFileSize, tchMaxSize, COUNTOF(tchMaxSize));
+		FormatNumber64(tchDocBytes, fileSize.QuadPart);
+		FormatNumber64(tchMaxBytes, maxFileSize);
+		if (MsgBoxWarn(MB_YESNO, IDS_ASK_VIEW_BIG_FILE, pszFile, tchDocSize, tchDocBytes, tchMaxSize, tchMaxBytes) == IDYES) {
+			// viewer owns the file handle on success
+			if (EditViewerOpen(hFile, fileSize.QuadPart, false, status)) {
+				status.bFileTooBig = false;
+				return true;
+			}
+			status.bFileTooBig = false;
+		}
+		CloseHandle(hFile);
+		return false;
 	}
 
-	NP2HeapFree(efr);
-	SciCall_EndBatchUpdate();
-}
+	// file identity for retained data and in-place save
+	BY_HANDLE_FILE_INFORMATION fileInfo;
+	const bool bFileInfo = (bRetainFileData || dwInPlaceSaveThreshold != 0) && GetFileInformationByHandle(hFile, &fileInfo);
 
-// XML/HTML predefined entity
-// https://en.wikipedia.org/wiki/List_of_XML_and_HTML_character_entity_references
-// &quot;	["]
-// &amp;	[&]
-// &apos;	[']
-// &lt;		[<]
-// &gt;		[>]
-// &nbsp;	[ ]
-// &emsp;	[\t]
-//=============================================================================
-//
-// EditEscapeXHTMLChars()
-//
-void EditEscapeXHTMLChars(HWND hwnd) noexcept {
-	if (SciCall_IsSelectionEmpty()) {
-		return;
-	}
-	if (SciCall_IsRectangularSelection()) {
-		NotifyRectangularSelection();
-		return;
+	char *lpData = nullptr;
+	if (bMapFile) {
+		HANDLE hMap = CreateFileMapping(hFile, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+		if (hMap != nullptr) {
+			// encoding detection and conversion may modify the data in place.
+			lpData = static_cast<char *>(MapViewOfFile(hMap, FILE_MAP_COPY, 0, 0, 0));
+			CloseHandle(hMap);
+		}
+		bMapFile = lpData != nullptr;
+	}
+
+	char *lpDataUTF8 = lpData;
+	size_t cbData = static_cast<size_t>(fileSize.QuadPart);
+	BOOL bReadSuccess = TRUE;
+	if (!bMapFile) {
+		lpData = static_cast<char *>(NP2HeapAlloc(static_cast<size_t>(fileSize.QuadPart) + NP2_ENCODING_DETECTION_PADDING*2));
+		if (lpData == nullptr) {
+			dwLastIOError = ERROR_NOT_ENOUGH_MEMORY;
+			CloseHandle(hFile);
+			return false;
+		}
+		lpDataUTF8 = reinterpret_cast<char *>(NP2_align_up(reinterpret_cast<uintptr_t>(lpData), NP2_ENCODING_DETECTION_PADDING));
+		const bool bRetain = bRetainFileData && bNetworkFile && bFileInfo;
+		if (!bRetain || !EditReadRetainedFile(fileInfo, lpDataUTF8, static_cast<size_t>(fileSize.QuadPart), &cbData)) {
+			EditReleaseRetainedFile();
+			if (fileSize.QuadPart >= NP2_ASYNC_LOAD_MIN_SIZE) {
+				bReadSuccess = EditReadFileAsync(hFile, pszFile, lpDataUTF8, static_cast<size_t>(fileSize.QuadPart), &cbData);
+			} else {
+				bReadSuccess = EditReadFile(hFile, lpDataUTF8, static_cast<size_t>(fileSize.QuadPart), &cbData);
+			}
+			// keep a copy before encoding detection and conversion modify the data in place.
+			if (bReadSuccess && bRetain && cbData == static_cast<size_t>(fileSize.QuadPart)) {
+				EditRetainFile(fileInfo, lpDataUTF8, cbData);
+			}
+		}
+	} else {
+		EditReleaseRetainedFile();
 	}
+	dwLastIOError = GetLastError();
+	CloseHandle(hFile);
 
-	EDITFINDREPLACE * const efr = static_cast<EDITFINDREPLACE *>(NP2HeapAlloc(sizeof(EDITFINDREPLACE)));
-	efr->hwnd = hwnd;
-	SciCall_BeginBatchUpdate();
+	if (!bReadSuccess) {
+		NP2HeapFree(lpData);
+		return false;
+	}
 
-	StrCpyEx(efr->szFind, "&");
-	StrCpyEx(efr->szReplace, "&amp;");
-	EditReplaceAllInSelection(hwnd, efr);
+	// decompressed content is loaded in read only mode, file is left unchanged when it's not a valid gzip file.
+	status.bCompressed = false;
+	if (cbData >= 18 && static_cast<uint8_t>(lpDataUTF8[0]) == 0x1f && static_cast<uint8_t>(lpDataUTF8[1]) == 0x8b) {
+		size_t cbDecompressed = 0;
+		char * const block = EditDecompressGZip(lpDataUTF8, cbData, static_cast<size_t>(maxFileSize), &cbDecompressed);
+		if (block != nullptr) {
+			EditFreeFileData(lpData, bMapFile);
+			bMapFile = false;
+			lpData = block;
+			lpDataUTF8 = reinterpret_cast<char *>(NP2_align_up(reinterpret_cast<uintptr_t>(block), NP2_ENCODING_DETECTION_PADDING));
+			cbData = cbDecompressed;
+			status.bCompressed = true;
+		}
+	}
 
-	StrCpyEx(efr->szFind, "\"");
-	StrCpyEx(efr->szReplace, "&quot;");
-	EditReplaceAllInSelection(hwnd, efr);
+	status.iEOLMode = GetScintillaEOLMode(iDefaultEOLMode);
+	status.bInconsistent = false;
+	status.totalLineCount = 1;
 
-	StrCpyEx(efr->szFind, "\'");
-	StrCpyEx(efr->szReplace, "&apos;");
-	EditReplaceAllInSelection(hwnd, efr);
+	int encodingFlag = EncodingFlag_None;
+	int iEncoding = EditDetermineEncoding(pszFile, lpDataUTF8, cbData, &encodingFlag);
+	if (iEncoding == CPI_DEFAULT && encodingFlag == EncodingFlag_UTF7) {
+		iEncoding = Encoding_GetAnsiIndex();
+	}
+	status.iEncoding = iEncoding;
+	status.bBinaryFile = encodingFlag & EncodingFlag_Binary;
+	status.bEncodingSampled = encodingFlag & EncodingFlag_Sampled;
+	UINT uFlags = mEncoding[iEncoding].uFlags;
 
-	StrCpyEx(efr->szFind, "<");
-	StrCpyEx(efr->szReplace, "&lt;");
-	EditReplaceAllInSelection(hwnd, efr);
+	if (cbData == 0) {
+		SciCall_SetCodePage((uFlags & NCP_DEFAULT) ? iDefaultCodePage : SC_CP_UTF8);
+		EditSetEmptyText();
+		SciCall_SetEOLMode(status.iEOLMode);
+		EditFreeFileData(lpData, bMapFile);
+		loadedFileSize = (!status.bCompressed && (uFlags & (NCP_UTF8 | NCP_DEFAULT))) ? fileSize.QuadPart : -1;
+		return true;
+	}
 
-	StrCpyEx(efr->szFind, ">");
-	StrCpyEx(efr->szReplace, "&gt;");
-	EditReplaceAllInSelection(hwnd, efr);
+	if (status.bBinaryFile && bBinaryFileHexView && !status.bCompressed) {
+		// show binary file as hex dump, the file is opened again as handle is already closed.
+		EditFreeFileData(lpData, bMapFile);
+		hFile = CreateFile(pszFile, GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+		if (hFile == INVALID_HANDLE_VALUE) {
+			dwLastIOError = GetLastError();
+			return false;
+		}
+		if (EditViewerOpen(hFile, fileSize.QuadPart, true, status)) {
+			return true;
+		}
+		CloseHandle(hFile);
+		return false;
+	}
 
-	if (pLexCurrent->iLexer != SCLEX_XML) {
-		StrCpyEx(efr->szFind, " ");
-		StrCpyEx(efr->szReplace, "&nbsp;");
-		EditReplaceAllInSelection(hwnd, efr);
+	size_t offset = 0; // include BOM to make lpDataUTF8 aligned
+	if (uFlags & NCP_UTF8) {
+		if (uFlags & NCP_UTF8_SIGN) {
+			offset = 3;
+			lpDataUTF8 += 3;
+			cbData -= 3;
+		}
+	} else if ((uFlags & NCP_UNICODE) != 0 && cbData >= NP2_PARALLEL_CONVERT_MIN_SIZE) {
+		LPWSTR pszTextW = (uFlags & NCP_UNICODE_BOM) ? (reinterpret_cast<LPWSTR>(lpDataUTF8) + 1) : reinterpret_cast<LPWSTR>(lpDataUTF8);
+		const size_t cchTextW = (cbData / sizeof(WCHAR)) - ((uFlags & NCP_UNICODE_BOM) ? 1 : 0);
+		const bool bReverse = (uFlags & NCP_UNICODE_REVERSE) != 0 && encodingFlag != EncodingFlag_Reversed;
+		lpDataUTF8 = EditConvertUTF16ToUTF8(pszTextW, cchTextW, bReverse, &cbData);
+		EditFreeFileData(lpData, bMapFile);
+		if (lpDataUTF8 == nullptr) {
+			dwLastIOError = ERROR_NOT_ENOUGH_MEMORY;
+			return false;
+		}
+		bMapFile = false;
+		lpData = lpDataUTF8;
+		fvCurFile.Init(lpData, cbData);
+	} else if (uFlags & NCP_UNICODE) {
+		LPCWSTR pszTextW = (uFlags & NCP_UNICODE_BOM) ? (reinterpret_cast<LPWSTR>(lpDataUTF8) + 1) : reinterpret_cast<LPWSTR>(lpDataUTF8);
+		// NOTE: requires two extra trailing NULL bytes.
+		const int cchTextW = static_cast<int>((uFlags & NCP_UNICODE_BOM) ? (cbData / sizeof(WCHAR)) : ((cbData / sizeof(WCHAR)) + 1));
+		if ((uFlags & NCP_UNICODE_REVERSE) != 0 && encodingFlag != EncodingFlag_Reversed) {
+			_swab(lpDataUTF8, lpDataUTF8, cbData);
+		}
+		// cbData/2 => WCHAR, WCHAR*3 => UTF-8
+		lpDataUTF8 = static_cast<char *>(NP2HeapAlloc((cbData + 1)*sizeof(WCHAR)));
+		const int size = static_cast<int>(NP2HeapSize(lpDataUTF8));
+		cbData = WideCharToMultiByte(CP_UTF8, 0, pszTextW, cchTextW, lpDataUTF8, size, nullptr, nullptr);
+		if (cbData == 0) {
+			const UINT legacyACP = mEncoding[CPI_DEFAULT].uCodePage;
+			cbData = WideCharToMultiByte(legacyACP, 0, pszTextW, -1, lpDataUTF8, size, nullptr, nullptr);
+			status.bUnicodeErr = true;
+		}
+		if (cbData != 0) {
+			// remove the NULL terminator.
+			cbData -= 1;
+		}
 
-		StrCpyEx(efr->szFind, "\t");
-		StrCpyEx(efr->szReplace, "&emsp;");
-		EditReplaceAllInSelection(hwnd, efr);
+		EditFreeFileData(lpData, bMapFile);
+		bMapFile = false;
+		lpData = lpDataUTF8;
+		fvCurFile.Init(lpData, cbData);
+	} else if (uFlags & (NCP_8BIT | NCP_7BIT)) {
+		if (encodingFlag != EncodingFlag_UTF7 || (uFlags & NCP_7BIT) != 0) {
+			const UINT uCodePage = mEncoding[iEncoding].uCodePage;
+			lpDataUTF8 = EditRecodeAsUTF8(lpDataUTF8, cbData, uCodePage, &cbData);
+			EditFreeFileData(lpData, bMapFile);
+			bMapFile = false;
+			lpData = lpDataUTF8;
+		}
+	} else if (cbData < MAX_NON_UTF8_SIZE && (encodingFlag & (EncodingFlag_Binary | EncodingFlag_Invalid)) == 0
+		&& ((bLoadANSIasUTF8 && !(iSrcEncoding == CPI_DEFAULT || iWeakSrcEncoding == CPI_DEFAULT))
+		|| (GetACP() == CP_UTF8))) {
+		// try to load ANSI / unknown encoding as UTF-8
+		DWORD back = static_cast<DWORD>(cbData);
+		const UINT legacyACP = mEncoding[CPI_DEFAULT].uCodePage;
+		char * const result = RecodeAsUTF8(lpDataUTF8, &back, legacyACP, MB_ERR_INVALID_CHARS);
+		if (result) {
+			EditFreeFileData(lpData, bMapFile);
+			bMapFile = false;
+			lpDataUTF8 = result;
+			lpData = result;
+			cbData = back;
+			uFlags = 0;
+			status.iEncoding = Encoding_GetIndex(legacyACP);
+		}
 	}
 
-	NP2HeapFree(efr);
-	SciCall_EndBatchUpdate();
-}
+	Sci_Position *lineStarts = nullptr;
+	if (cbData) {
+		// StopWatch watch;
+		// watch.Start();
+		if (cbData >= NP2_PARALLEL_EOL_MIN_SIZE) {
+			lineStarts = EditDetectEOLModeParallel(lpDataUTF8, cbData, status);
+		} else {
+			EditDetectEOLMode(lpDataUTF8 - offset, cbData + offset, status);
+		}
+		// watch.Stop();
+		// watch.ShowLog("EOL time");
+		// printf("CR+LF: %zu, LF: %zu, CR: %zu\n", status.linesCount[SC_EOL_CRLF], status.linesCount[SC_EOL_LF], status.linesCount[SC_EOL_CR]);
+		EditDetectIndentation(lpDataUTF8, cbData, fvCurFile);
+	}
+	SciCall_SetCodePage((uFlags & NCP_DEFAULT) ? iDefaultCodePage : SC_CP_UTF8);
+	EditSetNewText(lpDataUTF8, cbData, status.totalLineCount, lineStarts);
 
-//=============================================================================
-//
-// EditUnescapeXHTMLChars()
-//
-void EditUnescapeXHTMLChars(HWND hwnd) noexcept {
-	if (SciCall_IsSelectionEmpty()) {
-		return;
+	if (lineStarts != nullptr) {
+		NP2HeapFree(lineStarts);
 	}
-	if (SciCall_IsRectangularSelection()) {
-		NotifyRectangularSelection();
-		return;
+	EditFreeFileData(lpData, bMapFile);
+	loadedFileSize = (!status.bCompressed && (uFlags & (NCP_UTF8 | NCP_DEFAULT))) ? fileSize.QuadPart : -1;
+	if (loadedFileSize >= 0 && bFileInfo && dwInPlaceSaveThreshold != 0) {
+		InPlaceSave_Arm(fileInfo, status.iEncoding);
 	}
-
-	EDITFINDREPLACE * const efr = static_cast<EDITFINDREPLACE *>(NP2HeapAlloc(sizeof(EDITFINDREPLACE)));
-	efr->hwnd = hwnd;
-	SciCall_BeginBatchUpdate();
-
-	StrCpyEx(efr->szFind, "&quot;");
-	StrCpyEx(efr->szReplace, "\"");
-	EditReplaceAllInSelection(hwnd, efr);
-
-	StrCpyEx(efr->szFind, "&apos;");
-	StrCpyEx(efr->szReplace, "\'");
-	EditReplaceAllInSelection(hwnd, efr);
-
-	StrCpyEx(efr->szFind, "&lt;");
-	StrCpyEx(efr->szReplace, "<");
-	EditReplaceAllInSelection(hwnd, efr);
-
-	StrCpyEx(efr->szFind, "&gt;");
-	StrCpyEx(efr->szReplace, ">");
-	EditReplaceAllInSelection(hwnd, efr);
-
-	StrCpyEx(efr->szFind, "&nbsp;");
-	StrCpyEx(efr->szReplace, " ");
-	EditReplaceAllInSelection(hwnd, efr);
-
-	StrCpyEx(efr->szFind, "&amp;");
-	StrCpyEx(efr->szReplace, "&");
-	EditReplaceAllInSelection(hwnd, efr);
-
-	StrCpyEx(efr->szFind, "&emsp;");
-	StrCpyEx(efr->szReplace, "\t");
-	EditReplaceAllInSelection(hwnd, efr);
-
-	NP2HeapFree(efr);
-	SciCall_EndBatchUpdate();
+	return true;
 }
 
-//=============================================================================
-//
-// EditChar2Hex()
-//
+// append text written to end of current file since last load, returns false when full reload is
+// required: the file is truncated or rewritten, or the file is converted on loading.
+#define NP2_MAX_APPEND_TAIL_SIZE	(256U << 20)
+#define NP2_APPEND_TAIL_CHECK_SIZE	64
 
-/*				C/C++	C#	Java	JS	JSON	Python	PHP	Lua		Go
-\ooo		3	1			1					1		1	1/ddd	1
-\xHH		2	1		1			1			1		1			1
-\uHHHH		4	1			1		1	1		1					1
-\UHHHHHHHH	8	1								1					1
-\xHHHH		4			1
-\uHHHHHH	6				1
-*/
-#define BMP_UNICODE_HEX_DIGIT	4
-#define MAX_UNICODE_HEX_DIGIT	8
+bool EditAppendFileTail(LPCWSTR pszFile) noexcept {
+	const LONGLONG oldSize = loadedFileSize;
+	if (oldSize < 0) {
+		return false;
+	}
 
-void EditCharacterToHex() noexcept {
-	Sci_Position iSelCount = SciCall_GetSelTextLength();
-	if (iSelCount == 0) {
-		return;
+	HANDLE hFile = CreateFile(pszFile,
+					   GENERIC_READ,
+					   FILE_SHARE_READ | FILE_SHARE_WRITE,
+					   nullptr, OPEN_EXISTING,
+					   FILE_ATTRIBUTE_NORMAL,
+					   nullptr);
+	if (hFile == INVALID_HANDLE_VALUE) {
+		return false;
 	}
-	if (SciCall_IsRectangularSelection()) {
-		NotifyRectangularSelection();
-		return;
+
+	LARGE_INTEGER fileSize;
+	fileSize.QuadPart = 0;
+	const Sci_Position length = SciCall_GetLength();
+	// compare bytes before old end of file to detect rewritten file
+	const DWORD check = static_cast<DWORD>(min<Sci_Position>(length, NP2_APPEND_TAIL_CHECK_SIZE));
+	if (!GetFileSizeEx(hFile, &fileSize) || fileSize.QuadPart < oldSize
+		|| fileSize.QuadPart - oldSize > NP2_MAX_APPEND_TAIL_SIZE || oldSize - check < 0) {
+		CloseHandle(hFile);
+		return false;
 	}
 
-	iSelCount *= MAX_UNICODE_HEX_DIGIT;
-	iSelCount = NP2_align_up(iSelCount + 1, MEMORY_ALLOCATION_ALIGNMENT);
-	char * const pszText = static_cast<char *>(NP2HeapAlloc(iSelCount * (sizeof(char) + sizeof(WCHAR))));
-	SciCall_GetSelText(pszText);
+	const DWORD cbData = static_cast<DWORD>(fileSize.QuadPart - oldSize) + check;
+	char * const lpData = static_cast<char *>(NP2HeapAlloc(cbData + 1));
+	DWORD cbRead = 0;
+	LARGE_INTEGER offset;
+	offset.QuadPart = oldSize - check;
+	bool bSuccess = lpData != nullptr && SetFilePointerEx(hFile, offset, nullptr, FILE_BEGIN)
+		&& ReadFile(hFile, lpData, cbData, &cbRead, nullptr) && cbRead == cbData
+		&& memcmp(lpData, SciCall_GetRangePointer(length - check, check), check) == 0;
+	CloseHandle(hFile);
 
-	int outLen = 0;
-	if (pszText[0] == '\0') {
-		outLen = 4;
-		StrCpyEx(pszText, "\\x00");
-	} else {
-		WCHAR * const pszTextW = reinterpret_cast<WCHAR *>(pszText + iSelCount);
+	if (bSuccess) {
+		const char *lpAppend = lpData + check;
+		size_t cbAppend = cbData - check;
+		// keep incomplete character for next append
 		const UINT cpEdit = SciCall_GetCodePage();
-		const int count = MultiByteToWideChar(cpEdit, 0, pszText, -1, pszTextW, static_cast<int>(iSelCount)) - 1; // '\0'
-		for (Sci_Position i = 0; i < count; i++) {
-			const WCHAR c = pszTextW[i];
-			if (c <= 0xFF) {
-				outLen += sprintf(pszText + outLen, "\\x%02X", c); // \xHH
-			} else {
-				outLen += sprintf(pszText + outLen, "\\u%04X", c); // \uHHHH
+		if (cpEdit == SC_CP_UTF8) {
+			cbAppend -= GetUTF8IncompleteTailSize(lpAppend, cbAppend);
+		} else if (IsDBCSCodePage(cpEdit)) {
+			// keep incomplete line, as it's hard to find character boundary from end
+			while (cbAppend != 0 && !IsEOLChar(lpAppend[cbAppend - 1])) {
+				--cbAppend;
 			}
 		}
-		if (count == 2 && IS_SURROGATE_PAIR(pszTextW[0], pszTextW[1])) {
-			const UINT value = UTF16_TO_UTF32(pszTextW[0], pszTextW[1]);
-			outLen += sprintf(pszText + outLen, " U+%06X", value);
+		if (cbAppend != 0) {
+			SciCall_SetReadOnly(false);
+			SciCall_SetUndoCollection(false);
+			SciCall_AppendText(cbAppend, lpAppend);
+			SciCall_SetUndoCollection(true);
+			SciCall_EmptyUndoBuffer();
+			SciCall_SetSavePoint();
+			SciCall_SetReadOnly(bReadOnlyMode);
+			loadedFileSize = oldSize + cbAppend;
 		}
 	}
-
-	EditReplaceMainSelection(outLen, pszText);
-	NP2HeapFree(pszText);
+	if (lpData != nullptr) {
+		NP2HeapFree(lpData);
+	}
+	return bSuccess;
 }
 
 //=============================================================================
 //
-// EditHex2Char()
+// EditSaveFile()
 //
-void EditHexToCharacter() noexcept {
-	Sci_Position iSelCount = SciCall_GetSelTextLength();
-	if (iSelCount == 0) {
-		return;
-	}
-	if (SciCall_IsRectangularSelection()) {
-		NotifyRectangularSelection();
-		return;
+bool EditSaveFile(HWND hwnd, LPCWSTR pszFile, int saveFlag, EditFileIOStatus &status) noexcept {
+	if (!(saveFlag & FileSaveFlag_EndSession) && !bReadOnlyMode) {
+		// ensure consistent line endings
+		if (bFixLineEndings) {
+			EditEnsureConsistentLineEndings();
+		}
+
+		// strip trailing blanks
+		if (bAutoStripBlanks) {
+			EditStripTrailingBlanks(hwnd, true);
+		}
 	}
 
-	iSelCount *= MAX_UNICODE_HEX_DIGIT;
-	iSelCount = NP2_align_up(iSelCount + 1, MEMORY_ALLOCATION_ALIGNMENT);
-	char * const pszText = static_cast<char *>(NP2HeapAlloc(iSelCount * (sizeof(char) + sizeof(WCHAR))));
-	WCHAR * const pszTextW = reinterpret_cast<WCHAR *>(pszText + iSelCount);
+	if (EditSaveFileInPlace(pszFile, saveFlag, status)) {
+		SciCall_SetSavePoint();
+		loadedFileSize = -1;
+		return true;
+	}
 
-	SciCall_GetSelText(pszText);
-	const UINT cpEdit = SciCall_GetCodePage();
-	MultiByteToWideChar(cpEdit, 0, pszText, -1, pszTextW, static_cast<int>(iSelCount));
+	WCHAR szTempFile[MAX_PATH];
+	FILE_BASIC_INFO timestamp;
+	HANDLE hFile = EditCreateTempFile(pszFile, szTempFile, saveFlag, timestamp);
+	const bool bAtomicSave = hFile != INVALID_HANDLE_VALUE;
+	if (!bAtomicSave) {
+		hFile = CreateFile(pszFile,
+						   GENERIC_READ | GENERIC_WRITE,
+						   FILE_SHARE_READ | FILE_SHARE_WRITE,
+						   nullptr, OPEN_ALWAYS,
+						   FILE_ATTRIBUTE_NORMAL,
+						   nullptr);
+		dwLastIOError = GetLastError();
+	}
 
-	const WCHAR *p = pszTextW;
-	WCHAR *t = pszTextW;
-	bool changed = false;
-	while (*p) {
-		UINT wc = *p++;
-		if ((wc == L'\\' && (*p == L'x' || UnsafeLower(*p) == 'u')) || (wc == L'U' && *p == L'+')) {
-			const int digitCount = (wc == L'U' || *p == L'U') ? MAX_UNICODE_HEX_DIGIT : BMP_UNICODE_HEX_DIGIT;
-			UINT value = 0;
-			int ucc = 1;
-			p++;
-			for (; ucc <= digitCount && *p; ucc++) {
-				const int hex = GetHexDigit(*p);
-				if (hex < 0) {
-					break;
-				}
-				value = (value << 4) | hex;
-				p++;
-			}
-			if (ucc > 1 && value <= MAX_UNICODE) {
-				changed = true;
-				// see UTF16FromUTF32Character() in UniConversion.h
-				if (value < SUPPLEMENTAL_PLANE_FIRST) {
-					wc = value;
-				} else {
-					*t++ = static_cast<WCHAR>(((value - SUPPLEMENTAL_PLANE_FIRST) >> 10) + SURROGATE_LEAD_FIRST);
-					wc = (value & 0x3ff) + SURROGATE_TRAIL_FIRST;
-				}
-			} else {
-				p -= ucc;
-			}
+	// failure could be due to missing attributes (Windows 2000, XP)
+	if (hFile == INVALID_HANDLE_VALUE) {
+		DWORD dwAttributes = GetFileAttributes(pszFile);
+		if (dwAttributes != INVALID_FILE_ATTRIBUTES) {
+			dwAttributes = dwAttributes & (FILE_ATTRIBUTE_HIDDEN | FILE_ATTRIBUTE_SYSTEM);
+			hFile = CreateFile(pszFile,
+							   GENERIC_READ | GENERIC_WRITE,
+							   FILE_SHARE_READ | FILE_SHARE_WRITE,
+							   nullptr,
+							   OPEN_ALWAYS,
+							   FILE_ATTRIBUTE_NORMAL | dwAttributes,
+							   nullptr);
+			dwLastIOError = GetLastError();
 		}
-		*t++ = static_cast<WCHAR>(wc);
 	}
 
-	if (changed) {
-		*t = L'\0';
-		iSelCount = WideCharToMultiByte(cpEdit, 0, pszTextW, static_cast<int>(t - pszTextW), pszText, static_cast<int>(iSelCount), nullptr, nullptr);
-		EditReplaceMainSelection(iSelCount, pszText);
+	if (hFile == INVALID_HANDLE_VALUE) {
+		return false;
 	}
 
-	NP2HeapFree(pszText);
-}
-
-void EditShowHex() noexcept {
-	const Sci_Position iSelCount = SciCall_GetSelTextLength();
-	if (iSelCount == 0) {
-		return;
-	}
-	if (SciCall_IsRectangularSelection()) {
-		NotifyRectangularSelection();
-		return;
+	if (!bAtomicSave && (saveFlag & FileSaveFlag_OriginalTimestamp)) {
+		if (!GetFileInformationByHandleEx(hFile, FileBasicInfo, &timestamp, sizeof(timestamp))) {
+			saveFlag &= ~FileSaveFlag_OriginalTimestamp;
+		}
 	}
 
-	const size_t allocSize = NP2_align_up(iSelCount + 1, MEMORY_ALLOCATION_ALIGNMENT);
-	char *pszText = static_cast<char *>(NP2HeapAlloc(allocSize * 4));
-	char *pszOut = pszText + allocSize;
-	SciCall_GetSelBytes(pszText);
-	const uint8_t *p = reinterpret_cast<const uint8_t *>(pszText);
-	const uint8_t * const end = p + iSelCount;
-	char *t = pszOut;
-	*t++ = '[';
-	do {
-		const uint8_t c = *p++;
-		*t++ = "0123456789ABCDEF"[c >> 4];
-		*t++ = "0123456789ABCDEF"[c & 15];
-		*t++ = ' ';
-	} while (p < end);
-	t[-1] = ']';
+	// get text, document is not changed while saving
+	const size_t cbData = SciCall_GetLength();
+	const char *lpData = nullptr;
+	const int iEncoding = status.iEncoding;
+	const UINT uFlags = mEncoding[iEncoding].uFlags;
+	TextEncoder encoder;
+	const bool bEncode = cbData != 0 && (uFlags & (NCP_UTF8 | NCP_DEFAULT)) == 0;
 
-	const Sci_Position iSelEnd = SciCall_GetSelectionEnd();
-	SciCall_InsertText(iSelEnd, pszOut);
-	SciCall_SetSel(iSelEnd, iSelEnd + (t - pszOut));
-	NP2HeapFree(pszText);
-}
+	// get content and check encoding
+	if (cbData != 0) {
+		lpData = SciCall_GetRangePointer(0, cbData);
+#if 0
+		// FIXME: move checks in front of disk file access
+		if ((uFlags & (NCP_UNICODE | NCP_UTF8_SIGN)) == 0) {
+			EditFileVars fv;
+			fv.Init(lpData, cbData);
+			const int iAltEncoding = fv.GetEncoding();
+			if (iAltEncoding >= CPI_FIRST && iAltEncoding != iEncoding
+				&& !((uFlags & NCP_UTF8) && (mEncoding[iAltEncoding].uFlags & NCP_UTF8))) {
+				Encoding_GetLabel(iAltEncoding);
+				Encoding_GetLabel(iEncoding);
+				InfoBoxWarn(MB_OK, L"MsgEncodingMismatch", IDS_ENCODINGMISMATCH,
+					mEncoding[iAltEncoding].wchLabel,
+					mEncoding[iEncoding].wchLabel);
+			}
+		}
+#endif
 
-void EditShowCharacterInfo() noexcept {
-	const Sci_Position position = SciCall_GetSelectionStart();
-	unsigned character = SciCall_GetCharacterAt(position);
-	char bytes[4]{};
-	WCHAR wchBuf[256];
-	memset(wchBuf, 0, sizeof(int));
-	unsigned count = 1;
-	if (character <= 0x7f) {
-		bytes[0] = static_cast<char>(character);
-		wchBuf[0] = static_cast<wchar_t>(character);
-	} else {
-		const UINT cpEdit = SciCall_GetCodePage();
-		if (cpEdit == SC_CP_UTF8) {
-			if (character < SUPPLEMENTAL_PLANE_FIRST) {
-				wchBuf[0] = static_cast<wchar_t>(character);
-			} else {
-				count = 2;
-				wchBuf[0] = static_cast<WCHAR>(((character - SUPPLEMENTAL_PLANE_FIRST) >> 10) + SURROGATE_LEAD_FIRST);
-				wchBuf[1] = (character & 0x3ff) + SURROGATE_TRAIL_FIRST;
+		// UTF-16 or NCP_8BIT, NCP_7BIT, no conversion for UTF-8 or ANSI
+		if (bEncode) {
+			if (!encoder.Init(iEncoding)) {
+				dwLastIOError = ERROR_NOT_ENOUGH_MEMORY;
+				CloseHandle(hFile);
+				if (bAtomicSave) {
+					DeleteFile(szTempFile);
+				}
+				return false;
+			}
+			if (encoder.HasDataLoss(lpData, cbData) && InfoBoxWarn(MB_OKCANCEL, L"MsgConv3", IDS_ERR_UNICODE2) != IDOK) {
+				status.bCancelDataLoss = true;
+				encoder.Release();
+				CloseHandle(hFile);
+				if (bAtomicSave) {
+					DeleteFile(szTempFile);
+				}
+				return false;
+			}
+		}
+	}
+
+	// write content
+	{
+		BOOL bWriteSuccess = bAtomicSave || SetEndOfFile(hFile);
+		DWORD dwBytesWritten;
+		// write encoding BOM
+		DWORD bom = 0;
+		DWORD length = 0;
+		if (uFlags & NCP_UNICODE_BOM) {
+			bom = (uFlags & NCP_UNICODE_REVERSE) ? BOM_UTF16BE : BOM_UTF16LE;
+			length = 2;
+		} else if (uFlags & NCP_UTF8_SIGN) {
+			bom = BOM_UTF8;
+			length = 3;
+		}
+		if (bAtomicSave) {
+			bWriteSuccess = EditWriteFileAsync(hFile, pszFile, lpData, cbData, bEncode ? &encoder : nullptr, bom, length, saveFlag);
+			if (bWriteSuccess) {
+				// ensure content is on disk before replacing the original file
+				bWriteSuccess = FlushFileBuffers(hFile);
 			}
+			dwLastIOError = GetLastError();
 		} else {
-			if (character <= 0xff) {
-				bytes[0] = static_cast<char>(character);
-			} else {
-				count = 2;
-				const uint16_t dbcs = bswap16(static_cast<uint16_t>(character));
-				memcpy(bytes, &dbcs, 2);
+			if (length != 0) {
+				bWriteSuccess = WriteFile(hFile, &bom, length, &dwBytesWritten, nullptr);
 			}
-			count = MultiByteToWideChar(cpEdit, 0, bytes, count, wchBuf, COUNTOF(wchBuf));
-			if (IS_SURROGATE_PAIR(wchBuf[0], wchBuf[1])) {
-				character = UTF16_TO_UTF32(wchBuf[0], wchBuf[1]);
-			} else {
-				character = wchBuf[0];
+			dwLastIOError = GetLastError();
+			if (lpData != nullptr) {
+				bWriteSuccess = bEncode ? EditWriteFileEncoded(hFile, lpData, cbData, encoder) : EditWriteFile(hFile, lpData, cbData);
+				dwLastIOError = GetLastError();
 			}
 		}
-		count = WideCharToMultiByte(CP_UTF8, 0, wchBuf, count, bytes, COUNTOF(bytes), nullptr, nullptr);
+		if (bEncode) {
+			encoder.Release();
+		}
+		if (saveFlag & FileSaveFlag_OriginalTimestamp) {
+			SetFileInformationByHandle(hFile, FileBasicInfo, &timestamp, sizeof(timestamp));
+		}
+		CloseHandle(hFile);
+		if (bAtomicSave) {
+			if (bWriteSuccess) {
+				bWriteSuccess = ReplaceFile(pszFile, szTempFile, nullptr, REPLACEFILE_IGNORE_MERGE_ERRORS, nullptr, nullptr);
+				dwLastIOError = GetLastError();
+			}
+			if (!bWriteSuccess) {
+				DeleteFile(szTempFile);
+			}
+		}
+		if (bWriteSuccess) {
+			if (!(saveFlag & FileSaveFlag_SaveCopy)) {
+				SciCall_SetSavePoint();
+				// file content changed, full reload is required
+				loadedFileSize = -1;
+				InPlaceSave_ArmSaved(pszFile, iEncoding);
+			}
+			return true;
+		}
 	}
 
-	char buffer[256];
-	unsigned length = 0;
-	memset(buffer, 0, sizeof(int));
-	length = sprintf(buffer, "Unicode: U+%0*X\n", ((character < SUPPLEMENTAL_PLANE_FIRST) ? 4 : 6), character);
-	StrCpyEx(buffer + length, "UTF-16:");
-	length += CSTRLEN("UTF-16:");
-	length += sprintf(buffer + length, " %04X", wchBuf[0]);
-	if (character >= SUPPLEMENTAL_PLANE_FIRST) {
-		length += sprintf(buffer + length, " %04X", wchBuf[1]);
-	}
-	StrCpyEx(buffer + length, "\nUTF-8:");
-	length += CSTRLEN("\nUTF-8:");
-	for (unsigned i = 0; i < count; i++) {
-		const uint8_t ch = bytes[i];
-		buffer[length] = ' ';
-		buffer[length + 1] = "0123456789ABCDEF"[ch >> 4];
-		buffer[length + 2] = "0123456789ABCDEF"[ch & 15];
-		length += 3;
-	}
-	length += sprintf(buffer + length, "\nHTML: &#%u;", character);
+	return false;
+}
 
-// see icu.h / uchar.h, https://learn.microsoft.com/en-us/windows/win32/intl/international-components-for-unicode--icu-
-using u_charNameSig = int32_t (__cdecl *)(uint32_t code, int nameChoice, char *buffer, int32_t bufferLength, int *pErrorCode);
-using u_getIntPropertyValueSig = int32_t (__cdecl *)(uint32_t code, int which);
-using u_getPropertyValueNameSig = const char * (__cdecl *)(int property, int32_t value, int nameChoice);
-	constexpr int U_EXTENDED_CHAR_NAME = 2;
-	constexpr int U_SHORT_PROPERTY_NAME = 0;
-	constexpr int U_LONG_PROPERTY_NAME = 1;
-	constexpr int UCHAR_GENERAL_CATEGORY = 0x1005;
+void EditReplaceRange(Sci_Position iSelStart, Sci_Position iSelEnd, Sci_Position cchText, LPCSTR pszText) noexcept {
+	Sci_Position iCurPos = SciCall_GetCurrentPos();
+	Sci_Position iAnchorPos = SciCall_GetAnchor();
 
-	static uint8_t triedLoadingICU = 0;
-	static u_charNameSig pfn_charName;
-	static u_getIntPropertyValueSig pfn_getIntPropertyValue;
-	static u_getPropertyValueNameSig pfn_getPropertyValueName;
-	if (triedLoadingICU == 0) {
-		triedLoadingICU = 1;
-		HMODULE hDLL = LoadLibraryExW(L"icu.dll", nullptr, kSystemLibraryLoadFlags); // Windows 10 1903
-		// if (hDLL == nullptr) { // Windows 10 1703, legacy outdated
-		// 	hDLL = LoadLibraryExW(L"icuuc.dll", nullptr, kSystemLibraryLoadFlags);
-		// }
-		if (hDLL != nullptr) {
-			pfn_charName = DLLFunction<u_charNameSig>(hDLL, "u_charName");
-			pfn_getIntPropertyValue = DLLFunction<u_getIntPropertyValueSig>(hDLL, "u_getIntPropertyValue");
-			pfn_getPropertyValueName = DLLFunction<u_getPropertyValueNameSig>(hDLL, "u_getPropertyValueName");
-			if (pfn_charName == nullptr || pfn_getIntPropertyValue == nullptr || pfn_getPropertyValueName == nullptr) {
-				FreeLibrary(hDLL);
-			} else {
-				hICUDLL = hDLL;
-				triedLoadingICU = 2;
-			}
-		}
-	}
-	if (triedLoadingICU == 2) {
-		StrCpyEx(buffer + length, "\nName: ");
-		length += CSTRLEN("\nName: ");
-		int value = 0;
-		length += pfn_charName(character, U_EXTENDED_CHAR_NAME, buffer + length, COUNTOF(buffer) - length, &value);
-		value = pfn_getIntPropertyValue(character, UCHAR_GENERAL_CATEGORY);
-		const char *shortName = pfn_getPropertyValueName(UCHAR_GENERAL_CATEGORY, value, U_SHORT_PROPERTY_NAME);
-		const char *longName = pfn_getPropertyValueName(UCHAR_GENERAL_CATEGORY, value, U_LONG_PROPERTY_NAME);
-		sprintf(buffer + length, "\nCategory: %s %s", shortName, longName);
+	if (iAnchorPos > iCurPos) {
+		iCurPos = iSelStart;
+		iAnchorPos = iSelStart + cchText;
+	} else {
+		iAnchorPos = iSelStart;
+		iCurPos = iSelStart + cchText;
 	}
 
-	const WPARAM notifyPos = (static_cast<WPARAM>(position) << 2) | SC_NOTIFICATIONPOSITION_NONE;
-	ShowNotificationA(notifyPos, buffer);
+	SciCall_SetTargetRange(iSelStart, iSelEnd);
+	SciCall_ReplaceTargetMinimal(cchText, pszText);
+	SciCall_SetSel(iAnchorPos, iCurPos);
+}
 
-	MultiByteToWideChar(CP_UTF8, 0, buffer, -1, wchBuf, COUNTOF(wchBuf));
-	SetClipData(hwndMain, wchBuf);
+void EditReplaceMainSelection(Sci_Position cchText, LPCSTR pszText) noexcept {
+	EditReplaceRange(SciCall_GetSelectionStart(), SciCall_GetSelectionEnd(), cchText, pszText);
 }
 
-void EditBase64Encode(Base64EncodingFlag encodingFlag) noexcept {
-	const size_t iSelByte = SciCall_GetSelTextLength();
-	if (iSelByte == 0) {
-		return;
-	}
-	if (SciCall_IsRectangularSelection()){
-		NotifyRectangularSelection();
-		return;
+static inline char *EditGetTextRange(Sci_Position iStartPos, Sci_Position iEndPos) noexcept {
+	const Sci_Position len = iEndPos - iStartPos;
+	if (len <= 0) {
+		return nullptr;
 	}
 
-	const size_t allocSize = NP2_align_up(iSelByte + 1, MEMORY_ALLOCATION_ALIGNMENT);
-	size_t outLen = (allocSize*4)/3 + 4 + MAX_PATH*2;
-	char * const input = static_cast<char *>(NP2HeapAlloc(allocSize + outLen));
-	SciCall_GetSelBytes(input);
-	char * const output = input + allocSize;
-	outLen = 0;
-	if (encodingFlag == Base64EncodingFlag_HtmlEmbeddedImage) {
-		memcpy(output, "<img src=\"data:image/", CSTRLEN("<img src=\"data:image/"));
-		outLen = CSTRLEN("<img src=\"data:image/");
-		LPCWSTR suffix = PathFindExtension(szCurFile);
-		if (*suffix == L'.') {
-			// image file extension should be ASCII
-			++suffix;
-			while (*suffix) {
-				output[outLen++] = static_cast<char>(ToLowerA(*suffix++));
+	char *mszBuf = static_cast<char *>(NP2HeapAlloc(len + 1));
+	const Sci_TextRangeFull tr = { { iStartPos, iEndPos }, mszBuf };
+	SciCall_GetTextRangeFull(&tr);
+	return mszBuf;
+}
+
+// https://docs.microsoft.com/en-us/windows/win32/intl/transliteration-services
+#include <elscore.h>
+#if defined(__MINGW32__)
+#if defined(__has_include) && __has_include(<elssrvc.h>)
+#include <elssrvc.h>
+#else
+// {A3A8333B-F4FC-42f6-A0C4-0462FE7317CB}
+static const GUID ELS_GUID_TRANSLITERATION_HANT_TO_HANS =
+	{ 0xA3A8333B, 0xF4FC, 0x42f6, { 0xA0, 0xC4, 0x04, 0x62, 0xFE, 0x73, 0x17, 0xCB } };
+
+// {3CACCDC8-5590-42dc-9A7B-B5A6B5B3B63B}
+static const GUID ELS_GUID_TRANSLITERATION_HANS_TO_HANT =
+	{ 0x3CACCDC8, 0x5590, 0x42dc, { 0x9A, 0x7B, 0xB5, 0xA6, 0xB5, 0xB3, 0xB6, 0x3B } };
+
+// {D8B983B1-F8BF-4a2b-BCD5-5B5EA20613E1}
+static const GUID ELS_GUID_TRANSLITERATION_MALAYALAM_TO_LATIN =
+	{ 0xD8B983B1, 0xF8BF, 0x4a2b, { 0xBC, 0xD5, 0x5B, 0x5E, 0xA2, 0x06, 0x13, 0xE1 } };
+
+// {C4A4DCFE-2661-4d02-9835-F48187109803}
+static const GUID ELS_GUID_TRANSLITERATION_DEVANAGARI_TO_LATIN =
+	{ 0xC4A4DCFE, 0x2661, 0x4d02, { 0x98, 0x35, 0xF4, 0x81, 0x87, 0x10, 0x98, 0x03 } };
+
+// {3DD12A98-5AFD-4903-A13F-E17E6C0BFE01}
+static const GUID ELS_GUID_TRANSLITERATION_CYRILLIC_TO_LATIN =
+	{ 0x3DD12A98, 0x5AFD, 0x4903, { 0xA1, 0x3F, 0xE1, 0x7E, 0x6C, 0x0B, 0xFE, 0x01 } };
+
+// {F4DFD825-91A4-489f-855E-9AD9BEE55727}
+static const GUID ELS_GUID_TRANSLITERATION_BENGALI_TO_LATIN =
+	{ 0xF4DFD825, 0x91A4, 0x489f, { 0x85, 0x5E, 0x9A, 0xD9, 0xBE, 0xE5, 0x57, 0x27 } };
+#endif // __MINGW32__
+#else
+#include <elssrvc.h>
+#endif
+
+namespace {
+
+// {4BA2A721-E43D-41b7-B330-536AE1E48863}
+const GUID WIN10_ELS_GUID_TRANSLITERATION_HANGUL_DECOMPOSITION =
+	{ 0x4BA2A721, 0xE43D, 0x41b7, { 0xB3, 0x30, 0x53, 0x6A, 0xE1, 0xE4, 0x88, 0x63 } };
+
+int TransliterateText(const GUID *pGuid, LPCWSTR pszTextW, int cchTextW, LPWSTR &pszMappedW) noexcept {
+using MappingGetServicesSig = HRESULT (WINAPI *)(PMAPPING_ENUM_OPTIONS pOptions, PMAPPING_SERVICE_INFO *prgServices, DWORD *pdwServicesCount);
+using MappingFreeServicesSig = HRESULT (WINAPI *)(PMAPPING_SERVICE_INFO pServiceInfo);
+using MappingRecognizeTextSig = HRESULT (WINAPI *)(PMAPPING_SERVICE_INFO pServiceInfo, LPCWSTR pszText, DWORD dwLength, DWORD dwIndex, PMAPPING_OPTIONS pOptions, PMAPPING_PROPERTY_BAG pbag);
+using MappingFreePropertyBagSig = HRESULT (WINAPI *)(PMAPPING_PROPERTY_BAG pBag);
+
+	static uint8_t triedLoadingELSCore = 0;
+	static MappingGetServicesSig pfnMappingGetServices;
+	static MappingFreeServicesSig pfnMappingFreeServices;
+	static MappingRecognizeTextSig pfnMappingRecognizeText;
+	static MappingFreePropertyBagSig pfnMappingFreePropertyBag;
+
+	if (triedLoadingELSCore == 0) {
+		triedLoadingELSCore = 1;
+		HMODULE hDLL = LoadLibraryExW(L"elscore.dll", nullptr, kSystemLibraryLoadFlags);
+		if (hDLL != nullptr) {
+			pfnMappingGetServices = DLLFunction<MappingGetServicesSig>(hDLL, "MappingGetServices");
+			pfnMappingFreeServices = DLLFunction<MappingFreeServicesSig>(hDLL, "MappingFreeServices");
+			pfnMappingRecognizeText = DLLFunction<MappingRecognizeTextSig>(hDLL, "MappingRecognizeText");
+			pfnMappingFreePropertyBag = DLLFunction<MappingFreePropertyBagSig>(hDLL, "MappingFreePropertyBag");
+			if (pfnMappingGetServices == nullptr || pfnMappingFreeServices == nullptr || pfnMappingRecognizeText == nullptr || pfnMappingFreePropertyBag == nullptr) {
+				FreeLibrary(hDLL);
+				return 0;
 			}
+			hELSCoreDLL = hDLL;
+			triedLoadingELSCore = 2;
 		}
-		memcpy(output + outLen, ";base64,", CSTRLEN(";base64,"));
-		outLen += CSTRLEN(";base64,");
 	}
-	outLen += Base64Encode(output + outLen, reinterpret_cast<const uint8_t *>(input), iSelByte, encodingFlag == Base64EncodingFlag_UrlSafe);
-	if (encodingFlag == Base64EncodingFlag_HtmlEmbeddedImage) {
-		memcpy(output + outLen, "\" />", CSTRLEN("\" />"));
-		outLen += CSTRLEN("\" />");
+	if (triedLoadingELSCore != 2) {
+		return 0;
 	}
 
-	EditReplaceMainSelection(outLen, output);
-	NP2HeapFree(input);
-}
+	MAPPING_ENUM_OPTIONS enumOptions;
+	PMAPPING_SERVICE_INFO prgServices = nullptr;
+	DWORD dwServicesCount = 0;
 
-void EditBase64Decode(bool decodeAsHex) noexcept {
-	size_t iSelByte = SciCall_GetSelTextLength();
-	if (iSelByte == 0) {
-		return;
-	}
-	if (SciCall_IsRectangularSelection()){
-		NotifyRectangularSelection();
-		return;
-	}
+	memset(&enumOptions, 0, sizeof(MAPPING_ENUM_OPTIONS));
+	enumOptions.Size = sizeof(MAPPING_ENUM_OPTIONS);
+	enumOptions.pGuid = const_cast<GUID *>(pGuid);
 
-	const size_t allocSize = NP2_align_up(iSelByte + 1, MEMORY_ALLOCATION_ALIGNMENT);
-	size_t outLen = (allocSize*3)/4 + 4;
-	char *input = static_cast<char *>(NP2HeapAlloc(allocSize + outLen));
-	SciCall_GetSelText(input);
-	uint8_t *output = reinterpret_cast<uint8_t *>(input + allocSize);
-	outLen = Base64Decode(output, reinterpret_cast<const uint8_t *>(input), iSelByte);
-	if (outLen != 0) {
-		if(decodeAsHex) {
-			const int iEOLMode = SciCall_GetEOLMode();
-			iSelByte = outLen*3 + outLen/8 + 1;
-			char *pszOut = static_cast<char *>(NP2HeapAlloc(iSelByte));
-			char *t = pszOut;
-			size_t i = 0;
-			do {
-				const uint8_t c = output[i++];
-				*t++ = "0123456789ABCDEF"[c >> 4];
-				*t++ = "0123456789ABCDEF"[c & 15];
-				*t++ = ' ';
-				if ((i & 15) == 0) {
-					--t;
-					switch (iEOLMode) {
-					default: // SC_EOL_CRLF
-						*t++ = '\r';
-						*t++ = '\n';
-						break;
-					case SC_EOL_LF:
-						*t++ = '\n';
-						break;
-					case SC_EOL_CR:
-						*t++ = '\r';
-						break;
-					}
-				}
-			} while (i < outLen);
-			if ((i & 15) != 0) {
-				--t;
+	HRESULT hr = pfnMappingGetServices(&enumOptions, &prgServices, &dwServicesCount);
+	dwServicesCount = 0;
+	if (SUCCEEDED(hr)) {
+		MAPPING_PROPERTY_BAG bag;
+		memset(&bag, 0, sizeof(MAPPING_PROPERTY_BAG));
+		bag.Size = sizeof (MAPPING_PROPERTY_BAG);
+		hr = pfnMappingRecognizeText(prgServices, pszTextW, cchTextW, 0, nullptr, &bag);
+		if (SUCCEEDED(hr)) {
+			const DWORD dwDataSize = bag.prgResultRanges[0].dwDataSize;
+			dwServicesCount = dwDataSize/sizeof(WCHAR);
+			pszTextW = static_cast<LPCWSTR>(bag.prgResultRanges[0].pData);
+			if (dwServicesCount != 0 && pszTextW[0] != L'\0') {
+				LPWSTR pszConvW = static_cast<LPWSTR>(NP2HeapAlloc(dwDataSize + sizeof(WCHAR)));
+				memcpy(pszConvW, pszTextW, dwDataSize);
+				pszMappedW = pszConvW;
 			}
-			outLen = t - pszOut;
-			NP2HeapFree(input);
-			input = pszOut;
-			output = reinterpret_cast<uint8_t *>(pszOut);
+			pfnMappingFreePropertyBag(&bag);
 		}
-		EditReplaceMainSelection(outLen, reinterpret_cast<char *>(output));
+		pfnMappingFreeServices(prgServices);
 	}
-	NP2HeapFree(input);
-}
-
-//=============================================================================
-//
-// EditConvertNumRadix()
-//
-static int ConvertNumRadix(char *tch, uint64_t num, int radix) noexcept {
-	switch (radix) {
-	case 16:
-		return sprintf(tch, "0x%" PRIx64, num);
 
-	case 10:
-		return sprintf(tch, "%" PRIu64, num);
+	return dwServicesCount;
+}
 
-	case 8: {
-		char buf[2 + 22 + 1] = "";
-		int index = 2 + 22;
-		int length = 0;
-		while (num) {
-			const int bit = static_cast<int>(num & 7);
-			num >>= 3;
-			buf[index--] = static_cast<char>('0' + bit);
-			++length;
-		}
-		if (length == 0) {
-			buf[index--] = '0';
-			++length;
-		}
-		buf[index--] = 'O';
-		buf[index] = '0';
-		length += 2;
-		strcat(tch, buf + index);
-		return length;
+int StringMapCase(LPCWSTR pszTextW, int cchTextW, DWORD flags, LPWSTR &pszMappedW) noexcept {
+	int charsConverted = LCMapStringEx(LOCALE_NAME_USER_DEFAULT, flags, pszTextW, cchTextW, nullptr, 0, nullptr, nullptr, 0);
+	if (charsConverted) {
+		pszMappedW = static_cast<LPWSTR>(NP2HeapAlloc((charsConverted + 1)*sizeof(WCHAR)));
+		charsConverted = LCMapStringEx(LOCALE_NAME_USER_DEFAULT, flags, pszTextW, cchTextW, pszMappedW, charsConverted, nullptr, nullptr, 0);
 	}
-	break;
+	return charsConverted;
+}
 
-	case 2: {
-		char buf[2 + 64 + 8 + 1] = "";
-		int index = 2 + 64 + 8;
-		int length = 0;
-		int bit_count = 0;
-		while (num) {
-			const int bit = static_cast<int>(num & 1);
-			num >>= 1;
-			buf[index--] = static_cast<char>('0' + bit);
-			++bit_count;
-			++length;
-			if (num && (bit_count & 7) == 0) {
-				buf[index--] = '_';
-				++length;
-			}
-		}
-		if (length == 0) {
-			buf[index--] = '0';
-			++length;
-		}
-		buf[index--] = 'b';
-		buf[index] = '0';
-		length += 2;
-		strcat(tch, buf + index);
-		return length;
+// TODO: Unicode Text Segmentation https://www.unicode.org/reports/tr29/
+constexpr wchar_t ToHalfwidth(wchar_t ch) noexcept {
+	if (ch > 0xFF00 && ch < 0xFF5F) {
+		return ch - 0xFEE0;
 	}
-	break;
+	return ch;
+}
 
-	}
-	return 0;
+constexpr bool IsWordSingleQuote(wchar_t ch) noexcept {
+	return ch == L'\'' || ch == L'`'
+		|| ch == 0x00B4 // ACUTE ACCENT
+		|| ch == 0x0384 // GREEK TONOS
+		|| ch == 0x2018 // LEFT SINGLE QUOTATION MARK
+		|| ch == 0x2019 // RIGHT SINGLE QUOTATION MARK
+		;
 }
 
-void EditConvertNumRadix(int radix) noexcept {
-	Sci_Position iSelCount = SciCall_GetSelTextLength();
-	if (iSelCount == 0) {
-		return;
+constexpr bool IsWordSpace(wchar_t ch) noexcept {
+	ch = ToHalfwidth(ch);
+	return IsASpace(ch)
+		|| ch == L'[' || ch == L']' || ch == L'(' || ch == L')' || ch == L'{' || ch == L'}'
+		|| ch == 0x0085 // NEXT LINE
+		|| ch == 0x2028 // LINE SEPARATOR
+		|| ch == 0x2029 // PARAGRAPH SEPARATOR
+		;
+}
+
+constexpr bool IsSentenceTerminator(wchar_t ch) noexcept {
+	ch = ToHalfwidth(ch);
+	return ch == L'\r' || ch == L'\n'
+		|| ch == L'.' || ch == L';' || ch == L'!' || ch == L'?'
+		|| ch == 0x0085 // NEXT LINE
+		|| ch == 0x2028 // LINE SEPARATOR
+		|| ch == 0x2029 // PARAGRAPH SEPARATOR
+		;
+}
+
+// returns -1 when text contains non-ASCII byte, 0 when text has no letter.
+int InvertCaseASCII(char *pszOut, const char *pszText, size_t length) noexcept {
+	uint32_t letters = 0;
+	size_t index = 0;
+#if NP2_USE_SSE2
+	const __m128i caseBit = _mm_set1_epi8(0x20);
+	while (index + sizeof(__m128i) <= length) {
+		const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i *>(pszText + index));
+		if (_mm_movemask_epi8(chunk) != 0) {
+			return -1;
+		}
+		const __m128i lower = _mm_or_si128(chunk, caseBit);
+		const __m128i letter = _mm_and_si128(_mm_cmpgt_epi8(lower, _mm_set1_epi8('a' - 1)), _mm_cmpgt_epi8(_mm_set1_epi8('z' + 1), lower));
+		letters |= _mm_movemask_epi8(letter);
+		_mm_storeu_si128(reinterpret_cast<__m128i *>(pszOut + index), _mm_xor_si128(chunk, _mm_and_si128(letter, caseBit)));
+		index += sizeof(__m128i);
 	}
-	if (SciCall_IsRectangularSelection()) {
-		NotifyRectangularSelection();
-		return;
+#endif
+	for (; index < length; index++) {
+		uint8_t ch = pszText[index];
+		if (ch & 0x80) {
+			return -1;
+		}
+		if (IsAlpha(ch)) {
+			ch ^= 0x20;
+			letters = 1;
+		}
+		pszOut[index] = ch;
 	}
+	return letters != 0;
+}
 
-	static_assert(IDM_EDIT_NUM2DEC - IDM_EDIT_NUM2BIN == 1);
-	static_assert(IDM_EDIT_NUM2OCT - IDM_EDIT_NUM2BIN == 2);
-	static_assert(IDM_EDIT_NUM2HEX - IDM_EDIT_NUM2BIN == 3);
-	radix -= IDM_EDIT_NUM2BIN;
-	radix = (radix == 1) ? 10 : (2 << radix);
+}
 
-	iSelCount = NP2_align_up(iSelCount + 1, MEMORY_ALLOCATION_ALIGNMENT);
-	const size_t outLen = (iSelCount*5) + 16; // 0xFF => 0b1111_1111
-	char * const pszText = static_cast<char *>(NP2HeapAlloc(iSelCount + outLen));
-	char * const pszOut = pszText + iSelCount;
-	Sci_Position cch = 0;
-	const char *p = pszText;
-	uint64_t value = 0;
+//=============================================================================
+//
+// EditMapTextCase(), used by ScintillaWin::CaseMapString()
+//
+char *EditMapTextCase(int menu, const char *pszText, size_t &iSelCount, UINT cpEdit) noexcept {
+	DWORD flags = 0;
+	const GUID *pGuid = nullptr;
+	switch (menu) {
+	case IDM_EDIT_SENTENCECASE:
+	case IDM_EDIT_TITLECASE:
+		flags = LCMAP_LINGUISTIC_CASING | LCMAP_LOWERCASE;
+		break;
+	case IDM_EDIT_MAP_FULLWIDTH:
+		flags = LCMAP_FULLWIDTH;
+		break;
+	case IDM_EDIT_MAP_HALFWIDTH:
+		flags = LCMAP_HALFWIDTH;
+		break;
+	case IDM_EDIT_MAP_SIMPLIFIED_CHINESE:
+		flags = LCMAP_SIMPLIFIED_CHINESE;
+		pGuid = &ELS_GUID_TRANSLITERATION_HANT_TO_HANS;
+		break;
+	case IDM_EDIT_MAP_TRADITIONAL_CHINESE:
+		flags = LCMAP_TRADITIONAL_CHINESE;
+		pGuid = &ELS_GUID_TRANSLITERATION_HANS_TO_HANT;
+		break;
+	case IDM_EDIT_MAP_HIRAGANA:
+		flags = LCMAP_HIRAGANA;
+		break;
+	case IDM_EDIT_MAP_KATAKANA:
+		flags = LCMAP_KATAKANA;
+		break;
+	case IDM_EDIT_MAP_MALAYALAM_LATIN:
+		pGuid = &ELS_GUID_TRANSLITERATION_MALAYALAM_TO_LATIN;
+		break;
+	case IDM_EDIT_MAP_DEVANAGARI_LATIN:
+		pGuid = &ELS_GUID_TRANSLITERATION_DEVANAGARI_TO_LATIN;
+		break;
+	case IDM_EDIT_MAP_CYRILLIC_LATIN:
+		pGuid = &ELS_GUID_TRANSLITERATION_CYRILLIC_TO_LATIN;
+		break;
+	case IDM_EDIT_MAP_BENGALI_LATIN:
+		pGuid = &ELS_GUID_TRANSLITERATION_BENGALI_TO_LATIN;
+		break;
+	case IDM_EDIT_MAP_HANGUL_DECOMPOSITION:
+		pGuid = &WIN10_ELS_GUID_TRANSLITERATION_HANGUL_DECOMPOSITION;
+		break;
+	case IDM_EDIT_INVERTCASE:
+	default:
+		break;
+	}
 
-	SciCall_GetSelText(pszText);
+	if (menu == IDM_EDIT_INVERTCASE) {
+		// CharUpper() and CharLower() map ASCII letters regardless of locale, avoid UTF-16 round trip
+		char *pszOut = static_cast<char *>(NP2HeapAlloc(iSelCount + 1));
+		if (pszOut != nullptr) {
+			const int result = InvertCaseASCII(pszOut, pszText, iSelCount);
+			if (result > 0) {
+				return pszOut;
+			}
+			NP2HeapFree(pszOut);
+			if (result == 0) {
+				return nullptr;
+			}
+		}
+	}
 
-	while (*p) {
-		if (*p == '0') {
-			value = 0;
-			p++;
-			const char prefix = UnsafeLower(*p);
-			if (prefix == 'x' && radix != 16) {
-				p++;
-				while (*p) {
-					if (*p == '_') {
-						p++;
+	LPWSTR pszTextW = static_cast<LPWSTR>(NP2HeapAlloc((iSelCount + 1) * sizeof(WCHAR)));
+	int cchTextW = MultiByteToWideChar(cpEdit, 0, pszText, static_cast<int>(iSelCount), pszTextW, static_cast<int>(iSelCount + 1));
+
+	bool bChanged = false;
+	if (flags != 0 || pGuid != nullptr) {
+		int charsConverted = 0;
+		LPWSTR pszMappedW = nullptr;
+		if (pGuid != nullptr && IsWin7AndAbove()) {
+			charsConverted = TransliterateText(pGuid, pszTextW, cchTextW, pszMappedW);
+		}
+		if (pszMappedW == nullptr && flags != 0) {
+			charsConverted = StringMapCase(pszTextW, cchTextW, flags, pszMappedW);
+			if (charsConverted) {
+				if (menu == IDM_EDIT_TITLECASE) {
+					if (IsWin7AndAbove()) {
+						LPWSTR pszConvW = nullptr;
+						charsConverted = StringMapCase(pszMappedW, charsConverted, LCMAP_LINGUISTIC_CASING | LCMAP_TITLECASE, pszConvW);
+						NP2HeapFree(pszMappedW);
+						pszMappedW = pszConvW;
 					} else {
-						const int hex = GetHexDigit(*p);
-						if (hex < 0) {
-							break;
+						// BOOKMARK_EDITION
+						bool bNewWord = true;
+						bool bPrevWasSpace = true;
+						for (int i = 0; i < charsConverted; i++) {
+							const WCHAR ch = pszMappedW[i];
+							if (!IsCharAlphaNumeric(ch) && (!IsWordSingleQuote(ch) || bPrevWasSpace)) {
+								bNewWord = true;
+							} else {
+								if (bNewWord && IsCharLower(ch)) {
+									pszMappedW[i] = LOWORD(CharUpper(AsPointer<LPWSTR, LONG_PTR>(ch)));
+								}
+								bNewWord = false;
+							}
+							bPrevWasSpace = IsWordSpace(ch);
 						}
-						value = (value << 4) | hex;
-						p++;
-					}
-				}
-				cch += ConvertNumRadix(pszOut + cch, value, radix);
-			} else if (prefix == 'o' && radix != 8) {
-				p++;
-				while (*p) {
-					if (*p >= '0' && *p <= '7') {
-						value <<= 3;
-						value += (*p++ - '0');
-					} else if (*p == '_') {
-						p++;
-					} else {
-						break;
-					}
-				}
-				cch += ConvertNumRadix(pszOut + cch, value, radix);
-			} else if (prefix == 'b' && radix != 2) {
-				p++;
-				while (*p) {
-					if (*p == '0') {
-						value <<= 1;
-						p++;
-					} else if (*p == '1') {
-						value <<= 1;
-						value |= 1;
-						p++;
-					} else if (*p == '_') {
-						p++;
-					} else {
-						break;
 					}
-				}
-				cch += ConvertNumRadix(pszOut + cch, value, radix);
-			} else if ((*p >= '0' && *p <= '9') && radix != 10) {
-				value = *p++ - '0';
-				while (*p) {
-					if (*p >= '0' && *p <= '9') {
-						value *= 10;
-						value += (*p++ - '0');
-					} else if (*p == '_') {
-						p++;
-					} else {
-						break;
+				} else if (menu == IDM_EDIT_SENTENCECASE) {
+					bool bNewSentence = true;
+					for (int i = 0; i < charsConverted; i++) {
+						const WCHAR ch = pszMappedW[i];
+						if (IsSentenceTerminator(ch)) {
+							bNewSentence = true;
+						} else if (bNewSentence && IsCharAlphaNumeric(ch)) {
+							if (IsCharLower(ch)) {
+								pszMappedW[i] = LOWORD(CharUpper(AsPointer<LPWSTR, LONG_PTR>(ch)));
+							}
+							bNewSentence = false;
+						}
 					}
 				}
-				cch += ConvertNumRadix(pszOut + cch, value, radix);
-			} else {
-				pszOut[cch++] = '0';
-			}
-		} else if ((*p >= '1' && *p <= '9') && radix != 10) {
-			value = *p++ - '0';
-			while (*p) {
-				if (*p >= '0' && *p <= '9') {
-					value *= 10;
-					value += (*p++ - '0');
-				} else if (*p == '_') {
-					p++;
-				} else {
-					break;
-				}
-			}
-			cch += ConvertNumRadix(pszOut + cch, value, radix);
-		} else if (IsAlphaNumeric(*p) || *p == '_') {
-			// radix and number prefix matches, no conversion
-			pszOut[cch++] = *p++;
-			while (IsAlphaNumeric(*p) || *p == '_') {
-				pszOut[cch++] = *p++;
 			}
+		}
+
+		if (charsConverted == 0 || StrIsEmpty(pszMappedW) || StrEqual(pszTextW, pszMappedW)) {
+			NP2HeapFree(pszMappedW);
 		} else {
-			pszOut[cch++] = *p++;
+			bChanged = true;
+			NP2HeapFree(pszTextW);
+			pszTextW = pszMappedW;
+			cchTextW = charsConverted;
+		}
+	} else {
+		// invert case
+		for (int i = 0; i < cchTextW; i++) {
+			const WCHAR ch = pszTextW[i];
+			if (IsCharUpper(ch)) {
+				pszTextW[i] = LOWORD(CharLower(AsPointer<LPWSTR, LONG_PTR>(ch)));
+				bChanged = true;
+			} else if (IsCharLower(ch)) {
+				pszTextW[i] = LOWORD(CharUpper(AsPointer<LPWSTR, LONG_PTR>(ch)));
+				bChanged = true;
+			}
 		}
 	}
-	pszOut[cch] = '\0';
 
-	EditReplaceMainSelection(cch, pszOut);
-	NP2HeapFree(pszText);
+	char *pszOut = nullptr;
+	if (bChanged) {
+		int cchText = cchTextW*kMaxMultiByteCount + 1;
+		pszOut = static_cast<char *>(NP2HeapAlloc(cchText));
+		cchText = WideCharToMultiByte(cpEdit, 0, pszTextW, cchTextW, pszOut, cchText, nullptr, nullptr);
+		iSelCount = cchText;
+	}
+
+	NP2HeapFree(pszTextW);
+	return pszOut;
 }
 
+#ifndef URL_ESCAPE_AS_UTF8		// NTDDI_VERSION >= NTDDI_WIN7
+#define URL_ESCAPE_AS_UTF8		0x00040000
+#endif
+#ifndef URL_UNESCAPE_AS_UTF8	// NTDDI_VERSION >= NTDDI_WIN8
+#define URL_UNESCAPE_AS_UTF8	URL_ESCAPE_AS_UTF8
+#endif
+#ifndef URL_ESCAPE_ASCII_URI_COMPONENT	// NTDDI_VERSION >= NTDDI_WIN8
+#define URL_ESCAPE_ASCII_URI_COMPONENT	0x00080000
+#endif
+
 //=============================================================================
 //
-// EditModifyNumber()
+// EditURLEncode()
 //
-void EditModifyNumber(bool bIncrease) {
-	const Sci_Position iSelCount = SciCall_GetSelTextLength();
-	if (iSelCount == 0) {
-		return;
+LPWSTR EditURLEncodeSelection(DWORD *cchEscapedW, bool component) noexcept {
+	*cchEscapedW = 0;
+	const Sci_Position iSelStart = SciCall_GetSelectionStart();
+	const Sci_Position iSelEnd = SciCall_GetSelectionEnd();
+	if (iSelStart == iSelEnd) {
+		return nullptr;
 	}
-	if (SciCall_IsRectangularSelection()) {
-		NotifyRectangularSelection();
-		return;
+
+	// only the UTF-16 text is allocated, selection is read in place
+	const size_t allocSize = NP2_align_up(iSelEnd - iSelStart + 1, MEMORY_ALLOCATION_ALIGNMENT);
+	WCHAR * const pszTextW = static_cast<WCHAR *>(NP2HeapAlloc(allocSize * sizeof(WCHAR)));
+	const UINT cpEdit = SciCall_GetCodePage();
+	EditRangeViewToWide(cpEdit, SciCall_GetRangeView(iSelStart, iSelEnd), pszTextW, static_cast<int>(allocSize));
+	// TODO: trim all C0 and C1 control characters.
+	StrTrim(pszTextW, L" \a\b\f\n\r\t\v");
+	if (StrIsEmpty(pszTextW)) {
+		NP2HeapFree(pszTextW);
+		return nullptr;
 	}
 
-	if (iSelCount < 32) {
-		char chNumber[32] = "";
-		SciCall_GetSelText(chNumber);
+	// https://docs.microsoft.com/en-us/windows/desktop/api/shlwapi/nf-shlwapi-urlescapew
+	DWORD cchEscaped = static_cast<DWORD>(allocSize * kMaxMultiByteCount * 3); // '&', H1, H0
+	LPWSTR pszEscapedW = static_cast<LPWSTR>(NP2HeapAlloc(cchEscaped * sizeof(WCHAR))); // '&', H1, H0
 
-		const char *ptr = strpbrk(chNumber, "xX");
-		const int radix = (ptr != nullptr) ? 16 : 10;
-		char *end;
-		unsigned iNumber = strtoul(chNumber, &end, radix);
-		if (end == chNumber) {
+	const DWORD flags = component ? (URL_ESCAPE_AS_UTF8 | URL_ESCAPE_ASCII_URI_COMPONENT | URL_ESCAPE_SEGMENT_ONLY) : URL_ESCAPE_AS_UTF8;
+	UrlEscape(pszTextW, pszEscapedW, &cchEscaped, flags);
+
+	NP2HeapFree(pszTextW);
+	*cchEscapedW = cchEscaped;
+	return pszEscapedW;
+}
+
+// same as the characters trimmed by EditURLEncodeSelection()
+static constexpr bool IsURLTrimChar(uint8_t ch) noexcept {
+	return ch == ' ' || (ch >= '\a' && ch <= '\r');
+}
+
+void EditURLEncode(bool component) noexcept {
+	const Sci_Position iSelCount = SciCall_GetSelTextLength();
+	if (iSelCount == 0) {
+		return;
+	}
+	if (SciCall_IsRectangularSelection()) {
+		NotifyRectangularSelection();
+		return;
+	}
+
+	const UINT cpEdit = SciCall_GetCodePage();
+	if (component && cpEdit == SC_CP_UTF8) {
+		// encode UTF-8 bytes directly, same as URL_ESCAPE_AS_UTF8 | URL_ESCAPE_ASCII_URI_COMPONENT
+		const Sci_Position iSelStart = SciCall_GetSelectionStart();
+		const Sci_Position iSelEnd = SciCall_GetSelectionEnd();
+		const uint8_t *ptr = reinterpret_cast<const uint8_t *>(SciCall_GetRangePointer(iSelStart, iSelEnd - iSelStart));
+		const uint8_t *end = ptr + (iSelEnd - iSelStart);
+		while (ptr < end && IsURLTrimChar(*ptr)) {
+			++ptr;
+		}
+		while (ptr < end && IsURLTrimChar(end[-1])) {
+			--end;
+		}
+		if (ptr == end) {
 			return;
 		}
 
-		if (bIncrease && iNumber < UINT_MAX) {
-			iNumber++;
-		} else if (!bIncrease && iNumber > 0) {
-			iNumber--;
+		char *pszEscaped = static_cast<char *>(NP2HeapAlloc((end - ptr)*3 + 1));
+		if (pszEscaped != nullptr) {
+			const size_t cchEscaped = UrlEncodeComponent(pszEscaped, ptr, end - ptr);
+			EditReplaceRange(iSelStart, iSelEnd, cchEscaped, pszEscaped);
+			NP2HeapFree(pszEscaped);
 		}
+		return;
+	}
 
-		int iWidth = static_cast<int>(strlen(chNumber)) - ((ptr != nullptr) ? 2 : 0);
-		if (ptr != nullptr) {
-			if (*ptr == 'X') {
-				iWidth = sprintf(chNumber, "%#0*X", iWidth, iNumber);
-			} else {
-				iWidth = sprintf(chNumber, "%#0*x", iWidth, iNumber);
-			}
-		} else {
-			iWidth = sprintf(chNumber, "%0*u", iWidth, iNumber);
-		}
-		EditReplaceMainSelection(iWidth, chNumber);
+	DWORD cchEscapedW;
+	LPWSTR pszEscapedW = EditURLEncodeSelection(&cchEscapedW, component);
+	if (pszEscapedW == nullptr) {
+		return;
 	}
+
+	DWORD cchEscaped = cchEscapedW * kMaxMultiByteCount;
+	char *pszEscaped = static_cast<char *>(NP2HeapAlloc(cchEscaped));
+	cchEscaped = WideCharToMultiByte(cpEdit, 0, pszEscapedW, cchEscapedW, pszEscaped, cchEscaped, nullptr, nullptr);
+	EditReplaceMainSelection(cchEscaped, pszEscaped);
+
+	NP2HeapFree(pszEscaped);
+	NP2HeapFree(pszEscapedW);
 }
 
 //=============================================================================
 //
-// EditTabsToSpaces()
+// EditURLDecode()
 //
-void EditTabsToSpaces(int nTabWidth, bool bOnlyIndentingWS) noexcept {
-	if (SciCall_IsSelectionEmpty()) {
+void EditURLDecode() noexcept {
+	const Sci_Position iSelCount = SciCall_GetSelTextLength();
+	if (iSelCount == 0) {
 		return;
 	}
 	if (SciCall_IsRectangularSelection()) {
@@ -2597,67 +4244,66 @@ void EditTabsToSpaces(int nTabWidth, bool bOnlyIndentingWS) noexcept {
 		return;
 	}
 
-	Sci_Position iSelStart = SciCall_GetSelectionStart();
+	const UINT cpEdit = SciCall_GetCodePage();
+	const Sci_Position iSelStart = SciCall_GetSelectionStart();
 	const Sci_Position iSelEnd = SciCall_GetSelectionEnd();
+	if (cpEdit == SC_CP_UTF8) {
+		// decode escaped bytes directly, fallback to UrlUnescape() for invalid UTF-8 result
+		const size_t length = iSelEnd - iSelStart;
+		char *pszUnescaped = static_cast<char *>(NP2HeapAlloc(length + 1));
+		if (pszUnescaped != nullptr) {
+			const char *ptr = SciCall_GetRangePointer(iSelStart, length);
+			const size_t cchUnescaped = UrlDecode(pszUnescaped, ptr, length);
+			const bool utf8 = IsUTF8(pszUnescaped, cchUnescaped);
+			if (utf8 && cchUnescaped != length) {
+				EditReplaceRange(iSelStart, iSelEnd, cchUnescaped, pszUnescaped);
+			}
+			NP2HeapFree(pszUnescaped);
+			if (utf8) {
+				return;
+			}
+		}
+	}
 
-	const Sci_Line iLine = SciCall_LineFromPosition(iSelStart);
-	iSelStart = SciCall_PositionFromLine(iLine);
-
-	const Sci_Position iSelCount = iSelEnd - iSelStart;
-	char *pszText = static_cast<char *>(NP2HeapAlloc(iSelCount + 1));
-	LPWSTR pszTextW = static_cast<LPWSTR>(NP2HeapAlloc((iSelCount + 1) * sizeof(WCHAR)));
-
-	const Sci_TextRangeFull tr = { { iSelStart, iSelEnd }, pszText};
-	SciCall_GetTextRangeFull(&tr);
-
-	const UINT cpEdit = SciCall_GetCodePage();
-	const int cchTextW = MultiByteToWideChar(cpEdit, 0, pszText, static_cast<int>(iSelCount), pszTextW, static_cast<int>(NP2HeapSize(pszTextW) / sizeof(WCHAR)));
-	NP2HeapFree(pszText);
+	size_t allocSize = NP2_align_up(iSelEnd - iSelStart + 1, MEMORY_ALLOCATION_ALIGNMENT);
+	WCHAR * const pszTextW = static_cast<WCHAR *>(NP2HeapAlloc(allocSize * sizeof(WCHAR)));
+	EditRangeViewToWide(cpEdit, SciCall_GetRangeView(iSelStart, iSelEnd), pszTextW, static_cast<int>(allocSize));
 
-	LPWSTR pszConvW = static_cast<LPWSTR>(NP2HeapAlloc(cchTextW * sizeof(WCHAR) * nTabWidth + 2));
-	int cchConvW = 0;
+	allocSize *= kMaxMultiByteCount;
+	char * const pszUnescaped = static_cast<char *>(NP2HeapAlloc(allocSize * (sizeof(char) + sizeof(WCHAR))));
+	WCHAR * const pszUnescapedW = reinterpret_cast<LPWSTR>(pszUnescaped + allocSize);
 
-	bool bIsLineStart = true;
-	bool bModified = false;
-	// Contributed by Homam, Thank you very much!
-	int i = 0;
-	for (int iTextW = 0; iTextW < cchTextW; iTextW++) {
-		const WCHAR w = pszTextW[iTextW];
-		if (w == L'\t' && (!bOnlyIndentingWS || bIsLineStart)) {
-			for (int j = 0; j < nTabWidth - (i % nTabWidth); j++) {
-				pszConvW[cchConvW++] = L' ';
-			}
-			i = 0;
-			bModified = true;
-		} else {
-			i++;
-			if (w == L'\n' || w == L'\r') {
-				i = 0;
-				bIsLineStart = true;
-			} else if (w != L' ') {
-				bIsLineStart = false;
+	DWORD cchUnescapedW = static_cast<DWORD>(allocSize);
+	int cchUnescaped = cchUnescapedW;
+	UrlUnescape(pszTextW, pszUnescapedW, &cchUnescapedW, URL_UNESCAPE_AS_UTF8);
+	if (!IsWin8AndAbove()) {
+		char *ptr = pszUnescaped;
+		LPCWSTR t = pszUnescapedW;
+		WCHAR ch;
+		while ((ch = *t++) != 0) {
+			if (ch > 0xff) {
+				break;
 			}
-			pszConvW[cchConvW++] = w;
+			*ptr++ = static_cast<char>(ch);
+		}
+		*ptr = '\0';
+		if (ptr == pszUnescaped + cchUnescapedW && IsUTF8(pszUnescaped, cchUnescapedW)) {
+			cchUnescapedW = MultiByteToWideChar(CP_UTF8, 0, pszUnescaped, cchUnescapedW, pszUnescapedW, cchUnescaped);
 		}
 	}
 
-	NP2HeapFree(pszTextW);
-
-	if (bModified) {
-		pszText = static_cast<char *>(NP2HeapAlloc(cchConvW * kMaxMultiByteCount));
-		const int cchText = WideCharToMultiByte(cpEdit, 0, pszConvW, cchConvW, pszText, static_cast<int>(NP2HeapSize(pszText)), nullptr, nullptr);
-		EditReplaceRange(iSelStart, iSelEnd, cchText, pszText);
-		NP2HeapFree(pszText);
-	}
+	cchUnescaped = WideCharToMultiByte(cpEdit, 0, pszUnescapedW, cchUnescapedW, pszUnescaped, static_cast<int>(allocSize), nullptr, nullptr);
+	EditReplaceMainSelection(cchUnescaped, pszUnescaped);
 
-	NP2HeapFree(pszConvW);
+	NP2HeapFree(pszTextW);
+	NP2HeapFree(pszUnescaped);
 }
 
 //=============================================================================
 //
-// EditSpacesToTabs()
+// EditEscapeCChars()
 //
-void EditSpacesToTabs(int nTabWidth, bool bOnlyIndentingWS) noexcept {
+void EditEscapeCChars(HWND hwnd) noexcept {
 	if (SciCall_IsSelectionEmpty()) {
 		return;
 	}
@@ -2666,1263 +4312,1151 @@ void EditSpacesToTabs(int nTabWidth, bool bOnlyIndentingWS) noexcept {
 		return;
 	}
 
-	Sci_Position iSelStart = SciCall_GetSelectionStart();
-	const Sci_Position iSelEnd = SciCall_GetSelectionEnd();
-
-	const Sci_Line iLine = SciCall_LineFromPosition(iSelStart);
-	iSelStart = SciCall_PositionFromLine(iLine);
-
-	const Sci_Position iSelCount = iSelEnd - iSelStart;
-	char *pszText = static_cast<char *>(NP2HeapAlloc(iSelCount + 1));
-	LPWSTR pszTextW = static_cast<LPWSTR>(NP2HeapAlloc((iSelCount + 1) * sizeof(WCHAR)));
-
-	const Sci_TextRangeFull tr = { { iSelStart, iSelEnd }, pszText };
-	SciCall_GetTextRangeFull(&tr);
-
-	const UINT cpEdit = SciCall_GetCodePage();
-
-	const int cchTextW = MultiByteToWideChar(cpEdit, 0, pszText, static_cast<int>(iSelCount), pszTextW, static_cast<int>(NP2HeapSize(pszTextW) / sizeof(WCHAR)));
-	NP2HeapFree(pszText);
-
-	LPWSTR pszConvW = static_cast<LPWSTR>(NP2HeapAlloc(cchTextW * sizeof(WCHAR) + 2));
-	int cchConvW = 0;
+	EDITFINDREPLACE * const efr = static_cast<EDITFINDREPLACE *>(NP2HeapAlloc(sizeof(EDITFINDREPLACE)));
+	efr->hwnd = hwnd;
+	SciCall_BeginBatchUpdate();
+	const int rid = pLexCurrent->rid;
 
-	bool bIsLineStart = true;
-	bool bModified = false;
-	// Contributed by Homam, Thank you very much!
-	int i = 0;
-	int j = 0;
-	WCHAR space[256];
-	for (int iTextW = 0; iTextW < cchTextW; iTextW++) {
-		const WCHAR w = pszTextW[iTextW];
-		if ((w == L' ' || w == L'\t') && (!bOnlyIndentingWS || bIsLineStart)) {
-			space[j++] = w;
-			if (j == nTabWidth - (i % nTabWidth) || w == L'\t') {
-				if (j > 1 || pszTextW[iTextW + 1] == L' ' || pszTextW[iTextW + 1] == L'\t') {
-					pszConvW[cchConvW++] = L'\t';
-				} else {
-					pszConvW[cchConvW++] = w;
-				}
-				i = j = 0;
-				bModified = bModified || (w != pszConvW[cchConvW - 1]);
-			}
-		} else {
-			i += j + 1;
-			if (j > 0) {
-				//space[j] = '\0';
-				for (int t = 0; t < j; t++) {
-					pszConvW[cchConvW++] = space[t];
-				}
-				j = 0;
-			}
-			if (w == L'\n' || w == L'\r') {
-				i = 0;
-				bIsLineStart = true;
-			} else {
-				bIsLineStart = false;
-			}
-			pszConvW[cchConvW++] = w;
-		}
-	}
+	StrCpyEx(efr->szFind, "\\");
+	StrCpyEx(efr->szReplace, "\\\\");
+	EditReplaceAllInSelection(hwnd, efr);
 
-	if (j > 0) {
-		for (int t = 0; t < j; t++) {
-			pszConvW[cchConvW++] = space[t];
-		}
+	StrCpyEx(efr->szFind, "\"");
+	if (rid == NP2LEX_RESOURCESCRIPT) {
+		StrCpyEx(efr->szReplace, "\"\"");
+	} else {
+		StrCpyEx(efr->szReplace, "\\\"");
 	}
+	EditReplaceAllInSelection(hwnd, efr);
 
-	NP2HeapFree(pszTextW);
-
-	if (bModified || cchConvW != cchTextW) {
-		pszText = static_cast<char *>(NP2HeapAlloc(cchConvW * kMaxMultiByteCount + 1));
-		const int cchText = WideCharToMultiByte(cpEdit, 0, pszConvW, cchConvW, pszText, static_cast<int>(NP2HeapSize(pszText)), nullptr, nullptr);
-		EditReplaceRange(iSelStart, iSelEnd, cchText, pszText);
-		NP2HeapFree(pszText);
+	if (rid != NP2LEX_RESOURCESCRIPT) {
+		StrCpyEx(efr->szFind, "\'");
+		StrCpyEx(efr->szReplace, "\\\'");
+		EditReplaceAllInSelection(hwnd, efr);
 	}
 
-	NP2HeapFree(pszConvW);
+	NP2HeapFree(efr);
+	SciCall_EndBatchUpdate();
 }
 
 //=============================================================================
 //
-// EditMoveUp()
+// EditUnescapeCChars()
 //
-void EditMoveUp() noexcept {
-	Sci_Position iCurPos = SciCall_GetCurrentPos();
-	Sci_Position iAnchorPos = SciCall_GetAnchor();
-	Sci_Line iCurLine = SciCall_LineFromPosition(iCurPos);
-	Sci_Line iAnchorLine = SciCall_LineFromPosition(iAnchorPos);
-
-	if (iCurLine == iAnchorLine) {
-		if (iCurLine > 0) {
-			const Sci_Position iLineStart = SciCall_PositionFromLine(iCurLine);
-			const Sci_Position iLineCurPos = iCurPos - iLineStart;
-			const Sci_Position iLineAnchorPos = iAnchorPos - iLineStart;
-			SciCall_LineTranspose();
-			const Sci_Position iLineDestStart = SciCall_PositionFromLine(iCurLine - 1);
-			SciCall_SetSel(iLineDestStart + iLineAnchorPos, iLineDestStart + iLineCurPos);
-			SciCall_ChooseCaretX();
-		}
+void EditUnescapeCChars(HWND hwnd) noexcept {
+	if (SciCall_IsSelectionEmpty()) {
+		return;
+	}
+	if (SciCall_IsRectangularSelection()) {
+		NotifyRectangularSelection();
 		return;
 	}
 
-	const Sci_Line iLineSrc = min(iCurLine, iAnchorLine) - 1;
-	if (iLineSrc >= 0) {
-		Sci_Line iLineDest = max(iCurLine, iAnchorLine);
-		if (max(iCurPos, iAnchorPos) <= SciCall_PositionFromLine(iLineDest)) {
-			iLineDest--;
-		}
+	EDITFINDREPLACE * const efr = static_cast<EDITFINDREPLACE *>(NP2HeapAlloc(sizeof(EDITFINDREPLACE)));
+	efr->hwnd = hwnd;
+	SciCall_BeginBatchUpdate();
+	const int rid = pLexCurrent->rid;
 
-		SciCall_MoveSelectedLinesUp();
-		if (iCurPos < iAnchorPos) {
-			iCurLine = iCurLine - 1;
-			iAnchorLine = iLineDest;
-		} else {
-			iAnchorLine = iAnchorLine - 1;
-			iCurLine = iLineDest;
-		}
+	StrCpyEx(efr->szFind, "\\\\");
+	StrCpyEx(efr->szReplace, "\\");
+	EditReplaceAllInSelection(hwnd, efr);
 
-		iAnchorPos = SciCall_PositionFromLine(iAnchorLine);
-		iCurPos = SciCall_PositionFromLine(iCurLine);
-		SciCall_SetSel(iAnchorPos, iCurPos);
+	if (rid == NP2LEX_RESOURCESCRIPT) {
+		StrCpyEx(efr->szFind, "\"\"");
+	} else {
+		StrCpyEx(efr->szFind, "\\\"");
+	}
+	StrCpyEx(efr->szReplace, "\"");
+	EditReplaceAllInSelection(hwnd, efr);
+
+	if (rid != NP2LEX_RESOURCESCRIPT) {
+		StrCpyEx(efr->szFind, "\\\'");
+		StrCpyEx(efr->szReplace, "\'");
+		EditReplaceAllInSelection(hwnd, efr);
 	}
+
+	NP2HeapFree(efr);
+	SciCall_EndBatchUpdate();
 }
 
+// XML/HTML predefined entity
+// https://en.wikipedia.org/wiki/List_of_XML_and_HTML_character_entity_references
+// &quot;	["]
+// &amp;	[&]
+// &apos;	[']
+// &lt;		[<]
+// &gt;		[>]
+// &nbsp;	[ ]
+// &emsp;	[\t]
 //=============================================================================
 //
-// EditMoveDown()
+// EditEscapeXHTMLChars()
 //
-void EditMoveDown() noexcept {
-	Sci_Position iCurPos = SciCall_GetCurrentPos();
-	Sci_Position iAnchorPos = SciCall_GetAnchor();
-	Sci_Line iCurLine = SciCall_LineFromPosition(iCurPos);
-	Sci_Line iAnchorLine = SciCall_LineFromPosition(iAnchorPos);
+void EditEscapeXHTMLChars(HWND hwnd) noexcept {
+	if (SciCall_IsSelectionEmpty()) {
+		return;
+	}
+	if (SciCall_IsRectangularSelection()) {
+		NotifyRectangularSelection();
+		return;
+	}
 
-	if (iCurLine == iAnchorLine) {
-		iCurLine += 1;
-		if (iCurLine < SciCall_GetLineCount()) {
-			const Sci_Position iLineStart = SciCall_PositionFromLine(iAnchorLine);
-			const Sci_Position iLineCurPos = iCurPos - iLineStart;
-			const Sci_Position iLineAnchorPos = iAnchorPos - iLineStart;
-			SciCall_GotoLine(iCurLine);
-			SciCall_LineTranspose();
-			const Sci_Position iLineDestStart = SciCall_PositionFromLine(iCurLine);
-			SciCall_SetSel(iLineDestStart + iLineAnchorPos, iLineDestStart + iLineCurPos);
-			SciCall_ChooseCaretX();
-		}
-		return;
-	}
-
-	Sci_Line iLineSrc = max(iCurLine, iAnchorLine) + 1;
-	if (max(iCurPos, iAnchorPos) <= SciCall_PositionFromLine(iLineSrc - 1)) {
-		iLineSrc--;
-	}
+	EDITFINDREPLACE * const efr = static_cast<EDITFINDREPLACE *>(NP2HeapAlloc(sizeof(EDITFINDREPLACE)));
+	efr->hwnd = hwnd;
+	SciCall_BeginBatchUpdate();
 
-	const Sci_Line iLineEnd = SciCall_GetLineCount() - 1;
-	if (iLineSrc <= iLineEnd) {
-		SciCall_MoveSelectedLinesDown();
-		if (iCurPos < iAnchorPos) {
-			iCurLine = iCurLine + 1;
-			iAnchorLine = iLineSrc + 1;
-		} else {
-			iAnchorLine = iAnchorLine + 1;
-			iCurLine = iLineSrc + 1;
-		}
+	StrCpyEx(efr->szFind, "&");
+	StrCpyEx(efr->szReplace, "&amp;");
+	EditReplaceAllInSelection(hwnd, efr);
 
-		iAnchorPos = SciCall_PositionFromLine(iAnchorLine);
-		iCurPos = SciCall_PositionFromLine(iCurLine);
-		SciCall_SetSel(iAnchorPos, iCurPos);
-	}
-}
+	StrCpyEx(efr->szFind, "\"");
+	StrCpyEx(efr->szReplace, "&quot;");
+	EditReplaceAllInSelection(hwnd, efr);
 
-namespace {
-// only convert CR+LF
-void ConvertWinEditLineEndingsEx(char *s, int iEOLMode, int *lineCount) noexcept {
-	int count = 0;
-	if (iEOLMode != SC_EOL_CRLF) {
-		char *p = s;
-		const char chaEOL = (iEOLMode == SC_EOL_LF) ? '\n' : '\r';
-		while (*s) {
-			switch (*s) {
-			case '\r':
-				++count;
-				if (s[1] == '\n') {
-					++s;
-					*p++ = chaEOL;
-				} else {
-					*p++ = '\r';
-				}
-				++s;
-				break;
+	StrCpyEx(efr->szFind, "\'");
+	StrCpyEx(efr->szReplace, "&apos;");
+	EditReplaceAllInSelection(hwnd, efr);
 
-			case '\n':
-				++count;
-				*p++ = '\n';
-				++s;
-				break;
+	StrCpyEx(efr->szFind, "<");
+	StrCpyEx(efr->szReplace, "&lt;");
+	EditReplaceAllInSelection(hwnd, efr);
 
-			default:
-				*p++ = *s++;
-				break;
-			}
-		}
+	StrCpyEx(efr->szFind, ">");
+	StrCpyEx(efr->szReplace, "&gt;");
+	EditReplaceAllInSelection(hwnd, efr);
 
-		*p = '\0';
-		if (lineCount != nullptr) {
-			*lineCount = count;
-		}
-	} else if (lineCount != nullptr) {
-		while (*s) {
-			switch (*s++) {
-			case '\r':
-				++count;
-				if (*s == '\n') {
-					++s;
-				}
-				break;
+	if (pLexCurrent->iLexer != SCLEX_XML) {
+		StrCpyEx(efr->szFind, " ");
+		StrCpyEx(efr->szReplace, "&nbsp;");
+		EditReplaceAllInSelection(hwnd, efr);
 
-			case '\n':
-				++count;
-				break;
-			}
-		}
-		*lineCount = count;
+		StrCpyEx(efr->szFind, "\t");
+		StrCpyEx(efr->szReplace, "&emsp;");
+		EditReplaceAllInSelection(hwnd, efr);
 	}
-}
 
-inline void ConvertWinEditLineEndings(char *s, int iEOLMode) noexcept {
-	ConvertWinEditLineEndingsEx(s, iEOLMode, nullptr);
+	NP2HeapFree(efr);
+	SciCall_EndBatchUpdate();
 }
 
-enum {
-	EditModifyLinesSubstitution_None = '\0',
-	EditModifyLinesSubstitution_LineNumber = 'L',
-	EditModifyLinesSubstitution_NumberOne = 'N',
-	EditModifyLinesSubstitution_NumberZero = 'I',
-};
-
-struct EditModifyLinesText {
-	int length;
-	int lineCount;
-	uint8_t substitution;
-	bool padZero;
-	int numWidth;
-	Sci_Line number;
-	char *mszPrefix;
-	const char *mszSuffix;
-	void Parse(LPCWSTR pszTextW, Sci_Line iLineStart, Sci_Line iLineEnd, UINT cpEdit, int iEOLMode) noexcept;
-	void Insert(char *mszInsert, Sci_Line iLine, Sci_Position position) noexcept;
-};
-
-void EditModifyLinesText::Parse(LPCWSTR pszTextW, Sci_Line iLineStart, Sci_Line iLineEnd, UINT cpEdit, int iEOLMode) noexcept {
-	memset(this, 0, sizeof(EditModifyLinesText));
-	length = lstrlen(pszTextW);
-	if (length == 0) {
+//=============================================================================
+//
+// EditUnescapeXHTMLChars()
+//
+void EditUnescapeXHTMLChars(HWND hwnd) noexcept {
+	if (SciCall_IsSelectionEmpty()) {
+		return;
+	}
+	if (SciCall_IsRectangularSelection()) {
+		NotifyRectangularSelection();
 		return;
 	}
 
-	length = length * kMaxMultiByteCount + 1;
-	mszPrefix = static_cast<char *>(NP2HeapAlloc(length));
-	WideCharToMultiByte(cpEdit, 0, pszTextW, -1, mszPrefix, length, nullptr, nullptr);
-	ConvertWinEditLineEndingsEx(mszPrefix, iEOLMode, &lineCount);
+	EDITFINDREPLACE * const efr = static_cast<EDITFINDREPLACE *>(NP2HeapAlloc(sizeof(EDITFINDREPLACE)));
+	efr->hwnd = hwnd;
+	SciCall_BeginBatchUpdate();
 
-	char *p = mszPrefix;
-	while ((p = strstr(p, "$(")) != nullptr) {
-		char * const back = p;
-		p += CSTRLEN("$(");
-		padZero = *p == '0';
-		if (padZero) {
-			p++;
-		}
-		if ((*p == 'L' || *p == 'N' || *p == 'I') && p[1] == ')') {
-			*back = '\0';
-			number = 0;
-			Sci_Line count;
-			substitution = *p;
-			if (substitution == EditModifyLinesSubstitution_LineNumber) {
-				count = iLineEnd + 1;
-			} else {
-				number = substitution == EditModifyLinesSubstitution_NumberOne;
-				count = iLineEnd - iLineStart + number;
-			}
-			numWidth = 1;
-			while (count >= 10) {
-				++numWidth;
-				count /= 10;
-			}
+	StrCpyEx(efr->szFind, "&quot;");
+	StrCpyEx(efr->szReplace, "\"");
+	EditReplaceAllInSelection(hwnd, efr);
 
-			mszSuffix = p + 2;
-			break;
-		}
-	}
-}
+	StrCpyEx(efr->szFind, "&apos;");
+	StrCpyEx(efr->szReplace, "\'");
+	EditReplaceAllInSelection(hwnd, efr);
 
-void EditModifyLinesText::Insert(char *mszInsert, Sci_Line iLine, Sci_Position position) noexcept {
-	strcpy(mszInsert, mszPrefix);
-	if (substitution != EditModifyLinesSubstitution_None) {
-		char tchNum[64];
-		const int width = numWidth;
-		const Sci_Line value = (substitution == EditModifyLinesSubstitution_LineNumber) ? iLine + 1 : number;
-#if defined(_WIN64)
-		if (padZero) {
-			sprintf(tchNum, "%0*" PRId64, width, value);
-		} else {
-			sprintf(tchNum, "%*" PRId64, width, value);
-		}
-#else
-		if (padZero) {
-			sprintf(tchNum, "%0*d", width, static_cast<int>(value));
-		} else {
-			sprintf(tchNum, "%*d", width, static_cast<int>(value));
-		}
-#endif
-		strcat(mszInsert, tchNum);
-		strcat(mszInsert, mszSuffix);
-		number++;
-	}
+	StrCpyEx(efr->szFind, "&lt;");
+	StrCpyEx(efr->szReplace, "<");
+	EditReplaceAllInSelection(hwnd, efr);
 
-	SciCall_SetTargetRange(position, position);
-	SciCall_ReplaceTarget(-1, mszInsert);
-}
+	StrCpyEx(efr->szFind, "&gt;");
+	StrCpyEx(efr->szReplace, ">");
+	EditReplaceAllInSelection(hwnd, efr);
+
+	StrCpyEx(efr->szFind, "&nbsp;");
+	StrCpyEx(efr->szReplace, " ");
+	EditReplaceAllInSelection(hwnd, efr);
 
+	StrCpyEx(efr->szFind, "&amp;");
+	StrCpyEx(efr->szReplace, "&");
+	EditReplaceAllInSelection(hwnd, efr);
+
+	StrCpyEx(efr->szFind, "&emsp;");
+	StrCpyEx(efr->szReplace, "\t");
+	EditReplaceAllInSelection(hwnd, efr);
+
+	NP2HeapFree(efr);
+	SciCall_EndBatchUpdate();
 }
 
 //=============================================================================
 //
-// EditModifyLines()
+// EditChar2Hex()
 //
-void EditModifyLines(LPCWSTR pwszPrefix, LPCWSTR pwszAppend, bool skipEmptyLine) noexcept {
-	if (SciCall_IsRectangularSelection()) {
-		NotifyRectangularSelection();
+
+/*				C/C++	C#	Java	JS	JSON	Python	PHP	Lua		Go
+\ooo		3	1			1					1		1	1/ddd	1
+\xHH		2	1		1			1			1		1			1
+\uHHHH		4	1			1		1	1		1					1
+\UHHHHHHHH	8	1								1					1
+\xHHHH		4			1
+\uHHHHHH	6				1
+*/
+#define BMP_UNICODE_HEX_DIGIT	4
+#define MAX_UNICODE_HEX_DIGIT	8
+
+void EditCharacterToHex() noexcept {
+	Sci_Position iSelCount = SciCall_GetSelTextLength();
+	if (iSelCount == 0) {
 		return;
 	}
-	if (StrIsEmpty(pwszPrefix) && StrIsEmpty(pwszAppend)) {
+	if (SciCall_IsRectangularSelection()) {
+		NotifyRectangularSelection();
 		return;
 	}
 
-	BeginWaitCursor();
-
-	const UINT cpEdit = SciCall_GetCodePage();
-	const int iEOLMode = SciCall_GetEOLMode();
-	const Sci_Position iSelStart = SciCall_GetSelectionStart();
-	const Sci_Position iSelEnd = SciCall_GetSelectionEnd();
-	const Sci_Line iLineStart = SciCall_LineFromPosition(iSelStart);
-	Sci_Line iLineEnd = SciCall_LineFromPosition(iSelEnd);
+	iSelCount *= MAX_UNICODE_HEX_DIGIT;
+	iSelCount = NP2_align_up(iSelCount + 1, MEMORY_ALLOCATION_ALIGNMENT);
+	char * const pszText = static_cast<char *>(NP2HeapAlloc(iSelCount * (sizeof(char) + sizeof(WCHAR))));
+	SciCall_GetSelText(pszText);
 
-	//if (iSelStart > SciCall_PositionFromLine(iLineStart)) {
-	//	iLineStart++;
-	//}
-
-	if (iSelEnd <= SciCall_PositionFromLine(iLineEnd)) {
-		if (iLineEnd - iLineStart >= 1) {
-			iLineEnd--;
-		}
-	}
-
-	EditModifyLinesText prefix;
-	EditModifyLinesText suffix;
-	prefix.Parse(pwszPrefix, iLineStart, iLineEnd, cpEdit, iEOLMode);
-	suffix.Parse(pwszAppend, iLineStart, iLineEnd, cpEdit, iEOLMode);
-
-	char *mszInsert = static_cast<char *>(NP2HeapAlloc(prefix.length + suffix.length + 64));
-	SciCall_BeginUndoAction();
-	for (Sci_Line iLine = iLineStart, iLineDest = iLineStart; iLine <= iLineEnd; iLine++, iLineDest++) {
-		const Sci_Position iStartPos = SciCall_PositionFromLine(iLineDest);
-		Sci_Position iEndPos = SciCall_GetLineEndPosition(iLineDest);
-		if (skipEmptyLine && iStartPos == iEndPos) {
-			continue;
-		}
-		if (prefix.length != 0) {
-			iLineDest += prefix.lineCount;
-			prefix.Insert(mszInsert, iLine, iStartPos);
-		}
-		if (suffix.length != 0) {
-			if (prefix.length != 0) {
-				iEndPos = SciCall_GetLineEndPosition(iLineDest);
+	int outLen = 0;
+	if (pszText[0] == '\0') {
+		outLen = 4;
+		StrCpyEx(pszText, "\\x00");
+	} else {
+		WCHAR * const pszTextW = reinterpret_cast<WCHAR *>(pszText + iSelCount);
+		const UINT cpEdit = SciCall_GetCodePage();
+		const int count = MultiByteToWideChar(cpEdit, 0, pszText, -1, pszTextW, static_cast<int>(iSelCount)) - 1; // '\0'
+		for (Sci_Position i = 0; i < count; i++) {
+			const WCHAR c = pszTextW[i];
+			if (c <= 0xFF) {
+				outLen += sprintf(pszText + outLen, "\\x%02X", c); // \xHH
+			} else {
+				outLen += sprintf(pszText + outLen, "\\u%04X", c); // \uHHHH
 			}
-			iLineDest += suffix.lineCount;
-			suffix.Insert(mszInsert, iLine, iEndPos);
 		}
-	}
-	SciCall_EndUndoAction();
-
-	//// Fix selection
-	//if (iSelStart != iSelEnd && SciCall_GetTargetEnd() > SciCall_GetSelectionEnd()) {
-	//	Sci_Position iCurPos = SciCall_GetCurrentPos();
-	//	Sci_Position iAnchorPos = SciCall_GetAnchor();
-	//	Sci_Position iTargetEnd = SciCall_GetTargetEnd();
-	//	if (iCurPos > iAnchorPos) {
-	//		iCurPos = iTargetEnd;
-	//	} else {
-	//		iAnchorPos = iTargetEnd;
-	//	}
-	//	SciCall_SetSel(iAnchorPos, iCurPos);
-	//}
-
-	// extend selection to start of first line
-	// the above code is not required when last line has been excluded
-	if (iSelStart != iSelEnd) {
-		Sci_Position iCurPos = SciCall_GetCurrentPos();
-		Sci_Position iAnchorPos = SciCall_GetAnchor();
-		if (iCurPos < iAnchorPos) {
-			iCurPos = iLineStart;
-			iAnchorPos = iLineEnd + 1;
-		} else {
-			iAnchorPos = iLineStart;
-			iCurPos = iLineEnd + 1;
+		if (count == 2 && IS_SURROGATE_PAIR(pszTextW[0], pszTextW[1])) {
+			const UINT value = UTF16_TO_UTF32(pszTextW[0], pszTextW[1]);
+			outLen += sprintf(pszText + outLen, " U+%06X", value);
 		}
-		iAnchorPos = SciCall_PositionFromLine(iAnchorPos);
-		iCurPos = SciCall_PositionFromLine(iCurPos);
-		SciCall_SetSel(iAnchorPos, iCurPos);
 	}
 
-	EndWaitCursor();
-	NP2HeapFree(prefix.mszPrefix);
-	NP2HeapFree(suffix.mszPrefix);
-	NP2HeapFree(mszInsert);
+	EditReplaceMainSelection(outLen, pszText);
+	NP2HeapFree(pszText);
 }
 
 //=============================================================================
 //
-// EditAlignText()
+// EditHex2Char()
 //
-void EditAlignText(EditAlignMode nMode) noexcept {
+void EditHexToCharacter() noexcept {
+	Sci_Position iSelCount = SciCall_GetSelTextLength();
+	if (iSelCount == 0) {
+		return;
+	}
 	if (SciCall_IsRectangularSelection()) {
 		NotifyRectangularSelection();
 		return;
 	}
 
-#define BUFSIZE_ALIGN 1024
+	iSelCount *= MAX_UNICODE_HEX_DIGIT;
+	iSelCount = NP2_align_up(iSelCount + 1, MEMORY_ALLOCATION_ALIGNMENT);
+	char * const pszText = static_cast<char *>(NP2HeapAlloc(iSelCount * (sizeof(char) + sizeof(WCHAR))));
+	WCHAR * const pszTextW = reinterpret_cast<WCHAR *>(pszText + iSelCount);
 
-	const Sci_Position iSelStart = SciCall_GetSelectionStart();
-	const Sci_Position iSelEnd = SciCall_GetSelectionEnd();
-	Sci_Position iCurPos = SciCall_GetCurrentPos();
-	Sci_Position iAnchorPos = SciCall_GetAnchor();
+	// pszText is only used for output, selection is read in place
 	const UINT cpEdit = SciCall_GetCodePage();
+	EditRangeViewToWide(cpEdit, SciCall_GetRangeView(SciCall_GetSelectionStart(), SciCall_GetSelectionEnd()), pszTextW, static_cast<int>(iSelCount - 1));
 
-	const Sci_Line iLineStart = SciCall_LineFromPosition(iSelStart);
-	Sci_Line iLineEnd = SciCall_LineFromPosition(iSelEnd);
-
-	if (iSelEnd <= SciCall_PositionFromLine(iLineEnd)) {
-		if (iLineEnd - iLineStart >= 1) {
-			iLineEnd--;
-		}
-	}
-
-	Sci_Position iMinIndent = BUFSIZE_ALIGN;
-	Sci_Position iMaxLength = 0;
-	for (Sci_Line iLine = iLineStart; iLine <= iLineEnd; iLine++) {
-		Sci_Position iLineEndPos = SciCall_GetLineEndPosition(iLine);
-		const Sci_Position iLineIndentPos = SciCall_GetLineIndentPosition(iLine);
-
-		if (iLineIndentPos < iLineEndPos) {
-			while (iLineEndPos >= iLineIndentPos) {
-				iLineEndPos--;
-				const int ch = SciCall_GetCharAt(iLineEndPos);
-				if (!IsASpaceOrTab(ch)) {
+	const WCHAR *p = pszTextW;
+	WCHAR *t = pszTextW;
+	bool changed = false;
+	while (*p) {
+		UINT wc = *p++;
+		if ((wc == L'\\' && (*p == L'x' || UnsafeLower(*p) == 'u')) || (wc == L'U' && *p == L'+')) {
+			const int digitCount = (wc == L'U' || *p == L'U') ? MAX_UNICODE_HEX_DIGIT : BMP_UNICODE_HEX_DIGIT;
+			UINT value = 0;
+			int ucc = 1;
+			p++;
+			for (; ucc <= digitCount && *p; ucc++) {
+				const int hex = GetHexDigit(*p);
+				if (hex < 0) {
 					break;
 				}
+				value = (value << 4) | hex;
+				p++;
 			}
-
-			++iLineEndPos;
-			const Sci_Position iEndCol = SciCall_GetColumn(iLineEndPos);
-			const Sci_Position iIndentCol = SciCall_GetLineIndentation(iLine);
-			iMinIndent = min(iMinIndent, iIndentCol);
-			iMaxLength = max(iMaxLength, iEndCol);
-		}
-	}
-
-	if (iMaxLength < BUFSIZE_ALIGN) {
-		struct EditAlignTextVar {
-			char tchLineBuf[BUFSIZE_ALIGN * kMaxMultiByteCount];
-			WCHAR wchLineBuf[BUFSIZE_ALIGN];
-			LPWSTR pWords[BUFSIZE_ALIGN];
-			WCHAR wchNewLineBuf[BUFSIZE_ALIGN * 3];
-		};
-		EditAlignTextVar * const var = static_cast<EditAlignTextVar *>(NP2HeapAlloc(sizeof(EditAlignTextVar)));
-		SciCall_BeginUndoAction();
-		for (Sci_Line iLine = iLineStart; iLine <= iLineEnd; iLine++) {
-			const Sci_Position iIndentPos = SciCall_GetLineIndentPosition(iLine);
-			const Sci_Position iEndPos = SciCall_GetLineEndPosition(iLine);
-
-			if (iIndentPos == iEndPos && iEndPos > 0) {
-				const Sci_Position iStartPos = SciCall_PositionFromLine(iLine);
-				SciCall_DeleteRange(iStartPos, iEndPos - iStartPos);
-			} else {
-				char* const tchLineBuf = var->tchLineBuf;
-				WCHAR* const wchLineBuf = var->wchLineBuf;
-				LPWSTR* const pWords = var->pWords;
-				WCHAR * const wchNewLineBuf = var->wchNewLineBuf;
-				WCHAR *p = wchLineBuf;
-
-				Sci_Position iWordsLength = 0;
-				const Sci_Position cchLine = SciCall_GetLine(iLine, tchLineBuf);
-
-				int iWords = MultiByteToWideChar(cpEdit, 0, tchLineBuf, static_cast<int>(cchLine), wchLineBuf, COUNTOF(var->wchLineBuf));
-				wchLineBuf[iWords] = L'\0';
-				iWords = 0;
-				StrTrim(wchLineBuf, L"\r\n\t ");
-
-				while (*p) {
-					if (*p != L' ' && *p != L'\t') {
-						pWords[iWords++] = p++;
-						iWordsLength++;
-						while (*p && *p != L' ' && *p != L'\t') {
-							p++;
-							iWordsLength++;
-						}
-					} else {
-						*p++ = L'\0';
-					}
-				}
-
-				if (iWords > 0) {
-					if (nMode == EditAlignMode_Justify || nMode == EditAlignMode_JustifyEx) {
-						bool bNextLineIsBlank = false;
-						if (nMode == EditAlignMode_JustifyEx) {
-							if (SciCall_GetLineCount() <= iLine + 1) {
-								bNextLineIsBlank = true;
-							} else {
-								const Sci_Position iLineEndPos = SciCall_GetLineEndPosition(iLine + 1);
-								const Sci_Position iLineIndentPos = SciCall_GetLineIndentPosition(iLine + 1);
-								if (iLineIndentPos == iLineEndPos) {
-									bNextLineIsBlank = true;
-								}
-							}
-						}
-
-						if ((nMode == EditAlignMode_Justify || nMode == EditAlignMode_JustifyEx) &&
-								iWords > 1 && iWordsLength >= 2 &&
-								((nMode != EditAlignMode_JustifyEx || !bNextLineIsBlank || iLineStart == iLineEnd) ||
-								 (bNextLineIsBlank && iWordsLength*4 > (iMaxLength - iMinIndent)*3))) {
-							const int iGaps = iWords - 1;
-							const Sci_Position iSpacesPerGap = (iMaxLength - iMinIndent - iWordsLength) / iGaps;
-							const Sci_Position iExtraSpaces = (iMaxLength - iMinIndent - iWordsLength) % iGaps;
-
-							lstrcpy(wchNewLineBuf, pWords[0]);
-							p = StrEnd(wchNewLineBuf);
-
-							for (int i = 1; i < iWords; i++) {
-								for (Sci_Position j = 0; j < iSpacesPerGap; j++) {
-									*p++ = L' ';
-								}
-								if (i > iGaps - iExtraSpaces) {
-									*p++ = L' ';
-								}
-								*p = L'\0';
-								lstrcat(p, pWords[i]);
-								p = StrEnd(p);
-							}
-
-							WideCharToMultiByte(cpEdit, 0, wchNewLineBuf, -1, tchLineBuf, COUNTOF(var->tchLineBuf), nullptr, nullptr);
-
-							SciCall_SetTargetRange(SciCall_PositionFromLine(iLine), SciCall_GetLineEndPosition(iLine));
-							SciCall_ReplaceTarget(-1, tchLineBuf);
-							SciCall_SetLineIndentation(iLine, iMinIndent);
-						} else {
-							lstrcpy(wchNewLineBuf, pWords[0]);
-							p = StrEnd(wchNewLineBuf);
-
-							for (int i = 1; i < iWords; i++) {
-								*p++ = L' ';
-								*p = L'\0';
-								lstrcat(wchNewLineBuf, pWords[i]);
-								p = StrEnd(p);
-							}
-
-							WideCharToMultiByte(cpEdit, 0, wchNewLineBuf, -1, tchLineBuf, COUNTOF(var->tchLineBuf), nullptr, nullptr);
-
-							SciCall_SetTargetRange(SciCall_PositionFromLine(iLine), SciCall_GetLineEndPosition(iLine));
-							SciCall_ReplaceTarget(-1, tchLineBuf);
-							SciCall_SetLineIndentation(iLine, iMinIndent);
-						}
-					} else {
-						const Sci_Position iExtraSpaces = iMaxLength - iMinIndent - iWordsLength - iWords + 1;
-						Sci_Position iOddSpaces = iExtraSpaces % 2;
-
-						p = wchNewLineBuf;
-						if (nMode == EditAlignMode_Right) {
-							for (Sci_Position i = 0; i < iExtraSpaces; i++) {
-								*p++ = L' ';
-							}
-						}
-
-						if (nMode == EditAlignMode_Center) {
-							for (Sci_Position i = 1; i < iExtraSpaces - iOddSpaces; i += 2) {
-								*p++ = L' ';
-							}
-						}
-
-						*p = L'\0';
-						for (int i = 0; i < iWords; i++) {
-							lstrcat(p, pWords[i]);
-							if (i < iWords - 1) {
-								lstrcat(p, L" ");
-							}
-							if (nMode == EditAlignMode_Center && iWords > 1 && iOddSpaces > 0 && i + 1 >= iWords / 2) {
-								lstrcat(p, L" ");
-								iOddSpaces--;
-							}
-							p = StrEnd(p);
-						}
-
-						WideCharToMultiByte(cpEdit, 0, wchNewLineBuf, -1, tchLineBuf, COUNTOF(var->tchLineBuf), nullptr, nullptr);
-
-						Sci_Position iPos;
-						if (nMode == EditAlignMode_Right || nMode == EditAlignMode_Center) {
-							SciCall_SetLineIndentation(iLine, iMinIndent);
-							iPos = SciCall_GetLineIndentPosition(iLine);
-						} else {
-							iPos = SciCall_PositionFromLine(iLine);
-						}
-
-						SciCall_SetTargetRange(iPos, SciCall_GetLineEndPosition(iLine));
-						SciCall_ReplaceTarget(-1, tchLineBuf);
-						if (nMode == EditAlignMode_Left) {
-							SciCall_SetLineIndentation(iLine, iMinIndent);
-						}
-					}
+			if (ucc > 1 && value <= MAX_UNICODE) {
+				changed = true;
+				// see UTF16FromUTF32Character() in UniConversion.h
+				if (value < SUPPLEMENTAL_PLANE_FIRST) {
+					wc = value;
+				} else {
+					*t++ = static_cast<WCHAR>(((value - SUPPLEMENTAL_PLANE_FIRST) >> 10) + SURROGATE_LEAD_FIRST);
+					wc = (value & 0x3ff) + SURROGATE_TRAIL_FIRST;
 				}
+			} else {
+				p -= ucc;
 			}
 		}
-		SciCall_EndUndoAction();
-		NP2HeapFree(var);
-	} else {
-		MsgBoxInfo(MB_OK, IDS_BUFFERTOOSMALL);
+		*t++ = static_cast<WCHAR>(wc);
 	}
 
-	if (iCurPos < iAnchorPos) {
-		iCurPos = iLineStart;
-		iAnchorPos = iLineEnd + 1;
-	} else {
-		iAnchorPos = iLineStart;
-		iCurPos = iLineEnd + 1;
+	if (changed) {
+		*t = L'\0';
+		iSelCount = WideCharToMultiByte(cpEdit, 0, pszTextW, static_cast<int>(t - pszTextW), pszText, static_cast<int>(iSelCount), nullptr, nullptr);
+		EditReplaceMainSelection(iSelCount, pszText);
 	}
-	iAnchorPos = SciCall_PositionFromLine(iAnchorPos);
-	iCurPos = SciCall_PositionFromLine(iCurPos);
-	SciCall_SetSel(iAnchorPos, iCurPos);
+
+	NP2HeapFree(pszText);
 }
 
-//=============================================================================
-//
-// EditEncloseSelection()
-//
-void EditEncloseSelection(LPCWSTR pwszOpen, LPCWSTR pwszClose) noexcept {
-	if (SciCall_IsRectangularSelection()) {
-		NotifyRectangularSelection();
+void EditShowHex() noexcept {
+	const Sci_Position iSelCount = SciCall_GetSelTextLength();
+	if (iSelCount == 0) {
 		return;
 	}
-	if (StrIsEmpty(pwszOpen) && StrIsEmpty(pwszClose)) {
+	if (SciCall_IsRectangularSelection()) {
+		NotifyRectangularSelection();
 		return;
 	}
 
-	BeginWaitCursor();
-
 	const Sci_Position iSelStart = SciCall_GetSelectionStart();
 	const Sci_Position iSelEnd = SciCall_GetSelectionEnd();
-	const UINT cpEdit = SciCall_GetCodePage();
-	const int iEOLMode = SciCall_GetEOLMode();
-
-	char *mszOpen = nullptr;
-	int len = lstrlen(pwszOpen);
-	if (len != 0) {
-		const int size = kMaxMultiByteCount * len + 1;
-		mszOpen = static_cast<char *>(NP2HeapAlloc(size));
-		WideCharToMultiByte(cpEdit, 0, pwszOpen, -1, mszOpen, size, nullptr, nullptr);
-		ConvertWinEditLineEndings(mszOpen, iEOLMode);
-	}
-
-	char *mszClose = nullptr;
-	len = lstrlen(pwszClose);
-	if (len != 0) {
-		const int size = kMaxMultiByteCount * len + 1;
-		mszClose = static_cast<char *>(NP2HeapAlloc(size));
-		WideCharToMultiByte(cpEdit, 0, pwszClose, -1, mszClose, size, nullptr, nullptr);
-		ConvertWinEditLineEndings(mszClose, iEOLMode);
-	}
-
-	SciCall_BeginUndoAction();
-	len = 0;
-
-	if (StrNotEmpty(mszOpen)) {
-		len = static_cast<int>(strlen(mszOpen));
-		SciCall_SetTargetRange(iSelStart, iSelStart);
-		SciCall_ReplaceTarget(len, mszOpen);
+	const size_t length = iSelEnd - iSelStart;
+	char *pszOut = static_cast<char *>(NP2HeapAlloc(length*3 + 2));
+	if (pszOut == nullptr) {
+		return;
 	}
 
-	if (StrNotEmpty(mszClose)) {
-		SciCall_SetTargetRange(iSelEnd + len, iSelEnd + len);
-		SciCall_ReplaceTarget(-1, mszClose);
+	const SciTextRangeView view = SciCall_GetRangeView(iSelStart, iSelEnd);
+	pszOut[0] = '[';
+	size_t cchOut = 1;
+	for (int i = 0; i < 2; i++) {
+		cchOut += BytesToHex(pszOut + cchOut, reinterpret_cast<const uint8_t *>(view.text[i]), view.length[i]);
 	}
+	pszOut[cchOut - 1] = ']';
 
-	SciCall_EndUndoAction();
+	SciCall_InsertText(iSelEnd, pszOut);
+	SciCall_SetSel(iSelEnd, iSelEnd + cchOut);
+	NP2HeapFree(pszOut);
+}
 
-	// Fix selection
-	if (iSelStart == iSelEnd) {
-		SciCall_SetSel(iSelStart + len, iSelStart + len);
+void EditShowCharacterInfo() noexcept {
+	const Sci_Position position = SciCall_GetSelectionStart();
+	unsigned character = SciCall_GetCharacterAt(position);
+	char bytes[4]{};
+	WCHAR wchBuf[256];
+	memset(wchBuf, 0, sizeof(int));
+	unsigned count = 1;
+	if (character <= 0x7f) {
+		bytes[0] = static_cast<char>(character);
+		wchBuf[0] = static_cast<wchar_t>(character);
 	} else {
-		Sci_Position iCurPos = SciCall_GetCurrentPos();
-		Sci_Position iAnchorPos = SciCall_GetAnchor();
-
-		if (iCurPos < iAnchorPos) {
-			iCurPos = iSelStart + len;
-			iAnchorPos = iSelEnd + len;
+		const UINT cpEdit = SciCall_GetCodePage();
+		if (cpEdit == SC_CP_UTF8) {
+			if (character < SUPPLEMENTAL_PLANE_FIRST) {
+				wchBuf[0] = static_cast<wchar_t>(character);
+			} else {
+				count = 2;
+				wchBuf[0] = static_cast<WCHAR>(((character - SUPPLEMENTAL_PLANE_FIRST) >> 10) + SURROGATE_LEAD_FIRST);
+				wchBuf[1] = (character & 0x3ff) + SURROGATE_TRAIL_FIRST;
+			}
 		} else {
-			iAnchorPos = iSelStart + len;
-			iCurPos = iSelEnd + len;
+			if (character <= 0xff) {
+				bytes[0] = static_cast<char>(character);
+			} else {
+				count = 2;
+				const uint16_t dbcs = bswap16(static_cast<uint16_t>(character));
+				memcpy(bytes, &dbcs, 2);
+			}
+			count = MultiByteToWideChar(cpEdit, 0, bytes, count, wchBuf, COUNTOF(wchBuf));
+			if (IS_SURROGATE_PAIR(wchBuf[0], wchBuf[1])) {
+				character = UTF16_TO_UTF32(wchBuf[0], wchBuf[1]);
+			} else {
+				character = wchBuf[0];
+			}
 		}
-		SciCall_SetSel(iAnchorPos, iCurPos);
+		count = WideCharToMultiByte(CP_UTF8, 0, wchBuf, count, bytes, COUNTOF(bytes), nullptr, nullptr);
 	}
 
-	EndWaitCursor();
-	if (mszOpen != nullptr) {
-		NP2HeapFree(mszOpen);
+	char buffer[256];
+	unsigned length = 0;
+	memset(buffer, 0, sizeof(int));
+	length = sprintf(buffer, "Unicode: U+%0*X\n", ((character < SUPPLEMENTAL_PLANE_FIRST) ? 4 : 6), character);
+	StrCpyEx(buffer + length, "UTF-16:");
+	length += CSTRLEN("UTF-16:");
+	length += sprintf(buffer + length, " %04X", wchBuf[0]);
+	if (character >= SUPPLEMENTAL_PLANE_FIRST) {
+		length += sprintf(buffer + length, " %04X", wchBuf[1]);
 	}
-	if (mszClose != nullptr) {
-		NP2HeapFree(mszClose);
+	StrCpyEx(buffer + length, "\nUTF-8:");
+	length += CSTRLEN("\nUTF-8:");
+	for (unsigned i = 0; i < count; i++) {
+		const uint8_t ch = bytes[i];
+		buffer[length] = ' ';
+		buffer[length + 1] = "0123456789ABCDEF"[ch >> 4];
+		buffer[length + 2] = "0123456789ABCDEF"[ch & 15];
+		length += 3;
+	}
+	length += sprintf(buffer + length, "\nHTML: &#%u;", character);
+
+// see icu.h / uchar.h, https://learn.microsoft.com/en-us/windows/win32/intl/international-components-for-unicode--icu-
+using u_charNameSig = int32_t (__cdecl *)(uint32_t code, int nameChoice, char *buffer, int32_t bufferLength, int *pErrorCode);
+using u_getIntPropertyValueSig = int32_t (__cdecl *)(uint32_t code, int which);
+using u_getPropertyValueNameSig = const char * (__cdecl *)(int property, int32_t value, int nameChoice);
+	constexpr int U_EXTENDED_CHAR_NAME = 2;
+	constexpr int U_SHORT_PROPERTY_NAME = 0;
+	constexpr int U_LONG_PROPERTY_NAME = 1;
+	constexpr int UCHAR_GENERAL_CATEGORY = 0x1005;
+
+	static uint8_t triedLoadingICU = 0;
+	static u_charNameSig pfn_charName;
+	static u_getIntPropertyValueSig pfn_getIntPropertyValue;
+	static u_getPropertyValueNameSig pfn_getPropertyValueName;
+	if (triedLoadingICU == 0) {
+		triedLoadingICU = 1;
+		HMODULE hDLL = LoadLibraryExW(L"icu.dll", nullptr, kSystemLibraryLoadFlags); // Windows 10 1903
+		// if (hDLL == nullptr) { // Windows 10 1703, legacy outdated
+		// 	hDLL = LoadLibraryExW(L"icuuc.dll", nullptr, kSystemLibraryLoadFlags);
+		// }
+		if (hDLL != nullptr) {
+			pfn_charName = DLLFunction<u_charNameSig>(hDLL, "u_charName");
+			pfn_getIntPropertyValue = DLLFunction<u_getIntPropertyValueSig>(hDLL, "u_getIntPropertyValue");
+			pfn_getPropertyValueName = DLLFunction<u_getPropertyValueNameSig>(hDLL, "u_getPropertyValueName");
+			if (pfn_charName == nullptr || pfn_getIntPropertyValue == nullptr || pfn_getPropertyValueName == nullptr) {
+				FreeLibrary(hDLL);
+			} else {
+				hICUDLL = hDLL;
+				triedLoadingICU = 2;
+			}
+		}
+	}
+	if (triedLoadingICU == 2) {
+		StrCpyEx(buffer + length, "\nName: ");
+		length += CSTRLEN("\nName: ");
+		int value = 0;
+		length += pfn_charName(character, U_EXTENDED_CHAR_NAME, buffer + length, COUNTOF(buffer) - length, &value);
+		value = pfn_getIntPropertyValue(character, UCHAR_GENERAL_CATEGORY);
+		const char *shortName = pfn_getPropertyValueName(UCHAR_GENERAL_CATEGORY, value, U_SHORT_PROPERTY_NAME);
+		const char *longName = pfn_getPropertyValueName(UCHAR_GENERAL_CATEGORY, value, U_LONG_PROPERTY_NAME);
+		sprintf(buffer + length, "\nCategory: %s %s", shortName, longName);
 	}
+
+	const WPARAM notifyPos = (static_cast<WPARAM>(position) << 2) | SC_NOTIFICATIONPOSITION_NONE;
+	ShowNotificationA(notifyPos, buffer);
+
+	MultiByteToWideChar(CP_UTF8, 0, buffer, -1, wchBuf, COUNTOF(wchBuf));
+	SetClipData(hwndMain, wchBuf);
 }
 
-//=============================================================================
-//
-// EditToggleLineComments()
-//
-void EditToggleLineComments(LPCWSTR pwszComment, int commentFlag) noexcept {
-	if (SciCall_IsRectangularSelection()) {
+void EditBase64Encode(Base64EncodingFlag encodingFlag) noexcept {
+	if (SciCall_IsSelectionEmpty()) {
+		return;
+	}
+	if (SciCall_IsRectangularSelection()){
 		NotifyRectangularSelection();
 		return;
 	}
 
-	BeginWaitCursor();
-
+	// selected text is encoded in place from document buffer
 	const Sci_Position iSelStart = SciCall_GetSelectionStart();
-	const Sci_Position iSelEnd = SciCall_GetSelectionEnd();
-	Sci_Position iCurPos = SciCall_GetCurrentPos();
-
-	char mszComment[32] = "";
-	const UINT cpEdit = SciCall_GetCodePage();
-	int cchComment = WideCharToMultiByte(cpEdit, 0, pwszComment, -1, mszComment, COUNTOF(mszComment), nullptr, nullptr) - 1;
-	const char commentEnd = mszComment[cchComment - 1];
-	char commentPad = ' ';
-	if (commentEnd == ' ') {
-		cchComment -= 1;
-	} else if ((commentFlag & AutoInsertMask_SpaceAfterComment) == 0) {
-		commentPad = '\0';
+	const size_t iSelByte = SciCall_GetSelectionEnd() - iSelStart;
+	size_t outLen = (iSelByte*4)/3 + 4 + MAX_PATH*2;
+	char * const output = static_cast<char *>(NP2HeapAlloc(outLen));
+	if (output == nullptr) {
+		return;
 	}
-
-	const Sci_Line iLineStart = SciCall_LineFromPosition(iSelStart);
-	Sci_Line iLineEnd = SciCall_LineFromPosition(iSelEnd);
-
-	if (iSelEnd <= SciCall_PositionFromLine(iLineEnd)) {
-		if (iLineEnd - iLineStart >= 1) {
-			iLineEnd--;
+	const uint8_t *input = reinterpret_cast<const uint8_t *>(SciCall_GetRangePointer(iSelStart, iSelByte));
+	outLen = 0;
+	if (encodingFlag == Base64EncodingFlag_HtmlEmbeddedImage) {
+		memcpy(output, "<img src=\"data:image/", CSTRLEN("<img src=\"data:image/"));
+		outLen = CSTRLEN("<img src=\"data:image/");
+		LPCWSTR suffix = PathFindExtension(szCurFile);
+		if (*suffix == L'.') {
+			// image file extension should be ASCII
+			++suffix;
+			while (*suffix) {
+				output[outLen++] = static_cast<char>(ToLowerA(*suffix++));
+			}
 		}
+		memcpy(output + outLen, ";base64,", CSTRLEN(";base64,"));
+		outLen += CSTRLEN(";base64,");
+	}
+	outLen += Base64Encode(output + outLen, input, iSelByte, encodingFlag == Base64EncodingFlag_UrlSafe);
+	if (encodingFlag == Base64EncodingFlag_HtmlEmbeddedImage) {
+		memcpy(output + outLen, "\" />", CSTRLEN("\" />"));
+		outLen += CSTRLEN("\" />");
 	}
 
-	Sci_Position iCommentCol = 0;
-	if ((commentFlag & AutoInsertMask_CommentAtStart) == 0) {
-		iCommentCol = 1024 - 1 - cchComment;
-		for (Sci_Line iLine = iLineStart; iLine <= iLineEnd; iLine++) {
-			const Sci_Position iLineEndPos = SciCall_GetLineEndPosition(iLine);
-			const Sci_Position iLineIndentPos = SciCall_GetLineIndentPosition(iLine);
+	EditReplaceRange(iSelStart, iSelStart + iSelByte, outLen, output);
+	NP2HeapFree(output);
+}
 
-			if (iLineIndentPos != iLineEndPos) {
-				const Sci_Position iIndentColumn = SciCall_GetColumn(iLineIndentPos);
-				iCommentCol = min(iCommentCol, iIndentColumn);
-			}
-		}
+void EditBase64Decode(bool decodeAsHex) noexcept {
+	if (SciCall_IsSelectionEmpty()) {
+		return;
+	}
+	if (SciCall_IsRectangularSelection()){
+		NotifyRectangularSelection();
+		return;
 	}
 
-	enum CommentAction {
-		CommentAction_None,
-		CommentAction_Add,
-		CommentAction_Delete,
-	} iAction = CommentAction_None;
-
-	SciCall_BeginUndoAction();
-	for (Sci_Line iLine = iLineStart; iLine <= iLineEnd; iLine++) {
-		const Sci_Position iIndentPos = SciCall_GetLineIndentPosition(iLine);
-		const Sci_Position iLineEndPos = SciCall_GetLineEndPosition(iLine);
-
-		char tchBuf[32] = "";
-		const Sci_TextRangeFull tr = { { iIndentPos, min(iIndentPos + 31, iLineEndPos) }, tchBuf };
-		SciCall_GetTextRangeFull(&tr);
-
-		if (_strnicmp(tchBuf, mszComment, cchComment) == 0 && (commentEnd != ' ' || static_cast<uint8_t>(tchBuf[cchComment]) <= ' ')) {
-			switch (iAction) {
-			case CommentAction_None:
-				iAction = CommentAction_Delete;
-				[[fallthrough]];
-				// fall through
-			case CommentAction_Delete: {
-				Sci_Position iCommentPos = iIndentPos;
-				Sci_Position iEndPos = iIndentPos + cchComment;
-				// a line with [space/tab] comment only
-				if (commentPad == ' ' && tchBuf[cchComment] == ' ') {
-					// TODO: detect indentation space and alignment space
-					++iEndPos;
-				}
-				if (iEndPos == iLineEndPos) {
-					iCommentPos = SciCall_PositionFromLine(iLine);
-				}
-				SciCall_DeleteRange(iCommentPos, iEndPos - iCommentPos);
-			} break;
-			case CommentAction_Add: {
-				const Sci_Position iCommentPos = SciCall_FindColumn(iLine, iCommentCol);
-				if (iCommentPos != iIndentPos) {
-					mszComment[cchComment] = commentPad;
-					SciCall_InsertText(iCommentPos, mszComment);
-				}
-			} break;
+	const Sci_Position iSelStart = SciCall_GetSelectionStart();
+	const size_t iSelByte = SciCall_GetSelectionEnd() - iSelStart;
+	size_t outLen = (iSelByte*3)/4 + 4;
+	uint8_t *output = static_cast<uint8_t *>(NP2HeapAlloc(outLen));
+	if (output == nullptr) {
+		return;
+	}
+	const uint8_t *input = reinterpret_cast<const uint8_t *>(SciCall_GetRangePointer(iSelStart, iSelByte));
+	outLen = Base64Decode(output, input, iSelByte);
+	if (outLen != 0) {
+		if(decodeAsHex) {
+			const int iEOLMode = SciCall_GetEOLMode();
+			char *pszOut = static_cast<char *>(NP2HeapAlloc(outLen*3 + outLen/8 + 1));
+			if (pszOut == nullptr) {
+				NP2HeapFree(output);
+				return;
 			}
-		} else {
-			switch (iAction) {
-			case CommentAction_None:
-				iAction = CommentAction_Add;
-				[[fallthrough]];
-				// fall through
-			case CommentAction_Add: {
-				const Sci_Position iCommentPos = SciCall_FindColumn(iLine, iCommentCol);
-				if (iCommentCol == 0 || iLineStart == iLineEnd || iIndentPos != iLineEndPos) {
-					mszComment[cchComment] = (iCommentPos == iLineEndPos) ? '\0' : commentPad;
-					SciCall_InsertText(iCommentPos, mszComment);
-				} else {
-					char tchComment[1024] = "";
-					Sci_Position tab = 0;
-					Sci_Position count = iCommentCol;
-					if (!fvCurFile.bTabsAsSpaces) {
-						const int tabWidth = fvCurFile.iTabWidth;
-						tab = count / tabWidth;
-						count %= tabWidth;
-						memset(tchComment, '\t', tab);
+			char *t = pszOut;
+			size_t i = 0;
+			do {
+				// 16 bytes per line
+				const size_t count = min<size_t>(outLen - i, 16);
+				t += BytesToHex(t, output + i, count);
+				--t;
+				i += count;
+				if (count == 16) {
+					switch (iEOLMode) {
+					default: // SC_EOL_CRLF
+						*t++ = '\r';
+						*t++ = '\n';
+						break;
+					case SC_EOL_LF:
+						*t++ = '\n';
+						break;
+					case SC_EOL_CR:
+						*t++ = '\r';
+						break;
 					}
-					memset(tchComment + tab, ' ', count);
-					memcpy(tchComment + tab + count, mszComment, cchComment);
-					SciCall_InsertText(iCommentPos, tchComment);
 				}
-			} break;
-			case CommentAction_Delete:
-				break;
-			}
-		}
-	}
-
-	SciCall_EndUndoAction();
-	if (iSelStart != iSelEnd) {
-		Sci_Position iAnchorPos;
-		if (iCurPos == iSelStart) {
-			iCurPos = iLineStart;
-			iAnchorPos = iLineEnd + 1;
-		} else {
-			iAnchorPos = iLineStart;
-			iCurPos = iLineEnd + 1;
+			} while (i < outLen);
+			outLen = t - pszOut;
+			NP2HeapFree(output);
+			output = reinterpret_cast<uint8_t *>(pszOut);
 		}
-		iAnchorPos = SciCall_PositionFromLine(iAnchorPos);
-		iCurPos = SciCall_PositionFromLine(iCurPos);
-		SciCall_SetSel(iAnchorPos, iCurPos);
+		EditReplaceRange(iSelStart, iSelStart + iSelByte, outLen, reinterpret_cast<char *>(output));
 	}
-
-	EndWaitCursor();
+	NP2HeapFree(output);
 }
 
 //=============================================================================
 //
-// EditPadWithSpaces()
+// EditConvertNumRadix()
 //
-void EditPadWithSpaces(bool bSkipEmpty, bool bNoUndoGroup) noexcept {
-	Sci_Position iMaxColumn = 0;
-	bool bReducedSelection = false;
-
-	Sci_Position iSelStart = 0;
-	Sci_Position iSelEnd = 0;
+static int ConvertNumRadix(char *tch, uint64_t num, int radix) noexcept {
+	switch (radix) {
+	case 16:
+		return sprintf(tch, "0x%" PRIx64, num);
 
-	Sci_Line iLineStart = 0;
-	Sci_Line iLineEnd = 0;
+	case 10:
+		return sprintf(tch, "%" PRIu64, num);
 
-	Sci_Line iRcCurLine = 0;
-	Sci_Line iRcAnchorLine = 0;
-	Sci_Position iRcCurCol = 0;
-	Sci_Position iRcAnchorCol = 0;
+	case 8: {
+		char buf[2 + 22 + 1] = "";
+		int index = 2 + 22;
+		int length = 0;
+		while (num) {
+			const int bit = static_cast<int>(num & 7);
+			num >>= 3;
+			buf[index--] = static_cast<char>('0' + bit);
+			++length;
+		}
+		if (length == 0) {
+			buf[index--] = '0';
+			++length;
+		}
+		buf[index--] = 'O';
+		buf[index] = '0';
+		length += 2;
+		strcat(tch, buf + index);
+		return length;
+	}
+	break;
 
-	const bool bIsRectangular = SciCall_IsRectangularSelection();
-	if (!bIsRectangular ) {
-		iSelStart = SciCall_GetSelectionStart();
-		iSelEnd = SciCall_GetSelectionEnd();
-
-		iLineStart = SciCall_LineFromPosition(iSelStart);
-		iLineEnd = SciCall_LineFromPosition(iSelEnd);
-
-		if (iLineStart == iLineEnd) {
-			iLineStart = 0;
-			iLineEnd = SciCall_GetLineCount() - 1;
-		} else {
-			if (iSelEnd <= SciCall_PositionFromLine(iLineEnd)) {
-				if (iLineEnd - iLineStart >= 1) {
-					iLineEnd--;
-					bReducedSelection = true;
-				}
+	case 2: {
+		char buf[2 + 64 + 8 + 1] = "";
+		int index = 2 + 64 + 8;
+		int length = 0;
+		int bit_count = 0;
+		while (num) {
+			const int bit = static_cast<int>(num & 1);
+			num >>= 1;
+			buf[index--] = static_cast<char>('0' + bit);
+			++bit_count;
+			++length;
+			if (num && (bit_count & 7) == 0) {
+				buf[index--] = '_';
+				++length;
 			}
 		}
-
-		for (Sci_Line iLine = iLineStart; iLine <= iLineEnd; iLine++) {
-			const Sci_Position iPos = SciCall_GetLineEndPosition(iLine);
-			iMaxColumn = max(iMaxColumn, SciCall_GetColumn(iPos));
+		if (length == 0) {
+			buf[index--] = '0';
+			++length;
 		}
-	} else {
-		const Sci_Position iCurPos = SciCall_GetCurrentPos();
-		const Sci_Position iAnchorPos = SciCall_GetAnchor();
+		buf[index--] = 'b';
+		buf[index] = '0';
+		length += 2;
+		strcat(tch, buf + index);
+		return length;
+	}
+	break;
 
-		iRcCurLine = SciCall_LineFromPosition(iCurPos);
-		iRcAnchorLine = SciCall_LineFromPosition(iAnchorPos);
+	}
+	return 0;
+}
 
-		iRcCurCol = SciCall_GetColumn(iCurPos);
-		iRcAnchorCol = SciCall_GetColumn(iAnchorPos);
+void EditConvertNumRadix(int radix) noexcept {
+	Sci_Position iSelCount = SciCall_GetSelTextLength();
+	if (iSelCount == 0) {
+		return;
+	}
+	if (SciCall_IsRectangularSelection()) {
+		NotifyRectangularSelection();
+		return;
+	}
 
-		iLineStart = 0;
-		iLineEnd = SciCall_GetLineCount() - 1;
+	static_assert(IDM_EDIT_NUM2DEC - IDM_EDIT_NUM2BIN == 1);
+	static_assert(IDM_EDIT_NUM2OCT - IDM_EDIT_NUM2BIN == 2);
+	static_assert(IDM_EDIT_NUM2HEX - IDM_EDIT_NUM2BIN == 3);
+	radix -= IDM_EDIT_NUM2BIN;
+	radix = (radix == 1) ? 10 : (2 << radix);
 
-		for (Sci_Line iLine = iLineStart; iLine <= iLineEnd; iLine++) {
-			const Sci_Position iPos = SciCall_GetLineSelEndPosition(iLine);
-			if (iPos >= 0) {
-				iMaxColumn = max(iMaxColumn, SciCall_GetColumn(iPos));
-			}
-		}
-	}
+	iSelCount = NP2_align_up(iSelCount + 1, MEMORY_ALLOCATION_ALIGNMENT);
+	const size_t outLen = (iSelCount*5) + 16; // 0xFF => 0b1111_1111
+	char * const pszText = static_cast<char *>(NP2HeapAlloc(iSelCount + outLen));
+	char * const pszOut = pszText + iSelCount;
+	Sci_Position cch = 0;
+	const char *p = pszText;
+	uint64_t value = 0;
 
-	char *pmszPadStr = static_cast<char *>(NP2HeapAlloc((iMaxColumn + 1) * sizeof(char)));
-	if (pmszPadStr) {
-		memset(pmszPadStr, ' ', iMaxColumn);
-		if (!bNoUndoGroup) {
-			SciCall_BeginUndoAction();
-		}
+	SciCall_GetSelText(pszText);
 
-		for (Sci_Line iLine = iLineStart; iLine <= iLineEnd; iLine++) {
-			const Sci_Position iLineSelEndPos = SciCall_GetLineSelEndPosition(iLine);
-			if (bIsRectangular && iLineSelEndPos < 0) {
-				continue;
+	while (*p) {
+		if (*p == '0') {
+			value = 0;
+			p++;
+			const char prefix = UnsafeLower(*p);
+			if (prefix == 'x' && radix != 16) {
+				p++;
+				while (*p) {
+					if (*p == '_') {
+						p++;
+					} else {
+						const int hex = GetHexDigit(*p);
+						if (hex < 0) {
+							break;
+						}
+						value = (value << 4) | hex;
+						p++;
+					}
+				}
+				cch += ConvertNumRadix(pszOut + cch, value, radix);
+			} else if (prefix == 'o' && radix != 8) {
+				p++;
+				while (*p) {
+					if (*p >= '0' && *p <= '7') {
+						value <<= 3;
+						value += (*p++ - '0');
+					} else if (*p == '_') {
+						p++;
+					} else {
+						break;
+					}
+				}
+				cch += ConvertNumRadix(pszOut + cch, value, radix);
+			} else if (prefix == 'b' && radix != 2) {
+				p++;
+				while (*p) {
+					if (*p == '0') {
+						value <<= 1;
+						p++;
+					} else if (*p == '1') {
+						value <<= 1;
+						value |= 1;
+						p++;
+					} else if (*p == '_') {
+						p++;
+					} else {
+						break;
+					}
+				}
+				cch += ConvertNumRadix(pszOut + cch, value, radix);
+			} else if ((*p >= '0' && *p <= '9') && radix != 10) {
+				value = *p++ - '0';
+				while (*p) {
+					if (*p >= '0' && *p <= '9') {
+						value *= 10;
+						value += (*p++ - '0');
+					} else if (*p == '_') {
+						p++;
+					} else {
+						break;
+					}
+				}
+				cch += ConvertNumRadix(pszOut + cch, value, radix);
+			} else {
+				pszOut[cch++] = '0';
 			}
-
-			const Sci_Position iPos = SciCall_GetLineEndPosition(iLine);
-			if (bIsRectangular && iPos > iLineSelEndPos) {
-				continue;
+		} else if ((*p >= '1' && *p <= '9') && radix != 10) {
+			value = *p++ - '0';
+			while (*p) {
+				if (*p >= '0' && *p <= '9') {
+					value *= 10;
+					value += (*p++ - '0');
+				} else if (*p == '_') {
+					p++;
+				} else {
+					break;
+				}
 			}
-
-			if (bSkipEmpty && SciCall_PositionFromLine(iLine) >= iPos) {
-				continue;
+			cch += ConvertNumRadix(pszOut + cch, value, radix);
+		} else if (IsAlphaNumeric(*p) || *p == '_') {
+			// radix and number prefix matches, no conversion
+			pszOut[cch++] = *p++;
+			while (IsAlphaNumeric(*p) || *p == '_') {
+				pszOut[cch++] = *p++;
 			}
-
-			const Sci_Position iPadLen = iMaxColumn - SciCall_GetColumn(iPos);
-
-			SciCall_SetTargetRange(iPos, iPos);
-			SciCall_ReplaceTarget(iPadLen, pmszPadStr);
-		}
-
-		NP2HeapFree(pmszPadStr);
-		if (!bNoUndoGroup) {
-			SciCall_EndUndoAction();
-		}
-	}
-
-	if (!bIsRectangular && SciCall_LineFromPosition(iSelStart) != SciCall_LineFromPosition(iSelEnd)) {
-		Sci_Position iCurPos = SciCall_GetCurrentPos();
-		Sci_Position iAnchorPos = SciCall_GetAnchor();
-		iRcCurCol = SciCall_PositionFromLine(iLineStart);
-		if (!bReducedSelection) {
-			iRcAnchorCol = SciCall_GetLineEndPosition(iLineEnd);
-		} else {
-			iRcAnchorCol = SciCall_PositionFromLine(iLineEnd + 1);
-		}
-		if (iCurPos < iAnchorPos) {
-			iCurPos = iRcCurCol;
-			iAnchorPos = iRcAnchorCol;
 		} else {
-			iAnchorPos = iRcCurCol;
-			iCurPos = iRcAnchorCol;
+			pszOut[cch++] = *p++;
 		}
-		SciCall_SetSel(iAnchorPos, iCurPos);
-	} else if (bIsRectangular) {
-		const Sci_Position iCurPos = SciCall_FindColumn(iRcCurLine, iRcCurCol);
-		const Sci_Position iAnchorPos = SciCall_FindColumn(iRcAnchorLine, iRcAnchorCol);
-
-		SciCall_SetRectangularSelectionCaret(iCurPos);
-		SciCall_SetRectangularSelectionAnchor(iAnchorPos);
 	}
+	pszOut[cch] = '\0';
+
+	EditReplaceMainSelection(cch, pszOut);
+	NP2HeapFree(pszText);
 }
 
 //=============================================================================
 //
-// EditStripFirstCharacter()
+// EditModifyNumber()
 //
-void EditStripFirstCharacter() noexcept {
+void EditModifyNumber(bool bIncrease) {
+	const Sci_Position iSelCount = SciCall_GetSelTextLength();
+	if (iSelCount == 0) {
+		return;
+	}
 	if (SciCall_IsRectangularSelection()) {
 		NotifyRectangularSelection();
 		return;
 	}
 
-	const Sci_Position iSelStart = SciCall_GetSelectionStart();
-	const Sci_Position iSelEnd = SciCall_GetSelectionEnd();
+	if (iSelCount < 32) {
+		char chNumber[32] = "";
+		SciCall_GetSelText(chNumber);
 
-	Sci_Line iLineStart = SciCall_LineFromPosition(iSelStart);
-	Sci_Line iLineEnd = SciCall_LineFromPosition(iSelEnd);
+		const char *ptr = strpbrk(chNumber, "xX");
+		const int radix = (ptr != nullptr) ? 16 : 10;
+		char *end;
+		unsigned iNumber = strtoul(chNumber, &end, radix);
+		if (end == chNumber) {
+			return;
+		}
 
-	if (iLineStart != iLineEnd) {
-		if (iSelStart > SciCall_PositionFromLine(iLineStart)) {
-			iLineStart++;
+		if (bIncrease && iNumber < UINT_MAX) {
+			iNumber++;
+		} else if (!bIncrease && iNumber > 0) {
+			iNumber--;
 		}
 
-		if (iSelEnd <= SciCall_PositionFromLine(iLineEnd)) {
-			iLineEnd--;
+		int iWidth = static_cast<int>(strlen(chNumber)) - ((ptr != nullptr) ? 2 : 0);
+		if (ptr != nullptr) {
+			if (*ptr == 'X') {
+				iWidth = sprintf(chNumber, "%#0*X", iWidth, iNumber);
+			} else {
+				iWidth = sprintf(chNumber, "%#0*x", iWidth, iNumber);
+			}
+		} else {
+			iWidth = sprintf(chNumber, "%0*u", iWidth, iNumber);
 		}
+		EditReplaceMainSelection(iWidth, chNumber);
 	}
-
-	SciCall_BeginUndoAction();
-	for (Sci_Line iLine = iLineStart; iLine <= iLineEnd; iLine++) {
-		const Sci_Position iPos = SciCall_PositionFromLine(iLine);
-		if (SciCall_GetLineEndPosition(iLine) > iPos) {
-			SciCall_DeleteRange(iPos, SciCall_PositionAfter(iPos) - iPos);
-		}
-	}
-	SciCall_EndUndoAction();
-}
+}
 
 //=============================================================================
 //
-// EditStripLastCharacter()
+// EditTransformLines()
 //
-void EditStripLastCharacter() noexcept {
-	if (SciCall_IsRectangularSelection()) {
-		NotifyRectangularSelection();
-		return;
-	}
+#define NP2_PARALLEL_TRANSFORM_MIN_SIZE	(4*1024*1024)
 
-	const Sci_Position iSelStart = SciCall_GetSelectionStart();
-	const Sci_Position iSelEnd = SciCall_GetSelectionEnd();
+namespace {
 
-	Sci_Line iLineStart = SciCall_LineFromPosition(iSelStart);
-	Sci_Line iLineEnd = SciCall_LineFromPosition(iSelEnd);
+struct EditLineTransform;
 
-	if (iLineStart != iLineEnd) {
-		if (iSelStart >= SciCall_GetLineEndPosition(iLineStart)) {
-			iLineStart++;
-		}
+struct LineTransformLine {
+	const char *text;		// line content without line ending
+	Sci_Position length;
+	const char *nextText;	// next line in the range, nullptr for last line
+	Sci_Position nextLength;
+	Sci_Line line;
+	Sci_Position skipped;	// leading bytes removed by kernel, used to map positions
+	Sci_Line counter;		// kernel state, only continuous for sequential transform
+};
 
-		if (iSelEnd < SciCall_GetLineEndPosition(iLineEnd)) {
-			iLineEnd--;
-		}
-	}
+// writes transformed line content into pszOut, returns output length,
+// or -1 to remove the line together with its line ending.
+typedef Sci_Position (*LineTransformKernel)(const EditLineTransform &transform, LineTransformLine &line, char *pszOut) noexcept;
+
+struct EditLineTransform {
+	LineTransformKernel kernel;
+	Sci_Position growth;		// maximum output bytes for each input byte, or for each growthChar
+	Sci_Position lineExtra;		// maximum bytes added to each line
+	char growthChar;
+	bool sequential;			// kernel uses counter, don't split the range
+	bool excludeEndLine;		// empty last line at document end is not in the range
+	bool option;
+	int tabWidth;
+	UINT dbcsCodePage;
+	bool utf8;
+	const void *param;
+	Sci_Position position[2];	// document positions (e.g. caret and anchor) mapped into output
+};
 
-	SciCall_BeginUndoAction();
-	for (Sci_Line iLine = iLineStart; iLine <= iLineEnd; iLine++) {
-		const Sci_Position iStartPos = SciCall_PositionFromLine(iLine);
-		const Sci_Position iEndPos = SciCall_GetLineEndPosition(iLine);
+struct LineTransformPart {
+	const EditLineTransform *transform;
+	const char *text;			// range text
+	Sci_Position start;			// offsets into range text, part starts at line start
+	Sci_Position end;
+	Sci_Position rangeEnd;
+	Sci_Line line;
+	bool emptyLastLine;			// range ends with empty last line of the document
+	bool lastPart;
+	const Sci_Position *position;	// relative to range start
+	char *output;
+	Sci_Position outLength;
+	Sci_Position mapped[2];		// relative to part output, -1 when not in the part
+};
 
-		if (iEndPos > iStartPos) {
-			const Sci_Position iPos = SciCall_PositionBefore(iEndPos);
-			SciCall_DeleteRange(iPos, iEndPos - iPos);
+// find first CR or LF, returns end when not found.
+const char *FindLineEnd(const char *ptr, const char *end) noexcept {
+#if NP2_USE_AVX2
+	const __m256i vectCR = _mm256_set1_epi8('\r');
+	const __m256i vectLF = _mm256_set1_epi8('\n');
+	while (ptr + sizeof(__m256i) <= end) {
+		const __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(ptr));
+		const uint32_t mask = mm256_movemask_epi8(_mm256_or_si256(_mm256_cmpeq_epi8(chunk, vectCR), _mm256_cmpeq_epi8(chunk, vectLF)));
+		if (mask != 0) {
+			return ptr + np2_ctz(mask);
 		}
+		ptr += sizeof(__m256i);
 	}
-	SciCall_EndUndoAction();
-}
-
-//=============================================================================
-//
-// EditStripTrailingBlanks()
-//
-void EditStripTrailingBlanks(HWND hwnd, bool bIgnoreSelection) noexcept {
-	// Check if there is any selection... simply use a regular expression replace!
-	if (!bIgnoreSelection && !SciCall_IsSelectionEmpty()) {
-		if (!SciCall_IsRectangularSelection()) {
-			EDITFINDREPLACE * const efrTrim = static_cast<EDITFINDREPLACE *>(NP2HeapAlloc(sizeof(EDITFINDREPLACE)));
-			efrTrim->hwnd = hwnd;
-			efrTrim->fuFlags = SCFIND_REGEXP;
-			memcpy(efrTrim->szFind, "[ \t]+$", CSTRLEN("[ \t]+$"));
-			EditReplaceAllInSelection(hwnd, efrTrim, EditReplaceAllFlag_UndoGroup);
-			NP2HeapFree(efrTrim);
-			return;
+#elif NP2_USE_SSE2
+	const __m128i vectCR = _mm_set1_epi8('\r');
+	const __m128i vectLF = _mm_set1_epi8('\n');
+	while (ptr + sizeof(__m128i) <= end) {
+		const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i *>(ptr));
+		const uint32_t mask = mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(chunk, vectCR), _mm_cmpeq_epi8(chunk, vectLF)));
+		if (mask != 0) {
+			return ptr + np2_ctz(mask);
 		}
+		ptr += sizeof(__m128i);
 	}
-
-	// Code from SciTE...
-	SciCall_BeginUndoAction();
-	const Sci_Line maxLines = SciCall_GetLineCount();
-	for (Sci_Line line = 0; line < maxLines; line++) {
-		const Sci_Position lineStart = SciCall_PositionFromLine(line);
-		const Sci_Position lineEnd = SciCall_GetLineEndPosition(line);
-		Sci_Position i = lineEnd;
-		while (i >= lineStart) {
-			i--;
-			const int ch = SciCall_GetCharAt(i);
-			if (!IsASpaceOrTab(ch)) {
-				break;
+#endif
+	while (ptr < end && *ptr != '\r' && *ptr != '\n') {
+		++ptr;
+	}
+	return ptr;
+}
+
+const char *SkipLineEnd(const char *ptr, const char *end) noexcept {
+	if (ptr < end && *ptr == '\r') {
+		++ptr;
+	}
+	if (ptr < end && *ptr == '\n') {
+		++ptr;
+	}
+	return ptr;
+}
+
+DWORD WINAPI EditTransformLinesThread(LPVOID lpParam) noexcept {
+	LineTransformPart &part = *static_cast<LineTransformPart *>(lpParam);
+	const EditLineTransform &transform = *part.transform;
+	const char * const text = part.text;
+	const char * const end = text + part.end;
+	const char * const rangeEnd = text + part.rangeEnd;
+	char *pszOut = part.output;
+
+	LineTransformLine line {};
+	line.line = part.line;
+	const char *ptr = text + part.start;
+	const char *lineEnd = FindLineEnd(ptr, rangeEnd);
+	while (ptr < end || (ptr == rangeEnd && part.emptyLastLine && part.lastPart)) {
+		const char * const next = SkipLineEnd(lineEnd, rangeEnd);
+		const char *nextLineEnd = nullptr;
+		line.text = ptr;
+		line.length = lineEnd - ptr;
+		line.nextText = nullptr;
+		line.nextLength = 0;
+		line.skipped = 0;
+		if (next < rangeEnd || (next == rangeEnd && next != ptr && part.emptyLastLine)) {
+			nextLineEnd = FindLineEnd(next, rangeEnd);
+			line.nextText = next;
+			line.nextLength = nextLineEnd - next;
+		}
+
+		const Sci_Position length = transform.kernel(transform, line, pszOut);
+		const Sci_Position lineStart = ptr - text;
+		for (UINT k = 0; k < 2; k++) {
+			const Sci_Position offset = part.position[k] - lineStart;
+			if (offset >= 0 && offset < next - ptr) {
+				Sci_Position mapped = pszOut - part.output;
+				if (length >= 0) {
+					mapped += (offset <= line.length) ? clamp<Sci_Position>(offset - line.skipped, 0, length) : (length + offset - line.length);
+				}
+				part.mapped[k] = mapped;
 			}
 		}
-		i++;
-		if (i < lineEnd) {
-			SciCall_DeleteRange(i, lineEnd - i);
+		if (length >= 0) {
+			pszOut += length;
+			memcpy(pszOut, lineEnd, next - lineEnd);
+			pszOut += next - lineEnd;
 		}
+
+		if (next == ptr) {
+			break; // empty last line
+		}
+		line.line++;
+		ptr = next;
+		lineEnd = nextLineEnd;
 	}
-	SciCall_EndUndoAction();
+	part.outLength = pszOut - part.output;
+	return 0;
 }
 
-//=============================================================================
-//
-// EditStripLeadingBlanks()
-//
-void EditStripLeadingBlanks(HWND hwnd, bool bIgnoreSelection) noexcept {
-	// Check if there is any selection... simply use a regular expression replace!
-	if (!bIgnoreSelection && !SciCall_IsSelectionEmpty()) {
-		if (!SciCall_IsRectangularSelection()) {
-			EDITFINDREPLACE * const efrTrim = static_cast<EDITFINDREPLACE *>(NP2HeapAlloc(sizeof(EDITFINDREPLACE)));
-			efrTrim->hwnd = hwnd;
-			efrTrim->fuFlags = SCFIND_REGEXP;
-			memcpy(efrTrim->szFind, "^[ \t]+", CSTRLEN("^[ \t]+"));
-			EditReplaceAllInSelection(hwnd, efrTrim, EditReplaceAllFlag_UndoGroup);
-			NP2HeapFree(efrTrim);
-			return;
-		}
+// transform lines started from iStartPos (line start) to before iEndPos into one buffer,
+// empty last line is included when iEndPos is document end unless excludeEndLine is set.
+// large range is split at line starts and transformed on worker threads.
+// output is allocated from the temporary arena, caller must hold a TempArenaScope.
+// returns nullptr when text is unchanged or out of memory.
+char *EditTransformLines(EditLineTransform &transform, Sci_Position iStartPos, Sci_Position iEndPos, Sci_Position &cchOut) noexcept {
+	const Sci_Position length = iEndPos - iStartPos;
+	UINT partCount = 1;
+	if (!transform.sequential) {
+		SYSTEM_INFO info;
+		GetSystemInfo(&info);
+		partCount = static_cast<UINT>(min<Sci_Position>(info.dwNumberOfProcessors, length / NP2_PARALLEL_TRANSFORM_MIN_SIZE));
+		partCount = clamp<UINT>(partCount, 1, MAX_PARALLEL_WORKER_COUNT);
+	}
+
+	const char * const pszText = SciCall_GetRangePointer(iStartPos, length);
+	const bool emptyLastLine = !transform.excludeEndLine && iEndPos == SciCall_GetLength()
+		&& SciCall_PositionFromLine(SciCall_LineFromPosition(iEndPos)) == iEndPos;
+	const Sci_Position position[2] = { transform.position[0] - iStartPos, transform.position[1] - iStartPos };
+	LineTransformPart parts[MAX_PARALLEL_WORKER_COUNT];
+	Sci_Position offsets[MAX_PARALLEL_WORKER_COUNT];
+	Sci_Position start = 0;
+	Sci_Position capacity = 0;
+	for (UINT i = 0; i < partCount; i++) {
+		const Sci_Line line = SciCall_LineFromPosition(iStartPos + start);
+		Sci_Position end = length;
+		if (i + 1 < partCount) {
+			end = SciCall_PositionFromLine(SciCall_LineFromPosition(iStartPos + length/partCount*(i + 1)) + 1) - iStartPos;
+			end = clamp(end, start, length);
+		}
+		Sci_Position size = (end - start)*transform.growth;
+		if (transform.growthChar != '\0') {
+			Sci_Position count = 0;
+			for (Sci_Position index = start; index < end; index++) {
+				count += pszText[index] == transform.growthChar;
+			}
+			size = (end - start) + count*(transform.growth - 1);
+		}
+		offsets[i] = capacity;
+		capacity += size + (SciCall_LineFromPosition(iStartPos + end) - line + 1)*transform.lineExtra;
+
+		LineTransformPart &part = parts[i];
+		part.transform = &transform;
+		part.text = pszText;
+		part.start = start;
+		part.end = end;
+		part.rangeEnd = length;
+		part.line = line;
+		part.emptyLastLine = emptyLastLine;
+		part.lastPart = i + 1 == partCount;
+		part.position = position;
+		part.outLength = 0;
+		part.mapped[0] = -1;
+		part.mapped[1] = -1;
+		start = end;
+	}
+
+	char * const pszOut = static_cast<char *>(TempArenaAlloc(capacity + 1));
+	if (pszOut == nullptr) {
+		return nullptr;
+	}
+	for (UINT i = 0; i < partCount; i++) {
+		parts[i].output = pszOut + offsets[i];
 	}
+	RunParallelWorker(EditTransformLinesThread, parts, sizeof(LineTransformPart), partCount);
 
-	// Code from SciTE...
-	SciCall_BeginUndoAction();
-	const Sci_Line maxLines = SciCall_GetLineCount();
-	for (Sci_Line line = 0; line < maxLines; line++) {
-		const Sci_Position lineStart = SciCall_PositionFromLine(line);
-		const Sci_Position lineEnd = SciCall_GetLineIndentPosition(line);
-		if (lineEnd > lineStart) {
-			SciCall_DeleteRange(lineStart, lineEnd - lineStart);
+	Sci_Position mapped[2] = { -1, -1 };
+	cchOut = 0;
+	for (UINT i = 0; i < partCount; i++) {
+		const LineTransformPart &part = parts[i];
+		for (UINT k = 0; k < 2; k++) {
+			if (part.mapped[k] >= 0) {
+				mapped[k] = cchOut + part.mapped[k];
+			}
 		}
+		if (part.output != pszOut + cchOut) {
+			memmove(pszOut + cchOut, part.output, part.outLength);
+		}
+		cchOut += part.outLength;
 	}
-	SciCall_EndUndoAction();
-}
 
-//=============================================================================
-//
-// EditCompressSpaces()
-//
-void EditCompressSpaces() noexcept {
-	if (SciCall_IsRectangularSelection()) {
-		NotifyRectangularSelection();
-		return;
+	if (cchOut == length && memcmp(pszOut, pszText, length) == 0) {
+		return nullptr;
 	}
-
-	Sci_Position iSelStart = SciCall_GetSelectionStart();
-	Sci_Position iSelEnd = SciCall_GetSelectionEnd();
-	const Sci_Position iLength = SciCall_GetLength();
-	Sci_Position iSelCount;
-	char *pszIn;
-	char chPrev = '\n';
-	char chNext = '\n';
-
-	if (iSelStart == iSelEnd) {
-		iSelStart = 0;
-		iSelEnd = iLength;
-		iSelCount = iLength;
-		pszIn = static_cast<char *>(NP2HeapAlloc(iSelCount + 2));
-		SciCall_GetText(iSelCount, pszIn);
-	} else {
-		iSelCount = SciCall_GetSelTextLength();
-		pszIn = static_cast<char *>(NP2HeapAlloc(iSelCount + 2));
-		SciCall_GetSelText(pszIn);
-		if (iSelEnd < iLength) {
-			chNext = static_cast<char>(SciCall_GetCharAt(iSelEnd));
-		}
-		if (iSelStart != 0) {
-			chPrev = static_cast<char>(SciCall_GetCharAt(iSelStart - 1));
+	for (UINT k = 0; k < 2; k++) {
+		if (position[k] >= length) {
+			transform.position[k] += cchOut - length;
+		} else if (mapped[k] >= 0) {
+			transform.position[k] = iStartPos + mapped[k];
 		}
 	}
+	return pszOut;
+}
 
-	pszIn[iSelCount] = chNext;
-	const char * const end = pszIn + iSelCount;
-	char *co = pszIn;
-	bool bModified = false;
-	for (const char *ci = pszIn; ci < end;) {
-		const char ch = *ci++;
-		if (ch != ' ' && ch != '\t') {
-			chPrev = ch;
-			*co++ = ch;
-		} else if (chPrev != '\n' && chPrev != '\r') {
-			while (ci < end && (*ci == ' ' || *ci == '\t')) {
-				++ci;
-			}
-			if (*ci != '\n' && *ci != '\r') {
-				chPrev = ' ';
-				*co++ = ' ';
-				if (ch == '\t') {
-					bModified = true;
+// UTF-16 code units in the character, DBCS trail byte is skipped.
+inline int LineTransformCharWidth(const EditLineTransform &transform, const char *text, Sci_Position &index, Sci_Position length) noexcept {
+	const uint8_t ch = text[index++];
+	if (transform.utf8) {
+		return (ch < 0x80 || ch >= 0xc0) + (ch >= 0xf0);
+	}
+	if (transform.dbcsCodePage != 0 && index < length && IsDBCSLeadByteEx(transform.dbcsCodePage, ch)) {
+		++index;
+	}
+	return 1;
+}
+
+// main Wide and Fullwidth blocks of UAX #11 East Asian Width
+constexpr bool IsEastAsianWideCharacter(uint32_t ch) noexcept {
+	return (ch >= 0x1100 && ch <= 0x115F)	// Hangul Jamo
+		|| (ch >= 0x2E80 && ch <= 0x303E)	// CJK Radicals Supplement .. CJK Symbols and Punctuation
+		|| (ch >= 0x3041 && ch <= 0x33FF)	// Hiragana .. CJK Compatibility
+		|| (ch >= 0x3400 && ch <= 0x4DBF)	// CJK Unified Ideographs Extension A
+		|| (ch >= 0x4E00 && ch <= 0xA4CF)	// CJK Unified Ideographs, Yi
+		|| (ch >= 0xA960 && ch <= 0xA97F)	// Hangul Jamo Extended-A
+		|| (ch >= 0xAC00 && ch <= 0xD7A3)	// Hangul Syllables
+		|| (ch >= 0xF900 && ch <= 0xFAFF)	// CJK Compatibility Ideographs
+		|| (ch >= 0xFE10 && ch <= 0xFE19)	// Vertical Forms
+		|| (ch >= 0xFE30 && ch <= 0xFE6F)	// CJK Compatibility Forms, Small Form Variants
+		|| (ch >= 0xFF00 && ch <= 0xFF60)	// Fullwidth Forms
+		|| (ch >= 0xFFE0 && ch <= 0xFFE6)
+		|| (ch >= 0x1F300 && ch <= 0x1F64F)	// Miscellaneous Symbols and Pictographs, Emoticons
+		|| (ch >= 0x1F900 && ch <= 0x1F9FF)	// Supplemental Symbols and Pictographs
+		|| (ch >= 0x20000 && ch <= 0x3FFFD);	// Supplementary and Tertiary Ideographic Plane
+}
+
+// display columns of the character, East Asian wide character and DBCS character take two columns.
+inline int LineTransformCharColumns(const EditLineTransform &transform, const char *text, Sci_Position &index, Sci_Position length) noexcept {
+	const uint8_t ch = text[index++];
+	if (ch < 0x80) {
+		return 1;
+	}
+	if (transform.utf8) {
+		if (ch >= 0xc2 && ch < 0xf5) {
+			const int trail = 1 + (ch >= 0xe0) + (ch >= 0xf0);
+			if (index + trail <= length) {
+				uint32_t character = ch & (0x3f >> trail);
+				int count = 0;
+				for (; count < trail; count++) {
+					const uint8_t next = text[index + count];
+					if ((next & 0xc0) != 0x80) {
+						break;
+					}
+					character = (character << 6) | (next & 0x3f);
+				}
+				if (count == trail) {
+					index += trail;
+					return IsEastAsianWideCharacter(character) ? 2 : 1;
 				}
 			}
 		}
+		return 1;
+	}
+	if (transform.dbcsCodePage != 0 && index < length && IsDBCSLeadByteEx(transform.dbcsCodePage, ch)) {
+		++index;
+		return 2;
 	}
+	return 1;
+}
 
-	if (bModified || co < end) {
-		*co = '\0';
-		iSelCount = co - pszIn;
-		EditReplaceRange(iSelStart, iSelEnd, iSelCount, pszIn);
+void InitLineTransform(EditLineTransform &transform, LineTransformKernel kernel) noexcept {
+	memset(&transform, 0, sizeof(EditLineTransform));
+	const UINT cpEdit = SciCall_GetCodePage();
+	transform.kernel = kernel;
+	transform.growth = 1;
+	transform.utf8 = cpEdit == CP_UTF8;
+	transform.dbcsCodePage = IsDBCSCodePage(cpEdit) ? cpEdit : 0;
+	transform.position[0] = SciCall_GetCurrentPos();
+	transform.position[1] = SciCall_GetAnchor();
+}
+
+// replace range with transformed text, returns false when text is unchanged.
+bool EditTransformRange(EditLineTransform &transform, Sci_Position iStartPos, Sci_Position iEndPos) noexcept {
+	const TempArenaScope arenaScope;
+	Sci_Position cchOut = 0;
+	char * const pszOut = EditTransformLines(transform, iStartPos, iEndPos, cchOut);
+	if (pszOut == nullptr) {
+		return false;
 	}
-	NP2HeapFree(pszIn);
+	SciCall_SetTargetRange(iStartPos, iEndPos);
+	SciCall_ReplaceTargetMinimal(cchOut, pszOut);
+	return true;
+}
+
 }
 
 //=============================================================================
 //
-// EditRemoveBlankLines()
+// EditTabsToSpaces()
 //
-void EditRemoveBlankLines(bool bMerge) noexcept {
-	if (SciCall_IsRectangularSelection()) {
-		NotifyRectangularSelection();
-		return;
-	}
-
-	Sci_Position iSelStart = SciCall_GetSelectionStart();
-	Sci_Position iSelEnd = SciCall_GetSelectionEnd();
-
-	if (iSelStart == iSelEnd) {
-		iSelStart = 0;
-		iSelEnd = SciCall_GetLength();
-	}
-
-	Sci_Line iLineStart = SciCall_LineFromPosition(iSelStart);
-	Sci_Line iLineEnd = SciCall_LineFromPosition(iSelEnd);
-
-	if (iSelStart > SciCall_PositionFromLine(iLineStart)) {
-		iLineStart++;
-	}
-
-	if (iSelEnd <= SciCall_PositionFromLine(iLineEnd) && iLineEnd != SciCall_GetLineCount() - 1) {
-		iLineEnd--;
+static Sci_Position TabsToSpacesKernel(const EditLineTransform &transform, LineTransformLine &line, char *pszOut) noexcept {
+	const char * const text = line.text;
+	const Sci_Position length = line.length;
+	if (memchr(text, '\t', length) == nullptr) {
+		memcpy(pszOut, text, length);
+		return length;
 	}
 
-	SciCall_BeginUndoAction();
-	for (Sci_Line iLine = iLineStart; iLine <= iLineEnd;) {
-		Sci_Line nBlanks = 0;
-		while (iLine + nBlanks <= iLineEnd && SciCall_GetLineIndentPosition(iLine + nBlanks) == SciCall_GetLineEndPosition(iLine + nBlanks)) {
-			nBlanks++;
-		}
-
-		if (nBlanks == 0 || (nBlanks == 1 && bMerge)) {
-			iLine += nBlanks + 1;
+	const int tabWidth = transform.tabWidth;
+	char *out = pszOut;
+	bool bIsLineStart = true;
+	int column = 0;
+	for (Sci_Position index = 0; index < length;) {
+		const char ch = text[index];
+		if (ch == '\t' && (!transform.option || bIsLineStart)) {
+			const int count = tabWidth - (column % tabWidth);
+			memset(out, ' ', count);
+			out += count;
+			column = 0;
+			++index;
 		} else {
-			if (bMerge) {
-				nBlanks--;
-			}
-
-			const Sci_Position iTargetStart = SciCall_PositionFromLine(iLine);
-			const Sci_Position iTargetEnd = SciCall_PositionFromLine(iLine + nBlanks);
-			SciCall_DeleteRange(iTargetStart, iTargetEnd - iTargetStart);
-
-			if (bMerge) {
-				iLine++;
+			if (ch != ' ') {
+				bIsLineStart = false;
 			}
-			iLineEnd -= nBlanks;
+			const Sci_Position begin = index;
+			column += LineTransformCharWidth(transform, text, index, length);
+			memcpy(out, text + begin, index - begin);
+			out += index - begin;
 		}
 	}
-	SciCall_EndUndoAction();
+	return out - pszOut;
 }
 
-//=============================================================================
-//
-// EditWrapToColumn()
-//
-void EditWrapToColumn(int nColumn/*, int nTabWidth*/) noexcept {
+void EditTabsToSpaces(int nTabWidth, bool bOnlyIndentingWS) noexcept {
 	if (SciCall_IsSelectionEmpty()) {
 		return;
 	}
@@ -3937,121 +5471,68 @@ void EditWrapToColumn(int nColumn/*, int nTabWidth*/) noexcept {
 	const Sci_Line iLine = SciCall_LineFromPosition(iSelStart);
 	iSelStart = SciCall_PositionFromLine(iLine);
 
-	const Sci_Position iSelCount = iSelEnd - iSelStart;
-	char *pszText = static_cast<char *>(NP2HeapAlloc(iSelCount + 1 + 2));
-	LPWSTR pszTextW = static_cast<LPWSTR>(NP2HeapAlloc((iSelCount + 1 + 2) * sizeof(WCHAR)));
-
-	const Sci_TextRangeFull tr = { { iSelStart, iSelEnd }, pszText };
-	SciCall_GetTextRangeFull(&tr);
-
-	const UINT cpEdit = SciCall_GetCodePage();
-	const int cchTextW = MultiByteToWideChar(cpEdit, 0, pszText, static_cast<int>(iSelCount), pszTextW, static_cast<int>(NP2HeapSize(pszTextW) / sizeof(WCHAR)));
-	NP2HeapFree(pszText);
-
-	LPWSTR pszConvW = static_cast<LPWSTR>(NP2HeapAlloc(cchTextW * sizeof(WCHAR) * 3 + 2));
-
-	const unsigned iEOLMode = SciCall_GetEOLMode();
-	unsigned wszEOL = '\r' | ('\n' << 16);
-	wszEOL >>= 16*(iEOLMode >> 1);
-
-#define ISDELIMITER(wc) StrChr(L",;.:-+%&\xA6|/*?!\"\'~\xB4#=", wc)
-#define ISWHITE(wc)		IsASpaceOrTab(wc)
-#define ISWORDEND(wc)	(/*ISDELIMITER(wc) ||*/ IsASpace(wc))
+	EditLineTransform transform;
+	InitLineTransform(transform, TabsToSpacesKernel);
+	transform.growth = nTabWidth;
+	transform.growthChar = '\t';
+	transform.option = bOnlyIndentingWS;
+	transform.tabWidth = nTabWidth;
+	const TempArenaScope arenaScope;
+	Sci_Position cchText = 0;
+	char * const pszText = EditTransformLines(transform, iSelStart, iSelEnd, cchText);
+	if (pszText != nullptr) {
+		EditReplaceRange(iSelStart, iSelEnd, cchText, pszText);
+	}
+}
 
-	int cchConvW = 0;
-	int iLineLength = 0;
-	bool bModified = false;
-	for (int iTextW = 0; iTextW < cchTextW; iTextW++) {
-		const WCHAR w = pszTextW[iTextW];
-
-		//if (ISDELIMITER(w)) {
-		//	int iNextWordLen = 0;
-		//	WCHAR w2 = pszTextW[iTextW + 1];
-		//
-		//	if (iLineLength + iNextWordLen + 1 > nColumn) {
-		//		memcpy(pszConvW + cchConvW, &wszEOL, 2*sizeof(WCHAR));
-		//		cchConvW += (iEOLMode == SC_EOL_CRLF) ? 2 : 1;
-		//		iLineLength = 0;
-		//		bModified = true;
-		//	}
-		//
-		//	while (w2 != L'\0' && !ISWORDEND(w2)) {
-		//		iNextWordLen++;
-		//		w2 = pszTextW[iTextW + iNextWordLen + 1];
-		//	}
-		//
-		//	if (ISDELIMITER(w2) && iNextWordLen > 0) // delimiters go with the word
-		//		iNextWordLen++;
-		//
-		//	pszConvW[cchConvW++] = w;
-		//	iLineLength++;
-		//
-		//	if (iNextWordLen > 0) {
-		//		if (iLineLength + iNextWordLen + 1 > nColumn) {
-		//			memcpy(pszConvW + cchConvW, &wszEOL, 2*sizeof(WCHAR));
-		//			cchConvW += (iEOLMode == SC_EOL_CRLF) ? 2 : 1;
-		//			iLineLength = 0;
-		//			bModified = true;
-		//		}
-		//	}
-		//}
-
-		if (ISWHITE(w)) {
-			while (IsASpaceOrTab(pszTextW[iTextW + 1])) {
-				iTextW++;
-				bModified = true;
-			} // Modified: left out some whitespaces
-
-			WCHAR w2 = pszTextW[iTextW + 1];
-			int iNextWordLen = 0;
-
-			while (w2 != L'\0' && !ISWORDEND(w2)) {
-				iNextWordLen++;
-				w2 = pszTextW[iTextW + iNextWordLen + 1];
-			}
-
-			//if (ISDELIMITER(w2) /*&& iNextWordLen > 0*/) // delimiters go with the word
-			//	iNextWordLen++;
-			if (iNextWordLen > 0) {
-				if (iLineLength + iNextWordLen + 1 > nColumn) {
-					memcpy(pszConvW + cchConvW, &wszEOL, 2*sizeof(WCHAR));
-					cchConvW += (iEOLMode == SC_EOL_CRLF) ? 2 : 1;
-					iLineLength = 0;
-					bModified = true;
+//=============================================================================
+//
+// EditSpacesToTabs()
+//
+static Sci_Position SpacesToTabsKernel(const EditLineTransform &transform, LineTransformLine &line, char *pszOut) noexcept {
+	const char * const text = line.text;
+	const Sci_Position length = line.length;
+	const int tabWidth = transform.tabWidth;
+	char *out = pszOut;
+	bool bIsLineStart = true;
+	int column = 0;
+	int spaceCount = 0;
+	Sci_Position spaceStart = 0;
+	for (Sci_Position index = 0; index < length;) {
+		const char ch = text[index];
+		if ((ch == ' ' || ch == '\t') && (!transform.option || bIsLineStart)) {
+			if (spaceCount == 0) {
+				spaceStart = index;
+			}
+			++spaceCount;
+			++index;
+			if (spaceCount == tabWidth - (column % tabWidth) || ch == '\t') {
+				const char chNext = (index < length) ? text[index] : '\0';
+				if (spaceCount > 1 || chNext == ' ' || chNext == '\t') {
+					*out++ = '\t';
 				} else {
-					if (iLineLength > 0) {
-						pszConvW[cchConvW++] = L' ';
-						iLineLength++;
-					}
+					*out++ = ch;
 				}
+				column = spaceCount = 0;
 			}
 		} else {
-			pszConvW[cchConvW++] = w;
-			if (w == L'\r' || w == L'\n') {
-				iLineLength = 0;
-			} else {
-				iLineLength++;
-			}
+			column += spaceCount;
+			memcpy(out, text + spaceStart, spaceCount);
+			out += spaceCount;
+			spaceCount = 0;
+			bIsLineStart = false;
+			const Sci_Position begin = index;
+			column += LineTransformCharWidth(transform, text, index, length);
+			memcpy(out, text + begin, index - begin);
+			out += index - begin;
 		}
 	}
-
-	NP2HeapFree(pszTextW);
-
-	if (bModified) {
-		pszText = static_cast<char *>(NP2HeapAlloc(cchConvW * kMaxMultiByteCount));
-		const int cchText = WideCharToMultiByte(cpEdit, 0, pszConvW, cchConvW, pszText, static_cast<int>(NP2HeapSize(pszText)), nullptr, nullptr);
-		EditReplaceRange(iSelStart, iSelEnd, cchText, pszText);
-		NP2HeapFree(pszText);
-	}
-
-	NP2HeapFree(pszConvW);
+	memcpy(out, text + spaceStart, spaceCount);
+	out += spaceCount;
+	return out - pszOut;
 }
 
-//=============================================================================
-//
-// EditJoinLinesEx()
-//
-void EditJoinLinesEx() noexcept {
+void EditSpacesToTabs(int nTabWidth, bool bOnlyIndentingWS) noexcept {
 	if (SciCall_IsSelectionEmpty()) {
 		return;
 	}
@@ -4062,1784 +5543,5296 @@ void EditJoinLinesEx() noexcept {
 
 	Sci_Position iSelStart = SciCall_GetSelectionStart();
 	const Sci_Position iSelEnd = SciCall_GetSelectionEnd();
+
 	const Sci_Line iLine = SciCall_LineFromPosition(iSelStart);
 	iSelStart = SciCall_PositionFromLine(iLine);
 
-	const Sci_Position iSelCount = iSelEnd - iSelStart;
-	char *pszText = static_cast<char *>(NP2HeapAlloc(iSelCount + 1 + 2));
-	char *pszJoin = static_cast<char *>(NP2HeapAlloc(NP2HeapSize(pszText)));
-
-	const Sci_TextRangeFull tr = { { iSelStart, iSelEnd }, pszText };
-	SciCall_GetTextRangeFull(&tr);
+	EditLineTransform transform;
+	InitLineTransform(transform, SpacesToTabsKernel);
+	transform.option = bOnlyIndentingWS;
+	transform.tabWidth = nTabWidth;
+	const TempArenaScope arenaScope;
+	Sci_Position cchText = 0;
+	char * const pszText = EditTransformLines(transform, iSelStart, iSelEnd, cchText);
+	if (pszText != nullptr) {
+		EditReplaceRange(iSelStart, iSelEnd, cchText, pszText);
+	}
+}
 
-	const unsigned iEOLMode = SciCall_GetEOLMode();
-	unsigned szEOL = '\r' | ('\n' << 8);
-	szEOL >>= 8*(iEOLMode >> 1);
+//=============================================================================
+//
+// EditMoveUp()
+//
+void EditMoveUp() noexcept {
+	Sci_Position iCurPos = SciCall_GetCurrentPos();
+	Sci_Position iAnchorPos = SciCall_GetAnchor();
+	Sci_Line iCurLine = SciCall_LineFromPosition(iCurPos);
+	Sci_Line iAnchorLine = SciCall_LineFromPosition(iAnchorPos);
 
-	Sci_Position cchJoin = 0;
-	bool bModified = false;
-	for (Sci_Position i = 0; i < iSelCount; i++) {
-		if (IsEOLChar(pszText[i])) {
-			if (pszText[i] == '\r' && pszText[i + 1] == '\n') {
-				i++;
-			}
-			if (!IsEOLChar(pszText[i + 1]) && pszText[i + 1] != '\0') {
-				pszJoin[cchJoin++] = ' ';
-				bModified = true;
-			} else {
-				while (IsEOLChar(pszText[i + 1])) {
-					i++;
-					bModified = true;
-				}
-				if (pszText[i + 1] != '\0') {
-					if (cchJoin != 0) {
-						memcpy(pszJoin + cchJoin, &szEOL, 2);
-						cchJoin += (iEOLMode == SC_EOL_CRLF) ? 2 : 1;
-					}
-					memcpy(pszJoin + cchJoin, &szEOL, 2);
-					cchJoin += (iEOLMode == SC_EOL_CRLF) ? 2 : 1;
-				}
-			}
-		} else {
-			pszJoin[cchJoin++] = pszText[i];
+	if (iCurLine == iAnchorLine) {
+		if (iCurLine > 0) {
+			const Sci_Position iLineStart = SciCall_PositionFromLine(iCurLine);
+			const Sci_Position iLineCurPos = iCurPos - iLineStart;
+			const Sci_Position iLineAnchorPos = iAnchorPos - iLineStart;
+			SciCall_LineTranspose();
+			const Sci_Position iLineDestStart = SciCall_PositionFromLine(iCurLine - 1);
+			SciCall_SetSel(iLineDestStart + iLineAnchorPos, iLineDestStart + iLineCurPos);
+			SciCall_ChooseCaretX();
 		}
+		return;
 	}
 
-	NP2HeapFree(pszText);
+	const Sci_Line iLineSrc = min(iCurLine, iAnchorLine) - 1;
+	if (iLineSrc >= 0) {
+		Sci_Line iLineDest = max(iCurLine, iAnchorLine);
+		if (max(iCurPos, iAnchorPos) <= SciCall_PositionFromLine(iLineDest)) {
+			iLineDest--;
+		}
 
-	if (bModified) {
-		EditReplaceRange(iSelStart, iSelEnd, cchJoin, pszJoin);
-	}
+		SciCall_MoveSelectedLinesUp();
+		if (iCurPos < iAnchorPos) {
+			iCurLine = iCurLine - 1;
+			iAnchorLine = iLineDest;
+		} else {
+			iAnchorLine = iAnchorLine - 1;
+			iCurLine = iLineDest;
+		}
 
-	NP2HeapFree(pszJoin);
+		iAnchorPos = SciCall_PositionFromLine(iAnchorLine);
+		iCurPos = SciCall_PositionFromLine(iCurLine);
+		SciCall_SetSel(iAnchorPos, iCurPos);
+	}
 }
 
 //=============================================================================
 //
-// EditSortLines()
+// EditMoveDown()
 //
-namespace {
+void EditMoveDown() noexcept {
+	Sci_Position iCurPos = SciCall_GetCurrentPos();
+	Sci_Position iAnchorPos = SciCall_GetAnchor();
+	Sci_Line iCurLine = SciCall_LineFromPosition(iCurPos);
+	Sci_Line iAnchorLine = SciCall_LineFromPosition(iAnchorPos);
 
-struct SORTLINE {
-	LPCWSTR pwszLine;
-	LPCWSTR pwszSortEntry;
-	LPCWSTR pwszSortLine;
-	int iLine;
-	EditSortFlag iSortFlags;
-};
+	if (iCurLine == iAnchorLine) {
+		iCurLine += 1;
+		if (iCurLine < SciCall_GetLineCount()) {
+			const Sci_Position iLineStart = SciCall_PositionFromLine(iAnchorLine);
+			const Sci_Position iLineCurPos = iCurPos - iLineStart;
+			const Sci_Position iLineAnchorPos = iAnchorPos - iLineStart;
+			SciCall_GotoLine(iCurLine);
+			SciCall_LineTranspose();
+			const Sci_Position iLineDestStart = SciCall_PositionFromLine(iCurLine);
+			SciCall_SetSel(iLineDestStart + iLineAnchorPos, iLineDestStart + iLineCurPos);
+			SciCall_ChooseCaretX();
+		}
+		return;
+	}
 
-int __cdecl CmpSortLine(const void *p1, const void *p2) noexcept {
-	const SORTLINE *s1 = static_cast<const SORTLINE *>(p1);
-	const SORTLINE *s2 = static_cast<const SORTLINE *>(p2);
-	const EditSortFlag iSortFlags = s1->iSortFlags;
-	int cmp = 0;
-	if (iSortFlags & EditSortFlag_LogicalNumber) {
-		cmp = StrCmpLogicalW(s1->pwszSortEntry, s2->pwszSortEntry);
-		if (cmp == 0 && (iSortFlags & (EditSortFlag_ColumnSort | EditSortFlag_GroupByFileType))) {
-			cmp = StrCmpLogicalW(s1->pwszSortLine, s2->pwszSortLine);
+	Sci_Line iLineSrc = max(iCurLine, iAnchorLine) + 1;
+	if (max(iCurPos, iAnchorPos) <= SciCall_PositionFromLine(iLineSrc - 1)) {
+		iLineSrc--;
+	}
+
+	const Sci_Line iLineEnd = SciCall_GetLineCount() - 1;
+	if (iLineSrc <= iLineEnd) {
+		SciCall_MoveSelectedLinesDown();
+		if (iCurPos < iAnchorPos) {
+			iCurLine = iCurLine + 1;
+			iAnchorLine = iLineSrc + 1;
+		} else {
+			iAnchorLine = iAnchorLine + 1;
+			iCurLine = iLineSrc + 1;
 		}
+
+		iAnchorPos = SciCall_PositionFromLine(iAnchorLine);
+		iCurPos = SciCall_PositionFromLine(iCurLine);
+		SciCall_SetSel(iAnchorPos, iCurPos);
 	}
-	if (cmp == 0) {
-		cmp = wcscmp(s1->pwszSortEntry, s2->pwszSortEntry);
-		if (cmp == 0 && (iSortFlags & (EditSortFlag_ColumnSort | EditSortFlag_GroupByFileType))) {
-			cmp = wcscmp(s1->pwszSortLine, s2->pwszSortLine);
+}
+
+namespace {
+// only convert CR+LF
+void ConvertWinEditLineEndingsEx(char *s, int iEOLMode, int *lineCount) noexcept {
+	int count = 0;
+	if (iEOLMode != SC_EOL_CRLF) {
+		char *p = s;
+		const char chaEOL = (iEOLMode == SC_EOL_LF) ? '\n' : '\r';
+		while (*s) {
+			switch (*s) {
+			case '\r':
+				++count;
+				if (s[1] == '\n') {
+					++s;
+					*p++ = chaEOL;
+				} else {
+					*p++ = '\r';
+				}
+				++s;
+				break;
+
+			case '\n':
+				++count;
+				*p++ = '\n';
+				++s;
+				break;
+
+			default:
+				*p++ = *s++;
+				break;
+			}
 		}
-		if (cmp == 0) {
-			// stable sort for duplicate lines
-			cmp = s1->iLine - s2->iLine;
-			if (iSortFlags & EditSortFlag_MergeDuplicate) {
-				cmp = -cmp; // reverse order to keep first line
+
+		*p = '\0';
+		if (lineCount != nullptr) {
+			*lineCount = count;
+		}
+	} else if (lineCount != nullptr) {
+		while (*s) {
+			switch (*s++) {
+			case '\r':
+				++count;
+				if (*s == '\n') {
+					++s;
+				}
+				break;
+
+			case '\n':
+				++count;
+				break;
 			}
 		}
+		*lineCount = count;
 	}
-	if (iSortFlags & EditSortFlag_Descending) {
-		cmp = -cmp;
-	}
-	return cmp;
 }
 
-int __cdecl DontSortLine(const void *p1, const void *p2) noexcept {
-	const SORTLINE *s1 = static_cast<const SORTLINE *>(p1);
-	const SORTLINE *s2 = static_cast<const SORTLINE *>(p2);
-	return s1->iLine - s2->iLine;
+inline void ConvertWinEditLineEndings(char *s, int iEOLMode) noexcept {
+	ConvertWinEditLineEndingsEx(s, iEOLMode, nullptr);
 }
 
-}
+enum {
+	EditModifyLinesSubstitution_None = '\0',
+	EditModifyLinesSubstitution_LineNumber = 'L',
+	EditModifyLinesSubstitution_NumberOne = 'N',
+	EditModifyLinesSubstitution_NumberZero = 'I',
+};
 
-void EditSortLines(EditSortFlag iSortFlags) noexcept {
-	Sci_Position iCurPos = SciCall_GetCurrentPos();
-	Sci_Position iAnchorPos = SciCall_GetAnchor();
-	if (iCurPos == iAnchorPos) {
-		return;
+struct EditModifyLinesText {
+	int length;
+	int lineCount;
+	uint8_t substitution;
+	bool padZero;
+	int numWidth;
+	Sci_Line number;
+	int prefixLength;
+	int suffixLength;
+	char *mszPrefix;
+	const char *mszSuffix;
+	void Parse(LPCWSTR pszTextW, Sci_Line iLineStart, Sci_Line iLineEnd, UINT cpEdit, int iEOLMode) noexcept;
+	int Format(char *pszOut, Sci_Line iLine, Sci_Line index) const noexcept;
+	bool IsCounter() const noexcept {
+		return substitution == EditModifyLinesSubstitution_NumberOne || substitution == EditModifyLinesSubstitution_NumberZero;
 	}
+};
 
-	Sci_Line iRcCurLine = 0;
-	Sci_Line iRcAnchorLine = 0;
-	Sci_Position iRcCurCol = 0;
-	Sci_Position iRcAnchorCol = 0;
-
-	Sci_Position iSelStart = 0;
+struct EditModifyLinesParam {
+	const EditModifyLinesText *prefix;
+	const EditModifyLinesText *suffix;
 	Sci_Line iLineStart;
-	Sci_Line iLineEnd;
-	Sci_Position iSortColumn;
-
-	const bool bIsRectangular = SciCall_IsRectangularSelection();
-	if (bIsRectangular) {
-		iRcCurLine = SciCall_LineFromPosition(iCurPos);
-		iRcAnchorLine = SciCall_LineFromPosition(iAnchorPos);
-
-		iRcCurCol = SciCall_GetColumn(iCurPos);
-		iRcAnchorCol = SciCall_GetColumn(iAnchorPos);
-
-		iLineStart = min(iRcCurLine, iRcAnchorLine);
-		iLineEnd = max(iRcCurLine, iRcAnchorLine);
-		iSortColumn = min(iRcCurCol, iRcAnchorCol);
-	} else {
-		iSelStart = SciCall_GetSelectionStart();
-		const Sci_Position iSelEnd = SciCall_GetSelectionEnd();
+	bool skipEmptyLine;
+};
 
-		const Sci_Line iLine = SciCall_LineFromPosition(iSelStart);
-		iSelStart = SciCall_PositionFromLine(iLine);
+void EditModifyLinesText::Parse(LPCWSTR pszTextW, Sci_Line iLineStart, Sci_Line iLineEnd, UINT cpEdit, int iEOLMode) noexcept {
+	memset(this, 0, sizeof(EditModifyLinesText));
+	length = lstrlen(pszTextW);
+	if (length == 0) {
+		return;
+	}
 
-		iLineStart = SciCall_LineFromPosition(iSelStart);
-		iLineEnd = SciCall_LineFromPosition(iSelEnd);
+	length = length * kMaxMultiByteCount + 1;
+	mszPrefix = static_cast<char *>(NP2HeapAlloc(length));
+	WideCharToMultiByte(cpEdit, 0, pszTextW, -1, mszPrefix, length, nullptr, nullptr);
+	ConvertWinEditLineEndingsEx(mszPrefix, iEOLMode, &lineCount);
 
-		if (iSelEnd <= SciCall_PositionFromLine(iLineEnd)) {
-			iLineEnd--;
+	char *p = mszPrefix;
+	while ((p = strstr(p, "$(")) != nullptr) {
+		char * const back = p;
+		p += CSTRLEN("$(");
+		padZero = *p == '0';
+		if (padZero) {
+			p++;
 		}
+		if ((*p == 'L' || *p == 'N' || *p == 'I') && p[1] == ')') {
+			*back = '\0';
+			number = 0;
+			Sci_Line count;
+			substitution = *p;
+			if (substitution == EditModifyLinesSubstitution_LineNumber) {
+				count = iLineEnd + 1;
+			} else {
+				number = substitution == EditModifyLinesSubstitution_NumberOne;
+				count = iLineEnd - iLineStart + number;
+			}
+			numWidth = 1;
+			while (count >= 10) {
+				++numWidth;
+				count /= 10;
+			}
 
-		iSortColumn = SciCall_GetColumn(iCurPos);
+			mszSuffix = p + 2;
+			break;
+		}
 	}
+	prefixLength = static_cast<int>(strlen(mszPrefix));
+	suffixLength = (mszSuffix != nullptr) ? static_cast<int>(strlen(mszSuffix)) : 0;
+}
 
-	const Sci_Line iLineCount = iLineEnd - iLineStart + 1;
-	if (iLineCount < 2) {
-		return;
+// index is number of lines modified before current line
+int EditModifyLinesText::Format(char *pszOut, Sci_Line iLine, Sci_Line index) const noexcept {
+	memcpy(pszOut, mszPrefix, prefixLength);
+	int length = prefixLength;
+	if (substitution != EditModifyLinesSubstitution_None) {
+		const int width = numWidth;
+		const Sci_Line value = (substitution == EditModifyLinesSubstitution_LineNumber) ? iLine + 1 : number + index;
+#if defined(_WIN64)
+		if (padZero) {
+			length += sprintf(pszOut + length, "%0*" PRId64, width, value);
+		} else {
+			length += sprintf(pszOut + length, "%*" PRId64, width, value);
+		}
+#else
+		if (padZero) {
+			length += sprintf(pszOut + length, "%0*d", width, static_cast<int>(value));
+		} else {
+			length += sprintf(pszOut + length, "%*d", width, static_cast<int>(value));
+		}
+#endif
+		memcpy(pszOut + length, mszSuffix, suffixLength);
+		length += suffixLength;
 	}
+	return length;
+}
 
-	SciCall_BeginUndoAction();
-	if (bIsRectangular) {
-		EditPadWithSpaces(!(iSortFlags & EditSortFlag_Shuffle), true);
+Sci_Position ModifyLinesKernel(const EditLineTransform &transform, LineTransformLine &line, char *pszOut) noexcept {
+	const EditModifyLinesParam &param = *static_cast<const EditModifyLinesParam *>(transform.param);
+	const Sci_Position length = line.length;
+	if (param.skipEmptyLine && length == 0) {
+		return 0;
 	}
 
-	const UINT cpEdit = SciCall_GetCodePage();
-	Sci_Position iTargetStart = SciCall_PositionFromLine(iLineStart);
-	Sci_Position iTargetEnd = SciCall_PositionFromLine(iLineEnd + 1);
-	const size_t cbPmszBuf = iTargetEnd - iTargetStart + 2*iLineCount + 1; // 2 for CR LF
-	size_t cchTextW = cbPmszBuf*sizeof(WCHAR) + iLineCount*alignof(WCHAR *);
-	if (iSortFlags & EditSortFlag_IgnoreCase) {
-		cchTextW += cchTextW;
+	const Sci_Line index = param.skipEmptyLine ? line.counter++ : (line.line - param.iLineStart);
+	char *out = pszOut;
+	if (param.prefix->length != 0) {
+		out += param.prefix->Format(out, line.line, index);
 	}
-	char * const pmszBuf = static_cast<char *>(NP2HeapAlloc(cbPmszBuf));
-	SORTLINE * const pLines = static_cast<SORTLINE *>(NP2HeapAlloc(sizeof(SORTLINE) * iLineCount));
-	WCHAR * const pszTextW = static_cast<WCHAR *>(NP2HeapAlloc(cchTextW));
-	size_t cchTotal = alignof(WCHAR *)/sizeof(WCHAR); // first pointer reserved for empty line
+	memcpy(out, line.text, length);
+	out += length;
+	if (param.suffix->length != 0) {
+		out += param.suffix->Format(out, line.line, index);
+	}
+	return out - pszOut;
+}
 
-	for (Sci_Line i = 0, iLine = iLineStart; iLine <= iLineEnd; i++, iLine++) {
-		SciCall_GetLine(iLine, pmszBuf);
-		const Sci_Position cbLine = SciCall_GetLineLength(iLine);
+}
 
-		// remove EOL
-		char *p = pmszBuf + cbLine - 1;
-		if (*p == '\n' || *p == '\r') {
-			*p-- = '\0';
-		}
-		if (*p == '\r') {
-			*p-- = '\0';
+//=============================================================================
+//
+// EditModifyLines()
+//
+void EditModifyLines(LPCWSTR pwszPrefix, LPCWSTR pwszAppend, bool skipEmptyLine) noexcept {
+	if (SciCall_IsRectangularSelection()) {
+		NotifyRectangularSelection();
+		return;
+	}
+	if (StrIsEmpty(pwszPrefix) && StrIsEmpty(pwszAppend)) {
+		return;
+	}
+
+	BeginWaitCursor();
+
+	const UINT cpEdit = SciCall_GetCodePage();
+	const int iEOLMode = SciCall_GetEOLMode();
+	const Sci_Position iSelStart = SciCall_GetSelectionStart();
+	const Sci_Position iSelEnd = SciCall_GetSelectionEnd();
+	const Sci_Line iLineStart = SciCall_LineFromPosition(iSelStart);
+	Sci_Line iLineEnd = SciCall_LineFromPosition(iSelEnd);
+
+	//if (iSelStart > SciCall_PositionFromLine(iLineStart)) {
+	//	iLineStart++;
+	//}
+
+	if (iSelEnd <= SciCall_PositionFromLine(iLineEnd)) {
+		if (iLineEnd - iLineStart >= 1) {
+			iLineEnd--;
 		}
+	}
 
-		if (p >= pmszBuf) {
-			LPWSTR pwszLine = pszTextW + cchTotal;
-			const UINT cchLine = MultiByteToWideChar(cpEdit, 0, pmszBuf, -1, pwszLine, static_cast<int>(cbPmszBuf));
-			cchTotal += NP2_align_up(cchLine, alignof(WCHAR *)/sizeof(WCHAR));
-			pLines[i].pwszLine = pwszLine;
-			if (iSortFlags & EditSortFlag_IgnoreCase) {
-				// convert to uppercase for case insensitive comparison
-				// https://learn.microsoft.com/en-us/dotnet/api/system.string.toupper?view=net-7.0#system-string-toupper
-				LPWSTR pwszSortLine = pszTextW + cchTotal;
-				const UINT charsConverted = LCMapStringEx(LOCALE_NAME_USER_DEFAULT, LCMAP_UPPERCASE, pwszLine, cchLine, pwszSortLine, static_cast<int>(cbPmszBuf), nullptr, nullptr, 0);
-				cchTotal += NP2_align_up(charsConverted, alignof(WCHAR *)/sizeof(WCHAR));
-				pwszLine = pwszSortLine;
-			}
+	EditModifyLinesText prefix;
+	EditModifyLinesText suffix;
+	prefix.Parse(pwszPrefix, iLineStart, iLineEnd, cpEdit, iEOLMode);
+	suffix.Parse(pwszAppend, iLineStart, iLineEnd, cpEdit, iEOLMode);
 
-			pLines[i].pwszSortLine = pwszLine;
-			if (iSortFlags & EditSortFlag_ColumnSort) {
-				const int tabWidth = fvCurFile.iTabWidth;
-				Sci_Position col = 0;
-				Sci_Position tabs = tabWidth;
-				while (*pwszLine) {
-					if (*pwszLine == L'\t') {
-						if (col + tabs <= iSortColumn) {
-							col += tabs;
-							tabs = tabWidth;
-							++pwszLine;
-						} else {
-							break;
-						}
-					} else if (col < iSortColumn) {
-						col++;
-						if (--tabs == 0) {
-							tabs = tabWidth;
-						}
-						pwszLine += 1 + IS_SURROGATE_PAIR(*pwszLine, pwszLine[1]);
-					} else {
-						break;
-					}
-				}
-			} else if (iSortFlags & EditSortFlag_GroupByFileType) {
-				pwszLine = PathFindExtension(pwszLine);
-			}
-			pLines[i].pwszSortEntry = pwszLine;
-			pLines[i].iLine = static_cast<int>(iLine);
-			pLines[i].iSortFlags = iSortFlags;
+	// build all modified lines into one buffer, then replace them as one block
+	const EditModifyLinesParam param = { &prefix, &suffix, iLineStart, skipEmptyLine };
+	EditLineTransform transform;
+	InitLineTransform(transform, ModifyLinesKernel);
+	transform.lineExtra = prefix.length + suffix.length + 64;
+	transform.sequential = skipEmptyLine && (prefix.IsCounter() || suffix.IsCounter());
+	transform.param = &param;
+	transform.excludeEndLine = iLineEnd + 1 < SciCall_GetLineCount();
+	EditTransformRange(transform, SciCall_PositionFromLine(iLineStart), SciCall_PositionFromLine(iLineEnd + 1));
+
+	//// Fix selection
+	//if (iSelStart != iSelEnd && SciCall_GetTargetEnd() > SciCall_GetSelectionEnd()) {
+	//	Sci_Position iCurPos = SciCall_GetCurrentPos();
+	//	Sci_Position iAnchorPos = SciCall_GetAnchor();
+	//	Sci_Position iTargetEnd = SciCall_GetTargetEnd();
+	//	if (iCurPos > iAnchorPos) {
+	//		iCurPos = iTargetEnd;
+	//	} else {
+	//		iAnchorPos = iTargetEnd;
+	//	}
+	//	SciCall_SetSel(iAnchorPos, iCurPos);
+	//}
+
+	// extend selection to start of first line
+	// the above code is not required when last line has been excluded
+	if (iSelStart != iSelEnd) {
+		Sci_Position iCurPos = SciCall_GetCurrentPos();
+		Sci_Position iAnchorPos = SciCall_GetAnchor();
+		if (iCurPos < iAnchorPos) {
+			iCurPos = iLineStart;
+			iAnchorPos = iLineEnd + 1;
 		} else {
-			pLines[i].pwszLine = pszTextW;
-			pLines[i].pwszSortEntry = pszTextW;
-			pLines[i].pwszSortLine = pszTextW;
-			pLines[i].iLine = static_cast<int>(iLine);
-			pLines[i].iSortFlags = iSortFlags;
+			iAnchorPos = iLineStart;
+			iCurPos = iLineEnd + 1;
 		}
+		iAnchorPos = SciCall_PositionFromLine(iAnchorPos);
+		iCurPos = SciCall_PositionFromLine(iCurPos);
+		SciCall_SetSel(iAnchorPos, iCurPos);
 	}
 
-	if (iSortFlags & EditSortFlag_Shuffle) {
-		// srand(GetTickCount());
-		uint32_t state = GetTickCount();
-		for (Sci_Line i = iLineCount - 1; i > 0; i--) {
-			// const Sci_Line j = rand() % i;
-			state = state*1103515245 + 12345; // see TestUtils.h
-			const Sci_Line j = ((state >> 16) & RAND_MAX) % i;
-			const SORTLINE sLine = pLines[i];
-			pLines[i] = pLines[j];
-			pLines[j] = sLine;
-		}
-	} else {
-		qsort(pLines, iLineCount, sizeof(SORTLINE), CmpSortLine);
-		if (iSortFlags > EditSortFlag_Shuffle) {
-			bool bLastDup = false;
-			for (Sci_Line i = 0; i < iLineCount; i++) {
-				BOOL bDropLine;
-				if (i + 1 < iLineCount && wcscmp(pLines[i].pwszSortLine, pLines[i + 1].pwszSortLine) == 0) {
-					bLastDup = true;
-					bDropLine = EditSortFlag_MergeDuplicate | EditSortFlag_RemoveDuplicate;
+	EndWaitCursor();
+	NP2HeapFree(prefix.mszPrefix);
+	NP2HeapFree(suffix.mszPrefix);
+}
+
+//=============================================================================
+//
+// CSV record and column index
+//
+// start position for every NP2_CSV_INDEX_STEP records (record may contain quoted line breaks)
+// and maximum field width for each column are built on background thread from document snapshot,
+// column commands use it to find record boundaries and column widths without rescanning the document.
+#define NP2_CSV_INDEX_STEP	64U		// records between two record index entries
+#define NP2_CSV_MAX_COLUMN	1024U	// columns with width tracked
+
+namespace {
+
+struct CsvDialect {
+	uint8_t delimiter;
+	uint8_t quoteChar;
+	bool backslashEscape;
+	bool mergeDelimiter;
+	bool utf8;
+	UINT dbcsCodePage;
+
+	void Init(int option, UINT cpEdit) noexcept {
+		delimiter = option & 0xff;
+		quoteChar = (option >> 8) & 0x7f;
+		backslashEscape = (option & CsvOption_BackslashEscape) != 0;
+		mergeDelimiter = (option & CsvOption_MergeDelimiter) != 0;
+		utf8 = cpEdit == CP_UTF8;
+		dbcsCodePage = IsDBCSCodePage(cpEdit) ? cpEdit : 0;
+	}
+	bool IsLeadByte(uint8_t ch) const noexcept {
+		return dbcsCodePage != 0 && IsDBCSLeadByteEx(dbcsCodePage, ch);
+	}
+};
+
+struct CsvField {
+	Sci_Position start;
+	Sci_Position end;		// before delimiter or line break
+};
+
+struct CsvRecord {
+	CsvField *fields;
+	UINT maxField;
+	UINT fieldCount;		// may be larger than maxField
+	bool multiline;
+	Sci_Position contentEnd;
+};
+
+struct CsvIndex {
+	BackgroundWorker worker;
+	Scintilla::IDocumentSnapshot *snapshot;
+	int option;
+	CsvDialect dialect;
+	Sci_Position *recordIndex;	// start position for record i*NP2_CSV_INDEX_STEP
+	volatile LONG indexCount;
+	volatile LONG indexDone;
+	// valid after indexDone is set
+	Sci_Position recordCount;
+	UINT columnCount;
+	bool multiline;				// some record contains quoted line break
+	UINT columnWidth[NP2_CSV_MAX_COLUMN];	// in characters, excludes multiline records
+};
+
+CsvIndex csvIndex;
+
+// scan one record from pos with same quoting rules as LexCSV, returns start of next record.
+Sci_Position CsvScanRecord(const char *text, Sci_Position pos, Sci_Position end, const CsvDialect &dialect, CsvRecord &record) noexcept {
+	const uint8_t delimiter = dialect.delimiter;
+	const uint8_t quoteChar = dialect.quoteChar;
+	uint8_t chPrev = 0;
+	uint8_t chPrevNonWhite = delimiter;
+	bool quoted = false;
+	UINT count = 0;
+	Sci_Position fieldStart = pos;
+	record.multiline = false;
+	record.contentEnd = end;
+	while (pos < end) {
+		const uint8_t ch = text[pos++];
+		if (quoted) {
+			if (ch == quoteChar) {
+				if (pos < end && static_cast<uint8_t>(text[pos]) == quoteChar) {
+					pos++;
 				} else {
-					bDropLine = bLastDup ? EditSortFlag_RemoveDuplicate : EditSortFlag_RemoveUnique;
-					bLastDup = false;
+					quoted = false;
 				}
-				if (iSortFlags & bDropLine) {
-					pLines[i].pwszLine = nullptr;
+			} else if (ch == '\r' || ch == '\n') {
+				pos += ch == '\r' && pos < end && text[pos] == '\n';
+				record.multiline = true;
+				chPrev = 0;
+				chPrevNonWhite = delimiter;
+				continue;
+			}
+		} else if (ch == '\r' || ch == '\n') {
+			record.contentEnd = pos - 1;
+			pos += ch == '\r' && pos < end && text[pos] == '\n';
+			break;
+		} else if (ch == delimiter) {
+			if (ch != chPrev || !dialect.mergeDelimiter) {
+				if (count < record.maxField) {
+					record.fields[count] = {fieldStart, pos - 1};
 				}
+				++count;
+			}
+			fieldStart = pos;
+		} else if (chPrevNonWhite == delimiter) {
+			if (ch == quoteChar) {
+				quoted = true;
+			} else if (ch == '=' && pos < end && static_cast<uint8_t>(text[pos]) == quoteChar) {
+				quoted = true;
+				pos++;
 			}
 		}
-		if (iSortFlags & EditSortFlag_DontSort) {
-			qsort(pLines, iLineCount, sizeof(SORTLINE), DontSortLine);
+
+		chPrev = ch;
+		if (ch > ' ') {
+			chPrevNonWhite = ch;
+			if (pos < end) {
+				if (ch == '\\' && dialect.backslashEscape) {
+					pos += text[pos] != '\r' && text[pos] != '\n';
+				} else if (dialect.IsLeadByte(ch)) {
+					pos++;
+				}
+			}
 		}
 	}
 
-	const unsigned iEOLMode = SciCall_GetEOLMode();
-	unsigned szEOL = '\r' | ('\n' << 8);
-	szEOL >>= 8*(iEOLMode >> 1);
+	if (count < record.maxField) {
+		record.fields[count] = {fieldStart, record.contentEnd};
+	}
+	record.fieldCount = count + 1;
+	return pos;
+}
 
-	char *pszOut = pmszBuf;
-	cchTotal = 0;
-	for (Sci_Line i = 0; i < iLineCount; i++) {
-		LPCWSTR pwszLine = pLines[i].pwszLine;
-		if (pwszLine) {
-			const UINT cbLine = WideCharToMultiByte(cpEdit, 0, pwszLine, -1, pszOut, static_cast<int>(cbPmszBuf), nullptr, nullptr);
-			cchTotal += cbLine - 1;
-			pszOut += cbLine - 1;
-			memcpy(pszOut, &szEOL, 2);
-			cchTotal += (iEOLMode == SC_EOL_CRLF) ? 2 : 1;
-			pszOut += (iEOLMode == SC_EOL_CRLF) ? 2 : 1;
+// field without surrounding spaces, returns width in characters.
+UINT CsvTrimField(const char *text, CsvField &field, const CsvDialect &dialect) noexcept {
+	Sci_Position start = field.start;
+	Sci_Position end = field.end;
+	while (start < end && IsASpaceOrTab(text[start])) {
+		++start;
+	}
+	while (end > start && IsASpaceOrTab(text[end - 1])) {
+		--end;
+	}
+	field = {start, end};
+	UINT width = static_cast<UINT>(end - start);
+	if (dialect.utf8) {
+		for (; start < end; start++) {
+			width -= (static_cast<uint8_t>(text[start]) & 0xc0) == 0x80;
 		}
 	}
-	if (cchTotal != 0) {
-		const Sci_Position iLineEndPos = SciCall_GetLineEndPosition(iLineEnd);
-		if (iLineEndPos == iTargetEnd) {
-			// no EOL on last line
-			cchTotal -= (iEOLMode == SC_EOL_CRLF) ? 2 : 1;
+	return width;
+}
+
+void CsvUpdateColumnWidth(const char *text, const CsvRecord &record, const CsvDialect &dialect, UINT *columnWidth) noexcept {
+	if (!record.multiline) {
+		const UINT count = min(record.fieldCount, record.maxField);
+		for (UINT i = 0; i < count; i++) {
+			CsvField field = record.fields[i];
+			const UINT width = CsvTrimField(text, field, dialect);
+			columnWidth[i] = max(columnWidth[i], width);
 		}
 	}
+}
 
-	NP2HeapFree(pLines);
-	NP2HeapFree(pszTextW);
-	SciCall_SetTargetRange(iTargetStart, iTargetEnd);
-	SciCall_ReplaceTarget(cchTotal, pmszBuf);
-	SciCall_EndUndoAction();
-	NP2HeapFree(pmszBuf);
+DWORD WINAPI EditCsvIndexThread(LPVOID lpParam) noexcept {
+	CsvIndex * const index = static_cast<CsvIndex *>(lpParam);
+	const char * const text = index->snapshot->Text();
+	const Sci_Position length = index->snapshot->Length();
+	CsvField *fields = static_cast<CsvField *>(NP2HeapAlloc(NP2_CSV_MAX_COLUMN * sizeof(CsvField)));
+	if (fields == nullptr) {
+		return 0;
+	}
 
-	if (!bIsRectangular) {
-		if (iAnchorPos > iCurPos) {
-			iCurPos = iSelStart;
-			iAnchorPos = iSelStart + cchTotal;
-		} else {
-			iAnchorPos = iSelStart;
-			iCurPos = iSelStart + cchTotal;
+	CsvRecord record;
+	record.fields = fields;
+	record.maxField = NP2_CSV_MAX_COLUMN;
+	Sci_Position pos = 0;
+	Sci_Position records = 0;
+	UINT columns = 0;
+	bool multiline = false;
+	while (pos < length) {
+		if ((records & (NP2_CSV_INDEX_STEP - 1)) == 0) {
+			if (!index->worker.Continue() || index->snapshot->IsStale()) {
+				NP2HeapFree(fields);
+				return 0;
+			}
+			const LONG count = static_cast<LONG>(records / NP2_CSV_INDEX_STEP);
+			index->recordIndex[count] = pos;
+			InterlockedExchange(&index->indexCount, count + 1);
 		}
-		SciCall_SetSel(iAnchorPos, iCurPos);
-	} else {
-		iTargetStart = SciCall_GetTargetStart();
-		iTargetEnd = SciCall_GetTargetEnd();
-		SciCall_ClearSelections();
-		if (iTargetStart != iTargetEnd) {
-			iTargetEnd -= (iEOLMode == SC_EOL_CRLF) ? 2 : 1;
-			iLineStart = SciCall_LineFromPosition(iTargetStart);
-			iLineEnd = SciCall_LineFromPosition(iTargetEnd);
-			if (iRcAnchorLine > iRcCurLine) {
-				iCurPos = SciCall_FindColumn(iLineStart, iRcCurCol);
-				iAnchorPos = SciCall_FindColumn(iLineEnd, iRcAnchorCol);
+		pos = CsvScanRecord(text, pos, length, index->dialect, record);
+		++records;
+		multiline |= record.multiline;
+		columns = max(columns, record.fieldCount);
+		CsvUpdateColumnWidth(text, record, index->dialect, index->columnWidth);
+	}
+
+	NP2HeapFree(fields);
+	index->recordCount = records;
+	index->columnCount = columns;
+	index->multiline = multiline;
+	InterlockedExchange(&index->indexDone, TRUE);
+	return 0;
+}
+
+inline bool EditCsvIndexReady() noexcept {
+	const CsvIndex &index = csvIndex;
+	if (index.snapshot != nullptr && index.snapshot->IsStale()) {
+		// rebuild after document changed, current command uses lexer line state
+		EditCsvIndexStart(index.option);
+	}
+	return index.snapshot != nullptr && index.indexCount != 0;
+}
+
+// start of record contains pos.
+Sci_Position EditCsvRecordStart(Sci_Position pos) noexcept {
+	const CsvIndex &index = csvIndex;
+	if (EditCsvIndexReady()) {
+		const LONG count = index.indexCount;
+		const bool done = index.indexDone;
+		const Sci_Position * const entries = index.recordIndex;
+		LONG low = 0;
+		LONG high = count - 1;
+		while (low < high) {
+			const LONG mid = (low + high + 1) >> 1;
+			if (entries[mid] <= pos) {
+				low = mid;
 			} else {
-				iCurPos = SciCall_FindColumn(iLineEnd, iRcCurCol);
-				iAnchorPos = SciCall_FindColumn(iLineStart, iRcAnchorCol);
+				high = mid - 1;
+			}
+		}
+		// worker not yet reached pos, avoid scanning remaining document
+		if (done || low + 1 < count) {
+			const char * const text = index.snapshot->Text();
+			const Sci_Position length = index.snapshot->Length();
+			CsvRecord record{};
+			Sci_Position start = entries[low];
+			while (start < length) {
+				const Sci_Position next = CsvScanRecord(text, start, length, index.dialect, record);
+				if (next > pos || record.contentEnd == length) {
+					break;
+				}
+				start = next;
 			}
-			if (iCurPos != iAnchorPos) {
-				SciCall_SetRectangularSelectionCaret(iCurPos);
-				SciCall_SetRectangularSelectionAnchor(iAnchorPos);
-			} else {
-				SciCall_SetSel(iTargetStart, iTargetStart);
-			}
-		} else {
-			SciCall_SetSel(iTargetStart, iTargetStart);
+			return start;
 		}
 	}
-}
-
-//=============================================================================
-//
-// EditJumpTo()
-//
-void EditJumpTo(Sci_Line iNewLine, Sci_Position iNewCol) noexcept {
-	// Jumpt to end with line set to -1
-	if (iNewLine < 0 || iNewLine > SciCall_GetLineCount()) {
-		iNewCol = SciCall_GetLength();
-	} else {
-		--iNewLine;
-		const Sci_Position iLineEndPos = SciCall_GetLineEndPosition(iNewLine);
-		iNewCol = min(iNewCol, iLineEndPos);
-		iNewCol = SciCall_FindColumn(iNewLine, iNewCol - 1);
-	}
-
-	EditSelectEx(iNewCol, iNewCol);
-	SciCall_ChooseCaretX();
-}
-
-//=============================================================================
-//
-// EditSelectEx()
-//
-void EditSelectEx(Sci_Position iAnchorPos, Sci_Position iCurrentPos) noexcept {
-	const Sci_Line iNewLine = SciCall_LineFromPosition(iCurrentPos);
 
-	if (iAnchorPos != iCurrentPos) {
-		const Sci_Line iAnchorLine = SciCall_LineFromPosition(iAnchorPos);
-		// Ensure that the first and last lines of a selection are always unfolded
-		// This needs to be done *before* the SciCall_SetSel() message
-		if (iAnchorLine != iNewLine) {
-			SciCall_EnsureVisible(iAnchorLine);
+	// line ended inside quoted field has nonzero line state, see LexCSV
+	Sci_Line line = SciCall_LineFromPosition(pos);
+	if (line != 0) {
+		SciCall_EnsureStyledTo(SciCall_PositionFromLine(line));
+		while (line != 0 && SciCall_GetLineState(line - 1) != 0) {
+			--line;
 		}
 	}
+	return SciCall_PositionFromLine(line);
+}
+
+// contiguous document text for records overlapped by [start, end)
+const char *EditCsvGetRecords(Sci_Position &start, Sci_Position &end, const CsvDialect &dialect) noexcept {
+	start = EditCsvRecordStart(start);
+	const Sci_Position last = EditCsvRecordStart(end);
+	if (last != end || last == start) {
+		const Sci_Position length = SciCall_GetLength() - last;
+		const char * const text = SciCall_GetRangePointer(last, length);
+		CsvRecord record{};
+		end = last + CsvScanRecord(text, 0, length, dialect, record);
+	}
+	return SciCall_GetRangePointer(start, end - start);
+}
+
+// column of field contains pos.
+UINT EditCsvFieldIndex(Sci_Position pos, const CsvDialect &dialect) noexcept {
+	Sci_Position start = pos;
+	Sci_Position end = pos;
+	const char * const text = EditCsvGetRecords(start, end, dialect);
+	CsvField fields[NP2_CSV_MAX_COLUMN];
+	CsvRecord record;
+	record.fields = fields;
+	record.maxField = COUNTOF(fields);
+	CsvScanRecord(text, 0, end - start, dialect, record);
+	const UINT count = min(record.fieldCount, record.maxField);
+	pos -= start;
+	UINT column = 0;
+	while (column + 1 < count && fields[column + 1].start <= pos) {
+		++column;
+	}
+	return column;
+}
+
+// returns length of aligned record, only get the length when output is nullptr.
+Sci_Position CsvAlignRecord(const char *text, const CsvRecord &record, Sci_Position recordEnd, const UINT *columnWidth, EditAlignMode nMode, char *output) noexcept {
+	const CsvField * const fields = record.fields;
+	Sci_Position length = 0;
+	Sci_Position tail = fields[0].start;
+	if (!record.multiline && record.fieldCount > 1) {
+		const UINT count = min(record.fieldCount, record.maxField);
+		for (UINT i = 0; i < count; i++) {
+			CsvField field = fields[i];
+			const UINT width = CsvTrimField(text, field, csvIndex.dialect);
+			const UINT padding = (columnWidth[i] > width) ? columnWidth[i] - width : 0;
+			UINT before = 0;
+			if (nMode == EditAlignMode_Right) {
+				before = padding;
+			} else if (nMode == EditAlignMode_Center) {
+				before = padding / 2;
+			}
+			// no trailing spaces after last field
+			const UINT after = (i + 1 == record.fieldCount) ? 0 : padding - before;
+			const Sci_Position cchField = field.end - field.start;
+			// delimiters before next field
+			const Sci_Position cchDelimiter = (i + 1 < count) ? fields[i + 1].start - fields[i].end : 0;
+			if (output != nullptr) {
+				char *ptr = output + length;
+				memset(ptr, ' ', before);
+				ptr += before;
+				memcpy(ptr, text + field.start, cchField);
+				ptr += cchField;
+				memset(ptr, ' ', after);
+				ptr += after;
+				memcpy(ptr, text + fields[i].end, cchDelimiter);
+			}
+			length += before + cchField + after + cchDelimiter;
+		}
+		tail = fields[count - 1].end;
+	}
+	// fields after NP2_CSV_MAX_COLUMN and line break
+	if (output != nullptr) {
+		memcpy(output + length, text + tail, recordEnd - tail);
+	}
+	return length + recordEnd - tail;
+}
+
+// pad fields in selected records (or whole document) with spaces to align columns.
+bool EditCsvAlignFields(EditAlignMode nMode) noexcept {
+	const CsvIndex &index = csvIndex;
+	const CsvDialect &dialect = index.dialect;
+	if (index.worker.eventCancel == nullptr || dialect.delimiter == ' ') {
+		return false;
+	}
 
-	SciCall_SetXCaretPolicy(CARET_SLOP | CARET_STRICT | CARET_EVEN, 50);
-	SciCall_SetYCaretPolicy(CARET_SLOP | CARET_STRICT | CARET_EVEN, 5);
-	// center current line on screen when it's not visible
-	SciCall_EnsureVisibleEnforcePolicy(iNewLine);
-	if (iAnchorPos == iCurrentPos) {
-		SciCall_GotoPos(iAnchorPos);
+	const Sci_Position length = SciCall_GetLength();
+	Sci_Position iSelStart = SciCall_GetSelectionStart();
+	Sci_Position iSelEnd = SciCall_GetSelectionEnd();
+	if (iSelStart == iSelEnd) {
+		iSelStart = 0;
+		iSelEnd = length;
+	}
+	const bool whole = iSelStart == 0 && iSelEnd == length;
+	const char * const text = EditCsvGetRecords(iSelStart, iSelEnd, dialect);
+	const Sci_Position cchText = iSelEnd - iSelStart;
+
+	CsvRecord record;
+	record.fields = static_cast<CsvField *>(NP2HeapAlloc(NP2_CSV_MAX_COLUMN * sizeof(CsvField)));
+	record.maxField = NP2_CSV_MAX_COLUMN;
+	UINT * const columnWidth = static_cast<UINT *>(NP2HeapAlloc(NP2_CSV_MAX_COLUMN * sizeof(UINT)));
+	if (whole && EditCsvIndexReady() && index.indexDone) {
+		memcpy(columnWidth, index.columnWidth, sizeof(index.columnWidth));
 	} else {
-		SciCall_SetSel(iAnchorPos, iCurrentPos);
+		for (Sci_Position pos = 0; pos < cchText;) {
+			pos = CsvScanRecord(text, pos, cchText, dialect, record);
+			CsvUpdateColumnWidth(text, record, dialect, columnWidth);
+		}
 	}
-	SciCall_SetXCaretPolicy(CARET_SLOP | CARET_EVEN, 50);
-	SciCall_SetYCaretPolicy(CARET_EVEN, 0);
-}
-
-//=============================================================================
-//
-// EditFixPositions()
-//
-void EditFixPositions() noexcept {
-	const Sci_Position iMaxPos = SciCall_GetLength();
-	Sci_Position iCurrentPos = SciCall_GetCurrentPos();
-	const Sci_Position iAnchorPos = SciCall_GetAnchor();
 
-	if (iCurrentPos > 0 && iCurrentPos < iMaxPos) {
-		const Sci_Position iNewPos = SciCall_PositionAfter(SciCall_PositionBefore(iCurrentPos));
-		if (iNewPos != iCurrentPos) {
-			SciCall_SetCurrentPos(iNewPos);
-			iCurrentPos = iNewPos;
-		}
+	Sci_Position cchAlign = 0;
+	for (Sci_Position pos = 0; pos < cchText;) {
+		const Sci_Position next = CsvScanRecord(text, pos, cchText, dialect, record);
+		cchAlign += CsvAlignRecord(text, record, next, columnWidth, nMode, nullptr);
+		pos = next;
 	}
 
-	if (iAnchorPos != iCurrentPos && iAnchorPos > 0 && iAnchorPos < iMaxPos) {
-		const Sci_Position iNewPos = SciCall_PositionAfter(SciCall_PositionBefore(iAnchorPos));
-		if (iNewPos != iAnchorPos) {
-			SciCall_SetAnchor(iNewPos);
-		}
+	char * const pszAlign = static_cast<char *>(NP2HeapAlloc(cchAlign + 1));
+	Sci_Position offset = 0;
+	for (Sci_Position pos = 0; pos < cchText;) {
+		const Sci_Position next = CsvScanRecord(text, pos, cchText, dialect, record);
+		offset += CsvAlignRecord(text, record, next, columnWidth, nMode, pszAlign + offset);
+		pos = next;
 	}
+
+	NP2HeapFree(record.fields);
+	NP2HeapFree(columnWidth);
+	EditReplaceRange(iSelStart, iSelEnd, cchAlign, pszAlign);
+	NP2HeapFree(pszAlign);
+	return true;
 }
 
-//=============================================================================
-//
-// EditEnsureSelectionVisible()
-//
-void EditEnsureSelectionVisible() noexcept {
-	const Sci_Position iAnchorPos = SciCall_GetAnchor();
-	const Sci_Position iCurrentPos = SciCall_GetCurrentPos();
-	EditSelectEx(iAnchorPos, iCurrentPos);
 }
 
-void EditEnsureConsistentLineEndings() noexcept {
-	const size_t lineCount = SciCall_GetLineCount();
-	if (lineCount < 2) {
-		return;
+void EditCsvIndexStop() noexcept {
+	CsvIndex &index = csvIndex;
+	if (index.worker.eventCancel != nullptr) {
+		// index thread never posts message
+		SetEvent(index.worker.eventCancel);
+		HANDLE hThread = InterlockedExchangePointer(&index.worker.workerThread, nullptr);
+		if (hThread != nullptr) {
+			WaitForSingleObject(hThread, INFINITE);
+			CloseHandle(hThread);
+		}
+		ResetEvent(index.worker.eventCancel);
 	}
-	const size_t actions = SciCall_GetUndoActions();
-	if (lineCount + actions >= MAX_SMALL_FILE_SIZE) {
-		// Scintilla undo stack is indexed with int
-		return;
+	if (index.snapshot != nullptr) {
+		index.snapshot->Release();
+		index.snapshot = nullptr;
 	}
+	if (index.recordIndex != nullptr) {
+		NP2HeapFree(index.recordIndex);
+		index.recordIndex = nullptr;
+	}
+	index.indexCount = 0;
+	index.indexDone = FALSE;
+}
 
-	const int iEOLMode = SciCall_GetEOLMode();
-	if (iEOLMode == SC_EOL_CRLF) {
-#if defined(_WIN64)
-		const int options = SciCall_GetDocumentOptions();
-		if (!(options & SC_DOCUMENTOPTION_TEXT_LARGE))
-#endif
-		{
-			const size_t dwLength = SciCall_GetLength() + lineCount;
-			if (dwLength >= MAX_SMALL_FILE_SIZE) {
+void EditCsvIndexStart(int option) noexcept {
+	CsvIndex &index = csvIndex;
+	if (index.worker.eventCancel == nullptr) {
+		index.worker.Init(hwndMain);
+	} else {
+		EditCsvIndexStop();
+	}
+
+	index.option = option;
+	index.dialect.Init(option, SciCall_GetCodePage());
+	memset(index.columnWidth, 0, sizeof(index.columnWidth));
+	// records never exceed lines
+	index.recordIndex = static_cast<Sci_Position *>(NP2HeapAlloc((SciCall_GetLineCount() / NP2_CSV_INDEX_STEP + 2) * sizeof(Sci_Position)));
+	if (index.recordIndex != nullptr) {
+		index.snapshot = SciCall_CreateDocumentSnapshot();
+		if (index.snapshot != nullptr) {
+			index.worker.workerThread = CreateThread(nullptr, 0, EditCsvIndexThread, &index, 0, nullptr);
+			if (index.worker.workerThread != nullptr) {
 				return;
 			}
 		}
+		EditCsvIndexStop();
 	}
-
-	SciCall_ConvertEOLs(iEOLMode);
-	EditFixPositions();
 }
 
 //=============================================================================
 //
-// EditGetExcerpt()
+// EditAlignText()
 //
-void EditGetExcerpt(LPWSTR lpszExcerpt, DWORD cchExcerpt) noexcept {
-	if (SciCall_IsSelectionEmpty() || SciCall_IsRectangularSelection()) {
-		StrCpyEx(lpszExcerpt, L"");
-		return;
-	}
+namespace {
 
-	WCHAR tch[256]{};
-	char pszText[256]{};
-	const Sci_Position iSelStart = SciCall_GetSelectionStart();
-	const Sci_Position iSelEnd = min<Sci_Position>(SciCall_GetSelectionEnd(), iSelStart + COUNTOF(tch) - 1);
+struct EditAlignParam {
+	EditAlignMode mode;
+	int minIndent;
+	int maxLength;
+	bool useTabs;
+	bool singleLine;
+	bool nextLineIsBlank;	// line after the range is blank or missing
+};
 
-	const Sci_TextRangeFull tr = { { iSelStart, iSelEnd }, pszText };
-	SciCall_GetTextRangeFull(&tr);
-	const UINT cpEdit = SciCall_GetCodePage();
-	MultiByteToWideChar(cpEdit, 0, pszText, static_cast<int>(iSelEnd - iSelStart), tch, COUNTOF(tch));
+struct AlignMeasurePart {
+	const EditLineTransform *transform;
+	const char *text;
+	Sci_Position start;
+	Sci_Position end;
+	int minIndent;
+	int maxLength;
+};
 
-	DWORD cch = 0;
-	WCHAR chPrev = L' ';
-	LPCWSTR p = tch;
-	while (*p != L'\0') {
-		WCHAR ch = *p++;
-		if (ch <= L' ') {
-			ch = L' ';
-			if (chPrev == L' ') {
-				continue;
-			}
-		}
-		if (cch < cchExcerpt - 1) {
-			lpszExcerpt[cch] = ch;
-		}
-		chPrev = ch;
-		cch++;
-		if (cch > cchExcerpt) {
-			cch = cchExcerpt - 1;
-			lpszExcerpt[cchExcerpt - 2] = L'.';
-			lpszExcerpt[cchExcerpt - 3] = L'.';
-			lpszExcerpt[cchExcerpt - 4] = L'.';
-			break;
+inline bool IsBlankLine(const char *text, Sci_Position length) noexcept {
+	for (Sci_Position index = 0; index < length; index++) {
+		if (!IsASpaceOrTab(text[index])) {
+			return false;
 		}
 	}
-	lpszExcerpt[cch] = L'\0';
-	if (cch == 0) {
-		lstrcpy(lpszExcerpt, L" ... ");
-	}
+	return true;
 }
 
-void EditSelectWord() noexcept {
-	const Sci_Position iPos = SciCall_GetCurrentPos();
-
-	if (SciCall_IsSelectionEmpty()) {
-		Sci_Position iWordStart = SciCall_WordStartPosition(iPos, true);
-		Sci_Position iWordEnd = SciCall_WordEndPosition(iPos, true);
-
-		if (iWordStart == iWordEnd) {// we are in whitespace salad...
-			iWordStart = SciCall_WordEndPosition(iPos, false);
-			iWordEnd = SciCall_WordEndPosition(iWordStart, true);
-			if (iWordStart != iWordEnd) {
-				//if (IsDocWordChar(SciCall_GetCharAt(iWordStart - 1))) {
-				//	--iWordStart;
-				//}
-				SciCall_SetSel(iWordStart, iWordEnd);
+// indentation and end of trimmed content in display columns, for lines not blank.
+DWORD WINAPI AlignMeasureThread(LPVOID lpParam) noexcept {
+	AlignMeasurePart &part = *static_cast<AlignMeasurePart *>(lpParam);
+	const EditLineTransform &transform = *part.transform;
+	const int tabWidth = transform.tabWidth;
+	const char *ptr = part.text + part.start;
+	const char * const end = part.text + part.end;
+	while (ptr < end) {
+		const char * const lineEnd = FindLineEnd(ptr, end);
+		const Sci_Position length = lineEnd - ptr;
+		int column = 0;
+		int indent = -1;
+		int endColumn = 0;
+		for (Sci_Position index = 0; index < length;) {
+			const char ch = ptr[index];
+			if (ch == '\t') {
+				column += tabWidth - (column % tabWidth);
+				++index;
+			} else if (ch == ' ') {
+				++column;
+				++index;
+			} else {
+				if (indent < 0) {
+					indent = column;
+				}
+				column += LineTransformCharColumns(transform, ptr, index, length);
+				endColumn = column;
 			}
-		} else {
-			//if (IsDocWordChar(SciCall_GetCharAt(iWordStart - 1))) {
-			//	--iWordStart;
-			//}
-			SciCall_SetSel(iWordStart, iWordEnd);
 		}
+		if (indent >= 0) {
+			part.minIndent = min(part.minIndent, indent);
+			part.maxLength = max(part.maxLength, endColumn);
+		}
+		ptr = SkipLineEnd(lineEnd, end);
+	}
+	return 0;
+}
 
-		if (!SciCall_IsSelectionEmpty()) {
-			return;
+void AlignMeasureRange(EditLineTransform &transform, EditAlignParam &param, Sci_Position iStartPos, Sci_Position iEndPos) noexcept {
+	const Sci_Position length = iEndPos - iStartPos;
+	SYSTEM_INFO info;
+	GetSystemInfo(&info);
+	UINT partCount = static_cast<UINT>(min<Sci_Position>(info.dwNumberOfProcessors, length / NP2_PARALLEL_TRANSFORM_MIN_SIZE));
+	partCount = clamp<UINT>(partCount, 1, MAX_PARALLEL_WORKER_COUNT);
+
+	const char * const pszText = SciCall_GetRangePointer(iStartPos, length);
+	AlignMeasurePart parts[MAX_PARALLEL_WORKER_COUNT];
+	Sci_Position start = 0;
+	for (UINT i = 0; i < partCount; i++) {
+		Sci_Position end = length;
+		if (i + 1 < partCount) {
+			end = SciCall_PositionFromLine(SciCall_LineFromPosition(iStartPos + length/partCount*(i + 1)) + 1) - iStartPos;
+			end = clamp(end, start, length);
+		}
+		AlignMeasurePart &part = parts[i];
+		part.transform = &transform;
+		part.text = pszText;
+		part.start = start;
+		part.end = end;
+		part.minIndent = INT_MAX;
+		part.maxLength = 0;
+		start = end;
+	}
+	RunParallelWorker(AlignMeasureThread, parts, sizeof(AlignMeasurePart), partCount);
+
+	param.minIndent = INT_MAX;
+	param.maxLength = 0;
+	for (UINT i = 0; i < partCount; i++) {
+		param.minIndent = min(param.minIndent, parts[i].minIndent);
+		param.maxLength = max(param.maxLength, parts[i].maxLength);
+	}
+}
+
+// same as SCI_SETLINEINDENTATION
+inline char *AlignWriteIndent(const EditLineTransform &transform, const EditAlignParam &param, char *out) noexcept {
+	int indent = param.minIndent;
+	if (param.useTabs) {
+		const int tabWidth = transform.tabWidth;
+		memset(out, '\t', indent / tabWidth);
+		out += indent / tabWidth;
+		indent %= tabWidth;
+	}
+	memset(out, ' ', indent);
+	return out + indent;
+}
+
+inline void SkipSpaceOrTab(const char *text, Sci_Position &index, Sci_Position length) noexcept {
+	while (index < length && IsASpaceOrTab(text[index])) {
+		++index;
+	}
+}
+
+// words are separated by space or tab, line is rebuilt with single space between words
+// then padded to fill columns between minimum indentation and maximum line length.
+Sci_Position AlignTextKernel(const EditLineTransform &transform, LineTransformLine &line, char *pszOut) noexcept {
+	const EditAlignParam &param = *static_cast<const EditAlignParam *>(transform.param);
+	const char * const text = line.text;
+	const Sci_Position length = line.length;
+
+	int iWords = 0;
+	int iWordsLength = 0;
+	for (Sci_Position index = 0; ;) {
+		SkipSpaceOrTab(text, index, length);
+		if (index == length) {
+			break;
+		}
+		++iWords;
+		do {
+			iWordsLength += LineTransformCharColumns(transform, text, index, length);
+		} while (index < length && !IsASpaceOrTab(text[index]));
+	}
+	if (iWords == 0) {
+		return 0; // remove whitespace on blank line
+	}
+
+	const EditAlignMode nMode = param.mode;
+	const int iMaxWidth = param.maxLength - param.minIndent;
+	int iSpacesPerGap = 1;
+	int iExtraSpaces = 0;
+	int iGapExtra = iWords; // gaps after this get one more space
+	int iOddSpaces = 0;
+	char *out = AlignWriteIndent(transform, param, pszOut);
+	if (nMode == EditAlignMode_Justify || nMode == EditAlignMode_JustifyEx) {
+		bool bNextLineIsBlank = false;
+		if (nMode == EditAlignMode_JustifyEx) {
+			bNextLineIsBlank = (line.nextText != nullptr) ? IsBlankLine(line.nextText, line.nextLength) : param.nextLineIsBlank;
+		}
+		if (iWords > 1 && iWordsLength >= 2 &&
+				((nMode != EditAlignMode_JustifyEx || !bNextLineIsBlank || param.singleLine) ||
+				 (bNextLineIsBlank && iWordsLength*4 > iMaxWidth*3))) {
+			const int iGaps = iWords - 1;
+			iSpacesPerGap = (iMaxWidth - iWordsLength) / iGaps;
+			iGapExtra = iGaps - (iMaxWidth - iWordsLength) % iGaps;
+		}
+	} else {
+		iExtraSpaces = iMaxWidth - iWordsLength - iWords + 1;
+		if (nMode == EditAlignMode_Right) {
+			memset(out, ' ', iExtraSpaces);
+			out += iExtraSpaces;
+		} else if (nMode == EditAlignMode_Center) {
+			iOddSpaces = iExtraSpaces % 2;
+			const int count = (iExtraSpaces - iOddSpaces) / 2;
+			memset(out, ' ', count);
+			out += count;
+		}
+	}
+
+	int word = 0;
+	for (Sci_Position index = 0; ;) {
+		SkipSpaceOrTab(text, index, length);
+		if (index == length) {
+			break;
+		}
+		if (word != 0) {
+			const int count = iSpacesPerGap + (word > iGapExtra);
+			memset(out, ' ', count);
+			out += count;
+		}
+		const Sci_Position begin = index;
+		do {
+			++index;
+		} while (index < length && !IsASpaceOrTab(text[index]));
+		memcpy(out, text + begin, index - begin);
+		out += index - begin;
+		++word;
+		if (iOddSpaces > 0 && iWords > 1 && word >= iWords / 2) {
+			*out++ = ' ';
+			iOddSpaces--;
 		}
 	}
+	return out - pszOut;
+}
 
-	const Sci_Line iLine = SciCall_LineFromPosition(iPos);
-	const Sci_Position iLineStart = SciCall_GetLineIndentPosition(iLine);
-	const Sci_Position iLineEnd = SciCall_GetLineEndPosition(iLine);
-	SciCall_SetSel(iLineStart, iLineEnd);
 }
 
-void EditSelectLines(bool currentBlock, bool lineSelection) noexcept {
-	if (lineSelection && !currentBlock) {
-		SciCall_SetSelectionMode(SC_SEL_LINES);
+void EditAlignText(EditAlignMode nMode) noexcept {
+	if (SciCall_IsRectangularSelection()) {
+		NotifyRectangularSelection();
+		return;
+	}
+	if (nMode <= EditAlignMode_Center && pLexCurrent->iLexer == SCLEX_CSV && EditCsvAlignFields(nMode)) {
 		return;
 	}
 
-	// see Editor::LineSelectionRange()
-	Sci_Position iCurrentPos = SciCall_GetCurrentPos();
+	const Sci_Position iSelEnd = SciCall_GetSelectionEnd();
+	Sci_Position iCurPos = SciCall_GetCurrentPos();
 	Sci_Position iAnchorPos = SciCall_GetAnchor();
-	bool backward = (iCurrentPos < iAnchorPos);
 
-	Sci_Line iLineAnchorPos = SciCall_LineFromPosition(iAnchorPos);
-	Sci_Line iLineCurPos = SciCall_LineFromPosition(iCurrentPos);
+	const Sci_Line iLineStart = SciCall_LineFromPosition(SciCall_GetSelectionStart());
+	Sci_Line iLineEnd = SciCall_LineFromPosition(iSelEnd);
 
-	if (currentBlock) {
-		Sci_Line iLineStart = iLineCurPos;
-		const int level = SciCall_GetFoldLevel(iLineStart);
-		if (!(level & SC_FOLDLEVELHEADERFLAG)) {
-			iLineStart = SciCall_GetFoldParent(iLineStart);
-			if (iLineStart < 0) {
-				SciCall_SelectAll();
-				return;
-			}
+	if (iSelEnd <= SciCall_PositionFromLine(iLineEnd)) {
+		if (iLineEnd - iLineStart >= 1) {
+			iLineEnd--;
 		}
+	}
 
-		const Sci_Line iLineEnd = SciCall_GetLastChild(iLineStart);
-		backward = backward || (iCurrentPos == iAnchorPos && iLineEnd - iLineCurPos > iLineCurPos - iLineStart);
-		if (backward) {
-			iLineCurPos = iLineStart;
-			iLineAnchorPos = iLineEnd;
-		} else {
-			iLineCurPos = iLineEnd;
-			iLineAnchorPos = iLineStart;
-		}
+	const Sci_Position iStartPos = SciCall_PositionFromLine(iLineStart);
+	const Sci_Position iEndPos = SciCall_PositionFromLine(iLineEnd + 1);
+	const Sci_Line lineCount = SciCall_GetLineCount();
+	EditAlignParam param;
+	param.mode = nMode;
+	param.useTabs = SciCall_GetUseTabs();
+	param.singleLine = iLineStart == iLineEnd;
+	param.nextLineIsBlank = true;
+	if (iLineEnd + 1 < lineCount) {
+		param.nextLineIsBlank = SciCall_GetLineIndentPosition(iLineEnd + 1) == SciCall_GetLineEndPosition(iLineEnd + 1);
 	}
 
-	const Sci_Line offset = lineSelection ? 0 : 1;
-	if (backward) {
-		iLineAnchorPos = iLineAnchorPos + offset;
+	BeginWaitCursor();
+	EditLineTransform transform;
+	InitLineTransform(transform, AlignTextKernel);
+	transform.tabWidth = SciCall_GetTabWidth();
+	transform.excludeEndLine = iLineEnd + 1 < lineCount;
+	AlignMeasureRange(transform, param, iStartPos, iEndPos);
+	if (param.minIndent == INT_MAX) {
+		param.minIndent = 0; // all lines are blank
+	}
+	// indentation and padding are at most one byte per column
+	transform.lineExtra = param.maxLength + 1;
+	transform.param = &param;
+	EditTransformRange(transform, iStartPos, iEndPos);
+	EndWaitCursor();
+
+	if (iCurPos < iAnchorPos) {
+		iCurPos = iLineStart;
+		iAnchorPos = iLineEnd + 1;
 	} else {
-		iLineCurPos = iLineCurPos + offset;
+		iAnchorPos = iLineStart;
+		iCurPos = iLineEnd + 1;
 	}
+	iAnchorPos = SciCall_PositionFromLine(iAnchorPos);
+	iCurPos = SciCall_PositionFromLine(iCurPos);
+	SciCall_SetSel(iAnchorPos, iCurPos);
+}
 
-	iAnchorPos = SciCall_PositionFromLine(iLineAnchorPos);
-	iCurrentPos = SciCall_PositionFromLine(iLineCurPos);
-	SciCall_SetSel(iAnchorPos, iCurrentPos);
-	if (lineSelection) {
-		SciCall_SetSelectionMode(SC_SEL_LINES);
+//=============================================================================
+//
+// EditEncloseSelection()
+//
+void EditEncloseSelection(LPCWSTR pwszOpen, LPCWSTR pwszClose) noexcept {
+	if (SciCall_IsRectangularSelection()) {
+		NotifyRectangularSelection();
+		return;
+	}
+	if (StrIsEmpty(pwszOpen) && StrIsEmpty(pwszClose)) {
+		return;
 	}
-	SciCall_ChooseCaretX();
-}
 
-static LRESULT CALLBACK AddBackslashEditProc(HWND hwnd, UINT umsg, WPARAM wParam, LPARAM lParam, UINT_PTR uIdSubclass, DWORD_PTR dwRefData) noexcept {
-	UNREFERENCED_PARAMETER(dwRefData);
+	BeginWaitCursor();
 
-	switch (umsg) {
-	case WM_PASTE: {
-		bool done = false;
-		LPWSTR lpsz = EditGetClipboardTextW();
-		if (StrNotEmpty(lpsz)) {
-			const int len = lstrlen(lpsz);
-			LPWSTR lpszEsc = static_cast<LPWSTR>(NP2HeapAlloc((kMaxBackslashEscapeCount*len + 1)*sizeof(WCHAR)));
-			if (lpszEsc != nullptr) {
-				AddBackslashW(lpszEsc, lpsz);
-				SendMessage(hwnd, EM_REPLACESEL, TRUE, AsInteger<LPARAM>(lpszEsc));
-				NP2HeapFree(lpszEsc);
-				done = true;
-			}
-		}
-		if (lpsz != nullptr) {
-			NP2HeapFree(lpsz);
-		}
-		if (done) {
-			return TRUE;
-		}
-	}
-	break;
+	const Sci_Position iSelStart = SciCall_GetSelectionStart();
+	const Sci_Position iSelEnd = SciCall_GetSelectionEnd();
+	const UINT cpEdit = SciCall_GetCodePage();
+	const int iEOLMode = SciCall_GetEOLMode();
 
-	case WM_NCDESTROY:
-		RemoveWindowSubclass(hwnd, AddBackslashEditProc, uIdSubclass);
-		break;
+	char *mszOpen = nullptr;
+	int len = lstrlen(pwszOpen);
+	if (len != 0) {
+		const int size = kMaxMultiByteCount * len + 1;
+		mszOpen = static_cast<char *>(NP2HeapAlloc(size));
+		WideCharToMultiByte(cpEdit, 0, pwszOpen, -1, mszOpen, size, nullptr, nullptr);
+		ConvertWinEditLineEndings(mszOpen, iEOLMode);
 	}
 
-	return DefSubclassProc(hwnd, umsg, wParam, lParam);
-}
-
-void AddBackslashComboBoxSetup(HWND hwnd) noexcept {
-	COMBOBOXINFO info;
-	info.cbSize = sizeof(COMBOBOXINFO);
-	if (GetComboBoxInfo(hwnd, &info)) {
-		SetWindowSubclass(info.hwndItem, AddBackslashEditProc, 0, 0);
-		// Ctrl+Backspace
-		SHAutoComplete(info.hwndItem, SHACF_FILESYS_ONLY | SHACF_AUTOAPPEND_FORCE_OFF | SHACF_AUTOSUGGEST_FORCE_OFF);
+	char *mszClose = nullptr;
+	len = lstrlen(pwszClose);
+	if (len != 0) {
+		const int size = kMaxMultiByteCount * len + 1;
+		mszClose = static_cast<char *>(NP2HeapAlloc(size));
+		WideCharToMultiByte(cpEdit, 0, pwszClose, -1, mszClose, size, nullptr, nullptr);
+		ConvertWinEditLineEndings(mszClose, iEOLMode);
 	}
-}
 
-extern int iFindReplaceOption;
-extern int iFindReplaceOpacityLevel;
+	SciCall_BeginUndoAction();
+	len = 0;
 
-void EditSaveSelectionAsFindText(EDITFINDREPLACE *lpefr, int menu, bool findSelection) noexcept {
-	if (!findSelection && (iSelectOption & SelectOption_CopySelectionAsFindText) == 0) {
-		return;
-	}
-	Sci_Position cchSelection = SciCall_GetSelTextLength();
-	if (cchSelection == 0 && findSelection) {
-		EditSelectWord();
-		cchSelection = SciCall_GetSelTextLength();
+	if (StrNotEmpty(mszOpen)) {
+		len = static_cast<int>(strlen(mszOpen));
+		SciCall_SetTargetRange(iSelStart, iSelStart);
+		SciCall_ReplaceTarget(len, mszOpen);
 	}
 
-	if (cchSelection > 0 && cchSelection < NP2_FIND_REPLACE_LIMIT) {
-		char mszSelection[NP2_FIND_REPLACE_LIMIT];
+	if (StrNotEmpty(mszClose)) {
+		SciCall_SetTargetRange(iSelEnd + len, iSelEnd + len);
+		SciCall_ReplaceTarget(-1, mszClose);
+	}
 
-		SciCall_GetSelText(mszSelection);
-		mszSelection[cchSelection] = 0; // zero terminate
+	SciCall_EndUndoAction();
 
-		const UINT cpEdit = SciCall_GetCodePage();
-		strcpy(lpefr->szFind, mszSelection);
+	// Fix selection
+	if (iSelStart == iSelEnd) {
+		SciCall_SetSel(iSelStart + len, iSelStart + len);
+	} else {
+		Sci_Position iCurPos = SciCall_GetCurrentPos();
+		Sci_Position iAnchorPos = SciCall_GetAnchor();
 
-		if (cpEdit != SC_CP_UTF8) {
-			WCHAR wszBuf[NP2_FIND_REPLACE_LIMIT];
-			MultiByteToWideChar(cpEdit, 0, mszSelection, -1, wszBuf, COUNTOF(wszBuf));
-			WideCharToMultiByte(CP_UTF8, 0, wszBuf, -1, lpefr->szFindUTF8, COUNTOF(lpefr->szFindUTF8), nullptr, nullptr);
+		if (iCurPos < iAnchorPos) {
+			iCurPos = iSelStart + len;
+			iAnchorPos = iSelEnd + len;
 		} else {
-			strcpy(lpefr->szFindUTF8, mszSelection);
+			iAnchorPos = iSelStart + len;
+			iCurPos = iSelEnd + len;
 		}
+		SciCall_SetSel(iAnchorPos, iCurPos);
+	}
 
-		lpefr->fuFlags &= SCFIND_REGEXP - 1; // clear all regex flags
-		lpefr->option &= ~FindReplaceOption_TransformBackslash;
+	EndWaitCursor();
+	if (mszOpen != nullptr) {
+		NP2HeapFree(mszOpen);
+	}
+	if (mszClose != nullptr) {
+		NP2HeapFree(mszClose);
+	}
+}
 
-		switch (menu) {
-		case IDM_EDIT_SAVEFIND:
-			break;
+namespace {
 
-		case CMD_FINDNEXTSEL:
-			EditFindNext(lpefr, false);
-			break;
+struct ToggleLineCommentsParam {
+	const char *comment;
+	int cchComment;
+	char commentEnd;
+	char commentPad;
+	bool deleteComment;
+	bool singleLine;
+	bool tabsAsSpaces;
+	int indentWidth;
+	Sci_Position commentCol;
+};
 
-		case CMD_FINDPREVSEL:
-			EditFindPrev(lpefr, false);
-			break;
+// same as SCI_GETLINEINDENTPOSITION and SCI_GETCOLUMN on it.
+Sci_Position LineCommentIndent(const char *text, Sci_Position length, int tabWidth, Sci_Position &column) noexcept {
+	Sci_Position index = 0;
+	column = 0;
+	while (index < length && (text[index] == ' ' || text[index] == '\t')) {
+		column = (text[index] == '\t') ? (column/tabWidth + 1)*tabWidth : column + 1;
+		++index;
+	}
+	return index;
+}
+
+// same as SCI_FINDCOLUMN for column not after indentation of non-blank line.
+Sci_Position LineCommentColumn(const char *text, Sci_Position indent, int tabWidth, Sci_Position column) noexcept {
+	Sci_Position index = 0;
+	Sci_Position current = 0;
+	while (current < column && index < indent) {
+		if (text[index] == '\t') {
+			current = (current/tabWidth + 1)*tabWidth;
+			if (current > column) {
+				break;
+			}
+		} else {
+			++current;
 		}
+		++index;
 	}
+	return index;
 }
 
-static void FindReplaceSetFont(HWND hwnd, BOOL monospaced, HFONT *hFontFindReplaceEdit) noexcept {
-	HFONT font = nullptr;
-	if (monospaced) {
-		const UINT dpi = GetWindowDPI(hwnd);
-		font = Style_CreateCodeFont(dpi);
-		*hFontFindReplaceEdit = font;
+// tchBuf receives at most 31 bytes after indentation.
+bool IsLineCommented(const ToggleLineCommentsParam &param, const char *text, Sci_Position length, char (&tchBuf)[32]) noexcept {
+	memset(tchBuf, 0, sizeof(tchBuf));
+	memcpy(tchBuf, text, min<Sci_Position>(length, sizeof(tchBuf) - 1));
+	return _strnicmp(tchBuf, param.comment, param.cchComment) == 0
+		&& (param.commentEnd != ' ' || static_cast<uint8_t>(tchBuf[param.cchComment]) <= ' ');
+}
+
+Sci_Position ToggleLineCommentsKernel(const EditLineTransform &transform, LineTransformLine &line, char *pszOut) noexcept {
+	const ToggleLineCommentsParam &param = *static_cast<const ToggleLineCommentsParam *>(transform.param);
+	const char * const text = line.text;
+	const Sci_Position length = line.length;
+	Sci_Position column;
+	const Sci_Position indent = LineCommentIndent(text, length, transform.tabWidth, column);
+	char tchBuf[32];
+	const bool commented = IsLineCommented(param, text + indent, length - indent, tchBuf);
+	const int cchComment = param.cchComment;
+
+	if (param.deleteComment) {
+		if (!commented) {
+			memcpy(pszOut, text, length);
+			return length;
+		}
+		Sci_Position iCommentPos = indent;
+		Sci_Position iEndPos = indent + cchComment;
+		// a line with [space/tab] comment only
+		if (param.commentPad == ' ' && tchBuf[cchComment] == ' ') {
+			++iEndPos;
+		}
+		if (iEndPos == length) {
+			iCommentPos = 0;
+		}
+		memcpy(pszOut, text, iCommentPos);
+		memcpy(pszOut + iCommentPos, text + iEndPos, length - iEndPos);
+		return length - (iEndPos - iCommentPos);
 	}
-	if (font == nullptr) {
-		font = GetWindowFont(hwnd);
+
+	const Sci_Position iCommentPos = LineCommentColumn(text, indent, transform.tabWidth, param.commentCol);
+	char *out = pszOut;
+	memcpy(out, text, iCommentPos);
+	out += iCommentPos;
+	if (commented) {
+		if (iCommentPos != indent) {
+			memcpy(out, param.comment, cchComment);
+			out += cchComment;
+			if (param.commentPad != '\0') {
+				*out++ = param.commentPad;
+			}
+		}
+	} else if (param.commentCol == 0 || param.singleLine || indent != length) {
+		memcpy(out, param.comment, cchComment);
+		out += cchComment;
+		if (param.commentPad != '\0' && iCommentPos != length) {
+			*out++ = param.commentPad;
+		}
+	} else {
+		Sci_Position count = param.commentCol;
+		if (!param.tabsAsSpaces) {
+			const Sci_Position tab = count / param.indentWidth;
+			count %= param.indentWidth;
+			memset(out, '\t', tab);
+			out += tab;
+		}
+		memset(out, ' ', count);
+		out += count;
+		memcpy(out, param.comment, cchComment);
+		out += cchComment;
 	}
-	SendDlgItemMessage(hwnd, IDC_FINDTEXT, WM_SETFONT, AsInteger<WPARAM>(font), TRUE);
-	SendDlgItemMessage(hwnd, IDC_REPLACETEXT, WM_SETFONT, AsInteger<WPARAM>(font), TRUE);
+	memcpy(out, text + iCommentPos, length - iCommentPos);
+	out += length - iCommentPos;
+	return out - pszOut;
 }
 
-static bool CopySelectionAsFindText(HWND hwnd, EDITFINDREPLACE *lpefr, bool bFirstTime) noexcept {
-	const Sci_Position cchSelection = SciCall_GetSelTextLength();
-	char *lpszSelection = nullptr;
+}
 
-	if (cchSelection != 0 && cchSelection <= NP2_FIND_REPLACE_LIMIT && (iSelectOption & SelectOption_CopySelectionAsFindText)) {
-		lpszSelection = static_cast<char *>(NP2HeapAlloc(cchSelection + 1));
-		SciCall_GetSelText(lpszSelection);
+//=============================================================================
+//
+// EditToggleLineComments()
+//
+void EditToggleLineComments(LPCWSTR pwszComment, int commentFlag) noexcept {
+	if (SciCall_IsRectangularSelection()) {
+		NotifyRectangularSelection();
+		return;
 	}
 
-	// only for manually selected text
-	const bool hasFindText = StrNotEmpty(lpszSelection);
+	BeginWaitCursor();
 
-	// First time you bring up find/replace dialog,
-	// copy content from clipboard to find box when nothing is selected in the editor.
-	if (!hasFindText && bFirstTime && (iSelectOption & SelectOption_CopyPasteBufferAsFindText)) {
-		char *pClip = EditGetClipboardText(hwnd);
-		if (pClip != nullptr) {
-			const size_t len = strlen(pClip);
-			if (len > 0 && len <= NP2_FIND_REPLACE_LIMIT) {
-				NP2HeapFree(lpszSelection);
-				lpszSelection = static_cast<char *>(NP2HeapAlloc(len + 2));
-				strcpy(lpszSelection, pClip);
-			}
-			LocalFree(pClip);
+	const Sci_Position iSelStart = SciCall_GetSelectionStart();
+	const Sci_Position iSelEnd = SciCall_GetSelectionEnd();
+	Sci_Position iCurPos = SciCall_GetCurrentPos();
+
+	char mszComment[32] = "";
+	const UINT cpEdit = SciCall_GetCodePage();
+	int cchComment = WideCharToMultiByte(cpEdit, 0, pwszComment, -1, mszComment, COUNTOF(mszComment), nullptr, nullptr) - 1;
+	const char commentEnd = mszComment[cchComment - 1];
+	char commentPad = ' ';
+	if (commentEnd == ' ') {
+		cchComment -= 1;
+	} else if ((commentFlag & AutoInsertMask_SpaceAfterComment) == 0) {
+		commentPad = '\0';
+	}
+
+	const Sci_Line iLineStart = SciCall_LineFromPosition(iSelStart);
+	Sci_Line iLineEnd = SciCall_LineFromPosition(iSelEnd);
+
+	if (iSelEnd <= SciCall_PositionFromLine(iLineEnd)) {
+		if (iLineEnd - iLineStart >= 1) {
+			iLineEnd--;
 		}
 	}
 
-	if (StrNotEmpty(lpszSelection)) {
-		char *lpszEscSel = static_cast<char *>(NP2HeapAlloc((kMaxBackslashEscapeCount * NP2_FIND_REPLACE_LIMIT)));
-		unsigned option = lpefr->option & ~FindReplaceOption_TransformBackslash;
-		if (AddBackslashA(lpszEscSel, lpszSelection)) {
-			if ((lpefr->fuFlags & SCFIND_REGEXP) == 0) {
-				option |= FindReplaceOption_TransformBackslash;
+	ToggleLineCommentsParam param;
+	param.comment = mszComment;
+	param.cchComment = cchComment;
+	param.commentEnd = commentEnd;
+	param.commentPad = commentPad;
+	param.singleLine = iLineStart == iLineEnd;
+	param.tabsAsSpaces = fvCurFile.bTabsAsSpaces;
+	param.indentWidth = fvCurFile.iTabWidth;
+	param.commentCol = 0;
+
+	// action is decided by first line, comment column is minimum indentation of non-blank lines.
+	// scan the range pointer directly instead of querying indentation for each line.
+	const int tabWidth = SciCall_GetTabWidth();
+	const Sci_Position iStartPos = SciCall_PositionFromLine(iLineStart);
+	const Sci_Position iEndPos = SciCall_PositionFromLine(iLineEnd + 1);
+	{
+		const char *ptr = SciCall_GetRangePointer(iStartPos, iEndPos - iStartPos);
+		const char * const end = ptr + (iEndPos - iStartPos);
+		const char *lineEnd = FindLineEnd(ptr, end);
+		Sci_Position column;
+		Sci_Position indent = LineCommentIndent(ptr, lineEnd - ptr, tabWidth, column);
+		char tchBuf[32];
+		param.deleteComment = IsLineCommented(param, ptr + indent, (lineEnd - ptr) - indent, tchBuf);
+		if ((commentFlag & AutoInsertMask_CommentAtStart) == 0) {
+			Sci_Position iCommentCol = 1024 - 1 - cchComment;
+			while (true) {
+				if (ptr + indent != lineEnd) {
+					iCommentCol = min(iCommentCol, column);
+				}
+				ptr = SkipLineEnd(lineEnd, end);
+				if (ptr == end) {
+					break;
+				}
+				lineEnd = FindLineEnd(ptr, end);
+				indent = LineCommentIndent(ptr, lineEnd - ptr, tabWidth, column);
 			}
+			param.commentCol = iCommentCol;
 		}
+	}
 
-		lpefr->option = option;
-		const UINT cpEdit = SciCall_GetCodePage();
-		SetDlgItemTextA2W(cpEdit, hwnd, IDC_FINDTEXT, lpszEscSel);
-		NP2HeapFree(lpszEscSel);
+	// build all lines into one buffer, then replace them as one block
+	EditLineTransform transform;
+	InitLineTransform(transform, ToggleLineCommentsKernel);
+	transform.lineExtra = cchComment + 1;
+	if (!param.deleteComment && !param.singleLine) {
+		transform.lineExtra += param.commentCol;
 	}
+	transform.tabWidth = tabWidth;
+	transform.param = &param;
+	transform.excludeEndLine = iLineEnd + 1 < SciCall_GetLineCount();
+	EditTransformRange(transform, iStartPos, iEndPos);
 
-	if (lpszSelection != nullptr) {
-		NP2HeapFree(lpszSelection);
+	if (iSelStart != iSelEnd) {
+		Sci_Position iAnchorPos;
+		if (iCurPos == iSelStart) {
+			iCurPos = iLineStart;
+			iAnchorPos = iLineEnd + 1;
+		} else {
+			iAnchorPos = iLineStart;
+			iCurPos = iLineEnd + 1;
+		}
+		iAnchorPos = SciCall_PositionFromLine(iAnchorPos);
+		iCurPos = SciCall_PositionFromLine(iCurPos);
+		SciCall_SetSel(iAnchorPos, iCurPos);
 	}
-	return hasFindText;
+
+	EndWaitCursor();
 }
 
 //=============================================================================
 //
-// EditFindReplaceDlgProc()
+// EditPadWithSpaces()
 //
-static INT_PTR CALLBACK EditFindReplaceDlgProc(HWND hwnd, UINT umsg, WPARAM wParam, LPARAM lParam) noexcept {
-	static const DWORD controlDefinition[] = {
-		DeferCtlMoveX(IDC_RESIZEGRIP2),
-		DeferCtlMoveX(IDOK),
-		DeferCtlSizeX(IDC_FINDTEXT),
-		DeferCtlMoveX(IDC_CLEAR_FIND),
-		DeferCtlMoveX(IDC_FINDPREV),
-		DeferCtlMoveX(IDC_SAVEPOSITION),
-		DeferCtlMoveX(IDC_RESETPOSITION),
-		DeferCtlMoveX(IDC_FINDALL),
-		DeferCtlMoveX(IDC_REPLACEALL),
-		// replace
-		DeferCtlSizeX(IDC_REPLACETEXT),
-		DeferCtlMoveX(IDC_CLEAR_REPLACE),
-		DeferCtlMoveX(IDC_REPLACE),
-		DeferCtlMoveX(IDC_REPLACEINSEL),
-	};
+void EditPadWithSpaces(bool bSkipEmpty, bool bNoUndoGroup) noexcept {
+	Sci_Position iMaxColumn = 0;
+	bool bReducedSelection = false;
 
-	static int bSwitchedFindReplace = 0;
-	static int xFindReplaceDlgSave;
-	static int yFindReplaceDlgSave;
-	static HFONT hFontFindReplaceEdit;
+	Sci_Position iSelStart = 0;
+	Sci_Position iSelEnd = 0;
 
-	WCHAR tch[NP2_FIND_REPLACE_LIMIT + 32];
+	Sci_Line iLineStart = 0;
+	Sci_Line iLineEnd = 0;
 
-	switch (umsg) {
-	case WM_INITDIALOG: {
-		SetWindowLongPtr(hwnd, DWLP_USER, lParam);
-		HWND hwndRepl = GetDlgItem(hwnd, IDC_REPLACETEXT);
-		const DWORD controlCount = hwndRepl ? COUNTOF(controlDefinition) : COUNTOF(controlDefinition) - 4;
-		ResizeDlg_InitX(hwnd, &positionRecord.cxFindReplaceDlg, controlDefinition, controlCount);
+	Sci_Line iRcCurLine = 0;
+	Sci_Line iRcAnchorLine = 0;
+	Sci_Position iRcCurCol = 0;
+	Sci_Position iRcAnchorCol = 0;
 
-		HWND hwndFind = GetDlgItem(hwnd, IDC_FINDTEXT);
-		AddBackslashComboBoxSetup(hwndFind);
+	const bool bIsRectangular = SciCall_IsRectangularSelection();
+	if (!bIsRectangular ) {
+		iSelStart = SciCall_GetSelectionStart();
+		iSelEnd = SciCall_GetSelectionEnd();
 
-		// Load MRUs
-		mruFind.AddToCombobox(hwndFind);
+		iLineStart = SciCall_LineFromPosition(iSelStart);
+		iLineEnd = SciCall_LineFromPosition(iSelEnd);
 
-		EDITFINDREPLACE * const lpefr = AsPointer<EDITFINDREPLACE *>(lParam);
-		// don't copy selection after toggle find & replace on this window.
-		bool hasFindText = false;
-		if (bSwitchedFindReplace != 3) {
-			hasFindText = CopySelectionAsFindText(hwnd, lpefr, true);
+		if (iLineStart == iLineEnd) {
+			iLineStart = 0;
+			iLineEnd = SciCall_GetLineCount() - 1;
+		} else {
+			if (iSelEnd <= SciCall_PositionFromLine(iLineEnd)) {
+				if (iLineEnd - iLineStart >= 1) {
+					iLineEnd--;
+					bReducedSelection = true;
+				}
+			}
 		}
-		if (!GetWindowTextLength(hwndFind)) {
-			SetDlgItemTextA2W(CP_UTF8, hwnd, IDC_FINDTEXT, lpefr->szFindUTF8);
+
+		for (Sci_Line iLine = iLineStart; iLine <= iLineEnd; iLine++) {
+			const Sci_Position iPos = SciCall_GetLineEndPosition(iLine);
+			iMaxColumn = max(iMaxColumn, SciCall_GetColumn(iPos));
 		}
+	} else {
+		const Sci_Position iCurPos = SciCall_GetCurrentPos();
+		const Sci_Position iAnchorPos = SciCall_GetAnchor();
 
-		ComboBox_LimitText(hwndFind, NP2_FIND_REPLACE_LIMIT);
-		ComboBox_SetExtendedUI(hwndFind, TRUE);
+		iRcCurLine = SciCall_LineFromPosition(iCurPos);
+		iRcAnchorLine = SciCall_LineFromPosition(iAnchorPos);
 
-		if (hwndRepl) {
-			AddBackslashComboBoxSetup(hwndRepl);
-			mruReplace.AddToCombobox(hwndRepl);
-			ComboBox_LimitText(hwndRepl, NP2_FIND_REPLACE_LIMIT);
-			ComboBox_SetExtendedUI(hwndRepl, TRUE);
-			SetDlgItemTextA2W(CP_UTF8, hwnd, IDC_REPLACETEXT, lpefr->szReplaceUTF8);
-		}
+		iRcCurCol = SciCall_GetColumn(iCurPos);
+		iRcAnchorCol = SciCall_GetColumn(iAnchorPos);
 
-		// focus on replace box when selected text is not empty.
-		PostMessage(hwnd, WM_NEXTDLGCTL, AsInteger<WPARAM>((hasFindText && hwndRepl)? hwndRepl : hwndFind), TRUE);
+		iLineStart = min(iRcCurLine, iRcAnchorLine);
+		iLineEnd = max(iRcCurLine, iRcAnchorLine);
+	}
 
-		unsigned mask = lpefr->fuFlags;
-		if (mask & SCFIND_MATCHCASE) {
-			CheckDlgButton(hwnd, IDC_FINDCASE, BST_CHECKED);
-		}
-		if (mask & SCFIND_WHOLEWORD) {
-			CheckDlgButton(hwnd, IDC_FINDWORD, BST_CHECKED);
-		}
-		if (mask & SCFIND_WORDSTART) {
-			CheckDlgButton(hwnd, IDC_FINDSTART, BST_CHECKED);
-		}
-		if (mask & SCFIND_REGEXP) {
-			CheckDlgButton(hwnd, IDC_FINDREGEXP, BST_CHECKED);
-		}
-		if (mask & SCFIND_REGEX_DOT_ALL) {
-			CheckDlgButton(hwnd, IDC_FIND_DOTALL, BST_CHECKED);
+	// lines ends inside the rectangular selection, found before the selection is collapsed.
+	uint8_t *pPadLines = nullptr;
+	if (bIsRectangular) {
+		pPadLines = static_cast<uint8_t *>(NP2HeapAlloc(iLineEnd - iLineStart + 1));
+		for (Sci_Line iLine = iLineStart; iLine <= iLineEnd; iLine++) {
+			const Sci_Position iLineSelEndPos = SciCall_GetLineSelEndPosition(iLine);
+			if (iLineSelEndPos >= 0) {
+				iMaxColumn = max(iMaxColumn, SciCall_GetColumn(iLineSelEndPos));
+				pPadLines[iLine - iLineStart] = SciCall_GetLineEndPosition(iLine) <= iLineSelEndPos;
+			}
 		}
+	}
 
-		mask = lpefr->option;
-		if (mask & FindReplaceOption_TransformBackslash) {
-			CheckDlgButton(hwnd, IDC_FINDTRANSFORMBS, BST_CHECKED);
-		}
-		if (mask & FindReplaceOption_WildcardSearch) {
-			CheckDlgButton(hwnd, IDC_WILDCARDSEARCH, BST_CHECKED);
-			CheckDlgButton(hwnd, IDC_FINDREGEXP, BST_UNCHECKED);
+	char *pmszPadStr = static_cast<char *>(NP2HeapAlloc((iMaxColumn + 1) * sizeof(char)));
+	if (pmszPadStr) {
+		memset(pmszPadStr, ' ', iMaxColumn);
+		// one notification for all lines, selection is restored after padding.
+		SciCall_BeginBatchUpdate(bNoUndoGroup);
+		if (bIsRectangular) {
+			const Sci_Position iCurPos = SciCall_GetCurrentPos();
+			SciCall_SetSelection(iCurPos, iCurPos);
 		}
-		if (mask & FindReplaceOption_NoFindWrap) {
-			CheckDlgButton(hwnd, IDC_NOWRAP, BST_CHECKED);
+
+		for (Sci_Line iLine = iLineStart; iLine <= iLineEnd; iLine++) {
+			if (bIsRectangular && !pPadLines[iLine - iLineStart]) {
+				continue;
+			}
+
+			const Sci_Position iPos = SciCall_GetLineEndPosition(iLine);
+			if (bSkipEmpty && SciCall_PositionFromLine(iLine) >= iPos) {
+				continue;
+			}
+
+			const Sci_Position iPadLen = iMaxColumn - SciCall_GetColumn(iPos);
+
+			SciCall_SetTargetRange(iPos, iPos);
+			SciCall_ReplaceTarget(iPadLen, pmszPadStr);
 		}
 
-		int bCloseDlg;
-		if (hwndRepl) {
-			bCloseDlg = bSwitchedFindReplace ? FindReplaceOption_CloseFind : FindReplaceOption_CloseReplace;
+		NP2HeapFree(pmszPadStr);
+		SciCall_EndBatchUpdate(bNoUndoGroup);
+	}
+	if (pPadLines != nullptr) {
+		NP2HeapFree(pPadLines);
+	}
+
+	if (!bIsRectangular && SciCall_LineFromPosition(iSelStart) != SciCall_LineFromPosition(iSelEnd)) {
+		Sci_Position iCurPos = SciCall_GetCurrentPos();
+		Sci_Position iAnchorPos = SciCall_GetAnchor();
+		iRcCurCol = SciCall_PositionFromLine(iLineStart);
+		if (!bReducedSelection) {
+			iRcAnchorCol = SciCall_GetLineEndPosition(iLineEnd);
 		} else {
-			bCloseDlg = bSwitchedFindReplace ? FindReplaceOption_CloseReplace : FindReplaceOption_CloseFind;
+			iRcAnchorCol = SciCall_PositionFromLine(iLineEnd + 1);
 		}
-		if (mask & bCloseDlg) {
-			CheckDlgButton(hwnd, IDC_FINDCLOSE, BST_CHECKED);
+		if (iCurPos < iAnchorPos) {
+			iCurPos = iRcCurCol;
+			iAnchorPos = iRcAnchorCol;
+		} else {
+			iAnchorPos = iRcCurCol;
+			iCurPos = iRcAnchorCol;
 		}
+		SciCall_SetSel(iAnchorPos, iCurPos);
+	} else if (bIsRectangular) {
+		const Sci_Position iCurPos = SciCall_FindColumn(iRcCurLine, iRcCurCol);
+		const Sci_Position iAnchorPos = SciCall_FindColumn(iRcAnchorLine, iRcAnchorCol);
 
-		if (!bSwitchedFindReplace) {
-			if (positionRecord.xFindReplaceDlg == 0 || positionRecord.yFindReplaceDlg == 0) {
-				CenterDlgInParent(hwnd);
-			} else {
-				SetDlgPos(hwnd, positionRecord.xFindReplaceDlg, positionRecord.yFindReplaceDlg);
-			}
-		} else {
-			bSwitchedFindReplace = 0;
-			SetDlgPos(hwnd, xFindReplaceDlgSave, yFindReplaceDlgSave);
+		SciCall_SetRectangularSelectionCaret(iCurPos);
+		SciCall_SetRectangularSelectionAnchor(iAnchorPos);
+	}
+}
+
+//=============================================================================
+//
+// EditStripFirstCharacter()
+//
+void EditStripFirstCharacter() noexcept {
+	if (SciCall_IsRectangularSelection()) {
+		NotifyRectangularSelection();
+		return;
+	}
+
+	const Sci_Position iSelStart = SciCall_GetSelectionStart();
+	const Sci_Position iSelEnd = SciCall_GetSelectionEnd();
+
+	Sci_Line iLineStart = SciCall_LineFromPosition(iSelStart);
+	Sci_Line iLineEnd = SciCall_LineFromPosition(iSelEnd);
+
+	if (iLineStart != iLineEnd) {
+		if (iSelStart > SciCall_PositionFromLine(iLineStart)) {
+			iLineStart++;
 		}
 
-		mask = iFindReplaceOption;
-		if (mask & FindReplaceOption_UseCxxRegex) {
-			CheckDlgButton(hwnd, IDC_FIND_CXXREGEX, BST_CHECKED);
+		if (iSelEnd <= SciCall_PositionFromLine(iLineEnd)) {
+			iLineEnd--;
 		}
-		if (mask & FindReplaceOption_TransparentMode) {
-			CheckDlgButton(hwnd, IDC_TRANSPARENT, BST_CHECKED);
+	}
+
+	SciCall_BeginUndoAction();
+	for (Sci_Line iLine = iLineStart; iLine <= iLineEnd; iLine++) {
+		const Sci_Position iPos = SciCall_PositionFromLine(iLine);
+		if (SciCall_GetLineEndPosition(iLine) > iPos) {
+			SciCall_DeleteRange(iPos, SciCall_PositionAfter(iPos) - iPos);
 		}
-		if (mask & FindReplaceOption_FindAllBookmark) {
-			CheckDlgButton(hwnd, IDC_FINDALLBOOKMARK, BST_CHECKED);
+	}
+	SciCall_EndUndoAction();
+}
+
+//=============================================================================
+//
+// EditStripLastCharacter()
+//
+void EditStripLastCharacter() noexcept {
+	if (SciCall_IsRectangularSelection()) {
+		NotifyRectangularSelection();
+		return;
+	}
+
+	const Sci_Position iSelStart = SciCall_GetSelectionStart();
+	const Sci_Position iSelEnd = SciCall_GetSelectionEnd();
+
+	Sci_Line iLineStart = SciCall_LineFromPosition(iSelStart);
+	Sci_Line iLineEnd = SciCall_LineFromPosition(iSelEnd);
+
+	if (iLineStart != iLineEnd) {
+		if (iSelStart >= SciCall_GetLineEndPosition(iLineStart)) {
+			iLineStart++;
 		}
-		if (mask & FindReplaceOption_UseMonospacedFont) {
-			CheckDlgButton(hwnd, IDC_USEMONOSPACEDFONT, BST_CHECKED);
-			FindReplaceSetFont(hwnd, TRUE, &hFontFindReplaceEdit);
+
+		if (iSelEnd < SciCall_GetLineEndPosition(iLineEnd)) {
+			iLineEnd--;
 		}
 	}
-	return TRUE;
 
-	case APPM_COPYDATA: {
-		HWND hwndFind = GetDlgItem(hwnd, IDC_FINDTEXT);
-		HWND hwndRepl = GetDlgItem(hwnd, IDC_REPLACETEXT);
-		EDITFINDREPLACE * const lpefr = AsPointer<EDITFINDREPLACE *>(GetWindowLongPtr(hwnd, DWLP_USER));
+	SciCall_BeginUndoAction();
+	for (Sci_Line iLine = iLineStart; iLine <= iLineEnd; iLine++) {
+		const Sci_Position iStartPos = SciCall_PositionFromLine(iLine);
+		const Sci_Position iEndPos = SciCall_GetLineEndPosition(iLine);
 
-		const bool hasFindText = CopySelectionAsFindText(hwnd, lpefr, false);
-		if (!GetWindowTextLength(hwndFind)) {
-			SetDlgItemTextA2W(CP_UTF8, hwnd, IDC_FINDTEXT, lpefr->szFindUTF8);
+		if (iEndPos > iStartPos) {
+			const Sci_Position iPos = SciCall_PositionBefore(iEndPos);
+			SciCall_DeleteRange(iPos, iEndPos - iPos);
 		}
-		CheckDlgButton(hwnd, IDC_FINDTRANSFORMBS, (lpefr->option & FindReplaceOption_TransformBackslash) ? BST_CHECKED : BST_UNCHECKED);
-		// focus on replace box when selected text is not empty.
-		PostMessage(hwnd, WM_NEXTDLGCTL, AsInteger<WPARAM>((hasFindText && hwndRepl)? hwndRepl : hwndFind), TRUE);
 	}
-	break;
+	SciCall_EndUndoAction();
+}
 
-	case WM_DESTROY:
+//=============================================================================
+//
+// EditStripTrailingBlanks()
+//
+static Sci_Position StripTrailingBlanksKernel(const EditLineTransform &/*transform*/, LineTransformLine &line, char *pszOut) noexcept {
+	Sci_Position length = line.length;
+	while (length != 0 && IsASpaceOrTab(line.text[length - 1])) {
+		length--;
+	}
+	memcpy(pszOut, line.text, length);
+	return length;
+}
+
+void EditStripTrailingBlanks(HWND hwnd, bool bIgnoreSelection) noexcept {
+	// Check if there is any selection... simply use a regular expression replace!
+	if (!bIgnoreSelection && !SciCall_IsSelectionEmpty()) {
+		if (!SciCall_IsRectangularSelection()) {
+			EDITFINDREPLACE * const efrTrim = static_cast<EDITFINDREPLACE *>(NP2HeapAlloc(sizeof(EDITFINDREPLACE)));
+			efrTrim->hwnd = hwnd;
+			efrTrim->fuFlags = SCFIND_REGEXP;
+			memcpy(efrTrim->szFind, "[ \t]+$", CSTRLEN("[ \t]+$"));
+			EditReplaceAllInSelection(hwnd, efrTrim, EditReplaceAllFlag_UndoGroup);
+			NP2HeapFree(efrTrim);
+			return;
+		}
+	}
+
+	// strip lines into buffer, then replace changed lines as one block,
+	// instead of a deletion (and undo action) for every line.
+	EditLineTransform transform;
+	InitLineTransform(transform, StripTrailingBlanksKernel);
+	if (EditTransformRange(transform, 0, SciCall_GetLength()) && !SciCall_IsRectangularSelection()) {
+		SciCall_SetSel(transform.position[1], transform.position[0]);
+	}
+}
+
+//=============================================================================
+//
+// EditStripLeadingBlanks()
+//
+static Sci_Position StripLeadingBlanksKernel(const EditLineTransform &/*transform*/, LineTransformLine &line, char *pszOut) noexcept {
+	Sci_Position skipped = 0;
+	while (skipped < line.length && IsASpaceOrTab(line.text[skipped])) {
+		skipped++;
+	}
+	line.skipped = skipped;
+	memcpy(pszOut, line.text + skipped, line.length - skipped);
+	return line.length - skipped;
+}
+
+void EditStripLeadingBlanks(HWND hwnd, bool bIgnoreSelection) noexcept {
+	// Check if there is any selection... simply use a regular expression replace!
+	if (!bIgnoreSelection && !SciCall_IsSelectionEmpty()) {
+		if (!SciCall_IsRectangularSelection()) {
+			EDITFINDREPLACE * const efrTrim = static_cast<EDITFINDREPLACE *>(NP2HeapAlloc(sizeof(EDITFINDREPLACE)));
+			efrTrim->hwnd = hwnd;
+			efrTrim->fuFlags = SCFIND_REGEXP;
+			memcpy(efrTrim->szFind, "^[ \t]+", CSTRLEN("^[ \t]+"));
+			EditReplaceAllInSelection(hwnd, efrTrim, EditReplaceAllFlag_UndoGroup);
+			NP2HeapFree(efrTrim);
+			return;
+		}
+	}
+
+	EditLineTransform transform;
+	InitLineTransform(transform, StripLeadingBlanksKernel);
+	if (EditTransformRange(transform, 0, SciCall_GetLength()) && !SciCall_IsRectangularSelection()) {
+		SciCall_SetSel(transform.position[1], transform.position[0]);
+	}
+}
+
+//=============================================================================
+//
+// EditCompressSpaces()
+//
+void EditCompressSpaces() noexcept {
+	if (SciCall_IsRectangularSelection()) {
+		NotifyRectangularSelection();
+		return;
+	}
+
+	Sci_Position iSelStart = SciCall_GetSelectionStart();
+	Sci_Position iSelEnd = SciCall_GetSelectionEnd();
+	const Sci_Position iLength = SciCall_GetLength();
+	Sci_Position iSelCount;
+	char *pszIn;
+	char chPrev = '\n';
+	char chNext = '\n';
+
+	if (iSelStart == iSelEnd) {
+		iSelStart = 0;
+		iSelEnd = iLength;
+		iSelCount = iLength;
+		pszIn = static_cast<char *>(NP2HeapAlloc(iSelCount + 2));
+		SciCall_GetText(iSelCount, pszIn);
+	} else {
+		iSelCount = SciCall_GetSelTextLength();
+		pszIn = static_cast<char *>(NP2HeapAlloc(iSelCount + 2));
+		SciCall_GetSelText(pszIn);
+		if (iSelEnd < iLength) {
+			chNext = static_cast<char>(SciCall_GetCharAt(iSelEnd));
+		}
+		if (iSelStart != 0) {
+			chPrev = static_cast<char>(SciCall_GetCharAt(iSelStart - 1));
+		}
+	}
+
+	pszIn[iSelCount] = chNext;
+	const char * const end = pszIn + iSelCount;
+	char *co = pszIn;
+	bool bModified = false;
+	for (const char *ci = pszIn; ci < end;) {
+		const char ch = *ci++;
+		if (ch != ' ' && ch != '\t') {
+			chPrev = ch;
+			*co++ = ch;
+		} else if (chPrev != '\n' && chPrev != '\r') {
+			while (ci < end && (*ci == ' ' || *ci == '\t')) {
+				++ci;
+			}
+			if (*ci != '\n' && *ci != '\r') {
+				chPrev = ' ';
+				*co++ = ' ';
+				if (ch == '\t') {
+					bModified = true;
+				}
+			}
+		}
+	}
+
+	if (bModified || co < end) {
+		*co = '\0';
+		iSelCount = co - pszIn;
+		EditReplaceRange(iSelStart, iSelEnd, iSelCount, pszIn);
+	}
+	NP2HeapFree(pszIn);
+}
+
+//=============================================================================
+//
+// EditRemoveBlankLines()
+//
+static inline bool IsBlankLineText(const char *text, Sci_Position length) noexcept {
+	for (Sci_Position index = 0; index < length; index++) {
+		if (!IsASpaceOrTab(text[index])) {
+			return false;
+		}
+	}
+	return true;
+}
+
+static Sci_Position RemoveBlankLinesKernel(const EditLineTransform &transform, LineTransformLine &line, char *pszOut) noexcept {
+	if (IsBlankLineText(line.text, line.length)) {
+		// merge keeps last line of the blank block
+		if (!transform.option || (line.nextText != nullptr && IsBlankLineText(line.nextText, line.nextLength))) {
+			return -1;
+		}
+	}
+	memcpy(pszOut, line.text, line.length);
+	return line.length;
+}
+
+void EditRemoveBlankLines(bool bMerge) noexcept {
+	if (SciCall_IsRectangularSelection()) {
+		NotifyRectangularSelection();
+		return;
+	}
+
+	Sci_Position iSelStart = SciCall_GetSelectionStart();
+	Sci_Position iSelEnd = SciCall_GetSelectionEnd();
+
+	if (iSelStart == iSelEnd) {
+		iSelStart = 0;
+		iSelEnd = SciCall_GetLength();
+	}
+
+	Sci_Line iLineStart = SciCall_LineFromPosition(iSelStart);
+	Sci_Line iLineEnd = SciCall_LineFromPosition(iSelEnd);
+
+	if (iSelStart > SciCall_PositionFromLine(iLineStart)) {
+		iLineStart++;
+	}
+
+	if (iSelEnd <= SciCall_PositionFromLine(iLineEnd) && iLineEnd != SciCall_GetLineCount() - 1) {
+		iLineEnd--;
+	}
+	if (iLineStart > iLineEnd) {
+		return;
+	}
+
+	EditLineTransform transform;
+	InitLineTransform(transform, RemoveBlankLinesKernel);
+	transform.option = bMerge;
+	transform.excludeEndLine = iLineEnd + 1 < SciCall_GetLineCount();
+	if (EditTransformRange(transform, SciCall_PositionFromLine(iLineStart), SciCall_PositionFromLine(iLineEnd + 1))) {
+		SciCall_SetSel(transform.position[1], transform.position[0]);
+	}
+}
+
+//=============================================================================
+//
+// EditWrapToColumn()
+//
+namespace {
+
+struct EditWrapParam {
+	int column;
+	int eolLength;
+	char eol[4];
+};
+
+// whitespace is collapsed, a word is moved to next line when it exceeds the column.
+Sci_Position WrapToColumnKernel(const EditLineTransform &transform, LineTransformLine &line, char *pszOut) noexcept {
+	const EditWrapParam &param = *static_cast<const EditWrapParam *>(transform.param);
+	const char * const text = line.text;
+	const Sci_Position length = line.length;
+	char *out = pszOut;
+	int column = 0;
+	Sci_Position index = 0;
+	while (index < length) {
+		if (IsASpaceOrTab(text[index])) {
+			do {
+				++index;
+			} while (index < length && IsASpaceOrTab(text[index]));
+
+			int width = 0;
+			Sci_Position wordEnd = index;
+			while (wordEnd < length && !IsASpace(static_cast<uint8_t>(text[wordEnd]))) {
+				width += LineTransformCharColumns(transform, text, wordEnd, length);
+			}
+			if (width != 0) {
+				if (column + width + 1 > param.column) {
+					memcpy(out, param.eol, param.eolLength);
+					out += param.eolLength;
+					column = 0;
+				} else if (column != 0) {
+					*out++ = ' ';
+					column++;
+				}
+			}
+		} else {
+			const Sci_Position begin = index;
+			column += LineTransformCharColumns(transform, text, index, length);
+			memcpy(out, text + begin, index - begin);
+			out += index - begin;
+		}
+	}
+	return out - pszOut;
+}
+
+}
+
+void EditWrapToColumn(int nColumn/*, int nTabWidth*/) noexcept {
+	if (SciCall_IsSelectionEmpty()) {
+		return;
+	}
+	if (SciCall_IsRectangularSelection()) {
+		NotifyRectangularSelection();
+		return;
+	}
+
+	Sci_Position iSelStart = SciCall_GetSelectionStart();
+	const Sci_Position iSelEnd = SciCall_GetSelectionEnd();
+
+	const Sci_Line iLine = SciCall_LineFromPosition(iSelStart);
+	iSelStart = SciCall_PositionFromLine(iLine);
+
+	const unsigned iEOLMode = SciCall_GetEOLMode();
+	unsigned szEOL = '\r' | ('\n' << 8);
+	szEOL >>= 8*(iEOLMode >> 1);
+
+	EditWrapParam param;
+	param.column = nColumn;
+	param.eolLength = (iEOLMode == SC_EOL_CRLF) ? 2 : 1;
+	memcpy(param.eol, &szEOL, sizeof(szEOL));
+
+	EditLineTransform transform;
+	InitLineTransform(transform, WrapToColumnKernel);
+	// each whitespace is replaced with at most one line ending
+	transform.growth = param.eolLength;
+	transform.param = &param;
+	const TempArenaScope arenaScope;
+	Sci_Position cchText = 0;
+	char * const pszText = EditTransformLines(transform, iSelStart, iSelEnd, cchText);
+	if (pszText != nullptr) {
+		EditReplaceRange(iSelStart, iSelEnd, cchText, pszText);
+	}
+}
+
+//=============================================================================
+//
+// EditJoinLinesEx()
+//
+namespace {
+
+struct JoinLinesPart {
+	const char *text;
+	Sci_Position start;
+	Sci_Position end;
+	bool paragraph;		// part starts with a paragraph after blank lines
+	int eolLength;
+	const char *eol;
+	char *output;
+	Sci_Position outLength;
+};
+
+// find first line after blank lines that follows text in [start, end), returns end when not found.
+Sci_Position FindParagraphStart(const char *text, Sci_Position start, Sci_Position end) noexcept {
+	const char *ptr = text + start;
+	const char * const stop = text + end;
+	bool seenText = false;
+	bool blank = false;
+	ptr = SkipLineEnd(FindLineEnd(ptr, stop), stop);
+	while (ptr < stop) {
+		const char * const lineEnd = FindLineEnd(ptr, stop);
+		if (lineEnd == ptr) {
+			blank = seenText;
+		} else {
+			if (blank) {
+				return ptr - text;
+			}
+			seenText = true;
+		}
+		ptr = SkipLineEnd(lineEnd, stop);
+	}
+	return end;
+}
+
+// single line break is joined with a space, blank lines are merged into one paragraph break.
+DWORD WINAPI EditJoinLinesThread(LPVOID lpParam) noexcept {
+	JoinLinesPart &part = *static_cast<JoinLinesPart *>(lpParam);
+	const char * const end = part.text + part.end;
+	const char *ptr = part.text + part.start;
+	char * const output = part.output;
+	char *out = output;
+	if (part.paragraph) {
+		memcpy(out, part.eol, part.eolLength);
+		memcpy(out + part.eolLength, part.eol, part.eolLength);
+		out += 2*part.eolLength;
+	}
+	while (ptr < end) {
+		const char * const lineEnd = FindLineEnd(ptr, end);
+		memcpy(out, ptr, lineEnd - ptr);
+		out += lineEnd - ptr;
+		if (lineEnd == end) {
+			break;
+		}
+		ptr = SkipLineEnd(lineEnd, end);
+		if (ptr < end && !IsEOLChar(*ptr)) {
+			*out++ = ' ';
+		} else {
+			while (ptr < end && IsEOLChar(*ptr)) {
+				++ptr;
+			}
+			if (ptr < end) {
+				if (out != output) {
+					memcpy(out, part.eol, part.eolLength);
+					out += part.eolLength;
+				}
+				memcpy(out, part.eol, part.eolLength);
+				out += part.eolLength;
+			}
+		}
+	}
+	part.outLength = out - output;
+	return 0;
+}
+
+}
+
+void EditJoinLinesEx() noexcept {
+	if (SciCall_IsSelectionEmpty()) {
+		return;
+	}
+	if (SciCall_IsRectangularSelection()) {
+		NotifyRectangularSelection();
+		return;
+	}
+
+	Sci_Position iSelStart = SciCall_GetSelectionStart();
+	const Sci_Position iSelEnd = SciCall_GetSelectionEnd();
+	const Sci_Line iLine = SciCall_LineFromPosition(iSelStart);
+	iSelStart = SciCall_PositionFromLine(iLine);
+
+	const unsigned iEOLMode = SciCall_GetEOLMode();
+	unsigned szEOL = '\r' | ('\n' << 8);
+	szEOL >>= 8*(iEOLMode >> 1);
+	char eol[4];
+	memcpy(eol, &szEOL, sizeof(szEOL));
+	const int eolLength = (iEOLMode == SC_EOL_CRLF) ? 2 : 1;
+
+	const Sci_Position length = iSelEnd - iSelStart;
+	const char * const pszText = SciCall_GetRangePointer(iSelStart, length);
+	SYSTEM_INFO info;
+	GetSystemInfo(&info);
+	UINT partCount = static_cast<UINT>(min<Sci_Position>(info.dwNumberOfProcessors, length / NP2_PARALLEL_TRANSFORM_MIN_SIZE));
+	partCount = clamp<UINT>(partCount, 1, MAX_PARALLEL_WORKER_COUNT);
+
+	// split on paragraph boundaries, output of each part is independent
+	JoinLinesPart parts[MAX_PARALLEL_WORKER_COUNT];
+	Sci_Position offsets[MAX_PARALLEL_WORKER_COUNT];
+	UINT count = 0;
+	Sci_Position start = 0;
+	Sci_Position capacity = 0;
+	for (UINT i = 1; i <= partCount; i++) {
+		Sci_Position end = length;
+		if (i < partCount) {
+			const Sci_Position limit = length/partCount*(i + 1);
+			end = FindParagraphStart(pszText, max(start, length/partCount*i), limit);
+			if (end == limit) {
+				continue;
+			}
+		}
+		JoinLinesPart &part = parts[count];
+		part.text = pszText;
+		part.start = start;
+		part.end = end;
+		part.paragraph = start != 0;
+		part.eolLength = eolLength;
+		part.eol = eol;
+		part.outLength = 0;
+		// each line ending sequence is replaced by at most two line endings
+		offsets[count] = capacity;
+		capacity += (end - start)*eolLength + 2*eolLength;
+		start = end;
+		count++;
+	}
+
+	char * const pszJoin = static_cast<char *>(NP2HeapAlloc(capacity + 1));
+	if (pszJoin == nullptr) {
+		return;
+	}
+	for (UINT i = 0; i < count; i++) {
+		parts[i].output = pszJoin + offsets[i];
+	}
+	RunParallelWorker(EditJoinLinesThread, parts, sizeof(JoinLinesPart), count);
+
+	Sci_Position cchJoin = 0;
+	for (UINT i = 0; i < count; i++) {
+		const JoinLinesPart &part = parts[i];
+		if (part.output != pszJoin + cchJoin) {
+			memmove(pszJoin + cchJoin, part.output, part.outLength);
+		}
+		cchJoin += part.outLength;
+	}
+
+	if (cchJoin != length || memcmp(pszJoin, pszText, length) != 0) {
+		EditReplaceRange(iSelStart, iSelEnd, cchJoin, pszJoin);
+	}
+	NP2HeapFree(pszJoin);
+}
+
+//=============================================================================
+//
+// EditSortLines()
+//
+#define NP2_PARALLEL_SORT_MIN_LINES	(64*1024)
+
+namespace {
+
+struct SORTLINE {
+	uint64_t sortKey;	// leading characters of pwszSortEntry, zero for logical number sort
+	LPCWSTR pwszLine;
+	LPCWSTR pwszSortEntry;
+	LPCWSTR pwszSortLine;
+	int iLine;
+	EditSortFlag iSortFlags;
+};
+
+int __cdecl CmpSortLine(const void *p1, const void *p2) noexcept {
+	const SORTLINE *s1 = static_cast<const SORTLINE *>(p1);
+	const SORTLINE *s2 = static_cast<const SORTLINE *>(p2);
+	const EditSortFlag iSortFlags = s1->iSortFlags;
+	int cmp = 0;
+	if (iSortFlags & EditSortFlag_LogicalNumber) {
+		cmp = StrCmpLogicalW(s1->pwszSortEntry, s2->pwszSortEntry);
+		if (cmp == 0 && (iSortFlags & (EditSortFlag_ColumnSort | EditSortFlag_GroupByFileType))) {
+			cmp = StrCmpLogicalW(s1->pwszSortLine, s2->pwszSortLine);
+		}
+	}
+	if (cmp == 0) {
+		cmp = wcscmp(s1->pwszSortEntry, s2->pwszSortEntry);
+		if (cmp == 0 && (iSortFlags & (EditSortFlag_ColumnSort | EditSortFlag_GroupByFileType))) {
+			cmp = wcscmp(s1->pwszSortLine, s2->pwszSortLine);
+		}
+		if (cmp == 0) {
+			// stable sort for duplicate lines
+			cmp = s1->iLine - s2->iLine;
+			if (iSortFlags & EditSortFlag_MergeDuplicate) {
+				cmp = -cmp; // reverse order to keep first line
+			}
+		}
+	}
+	if (iSortFlags & EditSortFlag_Descending) {
+		cmp = -cmp;
+	}
+	return cmp;
+}
+
+int __cdecl DontSortLine(const void *p1, const void *p2) noexcept {
+	const SORTLINE *s1 = static_cast<const SORTLINE *>(p1);
+	const SORTLINE *s2 = static_cast<const SORTLINE *>(p2);
+	return s1->iLine - s2->iLine;
+}
+
+// first 4 UTF-16 code units in wcscmp() order
+uint64_t SortLineKey(LPCWSTR pwszSortEntry, EditSortFlag iSortFlags) noexcept {
+	if (iSortFlags & EditSortFlag_LogicalNumber) {
+		return 0;
+	}
+	uint64_t key = 0;
+	for (UINT i = 0; i < 4; i++) {
+		key <<= 16;
+		if (*pwszSortEntry) {
+			key |= static_cast<uint16_t>(*pwszSortEntry++);
+		}
+	}
+	return (iSortFlags & EditSortFlag_Descending) ? ~key : key;
+}
+
+inline int SortLineCompare(const SORTLINE &s1, const SORTLINE &s2) noexcept {
+	if (s1.sortKey != s2.sortKey) {
+		return (s1.sortKey < s2.sortKey) ? -1 : 1;
+	}
+	return CmpSortLine(&s1, &s2);
+}
+
+int __cdecl CmpSortLineKey(const void *p1, const void *p2) noexcept {
+	return SortLineCompare(*static_cast<const SORTLINE *>(p1), *static_cast<const SORTLINE *>(p2));
+}
+
+// LSD radix sort on sort key, then sort lines with same key.
+void SortLinesRange(SORTLINE *pLines, SORTLINE *temp, size_t count) noexcept {
+	if (pLines[0].iSortFlags & EditSortFlag_LogicalNumber) {
+		qsort(pLines, count, sizeof(SORTLINE), CmpSortLine);
+		return;
+	}
+
+	SORTLINE *source = pLines;
+	for (UINT shift = 0; shift < 64; shift += 8) {
+		size_t counts[256]{};
+		for (size_t i = 0; i < count; i++) {
+			counts[(source[i].sortKey >> shift) & 0xff]++;
+		}
+		if (counts[(source[0].sortKey >> shift) & 0xff] == count) {
+			continue;
+		}
+		size_t total = 0;
+		for (size_t &value : counts) {
+			const size_t start = total;
+			total += value;
+			value = start;
+		}
+		for (size_t i = 0; i < count; i++) {
+			const SORTLINE &line = source[i];
+			temp[counts[(line.sortKey >> shift) & 0xff]++] = line;
+		}
+		SORTLINE * const sorted = temp;
+		temp = source;
+		source = sorted;
+	}
+	if (source != pLines) {
+		memcpy(pLines, source, count*sizeof(SORTLINE));
+	}
+
+	size_t start = 0;
+	while (start < count) {
+		const uint64_t sortKey = pLines[start].sortKey;
+		size_t end = start + 1;
+		while (end < count && pLines[end].sortKey == sortKey) {
+			++end;
+		}
+		if (end - start > 1) {
+			qsort(pLines + start, end - start, sizeof(SORTLINE), CmpSortLine);
+		}
+		start = end;
+	}
+}
+
+struct SortLinesPart {
+	SORTLINE *pLines;
+	SORTLINE *temp;		// scratch buffer when sorting, output when merging
+	size_t count;
+	size_t mergeCount;	// lines in second run to merge, zero for sorting
+};
+
+DWORD WINAPI EditSortLinesThread(LPVOID lpParam) noexcept {
+	const SortLinesPart * const part = static_cast<const SortLinesPart *>(lpParam);
+	if (part->mergeCount == 0) {
+		SortLinesRange(part->pLines, part->temp, part->count);
+	} else {
+		const SORTLINE *first = part->pLines;
+		const SORTLINE * const firstEnd = first + part->count;
+		const SORTLINE *second = firstEnd;
+		const SORTLINE * const secondEnd = second + part->mergeCount;
+		SORTLINE *output = part->temp;
+		while (first < firstEnd && second < secondEnd) {
+			if (SortLineCompare(*second, *first) < 0) {
+				*output++ = *second++;
+			} else {
+				*output++ = *first++;
+			}
+		}
+		memcpy(output, first, (firstEnd - first)*sizeof(SORTLINE));
+		output += firstEnd - first;
+		memcpy(output, second, (secondEnd - second)*sizeof(SORTLINE));
+	}
+	return 0;
+}
+
+// sort parts on worker threads, then merge pairs of sorted parts until one remains.
+void EditSortLinesParallel(SORTLINE *pLines, size_t count) noexcept {
+	const TempArenaScope arenaScope;
+	SORTLINE * const buffer = static_cast<SORTLINE *>(TempArenaAlloc(count*sizeof(SORTLINE)));
+	if (buffer == nullptr) {
+		qsort(pLines, count, sizeof(SORTLINE), CmpSortLineKey);
+		return;
+	}
+
+	SYSTEM_INFO info;
+	GetSystemInfo(&info);
+	UINT partCount = static_cast<UINT>(min<size_t>(info.dwNumberOfProcessors, count / NP2_PARALLEL_SORT_MIN_LINES));
+	partCount = clamp<UINT>(partCount, 1, MAX_PARALLEL_WORKER_COUNT);
+
+	SortLinesPart parts[MAX_PARALLEL_WORKER_COUNT];
+	size_t starts[MAX_PARALLEL_WORKER_COUNT + 1];
+	for (UINT i = 0; i < partCount; i++) {
+		starts[i] = count*i / partCount;
+	}
+	starts[partCount] = count;
+	for (UINT i = 0; i < partCount; i++) {
+		parts[i] = { pLines + starts[i], buffer + starts[i], starts[i + 1] - starts[i], 0 };
+	}
+	RunParallelWorker(EditSortLinesThread, parts, sizeof(SortLinesPart), partCount);
+
+	SORTLINE *source = pLines;
+	SORTLINE *output = buffer;
+	while (partCount > 1) {
+		UINT mergeCount = 0;
+		for (UINT i = 0; i + 1 < partCount; i += 2) {
+			parts[mergeCount] = { source + starts[i], output + starts[i], starts[i + 1] - starts[i], starts[i + 2] - starts[i + 1] };
+			starts[mergeCount++] = starts[i];
+		}
+		RunParallelWorker(EditSortLinesThread, parts, sizeof(SortLinesPart), mergeCount);
+		if (partCount & 1) {
+			const size_t start = starts[partCount - 1];
+			memcpy(output + start, source + start, (count - start)*sizeof(SORTLINE));
+			starts[mergeCount++] = start;
+		}
+		starts[mergeCount] = count;
+		partCount = mergeCount;
+		SORTLINE * const sorted = output;
+		output = source;
+		source = sorted;
+	}
+	if (source != pLines) {
+		memcpy(pLines, source, count*sizeof(SORTLINE));
+	}
+}
+
+uint64_t HashLineText(const char *pszLine, size_t length) noexcept {
+	uint64_t hash = length*UINT64_C(0x9E3779B97F4A7C15);
+	while (length != 0) {
+		uint64_t value = 0;
+		const size_t size = min<size_t>(length, sizeof(uint64_t));
+		memcpy(&value, pszLine, size);
+		pszLine += size;
+		length -= size;
+		hash = (hash ^ value)*UINT64_C(0xFF51AFD7ED558CCD);
+		hash ^= hash >> 32;
+	}
+	return hash;
+}
+
+struct UniqueLineGroup {
+	uint64_t hash;
+	Sci_Position start;		// first line with same text, relative to target start
+	Sci_Position length;	// line length without EOL
+	UINT count;
+};
+
+// lines are kept in document order, group same lines with hash table over document text
+// instead of sorting converted lines. returns false when out of memory.
+bool EditUniqueLines(EditSortFlag iSortFlags, Sci_Line iLineStart, Sci_Line iLineCount, bool bAnchorAfterCaret) noexcept {
+	const Sci_Position iTargetStart = SciCall_PositionFromLine(iLineStart);
+	const Sci_Position iTargetEnd = SciCall_PositionFromLine(iLineStart + iLineCount);
+	size_t cbOutBuf = iTargetEnd - iTargetStart + 2*iLineCount + 1; // 2 for CR LF
+	if (iSortFlags & EditSortFlag_CountDuplicate) {
+		cbOutBuf += 11*iLineCount; // count and tab
+	}
+	size_t tableSize = 64;
+	while (tableSize < 2*static_cast<size_t>(iLineCount)) {
+		tableSize <<= 1;
+	}
+
+	const TempArenaScope arenaScope;
+	UINT * const lineGroups = static_cast<UINT *>(TempArenaAlloc(iLineCount*sizeof(UINT)));
+	UniqueLineGroup * const groups = static_cast<UniqueLineGroup *>(TempArenaAlloc(iLineCount*sizeof(UniqueLineGroup)));
+	UINT * const table = static_cast<UINT *>(TempArenaAlloc(tableSize*sizeof(UINT)));
+	char * const pszOut = static_cast<char *>(TempArenaAlloc(cbOutBuf));
+	if (lineGroups == nullptr || groups == nullptr || table == nullptr || pszOut == nullptr) {
+		return false;
+	}
+
+	const char * const pszText = SciCall_GetRangePointer(iTargetStart, iTargetEnd - iTargetStart);
+	const size_t mask = tableSize - 1;
+	UINT groupCount = 0;
+	for (Sci_Line i = 0; i < iLineCount; i++) {
+		const Sci_Position start = SciCall_PositionFromLine(iLineStart + i) - iTargetStart;
+		const Sci_Position length = SciCall_GetLineEndPosition(iLineStart + i) - iTargetStart - start;
+		const char * const pszLine = pszText + start;
+		const uint64_t hash = HashLineText(pszLine, length);
+		size_t slot = hash & mask;
+		UINT index;
+		while ((index = table[slot]) != 0) {
+			const UniqueLineGroup &group = groups[index - 1];
+			if (group.hash == hash && group.length == length && memcmp(pszText + group.start, pszLine, length) == 0) {
+				break;
+			}
+			slot = (slot + 1) & mask;
+		}
+		if (index == 0) {
+			index = ++groupCount;
+			table[slot] = index;
+			groups[index - 1] = { hash, start, length, 0 };
+		}
+		groups[index - 1].count++;
+		lineGroups[i] = index - 1;
+	}
+
+	const unsigned iEOLMode = SciCall_GetEOLMode();
+	unsigned szEOL = '\r' | ('\n' << 8);
+	szEOL >>= 8*(iEOLMode >> 1);
+	const UINT cbEOL = (iEOLMode == SC_EOL_CRLF) ? 2 : 1;
+
+	size_t cchTotal = 0;
+	for (Sci_Line i = 0; i < iLineCount; i++) {
+		const UniqueLineGroup &group = groups[lineGroups[i]];
+		BOOL bDropLine = EditSortFlag_RemoveUnique;
+		if (group.count > 1) {
+			const Sci_Position start = SciCall_PositionFromLine(iLineStart + i) - iTargetStart;
+			bDropLine = (start == group.start) ? EditSortFlag_RemoveDuplicate : (EditSortFlag_MergeDuplicate | EditSortFlag_RemoveDuplicate);
+		}
+		if ((iSortFlags & bDropLine) == 0) {
+			if (iSortFlags & EditSortFlag_CountDuplicate) {
+				cchTotal += sprintf(pszOut + cchTotal, "%u\t", group.count);
+			}
+			memcpy(pszOut + cchTotal, pszText + group.start, group.length);
+			cchTotal += group.length;
+			memcpy(pszOut + cchTotal, &szEOL, 2);
+			cchTotal += cbEOL;
+		}
+	}
+	if (cchTotal != 0 && SciCall_GetLineEndPosition(iLineStart + iLineCount - 1) == iTargetEnd) {
+		// no EOL on last line
+		cchTotal -= cbEOL;
+	}
+
+	SciCall_BeginUndoAction();
+	SciCall_SetTargetRange(iTargetStart, iTargetEnd);
+	SciCall_ReplaceTargetMinimal(cchTotal, pszOut);
+	SciCall_EndUndoAction();
+
+	if (bAnchorAfterCaret) {
+		SciCall_SetSel(iTargetStart + cchTotal, iTargetStart);
+	} else {
+		SciCall_SetSel(iTargetStart, iTargetStart + cchTotal);
+	}
+	return true;
+}
+
+}
+
+void EditSortLines(EditSortFlag iSortFlags) noexcept {
+	Sci_Position iCurPos = SciCall_GetCurrentPos();
+	Sci_Position iAnchorPos = SciCall_GetAnchor();
+	if (iCurPos == iAnchorPos) {
+		return;
+	}
+
+	Sci_Line iRcCurLine = 0;
+	Sci_Line iRcAnchorLine = 0;
+	Sci_Position iRcCurCol = 0;
+	Sci_Position iRcAnchorCol = 0;
+
+	Sci_Position iSelStart = 0;
+	Sci_Line iLineStart;
+	Sci_Line iLineEnd;
+	Sci_Position iSortColumn;
+	UINT csvColumn = UINT_MAX;
+
+	const bool bIsRectangular = SciCall_IsRectangularSelection();
+	if (bIsRectangular) {
+		iRcCurLine = SciCall_LineFromPosition(iCurPos);
+		iRcAnchorLine = SciCall_LineFromPosition(iAnchorPos);
+
+		iRcCurCol = SciCall_GetColumn(iCurPos);
+		iRcAnchorCol = SciCall_GetColumn(iAnchorPos);
+
+		iLineStart = min(iRcCurLine, iRcAnchorLine);
+		iLineEnd = max(iRcCurLine, iRcAnchorLine);
+		iSortColumn = min(iRcCurCol, iRcAnchorCol);
+	} else {
+		iSelStart = SciCall_GetSelectionStart();
+		const Sci_Position iSelEnd = SciCall_GetSelectionEnd();
+
+		const Sci_Line iLine = SciCall_LineFromPosition(iSelStart);
+		iSelStart = SciCall_PositionFromLine(iLine);
+
+		iLineStart = SciCall_LineFromPosition(iSelStart);
+		iLineEnd = SciCall_LineFromPosition(iSelEnd);
+
+		if (iSelEnd <= SciCall_PositionFromLine(iLineEnd)) {
+			iLineEnd--;
+		}
+
+		iSortColumn = SciCall_GetColumn(iCurPos);
+		if ((iSortFlags & EditSortFlag_ColumnSort) && pLexCurrent->iLexer == SCLEX_CSV && csvIndex.worker.eventCancel != nullptr) {
+			// sort whole records by field at caret
+			csvColumn = min(EditCsvFieldIndex(iCurPos, csvIndex.dialect), NP2_CSV_MAX_COLUMN - 1);
+			Sci_Position iRecordEnd = SciCall_PositionFromLine(iLineEnd + 1);
+			EditCsvGetRecords(iSelStart, iRecordEnd, csvIndex.dialect);
+			iLineStart = SciCall_LineFromPosition(iSelStart);
+			iLineEnd = SciCall_LineFromPosition(iRecordEnd);
+			if (iLineEnd > iLineStart && iRecordEnd == SciCall_PositionFromLine(iLineEnd)) {
+				iLineEnd--;
+			}
+		}
+	}
+
+	Sci_Line iLineCount = iLineEnd - iLineStart + 1;
+	if (iLineCount < 2) {
+		return;
+	}
+	if (!bIsRectangular && csvColumn == UINT_MAX && iSortFlags > EditSortFlag_Shuffle
+		&& (iSortFlags & (EditSortFlag_DontSort | EditSortFlag_IgnoreCase)) == EditSortFlag_DontSort) {
+		if (EditUniqueLines(iSortFlags, iLineStart, iLineCount, iAnchorPos > iCurPos)) {
+			return;
+		}
+	}
+
+	SciCall_BeginUndoAction();
+	if (bIsRectangular) {
+		EditPadWithSpaces(!(iSortFlags & EditSortFlag_Shuffle), true);
+	}
+
+	const UINT cpEdit = SciCall_GetCodePage();
+	Sci_Position iTargetStart = SciCall_PositionFromLine(iLineStart);
+	Sci_Position iTargetEnd = SciCall_PositionFromLine(iLineEnd + 1);
+	size_t cbPmszBuf = iTargetEnd - iTargetStart + 2*iLineCount + 1; // 2 for CR LF
+	size_t cchTextW = cbPmszBuf*sizeof(WCHAR) + iLineCount*alignof(WCHAR *);
+	if (iSortFlags & EditSortFlag_IgnoreCase) {
+		cchTextW += cchTextW;
+	}
+	if (iSortFlags & EditSortFlag_CountDuplicate) {
+		cbPmszBuf += 11*iLineCount; // count and tab
+	}
+	const TempArenaScope arenaScope;
+	char * const pmszBuf = static_cast<char *>(TempArenaAlloc(cbPmszBuf));
+	SORTLINE * const pLines = static_cast<SORTLINE *>(TempArenaAlloc(sizeof(SORTLINE) * iLineCount));
+	WCHAR * const pszTextW = static_cast<WCHAR *>(TempArenaAlloc(cchTextW));
+	size_t cchTotal = alignof(WCHAR *)/sizeof(WCHAR); // first pointer reserved for empty line
+
+	CsvRecord record;
+	record.maxField = csvColumn + 1;
+	record.fields = (csvColumn != UINT_MAX) ? static_cast<CsvField *>(TempArenaAlloc(record.maxField * sizeof(CsvField))) : nullptr;
+	Sci_Line iItemCount = 0;
+	for (Sci_Line iLine = iLineStart; iLine <= iLineEnd; iLine++) {
+		const Sci_Line i = iItemCount++;
+		Sci_Position cbLine;
+		Sci_Position cbSortEntry = 0;
+		if (record.fields != nullptr) {
+			// record may contain quoted line breaks
+			const Sci_Position iStartPos = SciCall_PositionFromLine(iLine);
+			const Sci_Position iEndPos = SciCall_PositionFromLine(iLineEnd + 1);
+			const char * const pszRecord = SciCall_GetRangePointer(iStartPos, iEndPos - iStartPos);
+			cbLine = CsvScanRecord(pszRecord, 0, iEndPos - iStartPos, csvIndex.dialect, record);
+			memcpy(pmszBuf, pszRecord, cbLine);
+			pmszBuf[cbLine] = '\0';
+			iLine = SciCall_LineFromPosition(iStartPos + record.contentEnd);
+			cbSortEntry = (csvColumn < record.fieldCount) ? record.fields[csvColumn].start : record.contentEnd;
+		} else {
+			SciCall_GetLine(iLine, pmszBuf);
+			cbLine = SciCall_GetLineLength(iLine);
+		}
+
+		// remove EOL
+		char *p = pmszBuf + cbLine - 1;
+		if (*p == '\n' || *p == '\r') {
+			*p-- = '\0';
+		}
+		if (*p == '\r') {
+			*p-- = '\0';
+		}
+
+		if (p >= pmszBuf) {
+			LPWSTR pwszLine = pszTextW + cchTotal;
+			const UINT cchLine = MultiByteToWideChar(cpEdit, 0, pmszBuf, -1, pwszLine, static_cast<int>(cbPmszBuf));
+			cchTotal += NP2_align_up(cchLine, alignof(WCHAR *)/sizeof(WCHAR));
+			pLines[i].pwszLine = pwszLine;
+			if (iSortFlags & EditSortFlag_IgnoreCase) {
+				// convert to uppercase for case insensitive comparison
+				// https://learn.microsoft.com/en-us/dotnet/api/system.string.toupper?view=net-7.0#system-string-toupper
+				LPWSTR pwszSortLine = pszTextW + cchTotal;
+				const UINT charsConverted = LCMapStringEx(LOCALE_NAME_USER_DEFAULT, LCMAP_UPPERCASE, pwszLine, cchLine, pwszSortLine, static_cast<int>(cbPmszBuf), nullptr, nullptr, 0);
+				cchTotal += NP2_align_up(charsConverted, alignof(WCHAR *)/sizeof(WCHAR));
+				pwszLine = pwszSortLine;
+			}
+
+			pLines[i].pwszSortLine = pwszLine;
+			if (record.fields != nullptr) {
+				pwszLine += MultiByteToWideChar(cpEdit, 0, pmszBuf, static_cast<int>(cbSortEntry), nullptr, 0);
+			} else if (iSortFlags & EditSortFlag_ColumnSort) {
+				const int tabWidth = fvCurFile.iTabWidth;
+				Sci_Position col = 0;
+				Sci_Position tabs = tabWidth;
+				while (*pwszLine) {
+					if (*pwszLine == L'\t') {
+						if (col + tabs <= iSortColumn) {
+							col += tabs;
+							tabs = tabWidth;
+							++pwszLine;
+						} else {
+							break;
+						}
+					} else if (col < iSortColumn) {
+						col++;
+						if (--tabs == 0) {
+							tabs = tabWidth;
+						}
+						pwszLine += 1 + IS_SURROGATE_PAIR(*pwszLine, pwszLine[1]);
+					} else {
+						break;
+					}
+				}
+			} else if (iSortFlags & EditSortFlag_GroupByFileType) {
+				pwszLine = PathFindExtension(pwszLine);
+			}
+			pLines[i].pwszSortEntry = pwszLine;
+			pLines[i].iLine = static_cast<int>(iLine);
+			pLines[i].iSortFlags = iSortFlags;
+		} else {
+			pLines[i].pwszLine = pszTextW;
+			pLines[i].pwszSortEntry = pszTextW;
+			pLines[i].pwszSortLine = pszTextW;
+			pLines[i].iLine = static_cast<int>(iLine);
+			pLines[i].iSortFlags = iSortFlags;
+		}
+		pLines[i].sortKey = SortLineKey(pLines[i].pwszSortEntry, iSortFlags);
+	}
+	if (record.fields != nullptr) {
+		iLineCount = iItemCount;
+	}
+
+	if (iSortFlags & EditSortFlag_Shuffle) {
+		// srand(GetTickCount());
+		uint32_t state = GetTickCount();
+		for (Sci_Line i = iLineCount - 1; i > 0; i--) {
+			// const Sci_Line j = rand() % i;
+			state = state*1103515245 + 12345; // see TestUtils.h
+			const Sci_Line j = ((state >> 16) & RAND_MAX) % i;
+			const SORTLINE sLine = pLines[i];
+			pLines[i] = pLines[j];
+			pLines[j] = sLine;
+		}
+	} else {
+		EditSortLinesParallel(pLines, iLineCount);
+		if (iSortFlags > EditSortFlag_Shuffle) {
+			Sci_Line iFirstDup = 0;
+			for (Sci_Line i = 0; i < iLineCount; i++) {
+				BOOL bDropLine;
+				if (i + 1 < iLineCount && wcscmp(pLines[i].pwszSortLine, pLines[i + 1].pwszSortLine) == 0) {
+					bDropLine = EditSortFlag_MergeDuplicate | EditSortFlag_RemoveDuplicate;
+				} else {
+					bDropLine = (iFirstDup != i) ? EditSortFlag_RemoveDuplicate : EditSortFlag_RemoveUnique;
+					if (iSortFlags & EditSortFlag_CountDuplicate) {
+						// sort key is no longer used, reuse it for occurrence count
+						for (Sci_Line j = iFirstDup; j <= i; j++) {
+							pLines[j].sortKey = i - iFirstDup + 1;
+						}
+					}
+					iFirstDup = i + 1;
+				}
+				if (iSortFlags & bDropLine) {
+					pLines[i].pwszLine = nullptr;
+				}
+			}
+		}
+		if (iSortFlags & EditSortFlag_DontSort) {
+			qsort(pLines, iLineCount, sizeof(SORTLINE), DontSortLine);
+		}
+	}
+
+	const unsigned iEOLMode = SciCall_GetEOLMode();
+	unsigned szEOL = '\r' | ('\n' << 8);
+	szEOL >>= 8*(iEOLMode >> 1);
+
+	const bool bCountDup = (iSortFlags & (EditSortFlag_Shuffle | EditSortFlag_CountDuplicate)) == EditSortFlag_CountDuplicate;
+	char *pszOut = pmszBuf;
+	cchTotal = 0;
+	for (Sci_Line i = 0; i < iLineCount; i++) {
+		LPCWSTR pwszLine = pLines[i].pwszLine;
+		if (pwszLine) {
+			if (bCountDup) {
+				const int cbCount = sprintf(pszOut, "%u\t", static_cast<UINT>(pLines[i].sortKey));
+				cchTotal += cbCount;
+				pszOut += cbCount;
+			}
+			const UINT cbLine = WideCharToMultiByte(cpEdit, 0, pwszLine, -1, pszOut, static_cast<int>(cbPmszBuf), nullptr, nullptr);
+			cchTotal += cbLine - 1;
+			pszOut += cbLine - 1;
+			memcpy(pszOut, &szEOL, 2);
+			cchTotal += (iEOLMode == SC_EOL_CRLF) ? 2 : 1;
+			pszOut += (iEOLMode == SC_EOL_CRLF) ? 2 : 1;
+		}
+	}
+	if (cchTotal != 0) {
+		const Sci_Position iLineEndPos = SciCall_GetLineEndPosition(iLineEnd);
+		if (iLineEndPos == iTargetEnd) {
+			// no EOL on last line
+			cchTotal -= (iEOLMode == SC_EOL_CRLF) ? 2 : 1;
+		}
+	}
+
+	SciCall_SetTargetRange(iTargetStart, iTargetEnd);
+	SciCall_ReplaceTargetMinimal(cchTotal, pmszBuf);
+	SciCall_EndUndoAction();
+
+	if (!bIsRectangular) {
+		if (iAnchorPos > iCurPos) {
+			iCurPos = iSelStart;
+			iAnchorPos = iSelStart + cchTotal;
+		} else {
+			iAnchorPos = iSelStart;
+			iCurPos = iSelStart + cchTotal;
+		}
+		SciCall_SetSel(iAnchorPos, iCurPos);
+	} else {
+		iTargetStart = SciCall_GetTargetStart();
+		iTargetEnd = SciCall_GetTargetEnd();
+		SciCall_ClearSelections();
+		if (iTargetStart != iTargetEnd) {
+			iTargetEnd -= (iEOLMode == SC_EOL_CRLF) ? 2 : 1;
+			iLineStart = SciCall_LineFromPosition(iTargetStart);
+			iLineEnd = SciCall_LineFromPosition(iTargetEnd);
+			if (iRcAnchorLine > iRcCurLine) {
+				iCurPos = SciCall_FindColumn(iLineStart, iRcCurCol);
+				iAnchorPos = SciCall_FindColumn(iLineEnd, iRcAnchorCol);
+			} else {
+				iCurPos = SciCall_FindColumn(iLineEnd, iRcCurCol);
+				iAnchorPos = SciCall_FindColumn(iLineStart, iRcAnchorCol);
+			}
+			if (iCurPos != iAnchorPos) {
+				SciCall_SetRectangularSelectionCaret(iCurPos);
+				SciCall_SetRectangularSelectionAnchor(iAnchorPos);
+			} else {
+				SciCall_SetSel(iTargetStart, iTargetStart);
+			}
+		} else {
+			SciCall_SetSel(iTargetStart, iTargetStart);
+		}
+	}
+}
+
+//=============================================================================
+//
+// EditJumpTo()
+//
+void EditJumpTo(Sci_Line iNewLine, Sci_Position iNewCol) noexcept {
+	// Jumpt to end with line set to -1
+	if (iNewLine < 0 || iNewLine > SciCall_GetLineCount()) {
+		iNewCol = SciCall_GetLength();
+	} else {
+		--iNewLine;
+		const Sci_Position iLineEndPos = SciCall_GetLineEndPosition(iNewLine);
+		iNewCol = min(iNewCol, iLineEndPos);
+		iNewCol = SciCall_FindColumn(iNewLine, iNewCol - 1);
+	}
+
+	EditSelectEx(iNewCol, iNewCol);
+	SciCall_ChooseCaretX();
+}
+
+//=============================================================================
+//
+// EditSelectEx()
+//
+void EditSelectEx(Sci_Position iAnchorPos, Sci_Position iCurrentPos) noexcept {
+	const Sci_Line iNewLine = SciCall_LineFromPosition(iCurrentPos);
+
+	if (iAnchorPos != iCurrentPos) {
+		const Sci_Line iAnchorLine = SciCall_LineFromPosition(iAnchorPos);
+		// Ensure that the first and last lines of a selection are always unfolded
+		// This needs to be done *before* the SciCall_SetSel() message
+		if (iAnchorLine != iNewLine) {
+			SciCall_EnsureVisible(iAnchorLine);
+		}
+	}
+
+	SciCall_SetXCaretPolicy(CARET_SLOP | CARET_STRICT | CARET_EVEN, 50);
+	SciCall_SetYCaretPolicy(CARET_SLOP | CARET_STRICT | CARET_EVEN, 5);
+	// center current line on screen when it's not visible
+	SciCall_EnsureVisibleEnforcePolicy(iNewLine);
+	if (iAnchorPos == iCurrentPos) {
+		SciCall_GotoPos(iAnchorPos);
+	} else {
+		SciCall_SetSel(iAnchorPos, iCurrentPos);
+	}
+	SciCall_SetXCaretPolicy(CARET_SLOP | CARET_EVEN, 50);
+	SciCall_SetYCaretPolicy(CARET_EVEN, 0);
+}
+
+//=============================================================================
+//
+// EditFixPositions()
+//
+void EditFixPositions() noexcept {
+	const Sci_Position iMaxPos = SciCall_GetLength();
+	Sci_Position iCurrentPos = SciCall_GetCurrentPos();
+	const Sci_Position iAnchorPos = SciCall_GetAnchor();
+
+	if (iCurrentPos > 0 && iCurrentPos < iMaxPos) {
+		const Sci_Position iNewPos = SciCall_PositionAfter(SciCall_PositionBefore(iCurrentPos));
+		if (iNewPos != iCurrentPos) {
+			SciCall_SetCurrentPos(iNewPos);
+			iCurrentPos = iNewPos;
+		}
+	}
+
+	if (iAnchorPos != iCurrentPos && iAnchorPos > 0 && iAnchorPos < iMaxPos) {
+		const Sci_Position iNewPos = SciCall_PositionAfter(SciCall_PositionBefore(iAnchorPos));
+		if (iNewPos != iAnchorPos) {
+			SciCall_SetAnchor(iNewPos);
+		}
+	}
+}
+
+//=============================================================================
+//
+// EditEnsureSelectionVisible()
+//
+void EditEnsureSelectionVisible() noexcept {
+	const Sci_Position iAnchorPos = SciCall_GetAnchor();
+	const Sci_Position iCurrentPos = SciCall_GetCurrentPos();
+	EditSelectEx(iAnchorPos, iCurrentPos);
+}
+
+void EditEnsureConsistentLineEndings() noexcept {
+	const size_t lineCount = SciCall_GetLineCount();
+	if (lineCount < 2) {
+		return;
+	}
+	const size_t actions = SciCall_GetUndoActions();
+	if (actions + 2 >= MAX_SMALL_FILE_SIZE) {
+		// Scintilla undo stack is indexed with int, converting adds one deletion and one insertion
+		return;
+	}
+
+	const int iEOLMode = SciCall_GetEOLMode();
+	if (iEOLMode == SC_EOL_CRLF) {
+#if defined(_WIN64)
+		const int options = SciCall_GetDocumentOptions();
+		if (!(options & SC_DOCUMENTOPTION_TEXT_LARGE))
+#endif
+		{
+			const size_t dwLength = SciCall_GetLength() + lineCount;
+			if (dwLength >= MAX_SMALL_FILE_SIZE) {
+				return;
+			}
+		}
+	}
+
+	SciCall_ConvertEOLs(iEOLMode);
+	EditFixPositions();
+}
+
+//=============================================================================
+//
+// EditGetExcerpt()
+//
+static void EditGetExcerptRange(Sci_Position iSelStart, Sci_Position iSelEnd, LPWSTR lpszExcerpt, DWORD cchExcerpt) noexcept {
+	WCHAR tch[256]{};
+	char pszText[256]{};
+	iSelEnd = min<Sci_Position>(iSelEnd, iSelStart + COUNTOF(tch) - 1);
+
+	const Sci_TextRangeFull tr = { { iSelStart, iSelEnd }, pszText };
+	SciCall_GetTextRangeFull(&tr);
+	const UINT cpEdit = SciCall_GetCodePage();
+	MultiByteToWideChar(cpEdit, 0, pszText, static_cast<int>(iSelEnd - iSelStart), tch, COUNTOF(tch));
+
+	DWORD cch = 0;
+	WCHAR chPrev = L' ';
+	LPCWSTR p = tch;
+	while (*p != L'\0') {
+		WCHAR ch = *p++;
+		if (ch <= L' ') {
+			ch = L' ';
+			if (chPrev == L' ') {
+				continue;
+			}
+		}
+		if (cch < cchExcerpt - 1) {
+			lpszExcerpt[cch] = ch;
+		}
+		chPrev = ch;
+		cch++;
+		if (cch > cchExcerpt) {
+			cch = cchExcerpt - 1;
+			lpszExcerpt[cchExcerpt - 2] = L'.';
+			lpszExcerpt[cchExcerpt - 3] = L'.';
+			lpszExcerpt[cchExcerpt - 4] = L'.';
+			break;
+		}
+	}
+	lpszExcerpt[cch] = L'\0';
+	if (cch == 0) {
+		lstrcpy(lpszExcerpt, L" ... ");
+	}
+}
+
+void EditGetExcerpt(LPWSTR lpszExcerpt, DWORD cchExcerpt) noexcept {
+	if (SciCall_IsSelectionEmpty() || SciCall_IsRectangularSelection()) {
+		StrCpyEx(lpszExcerpt, L"");
+		return;
+	}
+
+	EditGetExcerptRange(SciCall_GetSelectionStart(), SciCall_GetSelectionEnd(), lpszExcerpt, cchExcerpt);
+}
+
+void EditSelectWord() noexcept {
+	const Sci_Position iPos = SciCall_GetCurrentPos();
+
+	if (SciCall_IsSelectionEmpty()) {
+		Sci_Position iWordStart = SciCall_WordStartPosition(iPos, true);
+		Sci_Position iWordEnd = SciCall_WordEndPosition(iPos, true);
+
+		if (iWordStart == iWordEnd) {// we are in whitespace salad...
+			iWordStart = SciCall_WordEndPosition(iPos, false);
+			iWordEnd = SciCall_WordEndPosition(iWordStart, true);
+			if (iWordStart != iWordEnd) {
+				//if (IsDocWordChar(SciCall_GetCharAt(iWordStart - 1))) {
+				//	--iWordStart;
+				//}
+				SciCall_SetSel(iWordStart, iWordEnd);
+			}
+		} else {
+			//if (IsDocWordChar(SciCall_GetCharAt(iWordStart - 1))) {
+			//	--iWordStart;
+			//}
+			SciCall_SetSel(iWordStart, iWordEnd);
+		}
+
+		if (!SciCall_IsSelectionEmpty()) {
+			return;
+		}
+	}
+
+	const Sci_Line iLine = SciCall_LineFromPosition(iPos);
+	const Sci_Position iLineStart = SciCall_GetLineIndentPosition(iLine);
+	const Sci_Position iLineEnd = SciCall_GetLineEndPosition(iLine);
+	SciCall_SetSel(iLineStart, iLineEnd);
+}
+
+void EditSelectLines(bool currentBlock, bool lineSelection) noexcept {
+	if (lineSelection && !currentBlock) {
+		SciCall_SetSelectionMode(SC_SEL_LINES);
+		return;
+	}
+
+	// see Editor::LineSelectionRange()
+	Sci_Position iCurrentPos = SciCall_GetCurrentPos();
+	Sci_Position iAnchorPos = SciCall_GetAnchor();
+	bool backward = (iCurrentPos < iAnchorPos);
+
+	Sci_Line iLineAnchorPos = SciCall_LineFromPosition(iAnchorPos);
+	Sci_Line iLineCurPos = SciCall_LineFromPosition(iCurrentPos);
+
+	if (currentBlock) {
+		Sci_Line iLineStart = iLineCurPos;
+		const int level = SciCall_GetFoldLevel(iLineStart);
+		if (!(level & SC_FOLDLEVELHEADERFLAG)) {
+			iLineStart = SciCall_GetFoldParent(iLineStart);
+			if (iLineStart < 0) {
+				SciCall_SelectAll();
+				return;
+			}
+		}
+
+		const Sci_Line iLineEnd = SciCall_GetLastChild(iLineStart);
+		backward = backward || (iCurrentPos == iAnchorPos && iLineEnd - iLineCurPos > iLineCurPos - iLineStart);
+		if (backward) {
+			iLineCurPos = iLineStart;
+			iLineAnchorPos = iLineEnd;
+		} else {
+			iLineCurPos = iLineEnd;
+			iLineAnchorPos = iLineStart;
+		}
+	}
+
+	const Sci_Line offset = lineSelection ? 0 : 1;
+	if (backward) {
+		iLineAnchorPos = iLineAnchorPos + offset;
+	} else {
+		iLineCurPos = iLineCurPos + offset;
+	}
+
+	iAnchorPos = SciCall_PositionFromLine(iLineAnchorPos);
+	iCurrentPos = SciCall_PositionFromLine(iLineCurPos);
+	SciCall_SetSel(iAnchorPos, iCurrentPos);
+	if (lineSelection) {
+		SciCall_SetSelectionMode(SC_SEL_LINES);
+	}
+	SciCall_ChooseCaretX();
+}
+
+static LRESULT CALLBACK AddBackslashEditProc(HWND hwnd, UINT umsg, WPARAM wParam, LPARAM lParam, UINT_PTR uIdSubclass, DWORD_PTR dwRefData) noexcept {
+	UNREFERENCED_PARAMETER(dwRefData);
+
+	switch (umsg) {
+	case WM_PASTE: {
+		bool done = false;
+		LPWSTR lpsz = EditGetClipboardTextW();
+		if (StrNotEmpty(lpsz)) {
+			const int len = lstrlen(lpsz);
+			LPWSTR lpszEsc = static_cast<LPWSTR>(NP2HeapAlloc((kMaxBackslashEscapeCount*len + 1)*sizeof(WCHAR)));
+			if (lpszEsc != nullptr) {
+				AddBackslashW(lpszEsc, lpsz);
+				SendMessage(hwnd, EM_REPLACESEL, TRUE, AsInteger<LPARAM>(lpszEsc));
+				NP2HeapFree(lpszEsc);
+				done = true;
+			}
+		}
+		if (lpsz != nullptr) {
+			NP2HeapFree(lpsz);
+		}
+		if (done) {
+			return TRUE;
+		}
+	}
+	break;
+
+	case WM_NCDESTROY:
+		RemoveWindowSubclass(hwnd, AddBackslashEditProc, uIdSubclass);
+		break;
+	}
+
+	return DefSubclassProc(hwnd, umsg, wParam, lParam);
+}
+
+void AddBackslashComboBoxSetup(HWND hwnd) noexcept {
+	COMBOBOXINFO info;
+	info.cbSize = sizeof(COMBOBOXINFO);
+	if (GetComboBoxInfo(hwnd, &info)) {
+		SetWindowSubclass(info.hwndItem, AddBackslashEditProc, 0, 0);
+		// Ctrl+Backspace
+		SHAutoComplete(info.hwndItem, SHACF_FILESYS_ONLY | SHACF_AUTOAPPEND_FORCE_OFF | SHACF_AUTOSUGGEST_FORCE_OFF);
+	}
+}
+
+extern int iFindReplaceOption;
+extern int iFindReplaceOpacityLevel;
+
+void EditSaveSelectionAsFindText(EDITFINDREPLACE *lpefr, int menu, bool findSelection) noexcept {
+	if (!findSelection && (iSelectOption & SelectOption_CopySelectionAsFindText) == 0) {
+		return;
+	}
+	Sci_Position cchSelection = SciCall_GetSelTextLength();
+	if (cchSelection == 0 && findSelection) {
+		EditSelectWord();
+		cchSelection = SciCall_GetSelTextLength();
+	}
+
+	if (cchSelection > 0 && cchSelection < NP2_FIND_REPLACE_LIMIT) {
+		char mszSelection[NP2_FIND_REPLACE_LIMIT];
+
+		SciCall_GetSelText(mszSelection);
+		mszSelection[cchSelection] = 0; // zero terminate
+
+		const UINT cpEdit = SciCall_GetCodePage();
+		strcpy(lpefr->szFind, mszSelection);
+
+		if (cpEdit != SC_CP_UTF8) {
+			WCHAR wszBuf[NP2_FIND_REPLACE_LIMIT];
+			MultiByteToWideChar(cpEdit, 0, mszSelection, -1, wszBuf, COUNTOF(wszBuf));
+			WideCharToMultiByte(CP_UTF8, 0, wszBuf, -1, lpefr->szFindUTF8, COUNTOF(lpefr->szFindUTF8), nullptr, nullptr);
+		} else {
+			strcpy(lpefr->szFindUTF8, mszSelection);
+		}
+
+		lpefr->fuFlags &= SCFIND_REGEXP - 1; // clear all regex flags
+		lpefr->option &= ~FindReplaceOption_TransformBackslash;
+
+		switch (menu) {
+		case IDM_EDIT_SAVEFIND:
+			break;
+
+		case CMD_FINDNEXTSEL:
+			EditFindNext(lpefr, false);
+			break;
+
+		case CMD_FINDPREVSEL:
+			EditFindPrev(lpefr, false);
+			break;
+		}
+	}
+}
+
+static void FindReplaceSetFont(HWND hwnd, BOOL monospaced, HFONT *hFontFindReplaceEdit) noexcept {
+	HFONT font = nullptr;
+	if (monospaced) {
+		const UINT dpi = GetWindowDPI(hwnd);
+		font = Style_CreateCodeFont(dpi);
+		*hFontFindReplaceEdit = font;
+	}
+	if (font == nullptr) {
+		font = GetWindowFont(hwnd);
+	}
+	SendDlgItemMessage(hwnd, IDC_FINDTEXT, WM_SETFONT, AsInteger<WPARAM>(font), TRUE);
+	SendDlgItemMessage(hwnd, IDC_REPLACETEXT, WM_SETFONT, AsInteger<WPARAM>(font), TRUE);
+}
+
+static bool CopySelectionAsFindText(HWND hwnd, EDITFINDREPLACE *lpefr, bool bFirstTime) noexcept {
+	const Sci_Position cchSelection = SciCall_GetSelTextLength();
+	char *lpszSelection = nullptr;
+
+	if (cchSelection != 0 && cchSelection <= NP2_FIND_REPLACE_LIMIT && (iSelectOption & SelectOption_CopySelectionAsFindText)) {
+		lpszSelection = static_cast<char *>(NP2HeapAlloc(cchSelection + 1));
+		SciCall_GetSelText(lpszSelection);
+	}
+
+	// only for manually selected text
+	const bool hasFindText = StrNotEmpty(lpszSelection);
+
+	// First time you bring up find/replace dialog,
+	// copy content from clipboard to find box when nothing is selected in the editor.
+	if (!hasFindText && bFirstTime && (iSelectOption & SelectOption_CopyPasteBufferAsFindText)) {
+		char *pClip = EditGetClipboardText(hwnd);
+		if (pClip != nullptr) {
+			const size_t len = strlen(pClip);
+			if (len > 0 && len <= NP2_FIND_REPLACE_LIMIT) {
+				NP2HeapFree(lpszSelection);
+				lpszSelection = static_cast<char *>(NP2HeapAlloc(len + 2));
+				strcpy(lpszSelection, pClip);
+			}
+			LocalFree(pClip);
+		}
+	}
+
+	if (StrNotEmpty(lpszSelection)) {
+		char *lpszEscSel = static_cast<char *>(NP2HeapAlloc((kMaxBackslashEscapeCount * NP2_FIND_REPLACE_LIMIT)));
+		unsigned option = lpefr->option & ~FindReplaceOption_TransformBackslash;
+		if (AddBackslashA(lpszEscSel, lpszSelection)) {
+			if ((lpefr->fuFlags & SCFIND_REGEXP) == 0) {
+				option |= FindReplaceOption_TransformBackslash;
+			}
+		}
+
+		lpefr->option = option;
+		const UINT cpEdit = SciCall_GetCodePage();
+		SetDlgItemTextA2W(cpEdit, hwnd, IDC_FINDTEXT, lpszEscSel);
+		NP2HeapFree(lpszEscSel);
+	}
+
+	if (lpszSelection != nullptr) {
+		NP2HeapFree(lpszSelection);
+	}
+	return hasFindText;
+}
+
+//=============================================================================
+//
+// EditFindReplaceDlgProc()
+//
+static INT_PTR CALLBACK EditFindReplaceDlgProc(HWND hwnd, UINT umsg, WPARAM wParam, LPARAM lParam) noexcept {
+	static const DWORD controlDefinition[] = {
+		DeferCtlMoveX(IDC_RESIZEGRIP2),
+		DeferCtlMoveX(IDOK),
+		DeferCtlSizeX(IDC_FINDTEXT),
+		DeferCtlMoveX(IDC_CLEAR_FIND),
+		DeferCtlMoveX(IDC_FINDPREV),
+		DeferCtlMoveX(IDC_SAVEPOSITION),
+		DeferCtlMoveX(IDC_RESETPOSITION),
+		DeferCtlMoveX(IDC_FINDALL),
+		DeferCtlMoveX(IDC_REPLACEALL),
+		// replace
+		DeferCtlSizeX(IDC_REPLACETEXT),
+		DeferCtlMoveX(IDC_CLEAR_REPLACE),
+		DeferCtlMoveX(IDC_REPLACE),
+		DeferCtlMoveX(IDC_REPLACEINSEL),
+	};
+
+	static int bSwitchedFindReplace = 0;
+	static int xFindReplaceDlgSave;
+	static int yFindReplaceDlgSave;
+	static HFONT hFontFindReplaceEdit;
+
+	WCHAR tch[NP2_FIND_REPLACE_LIMIT + 32];
+
+	switch (umsg) {
+	case WM_INITDIALOG: {
+		SetWindowLongPtr(hwnd, DWLP_USER, lParam);
+		HWND hwndRepl = GetDlgItem(hwnd, IDC_REPLACETEXT);
+		const DWORD controlCount = hwndRepl ? COUNTOF(controlDefinition) : COUNTOF(controlDefinition) - 4;
+		ResizeDlg_InitX(hwnd, &positionRecord.cxFindReplaceDlg, controlDefinition, controlCount);
+
+		HWND hwndFind = GetDlgItem(hwnd, IDC_FINDTEXT);
+		AddBackslashComboBoxSetup(hwndFind);
+
+		// Load MRUs
+		mruFind.AddToCombobox(hwndFind);
+
+		EDITFINDREPLACE * const lpefr = AsPointer<EDITFINDREPLACE *>(lParam);
+		// don't copy selection after toggle find & replace on this window.
+		bool hasFindText = false;
+		if (bSwitchedFindReplace != 3) {
+			hasFindText = CopySelectionAsFindText(hwnd, lpefr, true);
+		}
+		if (!GetWindowTextLength(hwndFind)) {
+			SetDlgItemTextA2W(CP_UTF8, hwnd, IDC_FINDTEXT, lpefr->szFindUTF8);
+		}
+
+		ComboBox_LimitText(hwndFind, NP2_FIND_REPLACE_LIMIT);
+		ComboBox_SetExtendedUI(hwndFind, TRUE);
+
+		if (hwndRepl) {
+			AddBackslashComboBoxSetup(hwndRepl);
+			mruReplace.AddToCombobox(hwndRepl);
+			ComboBox_LimitText(hwndRepl, NP2_FIND_REPLACE_LIMIT);
+			ComboBox_SetExtendedUI(hwndRepl, TRUE);
+			SetDlgItemTextA2W(CP_UTF8, hwnd, IDC_REPLACETEXT, lpefr->szReplaceUTF8);
+		}
+
+		// focus on replace box when selected text is not empty.
+		PostMessage(hwnd, WM_NEXTDLGCTL, AsInteger<WPARAM>((hasFindText && hwndRepl)? hwndRepl : hwndFind), TRUE);
+
+		unsigned mask = lpefr->fuFlags;
+		if (mask & SCFIND_MATCHCASE) {
+			CheckDlgButton(hwnd, IDC_FINDCASE, BST_CHECKED);
+		}
+		if (mask & SCFIND_WHOLEWORD) {
+			CheckDlgButton(hwnd, IDC_FINDWORD, BST_CHECKED);
+		}
+		if (mask & SCFIND_WORDSTART) {
+			CheckDlgButton(hwnd, IDC_FINDSTART, BST_CHECKED);
+		}
+		if (mask & SCFIND_REGEXP) {
+			CheckDlgButton(hwnd, IDC_FINDREGEXP, BST_CHECKED);
+		}
+		if (mask & SCFIND_REGEX_DOT_ALL) {
+			CheckDlgButton(hwnd, IDC_FIND_DOTALL, BST_CHECKED);
+		}
+
+		mask = lpefr->option;
+		if (mask & FindReplaceOption_TransformBackslash) {
+			CheckDlgButton(hwnd, IDC_FINDTRANSFORMBS, BST_CHECKED);
+		}
+		if (mask & FindReplaceOption_WildcardSearch) {
+			CheckDlgButton(hwnd, IDC_WILDCARDSEARCH, BST_CHECKED);
+			CheckDlgButton(hwnd, IDC_FINDREGEXP, BST_UNCHECKED);
+		}
+		if (mask & FindReplaceOption_NoFindWrap) {
+			CheckDlgButton(hwnd, IDC_NOWRAP, BST_CHECKED);
+		}
+
+		int bCloseDlg;
+		if (hwndRepl) {
+			bCloseDlg = bSwitchedFindReplace ? FindReplaceOption_CloseFind : FindReplaceOption_CloseReplace;
+		} else {
+			bCloseDlg = bSwitchedFindReplace ? FindReplaceOption_CloseReplace : FindReplaceOption_CloseFind;
+		}
+		if (mask & bCloseDlg) {
+			CheckDlgButton(hwnd, IDC_FINDCLOSE, BST_CHECKED);
+		}
+
+		if (!bSwitchedFindReplace) {
+			if (positionRecord.xFindReplaceDlg == 0 || positionRecord.yFindReplaceDlg == 0) {
+				CenterDlgInParent(hwnd);
+			} else {
+				SetDlgPos(hwnd, positionRecord.xFindReplaceDlg, positionRecord.yFindReplaceDlg);
+			}
+		} else {
+			bSwitchedFindReplace = 0;
+			SetDlgPos(hwnd, xFindReplaceDlgSave, yFindReplaceDlgSave);
+		}
+
+		mask = iFindReplaceOption;
+		if (mask & FindReplaceOption_UseCxxRegex) {
+			CheckDlgButton(hwnd, IDC_FIND_CXXREGEX, BST_CHECKED);
+		}
+		if (mask & FindReplaceOption_TransparentMode) {
+			CheckDlgButton(hwnd, IDC_TRANSPARENT, BST_CHECKED);
+		}
+		if (mask & FindReplaceOption_FindAllBookmark) {
+			CheckDlgButton(hwnd, IDC_FINDALLBOOKMARK, BST_CHECKED);
+		}
+		if (mask & FindReplaceOption_UseMonospacedFont) {
+			CheckDlgButton(hwnd, IDC_USEMONOSPACEDFONT, BST_CHECKED);
+			FindReplaceSetFont(hwnd, TRUE, &hFontFindReplaceEdit);
+		}
+	}
+	return TRUE;
+
+	case APPM_COPYDATA: {
+		HWND hwndFind = GetDlgItem(hwnd, IDC_FINDTEXT);
+		HWND hwndRepl = GetDlgItem(hwnd, IDC_REPLACETEXT);
+		EDITFINDREPLACE * const lpefr = AsPointer<EDITFINDREPLACE *>(GetWindowLongPtr(hwnd, DWLP_USER));
+
+		const bool hasFindText = CopySelectionAsFindText(hwnd, lpefr, false);
+		if (!GetWindowTextLength(hwndFind)) {
+			SetDlgItemTextA2W(CP_UTF8, hwnd, IDC_FINDTEXT, lpefr->szFindUTF8);
+		}
+		CheckDlgButton(hwnd, IDC_FINDTRANSFORMBS, (lpefr->option & FindReplaceOption_TransformBackslash) ? BST_CHECKED : BST_UNCHECKED);
+		// focus on replace box when selected text is not empty.
+		PostMessage(hwnd, WM_NEXTDLGCTL, AsInteger<WPARAM>((hasFindText && hwndRepl)? hwndRepl : hwndFind), TRUE);
+	}
+	break;
+
+	case APPM_FINDASYOUTYPE:
+		EditFindAsYouTypeUpdate(wParam, lParam);
+		break;
+
+	case WM_DESTROY:
 	case WM_DPICHANGED:
+		if (umsg == WM_DESTROY) {
+			EditFindAsYouTypeStop(false);
+		}
 		if (hFontFindReplaceEdit) {
 			DeleteObject(hFontFindReplaceEdit);
 			hFontFindReplaceEdit = nullptr;
 		}
-		if (umsg == WM_DPICHANGED && IsButtonChecked(hwnd, IDC_USEMONOSPACEDFONT)) {
-			FindReplaceSetFont(hwnd, TRUE, &hFontFindReplaceEdit);
+		if (umsg == WM_DPICHANGED && IsButtonChecked(hwnd, IDC_USEMONOSPACEDFONT)) {
+			FindReplaceSetFont(hwnd, TRUE, &hFontFindReplaceEdit);
+		}
+		return FALSE;
+
+	case WM_COMMAND:
+		switch (LOWORD(wParam)) {
+		case IDC_FINDTEXT:
+		case IDC_REPLACETEXT: {
+			HWND hwndFind = GetDlgItem(hwnd, IDC_FINDTEXT);
+			const BOOL bEnable = ComboBox_HasText(hwndFind);
+
+			EnableWindow(GetDlgItem(hwnd, IDOK), bEnable);
+			EnableWindow(GetDlgItem(hwnd, IDC_FINDPREV), bEnable);
+			EnableWindow(GetDlgItem(hwnd, IDC_FINDALL), bEnable);
+			EnableWindow(GetDlgItem(hwnd, IDC_REPLACE), bEnable);
+			EnableWindow(GetDlgItem(hwnd, IDC_REPLACEALL), bEnable);
+			EnableWindow(GetDlgItem(hwnd, IDC_REPLACEINSEL), bEnable);
+
+			if (HIWORD(wParam) == CBN_CLOSEUP) {
+				HWND hwndCtl = GetDlgItem(hwnd, LOWORD(wParam));
+				const DWORD lSelEnd = ComboBox_GetEditSelEnd(hwndCtl);
+				ComboBox_SetEditSel(hwndCtl, lSelEnd, lSelEnd);
+			} else if (HIWORD(wParam) == CBN_EDITCHANGE && LOWORD(wParam) == IDC_FINDTEXT) {
+				EditFindAsYouType(hwnd);
+			}
+		}
+		break;
+
+		case IDC_FINDREGEXP:
+			if (IsButtonChecked(hwnd, IDC_FINDREGEXP)) {
+				CheckDlgButton(hwnd, IDC_FINDTRANSFORMBS, BST_UNCHECKED);
+				// Can not use wildcard search together with regexp
+				CheckDlgButton(hwnd, IDC_WILDCARDSEARCH, BST_UNCHECKED);
+			}
+			break;
+
+		case IDC_FINDTRANSFORMBS:
+			if (IsButtonChecked(hwnd, IDC_FINDTRANSFORMBS)) {
+				CheckDlgButton(hwnd, IDC_FINDREGEXP, BST_UNCHECKED);
+			}
+			break;
+
+		case IDC_WILDCARDSEARCH:
+			CheckDlgButton(hwnd, IDC_FINDREGEXP, BST_UNCHECKED);
+			//if (IsButtonChecked(hwnd, IDC_FINDWILDCARDS))
+			//	CheckDlgButton(hwnd, IDC_FINDREGEXP, BST_UNCHECKED);
+			break;
+
+		case IDC_FIND_CXXREGEX:
+		case IDC_TRANSPARENT:
+		case IDC_USEMONOSPACEDFONT:
+		case IDC_FINDALLBOOKMARK: {
+			const int mask = 1 << (LOWORD(wParam) - IDC_FIND_CXXREGEX);
+			if (IsButtonChecked(hwnd, LOWORD(wParam))) {
+				iFindReplaceOption |= mask;
+			} else {
+				iFindReplaceOption &= ~mask;
+			}
+			if (LOWORD(wParam) == IDC_USEMONOSPACEDFONT) {
+				if (hFontFindReplaceEdit) { // dpi may changed between toggle monospaced font
+					DeleteObject(hFontFindReplaceEdit);
+					hFontFindReplaceEdit = nullptr;
+				}
+				FindReplaceSetFont(hwnd, iFindReplaceOption & FindReplaceOption_UseMonospacedFont, &hFontFindReplaceEdit);
+			}
+		} break;
+
+		case IDOK:
+		case IDC_FINDPREV:
+		case IDC_FINDALL:
+		case IDC_REPLACE:
+		case IDC_REPLACEALL:
+		case IDC_REPLACEINSEL:
+		case IDACC_SELTONEXT:
+		case IDACC_SELTOPREV: {
+			// keep match selected by find as you type
+			EditFindAsYouTypeStop(false);
+			EDITFINDREPLACE * const lpefr = AsPointer<EDITFINDREPLACE *>(GetWindowLongPtr(hwnd, DWLP_USER));
+			HWND hwndFind = GetDlgItem(hwnd, IDC_FINDTEXT);
+			HWND hwndRepl = GetDlgItem(hwnd, IDC_REPLACETEXT);
+			const bool bIsFindDlg = (hwndRepl == nullptr);
+			// Get current code page for Unicode conversion
+			const UINT cpEdit = SciCall_GetCodePage();
+
+			if (!GetDlgItemTextA2W(cpEdit, hwnd, IDC_FINDTEXT, lpefr->szFind, COUNTOF(lpefr->szFind))) {
+				EnableWindow(GetDlgItem(hwnd, IDOK), FALSE);
+				EnableWindow(GetDlgItem(hwnd, IDC_FINDPREV), FALSE);
+				EnableWindow(GetDlgItem(hwnd, IDC_FINDALL), FALSE);
+				EnableWindow(GetDlgItem(hwnd, IDC_REPLACE), FALSE);
+				EnableWindow(GetDlgItem(hwnd, IDC_REPLACEALL), FALSE);
+				EnableWindow(GetDlgItem(hwnd, IDC_REPLACEINSEL), FALSE);
+				return TRUE;
+			}
+
+			if (!bIsFindDlg) {
+				GetDlgItemTextA2W(cpEdit, hwnd, IDC_REPLACETEXT, lpefr->szReplace, COUNTOF(lpefr->szReplace));
+			}
+
+			unsigned mask = SCFIND_NONE;
+			if (IsButtonChecked(hwnd, IDC_FINDCASE)) {
+				mask |= SCFIND_MATCHCASE;
+			}
+			if (IsButtonChecked(hwnd, IDC_FINDWORD)) {
+				mask |= SCFIND_WHOLEWORD;
+			}
+			if (IsButtonChecked(hwnd, IDC_FINDSTART)) {
+				mask |= SCFIND_WORDSTART;
+			}
+			if (IsButtonChecked(hwnd, IDC_FINDREGEXP)) {
+				if (iFindReplaceOption & FindReplaceOption_UseCxxRegex) {
+					mask |= SCFIND_REGEXP | SCFIND_CXX11REGEX;
+					if (IsButtonChecked(hwnd, IDC_FIND_DOTALL)) {
+						mask |= SCFIND_REGEX_DOT_ALL;
+					}
+				} else {
+					mask |= SCFIND_REGEXP | SCFIND_POSIX;
+				}
+			}
+			lpefr->fuFlags = mask;
+
+			mask = FindReplaceOption_None;
+			if (IsButtonChecked(hwnd, IDC_FINDTRANSFORMBS)) {
+				mask |= FindReplaceOption_TransformBackslash;
+			}
+			if (IsButtonChecked(hwnd, IDC_WILDCARDSEARCH)) {
+				mask |= FindReplaceOption_WildcardSearch;
+			}
+			if (IsButtonChecked(hwnd, IDC_NOWRAP)) {
+				mask |= FindReplaceOption_NoFindWrap;
+			}
+
+			bool bCloseDlg = IsButtonChecked(hwnd, IDC_FINDCLOSE);
+			if (bCloseDlg) {
+				mask |= bIsFindDlg ? FindReplaceOption_CloseFind : FindReplaceOption_CloseReplace;
+				if (!bIsFindDlg && LOWORD(wParam) == IDOK) {
+					bCloseDlg = false;
+				}
+			}
+			mask |= lpefr->option & (bIsFindDlg ? FindReplaceOption_CloseReplace : FindReplaceOption_CloseFind);
+			lpefr->option = mask;
+
+			// Save MRUs
+			if (StrNotEmpty(lpefr->szFind)) {
+				if (GetDlgItemTextA2W(CP_UTF8, hwnd, IDC_FINDTEXT, lpefr->szFindUTF8, COUNTOF(lpefr->szFindUTF8))) {
+					ComboBox_GetText(hwndFind, tch, COUNTOF(tch));
+					mruFind.AddMultiline(tch);
+				}
+			}
+			if (StrNotEmpty(lpefr->szReplace)) {
+				if (GetDlgItemTextA2W(CP_UTF8, hwnd, IDC_REPLACETEXT, lpefr->szReplaceUTF8, COUNTOF(lpefr->szReplaceUTF8))) {
+					ComboBox_GetText(hwndRepl, tch, COUNTOF(tch));
+					mruReplace.AddMultiline(tch);
+				}
+			} else {
+				strcpy(lpefr->szReplaceUTF8, "");
+			}
+
+			// Reload MRUs
+			ComboBox_ResetContent(hwndFind);
+			ComboBox_ResetContent(hwndRepl);
+			mruFind.AddToCombobox(hwndFind);
+			mruReplace.AddToCombobox(hwndRepl);
+
+			SetDlgItemTextA2W(CP_UTF8, hwnd, IDC_FINDTEXT, lpefr->szFindUTF8);
+			SetDlgItemTextA2W(CP_UTF8, hwnd, IDC_REPLACETEXT, lpefr->szReplaceUTF8);
+
+			SendMessage(hwnd, WM_NEXTDLGCTL, AsInteger<WPARAM>(GetFocus()), TRUE);
+
+			if (bCloseDlg) {
+				DestroyWindow(hwnd);
+				hDlgFindReplace = nullptr;
+			}
+
+			switch (LOWORD(wParam)) {
+			case IDOK: // find next
+			case IDACC_SELTONEXT:
+				if (!bIsFindDlg) {
+					bReplaceInitialized = true;
+				}
+				EditFindNext(lpefr, LOWORD(wParam) == IDACC_SELTONEXT || KeyboardIsKeyDown(VK_SHIFT));
+				break;
+
+			case IDC_FINDPREV: // find previous
+			case IDACC_SELTOPREV:
+				if (!bIsFindDlg) {
+					bReplaceInitialized = true;
+				}
+				EditFindPrev(lpefr, LOWORD(wParam) == IDACC_SELTOPREV || KeyboardIsKeyDown(VK_SHIFT));
+				break;
+
+			case IDC_REPLACE:
+				bReplaceInitialized = true;
+				EditReplace(lpefr->hwnd, lpefr);
+				break;
+
+			case IDC_FINDALL:
+				// hold Shift to also list all matches, hold Ctrl to search files in current directory
+				if (KeyboardIsKeyDown(VK_CONTROL)) {
+					EditFindInFiles(lpefr);
+				} else {
+					EditFindAll(lpefr, false, KeyboardIsKeyDown(VK_SHIFT));
+				}
+				break;
+
+			case IDC_REPLACEALL:
+				if (bIsFindDlg) {
+					EditFindAll(lpefr, true, false);
+				} else {
+					bReplaceInitialized = true;
+					EditReplaceAll(lpefr->hwnd, lpefr);
+				}
+				break;
+
+			case IDC_REPLACEINSEL:
+				bReplaceInitialized = true;
+				EditReplaceAllInSelection(lpefr->hwnd, lpefr, EditReplaceAllFlag_Default);
+				break;
+			}
+		}
+		break;
+
+		case IDCANCEL:
+			DestroyWindow(hwnd);
+			break;
+
+		case IDACC_FIND:
+			PostWMCommand(hwndMain, IDM_EDIT_FIND);
+			break;
+
+		case IDACC_REPLACE:
+			PostWMCommand(hwndMain, IDM_EDIT_REPLACE);
+			break;
+
+		case IDACC_FINDNEXT:
+			PostWMCommand(hwnd, IDOK);
+			break;
+
+		case IDACC_FINDPREV:
+			PostWMCommand(hwnd, IDC_FINDPREV);
+			break;
+
+		case IDACC_REPLACENEXT:
+			if (GetDlgItem(hwnd, IDC_REPLACETEXT) != nullptr) {
+				PostWMCommand(hwnd, IDC_REPLACE);
+			}
+			break;
+
+		case IDACC_SAVEFIND: {
+			SendWMCommand(hwndMain, IDM_EDIT_SAVEFIND);
+			const EDITFINDREPLACE * const lpefr = AsPointer<const EDITFINDREPLACE *>(GetWindowLongPtr(hwnd, DWLP_USER));
+			SetDlgItemTextA2W(CP_UTF8, hwnd, IDC_FINDTEXT, lpefr->szFindUTF8);
+			CheckDlgButton(hwnd, IDC_FINDREGEXP, BST_UNCHECKED);
+			CheckDlgButton(hwnd, IDC_FINDTRANSFORMBS, BST_UNCHECKED);
+			PostMessage(hwnd, WM_NEXTDLGCTL, AsInteger<WPARAM>(GetDlgItem(hwnd, IDC_FINDTEXT)), TRUE);
+		}
+		break;
+
+		case IDC_TOGGLEFINDREPLACE: {
+			bSwitchedFindReplace |= 2;
+			EDITFINDREPLACE * const lpefr = AsPointer<EDITFINDREPLACE *>(GetWindowLongPtr(hwnd, DWLP_USER));
+			GetDlgPos(hwnd, &xFindReplaceDlgSave, &yFindReplaceDlgSave);
+			GetDlgItemTextA2W(CP_UTF8, hwnd, IDC_FINDTEXT, lpefr->szFindUTF8, COUNTOF(lpefr->szFindUTF8));
+			if (GetDlgItem(hwnd, IDC_REPLACETEXT) != nullptr) {
+				GetDlgItemTextA2W(CP_UTF8, hwnd, IDC_REPLACETEXT, lpefr->szReplaceUTF8, COUNTOF(lpefr->szReplaceUTF8));
+			}
+		}
+		break;
+		}
+		return TRUE;
+
+	case WM_NOTIFY: {
+		LPNMHDR pnmhdr = AsPointer<LPNMHDR>(lParam);
+		switch (pnmhdr->code) {
+		case NM_CLICK:
+		case NM_RETURN:
+			switch (pnmhdr->idFrom) {
+			case IDC_TOGGLEFINDREPLACE:
+				bSwitchedFindReplace = 1;
+				if (GetDlgItem(hwnd, IDC_REPLACETEXT)) {
+					PostWMCommand(hwndMain, IDM_EDIT_FIND);
+				} else {
+					PostWMCommand(hwndMain, IDM_EDIT_REPLACE);
+				}
+				break;
+
+			// Display help messages in the find/replace windows
+			case IDC_BACKSLASHHELP:
+				MsgBoxInfo(MB_OK, IDS_BACKSLASHHELP);
+				//ShowNotificationMessage(SC_NOTIFICATIONPOSITION_CENTER, IDS_BACKSLASHHELP);
+				break;
+
+			case IDC_REGEXPHELP:
+				MsgBoxInfo(MB_OK, IDS_REGEXPHELP);
+				//ShowNotificationMessage(SC_NOTIFICATIONPOSITION_CENTER, IDS_REGEXPHELP);
+				break;
+
+			case IDC_WILDCARDHELP:
+				MsgBoxInfo(MB_OK, IDS_WILDCARDHELP);
+				//ShowNotificationMessage(SC_NOTIFICATIONPOSITION_CENTER, IDS_WILDCARDHELP);
+				break;
+
+			case IDC_CLEAR_FIND:
+			case IDC_CLEAR_REPLACE: {
+				HWND hwndFind = GetDlgItem(hwnd, (pnmhdr->idFrom == IDC_CLEAR_FIND) ? IDC_FINDTEXT : IDC_REPLACETEXT);
+				ComboBox_GetText(hwndFind, tch, COUNTOF(tch));
+				ComboBox_ResetContent(hwndFind);
+				if (pnmhdr->idFrom == IDC_CLEAR_FIND) {
+					mruFind.Empty(true);
+				} else {
+					mruReplace.Empty(true);
+				}
+				ComboBox_SetText(hwndFind, tch);
+			}
+			break;
+
+			case IDC_SAVEPOSITION:
+				GetDlgPos(hwnd, &positionRecord.xFindReplaceDlg, &positionRecord.yFindReplaceDlg);
+				break;
+
+			case IDC_RESETPOSITION:
+				CenterDlgInParent(hwnd);
+				positionRecord.xFindReplaceDlg = positionRecord.yFindReplaceDlg = 0;
+				break;
+			}
+			break;
+		}
+	}
+	break;
+
+	case WM_ACTIVATE:
+		SetWindowTransparentMode(hwnd, (LOWORD(wParam) == WA_INACTIVE && (iFindReplaceOption & FindReplaceOption_TransparentMode) != 0), iFindReplaceOpacityLevel);
+		if (LOWORD(wParam) == WA_INACTIVE) {
+			// next typing starts from current selection
+			EditFindAsYouTypeStop(false);
+		}
+		break;
+	}
+
+	return FALSE;
+}
+
+//=============================================================================
+//
+// EditFindReplaceDlg()
+//
+HWND EditFindReplaceDlg(HWND hwnd, EDITFINDREPLACE *lpefr, bool bReplace) noexcept {
+	lpefr->hwnd = hwnd;
+	HWND hDlg = CreateThemedDialogParam(g_hInstance,
+								   bReplace ? MAKEINTRESOURCE(IDD_REPLACE) : MAKEINTRESOURCE(IDD_FIND),
+								   GetParent(hwnd),
+								   EditFindReplaceDlgProc,
+								   AsInteger<LPARAM>(lpefr));
+
+	ShowWindow(hDlg, SW_SHOW);
+	return hDlg;
+}
+
+// Wildcard search uses the regexp engine to perform a simple search with * ?
+// as wildcards instead of more advanced and user-unfriendly regexp syntax.
+static void EscapeWildcards(char *szFind2) noexcept {
+	char szWildcardEscaped[NP2_FIND_REPLACE_LIMIT];
+	int iSource = 0;
+	int iDest = 0;
+
+	while (szFind2[iSource]) {
+		const char c = szFind2[iSource];
+		if (c == '*') {
+			szWildcardEscaped[iDest++] = '.';
+			szWildcardEscaped[iDest] = '*';
+		} else if (c == '?') {
+			szWildcardEscaped[iDest] = '.';
+		} else {
+			if (c == '.' || c == '^' || c == '$' || c == '\\' || c == '[' || c == ']' || c == '+') {
+				szWildcardEscaped[iDest++] = '\\';
+			}
+			szWildcardEscaped[iDest] = c;
+		}
+		iSource++;
+		iDest++;
+	}
+	szWildcardEscaped[iDest] = 0;
+	strncpy(szFind2, szWildcardEscaped, COUNTOF(szWildcardEscaped));
+}
+
+int EditPrepareFind(char *szFind2, const EDITFINDREPLACE *lpefr) noexcept {
+	if (StrIsEmpty(lpefr->szFind)) {
+		return NP2_InvalidSearchFlags;
+	}
+
+	int searchFlags = lpefr->fuFlags;
+	strncpy(szFind2, lpefr->szFind, NP2_FIND_REPLACE_LIMIT);
+	if (lpefr->option & FindReplaceOption_TransformBackslash) {
+		const UINT cpEdit = SciCall_GetCodePage();
+		TransformBackslashes(szFind2, (searchFlags & SCFIND_REGEXP), cpEdit);
+	}
+	if (StrIsEmpty(szFind2)) {
+		InfoBoxWarn(MB_OK, L"MsgNotFound", IDS_NOTFOUND);
+		return NP2_InvalidSearchFlags;
+	}
+	if (lpefr->option & FindReplaceOption_WildcardSearch) {
+		EscapeWildcards(szFind2);
+		searchFlags |= SCFIND_REGEXP;
+	} else if (!(searchFlags & (SCFIND_REGEXP | SCFIND_MATCHCASE))) {
+		const BOOL sensitive = IsStringCaseSensitiveA(szFind2);
+		//printf("%s sensitive=%d\n", __func__, sensitive);
+		searchFlags |= ((sensitive - TRUE) & SCFIND_MATCHCASE);
+	}
+	return searchFlags;
+}
+
+int EditPrepareReplace(HWND hwnd, char *szFind2, char **pszReplace2, BOOL *bReplaceRE, const EDITFINDREPLACE *lpefr) noexcept {
+	const int searchFlags = EditPrepareFind(szFind2, lpefr);
+	if (searchFlags == NP2_InvalidSearchFlags) {
+		return searchFlags;
+	}
+
+	*bReplaceRE = (searchFlags & SCFIND_REGEXP);
+	if (StrEqualEx(lpefr->szReplace, "^c")) {
+		*bReplaceRE = FALSE;
+		*pszReplace2 = EditGetClipboardText(hwnd);
+	} else {
+		*pszReplace2 = StrDupA(lpefr->szReplace);
+		if (lpefr->option & FindReplaceOption_TransformBackslash) {
+			const UINT cpEdit = SciCall_GetCodePage();
+			TransformBackslashes(*pszReplace2, *bReplaceRE, cpEdit);
+		}
+	}
+
+	if (*pszReplace2 == nullptr) {
+		*pszReplace2 = StrDupA("");
+	}
+	return searchFlags;
+}
+
+//=============================================================================
+//
+// EditFindNext()
+//
+void EditFindNext(const EDITFINDREPLACE *lpefr, bool fExtendSelection) noexcept {
+	char szFind2[NP2_FIND_REPLACE_LIMIT];
+	const int searchFlags = EditPrepareFind(szFind2, lpefr);
+	if (searchFlags == NP2_InvalidSearchFlags) {
+		return;
+	}
+
+	const Sci_Position iSelPos = SciCall_GetCurrentPos();
+	const Sci_Position iSelAnchor = SciCall_GetAnchor();
+
+	Sci_TextToFindFull ttf = { { SciCall_GetSelectionEnd(), SciCall_GetLength() }, szFind2, { 0, 0 } };
+	Sci_Position iPos = SciCall_FindTextFull(searchFlags, &ttf);
+	bool bSuppressNotFound = false;
+
+	if (iPos < 0 && ttf.chrg.cpMin > 0 && (lpefr->option & FindReplaceOption_NoFindWrap) == 0 && !fExtendSelection) {
+		if (IDOK == InfoBoxInfo(MB_OKCANCEL, L"MsgFindWrap1", IDS_FIND_WRAPFW)) {
+			ttf.chrg.cpMin = 0;
+			iPos = SciCall_FindTextFull(searchFlags, &ttf);
+		} else {
+			bSuppressNotFound = true;
+		}
+	}
+
+	if (iPos < 0) {
+		// not found
+		if (!bSuppressNotFound) {
+			InfoBoxWarn(MB_OK, L"MsgNotFound", IDS_NOTFOUND);
+		}
+	} else {
+		if (!fExtendSelection) {
+			EditSelectEx(ttf.chrgText.cpMin, ttf.chrgText.cpMax);
+		} else {
+			EditSelectEx(min(iSelAnchor, iSelPos), ttf.chrgText.cpMax);
+		}
+		if (ttf.chrgText.cpMin == ttf.chrgText.cpMax) {
+			const WPARAM notifyPos = (static_cast<WPARAM>(ttf.chrgText.cpMin) << 2) | SC_NOTIFICATIONPOSITION_NONE;
+			ShowNotificationMessage(notifyPos, IDS_ZERO_LENGTH_MATCH);
+		}
+	}
+
+}
+
+//=============================================================================
+//
+// EditFindPrev()
+//
+void EditFindPrev(const EDITFINDREPLACE *lpefr, bool fExtendSelection) noexcept {
+	char szFind2[NP2_FIND_REPLACE_LIMIT];
+	const int searchFlags = EditPrepareFind(szFind2, lpefr);
+	if (searchFlags == NP2_InvalidSearchFlags) {
+		return;
+	}
+
+	const Sci_Position iSelPos = SciCall_GetCurrentPos();
+	const Sci_Position iSelAnchor = SciCall_GetAnchor();
+
+	Sci_TextToFindFull ttf = { { SciCall_GetSelectionStart(), 0 }, szFind2, { 0, 0 } };
+	Sci_Position iPos = SciCall_FindTextFull(searchFlags, &ttf);
+	const Sci_Position iLength = SciCall_GetLength();
+	bool bSuppressNotFound = false;
+
+	if (iPos < 0 && ttf.chrg.cpMin < iLength && (lpefr->option & FindReplaceOption_NoFindWrap) == 0 && !fExtendSelection) {
+		if (IDOK == InfoBoxInfo(MB_OKCANCEL, L"MsgFindWrap2", IDS_FIND_WRAPRE)) {
+			ttf.chrg.cpMin = iLength;
+			iPos = SciCall_FindTextFull(searchFlags, &ttf);
+		} else {
+			bSuppressNotFound = true;
+		}
+	}
+
+	if (iPos < 0) {
+		// not found
+		if (!bSuppressNotFound) {
+			InfoBoxWarn(MB_OK, L"MsgNotFound", IDS_NOTFOUND);
+		}
+	} else {
+		if (!fExtendSelection) {
+			EditSelectEx(ttf.chrgText.cpMin, ttf.chrgText.cpMax);
+		} else {
+			EditSelectEx(max(iSelPos, iSelAnchor), ttf.chrgText.cpMin);
+		}
+		if (ttf.chrgText.cpMin == ttf.chrgText.cpMax) {
+			const WPARAM notifyPos = (static_cast<WPARAM>(ttf.chrgText.cpMin) << 2) | SC_NOTIFICATIONPOSITION_NONE;
+			ShowNotificationMessage(notifyPos, IDS_ZERO_LENGTH_MATCH);
+		}
+	}
+}
+
+//=============================================================================
+//
+// EditReplace()
+//
+void EditReplace(HWND hwnd, const EDITFINDREPLACE *lpefr) noexcept {
+	BOOL bReplaceRE;
+	char szFind2[NP2_FIND_REPLACE_LIMIT];
+	char *pszReplace2;
+	const int searchFlags = EditPrepareReplace(hwnd, szFind2, &pszReplace2, &bReplaceRE, lpefr);
+	if (searchFlags == NP2_InvalidSearchFlags) {
+		return;
+	}
+
+	const Sci_Position iSelStart = SciCall_GetSelectionStart();
+	const Sci_Position iSelEnd = SciCall_GetSelectionEnd();
+
+	Sci_TextToFindFull ttf = { { iSelStart, SciCall_GetLength() }, szFind2, { 0, 0 } };
+	Sci_Position iPos = SciCall_FindTextFull(searchFlags, &ttf);
+	bool bSuppressNotFound = false;
+
+	if (iPos < 0 && ttf.chrg.cpMin > 0 && (lpefr->option & FindReplaceOption_NoFindWrap) == 0) {
+		if (IDOK == InfoBoxInfo(MB_OKCANCEL, L"MsgFindWrap1", IDS_FIND_WRAPFW)) {
+			ttf.chrg.cpMin = 0;
+			iPos = SciCall_FindTextFull(searchFlags, &ttf);
+		} else {
+			bSuppressNotFound = true;
+		}
+	}
+
+	if (iPos < 0) {
+		// not found
+		LocalFree(pszReplace2);
+		if (!bSuppressNotFound) {
+			InfoBoxWarn(MB_OK, L"MsgNotFound", IDS_NOTFOUND);
+		}
+		return;
+	}
+
+	if (iSelStart != ttf.chrgText.cpMin || iSelEnd != ttf.chrgText.cpMax) {
+		LocalFree(pszReplace2);
+		EditSelectEx(ttf.chrgText.cpMin, ttf.chrgText.cpMax);
+		return;
+	}
+
+	SciCall_SetTargetRange(ttf.chrgText.cpMin, ttf.chrgText.cpMax);
+	SciCall_ReplaceTargetEx(bReplaceRE, -1, pszReplace2);
+	LocalFree(pszReplace2);
+
+	ttf.chrg.cpMin = SciCall_GetTargetEnd();
+	ttf.chrg.cpMax = SciCall_GetLength();
+
+	iPos = SciCall_FindTextFull(searchFlags, &ttf);
+	bSuppressNotFound = false;
+
+	if (iPos < 0 && ttf.chrg.cpMin > 0 && (lpefr->option & FindReplaceOption_NoFindWrap) == 0) {
+		if (IDOK == InfoBoxInfo(MB_OKCANCEL, L"MsgFindWrap1", IDS_FIND_WRAPFW)) {
+			ttf.chrg.cpMin = 0;
+			iPos = SciCall_FindTextFull(searchFlags, &ttf);
+		} else {
+			bSuppressNotFound = true;
+		}
+	}
+
+	if (iPos >= 0) {
+		EditSelectEx(ttf.chrgText.cpMin, ttf.chrgText.cpMax);
+	} else {
+		iPos = SciCall_GetTargetEnd();
+		EditSelectEx(iPos, iPos); //?
+		if (!bSuppressNotFound) {
+			InfoBoxWarn(MB_OK, L"MsgNotFound", IDS_NOTFOUND);
+		}
+	}
+}
+
+//=============================================================================
+//
+// Mark all occurrences of the text currently selected (originally by Aleksandar Lekov)
+//
+
+extern EditMarkAll editMarkAll;
+extern IdleTaskTimer idleTaskTimer;
+#define EditMarkAll_MeasuredSize		(1024*1024)
+#define EditMarkAll_MinDuration			1.0
+// (100 / 64) => 2 MiB on second search.
+// increment search size will return to normal after several runs
+// when selection no longer changed, this make continuous selecting smooth.
+#define EditMarkAll_DefaultDuration		64
+#define EditMarkAll_RangeCacheCount		256
+// maximum number of ranges returned by each parallel search
+#define EditMarkAll_FindAllCount		16384
+//static UINT EditMarkAll_Runs;
+
+void EditMarkAll::Reset(int findFlag, Sci_Position iSelCount, LPSTR text) noexcept {
+	if (matchCount != 0) {
+		// clear existing indicator
+		SciCall_SetIndicatorCurrent(IndicatorNumber_MarkOccurrence);
+		SciCall_IndicatorClearRange(0, SciCall_GetLength());
+		UpdateStatusBarCache(StatusItem_Find);
+	}
+	if (prevBookmarkLine >= 0 || bookmarkForFindAll) {
+		if ((findFlag | markFlag) & NP2_MarkAllBookmark) {
+			if ((findFlag & (NP2_MarkAllBookmark | NP2_FromFindAll)) != 0 || !bookmarkForFindAll) {
+				SciCall_MarkerDeleteAll(MarkerNumber_Bookmark);
+			}
+		}
+	}
+	if (pszText) {
+		NP2HeapFree(pszText);
+	}
+
+	pending = false;
+	ignoreSelectionUpdate = false;
+	markFlag = findFlag;
+	incrementSize = 1;
+	length = iSelCount;
+	pszText = text;
+	// timing for increment search is only useful for current search.
+	duration = EditMarkAll_DefaultDuration;
+	matchCount = 0;
+	lastMatchPos = 0;
+	prevStopPos = 0;
+	prevBookmarkLine = -1;
+}
+
+void EditMarkAll::Start(BOOL bChanged, int findFlag, Sci_Position iSelCount, LPSTR text) noexcept {
+	if (!bChanged && (findFlag == (markFlag & (NP2_SearchForLineEnd - 1))
+		&& iSelCount == length
+		// _stricmp() is not safe for DBCS string.
+		&& memcmp(text, pszText, iSelCount) == 0)) {
+		NP2HeapFree(text);
+		return;
+	}
+
+	Reset(findFlag, iSelCount, text);
+	if ((findFlag & SCFIND_REGEXP) && iSelCount == 1) {
+		const char ch = *text;
+		if (ch == '^' || ch == '$') {
+			const Sci_Line lineCount = SciCall_GetLineCount();
+			matchCount = lineCount - (ch == '^');
+			UpdateStatusBarCache(StatusItem_Find);
+			UpdateStatusbar();
+			return;
+		}
+	} else if (findFlag & SCFIND_REGEXP) {
+		// see BuiltinRegex::FindText()
+		const char ch = text[iSelCount - 1];
+		if (ch == '$' && text[iSelCount - 2] != '\\') {
+			markFlag |= NP2_SearchForLineEnd;
+		}
+	}
+
+	//EditMarkAll_Runs = 0;
+	bookmarkForFindAll = false;
+	if (findFlag & NP2_MarkAllBookmark) {
+		bookmarkForFindAll = (findFlag & NP2_FromFindAll) != 0;
+		Style_SetBookmark();
+	}
+	Continue(idleTaskTimer);
+}
+
+void EditMarkAll::Stop() noexcept {
+	pending = false;
+	matchCount = 0;
+	idleTaskTimer.Set(0);
+	Clear();
+}
+
+static void EditFindAllResults_Append(const Sci_Position *ranges, UINT index) noexcept;
+
+static Sci_Line EditMarkAll_Bookmark(Sci_Line bookmarkLine, const Sci_Position *ranges, UINT index, int findFlag, Sci_Position matchCount) noexcept {
+	if (findFlag & NP2_MarkAllListResults) {
+		EditFindAllResults_Append(ranges, index);
+	}
+	if (findFlag & NP2_MarkAllSelectAll) {
+		UINT i = 0;
+		if (matchCount == static_cast<Sci_Position>(index/2)) {
+			i = 2;
+			SciCall_SetSelection(ranges[0] + ranges[1], ranges[0]);
+		}
+		for (; i < index; i += 2) {
+			SciCall_AddSelection(ranges[i] + ranges[i + 1], ranges[i]);
+		}
+	} else {
+		SciCall_IndicatorFillRanges(index/2, ranges);
+	}
+	if (!(findFlag & NP2_MarkAllBookmark)) {
+		return bookmarkLine;
+	}
+	if (findFlag & NP2_MarkAllMultiline) {
+		for (UINT i = 0; i < index; i += 2) {
+			Sci_Line line = SciCall_LineFromPosition(ranges[i]);
+			const Sci_Line lineEnd = SciCall_LineFromPosition(ranges[i] + ranges[i + 1]);
+			line = max(bookmarkLine + 1, line);
+			while (line <= lineEnd) {
+				SciCall_MarkerAdd(line, MarkerNumber_Bookmark);
+				++line;
+			}
+			bookmarkLine = lineEnd;
+		}
+	} else {
+		for (UINT i = 0; i < index; i += 2) {
+			const Sci_Line line = SciCall_LineFromPosition(ranges[i]);
+			if (line != bookmarkLine) {
+				SciCall_MarkerAdd(line, MarkerNumber_Bookmark);
+				bookmarkLine = line;
+			}
 		}
-		return FALSE;
+	}
+	return bookmarkLine;
+}
 
-	case WM_COMMAND:
-		switch (LOWORD(wParam)) {
-		case IDC_FINDTEXT:
-		case IDC_REPLACETEXT: {
-			HWND hwndFind = GetDlgItem(hwnd, IDC_FINDTEXT);
-			const BOOL bEnable = ComboBox_HasText(hwndFind);
+void EditMarkAll::Continue(IdleTaskTimer &timer) noexcept {
+	// use increment search to ensure FindText() terminated in expected time.
+	//++EditMarkAll_Runs;
+	//printf("match %3u %s\n", EditMarkAll_Runs, GetCurrentLogTime());
+	QueryPerformanceCounter(&watch.begin);
+	const Sci_Position iLength = SciCall_GetLength();
+	Sci_Position iStartPos = prevStopPos;
+	Sci_Position iMaxLength = incrementSize * EditMarkAll_MeasuredSize;
+	iMaxLength += iStartPos + length;
+	iMaxLength = min(iMaxLength, iLength);
+	if (iMaxLength < iLength) {
+		// match on whole line to avoid rewinding.
+		iMaxLength = SciCall_PositionFromLine(SciCall_LineFromPosition(iMaxLength) + 1);
+		if (iMaxLength + EditMarkAll_MeasuredSize >= iLength) {
+			iMaxLength = iLength;
+		}
+	}
 
-			EnableWindow(GetDlgItem(hwnd, IDOK), bEnable);
-			EnableWindow(GetDlgItem(hwnd, IDC_FINDPREV), bEnable);
-			EnableWindow(GetDlgItem(hwnd, IDC_FINDALL), bEnable);
-			EnableWindow(GetDlgItem(hwnd, IDC_REPLACE), bEnable);
-			EnableWindow(GetDlgItem(hwnd, IDC_REPLACEALL), bEnable);
-			EnableWindow(GetDlgItem(hwnd, IDC_REPLACEINSEL), bEnable);
+	// rewind start position
+	const int findFlag = markFlag;
+	if (findFlag & NP2_MarkAllMultiline) {
+		iStartPos = max(iStartPos - length + 1, lastMatchPos);
+	}
 
-			if (HIWORD(wParam) == CBN_CLOSEUP) {
-				HWND hwndCtl = GetDlgItem(hwnd, LOWORD(wParam));
-				const DWORD lSelEnd = ComboBox_GetEditSelEnd(hwndCtl);
-				ComboBox_SetEditSel(hwndCtl, lSelEnd, lSelEnd);
-			}
-		}
-		break;
+	Sci_Position cpMin = iStartPos;
+	Sci_TextToFindFull ttf = { { cpMin, iMaxLength }, pszText, { 0, 0 } };
 
-		case IDC_FINDREGEXP:
-			if (IsButtonChecked(hwnd, IDC_FINDREGEXP)) {
-				CheckDlgButton(hwnd, IDC_FINDTRANSFORMBS, BST_UNCHECKED);
-				// Can not use wildcard search together with regexp
-				CheckDlgButton(hwnd, IDC_WILDCARDSEARCH, BST_UNCHECKED);
-			}
-			break;
+	Sci_Position matchCount_ = matchCount;
+	UINT index = 0;
+	Sci_Position ranges[EditMarkAll_RangeCacheCount*2];
+	Sci_Line bookmarkLine = prevBookmarkLine;
 
-		case IDC_FINDTRANSFORMBS:
-			if (IsButtonChecked(hwnd, IDC_FINDTRANSFORMBS)) {
-				CheckDlgButton(hwnd, IDC_FINDREGEXP, BST_UNCHECKED);
+	SciCall_SetIndicatorCurrent(IndicatorNumber_MarkOccurrence);
+	timer.Start(WaitableTimer_IdleTaskTimeSlot);
+	// plain text is searched on line aligned chunks in parallel, found ranges are merged in batches.
+	Sci_Position * const found = ((findFlag & (SCFIND_REGEXP | NP2_MarkAllMultiline)) == 0)
+		? static_cast<Sci_Position *>(NP2HeapAlloc(EditMarkAll_FindAllCount*2*sizeof(Sci_Position))) : nullptr;
+	if (found != nullptr) {
+		Sci_TextToFindAllFull ttfa = { { cpMin, iMaxLength }, pszText, found, EditMarkAll_FindAllCount };
+		while (cpMin < iMaxLength && timer.Continue()) {
+			ttfa.chrg.cpMin = cpMin;
+			const Sci_Position count = SciCall_FindAllFull(findFlag, &ttfa);
+			for (Sci_Position i = 0; i < count*2; i += 2) {
+				const Sci_Position iPos = found[i];
+				const Sci_Position iSelCount = found[i + 1];
+				++matchCount_;
+				if (index != 0 && iPos == cpMin && (findFlag & (NP2_MarkAllSelectAll | NP2_MarkAllListResults)) == 0) {
+					ranges[index - 1] += iSelCount;
+				} else {
+					ranges[index] = iPos;
+					ranges[index + 1] = iSelCount;
+					index += 2;
+					if (index == COUNTOF(ranges)) {
+						bookmarkLine = EditMarkAll_Bookmark(bookmarkLine, ranges, index, findFlag, matchCount_);
+						index = 0;
+					}
+				}
+				cpMin = iPos + iSelCount;
 			}
+			cpMin = ttfa.chrg.cpMin;
+		}
+		NP2HeapFree(found);
+	}
+	while (cpMin < iMaxLength && timer.Continue()) {
+		ttf.chrg.cpMin = cpMin;
+		const Sci_Position iPos = SciCall_FindTextFull(findFlag, &ttf);
+		if (iPos < 0) {
+			iStartPos = iMaxLength;
 			break;
+		}
 
-		case IDC_WILDCARDSEARCH:
-			CheckDlgButton(hwnd, IDC_FINDREGEXP, BST_UNCHECKED);
-			//if (IsButtonChecked(hwnd, IDC_FINDWILDCARDS))
-			//	CheckDlgButton(hwnd, IDC_FINDREGEXP, BST_UNCHECKED);
-			break;
+		++matchCount_;
+		const Sci_Position iSelCount = ttf.chrgText.cpMax - iPos;
+		if (iSelCount == 0) {
+			// empty regex
+			cpMin = SciCall_PositionAfter(iPos);
+			continue;
+		}
 
-		case IDC_FIND_CXXREGEX:
-		case IDC_TRANSPARENT:
-		case IDC_USEMONOSPACEDFONT:
-		case IDC_FINDALLBOOKMARK: {
-			const int mask = 1 << (LOWORD(wParam) - IDC_FIND_CXXREGEX);
-			if (IsButtonChecked(hwnd, LOWORD(wParam))) {
-				iFindReplaceOption |= mask;
-			} else {
-				iFindReplaceOption &= ~mask;
-			}
-			if (LOWORD(wParam) == IDC_USEMONOSPACEDFONT) {
-				if (hFontFindReplaceEdit) { // dpi may changed between toggle monospaced font
-					DeleteObject(hFontFindReplaceEdit);
-					hFontFindReplaceEdit = nullptr;
-				}
-				FindReplaceSetFont(hwnd, iFindReplaceOption & FindReplaceOption_UseMonospacedFont, &hFontFindReplaceEdit);
+		if (index != 0 && iPos == cpMin && (findFlag & (NP2_MarkAllSelectAll | NP2_MarkAllListResults | NP2_SearchForLineEnd)) == 0) {
+			// TODO: avoid merge adjacent indicator ranges when they are not on same line.
+			ranges[index - 1] += iSelCount;
+		} else {
+			ranges[index] = iPos;
+			ranges[index + 1] = iSelCount;
+			index += 2;
+			if (index == COUNTOF(ranges)) {
+				bookmarkLine = EditMarkAll_Bookmark(bookmarkLine, ranges, index, findFlag, matchCount_);
+				index = 0;
 			}
-		} break;
+		}
+		cpMin = ttf.chrgText.cpMax;
+	}
+	if (index) {
+		bookmarkLine = EditMarkAll_Bookmark(bookmarkLine, ranges, index, findFlag, matchCount_);
+	}
 
-		case IDOK:
-		case IDC_FINDPREV:
-		case IDC_FINDALL:
-		case IDC_REPLACE:
-		case IDC_REPLACEALL:
-		case IDC_REPLACEINSEL:
-		case IDACC_SELTONEXT:
-		case IDACC_SELTOPREV: {
-			EDITFINDREPLACE * const lpefr = AsPointer<EDITFINDREPLACE *>(GetWindowLongPtr(hwnd, DWLP_USER));
-			HWND hwndFind = GetDlgItem(hwnd, IDC_FINDTEXT);
-			HWND hwndRepl = GetDlgItem(hwnd, IDC_REPLACETEXT);
-			const bool bIsFindDlg = (hwndRepl == nullptr);
-			// Get current code page for Unicode conversion
-			const UINT cpEdit = SciCall_GetCodePage();
+	iStartPos = max(iStartPos, cpMin);
+	pending = iStartPos < iLength;
+	if (pending) {
+		// dynamic compute increment search size, see ActionDuration in Scintilla.
+		watch.Stop();
+		const double period = watch.Get();
+		iMaxLength = iStartPos - prevStopPos;
+		const double durationOne = (EditMarkAll_MeasuredSize * period) / iMaxLength;
+		constexpr double alpha = 0.25;
+		const double duration_ = alpha * durationOne + (1.0 - alpha) * duration;
+		duration = max(duration_, EditMarkAll_MinDuration);
+		incrementSize = 1 + static_cast<int>(WaitableTimer_IdleTaskTimeSlot / duration);
+		//printf("match %3u (%zd, %zd) length=%.3f / %zd, one=%.3f, duration=%.3f / %.3f, increment=%d\n", EditMarkAll_Runs,
+		//	prevStopPos, iStartPos, period, iMaxLength, durationOne, duration, duration_, incrementSize);
+	}
 
-			if (!GetDlgItemTextA2W(cpEdit, hwnd, IDC_FINDTEXT, lpefr->szFind, COUNTOF(lpefr->szFind))) {
-				EnableWindow(GetDlgItem(hwnd, IDOK), FALSE);
-				EnableWindow(GetDlgItem(hwnd, IDC_FINDPREV), FALSE);
-				EnableWindow(GetDlgItem(hwnd, IDC_FINDALL), FALSE);
-				EnableWindow(GetDlgItem(hwnd, IDC_REPLACE), FALSE);
-				EnableWindow(GetDlgItem(hwnd, IDC_REPLACEALL), FALSE);
-				EnableWindow(GetDlgItem(hwnd, IDC_REPLACEINSEL), FALSE);
-				return TRUE;
-			}
+	if (TraceProviderEnabled()) {
+		watch.Stop();
+		TraceLogMarkAll(prevStopPos, iStartPos, matchCount_ - matchCount, watch.Get());
+	}
 
-			if (!bIsFindDlg) {
-				GetDlgItemTextA2W(cpEdit, hwnd, IDC_REPLACETEXT, lpefr->szReplace, COUNTOF(lpefr->szReplace));
-			}
+	ignoreSelectionUpdate = matchCount_ && (findFlag & NP2_MarkAllSelectAll);
+	lastMatchPos = cpMin;
+	prevStopPos = iStartPos;
+	prevBookmarkLine = bookmarkLine;
+	if (!pending || matchCount_ != matchCount) {
+		matchCount = matchCount_;
+		UpdateStatusBarCache(StatusItem_Find);
+		UpdateStatusbar();
+	}
+}
 
-			unsigned mask = SCFIND_NONE;
-			if (IsButtonChecked(hwnd, IDC_FINDCASE)) {
-				mask |= SCFIND_MATCHCASE;
-			}
-			if (IsButtonChecked(hwnd, IDC_FINDWORD)) {
-				mask |= SCFIND_WHOLEWORD;
-			}
-			if (IsButtonChecked(hwnd, IDC_FINDSTART)) {
-				mask |= SCFIND_WORDSTART;
-			}
-			if (IsButtonChecked(hwnd, IDC_FINDREGEXP)) {
-				if (iFindReplaceOption & FindReplaceOption_UseCxxRegex) {
-					mask |= SCFIND_REGEXP | SCFIND_CXX11REGEX;
-					if (IsButtonChecked(hwnd, IDC_FIND_DOTALL)) {
-						mask |= SCFIND_REGEX_DOT_ALL;
-					}
-				} else {
-					mask |= SCFIND_REGEXP | SCFIND_POSIX;
-				}
-			}
-			lpefr->fuFlags = mask;
+void EditMarkAll::MarkAll(BOOL bChanged, int option) noexcept {
+	// get current selection
+	Sci_Position iSelStart = SciCall_GetSelectionStart();
+	const Sci_Position iSelEnd = SciCall_GetSelectionEnd();
+	Sci_Position iSelCount = iSelEnd - iSelStart;
 
-			mask = FindReplaceOption_None;
-			if (IsButtonChecked(hwnd, IDC_FINDTRANSFORMBS)) {
-				mask |= FindReplaceOption_TransformBackslash;
-			}
-			if (IsButtonChecked(hwnd, IDC_WILDCARDSEARCH)) {
-				mask |= FindReplaceOption_WildcardSearch;
-			}
-			if (IsButtonChecked(hwnd, IDC_NOWRAP)) {
-				mask |= FindReplaceOption_NoFindWrap;
-			}
+	// if nothing selected or multiple lines are selected exit
+	if (iSelCount == 0 || SciCall_LineFromPosition(iSelStart) != SciCall_LineFromPosition(iSelEnd)) {
+		Clear();
+		return;
+	}
 
-			bool bCloseDlg = IsButtonChecked(hwnd, IDC_FINDCLOSE);
-			if (bCloseDlg) {
-				mask |= bIsFindDlg ? FindReplaceOption_CloseFind : FindReplaceOption_CloseReplace;
-				if (!bIsFindDlg && LOWORD(wParam) == IDOK) {
-					bCloseDlg = false;
-				}
-			}
-			mask |= lpefr->option & (bIsFindDlg ? FindReplaceOption_CloseReplace : FindReplaceOption_CloseFind);
-			lpefr->option = mask;
+	iSelCount = SciCall_GetSelTextLength();
+	char *text = static_cast<char *>(NP2HeapAlloc(iSelCount + 1));
+	SciCall_GetSelText(text);
 
-			// Save MRUs
-			if (StrNotEmpty(lpefr->szFind)) {
-				if (GetDlgItemTextA2W(CP_UTF8, hwnd, IDC_FINDTEXT, lpefr->szFindUTF8, COUNTOF(lpefr->szFindUTF8))) {
-					ComboBox_GetText(hwndFind, tch, COUNTOF(tch));
-					mruFind.AddMultiline(tch);
-				}
-			}
-			if (StrNotEmpty(lpefr->szReplace)) {
-				if (GetDlgItemTextA2W(CP_UTF8, hwnd, IDC_REPLACETEXT, lpefr->szReplaceUTF8, COUNTOF(lpefr->szReplaceUTF8))) {
-					ComboBox_GetText(hwndRepl, tch, COUNTOF(tch));
-					mruReplace.AddMultiline(tch);
-				}
-			} else {
-				strcpy(lpefr->szReplaceUTF8, "");
+	static_assert(NP2_MarkAllBookmark == MarkOccurrences_Bookmark << 10);
+	int findFlag = (option & MarkOccurrences_Bookmark) << 10;
+	// exit if selection is not a word and Match whole words only is enabled
+	if (option & MarkOccurrences_WholeWord) {
+		findFlag |= SCFIND_WHOLEWORD;
+		const UINT cpEdit = SciCall_GetCodePage();
+		const bool dbcs = !(cpEdit == CP_UTF8 || cpEdit == 0);
+		// CharClassify::SetDefaultCharClasses()
+		for (iSelStart = 0; iSelStart < iSelCount; ++iSelStart) {
+			const unsigned char ch = text[iSelStart];
+			if (dbcs && IsDBCSLeadByteEx(cpEdit, ch)) {
+				++iSelStart;
+			} else if (!IsDocWordChar(ch)) {
+				NP2HeapFree(text);
+				Clear();
+				return;
 			}
+		}
+	}
+	if (option & MarkOccurrences_MatchCase) {
+		findFlag |= SCFIND_MATCHCASE;
+	} else {
+		const bool sensitive = IsStringCaseSensitiveA(text);
+		//printf("%s sensitive=%d\n", __func__, sensitive);
+		if (!sensitive) {
+			findFlag |= SCFIND_MATCHCASE;
+		}
+	}
 
-			// Reload MRUs
-			ComboBox_ResetContent(hwndFind);
-			ComboBox_ResetContent(hwndRepl);
-			mruFind.AddToCombobox(hwndFind);
-			mruReplace.AddToCombobox(hwndRepl);
+	Start(bChanged, findFlag, iSelCount, text);
+}
 
-			SetDlgItemTextA2W(CP_UTF8, hwnd, IDC_FINDTEXT, lpefr->szFindUTF8);
-			SetDlgItemTextA2W(CP_UTF8, hwnd, IDC_REPLACETEXT, lpefr->szReplaceUTF8);
+void EditFindAll(const EDITFINDREPLACE *lpefr, bool selectAll, bool listResults) noexcept {
+	char *szFind2 = static_cast<char *>(NP2HeapAlloc(NP2_FIND_REPLACE_LIMIT));
+	int searchFlags = EditPrepareFind(szFind2, lpefr);
+	if (searchFlags == NP2_InvalidSearchFlags) {
+		NP2HeapFree(szFind2);
+		return;
+	}
 
-			SendMessage(hwnd, WM_NEXTDLGCTL, AsInteger<WPARAM>(GetFocus()), TRUE);
+	static_assert(NP2_MarkAllBookmark == FindReplaceOption_FindAllBookmark << 10);
+	searchFlags |= ((iFindReplaceOption & FindReplaceOption_FindAllBookmark) << 10)
+		| ((static_cast<int>(selectAll)) * NP2_MarkAllSelectAll)
+		| ((static_cast<int>(listResults)) * NP2_MarkAllListResults)
+		| NP2_FromFindAll;
+	// rewind start position when transform backslash is checked,
+	// all other searching doesn't across lines.
+	// NOTE: complex fix is needed when multiline regex is supported.
+	if ((searchFlags & SCFIND_REGEX_DOT_ALL) != 0 || ((lpefr->option & FindReplaceOption_TransformBackslash) != 0 && strpbrk(szFind2, "\r\n") != nullptr)) {
+		searchFlags |= NP2_MarkAllMultiline;
+	}
+	if (listResults) {
+		if (!IsWindow(hDlgFindAllResults)) {
+			hDlgFindAllResults = EditFindAllResultsDlg(hwndMain);
+		}
+		EditFindAllResults_Clear();
+	}
+	// always restart the search when results are listed, as previous results are cleared.
+	editMarkAll.Start(static_cast<BOOL>(listResults), searchFlags, strlen(szFind2), szFind2);
+}
 
-			if (bCloseDlg) {
-				DestroyWindow(hwnd);
-				hDlgFindReplace = nullptr;
-			}
+//=============================================================================
+//
+// Find All results, appended by EditMarkAll::Continue() in batches,
+// the list view is virtual (LVS_OWNERDATA) so item text is only built when painted.
+//
+namespace {
 
-			switch (LOWORD(wParam)) {
-			case IDOK: // find next
-			case IDACC_SELTONEXT:
-				if (!bIsFindDlg) {
-					bReplaceInitialized = true;
-				}
-				EditFindNext(lpefr, LOWORD(wParam) == IDACC_SELTONEXT || KeyboardIsKeyDown(VK_SHIFT));
-				break;
+struct FindAllResults {
+	HWND hwndList;
+	Sci_Position count;
+	Sci_Position capacity;
+	Sci_Position *ranges;	// start position and length for each match
+};
 
-			case IDC_FINDPREV: // find previous
-			case IDACC_SELTOPREV:
-				if (!bIsFindDlg) {
-					bReplaceInitialized = true;
-				}
-				EditFindPrev(lpefr, LOWORD(wParam) == IDACC_SELTOPREV || KeyboardIsKeyDown(VK_SHIFT));
-				break;
+FindAllResults findAllResults;
 
-			case IDC_REPLACE:
-				bReplaceInitialized = true;
-				EditReplace(lpefr->hwnd, lpefr);
-				break;
+}
 
-			case IDC_FINDALL:
-				EditFindAll(lpefr, false);
-				break;
+void EditFindAllResults_Clear() noexcept {
+	auto &results = findAllResults;
+	if (results.ranges) {
+		NP2HeapFree(results.ranges);
+		results.ranges = nullptr;
+	}
+	results.count = 0;
+	results.capacity = 0;
+	if (results.hwndList) {
+		ListView_SetItemCount(results.hwndList, 0);
+	}
+}
 
-			case IDC_REPLACEALL:
-				if (bIsFindDlg) {
-					EditFindAll(lpefr, true);
-				} else {
-					bReplaceInitialized = true;
-					EditReplaceAll(lpefr->hwnd, lpefr);
-				}
-				break;
+static void EditFindAllResults_Append(const Sci_Position *ranges, UINT index) noexcept {
+	auto &results = findAllResults;
+	// results dialog was closed while searching
+	if (results.hwndList == nullptr) {
+		return;
+	}
 
-			case IDC_REPLACEINSEL:
-				bReplaceInitialized = true;
-				EditReplaceAllInSelection(lpefr->hwnd, lpefr, EditReplaceAllFlag_Default);
-				break;
-			}
+	const Sci_Position count = results.count + index/2;
+	if (count > results.capacity) {
+		const Sci_Position capacity = max<Sci_Position>(count, 2*results.capacity + 1024);
+		const size_t size = capacity * 2 * sizeof(Sci_Position);
+		Sci_Position *buffer = static_cast<Sci_Position *>(results.ranges ? NP2HeapReAlloc(results.ranges, size) : NP2HeapAlloc(size));
+		if (buffer == nullptr) {
+			return;
 		}
-		break;
+		results.ranges = buffer;
+		results.capacity = capacity;
+	}
 
-		case IDCANCEL:
-			DestroyWindow(hwnd);
-			break;
+	memcpy(results.ranges + results.count*2, ranges, index*sizeof(Sci_Position));
+	results.count = count;
+	ListView_SetItemCountEx(results.hwndList, min<Sci_Position>(count, INT_MAX), LVSICF_NOINVALIDATEALL | LVSICF_NOSCROLL);
+}
 
-		case IDACC_FIND:
-			PostWMCommand(hwndMain, IDM_EDIT_FIND);
-			break;
+static void EditFindAllResults_GetText(int iItem, LPWSTR pszText, int cchText) noexcept {
+	const auto &results = findAllResults;
+	if (iItem < 0 || iItem >= results.count || cchText < 64) {
+		return;
+	}
 
-		case IDACC_REPLACE:
-			PostWMCommand(hwndMain, IDM_EDIT_REPLACE);
-			break;
+	// clamp to current document, results are not updated after editing.
+	const Sci_Position iPos = min(results.ranges[2*iItem], SciCall_GetLength());
+	const Sci_Line iLine = SciCall_LineFromPosition(iPos);
+	const Sci_Position iCol = SciCall_GetColumn(iPos);
+	Sci_Position iStart = SciCall_PositionFromLine(iLine);
+	const Sci_Position iEnd = SciCall_GetLineEndPosition(iLine);
+	// show some text before the match on long line
+	if (iPos - iStart > 32) {
+		iStart = SciCall_PositionAfter(iPos - 32);
+	}
+
+	PosToStr(iLine + 1, pszText);
+	int cch = lstrlen(pszText);
+	pszText[cch++] = L':';
+	PosToStr(iCol + 1, pszText + cch);
+	cch += lstrlen(pszText + cch);
+	pszText[cch++] = L':';
+	pszText[cch++] = L' ';
+	EditGetExcerptRange(iStart, iEnd, pszText + cch, cchText - cch);
+}
+
+static void EditFindAllResults_Select(int iItem) noexcept {
+	const auto &results = findAllResults;
+	if (iItem < 0 || iItem >= results.count) {
+		return;
+	}
 
-		case IDACC_FINDNEXT:
-			PostWMCommand(hwnd, IDOK);
-			break;
+	const Sci_Position iLength = SciCall_GetLength();
+	const Sci_Position iPos = min(results.ranges[2*iItem], iLength);
+	const Sci_Position iEnd = min(iPos + results.ranges[2*iItem + 1], iLength);
+	// keep current marking and results when jumping to a match.
+	editMarkAll.ignoreSelectionUpdate = true;
+	EditSelectEx(iPos, iEnd);
+}
 
-		case IDACC_FINDPREV:
-			PostWMCommand(hwnd, IDC_FINDPREV);
-			break;
+static INT_PTR CALLBACK EditFindAllResultsDlgProc(HWND hwnd, UINT umsg, WPARAM wParam, LPARAM lParam) noexcept {
+	static const DWORD controlDefinition[] = {
+		DeferCtlMove(IDC_RESIZEGRIP),
+		DeferCtlSize(IDC_FINDALLRESULTS) | RESIZE_AUTOSIZE_USEHEADER,
+	};
 
-		case IDACC_REPLACENEXT:
-			if (GetDlgItem(hwnd, IDC_REPLACETEXT) != nullptr) {
-				PostWMCommand(hwnd, IDC_REPLACE);
-			}
-			break;
+	switch (umsg) {
+	case WM_INITDIALOG: {
+		HWND hwndLV = GetDlgItem(hwnd, IDC_FINDALLRESULTS);
+		InitWindowCommon(hwndLV);
+		ResizeDlg_Init(hwnd, &positionRecord.cxFindAllResultsDlg, &positionRecord.cyFindAllResultsDlg, controlDefinition, COUNTOF(controlDefinition));
 
-		case IDACC_SAVEFIND: {
-			SendWMCommand(hwndMain, IDM_EDIT_SAVEFIND);
-			const EDITFINDREPLACE * const lpefr = AsPointer<const EDITFINDREPLACE *>(GetWindowLongPtr(hwnd, DWLP_USER));
-			SetDlgItemTextA2W(CP_UTF8, hwnd, IDC_FINDTEXT, lpefr->szFindUTF8);
-			CheckDlgButton(hwnd, IDC_FINDREGEXP, BST_UNCHECKED);
-			CheckDlgButton(hwnd, IDC_FINDTRANSFORMBS, BST_UNCHECKED);
-			PostMessage(hwnd, WM_NEXTDLGCTL, AsInteger<WPARAM>(GetDlgItem(hwnd, IDC_FINDTEXT)), TRUE);
-		}
-		break;
+		ListView_SetExtendedListViewStyle(hwndLV, LVS_EX_FULLROWSELECT | LVS_EX_DOUBLEBUFFER | LVS_EX_LABELTIP);
+		const LVCOLUMN lvc = { LVCF_FMT | LVCF_TEXT, LVCFMT_LEFT, 0, nullptr, -1, 0, 0, 0
+#if _WIN32_WINNT >= _WIN32_WINNT_VISTA
+			, 0, 0, 0
+#endif
+		};
+		ListView_InsertColumn(hwndLV, 0, &lvc);
+		ListView_SetColumnWidth(hwndLV, 0, LVSCW_AUTOSIZE_USEHEADER);
 
-		case IDC_TOGGLEFINDREPLACE: {
-			bSwitchedFindReplace |= 2;
-			EDITFINDREPLACE * const lpefr = AsPointer<EDITFINDREPLACE *>(GetWindowLongPtr(hwnd, DWLP_USER));
-			GetDlgPos(hwnd, &xFindReplaceDlgSave, &yFindReplaceDlgSave);
-			GetDlgItemTextA2W(CP_UTF8, hwnd, IDC_FINDTEXT, lpefr->szFindUTF8, COUNTOF(lpefr->szFindUTF8));
-			if (GetDlgItem(hwnd, IDC_REPLACETEXT) != nullptr) {
-				GetDlgItemTextA2W(CP_UTF8, hwnd, IDC_REPLACETEXT, lpefr->szReplaceUTF8, COUNTOF(lpefr->szReplaceUTF8));
-			}
-		}
-		break;
-		}
-		return TRUE;
+		findAllResults.hwndList = hwndLV;
+		CenterDlgInParent(hwnd);
+	}
+	return TRUE;
+
+	case WM_DESTROY:
+		findAllResults.hwndList = nullptr;
+		EditFindAllResults_Clear();
+		hDlgFindAllResults = nullptr;
+		return FALSE;
 
 	case WM_NOTIFY: {
-		LPNMHDR pnmhdr = AsPointer<LPNMHDR>(lParam);
-		switch (pnmhdr->code) {
-		case NM_CLICK:
-		case NM_RETURN:
-			switch (pnmhdr->idFrom) {
-			case IDC_TOGGLEFINDREPLACE:
-				bSwitchedFindReplace = 1;
-				if (GetDlgItem(hwnd, IDC_REPLACETEXT)) {
-					PostWMCommand(hwndMain, IDM_EDIT_FIND);
-				} else {
-					PostWMCommand(hwndMain, IDM_EDIT_REPLACE);
+		const LPNMHDR pnmhdr = AsPointer<LPNMHDR>(lParam);
+		if (pnmhdr->idFrom == IDC_FINDALLRESULTS) {
+			switch (pnmhdr->code) {
+			case LVN_GETDISPINFO: {
+				const NMLVDISPINFO *lpdi = AsPointer<NMLVDISPINFO *>(lParam);
+				if (lpdi->item.mask & LVIF_TEXT) {
+					EditFindAllResults_GetText(lpdi->item.iItem, lpdi->item.pszText, lpdi->item.cchTextMax);
 				}
-				break;
-
-			// Display help messages in the find/replace windows
-			case IDC_BACKSLASHHELP:
-				MsgBoxInfo(MB_OK, IDS_BACKSLASHHELP);
-				//ShowNotificationMessage(SC_NOTIFICATIONPOSITION_CENTER, IDS_BACKSLASHHELP);
-				break;
-
-			case IDC_REGEXPHELP:
-				MsgBoxInfo(MB_OK, IDS_REGEXPHELP);
-				//ShowNotificationMessage(SC_NOTIFICATIONPOSITION_CENTER, IDS_REGEXPHELP);
-				break;
-
-			case IDC_WILDCARDHELP:
-				MsgBoxInfo(MB_OK, IDS_WILDCARDHELP);
-				//ShowNotificationMessage(SC_NOTIFICATIONPOSITION_CENTER, IDS_WILDCARDHELP);
-				break;
+			}
+			break;
 
-			case IDC_CLEAR_FIND:
-			case IDC_CLEAR_REPLACE: {
-				HWND hwndFind = GetDlgItem(hwnd, (pnmhdr->idFrom == IDC_CLEAR_FIND) ? IDC_FINDTEXT : IDC_REPLACETEXT);
-				ComboBox_GetText(hwndFind, tch, COUNTOF(tch));
-				ComboBox_ResetContent(hwndFind);
-				if (pnmhdr->idFrom == IDC_CLEAR_FIND) {
-					mruFind.Empty(true);
-				} else {
-					mruReplace.Empty(true);
+			case LVN_ITEMCHANGED: {
+				const NMLISTVIEW *pnmlv = AsPointer<NMLISTVIEW *>(lParam);
+				if ((pnmlv->uNewState & LVIS_SELECTED) && !(pnmlv->uOldState & LVIS_SELECTED)) {
+					EditFindAllResults_Select(pnmlv->iItem);
 				}
-				ComboBox_SetText(hwndFind, tch);
 			}
 			break;
 
-			case IDC_SAVEPOSITION:
-				GetDlgPos(hwnd, &positionRecord.xFindReplaceDlg, &positionRecord.yFindReplaceDlg);
-				break;
-
-			case IDC_RESETPOSITION:
-				CenterDlgInParent(hwnd);
-				positionRecord.xFindReplaceDlg = positionRecord.yFindReplaceDlg = 0;
+			case NM_DBLCLK:
+				SendWMCommand(hwnd, IDOK);
 				break;
 			}
-			break;
 		}
 	}
-	break;
+	return TRUE;
 
-	case WM_ACTIVATE:
-		SetWindowTransparentMode(hwnd, (LOWORD(wParam) == WA_INACTIVE && (iFindReplaceOption & FindReplaceOption_TransparentMode) != 0), iFindReplaceOpacityLevel);
+	case WM_COMMAND:
+		switch (LOWORD(wParam)) {
+		case IDOK: {
+			HWND hwndLV = GetDlgItem(hwnd, IDC_FINDALLRESULTS);
+			const int iItem = ListView_GetNextItem(hwndLV, -1, LVNI_ALL | LVNI_SELECTED);
+			if (iItem >= 0) {
+				EditFindAllResults_Select(iItem);
+				SetFocus(hwndEdit);
+			}
+		}
 		break;
-	}
 
+		case IDCANCEL:
+			DestroyWindow(hwnd);
+			break;
+		}
+		return TRUE;
+	}
 	return FALSE;
 }
 
+HWND EditFindAllResultsDlg(HWND hwnd) noexcept {
+	HWND hDlg = CreateThemedDialogParam(g_hInstance, MAKEINTRESOURCE(IDD_FINDALLRESULTS), hwnd, EditFindAllResultsDlgProc, 0);
+	ShowWindow(hDlg, SW_SHOW);
+	return hDlg;
+}
+
 //=============================================================================
 //
-// EditFindReplaceDlg()
+// Find in Files, files under the directory of current file are enumerated on
+// one thread and searched on a pool of workers, each file is memory mapped and
+// decoded to UTF-8 only when needed; matched lines are listed in a virtual list view.
 //
-HWND EditFindReplaceDlg(HWND hwnd, EDITFINDREPLACE *lpefr, bool bReplace) noexcept {
-	lpefr->hwnd = hwnd;
-	HWND hDlg = CreateThemedDialogParam(g_hInstance,
-								   bReplace ? MAKEINTRESOURCE(IDD_REPLACE) : MAKEINTRESOURCE(IDD_FIND),
-								   GetParent(hwnd),
-								   EditFindReplaceDlgProc,
-								   AsInteger<LPARAM>(lpefr));
+#define NP2_FIND_IN_FILES_QUEUE_SIZE	1024	// pending files between enumerator and workers
+#define NP2_FIND_IN_FILES_WAIT			100		// milliseconds, idle thread checks cancellation
+#define NP2_FIND_IN_FILES_BINARY_CHECK	8192	// file with NUL in first bytes is skipped as binary
+#define NP2_FIND_IN_FILES_EXCERPT		160		// bytes of matched line kept for display
+#define NP2_FIND_IN_FILES_CONTEXT		32		// bytes before match shown on long line
+#if defined(_WIN64)
+#define NP2_FIND_IN_FILES_MAX_SIZE		(UINT64_C(16) << 30)
+#else
+#define NP2_FIND_IN_FILES_MAX_SIZE		(UINT64_C(512) << 20)
+#endif
+#if _WIN32_WINNT >= _WIN32_WINNT_WIN7
+#define NP2_FIND_IN_FILES_INFO_LEVEL	FindExInfoBasic
+#define NP2_FIND_IN_FILES_FIND_FLAGS	FIND_FIRST_EX_LARGE_FETCH
+#else
+#define NP2_FIND_IN_FILES_INFO_LEVEL	FindExInfoStandard
+#define NP2_FIND_IN_FILES_FIND_FLAGS	0
+#endif
+
+namespace {
+
+struct FindInFilesMatch {
+	UINT file;			// offset of path in FindInFiles::paths
+	UINT line;			// zero based line
+	UINT offset;		// byte offset of match in the line, UTF-8
+	UINT excerpt;		// offset of excerpt in FindInFiles::text
+};
+
+// literal text search used by Find in Files and find as you type, when case is ignored,
+// text is lower case and only ASCII letters are folded.
+struct LiteralPattern {
+	char text[NP2_FIND_REPLACE_LIMIT];
+	UINT length;
+	bool matchCase;
+	bool wholeWord;
+	bool ascii;
+
+	bool Init(int searchFlags) noexcept;
+	bool Verify(const char *ptr) const noexcept {
+		return matchCase ? (memcmp(ptr + 1, text + 1, length - 1) == 0)
+			: (_strnicmp(ptr + 1, text + 1, length - 1) == 0);
+	}
+	const char *Search(const char *ptr, const char *end) const noexcept;
+	bool IsWholeWord(const char *data, const char *found, const char *end) const noexcept;
+};
+
+struct FindInFiles {
+	HWND hwndList;
+	BackgroundWorker worker;
+	WCHAR szDirectory[MAX_PATH];
+	LiteralPattern pattern;
+
+	// queue of file paths, guarded by queueLock
+	SRWLOCK queueLock;
+	CONDITION_VARIABLE queueChanged;
+	LPWSTR queue[NP2_FIND_IN_FILES_QUEUE_SIZE];
+	UINT queueHead;
+	UINT queueCount;
+	bool enumDone;
+
+	// results, guarded by lock
+	SRWLOCK lock;
+	FindInFilesMatch *matches;
+	UINT matchCount;
+	UINT matchCapacity;
+	WCHAR *paths;
+	UINT pathLength;
+	UINT pathCapacity;
+	char *text;
+	UINT textLength;
+	UINT textCapacity;
+	bool updatePosted;
+};
+
+FindInFiles findInFiles;
+
+// not accepted by MultiByteToWideChar(), converted by byte swapping
+constexpr UINT kCodePageUTF16LE = 1200;
+constexpr UINT kCodePageUTF16BE = 1201;
 
-	ShowWindow(hDlg, SW_SHOW);
-	return hDlg;
+template <typename T>
+bool FindInFiles_Reserve(T **buffer, UINT *capacity, size_t count) noexcept {
+	if (count <= *capacity) {
+		return true;
+	}
+	if (count > UINT_MAX/2) {
+		return false;
+	}
+	const UINT newCapacity = max(static_cast<UINT>(count), 2*(*capacity) + 1024);
+	void *ptr = (*buffer == nullptr) ? NP2HeapAlloc(newCapacity*sizeof(T)) : NP2HeapReAlloc(*buffer, newCapacity*sizeof(T));
+	if (ptr == nullptr) {
+		return false;
+	}
+	*buffer = static_cast<T *>(ptr);
+	*capacity = newCapacity;
+	return true;
 }
 
-// Wildcard search uses the regexp engine to perform a simple search with * ?
-// as wildcards instead of more advanced and user-unfriendly regexp syntax.
-static void EscapeWildcards(char *szFind2) noexcept {
-	char szWildcardEscaped[NP2_FIND_REPLACE_LIMIT];
-	int iSource = 0;
-	int iDest = 0;
+constexpr bool LiteralPattern_IsWordChar(uint8_t ch) noexcept {
+	return ch >= 0x80 || IsAlphaNumeric(ch) || ch == '_';
+}
 
-	while (szFind2[iSource]) {
-		const char c = szFind2[iSource];
-		if (c == '*') {
-			szWildcardEscaped[iDest++] = '.';
-			szWildcardEscaped[iDest] = '*';
-		} else if (c == '?') {
-			szWildcardEscaped[iDest] = '.';
-		} else {
-			if (c == '.' || c == '^' || c == '$' || c == '\\' || c == '[' || c == ']' || c == '+') {
-				szWildcardEscaped[iDest++] = '\\';
-			}
-			szWildcardEscaped[iDest] = c;
+bool LiteralPattern::Init(int searchFlags) noexcept {
+	length = static_cast<UINT>(strlen(text));
+	matchCase = (searchFlags & SCFIND_MATCHCASE) != 0 || IsStringCaseSensitiveA(text) == FALSE;
+	wholeWord = (searchFlags & SCFIND_WHOLEWORD) != 0;
+	ascii = true;
+	for (UINT i = 0; i < length; i++) {
+		const uint8_t ch = text[i];
+		ascii &= ch < 0x80;
+		if (!matchCase) {
+			text[i] = static_cast<char>(ToLowerA(ch));
 		}
-		iSource++;
-		iDest++;
 	}
-	szWildcardEscaped[iDest] = 0;
-	strncpy(szFind2, szWildcardEscaped, COUNTOF(szWildcardEscaped));
+	return length != 0;
 }
 
-int EditPrepareFind(char *szFind2, const EDITFINDREPLACE *lpefr) noexcept {
-	if (StrIsEmpty(lpefr->szFind)) {
-		return NP2_InvalidSearchFlags;
+// SSE2 filter on first byte then verify remaining bytes
+const char *LiteralPattern::Search(const char *ptr, const char *end) const noexcept {
+	if (static_cast<size_t>(end - ptr) < length) {
+		return nullptr;
 	}
 
-	int searchFlags = lpefr->fuFlags;
-	strncpy(szFind2, lpefr->szFind, NP2_FIND_REPLACE_LIMIT);
-	if (lpefr->option & FindReplaceOption_TransformBackslash) {
-		const UINT cpEdit = SciCall_GetCodePage();
-		TransformBackslashes(szFind2, (searchFlags & SCFIND_REGEXP), cpEdit);
-	}
-	if (StrIsEmpty(szFind2)) {
-		InfoBoxWarn(MB_OK, L"MsgNotFound", IDS_NOTFOUND);
-		return NP2_InvalidSearchFlags;
+	const uint8_t first = text[0];
+	const uint8_t fold = (!matchCase && IsAlpha(first)) ? 0x20 : 0;
+	end -= length - 1;
+#if NP2_USE_SSE2
+	const __m128i mmFirst = _mm_set1_epi8(static_cast<char>(first));
+	const __m128i mmFold = _mm_set1_epi8(static_cast<char>(fold));
+	for (; ptr + sizeof(__m128i) <= end; ptr += sizeof(__m128i)) {
+		const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i *>(ptr));
+		uint32_t mask = _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_or_si128(chunk, mmFold), mmFirst));
+		while (mask != 0) {
+			const char *candidate = ptr + np2_ctz(mask);
+			if (Verify(candidate)) {
+				return candidate;
+			}
+			mask &= mask - 1;
+		}
 	}
-	if (lpefr->option & FindReplaceOption_WildcardSearch) {
-		EscapeWildcards(szFind2);
-		searchFlags |= SCFIND_REGEXP;
-	} else if (!(searchFlags & (SCFIND_REGEXP | SCFIND_MATCHCASE))) {
-		const BOOL sensitive = IsStringCaseSensitiveA(szFind2);
-		//printf("%s sensitive=%d\n", __func__, sensitive);
-		searchFlags |= ((sensitive - TRUE) & SCFIND_MATCHCASE);
+#endif
+	for (; ptr < end; ptr++) {
+		if ((static_cast<uint8_t>(*ptr) | fold) == first && Verify(ptr)) {
+			return ptr;
+		}
 	}
-	return searchFlags;
+	return nullptr;
 }
 
-int EditPrepareReplace(HWND hwnd, char *szFind2, char **pszReplace2, BOOL *bReplaceRE, const EDITFINDREPLACE *lpefr) noexcept {
-	const int searchFlags = EditPrepareFind(szFind2, lpefr);
-	if (searchFlags == NP2_InvalidSearchFlags) {
-		return searchFlags;
-	}
-
-	*bReplaceRE = (searchFlags & SCFIND_REGEXP);
-	if (StrEqualEx(lpefr->szReplace, "^c")) {
-		*bReplaceRE = FALSE;
-		*pszReplace2 = EditGetClipboardText(hwnd);
-	} else {
-		*pszReplace2 = StrDupA(lpefr->szReplace);
-		if (lpefr->option & FindReplaceOption_TransformBackslash) {
-			const UINT cpEdit = SciCall_GetCodePage();
-			TransformBackslashes(*pszReplace2, *bReplaceRE, cpEdit);
-		}
-	}
+bool LiteralPattern::IsWholeWord(const char *data, const char *found, const char *end) const noexcept {
+	return !wholeWord || ((found == data || !LiteralPattern_IsWordChar(found[-1]))
+		&& (found + length >= end || !LiteralPattern_IsWordChar(found[length])));
+}
 
-	if (*pszReplace2 == nullptr) {
-		*pszReplace2 = StrDupA("");
-	}
-	return searchFlags;
 }
 
-//=============================================================================
-//
-// EditFindNext()
-//
-void EditFindNext(const EDITFINDREPLACE *lpefr, bool fExtendSelection) noexcept {
-	char szFind2[NP2_FIND_REPLACE_LIMIT];
-	const int searchFlags = EditPrepareFind(szFind2, lpefr);
-	if (searchFlags == NP2_InvalidSearchFlags) {
-		return;
+static void FindInFiles_ClearResults() noexcept {
+	auto &state = findInFiles;
+	AcquireSRWLockExclusive(&state.lock);
+	if (state.matches) {
+		NP2HeapFree(state.matches);
+		state.matches = nullptr;
 	}
+	if (state.paths) {
+		NP2HeapFree(state.paths);
+		state.paths = nullptr;
+	}
+	if (state.text) {
+		NP2HeapFree(state.text);
+		state.text = nullptr;
+	}
+	state.matchCount = 0;
+	state.matchCapacity = 0;
+	state.pathLength = 0;
+	state.pathCapacity = 0;
+	state.textLength = 0;
+	state.textCapacity = 0;
+	state.updatePosted = false;
+	ReleaseSRWLockExclusive(&state.lock);
+	if (state.hwndList) {
+		ListView_SetItemCount(state.hwndList, 0);
+	}
+}
 
-	const Sci_Position iSelPos = SciCall_GetCurrentPos();
-	const Sci_Position iSelAnchor = SciCall_GetAnchor();
-
-	Sci_TextToFindFull ttf = { { SciCall_GetSelectionEnd(), SciCall_GetLength() }, szFind2, { 0, 0 } };
-	Sci_Position iPos = SciCall_FindTextFull(searchFlags, &ttf);
-	bool bSuppressNotFound = false;
+// search UTF-8 text of one file, matched lines are appended as one batch
+static void FindInFiles_SearchText(LPCWSTR path, const char *data, size_t size) noexcept {
+	auto &state = findInFiles;
+	const char * const end = data + size;
+	const char *lineStart = data;
+	UINT line = 0;
+	FindInFilesMatch *matches = nullptr;
+	UINT matchCount = 0;
+	UINT matchCapacity = 0;
+	char *text = nullptr;
+	UINT textLength = 0;
+	UINT textCapacity = 0;
 
-	if (iPos < 0 && ttf.chrg.cpMin > 0 && (lpefr->option & FindReplaceOption_NoFindWrap) == 0 && !fExtendSelection) {
-		if (IDOK == InfoBoxInfo(MB_OKCANCEL, L"MsgFindWrap1", IDS_FIND_WRAPFW)) {
-			ttf.chrg.cpMin = 0;
-			iPos = SciCall_FindTextFull(searchFlags, &ttf);
-		} else {
-			bSuppressNotFound = true;
+	const char *ptr = data;
+	while (ptr < end && state.worker.Continue()) {
+		const char *found = state.pattern.Search(ptr, end);
+		if (found == nullptr) {
+			break;
+		}
+		if (!state.pattern.IsWholeWord(data, found, end)) {
+			ptr = found + 1;
+			continue;
 		}
-	}
 
-	if (iPos < 0) {
-		// not found
-		if (!bSuppressNotFound) {
-			InfoBoxWarn(MB_OK, L"MsgNotFound", IDS_NOTFOUND);
+		// count lines between previous match and this one
+		const char *eol;
+		while ((eol = static_cast<const char *>(memchr(lineStart, '\n', found - lineStart))) != nullptr) {
+			lineStart = eol + 1;
+			++line;
 		}
-	} else {
-		if (!fExtendSelection) {
-			EditSelectEx(ttf.chrgText.cpMin, ttf.chrgText.cpMax);
-		} else {
-			EditSelectEx(min(iSelAnchor, iSelPos), ttf.chrgText.cpMax);
+		const char *lineEnd = static_cast<const char *>(memchr(found, '\n', end - found));
+		if (lineEnd == nullptr) {
+			lineEnd = end;
 		}
-		if (ttf.chrgText.cpMin == ttf.chrgText.cpMax) {
-			const WPARAM notifyPos = (static_cast<WPARAM>(ttf.chrgText.cpMin) << 2) | SC_NOTIFICATIONPOSITION_NONE;
-			ShowNotificationMessage(notifyPos, IDS_ZERO_LENGTH_MATCH);
+
+		const char *excerptStart = lineStart;
+		if (found - excerptStart > NP2_FIND_IN_FILES_CONTEXT) {
+			excerptStart = found - NP2_FIND_IN_FILES_CONTEXT;
+			// don't split UTF-8 sequence
+			while (excerptStart < found && (static_cast<uint8_t>(*excerptStart) & 0xC0) == 0x80) {
+				++excerptStart;
+			}
+		}
+		const UINT excerptLength = static_cast<UINT>(min<size_t>(lineEnd - excerptStart, NP2_FIND_IN_FILES_EXCERPT));
+		if (!FindInFiles_Reserve(&matches, &matchCapacity, matchCount + 1)
+			|| !FindInFiles_Reserve(&text, &textCapacity, textLength + excerptLength + 1)) {
+			break;
 		}
-	}
 
-}
+		FindInFilesMatch &match = matches[matchCount++];
+		match.line = line;
+		match.offset = static_cast<UINT>(min<size_t>(found - lineStart, UINT_MAX));
+		match.excerpt = textLength;
+		memcpy(text + textLength, excerptStart, excerptLength);
+		textLength += excerptLength;
+		text[textLength++] = '\0';
 
-//=============================================================================
-//
-// EditFindPrev()
-//
-void EditFindPrev(const EDITFINDREPLACE *lpefr, bool fExtendSelection) noexcept {
-	char szFind2[NP2_FIND_REPLACE_LIMIT];
-	const int searchFlags = EditPrepareFind(szFind2, lpefr);
-	if (searchFlags == NP2_InvalidSearchFlags) {
-		return;
+		// one result per line
+		ptr = lineEnd;
 	}
 
-	const Sci_Position iSelPos = SciCall_GetCurrentPos();
-	const Sci_Position iSelAnchor = SciCall_GetAnchor();
-
-	Sci_TextToFindFull ttf = { { SciCall_GetSelectionStart(), 0 }, szFind2, { 0, 0 } };
-	Sci_Position iPos = SciCall_FindTextFull(searchFlags, &ttf);
-	const Sci_Position iLength = SciCall_GetLength();
-	bool bSuppressNotFound = false;
+	if (matchCount != 0) {
+		const UINT cchPath = lstrlen(path) + 1;
+		AcquireSRWLockExclusive(&state.lock);
+		bool post = false;
+		if (FindInFiles_Reserve(&state.matches, &state.matchCapacity, static_cast<size_t>(state.matchCount) + matchCount)
+			&& FindInFiles_Reserve(&state.paths, &state.pathCapacity, static_cast<size_t>(state.pathLength) + cchPath)
+			&& FindInFiles_Reserve(&state.text, &state.textCapacity, static_cast<size_t>(state.textLength) + textLength)) {
+			const UINT file = state.pathLength;
+			memcpy(state.paths + file, path, cchPath*sizeof(WCHAR));
+			state.pathLength += cchPath;
+			for (UINT i = 0; i < matchCount; i++) {
+				FindInFilesMatch &match = state.matches[state.matchCount++];
+				match = matches[i];
+				match.file = file;
+				match.excerpt += state.textLength;
+			}
+			memcpy(state.text + state.textLength, text, textLength);
+			state.textLength += textLength;
+			post = !state.updatePosted;
+			state.updatePosted = true;
+		}
+		ReleaseSRWLockExclusive(&state.lock);
+		if (post) {
+			PostMessage(state.worker.hwnd, APPM_FINDINFILES_UPDATE, 0, 0);
+		}
+	}
+	if (matches) {
+		NP2HeapFree(matches);
+	}
+	if (text) {
+		NP2HeapFree(text);
+	}
+}
 
-	if (iPos < 0 && ttf.chrg.cpMin < iLength && (lpefr->option & FindReplaceOption_NoFindWrap) == 0 && !fExtendSelection) {
-		if (IDOK == InfoBoxInfo(MB_OKCANCEL, L"MsgFindWrap2", IDS_FIND_WRAPRE)) {
-			ttf.chrg.cpMin = iLength;
-			iPos = SciCall_FindTextFull(searchFlags, &ttf);
-		} else {
-			bSuppressNotFound = true;
-		}
+// decode text with the code page to UTF-8, returns buffer to be freed
+static char *FindInFiles_ConvertToUTF8(UINT codePage, const char *data, size_t size, size_t *length) noexcept {
+	if (size > INT_MAX/kMaxMultiByteCount) {
+		return nullptr;
 	}
 
-	if (iPos < 0) {
-		// not found
-		if (!bSuppressNotFound) {
-			InfoBoxWarn(MB_OK, L"MsgNotFound", IDS_NOTFOUND);
+	const bool utf16 = codePage == kCodePageUTF16LE || codePage == kCodePageUTF16BE;
+	int cchWide = static_cast<int>(size/sizeof(WCHAR));
+	if (!utf16) {
+		cchWide = MultiByteToWideChar(codePage, 0, data, static_cast<int>(size), nullptr, 0);
+	}
+	LPWSTR wide = static_cast<LPWSTR>(NP2HeapAlloc((cchWide + 1)*sizeof(WCHAR)));
+	if (wide == nullptr) {
+		return nullptr;
+	}
+	if (utf16) {
+		memcpy(wide, data, cchWide*sizeof(WCHAR));
+		if (codePage == kCodePageUTF16BE) {
+			for (int i = 0; i < cchWide; i++) {
+				wide[i] = static_cast<WCHAR>(_byteswap_ushort(wide[i]));
+			}
 		}
 	} else {
-		if (!fExtendSelection) {
-			EditSelectEx(ttf.chrgText.cpMin, ttf.chrgText.cpMax);
-		} else {
-			EditSelectEx(max(iSelPos, iSelAnchor), ttf.chrgText.cpMin);
-		}
-		if (ttf.chrgText.cpMin == ttf.chrgText.cpMax) {
-			const WPARAM notifyPos = (static_cast<WPARAM>(ttf.chrgText.cpMin) << 2) | SC_NOTIFICATIONPOSITION_NONE;
-			ShowNotificationMessage(notifyPos, IDS_ZERO_LENGTH_MATCH);
+		MultiByteToWideChar(codePage, 0, data, static_cast<int>(size), wide, cchWide);
+	}
+
+	char *utf8 = nullptr;
+	const int cbUTF8 = WideCharToMultiByte(CP_UTF8, 0, wide, cchWide, nullptr, 0, nullptr, nullptr);
+	if (cbUTF8 > 0) {
+		utf8 = static_cast<char *>(NP2HeapAlloc(cbUTF8 + 1));
+		if (utf8) {
+			WideCharToMultiByte(CP_UTF8, 0, wide, cchWide, utf8, cbUTF8, nullptr, nullptr);
+			*length = cbUTF8;
 		}
 	}
+	NP2HeapFree(wide);
+	return utf8;
 }
 
-//=============================================================================
-//
-// EditReplace()
-//
-void EditReplace(HWND hwnd, const EDITFINDREPLACE *lpefr) noexcept {
-	BOOL bReplaceRE;
-	char szFind2[NP2_FIND_REPLACE_LIMIT];
-	char *pszReplace2;
-	const int searchFlags = EditPrepareReplace(hwnd, szFind2, &pszReplace2, &bReplaceRE, lpefr);
-	if (searchFlags == NP2_InvalidSearchFlags) {
+static void FindInFiles_SearchFile(LPCWSTR path) noexcept {
+	HANDLE hFile = CreateFile(path, GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+		nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+	if (hFile == INVALID_HANDLE_VALUE) {
 		return;
 	}
 
-	const Sci_Position iSelStart = SciCall_GetSelectionStart();
-	const Sci_Position iSelEnd = SciCall_GetSelectionEnd();
-
-	Sci_TextToFindFull ttf = { { iSelStart, SciCall_GetLength() }, szFind2, { 0, 0 } };
-	Sci_Position iPos = SciCall_FindTextFull(searchFlags, &ttf);
-	bool bSuppressNotFound = false;
+	LARGE_INTEGER fileSize;
+	if (!GetFileSizeEx(hFile, &fileSize) || fileSize.QuadPart < findInFiles.pattern.length
+		|| static_cast<uint64_t>(fileSize.QuadPart) > NP2_FIND_IN_FILES_MAX_SIZE) {
+		CloseHandle(hFile);
+		return;
+	}
 
-	if (iPos < 0 && ttf.chrg.cpMin > 0 && (lpefr->option & FindReplaceOption_NoFindWrap) == 0) {
-		if (IDOK == InfoBoxInfo(MB_OKCANCEL, L"MsgFindWrap1", IDS_FIND_WRAPFW)) {
-			ttf.chrg.cpMin = 0;
-			iPos = SciCall_FindTextFull(searchFlags, &ttf);
-		} else {
-			bSuppressNotFound = true;
-		}
+	HANDLE hMap = CreateFileMapping(hFile, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	const char *view = hMap ? static_cast<const char *>(MapViewOfFile(hMap, FILE_MAP_READ, 0, 0, 0)) : nullptr;
+	if (view) {
+		const char *data = view;
+		size_t size = static_cast<size_t>(fileSize.QuadPart);
+		const UINT bom = (size >= 2) ? *(reinterpret_cast<const uint16_t *>(data)) : 0;
+		UINT codePage = CP_UTF8;
+		if ((size & 1) == 0 && (bom == BOM_UTF16LE || bom == BOM_UTF16BE)) {
+			codePage = (bom == BOM_UTF16LE) ? kCodePageUTF16LE : kCodePageUTF16BE;
+			data += 2;
+			size -= 2;
+		} else if (size >= 3 && IsUTF8Signature(data)) {
+			data += 3;
+			size -= 3;
+		} else if (memchr(data, '\0', min<size_t>(size, NP2_FIND_IN_FILES_BINARY_CHECK)) != nullptr) {
+			codePage = 0; // binary
+		} else if (!findInFiles.pattern.ascii && !IsUTF8(data, size)) {
+			// ASCII text is same in all supported 8-bit code pages
+			codePage = CP_ACP;
+		}
+
+		if (codePage == CP_UTF8) {
+			FindInFiles_SearchText(path, data, size);
+		} else if (codePage != 0) {
+			size_t length = 0;
+			char *utf8 = FindInFiles_ConvertToUTF8(codePage, data, size, &length);
+			if (utf8) {
+				FindInFiles_SearchText(path, utf8, length);
+				NP2HeapFree(utf8);
+			}
+		}
+		UnmapViewOfFile(view);
+	}
+	if (hMap) {
+		CloseHandle(hMap);
 	}
+	CloseHandle(hFile);
+}
 
-	if (iPos < 0) {
-		// not found
-		LocalFree(pszReplace2);
-		if (!bSuppressNotFound) {
-			InfoBoxWarn(MB_OK, L"MsgNotFound", IDS_NOTFOUND);
-		}
+static void FindInFiles_Enqueue(LPCWSTR path) noexcept {
+	auto &state = findInFiles;
+	const UINT cb = (lstrlen(path) + 1)*sizeof(WCHAR);
+	LPWSTR item = static_cast<LPWSTR>(NP2HeapAlloc(cb));
+	if (item == nullptr) {
 		return;
 	}
 
-	if (iSelStart != ttf.chrgText.cpMin || iSelEnd != ttf.chrgText.cpMax) {
-		LocalFree(pszReplace2);
-		EditSelectEx(ttf.chrgText.cpMin, ttf.chrgText.cpMax);
-		return;
+	memcpy(item, path, cb);
+	AcquireSRWLockExclusive(&state.queueLock);
+	while (state.queueCount == NP2_FIND_IN_FILES_QUEUE_SIZE && state.worker.Continue()) {
+		SleepConditionVariableSRW(&state.queueChanged, &state.queueLock, NP2_FIND_IN_FILES_WAIT, 0);
+	}
+	if (state.queueCount < NP2_FIND_IN_FILES_QUEUE_SIZE) {
+		state.queue[(state.queueHead + state.queueCount) % NP2_FIND_IN_FILES_QUEUE_SIZE] = item;
+		state.queueCount++;
+		item = nullptr;
+	}
+	ReleaseSRWLockExclusive(&state.queueLock);
+	WakeAllConditionVariable(&state.queueChanged);
+	if (item) {
+		NP2HeapFree(item);
 	}
+}
 
-	SciCall_SetTargetRange(ttf.chrgText.cpMin, ttf.chrgText.cpMax);
-	SciCall_ReplaceTargetEx(bReplaceRE, -1, pszReplace2);
-	LocalFree(pszReplace2);
+static LPWSTR FindInFiles_Dequeue() noexcept {
+	auto &state = findInFiles;
+	LPWSTR item = nullptr;
+	AcquireSRWLockExclusive(&state.queueLock);
+	while (state.queueCount == 0 && !state.enumDone && state.worker.Continue()) {
+		SleepConditionVariableSRW(&state.queueChanged, &state.queueLock, NP2_FIND_IN_FILES_WAIT, 0);
+	}
+	if (state.queueCount != 0 && state.worker.Continue()) {
+		item = state.queue[state.queueHead];
+		state.queueHead = (state.queueHead + 1) % NP2_FIND_IN_FILES_QUEUE_SIZE;
+		state.queueCount--;
+	}
+	ReleaseSRWLockExclusive(&state.queueLock);
+	WakeAllConditionVariable(&state.queueChanged);
+	return item;
+}
 
-	ttf.chrg.cpMin = SciCall_GetTargetEnd();
-	ttf.chrg.cpMax = SciCall_GetLength();
+// depth first walk with explicit stack of directory paths
+static void FindInFiles_Enumerate() noexcept {
+	auto &state = findInFiles;
+	LPWSTR *stack = nullptr;
+	UINT stackCount = 0;
+	UINT stackCapacity = 0;
+	WCHAR szPath[MAX_PATH];
+	LPWSTR dir = static_cast<LPWSTR>(NP2HeapAlloc(sizeof(state.szDirectory)));
+	if (dir) {
+		lstrcpy(dir, state.szDirectory);
+	}
 
-	iPos = SciCall_FindTextFull(searchFlags, &ttf);
-	bSuppressNotFound = false;
+	while (dir && state.worker.Continue()) {
+		WIN32_FIND_DATA fd;
+		HANDLE hFind = INVALID_HANDLE_VALUE;
+		if (PathCombine(szPath, dir, L"*")) {
+			hFind = FindFirstFileEx(szPath, NP2_FIND_IN_FILES_INFO_LEVEL, &fd, FindExSearchNameMatch, nullptr, NP2_FIND_IN_FILES_FIND_FLAGS);
+		}
+		if (hFind != INVALID_HANDLE_VALUE) {
+			do {
+				LPCWSTR name = fd.cFileName;
+				// skip dot directories, hidden and system items and version control metadata
+				if ((name[0] == L'.' && (name[1] == L'\0' || (name[1] == L'.' && name[2] == L'\0')))
+					|| (fd.dwFileAttributes & (FILE_ATTRIBUTE_HIDDEN | FILE_ATTRIBUTE_SYSTEM))
+					|| !PathCombine(szPath, dir, name)) {
+					continue;
+				}
+				if (fd.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) {
+					if (!(fd.dwFileAttributes & FILE_ATTRIBUTE_REPARSE_POINT)
+						&& !StrCaseEqual(name, L".git") && !StrCaseEqual(name, L".svn") && !StrCaseEqual(name, L".hg")
+						&& FindInFiles_Reserve(&stack, &stackCapacity, stackCount + 1)) {
+						const UINT cb = (lstrlen(szPath) + 1)*sizeof(WCHAR);
+						LPWSTR subdir = static_cast<LPWSTR>(NP2HeapAlloc(cb));
+						if (subdir) {
+							memcpy(subdir, szPath, cb);
+							stack[stackCount++] = subdir;
+						}
+					}
+				} else {
+					FindInFiles_Enqueue(szPath);
+				}
+			} while (state.worker.Continue() && FindNextFile(hFind, &fd));
+			FindClose(hFind);
+		}
 
-	if (iPos < 0 && ttf.chrg.cpMin > 0 && (lpefr->option & FindReplaceOption_NoFindWrap) == 0) {
-		if (IDOK == InfoBoxInfo(MB_OKCANCEL, L"MsgFindWrap1", IDS_FIND_WRAPFW)) {
-			ttf.chrg.cpMin = 0;
-			iPos = SciCall_FindTextFull(searchFlags, &ttf);
-		} else {
-			bSuppressNotFound = true;
+		NP2HeapFree(dir);
+		dir = (stackCount != 0) ? stack[--stackCount] : nullptr;
+	}
+
+	if (dir) {
+		NP2HeapFree(dir);
+	}
+	for (UINT i = 0; i < stackCount; i++) {
+		NP2HeapFree(stack[i]);
+	}
+	if (stack) {
+		NP2HeapFree(stack);
+	}
+
+	AcquireSRWLockExclusive(&state.queueLock);
+	state.enumDone = true;
+	ReleaseSRWLockExclusive(&state.queueLock);
+	WakeAllConditionVariable(&state.queueChanged);
+}
+
+// first worker enumerates files, others search them
+static DWORD WINAPI FindInFiles_Worker(LPVOID lpParameter) noexcept {
+	const UINT index = *static_cast<const UINT *>(lpParameter);
+	if (index == 0) {
+		FindInFiles_Enumerate();
+	} else {
+		LPWSTR path;
+		while ((path = FindInFiles_Dequeue()) != nullptr) {
+			FindInFiles_SearchFile(path);
+			NP2HeapFree(path);
 		}
 	}
+	return 0;
+}
+
+static DWORD WINAPI FindInFiles_Thread(LPVOID /*lpParameter*/) noexcept {
+	auto &state = findInFiles;
+	SYSTEM_INFO info;
+	GetSystemInfo(&info);
+	UINT indexes[MAX_PARALLEL_WORKER_COUNT];
+	const UINT count = min<UINT>(info.dwNumberOfProcessors + 1, MAX_PARALLEL_WORKER_COUNT);
+	for (UINT i = 0; i < count; i++) {
+		indexes[i] = i;
+	}
+	RunParallelWorker(FindInFiles_Worker, indexes, sizeof(UINT), max(count, 2U));
 
-	if (iPos >= 0) {
-		EditSelectEx(ttf.chrgText.cpMin, ttf.chrgText.cpMax);
-	} else {
-		iPos = SciCall_GetTargetEnd();
-		EditSelectEx(iPos, iPos); //?
-		if (!bSuppressNotFound) {
-			InfoBoxWarn(MB_OK, L"MsgNotFound", IDS_NOTFOUND);
-		}
+	// files left by cancellation
+	while (state.queueCount != 0) {
+		NP2HeapFree(state.queue[state.queueHead]);
+		state.queueHead = (state.queueHead + 1) % NP2_FIND_IN_FILES_QUEUE_SIZE;
+		state.queueCount--;
 	}
+	// final update after all workers finished
+	PostMessage(state.worker.hwnd, APPM_FINDINFILES_UPDATE, 1, 0);
+	return 0;
 }
 
-//=============================================================================
-//
-// Mark all occurrences of the text currently selected (originally by Aleksandar Lekov)
-//
+void EditFindInFiles(const EDITFINDREPLACE *lpefr) noexcept {
+	auto &state = findInFiles;
+	// only literal text is supported, regex engine is bound to document
+	if ((lpefr->fuFlags & SCFIND_REGEXP) || (lpefr->option & FindReplaceOption_WildcardSearch) || StrIsEmpty(lpefr->szFindUTF8)) {
+		MessageBeep(MB_ICONWARNING);
+		return;
+	}
 
-extern EditMarkAll editMarkAll;
-extern HANDLE idleTaskTimer;
-#define EditMarkAll_MeasuredSize		(1024*1024)
-#define EditMarkAll_MinDuration			1.0
-// (100 / 64) => 2 MiB on second search.
-// increment search size will return to normal after several runs
-// when selection no longer changed, this make continuous selecting smooth.
-#define EditMarkAll_DefaultDuration		64
-#define EditMarkAll_RangeCacheCount		256
-//static UINT EditMarkAll_Runs;
+	if (!IsWindow(hDlgFindInFiles)) {
+		hDlgFindInFiles = EditFindInFilesDlg(hwndMain);
+	}
+	// previous search is discarded
+	state.worker.Cancel();
+	FindInFiles_ClearResults();
 
-void EditMarkAll::Reset(int findFlag, Sci_Position iSelCount, LPSTR text) noexcept {
-	if (matchCount != 0) {
-		// clear existing indicator
-		SciCall_SetIndicatorCurrent(IndicatorNumber_MarkOccurrence);
-		SciCall_IndicatorClearRange(0, SciCall_GetLength());
-		UpdateStatusBarCache(StatusItem_Find);
+	LiteralPattern &pattern = state.pattern;
+	strncpy(pattern.text, lpefr->szFindUTF8, COUNTOF(pattern.text) - 1);
+	pattern.text[COUNTOF(pattern.text) - 1] = '\0';
+	if (lpefr->option & FindReplaceOption_TransformBackslash) {
+		TransformBackslashes(pattern.text, FALSE, CP_UTF8);
 	}
-	if (prevBookmarkLine >= 0 || bookmarkForFindAll) {
-		if ((findFlag | markFlag) & NP2_MarkAllBookmark) {
-			if ((findFlag & (NP2_MarkAllBookmark | NP2_FromFindAll)) != 0 || !bookmarkForFindAll) {
-				SciCall_MarkerDeleteAll(MarkerNumber_Bookmark);
-			}
-		}
+	if (!pattern.Init(lpefr->fuFlags)) {
+		MessageBeep(MB_ICONWARNING);
+		return;
 	}
-	if (pszText) {
-		NP2HeapFree(pszText);
+
+	if (StrNotEmpty(szCurFile)) {
+		lstrcpy(state.szDirectory, szCurFile);
+		PathRemoveFileSpec(state.szDirectory);
+	} else {
+		GetCurrentDirectory(COUNTOF(state.szDirectory), state.szDirectory);
 	}
 
-	pending = false;
-	ignoreSelectionUpdate = false;
-	markFlag = findFlag;
-	incrementSize = 1;
-	length = iSelCount;
-	pszText = text;
-	// timing for increment search is only useful for current search.
-	duration = EditMarkAll_DefaultDuration;
-	matchCount = 0;
-	lastMatchPos = 0;
-	prevStopPos = 0;
-	prevBookmarkLine = -1;
+	state.queueHead = 0;
+	state.queueCount = 0;
+	state.enumDone = false;
+	state.worker.workerThread = CreateThread(nullptr, 0, FindInFiles_Thread, nullptr, 0, nullptr);
 }
 
-void EditMarkAll::Start(BOOL bChanged, int findFlag, Sci_Position iSelCount, LPSTR text) noexcept {
-	if (!bChanged && (findFlag == (markFlag & (NP2_SearchForLineEnd - 1))
-		&& iSelCount == length
-		// _stricmp() is not safe for DBCS string.
-		&& memcmp(text, pszText, iSelCount) == 0)) {
-		NP2HeapFree(text);
-		return;
+static bool FindInFiles_GetMatch(int iItem, FindInFilesMatch *match) noexcept {
+	const auto &state = findInFiles;
+	if (iItem < 0 || static_cast<UINT>(iItem) >= state.matchCount) {
+		return false;
 	}
+	*match = state.matches[iItem];
+	return true;
+}
 
-	Reset(findFlag, iSelCount, text);
-	if ((findFlag & SCFIND_REGEXP) && iSelCount == 1) {
-		const char ch = *text;
-		if (ch == '^' || ch == '$') {
-			const Sci_Line lineCount = SciCall_GetLineCount();
-			matchCount = lineCount - (ch == '^');
-			UpdateStatusBarCache(StatusItem_Find);
-			UpdateStatusbar();
-			return;
-		}
-	} else if (findFlag & SCFIND_REGEXP) {
-		// see BuiltinRegex::FindText()
-		const char ch = text[iSelCount - 1];
-		if (ch == '$' && text[iSelCount - 2] != '\\') {
-			markFlag |= NP2_SearchForLineEnd;
-		}
+static void FindInFiles_GetText(int iItem, LPWSTR pszText, int cchText) noexcept {
+	auto &state = findInFiles;
+	AcquireSRWLockShared(&state.lock);
+	FindInFilesMatch match;
+	if (cchText > 64 && FindInFiles_GetMatch(iItem, &match)) {
+		// path relative to searched directory
+		LPCWSTR path = state.paths + match.file;
+		const int cchDir = lstrlen(state.szDirectory);
+		if (_wcsnicmp(path, state.szDirectory, cchDir) == 0 && path[cchDir] == L'\\') {
+			path += cchDir + 1;
+		}
+		// leave room for line number and some text
+		lstrcpyn(pszText, path, cchText - 32);
+		int cch = lstrlen(pszText);
+		pszText[cch++] = L'(';
+		PosToStr(match.line + 1, pszText + cch);
+		cch += lstrlen(pszText + cch);
+		pszText[cch++] = L')';
+		pszText[cch++] = L':';
+		pszText[cch++] = L' ';
+		const int cchExcerpt = MultiByteToWideChar(CP_UTF8, 0, state.text + match.excerpt, -1, pszText + cch, cchText - cch);
+		if (cchExcerpt == 0) {
+			pszText[cch] = L'\0';
+		}
+		// collapse tabs to keep the list readable
+		for (LPWSTR p = pszText + cch; *p; p++) {
+			if (*p == L'\t' || *p == L'\r') {
+				*p = L' ';
+			}
+		}
+	}
+	ReleaseSRWLockShared(&state.lock);
+}
+
+static void FindInFiles_Open(int iItem) noexcept {
+	auto &state = findInFiles;
+	WCHAR szFile[MAX_PATH];
+	AcquireSRWLockShared(&state.lock);
+	FindInFilesMatch match;
+	const bool found = FindInFiles_GetMatch(iItem, &match);
+	if (found) {
+		lstrcpyn(szFile, state.paths + match.file, COUNTOF(szFile));
+	}
+	ReleaseSRWLockShared(&state.lock);
+	if (!found) {
+		return;
 	}
 
-	//EditMarkAll_Runs = 0;
-	bookmarkForFindAll = false;
-	if (findFlag & NP2_MarkAllBookmark) {
-		bookmarkForFindAll = (findFlag & NP2_FromFindAll) != 0;
-		Style_SetBookmark();
+	if (!PathEqual(szFile, szCurFile) && !FileLoad(FileLoadFlag_Default, szFile)) {
+		return;
 	}
-	Continue(idleTaskTimer);
+	const Sci_Line iLine = min<Sci_Line>(match.line, SciCall_GetLineCount() - 1);
+	const Sci_Position iLineStart = SciCall_PositionFromLine(iLine);
+	const Sci_Position iLineEnd = SciCall_GetLineEndPosition(iLine);
+	const Sci_Position iPos = min<Sci_Position>(iLineStart + match.offset, iLineEnd);
+	const Sci_Position iEnd = min<Sci_Position>(iPos + state.pattern.length, iLineEnd);
+	EditSelectEx(iPos, iEnd);
+	SetFocus(hwndEdit);
 }
 
-void EditMarkAll::Stop() noexcept {
-	pending = false;
-	matchCount = 0;
-	WaitableTimer_Set(idleTaskTimer, 0);
-	Clear();
-}
+static INT_PTR CALLBACK EditFindInFilesDlgProc(HWND hwnd, UINT umsg, WPARAM wParam, LPARAM lParam) noexcept {
+	static const DWORD controlDefinition[] = {
+		DeferCtlMove(IDC_RESIZEGRIP),
+		DeferCtlSize(IDC_FINDINFILES) | RESIZE_AUTOSIZE_USEHEADER,
+	};
 
-static Sci_Line EditMarkAll_Bookmark(Sci_Line bookmarkLine, const Sci_Position *ranges, UINT index, int findFlag, Sci_Position matchCount) noexcept {
-	if (findFlag & NP2_MarkAllSelectAll) {
-		UINT i = 0;
-		if (matchCount == static_cast<Sci_Position>(index/2)) {
-			i = 2;
-			SciCall_SetSelection(ranges[0] + ranges[1], ranges[0]);
-		}
-		for (; i < index; i += 2) {
-			SciCall_AddSelection(ranges[i] + ranges[i + 1], ranges[i]);
-		}
-	} else {
-		for (UINT i = 0; i < index; i += 2) {
-			SciCall_IndicatorFillRange(ranges[i], ranges[i + 1]);
-		}
+	switch (umsg) {
+	case WM_INITDIALOG: {
+		HWND hwndLV = GetDlgItem(hwnd, IDC_FINDINFILES);
+		InitWindowCommon(hwndLV);
+		ResizeDlg_Init(hwnd, &positionRecord.cxFindInFilesDlg, &positionRecord.cyFindInFilesDlg, controlDefinition, COUNTOF(controlDefinition));
+
+		ListView_SetExtendedListViewStyle(hwndLV, LVS_EX_FULLROWSELECT | LVS_EX_DOUBLEBUFFER | LVS_EX_LABELTIP);
+		const LVCOLUMN lvc = { LVCF_FMT | LVCF_TEXT, LVCFMT_LEFT, 0, nullptr, -1, 0, 0, 0
+#if _WIN32_WINNT >= _WIN32_WINNT_VISTA
+			, 0, 0, 0
+#endif
+		};
+		ListView_InsertColumn(hwndLV, 0, &lvc);
+		ListView_SetColumnWidth(hwndLV, 0, LVSCW_AUTOSIZE_USEHEADER);
+
+		auto &state = findInFiles;
+		state.hwndList = hwndLV;
+		state.worker.Init(hwnd);
+		InitializeSRWLock(&state.lock);
+		InitializeSRWLock(&state.queueLock);
+		InitializeConditionVariable(&state.queueChanged);
+		CenterDlgInParent(hwnd);
 	}
-	if (!(findFlag & NP2_MarkAllBookmark)) {
-		return bookmarkLine;
+	return TRUE;
+
+	case WM_DESTROY: {
+		auto &state = findInFiles;
+		state.worker.Destroy();
+		state.hwndList = nullptr;
+		FindInFiles_ClearResults();
+		hDlgFindInFiles = nullptr;
 	}
-	if (findFlag & NP2_MarkAllMultiline) {
-		for (UINT i = 0; i < index; i += 2) {
-			Sci_Line line = SciCall_LineFromPosition(ranges[i]);
-			const Sci_Line lineEnd = SciCall_LineFromPosition(ranges[i] + ranges[i + 1]);
-			line = max(bookmarkLine + 1, line);
-			while (line <= lineEnd) {
-				SciCall_MarkerAdd(line, MarkerNumber_Bookmark);
-				++line;
+	return FALSE;
+
+	case APPM_FINDINFILES_UPDATE: {
+		auto &state = findInFiles;
+		AcquireSRWLockExclusive(&state.lock);
+		const UINT count = state.matchCount;
+		state.updatePosted = false;
+		ReleaseSRWLockExclusive(&state.lock);
+		ListView_SetItemCountEx(state.hwndList, min<UINT>(count, INT_MAX), LVSICF_NOINVALIDATEALL | LVSICF_NOSCROLL);
+	}
+	return TRUE;
+
+	case WM_NOTIFY: {
+		const LPNMHDR pnmhdr = AsPointer<LPNMHDR>(lParam);
+		if (pnmhdr->idFrom == IDC_FINDINFILES) {
+			switch (pnmhdr->code) {
+			case LVN_GETDISPINFO: {
+				const NMLVDISPINFO *lpdi = AsPointer<NMLVDISPINFO *>(lParam);
+				if (lpdi->item.mask & LVIF_TEXT) {
+					FindInFiles_GetText(lpdi->item.iItem, lpdi->item.pszText, lpdi->item.cchTextMax);
+				}
 			}
-			bookmarkLine = lineEnd;
-		}
-	} else {
-		for (UINT i = 0; i < index; i += 2) {
-			const Sci_Line line = SciCall_LineFromPosition(ranges[i]);
-			if (line != bookmarkLine) {
-				SciCall_MarkerAdd(line, MarkerNumber_Bookmark);
-				bookmarkLine = line;
+			break;
+
+			case NM_DBLCLK:
+				SendWMCommand(hwnd, IDOK);
+				break;
 			}
 		}
 	}
-	return bookmarkLine;
-}
+	return TRUE;
 
-void EditMarkAll::Continue(HANDLE timer) noexcept {
-	// use increment search to ensure FindText() terminated in expected time.
-	//++EditMarkAll_Runs;
-	//printf("match %3u %s\n", EditMarkAll_Runs, GetCurrentLogTime());
-	QueryPerformanceCounter(&watch.begin);
-	const Sci_Position iLength = SciCall_GetLength();
-	Sci_Position iStartPos = prevStopPos;
-	Sci_Position iMaxLength = incrementSize * EditMarkAll_MeasuredSize;
-	iMaxLength += iStartPos + length;
-	iMaxLength = min(iMaxLength, iLength);
-	if (iMaxLength < iLength) {
-		// match on whole line to avoid rewinding.
-		iMaxLength = SciCall_PositionFromLine(SciCall_LineFromPosition(iMaxLength) + 1);
-		if (iMaxLength + EditMarkAll_MeasuredSize >= iLength) {
-			iMaxLength = iLength;
+	case WM_COMMAND:
+		switch (LOWORD(wParam)) {
+		case IDOK: {
+			HWND hwndLV = GetDlgItem(hwnd, IDC_FINDINFILES);
+			const int iItem = ListView_GetNextItem(hwndLV, -1, LVNI_ALL | LVNI_SELECTED);
+			if (iItem >= 0) {
+				FindInFiles_Open(iItem);
+			}
 		}
-	}
+		break;
 
-	// rewind start position
-	const int findFlag = markFlag;
-	if (findFlag & NP2_MarkAllMultiline) {
-		iStartPos = max(iStartPos - length + 1, lastMatchPos);
+		case IDCANCEL:
+			DestroyWindow(hwnd);
+			break;
+		}
+		return TRUE;
 	}
+	return FALSE;
+}
 
-	Sci_Position cpMin = iStartPos;
-	Sci_TextToFindFull ttf = { { cpMin, iMaxLength }, pszText, { 0, 0 } };
+HWND EditFindInFilesDlg(HWND hwnd) noexcept {
+	HWND hDlg = CreateThemedDialogParam(g_hInstance, MAKEINTRESOURCE(IDD_FINDINFILES), hwnd, EditFindInFilesDlgProc, 0);
+	ShowWindow(hDlg, SW_SHOW);
+	return hDlg;
+}
 
-	Sci_Position matchCount_ = matchCount;
-	UINT index = 0;
-	Sci_Position ranges[EditMarkAll_RangeCacheCount*2];
-	Sci_Line bookmarkLine = prevBookmarkLine;
+//=============================================================================
+//
+// Find as you type in Find/Replace dialog, literal text is searched on a worker
+// against document snapshot, each change to find text cancels previous search.
+// first match after the selection is posted before all matches are counted.
+//
+#define NP2_FIND_AS_YOU_TYPE_CHUNK		(1 << 20)	// bytes searched between cancellation checks
+#define NP2_FIND_AS_YOU_TYPE_PROGRESS	100			// milliseconds between count updates
 
-	SciCall_SetIndicatorCurrent(IndicatorNumber_MarkOccurrence);
-	WaitableTimer_Set(timer, WaitableTimer_IdleTaskTimeSlot);
-	while (cpMin < iMaxLength && WaitableTimer_Continue(timer)) {
-		ttf.chrg.cpMin = cpMin;
-		const Sci_Position iPos = SciCall_FindTextFull(findFlag, &ttf);
-		if (iPos < 0) {
-			iStartPos = iMaxLength;
-			break;
-		}
+extern bool bFindAsYouType;
 
-		++matchCount_;
-		const Sci_Position iSelCount = ttf.chrgText.cpMax - iPos;
-		if (iSelCount == 0) {
-			// empty regex
-			cpMin = SciCall_PositionAfter(iPos);
-			continue;
-		}
+namespace {
 
-		if (index != 0 && iPos == cpMin && (findFlag & (NP2_MarkAllSelectAll | NP2_SearchForLineEnd)) == 0) {
-			// TODO: avoid merge adjacent indicator ranges when they are not on same line.
-			ranges[index - 1] += iSelCount;
-		} else {
-			ranges[index] = iPos;
-			ranges[index + 1] = iSelCount;
-			index += 2;
-			if (index == COUNTOF(ranges)) {
-				bookmarkLine = EditMarkAll_Bookmark(bookmarkLine, ranges, index, findFlag, matchCount_);
-				index = 0;
+enum FindAsYouTypeUpdate {
+	FindAsYouTypeUpdate_FirstMatch,
+	FindAsYouTypeUpdate_Progress,
+	FindAsYouTypeUpdate_Done,
+};
+
+struct FindAsYouType {
+	BackgroundWorker worker;
+	Scintilla::IDocumentSnapshot *snapshot;
+	LiteralPattern pattern;
+	WPARAM generation;		// posted with each update, older updates are discarded
+	bool active;			// match count is shown on status bar
+	bool pending;
+	bool wrapAround;
+	Sci_Position anchor;	// selection before typing, restored when not found
+	Sci_Position caret;
+	// written by worker before posting update
+	volatile Sci_Position firstMatch;
+	volatile Sci_Position matchCount;
+};
+
+FindAsYouType findAsYouType;
+
+}
+
+// returns first whole match starting in [ptr, end), nullptr when not found or cancelled
+static const char *FindAsYouType_Search(const FindAsYouType &state, const char *text, const char *ptr, const char *end) noexcept {
+	const LiteralPattern &pattern = state.pattern;
+	const char * const textEnd = text + state.snapshot->Length();
+	while (ptr < end && state.worker.Continue() && !state.snapshot->IsStale()) {
+		const char * const stop = (end - ptr > NP2_FIND_AS_YOU_TYPE_CHUNK) ? ptr + NP2_FIND_AS_YOU_TYPE_CHUNK : end;
+		const char * const limit = stop + min<size_t>(pattern.length - 1, textEnd - stop);
+		const char *found = pattern.Search(ptr, limit);
+		while (found != nullptr) {
+			if (pattern.IsWholeWord(text, found, textEnd)) {
+				return found;
 			}
+			found = pattern.Search(found + 1, limit);
 		}
-		cpMin = ttf.chrgText.cpMax;
-	}
-	if (index) {
-		bookmarkLine = EditMarkAll_Bookmark(bookmarkLine, ranges, index, findFlag, matchCount_);
+		ptr = stop;
 	}
+	return nullptr;
+}
 
-	iStartPos = max(iStartPos, cpMin);
-	pending = iStartPos < iLength;
-	if (pending) {
-		// dynamic compute increment search size, see ActionDuration in Scintilla.
-		watch.Stop();
-		const double period = watch.Get();
-		iMaxLength = iStartPos - prevStopPos;
-		const double durationOne = (EditMarkAll_MeasuredSize * period) / iMaxLength;
-		constexpr double alpha = 0.25;
-		const double duration_ = alpha * durationOne + (1.0 - alpha) * duration;
-		duration = max(duration_, EditMarkAll_MinDuration);
-		incrementSize = 1 + static_cast<int>(WaitableTimer_IdleTaskTimeSlot / duration);
-		//printf("match %3u (%zd, %zd) length=%.3f / %zd, one=%.3f, duration=%.3f / %.3f, increment=%d\n", EditMarkAll_Runs,
-		//	prevStopPos, iStartPos, period, iMaxLength, durationOne, duration, duration_, incrementSize);
-	}
+static DWORD WINAPI FindAsYouType_Thread(LPVOID lpParam) noexcept {
+	FindAsYouType &state = *static_cast<FindAsYouType *>(lpParam);
+	const BackgroundWorker &worker = state.worker;
+	const WPARAM generation = state.generation;
+	const char * const text = state.snapshot->Text();
+	const char * const end = text + state.snapshot->Length();
+	const char * const start = text + min(state.anchor, state.caret);
 
-	ignoreSelectionUpdate = matchCount_ && (findFlag & NP2_MarkAllSelectAll);
-	lastMatchPos = cpMin;
-	prevStopPos = iStartPos;
-	prevBookmarkLine = bookmarkLine;
-	if (!pending || matchCount_ != matchCount) {
-		matchCount = matchCount_;
-		UpdateStatusBarCache(StatusItem_Find);
-		UpdateStatusbar();
+	const char *found = FindAsYouType_Search(state, text, start, end);
+	if (found == nullptr && state.wrapAround) {
+		found = FindAsYouType_Search(state, text, text, start);
+	}
+	if (!worker.Continue()) {
+		return 0;
+	}
+	state.firstMatch = (found == nullptr) ? -1 : found - text;
+	PostMessage(worker.hwnd, APPM_FINDASYOUTYPE, generation, FindAsYouTypeUpdate_FirstMatch);
+
+	Sci_Position matchCount = 0;
+	DWORD dwLastUpdate = GetTickCount();
+	const char *ptr = text;
+	while ((found = FindAsYouType_Search(state, text, ptr, end)) != nullptr) {
+		++matchCount;
+		ptr = found + state.pattern.length;
+		const DWORD dwNow = GetTickCount();
+		if (dwNow - dwLastUpdate >= NP2_FIND_AS_YOU_TYPE_PROGRESS) {
+			dwLastUpdate = dwNow;
+			state.matchCount = matchCount;
+			PostMessage(worker.hwnd, APPM_FINDASYOUTYPE, generation, FindAsYouTypeUpdate_Progress);
+		}
 	}
+	if (worker.Continue()) {
+		state.matchCount = matchCount;
+		PostMessage(worker.hwnd, APPM_FINDASYOUTYPE, generation, FindAsYouTypeUpdate_Done);
+	}
+	return 0;
 }
 
-void EditMarkAll::MarkAll(BOOL bChanged, int option) noexcept {
-	// get current selection
-	Sci_Position iSelStart = SciCall_GetSelectionStart();
-	const Sci_Position iSelEnd = SciCall_GetSelectionEnd();
-	Sci_Position iSelCount = iSelEnd - iSelStart;
+static void FindAsYouType_Cancel() noexcept {
+	FindAsYouType &state = findAsYouType;
+	// worker only posts message, wait without dispatching keystrokes
+	SetEvent(state.worker.eventCancel);
+	HANDLE hThread = InterlockedExchangePointer(&state.worker.workerThread, nullptr);
+	if (hThread != nullptr) {
+		WaitForSingleObject(hThread, INFINITE);
+		CloseHandle(hThread);
+	}
+	ResetEvent(state.worker.eventCancel);
+	++state.generation;
+}
 
-	// if nothing selected or multiple lines are selected exit
-	if (iSelCount == 0 || SciCall_LineFromPosition(iSelStart) != SciCall_LineFromPosition(iSelEnd)) {
-		Clear();
+void EditFindAsYouType(HWND hwndDlg) noexcept {
+	FindAsYouType &state = findAsYouType;
+	if (!bFindAsYouType) {
 		return;
 	}
+	if (state.worker.eventCancel == nullptr) {
+		state.worker.Init(hwndDlg);
+	} else {
+		FindAsYouType_Cancel();
+	}
+	state.worker.hwnd = hwndDlg;
 
-	iSelCount = SciCall_GetSelTextLength();
-	char *text = static_cast<char *>(NP2HeapAlloc(iSelCount + 1));
-	SciCall_GetSelText(text);
+	// only literal text is supported, regex engine is bound to document
+	LiteralPattern &pattern = state.pattern;
+	const UINT cpEdit = SciCall_GetCodePage();
+	if (IsButtonChecked(hwndDlg, IDC_FINDREGEXP) || IsButtonChecked(hwndDlg, IDC_WILDCARDSEARCH)
+		|| IsButtonChecked(hwndDlg, IDC_FINDSTART)) {
+		EditFindAsYouTypeStop(false);
+		return;
+	}
+	if (!GetDlgItemTextA2W(cpEdit, hwndDlg, IDC_FINDTEXT, pattern.text, COUNTOF(pattern.text))) {
+		EditFindAsYouTypeStop(true);
+		return;
+	}
+	if (IsButtonChecked(hwndDlg, IDC_FINDTRANSFORMBS)) {
+		TransformBackslashes(pattern.text, FALSE, cpEdit);
+	}
+	int searchFlags = SCFIND_NONE;
+	if (IsButtonChecked(hwndDlg, IDC_FINDCASE)) {
+		searchFlags |= SCFIND_MATCHCASE;
+	}
+	if (IsButtonChecked(hwndDlg, IDC_FINDWORD)) {
+		searchFlags |= SCFIND_WHOLEWORD;
+	}
+	if (!pattern.Init(searchFlags)) {
+		EditFindAsYouTypeStop(true);
+		return;
+	}
 
-	static_assert(NP2_MarkAllBookmark == MarkOccurrences_Bookmark << 10);
-	int findFlag = (option & MarkOccurrences_Bookmark) << 10;
-	// exit if selection is not a word and Match whole words only is enabled
-	if (option & MarkOccurrences_WholeWord) {
-		findFlag |= SCFIND_WHOLEWORD;
-		const UINT cpEdit = SciCall_GetCodePage();
-		const bool dbcs = !(cpEdit == CP_UTF8 || cpEdit == 0);
-		// CharClassify::SetDefaultCharClasses()
-		for (iSelStart = 0; iSelStart < iSelCount; ++iSelStart) {
-			const unsigned char ch = text[iSelStart];
-			if (dbcs && IsDBCSLeadByteEx(cpEdit, ch)) {
-				++iSelStart;
-			} else if (!IsDocWordChar(ch)) {
-				NP2HeapFree(text);
-				Clear();
-				return;
-			}
-		}
+	if (!state.active) {
+		// each keystroke searches from selection before typing
+		state.anchor = SciCall_GetAnchor();
+		state.caret = SciCall_GetCurrentPos();
 	}
-	if (option & MarkOccurrences_MatchCase) {
-		findFlag |= SCFIND_MATCHCASE;
-	} else {
-		const bool sensitive = IsStringCaseSensitiveA(text);
-		//printf("%s sensitive=%d\n", __func__, sensitive);
-		if (!sensitive) {
-			findFlag |= SCFIND_MATCHCASE;
-		}
+	state.wrapAround = !IsButtonChecked(hwndDlg, IDC_NOWRAP);
+	state.firstMatch = -1;
+	state.matchCount = 0;
+	// snapshot is shared while document is unchanged
+	if (state.snapshot != nullptr) {
+		state.snapshot->Release();
+	}
+	state.snapshot = SciCall_CreateDocumentSnapshot();
+	if (state.snapshot != nullptr) {
+		state.worker.workerThread = CreateThread(nullptr, 0, FindAsYouType_Thread, &state, 0, nullptr);
+	}
+	if (state.worker.workerThread == nullptr) {
+		EditFindAsYouTypeStop(false);
+		return;
 	}
 
-	Start(bChanged, findFlag, iSelCount, text);
+	state.active = true;
+	state.pending = true;
+	UpdateStatusBarCache(StatusItem_Find);
+	UpdateStatusbar();
 }
 
-void EditFindAll(const EDITFINDREPLACE *lpefr, bool selectAll) noexcept {
-	char *szFind2 = static_cast<char *>(NP2HeapAlloc(NP2_FIND_REPLACE_LIMIT));
-	int searchFlags = EditPrepareFind(szFind2, lpefr);
-	if (searchFlags == NP2_InvalidSearchFlags) {
-		NP2HeapFree(szFind2);
+void EditFindAsYouTypeStop(bool restoreSelection) noexcept {
+	FindAsYouType &state = findAsYouType;
+	if (state.worker.eventCancel != nullptr) {
+		FindAsYouType_Cancel();
+	}
+	if (state.snapshot != nullptr) {
+		state.snapshot->Release();
+		state.snapshot = nullptr;
+	}
+	if (state.active) {
+		state.active = false;
+		if (restoreSelection) {
+			EditSelectEx(state.anchor, state.caret);
+		}
+		UpdateStatusBarCache(StatusItem_Find);
+		UpdateStatusbar();
+	}
+}
+
+void EditFindAsYouTypeUpdate(WPARAM wParam, LPARAM lParam) noexcept {
+	FindAsYouType &state = findAsYouType;
+	if (wParam != state.generation || !state.active || state.snapshot == nullptr || state.snapshot->IsStale()) {
 		return;
 	}
+	if (lParam == FindAsYouTypeUpdate_FirstMatch) {
+		// marking occurrences of each intermediate match is skipped
+		editMarkAll.ignoreSelectionUpdate = true;
+		const Sci_Position iPos = state.firstMatch;
+		if (iPos >= 0) {
+			EditSelectEx(iPos, iPos + state.pattern.length);
+		} else {
+			EditSelectEx(state.anchor, state.caret);
+		}
+	} else {
+		state.pending = lParam != FindAsYouTypeUpdate_Done;
+		UpdateStatusBarCache(StatusItem_Find);
+		UpdateStatusbar();
+	}
+}
 
-	static_assert(NP2_MarkAllBookmark == FindReplaceOption_FindAllBookmark << 10);
-	searchFlags |= ((iFindReplaceOption & FindReplaceOption_FindAllBookmark) << 10)
-		| ((static_cast<int>(selectAll)) * NP2_MarkAllSelectAll)
-		| NP2_FromFindAll;
-	// rewind start position when transform backslash is checked,
-	// all other searching doesn't across lines.
-	// NOTE: complex fix is needed when multiline regex is supported.
-	if ((searchFlags & SCFIND_REGEX_DOT_ALL) != 0 || ((lpefr->option & FindReplaceOption_TransformBackslash) != 0 && strpbrk(szFind2, "\r\n") != nullptr)) {
-		searchFlags |= NP2_MarkAllMultiline;
+bool EditFindAsYouTypeGetCount(Sci_Position &matchCount, bool &pending) noexcept {
+	const FindAsYouType &state = findAsYouType;
+	if (!state.active || state.snapshot == nullptr || state.snapshot->IsStale()) {
+		return false;
 	}
-	editMarkAll.Start(FALSE, searchFlags, strlen(szFind2), szFind2);
+	matchCount = state.matchCount;
+	pending = state.pending;
+	return true;
 }
 
 void EditToggleBookmarkAt(Sci_Position iPos) noexcept {
@@ -5910,50 +10903,16 @@ void EditReplaceAll(HWND hwnd, const EDITFINDREPLACE *lpefr) noexcept {
 	watch.Start();
 #endif
 
-	const bool bRegexStartOfLine = bReplaceRE && (szFind2[0] == '^');
-	Sci_TextToFindFull ttf = { { 0, SciCall_GetLength() }, szFind2, { 0, 0 } };
-	Sci_Position iCount = 0;
-	while (SciCall_FindTextFull(searchFlags, &ttf) >= 0) {
-		++iCount;
-		if (iCount == 1) {
-			SciCall_BeginBatchUpdate();
-		}
-
-		SciCall_SetTargetRange(ttf.chrgText.cpMin, ttf.chrgText.cpMax);
-		const Sci_Position iReplacedLen = SciCall_ReplaceTargetEx(bReplaceRE, -1, pszReplace2);
-
-		ttf.chrg.cpMin = (ttf.chrgText.cpMin + iReplacedLen);
-		// document length change: iReplacedLen - (ttf.chrgText.cpMax - ttf.chrgText.cpMin)
-		ttf.chrg.cpMax += ttf.chrg.cpMin - ttf.chrgText.cpMax;
-
-		if (ttf.chrg.cpMin == ttf.chrg.cpMax) {
-			break;
-		}
-
-		if (ttf.chrgText.cpMin == ttf.chrgText.cpMax && !bRegexStartOfLine) {
-			// move to next line after the replacement.
-			ttf.chrg.cpMin = SciCall_PositionAfter(ttf.chrg.cpMin);
-		}
-
-		if (bRegexStartOfLine) {
-			const Sci_Line iLine = SciCall_LineFromPosition(ttf.chrg.cpMin);
-			const Sci_Position ilPos = SciCall_PositionFromLine(iLine);
-
-			if (ilPos == ttf.chrg.cpMin) {
-				ttf.chrg.cpMin = SciCall_PositionFromLine(iLine + 1);
-			}
-			if (ttf.chrg.cpMin == ttf.chrg.cpMax) {
-				break;
-			}
-		}
-	}
+	// find all matches and replace them as one block
+	SciCall_SetSearchFlags(searchFlags);
+	SciCall_TargetWholeDocument();
+	const Sci_Position iCount = SciCall_ReplaceAllInTarget(bReplaceRE, szFind2, pszReplace2);
 
 #if 0
 	watch.Stop();
 	watch.ShowLog("EditReplaceAll() time");
 #endif
 	if (iCount) {
-		SciCall_EndBatchUpdate();
 		EditEnsureSelectionVisible();
 	}
 
@@ -5984,52 +10943,12 @@ void EditReplaceAllInSelection(HWND hwnd, const EDITFINDREPLACE *lpefr, EditRepl
 	// Show wait cursor...
 	BeginWaitCursor();
 
-	const bool bRegexStartOfLine = bReplaceRE && (szFind2[0] == '^');
-	Sci_TextToFindFull ttf = { { SciCall_GetSelectionStart(), SciCall_GetLength() }, szFind2, { 0, 0 } };
-	Sci_Position iCount = 0;
-	while (SciCall_FindTextFull(searchFlags, &ttf) >= 0) {
-		if (ttf.chrgText.cpMax <= SciCall_GetSelectionEnd()) {
-			++iCount;
-			if (iCount == 1 && (flag & EditReplaceAllFlag_UndoGroup) != 0) {
-				SciCall_BeginBatchUpdate();
-			}
-
-			SciCall_SetTargetRange(ttf.chrgText.cpMin, ttf.chrgText.cpMax);
-			const Sci_Position iReplacedLen = SciCall_ReplaceTargetEx(bReplaceRE, -1, pszReplace2);
-
-			ttf.chrg.cpMin = (ttf.chrgText.cpMin + iReplacedLen);
-			// document length change: iReplacedLen - (ttf.chrgText.cpMax - ttf.chrgText.cpMin)
-			ttf.chrg.cpMax += ttf.chrg.cpMin - ttf.chrgText.cpMax;
-
-			if (ttf.chrg.cpMin == ttf.chrg.cpMax) {
-				break;
-			}
-
-			if (ttf.chrgText.cpMin == ttf.chrgText.cpMax && !bRegexStartOfLine) {
-				// move to next line after the replacement.
-				ttf.chrg.cpMin = SciCall_PositionAfter(ttf.chrg.cpMin);
-			}
-
-			if (bRegexStartOfLine) {
-				const Sci_Line iLine = SciCall_LineFromPosition(ttf.chrg.cpMin);
-				const Sci_Position ilPos = SciCall_PositionFromLine(iLine);
-
-				if (ilPos == ttf.chrg.cpMin) {
-					ttf.chrg.cpMin = SciCall_PositionFromLine(iLine + 1);
-				}
-				if (ttf.chrg.cpMin == ttf.chrg.cpMax) {
-					break;
-				}
-			}
-		} else { // gone across selection, cancel
-			break;
-		}
-	}
+	// matches are replaced as one block, which is always a single undo step
+	SciCall_SetSearchFlags(searchFlags);
+	SciCall_SetTargetRange(SciCall_GetSelectionStart(), SciCall_GetSelectionEnd());
+	const Sci_Position iCount = SciCall_ReplaceAllInTarget(bReplaceRE, szFind2, pszReplace2);
 
 	if (iCount) {
-		if ((flag & EditReplaceAllFlag_UndoGroup) != 0) {
-			SciCall_EndBatchUpdate();
-		}
 		const Sci_Position iPos = SciCall_GetTargetEnd();
 		if (SciCall_GetSelectionEnd() < iPos) {
 			Sci_Position iAnchorPos = SciCall_GetAnchor();
@@ -6062,8 +10981,9 @@ static INT_PTR CALLBACK EditLineNumDlgProc(HWND hwnd, UINT umsg, WPARAM wParam,
 
 	switch (umsg) {
 	case WM_INITDIALOG: {
-		const Sci_Line iCurLine = SciCall_LineFromPosition(SciCall_GetCurrentPos()) + 1;
-		const Sci_Line iMaxLine = SciCall_GetLineCount();
+		const bool bViewer = EditViewerActive();
+		const Sci_Line iCurLine = SciCall_LineFromPosition(SciCall_GetCurrentPos()) + 1 + (bViewer ? EditViewerFirstLine() : 0);
+		const Sci_Line iMaxLine = bViewer ? EditViewerLineCount() : SciCall_GetLineCount();
 		const Sci_Position iLength = SciCall_GetLength();
 
 		SendDlgItemMessage(hwnd, IDC_LINENUM, EM_LIMITTEXT, 20, 0);
@@ -6086,66 +11006,227 @@ static INT_PTR CALLBACK EditLineNumDlgProc(HWND hwnd, UINT umsg, WPARAM wParam,
 		wsprintf(tchLines, tchFmt, tchLn);
 		SetDlgItemText(hwnd, IDC_COLUMN_RANGE, tchLines);
 
-		CenterDlgInParent(hwnd);
+		CenterDlgInParent(hwnd);
+	}
+	return TRUE;
+
+	case WM_COMMAND:
+		switch (LOWORD(wParam)) {
+		case IDOK: {
+			bool fTranslated;
+			bool fTranslated2;
+			WCHAR tchLn[32];
+			Sci_Line iNewLine = 0;
+			Sci_Position iNewCol = 0;
+
+			// Extract line number from the text entered
+			// For example: "5410:" will result in 5410
+			GetDlgItemText(hwnd, IDC_LINENUM, tchLn, COUNTOF(tchLn));
+#if defined(_WIN64)
+			int64_t iLine = 0;
+			fTranslated = CRTStrToInt64(tchLn, &iLine);
+#else
+			int iLine = 0;
+			fTranslated = CRTStrToInt(tchLn, &iLine);
+#endif
+			iNewLine = iLine;
+
+			if (SendDlgItemMessage(hwnd, IDC_COLNUM, WM_GETTEXTLENGTH, 0, 0) > 0) {
+				GetDlgItemText(hwnd, IDC_COLNUM, tchLn, COUNTOF(tchLn));
+#if defined(_WIN64)
+				fTranslated2 = CRTStrToInt64(tchLn, &iLine);
+#else
+				fTranslated2 = CRTStrToInt(tchLn, &iLine);
+#endif
+				iNewCol = iLine;
+			} else {
+				iNewCol = 1;
+				fTranslated2 = fTranslated;
+			}
+
+			if (!(fTranslated || fTranslated2)) {
+				PostMessage(hwnd, WM_NEXTDLGCTL, AsInteger<WPARAM>(GetDlgItem(hwnd, IDC_LINENUM)), TRUE);
+				return TRUE;
+			}
+
+			if (fTranslated && EditViewerActive()) {
+				// line number in whole file
+				if (EditViewerGotoLine(iNewLine, iNewCol)) {
+					EndDialog(hwnd, IDOK);
+				} else {
+					MessageBeep(MB_OK);
+					PostMessage(hwnd, WM_NEXTDLGCTL, AsInteger<WPARAM>(GetDlgItem(hwnd, IDC_LINENUM)), TRUE);
+				}
+				return TRUE;
+			}
+
+			const Sci_Line iMaxLine = SciCall_GetLineCount();
+			const Sci_Position iLength = SciCall_GetLength();
+			// directly goto specific position
+			if (fTranslated2 && !fTranslated) {
+				if (iNewCol > 0 && iNewCol <= iLength) {
+					--iNewCol;
+					EditSelectEx(iNewCol, iNewCol);
+					SciCall_ChooseCaretX();
+					EndDialog(hwnd, IDOK);
+				} else {
+					PostMessage(hwnd, WM_NEXTDLGCTL, AsInteger<WPARAM>(GetDlgItem(hwnd, IDC_COLNUM)), TRUE);
+				}
+			} else if (iNewLine > 0 && iNewLine <= iMaxLine) {
+				EditJumpTo(iNewLine, iNewCol);
+				EndDialog(hwnd, IDOK);
+			} else {
+				PostMessage(hwnd, WM_NEXTDLGCTL, AsInteger<WPARAM>(GetDlgItem(hwnd, ((iNewCol > 0) ? IDC_LINENUM : IDC_COLNUM))), TRUE);
+			}
+		}
+		break;
+
+		case IDCANCEL:
+			EndDialog(hwnd, IDCANCEL);
+			break;
+		}
+
+		return TRUE;
+	}
+
+	return FALSE;
+}
+
+//=============================================================================
+//
+// EditLinenumDlg()
+//
+bool EditLineNumDlg(HWND hwnd) noexcept {
+	const INT_PTR iResult = ThemedDialogBoxParam(g_hInstance, MAKEINTRESOURCE(IDD_LINENUM), GetParent(hwnd), EditLineNumDlgProc, 0);
+	return iResult == IDOK;
+}
+
+//=============================================================================
+//
+// EditGotoSymbolDlg()
+//
+// symbols come from the background symbol index, filtered with fuzzy match as typing.
+#define NP2_SYMBOL_PATTERN_SIZE		64
+
+namespace {
+
+struct GotoSymbolState {
+	SymbolItem *items;
+	UINT count;
+};
+
+GotoSymbolState gotoSymbol;
+
+}
+
+static void EditGotoSymbol_Filter(HWND hwnd) noexcept {
+	auto &state = gotoSymbol;
+	WCHAR wch[NP2_SYMBOL_PATTERN_SIZE];
+	char pattern[NP2_SYMBOL_PATTERN_SIZE*kMaxMultiByteCount];
+	GetDlgItemText(hwnd, IDC_SYMBOL_FILTER, wch, COUNTOF(wch));
+	const UINT cpEdit = SciCall_GetCodePage();
+	const int length = WideCharToMultiByte(cpEdit, 0, wch, -1, pattern, COUNTOF(pattern), nullptr, nullptr);
+
+	if (state.items != nullptr) {
+		NP2HeapFree(state.items);
+	}
+	state.items = EditSymbolIndexMatch(pattern, (length > 0) ? length - 1 : 0, &state.count);
+
+	HWND hwndLV = GetDlgItem(hwnd, IDC_SYMBOL_LIST);
+	ListView_SetItemCount(hwndLV, state.count);
+	if (state.count != 0) {
+		ListView_SetItemState(hwndLV, 0, LVIS_FOCUSED | LVIS_SELECTED, LVIS_FOCUSED | LVIS_SELECTED);
+		ListView_EnsureVisible(hwndLV, 0, FALSE);
+	}
+	InvalidateRect(hwndLV, nullptr, TRUE);
+}
+
+static void EditGotoSymbol_GetText(int iItem, LPWSTR pszText, int cchText) noexcept {
+	const auto &state = gotoSymbol;
+	if (iItem < 0 || static_cast<UINT>(iItem) >= state.count || cchText < 32) {
+		return;
+	}
+
+	const SymbolItem &item = state.items[iItem];
+	PosToStr(item.line + 1, pszText);
+	int cch = lstrlen(pszText);
+	pszText[cch++] = L':';
+	pszText[cch++] = L' ';
+	const UINT cpEdit = SciCall_GetCodePage();
+	cch += MultiByteToWideChar(cpEdit, 0, item.name, item.length, pszText + cch, cchText - cch - 1);
+	pszText[cch] = L'\0';
+}
+
+static INT_PTR CALLBACK EditGotoSymbolDlgProc(HWND hwnd, UINT umsg, WPARAM wParam, LPARAM lParam) noexcept {
+	static const DWORD controlDefinition[] = {
+		DeferCtlMove(IDC_RESIZEGRIP),
+		DeferCtlSizeX(IDC_SYMBOL_FILTER),
+		DeferCtlSize(IDC_SYMBOL_LIST) | RESIZE_AUTOSIZE_USEHEADER,
+	};
+
+	switch (umsg) {
+	case WM_INITDIALOG: {
+		HWND hwndLV = GetDlgItem(hwnd, IDC_SYMBOL_LIST);
+		InitWindowCommon(hwndLV);
+		ResizeDlg_Init(hwnd, &positionRecord.cxGotoSymbolDlg, &positionRecord.cyGotoSymbolDlg, controlDefinition, COUNTOF(controlDefinition));
+
+		ListView_SetExtendedListViewStyle(hwndLV, LVS_EX_FULLROWSELECT | LVS_EX_DOUBLEBUFFER | LVS_EX_LABELTIP);
+		const LVCOLUMN lvc = { LVCF_FMT | LVCF_TEXT, LVCFMT_LEFT, 0, nullptr, -1, 0, 0, 0
+#if _WIN32_WINNT >= _WIN32_WINNT_VISTA
+			, 0, 0, 0
+#endif
+		};
+		ListView_InsertColumn(hwndLV, 0, &lvc);
+		ListView_SetColumnWidth(hwndLV, 0, LVSCW_AUTOSIZE_USEHEADER);
+
+		SendDlgItemMessage(hwnd, IDC_SYMBOL_FILTER, EM_LIMITTEXT, NP2_SYMBOL_PATTERN_SIZE - 1, 0);
+		EditGotoSymbol_Filter(hwnd);
+		CenterDlgInParent(hwnd);
+	}
+	return TRUE;
+
+	case WM_DESTROY:
+		if (gotoSymbol.items != nullptr) {
+			NP2HeapFree(gotoSymbol.items);
+		}
+		gotoSymbol = {};
+		return FALSE;
+
+	case WM_NOTIFY: {
+		const LPNMHDR pnmhdr = AsPointer<LPNMHDR>(lParam);
+		if (pnmhdr->idFrom == IDC_SYMBOL_LIST) {
+			switch (pnmhdr->code) {
+			case LVN_GETDISPINFO: {
+				const NMLVDISPINFO *lpdi = AsPointer<NMLVDISPINFO *>(lParam);
+				if (lpdi->item.mask & LVIF_TEXT) {
+					EditGotoSymbol_GetText(lpdi->item.iItem, lpdi->item.pszText, lpdi->item.cchTextMax);
+				}
+			}
+			break;
+
+			case NM_DBLCLK:
+				SendWMCommand(hwnd, IDOK);
+				break;
+			}
+		}
 	}
 	return TRUE;
 
 	case WM_COMMAND:
 		switch (LOWORD(wParam)) {
-		case IDOK: {
-			bool fTranslated;
-			bool fTranslated2;
-			WCHAR tchLn[32];
-			Sci_Line iNewLine = 0;
-			Sci_Position iNewCol = 0;
-
-			// Extract line number from the text entered
-			// For example: "5410:" will result in 5410
-			GetDlgItemText(hwnd, IDC_LINENUM, tchLn, COUNTOF(tchLn));
-#if defined(_WIN64)
-			int64_t iLine = 0;
-			fTranslated = CRTStrToInt64(tchLn, &iLine);
-#else
-			int iLine = 0;
-			fTranslated = CRTStrToInt(tchLn, &iLine);
-#endif
-			iNewLine = iLine;
-
-			if (SendDlgItemMessage(hwnd, IDC_COLNUM, WM_GETTEXTLENGTH, 0, 0) > 0) {
-				GetDlgItemText(hwnd, IDC_COLNUM, tchLn, COUNTOF(tchLn));
-#if defined(_WIN64)
-				fTranslated2 = CRTStrToInt64(tchLn, &iLine);
-#else
-				fTranslated2 = CRTStrToInt(tchLn, &iLine);
-#endif
-				iNewCol = iLine;
-			} else {
-				iNewCol = 1;
-				fTranslated2 = fTranslated;
-			}
-
-			if (!(fTranslated || fTranslated2)) {
-				PostMessage(hwnd, WM_NEXTDLGCTL, AsInteger<WPARAM>(GetDlgItem(hwnd, IDC_LINENUM)), TRUE);
-				return TRUE;
+		case IDC_SYMBOL_FILTER:
+			if (HIWORD(wParam) == EN_CHANGE) {
+				EditGotoSymbol_Filter(hwnd);
 			}
+			break;
 
-			const Sci_Line iMaxLine = SciCall_GetLineCount();
-			const Sci_Position iLength = SciCall_GetLength();
-			// directly goto specific position
-			if (fTranslated2 && !fTranslated) {
-				if (iNewCol > 0 && iNewCol <= iLength) {
-					--iNewCol;
-					EditSelectEx(iNewCol, iNewCol);
-					SciCall_ChooseCaretX();
-					EndDialog(hwnd, IDOK);
-				} else {
-					PostMessage(hwnd, WM_NEXTDLGCTL, AsInteger<WPARAM>(GetDlgItem(hwnd, IDC_COLNUM)), TRUE);
-				}
-			} else if (iNewLine > 0 && iNewLine <= iMaxLine) {
-				EditJumpTo(iNewLine, iNewCol);
+		case IDOK: {
+			HWND hwndLV = GetDlgItem(hwnd, IDC_SYMBOL_LIST);
+			const int iItem = ListView_GetNextItem(hwndLV, -1, LVNI_ALL | LVNI_SELECTED);
+			if (iItem >= 0 && static_cast<UINT>(iItem) < gotoSymbol.count) {
+				const Sci_Line iLine = gotoSymbol.items[iItem].line;
 				EndDialog(hwnd, IDOK);
-			} else {
-				PostMessage(hwnd, WM_NEXTDLGCTL, AsInteger<WPARAM>(GetDlgItem(hwnd, ((iNewCol > 0) ? IDC_LINENUM : IDC_COLNUM))), TRUE);
+				EditJumpTo(iLine + 1, 0);
 			}
 		}
 		break;
@@ -6154,19 +11235,13 @@ static INT_PTR CALLBACK EditLineNumDlgProc(HWND hwnd, UINT umsg, WPARAM wParam,
 			EndDialog(hwnd, IDCANCEL);
 			break;
 		}
-
 		return TRUE;
 	}
-
 	return FALSE;
 }
 
-//=============================================================================
-//
-// EditLinenumDlg()
-//
-bool EditLineNumDlg(HWND hwnd) noexcept {
-	const INT_PTR iResult = ThemedDialogBoxParam(g_hInstance, MAKEINTRESOURCE(IDD_LINENUM), GetParent(hwnd), EditLineNumDlgProc, 0);
+bool EditGotoSymbolDlg(HWND hwnd) noexcept {
+	const INT_PTR iResult = ThemedDialogBoxParam(g_hInstance, MAKEINTRESOURCE(IDD_GOTOSYMBOL), GetParent(hwnd), EditGotoSymbolDlgProc, 0);
 	return iResult == IDOK;
 }
 
@@ -6777,6 +11852,7 @@ static INT_PTR CALLBACK EditSortDlgProc(HWND hwnd, UINT umsg, WPARAM wParam, LPA
 			EnableWindow(GetDlgItem(hwnd, IDC_SORT_MERGE_DUP), FALSE);
 			EnableWindow(GetDlgItem(hwnd, IDC_SORT_REMOVE_DUP), FALSE);
 			EnableWindow(GetDlgItem(hwnd, IDC_SORT_REMOVE_UNIQUE), FALSE);
+			EnableWindow(GetDlgItem(hwnd, IDC_SORT_COUNT_DUP), FALSE);
 			EnableWindow(GetDlgItem(hwnd, IDC_SORT_IGNORE_CASE), FALSE);
 			EnableWindow(GetDlgItem(hwnd, IDC_SORT_LOGICAL_NUMBER), FALSE);
 			EnableWindow(GetDlgItem(hwnd, IDC_SORT_GROUPBY_FILE_TYPE), FALSE);
@@ -6798,6 +11874,10 @@ static INT_PTR CALLBACK EditSortDlgProc(HWND hwnd, UINT umsg, WPARAM wParam, LPA
 			CheckDlgButton(hwnd, IDC_SORT_REMOVE_UNIQUE, BST_CHECKED);
 		}
 
+		if (iSortFlags & EditSortFlag_CountDuplicate) {
+			CheckDlgButton(hwnd, IDC_SORT_COUNT_DUP, BST_CHECKED);
+		}
+
 		if (iSortFlags & EditSortFlag_IgnoreCase) {
 			CheckDlgButton(hwnd, IDC_SORT_IGNORE_CASE, BST_CHECKED);
 		}
@@ -6843,6 +11923,9 @@ static INT_PTR CALLBACK EditSortDlgProc(HWND hwnd, UINT umsg, WPARAM wParam, LPA
 			if (IsButtonChecked(hwnd, IDC_SORT_REMOVE_UNIQUE)) {
 				iSortFlags |= EditSortFlag_RemoveUnique;
 			}
+			if (IsButtonChecked(hwnd, IDC_SORT_COUNT_DUP)) {
+				iSortFlags |= EditSortFlag_CountDuplicate;
+			}
 			if (IsButtonChecked(hwnd, IDC_SORT_IGNORE_CASE)) {
 				iSortFlags |= EditSortFlag_IgnoreCase;
 			}
@@ -6870,6 +11953,7 @@ static INT_PTR CALLBACK EditSortDlgProc(HWND hwnd, UINT umsg, WPARAM wParam, LPA
 			EnableWindow(GetDlgItem(hwnd, IDC_SORT_MERGE_DUP), !IsButtonChecked(hwnd, IDC_SORT_REMOVE_UNIQUE));
 			EnableWindow(GetDlgItem(hwnd, IDC_SORT_REMOVE_DUP), TRUE);
 			EnableWindow(GetDlgItem(hwnd, IDC_SORT_REMOVE_UNIQUE), TRUE);
+			EnableWindow(GetDlgItem(hwnd, IDC_SORT_COUNT_DUP), TRUE);
 			EnableWindow(GetDlgItem(hwnd, IDC_SORT_IGNORE_CASE), TRUE);
 			EnableWindow(GetDlgItem(hwnd, IDC_SORT_LOGICAL_NUMBER), TRUE);
 			EnableWindow(GetDlgItem(hwnd, IDC_SORT_GROUPBY_FILE_TYPE), TRUE);
@@ -6879,6 +11963,7 @@ static INT_PTR CALLBACK EditSortDlgProc(HWND hwnd, UINT umsg, WPARAM wParam, LPA
 			EnableWindow(GetDlgItem(hwnd, IDC_SORT_MERGE_DUP), FALSE);
 			EnableWindow(GetDlgItem(hwnd, IDC_SORT_REMOVE_DUP), FALSE);
 			EnableWindow(GetDlgItem(hwnd, IDC_SORT_REMOVE_UNIQUE), FALSE);
+			EnableWindow(GetDlgItem(hwnd, IDC_SORT_COUNT_DUP), FALSE);
 			EnableWindow(GetDlgItem(hwnd, IDC_SORT_IGNORE_CASE), FALSE);
 			EnableWindow(GetDlgItem(hwnd, IDC_SORT_LOGICAL_NUMBER), FALSE);
 			EnableWindow(GetDlgItem(hwnd, IDC_SORT_GROUPBY_FILE_TYPE), FALSE);
@@ -7102,6 +12187,111 @@ char *EditGetStringAroundCaret(LPCSTR delimiters) noexcept {
 
 extern bool bOpenFolderWithMatepath;
 
+// probing path on unreachable network server blocks for the SMB timeout, so network paths are probed
+// on a separate thread with short timeout, servers timed out are remembered to fail later probes at once.
+#define OPEN_SELECTION_PROBE_TIMEOUT		1500
+#define OPEN_SELECTION_SERVER_CACHE_SIZE	8
+#define OPEN_SELECTION_SERVER_EXPIRE_TIME	(60*1000)
+
+struct OpenSelectionProbe {
+	LONG refCount;
+	DWORD dwAttributes;
+	WCHAR path[MAX_PATH*2];
+
+	void Release() noexcept {
+		if (InterlockedDecrement(&refCount) == 0) {
+			GlobalFree(this);
+		}
+	}
+};
+
+struct UnreachableServer {
+	ULONGLONG expireTime;
+	WCHAR name[MAX_PATH];
+};
+
+static UnreachableServer unreachableServers[OPEN_SELECTION_SERVER_CACHE_SIZE];
+static UINT unreachableServerNext = 0;
+
+static DWORD WINAPI OpenSelectionProbeThread(LPVOID lpParam) noexcept {
+	OpenSelectionProbe *probe = static_cast<OpenSelectionProbe *>(lpParam);
+	probe->dwAttributes = GetFileAttributes(probe->path);
+	probe->Release();
+	return 0;
+}
+
+// get server name for UNC path, or drive for mapped network drive.
+static bool OpenSelectionGetServer(LPCWSTR path, WCHAR (&server)[MAX_PATH]) noexcept {
+	WCHAR fullPath[MAX_PATH*2];
+	if (!GetFullPathName(path, COUNTOF(fullPath), fullPath, nullptr)) {
+		return false;
+	}
+	if (fullPath[0] == L'\\' && fullPath[1] == L'\\') {
+		LPCWSTR name = fullPath + 2;
+		if (StrStartsWith(name, L"?\\UNC\\")) {
+			name += CSTRLEN(L"?\\UNC\\");
+		} else if (name[0] == L'?' || name[0] == L'.') {
+			// local device path
+			return false;
+		}
+		LPCWSTR end = StrChr(name, L'\\');
+		const int length = (end == nullptr) ? lstrlen(name) : static_cast<int>(end - name);
+		lstrcpyn(server, name, min<int>(length + 1, MAX_PATH));
+		return length != 0;
+	}
+	if (IsAlpha(fullPath[0]) && fullPath[1] == L':') {
+		WCHAR drive[] = L"?:\\";
+		drive[0] = fullPath[0];
+		if (GetDriveType(drive) == DRIVE_REMOTE) {
+			drive[2] = L'\0';
+			lstrcpy(server, drive);
+			return true;
+		}
+	}
+	return false;
+}
+
+static DWORD EditOpenSelectionGetAttributes(LPCWSTR path) noexcept {
+	WCHAR server[MAX_PATH];
+	if (!OpenSelectionGetServer(path, server)) {
+		return GetFileAttributes(path);
+	}
+
+	const ULONGLONG now = GetTickCount64();
+	for (const UnreachableServer &entry : unreachableServers) {
+		if (entry.expireTime > now && StrCaseEqual(entry.name, server)) {
+			return INVALID_FILE_ATTRIBUTES;
+		}
+	}
+
+	// probe is shared with the thread, freed by the last one.
+	OpenSelectionProbe *probe = static_cast<OpenSelectionProbe *>(GlobalAlloc(GPTR, sizeof(OpenSelectionProbe)));
+	if (probe == nullptr) {
+		return GetFileAttributes(path);
+	}
+	probe->refCount = 2;
+	probe->dwAttributes = INVALID_FILE_ATTRIBUTES;
+	lstrcpyn(probe->path, path, COUNTOF(probe->path));
+	HANDLE hThread = CreateThread(nullptr, 0, OpenSelectionProbeThread, probe, 0, nullptr);
+	if (hThread == nullptr) {
+		GlobalFree(probe);
+		return GetFileAttributes(path);
+	}
+
+	DWORD dwAttributes = INVALID_FILE_ATTRIBUTES;
+	if (WaitForSingleObject(hThread, OPEN_SELECTION_PROBE_TIMEOUT) == WAIT_OBJECT_0) {
+		dwAttributes = probe->dwAttributes;
+	} else {
+		UnreachableServer &entry = unreachableServers[unreachableServerNext];
+		unreachableServerNext = (unreachableServerNext + 1) % OPEN_SELECTION_SERVER_CACHE_SIZE;
+		entry.expireTime = now + OPEN_SELECTION_SERVER_EXPIRE_TIME;
+		lstrcpy(entry.name, server);
+	}
+	CloseHandle(hThread);
+	probe->Release();
+	return dwAttributes;
+}
+
 static DWORD EditOpenSelectionCheckFile(LPCWSTR link, wchar_t (&path)[MAX_PATH*2], LPWSTR wchDirectory) noexcept {
 	if (StrStartsWith(link, L"//")) {
 		// issue #454, treat as link
@@ -7110,21 +12300,21 @@ static DWORD EditOpenSelectionCheckFile(LPCWSTR link, wchar_t (&path)[MAX_PATH*2
 		return 0;
 	}
 
-	DWORD dwAttributes = GetFileAttributes(link);
+	DWORD dwAttributes = EditOpenSelectionGetAttributes(link);
 	constexpr DWORD cchFilePath = COUNTOF(path);
 	if (dwAttributes == INVALID_FILE_ATTRIBUTES) {
 		// handle variables expanded into absolute path, avoid touch percent encoded URL
 		if (link[0] == '%' && ExpandEnvironmentStringsEx(link, path)) {
-			dwAttributes = GetFileAttributes(path);
+			dwAttributes = EditOpenSelectionGetAttributes(path);
 		}
 		if (dwAttributes == INVALID_FILE_ATTRIBUTES && StrNotEmpty(szCurFile)) {
 			lstrcpy(wchDirectory, szCurFile);
 			PathRemoveFileSpec(wchDirectory);
 			PathCombine(path, wchDirectory, link);
-			dwAttributes = GetFileAttributes(path);
+			dwAttributes = EditOpenSelectionGetAttributes(path);
 		}
 		if (dwAttributes == INVALID_FILE_ATTRIBUTES && GetFullPathName(link, cchFilePath, path, nullptr)) {
-			dwAttributes = GetFileAttributes(path);
+			dwAttributes = EditOpenSelectionGetAttributes(path);
 		}
 	} else {
 		if (!GetFullPathName(link, cchFilePath, path, nullptr)) {
@@ -7370,7 +12560,7 @@ extern bool fWordWrapG;
 extern int iWordWrapMode;
 extern int iLongLinesLimitG;
 
-void EditFileVars::Init(LPCSTR lpData, DWORD cbData) noexcept {
+void EditFileVars::Init(LPCSTR lpData, size_t cbData) noexcept {
 	memset(this, 0, sizeof(EditFileVars));
 	// see Apply() for other Tab settings.
 	tabSettings.schemeUseGlobalTabSettings = true;
@@ -7383,7 +12573,7 @@ void EditFileVars::Init(LPCSTR lpData, DWORD cbData) noexcept {
 	}
 
 	char tch[512 + 1];
-	const DWORD len = min<DWORD>(cbData, sizeof(tch) - 1);
+	const size_t len = min<size_t>(cbData, sizeof(tch) - 1);
 	memcpy(tch, lpData, len);
 	tch[len] = '\0';
 	const bool utf8Sig = IsUTF8Signature(tch);
@@ -7848,43 +13038,16 @@ void FoldToggleAll(FOLD_ACTION action) noexcept {
 
 void FoldToggleLevel(int lev, FOLD_ACTION action) noexcept {
 	SciCall_ColouriseAll();
-	const Sci_Line lineCount = SciCall_GetLineCount();
-	Sci_Line line = 0;
-
 	SendMessage(hwndEdit, WM_SETREDRAW, FALSE, 0);
 #if 0
 	StopWatch watch;
 	watch.Start();
 #endif
+	int foldAction = static_cast<int>(action);
 	if (pLexCurrent->lexerAttr & LexerAttr_IndentBasedFolding) {
-		FoldLevelStack levelStack{};
-		++lev;
-		while (line < lineCount) {
-			int level = SciCall_GetFoldLevel(line);
-			if (level & SC_FOLDLEVELHEADERFLAG) {
-				level &= SC_FOLDLEVELNUMBERMASK;
-				levelStack.Push(level);
-				if (lev == levelStack.levelCount) {
-					action = FoldToggleNode(line, action);
-					line = SciCall_GetLastChildEx(line, level);
-				}
-			}
-			++line;
-		}
-	} else {
-		lev += SC_FOLDLEVELBASE;
-		while (line < lineCount) {
-			int level = SciCall_GetFoldLevel(line);
-			if (level & SC_FOLDLEVELHEADERFLAG) {
-				level &= SC_FOLDLEVELNUMBERMASK;
-				if (lev == level) {
-					action = FoldToggleNode(line, action);
-					line = SciCall_GetLastChildEx(line, level);
-				}
-			}
-			++line;
-		}
+		foldAction |= SC_FOLDACTION_NESTING_DEPTH;
 	}
+	SciCall_FoldAtLevel(foldAction, lev);
 
 #if 0
 	watch.Stop();
@@ -8194,3 +13357,430 @@ void EditGotoBlock(int menu) noexcept {
 		EditJumpTo(iLine + 1, column + 1);
 	}
 }
+
+//=============================================================================
+//
+// compare current document with a file: lines are hashed (ignoring line endings),
+// line hashes are compared with linear space O(ND) Myers algorithm on background thread.
+// changed and inserted document lines are marked with line background, deleted lines
+// are marked by underlining document line before them.
+//
+#define NP2_COMPARE_MAX_COST		4096	// edit cost for a middle snake before range is treated as replaced
+#define NP2_COMPARE_CANCEL_CHECK	64
+
+struct CompareHunk {
+	size_t fileLine;
+	size_t fileCount;
+	size_t docLine;
+	size_t docCount;
+};
+
+struct CompareWorker {
+	BackgroundWorker worker;
+	WCHAR szFile[MAX_PATH];
+	uint64_t *docHashes;
+	size_t docLines;
+	Sci_Position docLength;	// document is only marked when not changed
+	uint64_t *fileHashes;
+	size_t fileLines;
+	CompareHunk *hunks;
+	size_t hunkCount;
+	size_t hunkAllocated;
+	ptrdiff_t *forward;		// Myers V arrays
+	ptrdiff_t *backward;
+	bool success;
+};
+
+static CompareWorker compareWorker;
+
+// hash text of each line, returns line count, the array is allocated with NP2HeapAlloc().
+static uint64_t *EditHashTextLines(const char *lpData, size_t cbData, size_t *lineCount) noexcept {
+	EditFileIOStatus status{};
+	EditDetectEOLMode(lpData, cbData, status);
+	const size_t count = status.totalLineCount;
+	Sci_Position * const lineStarts = static_cast<Sci_Position *>(NP2HeapAlloc((count + 1)*sizeof(Sci_Position)));
+	uint64_t * const hashes = static_cast<uint64_t *>(NP2HeapAlloc(count*sizeof(uint64_t)));
+	if (lineStarts == nullptr || hashes == nullptr) {
+		NP2HeapFree(lineStarts);
+		NP2HeapFree(hashes);
+		return nullptr;
+	}
+
+	EditFindLineStarts(lpData, 0, cbData, lineStarts + 1);
+	lineStarts[count] = cbData;
+	for (size_t line = 0; line < count; line++) {
+		const size_t start = lineStarts[line];
+		size_t end = lineStarts[line + 1];
+		if (end > start && lpData[end - 1] == '\n') {
+			--end;
+		}
+		if (end > start && lpData[end - 1] == '\r') {
+			--end;
+		}
+		hashes[line] = HashLineText(lpData + start, end - start);
+	}
+	NP2HeapFree(lineStarts);
+	*lineCount = count;
+	return hashes;
+}
+
+static bool CompareAddHunk(CompareWorker *state, size_t fileLine, size_t fileCount, size_t docLine, size_t docCount) noexcept {
+	if (state->hunkCount != 0) {
+		// merge with adjacent hunk
+		CompareHunk &last = state->hunks[state->hunkCount - 1];
+		if (last.fileLine + last.fileCount == fileLine && last.docLine + last.docCount == docLine) {
+			last.fileCount += fileCount;
+			last.docCount += docCount;
+			return true;
+		}
+	}
+	if (state->hunkCount == state->hunkAllocated) {
+		const size_t allocated = max<size_t>(state->hunkAllocated*2, 1024);
+		CompareHunk * const hunks = static_cast<CompareHunk *>((state->hunks == nullptr)
+			? NP2HeapAlloc(allocated*sizeof(CompareHunk))
+			: NP2HeapReAlloc(state->hunks, allocated*sizeof(CompareHunk)));
+		if (hunks == nullptr) {
+			return false;
+		}
+		state->hunks = hunks;
+		state->hunkAllocated = allocated;
+	}
+	state->hunks[state->hunkCount++] = { fileLine, fileCount, docLine, docCount };
+	return true;
+}
+
+// find middle snake of shortest edit script for file[fileLo, fileHi) and doc[docLo, docHi],
+// returns false when edit cost exceeds NP2_COMPARE_MAX_COST.
+static bool CompareBisect(CompareWorker *state, size_t fileLo, size_t fileHi, size_t docLo, size_t docHi, size_t *fileMid, size_t *docMid) noexcept {
+	const uint64_t * const a = state->fileHashes + fileLo;
+	const uint64_t * const b = state->docHashes + docLo;
+	const ptrdiff_t n = fileHi - fileLo;
+	const ptrdiff_t m = docHi - docLo;
+	const ptrdiff_t maxCost = min<ptrdiff_t>((n + m + 1)/2, NP2_COMPARE_MAX_COST);
+	const ptrdiff_t offset = maxCost + 1;
+	const ptrdiff_t length = 2*maxCost + 3;
+	ptrdiff_t * const v1 = state->forward;
+	ptrdiff_t * const v2 = state->backward;
+	for (ptrdiff_t i = 0; i < length; i++) {
+		v1[i] = -1;
+		v2[i] = -1;
+	}
+	v1[offset + 1] = 0;
+	v2[offset + 1] = 0;
+	const ptrdiff_t delta = n - m;
+	const bool front = (delta & 1) != 0;
+	ptrdiff_t k1start = 0;
+	ptrdiff_t k1end = 0;
+	ptrdiff_t k2start = 0;
+	ptrdiff_t k2end = 0;
+	for (ptrdiff_t d = 0; d < maxCost; d++) {
+		if ((d % NP2_COMPARE_CANCEL_CHECK) == 0 && !state->worker.Continue()) {
+			return false;
+		}
+		for (ptrdiff_t k1 = -d + k1start; k1 <= d - k1end; k1 += 2) {
+			const ptrdiff_t k1Offset = offset + k1;
+			ptrdiff_t x1;
+			if (k1 == -d || (k1 != d && v1[k1Offset - 1] < v1[k1Offset + 1])) {
+				x1 = v1[k1Offset + 1];
+			} else {
+				x1 = v1[k1Offset - 1] + 1;
+			}
+			ptrdiff_t y1 = x1 - k1;
+			while (x1 < n && y1 < m && a[x1] == b[y1]) {
+				++x1;
+				++y1;
+			}
+			v1[k1Offset] = x1;
+			if (x1 > n) {
+				k1end += 2;
+			} else if (y1 > m) {
+				k1start += 2;
+			} else if (front) {
+				const ptrdiff_t k2Offset = offset + delta - k1;
+				if (k2Offset >= 0 && k2Offset < length && v2[k2Offset] != -1) {
+					if (x1 >= n - v2[k2Offset]) {
+						*fileMid = fileLo + x1;
+						*docMid = docLo + y1;
+						return true;
+					}
+				}
+			}
+		}
+		for (ptrdiff_t k2 = -d + k2start; k2 <= d - k2end; k2 += 2) {
+			const ptrdiff_t k2Offset = offset + k2;
+			ptrdiff_t x2;
+			if (k2 == -d || (k2 != d && v2[k2Offset - 1] < v2[k2Offset + 1])) {
+				x2 = v2[k2Offset + 1];
+			} else {
+				x2 = v2[k2Offset - 1] + 1;
+			}
+			ptrdiff_t y2 = x2 - k2;
+			while (x2 < n && y2 < m && a[n - x2 - 1] == b[m - y2 - 1]) {
+				++x2;
+				++y2;
+			}
+			v2[k2Offset] = x2;
+			if (x2 > n) {
+				k2end += 2;
+			} else if (y2 > m) {
+				k2start += 2;
+			} else if (!front) {
+				const ptrdiff_t k1Offset = offset + delta - k2;
+				if (k1Offset >= 0 && k1Offset < length && v1[k1Offset] != -1) {
+					const ptrdiff_t x1 = v1[k1Offset];
+					if (x1 >= n - x2) {
+						*fileMid = fileLo + x1;
+						*docMid = docLo + x1 - (k1Offset - offset);
+						return true;
+					}
+				}
+			}
+		}
+	}
+	return false;
+}
+
+static bool CompareRange(CompareWorker *state, size_t fileLo, size_t fileHi, size_t docLo, size_t docHi) noexcept {
+	const uint64_t * const a = state->fileHashes;
+	const uint64_t * const b = state->docHashes;
+	while (true) {
+		// skip common prefix and suffix
+		while (fileLo < fileHi && docLo < docHi && a[fileLo] == b[docLo]) {
+			++fileLo;
+			++docLo;
+		}
+		while (fileLo < fileHi && docLo < docHi && a[fileHi - 1] == b[docHi - 1]) {
+			--fileHi;
+			--docHi;
+		}
+		if (fileLo == fileHi || docLo == docHi) {
+			if (fileLo == fileHi && docLo == docHi) {
+				return true;
+			}
+			return CompareAddHunk(state, fileLo, fileHi - fileLo, docLo, docHi - docLo);
+		}
+
+		size_t fileMid;
+		size_t docMid;
+		if (!CompareBisect(state, fileLo, fileHi, docLo, docHi, &fileMid, &docMid)) {
+			return state->worker.Continue() && CompareAddHunk(state, fileLo, fileHi - fileLo, docLo, docHi - docLo);
+		}
+		// recurse on first half, loop on second half
+		if (!CompareRange(state, fileLo, fileMid, docLo, docMid)) {
+			return false;
+		}
+		fileLo = fileMid;
+		docLo = docMid;
+	}
+}
+
+static DWORD WINAPI EditCompareThread(LPVOID lpParam) noexcept {
+	CompareWorker * const state = static_cast<CompareWorker *>(lpParam);
+	HANDLE hFile = CreateFile(state->szFile, GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE,
+		nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+	if (hFile == INVALID_HANDLE_VALUE) {
+		PostMessage(state->worker.hwnd, APPM_COMPARE_DONE, 0, 0);
+		return 0;
+	}
+
+	LARGE_INTEGER fileSize;
+	fileSize.QuadPart = 0;
+	char *lpData = nullptr;
+	size_t cbData = 0;
+	if (GetFileSizeEx(hFile, &fileSize) && static_cast<ULONGLONG>(fileSize.QuadPart) < SIZE_MAX/2) {
+		lpData = static_cast<char *>(NP2HeapAlloc(static_cast<size_t>(fileSize.QuadPart) + NP2_ENCODING_DETECTION_PADDING));
+		if (lpData != nullptr) {
+			// file unchanged since loaded is served from retained bytes
+			BY_HANDLE_FILE_INFORMATION fileInfo;
+			const bool retained = GetFileInformationByHandle(hFile, &fileInfo)
+				&& EditReadRetainedFile(fileInfo, lpData, static_cast<size_t>(fileSize.QuadPart), &cbData);
+			if (!retained && !EditReadFile(hFile, lpData, static_cast<size_t>(fileSize.QuadPart), &cbData)) {
+				NP2HeapFree(lpData);
+				lpData = nullptr;
+			}
+		}
+	}
+	CloseHandle(hFile);
+
+	if (lpData != nullptr) {
+		const char *text = lpData;
+		size_t length = cbData;
+		char *converted = nullptr;
+		if (length >= 3 && memcmp(text, "\xEF\xBB\xBF", 3) == 0) {
+			text += 3;
+			length -= 3;
+		} else if (length >= 2 && length < INT_MAX && text[0] == '\xFF' && text[1] == '\xFE') {
+			// UTF-16LE with BOM
+			const int cchText = static_cast<int>(length/sizeof(WCHAR)) - 1;
+			LPCWSTR lpText = reinterpret_cast<LPCWSTR>(text) + 1;
+			const int cbConverted = WideCharToMultiByte(CP_UTF8, 0, lpText, cchText, nullptr, 0, nullptr, nullptr);
+			converted = static_cast<char *>(NP2HeapAlloc(cbConverted + NP2_ENCODING_DETECTION_PADDING));
+			if (converted != nullptr) {
+				length = WideCharToMultiByte(CP_UTF8, 0, lpText, cchText, converted, cbConverted, nullptr, nullptr);
+				text = converted;
+			}
+		}
+		if (state->worker.Continue()) {
+			state->fileHashes = EditHashTextLines(text, length, &state->fileLines);
+		}
+		NP2HeapFree(converted);
+		NP2HeapFree(lpData);
+	}
+
+	if (state->fileHashes != nullptr && state->worker.Continue()) {
+		const size_t length = 2*NP2_COMPARE_MAX_COST + 3;
+		state->forward = static_cast<ptrdiff_t *>(NP2HeapAlloc(2*length*sizeof(ptrdiff_t)));
+		if (state->forward != nullptr) {
+			state->backward = state->forward + length;
+			state->success = CompareRange(state, 0, state->fileLines, 0, state->docLines);
+			NP2HeapFree(state->forward);
+			state->forward = nullptr;
+			state->backward = nullptr;
+		}
+	}
+	if (state->worker.Continue()) {
+		PostMessage(state->worker.hwnd, APPM_COMPARE_DONE, 0, 0);
+	}
+	return 0;
+}
+
+static void EditCompareFreeResult() noexcept {
+	CompareWorker &state = compareWorker;
+	NP2HeapFree(state.docHashes);
+	NP2HeapFree(state.fileHashes);
+	NP2HeapFree(state.hunks);
+	state.docHashes = nullptr;
+	state.fileHashes = nullptr;
+	state.hunks = nullptr;
+	state.hunkCount = 0;
+	state.hunkAllocated = 0;
+	state.success = false;
+}
+
+void EditCompareCancel() noexcept {
+	CompareWorker &state = compareWorker;
+	if (state.worker.eventCancel != nullptr) {
+		// worker thread only posts message, wait without dispatching messages.
+		SetEvent(state.worker.eventCancel);
+		HANDLE hThread = InterlockedExchangePointer(&state.worker.workerThread, nullptr);
+		if (hThread != nullptr) {
+			WaitForSingleObject(hThread, INFINITE);
+			CloseHandle(hThread);
+			EndWaitCursor();
+		}
+		ResetEvent(state.worker.eventCancel);
+		MSG msg;
+		PeekMessage(&msg, hwndMain, APPM_COMPARE_DONE, APPM_COMPARE_DONE, PM_REMOVE);
+		EditCompareFreeResult();
+	}
+}
+
+void EditCompareClear() noexcept {
+	EditCompareCancel();
+	SciCall_MarkerDeleteAll(MarkerNumber_DiffInserted);
+	SciCall_MarkerDeleteAll(MarkerNumber_DiffChanged);
+	SciCall_MarkerDeleteAll(MarkerNumber_DiffDeleted);
+}
+
+void EditCompareFile(LPCWSTR pszFile) noexcept {
+	CompareWorker &state = compareWorker;
+	if (state.worker.eventCancel == nullptr) {
+		state.worker.Init(hwndMain);
+	}
+	EditCompareClear();
+
+	// document lines are hashed on current thread, as the text may be changed while comparing.
+	const Sci_Position length = SciCall_GetLength();
+	const char *text = SciCall_GetCharacterPointer();
+	state.docHashes = EditHashTextLines(text, length, &state.docLines);
+	if (state.docHashes == nullptr) {
+		return;
+	}
+	state.docLength = length;
+	lstrcpyn(state.szFile, pszFile, COUNTOF(state.szFile));
+	BeginWaitCursor();
+	state.worker.workerThread = CreateThread(nullptr, 0, EditCompareThread, &state, 0, nullptr);
+}
+
+static void EditCompareShowLine(Sci_Line line) noexcept {
+	if (line >= 0) {
+		editMarkAll.ignoreSelectionUpdate = true;
+		SciCall_EnsureVisible(line);
+		SciCall_GotoLine(line);
+		SciCall_SetYCaretPolicy(CARET_SLOP | CARET_STRICT | CARET_EVEN, 10);
+		SciCall_ScrollCaret();
+		SciCall_SetYCaretPolicy(CARET_EVEN, 0);
+	}
+}
+
+void EditCompareApply() noexcept {
+	CompareWorker &state = compareWorker;
+	HANDLE hThread = InterlockedExchangePointer(&state.worker.workerThread, nullptr);
+	if (hThread != nullptr) {
+		WaitForSingleObject(hThread, INFINITE);
+		CloseHandle(hThread);
+	}
+	EndWaitCursor();
+	if (!state.success || state.docLength != SciCall_GetLength()) {
+		EditCompareFreeResult();
+		MsgBoxWarn(MB_OK, IDS_COMPARE_FAILED, state.szFile);
+		return;
+	}
+
+	if (state.hunkCount == 0) {
+		EditCompareFreeResult();
+		MsgBoxInfo(MB_OK, IDS_COMPARE_IDENTICAL, state.szFile);
+		return;
+	}
+
+	SciCall_MarkerDefine(MarkerNumber_DiffInserted, SC_MARK_BACKGROUND);
+	SciCall_MarkerSetLayer(MarkerNumber_DiffInserted, SC_LAYER_UNDER_TEXT);
+	SciCall_MarkerSetBackTranslucent(MarkerNumber_DiffInserted, ColorAlpha(RGB(0x00, 0xC0, 0x00), 0x40));
+	SciCall_MarkerDefine(MarkerNumber_DiffChanged, SC_MARK_BACKGROUND);
+	SciCall_MarkerSetLayer(MarkerNumber_DiffChanged, SC_LAYER_UNDER_TEXT);
+	SciCall_MarkerSetBackTranslucent(MarkerNumber_DiffChanged, ColorAlpha(RGB(0xFF, 0xC0, 0x00), 0x40));
+	SciCall_MarkerDefine(MarkerNumber_DiffDeleted, SC_MARK_UNDERLINE);
+	SciCall_MarkerSetBackTranslucent(MarkerNumber_DiffDeleted, ColorAlpha(RGB(0xFF, 0x00, 0x00), SC_ALPHA_OPAQUE));
+
+	for (size_t i = 0; i < state.hunkCount; i++) {
+		const CompareHunk &hunk = state.hunks[i];
+		if (hunk.docCount == 0) {
+			const Sci_Line line = (hunk.docLine == 0) ? 0 : static_cast<Sci_Line>(hunk.docLine - 1);
+			SciCall_MarkerAdd(line, MarkerNumber_DiffDeleted);
+		} else {
+			const int marker = (hunk.fileCount == 0) ? MarkerNumber_DiffInserted : MarkerNumber_DiffChanged;
+			const Sci_Line end = static_cast<Sci_Line>(hunk.docLine + hunk.docCount);
+			for (Sci_Line line = static_cast<Sci_Line>(hunk.docLine); line < end; line++) {
+				SciCall_MarkerAdd(line, marker);
+			}
+		}
+	}
+	EditCompareFreeResult();
+	EditCompareShowLine(SciCall_MarkerNext(0, MarkerBitmask_Diff));
+}
+
+void EditCompareGoto(bool next) noexcept {
+	// changed or inserted lines in a hunk are treated as one difference
+	Sci_Line line = SciCall_LineFromPosition(SciCall_GetCurrentPos());
+	if (next) {
+		if (SciCall_MarkerGet(line) & MarkerBitmask_DiffBlock) {
+			while (SciCall_MarkerGet(line + 1) & MarkerBitmask_DiffBlock) {
+				++line;
+			}
+		}
+		line = SciCall_MarkerNext(line + 1, MarkerBitmask_Diff);
+	} else {
+		if (SciCall_MarkerGet(line) & MarkerBitmask_DiffBlock) {
+			while (line > 0 && (SciCall_MarkerGet(line - 1) & MarkerBitmask_DiffBlock)) {
+				--line;
+			}
+		}
+		line = SciCall_MarkerPrevious(line - 1, MarkerBitmask_Diff);
+		if (line > 0 && (SciCall_MarkerGet(line) & MarkerBitmask_DiffBlock)) {
+			while (line > 0 && (SciCall_MarkerGet(line - 1) & MarkerBitmask_DiffBlock)) {
+				--line;
+			}
+		}
+	}
+	EditCompareShowLine(line);
+}
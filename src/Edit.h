@@ -30,7 +30,8 @@
 #define NP2_MarkAllBookmark		0x00002000
 #define NP2_MarkAllSelectAll	0x00004000
 #define NP2_FromFindAll			0x00008000
-#define NP2_SearchForLineEnd	0x00010000
+#define NP2_MarkAllListResults	0x00010000
+#define NP2_SearchForLineEnd	0x00020000
 
 enum {
 	FindReplaceOption_None = 0,
@@ -80,6 +81,7 @@ enum EditSortFlag {
 	EditSortFlag_MergeDuplicate = 128,
 	EditSortFlag_RemoveDuplicate = 256,
 	EditSortFlag_RemoveUnique = 512,
+	EditSortFlag_CountDuplicate = 1024,
 };
 
 // wrap indent
@@ -117,7 +119,7 @@ enum {
 
 void	Edit_ReleaseResources() noexcept;
 void	EditCreate(HWND hwndParent) noexcept;
-void	EditSetNewText(LPCSTR lpstrText, DWORD cbText, size_t lineCount) noexcept;
+void	EditSetNewText(LPCSTR lpstrText, size_t cbText, size_t lineCount, const Sci_Position *lineStarts = nullptr) noexcept;
 
 static inline void EditSetEmptyText() noexcept{
 	EditSetNewText("", 0, 1);
@@ -140,9 +142,31 @@ constexpr int GetSettingsEOLMode(int mode) noexcept {
 }
 
 struct EditFileIOStatus;
-void 	EditDetectEOLMode(LPCSTR lpData, DWORD cbData, EditFileIOStatus &status) noexcept;
+void 	EditDetectEOLMode(LPCSTR lpData, size_t cbData, EditFileIOStatus &status) noexcept;
 bool	EditLoadFile(LPWSTR pszFile, EditFileIOStatus &status) noexcept;
 bool	EditSaveFile(HWND hwnd, LPCWSTR pszFile, int saveFlag, EditFileIOStatus &status) noexcept;
+void	EditVerifyUTF8Async(LPCWSTR pszFile) noexcept;
+void	EditVerifyUTF8Cancel() noexcept;
+bool	EditAppendFileTail(LPCWSTR pszFile) noexcept;
+void	EditReleaseRetainedFile() noexcept;
+void	EditInPlaceSaveModified(int modificationType, Sci_Position position, Sci_Position length, Sci_Position lengthBefore) noexcept;
+// read-only viewer for file too large to be loaded
+bool	EditViewerOpen(HANDLE hFile, LONGLONG fileSize, bool hexView, EditFileIOStatus &status) noexcept;
+void	EditViewerClose() noexcept;
+bool	EditViewerActive() noexcept;
+Sci_Line EditViewerFirstLine() noexcept;
+Sci_Line EditViewerLineCount() noexcept;
+void	EditViewerMovePart(bool next) noexcept;
+bool	EditViewerGotoLine(Sci_Line iNewLine, Sci_Position iNewCol) noexcept;
+// compare current document with a file
+void	EditCompareFile(LPCWSTR pszFile) noexcept;
+void	EditCompareApply() noexcept;
+void	EditCompareCancel() noexcept;
+void	EditCompareClear() noexcept;
+void	EditCompareGoto(bool next) noexcept;
+// record and column index for CSV document
+void	EditCsvIndexStart(int option) noexcept;
+void	EditCsvIndexStop() noexcept;
 
 void	EditReplaceMainSelection(Sci_Position cchText, LPCSTR pszText) noexcept;
 
@@ -201,7 +225,15 @@ void	EditSaveSelectionAsFindText(EDITFINDREPLACE *lpefr, int menu, bool findSele
 HWND	EditFindReplaceDlg(HWND hwnd, EDITFINDREPLACE *lpefr, bool bReplace) noexcept;
 void	EditFindNext(const EDITFINDREPLACE *lpefr, bool fExtendSelection) noexcept;
 void	EditFindPrev(const EDITFINDREPLACE *lpefr, bool fExtendSelection) noexcept;
-void	EditFindAll(const EDITFINDREPLACE *lpefr, bool selectAll) noexcept;
+void	EditFindAll(const EDITFINDREPLACE *lpefr, bool selectAll, bool listResults) noexcept;
+HWND	EditFindAllResultsDlg(HWND hwnd) noexcept;
+void	EditFindAllResults_Clear() noexcept;
+void	EditFindInFiles(const EDITFINDREPLACE *lpefr) noexcept;
+HWND	EditFindInFilesDlg(HWND hwnd) noexcept;
+void	EditFindAsYouType(HWND hwndDlg) noexcept;
+void	EditFindAsYouTypeStop(bool restoreSelection) noexcept;
+void	EditFindAsYouTypeUpdate(WPARAM wParam, LPARAM lParam) noexcept;
+bool	EditFindAsYouTypeGetCount(Sci_Position &matchCount, bool &pending) noexcept;
 void	EditReplace(HWND hwnd, const EDITFINDREPLACE *lpefr) noexcept;
 enum EditReplaceAllFlag {
 	EditReplaceAllFlag_None,
@@ -212,6 +244,7 @@ enum EditReplaceAllFlag {
 void	EditReplaceAll(HWND hwnd, const EDITFINDREPLACE *lpefr) noexcept;
 void	EditReplaceAllInSelection(HWND hwnd, const EDITFINDREPLACE *lpefr, EditReplaceAllFlag flag = EditReplaceAllFlag_None) noexcept;
 bool	EditLineNumDlg(HWND hwnd) noexcept;
+bool	EditGotoSymbolDlg(HWND hwnd) noexcept;
 void	EditModifyLinesDlg(HWND hwnd) noexcept;
 void	EditEncloseSelectionDlg(HWND hwnd) noexcept;
 void	EditInsertTagDlg(HWND hwnd) noexcept;
@@ -236,10 +269,14 @@ void EditOpenSelection(OpenSelectionType type);
 // in Bridge.cpp
 bool	EditPrint(HWND hwnd, LPCWSTR pszDocTitle, BOOL bDefault) noexcept;
 void	EditPrintSetup(HWND hwnd) noexcept;
+void	EditPrintInvalidatePages() noexcept;
 void	EditFormatCode(int menu) noexcept;
 
 enum {
 	MarkerNumber_Bookmark = 0,
+	MarkerNumber_DiffInserted = 1,
+	MarkerNumber_DiffChanged = 2,
+	MarkerNumber_DiffDeleted = 3,
 
 	// [0, INDICATOR_CONTAINER) are reserved for lexer.
 	IndicatorNumber_MarkOccurrence = INDICATOR_CONTAINER + 0,
@@ -252,6 +289,8 @@ enum {
 	MarginNumber_CodeFolding = 2,
 
 	MarkerBitmask_Bookmark = 1 << MarkerNumber_Bookmark,
+	MarkerBitmask_DiffBlock = (1 << MarkerNumber_DiffInserted) | (1 << MarkerNumber_DiffChanged),
+	MarkerBitmask_Diff = MarkerBitmask_DiffBlock | (1 << MarkerNumber_DiffDeleted),
 };
 
 enum {
@@ -282,7 +321,7 @@ struct EditMarkAll {
 		Reset(0, 0, nullptr);
 	}
 	void Start(BOOL bChanged, int findFlag, Sci_Position iSelCount, LPSTR text) noexcept;
-	void Continue(HANDLE timer) noexcept;
+	void Continue(IdleTaskTimer &timer) noexcept;
 	void Stop() noexcept;
 	void MarkAll(BOOL bChanged, int option) noexcept;
 };
@@ -367,6 +406,7 @@ struct EditAutoCompletionConfig {
 	bool bIndentText;
 	bool bIgnoreCase;
 	bool bLaTeXInputMethod;
+	bool bFuzzyMatch;
 	int iCompleteOption;
 	int fCompleteScope;
 	int fScanWordScope;
@@ -394,9 +434,29 @@ void	EditCompleteUpdateConfig() noexcept;
 bool	IsDocWordChar(uint32_t ch) noexcept;
 bool	IsAutoCompletionWordCharacter(uint32_t ch) noexcept;
 void	EditCompleteWord(int iCondition, bool autoInsert) noexcept;
+// index for words in document, rebuilt in idle time after modification
+extern bool bDocWordIndexPending;
+void	EditDocWordIndexReset() noexcept;
+void	EditDocWordIndexModified(int modificationType, Sci_Position position, Sci_Position length, Sci_Line linesAdded) noexcept;
+void	EditDocWordIndexContinue(IdleTaskTimer &timer) noexcept;
+// index for symbols in document, used by Goto Symbol
+struct SymbolItem {
+	Sci_Line line;
+	LPCSTR name;
+	UINT length;
+	UINT score;
+};
+extern bool bSymbolIndexPending;
+void	EditSymbolIndexReset() noexcept;
+void	EditSymbolIndexModified(int modificationType, Sci_Position position, Sci_Position length, Sci_Line linesAdded) noexcept;
+void	EditSymbolIndexContinue(IdleTaskTimer &timer) noexcept;
+SymbolItem *EditSymbolIndexMatch(LPCSTR pattern, UINT length, UINT *count) noexcept;
+void	EditElementIndexReset() noexcept;
+void	EditElementIndexModified(int modificationType, Sci_Position position, Sci_Position length, Sci_Line linesAdded) noexcept;
 bool	EditIsOpenBraceMatched(Sci_Position pos, Sci_Position startPos) noexcept;
 void	EditAutoCloseBraceQuote(int ch, AutoInsertCharacter what) noexcept;
 void	EditAutoCloseXMLTag() noexcept;
+bool	EditAutoCloseXMLElement() noexcept;
 void	EditAutoIndent() noexcept;
 void	EditToggleCommentLine(bool alternative) noexcept;
 void	EditToggleCommentBlock(bool alternative) noexcept;
@@ -473,6 +533,7 @@ enum {
 	EncodingFlag_UTF7 = 2,
 	EncodingFlag_Reversed = 4,
 	EncodingFlag_Invalid = 8,
+	EncodingFlag_Sampled = 16,
 };
 
 struct NP2ENCODING {
@@ -582,8 +643,9 @@ bool	Encoding_GetFromComboboxEx(HWND hwnd, int *pidEncoding) noexcept;
 #endif
 
 UINT	CodePageFromCharSet(UINT uCharSet) noexcept;
-bool	IsUTF8(const char *data, DWORD length) noexcept;
+bool	IsUTF8(const char *data, size_t length) noexcept;
 bool	IsUTF7(const char *pTest, DWORD nLength) noexcept;
+bool	MaybeBinaryFile(const uint8_t *ptr, DWORD length, int *encodingFlag) noexcept;
 
 #define BOM_UTF8		0xBFBBEF
 #define BOM_UTF16LE		0xFEFF
@@ -600,7 +662,10 @@ constexpr BOOL Encoding_HasBOM(int iEncoding) noexcept {
 }
 
 LPSTR RecodeAsUTF8(LPSTR lpData, DWORD *cbData, UINT codePage, DWORD flags) noexcept;
-int EditDetermineEncoding(LPCWSTR pszFile, char *lpData, DWORD cbData, int *encodingFlag) noexcept;
+int EditDetermineEncoding(LPCWSTR pszFile, char *lpData, size_t cbData, int *encodingFlag) noexcept;
+#if NP2_ENABLE_ENCODING_BENCHMARK
+void Encoding_Benchmark(LPCWSTR pszCorpus) noexcept;
+#endif
 bool IsStringCaseSensitiveW(LPCWSTR pszTextW) noexcept;
 bool IsStringCaseSensitiveA(LPCSTR pszText) noexcept;
 
@@ -642,7 +707,7 @@ struct EditFileVars {
 	int 	iEncoding;
 	char	tchEncoding[32];
 	char	tchMode[32];
-	void Init(LPCSTR lpData, DWORD cbData) noexcept;
+	void Init(LPCSTR lpData, size_t cbData) noexcept;
 	void Apply() noexcept;
 	int GetEncoding() const noexcept {
 		return (mask & FV_ENCODING) ? iEncoding : CPI_NONE;
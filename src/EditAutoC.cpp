@@ -17,15 +17,16 @@
 #include "EditAutoC_Data0.h"
 #include "LaTeXInput.h"
 
-#define NP2_AUTOC_CACHE_SORT_KEY	1
-#define NP2_AUTOC_USE_WORD_POINTER	0	// used for debug
 #define NP2_AUTOC_MAX_WORD_LENGTH	(128 - 3 - 1)	// SP + '(' + ')' + '\0'
 #define NP2_AUTOC_WORD_BUFFER_SIZE	128
 #define NP2_AUTOC_INIT_BUFFER_SIZE	(4096)
+#define NP2_AUTOC_INIT_WORD_COUNT	1024
+#define NP2_AUTOC_RECENT_WORD_COUNT	1024	// hash slots to skip repeated words before sorting
 
-// optimization for small string
+// optimization for small string, larger string is allocated from the temporary arena
 template <size_t StackSize = 32>
 class CharBuffer {
+	const TempArenaScope arenaScope;
 	char *ptr;
 	char buffer[StackSize];
 public:
@@ -34,7 +35,7 @@ public:
 			ptr = buffer;
 			memset(buffer, 0, StackSize);
 		} else {
-			ptr = static_cast<char *>(NP2HeapAlloc(size));
+			ptr = static_cast<char *>(TempArenaAlloc(size));
 		}
 	}
 	char *data() noexcept {
@@ -43,11 +44,6 @@ public:
 	char& operator[](size_t index) noexcept {
 		return ptr[index];
 	}
-	~CharBuffer() {
-		if (ptr != buffer) {
-			NP2HeapFree(ptr);
-		}
-	}
 };
 
 // memory buffer
@@ -55,32 +51,41 @@ struct WordListBuffer {
 	WordListBuffer *next;
 };
 
-struct WordNode;
-struct WordList {
-	int (__cdecl *WL_strcmp)(LPCSTR, LPCSTR);
-	int (__cdecl *WL_strncmp)(LPCSTR, LPCSTR, size_t);
-#if NP2_AUTOC_CACHE_SORT_KEY
-	uint32_t (*WL_SortKeyFunc)(const void *, uint32_t);
-#endif
+// words are appended into chained buffers, the entries are sorted by sort key then word,
+// and duplicate words removed in Finish().
+struct WordEntry {
+	LPCSTR word;
+	UINT sortKey;
+	UINT len;
+};
 
-	WordNode *pListHead;
+struct WordList {
 	LPCSTR pWordStart;
 	UINT iStartLen;
-#if NP2_AUTOC_CACHE_SORT_KEY
 	UINT startSortKey;
 	bool bIgnoreCase;
-#endif
-	UINT nWordCount;
+	bool bFuzzy;		// words are ranked by WordList_FuzzyScore() instead of sorted
+	uint64_t startMask;
+	UINT nWordCount;	// include duplicate words before Finish()
 	UINT nTotalLen;
 
+	WordEntry *entries;
+	UINT maxCount;
 	UINT offset;
 	UINT capacity;
 	WordListBuffer *buffer;
+	UINT recentWords[NP2_AUTOC_RECENT_WORD_COUNT];	// entry index + 1
 
-	void Init(LPCSTR pRoot, UINT iRootLen, bool ignoreCase) noexcept;
+	void Init(LPCSTR pRoot, UINT iRootLen, bool ignoreCase, bool fuzzy) noexcept;
 	void Free() const noexcept;
+	void Finish() noexcept;
 	char *GetList() const noexcept;
 	void AddBuffer() noexcept;
+	UINT SortKey(LPCSTR pWord, UINT len) const noexcept;
+	UINT FuzzyKey(LPCSTR pWord, UINT len) const noexcept;
+	bool Matches(uint64_t mask) const noexcept {
+		return (mask & startMask) == startMask;
+	}
 	void AddWord(LPCSTR pWord, UINT len) noexcept;
 	void UpdateRoot(LPCSTR pRoot, UINT iRootLen) noexcept;
 	bool StartsWith(LPCSTR pWord) const noexcept;
@@ -96,7 +101,6 @@ struct WordList {
 // TODO: replace _stricmp() and _strnicmp() with other functions
 // which correctly case insensitively compares UTF-8 string and ANSI/DBCS string.
 
-#if NP2_AUTOC_CACHE_SORT_KEY
 #define NP2_AUTOC_SORT_KEY_LENGTH	4
 
 uint32_t WordList_SortKey(const void *pWord, uint32_t len) noexcept {
@@ -150,146 +154,184 @@ uint32_t WordList_SortKeyCase(const void *pWord, uint32_t len) noexcept {
 #endif
 	return high;
 }
-#endif
 
-// Tree
-struct WordNode {
-	union {
-		WordNode *link[2];
-		struct {
-			WordNode *left;
-			WordNode *right;
-		};
-	};
-#if NP2_AUTOC_USE_WORD_POINTER
-	char *word;
-#endif
-#if NP2_AUTOC_CACHE_SORT_KEY
-	UINT sortKey;
-#endif
-	UINT len;
-	UINT level;
+// fuzzy match: characters in root are matched in order, the first one at word start or boundary.
+#define NP2_AUTOC_FUZZY_MIN_ROOT_LENGTH	2
+#define NP2_AUTOC_FUZZY_MAX_ROOT_LENGTH	32
+#define NP2_AUTOC_FUZZY_MAX_SCORE		0xffff
+
+enum {
+	FuzzyScore_Match = 16,
+	FuzzyScore_Start = 48,
+	FuzzyScore_Boundary = 32,
+	FuzzyScore_Consecutive = 24,
+	FuzzyScore_SameCase = 2,
+	FuzzyScore_Gap = 1,
+	FuzzyScore_None = INT_MIN/2,
 };
 
-#define NP2_TREE_HEIGHT_LIMIT	32
-// store word right after the node as most word are short.
-#define WordNode_GetWord(node)		(reinterpret_cast<char *>(node) + sizeof(WordNode))
-// TODO: since the tree is sorted, nodes greater than some level can be deleted to reduce total words.
-// or only limit word count in WordList::GetList().
-
-// Andersson Tree, source from https://www.eternallyconfuzzled.com/tuts/datastructures/jsw_tut_andersson.aspx
-// see also https://en.wikipedia.org/wiki/AA_tree
-#define aa_tree_skew(t) \
-	if ((t)->level && (t)->left && (t)->level == (t)->left->level) {\
-		WordNode *save = (t)->left;					\
-		(t)->left = save->right;							\
-		save->right = (t);									\
-		(t) = save;											\
-	}
-#define aa_tree_split(t) \
-	if ((t)->level && (t)->right && (t)->right->right && (t)->level == (t)->right->right->level) {\
-		WordNode *save = (t)->right;					\
-		(t)->right = save->left;							\
-		save->left = (t);									\
-		(t) = save;											\
-		++(t)->level;										\
-	}
-
-#define WordList_AddNode()	(reinterpret_cast<WordNode *>(reinterpret_cast<char *>(buffer) + offset))
-void WordList::AddBuffer() noexcept {
-	WordListBuffer *block = static_cast<WordListBuffer *>(NP2HeapAlloc(capacity));
-	block->next = buffer;
-	offset = NP2_align_up(sizeof(WordListBuffer), alignof(WordNode));
-	buffer = block;
+static constexpr uint8_t FoldAsciiCase(uint8_t ch) noexcept {
+	return (ch >= 'A' && ch <= 'Z') ? (ch + 'a' - 'A') : ch;
 }
 
-void WordList::AddWord(LPCSTR pWord, UINT len) noexcept {
-	WordNode *root = pListHead;
-#if NP2_AUTOC_CACHE_SORT_KEY
-	const UINT sortKey = (iStartLen > NP2_AUTOC_SORT_KEY_LENGTH) ? 0 : WL_SortKeyFunc(pWord, len);
-#endif
-	if (root == nullptr) {
-		WordNode *node = WordList_AddNode();
-		char *word = WordNode_GetWord(node);
-		memcpy(word, pWord, len);
-#if NP2_AUTOC_USE_WORD_POINTER
-		node->word = word;
-#endif
-#if NP2_AUTOC_CACHE_SORT_KEY
-		node->sortKey = sortKey;
-#endif
-		node->len = len;
-		node->level = 1;
-		root = node;
-	} else {
-		WordNode *iter = root;
-		WordNode *path[NP2_TREE_HEIGHT_LIMIT]{};
-		int top = 0;
-		int dir;
-
-		// find a spot and save the path
-		for (;;) {
-			path[top++] = iter;
-#if NP2_AUTOC_CACHE_SORT_KEY
-			dir = static_cast<int>(iter->sortKey - sortKey);
-			if (dir == 0 && (len > NP2_AUTOC_SORT_KEY_LENGTH || iter->len > NP2_AUTOC_SORT_KEY_LENGTH || bIgnoreCase)) {
-				dir = WL_strcmp(WordNode_GetWord(iter), pWord);
+// characters in word, used to filter out words can't match root.
+uint64_t WordList_CharMask(LPCSTR pWord, UINT len) noexcept {
+	uint64_t mask = 0;
+	for (UINT i = 0; i < len; i++) {
+		mask |= UINT64_C(1) << (FoldAsciiCase(pWord[i]) & 63);
+	}
+	return mask;
+}
+
+static constexpr bool IsFuzzyWordChar(uint8_t ch) noexcept {
+	return ch >= 0x80 || (ch >= '0' && ch <= '9') || ((ch | 0x20) >= 'a' && (ch | 0x20) <= 'z');
+}
+
+static inline int FuzzyBoundaryBonus(LPCSTR pWord, UINT index) noexcept {
+	if (index == 0) {
+		return FuzzyScore_Start;
+	}
+	const uint8_t chPrev = pWord[index - 1];
+	const uint8_t ch = pWord[index];
+	if (!IsFuzzyWordChar(chPrev) || (chPrev >= 'a' && chPrev <= 'z' && ch >= 'A' && ch <= 'Z')) {
+		// after separator or camelCase hump
+		return FuzzyScore_Boundary;
+	}
+	return -1;
+}
+
+// returns 0 when root not matched, otherwise higher score for better match.
+// score[i][j] is best score for root[0..i] with root[i] matched at word[j], only two rows are kept.
+UINT WordList_FuzzyScore(LPCSTR pRoot, UINT rootLen, LPCSTR pWord, UINT len, bool ignoreCase) noexcept {
+	if (len < rootLen) {
+		return 0;
+	}
+	const uint8_t first = ignoreCase ? FoldAsciiCase(pRoot[0]) : pRoot[0];
+	// quick check for subsequence
+	for (UINT i = 0, j = 0; i < rootLen; j++) {
+		if (j == len) {
+			return 0;
+		}
+		const uint8_t ch = ignoreCase ? FoldAsciiCase(pWord[j]) : pWord[j];
+		if (ch == (ignoreCase ? FoldAsciiCase(pRoot[i]) : static_cast<uint8_t>(pRoot[i]))) {
+			++i;
+		}
+	}
+
+	int rows[2][NP2_AUTOC_WORD_BUFFER_SIZE];
+	int *prev = rows[0];
+	int *curr = rows[1];
+	bool matched = false;
+	for (UINT j = 0; j < len; j++) {
+		int score = FuzzyScore_None;
+		const uint8_t ch = pWord[j];
+		if ((ignoreCase ? FoldAsciiCase(ch) : ch) == first) {
+			const int bonus = FuzzyBoundaryBonus(pWord, j);
+			if (bonus >= 0) {
+				score = FuzzyScore_Match + bonus + ((ch == static_cast<uint8_t>(pRoot[0])) ? FuzzyScore_SameCase : 0);
+				matched = true;
 			}
-#else
-			dir = WL_strcmp(WordNode_GetWord(iter), pWord);
-#endif
-			if (dir == 0) {
-				return;
+		}
+		curr[j] = score;
+	}
+	if (!matched) {
+		return 0;
+	}
+
+	for (UINT i = 1; i < rootLen; i++) {
+		int * const temp = prev;
+		prev = curr;
+		curr = temp;
+		const uint8_t chRoot = pRoot[i];
+		const uint8_t target = ignoreCase ? FoldAsciiCase(chRoot) : chRoot;
+		// best of prev[k] - FuzzyScore_Gap*(j - 1 - k) for k < j - 1
+		int gapBest = FuzzyScore_None;
+		curr[i - 1] = FuzzyScore_None;
+		for (UINT j = i; j < len; j++) {
+			if (j >= 2) {
+				gapBest = max(gapBest, prev[j - 2]) - FuzzyScore_Gap;
 			}
-			dir = dir < 0;
-			if (iter->link[dir] == nullptr) {
-				break;
+			int score = FuzzyScore_None;
+			const uint8_t ch = pWord[j];
+			if ((ignoreCase ? FoldAsciiCase(ch) : ch) == target) {
+				const int best = max(prev[j - 1] + FuzzyScore_Consecutive, gapBest);
+				if (best > FuzzyScore_None/2) {
+					const int bonus = FuzzyBoundaryBonus(pWord, j);
+					score = best + FuzzyScore_Match + max(bonus, 0) + ((ch == chRoot) ? FuzzyScore_SameCase : 0);
+				}
 			}
-			iter = iter->link[dir];
+			curr[j] = score;
 		}
+	}
 
-		if (capacity < offset + len + 1 + sizeof(WordNode)) {
-			capacity <<= 1;
-			AddBuffer();
-		}
+	int best = FuzzyScore_None;
+	for (UINT j = rootLen - 1; j < len; j++) {
+		best = max(best, curr[j]);
+	}
+	if (best <= FuzzyScore_None/2) {
+		return 0;
+	}
+	// prefer shorter word
+	best -= static_cast<int>(len - rootLen);
+	return clamp(best, 1, NP2_AUTOC_FUZZY_MAX_SCORE);
+}
 
-		WordNode *node = WordList_AddNode();
-		char *word = WordNode_GetWord(node);
-		memcpy(word, pWord, len);
-#if NP2_AUTOC_USE_WORD_POINTER
-		node->word = word;
-#endif
-#if NP2_AUTOC_CACHE_SORT_KEY
-		node->sortKey = sortKey;
-#endif
-		node->len = len;
-		node->level = 1;
-		iter->link[dir] = node;
-
-		// walk back and rebalance
-		while (--top >= 0) {
-			// which child?
-			if (top != 0) {
-				dir = path[top - 1]->right == path[top];
-			}
-			aa_tree_skew(path[top]);
-			aa_tree_split(path[top]);
-			// fix the parent
-			if (top != 0) {
-				path[top - 1]->link[dir] = path[top];
-			} else {
-				root = path[top];
-			}
+UINT WordList::FuzzyKey(LPCSTR pWord, UINT len) const noexcept {
+	// higher score first, 0 for not matched
+	const UINT score = WordList_FuzzyScore(pWordStart, iStartLen, pWord, len, bIgnoreCase);
+	return score ? (NP2_AUTOC_FUZZY_MAX_SCORE + 1 - score) : 0;
+}
+
+UINT WordList::SortKey(LPCSTR pWord, UINT len) const noexcept {
+	// long root is compared with _strnicmp(), words are sorted with strcmp()
+	return (bIgnoreCase && iStartLen <= NP2_AUTOC_SORT_KEY_LENGTH) ? WordList_SortKeyCase(pWord, len) : WordList_SortKey(pWord, len);
+}
+
+void WordList::AddBuffer() noexcept {
+	WordListBuffer *block = static_cast<WordListBuffer *>(NP2HeapAlloc(capacity));
+	block->next = buffer;
+	offset = sizeof(WordListBuffer);
+	buffer = block;
+}
+
+void WordList::AddWord(LPCSTR pWord, UINT len) noexcept {
+	// skip word same as recently added one with same hash
+	uint32_t hash = len;
+	for (UINT i = 0; i < len; i++) {
+		hash = hash*31 + static_cast<uint8_t>(pWord[i]);
+	}
+	UINT &recent = recentWords[hash % NP2_AUTOC_RECENT_WORD_COUNT];
+	if (recent != 0) {
+		const WordEntry &entry = entries[recent - 1];
+		if (entry.len == len && memcmp(entry.word, pWord, len) == 0) {
+			return;
 		}
 	}
+	const UINT sortKey = bFuzzy ? FuzzyKey(pWord, len) : SortKey(pWord, len);
+	if (sortKey == 0 && bFuzzy) {
+		return;
+	}
 
-	pListHead = root;
-	nWordCount++;
+	// WordList_SortKey() reads 4 bytes
+	if (capacity < offset + len + 1 + sizeof(uint32_t)) {
+		capacity <<= 1;
+		AddBuffer();
+	}
+	if (nWordCount == maxCount) {
+		maxCount <<= 1;
+		entries = static_cast<WordEntry *>(NP2HeapReAlloc(entries, maxCount*sizeof(WordEntry)));
+	}
+
+	char *word = reinterpret_cast<char *>(buffer) + offset;
+	memcpy(word, pWord, len);
+	offset += len + 1;
+	entries[nWordCount] = {word, sortKey, len};
+	recent = ++nWordCount;
 	nTotalLen += len + 1;
-	offset += NP2_align_up(len + 1 + sizeof(WordNode), alignof(WordNode));
 }
 
 void WordList::Free() const noexcept {
+	NP2HeapFree(entries);
 	WordListBuffer *block = buffer;
 	while (block) {
 		WordListBuffer * const next = block->next;
@@ -298,24 +340,85 @@ void WordList::Free() const noexcept {
 	}
 }
 
+static int __cdecl CmpWordEntry(const void *p1, const void *p2) noexcept {
+	const WordEntry *entry1 = static_cast<const WordEntry *>(p1);
+	const WordEntry *entry2 = static_cast<const WordEntry *>(p2);
+	return strcmp(entry1->word, entry2->word);
+}
+
+// LSD radix sort on sort key, skip bytes that are same for all entries.
+static WordEntry *WordList_RadixSort(WordEntry *entries, WordEntry *temp, UINT count) noexcept {
+	for (UINT shift = 0; shift < 32; shift += 8) {
+		UINT counts[256]{};
+		for (UINT i = 0; i < count; i++) {
+			counts[(entries[i].sortKey >> shift) & 0xff]++;
+		}
+		if (counts[(entries[0].sortKey >> shift) & 0xff] == count) {
+			continue;
+		}
+		UINT total = 0;
+		for (UINT &value : counts) {
+			const UINT start = total;
+			total += value;
+			value = start;
+		}
+		for (UINT i = 0; i < count; i++) {
+			const WordEntry &entry = entries[i];
+			temp[counts[(entry.sortKey >> shift) & 0xff]++] = entry;
+		}
+		WordEntry * const sorted = temp;
+		temp = entries;
+		entries = sorted;
+	}
+	return entries;
+}
+
+void WordList::Finish() noexcept {
+	UINT count = nWordCount;
+	if (count > 1) {
+		WordEntry *temp = static_cast<WordEntry *>(NP2HeapAlloc(count*sizeof(WordEntry)));
+		WordEntry *sorted = WordList_RadixSort(entries, temp, count);
+		if (sorted == temp) {
+			temp = entries;
+			entries = sorted;
+		}
+		NP2HeapFree(temp);
+
+		// sort words with same sort key, then remove duplicate words
+		UINT unique = 0;
+		UINT totalLen = 0;
+		UINT start = 0;
+		while (start < count) {
+			const UINT sortKey = entries[start].sortKey;
+			UINT end = start + 1;
+			while (end < count && entries[end].sortKey == sortKey) {
+				++end;
+			}
+			if (end - start > 1) {
+				qsort(entries + start, end - start, sizeof(WordEntry), CmpWordEntry);
+			}
+			for (UINT i = start; i < end; i++) {
+				const WordEntry &entry = entries[i];
+				if (i == start || strcmp(entries[unique - 1].word, entry.word) != 0) {
+					entries[unique++] = entry;
+					totalLen += entry.len + 1;
+				}
+			}
+			start = end;
+		}
+		nWordCount = unique;
+		nTotalLen = totalLen;
+	}
+}
+
 char* WordList::GetList() const noexcept {
-	WordNode *root = pListHead;
-	WordNode *path[NP2_TREE_HEIGHT_LIMIT]{};
-	int top = 0;
 	char *buf = static_cast<char *>(NP2HeapAlloc(nTotalLen + 1));// additional separator
 	char * const pList = buf;
-
-	while (root || top > 0) {
-		if (root) {
-			path[top++] = root;
-			root = root->left;
-		} else {
-			root = path[--top];
-			memcpy(buf, WordNode_GetWord(root), root->len);
-			buf += root->len;
-			*buf++ = '\n'; // the separator char
-			root = root->right;
-		}
+	for (UINT i = 0; i < nWordCount; i++) {
+		const WordEntry &entry = entries[i];
+		memcpy(buf, entry.word, entry.len);
+		buf += entry.len;
+		*buf++ = '\n'; // the separator char
 	}
 	// trim last separator char
 	if (buf != pList) {
@@ -324,30 +427,17 @@ char* WordList::GetList() const noexcept {
 	return pList;
 }
 
-void WordList::Init(LPCSTR pRoot, UINT iRootLen, bool ignoreCase) noexcept {
+void WordList::Init(LPCSTR pRoot, UINT iRootLen, bool ignoreCase, bool fuzzy) noexcept {
 	memset(this, 0, sizeof(struct WordList));
 	pWordStart = pRoot;
 	iStartLen = iRootLen;
-
-	if (ignoreCase) {
-		// use strcmp() instead of _stricmp() to keep all matched string instead of just first one
-		WL_strcmp = strcmp;
-		WL_strncmp = _strnicmp;
-#if NP2_AUTOC_CACHE_SORT_KEY
-		WL_SortKeyFunc = WordList_SortKeyCase;
-#endif
-	} else {
-		WL_strcmp = strcmp;
-		WL_strncmp = strncmp;
-#if NP2_AUTOC_CACHE_SORT_KEY
-		WL_SortKeyFunc = WordList_SortKey;
-#endif
-	}
-#if NP2_AUTOC_CACHE_SORT_KEY
-	startSortKey = WL_SortKeyFunc(pRoot, iRootLen);
 	bIgnoreCase = ignoreCase;
-#endif
+	bFuzzy = fuzzy && iRootLen >= NP2_AUTOC_FUZZY_MIN_ROOT_LENGTH && iRootLen <= NP2_AUTOC_FUZZY_MAX_ROOT_LENGTH;
+	startSortKey = SortKey(pRoot, iRootLen);
+	startMask = WordList_CharMask(pRoot, iRootLen);
 
+	maxCount = NP2_AUTOC_INIT_WORD_COUNT;
+	entries = static_cast<WordEntry *>(NP2HeapAlloc(maxCount*sizeof(WordEntry)));
 	capacity = NP2_AUTOC_INIT_BUFFER_SIZE;
 	AddBuffer();
 }
@@ -355,18 +445,25 @@ void WordList::Init(LPCSTR pRoot, UINT iRootLen, bool ignoreCase) noexcept {
 void WordList::UpdateRoot(LPCSTR pRoot, UINT iRootLen) noexcept {
 	pWordStart = pRoot;
 	iStartLen = iRootLen;
-#if NP2_AUTOC_CACHE_SORT_KEY
-	startSortKey = WL_SortKeyFunc(pRoot, iRootLen);
-#endif
+	bFuzzy = bFuzzy && iRootLen >= NP2_AUTOC_FUZZY_MIN_ROOT_LENGTH;
+	startSortKey = SortKey(pRoot, iRootLen);
+	startMask = WordList_CharMask(pRoot, iRootLen);
+	// sort key of added words depends on root length
+	for (UINT i = 0; i < nWordCount; i++) {
+		WordEntry &entry = entries[i];
+		entry.sortKey = bFuzzy ? FuzzyKey(entry.word, entry.len) : SortKey(entry.word, entry.len);
+	}
 }
 
 bool WordList::StartsWith(LPCSTR pWord) const noexcept {
-#if NP2_AUTOC_CACHE_SORT_KEY
+	if (bFuzzy) {
+		// checked by AddWord()
+		return true;
+	}
 	if (iStartLen <= NP2_AUTOC_SORT_KEY_LENGTH) {
-		return startSortKey == WL_SortKeyFunc(pWord, iStartLen);
+		return startSortKey == SortKey(pWord, iStartLen);
 	}
-#endif
-	return WL_strncmp(pWordStart, pWord, iStartLen) == 0;
+	return (bIgnoreCase ? _strnicmp(pWordStart, pWord, iStartLen) : strncmp(pWordStart, pWord, iStartLen)) == 0;
 }
 
 static constexpr bool WordList_IsSeparator(uint8_t ch) noexcept {
@@ -413,11 +510,11 @@ static constexpr bool WordList_IsSeparator(uint8_t ch) noexcept {
 #endif
 }
 
-void WordList::AddListEx(LPCSTR pList) noexcept {
+template <typename T>
+static void WordList_AddList(T &pWList, LPCSTR pList, UINT iRootLen) noexcept {
 	//StopWatch watch;
 	//watch.Start();
 	char word[NP2_AUTOC_WORD_BUFFER_SIZE];
-	const UINT iRootLen = iStartLen;
 	UINT len = 0;
 	bool ok = false;
 	while (true) {
@@ -438,8 +535,8 @@ void WordList::AddListEx(LPCSTR pList) noexcept {
 				word[len++] = ')';
 			}
 			word[len] = '\0';
-			if (ok || StartsWith(word)) {
-				AddWord(word, len);
+			if (ok || pWList.StartsWith(word)) {
+				pWList.AddWord(word, len);
 				ok = ch == '.';
 			}
 		}
@@ -461,7 +558,8 @@ void WordList::AddListEx(LPCSTR pList) noexcept {
 	//printf("%s duration=%.6f\n", __func__, duration);
 }
 
-void WordList::AddSubWord(LPSTR pWord, UINT wordLength, UINT iRootLen) noexcept {
+template <typename T>
+static void WordList_AddSubWord(T &pWList, LPSTR pWord, UINT wordLength, UINT iRootLen) noexcept {
 	/*
 	when pRoot is 'b', split 'bugprone-branch-clone' as following:
 	1. first hyphen: 'bugprone-branch-clone' => 'bugprone', 'branch-clone'.
@@ -477,11 +575,11 @@ void WordList::AddSubWord(LPSTR pWord, UINT wordLength, UINT iRootLen) noexcept
 		if (ch == '.' || ch == '-' || ch == ':') {
 			if (i >= iRootLen) {
 				pWord[i] = '\0';
-				AddWord(pWord, i);
+				pWList.AddWord(pWord, i);
 				for (UINT j = 0; j < count; j++) {
 					const UINT subLen = i - starts[j];
 					if (subLen >= iRootLen) {
-						AddWord(words[j], subLen);
+						pWList.AddWord(words[j], subLen);
 					}
 				}
 				pWord[i] = ch;
@@ -492,8 +590,8 @@ void WordList::AddSubWord(LPSTR pWord, UINT wordLength, UINT iRootLen) noexcept
 
 			const UINT subLen = wordLength - (i + 1);
 			LPCSTR pSubRoot = pWord + i + 1;
-			if (subLen >= iRootLen && StartsWith(pSubRoot)) {
-				AddWord(pSubRoot, subLen);
+			if (subLen >= iRootLen && pWList.StartsWith(pSubRoot)) {
+				pWList.AddWord(pSubRoot, subLen);
 				if (count < COUNTOF(words)) {
 					words[count] = pSubRoot;
 					starts[count] = i + 1;
@@ -504,6 +602,10 @@ void WordList::AddSubWord(LPSTR pWord, UINT wordLength, UINT iRootLen) noexcept
 	}
 }
 
+void WordList::AddSubWord(LPSTR pWord, UINT wordLength, UINT iRootLen) noexcept {
+	WordList_AddSubWord(*this, pWord, wordLength, iRootLen);
+}
+
 
 static constexpr bool IsCppCommentStyle(int style) noexcept {
 	return style == SCE_C_COMMENT
@@ -618,208 +720,1465 @@ static constexpr bool IsPrintfFormatSpecifier(int ch) noexcept {
 	return IsAlpha(ch);
 }
 
-static bool IsEscapeCharOrFormatSpecifier(Sci_Position before, int ch, int chPrev, int style, bool punctuation) noexcept {
-	// style for chPrev, style for ch is zero on typing
-	const int stylePrev = SciCall_GetStyleIndexAt(before);
-	if (stylePrev == 0) {
+static bool IsEscapeCharOrFormatSpecifier(Sci_Position before, int ch, int chPrev, int style, bool punctuation) noexcept {
+	// style for chPrev, style for ch is zero on typing
+	const int stylePrev = SciCall_GetStyleIndexAt(before);
+	if (stylePrev == 0) {
+		return false;
+	}
+	if (chPrev == '%') {
+		if (!IsPrintfFormatSpecifier(ch)) {
+			return false;
+		}
+		if (style != 0 && pLexCurrent->formatSpecifierStyle) {
+			return stylePrev == pLexCurrent->formatSpecifierStyle;
+		}
+		// legacy lexer without format specifier highlighting
+		if (pLexCurrent->lexerAttr & LexerAttr_PrintfFormatSpecifier) {
+			return !(stylePrev == pLexCurrent->operatorStyle || stylePrev == pLexCurrent->operatorStyle2);
+		}
+		return false;
+	}
+
+	if (style != 0 && pLexCurrent->escapeCharacterStyle) {
+		if (stylePrev != pLexCurrent->escapeCharacterStyle) {
+			if (pLexCurrent->iLexer != SCLEX_PHPSCRIPT
+				|| !(stylePrev == js_style(SCE_JS_ESCAPECHAR) || stylePrev == css_style(SCE_CSS_ESCAPECHAR))) {
+				return false;
+			}
+		}
+	} else if (!punctuation) {
+		// legacy lexer without escape character highlighting
+		if (!IsEscapeCharacter(ch)) {
+			return false;
+		}
+	}
+
+	if (!IsRawStringStyle(stylePrev)) {
+		int chPrev2 = 0;
+		const Sci_Position before2 = SciCall_PositionBefore(before);
+		if (before2 + 1 == before) {
+			chPrev2 = SciCall_GetCharAt(before2);
+		}
+		// simply treat chPrev == chPrev2 as escape escapeCharacterStart self
+		return chPrev != chPrev2;
+	}
+
+	return false;
+}
+
+static inline bool NeedSpaceAfterKeyword(const char *word, Sci_Position length) noexcept {
+	const char *p = strstr(
+		" if for try using while elseif switch foreach synchronized "
+		, word);
+	return p != nullptr && p[-1] == ' ' && p[length] == ' ';
+}
+
+enum {
+	// see LexInno.cxx
+	InnoLineStatePreprocessor = 1 << 5,
+	InnoLineStateCodeSection = 1 << 6,
+	// see LexVim.cxx
+	VimLineStateMaskVim9Script = 1 << 3,
+};
+
+//KeywordIndex++Autogenerated -- start of section automatically generated
+enum {
+	APDLKeywordIndex_SlashCommand = 2,
+	APDLKeywordIndex_StarCommand = 3,
+	AutoHotkeyKeywordIndex_Directive = 1,
+	AutoHotkeyKeywordIndex_CompilerDirective = 2,
+	AutoIt3KeywordIndex_Macro = 2,
+	AutoIt3KeywordIndex_Directive = 4,
+	AutoIt3KeywordIndex_Special = 5,
+	BashKeywordIndex_Variable = 2,
+	CPPKeywordIndex_Preprocessor = 2,
+	CPPKeywordIndex_Directive = 3,
+	CSSKeywordIndex_AtRule = 1,
+	CSSKeywordIndex_PseudoClass = 2,
+	CSSKeywordIndex_PseudoElement = 3,
+	CSharpKeywordIndex_Preprocessor = 3,
+	CSharpKeywordIndex_CommentTag = 10,
+	CangjieKeywordIndex_Macro = 2,
+	CangjieKeywordIndex_Annotation = 3,
+	DKeywordIndex_Preprocessor = 2,
+	DKeywordIndex_Attribute = 3,
+	DartKeywordIndex_Metadata = 4,
+	ErlangKeywordIndex_Annotation = 1,
+	ErlangKeywordIndex_Directive = 1,
+	FSharpKeywordIndex_Preprocessor = 2,
+	FSharpKeywordIndex_CommentTag = 4,
+	GraphVizKeywordIndex_HtmlLabel = 1,
+	GroovyKeywordIndex_Annotation = 7,
+	GroovyKeywordIndex_GroovyDoc = 9,
+	HTMLKeywordIndex_Tag = 0,
+	HTMLKeywordIndex_Attribute = 5,
+	HTMLKeywordIndex_Value = 6,
+	HaxeKeywordIndex_Preprocessor = 1,
+	HaxeKeywordIndex_CommentTag = 8,
+	InnoKeywordIndex_Directive = 4,
+	JavaKeywordIndex_Annotation = 7,
+	JavaKeywordIndex_Javadoc = 9,
+	JavaScriptKeywordIndex_Decorator = 7,
+	JavaScriptKeywordIndex_JSDoc = 10,
+	JuliaKeywordIndex_CodeFolding = 1,
+	JuliaKeywordIndex_Macro = 6,
+	KotlinKeywordIndex_Annotation = 6,
+	KotlinKeywordIndex_KDoc = 8,
+	NSISKeywordIndex_PredefinedVariable = 5,
+	PHPKeywordIndex_PredefinedVariable = 4,
+	PHPKeywordIndex_Phpdoc = 12,
+	PerlKeywordIndex_Variable = 2,
+	PowerBuilderKeywordIndex_Preprocessor = 2,
+	PowerShellKeywordIndex_PredefinedVariable = 4,
+	PythonKeywordIndex_Decorator = 7,
+	RebolKeywordIndex_Directive = 1,
+	RubyKeywordIndex_PredefinedVariable = 4,
+	SASKeywordIndex_Macro = 1,
+	ScalaKeywordIndex_Annotation = 3,
+	ScalaKeywordIndex_Scaladoc = 5,
+	SmaliKeywordIndex_Directive = 9,
+	SwiftKeywordIndex_Directive = 1,
+	SwiftKeywordIndex_Attribute = 2,
+	TexinfoKeywordIndex_Command = 0,
+	TexinfoKeywordIndex_BlockCommand = 1,
+	TexinfoKeywordIndex_TeXCommand = 2,
+	VBKeywordIndex_Preprocessor = 3,
+	VHDLKeywordIndex_Directive = 3,
+	VHDLKeywordIndex_Attribute = 4,
+	VerilogKeywordIndex_Directive = 3,
+	VerilogKeywordIndex_SystemTaskAndFunction = 4,
+	ZigKeywordIndex_BuiltinFunction = 2,
+};
+//KeywordIndex--Autogenerated -- end of section automatically generated
+
+extern EDITLEXER lexCPP;
+extern EDITLEXER lexCSS;
+extern EDITLEXER lexHTML;
+extern EDITLEXER lexJavaScript;
+extern EDITLEXER lexPHP;
+extern EDITLEXER lexVBScript;
+extern IdleTaskTimer idleTaskTimer;
+
+enum HtmlTextBlock {
+	HtmlTextBlock_Tag,
+	HtmlTextBlock_CDATA,
+	HtmlTextBlock_SGML,
+	HtmlTextBlock_JavaScript,
+	HtmlTextBlock_VBScript,
+	HtmlTextBlock_PHP,
+	HtmlTextBlock_CSS,
+};
+
+static HtmlTextBlock GetCurrentHtmlTextBlockEx(int iLexer, int iCurrentStyle) noexcept {
+	if (iLexer == SCLEX_PHPSCRIPT) {
+		if (iCurrentStyle >= css_style(SCE_CSS_DEFAULT)) {
+			return HtmlTextBlock_CSS;
+		}
+		if (iCurrentStyle >= js_style(SCE_JS_DEFAULT)) {
+			return HtmlTextBlock_JavaScript;
+		}
+		if (iCurrentStyle >= SCE_PHP_DEFAULT) {
+			return HtmlTextBlock_PHP;
+		}
+	}
+	if (iCurrentStyle == SCE_H_CDATA) {
+		return HtmlTextBlock_CDATA;
+	}
+	if ((iCurrentStyle >= SCE_HJ_START && iCurrentStyle <= SCE_HJ_TEMPLATELITERAL)
+		|| (iCurrentStyle >= SCE_HJA_START && iCurrentStyle <= SCE_HJA_TEMPLATELITERAL)) {
+		return HtmlTextBlock_JavaScript;
+	}
+	if ((iCurrentStyle >= SCE_HB_START && iCurrentStyle <= SCE_HB_OPERATOR)
+		|| (iCurrentStyle >= SCE_HBA_START && iCurrentStyle <= SCE_HBA_OPERATOR)) {
+		return HtmlTextBlock_VBScript;
+	}
+	if ((iCurrentStyle >= SCE_H_SGML_DEFAULT && iCurrentStyle < SCE_H_SGML_BLOCK_DEFAULT)) {
+		return HtmlTextBlock_SGML;
+	}
+	return HtmlTextBlock_Tag;
+}
+
+static HtmlTextBlock GetCurrentHtmlTextBlock(int iLexer) noexcept {
+	const Sci_Position iCurrentPos = SciCall_GetCurrentPos();
+	const int iCurrentStyle = SciCall_GetStyleIndexAt(iCurrentPos);
+	return GetCurrentHtmlTextBlockEx(iLexer, iCurrentStyle);
+}
+
+void EscapeRegex(LPSTR pszOut, LPCSTR pszIn) noexcept {
+	char ch;
+	while ((ch = *pszIn++) != '\0') {
+		if (ch == '.'		// any character
+			|| ch == '^'	// start of line
+			|| ch == '$'	// end of line
+			|| ch == '?'	// 0 or 1 times
+			|| ch == '*'	// 0 or more times
+			|| ch == '+'	// 1 or more times
+			|| ch == '[' || ch == ']'
+			|| ch == '(' || ch == ')'
+			) {
+			*pszOut++ = '\\';
+		}
+		*pszOut++ = ch;
+	}
+	*pszOut++ = '\0';
+}
+
+// word found at iPosFind is extended to wordEnd, returns position after the word.
+template <typename T>
+static Sci_Position AutoC_AddDocWordAt(T &pWList, Sci_Position iPosFind, Sci_Position wordEnd, Sci_Position iDocLen, int style, int iRootLen, char prefix) noexcept {
+	// find all word after '::', '->', '.' and '-'
+	bool bSubWord = false;
+	while (wordEnd < iDocLen) {
+		const int ch = SciCall_GetCharAt(wordEnd);
+		if (!(ch == ':' || ch == '.' || ch == '-')) {
+			if (ch == '!' && pLexCurrent->iLexer == SCLEX_RUST && style == SCE_RUST_MACRO) {
+				// macro: println!()
+				++wordEnd;
+			}
+			break;
+		}
+
+		const Sci_Position before = wordEnd;
+		Sci_Position width = 0;
+		int chNext = SciCall_GetCharacterAndWidth(wordEnd + 1, &width);
+		if ((ch == '-' && chNext == '>') || (ch == ':' && chNext == ':')) {
+			chNext = SciCall_GetCharacterAndWidth(wordEnd + 2, &width);
+			if (IsAutoCompletionWordCharacter(chNext)) {
+				wordEnd += 2;
+			}
+		} else if (ch == '.' || (ch == '-' && style == SciCall_GetStyleIndexAt(wordEnd))) {
+			if (IsAutoCompletionWordCharacter(chNext)) {
+				++wordEnd;
+			}
+		}
+		if (wordEnd == before) {
+			break;
+		}
+
+		while (wordEnd < iDocLen && (chNext < 0x80 && !IsDefaultWordChar(chNext))) {
+			wordEnd += width;
+			chNext = SciCall_GetCharacterAndWidth(wordEnd, &width);
+			if (!IsAutoCompletionWordCharacter(chNext)) {
+				break;
+			}
+		}
+
+		wordEnd = SciCall_WordEndPosition(wordEnd, true);
+		if (wordEnd - iPosFind > NP2_AUTOC_MAX_WORD_LENGTH) {
+			wordEnd = before;
+			break;
+		}
+		bSubWord = true;
+	}
+
+	if (wordEnd - iPosFind >= iRootLen) {
+		char wordBuf[NP2_AUTOC_WORD_BUFFER_SIZE];
+		char *pWord = wordBuf;
+		const Sci_TextRangeFull tr = { { iPosFind, min(iPosFind + NP2_AUTOC_MAX_WORD_LENGTH, wordEnd) }, pWord };
+		int wordLength = static_cast<int>(SciCall_GetTextRangeFull(&tr));
+
+		const Sci_Position before = SciCall_PositionBefore(iPosFind);
+		if (before + 1 == iPosFind) {
+			const int chPrev = SciCall_GetCharAt(before);
+			// word after escape character or format specifier
+			if (chPrev == '%' || chPrev == pLexCurrent->escapeCharacterStart) {
+				if (IsEscapeCharOrFormatSpecifier(before, static_cast<uint8_t>(pWord[0]), chPrev, style, false)) {
+					pWord++;
+					--wordLength;
+				}
+			}
+		}
+		if (prefix && prefix == pWord[0]) {
+			pWord++;
+			--wordLength;
+		}
+
+		//if (pLexCurrent->iLexer == SCLEX_PHPSCRIPT && wordLength >= 2 && pWord[0] == '$' && pWord[1] == '$') {
+		//	pWord++;
+		//	--wordLength;
+		//}
+		while (wordLength > 0 && (pWord[wordLength - 1] == '-' || pWord[wordLength - 1] == ':' || pWord[wordLength - 1] == '.')) {
+			--wordLength;
+			pWord[wordLength] = '\0';
+		}
+
+		if (wordLength >= iRootLen && (pWord[0] != ':' || pWord[1] == ':') && pWList.StartsWith(pWord)) {
+			bool space = false;
+			if (!(pLexCurrent->iLexer == SCLEX_CPP && style == SCE_C_MACRO)) {
+				while (IsASpaceOrTab(SciCall_GetCharAt(wordEnd))) {
+					space = true;
+					wordEnd++;
+				}
+			}
+
+			const int chWordEnd = SciCall_GetCharAt(wordEnd);
+			if ((pLexCurrent->iLexer == SCLEX_JULIA || pLexCurrent->iLexer == SCLEX_RUST) && chWordEnd == '!') {
+				const int chNext = SciCall_GetCharAt(wordEnd + 1);
+				if (chNext == '(') {
+					wordEnd += 2;
+					pWord[wordLength++] = '!';
+					pWord[wordLength++] = '(';
+					pWord[wordLength++] = ')';
+				}
+			}
+			else if (chWordEnd == '(') {
+				if (space && NeedSpaceAfterKeyword(pWord, wordLength)) {
+					pWord[wordLength++] = ' ';
+				}
+
+				pWord[wordLength++] = '(';
+				pWord[wordLength++] = ')';
+				wordEnd++;
+			}
+
+			if (wordLength >= iRootLen) {
+				pWord[wordLength] = '\0';
+				pWList.AddWord(pWord, wordLength);
+				if (bSubWord) {
+					pWList.AddSubWord(pWord, wordLength, iRootLen);
+				}
+			}
+		}
+	}
+	return wordEnd;
+}
+
+//=============================================================================
+//
+// Document word index
+//
+// words on every NP2_DOC_WORD_BLOCK_LINES lines are collected with their style into a sorted block,
+// blocks changed by modification are rebuilt in idle time, completion searches blocks
+// instead of scanning whole document for current word.
+#define NP2_DOC_WORD_BLOCK_LINES	256
+#define NP2_DOC_WORD_INIT_BUFFER_SIZE	(16*1024)
+
+bool bDocWordIndexPending;
+
+namespace {
+
+struct DocWordEntry {
+	LPCSTR word;
+	uint64_t mask;	// WordList_CharMask()
+	uint8_t length;
+	uint8_t style;
+};
+
+struct DocWordItem {
+	UINT offset;
+	uint8_t length;
+	uint8_t style;
+};
+
+struct DocWordBlock {
+	Sci_Line lineCount;
+	DocWordEntry *entries;	// sorted case insensitively, followed by words
+	UINT wordCount;
+	bool dirty;
+	uint8_t endStyle;		// style at block end when indexed
+};
+
+// collect words in a block or keyword list, same as WordList with empty root
+struct DocWordCollector {
+	char *buffer;
+	UINT offset;
+	UINT capacity;
+	DocWordItem *items;
+	UINT count;
+	UINT maxCount;
+	int style;
+
+	void Free() noexcept {
+		if (buffer != nullptr) {
+			NP2HeapFree(buffer);
+			NP2HeapFree(items);
+			memset(this, 0, sizeof(DocWordCollector));
+		}
+	}
+	bool StartsWith(LPCSTR /*pWord*/) const noexcept {
+		return true;
+	}
+	void AddWord(LPCSTR pWord, UINT len) noexcept;
+	void AddSubWord(LPSTR pWord, UINT wordLength, UINT iRootLen) noexcept {
+		WordList_AddSubWord(*this, pWord, wordLength, iRootLen);
+	}
+	DocWordEntry *Build(UINT &wordCount) const noexcept;
+};
+
+struct DocWordIndex {
+	DocWordBlock *blocks;
+	UINT blockCount;
+	UINT capacity;
+	UINT dirtyCount;
+	bool enabled;
+	// document state after last modification notification
+	Sci_Position docLength;
+	Sci_Line lineCount;
+	DocWordCollector collector;
+
+	void Reset() noexcept;
+	void MarkDirty(UINT index) noexcept {
+		DocWordBlock &block = blocks[index];
+		if (!block.dirty) {
+			block.dirty = true;
+			++dirtyCount;
+		}
+	}
+	void InsertBlocks(UINT index, UINT count) noexcept;
+	void RemoveBlock(UINT index) noexcept;
+	void IndexBlock(UINT index, Sci_Line startLine) noexcept;
+	bool Update(const IdleTaskTimer &timer) noexcept;
+	bool AddWords(WordList &pWList, const uint32_t (&ignoredStyleMask)[8], bool bIgnoreCase, Sci_Line &startLine, Sci_Line &endLine) noexcept;
+};
+
+DocWordIndex docWordIndex;
+
+void DocWordCollector::AddWord(LPCSTR pWord, UINT len) noexcept {
+	if (capacity < offset + len + 1) {
+		capacity = max<UINT>(capacity*2, NP2_DOC_WORD_INIT_BUFFER_SIZE);
+		buffer = static_cast<char *>((buffer == nullptr) ? NP2HeapAlloc(capacity) : NP2HeapReAlloc(buffer, capacity));
+	}
+	if (count == maxCount) {
+		maxCount = max<UINT>(maxCount*2, NP2_DOC_WORD_INIT_BUFFER_SIZE/8);
+		const size_t size = maxCount*sizeof(DocWordItem);
+		items = static_cast<DocWordItem *>((items == nullptr) ? NP2HeapAlloc(size) : NP2HeapReAlloc(items, size));
+	}
+	memcpy(buffer + offset, pWord, len);
+	buffer[offset + len] = '\0';
+	items[count++] = {offset, static_cast<uint8_t>(len), static_cast<uint8_t>(style)};
+	offset += len + 1;
+}
+
+int __cdecl CmpDocWordEntry(const void *p1, const void *p2) noexcept {
+	const DocWordEntry *entry1 = static_cast<const DocWordEntry *>(p1);
+	const DocWordEntry *entry2 = static_cast<const DocWordEntry *>(p2);
+	int cmp = _stricmp(entry1->word, entry2->word);
+	if (cmp == 0) {
+		cmp = strcmp(entry1->word, entry2->word);
+		if (cmp == 0) {
+			cmp = entry1->style - entry2->style;
+		}
+	}
+	return cmp;
+}
+
+// find first word starts with root
+UINT DocWordEntry_LowerBound(const DocWordEntry *entries, UINT count, LPCSTR pRoot, UINT iRootLen) noexcept {
+	UINT low = 0;
+	UINT high = count;
+	while (low < high) {
+		const UINT mid = (low + high) >> 1;
+		if (_strnicmp(entries[mid].word, pRoot, iRootLen) < 0) {
+			low = mid + 1;
+		} else {
+			high = mid;
+		}
+	}
+	return low;
+}
+
+// sort and remove duplicate words, returns entries followed by words.
+DocWordEntry *DocWordCollector::Build(UINT &wordCount) const noexcept {
+	wordCount = 0;
+	DocWordEntry *result = nullptr;
+	if (count != 0) {
+		DocWordEntry *entries = static_cast<DocWordEntry *>(NP2HeapAlloc(count*sizeof(DocWordEntry)));
+		for (UINT i = 0; i < count; i++) {
+			const DocWordItem &item = items[i];
+			LPCSTR word = buffer + item.offset;
+			entries[i] = {word, WordList_CharMask(word, item.length), item.length, item.style};
+		}
+		qsort(entries, count, sizeof(DocWordEntry), CmpDocWordEntry);
+		UINT totalLen = 0;
+		for (UINT i = 0; i < count; i++) {
+			if (wordCount == 0 || CmpDocWordEntry(&entries[wordCount - 1], &entries[i]) != 0) {
+				entries[wordCount++] = entries[i];
+				totalLen += entries[i].length + 1;
+			}
+		}
+
+		// padding for WordList_SortKey() on last word
+		result = static_cast<DocWordEntry *>(NP2HeapAlloc(wordCount*sizeof(DocWordEntry) + totalLen + sizeof(uint32_t)));
+		char *ptr = reinterpret_cast<char *>(result + wordCount);
+		for (UINT i = 0; i < wordCount; i++) {
+			DocWordEntry entry = entries[i];
+			memcpy(ptr, entry.word, entry.length + 1);
+			entry.word = ptr;
+			result[i] = entry;
+			ptr += entry.length + 1;
+		}
+		NP2HeapFree(entries);
+	}
+	return result;
+}
+
+void DocWordIndex::Reset() noexcept {
+	for (UINT i = 0; i < blockCount; i++) {
+		if (blocks[i].entries != nullptr) {
+			NP2HeapFree(blocks[i].entries);
+		}
+	}
+	blockCount = 0;
+	dirtyCount = 0;
+	enabled = (autoCompletionConfig.iCompleteOption & AutoCompletionOption_ScanWordsInDocument) != 0;
+	if (!enabled) {
+		if (blocks != nullptr) {
+			NP2HeapFree(blocks);
+			blocks = nullptr;
+			capacity = 0;
+		}
+		collector.Free();
+		bDocWordIndexPending = false;
+		return;
+	}
+
+	docLength = SciCall_GetLength();
+	lineCount = SciCall_GetLineCount();
+	const UINT count = static_cast<UINT>((lineCount + NP2_DOC_WORD_BLOCK_LINES - 1) / NP2_DOC_WORD_BLOCK_LINES);
+	InsertBlocks(0, count);
+	blocks[count - 1].lineCount = lineCount - (count - 1)*NP2_DOC_WORD_BLOCK_LINES;
+	bDocWordIndexPending = true;
+}
+
+// insert dirty blocks with NP2_DOC_WORD_BLOCK_LINES lines.
+void DocWordIndex::InsertBlocks(UINT index, UINT count) noexcept {
+	if (blockCount + count > capacity) {
+		capacity = max(blockCount + count, capacity*2);
+		const size_t size = capacity*sizeof(DocWordBlock);
+		blocks = static_cast<DocWordBlock *>((blocks == nullptr) ? NP2HeapAlloc(size) : NP2HeapReAlloc(blocks, size));
+	}
+	memmove(blocks + index + count, blocks + index, (blockCount - index)*sizeof(DocWordBlock));
+	for (UINT i = 0; i < count; i++) {
+		DocWordBlock &block = blocks[index + i];
+		memset(&block, 0, sizeof(DocWordBlock));
+		block.lineCount = NP2_DOC_WORD_BLOCK_LINES;
+		block.dirty = true;
+	}
+	blockCount += count;
+	dirtyCount += count;
+}
+
+void DocWordIndex::RemoveBlock(UINT index) noexcept {
+	const DocWordBlock &block = blocks[index];
+	if (block.entries != nullptr) {
+		NP2HeapFree(block.entries);
+	}
+	dirtyCount -= block.dirty;
+	--blockCount;
+	memmove(blocks + index, blocks + index + 1, (blockCount - index)*sizeof(DocWordBlock));
+}
+
+void DocWordIndex::IndexBlock(UINT index, Sci_Line startLine) noexcept {
+	Sci_Line count = blocks[index].lineCount;
+	if (count > 2*NP2_DOC_WORD_BLOCK_LINES) {
+		// split block after many lines inserted
+		const UINT added = static_cast<UINT>((count - 1) / NP2_DOC_WORD_BLOCK_LINES);
+		InsertBlocks(index + 1, added);
+		blocks[index + added].lineCount = count - added*NP2_DOC_WORD_BLOCK_LINES;
+		blocks[index].lineCount = count = NP2_DOC_WORD_BLOCK_LINES;
+	}
+
+	const Sci_Position startPos = SciCall_PositionFromLine(startLine);
+	const Sci_Position endPos = SciCall_PositionFromLine(startLine + count);
+	const Sci_Position iDocLen = SciCall_GetLength();
+	SciCall_EnsureStyledTo(endPos);
+	const char * const text = SciCall_GetRangePointer(startPos, endPos - startPos);
+
+	DocWordCollector &words = collector;
+	words.offset = 0;
+	words.count = 0;
+	Sci_Position pos = startPos;
+	while (pos < endPos) {
+		const uint8_t ch = text[pos - startPos];
+		if (ch < 0x80 && !IsDocWordChar(ch)) {
+			++pos;
+			continue;
+		}
+		const Sci_Position wordEnd = SciCall_WordEndPosition(pos, true);
+		if (wordEnd == pos) {
+			pos = SciCall_PositionAfter(pos);
+			continue;
+		}
+		const int style = SciCall_GetStyleIndexAt(pos);
+		words.style = style;
+		// words after '::', '->', '.' and '-' are also indexed from their start
+		AutoC_AddDocWordAt(words, pos, wordEnd, iDocLen, style, 1, '\0');
+		pos = wordEnd;
+	}
+
+	DocWordBlock &block = blocks[index];
+	if (block.entries != nullptr) {
+		NP2HeapFree(block.entries);
+	}
+	block.entries = words.Build(block.wordCount);
+
+	const uint8_t endStyle = (endPos == 0) ? 0 : static_cast<uint8_t>(SciCall_GetStyleIndexAt(endPos - 1));
+	block.dirty = false;
+	--dirtyCount;
+	if (block.endStyle != endStyle) {
+		block.endStyle = endStyle;
+		// styles after the block may also changed
+		if (index + 1 < blockCount) {
+			MarkDirty(index + 1);
+		}
+	}
+}
+
+// index dirty blocks until finished or timer expired, returns whether all blocks are indexed.
+bool DocWordIndex::Update(const IdleTaskTimer &timer) noexcept {
+	if (!enabled) {
+		return false;
+	}
+	// text changed without notification
+	if (docLength != SciCall_GetLength() || lineCount != SciCall_GetLineCount()) {
+		Reset();
+	}
+
+	Sci_Line line = 0;
+	for (UINT index = 0; index < blockCount && dirtyCount != 0; index++) {
+		if (blocks[index].dirty) {
+			if (!timer.Continue()) {
+				break;
+			}
+			IndexBlock(index, line);
+		}
+		line += blocks[index].lineCount;
+	}
+	bDocWordIndexPending = dirtyCount != 0;
+	return dirtyCount == 0;
+}
+
+// add indexed words except these on block contains current line, which is returned in [startLine, endLine).
+bool DocWordIndex::AddWords(WordList &pWList, const uint32_t (&ignoredStyleMask)[8], bool bIgnoreCase, Sci_Line &startLine, Sci_Line &endLine) noexcept {
+	if (!Update(idleTaskTimer)) {
+		return false;
+	}
+
+	LPCSTR const pRoot = pWList.pWordStart;
+	const UINT iRootLen = pWList.iStartLen;
+	const Sci_Line currentLine = SciCall_LineFromPosition(SciCall_GetCurrentPos());
+	Sci_Line line = 0;
+	for (UINT index = 0; index < blockCount; index++) {
+		const DocWordBlock &block = blocks[index];
+		if (currentLine >= line && currentLine < line + block.lineCount) {
+			startLine = line;
+			endLine = line + block.lineCount;
+		} else if (pWList.bFuzzy) {
+			const DocWordEntry * const entries = block.entries;
+			for (UINT i = 0; i < block.wordCount; i++) {
+				const DocWordEntry &entry = entries[i];
+				if (pWList.Matches(entry.mask) && !BitTestEx(ignoredStyleMask, entry.style)) {
+					pWList.AddWord(entry.word, entry.length);
+				}
+			}
+		} else {
+			const DocWordEntry * const entries = block.entries;
+			UINT low = DocWordEntry_LowerBound(entries, block.wordCount, pRoot, iRootLen);
+			for (; low < block.wordCount; low++) {
+				const DocWordEntry &entry = entries[low];
+				if (_strnicmp(entry.word, pRoot, iRootLen) != 0) {
+					break;
+				}
+				if (!BitTestEx(ignoredStyleMask, entry.style) && (bIgnoreCase || strncmp(entry.word, pRoot, iRootLen) == 0)) {
+					pWList.AddWord(entry.word, entry.length);
+				}
+			}
+		}
+		line += block.lineCount;
+	}
+	return true;
+}
+
+// mark block contains modified line as dirty, and update line count of blocks after lines inserted or deleted.
+template <typename BlockIndex>
+void BlockIndex_Modified(BlockIndex &index, int modificationType, Sci_Position position, Sci_Position length, Sci_Line linesAdded) noexcept {
+	index.docLength += (modificationType & SC_MOD_INSERTTEXT) ? length : -length;
+	index.lineCount += linesAdded;
+	const Sci_Line line = SciCall_LineFromPosition(position);
+	UINT current = 0;
+	Sci_Line startLine = 0;
+	while (current + 1 < index.blockCount && startLine + index.blocks[current].lineCount <= line) {
+		startLine += index.blocks[current].lineCount;
+		++current;
+	}
+
+	index.MarkDirty(current);
+	if (linesAdded >= 0) {
+		index.blocks[current].lineCount += linesAdded;
+	} else {
+		// deleted lines after current line may span several blocks
+		Sci_Line removed = min(-linesAdded, startLine + index.blocks[current].lineCount - 1 - line);
+		index.blocks[current].lineCount -= removed;
+		removed = -linesAdded - removed;
+		const UINT next = current + 1;
+		while (removed > 0 && next < index.blockCount) {
+			auto &block = index.blocks[next];
+			if (block.lineCount <= removed) {
+				removed -= block.lineCount;
+				index.RemoveBlock(next);
+			} else {
+				block.lineCount -= removed;
+				removed = 0;
+				index.MarkDirty(next);
+			}
+		}
+	}
+}
+
+}
+
+void EditDocWordIndexReset() noexcept {
+	docWordIndex.Reset();
+}
+
+void EditDocWordIndexModified(int modificationType, Sci_Position position, Sci_Position length, Sci_Line linesAdded) noexcept {
+	DocWordIndex &index = docWordIndex;
+	if (!index.enabled || index.blockCount == 0) {
+		return;
+	}
+
+	BlockIndex_Modified(index, modificationType, position, length, linesAdded);
+	bDocWordIndexPending = true;
+}
+
+void EditDocWordIndexContinue(IdleTaskTimer &timer) noexcept {
+	timer.Start(WaitableTimer_IdleTaskTimeSlot);
+	docWordIndex.Update(timer);
+}
+
+//=============================================================================
+//
+// Symbol index
+//
+// symbols are collected per block like document words: runs of function definition style
+// (defaultFoldIgnoreInner), and text of fold header lines on levels in defaultFoldLevelMask
+// (e.g. markdown headers, C++ namespace and class), the later is limited to outermost level
+// when the lexer has function definition style, and not used for indentation based folding.
+#define NP2_SYMBOL_BLOCK_LINES		1024
+#define NP2_SYMBOL_NAME_SIZE		80
+#define NP2_SYMBOL_SCAN_LENGTH		256		// bytes on each line scanned for symbol
+#define NP2_SYMBOL_INDEX_WAIT_TIME	1000	// milliseconds to finish indexing for Goto Symbol
+
+bool bSymbolIndexPending;
+
+namespace {
+
+struct SymbolEntry {
+	UINT lineOffset;	// from block start line
+	UINT length;
+	char name[NP2_SYMBOL_NAME_SIZE];
+};
+
+struct SymbolBlock {
+	Sci_Line lineCount;
+	SymbolEntry *entries;
+	UINT symbolCount;
+	bool dirty;
+	uint8_t endStyle;		// style at block end when indexed
+	int endLevel;			// fold level of last line when indexed
+};
+
+struct SymbolIndex {
+	SymbolBlock *blocks;
+	UINT blockCount;
+	UINT capacity;
+	UINT dirtyCount;
+	bool enabled;
+	int definitionStyle;
+	UINT levelMask;
+	// document state after last modification notification
+	Sci_Position docLength;
+	Sci_Line lineCount;
+	// symbols for current block
+	SymbolEntry *collector;
+	UINT collectorCount;
+	UINT collectorCapacity;
+
+	void Reset() noexcept;
+	void MarkDirty(UINT index) noexcept {
+		SymbolBlock &block = blocks[index];
+		if (!block.dirty) {
+			block.dirty = true;
+			++dirtyCount;
+		}
+	}
+	void InsertBlocks(UINT index, UINT count) noexcept;
+	void RemoveBlock(UINT index) noexcept;
+	void AddSymbol(const char *text, UINT length, UINT lineOffset) noexcept;
+	void IndexBlock(UINT index, Sci_Line startLine) noexcept;
+	bool Update(const IdleTaskTimer &timer) noexcept;
+};
+
+SymbolIndex symbolIndex;
+
+constexpr bool IsSymbolChar(uint8_t ch) noexcept {
+	return ch >= 0x80 || ch == '_' || IsAlphaNumeric(ch);
+}
+
+void SymbolIndex::Reset() noexcept {
+	for (UINT i = 0; i < blockCount; i++) {
+		if (blocks[i].entries != nullptr) {
+			NP2HeapFree(blocks[i].entries);
+		}
+	}
+	blockCount = 0;
+	dirtyCount = 0;
+	definitionStyle = pLexCurrent->defaultFoldIgnoreInner;
+	levelMask = (pLexCurrent->lexerAttr & LexerAttr_IndentBasedFolding) ? 0 : pLexCurrent->defaultFoldLevelMask;
+	if (definitionStyle != 0) {
+		levelMask &= 0U - levelMask;
+	}
+	enabled = definitionStyle != 0 || levelMask != 0;
+	if (!enabled) {
+		if (blocks != nullptr) {
+			NP2HeapFree(blocks);
+			blocks = nullptr;
+			capacity = 0;
+		}
+		if (collector != nullptr) {
+			NP2HeapFree(collector);
+			collector = nullptr;
+			collectorCapacity = 0;
+		}
+		bSymbolIndexPending = false;
+		return;
+	}
+
+	docLength = SciCall_GetLength();
+	lineCount = SciCall_GetLineCount();
+	const UINT count = static_cast<UINT>((lineCount + NP2_SYMBOL_BLOCK_LINES - 1) / NP2_SYMBOL_BLOCK_LINES);
+	InsertBlocks(0, count);
+	blocks[count - 1].lineCount = lineCount - (count - 1)*NP2_SYMBOL_BLOCK_LINES;
+	bSymbolIndexPending = true;
+}
+
+// insert dirty blocks with NP2_SYMBOL_BLOCK_LINES lines.
+void SymbolIndex::InsertBlocks(UINT index, UINT count) noexcept {
+	if (blockCount + count > capacity) {
+		capacity = max(blockCount + count, capacity*2);
+		const size_t size = capacity*sizeof(SymbolBlock);
+		blocks = static_cast<SymbolBlock *>((blocks == nullptr) ? NP2HeapAlloc(size) : NP2HeapReAlloc(blocks, size));
+	}
+	memmove(blocks + index + count, blocks + index, (blockCount - index)*sizeof(SymbolBlock));
+	for (UINT i = 0; i < count; i++) {
+		SymbolBlock &block = blocks[index + i];
+		memset(&block, 0, sizeof(SymbolBlock));
+		block.lineCount = NP2_SYMBOL_BLOCK_LINES;
+		block.dirty = true;
+	}
+	blockCount += count;
+	dirtyCount += count;
+}
+
+void SymbolIndex::RemoveBlock(UINT index) noexcept {
+	const SymbolBlock &block = blocks[index];
+	if (block.entries != nullptr) {
+		NP2HeapFree(block.entries);
+	}
+	dirtyCount -= block.dirty;
+	--blockCount;
+	memmove(blocks + index, blocks + index + 1, (blockCount - index)*sizeof(SymbolBlock));
+}
+
+// add symbol with surrounding spaces removed, long name is truncated on character boundary.
+void SymbolIndex::AddSymbol(const char *text, UINT length, UINT lineOffset) noexcept {
+	while (length != 0 && IsASpaceOrTab(*text)) {
+		++text;
+		--length;
+	}
+	while (length != 0 && IsASpaceOrTab(text[length - 1])) {
+		--length;
+	}
+	if (length >= NP2_SYMBOL_NAME_SIZE) {
+		length = NP2_SYMBOL_NAME_SIZE - 1;
+		while (length != 0 && (static_cast<uint8_t>(text[length]) & 0xc0) == 0x80) {
+			--length;
+		}
+	}
+	// ignore line without any word, e.g. brace on its own line
+	bool word = false;
+	for (UINT i = 0; i < length && !word; i++) {
+		word = IsSymbolChar(text[i]);
+	}
+	if (!word) {
+		return;
+	}
+
+	if (collectorCount == collectorCapacity) {
+		collectorCapacity = max<UINT>(collectorCapacity*2, 64);
+		const size_t size = collectorCapacity*sizeof(SymbolEntry);
+		collector = static_cast<SymbolEntry *>((collector == nullptr) ? NP2HeapAlloc(size) : NP2HeapReAlloc(collector, size));
+	}
+	SymbolEntry &entry = collector[collectorCount++];
+	entry.lineOffset = lineOffset;
+	entry.length = length;
+	memcpy(entry.name, text, length);
+	entry.name[length] = '\0';
+}
+
+void SymbolIndex::IndexBlock(UINT index, Sci_Line startLine) noexcept {
+	Sci_Line count = blocks[index].lineCount;
+	if (count > 2*NP2_SYMBOL_BLOCK_LINES) {
+		// split block after many lines inserted
+		const UINT added = static_cast<UINT>((count - 1) / NP2_SYMBOL_BLOCK_LINES);
+		InsertBlocks(index + 1, added);
+		blocks[index + added].lineCount = count - added*NP2_SYMBOL_BLOCK_LINES;
+		blocks[index].lineCount = count = NP2_SYMBOL_BLOCK_LINES;
+	}
+
+	const Sci_Position startPos = SciCall_PositionFromLine(startLine);
+	const Sci_Position endPos = SciCall_PositionFromLine(startLine + count);
+	SciCall_EnsureStyledTo(endPos);
+	const char * const text = SciCall_GetRangePointer(startPos, endPos - startPos);
+
+	collectorCount = 0;
+	for (Sci_Line offset = 0; offset < count; offset++) {
+		const Sci_Line line = startLine + offset;
+		const Sci_Position lineStart = SciCall_PositionFromLine(line);
+		const Sci_Position lineEnd = min(SciCall_GetLineEndPosition(line), lineStart + NP2_SYMBOL_SCAN_LENGTH);
+		if (lineStart == lineEnd) {
+			continue;
+		}
+
+		bool found = false;
+		if (definitionStyle != 0) {
+			Sci_Position pos = lineStart;
+			while (pos < lineEnd) {
+				if (!IsSymbolChar(text[pos - startPos])) {
+					++pos;
+					continue;
+				}
+				const Sci_Position wordStart = pos;
+				if (SciCall_GetStyleIndexAt(pos) == definitionStyle) {
+					do {
+						++pos;
+					} while (pos < lineEnd && SciCall_GetStyleIndexAt(pos) == definitionStyle);
+					AddSymbol(text + (wordStart - startPos), static_cast<UINT>(pos - wordStart), static_cast<UINT>(offset));
+					found = true;
+					break;
+				}
+				do {
+					++pos;
+				} while (pos < lineEnd && IsSymbolChar(text[pos - startPos]));
+			}
+		}
+		if (!found && levelMask != 0) {
+			const int level = SciCall_GetFoldLevel(line);
+			if (level & SC_FOLDLEVELHEADERFLAG) {
+				const UINT lev = (level & SC_FOLDLEVELNUMBERMASK) - SC_FOLDLEVELBASE;
+				if (lev < 8 && (levelMask & (1U << lev)) != 0) {
+					AddSymbol(text + (lineStart - startPos), static_cast<UINT>(lineEnd - lineStart), static_cast<UINT>(offset));
+				}
+			}
+		}
+	}
+
+	SymbolBlock &block = blocks[index];
+	if (block.entries != nullptr) {
+		NP2HeapFree(block.entries);
+		block.entries = nullptr;
+	}
+	block.symbolCount = collectorCount;
+	if (collectorCount != 0) {
+		const size_t size = collectorCount*sizeof(SymbolEntry);
+		block.entries = static_cast<SymbolEntry *>(NP2HeapAlloc(size));
+		memcpy(block.entries, collector, size);
+	}
+
+	const uint8_t endStyle = (endPos == 0) ? 0 : static_cast<uint8_t>(SciCall_GetStyleIndexAt(endPos - 1));
+	const int endLevel = SciCall_GetFoldLevel(startLine + count - 1);
+	block.dirty = false;
+	--dirtyCount;
+	if (block.endStyle != endStyle || block.endLevel != endLevel) {
+		block.endStyle = endStyle;
+		block.endLevel = endLevel;
+		// styles and fold levels after the block may also changed
+		if (index + 1 < blockCount) {
+			MarkDirty(index + 1);
+		}
+	}
+}
+
+// index dirty blocks until finished or timer expired, returns whether all blocks are indexed.
+bool SymbolIndex::Update(const IdleTaskTimer &timer) noexcept {
+	if (!enabled) {
+		return false;
+	}
+	// text changed without notification
+	if (docLength != SciCall_GetLength() || lineCount != SciCall_GetLineCount()) {
+		Reset();
+	}
+
+	Sci_Line line = 0;
+	for (UINT index = 0; index < blockCount && dirtyCount != 0; index++) {
+		if (blocks[index].dirty) {
+			if (!timer.Continue()) {
+				break;
+			}
+			IndexBlock(index, line);
+		}
+		line += blocks[index].lineCount;
+	}
+	bSymbolIndexPending = dirtyCount != 0;
+	return dirtyCount == 0;
+}
+
+int __cdecl CmpSymbolItem(const void *p1, const void *p2) noexcept {
+	const SymbolItem *item1 = static_cast<const SymbolItem *>(p1);
+	const SymbolItem *item2 = static_cast<const SymbolItem *>(p2);
+	// higher score first, then document order
+	if (item1->score != item2->score) {
+		return (item1->score > item2->score) ? -1 : 1;
+	}
+	return (item1->line < item2->line) ? -1 : (item1->line > item2->line);
+}
+
+}
+
+void EditSymbolIndexReset() noexcept {
+	symbolIndex.Reset();
+}
+
+void EditSymbolIndexModified(int modificationType, Sci_Position position, Sci_Position length, Sci_Line linesAdded) noexcept {
+	SymbolIndex &index = symbolIndex;
+	if (!index.enabled || index.blockCount == 0) {
+		return;
+	}
+
+	BlockIndex_Modified(index, modificationType, position, length, linesAdded);
+	bSymbolIndexPending = true;
+}
+
+void EditSymbolIndexContinue(IdleTaskTimer &timer) noexcept {
+	timer.Start(WaitableTimer_IdleTaskTimeSlot);
+	symbolIndex.Update(timer);
+}
+
+// returns symbols matched pattern ranked by fuzzy score, or all symbols in document order for empty pattern.
+// names point into the index, which is valid until next modification.
+SymbolItem *EditSymbolIndexMatch(LPCSTR pattern, UINT length, UINT *count) noexcept {
+	SymbolIndex &index = symbolIndex;
+	*count = 0;
+	if (!index.enabled) {
+		return nullptr;
+	}
+
+	// finish pending blocks, indexing for huge document is continued in idle time
+	idleTaskTimer.Set(NP2_SYMBOL_INDEX_WAIT_TIME);
+	index.Update(idleTaskTimer);
+	UINT total = 0;
+	for (UINT i = 0; i < index.blockCount; i++) {
+		total += index.blocks[i].symbolCount;
+	}
+	if (total == 0) {
+		return nullptr;
+	}
+
+	SymbolItem *items = static_cast<SymbolItem *>(NP2HeapAlloc(total*sizeof(SymbolItem)));
+	UINT matched = 0;
+	Sci_Line line = 0;
+	for (UINT i = 0; i < index.blockCount; i++) {
+		const SymbolBlock &block = index.blocks[i];
+		for (UINT j = 0; j < block.symbolCount; j++) {
+			const SymbolEntry &entry = block.entries[j];
+			UINT score = 0;
+			if (length != 0) {
+				score = WordList_FuzzyScore(pattern, length, entry.name, entry.length, true);
+				if (score == 0) {
+					continue;
+				}
+			}
+			items[matched++] = {line + entry.lineOffset, entry.name, entry.length, score};
+		}
+		line += block.lineCount;
+	}
+	if (length != 0) {
+		qsort(items, matched, sizeof(SymbolItem), CmpSymbolItem);
+	}
+	*count = matched;
+	return items;
+}
+
+//=============================================================================
+//
+// Element index
+//
+// for XML and HTML, tags on every NP2_ELEMENT_BLOCK_LINES lines are reduced into unmatched end tags
+// followed by unmatched start tags, open elements before a position are found by replaying blocks
+// instead of scanning whole document, blocks changed by modification are rebuilt when used.
+#define NP2_ELEMENT_BLOCK_LINES		1024
+#define NP2_ELEMENT_NAME_SIZE		64
+#define NP2_ELEMENT_TAG_LENGTH		1024	// bytes after block end scanned for end of start tag
+
+namespace {
+
+struct ElementTag {
+	bool end;
+	char name[NP2_ELEMENT_NAME_SIZE];
+};
+
+// open elements, or reduced tags of a block with unmatched end tags at bottom
+struct ElementStack {
+	ElementTag *tags;
+	UINT count;
+	UINT capacity;
+
+	void Free() noexcept {
+		if (tags != nullptr) {
+			NP2HeapFree(tags);
+			memset(this, 0, sizeof(ElementStack));
+		}
+	}
+	void Add(const ElementTag &tag, bool html, bool keepEnd) noexcept;
+};
+
+struct ElementBlock {
+	Sci_Line lineCount;
+	ElementTag *tags;
+	UINT tagCount;
+	bool dirty;
+	uint8_t endStyle;		// style at block end when indexed
+};
+
+struct ElementIndex {
+	ElementBlock *blocks;
+	UINT blockCount;
+	UINT capacity;
+	UINT dirtyCount;
+	bool enabled;
+	bool html;
+	// document state after last modification notification
+	Sci_Position docLength;
+	Sci_Line lineCount;
+	ElementStack collector;
+	ElementStack stack;
+
+	void Reset() noexcept;
+	void MarkDirty(UINT index) noexcept {
+		ElementBlock &block = blocks[index];
+		if (!block.dirty) {
+			block.dirty = true;
+			++dirtyCount;
+		}
+	}
+	void InsertBlocks(UINT index, UINT count) noexcept;
+	void RemoveBlock(UINT index) noexcept;
+	void Collect(ElementStack &tags, Sci_Position startPos, Sci_Position endPos, bool keepEnd) const noexcept;
+	void IndexBlock(UINT index, Sci_Line startLine) noexcept;
+	bool FindOpenElement(Sci_Position position, char *name) noexcept;
+};
+
+ElementIndex elementIndex;
+
+void ElementStack::Add(const ElementTag &tag, bool html, bool keepEnd) noexcept {
+	if (tag.end) {
+		// close nearest open element with same name, and inner elements without end tag
+		UINT index = count;
+		while (index != 0 && !tags[index - 1].end) {
+			--index;
+			const int diff = html ? _stricmp(tags[index].name, tag.name) : strcmp(tags[index].name, tag.name);
+			if (diff == 0) {
+				count = index;
+				return;
+			}
+		}
+		if (!keepEnd) {
+			return;
+		}
+		// end tag for element before the block also closes start tags in the block
+		count = index;
+	}
+	if (count == capacity) {
+		capacity = max<UINT>(capacity*2, 64);
+		const size_t size = capacity*sizeof(ElementTag);
+		tags = static_cast<ElementTag *>((tags == nullptr) ? NP2HeapAlloc(size) : NP2HeapReAlloc(tags, size));
+	}
+	tags[count++] = tag;
+}
+
+void ElementIndex::Reset() noexcept {
+	for (UINT i = 0; i < blockCount; i++) {
+		if (blocks[i].tags != nullptr) {
+			NP2HeapFree(blocks[i].tags);
+		}
+	}
+	blockCount = 0;
+	dirtyCount = 0;
+	const int iLexer = pLexCurrent->iLexer;
+	html = iLexer == SCLEX_HTML;
+	enabled = html || iLexer == SCLEX_XML;
+	if (!enabled) {
+		if (blocks != nullptr) {
+			NP2HeapFree(blocks);
+			blocks = nullptr;
+			capacity = 0;
+		}
+		collector.Free();
+		stack.Free();
+		return;
+	}
+
+	docLength = SciCall_GetLength();
+	lineCount = SciCall_GetLineCount();
+	const UINT count = static_cast<UINT>((lineCount + NP2_ELEMENT_BLOCK_LINES - 1) / NP2_ELEMENT_BLOCK_LINES);
+	InsertBlocks(0, count);
+	blocks[count - 1].lineCount = lineCount - (count - 1)*NP2_ELEMENT_BLOCK_LINES;
+}
+
+// insert dirty blocks with NP2_ELEMENT_BLOCK_LINES lines.
+void ElementIndex::InsertBlocks(UINT index, UINT count) noexcept {
+	if (blockCount + count > capacity) {
+		capacity = max(blockCount + count, capacity*2);
+		const size_t size = capacity*sizeof(ElementBlock);
+		blocks = static_cast<ElementBlock *>((blocks == nullptr) ? NP2HeapAlloc(size) : NP2HeapReAlloc(blocks, size));
+	}
+	memmove(blocks + index + count, blocks + index, (blockCount - index)*sizeof(ElementBlock));
+	for (UINT i = 0; i < count; i++) {
+		ElementBlock &block = blocks[index + i];
+		memset(&block, 0, sizeof(ElementBlock));
+		block.lineCount = NP2_ELEMENT_BLOCK_LINES;
+		block.dirty = true;
+	}
+	blockCount += count;
+	dirtyCount += count;
+}
+
+void ElementIndex::RemoveBlock(UINT index) noexcept {
+	const ElementBlock &block = blocks[index];
+	if (block.tags != nullptr) {
+		NP2HeapFree(block.tags);
+	}
+	dirtyCount -= block.dirty;
+	--blockCount;
+	memmove(blocks + index, blocks + index + 1, (blockCount - index)*sizeof(ElementBlock));
+}
+
+// add tags styled by LexHTML in [startPos, endPos), void elements and self-closing tags are ignored.
+void ElementIndex::Collect(ElementStack &tags, Sci_Position startPos, Sci_Position endPos, bool keepEnd) const noexcept {
+	const char * const text = SciCall_GetRangePointer(startPos, endPos - startPos);
+	const Sci_Position limit = min(docLength, endPos + NP2_ELEMENT_TAG_LENGTH);
+	Sci_Position pos = startPos;
+	while (pos + 1 < endPos) {
+		if (text[pos - startPos] != '<') {
+			++pos;
+			continue;
+		}
+		const int style = SciCall_GetStyleIndexAt(pos);
+		++pos;
+		if (style != SCE_H_TAG && style != SCE_H_TAGUNKNOWN) {
+			continue;
+		}
+
+		ElementTag tag;
+		tag.end = text[pos - startPos] == '/';
+		pos += tag.end;
+		UINT length = 0;
+		while (pos < endPos && IsHtmlTagChar(text[pos - startPos])) {
+			if (length + 1 < NP2_ELEMENT_NAME_SIZE) {
+				tag.name[length++] = text[pos - startPos];
+			}
+			++pos;
+		}
+		if (length == 0) {
+			continue;
+		}
+		tag.name[length] = '\0';
+		if (!tag.end) {
+			if (html) {
+				char voidTag[NP2_ELEMENT_NAME_SIZE + 2];
+				voidTag[0] = ' ';
+				memcpy(voidTag + 1, tag.name, length);
+				voidTag[length + 1] = ' ';
+				voidTag[length + 2] = '\0';
+				if (IsHtmlVoidTag(voidTag)) {
+					continue;
+				}
+			}
+			// find end of the start tag, which may be after endPos
+			bool selfClosing = false;
+			char chPrev = '\0';
+			for (Sci_Position offset = pos; offset < limit; offset++) {
+				const char ch = (offset < endPos) ? text[offset - startPos] : SciCall_GetCharAt(offset);
+				if (ch == '>' || ch == '<') {
+					const int styleEnd = SciCall_GetStyleIndexAt(offset);
+					if (styleEnd == SCE_H_TAG || styleEnd == SCE_H_TAGUNKNOWN || styleEnd == SCE_H_TAGEND) {
+						selfClosing = ch == '>' && chPrev == '/';
+						break;
+					}
+				}
+				chPrev = ch;
+			}
+			if (selfClosing) {
+				continue;
+			}
+		}
+		tags.Add(tag, html, keepEnd);
+	}
+}
+
+void ElementIndex::IndexBlock(UINT index, Sci_Line startLine) noexcept {
+	Sci_Line count = blocks[index].lineCount;
+	if (count > 2*NP2_ELEMENT_BLOCK_LINES) {
+		// split block after many lines inserted
+		const UINT added = static_cast<UINT>((count - 1) / NP2_ELEMENT_BLOCK_LINES);
+		InsertBlocks(index + 1, added);
+		blocks[index + added].lineCount = count - added*NP2_ELEMENT_BLOCK_LINES;
+		blocks[index].lineCount = count = NP2_ELEMENT_BLOCK_LINES;
+	}
+
+	const Sci_Position startPos = SciCall_PositionFromLine(startLine);
+	const Sci_Position endPos = SciCall_PositionFromLine(startLine + count);
+	SciCall_EnsureStyledTo(min(docLength, endPos + NP2_ELEMENT_TAG_LENGTH));
+	collector.count = 0;
+	Collect(collector, startPos, endPos, true);
+
+	ElementBlock &block = blocks[index];
+	if (block.tags != nullptr) {
+		NP2HeapFree(block.tags);
+		block.tags = nullptr;
+	}
+	block.tagCount = collector.count;
+	if (collector.count != 0) {
+		const size_t size = collector.count*sizeof(ElementTag);
+		block.tags = static_cast<ElementTag *>(NP2HeapAlloc(size));
+		memcpy(block.tags, collector.tags, size);
+	}
+
+	const uint8_t endStyle = (endPos == 0) ? 0 : static_cast<uint8_t>(SciCall_GetStyleIndexAt(endPos - 1));
+	block.dirty = false;
+	--dirtyCount;
+	if (block.endStyle != endStyle) {
+		block.endStyle = endStyle;
+		// styles after the block may also changed
+		if (index + 1 < blockCount) {
+			MarkDirty(index + 1);
+		}
+	}
+}
+
+// find innermost element open before position, in O(depth) for each block before current block.
+bool ElementIndex::FindOpenElement(Sci_Position position, char *name) noexcept {
+	if (!enabled) {
 		return false;
 	}
-	if (chPrev == '%') {
-		if (!IsPrintfFormatSpecifier(ch)) {
-			return false;
-		}
-		if (style != 0 && pLexCurrent->formatSpecifierStyle) {
-			return stylePrev == pLexCurrent->formatSpecifierStyle;
-		}
-		// legacy lexer without format specifier highlighting
-		if (pLexCurrent->lexerAttr & LexerAttr_PrintfFormatSpecifier) {
-			return !(stylePrev == pLexCurrent->operatorStyle || stylePrev == pLexCurrent->operatorStyle2);
-		}
-		return false;
+	// text changed without notification
+	if (blockCount == 0 || docLength != SciCall_GetLength() || lineCount != SciCall_GetLineCount()) {
+		Reset();
 	}
 
-	if (style != 0 && pLexCurrent->escapeCharacterStyle) {
-		if (stylePrev != pLexCurrent->escapeCharacterStyle) {
-			if (pLexCurrent->iLexer != SCLEX_PHPSCRIPT
-				|| !(stylePrev == js_style(SCE_JS_ESCAPECHAR) || stylePrev == css_style(SCE_CSS_ESCAPECHAR))) {
-				return false;
-			}
+	const Sci_Line line = SciCall_LineFromPosition(position);
+	Sci_Line startLine = 0;
+	stack.count = 0;
+	for (UINT index = 0; index < blockCount && startLine + blocks[index].lineCount <= line; index++) {
+		if (blocks[index].dirty) {
+			IndexBlock(index, startLine);
 		}
-	} else if (!punctuation) {
-		// legacy lexer without escape character highlighting
-		if (!IsEscapeCharacter(ch)) {
-			return false;
+		const ElementBlock &block = blocks[index];
+		for (UINT i = 0; i < block.tagCount; i++) {
+			stack.Add(block.tags[i], html, false);
 		}
+		startLine += block.lineCount;
 	}
 
-	if (!IsRawStringStyle(stylePrev)) {
-		int chPrev2 = 0;
-		const Sci_Position before2 = SciCall_PositionBefore(before);
-		if (before2 + 1 == before) {
-			chPrev2 = SciCall_GetCharAt(before2);
-		}
-		// simply treat chPrev == chPrev2 as escape escapeCharacterStart self
-		return chPrev != chPrev2;
+	const Sci_Position startPos = SciCall_PositionFromLine(startLine);
+	if (startPos < position) {
+		SciCall_EnsureStyledTo(position);
+		Collect(stack, startPos, position, false);
+	}
+	if (stack.count == 0) {
+		return false;
 	}
+	strcpy(name, stack.tags[stack.count - 1].name);
+	return true;
+}
 
-	return false;
 }
 
-static inline bool NeedSpaceAfterKeyword(const char *word, Sci_Position length) noexcept {
-	const char *p = strstr(
-		" if for try using while elseif switch foreach synchronized "
-		, word);
-	return p != nullptr && p[-1] == ' ' && p[length] == ' ';
+void EditElementIndexReset() noexcept {
+	elementIndex.Reset();
 }
 
-enum {
-	// see LexInno.cxx
-	InnoLineStatePreprocessor = 1 << 5,
-	InnoLineStateCodeSection = 1 << 6,
-	// see LexVim.cxx
-	VimLineStateMaskVim9Script = 1 << 3,
-};
+void EditElementIndexModified(int modificationType, Sci_Position position, Sci_Position length, Sci_Line linesAdded) noexcept {
+	ElementIndex &index = elementIndex;
+	if (!index.enabled || index.blockCount == 0) {
+		return;
+	}
 
-//KeywordIndex++Autogenerated -- start of section automatically generated
-enum {
-	APDLKeywordIndex_SlashCommand = 2,
-	APDLKeywordIndex_StarCommand = 3,
-	AutoHotkeyKeywordIndex_Directive = 1,
-	AutoHotkeyKeywordIndex_CompilerDirective = 2,
-	AutoIt3KeywordIndex_Macro = 2,
-	AutoIt3KeywordIndex_Directive = 4,
-	AutoIt3KeywordIndex_Special = 5,
-	BashKeywordIndex_Variable = 2,
-	CPPKeywordIndex_Preprocessor = 2,
-	CPPKeywordIndex_Directive = 3,
-	CSSKeywordIndex_AtRule = 1,
-	CSSKeywordIndex_PseudoClass = 2,
-	CSSKeywordIndex_PseudoElement = 3,
-	CSharpKeywordIndex_Preprocessor = 3,
-	CSharpKeywordIndex_CommentTag = 10,
-	CangjieKeywordIndex_Macro = 2,
-	CangjieKeywordIndex_Annotation = 3,
-	DKeywordIndex_Preprocessor = 2,
-	DKeywordIndex_Attribute = 3,
-	DartKeywordIndex_Metadata = 4,
-	ErlangKeywordIndex_Annotation = 1,
-	ErlangKeywordIndex_Directive = 1,
-	FSharpKeywordIndex_Preprocessor = 2,
-	FSharpKeywordIndex_CommentTag = 4,
-	GraphVizKeywordIndex_HtmlLabel = 1,
-	GroovyKeywordIndex_Annotation = 7,
-	GroovyKeywordIndex_GroovyDoc = 9,
-	HTMLKeywordIndex_Tag = 0,
-	HTMLKeywordIndex_Attribute = 5,
-	HTMLKeywordIndex_Value = 6,
-	HaxeKeywordIndex_Preprocessor = 1,
-	HaxeKeywordIndex_CommentTag = 8,
-	InnoKeywordIndex_Directive = 4,
-	JavaKeywordIndex_Annotation = 7,
-	JavaKeywordIndex_Javadoc = 9,
-	JavaScriptKeywordIndex_Decorator = 7,
-	JavaScriptKeywordIndex_JSDoc = 10,
-	JuliaKeywordIndex_CodeFolding = 1,
-	JuliaKeywordIndex_Macro = 6,
-	KotlinKeywordIndex_Annotation = 6,
-	KotlinKeywordIndex_KDoc = 8,
-	NSISKeywordIndex_PredefinedVariable = 5,
-	PHPKeywordIndex_PredefinedVariable = 4,
-	PHPKeywordIndex_Phpdoc = 12,
-	PerlKeywordIndex_Variable = 2,
-	PowerBuilderKeywordIndex_Preprocessor = 2,
-	PowerShellKeywordIndex_PredefinedVariable = 4,
-	PythonKeywordIndex_Decorator = 7,
-	RebolKeywordIndex_Directive = 1,
-	RubyKeywordIndex_PredefinedVariable = 4,
-	SASKeywordIndex_Macro = 1,
-	ScalaKeywordIndex_Annotation = 3,
-	ScalaKeywordIndex_Scaladoc = 5,
-	SmaliKeywordIndex_Directive = 9,
-	SwiftKeywordIndex_Directive = 1,
-	SwiftKeywordIndex_Attribute = 2,
-	TexinfoKeywordIndex_Command = 0,
-	TexinfoKeywordIndex_BlockCommand = 1,
-	TexinfoKeywordIndex_TeXCommand = 2,
-	VBKeywordIndex_Preprocessor = 3,
-	VHDLKeywordIndex_Directive = 3,
-	VHDLKeywordIndex_Attribute = 4,
-	VerilogKeywordIndex_Directive = 3,
-	VerilogKeywordIndex_SystemTaskAndFunction = 4,
-	ZigKeywordIndex_BuiltinFunction = 2,
+	BlockIndex_Modified(index, modificationType, position, length, linesAdded);
+}
+
+//=============================================================================
+//
+// Keyword table
+//
+// keyword lists are static strings, each list is expanded into sorted words on first use,
+// and kept for later completions to only add words starts with root.
+#define NP2_KEYWORD_TABLE_INIT_COUNT	32
+
+namespace {
+
+struct KeywordTable {
+	LPCSTR pList;
+	DocWordEntry *entries;	// sorted case insensitively, followed by words
+	UINT wordCount;
 };
-//KeywordIndex--Autogenerated -- end of section automatically generated
 
-extern EDITLEXER lexCPP;
-extern EDITLEXER lexCSS;
-extern EDITLEXER lexHTML;
-extern EDITLEXER lexJavaScript;
-extern EDITLEXER lexPHP;
-extern EDITLEXER lexVBScript;
-extern HANDLE idleTaskTimer;
+struct KeywordTableCache {
+	KeywordTable *tables;
+	UINT count;
+	UINT capacity;
 
-enum HtmlTextBlock {
-	HtmlTextBlock_Tag,
-	HtmlTextBlock_CDATA,
-	HtmlTextBlock_SGML,
-	HtmlTextBlock_JavaScript,
-	HtmlTextBlock_VBScript,
-	HtmlTextBlock_PHP,
-	HtmlTextBlock_CSS,
+	const KeywordTable &Get(LPCSTR pList) noexcept;
 };
 
-static HtmlTextBlock GetCurrentHtmlTextBlockEx(int iLexer, int iCurrentStyle) noexcept {
-	if (iLexer == SCLEX_PHPSCRIPT) {
-		if (iCurrentStyle >= css_style(SCE_CSS_DEFAULT)) {
-			return HtmlTextBlock_CSS;
-		}
-		if (iCurrentStyle >= js_style(SCE_JS_DEFAULT)) {
-			return HtmlTextBlock_JavaScript;
-		}
-		if (iCurrentStyle >= SCE_PHP_DEFAULT) {
-			return HtmlTextBlock_PHP;
+KeywordTableCache keywordTableCache;
+
+const KeywordTable &KeywordTableCache::Get(LPCSTR pList) noexcept {
+	for (UINT i = 0; i < count; i++) {
+		if (tables[i].pList == pList) {
+			return tables[i];
 		}
 	}
-	if (iCurrentStyle == SCE_H_CDATA) {
-		return HtmlTextBlock_CDATA;
-	}
-	if ((iCurrentStyle >= SCE_HJ_START && iCurrentStyle <= SCE_HJ_TEMPLATELITERAL)
-		|| (iCurrentStyle >= SCE_HJA_START && iCurrentStyle <= SCE_HJA_TEMPLATELITERAL)) {
-		return HtmlTextBlock_JavaScript;
-	}
-	if ((iCurrentStyle >= SCE_HB_START && iCurrentStyle <= SCE_HB_OPERATOR)
-		|| (iCurrentStyle >= SCE_HBA_START && iCurrentStyle <= SCE_HBA_OPERATOR)) {
-		return HtmlTextBlock_VBScript;
-	}
-	if ((iCurrentStyle >= SCE_H_SGML_DEFAULT && iCurrentStyle < SCE_H_SGML_BLOCK_DEFAULT)) {
-		return HtmlTextBlock_SGML;
+
+	if (count == capacity) {
+		capacity = max<UINT>(capacity*2, NP2_KEYWORD_TABLE_INIT_COUNT);
+		const size_t size = capacity*sizeof(KeywordTable);
+		tables = static_cast<KeywordTable *>((tables == nullptr) ? NP2HeapAlloc(size) : NP2HeapReAlloc(tables, size));
 	}
-	return HtmlTextBlock_Tag;
+
+	DocWordCollector words{};
+	WordList_AddList(words, pList, 0);
+	KeywordTable &table = tables[count++];
+	table.pList = pList;
+	table.entries = words.Build(table.wordCount);
+	words.Free();
+	return table;
 }
 
-static HtmlTextBlock GetCurrentHtmlTextBlock(int iLexer) noexcept {
-	const Sci_Position iCurrentPos = SciCall_GetCurrentPos();
-	const int iCurrentStyle = SciCall_GetStyleIndexAt(iCurrentPos);
-	return GetCurrentHtmlTextBlockEx(iLexer, iCurrentStyle);
 }
 
-void EscapeRegex(LPSTR pszOut, LPCSTR pszIn) noexcept {
-	char ch;
-	while ((ch = *pszIn++) != '\0') {
-		if (ch == '.'		// any character
-			|| ch == '^'	// start of line
-			|| ch == '$'	// end of line
-			|| ch == '?'	// 0 or 1 times
-			|| ch == '*'	// 0 or more times
-			|| ch == '+'	// 1 or more times
-			|| ch == '[' || ch == ']'
-			|| ch == '(' || ch == ')'
-			) {
-			*pszOut++ = '\\';
+void WordList::AddListEx(LPCSTR pList) noexcept {
+	const KeywordTable &table = keywordTableCache.Get(pList);
+	const DocWordEntry * const entries = table.entries;
+	if (bFuzzy) {
+		for (UINT index = 0; index < table.wordCount; index++) {
+			const DocWordEntry &entry = entries[index];
+			if (Matches(entry.mask)) {
+				AddWord(entry.word, entry.length);
+			}
+		}
+		return;
+	}
+	for (UINT index = DocWordEntry_LowerBound(entries, table.wordCount, pWordStart, iStartLen); index < table.wordCount; index++) {
+		const DocWordEntry &entry = entries[index];
+		if (_strnicmp(entry.word, pWordStart, iStartLen) != 0) {
+			break;
+		}
+		if (StartsWith(entry.word)) {
+			AddWord(entry.word, entry.length);
 		}
-		*pszOut++ = ch;
 	}
-	*pszOut++ = '\0';
 }
 
 static void AutoC_AddDocWord(WordList &pWList, const uint32_t (&ignoredStyleMask)[8], bool bIgnoreCase, char prefix) noexcept {
@@ -836,131 +2195,70 @@ static void AutoC_AddDocWord(WordList &pWList, const uint32_t (&ignoredStyleMask
 
 	const Sci_Position iCurrentPos = SciCall_GetCurrentPos() - iRootLen - (prefix ? 1 : 0);
 	const Sci_Position iDocLen = SciCall_GetLength();
-	Sci_TextToFindFull ft = { { 0, iDocLen }, pFind.data(), { 0, 0 } };
-
-	Sci_Position iPosFind = SciCall_FindTextFull(findFlag, &ft);
-	HANDLE timer = idleTaskTimer;
-	WaitableTimer_Set(timer, autoCompletionConfig.dwScanWordsTimeout);
-
-	while (iPosFind >= 0 && iPosFind < iDocLen && WaitableTimer_Continue(timer)) {
-		Sci_Position wordEnd = iPosFind + iRootLen;
-		const int style = SciCall_GetStyleIndexAt(wordEnd - 1);
-		wordEnd = ft.chrgText.cpMax;
-		if (iPosFind != iCurrentPos && !BitTestEx(ignoredStyleMask, style)) {
-			// find all word after '::', '->', '.' and '-'
-			bool bSubWord = false;
-			while (wordEnd < iDocLen) {
-				const int ch = SciCall_GetCharAt(wordEnd);
-				if (!(ch == ':' || ch == '.' || ch == '-')) {
-					if (ch == '!' && pLexCurrent->iLexer == SCLEX_RUST && style == SCE_RUST_MACRO) {
-						// macro: println!()
-						++wordEnd;
-					}
-					break;
-				}
-
-				const Sci_Position before = wordEnd;
-				Sci_Position width = 0;
-				int chNext = SciCall_GetCharacterAndWidth(wordEnd + 1, &width);
-				if ((ch == '-' && chNext == '>') || (ch == ':' && chNext == ':')) {
-					chNext = SciCall_GetCharacterAndWidth(wordEnd + 2, &width);
-					if (IsAutoCompletionWordCharacter(chNext)) {
-						wordEnd += 2;
-					}
-				} else if (ch == '.' || (ch == '-' && style == SciCall_GetStyleIndexAt(wordEnd))) {
-					if (IsAutoCompletionWordCharacter(chNext)) {
-						++wordEnd;
-					}
-				}
-				if (wordEnd == before) {
-					break;
-				}
-
-				while (wordEnd < iDocLen && (chNext < 0x80 && !IsDefaultWordChar(chNext))) {
-					wordEnd += width;
-					chNext = SciCall_GetCharacterAndWidth(wordEnd, &width);
-					if (!IsAutoCompletionWordCharacter(chNext)) {
+	IdleTaskTimer &timer = idleTaskTimer;
+	timer.Set(autoCompletionConfig.dwScanWordsTimeout);
+
+	// only scan lines around current position when words in other lines are indexed
+	Sci_Position iStartPos = 0;
+	Sci_Position iEndPos = iDocLen;
+	bool indexed = false;
+	if (prefix == '\0' && (findFlag & SCFIND_WORDSTART) != 0) {
+		Sci_Line startLine = 0;
+		Sci_Line endLine = 0;
+		if (docWordIndex.AddWords(pWList, ignoredStyleMask, bIgnoreCase, startLine, endLine)) {
+			iStartPos = SciCall_PositionFromLine(startLine);
+			iEndPos = SciCall_PositionFromLine(endLine);
+			indexed = true;
+		}
+	}
+	if (pWList.bFuzzy && indexed) {
+		// search can only find words starts with root, scan all words on lines around current position
+		const char * const text = SciCall_GetRangePointer(iStartPos, iEndPos - iStartPos);
+		Sci_Position pos = iStartPos;
+		while (pos < iEndPos && timer.Continue()) {
+			const uint8_t ch = text[pos - iStartPos];
+			if (ch < 0x80 && !IsDocWordChar(ch)) {
+				++pos;
+				continue;
+			}
+			Sci_Position wordEnd = SciCall_WordEndPosition(pos, true);
+			if (wordEnd == pos) {
+				pos = SciCall_PositionAfter(pos);
+				continue;
+			}
+			if (pos <= iCurrentPos && iCurrentPos - pos <= NP2_AUTOC_MAX_WORD_LENGTH) {
+				// skip current word and words joined to it by '::', '->', '.' or '-'
+				Sci_Position index = pos;
+				while (index < iCurrentPos) {
+					const uint8_t chNext = text[index - iStartPos];
+					if (!(chNext >= 0x80 || IsDocWordChar(chNext) || chNext == ':' || chNext == '.' || chNext == '-' || chNext == '>')) {
 						break;
 					}
+					++index;
 				}
-
-				wordEnd = SciCall_WordEndPosition(wordEnd, true);
-				if (wordEnd - iPosFind > NP2_AUTOC_MAX_WORD_LENGTH) {
-					wordEnd = before;
-					break;
-				}
-				bSubWord = true;
-			}
-
-			if (wordEnd - iPosFind >= iRootLen) {
-				char wordBuf[NP2_AUTOC_WORD_BUFFER_SIZE];
-				char *pWord = wordBuf;
-				const Sci_TextRangeFull tr = { { iPosFind, min(iPosFind + NP2_AUTOC_MAX_WORD_LENGTH, wordEnd) }, pWord };
-				int wordLength = static_cast<int>(SciCall_GetTextRangeFull(&tr));
-
-				const Sci_Position before = SciCall_PositionBefore(iPosFind);
-				if (before + 1 == iPosFind) {
-					const int chPrev = SciCall_GetCharAt(before);
-					// word after escape character or format specifier
-					if (chPrev == '%' || chPrev == pLexCurrent->escapeCharacterStart) {
-						if (IsEscapeCharOrFormatSpecifier(before, static_cast<uint8_t>(pWord[0]), chPrev, style, false)) {
-							pWord++;
-							--wordLength;
-						}
-					}
-				}
-				if (prefix && prefix == pWord[0]) {
-					pWord++;
-					--wordLength;
-				}
-
-				//if (pLexCurrent->iLexer == SCLEX_PHPSCRIPT && wordLength >= 2 && pWord[0] == '$' && pWord[1] == '$') {
-				//	pWord++;
-				//	--wordLength;
-				//}
-				while (wordLength > 0 && (pWord[wordLength - 1] == '-' || pWord[wordLength - 1] == ':' || pWord[wordLength - 1] == '.')) {
-					--wordLength;
-					pWord[wordLength] = '\0';
+				if (index == iCurrentPos) {
+					pos = wordEnd;
+					continue;
 				}
+			}
+			const int style = SciCall_GetStyleIndexAt(pos);
+			if (!BitTestEx(ignoredStyleMask, style)) {
+				wordEnd = AutoC_AddDocWordAt(pWList, pos, wordEnd, iDocLen, style, 1, '\0');
+			}
+			pos = wordEnd;
+		}
+		return;
+	}
 
-				if (wordLength >= iRootLen && (pWord[0] != ':' || pWord[1] == ':') && pWList.StartsWith(pWord)) {
-					bool space = false;
-					if (!(pLexCurrent->iLexer == SCLEX_CPP && style == SCE_C_MACRO)) {
-						while (IsASpaceOrTab(SciCall_GetCharAt(wordEnd))) {
-							space = true;
-							wordEnd++;
-						}
-					}
-
-					const int chWordEnd = SciCall_GetCharAt(wordEnd);
-					if ((pLexCurrent->iLexer == SCLEX_JULIA || pLexCurrent->iLexer == SCLEX_RUST) && chWordEnd == '!') {
-						const int chNext = SciCall_GetCharAt(wordEnd + 1);
-						if (chNext == '(') {
-							wordEnd += 2;
-							pWord[wordLength++] = '!';
-							pWord[wordLength++] = '(';
-							pWord[wordLength++] = ')';
-						}
-					}
-					else if (chWordEnd == '(') {
-						if (space && NeedSpaceAfterKeyword(pWord, wordLength)) {
-							pWord[wordLength++] = ' ';
-						}
-
-						pWord[wordLength++] = '(';
-						pWord[wordLength++] = ')';
-						wordEnd++;
-					}
+	Sci_TextToFindFull ft = { { iStartPos, iEndPos }, pFind.data(), { 0, 0 } };
 
-					if (wordLength >= iRootLen) {
-						pWord[wordLength] = '\0';
-						pWList.AddWord(pWord, wordLength);
-						if (bSubWord) {
-							pWList.AddSubWord(pWord, wordLength, iRootLen);
-						}
-					}
-				}
-			}
+	Sci_Position iPosFind = SciCall_FindTextFull(findFlag, &ft);
+	while (iPosFind >= 0 && iPosFind < iEndPos && timer.Continue()) {
+		Sci_Position wordEnd = iPosFind + iRootLen;
+		const int style = SciCall_GetStyleIndexAt(wordEnd - 1);
+		wordEnd = ft.chrgText.cpMax;
+		if (iPosFind != iCurrentPos && !BitTestEx(ignoredStyleMask, style)) {
+			wordEnd = AutoC_AddDocWordAt(pWList, iPosFind, wordEnd, iDocLen, style, iRootLen, prefix);
 		}
 
 		ft.chrg.cpMin = wordEnd;
@@ -1615,11 +2913,11 @@ static bool EditCompleteWordCore(int iCondition, bool autoInsert) noexcept {
 	watch.Start();
 #endif
 
-	bool bIgnoreLexer = (autoCompletionConfig.iCompleteOption & AutoCompletionOption_OnlyWordsInDocument) != 0
-		|| (pRoot[0] >= '0' && pRoot[0] <= '9'); // number
+	const bool bNumber = pRoot[0] >= '0' && pRoot[0] <= '9';
+	bool bIgnoreLexer = (autoCompletionConfig.iCompleteOption & AutoCompletionOption_OnlyWordsInDocument) != 0 || bNumber;
 	const bool bIgnoreCase = bIgnoreLexer || autoCompletionConfig.bIgnoreCase;
 	WordList pWList;
-	pWList.Init(pRoot.data(), iRootLen, bIgnoreCase);
+	pWList.Init(pRoot.data(), iRootLen, bIgnoreCase, autoCompletionConfig.bFuzzyMatch && !bNumber);
 	bool bIgnoreDoc = false;
 	char prefix = '\0';
 
@@ -1719,6 +3017,7 @@ static bool EditCompleteWordCore(int iCondition, bool autoInsert) noexcept {
 		}
 	}
 
+	pWList.Finish();
 #if 0
 	watch.Stop();
 	const double elapsed = watch.Get();
@@ -1726,7 +3025,7 @@ static bool EditCompleteWordCore(int iCondition, bool autoInsert) noexcept {
 #endif
 
 	const bool bShow = pWList.nWordCount > 0 && !(pWList.nWordCount == 1 && pWList.nTotalLen == static_cast<UINT>(iRootLen + 1));
-	const bool bUpdated = (autoCompletionConfig.iPreviousItemCount == 0)
+	const bool bUpdated = (autoCompletionConfig.iPreviousItemCount == 0) || pWList.bFuzzy
 		// deleted some words. leave some words that no longer matches current input at the top.
 		|| (iCondition == AutoCompleteCondition_OnCharAdded && autoCompletionConfig.iPreviousItemCount - pWList.nWordCount > autoCompletionConfig.iVisibleItemCount)
 		// added some words. TODO: check top matched items before updating, if top items not changed, delay the update.
@@ -1736,7 +3035,9 @@ static bool EditCompleteWordCore(int iCondition, bool autoInsert) noexcept {
 		autoCompletionConfig.iPreviousItemCount = pWList.nWordCount;
 		char *pList = pWList.GetList();
 		SciCall_AutoCSetOptions(SC_AUTOCOMPLETE_FIXED_SIZE);
-		//SciCall_AutoCSetOrder(SC_ORDER_PRESORTED); // pre-sorted is default
+		// fuzzy matched words are ranked by score, the list is kept when typed word is not a prefix.
+		SciCall_AutoCSetOrder(pWList.bFuzzy ? SC_ORDER_CUSTOM : SC_ORDER_PRESORTED);
+		SciCall_AutoCSetAutoHide(!pWList.bFuzzy);
 		SciCall_AutoCSetIgnoreCase(bIgnoreCase); // case sensitivity
 		SciCall_AutoCSetCaseInsensitiveBehaviour(bIgnoreCase);
 		//SciCall_AutoCSetSeparator('\n');
@@ -1755,7 +3056,7 @@ static bool EditCompleteWordCore(int iCondition, bool autoInsert) noexcept {
 }
 
 void EditCompleteWord(int iCondition, bool autoInsert) noexcept {
-	if (iCondition == AutoCompleteCondition_OnCharAdded) {
+	if (iCondition == AutoCompleteCondition_OnCharAdded && !autoCompletionConfig.bFuzzyMatch) {
 		if (autoCompletionConfig.iPreviousItemCount <= 2*autoCompletionConfig.iVisibleItemCount) {
 			return;
 		}
@@ -2022,6 +3323,26 @@ void EditAutoCloseXMLTag() noexcept {
 	}
 }
 
+// complete end tag for innermost open element after "</" typed in XML or HTML.
+bool EditAutoCloseXMLElement() noexcept {
+	const Sci_Position iCurPos = SciCall_GetCurrentPos();
+	if (iCurPos < 2 || SciCall_GetCharAt(iCurPos - 2) != '<' || IsHtmlTagChar(SciCall_GetCharAt(iCurPos))) {
+		return false;
+	}
+	const int style = SciCall_GetStyleIndexAt(iCurPos - 2);
+	if (style != SCE_H_DEFAULT && style != SCE_H_TAG && style != SCE_H_TAGUNKNOWN) {
+		return false;
+	}
+
+	char tchIns[NP2_ELEMENT_NAME_SIZE + 1];
+	if (!elementIndex.FindOpenElement(iCurPos - 2, tchIns)) {
+		return false;
+	}
+	strcat(tchIns, ">");
+	SciCall_ReplaceSel(tchIns);
+	return true;
+}
+
 enum AutoIndentType {
 	AutoIndentType_None,
 	AutoIndentType_IndentOnly,
@@ -3481,4 +4802,7 @@ void InitAutoCompletionCache(LPCEDITLEXER pLex) noexcept {
 	}
 
 	UpdateLexerExtraKeywords();
+	EditDocWordIndexReset();
+	EditSymbolIndexReset();
+	EditElementIndexReset();
 }
@@ -8,6 +8,7 @@
 #include <cstdio>
 #include "SciCall.h"
 #include "VectorISA.h"
+#include "config.h"
 #include "Helpers.h"
 #include "Notepad4.h"
 #include "Edit.h"
@@ -1046,22 +1047,68 @@ bool MaybeBinaryFile(const uint8_t *ptr, DWORD length, int *encodingFlag) noexce
 	UINT count = 0;
 	UINT mask = 0; // find two different C0 control characters
 	int result = 0;
-	while (ptr < end) {
-		const uint8_t ch = *ptr++;
-		if (IsC0ControlChar(ch)) {
-			++count;
-			mask |= 1U << ch;
-			if ((mask & (mask - 1)) != 0) {
-				result |= 2;
-			}
-			if ((count >= 8) || IsC0ControlChar(*ptr)) {
-				result |= 1;
+	// check C0 control character at p, returns true when the file is binary
+	const auto checkControl = [&](const uint8_t *p) noexcept {
+		++count;
+		mask |= 1U << *p;
+		if ((mask & (mask - 1)) != 0) {
+			result |= 2;
+		}
+		if ((count >= 8) || IsC0ControlChar(p[1])) {
+			result |= 1;
+		}
+		return result == 3;
+	};
+
+	// only visit control characters found by compare and mask on each chunk
+#if NP2_USE_AVX2
+	const __m256i vect31 = _mm256_set1_epi8(31);
+	const __m256i vect9 = _mm256_set1_epi8(9);
+	const __m256i vect4 = _mm256_set1_epi8(0x0d - 0x09);
+	while (ptr + sizeof(__m256i) <= end) {
+		const __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(ptr));
+		const __m256i control = _mm256_cmpeq_epi8(_mm256_min_epu8(chunk, vect31), chunk);
+		const __m256i offset = _mm256_sub_epi8(chunk, vect9);
+		const __m256i space = _mm256_cmpeq_epi8(_mm256_min_epu8(offset, vect4), offset);
+		uint32_t found = mm256_movemask_epi8(_mm256_andnot_si256(space, control));
+		while (found != 0) {
+			if (checkControl(ptr + np2_ctz(found))) {
+				*encodingFlag = EncodingFlag_Binary;
+				return true;
 			}
-			if (result == 3) {
+			found &= found - 1;
+		}
+		ptr += sizeof(__m256i);
+	}
+	// end NP2_USE_AVX2
+#elif NP2_USE_SSE2
+	const __m128i vect31 = _mm_set1_epi8(31);
+	const __m128i vect9 = _mm_set1_epi8(9);
+	const __m128i vect4 = _mm_set1_epi8(0x0d - 0x09);
+	while (ptr + sizeof(__m128i) <= end) {
+		const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i *>(ptr));
+		const __m128i control = _mm_cmpeq_epi8(_mm_min_epu8(chunk, vect31), chunk);
+		const __m128i offset = _mm_sub_epi8(chunk, vect9);
+		const __m128i space = _mm_cmpeq_epi8(_mm_min_epu8(offset, vect4), offset);
+		uint32_t found = mm_movemask_epi8(_mm_andnot_si128(space, control));
+		while (found != 0) {
+			if (checkControl(ptr + np2_ctz(found))) {
 				*encodingFlag = EncodingFlag_Binary;
-				break;
+				return true;
 			}
+			found &= found - 1;
+		}
+		ptr += sizeof(__m128i);
+	}
+	// end NP2_USE_SSE2
+#endif
+
+	while (ptr < end) {
+		if (IsC0ControlChar(*ptr) && checkControl(ptr)) {
+			*encodingFlag = EncodingFlag_Binary;
+			return true;
 		}
+		++ptr;
 	}
 	return result & true;
 }
@@ -1634,10 +1681,14 @@ bool IsUTF8(const char *pTest, DWORD nLength) noexcept {
 // clang -E -Xclang -fkeep-system-includes -DAVX2 z_validate.c > z_validate_avx2.c
 // clang -E -Xclang -fkeep-system-includes -DAVX512_VBMI z_validate.c > z_validate_avx512.c
 
-#if NP2_USE_AVX2
+#if NP2_USE_AVX2 || NP2_DISPATCH_AVX2
 #if defined(__GNUC__) || defined(__clang__)
+#if NP2_USE_AVX2
 __attribute__((__always_inline__)) static inline
 #else
+__attribute__((__target__("avx2"), __always_inline__)) static inline
+#endif
+#else
 static __forceinline
 #endif
 bool z_validate_vec_avx2(__m256i bytes, __m256i shifted_bytes, uint32_t *last_cont) noexcept {
@@ -1729,12 +1780,15 @@ bool z_validate_vec_avx2(__m256i bytes, __m256i shifted_bytes, uint32_t *last_co
 	return true;
 }
 
-bool IsUTF8(const char *data, DWORD length) noexcept {
+#if !NP2_USE_AVX2 && (defined(__GNUC__) || defined(__clang__))
+__attribute__((__target__("avx2")))
+#endif
+static bool z_validate_utf8_avx2(const char *data, size_t length) noexcept {
 	// Keep continuation bits from the previous iteration that carry over to
 	// each input chunk vector
 	uint32_t last_cont = 0;
 
-	uint32_t offset = 0;
+	size_t offset = 0;
 	// Deal with the input up until the last section of bytes
 	if (length >= sizeof(__m256i)) {
 		// We need a vector of the input byte stream shifted forward one byte.
@@ -1780,8 +1834,114 @@ bool IsUTF8(const char *data, DWORD length) noexcept {
 	return last_cont == 0;
 }
 
-// end NP2_USE_AVX2
-#elif NP2_USE_SSE2
+// AVX-512BW variant, vpshufb still works on 16-byte lanes, use masked load for
+// shifted bytes and the last section of bytes.
+#if NP2_USE_AVX512
+#if defined(__GNUC__) || defined(__clang__)
+__attribute__((__always_inline__)) static inline
+#else
+static __forceinline
+#endif
+#else
+#if defined(__GNUC__) || defined(__clang__)
+__attribute__((__target__("avx512f,avx512bw"), __always_inline__)) static inline
+#else
+static __forceinline
+#endif
+#endif
+bool z_validate_vec_avx512(__m512i bytes, __m512i shifted_bytes, uint64_t *last_cont) noexcept {
+#define V_TABLE_16(...)		_mm512_broadcast_i32x4(_mm_setr_epi8(__VA_ARGS__))
+	const __m512i error_1 = V_TABLE_16(
+		0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00,
+		0x01, 0x00, 0x06, 0x38
+	);
+	const __m512i error_2 = V_TABLE_16(
+		0x0B, 0x01, 0x00, 0x00,
+		0x10, 0x20, 0x20, 0x20,
+		0x20, 0x20, 0x20, 0x20,
+		0x20, 0x24, 0x20, 0x20
+	);
+	const __m512i error_3 = V_TABLE_16(
+		0x29, 0x29, 0x29, 0x29,
+		0x29, 0x29, 0x29, 0x29,
+		0x2B, 0x33, 0x35, 0x35,
+		0x31, 0x31, 0x31, 0x31
+	);
+#undef V_TABLE_16
+
+	const uint64_t high = _mm512_movepi8_mask(bytes);
+	if (!high) {
+		return *last_cont == 0;
+	}
+
+	// 64 bytes filled the mask, bits shifted out are carried to next round
+	// separately, so combine them with OR instead of add used in AVX2 variant.
+	uint64_t set = high & _mm512_movepi8_mask(_mm512_add_epi16(bytes, bytes));
+	const uint64_t cont = high ^ set;
+	uint64_t req = *last_cont | (set << 1);
+	uint64_t carry = set >> 63;
+	set &= _mm512_movepi8_mask(_mm512_slli_epi16(bytes, 2));
+	req |= set << 2;
+	carry |= set >> 62;
+	set &= _mm512_movepi8_mask(_mm512_slli_epi16(bytes, 3));
+	req |= set << 3;
+	carry |= set >> 61;
+	if (cont != req) {
+		return false;
+	}
+
+	const __m512i nibbles = _mm512_set1_epi8(0x0F);
+	const __m512i e_1 = _mm512_shuffle_epi8(error_1, _mm512_and_si512(_mm512_srli_epi16(shifted_bytes, 4), nibbles));
+	const __m512i e_2 = _mm512_shuffle_epi8(error_2, _mm512_and_si512(shifted_bytes, nibbles));
+	const __m512i e_3 = _mm512_shuffle_epi8(error_3, _mm512_and_si512(_mm512_srli_epi16(bytes, 4), nibbles));
+	if (_mm512_test_epi8_mask(_mm512_and_si512(e_1, e_2), e_3)) {
+		return false;
+	}
+
+	*last_cont = carry;
+	return true;
+}
+
+#if !NP2_USE_AVX512 && (defined(__GNUC__) || defined(__clang__))
+__attribute__((__target__("avx512f,avx512bw")))
+#endif
+static bool z_validate_utf8_avx512(const char *data, size_t length) noexcept {
+	uint64_t last_cont = 0;
+	size_t offset = 0;
+	while (offset < length) {
+		const size_t remain = length - offset;
+		const uint64_t mask = (remain >= sizeof(__m512i)) ? UINT64_MAX : ((UINT64_C(1) << remain) - 1);
+		// masked out bytes are not read, the byte before data is never accessed.
+		const uint64_t shifted_mask = (offset == 0) ? (mask << 1) : ((mask << 1) | 1);
+		const __m512i bytes = _mm512_maskz_loadu_epi8(mask, data + offset);
+		const __m512i shifted_bytes = _mm512_maskz_loadu_epi8(shifted_mask, data + offset - 1);
+		if (!z_validate_vec_avx512(bytes, shifted_bytes, &last_cont)) {
+			return false;
+		}
+		offset += sizeof(__m512i);
+	}
+	return last_cont == 0;
+}
+
+#if NP2_USE_AVX2
+static inline bool IsUTF8Block(const char *data, size_t length) noexcept {
+#if NP2_USE_AVX512
+	return z_validate_utf8_avx512(data, length);
+#else
+	if (np2_cpu_features() & NP2_CPU_FEATURE_AVX512BW) {
+		return z_validate_utf8_avx512(data, length);
+	}
+	return z_validate_utf8_avx2(data, length);
+#endif
+}
+#endif
+
+// end NP2_USE_AVX2 || NP2_DISPATCH_AVX2
+#endif
+
+#if NP2_USE_SSE2 && !NP2_USE_AVX2
 #if defined(__clang__)
 #include <tmmintrin.h>
 #endif
@@ -1886,12 +2046,12 @@ bool z_validate_vec_sse4(__m128i bytes, __m128i shifted_bytes, uint32_t *last_co
 #if defined(__GNUC__) || defined(__clang__)
 __attribute__((__target__("ssse3")))
 #endif
-static inline bool z_validate_utf8_sse4(const char *data, DWORD length) noexcept {
+static inline bool z_validate_utf8_sse4(const char *data, size_t length) noexcept {
 	// Keep continuation bits from the previous iteration that carry over to
 	// each input chunk vector
 	uint32_t last_cont = 0;
 
-	uint32_t offset = 0;
+	size_t offset = 0;
 	// Deal with the input up until the last section of bytes
 	if (length >= sizeof(__m128i)) {
 		// We need a vector of the input byte stream shifted forward one byte.
@@ -1935,12 +2095,6 @@ static inline bool z_validate_utf8_sse4(const char *data, DWORD length) noexcept
 	// The input is valid if we don't have any more expected continuation bytes
 	return last_cont == 0;
 }
-
-static inline int did_cpu_supports_ssse3() noexcept {
-	int info[4]{};
-	__cpuid(info, 0x00000001);
-	return info[2] & 0x0000200;
-}
 // end NP2_USE_SSE2
 #endif
 
@@ -1948,9 +2102,18 @@ static inline int did_cpu_supports_ssse3() noexcept {
 // See https://bjoern.hoehrmann.de/utf-8/decoder/dfa/ for details.
 
 #if !NP2_USE_AVX2
-bool IsUTF8(const char *data, DWORD length) noexcept {
+static bool IsUTF8Block(const char *data, size_t length) noexcept {
+#if NP2_DISPATCH_AVX2
+	const uint32_t features = np2_cpu_features();
+	if (features & NP2_CPU_FEATURE_AVX512BW) {
+		return z_validate_utf8_avx512(data, length);
+	}
+	if (features & NP2_CPU_FEATURE_AVX2) {
+		return z_validate_utf8_avx2(data, length);
+	}
+#endif // NP2_DISPATCH_AVX2
 #if NP2_USE_SSE2
-	if (did_cpu_supports_ssse3()) {
+	if (np2_cpu_features() & NP2_CPU_FEATURE_SSSE3) {
 		return z_validate_utf8_sse4(data, length);
 	}
 #endif // NP2_USE_SSE2
@@ -2035,6 +2198,25 @@ bool IsUTF8(const char *data, DWORD length) noexcept {
 	}
 	// end NP2_USE_SSE2
 #elif defined(_WIN64)
+#if NP2_USE_NEON
+	// skip 32 bytes of ASCII at once
+	while (pt + 2*sizeof(uint8x16_t) <= end) {
+		const uint8x16_t chunk = vorrq_u8(vld1q_u8(pt), vld1q_u8(pt + sizeof(uint8x16_t)));
+		if (vmaxvq_u8(chunk) & 0x80) {
+			const uint8_t * const stop = pt + 2*sizeof(uint8x16_t);
+			do {
+				state = utf8_dfa[256 + state + utf8_dfa[*pt++]];
+			} while (pt < stop);
+			if (state == UTF8_REJECT) {
+				return false;
+			}
+		} else if (state != UTF8_ACCEPT) {
+			return false;
+		} else {
+			pt += 2*sizeof(uint8x16_t);
+		}
+	}
+#endif
 	while (pt + sizeof(uint64_t) <= end) {
 		const uint64_t val = *(reinterpret_cast<const uint64_t *>(pt));
 		if (val & UINT64_C(0x8080808080808080)) {
@@ -2102,6 +2284,62 @@ bool IsUTF8(const char *data, DWORD length) noexcept {
 }
 #endif // !NP2_USE_AVX2
 
+// validate large input on multiple threads, each block starts at character boundary.
+#define UTF8_PARALLEL_MIN_SIZE		(64U << 20)
+#define UTF8_PARALLEL_MAX_THREAD	MAX_PARALLEL_WORKER_COUNT
+
+struct UTF8ValidateBlock {
+	const char *data;
+	size_t length;
+	bool valid;
+};
+
+static DWORD WINAPI IsUTF8Thread(LPVOID lpParam) noexcept {
+	UTF8ValidateBlock * const block = static_cast<UTF8ValidateBlock *>(lpParam);
+	block->valid = IsUTF8Block(block->data, block->length);
+	return 0;
+}
+
+bool IsUTF8(const char *data, size_t length) noexcept {
+	if (length < UTF8_PARALLEL_MIN_SIZE) {
+		return IsUTF8Block(data, length);
+	}
+
+	SYSTEM_INFO info;
+	GetSystemInfo(&info);
+	UINT count = static_cast<UINT>(min<size_t>(info.dwNumberOfProcessors, length / (UTF8_PARALLEL_MIN_SIZE / 4)));
+	count = clamp<UINT>(count, 1, UTF8_PARALLEL_MAX_THREAD);
+	if (count == 1) {
+		return IsUTF8Block(data, length);
+	}
+
+	UTF8ValidateBlock blocks[UTF8_PARALLEL_MAX_THREAD];
+	const size_t blockSize = length / count;
+	const char * const stop = data + length;
+	const char *ptr = data;
+	for (UINT i = 0; i < count; i++) {
+		const char *end = (i + 1 == count) ? stop : ptr + blockSize;
+		// move trailing bytes into current block, more than kMaxMultiByteCount
+		// trailing bytes is invalid and will be rejected by next block.
+		for (UINT k = 0; k < kMaxMultiByteCount && end < stop && (static_cast<uint8_t>(*end) & 0xC0) == 0x80; k++) {
+			++end;
+		}
+		blocks[i].data = ptr;
+		blocks[i].length = end - ptr;
+		blocks[i].valid = true;
+		ptr = end;
+	}
+
+	RunParallelWorker(IsUTF8Thread, blocks, sizeof(UTF8ValidateBlock), count);
+
+	for (UINT i = 0; i < count; i++) {
+		if (!blocks[i].valid) {
+			return false;
+		}
+	}
+	return true;
+}
+
 static const char *CheckUTF7(const char *pTest, DWORD nLength) noexcept {
 	const char *pt = pTest;
 #if NP2_USE_AVX512
@@ -2345,7 +2583,31 @@ LPSTR RecodeAsUTF8(LPSTR lpData, DWORD *cbData, UINT codePage, DWORD flags) noex
 	return lpData;
 }
 
-int EditDetermineEncoding(LPCWSTR pszFile, char *lpData, DWORD cbData, int *encodingFlag) noexcept {
+// check evenly spaced windows, full validation is done later by EditVerifyUTF8Async().
+#define UTF8_SAMPLE_COUNT	16
+#define UTF8_SAMPLE_SIZE	(64U << 10)
+
+static bool IsUTF8Sampled(const char *lpData, size_t cbData) noexcept {
+	const size_t step = (cbData - UTF8_SAMPLE_SIZE) / (UTF8_SAMPLE_COUNT - 1);
+	for (UINT i = 0; i < UTF8_SAMPLE_COUNT; i++) {
+		const char *ptr = lpData + i*step;
+		const char *end = ptr + UTF8_SAMPLE_SIZE;
+		const char * const stop = lpData + cbData;
+		// skip trailing bytes at window start, and cover whole character at window end.
+		for (UINT k = 0; k < kMaxMultiByteCount && (static_cast<uint8_t>(*ptr) & 0xC0) == 0x80; k++) {
+			++ptr;
+		}
+		for (UINT k = 0; k < kMaxMultiByteCount && end < stop && (static_cast<uint8_t>(*end) & 0xC0) == 0x80; k++) {
+			++end;
+		}
+		if (!IsUTF8(ptr, end - ptr)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+int EditDetermineEncoding(LPCWSTR pszFile, char *lpData, size_t cbData, int *encodingFlag) noexcept {
 	// TODO: scheme default encoding
 	LPCWSTR const pszExt = PathFindExtension(pszFile);
 	int preferedEncoding = CPI_NONE;
@@ -2380,10 +2642,10 @@ int EditDetermineEncoding(LPCWSTR pszFile, char *lpData, DWORD cbData, int *enco
 		return iEncoding;
 	}
 
-	// check Unicode / UTF-16 BOM
+	// check Unicode / UTF-16 BOM, large UTF-16 file is converted in parts by EditConvertUTF16ToUTF8().
 	const UINT bom = *(reinterpret_cast<const uint16_t *>(lpData));
-	if (cbData < MAX_NON_UTF8_SIZE && (Encoding_IsUnicode(iSrcEncoding) // reload as UTF-16
-		|| (iSrcEncoding < CPI_FIRST && (cbData & 1) == 0 && (bom == BOM_UTF16LE || bom == BOM_UTF16BE)))) {
+	if (Encoding_IsUnicode(iSrcEncoding) // reload as UTF-16
+		|| (iSrcEncoding < CPI_FIRST && (cbData & 1) == 0 && (bom == BOM_UTF16LE || bom == BOM_UTF16BE))) {
 		bool bBOM = iSrcEncoding < CPI_FIRST;
 		bool bReverse = bom == BOM_UTF16BE;
 		if (iSrcEncoding == CPI_UNICODE) {
@@ -2414,26 +2676,34 @@ int EditDetermineEncoding(LPCWSTR pszFile, char *lpData, DWORD cbData, int *enco
 
 	// load large file without encoding conversion, i.e. loaded as UTF-8 or ANSI only.
 	if (cbData >= MAX_NON_UTF8_SIZE) {
-		if (iSrcEncoding != CPI_DEFAULT && (utf8Sig || IsUTF8(lpData, cbData))) {
-			iEncoding = CPI_UTF8 + utf8Sig;
+		if (iSrcEncoding != CPI_DEFAULT) {
+			if (utf8Sig) {
+				iEncoding = CPI_UTF8SIGN;
+			} else if (IsUTF8Sampled(lpData, cbData)) {
+				iEncoding = CPI_UTF8;
+				*encodingFlag = EncodingFlag_Sampled;
+			}
 		}
 		return iEncoding;
 	}
 
+	// remaining detection is only applied to data less than MAX_NON_UTF8_SIZE.
+	const DWORD cbText = static_cast<DWORD>(cbData);
+
 	// check UTF-16 without BOM for Latin
-	if ((cbData & 1) == 0 && iSrcEncoding < CPI_FIRST
+	if ((cbText & 1) == 0 && iSrcEncoding < CPI_FIRST
 		// odd or even byte is lower C0 control character U+0000 to U+0007
 		&& ((bom & 0xF800) == 0 || (bom & 0x00F8) == 0)
 		&& fvCurFile.mask == 0) {
 #if 0
 		// Basic Latin and Latin-1: U+0000 to U+00FF
-		iEncoding = DetectUTF16Latin1(lpData, cbData);
+		iEncoding = DetectUTF16Latin1(lpData, cbText);
 		if (iEncoding != CPI_DEFAULT) {
 			return iEncoding;
 		}
 #endif
 		// Latin Extended-A U+0100 to NKo U+07FF
-		iEncoding = DetectUTF16LatinExt(lpData, cbData);
+		iEncoding = DetectUTF16LatinExt(lpData, cbText);
 		if (iEncoding != CPI_DEFAULT) {
 			return iEncoding;
 		}
@@ -2442,7 +2712,7 @@ int EditDetermineEncoding(LPCWSTR pszFile, char *lpData, DWORD cbData, int *enco
 	// treat as unreliable encoding declaration as we don't follow strict parse rules.
 	const int sniffedEncoding = fvCurFile.GetEncoding();
 	// check 7-bit ASCII
-	const char * const multiData = CheckUTF7(lpData, cbData);
+	const char * const multiData = CheckUTF7(lpData, cbText);
 	if (multiData == nullptr) {
 		// 7-bit / any encoding, similar to empty file
 		*encodingFlag = EncodingFlag_UTF7;
@@ -2473,8 +2743,8 @@ int EditDetermineEncoding(LPCWSTR pszFile, char *lpData, DWORD cbData, int *enco
 	}
 
 	// avoid validating initial ASCII for multi-byte encoding
-	const DWORD multiLen = static_cast<DWORD>(lpData + cbData - multiData);
-	//printf("%s initial ASCII: %u=%u - %u\n", __func__, (unsigned)(cbData - multiLen), (unsigned)cbData, (unsigned)multiLen);
+	const DWORD multiLen = static_cast<DWORD>(lpData + cbText - multiData);
+	//printf("%s initial ASCII: %u=%u - %u\n", __func__, (unsigned)(cbText - multiLen), (unsigned)cbText, (unsigned)multiLen);
 	// prefer UTF-8 when no encoding specified
 	// StopWatch watch;
 	// watch.Start();
@@ -2520,12 +2790,12 @@ int EditDetermineEncoding(LPCWSTR pszFile, char *lpData, DWORD cbData, int *enco
 		*encodingFlag = EncodingFlag_Invalid;
 	}
 	// detect binary file
-	if (MaybeBinaryFile(reinterpret_cast<const uint8_t *>(lpData), cbData, encodingFlag)) {
+	if (MaybeBinaryFile(reinterpret_cast<const uint8_t *>(lpData), cbText, encodingFlag)) {
 		tryUnicode = true;
 	}
 	// check UTF-16 without BOM
-	if (tryUnicode && (cbData & 1) == 0 && fvCurFile.mask == 0) {
-		iEncoding = DetectUnicode(lpData, cbData, bSkipUnicodeDetection);
+	if (tryUnicode && (cbText & 1) == 0 && fvCurFile.mask == 0) {
+		iEncoding = DetectUnicode(lpData, cbText, bSkipUnicodeDetection);
 		if (iEncoding != CPI_DEFAULT) {
 #if _WIN32_WINNT >= _WIN32_WINNT_VISTA
 			*encodingFlag = (iEncoding == CPI_UNICODEBE) ? EncodingFlag_Reversed : EncodingFlag_Invalid;
@@ -2539,6 +2809,255 @@ int EditDetermineEncoding(LPCWSTR pszFile, char *lpData, DWORD cbData, int *enco
 	return iEncoding;
 }
 
+#if NP2_ENABLE_ENCODING_BENCHMARK
+// Encoding detection benchmark over labelled corpus: each sub folder of pszCorpus contains files
+// of one encoding, named by encoding label (e.g. utf-8, utf-16le, gbk, shift_jis, euc-kr, iso-8859-1),
+// with "-bom" suffix for files with BOM, or "binary" for binary files.
+// Report accuracy and throughput into EncodingBenchmark-<ISA>.txt inside pszCorpus,
+// building with different NP2_USE_* targets compares SIMD variants.
+#include <cmath>
+
+#define ENCODING_BENCHMARK_ROUNDS	4
+
+#if NP2_USE_AVX512
+#define ENCODING_BENCHMARK_ISA		L"AVX512"
+#elif NP2_USE_AVX2
+#define ENCODING_BENCHMARK_ISA		L"AVX2"
+#elif NP2_USE_SSE2
+#define ENCODING_BENCHMARK_ISA		L"SSE2"
+#else
+#define ENCODING_BENCHMARK_ISA		L"Scalar"
+#endif
+
+struct EncodingBenchmarkResult {
+	UINT files;
+	UINT correct;
+	UINT utf8;			// files passed each check
+	UINT utf7;
+	UINT utf16;
+	uint64_t bytes;
+	double detectTime;	// sum of best time of each function in milliseconds
+	double utf8Time;
+	double utf7Time;
+	uint64_t utf16Bytes;
+	double utf16Time;
+};
+
+static int EncodingBenchmark_GetExpected(LPCWSTR label) noexcept {
+	if (StrCaseEqual(label, L"binary")) {
+		return CPI_NONE;
+	}
+	WCHAR name[MAX_PATH];
+	lstrcpyn(name, label, COUNTOF(name));
+	const int length = lstrlen(name);
+	const bool bom = length > 4 && StrCaseEqual(name + length - 4, L"-bom");
+	if (bom) {
+		name[length - 4] = L'\0';
+	}
+	int iEncoding = Encoding_Match(name);
+	if (iEncoding == CPI_NONE) {
+		// unknown label
+		return CPI_NONE - 1;
+	}
+	if (bom) {
+		switch (iEncoding) {
+		case CPI_UTF8:
+			iEncoding = CPI_UTF8SIGN;
+			break;
+		case CPI_UNICODE:
+			iEncoding = CPI_UNICODEBOM;
+			break;
+		case CPI_UNICODEBE:
+			iEncoding = CPI_UNICODEBEBOM;
+			break;
+		default:
+			iEncoding = CPI_NONE - 1;
+			break;
+		}
+	}
+	return iEncoding;
+}
+
+static bool EncodingBenchmark_IsCorrect(int expected, int iEncoding, int encodingFlag) noexcept {
+	if (expected == CPI_NONE) {
+		return (encodingFlag & EncodingFlag_Binary) != 0;
+	}
+	if (iEncoding == expected || (encodingFlag & EncodingFlag_UTF7) != 0) {
+		// 7-bit text is valid in any ASCII compatible encoding
+		return true;
+	}
+	if (iEncoding > CPI_UTF7 && expected > CPI_UTF7) {
+		return GetEncodingAlias(mEncoding[iEncoding].uCodePage) == GetEncodingAlias(mEncoding[expected].uCodePage);
+	}
+	return false;
+}
+
+static void EncodingBenchmark_File(LPCWSTR pszFile, int expected, EncodingBenchmarkResult &result) noexcept {
+	HANDLE hFile = CreateFile(pszFile, GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+	if (hFile == INVALID_HANDLE_VALUE) {
+		return;
+	}
+	LARGE_INTEGER fileSize;
+	char *lpData = nullptr;
+	DWORD cbData = 0;
+	if (GetFileSizeEx(hFile, &fileSize) && fileSize.QuadPart < MAX_NON_UTF8_SIZE) {
+		cbData = static_cast<DWORD>(fileSize.QuadPart);
+		lpData = static_cast<char *>(NP2HeapAlloc(cbData + NP2_ENCODING_DETECTION_PADDING));
+		DWORD cbRead = 0;
+		if (lpData != nullptr && !(ReadFile(hFile, lpData, cbData, &cbRead, nullptr) && cbRead == cbData)) {
+			NP2HeapFree(lpData);
+			lpData = nullptr;
+		}
+	}
+	CloseHandle(hFile);
+	if (lpData == nullptr) {
+		return;
+	}
+
+	// EditDetermineEncoding() may modify data, e.g. byte swap for UTF-16BE
+	char *lpTest = static_cast<char *>(NP2HeapAlloc(cbData + NP2_ENCODING_DETECTION_PADDING));
+	double detect = HUGE_VAL;
+	double utf8 = HUGE_VAL;
+	double utf7 = HUGE_VAL;
+	double utf16 = HUGE_VAL;
+	// count results of every round, so the checks are not optimized out
+	UINT utf8Count = 0;
+	UINT utf7Count = 0;
+	UINT utf16Count = 0;
+	int iEncoding = CPI_NONE;
+	int encodingFlag = EncodingFlag_None;
+	StopWatch watch;
+	for (UINT round = 0; round < ENCODING_BENCHMARK_ROUNDS; round++) {
+		memcpy(lpTest, lpData, cbData);
+		encodingFlag = EncodingFlag_None;
+		watch.Start();
+		iEncoding = EditDetermineEncoding(pszFile, lpTest, cbData, &encodingFlag);
+		watch.Stop();
+		detect = min(detect, watch.Get());
+
+		watch.Start();
+		utf8Count += IsUTF8(lpData, cbData);
+		watch.Stop();
+		utf8 = min(utf8, watch.Get());
+
+		watch.Start();
+		utf7Count += CheckUTF7(lpData, cbData) == nullptr;
+		watch.Stop();
+		utf7 = min(utf7, watch.Get());
+
+		if ((cbData & 1) == 0) {
+			watch.Start();
+			utf16Count += DetectUTF16LatinExt(lpData, cbData) != CPI_DEFAULT;
+			watch.Stop();
+			utf16 = min(utf16, watch.Get());
+		}
+	}
+
+	result.files++;
+	result.correct += EncodingBenchmark_IsCorrect(expected, iEncoding, encodingFlag);
+	result.utf8 += utf8Count == ENCODING_BENCHMARK_ROUNDS;
+	result.utf7 += utf7Count == ENCODING_BENCHMARK_ROUNDS;
+	result.utf16 += utf16Count == ENCODING_BENCHMARK_ROUNDS;
+	result.bytes += cbData;
+	result.detectTime += detect;
+	result.utf8Time += utf8;
+	result.utf7Time += utf7;
+	if ((cbData & 1) == 0) {
+		result.utf16Bytes += cbData;
+		result.utf16Time += utf16;
+	}
+	NP2HeapFree(lpTest);
+	NP2HeapFree(lpData);
+}
+
+static inline double EncodingBenchmark_Speed(uint64_t bytes, double elapsed) noexcept {
+	// MB/s, elapsed in milliseconds
+	return (elapsed > 0) ? (bytes / 1000.0) / elapsed : 0;
+}
+
+static void EncodingBenchmark_Print(FILE *fp, LPCWSTR label, const EncodingBenchmarkResult &result) noexcept {
+	const double accuracy = result.files ? 100.0 * result.correct / result.files : 0;
+	fwprintf(fp, L"%-16s %6u %6u %7.2f%% %6u %6u %6u %10.1f %10.1f %10.1f %10.1f\n", label,
+		result.files, result.correct, accuracy, result.utf8, result.utf7, result.utf16,
+		EncodingBenchmark_Speed(result.bytes, result.detectTime), EncodingBenchmark_Speed(result.bytes, result.utf8Time),
+		EncodingBenchmark_Speed(result.bytes, result.utf7Time), EncodingBenchmark_Speed(result.utf16Bytes, result.utf16Time));
+}
+
+void Encoding_Benchmark(LPCWSTR pszCorpus) noexcept {
+	const int srcEncoding = iSrcEncoding;
+	const int weakSrcEncoding = iWeakSrcEncoding;
+	iSrcEncoding = CPI_NONE;
+	iWeakSrcEncoding = CPI_NONE;
+
+	WCHAR szPath[MAX_PATH];
+	lstrcpyn(szPath, pszCorpus, COUNTOF(szPath));
+	PathAppend(szPath, L"EncodingBenchmark-" ENCODING_BENCHMARK_ISA L".txt");
+	FILE *fp = _wfopen(szPath, L"w");
+	if (fp == nullptr) {
+		return;
+	}
+	fwprintf(fp, L"%s, ANSI code page %u\n", ENCODING_BENCHMARK_ISA, GetACP());
+	// counts of files detected as UTF-8, 7-bit and UTF-16 without BOM, followed by MB/s of each function
+	fwprintf(fp, L"%-16s %6s %6s %8s %6s %6s %6s %10s %10s %10s %10s\n", L"label", L"files", L"right", L"accuracy",
+		L"UTF-8", L"7-bit", L"UTF-16", L"detect", L"IsUTF8", L"CheckUTF7", L"UTF16");
+
+	EncodingBenchmarkResult total{};
+	WIN32_FIND_DATA fdFolder;
+	lstrcpyn(szPath, pszCorpus, COUNTOF(szPath));
+	PathAppend(szPath, L"*");
+	HANDLE hFolder = FindFirstFile(szPath, &fdFolder);
+	if (hFolder != INVALID_HANDLE_VALUE) {
+		do {
+			if (!(fdFolder.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) || fdFolder.cFileName[0] == L'.') {
+				continue;
+			}
+			const int expected = EncodingBenchmark_GetExpected(fdFolder.cFileName);
+			if (expected < CPI_NONE) {
+				fwprintf(fp, L"%s: unknown encoding label\n", fdFolder.cFileName);
+				continue;
+			}
+
+			EncodingBenchmarkResult result{};
+			WIN32_FIND_DATA fdFile;
+			lstrcpyn(szPath, pszCorpus, COUNTOF(szPath));
+			PathAppend(szPath, fdFolder.cFileName);
+			PathAppend(szPath, L"*");
+			HANDLE hFile = FindFirstFile(szPath, &fdFile);
+			if (hFile != INVALID_HANDLE_VALUE) {
+				do {
+					if (!(fdFile.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY)) {
+						lstrcpyn(szPath, pszCorpus, COUNTOF(szPath));
+						PathAppend(szPath, fdFolder.cFileName);
+						PathAppend(szPath, fdFile.cFileName);
+						EncodingBenchmark_File(szPath, expected, result);
+					}
+				} while (FindNextFile(hFile, &fdFile));
+				FindClose(hFile);
+			}
+
+			EncodingBenchmark_Print(fp, fdFolder.cFileName, result);
+			total.files += result.files;
+			total.correct += result.correct;
+			total.utf8 += result.utf8;
+			total.utf7 += result.utf7;
+			total.utf16 += result.utf16;
+			total.bytes += result.bytes;
+			total.detectTime += result.detectTime;
+			total.utf8Time += result.utf8Time;
+			total.utf7Time += result.utf7Time;
+			total.utf16Bytes += result.utf16Bytes;
+			total.utf16Time += result.utf16Time;
+		} while (FindNextFile(hFolder, &fdFolder));
+		FindClose(hFolder);
+	}
+
+	EncodingBenchmark_Print(fp, L"total", total);
+	fclose(fp);
+	iSrcEncoding = srcEncoding;
+	iWeakSrcEncoding = weakSrcEncoding;
+}
+#endif
+
 // see updateCaseSensitivityBlock() in scintilla/scripts/GenerateCaseConvert.py
 //case++Autogenerated -- start of section automatically generated
 // Created with Python 3.15.0a1, Unicode 17.0.0
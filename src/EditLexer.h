@@ -50,6 +50,7 @@ enum {
 	KeywordAttr_PreSorted = 2,
 	KeywordAttr_NoLexer = 4,
 	KeywordAttr_NoAutoComp = 8,
+	KeywordAttr_Static = 16,
 };
 //Lexer Enum--Autogenerated -- end of section automatically generated
 
@@ -106,6 +107,7 @@ struct EDITLEXER {
 		bool bStyleChanged;
 		bool bUseDefaultCodeStyle;
 		int iFavoriteOrder;
+		int iStylingDuration; // nanoseconds to style 1 KiB, learned by Scintilla
 
 		const uint16_t iStyleCount;
 		const uint16_t iNameLen;
@@ -225,3 +227,14 @@ using LPCEDITLEXER = const EDITLEXER *;
 #define NP2LEX_ANSI			63196	// SCLEX_NULL		ANSI Art
 #define NP2LEX_2NDTEXTFILE	63197	// SCLEX_NULL		2nd Text File
 #define NP2LEX_GLOBAL		63200	// SCLEX_NULL		Global Styles
+
+// styles for 2nd Text File, filled by line styler when lines are laid out.
+enum {
+	LogStyle_Default = 0,
+	LogStyle_DateTime,
+	LogStyle_Error,
+	LogStyle_Warning,
+	LogStyle_Information,
+	LogStyle_Debug,
+	LogStyle_Address,
+};
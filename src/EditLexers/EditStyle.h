@@ -286,3 +286,8 @@
 #define NP2STYLE_Rule					63697
 #define NP2STYLE_Citation				63698
 #define NP2STYLE_BitField				63699
+#define NP2STYLE_LogError				63700
+#define NP2STYLE_LogWarning				63701
+#define NP2STYLE_LogInformation			63702
+#define NP2STYLE_LogDebug				63703
+#define NP2STYLE_IPAddress				63704
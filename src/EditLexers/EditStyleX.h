@@ -20,8 +20,8 @@
 		0, 0										\
 //Scheme Default Settings--Autogenerated -- end of section automatically generated
 
-#define EDITLEXER_HOLE(name, styles)	StyleTheme_Default, false, true, 0, COUNTOF(styles), CSTRLEN(name), (name), nullptr, nullptr
-#define EDITLEXER_TEXT(name, styles)	StyleTheme_Default, false, false, 0, COUNTOF(styles), CSTRLEN(name), (name), nullptr, nullptr
+#define EDITLEXER_HOLE(name, styles)	StyleTheme_Default, false, true, 0, 0, COUNTOF(styles), CSTRLEN(name), (name), nullptr, nullptr
+#define EDITLEXER_TEXT(name, styles)	StyleTheme_Default, false, false, 0, 0, COUNTOF(styles), CSTRLEN(name), (name), nullptr, nullptr
 
 #define NP2StyleX_MarginLineNumber		EDITSTYLE_HOLE(MarginLineNumber, L"Margin and Line Number")
 #define NP2StyleX_MatchingBrace			EDITSTYLE_HOLE(MatchingBrace, L"Matching Brace")
@@ -309,5 +309,10 @@
 #define NP2StyleX_Rule					EDITSTYLE_HOLE(Rule, L"Rule")
 #define NP2StyleX_Citation				EDITSTYLE_HOLE(Citation, L"Citation")
 #define NP2StyleX_BitField				EDITSTYLE_HOLE(BitField, L"Bit Field")
+#define NP2StyleX_LogError				EDITSTYLE_HOLE(LogError, L"Log Error")
+#define NP2StyleX_LogWarning			EDITSTYLE_HOLE(LogWarning, L"Log Warning")
+#define NP2StyleX_LogInformation		EDITSTYLE_HOLE(LogInformation, L"Log Information")
+#define NP2StyleX_LogDebug				EDITSTYLE_HOLE(LogDebug, L"Log Debug")
+#define NP2StyleX_IPAddress				EDITSTYLE_HOLE(IPAddress, L"IP Address")
 
 #define EDITSTYLE_DEFAULT 				{ STYLE_DEFAULT, NP2StyleX_Default, L"" }
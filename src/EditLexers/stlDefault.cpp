@@ -45,6 +45,12 @@ static EDITSTYLE Styles_Text[] = {
 
 static EDITSTYLE Styles_2ndText[] = {
 	EDITSTYLE_DEFAULT,
+	{ LogStyle_DateTime, NP2StyleX_DateTime, L"fore:#008080" },
+	{ LogStyle_Error, NP2StyleX_LogError, L"bold; fore:#FF0000" },
+	{ LogStyle_Warning, NP2StyleX_LogWarning, L"bold; fore:#E08000" },
+	{ LogStyle_Information, NP2StyleX_LogInformation, L"fore:#0000FF" },
+	{ LogStyle_Debug, NP2StyleX_LogDebug, L"fore:#808080" },
+	{ LogStyle_Address, NP2StyleX_IPAddress, L"fore:#8000FF" },
 };
 
 EDITLEXER lexTextFile = {
@@ -72,12 +72,894 @@ void DebugPrintf(const char *fmt, ...) noexcept {
 	DebugPrint(buf);
 }
 
+#if NP2_ENABLE_TRACE_LOGGING
+#include <TraceLoggingProvider.h>
+
+// name based GUID for provider name Notepad4, same as EventSource and tracelog -guid *Notepad4
+TRACELOGGING_DEFINE_PROVIDER(hTraceProvider, "Notepad4",
+	(0xf5d84de7, 0x41b5, 0x5786, 0x29, 0x35, 0x61, 0x7a, 0x7d, 0xd4, 0xbc, 0x73));
+
+void TraceProviderRegister() noexcept {
+	TraceLoggingRegister(hTraceProvider);
+}
+
+void TraceProviderUnregister() noexcept {
+	TraceLoggingUnregister(hTraceProvider);
+}
+
+bool TraceProviderEnabled() noexcept {
+	return TraceLoggingProviderEnabled(hTraceProvider, 0, 0);
+}
+
+void TraceLogFrame(LPCWSTR lexer, const FrameTrace &frame) noexcept {
+	TraceLoggingWrite(hTraceProvider, "Frame",
+		TraceLoggingWideString(lexer, "Lexer"),
+		TraceLoggingInt64(frame.paintTime, "PaintTime"),
+		TraceLoggingInt64(frame.paintLineStart, "PaintLineStart"),
+		TraceLoggingInt64(frame.paintLineEnd, "PaintLineEnd"),
+		TraceLoggingInt64(frame.wrapTime, "WrapTime"),
+		TraceLoggingInt64(frame.wrapLines, "WrapLines"),
+		TraceLoggingInt64(frame.styleTime, "StyleTime"),
+		TraceLoggingInt64(frame.styleBytes, "StyleBytes"),
+		TraceLoggingInt64(frame.idleTime, "IdleTime"));
+}
+
+void TraceLogMarkAll(int64_t start, int64_t end, int64_t matchCount, double duration) noexcept {
+	TraceLoggingWrite(hTraceProvider, "MarkAll",
+		TraceLoggingInt64(start, "Start"),
+		TraceLoggingInt64(end, "End"),
+		TraceLoggingInt64(matchCount, "MatchCount"),
+		TraceLoggingFloat64(duration, "Duration"));
+}
+
+void TraceLogFileIO(bool load, LPCWSTR path, int64_t size, double duration, bool success) noexcept {
+	// event name must be a string literal
+	if (load) {
+		TraceLoggingWrite(hTraceProvider, "FileLoad",
+			TraceLoggingWideString(path, "Path"),
+			TraceLoggingInt64(size, "Size"),
+			TraceLoggingFloat64(duration, "Duration"),
+			TraceLoggingBool(success, "Success"));
+	} else {
+		TraceLoggingWrite(hTraceProvider, "FileSave",
+			TraceLoggingWideString(path, "Path"),
+			TraceLoggingInt64(size, "Size"),
+			TraceLoggingFloat64(duration, "Duration"),
+			TraceLoggingBool(success, "Success"));
+	}
+}
+
+void TraceLogTempArena(int64_t peak, int64_t highWaterMark) noexcept {
+	TraceLoggingWrite(hTraceProvider, "TempArena",
+		TraceLoggingInt64(peak, "Peak"),
+		TraceLoggingInt64(highWaterMark, "HighWaterMark"));
+}
+#endif
+
+//=============================================================================
+//
+// Temporary arena for edit commands
+//
+namespace {
+
+struct TempArenaBlock {
+	TempArenaBlock *prev;
+	size_t size;	// including this header
+	size_t used;	// including this header
+	size_t dirty;	// memory after this is still zero filled by VirtualAlloc
+};
+
+struct TempArena {
+	TempArenaBlock *current;
+	TempArenaBlock *spare;	// one standard block kept for next command
+	size_t used;
+	size_t peak;	// peak of current outermost scope
+	size_t highWaterMark;
+	UINT depth;
+};
+
+constexpr size_t TempArenaAlignment = 16;
+constexpr size_t TempArenaBlockSize = 1024*1024;
+constexpr size_t TempArenaHeaderSize = (sizeof(TempArenaBlock) + TempArenaAlignment - 1) & ~(TempArenaAlignment - 1);
+
+thread_local TempArena tempArena;
+// large pages require SeLockMemoryPrivilege, disabled after first failure
+bool tempArenaLargePage = true;
+
+TempArenaBlock *TempArenaNewBlock(size_t size) noexcept {
+	TempArena &arena = tempArena;
+	size += TempArenaHeaderSize;
+	void *ptr = nullptr;
+	if (size <= TempArenaBlockSize) {
+		size = TempArenaBlockSize;
+		ptr = arena.spare;
+		arena.spare = nullptr;
+	} else {
+		const size_t largePage = tempArenaLargePage ? GetLargePageMinimum() : 0;
+		if (largePage != 0 && size >= largePage) {
+			const size_t sizeLarge = (size + largePage - 1) & ~(largePage - 1);
+			ptr = VirtualAlloc(nullptr, sizeLarge, MEM_COMMIT | MEM_RESERVE | MEM_LARGE_PAGES, PAGE_READWRITE);
+			if (ptr != nullptr) {
+				size = sizeLarge;
+			} else {
+				tempArenaLargePage = false;
+			}
+		}
+		if (ptr == nullptr) {
+			// allocation granularity
+			size = (size + 0xffff) & ~static_cast<size_t>(0xffff);
+		}
+	}
+	const bool reused = ptr != nullptr && size == TempArenaBlockSize;
+	if (ptr == nullptr) {
+		ptr = VirtualAlloc(nullptr, size, MEM_COMMIT | MEM_RESERVE, PAGE_READWRITE);
+		if (ptr == nullptr) {
+			return nullptr;
+		}
+	}
+	TempArenaBlock *block = static_cast<TempArenaBlock *>(ptr);
+	block->prev = arena.current;
+	block->size = size;
+	block->used = TempArenaHeaderSize;
+	if (!reused) {
+		block->dirty = TempArenaHeaderSize;
+	}
+	arena.current = block;
+	return block;
+}
+
+void TempArenaFreeBlock(TempArenaBlock *block) noexcept {
+	TempArena &arena = tempArena;
+	if (block->size == TempArenaBlockSize && arena.spare == nullptr) {
+		arena.spare = block;
+	} else {
+		VirtualFree(block, 0, MEM_RELEASE);
+	}
+}
+
+}
+
+void *TempArenaAlloc(size_t size) noexcept {
+	TempArena &arena = tempArena;
+	size = (size + TempArenaAlignment - 1) & ~(TempArenaAlignment - 1);
+	TempArenaBlock *block = arena.current;
+	if (block == nullptr || block->size - block->used < size) {
+		block = TempArenaNewBlock(size);
+		if (block == nullptr) {
+			return nullptr;
+		}
+	}
+	char * const ptr = reinterpret_cast<char *>(block) + block->used;
+	if (block->used < block->dirty) {
+		memset(ptr, 0, min(size, block->dirty - block->used));
+	}
+	block->used += size;
+	block->dirty = max(block->dirty, block->used);
+	arena.used += size;
+	arena.peak = max(arena.peak, arena.used);
+	return ptr;
+}
+
+size_t TempArenaHighWaterMark() noexcept {
+	return tempArena.highWaterMark;
+}
+
+TempArenaScope::TempArenaScope() noexcept {
+	TempArena &arena = tempArena;
+	block = arena.current;
+	blockUsed = (arena.current != nullptr) ? arena.current->used : 0;
+	used = arena.used;
+	if (arena.depth++ == 0) {
+		arena.peak = arena.used;
+	}
+}
+
+TempArenaScope::~TempArenaScope() {
+	TempArena &arena = tempArena;
+	while (arena.current != block) {
+		TempArenaBlock * const prev = arena.current->prev;
+		TempArenaFreeBlock(arena.current);
+		arena.current = prev;
+	}
+	if (arena.current != nullptr) {
+		arena.current->used = blockUsed;
+	}
+	arena.used = used;
+	if (--arena.depth == 0) {
+		if (arena.peak > arena.highWaterMark) {
+			arena.highWaterMark = arena.peak;
+		}
+		if (arena.peak != 0 && TraceProviderEnabled()) {
+			TraceLogTempArena(arena.peak, arena.highWaterMark);
+		}
+	}
+}
+
+//=============================================================================
+//
+// In-memory model of ini file
+//
+namespace {
+
+#define IniFileModelBucketCount		128
+
+// key of each node is section name, value is section content in GetPrivateProfileSection() format,
+// value is nullptr for deleted section.
+struct IniFileModel {
+	LPWSTR data;				// parsed file content, strings outside it are owned by the model
+	SIZE_T dataLength;
+	SIZE_T dataUsed;
+	IniKeyValueNode *nodeList;
+	UINT count;
+	UINT capacity;
+	bool active;
+	bool writeBack;
+	bool modified;
+	IniKeyValueNode *buckets[IniFileModelBucketCount];
+	WCHAR path[MAX_PATH];
+
+	bool Owns(LPCWSTR str) const noexcept {
+		return str >= data && str < data + dataLength;
+	}
+	void Link(IniKeyValueNode *node) noexcept;
+	IniKeyValueNode *AddNode(LPCWSTR name, LPCWSTR value) noexcept;
+	bool Parse(LPCWSTR lpszIniFile) noexcept;
+	bool LoadCache(LPCWSTR lpszCacheFile, const WIN32_FILE_ATTRIBUTE_DATA &attr) noexcept;
+	void SaveCache(LPCWSTR lpszCacheFile, const WIN32_FILE_ATTRIBUTE_DATA &attr) const noexcept;
+	bool Load(LPCWSTR lpszIniFile) noexcept;
+	void Free() noexcept;
+	bool Save() const noexcept;
+	IniKeyValueNode *Find(LPCWSTR name) const noexcept;
+	DWORD GetSection(LPCWSTR name, LPWSTR lpBuf, DWORD cchBuf) const noexcept;
+	void SetSection(LPCWSTR name, LPCWSTR value) noexcept;
+	LPCWSTR GetString(LPCWSTR name, LPCWSTR key, int &valueLen) const noexcept;
+	void SetString(LPCWSTR name, LPCWSTR key, LPCWSTR value) noexcept;
+};
+
+IniFileModel iniFileCache;
+
+// only ASCII letters are folded, other characters are skipped to match any case insensitive comparison.
+UINT IniSectionNameHash(LPCWSTR name) noexcept {
+	UINT hash = 0;
+	while (*name) {
+		UINT ch = *name++;
+		if (ch < 0x80) {
+			if (ch >= 'A' && ch <= 'Z') {
+				ch |= 0x20;
+			}
+			hash = hash*31 + ch;
+		}
+	}
+	return hash;
+}
+
+// length of string list including the final NUL.
+SIZE_T IniSectionLength(LPCWSTR lpSection) noexcept {
+	LPCWSTR p = lpSection;
+	while (*p) {
+		p = StrEnd(p) + 1;
+	}
+	return p - lpSection + 1;
+}
+
+LPWSTR IniAppendEntry(LPWSTR out, LPCWSTR key, int keyLen, LPCWSTR value, int valueLen) noexcept {
+	memcpy(out, key, keyLen*sizeof(WCHAR));
+	out += keyLen;
+	*out++ = L'=';
+	memcpy(out, value, valueLen*sizeof(WCHAR));
+	out += valueLen;
+	*out++ = L'\0';
+	return out;
+}
+
+LPWSTR IniDupString(LPCWSTR str, SIZE_T length) noexcept {
+	LPWSTR copy = static_cast<LPWSTR>(NP2HeapAlloc((length + 1)*sizeof(WCHAR)));
+	if (copy != nullptr) {
+		memcpy(copy, str, length*sizeof(WCHAR));
+	}
+	return copy;
+}
+
+constexpr bool IsIniSpace(WCHAR ch) noexcept {
+	return ch == L' ' || ch == L'\t';
+}
+
+void IniFileModel::Link(IniKeyValueNode *node) noexcept {
+	IniKeyValueNode **link = &buckets[node->hash % IniFileModelBucketCount];
+	while (*link != nullptr) {
+		// first section wins when section is duplicated
+		if ((*link)->hash == node->hash && StrCaseEqual((*link)->key, node->key)) {
+			return;
+		}
+		link = &(*link)->next;
+	}
+	node->next = nullptr;
+	*link = node;
+}
+
+IniKeyValueNode *IniFileModel::AddNode(LPCWSTR name, LPCWSTR value) noexcept {
+	if (count == capacity) {
+		const UINT newCapacity = capacity*2 + 16;
+		IniKeyValueNode *list = static_cast<IniKeyValueNode *>(NP2HeapAlloc(newCapacity*sizeof(IniKeyValueNode)));
+		if (list == nullptr) {
+			return nullptr;
+		}
+		if (nodeList != nullptr) {
+			memcpy(list, nodeList, count*sizeof(IniKeyValueNode));
+			NP2HeapFree(nodeList);
+		}
+		nodeList = list;
+		capacity = newCapacity;
+		memset(buckets, 0, sizeof(buckets));
+		for (UINT i = 0; i < count; i++) {
+			Link(&nodeList[i]);
+		}
+	}
+
+	IniKeyValueNode *node = &nodeList[count++];
+	node->hash = IniSectionNameHash(name);
+	node->key = name;
+	node->value = value;
+	Link(node);
+	return node;
+}
+
+bool IniFileModel::Parse(LPCWSTR lpszIniFile) noexcept {
+	HANDLE hFile = CreateFile(lpszIniFile,
+					   GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+					   nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+	if (hFile == INVALID_HANDLE_VALUE) {
+		return false;
+	}
+
+	LARGE_INTEGER fileSize;
+	fileSize.QuadPart = 0;
+	LPWSTR text = nullptr;
+	DWORD cbData = 0;
+	// only UTF-16LE file with BOM is cached, other files are read as ANSI by profile API.
+	bool success = GetFileSizeEx(hFile, &fileSize) && fileSize.QuadPart >= 2 && fileSize.QuadPart <= 64*1024*1024;
+	if (success) {
+		text = static_cast<LPWSTR>(NP2HeapAlloc(static_cast<SIZE_T>(fileSize.QuadPart) + sizeof(WCHAR)));
+		success = text != nullptr && ReadFile(hFile, text, static_cast<DWORD>(fileSize.QuadPart), &cbData, nullptr)
+			&& cbData >= sizeof(WCHAR) && text[0] == 0xFEFF;
+	}
+	CloseHandle(hFile);
+
+	const SIZE_T cchText = cbData / sizeof(WCHAR);
+	if (success) {
+		// every line is not shorter than its parsed content plus NUL, header line is not shorter than name plus two NUL.
+		dataLength = cchText + 4;
+		data = static_cast<LPWSTR>(NP2HeapAlloc(dataLength*sizeof(WCHAR)));
+		success = data != nullptr;
+	}
+	if (!success) {
+		if (text != nullptr) {
+			NP2HeapFree(text);
+		}
+		return false;
+	}
+
+	LPCWSTR p = text + 1;
+	LPCWSTR const end = text + cchText;
+	LPWSTR out = data;
+	bool inSection = false;
+	while (p < end) {
+		LPCWSTR lineEnd = p;
+		while (lineEnd < end && *lineEnd != L'\r' && *lineEnd != L'\n') {
+			++lineEnd;
+		}
+		LPCWSTR const next = lineEnd + (lineEnd < end);
+		while (p < lineEnd && IsIniSpace(*p)) {
+			++p;
+		}
+		while (lineEnd > p && IsIniSpace(lineEnd[-1])) {
+			--lineEnd;
+		}
+		if (p < lineEnd) {
+			if (*p == L'[') {
+				if (inSection) {
+					*out++ = L'\0';
+				}
+				++p;
+				LPCWSTR nameEnd = p;
+				while (nameEnd < lineEnd && *nameEnd != L']') {
+					++nameEnd;
+				}
+				while (p < nameEnd && IsIniSpace(*p)) {
+					++p;
+				}
+				while (nameEnd > p && IsIniSpace(nameEnd[-1])) {
+					--nameEnd;
+				}
+				LPWSTR name = out;
+				memcpy(out, p, (nameEnd - p)*sizeof(WCHAR));
+				out += nameEnd - p;
+				*out++ = L'\0';
+				inSection = AddNode(name, out) != nullptr;
+			} else {
+				if (!inSection) {
+					// lines before first section
+					*out = L'\0';
+					inSection = AddNode(out, out + 1) != nullptr;
+					++out;
+				}
+				if (inSection) {
+					LPCWSTR value = static_cast<LPCWSTR>(wmemchr(p, L'=', lineEnd - p));
+					if (value != nullptr) {
+						LPCWSTR keyEnd = value++;
+						while (keyEnd > p && IsIniSpace(keyEnd[-1])) {
+							--keyEnd;
+						}
+						while (value < lineEnd && IsIniSpace(*value)) {
+							++value;
+						}
+						memcpy(out, p, (keyEnd - p)*sizeof(WCHAR));
+						out += keyEnd - p;
+						*out++ = L'=';
+						p = value;
+					}
+					memcpy(out, p, (lineEnd - p)*sizeof(WCHAR));
+					out += lineEnd - p;
+					*out++ = L'\0';
+				}
+			}
+		}
+		p = next;
+	}
+	if (inSection) {
+		*out++ = L'\0';
+	}
+
+	NP2HeapFree(text);
+	dataUsed = out - data;
+	return true;
+}
+
+// binary cache contains parsed file content, it's used when size and last write time of the ini file are unchanged.
+#define IniFileCacheMagic		0x4334504EU		// 'NP4C'
+#define IniFileCacheVersion		1
+#define IniFileCacheExtension	L".cache"
+
+struct IniFileCacheHeader {
+	UINT magic;
+	UINT version;
+	DWORD nFileSizeHigh;
+	DWORD nFileSizeLow;
+	FILETIME ftLastWriteTime;
+	UINT hash;
+	UINT cchData;
+};
+
+UINT IniFileCacheHash(LPCWSTR data, SIZE_T length) noexcept {
+	UINT hash = 0;
+	for (SIZE_T i = 0; i < length; i++) {
+		hash = hash*31 + data[i];
+	}
+	return hash;
+}
+
+bool IniFileModel::LoadCache(LPCWSTR lpszCacheFile, const WIN32_FILE_ATTRIBUTE_DATA &attr) noexcept {
+	HANDLE hFile = CreateFile(lpszCacheFile,
+					   GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+					   nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+	if (hFile == INVALID_HANDLE_VALUE) {
+		return false;
+	}
+
+	IniFileCacheHeader header;
+	DWORD cbData = 0;
+	bool success = ReadFile(hFile, &header, sizeof(header), &cbData, nullptr) && cbData == sizeof(header)
+		&& header.magic == IniFileCacheMagic && header.version == IniFileCacheVersion
+		&& header.nFileSizeHigh == attr.nFileSizeHigh && header.nFileSizeLow == attr.nFileSizeLow
+		&& CompareFileTime(&header.ftLastWriteTime, &attr.ftLastWriteTime) == 0
+		&& header.cchData != 0 && header.cchData <= 64*1024*1024;
+	if (success) {
+		dataLength = header.cchData;
+		data = static_cast<LPWSTR>(NP2HeapAlloc(dataLength*sizeof(WCHAR)));
+		const DWORD cbCache = header.cchData*sizeof(WCHAR);
+		success = data != nullptr && ReadFile(hFile, data, cbCache, &cbData, nullptr) && cbData == cbCache
+			&& data[dataLength - 1] == L'\0' && IniFileCacheHash(data, dataLength) == header.hash;
+	}
+	CloseHandle(hFile);
+	if (!success) {
+		return false;
+	}
+
+	// each section is name, NUL, entries and NUL
+	LPCWSTR p = data;
+	LPCWSTR const end = data + dataLength;
+	while (p < end) {
+		LPCWSTR name = p;
+		p = StrEnd(p) + 1;
+		LPCWSTR value = p;
+		while (p < end && *p) {
+			p = StrEnd(p) + 1;
+		}
+		if (p == end || AddNode(name, value) == nullptr) {
+			return false;
+		}
+		++p;
+	}
+	dataUsed = dataLength;
+	return true;
+}
+
+void IniFileModel::SaveCache(LPCWSTR lpszCacheFile, const WIN32_FILE_ATTRIBUTE_DATA &attr) const noexcept {
+	HANDLE hFile = CreateFile(lpszCacheFile, GENERIC_WRITE, 0, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NOT_CONTENT_INDEXED, nullptr);
+	if (hFile == INVALID_HANDLE_VALUE) {
+		return;
+	}
+
+	IniFileCacheHeader header;
+	header.magic = IniFileCacheMagic;
+	header.version = IniFileCacheVersion;
+	header.nFileSizeHigh = attr.nFileSizeHigh;
+	header.nFileSizeLow = attr.nFileSizeLow;
+	header.ftLastWriteTime = attr.ftLastWriteTime;
+	header.hash = IniFileCacheHash(data, dataUsed);
+	header.cchData = static_cast<UINT>(dataUsed);
+
+	DWORD dwWritten = 0;
+	const DWORD cbData = static_cast<DWORD>(dataUsed*sizeof(WCHAR));
+	const bool success = WriteFile(hFile, &header, sizeof(header), &dwWritten, nullptr)
+		&& WriteFile(hFile, data, cbData, &dwWritten, nullptr) && dwWritten == cbData;
+	CloseHandle(hFile);
+	if (!success) {
+		DeleteFile(lpszCacheFile);
+	}
+}
+
+bool IniFileModel::Load(LPCWSTR lpszIniFile) noexcept {
+	WIN32_FILE_ATTRIBUTE_DATA attr;
+	if (!GetFileAttributesEx(lpszIniFile, GetFileExInfoStandard, &attr)) {
+		return false;
+	}
+
+	WCHAR szCacheFile[MAX_PATH + COUNTOF(IniFileCacheExtension)];
+	lstrcpy(szCacheFile, lpszIniFile);
+	lstrcat(szCacheFile, IniFileCacheExtension);
+	if (!LoadCache(szCacheFile, attr)) {
+		Free();
+		if (!Parse(lpszIniFile)) {
+			return false;
+		}
+		if (dataUsed != 0) {
+			SaveCache(szCacheFile, attr);
+		}
+	}
+
+	lstrcpyn(path, lpszIniFile, COUNTOF(path));
+	active = true;
+	modified = false;
+	return true;
+}
+
+void IniFileModel::Free() noexcept {
+	for (UINT i = 0; i < count; i++) {
+		const IniKeyValueNode &node = nodeList[i];
+		if (!Owns(node.key)) {
+			NP2HeapFree(const_cast<LPWSTR>(node.key));
+		}
+		if (node.value != nullptr && !Owns(node.value)) {
+			NP2HeapFree(const_cast<LPWSTR>(node.value));
+		}
+	}
+	if (nodeList != nullptr) {
+		NP2HeapFree(nodeList);
+	}
+	if (data != nullptr) {
+		NP2HeapFree(data);
+	}
+	memset(this, 0, sizeof(IniFileModel));
+}
+
+// write whole file into a temporary file, then replace the ini file with it.
+bool IniFileModel::Save() const noexcept {
+	SIZE_T cchText = 1;
+	for (UINT i = 0; i < count; i++) {
+		const IniKeyValueNode &node = nodeList[i];
+		if (node.value != nullptr) {
+			// [name]\r\n, key=value\r\n, blank line
+			cchText += lstrlen(node.key) + 6 + IniSectionLength(node.value)*2;
+		}
+	}
+
+	LPWSTR text = static_cast<LPWSTR>(NP2HeapAlloc(cchText*sizeof(WCHAR)));
+	if (text == nullptr) {
+		return false;
+	}
+	LPWSTR out = text;
+	*out++ = 0xFEFF;
+	for (UINT i = 0; i < count; i++) {
+		const IniKeyValueNode &node = nodeList[i];
+		if (node.value == nullptr || (*node.key == L'\0' && *node.value == L'\0')) {
+			continue;
+		}
+		if (out != text + 1) {
+			*out++ = L'\r';
+			*out++ = L'\n';
+		}
+		if (*node.key != L'\0' || i != 0) {
+			const int len = lstrlen(node.key);
+			*out++ = L'[';
+			memcpy(out, node.key, len*sizeof(WCHAR));
+			out += len;
+			*out++ = L']';
+			*out++ = L'\r';
+			*out++ = L'\n';
+		}
+		LPCWSTR p = node.value;
+		while (*p) {
+			const int len = lstrlen(p);
+			memcpy(out, p, len*sizeof(WCHAR));
+			out += len;
+			*out++ = L'\r';
+			*out++ = L'\n';
+			p += len + 1;
+		}
+	}
+
+	WCHAR szFolder[MAX_PATH];
+	WCHAR szTempFile[MAX_PATH];
+	lstrcpy(szFolder, path);
+	PathRemoveFileSpec(szFolder);
+	bool success = GetTempFileName(szFolder, L"np4", 0, szTempFile) != 0;
+	if (success) {
+		HANDLE hFile = CreateFile(szTempFile, GENERIC_WRITE, 0, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+		success = hFile != INVALID_HANDLE_VALUE;
+		if (success) {
+			const DWORD cbData = static_cast<DWORD>((out - text)*sizeof(WCHAR));
+			DWORD dwWritten = 0;
+			success = WriteFile(hFile, text, cbData, &dwWritten, nullptr) && dwWritten == cbData;
+			CloseHandle(hFile);
+		}
+		if (success) {
+			success = ReplaceFile(path, szTempFile, nullptr, REPLACEFILE_IGNORE_MERGE_ERRORS, nullptr, nullptr)
+				|| MoveFileEx(szTempFile, path, MOVEFILE_REPLACE_EXISTING | MOVEFILE_COPY_ALLOWED);
+		}
+		if (!success) {
+			DeleteFile(szTempFile);
+		}
+	}
+	NP2HeapFree(text);
+	return success;
+}
+
+IniKeyValueNode *IniFileModel::Find(LPCWSTR name) const noexcept {
+	const UINT hash = IniSectionNameHash(name);
+	IniKeyValueNode *node = buckets[hash % IniFileModelBucketCount];
+	while (node != nullptr) {
+		if (node->hash == hash && StrCaseEqual(node->key, name)) {
+			return node;
+		}
+		node = node->next;
+	}
+	return nullptr;
+}
+
+// same as GetPrivateProfileSection(), the result is truncated to whole entries.
+DWORD IniFileModel::GetSection(LPCWSTR name, LPWSTR lpBuf, DWORD cchBuf) const noexcept {
+	const IniKeyValueNode *node = Find(name);
+	LPCWSTR p = (node == nullptr) ? nullptr : node->value;
+	DWORD length = 0;
+	if (p != nullptr) {
+		while (*p) {
+			const DWORD len = lstrlen(p) + 1;
+			if (length + len + 1 > cchBuf) {
+				break;
+			}
+			memcpy(lpBuf + length, p, len*sizeof(WCHAR));
+			length += len;
+			p += len;
+		}
+	}
+	if (cchBuf != 0) {
+		lpBuf[length] = L'\0';
+	}
+	return length;
+}
+
+void IniFileModel::SetSection(LPCWSTR name, LPCWSTR value) noexcept {
+	LPWSTR copy = nullptr;
+	if (value != nullptr) {
+		copy = IniDupString(value, IniSectionLength(value));
+		if (copy == nullptr) {
+			return;
+		}
+	}
+
+	modified = true;
+	IniKeyValueNode *node = Find(name);
+	if (node != nullptr) {
+		if (node->value != nullptr && !Owns(node->value)) {
+			NP2HeapFree(const_cast<LPWSTR>(node->value));
+		}
+		node->value = copy;
+		return;
+	}
+	if (copy != nullptr) {
+		LPWSTR key = IniDupString(name, lstrlen(name));
+		if (key == nullptr || AddNode(key, copy) == nullptr) {
+			if (key != nullptr) {
+				NP2HeapFree(key);
+			}
+			NP2HeapFree(copy);
+		}
+	}
+}
+
+LPCWSTR IniFileModel::GetString(LPCWSTR name, LPCWSTR key, int &valueLen) const noexcept {
+	const IniKeyValueNode *node = Find(name);
+	LPCWSTR p = (node == nullptr) ? nullptr : node->value;
+	if (p != nullptr) {
+		const int keyLen = lstrlen(key);
+		while (*p) {
+			const int len = lstrlen(p);
+			if (len > keyLen && p[keyLen] == L'=' && _wcsnicmp(p, key, keyLen) == 0) {
+				valueLen = len - keyLen - 1;
+				return p + keyLen + 1;
+			}
+			p += len + 1;
+		}
+	}
+	return nullptr;
+}
+
+// same as WritePrivateProfileString(), value is nullptr to delete the key.
+void IniFileModel::SetString(LPCWSTR name, LPCWSTR key, LPCWSTR value) noexcept {
+	const IniKeyValueNode *node = Find(name);
+	LPCWSTR section = (node == nullptr) ? nullptr : node->value;
+	if (section == nullptr && value == nullptr) {
+		return;
+	}
+
+	const int keyLen = lstrlen(key);
+	const int valueLen = (value == nullptr) ? 0 : lstrlen(value);
+	const SIZE_T cchOld = (section == nullptr) ? 1 : IniSectionLength(section);
+	LPWSTR buffer = static_cast<LPWSTR>(NP2HeapAlloc((cchOld + keyLen + valueLen + 2)*sizeof(WCHAR)));
+	if (buffer == nullptr) {
+		return;
+	}
+
+	LPWSTR out = buffer;
+	bool found = false;
+	if (section != nullptr) {
+		LPCWSTR p = section;
+		while (*p) {
+			const int len = lstrlen(p);
+			if (!found && len > keyLen && p[keyLen] == L'=' && _wcsnicmp(p, key, keyLen) == 0) {
+				found = true;
+				if (value != nullptr) {
+					out = IniAppendEntry(out, key, keyLen, value, valueLen);
+				}
+			} else {
+				memcpy(out, p, (len + 1)*sizeof(WCHAR));
+				out += len + 1;
+			}
+			p += len + 1;
+		}
+	}
+	if (!found && value != nullptr) {
+		out = IniAppendEntry(out, key, keyLen, value, valueLen);
+	}
+	*out = L'\0';
+	if (found || value != nullptr) {
+		SetSection(name, buffer);
+	}
+	NP2HeapFree(buffer);
+}
+
+inline IniFileModel *GetIniFileCache(LPCWSTR lpszIniFile) noexcept {
+	if (iniFileCache.active && (lpszIniFile == iniFileCache.path || PathEqual(lpszIniFile, iniFileCache.path))) {
+		return &iniFileCache;
+	}
+	return nullptr;
+}
+
+}
+
+bool IniFileBeginCache(LPCWSTR lpszIniFile, bool bWriteBack) noexcept {
+	if (iniFileCache.active || StrIsEmpty(lpszIniFile)) {
+		return false;
+	}
+	if (!iniFileCache.Load(lpszIniFile)) {
+		iniFileCache.Free();
+		return false;
+	}
+	iniFileCache.writeBack = bWriteBack;
+	return true;
+}
+
+bool IniFileEndCache() noexcept {
+	bool success = true;
+	DWORD dwError = ERROR_SUCCESS;
+	if (iniFileCache.active && iniFileCache.writeBack && iniFileCache.modified) {
+		success = iniFileCache.Save();
+		dwError = GetLastError();
+	}
+	iniFileCache.Free();
+	if (!success) {
+		SetLastError(dwError);
+	}
+	return success;
+}
+
+DWORD IniGetStringEx(LPCWSTR lpSection, LPCWSTR lpName, LPCWSTR lpDefault, LPWSTR lpReturnedString, DWORD nSize, LPCWSTR lpszIniFile) noexcept {
+	const IniFileModel *model = GetIniFileCache(lpszIniFile);
+	if (model == nullptr || lpSection == nullptr || lpName == nullptr || nSize == 0) {
+		return GetPrivateProfileString(lpSection, lpName, lpDefault, lpReturnedString, nSize, lpszIniFile);
+	}
+
+	int valueLen = 0;
+	LPCWSTR value = model->GetString(lpSection, lpName, valueLen);
+	if (value == nullptr) {
+		value = (lpDefault == nullptr) ? L"" : lpDefault;
+		valueLen = lstrlen(value);
+	} else if (valueLen > 1 && (*value == L'\"' || *value == L'\'') && value[valueLen - 1] == *value) {
+		++value;
+		valueLen -= 2;
+	}
+	valueLen = min<int>(valueLen, nSize - 1);
+	memcpy(lpReturnedString, value, valueLen*sizeof(WCHAR));
+	lpReturnedString[valueLen] = L'\0';
+	return valueLen;
+}
+
+UINT IniGetIntEx(LPCWSTR lpSection, LPCWSTR lpName, int nDefault, LPCWSTR lpszIniFile) noexcept {
+	const IniFileModel *model = GetIniFileCache(lpszIniFile);
+	if (model == nullptr) {
+		return GetPrivateProfileInt(lpSection, lpName, nDefault, lpszIniFile);
+	}
+
+	int valueLen = 0;
+	LPCWSTR value = model->GetString(lpSection, lpName, valueLen);
+	if (value == nullptr) {
+		return nDefault;
+	}
+	const int radix = (value[0] == L'0' && (value[1] | 0x20) == L'x') ? 16 : 10;
+	return static_cast<UINT>(wcstol(value, nullptr, radix));
+}
+
+BOOL IniSetStringEx(LPCWSTR lpSection, LPCWSTR lpName, LPCWSTR lpString, LPCWSTR lpszIniFile) noexcept {
+	IniFileModel *model = GetIniFileCache(lpszIniFile);
+	if (model != nullptr && lpSection != nullptr) {
+		if (lpName == nullptr) {
+			model->SetSection(lpSection, nullptr);
+		} else {
+			model->SetString(lpSection, lpName, lpString);
+		}
+		if (model->writeBack) {
+			return TRUE;
+		}
+	}
+	return WritePrivateProfileString(lpSection, lpName, lpString, lpszIniFile);
+}
+
+DWORD IniLoadSectionEx(LPCWSTR lpSection, LPWSTR lpBuf, DWORD cchBuf, LPCWSTR lpszIniFile) noexcept {
+	const IniFileModel *model = GetIniFileCache(lpszIniFile);
+	if (model != nullptr) {
+		return model->GetSection(lpSection, lpBuf, cchBuf);
+	}
+	return GetPrivateProfileSection(lpSection, lpBuf, cchBuf, lpszIniFile);
+}
+
+BOOL IniSaveSectionEx(LPCWSTR lpSection, LPCWSTR lpBuf, LPCWSTR lpszIniFile) noexcept {
+	IniFileModel *model = GetIniFileCache(lpszIniFile);
+	if (model != nullptr) {
+		model->SetSection(lpSection, lpBuf);
+		if (model->writeBack) {
+			return TRUE;
+		}
+	}
+	return WritePrivateProfileSection(lpSection, lpBuf, lpszIniFile);
+}
+
 void IniClearSectionEx(LPCWSTR lpSection, LPCWSTR lpszIniFile, bool bDelete) noexcept {
 	if (StrIsEmpty(lpszIniFile)) {
 		return; // win.ini
 	}
 
-	WritePrivateProfileSection(lpSection, (bDelete ? nullptr : L""), lpszIniFile);
+	IniSaveSectionEx(lpSection, (bDelete ? nullptr : L""), lpszIniFile);
 }
 
 void IniClearAllSectionEx(LPCWSTR lpszPrefix, LPCWSTR lpszIniFile, bool bDelete) noexcept {
@@ -85,13 +967,25 @@ void IniClearAllSectionEx(LPCWSTR lpszPrefix, LPCWSTR lpszIniFile, bool bDelete)
 		return; // win.ini
 	}
 
+	LPCWSTR value = bDelete ? nullptr : L"";
+	const int len = lstrlen(lpszPrefix);
+	IniFileModel *model = GetIniFileCache(lpszIniFile);
+	if (model != nullptr) {
+		for (UINT i = 0; i < model->count; i++) {
+			const IniKeyValueNode &node = model->nodeList[i];
+			if (node.value != nullptr && _wcsnicmp(node.key, lpszPrefix, len) == 0) {
+				model->SetSection(node.key, value);
+			}
+		}
+		if (model->writeBack) {
+			return;
+		}
+	}
+
 	WCHAR sections[1024] = L"";
 	GetPrivateProfileSectionNames(sections, COUNTOF(sections), lpszIniFile);
 
 	LPCWSTR p = sections;
-	LPCWSTR value = bDelete ? nullptr : L"";
-	const int len = lstrlen(lpszPrefix);
-
 	while (*p) {
 		if (_wcsnicmp(p, lpszPrefix, len) == 0) {
 			WritePrivateProfileSection(p, value, lpszIniFile);
@@ -473,6 +1367,31 @@ void BackgroundWorker::Destroy() noexcept {
 	CloseHandle(eventCancel);
 }
 
+void RunParallelWorker(LPTHREAD_START_ROUTINE worker, void *items, size_t itemSize, UINT count) noexcept {
+	HANDLE threads[MAX_PARALLEL_WORKER_COUNT];
+	UINT started = 0;
+	char * const ptr = static_cast<char *>(items);
+	count = min<UINT>(count, MAX_PARALLEL_WORKER_COUNT);
+	for (UINT i = 1; i < count; i++) {
+		LPVOID lpParam = ptr + i*itemSize;
+		HANDLE hThread = CreateThread(nullptr, 0, worker, lpParam, 0, nullptr);
+		if (hThread == nullptr) {
+			worker(lpParam);
+		} else {
+			threads[started++] = hThread;
+		}
+	}
+	if (count != 0) {
+		worker(items);
+	}
+	if (started != 0) {
+		WaitForMultipleObjects(started, threads, TRUE, INFINITE);
+		for (UINT i = 0; i < started; i++) {
+			CloseHandle(threads[i]);
+		}
+	}
+}
+
 //=============================================================================
 //
 // PrivateSetCurrentProcessExplicitAppUserModelID()
@@ -1763,6 +2682,28 @@ bool PathEquivalent(LPCWSTR pszPath1, LPCWSTR pszPath2) noexcept {
 	return same;
 }
 
+bool PathGetFileIdentity(LPCWSTR pszPath, FileIdentity &identity) noexcept {
+	memset(&identity, 0, sizeof(FileIdentity));
+	HANDLE hFile = CreateFile(pszPath, FILE_READ_ATTRIBUTES,
+						FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+						nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+	if (hFile == INVALID_HANDLE_VALUE) {
+		return false;
+	}
+
+	FILE_ID_INFO fileId;
+	BY_HANDLE_FILE_INFORMATION info;
+	const bool success = PathGetFileId(hFile, &fileId) && GetFileInformationByHandle(hFile, &info);
+	if (success) {
+		identity.volumeSerialNumber = fileId.VolumeSerialNumber;
+		memcpy(identity.fileId, fileId.FileId.Identifier, sizeof(identity.fileId));
+		identity.fileSize = (static_cast<int64_t>(info.nFileSizeHigh) << 32) | info.nFileSizeLow;
+		identity.ftLastWriteTime = info.ftLastWriteTime;
+	}
+	CloseHandle(hFile);
+	return success;
+}
+
 //=============================================================================
 //
 // PathRelativeToApp()
@@ -3037,6 +3978,33 @@ size_t Base64Encode(char *output, const uint8_t *src, size_t length, bool urlSaf
 
 	char *p = output;
 	size_t i = 0;
+#if NP2_USE_AVX2
+	// https://arxiv.org/abs/1704.00605 Faster Base64 Encoding and Decoding using AVX2 Instructions
+	// each 128-bit lane holds 12 input bytes, 16 bytes are loaded for each lane.
+	const __m256i shuffle = _mm256_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10,
+		1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10);
+	const __m128i offset = _mm_setr_epi8('a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+		'0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, table[62] - 62, table[63] - 63, 'A', 0, 0);
+	const __m256i shiftLUT = _mm256_broadcastsi128_si256(offset);
+	while (i + 28 <= length) {
+		const __m128i lo = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src));
+		const __m128i hi = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + 12));
+		__m256i chunk = _mm256_inserti128_si256(_mm256_castsi128_si256(lo), hi, 1);
+		chunk = _mm256_shuffle_epi8(chunk, shuffle);
+		// split 24 bits of each 32-bit element into four 6-bit indices
+		const __m256i t0 = _mm256_mulhi_epu16(_mm256_and_si256(chunk, _mm256_set1_epi32(0x0fc0fc00)), _mm256_set1_epi32(0x04000040));
+		const __m256i t1 = _mm256_mullo_epi16(_mm256_and_si256(chunk, _mm256_set1_epi32(0x003f03f0)), _mm256_set1_epi32(0x01000010));
+		const __m256i indices = _mm256_or_si256(t0, t1);
+		// map index ranges [0, 26), [26, 52), [52, 62), 62 and 63 to ASCII offsets
+		__m256i range = _mm256_subs_epu8(indices, _mm256_set1_epi8(51));
+		range = _mm256_or_si256(range, _mm256_and_si256(_mm256_cmpgt_epi8(_mm256_set1_epi8(26), indices), _mm256_set1_epi8(13)));
+		chunk = _mm256_add_epi8(indices, _mm256_shuffle_epi8(shiftLUT, range));
+		_mm256_storeu_si256(reinterpret_cast<__m256i *>(p), chunk);
+		src += 24;
+		p += 32;
+		i += 24;
+	}
+#endif
 	while (i + 3 <= length) {
 		i += 3;
 		const uint8_t C0 = *src++;
@@ -3075,6 +4043,39 @@ size_t Base64Decode(uint8_t *output, const uint8_t *src, size_t length) noexcept
 	uint32_t value = 0;
 	uint8_t *p = output;
 	size_t i = 0;
+#if NP2_USE_AVX2
+	// stop at first block contains non base64 character, remaining is handled by scalar loop
+	while (i + 32 <= length) {
+		const __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src));
+		const __m256i upper = _mm256_and_si256(_mm256_cmpgt_epi8(chunk, _mm256_set1_epi8('A' - 1)), _mm256_cmpgt_epi8(_mm256_set1_epi8('Z' + 1), chunk));
+		const __m256i lower = _mm256_and_si256(_mm256_cmpgt_epi8(chunk, _mm256_set1_epi8('a' - 1)), _mm256_cmpgt_epi8(_mm256_set1_epi8('z' + 1), chunk));
+		const __m256i digit = _mm256_and_si256(_mm256_cmpgt_epi8(chunk, _mm256_set1_epi8('0' - 1)), _mm256_cmpgt_epi8(_mm256_set1_epi8('9' + 1), chunk));
+		const __m256i plus = _mm256_or_si256(_mm256_cmpeq_epi8(chunk, _mm256_set1_epi8('+')), _mm256_cmpeq_epi8(chunk, _mm256_set1_epi8('-')));
+		const __m256i slash = _mm256_or_si256(_mm256_cmpeq_epi8(chunk, _mm256_set1_epi8('/')), _mm256_cmpeq_epi8(chunk, _mm256_set1_epi8('_')));
+		const __m256i valid = _mm256_or_si256(_mm256_or_si256(upper, lower), _mm256_or_si256(digit, _mm256_or_si256(plus, slash)));
+		if (_mm256_movemask_epi8(valid) != -1) {
+			break;
+		}
+
+		__m256i shift = _mm256_and_si256(upper, _mm256_set1_epi8(-'A'));
+		shift = _mm256_or_si256(shift, _mm256_and_si256(lower, _mm256_set1_epi8(26 - 'a')));
+		shift = _mm256_or_si256(shift, _mm256_and_si256(digit, _mm256_set1_epi8(52 - '0')));
+		shift = _mm256_or_si256(shift, _mm256_and_si256(plus, _mm256_sub_epi8(_mm256_set1_epi8(62), chunk)));
+		shift = _mm256_or_si256(shift, _mm256_and_si256(slash, _mm256_sub_epi8(_mm256_set1_epi8(63), chunk)));
+		__m256i values = _mm256_add_epi8(chunk, shift);
+		// merge four 6-bit values into 24 bits, then pack 3 bytes of each 32-bit element in big endian order
+		values = _mm256_maddubs_epi16(values, _mm256_set1_epi32(0x01400140));
+		values = _mm256_madd_epi16(values, _mm256_set1_epi32(0x00011000));
+		values = _mm256_shuffle_epi8(values, _mm256_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1,
+			2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+		values = _mm256_permutevar8x32_epi32(values, _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 3, 7));
+		_mm_storeu_si128(reinterpret_cast<__m128i *>(p), _mm256_castsi256_si128(values));
+		_mm_storel_epi64(reinterpret_cast<__m128i *>(p + 16), _mm256_extracti128_si256(values, 1));
+		src += 32;
+		p += 24;
+		i += 32;
+	}
+#endif
 	while(i < length) {
 		uint8_t ch = *src;
 		if (static_cast<signed char>(ch) < 0) {
@@ -3107,6 +4108,126 @@ size_t Base64Decode(uint8_t *output, const uint8_t *src, size_t length) noexcept
 	return p - output;
 }
 
+size_t BytesToHex(char *output, const uint8_t *src, size_t length) noexcept {
+	char *p = output;
+	const uint8_t * const end = src + length;
+#if NP2_USE_AVX2
+	// each byte is converted to two hex digits followed by a space, 16 bytes per loop.
+	const __m128i digits = _mm_setr_epi8('0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'A', 'B', 'C', 'D', 'E', 'F');
+	const __m128i nibble = _mm_set1_epi8(0x0f);
+	while (src + sizeof(__m128i) <= end) {
+		const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src));
+		const __m128i hi = _mm_shuffle_epi8(digits, _mm_and_si128(_mm_srli_epi16(chunk, 4), nibble));
+		const __m128i lo = _mm_shuffle_epi8(digits, _mm_and_si128(chunk, nibble));
+		const __m128i first = _mm_unpacklo_epi8(hi, lo);
+		const __m128i second = _mm_unpackhi_epi8(hi, lo);
+		__m128i value = _mm_shuffle_epi8(first, _mm_setr_epi8(0, 1, -1, 2, 3, -1, 4, 5, -1, 6, 7, -1, 8, 9, -1, 10));
+		value = _mm_or_si128(value, _mm_setr_epi8(0, 0, ' ', 0, 0, ' ', 0, 0, ' ', 0, 0, ' ', 0, 0, ' ', 0));
+		_mm_storeu_si128(reinterpret_cast<__m128i *>(p), value);
+		value = _mm_or_si128(_mm_shuffle_epi8(first, _mm_setr_epi8(11, -1, 12, 13, -1, 14, 15, -1, -1, -1, -1, -1, -1, -1, -1, -1)),
+			_mm_shuffle_epi8(second, _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, 0, 1, -1, 2, 3, -1, 4, 5)));
+		value = _mm_or_si128(value, _mm_setr_epi8(0, ' ', 0, 0, ' ', 0, 0, ' ', 0, 0, ' ', 0, 0, ' ', 0, 0));
+		_mm_storeu_si128(reinterpret_cast<__m128i *>(p + 16), value);
+		value = _mm_shuffle_epi8(second, _mm_setr_epi8(-1, 6, 7, -1, 8, 9, -1, 10, 11, -1, 12, 13, -1, 14, 15, -1));
+		value = _mm_or_si128(value, _mm_setr_epi8(' ', 0, 0, ' ', 0, 0, ' ', 0, 0, ' ', 0, 0, ' ', 0, 0, ' '));
+		_mm_storeu_si128(reinterpret_cast<__m128i *>(p + 32), value);
+		src += sizeof(__m128i);
+		p += 3*sizeof(__m128i);
+	}
+#endif
+	while (src < end) {
+		const uint8_t c = *src++;
+		*p++ = "0123456789ABCDEF"[c >> 4];
+		*p++ = "0123456789ABCDEF"[c & 15];
+		*p++ = ' ';
+	}
+	return p - output;
+}
+
+// RFC 3986 unreserved characters: ALPHA / DIGIT / "-" / "." / "_" / "~"
+static constexpr bool IsUrlUnreserved(uint8_t ch) noexcept {
+	return IsAlphaNumeric(ch) || ch == '-' || ch == '.' || ch == '_' || ch == '~';
+}
+
+size_t UrlEncodeComponent(char *output, const uint8_t *src, size_t length) noexcept {
+	char *p = output;
+	size_t i = 0;
+#if NP2_USE_SSE2
+	while (i + sizeof(__m128i) <= length) {
+		const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src));
+		const __m128i letter = _mm_or_si128(chunk, _mm_set1_epi8(0x20));
+		__m128i unreserved = _mm_and_si128(_mm_cmpgt_epi8(letter, _mm_set1_epi8('a' - 1)), _mm_cmpgt_epi8(_mm_set1_epi8('z' + 1), letter));
+		unreserved = _mm_or_si128(unreserved, _mm_and_si128(_mm_cmpgt_epi8(chunk, _mm_set1_epi8('0' - 1)), _mm_cmpgt_epi8(_mm_set1_epi8('9' + 1), chunk)));
+		unreserved = _mm_or_si128(unreserved, _mm_or_si128(_mm_cmpeq_epi8(chunk, _mm_set1_epi8('-')), _mm_cmpeq_epi8(chunk, _mm_set1_epi8('.'))));
+		unreserved = _mm_or_si128(unreserved, _mm_or_si128(_mm_cmpeq_epi8(chunk, _mm_set1_epi8('_')), _mm_cmpeq_epi8(chunk, _mm_set1_epi8('~'))));
+		uint32_t mask = _mm_movemask_epi8(unreserved);
+		if (mask == 0xffff) {
+			_mm_storeu_si128(reinterpret_cast<__m128i *>(p), chunk);
+			p += sizeof(__m128i);
+		} else {
+			for (uint32_t index = 0; index < sizeof(__m128i); index++, mask >>= 1) {
+				const uint8_t ch = src[index];
+				if (mask & 1) {
+					*p++ = ch;
+				} else {
+					*p++ = '%';
+					*p++ = "0123456789ABCDEF"[ch >> 4];
+					*p++ = "0123456789ABCDEF"[ch & 15];
+				}
+			}
+		}
+		src += sizeof(__m128i);
+		i += sizeof(__m128i);
+	}
+#endif
+	for (; i < length; i++) {
+		const uint8_t ch = *src++;
+		if (IsUrlUnreserved(ch)) {
+			*p++ = ch;
+		} else {
+			*p++ = '%';
+			*p++ = "0123456789ABCDEF"[ch >> 4];
+			*p++ = "0123456789ABCDEF"[ch & 15];
+		}
+	}
+	return p - output;
+}
+
+size_t UrlDecode(char *output, const char *src, size_t length) noexcept {
+	char *p = output;
+	const char * const end = src + length;
+	while (src < end) {
+#if NP2_USE_SSE2
+		// copy bytes before next '%', output never exceeds input
+		if (src + sizeof(__m128i) <= end) {
+			const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src));
+			_mm_storeu_si128(reinterpret_cast<__m128i *>(p), chunk);
+			const uint32_t mask = _mm_movemask_epi8(_mm_cmpeq_epi8(chunk, _mm_set1_epi8('%')));
+			if (mask == 0) {
+				src += sizeof(__m128i);
+				p += sizeof(__m128i);
+				continue;
+			}
+			const uint32_t trailing = np2_ctz(mask);
+			src += trailing;
+			p += trailing;
+		}
+#endif
+		const char ch = *src++;
+		if (ch == '%' && src + 2 <= end) {
+			const int hi = GetHexDigit(static_cast<uint8_t>(src[0]));
+			const int lo = GetHexDigit(static_cast<uint8_t>(src[1]));
+			if (hi >= 0 && lo >= 0) {
+				*p++ = static_cast<char>((hi << 4) | lo);
+				src += 2;
+				continue;
+			}
+		}
+		*p++ = ch;
+	}
+	return p - output;
+}
+
 /*
 
  MinimizeToTray - Copyright 2000 Matthew Ellis <m.t.ellis@bigfoot.com>
@@ -326,6 +326,44 @@ void DebugPrintf(const char *fmt, ...) noexcept __attribute__((format(printf, 1,
 void DebugPrintf(const char *fmt, ...) noexcept;
 #endif
 
+#if defined(NP2_ENABLE_TRACE_LOGGING) && NP2_ENABLE_TRACE_LOGGING && !__has_include(<TraceLoggingProvider.h>)
+#undef NP2_ENABLE_TRACE_LOGGING
+#define NP2_ENABLE_TRACE_LOGGING	0
+#endif
+
+// work done for last painted frame, times are in microseconds.
+struct FrameTrace {
+	int64_t paintTime;
+	int64_t paintLineStart;
+	int64_t paintLineEnd;
+	int64_t wrapTime;
+	int64_t wrapLines;
+	int64_t styleTime;
+	int64_t styleBytes;
+	int64_t idleTime;
+};
+
+// durations for mark all and file I/O are in milliseconds.
+#if defined(NP2_ENABLE_TRACE_LOGGING) && NP2_ENABLE_TRACE_LOGGING
+void TraceProviderRegister() noexcept;
+void TraceProviderUnregister() noexcept;
+bool TraceProviderEnabled() noexcept;
+void TraceLogFrame(LPCWSTR lexer, const FrameTrace &frame) noexcept;
+void TraceLogMarkAll(int64_t start, int64_t end, int64_t matchCount, double duration) noexcept;
+void TraceLogFileIO(bool load, LPCWSTR path, int64_t size, double duration, bool success) noexcept;
+void TraceLogTempArena(int64_t peak, int64_t highWaterMark) noexcept;
+#else
+inline void TraceProviderRegister() noexcept {}
+inline void TraceProviderUnregister() noexcept {}
+constexpr bool TraceProviderEnabled() noexcept {
+	return false;
+}
+inline void TraceLogFrame([[maybe_unused]] LPCWSTR lexer, [[maybe_unused]] const FrameTrace &frame) noexcept {}
+inline void TraceLogMarkAll([[maybe_unused]] int64_t start, [[maybe_unused]] int64_t end, [[maybe_unused]] int64_t matchCount, [[maybe_unused]] double duration) noexcept {}
+inline void TraceLogFileIO([[maybe_unused]] bool load, [[maybe_unused]] LPCWSTR path, [[maybe_unused]] int64_t size, [[maybe_unused]] double duration, [[maybe_unused]] bool success) noexcept {}
+inline void TraceLogTempArena([[maybe_unused]] int64_t peak, [[maybe_unused]] int64_t highWaterMark) noexcept {}
+#endif
+
 extern HINSTANCE g_hInstance;
 #if defined(NP2_ENABLE_APP_LOCALIZATION_DLL) && NP2_ENABLE_APP_LOCALIZATION_DLL
 extern HINSTANCE g_exeInstance;
@@ -473,12 +511,43 @@ inline int GetBitmapResourceIdForCurrentDPI(int resourceId) noexcept {
 #define NP2HeapFree(hMem)			HeapFree(g_hDefaultHeap, 0, (hMem))
 #define NP2HeapSize(hMem)			HeapSize(g_hDefaultHeap, 0, (hMem))
 
+// bump allocator for temporary buffers of an edit command, memory is zero filled like NP2HeapAlloc
+// and is released when the enclosing TempArenaScope ends, there is no per buffer free.
+// blocks are allocated with VirtualAlloc outside the process heap, big blocks use large pages
+// when the process holds SeLockMemoryPrivilege.
+void *TempArenaAlloc(size_t size) noexcept;
+// peak bytes allocated from the arena of current thread.
+size_t TempArenaHighWaterMark() noexcept;
+
+class TempArenaScope {
+	void *block;
+	size_t blockUsed;
+	size_t used;
+public:
+	TempArenaScope() noexcept;
+	~TempArenaScope();
+	TempArenaScope(const TempArenaScope &) = delete;
+	TempArenaScope &operator=(const TempArenaScope &) = delete;
+};
+
+// while cache is active, whole ini file is read once and sections are served from memory,
+// with write back cache changes are written into the file when cache ends, otherwise also written directly.
+// parsed content is kept in "<ini file>.cache", which is reused until size or last write time of the ini file changed.
+bool IniFileBeginCache(LPCWSTR lpszIniFile, bool bWriteBack) noexcept;
+bool IniFileEndCache() noexcept;
+
+DWORD IniGetStringEx(LPCWSTR lpSection, LPCWSTR lpName, LPCWSTR lpDefault, LPWSTR lpReturnedString, DWORD nSize, LPCWSTR lpszIniFile) noexcept;
+UINT IniGetIntEx(LPCWSTR lpSection, LPCWSTR lpName, int nDefault, LPCWSTR lpszIniFile) noexcept;
+BOOL IniSetStringEx(LPCWSTR lpSection, LPCWSTR lpName, LPCWSTR lpString, LPCWSTR lpszIniFile) noexcept;
+DWORD IniLoadSectionEx(LPCWSTR lpSection, LPWSTR lpBuf, DWORD cchBuf, LPCWSTR lpszIniFile) noexcept;
+BOOL IniSaveSectionEx(LPCWSTR lpSection, LPCWSTR lpBuf, LPCWSTR lpszIniFile) noexcept;
+
 #define IniGetString(lpSection, lpName, lpDefault, lpReturnedStr, nSize) \
-	GetPrivateProfileString(lpSection, lpName, lpDefault, lpReturnedStr, nSize, szIniFile)
+	IniGetStringEx(lpSection, lpName, lpDefault, lpReturnedStr, nSize, szIniFile)
 #define IniGetInt(lpSection, lpName, nDefault) \
-	GetPrivateProfileInt(lpSection, lpName, nDefault, szIniFile)
+	IniGetIntEx(lpSection, lpName, nDefault, szIniFile)
 #define IniSetString(lpSection, lpName, lpString) \
-	WritePrivateProfileString(lpSection, lpName, lpString, szIniFile)
+	IniSetStringEx(lpSection, lpName, lpString, szIniFile)
 
 void IniClearSectionEx(LPCWSTR lpSection, LPCWSTR lpszIniFile, bool bDelete) noexcept;
 #define IniClearSection(lpSection)			IniClearSectionEx((lpSection), szIniFile, false)
@@ -511,9 +580,9 @@ inline void IniSetBoolEx(LPCWSTR lpSection, LPCWSTR lpName, bool b, bool bDefaul
 }
 
 #define LoadIniSection(lpSection, lpBuf, cchBuf) \
-	GetPrivateProfileSection(lpSection, lpBuf, cchBuf, szIniFile);
+	IniLoadSectionEx(lpSection, lpBuf, cchBuf, szIniFile)
 #define SaveIniSection(lpSection, lpBuf) \
-	WritePrivateProfileSection(lpSection, lpBuf, szIniFile)
+	IniSaveSectionEx(lpSection, lpBuf, szIniFile)
 
 struct IniKeyValueNode {
 	IniKeyValueNode *next;
@@ -638,6 +707,52 @@ inline HANDLE WaitableTimer_New(DWORD milliseconds) noexcept {
 #define WaitableTimer_Continue(timer)	\
 	(WaitForSingleObject((timer), 0) != WAIT_OBJECT_0)
 
+// idle task runs at least this time before yielding to pending input
+#define IdleTaskTimer_MinimumTimeSlot		8
+
+// time slice for idle tasks scheduled by the main message loop.
+struct IdleTaskTimer {
+	HANDLE timer;
+	LONGLONG yieldTime;		// performance counter after which pending input ends the slice
+	LONGLONG minimumTicks;
+
+	void Init() noexcept {
+		timer = WaitableTimer_Create();
+		LARGE_INTEGER freq;
+		QueryPerformanceFrequency(&freq);
+		minimumTicks = freq.QuadPart*IdleTaskTimer_MinimumTimeSlot/1000;
+		yieldTime = INT64_MAX;
+	}
+	void Destroy() noexcept {
+		WaitableTimer_Destroy(timer);
+	}
+	// time limit for synchronous task, not ended by input
+	void Set(DWORD milliseconds) noexcept {
+		WaitableTimer_Set(timer, milliseconds);
+		yieldTime = INT64_MAX;
+	}
+	// time slice for background task, ended by input after minimum time slice
+	void Start(DWORD milliseconds) noexcept {
+		WaitableTimer_Set(timer, milliseconds);
+		LARGE_INTEGER now;
+		QueryPerformanceCounter(&now);
+		yieldTime = now.QuadPart + minimumTicks;
+	}
+	bool Continue() const noexcept {
+		if (!WaitableTimer_Continue(timer)) {
+			return false;
+		}
+		if (yieldTime != INT64_MAX) {
+			LARGE_INTEGER now;
+			QueryPerformanceCounter(&now);
+			if (now.QuadPart >= yieldTime && HIWORD(GetQueueStatus(QS_INPUT)) != 0) {
+				return false;
+			}
+		}
+		return true;
+	}
+};
+
 struct BackgroundWorker {
 	HWND hwnd;
 	HANDLE eventCancel;
@@ -652,6 +767,11 @@ struct BackgroundWorker {
 	}
 };
 
+// run worker for count items (each is itemSize bytes) on separate threads,
+// the first item is run on current thread, returns after all items finished.
+#define MAX_PARALLEL_WORKER_COUNT	64
+void RunParallelWorker(LPTHREAD_START_ROUTINE worker, void *items, size_t itemSize, UINT count) noexcept;
+
 HRESULT PrivateSetCurrentProcessExplicitAppUserModelID(LPCWSTR AppID) noexcept;
 bool IsElevated() noexcept;
 
@@ -845,6 +965,14 @@ inline void GetProgramRealPath(LPWSTR tchModule, DWORD nSize) noexcept {
 
 // similar to std::filesystem::equivalent()
 bool PathEquivalent(LPCWSTR pszPath1, LPCWSTR pszPath2) noexcept;
+// volume serial number and file id, with size and last write time to detect changes
+struct FileIdentity {
+	uint64_t volumeSerialNumber;
+	uint8_t fileId[16];
+	int64_t fileSize;
+	FILETIME ftLastWriteTime;
+};
+bool PathGetFileIdentity(LPCWSTR pszPath, FileIdentity &identity) noexcept;
 void PathRelativeToApp(LPCWSTR lpszSrc, LPWSTR lpszDest, DWORD dwAttrTo, BOOL bUnexpandMyDocs) noexcept;
 void PathAbsoluteFromApp(LPCWSTR lpszSrc, LPWSTR lpszDest) noexcept;
 bool PathGetLnkPath(LPCWSTR pszLnkFile, LPWSTR pszResPath);
@@ -955,6 +1083,12 @@ bool AddBackslashW(LPWSTR pszOut, LPCWSTR pszInput) noexcept;
 void EscapeRegex(LPSTR pszOut, LPCSTR pszIn) noexcept;
 size_t Base64Encode(char *output, const uint8_t *src, size_t length, bool urlSafe) noexcept;
 size_t Base64Decode(uint8_t *output, const uint8_t *src, size_t length) noexcept;
+// "HH " for each byte, output requires length*3 bytes
+size_t BytesToHex(char *output, const uint8_t *src, size_t length) noexcept;
+// percent-encode bytes outside RFC 3986 unreserved set, output requires length*3 bytes
+size_t UrlEncodeComponent(char *output, const uint8_t *src, size_t length) noexcept;
+// decode %HH escapes, output requires length bytes
+size_t UrlDecode(char *output, const char *src, size_t length) noexcept;
 
 //==== MinimizeToTray Functions - see comments in Helpers.cpp ===================
 bool GetDoAnimateMinimize() noexcept;
@@ -37,6 +37,7 @@
 #include "Styles.h"
 #include "Dialogs.h"
 #include "resource.h"
+#include "Version.h"
 
 //! show code folding level and state on line number margin
 #define NP2_DEBUG_CODE_FOLDING		0
@@ -58,6 +59,8 @@ HWND	hwndEdit;
 HWND	hwndMain;
 static HMENU hmenuMain;
 HWND	hDlgFindReplace = nullptr;
+HWND	hDlgFindAllResults = nullptr;
+HWND	hDlgFindInFiles = nullptr;
 static bool bInitDone = false;
 static HACCEL hAccMain;
 static HACCEL hAccFindReplace;
@@ -130,6 +133,7 @@ int		iWrapColumn = 0;
 int		iZoomLevel = 100;
 bool	bShowBookmarkMargin;
 static bool bShowLineNumbers;
+static int iLineNumberDigits; // digits of line count used to measure line number margin
 static int bMarkOccurrences;
 int	iChangeHistoryMarker;
 EditAutoCompletionConfig autoCompletionConfig;
@@ -176,6 +180,16 @@ bool	bResetFileWatching;
 static DWORD dwFileCheckInterval;
 static DWORD dwAutoReloadTimeout;
 unsigned int dwUrlThreshold;
+// minimum file size in MiB to load file through memory mapped view, 0 to disable.
+DWORD dwFileMappingThreshold;
+DWORD dwInPlaceSaveThreshold;
+// minimum file size in MiB to save file into temporary file then replace it, 0 to disable.
+DWORD dwAtomicSaveThreshold;
+// maximum undo text in MiB kept in memory, older text is written into temporary file, 0 for no limit.
+static DWORD dwUndoMemoryBudget;
+// show binary file as hex dump in read-only viewer instead of text.
+bool bBinaryFileHexView;
+bool bRetainFileData;
 bool bUseXPFileDialog;
 static EscFunction iEscFunction;
 static bool bAlwaysOnTop;
@@ -192,6 +206,7 @@ static bool bShowMenu;
 static bool bShowToolbar;
 static int iAutoScaleToolbar;
 static bool bShowStatusbar;
+static bool bShowPerformanceOverlay = false;
 static bool bInFullScreenMode;
 static int iFullScreenMode;
 
@@ -216,6 +231,9 @@ static LPWSTR lpFileArg = nullptr;
 static LPWSTR lpSchemeArg = nullptr;
 static LPWSTR lpMatchArg = nullptr;
 static LPWSTR lpEncodingArg = nullptr;
+#if NP2_ENABLE_ENCODING_BENCHMARK
+static LPWSTR lpEncodingBenchmarkArg = nullptr;
+#endif
 MRUList mruFile;
 MRUList mruFind;
 MRUList mruReplace;
@@ -226,6 +244,7 @@ WCHAR	szCurFile[MAX_PATH + 40];
 EditFileVars fvCurFile;
 static bool bDocumentModified = false;
 static bool bReadOnlyFile = false;
+static bool bCompressedFile = false; // document is decompressed from gzip file
 bool bReadOnlyMode = false; // save call to SciCall_GetReadOnly()
 
 // AutoSave
@@ -239,6 +258,11 @@ static bool bAutoSaveTimerSet = false;
 static LPWSTR autoSavePathList[AllAutoSaveCount];
 static int autoSaveCount = 0;
 static WCHAR szAutoSaveFolder[MAX_PATH];
+// append insert and delete operations to recovery journal
+static bool bEditJournal = false;
+// periodic backup being written on background
+struct AutoSaveWorker;
+static AutoSaveWorker *autoSaveWorker = nullptr;
 
 static Sci_Line iInitialLine;
 static Sci_Position iInitialColumn;
@@ -252,8 +276,30 @@ bool bFreezeAppTitle = false;
 static WCHAR szTitleExcerpt[128] = L"";
 static bool fKeepTitleExcerpt = false;
 
-static HANDLE hChangeHandle = nullptr;
+// overlapped ReadDirectoryChangesW() on directory of current file,
+// completion is posted to main window from thread pool wait.
+static struct DirectoryWatcher {
+	HANDLE hDirectory;
+	HANDLE hWait;
+	OVERLAPPED overlapped;
+	DWORD buffer[1024]; // FILE_NOTIFY_INFORMATION is DWORD aligned
+} dirWatcher;
+static void OnDirectoryChanged() noexcept;
 static bool bRunningWatch = false;
+
+// low memory resource notification stays signaled while memory is low,
+// the wait runs once and is armed again after a delay to release next tier of caches.
+static struct LowMemoryWatcher {
+	HANDLE hNotification;
+	HANDLE hWait;
+	int level;
+} lowMemoryWatcher;
+#define NP2_LOWMEMORY_DELAY		30000	// milliseconds, before releasing next tier
+#define NP2_BACKGROUND_DELAY	300000	// milliseconds, inactive before releasing caches
+static void LowMemoryWatcher_Arm() noexcept;
+static void LowMemoryWatcher_Start() noexcept;
+static void LowMemoryWatcher_Stop() noexcept;
+static void OnLowMemory() noexcept;
 static DWORD dwChangeNotifyTime = 0;
 
 static UINT msgTaskbarCreated = 0;
@@ -267,7 +313,7 @@ static struct WatchFileInformation {
 static EDITFINDREPLACE efrData;
 bool	bReplaceInitialized = false;
 EditMarkAll editMarkAll;
-HANDLE idleTaskTimer;
+IdleTaskTimer idleTaskTimer;
 
 static EditSortFlag iSortOptions = EditSortFlag_Ascending;
 static EditAlignMode iAlignMode	= EditAlignMode_Left;
@@ -280,6 +326,16 @@ extern int iCaretBlinkPeriod;
 bool fIsElevated = false;
 static WCHAR wchWndClass[16] = WC_NOTEPAD4;
 
+// character and column counted from line start
+struct ColumnCheckpoint {
+	Sci_Position iPos;
+	Sci_Position iChar;
+	Sci_Position iColumn;
+};
+
+#define STATUSBAR_CHECKPOINT_COUNT		128
+#define STATUSBAR_CHECKPOINT_INTERVAL	(64*1024)
+
 // rarely changed statusbar items
 struct CachedStatusItem {
 	UINT updateMask;
@@ -289,6 +345,14 @@ struct CachedStatusItem {
 	Sci_Position iLineChar;
 	Sci_Position iLineColumn;
 
+	// checkpoints inside current line, so moving caret in long line only counts from nearby position
+	DWORD dwCheckpointReversion;
+	int iCheckpointTabWidth;
+	int checkpointCount;
+	Sci_Position iCheckpointInterval;
+	ColumnCheckpoint caretCheckpoint;
+	ColumnCheckpoint checkpoints[STATUSBAR_CHECKPOINT_COUNT];
+
 	LPCWSTR pszLexerName;
 	LPCWSTR pszEncoding;
 	LPCWSTR pszEolMode;
@@ -372,6 +436,7 @@ static bool	flagPortableMyDocs		= false;
 bool		flagNoFadeHidden		= false;
 static int	iOpacityLevel			= 75;
 int			iFindReplaceOpacityLevel= 75;
+bool		bFindAsYouType			= true;
 bool		flagSimpleIndentGuides	= false;
 bool 		fNoHTMLGuess			= false;
 bool 		fNoCGIGuess				= false;
@@ -391,6 +456,82 @@ static bool	flagQuietCreate			= false;
 TripleBoolean flagUseSystemMRU		= TripleBoolean_NotSet;
 static RelaunchElevatedFlag flagRelaunchElevated = RelaunchElevatedFlag_None;
 static bool	flagDisplayHelp			= false;
+// hidden pre-initialized instance, a new launch hands its command line over to it
+static bool	bStandbyInstance		= false;
+static bool	flagStandby				= false;
+#define NP2_STANDBY_WINDOW_PROP		L"Notepad4.Standby"
+// remember caret, scroll position, bookmarks and folds of recent files
+static bool	bRestoreFileState		= false;
+static void FileStateSave() noexcept;
+// cache styles and folds of large files to avoid lexing them again on reopen
+static bool	bStyleCache				= false;
+static void StyleCacheSave() noexcept;
+static void FileStateApplyPending() noexcept;
+
+// toolbar, status bar and mark occurrences updated for SCN_UPDATEUI are coalesced
+// and run on timer, WM_TIMER is only generated when there are no other messages.
+#define NP2_UPDATEUI_DELAY		16	// milliseconds, about one frame
+enum {
+	PendingUpdateUI_Toolbar = 1,
+	PendingUpdateUI_Statusbar = 2,
+	PendingUpdateUI_MarkSelection = 4,
+	PendingUpdateUI_MarkContent = 8,
+};
+static UINT pendingUpdateUI;
+static void ScheduleUpdateUI(UINT pending) noexcept;
+static void RunPendingUpdateUI() noexcept;
+
+// startup timestamps recorded for /perf-startup, same clock as StopWatch.
+enum StartupPerf {
+	StartupPerf_Entry,
+	StartupPerf_LoadSettings,
+	StartupPerf_StyleLoad,
+	StartupPerf_CreateWindow,
+	StartupPerf_FileLoad,
+	StartupPerf_FirstPaint,
+	StartupPerf_Idle,
+	StartupPerf_Count,
+};
+
+static bool	flagPerfStartup			= false;
+static LARGE_INTEGER startupPerf[StartupPerf_Count];
+
+static inline void StartupPerfMark(StartupPerf mark) noexcept {
+	if (flagPerfStartup && startupPerf[mark].QuadPart == 0) {
+		QueryPerformanceCounter(&startupPerf[mark]);
+	}
+}
+
+// append elapsed milliseconds since process entry to %TEMP%\Notepad4-startup.log
+static void StartupPerfWriteLog() noexcept {
+	static constexpr const char *names[StartupPerf_Count] = {
+		"Entry", "LoadSettings", "StyleLoad", "CreateWindow", "FileLoad", "FirstPaint", "Idle",
+	};
+
+	LARGE_INTEGER freq;
+	QueryPerformanceFrequency(&freq);
+	char buf[512];
+	int len = 0;
+	for (int i = StartupPerf_LoadSettings; i < StartupPerf_Count; i++) {
+		const LONGLONG diff = startupPerf[i].QuadPart ? (startupPerf[i].QuadPart - startupPerf[StartupPerf_Entry].QuadPart) : 0;
+		len += sprintf(buf + len, "%s=%.3f ", names[i], (diff * 1000) / static_cast<double>(freq.QuadPart));
+	}
+	buf[len - 1] = '\n';
+	buf[len] = '\0';
+	DebugPrint(buf);
+
+	WCHAR szLogFile[MAX_PATH];
+	GetTempPath(COUNTOF(szLogFile), szLogFile);
+	PathAppend(szLogFile, WC_NOTEPAD4 L"-startup.log");
+	HANDLE hFile = CreateFile(szLogFile, FILE_APPEND_DATA, FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr, OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+	if (hFile != INVALID_HANDLE_VALUE) {
+		DWORD dwWritten;
+		buf[len - 1] = '\r';
+		buf[len] = '\n';
+		WriteFile(hFile, buf, len + 1, &dwWritten, nullptr);
+		CloseHandle(hFile);
+	}
+}
 
 static inline bool IsDocumentModified() noexcept {
 	return bDocumentModified || iCurrentEncoding != iOriginalEncoding;
@@ -435,6 +576,7 @@ static void CleanUpResources(bool initialized) noexcept {
 	}
 #endif
 	OleUninitialize();
+	TraceProviderUnregister();
 }
 
 static void DispatchMessageMain(MSG *msg) noexcept {
@@ -443,6 +585,16 @@ static void DispatchMessageMain(MSG *msg) noexcept {
 			return;
 		}
 	}
+	if (IsWindow(hDlgFindAllResults) && (msg->hwnd == hDlgFindAllResults || IsChild(hDlgFindAllResults, msg->hwnd))) {
+		if (IsDialogMessage(hDlgFindAllResults, msg)) {
+			return;
+		}
+	}
+	if (IsWindow(hDlgFindInFiles) && (msg->hwnd == hDlgFindInFiles || IsChild(hDlgFindInFiles, msg->hwnd))) {
+		if (IsDialogMessage(hDlgFindInFiles, msg)) {
+			return;
+		}
+	}
 
 	if (!TranslateAccelerator(hwndMain, hAccMain, msg)) {
 		TranslateMessage(msg);
@@ -461,6 +613,7 @@ BOOL WINAPI ConsoleHandlerRoutine(DWORD dwCtrlType) noexcept {
 int WINAPI wWinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPWSTR lpCmdLine, int nShowCmd) {
 	UNREFERENCED_PARAMETER(hPrevInstance);
 	UNREFERENCED_PARAMETER(lpCmdLine);
+	QueryPerformanceCounter(&startupPerf[StartupPerf_Entry]);
 #if 0 // used for Clang UBSan or printing debug message on console.
 	if (AttachConsole(ATTACH_PARENT_PROCESS)) {
 		SetConsoleCtrlHandler(ConsoleHandlerRoutine, TRUE);
@@ -488,6 +641,7 @@ int WINAPI wWinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPWSTR lpCmdLi
 #endif
 
 	g_hDefaultHeap = GetProcessHeap();
+	TraceProviderRegister();
 	SetErrorMode(SEM_FAILCRITICALERRORS | SEM_NOOPENFILEERRORBOX);
 
 	// Don't keep working directory locked
@@ -513,6 +667,14 @@ int WINAPI wWinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPWSTR lpCmdLi
 	FindIniFile();
 	LoadFlags();
 
+#if NP2_ENABLE_ENCODING_BENCHMARK
+	if (lpEncodingBenchmarkArg) {
+		Encoding_Benchmark(lpEncodingBenchmarkArg);
+		LocalFree(lpEncodingBenchmarkArg);
+		return 0;
+	}
+#endif
+
 	// set AppUserModelID
 	PrivateSetCurrentProcessExplicitAppUserModelID(g_wchAppUserModelID);
 
@@ -546,15 +708,22 @@ int WINAPI wWinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPWSTR lpCmdLi
 		return 0;
 	}
 
-	// Try to run multiple instances
-	if (RelaunchMultiInst()) {
-		return 0;
-	}
+	if (flagStandby) {
+		// only one standby instance
+		if (!bStandbyInstance || FindStandbyInst() != nullptr) {
+			return 0;
+		}
+	} else {
+		// Try to run multiple instances
+		if (RelaunchMultiInst()) {
+			return 0;
+		}
 
-	// Try to activate another window
-	if (ActivatePrevInst()) {
-		NP2HeapFree(lpFileArg);
-		return 0;
+		// Try to activate another window
+		if (ActivatePrevInst() || ActivateStandbyInst(nShowCmd)) {
+			NP2HeapFree(lpFileArg);
+			return 0;
+		}
 	}
 
 	// Init OLE and Common Controls
@@ -596,7 +765,8 @@ int WINAPI wWinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPWSTR lpCmdLi
 	}
 
 	// create the timer first, to make flagMatchText working.
-	HANDLE timer = idleTaskTimer = WaitableTimer_Create();
+	idleTaskTimer.Init();
+	HANDLE timer = idleTaskTimer.timer;
 	QueryPerformanceFrequency(&editMarkAll.watch.freq);
 	InitInstance(hInstance, nShowCmd);
 	hAccMain = LoadAccelerators(hInstance, MAKEINTRESOURCE(IDR_MAINWND));
@@ -604,17 +774,33 @@ int WINAPI wWinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPWSTR lpCmdLi
 	MSG msg;
 
 	while (true) {
-		if (editMarkAll.pending) {
+		if (editMarkAll.pending || bDocWordIndexPending || bSymbolIndexPending) {
+			// Scintilla's idle styling and wrapping are posted messages, so they are dispatched
+			// before the idle tasks, which then run in priority order: mark all, word index, symbol index.
 			WaitableTimer_Set(timer, WaitableTimer_IdleTaskDelayTime);
-			while (editMarkAll.pending && WaitableTimer_Continue(timer)) {
+			while ((editMarkAll.pending || bDocWordIndexPending || bSymbolIndexPending) && WaitableTimer_Continue(timer)) {
 				if (PeekMessage(&msg, nullptr, 0, 0, PM_REMOVE)) {
 					DispatchMessageMain(&msg);
+				} else {
+					// sleep until next message or the delay expired
+					MsgWaitForMultipleObjectsEx(1, &timer, INFINITE, QS_ALLINPUT, MWMO_INPUTAVAILABLE);
 				}
 			}
 			if (editMarkAll.pending) {
-				editMarkAll.Continue(timer);
+				editMarkAll.Continue(idleTaskTimer);
+			} else if (bDocWordIndexPending) {
+				EditDocWordIndexContinue(idleTaskTimer);
+			} else if (bSymbolIndexPending) {
+				EditSymbolIndexContinue(idleTaskTimer);
 			}
 		}
+		if (flagPerfStartup && !PeekMessage(&msg, nullptr, 0, 0, PM_NOREMOVE)) {
+			// message queue is empty after startup
+			StartupPerfMark(StartupPerf_Idle);
+			StartupPerfWriteLog();
+			flagPerfStartup = false;
+			PostMessage(hwndMain, WM_CLOSE, 0, 0);
+		}
 		if (GetMessage(&msg, nullptr, 0, 0)) {
 			DispatchMessageMain(&msg);
 		} else {
@@ -622,7 +808,7 @@ int WINAPI wWinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPWSTR lpCmdLi
 		}
 	}
 
-	WaitableTimer_Destroy(timer);
+	idleTaskTimer.Destroy();
 	CleanUpResources(true);
 	return static_cast<int>(msg.wParam);
 }
@@ -793,6 +979,7 @@ void InitInstance(HINSTANCE hInstance, int nCmdShow) {
 				   nullptr,
 				   hInstance,
 				   nullptr);
+	StartupPerfMark(StartupPerf_CreateWindow);
 	if (IsTopMost()) {
 		SetWindowPos(hwnd, HWND_TOPMOST, 0, 0, 0, 0, SWP_NOMOVE | SWP_NOSIZE);
 	}
@@ -802,7 +989,10 @@ void InitInstance(HINSTANCE hInstance, int nCmdShow) {
 	if (!bShowMenu) {
 		SetMenu(hwnd, nullptr);
 	}
-	if (!flagStartAsTrayIcon) {
+	if (flagStandby) {
+		// stay hidden until APPM_ACTIVATE_STANDBY
+		SetProp(hwnd, NP2_STANDBY_WINDOW_PROP, hwnd);
+	} else if (!flagStartAsTrayIcon) {
 		ShowWindow(hwnd, wi.max ? SW_SHOWMAXIMIZED : nCmdShow);
 		UpdateWindow(hwnd);
 	} else {
@@ -856,6 +1046,7 @@ void InitInstance(HINSTANCE hInstance, int nCmdShow) {
 	if (!bFileLoadCalled) {
 		bOpened = FileLoad(static_cast<FileLoadFlag>(FileLoadFlag_DontSave | FileLoadFlag_New), L"");
 	}
+	StartupPerfMark(StartupPerf_FileLoad);
 	if (!bOpened) {
 		UpdateStatusBarCache(StatusItem_Encoding);
 		UpdateStatusBarCache(StatusItem_EolMode);
@@ -945,6 +1136,9 @@ void InitInstance(HINSTANCE hInstance, int nCmdShow) {
 	if (notepadAction > NotepadReplacementAction_Default) {
 		PostMessage(hwnd, WM_COMMAND, MAKEWPARAM(IDM_FILE_PRINT, 1), notepadAction);
 	}
+	if (bStandbyInstance && !flagStandby) {
+		LaunchStandbyInst();
+	}
 
 #if 0
 	watch.Stop();
@@ -1081,6 +1275,8 @@ LRESULT CALLBACK MainWndProc(HWND hwnd, UINT umsg, WPARAM wParam, LPARAM lParam)
 		if (!bShutdownOK) {
 			editMarkAll.Stop();
 			AutoSave_Stop(TRUE);
+			// keep journal when session ends with unsaved changes
+			Journal_Stop(umsg == WM_ENDSESSION && IsDocumentModified());
 			// Terminate file watching
 			InstallFileWatching(true);
 			DragAcceptFiles(hwnd, FALSE);
@@ -1095,7 +1291,16 @@ LRESULT CALLBACK MainWndProc(HWND hwnd, UINT umsg, WPARAM wParam, LPARAM lParam)
 			if (IsWindow(hDlgFindReplace)) {
 				DestroyWindow(hDlgFindReplace);
 			}
+			if (IsWindow(hDlgFindAllResults)) {
+				DestroyWindow(hDlgFindAllResults);
+			}
+			if (IsWindow(hDlgFindInFiles)) {
+				DestroyWindow(hDlgFindInFiles);
+			}
 
+			LowMemoryWatcher_Stop();
+			FileStateSave();
+			StyleCacheSave();
 			// call SaveSettings() when hwndToolbar is still valid
 			SaveAllSettings(true);
 			bitmapCache.Empty();
@@ -1163,6 +1368,20 @@ LRESULT CALLBACK MainWndProc(HWND hwnd, UINT umsg, WPARAM wParam, LPARAM lParam)
 	case WM_TIMER:
 		if (wParam == ID_AUTOSAVETIMER) {
 			AutoSave_DoWork(FileSaveFlag_Default);
+		} else if (wParam == ID_JOURNALTIMER) {
+			Journal_Flush();
+		} else if (wParam == ID_UPDATEUITIMER) {
+			RunPendingUpdateUI();
+		} else if (wParam == ID_LOWMEMORYTIMER) {
+			KillTimer(hwnd, ID_LOWMEMORYTIMER);
+			LowMemoryWatcher_Arm();
+		} else if (wParam == ID_BACKGROUNDTIMER) {
+			KillTimer(hwnd, ID_BACKGROUNDTIMER);
+			// many windows are usually left open behind the active one,
+			// layout and position caches are rebuilt on next paint.
+			SciCall_ReleaseCaches(SC_RELEASECACHE_INDEX);
+			EditReleaseRetainedFile();
+			SetProcessWorkingSetSize(GetCurrentProcess(), static_cast<SIZE_T>(-1), static_cast<SIZE_T>(-1));
 		}
 		break;
 
@@ -1199,6 +1418,11 @@ LRESULT CALLBACK MainWndProc(HWND hwnd, UINT umsg, WPARAM wParam, LPARAM lParam)
 		if (bTransparentMode == TransparentMode_Inactive) {
 			SetWindowTransparentMode(hwnd, LOWORD(wParam) == WA_INACTIVE, iOpacityLevel);
 		}
+		if (LOWORD(wParam) == WA_INACTIVE) {
+			SetTimer(hwnd, ID_BACKGROUNDTIMER, NP2_BACKGROUND_DELAY, nullptr);
+		} else {
+			KillTimer(hwnd, ID_BACKGROUNDTIMER);
+		}
 		break;
 
 	case WM_DROPFILES:
@@ -1399,11 +1623,21 @@ LRESULT CALLBACK MainWndProc(HWND hwnd, UINT umsg, WPARAM wParam, LPARAM lParam)
 				const bool bIsTail = (iFileWatchingMode == FileWatchingMode_AutoReload)
 					&& ((iFileWatchingOption & FileWatchingOption_KeepAtEnd) || (SciCall_LineFromPosition(SciCall_GetCurrentPos()) + 1 == SciCall_GetLineCount()));
 
-				iWeakSrcEncoding = iCurrentEncoding;
-				if (FileLoad(static_cast<FileLoadFlag>(FileLoadFlag_DontSave | FileLoadFlag_Reload), szCurFile)) {
+				// only read text appended to log file
+				if (iFileWatchingMode == FileWatchingMode_AutoReload && (iFileWatchingOption & FileWatchingOption_LogFile)
+					&& !IsDocumentModified() && EditAppendFileTail(szCurFile)) {
 					if (bIsTail) {
 						EditJumpTo(INVALID_POSITION, 0);
 					}
+					UpdateStatusBarCacheLineColumn();
+					UpdateStatusbar();
+				} else {
+					iWeakSrcEncoding = iCurrentEncoding;
+					if (FileLoad(static_cast<FileLoadFlag>(FileLoadFlag_DontSave | FileLoadFlag_Reload), szCurFile)) {
+						if (bIsTail) {
+							EditJumpTo(INVALID_POSITION, 0);
+						}
+					}
 				}
 			}
 		} else {
@@ -1457,6 +1691,26 @@ LRESULT CALLBACK MainWndProc(HWND hwnd, UINT umsg, WPARAM wParam, LPARAM lParam)
 		return TranslateAccelerator(hwnd, hAccMain, &msg);
 	}
 
+	case APPM_AUTOSAVE_DONE:
+		if (AsPointer<LPVOID>(lParam) == AsVoidPointer(autoSaveWorker)) {
+			AutoSave_Finish();
+		}
+		break;
+
+	case APPM_ACTIVATE_STANDBY:
+		if (flagStandby) {
+			flagStandby = false;
+			RemoveProp(hwnd, NP2_STANDBY_WINDOW_PROP);
+			SetPriorityClass(GetCurrentProcess(), NORMAL_PRIORITY_CLASS);
+			ShowWindow(hwnd, wi.max ? SW_SHOWMAXIMIZED : static_cast<int>(wParam));
+			UpdateWindow(hwnd);
+			SetForegroundWindow(hwnd);
+			// replace this instance with a new one
+			LaunchStandbyInst();
+			return TRUE;
+		}
+		return FALSE;
+
 	case APPM_TRAYMESSAGE:
 		switch (lParam) {
 		case WM_RBUTTONUP: {
@@ -1500,6 +1754,28 @@ LRESULT CALLBACK MainWndProc(HWND hwnd, UINT umsg, WPARAM wParam, LPARAM lParam)
 	}
 	break;
 
+	case APPM_DIRECTORY_CHANGED:
+		OnDirectoryChanged();
+		break;
+
+	case APPM_COMPARE_DONE:
+		EditCompareApply();
+		break;
+
+	case APPM_LOWMEMORY:
+		OnLowMemory();
+		break;
+
+	case APPM_INVALID_UTF8:
+		if (iCurrentEncoding == CPI_UTF8 && StrNotEmpty(szCurFile) && MsgBoxWarn(MB_YESNO, IDS_INVALID_UTF8_RELOAD) == IDYES) {
+			if (IsDocumentModified() && MsgBoxWarn(MB_OKCANCEL, IDS_ASK_RECODE) != IDOK) {
+				break;
+			}
+			iSrcEncoding = CPI_DEFAULT;
+			FileLoad(static_cast<FileLoadFlag>(FileLoadFlag_DontSave | FileLoadFlag_Reload), szCurFile);
+		}
+		break;
+
 	case APPM_POST_HOTSPOTCLICK: {
 		// release mouse capture and restore selection
 		const int x = SciCall_PointXFromPosition(lParam);
@@ -1682,6 +1958,7 @@ void EditCreate(HWND hwndParent) noexcept {
 
 	Style_InitDefaultColor();
 	SciCall_SetTechnology(iRenderingTechnology);
+	SciCall_SetScrollBlit(true);
 	SciCall_SetBidirectional(iBidirectional);
 	SciCall_SetIMEInteraction(bUseInlineIME);
 	SciCall_SetPasteConvertEndings(true);
@@ -1700,6 +1977,7 @@ void EditCreate(HWND hwndParent) noexcept {
 	SciCall_SetAdditionalCaretsBlink(true);
 	SciCall_SetAdditionalCaretsVisible(true);
 	SciCall_SetIdleStyling(NP2_LEXER_IDLE_STYLING);
+	SciCall_SetBackgroundStyling(true);
 
 	SciCall_AssignCmdKey((SCK_NEXT + (SCMOD_CTRL << 16)), SCI_PARADOWN);
 	SciCall_AssignCmdKey((SCK_PRIOR + (SCMOD_CTRL << 16)), SCI_PARAUP);
@@ -1781,15 +2059,19 @@ void EditCreate(HWND hwndParent) noexcept {
 	SciCall_SetViewWS(bViewWhiteSpace ? SCWS_VISIBLEALWAYS : SCWS_INVISIBLE);
 	SciCall_SetViewEOL(bViewEOLs);
 	SciCall_SetAutoInsertMask(autoCompletionConfig.fAutoInsertMask);
+	SciCall_SetUndoMemoryBudget(static_cast<size_t>(dwUndoMemoryBudget) << 20);
 }
 
 void EditReplaceDocument(HANDLE pdoc) noexcept {
 	const UINT cpEdit = SciCall_GetCodePage();
+	const SciFnLineStyler styler = SciCall_GetLineStyler();
 	SciCall_SetDocPointer(pdoc);
 	// reduce reference count to 1
 	SciCall_ReleaseDocument(pdoc);
 	SciCall_SetCodePage(cpEdit);
+	SciCall_SetLineStyler(styler);
 	SciCall_SetEOLMode(iCurrentEOLMode);
+	SciCall_SetUndoMemoryBudget(static_cast<size_t>(dwUndoMemoryBudget) << 20);
 }
 
 //=============================================================================
@@ -1841,6 +2123,8 @@ LRESULT MsgCreate(HWND hwnd, WPARAM wParam, LPARAM lParam) noexcept {
 	mruFile.Init(MRU_KEY_RECENT_FILES, iMaxRecentFiles, flags);
 	mruFind.Init(MRU_KEY_RECENT_FIND, MRU_MAXITEMS, MRUFlags_QuoteValue);
 	mruReplace.Init(MRU_KEY_RECENT_REPLACE, MRU_MAXITEMS, MRUFlags_QuoteValue);
+
+	LowMemoryWatcher_Start();
 	return 0;
 }
 
@@ -2061,6 +2345,9 @@ void MsgThemeChanged(HWND hwnd, WPARAM wParam, LPARAM lParam) noexcept {
 void MsgSize(HWND hwnd, WPARAM wParam, LPARAM lParam) noexcept {
 	UNREFERENCED_PARAMETER(hwnd);
 	if (wParam == SIZE_MINIMIZED) {
+		// nothing is painted until restored, layouts are recreated on demand
+		SciCall_ReleaseCaches(SC_RELEASECACHE_LAYOUT);
+		SetProcessWorkingSetSize(GetCurrentProcess(), static_cast<SIZE_T>(-1), static_cast<SIZE_T>(-1));
 		return;
 	}
 
@@ -2278,6 +2565,40 @@ void MsgNotifyZoom() noexcept {
 	UpdateStatusbar();
 }
 
+static void MsgNotifyPainted() noexcept {
+	StartupPerfMark(StartupPerf_FirstPaint);
+	FileStateApplyPending();
+	const bool tracing = TraceProviderEnabled();
+	if (!tracing && !(bShowPerformanceOverlay && bShowStatusbar)) {
+		return;
+	}
+
+	const FrameTrace frame = {
+		SciCall_GetFrameStatistic(SC_FRAMESTATISTIC_PAINTTIME),
+		SciCall_GetFrameStatistic(SC_FRAMESTATISTIC_PAINTLINESTART),
+		SciCall_GetFrameStatistic(SC_FRAMESTATISTIC_PAINTLINEEND),
+		SciCall_GetFrameStatistic(SC_FRAMESTATISTIC_WRAPTIME),
+		SciCall_GetFrameStatistic(SC_FRAMESTATISTIC_WRAPLINES),
+		SciCall_GetFrameStatistic(SC_FRAMESTATISTIC_STYLETIME),
+		SciCall_GetFrameStatistic(SC_FRAMESTATISTIC_STYLEBYTES),
+		SciCall_GetFrameStatistic(SC_FRAMESTATISTIC_IDLETIME),
+	};
+	if (tracing) {
+		TraceLogFrame(pLexCurrent->pszName, frame);
+	}
+	if (bShowPerformanceOverlay && bShowStatusbar) {
+		// shown in the empty status bar item, not localized as it's only used for diagnostics
+		WCHAR tch[192];
+		swprintf(tch, COUNTOF(tch), L"Paint %.2f ms (%lld-%lld)  Wrap %.2f ms (%lld)  Style %.2f ms (%lld)  Idle %.2f ms  Layout %lld/%lld (%.1f MiB)",
+			frame.paintTime/1e3, frame.paintLineStart + 1, frame.paintLineEnd,
+			frame.wrapTime/1e3, frame.wrapLines, frame.styleTime/1e3, frame.styleBytes, frame.idleTime/1e3,
+			static_cast<long long>(SciCall_GetLayoutCacheStatistic(SC_LAYOUTCACHESTATISTIC_HITS)),
+			static_cast<long long>(SciCall_GetLayoutCacheStatistic(SC_LAYOUTCACHESTATISTIC_MISSES)),
+			SciCall_GetLayoutCacheStatistic(SC_LAYOUTCACHESTATISTIC_LONGBYTES)/(1024.0*1024));
+		StatusSetText(hwndStatus, StatusItem_Empty, tch);
+	}
+}
+
 //=============================================================================
 //
 // MsgInitMenu() - Handles WM_INITMENU
@@ -2308,8 +2629,11 @@ void MsgInitMenu(HWND hwnd, WPARAM wParam, LPARAM lParam) noexcept {
 	}
 
 	const bool changed = IsDocumentModified();
-	EnableCmd(hmenu, IDM_FILE_SAVE, changed);
-	EnableCmd(hmenu, IDM_FILE_SAVEORIGINALTIMESTAMP, changed);
+	const bool viewer = EditViewerActive();
+	EnableCmd(hmenu, IDM_FILE_SAVE, changed && !viewer);
+	EnableCmd(hmenu, IDM_FILE_SAVEORIGINALTIMESTAMP, changed && !viewer);
+	DisableCmd(hmenu, IDM_FILE_SAVEAS, viewer);
+	DisableCmd(hmenu, IDM_FILE_SAVECOPY, viewer);
 #if defined(_WIN64)
 	DisableCmd(hmenu, IDM_FILE_LARGE_FILE_MODE, bLargeFileMode);
 	DisableCmd(hmenu, IDM_FILE_LARGE_FILE_MODE_RELOAD, bLargeFileMode);
@@ -2317,6 +2641,7 @@ void MsgInitMenu(HWND hwnd, WPARAM wParam, LPARAM lParam) noexcept {
 	EnableCmd(hmenu, IDM_FILE_RELAUNCH_ELEVATED, IsVistaAndAbove() && !fIsElevated);
 	CheckCmd(hmenu, IDM_FILE_READONLY_FILE, bReadOnlyFile);
 	CheckCmd(hmenu, IDM_FILE_READONLY_MODE, bReadOnlyMode);
+	DisableCmd(hmenu, IDM_FILE_READONLY_MODE, viewer || bCompressedFile);
 
 	int i = IDM_ENCODING_ANSI - 1;
 	if (iCurrentEncoding <= CPI_UTF8SIGN) {
@@ -2491,6 +2816,7 @@ void MsgInitMenu(HWND hwnd, WPARAM wParam, LPARAM lParam) noexcept {
 	CheckCmd(hmenu, IDM_VIEW_MARGIN, bShowBookmarkMargin);
 	CheckCmd(hmenu, IDM_VIEW_CHANGE_HISTORY_MARKER, iChangeHistoryMarker);
 	CheckCmd(hmenu, IDM_VIEW_AUTOCOMPLETION_IGNORECASE, autoCompletionConfig.bIgnoreCase);
+	CheckCmd(hmenu, IDM_VIEW_AUTOCOMPLETION_FUZZYMATCH, autoCompletionConfig.bFuzzyMatch);
 	CheckCmd(hmenu, IDM_SET_LATEX_INPUT_METHOD, autoCompletionConfig.bLaTeXInputMethod);
 	CheckCmd(hmenu, IDM_SET_MULTIPLE_SELECTION, iSelectOption & SelectOption_EnableMultipleSelection);
 	CheckCmd(hmenu, IDM_SET_SELECTIONASFINDTEXT, iSelectOption & SelectOption_CopySelectionAsFindText);
@@ -2522,6 +2848,7 @@ void MsgInitMenu(HWND hwnd, WPARAM wParam, LPARAM lParam) noexcept {
 	CheckCmd(hmenu, IDM_VIEW_USE_LARGE_TOOLBAR, iAutoScaleToolbar > USER_DEFAULT_SCREEN_DPI);
 #endif
 	CheckCmd(hmenu, IDM_VIEW_STATUSBAR, bShowStatusbar);
+	CheckCmd(hmenu, CMD_PERFORMANCE_OVERLAY, bShowPerformanceOverlay);
 #if NP2_ENABLE_APP_LOCALIZATION_DLL
 	CheckMenuRadioItem(hmenu, IDM_LANG_USER_DEFAULT, IDM_LANG_LAST_LANGUAGE, languageMenu, MF_BYCOMMAND);
 #endif
@@ -2684,7 +3011,7 @@ LRESULT MsgCommand(HWND hwnd, WPARAM wParam, LPARAM lParam) {
 
 			dwFileAttributes = GetFileAttributes(szCurFile);
 			bReadOnlyFile = (dwFileAttributes != INVALID_FILE_ATTRIBUTES) && (dwFileAttributes & FILE_ATTRIBUTE_READONLY);
-			if (!bReadOnlyFile && bReadOnlyMode) {
+			if (!bReadOnlyFile && bReadOnlyMode && !bCompressedFile && !EditViewerActive()) {
 				bReadOnlyMode = false;
 				SciCall_SetReadOnly(false);
 			}
@@ -2693,6 +3020,10 @@ LRESULT MsgCommand(HWND hwnd, WPARAM wParam, LPARAM lParam) {
 		break;
 
 	case IDM_FILE_READONLY_MODE:
+		// saving decompressed text would overwrite the gzip file
+		if (EditViewerActive() || bCompressedFile) {
+			break;
+		}
 		bReadOnlyMode = !bReadOnlyMode;
 		SciCall_SetReadOnly(bReadOnlyMode);
 		UpdateWindowTitle();
@@ -3678,6 +4009,31 @@ LRESULT MsgCommand(HWND hwnd, WPARAM wParam, LPARAM lParam) {
 		EditToggleBookmarkAt(-1);
 		break;
 
+	case IDM_FILE_COMPARE: {
+		WCHAR tchFile[MAX_PATH];
+		SetStrEmpty(tchFile);
+		OPENFILENAME ofn;
+		memset(&ofn, 0, sizeof(OPENFILENAME));
+		ofn.lStructSize = sizeof(OPENFILENAME);
+		ofn.hwndOwner = hwnd;
+		ofn.lpstrFile = tchFile;
+		ofn.nMaxFile = COUNTOF(tchFile);
+		ofn.Flags = OFN_FILEMUSTEXIST | OFN_HIDEREADONLY | OFN_DONTADDTORECENT | OFN_PATHMUSTEXIST | OFN_SHAREAWARE | OFN_NOCHANGEDIR;
+		if (GetOpenFileName(&ofn)) {
+			EditCompareFile(tchFile);
+		}
+	}
+	break;
+
+	case IDM_FILE_COMPARE_NEXT:
+	case IDM_FILE_COMPARE_PREV:
+		EditCompareGoto(LOWORD(wParam) == IDM_FILE_COMPARE_NEXT);
+		break;
+
+	case IDM_FILE_COMPARE_CLEAR:
+		EditCompareClear();
+		break;
+
 	case BME_EDIT_BOOKMARKSELECT:
 		EditBookmarkSelectAll();
 		break;
@@ -3765,6 +4121,10 @@ LRESULT MsgCommand(HWND hwnd, WPARAM wParam, LPARAM lParam) {
 		EditLineNumDlg(hwndEdit);
 		break;
 
+	case IDM_EDIT_GOTOSYMBOL:
+		EditGotoSymbolDlg(hwndEdit);
+		break;
+
 	//case IDM_EDIT_NAVIGATE_BACKWARD:
 	//case IDM_EDIT_NAVIGATE_FORWARD:
 	//	break;
@@ -3888,6 +4248,11 @@ LRESULT MsgCommand(HWND hwnd, WPARAM wParam, LPARAM lParam) {
 		SciCall_AutoCCancel();
 		break;
 
+	case IDM_VIEW_AUTOCOMPLETION_FUZZYMATCH:
+		autoCompletionConfig.bFuzzyMatch = !autoCompletionConfig.bFuzzyMatch;
+		SciCall_AutoCCancel();
+		break;
+
 	case IDM_SET_LATEX_INPUT_METHOD:
 		autoCompletionConfig.bLaTeXInputMethod = !autoCompletionConfig.bLaTeXInputMethod;
 		break;
@@ -4314,6 +4679,17 @@ LRESULT MsgCommand(HWND hwnd, WPARAM wParam, LPARAM lParam) {
 		DisplayCmdLineHelp(hwnd);
 		break;
 
+	case CMD_DOCUMENT_STATISTICS:
+		DisplayDocumentStatistics();
+		break;
+
+	case CMD_PERFORMANCE_OVERLAY:
+		bShowPerformanceOverlay = !bShowPerformanceOverlay;
+		if (!bShowPerformanceOverlay) {
+			StatusSetText(hwndStatus, StatusItem_Empty, L"");
+		}
+		break;
+
 	case IDM_HELP_PROJECT_HOME:
 	case IDM_HELP_LATEST_RELEASE:
 	case IDM_HELP_LATEST_BUILD:
@@ -4511,6 +4887,13 @@ LRESULT MsgCommand(HWND hwnd, WPARAM wParam, LPARAM lParam) {
 		EditCalculateExpr(LOWORD(wParam));
 		break;
 
+	case CMD_VIEWER_PREVPART:
+	case CMD_VIEWER_NEXTPART:
+		EditViewerMovePart(LOWORD(wParam) == CMD_VIEWER_NEXTPART);
+		UpdateStatusBarCacheLineColumn();
+		UpdateStatusbar();
+		break;
+
 	case CMD_ONLINE_SEARCH_GOOGLE:
 	case CMD_ONLINE_SEARCH_BING:
 	case CMD_ONLINE_SEARCH_WIKI:
@@ -4643,8 +5026,7 @@ LRESULT MsgNotify(HWND hwnd, WPARAM wParam, LPARAM lParam) {
 		switch (pnmh->code) {
 		case SCN_UPDATEUI:
 			if (scn->updated & ~(SC_UPDATE_V_SCROLL | SC_UPDATE_H_SCROLL)) {
-				UpdateToolbar();
-
+				UINT pending = PendingUpdateUI_Toolbar;
 				if (scn->updated & SC_UPDATE_SELECTION) {
 					const int overType = scn->listType;
 					cachedStatusItem.updateMask |= (1 << StatusItem_Character) | (1 << StatusItem_Column)
@@ -4658,24 +5040,20 @@ LRESULT MsgNotify(HWND hwnd, WPARAM wParam, LPARAM lParam) {
 					// mark occurrences of text currently selected
 					if (editMarkAll.ignoreSelectionUpdate) {
 						editMarkAll.ignoreSelectionUpdate = false;
+						// selection is already marked, discard superseded update
+						pendingUpdateUI &= ~PendingUpdateUI_MarkSelection;
 					} else if (bMarkOccurrences & MarkOccurrences_Enable) {
-						if (SciCall_IsSelectionEmpty()) {
-							if (editMarkAll.matchCount) {
-								editMarkAll.Clear();
-							}
-						} else {
-							editMarkAll.MarkAll((scn->updated & SC_UPDATE_CONTENT), bMarkOccurrences);
-						}
+						pending |= PendingUpdateUI_MarkSelection;
 					}
-				} else if (scn->updated & SC_UPDATE_CONTENT) {
+				}
+				if (scn->updated & SC_UPDATE_CONTENT) {
 					// cachedStatusItem.updateMask is already set in SCN_MODIFIED.
-					if (editMarkAll.matchCount) {
-						editMarkAll.MarkAll(TRUE, bMarkOccurrences);
-					}
+					pending |= PendingUpdateUI_MarkContent;
 				}
 				if (cachedStatusItem.updateMask) {
-					UpdateStatusbar();
+					pending |= PendingUpdateUI_Statusbar;
 				}
+				ScheduleUpdateUI(pending);
 
 				// Brace Match
 				if (bMatchBraces) {
@@ -4740,6 +5118,11 @@ LRESULT MsgNotify(HWND hwnd, WPARAM wParam, LPARAM lParam) {
 					}
 					return 0;
 				}
+				if (ch == '/' && (autoCompletionConfig.iCompleteOption & AutoCompletionOption_CloseTags) != 0) {
+					if (EditAutoCloseXMLElement()) {
+						return 0;
+					}
+				}
 				// Auto close braces/quotes, see GenerateAutoInsertMask() in tools/GenerateTable.py
 				uint32_t index = ch - '\"';
 				if (index == '{' - '\"' || (index < 63 && (UINT64_C(0x4200000004000461) & (UINT64_C(1) << index)))) {
@@ -4849,11 +5232,26 @@ LRESULT MsgNotify(HWND hwnd, WPARAM wParam, LPARAM lParam) {
 			break;
 
 		case SCN_MODIFIED:
-			// we only watch SC_MOD_INSERTTEXT | SC_MOD_DELETETEXT
+			// we only watch SC_MOD_INSERTTEXT | SC_MOD_DELETETEXT,
+			// SC_MOD_BATCHUPDATE is sent once for all modifications inside batch update.
 			++dwCurrentDocReversion;
+			EditPrintInvalidatePages();
+			if (scn->modificationType & SC_MOD_BATCHUPDATE) {
+				EditDocWordIndexReset();
+				EditSymbolIndexReset();
+				EditElementIndexReset();
+				Journal_Record(SC_MOD_DELETETEXT, scn->position, scn->lengthBefore, nullptr);
+				Journal_Record(SC_MOD_INSERTTEXT, scn->position, scn->length, SciCall_GetRangePointer(scn->position, scn->length));
+			} else {
+				EditDocWordIndexModified(scn->modificationType, scn->position, scn->length, scn->linesAdded);
+				EditSymbolIndexModified(scn->modificationType, scn->position, scn->length, scn->linesAdded);
+				EditElementIndexModified(scn->modificationType, scn->position, scn->length, scn->linesAdded);
+				Journal_Record(scn->modificationType, scn->position, scn->length, scn->text);
+			}
+			EditInPlaceSaveModified(scn->modificationType, scn->position, scn->length, scn->lengthBefore);
 			UpdateStatusBarCacheLineColumn();
 			if (scn->linesAdded) {
-				UpdateLineNumberWidth();
+				UpdateLineNumberWidthForLines();
 			}
 			AutoSave_Start(false);
 			break;
@@ -4862,8 +5260,13 @@ LRESULT MsgNotify(HWND hwnd, WPARAM wParam, LPARAM lParam) {
 			MsgNotifyZoom();
 			break;
 
+		case SCN_PAINTED:
+			MsgNotifyPainted();
+			break;
+
 		case SCN_SAVEPOINTREACHED:
 			bDocumentModified = false;
+			Journal_Rebase();
 			iOriginalEncoding = iCurrentEncoding;
 			UpdateDocumentModificationStatus();
 			break;
@@ -5088,6 +5491,8 @@ void LoadSettings() noexcept {
 	WCHAR *pIniSectionBuf = static_cast<WCHAR *>(NP2HeapAlloc(sizeof(WCHAR) * MAX_INI_SECTION_SIZE_SETTINGS));
 	constexpr DWORD cchIniSection = MAX_INI_SECTION_SIZE_SETTINGS;
 	section.Init(128);
+	// read ini file once, all sections below are served from memory
+	IniFileBeginCache(szIniFile, false);
 
 	LoadIniSection(INI_SECTION_NAME_SETTINGS, pIniSectionBuf, cchIniSection);
 	section.Parse(pIniSectionBuf);
@@ -5166,6 +5571,7 @@ void LoadSettings() noexcept {
 	iValue = section.GetInt(L"AutoCScanWordsTimeout", AUTOC_SCAN_WORDS_DEFAULT_TIMEOUT);
 	autoCompletionConfig.dwScanWordsTimeout = max(iValue, AUTOC_SCAN_WORDS_MIN_TIMEOUT);
 	autoCompletionConfig.bIgnoreCase = section.GetBool(L"AutoCIgnoreCase", false);
+	autoCompletionConfig.bFuzzyMatch = section.GetBool(L"AutoCFuzzyMatch", false);
 	autoCompletionConfig.bLaTeXInputMethod = section.GetBool(L"LaTeXInputMethod", false);
 	iValue = section.GetInt(L"AutoCVisibleItemCount", 16);
 	autoCompletionConfig.iVisibleItemCount = max(iValue, MIN_AUTO_COMPLETION_VISIBLE_ITEM_COUNT);
@@ -5354,6 +5760,12 @@ void LoadSettings() noexcept {
 		record.xFindReplaceDlg = section.GetInt(L"FindReplaceDlgPosX", 0);
 		record.yFindReplaceDlg = section.GetInt(L"FindReplaceDlgPosY", 0);
 		record.cxFindReplaceDlg = section.GetInt(L"FindReplaceDlgSizeX", 0);
+		record.cxFindAllResultsDlg = section.GetInt(L"FindAllResultsDlgSizeX", 0);
+		record.cyFindAllResultsDlg = section.GetInt(L"FindAllResultsDlgSizeY", 0);
+		record.cxFindInFilesDlg = section.GetInt(L"FindInFilesDlgSizeX", 0);
+		record.cyFindInFilesDlg = section.GetInt(L"FindInFilesDlgSizeY", 0);
+		record.cxGotoSymbolDlg = section.GetInt(L"GotoSymbolDlgSizeX", 0);
+		record.cyGotoSymbolDlg = section.GetInt(L"GotoSymbolDlgSizeY", 0);
 
 		record.cxStyleSelectDlg = section.GetInt(L"StyleSelectDlgSizeX", 0);
 		record.cyStyleSelectDlg = section.GetInt(L"StyleSelectDlgSizeY", 0);
@@ -5365,7 +5777,10 @@ void LoadSettings() noexcept {
 	NP2HeapFree(pIniSectionBuf);
 
 	// Scintilla Styles
+	StartupPerfMark(StartupPerf_LoadSettings);
 	Style_Load();
+	IniFileEndCache();
+	StartupPerfMark(StartupPerf_StyleLoad);
 }
 
 void SaveSettingsNow(bool bOnlySaveStyle, bool bQuiet) noexcept {
@@ -5417,6 +5832,8 @@ void SaveSettings(bool bSaveSettingsNow) noexcept {
 		return;
 	}
 
+	// collect all changes in memory, then write ini file at once
+	IniFileBeginCache(szIniFile, true);
 	WCHAR wchTmp[MAX_PATH];
 	WCHAR *pIniSectionBuf = static_cast<WCHAR *>(NP2HeapAlloc(sizeof(WCHAR) * MAX_INI_SECTION_SIZE_SETTINGS));
 	if (!bStickyWindowPosition) {
@@ -5466,6 +5883,7 @@ void SaveSettings(bool bSaveSettingsNow) noexcept {
 	section.SetIntEx(L"AutoCompleteScope", iValue, AutoCompleteScope_Default);
 	section.SetIntEx(L"AutoCScanWordsTimeout", autoCompletionConfig.dwScanWordsTimeout, AUTOC_SCAN_WORDS_DEFAULT_TIMEOUT);
 	section.SetBoolEx(L"AutoCIgnoreCase", autoCompletionConfig.bIgnoreCase, false);
+	section.SetBoolEx(L"AutoCFuzzyMatch", autoCompletionConfig.bFuzzyMatch, false);
 	section.SetBoolEx(L"LaTeXInputMethod", autoCompletionConfig.bLaTeXInputMethod, false);
 	section.SetIntEx(L"AutoCVisibleItemCount", autoCompletionConfig.iVisibleItemCount, 16);
 	section.SetIntEx(L"AutoCMinWordLength", autoCompletionConfig.iMinWordLength, 1);
@@ -5554,6 +5972,9 @@ void SaveSettings(bool bSaveSettingsNow) noexcept {
 	NP2HeapFree(pIniSectionBuf);
 	// Scintilla Styles
 	Style_Save();
+	if (!IniFileEndCache()) {
+		dwLastIOError = GetLastError();
+	}
 }
 
 void SaveWindowPosition(WCHAR *pIniSectionBuf) noexcept{
@@ -5604,6 +6025,12 @@ void SaveWindowPosition(WCHAR *pIniSectionBuf) noexcept{
 	section.SetIntEx(L"FindReplaceDlgPosX", record.xFindReplaceDlg, 0);
 	section.SetIntEx(L"FindReplaceDlgPosY", record.yFindReplaceDlg, 0);
 	section.SetIntEx(L"FindReplaceDlgSizeX", record.cxFindReplaceDlg, 0);
+	section.SetIntEx(L"FindAllResultsDlgSizeX", record.cxFindAllResultsDlg, 0);
+	section.SetIntEx(L"FindAllResultsDlgSizeY", record.cyFindAllResultsDlg, 0);
+	section.SetIntEx(L"FindInFilesDlgSizeX", record.cxFindInFilesDlg, 0);
+	section.SetIntEx(L"FindInFilesDlgSizeY", record.cyFindInFilesDlg, 0);
+	section.SetIntEx(L"GotoSymbolDlgSizeX", record.cxGotoSymbolDlg, 0);
+	section.SetIntEx(L"GotoSymbolDlgSizeY", record.cyGotoSymbolDlg, 0);
 
 	section.SetIntEx(L"StyleSelectDlgSizeX", record.cxStyleSelectDlg, 0);
 	section.SetIntEx(L"StyleSelectDlgSizeY", record.cyStyleSelectDlg, 0);
@@ -5922,6 +6349,21 @@ CommandParseState ParseCommandLineOption(LPWSTR lp1, LPWSTR lp2) noexcept {
 		}
 		break;
 
+#if NP2_ENABLE_ENCODING_BENCHMARK
+	case L'E':
+		if (StrCaseEqual(opt, L"encoding-benchmark")) {
+			state = CommandParseState_Argument;
+			if (ExtractFirstArgument(lp2, lp1, lp2)) {
+				if (lpEncodingBenchmarkArg) {
+					LocalFree(lpEncodingBenchmarkArg);
+				}
+				lpEncodingBenchmarkArg = StrDup(lp1);
+				state = CommandParseState_Consumed;
+			}
+		}
+		break;
+#endif
+
 	case L'M':
 		if (StrCaseEqual(opt, L"MBCS")) {
 			flagSetEncoding = IDM_ENCODING_ANSI - IDM_ENCODING_ANSI + 1;
@@ -5964,6 +6406,11 @@ CommandParseState ParseCommandLineOption(LPWSTR lp1, LPWSTR lp2) noexcept {
 		break;
 
 	case L'P': {
+		if (StrCaseEqual(opt, L"perf-startup")) {
+			flagPerfStartup = true;
+			state = CommandParseState_Consumed;
+			break;
+		}
 		if (opt[1] == L'\0' || notepadAction == NotepadReplacementAction_Default) {
 			notepadAction = NotepadReplacementAction_PrintDefault;
 			if (UnsafeUpper(opt[1]) == L'T') {
@@ -6086,8 +6533,12 @@ CommandParseState ParseCommandLineOption(LPWSTR lp1, LPWSTR lp2) noexcept {
 	break;
 
 	case L'S':
+		if (StrCaseEqual(opt, L"standby")) {
+			flagStandby = true;
+			state = CommandParseState_Consumed;
+		}
 		// Shell integration
-		if (StrStartsWithCase(opt, L"sysmru=")) {
+		else if (StrStartsWithCase(opt, L"sysmru=")) {
 			opt += CSTRLEN(L"sysmru=");
 			if (opt[1] == L'\0') {
 				const UINT value = opt[0] - L'0';
@@ -6260,6 +6711,10 @@ void LoadFlags() noexcept {
 	bSingleFileInstance = section.GetBool(L"SingleFileInstance", true);
 	bReuseWindow = section.GetBool(L"ReuseWindow", false);
 	bStickyWindowPosition = section.GetBool(L"StickyWindowPosition", false);
+	bStandbyInstance = section.GetBool(L"StandbyInstance", false);
+	bRestoreFileState = section.GetBool(L"RestoreFileState", false);
+	bStyleCache = section.GetBool(L"StyleCache", false);
+	bEditJournal = section.GetBool(L"EditJournal", false);
 
 	if (!flagReuseWindow && !flagNoReuseWindow) {
 		flagNoReuseWindow = !bReuseWindow;
@@ -6282,6 +6737,12 @@ void LoadFlags() noexcept {
 	dwFileCheckInterval = section.GetInt(L"FileCheckInterval", 1000);
 	dwAutoReloadTimeout = section.GetInt(L"AutoReloadTimeout", 1000);
 	dwUrlThreshold = section.GetInt(L"UrlThreshold", 256);
+	dwFileMappingThreshold = section.GetInt(L"FileMappingThreshold", 64);
+	dwAtomicSaveThreshold = section.GetInt(L"AtomicSaveThreshold", 16);
+	dwInPlaceSaveThreshold = section.GetInt(L"InPlaceSaveThreshold", 0);
+	dwUndoMemoryBudget = section.GetInt(L"UndoMemoryBudget", 0);
+	bBinaryFileHexView = section.GetBool(L"BinaryFileHexView", false);
+	bRetainFileData = section.GetBool(L"RetainFileData", false);
 
 	if (IsVistaAndAbove()) {
 		bUseXPFileDialog = section.GetBool(L"UseXPFileDialog", false);
@@ -6296,6 +6757,7 @@ void LoadFlags() noexcept {
 
 	iValue = section.GetInt(L"FindReplaceOpacityLevel", 75);
 	iFindReplaceOpacityLevel = validate(iValue, 0, 100, 75);
+	bFindAsYouType = section.GetBool(L"FindAsYouType", true);
 
 	flagSimpleIndentGuides = section.GetBool(L"SimpleIndentGuides", false);
 	fNoHTMLGuess = section.GetBool(L"NoHTMLGuess", false);
@@ -6425,6 +6887,40 @@ bool CreateIniFile(LPCWSTR lpszIniFile) noexcept {
 // UpdateToolbar()
 //
 //
+static void ScheduleUpdateUI(UINT pending) noexcept {
+	if (pendingUpdateUI == 0) {
+		// not reset by later notifications, so holding a key still updates every frame
+		SetTimer(hwndMain, ID_UPDATEUITIMER, NP2_UPDATEUI_DELAY, nullptr);
+	}
+	pendingUpdateUI |= pending;
+}
+
+static void RunPendingUpdateUI() noexcept {
+	KillTimer(hwndMain, ID_UPDATEUITIMER);
+	const UINT pending = pendingUpdateUI;
+	pendingUpdateUI = 0;
+	if (pending & PendingUpdateUI_Toolbar) {
+		UpdateToolbar();
+	}
+	// mark occurrences for current selection instead of each intermediate one
+	if (pending & PendingUpdateUI_MarkSelection) {
+		if (SciCall_IsSelectionEmpty()) {
+			if (editMarkAll.matchCount) {
+				editMarkAll.Clear();
+			}
+		} else {
+			editMarkAll.MarkAll((pending & PendingUpdateUI_MarkContent), bMarkOccurrences);
+		}
+	} else if (pending & PendingUpdateUI_MarkContent) {
+		if (editMarkAll.matchCount) {
+			editMarkAll.MarkAll(TRUE, bMarkOccurrences);
+		}
+	}
+	if ((pending & PendingUpdateUI_Statusbar) || cachedStatusItem.updateMask) {
+		UpdateStatusbar();
+	}
+}
+
 void UpdateToolbar() noexcept {
 	if (!bShowToolbar || !bInitDone) {
 		return;
@@ -6453,6 +6949,52 @@ void UpdateToolbar() noexcept {
 	CheckTool(IDT_VIEW_ALWAYSONTOP, IsTopMost());
 }
 
+static void StatusBar_ResetCheckpoints(Sci_Position iLineStart, Sci_Position iLineEnd) noexcept {
+	cachedStatusItem.dwCheckpointReversion = dwCurrentDocReversion;
+	cachedStatusItem.iCheckpointTabWidth = SciCall_GetTabWidth();
+	cachedStatusItem.checkpointCount = 0;
+	cachedStatusItem.iCheckpointInterval = max<Sci_Position>(STATUSBAR_CHECKPOINT_INTERVAL, (iLineEnd - iLineStart) / STATUSBAR_CHECKPOINT_COUNT);
+	cachedStatusItem.caretCheckpoint = { iLineStart, 0, 0 };
+}
+
+// count characters and columns from nearest checkpoint before iPos, add checkpoints on the way.
+static void StatusBar_CountColumn(Sci_Position iLineStart, Sci_Position iPos, Sci_TextToFindFull &ft) noexcept {
+	CachedStatusItem &item = cachedStatusItem;
+	if (item.dwCheckpointReversion != dwCurrentDocReversion || item.iCheckpointTabWidth != SciCall_GetTabWidth()) {
+		StatusBar_ResetCheckpoints(iLineStart, SciCall_GetLineEndPosition(SciCall_LineFromPosition(iLineStart)));
+	}
+
+	int index = item.checkpointCount;
+	while (index > 0 && item.checkpoints[index - 1].iPos > iPos) {
+		--index;
+	}
+	ColumnCheckpoint checkpoint = (index == 0) ? ColumnCheckpoint{ iLineStart, 0, 0 } : item.checkpoints[index - 1];
+	if (item.caretCheckpoint.iPos <= iPos && item.caretCheckpoint.iPos > checkpoint.iPos) {
+		checkpoint = item.caretCheckpoint;
+	}
+
+	while (true) {
+		Sci_Position iNext = iPos;
+		if (iPos - checkpoint.iPos > item.iCheckpointInterval && item.checkpointCount < STATUSBAR_CHECKPOINT_COUNT) {
+			iNext = min(iPos, SciCall_PositionAfter(checkpoint.iPos + item.iCheckpointInterval));
+		}
+		ft.chrg.cpMin = checkpoint.iPos;
+		ft.chrg.cpMax = iNext;
+		ft.chrgText.cpMin = checkpoint.iChar;
+		ft.chrgText.cpMax = checkpoint.iColumn;
+		SciCall_CountCharactersAndColumns(&ft);
+		checkpoint = { iNext, ft.chrgText.cpMin, ft.chrgText.cpMax };
+		if (iNext == iPos) {
+			break;
+		}
+		memmove(item.checkpoints + index + 1, item.checkpoints + index, (item.checkpointCount - index)*sizeof(ColumnCheckpoint));
+		item.checkpoints[index] = checkpoint;
+		++index;
+		++item.checkpointCount;
+	}
+	item.caretCheckpoint = checkpoint;
+}
+
 //=============================================================================
 //
 // UpdateStatusbar()
@@ -6466,23 +7008,29 @@ void UpdateStatusbar() noexcept {
 	const Sci_Position iPos = SciCall_GetCurrentPos();
 	const Sci_Line iLine = SciCall_LineFromPosition(iPos);
 	const Sci_Line iLines = SciCall_GetLineCount();
+	const Sci_Position iLineStart = SciCall_PositionFromLine(iLine);
+
+	UINT updateMask = cachedStatusItem.updateMask;
+	cachedStatusItem.updateMask = 0;
+	const bool lineChanged = (updateMask & (1 << StatusItem_Line)) || (iLine != cachedStatusItem.iLine);
+	if (lineChanged) {
+		StatusBar_ResetCheckpoints(iLineStart, SciCall_GetLineEndPosition(iLine));
+	}
 
 #if 0
 	StopWatch watch;
 	watch.Start();
 #endif
-	Sci_TextToFindFull ft = { { SciCall_PositionFromLine(iLine), iPos }, nullptr, { 0, 0 } };
-	SciCall_CountCharactersAndColumns(&ft);
+	Sci_TextToFindFull ft = { { iLineStart, iPos }, nullptr, { 0, 0 } };
+	StatusBar_CountColumn(iLineStart, iPos, ft);
 	const Sci_Position iChar = ft.chrgText.cpMin + 1;
 	const Sci_Position iCol = ft.chrgText.cpMax + 1;
 	Sci_Position iLineChar;
 	Sci_Position iLineColumn;
 
-	UINT updateMask = cachedStatusItem.updateMask;
-	cachedStatusItem.updateMask = 0;
-	if ((updateMask & (1 << StatusItem_Line)) || (iLine != cachedStatusItem.iLine)) {
+	if (lineChanged) {
 		updateMask |= (1 << StatusItem_Line);
-		ft.chrg.cpMin = ft.chrg.cpMax;
+		ft.chrg.cpMin = iPos;
 		ft.chrg.cpMax = SciCall_GetLineEndPosition(iLine);
 		SciCall_CountCharactersAndColumns(&ft);
 		iLineChar = ft.chrgText.cpMin;
@@ -6501,8 +7049,14 @@ void UpdateStatusbar() noexcept {
 
 	WCHAR tchCurLine[32];
 	WCHAR tchDocLine[32];
-	FormatNumber(tchCurLine, iLine + 1);
-	FormatNumber(tchDocLine, iLines);
+	if (EditViewerActive()) {
+		// line number in whole file
+		FormatNumber(tchCurLine, iLine + 1 + EditViewerFirstLine());
+		FormatNumber(tchDocLine, EditViewerLineCount());
+	} else {
+		FormatNumber(tchCurLine, iLine + 1);
+		FormatNumber(tchDocLine, iLines);
+	}
 
 	WCHAR tchCurColumn[32];
 	WCHAR tchLineColumn[32];
@@ -6554,8 +7108,11 @@ void UpdateStatusbar() noexcept {
 
 	// find all and mark occurrences
 	WCHAR tchMatchesCount[32];
-	FormatNumber(tchMatchesCount, editMarkAll.matchCount);
-	if (editMarkAll.pending) {
+	Sci_Position matchCount = editMarkAll.matchCount;
+	bool matchPending = editMarkAll.pending;
+	EditFindAsYouTypeGetCount(matchCount, matchPending);
+	FormatNumber(tchMatchesCount, matchCount);
+	if (matchPending) {
 		lstrcat(tchMatchesCount, L" ...");
 	}
 
@@ -6663,6 +7220,7 @@ void UpdateLineNumberWidth() noexcept {
 		PosToStr(iLines, tchLines + 2);
 		tchLines[0] = '_';
 		tchLines[1] = '_';
+		iLineNumberDigits = static_cast<int>(strlen(tchLines + 2));
 
 		width = SciCall_TextWidth(STYLE_LINENUMBER, tchLines);
 #endif
@@ -6670,6 +7228,21 @@ void UpdateLineNumberWidth() noexcept {
 	SciCall_SetMarginWidth(MarginNumber_LineNumber, width);
 }
 
+// line number margin width only changes when digits of line count changed.
+void UpdateLineNumberWidthForLines() noexcept {
+	if (bShowLineNumbers) {
+		Sci_Line iLines = SciCall_GetLineCount();
+		int digits = 0;
+		do {
+			++digits;
+			iLines /= 10;
+		} while (iLines != 0);
+		if (digits != iLineNumberDigits) {
+			UpdateLineNumberWidth();
+		}
+	}
+}
+
 // based on SciTEWin::FullScreenToggle()
 void ToggleFullScreenMode() noexcept {
 	static bool bSaved;
@@ -6743,6 +7316,9 @@ bool FileIO(bool fLoad, LPWSTR pszFile, FileSaveFlag flag, EditFileIOStatus &sta
 		UpdateWindow(hwndStatus);
 	}
 
+	StopWatch watch;
+	watch.Start();
+	const bool load = fLoad;
 	if (fLoad) {
 		fLoad = EditLoadFile(pszFile, status);
 		iSrcEncoding = CPI_NONE;
@@ -6750,6 +7326,10 @@ bool FileIO(bool fLoad, LPWSTR pszFile, FileSaveFlag flag, EditFileIOStatus &sta
 	} else {
 		fLoad = EditSaveFile(hwndEdit, pszFile, flag, status);
 	}
+	if (TraceProviderEnabled()) {
+		watch.Stop();
+		TraceLogFileIO(load, pszFile, SciCall_GetLength(), watch.Get(), fLoad);
+	}
 
 	const DWORD dwFileAttributes = GetFileAttributes(pszFile);
 	bReadOnlyFile = (dwFileAttributes != INVALID_FILE_ATTRIBUTES) && (dwFileAttributes & FILE_ATTRIBUTE_READONLY);
@@ -6764,71 +7344,564 @@ bool FileIO(bool fLoad, LPWSTR pszFile, FileSaveFlag flag, EditFileIOStatus &sta
 
 //=============================================================================
 //
-// FileLoad()
-//
+// File state: caret, scroll position, bookmarks and contracted folds of recent files,
+// saved into "<ini file>.session" and restored when the file is opened again.
 //
-bool FileLoad(FileLoadFlag loadFlag, LPCWSTR lpszFile) {
-	WCHAR tchPath[MAX_PATH];
-	SetStrEmpty(tchPath);
-	bool fSuccess = false;
-	bool bRestoreView = false;
-	Sci_Position iCurPos = 0;
-	Sci_Position iAnchorPos = 0;
-	Sci_Line iLine = 0;
-	Sci_Position iCol = 0;
-	Sci_Line iVisTopLine = 0;
-	Sci_Line iDocTopLine = 0;
-	int iXOffset = 0;
-	bool keepTitleExcerpt = fKeepTitleExcerpt;
-	bool keepCurrentLexer = false;
+namespace {
 
-	if (!(loadFlag & FileLoadFlag_New) && StrNotEmpty(lpszFile)) {
-		lstrcpy(tchPath, lpszFile);
-		if (lpszFile == szCurFile || PathEqual(lpszFile, szCurFile)) {
-			iCurPos = SciCall_GetCurrentPos();
-			iAnchorPos = SciCall_GetAnchor();
-			iLine = SciCall_LineFromPosition(iCurPos) + 1;
-			iCol = SciCall_GetColumn(iCurPos) + 1;
-			iVisTopLine = SciCall_GetFirstVisibleLine();
-			iDocTopLine = SciCall_DocLineFromVisible(iVisTopLine);
-			iXOffset = SciCall_GetXOffset();
-			bRestoreView = true;
-			keepTitleExcerpt = true;
-			keepCurrentLexer = true;
-			flagReadOnlyMode |= static_cast<int>(bReadOnlyMode);
-		}
-		fSuccess = true;
+constexpr uint32_t FileStateMagic = 0x5346344E; // 'N4FS'
+constexpr uint32_t FileStateVersion = 1;
+constexpr uint32_t MaxFileStateCount = 256;
+constexpr uint32_t MaxFileStateLines = 4096;
+constexpr uint32_t MaxFileStateStoreSize = 16*1024*1024;
+
+struct FileStateHeader {
+	uint32_t magic;
+	uint32_t version;
+};
+
+// followed by bookmark lines, contracted fold lines and file path (without NUL).
+struct FileStateRecord {
+	uint32_t cbSize;
+	uint32_t cchPath;
+	uint32_t bookmarkCount;
+	uint32_t foldCount;
+	int64_t fileSize;
+	FILETIME ftLastWriteTime;
+	int64_t currentPos;
+	int64_t anchorPos;
+	int64_t docTopLine;
+	int32_t xOffset;
+	uint32_t reserved;
+};
+
+static_assert(sizeof(FileStateRecord) % sizeof(int64_t) == 0);
+
+}
+
+// restored contracted folds, applied after styling reached them
+static int64_t *pendingFoldLines;
+static uint32_t pendingFoldCount;
+static uint32_t pendingFoldIndex;
+
+static bool GetFileStatePath(LPWSTR path) noexcept {
+	if (StrIsEmpty(szIniFile)) {
+		return false;
 	}
-	if (!(loadFlag & FileLoadFlag_DontSave)) {
-		if (!FileSave(FileSaveFlag_Ask)) {
-			return false;
-		}
+	lstrcpy(path, szIniFile);
+	lstrcat(path, L".session");
+	return true;
+}
+
+static char *FileStateReadStore(LPCWSTR path, DWORD &cbData) noexcept {
+	cbData = 0;
+	HANDLE hFile = CreateFile(path, GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE,
+							  nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+	if (hFile == INVALID_HANDLE_VALUE) {
+		return nullptr;
 	}
 
-	if (loadFlag & FileLoadFlag_New) {
-		SetStrEmpty(szCurFile);
-		SetDlgItemText(hwndMain, IDC_FILENAME, szCurFile);
-		if (!keepTitleExcerpt) {
-			SetStrEmpty(szTitleExcerpt);
+	char *data = nullptr;
+	LARGE_INTEGER size;
+	if (GetFileSizeEx(hFile, &size) && size.QuadPart > static_cast<LONGLONG>(sizeof(FileStateHeader))
+		&& size.QuadPart <= MaxFileStateStoreSize) {
+		data = static_cast<char *>(NP2HeapAlloc(size.LowPart));
+		DWORD cbRead = 0;
+		if (data != nullptr && ReadFile(hFile, data, size.LowPart, &cbRead, nullptr) && cbRead == size.LowPart) {
+			const FileStateHeader *header = reinterpret_cast<const FileStateHeader *>(data);
+			if (header->magic == FileStateMagic && header->version == FileStateVersion) {
+				cbData = cbRead;
+			}
 		}
-		fvCurFile.Init(nullptr, 0);
-		EditSetEmptyText();
-		bDocumentModified = false;
-		bReadOnlyFile = false;
-		iCurrentEOLMode = GetScintillaEOLMode(iDefaultEOLMode);
-		SciCall_SetEOLMode(iCurrentEOLMode);
-		iCurrentEncoding = iDefaultEncoding;
-		iOriginalEncoding = iCurrentEncoding;
-		SciCall_SetCodePage((iCurrentEncoding == CPI_DEFAULT) ? iDefaultCodePage : SC_CP_UTF8);
-		Style_SetLexer(nullptr, true);
-		UpdateStatusBarCache(StatusItem_Encoding);
-		UpdateStatusBarCache(StatusItem_EolMode);
-		UpdateStatusBarCacheLineColumn();
-		UpdateDocumentModificationStatus();
-		UpdateStatusbar();
-
-		AutoSave_Stop(TRUE);
-		// Terminate file watching
+		if (cbData == 0 && data != nullptr) {
+			NP2HeapFree(data);
+			data = nullptr;
+		}
+	}
+	CloseHandle(hFile);
+	return data;
+}
+
+static const FileStateRecord *FileStateNextRecord(const char *data, DWORD cbData, DWORD &offset) noexcept {
+	if (offset + sizeof(FileStateRecord) > cbData) {
+		return nullptr;
+	}
+	const FileStateRecord *record = reinterpret_cast<const FileStateRecord *>(data + offset);
+	const uint64_t minSize = sizeof(FileStateRecord)
+		+ (static_cast<uint64_t>(record->bookmarkCount) + record->foldCount)*sizeof(int64_t)
+		+ static_cast<uint64_t>(record->cchPath)*sizeof(WCHAR);
+	if (record->cbSize < minSize || record->cbSize > cbData - offset || (record->cbSize & 7) != 0
+		|| record->cchPath == 0 || record->cchPath >= MAX_PATH) {
+		return nullptr;
+	}
+	offset += record->cbSize;
+	return record;
+}
+
+static bool FileStateRecordMatch(const FileStateRecord *record, LPCWSTR path) noexcept {
+	const int64_t *lines = reinterpret_cast<const int64_t *>(record + 1);
+	WCHAR tchPath[MAX_PATH];
+	memcpy(tchPath, lines + record->bookmarkCount + record->foldCount, record->cchPath*sizeof(WCHAR));
+	tchPath[record->cchPath] = L'\0';
+	return PathEqual(tchPath, path);
+}
+
+static void FileStateClearPending() noexcept {
+	if (pendingFoldLines != nullptr) {
+		NP2HeapFree(pendingFoldLines);
+		pendingFoldLines = nullptr;
+	}
+	pendingFoldCount = 0;
+	pendingFoldIndex = 0;
+}
+
+static void FileStateSave() noexcept {
+	WCHAR path[MAX_PATH + 16];
+	WIN32_FILE_ATTRIBUTE_DATA fad;
+	if (!bRestoreFileState || StrIsEmpty(szCurFile) || !GetFileStatePath(path)
+		|| !GetFileAttributesEx(szCurFile, GetFileExInfoStandard, &fad)) {
+		return;
+	}
+
+	const uint32_t cchPath = lstrlen(szCurFile);
+	FileStateRecord *record = static_cast<FileStateRecord *>(NP2HeapAlloc(sizeof(FileStateRecord)
+		+ 2*MaxFileStateLines*sizeof(int64_t) + (cchPath + 4)*sizeof(WCHAR)));
+	if (record == nullptr) {
+		return;
+	}
+
+	int64_t *lines = reinterpret_cast<int64_t *>(record + 1);
+	uint32_t count = 0;
+	Sci_Line line = SciCall_MarkerNext(0, MarkerBitmask_Bookmark);
+	while (line >= 0 && count < MaxFileStateLines) {
+		lines[count++] = line;
+		line = SciCall_MarkerNext(line + 1, MarkerBitmask_Bookmark);
+	}
+	record->bookmarkCount = count;
+
+	// merge contracted folds with restored folds not yet applied, both are sorted
+	line = SciCall_ContractedFoldNext(0);
+	uint32_t index = pendingFoldIndex;
+	while (count - record->bookmarkCount < MaxFileStateLines) {
+		const int64_t pending = (index < pendingFoldCount) ? pendingFoldLines[index] : -1;
+		if (line < 0 && pending < 0) {
+			break;
+		}
+		if (line >= 0 && (pending < 0 || line <= pending)) {
+			lines[count++] = line;
+			if (line == pending) {
+				++index;
+			}
+			line = SciCall_ContractedFoldNext(line + 1);
+		} else {
+			lines[count++] = pending;
+			++index;
+		}
+	}
+	record->foldCount = count - record->bookmarkCount;
+
+	memcpy(lines + count, szCurFile, cchPath*sizeof(WCHAR));
+	record->cbSize = (sizeof(FileStateRecord) + count*sizeof(int64_t) + cchPath*sizeof(WCHAR) + 7) & ~7U;
+	record->cchPath = cchPath;
+	record->fileSize = (static_cast<int64_t>(fad.nFileSizeHigh) << 32) | fad.nFileSizeLow;
+	record->ftLastWriteTime = fad.ftLastWriteTime;
+	record->currentPos = SciCall_GetCurrentPos();
+	record->anchorPos = SciCall_GetAnchor();
+	record->docTopLine = SciCall_DocLineFromVisible(SciCall_GetFirstVisibleLine());
+	record->xOffset = SciCall_GetXOffset();
+
+	DWORD cbData = 0;
+	char *data = FileStateReadStore(path, cbData);
+	HANDLE hFile = CreateFile(path, GENERIC_WRITE, FILE_SHARE_READ,
+							  nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+	if (hFile != INVALID_HANDLE_VALUE) {
+		const FileStateHeader header = { FileStateMagic, FileStateVersion };
+		DWORD cbWritten;
+		bool ok = WriteFile(hFile, &header, sizeof(header), &cbWritten, nullptr)
+			&& WriteFile(hFile, record, record->cbSize, &cbWritten, nullptr);
+		if (data != nullptr) {
+			// most recent first, drop old record for current file
+			DWORD offset = sizeof(FileStateHeader);
+			uint32_t total = 1;
+			const FileStateRecord *prev;
+			while (ok && total < MaxFileStateCount && (prev = FileStateNextRecord(data, cbData, offset)) != nullptr) {
+				if (!FileStateRecordMatch(prev, szCurFile)) {
+					ok = WriteFile(hFile, prev, prev->cbSize, &cbWritten, nullptr);
+					++total;
+				}
+			}
+		}
+		CloseHandle(hFile);
+	}
+	if (data != nullptr) {
+		NP2HeapFree(data);
+	}
+	NP2HeapFree(record);
+}
+
+static void FileStateRestore() noexcept {
+	WCHAR path[MAX_PATH + 16];
+	if (!bRestoreFileState || !GetFileStatePath(path)) {
+		return;
+	}
+
+	DWORD cbData = 0;
+	char *data = FileStateReadStore(path, cbData);
+	if (data == nullptr) {
+		return;
+	}
+
+	DWORD offset = sizeof(FileStateHeader);
+	const FileStateRecord *record;
+	while ((record = FileStateNextRecord(data, cbData, offset)) != nullptr) {
+		if (FileStateRecordMatch(record, szCurFile)) {
+			break;
+		}
+	}
+
+	if (record != nullptr) {
+		const Sci_Position length = SciCall_GetLength();
+		const Sci_Line lineCount = SciCall_GetLineCount();
+		SciCall_SetSel(clamp<Sci_Position>(record->anchorPos, 0, length), clamp<Sci_Position>(record->currentPos, 0, length));
+
+		// bookmarks and folds are only meaningful when file is unchanged since last saving the state
+		WIN32_FILE_ATTRIBUTE_DATA fad;
+		if (GetFileAttributesEx(szCurFile, GetFileExInfoStandard, &fad)
+			&& record->fileSize == ((static_cast<int64_t>(fad.nFileSizeHigh) << 32) | fad.nFileSizeLow)
+			&& CompareFileTime(&record->ftLastWriteTime, &fad.ftLastWriteTime) == 0) {
+			const int64_t *lines = reinterpret_cast<const int64_t *>(record + 1);
+			for (uint32_t i = 0; i < record->bookmarkCount; i++) {
+				if (lines[i] >= 0 && lines[i] < lineCount) {
+					SciCall_MarkerAdd(static_cast<Sci_Line>(lines[i]), MarkerNumber_Bookmark);
+				}
+			}
+			// folds are contracted lazily, styling is not forced from document start up to the saved view.
+			if (bShowCodeFolding && record->foldCount != 0) {
+				pendingFoldLines = static_cast<int64_t *>(NP2HeapAlloc(record->foldCount*sizeof(int64_t)));
+				if (pendingFoldLines != nullptr) {
+					memcpy(pendingFoldLines, lines + record->bookmarkCount, record->foldCount*sizeof(int64_t));
+					pendingFoldCount = record->foldCount;
+				}
+			}
+		}
+
+		const Sci_Line iDocTopLine = clamp<Sci_Line>(record->docTopLine, 0, lineCount - 1);
+		SciCall_SetFirstVisibleLine(SciCall_VisibleFromDocLine(iDocTopLine));
+		SciCall_SetXOffset(record->xOffset);
+	}
+	NP2HeapFree(data);
+}
+
+static void FileStateApplyPending() noexcept {
+	if (pendingFoldIndex >= pendingFoldCount) {
+		return;
+	}
+
+	const Sci_Line lineStyled = SciCall_LineFromPosition(SciCall_GetEndStyled());
+	const Sci_Line lineCount = SciCall_GetLineCount();
+	// keep top line unchanged while contracting folds above it
+	const Sci_Line iDocTopLine = SciCall_DocLineFromVisible(SciCall_GetFirstVisibleLine());
+	bool changed = false;
+	while (pendingFoldIndex < pendingFoldCount) {
+		const int64_t line = pendingFoldLines[pendingFoldIndex];
+		if (line >= lineCount) {
+			pendingFoldIndex = pendingFoldCount;
+			break;
+		}
+		if (line >= lineStyled) {
+			break;
+		}
+		++pendingFoldIndex;
+		if (line >= 0 && (SciCall_GetFoldLevel(line) & SC_FOLDLEVELHEADERFLAG) && SciCall_GetFoldExpanded(line)) {
+			SciCall_FoldLine(line, SC_FOLDACTION_CONTRACT);
+			changed = true;
+		}
+	}
+	if (changed) {
+		SciCall_SetFirstVisibleLine(SciCall_VisibleFromDocLine(iDocTopLine));
+	}
+	if (pendingFoldIndex >= pendingFoldCount) {
+		FileStateClearPending();
+	}
+}
+
+//=============================================================================
+//
+// Style cache: styles, fold levels and line states of large files, saved into
+// "%LOCALAPPDATA%\Notepad4\StyleCache" when the unmodified file is closed, and restored
+// on reopen when file identity, size, last write time and lexer settings are unchanged.
+//
+namespace {
+
+constexpr uint32_t StyleCacheMagic = 0x4353344E; // 'N4SC'
+constexpr uint32_t StyleCacheVersion = 1;
+constexpr uint32_t MaxStyleCacheCount = 32;
+constexpr int64_t MinStyleCacheFileSize = 4*1024*1024;
+constexpr DWORD StyleCacheIOChunkSize = 64*1024*1024;
+
+struct StyleCacheHeader {
+	uint32_t magic;
+	uint32_t version;
+	int64_t fileSize;
+	FILETIME ftLastWriteTime;
+	uint64_t settingsHash;
+	uint64_t cacheSize;
+};
+
+}
+
+// identity of current file when it was loaded, the cache is only saved for the same file
+static FileIdentity styleCacheIdentity;
+static bool styleCacheTracked = false;
+
+static bool GetStyleCachePath(LPWSTR path, bool create) noexcept {
+	LPWSTR pszPath = nullptr;
+	if (S_OK != SHGetKnownFolderPath(FOLDERID_LocalAppData, KF_FLAG_DEFAULT, nullptr, &pszPath)) {
+		return false;
+	}
+	PathCombine(path, pszPath, WC_NOTEPAD4);
+	CoTaskMemFree(pszPath);
+	PathAppend(path, L"StyleCache");
+	if (create && GetFileAttributes(path) == INVALID_FILE_ATTRIBUTES) {
+		SHCreateDirectoryEx(nullptr, path, nullptr);
+	}
+
+	WCHAR name[64];
+	uint64_t fileId[2];
+	memcpy(fileId, styleCacheIdentity.fileId, sizeof(fileId));
+	wsprintf(name, L"%016I64X%016I64X%016I64X.cache", styleCacheIdentity.volumeSerialNumber, fileId[0], fileId[1]);
+	PathAppend(path, name);
+	return true;
+}
+
+static uint64_t StyleCacheSettingsHash() noexcept {
+	// FNV-1a over build version, lexer signature and encoding
+	const uint64_t values[] = {
+		Style_GetLexerSignature(),
+		static_cast<uint64_t>(SciCall_GetCodePage()),
+		static_cast<uint64_t>(iCurrentEncoding),
+	};
+	uint64_t hash = UINT64_C(0xcbf29ce484222325);
+	const auto update = [&hash](const void *data, size_t length) noexcept {
+		const uint8_t *ptr = static_cast<const uint8_t *>(data);
+		for (size_t i = 0; i < length; i++) {
+			hash = (hash ^ ptr[i]) * UINT64_C(0x100000001b3);
+		}
+	};
+	update(VERSION_FILEVERSION, sizeof(VERSION_FILEVERSION));
+	update(values, sizeof(values));
+	return hash;
+}
+
+// keep most recent caches
+static void StyleCachePrune(LPCWSTR path) noexcept {
+	WCHAR tchFind[MAX_PATH];
+	lstrcpy(tchFind, path);
+	PathRemoveFileSpec(tchFind);
+	PathAppend(tchFind, L"*.cache");
+
+	WIN32_FIND_DATA fd;
+	HANDLE hFind = FindFirstFile(tchFind, &fd);
+	if (hFind == INVALID_HANDLE_VALUE) {
+		return;
+	}
+	uint32_t count = 0;
+	FILETIME ftOldest{ UINT32_MAX, UINT32_MAX };
+	WCHAR oldest[MAX_PATH];
+	do {
+		++count;
+		if (CompareFileTime(&fd.ftLastWriteTime, &ftOldest) < 0) {
+			ftOldest = fd.ftLastWriteTime;
+			lstrcpy(oldest, fd.cFileName);
+		}
+	} while (FindNextFile(hFind, &fd));
+	FindClose(hFind);
+
+	if (count > MaxStyleCacheCount) {
+		PathRemoveFileSpec(tchFind);
+		PathAppend(tchFind, oldest);
+		DeleteFile(tchFind);
+	}
+}
+
+static void StyleCacheLoad() noexcept {
+	styleCacheTracked = false;
+	if (!bStyleCache || pLexCurrent->iLexer == SCLEX_NULL
+		|| !PathGetFileIdentity(szCurFile, styleCacheIdentity)
+		|| styleCacheIdentity.fileSize < MinStyleCacheFileSize) {
+		return;
+	}
+	styleCacheTracked = true;
+
+	WCHAR path[MAX_PATH];
+	if (!GetStyleCachePath(path, false)) {
+		return;
+	}
+	HANDLE hFile = CreateFile(path, GENERIC_READ, FILE_SHARE_READ,
+							  nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+	if (hFile == INVALID_HANDLE_VALUE) {
+		return;
+	}
+
+	StyleCacheHeader header;
+	DWORD cbRead = 0;
+	LARGE_INTEGER size;
+	char *data = nullptr;
+	if (GetFileSizeEx(hFile, &size)
+		&& ReadFile(hFile, &header, sizeof(header), &cbRead, nullptr) && cbRead == sizeof(header)
+		&& header.magic == StyleCacheMagic && header.version == StyleCacheVersion
+		&& header.fileSize == styleCacheIdentity.fileSize
+		&& CompareFileTime(&header.ftLastWriteTime, &styleCacheIdentity.ftLastWriteTime) == 0
+		&& header.settingsHash == StyleCacheSettingsHash()
+		&& header.cacheSize == static_cast<uint64_t>(size.QuadPart) - sizeof(header)
+		&& header.cacheSize <= static_cast<uint64_t>(PTRDIFF_MAX)) {
+		data = static_cast<char *>(NP2HeapAlloc(static_cast<size_t>(header.cacheSize)));
+	}
+	if (data != nullptr) {
+		uint64_t offset = 0;
+		while (offset < header.cacheSize) {
+			const DWORD cbChunk = static_cast<DWORD>(min<uint64_t>(header.cacheSize - offset, StyleCacheIOChunkSize));
+			if (!ReadFile(hFile, data + offset, cbChunk, &cbRead, nullptr) || cbRead != cbChunk) {
+				break;
+			}
+			offset += cbChunk;
+		}
+		if (offset == header.cacheSize) {
+			SciCall_SetStylingCache(static_cast<Sci_Position>(header.cacheSize), data);
+		}
+		NP2HeapFree(data);
+	}
+	CloseHandle(hFile);
+}
+
+static void StyleCacheSave() noexcept {
+	if (!styleCacheTracked) {
+		return;
+	}
+	styleCacheTracked = false;
+	// the document must still be the content of unchanged file
+	FileIdentity identity;
+	if (IsDocumentModified() || SciCall_GetEndStyled() < SciCall_GetLength()
+		|| !PathGetFileIdentity(szCurFile, identity)
+		|| memcmp(&identity, &styleCacheIdentity, sizeof(FileIdentity)) != 0) {
+		return;
+	}
+
+	const Sci_Position cacheSize = SciCall_GetStylingCache(nullptr);
+	WCHAR path[MAX_PATH];
+	if (cacheSize <= 0 || !GetStyleCachePath(path, true)) {
+		return;
+	}
+	char *data = static_cast<char *>(NP2HeapAlloc(cacheSize));
+	if (data == nullptr) {
+		return;
+	}
+	SciCall_GetStylingCache(data);
+
+	HANDLE hFile = CreateFile(path, GENERIC_WRITE, 0,
+							  nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+	if (hFile != INVALID_HANDLE_VALUE) {
+		StyleCacheHeader header;
+		header.magic = StyleCacheMagic;
+		header.version = StyleCacheVersion;
+		header.fileSize = identity.fileSize;
+		header.ftLastWriteTime = identity.ftLastWriteTime;
+		header.settingsHash = StyleCacheSettingsHash();
+		header.cacheSize = cacheSize;
+		DWORD cbWritten;
+		bool ok = WriteFile(hFile, &header, sizeof(header), &cbWritten, nullptr);
+		for (Sci_Position offset = 0; ok && offset < cacheSize; ) {
+			const DWORD cbChunk = static_cast<DWORD>(min<Sci_Position>(cacheSize - offset, StyleCacheIOChunkSize));
+			ok = WriteFile(hFile, data + offset, cbChunk, &cbWritten, nullptr) && cbWritten == cbChunk;
+			offset += cbChunk;
+		}
+		CloseHandle(hFile);
+		if (ok) {
+			StyleCachePrune(path);
+		} else {
+			DeleteFile(path);
+		}
+	}
+	NP2HeapFree(data);
+}
+
+//=============================================================================
+//
+// FileLoad()
+//
+//
+bool FileLoad(FileLoadFlag loadFlag, LPCWSTR lpszFile) {
+	WCHAR tchPath[MAX_PATH];
+	SetStrEmpty(tchPath);
+	bool fSuccess = false;
+	bool bRestoreView = false;
+	Sci_Position iCurPos = 0;
+	Sci_Position iAnchorPos = 0;
+	Sci_Line iLine = 0;
+	Sci_Position iCol = 0;
+	Sci_Line iVisTopLine = 0;
+	Sci_Line iDocTopLine = 0;
+	int iXOffset = 0;
+	bool keepTitleExcerpt = fKeepTitleExcerpt;
+	bool keepCurrentLexer = false;
+
+	if (!(loadFlag & FileLoadFlag_New) && StrNotEmpty(lpszFile)) {
+		lstrcpy(tchPath, lpszFile);
+		if (lpszFile == szCurFile || PathEqual(lpszFile, szCurFile)) {
+			iCurPos = SciCall_GetCurrentPos();
+			iAnchorPos = SciCall_GetAnchor();
+			iLine = SciCall_LineFromPosition(iCurPos) + 1;
+			iCol = SciCall_GetColumn(iCurPos) + 1;
+			iVisTopLine = SciCall_GetFirstVisibleLine();
+			iDocTopLine = SciCall_DocLineFromVisible(iVisTopLine);
+			iXOffset = SciCall_GetXOffset();
+			bRestoreView = true;
+			keepTitleExcerpt = true;
+			keepCurrentLexer = true;
+			flagReadOnlyMode |= static_cast<int>(bReadOnlyMode);
+		}
+		fSuccess = true;
+	}
+	if (!(loadFlag & FileLoadFlag_DontSave)) {
+		if (!FileSave(FileSaveFlag_Ask)) {
+			return false;
+		}
+	}
+	if (!bRestoreView) {
+		FileStateSave();
+	}
+	StyleCacheSave();
+	FileStateClearPending();
+	Journal_Stop(false);
+	EditVerifyUTF8Cancel();
+	EditCompareCancel();
+	EditViewerClose();
+
+	if (loadFlag & FileLoadFlag_New) {
+		SetStrEmpty(szCurFile);
+		SetDlgItemText(hwndMain, IDC_FILENAME, szCurFile);
+		if (!keepTitleExcerpt) {
+			SetStrEmpty(szTitleExcerpt);
+		}
+		fvCurFile.Init(nullptr, 0);
+		EditSetEmptyText();
+		bDocumentModified = false;
+		bReadOnlyFile = false;
+		bCompressedFile = false;
+		iCurrentEOLMode = GetScintillaEOLMode(iDefaultEOLMode);
+		SciCall_SetEOLMode(iCurrentEOLMode);
+		iCurrentEncoding = iDefaultEncoding;
+		iOriginalEncoding = iCurrentEncoding;
+		SciCall_SetCodePage((iCurrentEncoding == CPI_DEFAULT) ? iDefaultCodePage : SC_CP_UTF8);
+		Style_SetLexer(nullptr, true);
+		UpdateStatusBarCache(StatusItem_Encoding);
+		UpdateStatusBarCache(StatusItem_EolMode);
+		UpdateStatusBarCacheLineColumn();
+		UpdateDocumentModificationStatus();
+		UpdateStatusbar();
+
+		AutoSave_Stop(TRUE);
+		// Terminate file watching
 		if (bResetFileWatching) {
 			iFileWatchingMode = FileWatchingMode_None;
 		}
@@ -6893,6 +7966,7 @@ bool FileLoad(FileLoadFlag loadFlag, LPCWSTR lpszFile) {
 				SciCall_SetCodePage((iCurrentEncoding == CPI_DEFAULT) ? iDefaultCodePage : SC_CP_UTF8);
 				Style_SetLexer(nullptr, true);
 				bReadOnlyFile = false;
+				bCompressedFile = false;
 			}
 		} else if (result == IDCANCEL) {
 			PostWMCommand(hwndMain, IDM_FILE_EXIT);
@@ -6941,6 +8015,7 @@ bool FileLoad(FileLoadFlag loadFlag, LPCWSTR lpszFile) {
 		} else {
 			UpdateLineNumberWidth();
 		}
+		StyleCacheLoad();
 
 		mruFile.Add(pszFile);
 		if (flagUseSystemMRU == TripleBoolean_True) {
@@ -6953,6 +8028,9 @@ bool FileLoad(FileLoadFlag loadFlag, LPCWSTR lpszFile) {
 			iFileWatchingMode = FileWatchingMode_None;
 		}
 		InstallFileWatching(false);
+		if (status.bEncodingSampled) {
+			EditVerifyUTF8Async(szCurFile);
+		}
 
 		if (status.bBinaryFile || pLexCurrent->iLexer == SCLEX_DIFF) {
 			// ignore auto "detected" Tab settings for binary file and diff file.
@@ -6963,7 +8041,8 @@ bool FileLoad(FileLoadFlag loadFlag, LPCWSTR lpszFile) {
 			}
 		}
 		// open file in read only mode
-		if (status.bBinaryFile || flagReadOnlyMode != ReadOnlyMode_None || bReadOnlyFile) {
+		bCompressedFile = status.bCompressed;
+		if (status.bBinaryFile || status.bViewerMode || status.bCompressed || flagReadOnlyMode != ReadOnlyMode_None || bReadOnlyFile) {
 			bReadOnlyMode = true;
 			flagReadOnlyMode &= ReadOnlyMode_AllFile;
 			SciCall_SetReadOnly(true);
@@ -6993,6 +8072,12 @@ bool FileLoad(FileLoadFlag loadFlag, LPCWSTR lpszFile) {
 				SciCall_LineScroll(0, iVisTopLine - iNewTopLine);
 				SciCall_SetXOffset(iXOffset);
 			}
+		} else if (!status.bViewerMode) {
+			FileStateRestore();
+		}
+		// viewer only holds part of the file, its edits can't be saved or recovered
+		if (!status.bViewerMode && !Journal_Recover()) {
+			Journal_Start();
 		}
 
 		bInitDone = true;
@@ -7009,6 +8094,11 @@ bool FileLoad(FileLoadFlag loadFlag, LPCWSTR lpszFile) {
 			ShowNotificationMessage(SC_NOTIFICATIONPOSITION_BOTTOMRIGHT, IDS_BINARY_FILE_OPENED);
 			return fSuccess;
 		}
+		// notify giant file opened in viewer mode, line endings can't be converted
+		if (status.bViewerMode) {
+			ShowNotificationMessage(SC_NOTIFICATIONPOSITION_BOTTOMRIGHT, IDS_VIEWER_MODE_OPENED);
+			return fSuccess;
+		}
 		// Show inconsistent line endings warning
 		if (status.bInconsistent && bWarnLineEndings) {
 			// file with unknown lexer and unknown encoding
@@ -7020,7 +8110,8 @@ bool FileLoad(FileLoadFlag loadFlag, LPCWSTR lpszFile) {
 				ConvertLineEndings(status.iEOLMode);
 			}
 		}
-	} else if (!status.bFileTooBig) {
+	} else if (!status.bFileTooBig && dwLastIOError != ERROR_CANCELLED) {
+		// no error message when loading is canceled by user
 		MsgBoxLastError(MB_OK, IDS_ERR_LOADFILE, pszFile);
 	}
 
@@ -7059,6 +8150,12 @@ bool FileSave(FileSaveFlag saveFlag) noexcept {
 		return true;
 	}
 
+	// saving would truncate the file to the part loaded in viewer
+	if (EditViewerActive()) {
+		ShowNotificationMessage(SC_NOTIFICATIONPOSITION_BOTTOMRIGHT, IDS_VIEWER_MODE_OPENED);
+		return false;
+	}
+
 	// TODO: avoid message boxes when FileSaveFlag_EndSession is set
 	if (saveFlag & FileSaveFlag_Ask) {
 		// File or "Untitled" ...
@@ -7095,6 +8192,9 @@ bool FileSave(FileSaveFlag saveFlag) noexcept {
 			} else {
 				return false;
 			}
+		} else if (bCompressedFile) {
+			// don't replace the gzip file with decompressed text
+			saveFlag = static_cast<FileSaveFlag>(saveFlag | FileSaveFlag_SaveAs);
 		}
 		if (!(saveFlag & FileSaveFlag_SaveAs)) {
 			fSuccess = FileIO(false, szCurFile, saveFlag, status);
@@ -7160,6 +8260,8 @@ bool FileSave(FileSaveFlag saveFlag) noexcept {
 				iFileWatchingMode = FileWatchingMode_None;
 			}
 			InstallFileWatching(false);
+			// journal for new file name
+			Journal_Start();
 			if (PathEqual(szCurFile, szIniFile)) {
 				LoadFlags();
 				LoadSettings();
@@ -7167,15 +8269,16 @@ bool FileSave(FileSaveFlag saveFlag) noexcept {
 				mruFind.Reload();
 				mruReplace.Reload();
 				if (np2StyleTheme == StyleTheme_Default) {
-					Style_LoadAll(static_cast<StyleLoadFlag>(StyleLoadFlag_Reload | StyleLoadFlag_Apply));
+					Style_LoadAll(static_cast<StyleLoadFlag>(StyleLoadFlag_Reload | StyleLoadFlag_Apply | StyleLoadFlag_Lazy));
 				}
 			} else if (np2StyleTheme != StyleTheme_Default && PathEqual(szCurFile, darkStyleThemeFilePath)) {
-				Style_LoadAll(static_cast<StyleLoadFlag>(StyleLoadFlag_Reload | StyleLoadFlag_Apply));
+				Style_LoadAll(static_cast<StyleLoadFlag>(StyleLoadFlag_Reload | StyleLoadFlag_Apply | StyleLoadFlag_Lazy));
 			}
 		}
 
 		AutoSave_Stop(saveFlag & FileSaveFlag_EndSession);
-	} else if (!status.bCancelDataLoss) {
+	} else if (!status.bCancelDataLoss && dwLastIOError != ERROR_CANCELLED) {
+		// no error message when saving is canceled by user
 		if (StrNotEmpty(szCurFile)) {
 			lstrcpy(tchFile, szCurFile);
 		}
@@ -7371,7 +8474,7 @@ static BOOL CALLBACK EnumWindProcSingleFileInstance(HWND hwnd, LPARAM lParam) no
 	WCHAR szClassName[64];
 
 	if (GetClassName(hwnd, szClassName, COUNTOF(szClassName))) {
-		if (StrCaseEqual(szClassName, wchWndClass)) {
+		if (StrCaseEqual(szClassName, wchWndClass) && GetProp(hwnd, NP2_STANDBY_WINDOW_PROP) == nullptr) {
 			WCHAR tchFileName[MAX_PATH];
 			if (lpFileArg == nullptr || (GetDlgItemText(hwnd, IDC_FILENAME, tchFileName, COUNTOF(tchFileName)) && PathEquivalent(tchFileName, lpFileArg))) {
 				*AsPointer<HWND *>(lParam) = hwnd;
@@ -7518,6 +8621,81 @@ bool ActivatePrevInst() noexcept {
 	return false;
 }
 
+//=============================================================================
+//
+// Standby instance
+//
+static BOOL CALLBACK EnumWindProcStandbyInstance(HWND hwnd, LPARAM lParam) noexcept {
+	WCHAR szClassName[64];
+	if (GetProp(hwnd, NP2_STANDBY_WINDOW_PROP) != nullptr && GetClassName(hwnd, szClassName, COUNTOF(szClassName))
+		&& StrCaseEqual(szClassName, wchWndClass)) {
+		*AsPointer<HWND *>(lParam) = hwnd;
+		return FALSE;
+	}
+	return TRUE;
+}
+
+HWND FindStandbyInst() noexcept {
+	HWND hwnd = nullptr;
+	EnumWindows(EnumWindProcStandbyInstance, AsInteger<LPARAM>(&hwnd));
+	return hwnd;
+}
+
+void LaunchStandbyInst() noexcept {
+	if (FindStandbyInst() != nullptr) {
+		return;
+	}
+
+	WCHAR szModuleName[MAX_PATH];
+	WCHAR szParameters[MAX_PATH + 128];
+	GetModuleFileName(nullptr, szModuleName, COUNTOF(szModuleName));
+	wsprintf(szParameters, L"\"%s\" -appid=\"%s\" /standby", szModuleName, g_wchAppUserModelID);
+
+	STARTUPINFO si;
+	memset(&si, 0, sizeof(STARTUPINFO));
+	si.cb = sizeof(STARTUPINFO);
+	PROCESS_INFORMATION pi;
+	memset(&pi, 0, sizeof(PROCESS_INFORMATION));
+	// low priority to not compete with current instance
+	if (CreateProcess(szModuleName, szParameters, nullptr, nullptr, FALSE, IDLE_PRIORITY_CLASS, nullptr, g_wchWorkingDirectory, &si, &pi)) {
+		CloseHandle(pi.hProcess);
+		CloseHandle(pi.hThread);
+	}
+}
+
+bool ActivateStandbyInst(int nCmdShow) noexcept {
+	if (!bStandbyInstance || flagPerfStartup || flagStartAsTrayIcon || flagNewFromClipboard || flagPasteBoard || flagPosParam
+		|| flagAlwaysOnTop != TripleBoolean_NotSet || notepadAction != NotepadReplacementAction_None) {
+		return false;
+	}
+
+	HWND hwnd = FindStandbyInst();
+	if (hwnd == nullptr) {
+		return false;
+	}
+
+	DWORD dwProcessId = 0;
+	GetWindowThreadProcessId(hwnd, &dwProcessId);
+	AllowSetForegroundWindow(dwProcessId);
+	if (!SendMessage(hwnd, APPM_ACTIVATE_STANDBY, nCmdShow, 0)) {
+		return false;
+	}
+
+	LPWSTR lpszFile = lpFileArg;
+	if (lpszFile) {
+		WCHAR tchTmp[MAX_PATH];
+		if (ExpandEnvironmentStringsEx(lpszFile, tchTmp)) {
+			lstrcpy(lpszFile, tchTmp);
+		}
+		if (PathIsRelative(lpszFile)) {
+			PathCombine(tchTmp, g_wchWorkingDirectory, lpszFile);
+			lstrcpy(lpszFile, tchTmp);
+		}
+	}
+	ActivatePrevWindow(hwnd, lpszFile);
+	return true;
+}
+
 //=============================================================================
 //
 // RelaunchMultiInst()
@@ -7906,6 +9084,116 @@ void ShowNotificationMessage(WPARAM notifyPos, UINT uidMessage, ...) noexcept {
 	ShowNotificationA(notifyPos, lpszText);
 }
 
+static VOID CALLBACK DirectoryWatcherCallback(PVOID lpParameter, BOOLEAN TimerOrWaitFired) noexcept {
+	UNREFERENCED_PARAMETER(lpParameter);
+	UNREFERENCED_PARAMETER(TimerOrWaitFired);
+	PostMessage(hwndMain, APPM_DIRECTORY_CHANGED, 0, 0);
+}
+
+static VOID CALLBACK LowMemoryCallback(PVOID lpParameter, BOOLEAN TimerOrWaitFired) noexcept {
+	UNREFERENCED_PARAMETER(lpParameter);
+	UNREFERENCED_PARAMETER(TimerOrWaitFired);
+	PostMessage(hwndMain, APPM_LOWMEMORY, 0, 0);
+}
+
+static void LowMemoryWatcher_Arm() noexcept {
+	if (lowMemoryWatcher.hWait != nullptr) {
+		UnregisterWaitEx(lowMemoryWatcher.hWait, INVALID_HANDLE_VALUE);
+		lowMemoryWatcher.hWait = nullptr;
+	}
+	BOOL low = FALSE;
+	if (QueryMemoryResourceNotification(lowMemoryWatcher.hNotification, &low) && !low) {
+		// memory recovered, start again from first tier
+		lowMemoryWatcher.level = SC_RELEASECACHE_LAYOUT;
+	}
+	if (!RegisterWaitForSingleObject(&lowMemoryWatcher.hWait, lowMemoryWatcher.hNotification, LowMemoryCallback, nullptr, INFINITE, WT_EXECUTEONLYONCE)) {
+		lowMemoryWatcher.hWait = nullptr;
+	}
+}
+
+static void LowMemoryWatcher_Start() noexcept {
+	lowMemoryWatcher.hNotification = CreateMemoryResourceNotification(LowMemoryResourceNotification);
+	if (lowMemoryWatcher.hNotification != nullptr) {
+		LowMemoryWatcher_Arm();
+	}
+}
+
+static void LowMemoryWatcher_Stop() noexcept {
+	KillTimer(hwndMain, ID_LOWMEMORYTIMER);
+	if (lowMemoryWatcher.hWait != nullptr) {
+		UnregisterWaitEx(lowMemoryWatcher.hWait, INVALID_HANDLE_VALUE);
+	}
+	if (lowMemoryWatcher.hNotification != nullptr) {
+		CloseHandle(lowMemoryWatcher.hNotification);
+	}
+	memset(&lowMemoryWatcher, 0, sizeof(lowMemoryWatcher));
+}
+
+//=============================================================================
+//
+// OnLowMemory()
+//
+// Release caches that are rebuilt on demand, one more tier each time memory is still low.
+//
+static void OnLowMemory() noexcept {
+	EditReleaseRetainedFile();
+	SciCall_ReleaseCaches(lowMemoryWatcher.level);
+	if (lowMemoryWatcher.level < SC_RELEASECACHE_UNDO) {
+		++lowMemoryWatcher.level;
+	}
+	SetProcessWorkingSetSize(GetCurrentProcess(), static_cast<SIZE_T>(-1), static_cast<SIZE_T>(-1));
+	SetTimer(hwndMain, ID_LOWMEMORYTIMER, NP2_LOWMEMORY_DELAY, nullptr);
+}
+
+static bool DirectoryWatcher_Read() noexcept {
+	const BOOL result = ReadDirectoryChangesW(dirWatcher.hDirectory, dirWatcher.buffer, sizeof(dirWatcher.buffer), FALSE,
+						FILE_NOTIFY_CHANGE_FILE_NAME	| \
+						FILE_NOTIFY_CHANGE_ATTRIBUTES	| \
+						FILE_NOTIFY_CHANGE_SIZE			| \
+						FILE_NOTIFY_CHANGE_LAST_WRITE,
+						nullptr, &dirWatcher.overlapped, nullptr);
+	return result || GetLastError() == ERROR_IO_PENDING;
+}
+
+static void DirectoryWatcher_Stop() noexcept {
+	if (dirWatcher.hDirectory != nullptr) {
+		// wait until callback finished, then cancel pending read
+		UnregisterWaitEx(dirWatcher.hWait, INVALID_HANDLE_VALUE);
+		DWORD cbRead;
+		CancelIo(dirWatcher.hDirectory);
+		GetOverlappedResult(dirWatcher.hDirectory, &dirWatcher.overlapped, &cbRead, TRUE);
+		CloseHandle(dirWatcher.overlapped.hEvent);
+		CloseHandle(dirWatcher.hDirectory);
+		memset(&dirWatcher, 0, sizeof(dirWatcher));
+	}
+}
+
+static bool DirectoryWatcher_Start(LPCWSTR pszDirectory) noexcept {
+	HANDLE hDirectory = CreateFile(pszDirectory, FILE_LIST_DIRECTORY, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+		nullptr, OPEN_EXISTING, FILE_FLAG_BACKUP_SEMANTICS | FILE_FLAG_OVERLAPPED, nullptr);
+	if (hDirectory == INVALID_HANDLE_VALUE) {
+		return false;
+	}
+
+	dirWatcher.hDirectory = hDirectory;
+	// auto reset event, reset by the thread pool wait
+	dirWatcher.overlapped.hEvent = CreateEvent(nullptr, FALSE, FALSE, nullptr);
+	if (dirWatcher.overlapped.hEvent == nullptr
+		|| !RegisterWaitForSingleObject(&dirWatcher.hWait, dirWatcher.overlapped.hEvent, DirectoryWatcherCallback, nullptr, INFINITE, WT_EXECUTEDEFAULT)
+		|| !DirectoryWatcher_Read()) {
+		if (dirWatcher.hWait != nullptr) {
+			UnregisterWaitEx(dirWatcher.hWait, INVALID_HANDLE_VALUE);
+		}
+		if (dirWatcher.overlapped.hEvent != nullptr) {
+			CloseHandle(dirWatcher.overlapped.hEvent);
+		}
+		CloseHandle(hDirectory);
+		memset(&dirWatcher, 0, sizeof(dirWatcher));
+		return false;
+	}
+	return true;
+}
+
 //=============================================================================
 //
 // InstallFileWatching()
@@ -7915,21 +9203,14 @@ void InstallFileWatching(bool terminate) noexcept {
 	terminate = terminate || iFileWatchingMode == FileWatchingMode_None || StrIsEmpty(szCurFile);
 	// Terminate
 	if (bRunningWatch) {
-		if (hChangeHandle) {
-			FindCloseChangeNotification(hChangeHandle);
-			hChangeHandle = nullptr;
-		}
-		if (terminate) {
-			KillTimer(nullptr, ID_WATCHTIMER);
-		}
+		DirectoryWatcher_Stop();
+		KillTimer(hwndMain, ID_WATCHTIMER);
 	}
 
 	dwChangeNotifyTime = 0;
 	bRunningWatch = !terminate;
 	if (bRunningWatch) {
 		// Install
-		SetTimer(nullptr, ID_WATCHTIMER, dwFileCheckInterval, WatchTimerProc);
-
 		WCHAR tchDirectory[MAX_PATH];
 		lstrcpy(tchDirectory, szCurFile);
 		PathRemoveFileSpec(tchDirectory);
@@ -7942,16 +9223,10 @@ void InstallFileWatching(bool terminate) noexcept {
 			memset(&fdCurFile, 0, sizeof(fdCurFile));
 		}
 
-		if ((iFileWatchingOption & FileWatchingOption_LogFile) == FileWatchingOption_None) {
-			hChangeHandle = FindFirstChangeNotification(tchDirectory, FALSE,
-						FILE_NOTIFY_CHANGE_FILE_NAME	| \
-						FILE_NOTIFY_CHANGE_DIR_NAME		| \
-						FILE_NOTIFY_CHANGE_ATTRIBUTES	| \
-						FILE_NOTIFY_CHANGE_SIZE			| \
-						FILE_NOTIFY_CHANGE_LAST_WRITE);
-			if (hChangeHandle == INVALID_HANDLE_VALUE) {
-				hChangeHandle = nullptr;
-			}
+		// polling for continuously updated log file, or when the directory can't be watched
+		if ((iFileWatchingOption & FileWatchingOption_LogFile) != FileWatchingOption_None
+			|| !DirectoryWatcher_Start(tchDirectory)) {
+			SetTimer(hwndMain, ID_WATCHTIMER, dwFileCheckInterval, WatchTimerProc);
 		}
 	}
 }
@@ -7972,21 +9247,58 @@ static void CheckCurrentFileChangedOutsideApp() noexcept {
 	// Check if the changes affect the current file
 	if (IsCurrentFileChangedOutsideApp()) {
 		// Shutdown current watching and give control to main window
-		if (hChangeHandle) {
-			FindCloseChangeNotification(hChangeHandle);
-			hChangeHandle = nullptr;
-		}
+		DirectoryWatcher_Stop();
 		if (iFileWatchingMode == FileWatchingMode_AutoReload) {
 			bRunningWatch = true;
 			dwChangeNotifyTime = GetTickCount();
+			SetTimer(hwndMain, ID_WATCHTIMER, dwFileCheckInterval, WatchTimerProc);
 		} else {
-			KillTimer(nullptr, ID_WATCHTIMER);
+			KillTimer(hwndMain, ID_WATCHTIMER);
 			bRunningWatch = false;
 			dwChangeNotifyTime = 0;
 			SendMessage(hwndMain, APPM_CHANGENOTIFY, 0, 0);
 		}
-	} else if (hChangeHandle) {
-		FindNextChangeNotification(hChangeHandle);
+	} else if (dirWatcher.hDirectory != nullptr) {
+		DirectoryWatcher_Read();
+	}
+}
+
+static void OnDirectoryChanged() noexcept {
+	DWORD cbRead = 0;
+	if (!bRunningWatch || dirWatcher.hDirectory == nullptr) {
+		return;
+	}
+	if (!GetOverlappedResult(dirWatcher.hDirectory, &dirWatcher.overlapped, &cbRead, FALSE)) {
+		if (GetLastError() == ERROR_IO_INCOMPLETE) {
+			// stale message for previous read
+			return;
+		}
+		cbRead = 0;
+	}
+
+	// empty result when buffer overflowed
+	bool changed = cbRead == 0;
+	if (!changed) {
+		LPCWSTR pszName = PathFindFileName(szCurFile);
+		const int cchName = lstrlen(pszName);
+		const BYTE *ptr = reinterpret_cast<const BYTE *>(dirWatcher.buffer);
+		while (true) {
+			const FILE_NOTIFY_INFORMATION *info = reinterpret_cast<const FILE_NOTIFY_INFORMATION *>(ptr);
+			const int cchFile = static_cast<int>(info->FileNameLength / sizeof(WCHAR));
+			if (CompareStringOrdinal(info->FileName, cchFile, pszName, cchName, TRUE) == CSTR_EQUAL) {
+				changed = true;
+				break;
+			}
+			if (info->NextEntryOffset == 0) {
+				break;
+			}
+			ptr += info->NextEntryOffset;
+		}
+	}
+	if (changed) {
+		CheckCurrentFileChangedOutsideApp();
+	} else {
+		DirectoryWatcher_Read();
 	}
 }
 
@@ -8002,28 +9314,18 @@ void CALLBACK WatchTimerProc(HWND hwnd, UINT uMsg, UINT_PTR idEvent, DWORD dwTim
 	UNREFERENCED_PARAMETER(dwTime);
 
 	if (bRunningWatch) {
-		if (dwChangeNotifyTime > 0 && GetTickCount() - dwChangeNotifyTime > dwAutoReloadTimeout) {
-			if (hChangeHandle) {
-				FindCloseChangeNotification(hChangeHandle);
-				hChangeHandle = nullptr;
+		if (dwChangeNotifyTime > 0) {
+			if (GetTickCount() - dwChangeNotifyTime > dwAutoReloadTimeout) {
+				KillTimer(hwndMain, ID_WATCHTIMER);
+				bRunningWatch = false;
+				dwChangeNotifyTime = 0;
+				SendMessage(hwndMain, APPM_CHANGENOTIFY, 0, 0);
 			}
-			KillTimer(nullptr, ID_WATCHTIMER);
-			bRunningWatch = false;
-			dwChangeNotifyTime = 0;
-			SendMessage(hwndMain, APPM_CHANGENOTIFY, 0, 0);
 		}
-		// Check Change Notification Handle
-		// TODO: notification not fired for continuously updated file
-		else if (hChangeHandle) {
-			if (WAIT_OBJECT_0 == WaitForSingleObject(hChangeHandle, 0)) {
-				CheckCurrentFileChangedOutsideApp();
-			}
-		}
-		// polling, not very efficient but useful for watching continuously updated file
-		else if (iFileWatchingOption & FileWatchingOption_LogFile) {
-			if (dwChangeNotifyTime == 0) {
-				CheckCurrentFileChangedOutsideApp();
-			}
+		// polling, not very efficient but useful for watching continuously updated file,
+		// directory change notification is delayed until the writer flushes or closes the file.
+		else if (dirWatcher.hDirectory == nullptr) {
+			CheckCurrentFileChangedOutsideApp();
 		}
 	}
 }
@@ -8069,6 +9371,91 @@ void CALLBACK PasteBoardTimer(HWND hwnd, UINT uMsg, UINT_PTR idEvent, DWORD dwTi
 	}
 }
 
+#define NP2_AUTOSAVE_CHUNK_SIZE		(4U << 20)
+
+struct AutoSaveWorker {
+	HANDLE hThread;
+	HANDLE hFile;
+	Scintilla::IDocumentSnapshot *snapshot;
+	LPWSTR path;
+	DWORD reversion;
+	int saveFlag;
+	int metaLen;
+	BOOL bSuccess;
+	DWORD dwLastError;
+	char meta[(MAX_PATH + 60)*kMaxMultiByteCount + 2];
+};
+
+static void AutoSave_WriteFile(AutoSaveWorker &worker) noexcept {
+	// no encoding conversion, always saved in UTF-8 or ANSI encoding
+	const char *lpData = worker.snapshot->Text();
+	size_t cbData = worker.snapshot->Length();
+	DWORD cbWritten;
+	BOOL bSuccess = worker.metaLen == 0 || WriteFile(worker.hFile, worker.meta, worker.metaLen, &cbWritten, nullptr);
+	while (bSuccess && cbData != 0) {
+		const DWORD request = static_cast<DWORD>(min<size_t>(cbData, NP2_AUTOSAVE_CHUNK_SIZE));
+		bSuccess = WriteFile(worker.hFile, lpData, request, &cbWritten, nullptr) && cbWritten == request;
+		lpData += request;
+		cbData -= request;
+	}
+	worker.dwLastError = GetLastError();
+	worker.bSuccess = bSuccess;
+	CloseHandle(worker.hFile);
+	worker.hFile = nullptr;
+}
+
+static DWORD WINAPI AutoSaveThread(LPVOID lpParam) noexcept {
+	AutoSaveWorker * const worker = static_cast<AutoSaveWorker *>(lpParam);
+	AutoSave_WriteFile(*worker);
+	PostMessage(hwndMain, APPM_AUTOSAVE_DONE, 0, reinterpret_cast<LPARAM>(worker));
+	return 0;
+}
+
+// wait for pending backup, then update backup list on main thread
+void AutoSave_Finish() noexcept {
+	AutoSaveWorker * const worker = autoSaveWorker;
+	if (worker == nullptr) {
+		return;
+	}
+	autoSaveWorker = nullptr;
+	if (worker->hThread != nullptr) {
+		WaitForSingleObject(worker->hThread, INFINITE);
+		CloseHandle(worker->hThread);
+	}
+	worker->snapshot->Release();
+	dwLastIOError = worker->dwLastError;
+
+	LPWSTR path = worker->path;
+	const int saveFlag = worker->saveFlag;
+	if (worker->bSuccess) {
+		dwLastSavedDocReversion = worker->reversion;
+		if (saveFlag & FileSaveFlag_SaveAlways) {
+			// treat "Save Backup" as "Save As" with generated file name
+			LocalFree(path);
+			path = nullptr;
+		} else {
+			if (!(saveFlag & FileSaveFlag_SaveCopy) && autoSaveCount == MaxAutoSaveCount) {
+				// delete oldest backup
+				LPWSTR old = autoSavePathList[0];
+				if (old) {
+					if (!(iAutoSaveOption & AutoSaveOption_ManuallyDelete)) {
+						DeleteFile(old);
+					}
+					LocalFree(old);
+				}
+				memmove(AsVoidPointer(autoSavePathList), AsVoidPointer(autoSavePathList + 1), (AllAutoSaveCount - 1) * sizeof(LPWSTR));
+				autoSavePathList[AllAutoSaveCount - 1] = nullptr;
+				--autoSaveCount;
+			}
+			autoSavePathList[autoSaveCount++] = path;
+		}
+	} else if (path) {
+		DeleteFile(path);
+		LocalFree(path);
+	}
+	NP2HeapFree(worker);
+}
+
 void AutoSave_Start(bool reset) noexcept {
 	if ((iAutoSaveOption & AutoSaveOption_Periodic) && dwAutoSavePeriod != 0) {
 		if (reset || !bAutoSaveTimerSet) {
@@ -8084,6 +9471,7 @@ void AutoSave_Start(bool reset) noexcept {
 }
 
 void AutoSave_Stop(BOOL keepBackup) noexcept {
+	AutoSave_Finish();
 	dwCurrentDocReversion = 0;
 	dwLastSavedDocReversion = 0;
 	if (bAutoSaveTimerSet) {
@@ -8134,13 +9522,18 @@ void AutoSave_DoWork(FileSaveFlag saveFlag) noexcept {
 		return;
 	}
 
-	const DWORD cbData = static_cast<DWORD>(SciCall_GetLength());
-	if (cbData == 0) {
+	if (autoSaveWorker != nullptr) {
+		if (saveFlag == FileSaveFlag_Default) {
+			return; // previous backup is still being written
+		}
+		AutoSave_Finish();
+	}
+	if (SciCall_GetLength() == 0) {
 		return;
 	}
 
 	const bool Untitled = StrIsEmpty(szCurFile);
-	if (!Untitled && saveFlag == FileSaveFlag_Default && (iAutoSaveOption & AutoSaveOption_OverwriteCurrent)) {
+	if (!Untitled && !bCompressedFile && saveFlag == FileSaveFlag_Default && (iAutoSaveOption & AutoSaveOption_OverwriteCurrent)) {
 		// overwrite current file
 		EditFileIOStatus status{};
 		status.iEncoding = iCurrentEncoding;
@@ -8213,14 +9606,25 @@ void AutoSave_DoWork(FileSaveFlag saveFlag) noexcept {
 		return;
 	}
 
-	DWORD length = cbData + COUNTOF(suffix)*kMaxMultiByteCount + 1;
-	char *lpData = static_cast<char *>(NP2HeapAlloc(length));
+	AutoSaveWorker *worker = static_cast<AutoSaveWorker *>(NP2HeapAlloc(sizeof(AutoSaveWorker)));
+	// snapshot shares text with other background readers, it's released on first change
+	Scintilla::IDocumentSnapshot *snapshot = (worker == nullptr) ? nullptr : SciCall_CreateDocumentSnapshot();
+	if (snapshot == nullptr) {
+		CloseHandle(hFile);
+		DeleteFile(tchPath);
+		if (worker != nullptr) {
+			NP2HeapFree(worker);
+		}
+		return;
+	}
+
 	if (metaLen) {
 		lstrcpy(suffix, L"AutoSave for ");
 		lstrcat(suffix, szCurFile);
 		metaLen = lstrlen(suffix);
 		const UINT cpEdit = (iCurrentEncoding == CPI_DEFAULT) ? CP_ACP : CP_UTF8;
-		metaLen = WideCharToMultiByte(cpEdit, 0, suffix, metaLen, lpData, length, nullptr, nullptr);
+		char * const lpData = worker->meta;
+		metaLen = WideCharToMultiByte(cpEdit, 0, suffix, metaLen, lpData, sizeof(worker->meta) - 2, nullptr, nullptr);
 		switch (iCurrentEOLMode) {
 		default: // SC_EOL_CRLF
 			lpData[metaLen++] = '\r';
@@ -8235,36 +9639,414 @@ void AutoSave_DoWork(FileSaveFlag saveFlag) noexcept {
 		}
 	}
 
-	SciCall_GetText(cbData, lpData + metaLen);
-	SetEndOfFile(hFile);
-	// no encoding conversion, always saved in UTF-8 or ANSI encoding
-	const BOOL bWriteSuccess = WriteFile(hFile, lpData, cbData + metaLen, &length, nullptr);
-	dwLastIOError = GetLastError();
-	CloseHandle(hFile);
-	NP2HeapFree(lpData);
+	worker->hFile = hFile;
+	worker->snapshot = snapshot;
+	worker->path = StrDup(tchPath);
+	worker->reversion = dwCurrentDocReversion;
+	worker->saveFlag = saveFlag;
+	worker->metaLen = metaLen;
+	autoSaveWorker = worker;
+	// periodic backup is written on background, the editor is not blocked for large document
+	if (saveFlag == FileSaveFlag_Default) {
+		worker->hThread = CreateThread(nullptr, 0, AutoSaveThread, worker, 0, nullptr);
+	}
+	if (worker->hThread == nullptr) {
+		AutoSave_WriteFile(*worker);
+		AutoSave_Finish();
+	}
+}
 
-	if (bWriteSuccess) {
-		if (saveFlag & FileSaveFlag_SaveAlways) {
-			dwLastSavedDocReversion = dwCurrentDocReversion;
-			return; // treat "Save Backup" as "Save As" with generated file name
-		}
-		if (!(saveFlag & FileSaveFlag_SaveCopy) && autoSaveCount == MaxAutoSaveCount) {
-			// delete oldest backup
-			LPWSTR old = autoSavePathList[0];
-			if (old) {
-				if (!(iAutoSaveOption & AutoSaveOption_ManuallyDelete)) {
-					DeleteFile(old);
-				}
-				LocalFree(old);
-			}
-			memmove(AsVoidPointer(autoSavePathList), AsVoidPointer(autoSavePathList + 1), (AllAutoSaveCount - 1) * sizeof(LPWSTR));
-			autoSavePathList[AllAutoSaveCount - 1] = nullptr;
-			--autoSaveCount;
+//=============================================================================
+//
+// Edit journal: insert and delete operations on current file are appended to a recovery file
+// in AutoSave folder and flushed on background thread. When the file is opened again after
+// a crash, the operations are replayed onto it.
+//
+#define NP2_JOURNAL_MAGIC			0x4A34504EU	// 'NP4J'
+#define NP2_JOURNAL_VERSION			1
+#define NP2_JOURNAL_FLUSH_DELAY		1000	// milliseconds
+#define NP2_JOURNAL_COMPACT_SIZE	(64U << 20)
+#define NP2_JOURNAL_MAX_SIZE		(1U << 30)	// larger journal is not recovered
+#define NP2_JOURNAL_CHUNK_SIZE		(4U << 20)
+
+enum JournalOp {
+	JournalOp_Insert = 1,
+	JournalOp_Delete = 2,
+	JournalOp_Replace = 3,	// replace whole text, written by compaction
+};
+
+struct JournalHeader {
+	uint32_t magic;
+	uint32_t version;
+	int64_t fileSize;
+	FILETIME ftLastWriteTime;
+	uint32_t codePage;
+	uint32_t reserved;
+	int64_t docLength;		// document length after the file was loaded or saved
+};
+
+// insert and replace are followed by text
+struct JournalRecord {
+	uint32_t op;
+	uint32_t codePage;
+	int64_t position;
+	int64_t length;
+};
+
+struct EditJournal {
+	HANDLE hFile;
+	HANDLE hThread;
+	HANDLE eventFlush;
+	SRWLOCK lock;
+	// guarded by lock
+	char *buffer;
+	size_t bufferSize;
+	size_t bufferCapacity;
+	Scintilla::IDocumentSnapshot *snapshot;	// compact into one replace record
+	JournalHeader header;
+	UINT codePage;
+	bool rewrite;			// truncate journal and write header
+	bool stop;
+	// used on main thread
+	bool timerSet;
+	bool invalid;
+	Sci_Position docLength;
+	uint64_t journalSize;	// approximate size written since last rewrite
+	WCHAR path[MAX_PATH];
+	WCHAR source[MAX_PATH];
+};
+
+static EditJournal editJournal;
+
+static void Journal_GetPath(LPCWSTR pszFile, LPWSTR path) noexcept {
+	WCHAR tch[MAX_PATH];
+	lstrcpyn(tch, pszFile, COUNTOF(tch));
+	CharLower(tch);
+	uint32_t hash = 2166136261U;
+	for (LPCWSTR p = tch; *p; p++) {
+		hash = (hash ^ *p) * 16777619U;
+	}
+
+	WCHAR name[MAX_PATH];
+	lstrcpyn(name, PathFindFileName(pszFile), MAX_PATH - 32);
+	wsprintf(name + lstrlen(name), L".%08X.journal", hash);
+	PathCombine(path, AutoSave_GetDefaultFolder(), name);
+}
+
+static bool Journal_FillHeader(LPCWSTR pszFile, JournalHeader &header) noexcept {
+	WIN32_FILE_ATTRIBUTE_DATA fad;
+	if (!GetFileAttributesEx(pszFile, GetFileExInfoStandard, &fad)) {
+		return false;
+	}
+	memset(&header, 0, sizeof(header));
+	header.magic = NP2_JOURNAL_MAGIC;
+	header.version = NP2_JOURNAL_VERSION;
+	header.fileSize = (static_cast<int64_t>(fad.nFileSizeHigh) << 32) | fad.nFileSizeLow;
+	header.ftLastWriteTime = fad.ftLastWriteTime;
+	header.codePage = SciCall_GetCodePage();
+	header.docLength = SciCall_GetLength();
+	return true;
+}
+
+static BOOL Journal_WriteData(HANDLE hFile, const char *lpData, size_t cbData) noexcept {
+	BOOL bSuccess = TRUE;
+	while (bSuccess && cbData != 0) {
+		const DWORD request = static_cast<DWORD>(min<size_t>(cbData, NP2_JOURNAL_CHUNK_SIZE));
+		DWORD cbWritten;
+		bSuccess = WriteFile(hFile, lpData, request, &cbWritten, nullptr);
+		lpData += request;
+		cbData -= request;
+	}
+	return bSuccess;
+}
+
+static DWORD WINAPI Journal_WriterThread(LPVOID lpParam) noexcept {
+	EditJournal * const journal = static_cast<EditJournal *>(lpParam);
+	HANDLE hFile = journal->hFile;
+	bool stop = false;
+	while (!stop) {
+		WaitForSingleObject(journal->eventFlush, INFINITE);
+		AcquireSRWLockExclusive(&journal->lock);
+		char * const buffer = journal->buffer;
+		const size_t size = journal->bufferSize;
+		journal->buffer = nullptr;
+		journal->bufferSize = 0;
+		journal->bufferCapacity = 0;
+		Scintilla::IDocumentSnapshot * const snapshot = journal->snapshot;
+		journal->snapshot = nullptr;
+		const bool rewrite = journal->rewrite;
+		journal->rewrite = false;
+		const JournalHeader header = journal->header;
+		const UINT codePage = journal->codePage;
+		stop = journal->stop;
+		ReleaseSRWLockExclusive(&journal->lock);
+
+		if (rewrite) {
+			LARGE_INTEGER offset{};
+			SetFilePointerEx(hFile, offset, nullptr, FILE_BEGIN);
+			Journal_WriteData(hFile, reinterpret_cast<const char *>(&header), sizeof(header));
+			if (snapshot != nullptr) {
+				const JournalRecord record = { JournalOp_Replace, codePage, 0, snapshot->Length() };
+				Journal_WriteData(hFile, reinterpret_cast<const char *>(&record), sizeof(record));
+				Journal_WriteData(hFile, snapshot->Text(), snapshot->Length());
+			}
+			SetEndOfFile(hFile);
+		}
+		if (snapshot != nullptr) {
+			snapshot->Release();
+		}
+		if (buffer != nullptr) {
+			Journal_WriteData(hFile, buffer, size);
+			NP2HeapFree(buffer);
+		}
+		if (rewrite || size != 0) {
+			FlushFileBuffers(hFile);
 		}
+	}
+	return 0;
+}
+
+void Journal_Stop(bool keep) noexcept {
+	EditJournal &journal = editJournal;
+	if (journal.hThread == nullptr) {
+		return;
+	}
+	if (journal.timerSet) {
+		KillTimer(hwndMain, ID_JOURNALTIMER);
+	}
+
+	// remaining operations are written before the thread exits
+	AcquireSRWLockExclusive(&journal.lock);
+	journal.stop = true;
+	ReleaseSRWLockExclusive(&journal.lock);
+	SetEvent(journal.eventFlush);
+	WaitForSingleObject(journal.hThread, INFINITE);
+	CloseHandle(journal.hThread);
+	CloseHandle(journal.eventFlush);
+	CloseHandle(journal.hFile);
+	if (!keep) {
+		DeleteFile(journal.path);
+	}
+	memset(&journal, 0, sizeof(journal));
+}
+
+void Journal_Start() noexcept {
+	Journal_Stop(false);
+	if (!bEditJournal || StrIsEmpty(szCurFile)) {
+		return;
+	}
+
+	EditJournal &journal = editJournal;
+	lstrcpy(journal.source, szCurFile);
+	Journal_GetPath(szCurFile, journal.path);
+	if (!Journal_FillHeader(journal.source, journal.header)) {
+		memset(&journal, 0, sizeof(journal));
+		return;
+	}
+	// opened by another instance
+	journal.hFile = CreateFile(journal.path, GENERIC_WRITE, FILE_SHARE_READ,
+							   nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+	if (journal.hFile == INVALID_HANDLE_VALUE) {
+		memset(&journal, 0, sizeof(journal));
+		return;
+	}
 
-		autoSavePathList[autoSaveCount++] = StrDup(tchPath);
-		dwLastSavedDocReversion = dwCurrentDocReversion;
+	InitializeSRWLock(&journal.lock);
+	journal.eventFlush = CreateEvent(nullptr, FALSE, TRUE, nullptr);
+	journal.codePage = journal.header.codePage;
+	journal.rewrite = true;
+	journal.docLength = journal.header.docLength;
+	journal.hThread = CreateThread(nullptr, 0, Journal_WriterThread, &journal, 0, nullptr);
+	if (journal.hThread == nullptr) {
+		if (journal.eventFlush != nullptr) {
+			CloseHandle(journal.eventFlush);
+		}
+		CloseHandle(journal.hFile);
+		DeleteFile(journal.path);
+		memset(&journal, 0, sizeof(journal));
+	}
+}
+
+void Journal_Record(int modificationType, Sci_Position position, Sci_Position length, const char *text) noexcept {
+	EditJournal &journal = editJournal;
+	if (journal.hThread == nullptr || journal.invalid) {
+		return;
+	}
+
+	const bool insert = (modificationType & SC_MOD_INSERTTEXT) != 0;
+	const size_t size = sizeof(JournalRecord) + (insert ? length : 0);
+	if (insert && text == nullptr) {
+		journal.invalid = true;
 	} else {
-		DeleteFile(tchPath);
+		AcquireSRWLockExclusive(&journal.lock);
+		if (journal.bufferSize + size > journal.bufferCapacity) {
+			const size_t capacity = max(journal.bufferCapacity*2, journal.bufferSize + size + 4096);
+			char *buffer = static_cast<char *>((journal.buffer == nullptr) ? NP2HeapAlloc(capacity) : NP2HeapReAlloc(journal.buffer, capacity));
+			if (buffer == nullptr) {
+				journal.invalid = true;
+			} else {
+				journal.buffer = buffer;
+				journal.bufferCapacity = capacity;
+			}
+		}
+		if (!journal.invalid) {
+			const JournalRecord record = { static_cast<uint32_t>(insert ? JournalOp_Insert : JournalOp_Delete), 0, position, length };
+			char *ptr = journal.buffer + journal.bufferSize;
+			memcpy(ptr, &record, sizeof(record));
+			if (insert) {
+				memcpy(ptr + sizeof(record), text, length);
+			}
+			journal.bufferSize += size;
+		}
+		ReleaseSRWLockExclusive(&journal.lock);
+		journal.docLength += insert ? length : -length;
+		journal.journalSize += size;
+	}
+
+	if (!journal.timerSet) {
+		journal.timerSet = true;
+		SetTimer(hwndMain, ID_JOURNALTIMER, NP2_JOURNAL_FLUSH_DELAY, nullptr);
+	}
+}
+
+void Journal_Flush() noexcept {
+	EditJournal &journal = editJournal;
+	if (journal.timerSet) {
+		journal.timerSet = false;
+		KillTimer(hwndMain, ID_JOURNALTIMER);
+	}
+	if (journal.hThread == nullptr) {
+		return;
+	}
+
+	// changes made without notification, or journal grown larger than the document
+	const Sci_Position docLength = SciCall_GetLength();
+	const UINT codePage = SciCall_GetCodePage();
+	if (journal.invalid || journal.docLength != docLength || journal.codePage != codePage
+		|| journal.journalSize > max<uint64_t>(NP2_JOURNAL_COMPACT_SIZE, 2*static_cast<uint64_t>(docLength))) {
+		Scintilla::IDocumentSnapshot *snapshot = SciCall_CreateDocumentSnapshot();
+		if (snapshot != nullptr) {
+			AcquireSRWLockExclusive(&journal.lock);
+			journal.bufferSize = 0;
+			if (journal.snapshot != nullptr) {
+				journal.snapshot->Release();
+			}
+			journal.snapshot = snapshot;
+			journal.codePage = codePage;
+			journal.rewrite = true;
+			ReleaseSRWLockExclusive(&journal.lock);
+			journal.invalid = false;
+			journal.docLength = docLength;
+			journal.journalSize = docLength;
+		}
+	}
+	SetEvent(journal.eventFlush);
+}
+
+// file on disk matches the document, discard recorded operations
+void Journal_Rebase() noexcept {
+	EditJournal &journal = editJournal;
+	JournalHeader header;
+	if (journal.hThread == nullptr || !Journal_FillHeader(journal.source, header)) {
+		return;
+	}
+
+	AcquireSRWLockExclusive(&journal.lock);
+	journal.bufferSize = 0;
+	if (journal.snapshot != nullptr) {
+		journal.snapshot->Release();
+		journal.snapshot = nullptr;
+	}
+	journal.header = header;
+	journal.codePage = header.codePage;
+	journal.rewrite = true;
+	ReleaseSRWLockExclusive(&journal.lock);
+	journal.invalid = false;
+	journal.docLength = header.docLength;
+	journal.journalSize = 0;
+	SetEvent(journal.eventFlush);
+}
+
+// replay journal left by crashed instance onto the just loaded file, returns true when journal is started
+bool Journal_Recover() noexcept {
+	if (!bEditJournal || StrIsEmpty(szCurFile) || bReadOnlyMode) {
+		return false;
+	}
+
+	WCHAR path[MAX_PATH];
+	Journal_GetPath(szCurFile, path);
+	// fails when the journal is still used by another instance
+	HANDLE hFile = CreateFile(path, GENERIC_READ, 0, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+	if (hFile == INVALID_HANDLE_VALUE) {
+		return false;
+	}
+
+	char *data = nullptr;
+	DWORD cbData = 0;
+	LARGE_INTEGER size;
+	if (GetFileSizeEx(hFile, &size) && size.QuadPart > static_cast<LONGLONG>(sizeof(JournalHeader))
+		&& size.QuadPart <= NP2_JOURNAL_MAX_SIZE) {
+		data = static_cast<char *>(NP2HeapAlloc(size.LowPart));
+		if (data != nullptr && !(ReadFile(hFile, data, size.LowPart, &cbData, nullptr) && cbData == size.LowPart)) {
+			cbData = 0;
+		}
+	}
+	CloseHandle(hFile);
+
+	JournalHeader header;
+	bool valid = cbData != 0 && Journal_FillHeader(szCurFile, header);
+	if (valid) {
+		const JournalHeader *saved = reinterpret_cast<const JournalHeader *>(data);
+		valid = saved->magic == header.magic && saved->version == header.version
+			&& saved->fileSize == header.fileSize && CompareFileTime(&saved->ftLastWriteTime, &header.ftLastWriteTime) == 0
+			&& saved->codePage == header.codePage && saved->docLength == header.docLength
+			&& cbData > sizeof(JournalHeader) + sizeof(JournalRecord);
+	}
+	if (!valid || MsgBoxAsk(MB_YESNO, IDS_ASK_RECOVER_JOURNAL, szCurFile) != IDYES) {
+		if (data != nullptr) {
+			NP2HeapFree(data);
+		}
+		DeleteFile(path);
+		return false;
+	}
+
+	// replayed operations are recorded into new journal
+	Journal_Start();
+	SciCall_BeginUndoAction();
+	size_t offset = sizeof(JournalHeader);
+	while (offset + sizeof(JournalRecord) <= cbData) {
+		JournalRecord record;
+		memcpy(&record, data + offset, sizeof(record));
+		offset += sizeof(record);
+		const Sci_Position docLength = SciCall_GetLength();
+		if (record.position < 0 || record.length < 0) {
+			break;
+		}
+		if (record.op == JournalOp_Insert) {
+			if (record.position > docLength || static_cast<uint64_t>(record.length) > cbData - offset) {
+				break;
+			}
+			SciCall_SetTargetRange(record.position, record.position);
+			SciCall_ReplaceTarget(record.length, data + offset);
+			offset += record.length;
+		} else if (record.op == JournalOp_Delete) {
+			if (record.position + record.length > docLength) {
+				break;
+			}
+			SciCall_DeleteRange(record.position, record.length);
+		} else if (record.op == JournalOp_Replace) {
+			// text converted to another encoding is not recovered
+			if (record.codePage != header.codePage || static_cast<uint64_t>(record.length) > cbData - offset) {
+				break;
+			}
+			SciCall_SetTargetRange(0, docLength);
+			SciCall_ReplaceTarget(record.length, data + offset);
+			offset += record.length;
+		} else {
+			break;
+		}
 	}
+	SciCall_EndUndoAction();
+	NP2HeapFree(data);
+	return true;
 }
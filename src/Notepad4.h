@@ -129,10 +129,22 @@ enum {
 // https://www.codeproject.com/tips/1017834/how-to-send-data-from-one-process-to-another-in-cs
 #define APPM_COPYDATA				(WM_APP + 6)
 #define APPM_DROPFILES				(WM_APP + 7)	// ScintillaWin::Drop()
+#define APPM_INVALID_UTF8			(WM_APP + 8)	// EditVerifyUTF8Async()
+#define APPM_DIRECTORY_CHANGED		(WM_APP + 9)	// ReadDirectoryChangesW() completed
+#define APPM_ACTIVATE_STANDBY		(WM_APP + 10)	// hand over command line to standby instance
+#define APPM_AUTOSAVE_DONE			(WM_APP + 11)	// AutoSave_DoWork() backup written
+#define APPM_FINDINFILES_UPDATE		(WM_APP + 12)	// EditFindInFiles() results appended or finished
+#define APPM_COMPARE_DONE			(WM_APP + 13)	// EditCompareFile() finished
+#define APPM_FINDASYOUTYPE			(WM_APP + 14)	// EditFindAsYouType() first match found or matches counted
+#define APPM_LOWMEMORY				(WM_APP + 15)	// low memory resource notification signaled
 
 #define ID_WATCHTIMER				0xA000	// file watch timer
 #define ID_PASTEBOARDTIMER			0xA001	// paste board timer
 #define ID_AUTOSAVETIMER			0xA002	// AutoSave timer
+#define ID_JOURNALTIMER				0xA003	// edit journal flush timer
+#define ID_UPDATEUITIMER			0xA004	// coalesced SCN_UPDATEUI work timer
+#define ID_LOWMEMORYTIMER			0xA005	// re-arm low memory wait timer
+#define ID_BACKGROUNDTIMER			0xA006	// release caches of background window
 
 enum EscFunction {
 	EscFunction_None = 0,
@@ -207,6 +219,12 @@ struct WindowPositionRecord {
 	int xFindReplaceDlg;
 	int yFindReplaceDlg;
 	int cxFindReplaceDlg;
+	int cxFindAllResultsDlg;
+	int cyFindAllResultsDlg;
+	int cxFindInFilesDlg;
+	int cyFindInFilesDlg;
+	int cxGotoSymbolDlg;
+	int cyGotoSymbolDlg;
 
 	int cxStyleSelectDlg;
 	int cyStyleSelectDlg;
@@ -220,6 +238,9 @@ extern WindowPositionRecord positionRecord;
 BOOL InitApplication(HINSTANCE hInstance) noexcept;
 void InitInstance(HINSTANCE hInstance, int nCmdShow);
 bool ActivatePrevInst() noexcept;
+HWND FindStandbyInst() noexcept;
+void LaunchStandbyInst() noexcept;
+bool ActivateStandbyInst(int nCmdShow) noexcept;
 void GetRelaunchParameters(LPWSTR szParameters, LPCWSTR lpszFile, bool newWind, bool emptyWind) noexcept;
 bool RelaunchMultiInst() noexcept;
 bool RelaunchElevated() noexcept;
@@ -252,6 +273,7 @@ void UpdateStatusBarCache(int item) noexcept;
 void UpdateToolbar() noexcept;
 void UpdateFoldMarginWidth() noexcept;
 void UpdateLineNumberWidth() noexcept;
+void UpdateLineNumberWidthForLines() noexcept;
 void UpdateBookmarkMarginWidth() noexcept;
 
 enum {
@@ -270,7 +292,10 @@ struct EditFileIOStatus {
 	bool bFileTooBig;	// load output
 	bool bUnicodeErr;	// load output
 	bool bBinaryFile;	// load output
+	bool bEncodingSampled;// load output, UTF-8 detected from samples
 	bool bCancelDataLoss;// save output
+	bool bViewerMode;	// load output, file opened in read-only viewer
+	bool bCompressed;	// load output, decompressed from gzip file
 
 	// inconsistent line endings
 	bool bLineEndingsDefaultNo; // set default button to "No"
@@ -317,6 +342,13 @@ enum {
 void	AutoSave_Start(bool reset) noexcept;
 void	AutoSave_Stop(BOOL keepBackup) noexcept;
 void	AutoSave_DoWork(FileSaveFlag saveFlag) noexcept;
+void	AutoSave_Finish() noexcept;
+void	Journal_Start() noexcept;
+void	Journal_Stop(bool keep) noexcept;
+void	Journal_Record(int modificationType, Sci_Position position, Sci_Position length, const char *text) noexcept;
+void	Journal_Flush() noexcept;
+void	Journal_Rebase() noexcept;
+bool	Journal_Recover() noexcept;
 LPCWSTR AutoSave_GetDefaultFolder() noexcept;
 
 LRESULT CALLBACK MainWndProc(HWND hwnd, UINT umsg, WPARAM wParam, LPARAM lParam);
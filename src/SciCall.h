@@ -17,6 +17,7 @@
 #pragma once
 
 #include "Scintilla.h"
+#include "ILoader.h"
 #include "compiler.h"
 
 extern HANDLE g_hScintilla;
@@ -178,14 +179,26 @@ inline Sci_Position SciCall_ReplaceTargetRE(Sci_Position length, const char *tex
 	return SciCall(SCI_REPLACETARGETRE, length, AsInteger<LPARAM>(text));
 }
 
+inline Sci_Position SciCall_ReplaceTargetMinimal(Sci_Position length, const char *text) noexcept {
+	return SciCall(SCI_REPLACETARGETMINIMAL, length, AsInteger<LPARAM>(text));
+}
+
 inline Sci_Position SciCall_FindTextFull(int searchFlags, Sci_TextToFindFull *ft) noexcept {
 	return SciCall(SCI_FINDTEXTFULL, searchFlags, AsInteger<LPARAM>(ft));
 }
 
+inline Sci_Position SciCall_FindAllFull(int searchFlags, Sci_TextToFindAllFull *ft) noexcept {
+	return SciCall(SCI_FINDALLFULL, searchFlags, AsInteger<LPARAM>(ft));
+}
+
 inline Sci_Position SciCall_ReplaceTargetEx(BOOL regex, Sci_Position length, const char *text) noexcept {
 	return SciCall(regex ? SCI_REPLACETARGETRE : SCI_REPLACETARGET, length, AsInteger<LPARAM>(text));
 }
 
+inline Sci_Position SciCall_ReplaceAllInTarget(BOOL regex, const char *search, const char *text) noexcept {
+	return SciCall(regex ? SCI_REPLACEALLINTARGETRE : SCI_REPLACEALLINTARGET, AsInteger<WPARAM>(search), AsInteger<LPARAM>(text));
+}
+
 // Overtype
 
 inline BOOL SciCall_GetOvertype() noexcept {
@@ -252,6 +265,10 @@ inline void SciCall_SetUndoCollection(bool collectUndo) noexcept {
 	SciCall(SCI_SETUNDOCOLLECTION, collectUndo, 0);
 }
 
+inline void SciCall_SetUndoMemoryBudget(size_t bytes) noexcept {
+	SciCall(SCI_SETUNDOMEMORYBUDGET, bytes, 0);
+}
+
 inline void SciCall_BeginUndoAction() noexcept {
 	SciCall(SCI_BEGINUNDOACTION, 0, 0);
 }
@@ -290,10 +307,42 @@ inline Sci_Line SciCall_GetLineCount() noexcept {
 	return SciCall(SCI_GETLINECOUNT, 0, 0);
 }
 
+inline size_t SciCall_GetMemoryUsage(int usage) noexcept {
+	return SciCall(SCI_GETMEMORYUSAGE, usage, 0);
+}
+
+inline void SciCall_ReleaseCaches(int level) noexcept {
+	SciCall(SCI_RELEASECACHES, level, 0);
+}
+
+inline void SciCall_SetStylingDuration(int nanoseconds) noexcept {
+	SciCall(SCI_SETSTYLINGDURATION, nanoseconds, 0);
+}
+
+inline int SciCall_GetStylingDuration() noexcept {
+	return static_cast<int>(SciCall(SCI_GETSTYLINGDURATION, 0, 0));
+}
+
+inline Sci_Position SciCall_GetFrameStatistic(int statistic) noexcept {
+	return SciCall(SCI_GETFRAMESTATISTIC, statistic, 0);
+}
+
+inline void SciCall_SetLayoutCacheBudget(size_t bytes) noexcept {
+	SciCall(SCI_SETLAYOUTCACHEBUDGET, bytes, 0);
+}
+
+inline Sci_Position SciCall_GetLayoutCacheStatistic(int statistic) noexcept {
+	return SciCall(SCI_GETLAYOUTCACHESTATISTIC, statistic, 0);
+}
+
 inline void SciCall_AllocateLines(Sci_Line lineCount) noexcept {
 	SciCall(SCI_ALLOCATELINES, lineCount, 0);
 }
 
+inline void SciCall_SetLineStartsHint(Sci_Line lineCount, const Sci_Position *lineStarts) noexcept {
+	SciCall(SCI_SETLINESTARTSHINT, lineCount, AsInteger<LPARAM>(lineStarts));
+}
+
 inline void SciCall_SetSel(Sci_Position anchor, Sci_Position caret) noexcept {
 	SciCall(SCI_SETSEL, anchor, caret);
 }
@@ -484,6 +533,14 @@ inline bool SciCall_IsSelectionEmpty() noexcept {
 	return static_cast<bool>(SciCall(SCI_GETSELECTIONEMPTY, 0, 0));
 }
 
+inline Sci_Position SciCall_GetSelectionNStart(size_t selection) noexcept {
+	return SciCall(SCI_GETSELECTIONNSTART, selection, 0);
+}
+
+inline Sci_Position SciCall_GetSelectionNEnd(size_t selection) noexcept {
+	return SciCall(SCI_GETSELECTIONNEND, selection, 0);
+}
+
 inline void SciCall_ClearSelections() noexcept {
 	SciCall(SCI_CLEARSELECTIONS, 0, 0);
 }
@@ -635,6 +692,26 @@ inline void SciCall_SetIdleStyling(int idleStyling) noexcept {
 	SciCall(SCI_SETIDLESTYLING, idleStyling, 0);
 }
 
+inline void SciCall_SetBackgroundStyling(bool background) noexcept {
+	SciCall(SCI_SETBACKGROUNDSTYLING, background, 0);
+}
+
+inline SciFnLineStyler SciCall_GetLineStyler() noexcept {
+	return reinterpret_cast<SciFnLineStyler>(SciCall(SCI_GETLINESTYLER, 0, 0));
+}
+
+inline void SciCall_SetLineStyler(SciFnLineStyler styler) noexcept {
+	SciCall(SCI_SETLINESTYLER, 0, reinterpret_cast<LPARAM>(styler));
+}
+
+inline Sci_Position SciCall_GetStylingCache(char *cache) noexcept {
+	return SciCall(SCI_GETSTYLINGCACHE, 0, AsInteger<LPARAM>(cache));
+}
+
+inline bool SciCall_SetStylingCache(Sci_Position length, const char *cache) noexcept {
+	return SciCall(SCI_SETSTYLINGCACHE, length, AsInteger<LPARAM>(cache));
+}
+
 inline void SciCall_StartStyling(Sci_Position start) noexcept {
 	SciCall(SCI_STARTSTYLING, start, 0);
 }
@@ -873,6 +950,10 @@ inline int SciCall_GetTechnology() noexcept {
 	return static_cast<int>(SciCall(SCI_GETTECHNOLOGY, 0, 0));
 }
 
+inline void SciCall_SetScrollBlit(bool blit) noexcept {
+	SciCall(SCI_SETSCROLLBLIT, blit, 0);
+}
+
 inline void SciCall_SetBidirectional(int bidirectional) noexcept {
 	SciCall(SCI_SETBIDIRECTIONAL, bidirectional, 0);
 }
@@ -1078,6 +1159,10 @@ inline void SciCall_IndicatorFillRange(Sci_Position start, Sci_Position length)
 	SciCall(SCI_INDICATORFILLRANGE, start, length);
 }
 
+inline void SciCall_IndicatorFillRanges(size_t count, const Sci_Position *ranges) noexcept {
+	SciCall(SCI_INDICATORFILLRANGES, count, AsInteger<LPARAM>(ranges));
+}
+
 // Autocompletion
 
 inline void SciCall_AutoCShow(Sci_Position lengthEntered, const char *itemList) noexcept {
@@ -1124,6 +1209,10 @@ inline void SciCall_AutoCSetOrder(int ordere) noexcept {
 	SciCall(SCI_AUTOCSETORDER, ordere, 0);
 }
 
+inline void SciCall_AutoCSetAutoHide(bool autoHide) noexcept {
+	SciCall(SCI_AUTOCSETAUTOHIDE, autoHide, 0);
+}
+
 inline void SciCall_AutoCSetOptions(int options) noexcept {
 	SciCall(SCI_AUTOCSETOPTIONS, options, 0);
 }
@@ -1296,12 +1385,40 @@ inline void SciCall_SetPrintColorMode(int mode) noexcept {
 
 // Direct access
 
+inline const char* SciCall_GetCharacterPointer() noexcept {
+	return AsPointer<const char *>(SciCall(SCI_GETCHARACTERPOINTER, 0, 0));
+}
+
 inline const char* SciCall_GetRangePointer(Sci_Position start, Sci_Position lengthRange) noexcept {
 	return AsPointer<const char *>(SciCall(SCI_GETRANGEPOINTER, start, lengthRange));
 }
 
+inline Sci_Position SciCall_GetGapPosition() noexcept {
+	return SciCall(SCI_GETGAPPOSITION, 0, 0);
+}
+
+// Read-only view of text in [start, end) without copying it or moving the gap of the buffer,
+// text is split into two segments when the gap is at a character boundary inside the range.
+// Valid until the document is modified.
+struct SciTextRangeView {
+	const char *text[2];
+	Sci_Position length[2];
+};
+
+inline SciTextRangeView SciCall_GetRangeView(Sci_Position start, Sci_Position end) noexcept {
+	const Sci_Position gap = SciCall_GetGapPosition();
+	if (gap > start && gap < end && SciCall_PositionBefore(SciCall_PositionAfter(gap)) == gap) {
+		return { { SciCall_GetRangePointer(start, gap - start), SciCall_GetRangePointer(gap, end - gap) }, { gap - start, end - gap } };
+	}
+	return { { SciCall_GetRangePointer(start, end - start), nullptr }, { end - start, 0 } };
+}
+
 // Multiple views
 
+inline HANDLE SciCall_GetDocPointer() noexcept {
+	return AsPointer<HANDLE>(SciCall(SCI_GETDOCPOINTER, 0, 0));
+}
+
 inline void SciCall_SetDocPointer(HANDLE doc) noexcept {
 	SciCall(SCI_SETDOCPOINTER, 0, AsInteger<LPARAM>(doc));
 }
@@ -1318,12 +1435,28 @@ inline int SciCall_GetDocumentOptions() noexcept {
 	return static_cast<int>(SciCall(SCI_GETDOCUMENTOPTIONS, 0, 0));
 }
 
+inline void SciCall_SetDocumentOptions(int documentOptions) noexcept {
+	SciCall(SCI_SETDOCUMENTOPTIONS, documentOptions, 0);
+}
+
+inline Scintilla::ILoader *SciCall_CreateLoader(Sci_Position bytes, int documentOptions) noexcept {
+	return AsPointer<Scintilla::ILoader *>(SciCall(SCI_CREATELOADER, bytes, documentOptions));
+}
+
+inline Scintilla::IDocumentSnapshot *SciCall_CreateDocumentSnapshot() noexcept {
+	return AsPointer<Scintilla::IDocumentSnapshot *>(SciCall(SCI_CREATEDOCUMENTSNAPSHOT, 0, 0));
+}
+
 // Folding
 
 inline Sci_Line SciCall_DocLineFromVisible(Sci_Line displayLine) noexcept {
 	return SciCall(SCI_DOCLINEFROMVISIBLE, displayLine, 0);
 }
 
+inline Sci_Line SciCall_VisibleFromDocLine(Sci_Line docLine) noexcept {
+	return SciCall(SCI_VISIBLEFROMDOCLINE, docLine, 0);
+}
+
 inline bool SciCall_GetLineVisible(Sci_Line line) noexcept {
 	return static_cast<bool>(SciCall(SCI_GETLINEVISIBLE, line, 0));
 }
@@ -1352,6 +1485,10 @@ inline BOOL SciCall_GetFoldExpanded(Sci_Line line) noexcept {
 	return static_cast<BOOL>(SciCall(SCI_GETFOLDEXPANDED, line, 0));
 }
 
+inline Sci_Line SciCall_ContractedFoldNext(Sci_Line lineStart) noexcept {
+	return SciCall(SCI_CONTRACTEDFOLDNEXT, lineStart, 0);
+}
+
 inline void SciCall_FoldLine(Sci_Line line, int action) noexcept {
 	SciCall(SCI_FOLDLINE, line, action);
 }
@@ -1360,6 +1497,10 @@ inline void SciCall_FoldAll(int action) noexcept {
 	SciCall(SCI_FOLDALL, action, 0);
 }
 
+inline void SciCall_FoldAtLevel(int action, int level) noexcept {
+	SciCall(SCI_FOLDATLEVEL, action, level);
+}
+
 inline void SciCall_ToggleFoldShowText(Sci_Line line, const char *text) noexcept {
 	SciCall(SCI_TOGGLEFOLDSHOWTEXT, line, AsInteger<LPARAM>(text));
 }
@@ -303,8 +303,6 @@ int np2LexLangIndex = 0;
 static bool tabSeparatedValue; // for TSV file
 static int iCsvOption = ('\"' << 8) | ',';
 
-#define CsvOption_BackslashEscape	(1 << 15)
-#define CsvOption_MergeDelimiter	(1 << 16)
 #define LexerChanged_Override		2
 
 #define STYLESMODIFIED_NONE			0
@@ -360,6 +358,17 @@ static bool bAutoSelect;
 #define ALL_FILE_EXTENSIONS_BYTE_SIZE	((MATCH_LEXER_COUNT * MAX_EDITLEXER_EXT_SIZE) * sizeof(WCHAR))
 static LPWSTR g_AllFileExtensions = nullptr;
 
+// hash table for extensions in g_AllFileExtensions, rebuilt on first lookup after any extension changed.
+struct FileExtensionEntry {
+	PEDITLEXER pLex;
+	LPCWSTR ext;
+	UINT hash;
+	UINT length;
+};
+static FileExtensionEntry *fileExtensionMap = nullptr;
+static UINT fileExtensionMapMask = 0;
+static bool bFileExtensionMapValid = false;
+
 // Notepad4.cpp
 extern HWND hwndMain;
 extern DWORD dwLastIOError;
@@ -611,6 +620,9 @@ HFONT Style_CreateCodeFont(UINT dpi) noexcept {
 
 void Style_ReleaseResources() noexcept {
 	NP2HeapFree(g_AllFileExtensions);
+	if (fileExtensionMap != nullptr) {
+		NP2HeapFree(fileExtensionMap);
+	}
 	for (UINT iLexer = 0; iLexer < ALL_LEXER_COUNT; iLexer++) {
 		PEDITLEXER pLex = pLexArray[iLexer];
 		if (pLex->szStyleBuf) {
@@ -653,6 +665,21 @@ void Style_SaveTabSettings(LPCEDITLEXER pLex) noexcept {
 	IniSetBoolEx(lpSection, L"UseGlobalTabSettings", tabSettings.schemeUseGlobalTabSettings, LexerAttr_GetGlobalTabSettings(lexerAttr));
 }
 
+// styling speed differs a lot between lexers, remember the average measured by Scintilla
+// for each lexer, so idle styling is sized correctly from first paint.
+static void Style_StoreStylingDuration(PEDITLEXER pLex) noexcept {
+	const int duration = SciCall_GetStylingDuration();
+	if (duration != 0) {
+		pLex->iStylingDuration = duration;
+	}
+}
+
+static inline void Style_RestoreStylingDuration(LPCEDITLEXER pLex) noexcept {
+	constexpr int DefaultStylingDuration = 1000; // same as Document::durationStyleOneUnit
+	const int duration = pLex->iStylingDuration;
+	SciCall_SetStylingDuration((duration == 0) ? DefaultStylingDuration : duration);
+}
+
 static inline void SaveLexTabSettings(IniSectionBuilder &section, LPCEDITLEXER pLex) noexcept {
 	const UINT lexerAttr = pLex->lexerAttr;
 	section.SetIntEx(L"TabWidth", tabSettings.schemeTabWidth, pLex->defaultTabWidth);
@@ -664,7 +691,7 @@ static inline void SaveLexTabSettings(IniSectionBuilder &section, LPCEDITLEXER p
 static void Style_LoadOneEx(PEDITLEXER pLex, IniSectionParser &section, WCHAR *pIniSectionBuf, int cchIniSection) noexcept {
 	pLex->iStyleTheme = static_cast<uint8_t>(np2StyleTheme);
 	LPCWSTR themePath = GetStyleThemeFilePath();
-	GetPrivateProfileSection(pLex->pszName, pIniSectionBuf, cchIniSection, themePath);
+	IniLoadSectionEx(pLex->pszName, pIniSectionBuf, cchIniSection, themePath);
 
 	const UINT iStyleCount = pLex->iStyleCount;
 	LPWSTR szValue = pLex->szStyleBuf;
@@ -709,6 +736,7 @@ void Style_SetFavoriteSchemes() noexcept {
 						--iLexer;
 					} while (iLexer != index);
 					pLexArray[iLexer] = pLex;
+					bFileExtensionMapValid = false;
 				}
 				++index;
 				break;
@@ -802,6 +830,7 @@ void Style_Load() noexcept {
 	for (UINT iLexer = 0; iLexer < MATCH_LEXER_COUNT; iLexer++) {
 		PEDITLEXER pLex = pLexArray[iLexer + LEXER_INDEX_MATCH];
 		pLex->szExtensions = g_AllFileExtensions + (iLexer * MAX_EDITLEXER_EXT_SIZE);
+		bFileExtensionMapValid = false;
 		LPCWSTR value = section.GetValueImpl(pLex->pszName, pLex->iNameLen);
 		if (StrIsEmpty(value)) {
 			lstrcpy(pLex->szExtensions, pLex->pszDefExt);
@@ -810,6 +839,14 @@ void Style_Load() noexcept {
 		}
 	}
 
+	// styling duration
+	LoadIniSection(INI_SECTION_NAME_STYLING_DURATION, pIniSectionBuf, cchIniSection);
+	section.Parse(pIniSectionBuf);
+	for (UINT iLexer = LEXER_INDEX_MATCH; iLexer < ALL_LEXER_COUNT; iLexer++) {
+		PEDITLEXER pLex = pLexArray[iLexer];
+		pLex->iStylingDuration = max(section.GetIntImpl(pLex->pszName, pLex->iNameLen, 0), 0);
+	}
+
 	if (np2StyleTheme == StyleTheme_Dark && StrIsEmpty(darkStyleThemeFilePath)) {
 		FindDarkThemeFile(darkStyleThemeFilePath);
 	}
@@ -846,7 +883,7 @@ void Style_LoadAll(StyleLoadFlag loadFlag) noexcept {
 		LPCWSTR themePath = GetStyleThemeFilePath();
 		memcpy(customColor, defaultCustomColor, MAX_CUSTOM_COLOR_COUNT * sizeof(COLORREF));
 
-		GetPrivateProfileSection(INI_SECTION_NAME_CUSTOM_COLORS, pIniSectionBuf, cchIniSection, themePath);
+		IniLoadSectionEx(INI_SECTION_NAME_CUSTOM_COLORS, pIniSectionBuf, cchIniSection, themePath);
 		section.ParseArray(pIniSectionBuf, FALSE);
 
 		const UINT count = min<UINT>(section.count, MAX_CUSTOM_COLOR_COUNT);
@@ -863,7 +900,18 @@ void Style_LoadAll(StyleLoadFlag loadFlag) noexcept {
 		}
 	}
 
-	if (!FlagSet(loadFlag, StyleLoadFlag_CustomColor)) {
+	if (FlagSet(loadFlag, StyleLoadFlag_Lazy)) {
+		for (UINT iLexer = 0; iLexer < ALL_LEXER_COUNT; iLexer++) {
+			PEDITLEXER pLex = pLexArray[iLexer];
+			if (pLex == &lexGlobal || pLex == pLexCurrent) {
+				Style_LoadOneEx(pLex, section, pIniSectionBuf, cchIniSection);
+			} else if (pLex->szStyleBuf != nullptr) {
+				// same as reloading now: pending changes are replaced with content of the file
+				pLex->iStyleTheme = static_cast<uint8_t>(StyleTheme_Max + 1);
+				pLex->bStyleChanged = false;
+			}
+		}
+	} else if (!FlagSet(loadFlag, StyleLoadFlag_CustomColor)) {
 		for (UINT iLexer = 0; iLexer < ALL_LEXER_COUNT; iLexer++) {
 			PEDITLEXER pLex = pLexArray[iLexer];
 			if (FlagSet(loadFlag, StyleLoadFlag_Reload) || !IsStyleLoaded(pLex)) {
@@ -899,6 +947,18 @@ void Style_Save() noexcept {
 
 	SaveIniSection(INI_SECTION_NAME_STYLES, pIniSectionBuf);
 
+	// styling duration
+	Style_StoreStylingDuration(pLexCurrent);
+	memset(pIniSectionBuf, 0, 2*sizeof(WCHAR));
+	section.next = pIniSectionBuf;
+	for (UINT iLexer = LEXER_INDEX_MATCH; iLexer < ALL_LEXER_COUNT; iLexer++) {
+		const LPCEDITLEXER pLex = pLexArray[iLexer];
+		if (pLex->iStylingDuration != 0) {
+			section.SetInt(pLex->pszName, pLex->iStylingDuration);
+		}
+	}
+	SaveIniSection(INI_SECTION_NAME_STYLING_DURATION, StrIsEmpty(pIniSectionBuf) ? nullptr : pIniSectionBuf);
+
 	// file extensions
 	if (fStylesModified & STYLESMODIFIED_FILE_EXT) {
 		memset(pIniSectionBuf, 0, 2*sizeof(WCHAR));
@@ -941,7 +1001,7 @@ void Style_Save() noexcept {
 				section.SetString(tch, wch);
 			}
 		}
-		WritePrivateProfileSection(INI_SECTION_NAME_CUSTOM_COLORS, pIniSectionBuf, themePath);
+		IniSaveSectionEx(INI_SECTION_NAME_CUSTOM_COLORS, pIniSectionBuf, themePath);
 	}
 
 	if (fStylesModified & STYLESMODIFIED_STYLE_MASK) {
@@ -962,7 +1022,7 @@ void Style_Save() noexcept {
 				SaveLexTabSettings(section, pLex);
 			}
 			// delete this section if nothing changed
-			WritePrivateProfileSection(pLex->pszName, StrIsEmpty(pIniSectionBuf) ? nullptr : pIniSectionBuf, themePath);
+			IniSaveSectionEx(pLex->pszName, StrIsEmpty(pIniSectionBuf) ? nullptr : pIniSectionBuf, themePath);
 			pLex->bStyleChanged = false;
 		}
 	}
@@ -1011,6 +1071,7 @@ bool Style_Import(HWND hwnd) noexcept {
 					LPCWSTR value = section.GetValueImpl(pLex->pszName, pLex->iNameLen);
 					if (StrNotEmpty(value)) {
 						lstrcpyn(pLex->szExtensions, value, MAX_EDITLEXER_EXT_SIZE);
+						bFileExtensionMapValid = false;
 					}
 					if (section.count == 0) {
 						break;
@@ -1118,6 +1179,7 @@ static void Style_ResetAll(bool resetColor) noexcept {
 		PEDITLEXER pLex = pLexArray[iLexer];
 		if (pLex->szExtensions) {
 			lstrcpy(pLex->szExtensions, pLex->pszDefExt);
+			bFileExtensionMapValid = false;
 		}
 		pLex->bStyleChanged = true;
 		pLex->bUseDefaultCodeStyle = (pLex->rid == NP2LEX_TEXTFILE);
@@ -1417,6 +1479,119 @@ void Style_DefineIndicator(int index, int indicator, int indicatorStyle) noexcep
 	}
 }
 
+//=============================================================================
+// styles for 2nd Text File (log files)
+// Style_LogLineStyler()
+//
+// Lexer for 2nd Text File is SCLEX_NULL without style buffer, styles are only
+// computed from line text for lines been laid out, so huge log is still highlighted
+// without extra memory and with work proportional to visible lines.
+//
+namespace {
+
+struct LogLevelWord {
+	char word[12];
+	int style;
+};
+
+constexpr LogLevelWord logLevelWordList[] = {
+	{ "alert", LogStyle_Error },
+	{ "crit", LogStyle_Error },
+	{ "critical", LogStyle_Error },
+	{ "emerg", LogStyle_Error },
+	{ "err", LogStyle_Error },
+	{ "error", LogStyle_Error },
+	{ "exception", LogStyle_Error },
+	{ "fail", LogStyle_Error },
+	{ "failed", LogStyle_Error },
+	{ "fatal", LogStyle_Error },
+	{ "severe", LogStyle_Error },
+	{ "warn", LogStyle_Warning },
+	{ "warning", LogStyle_Warning },
+	{ "info", LogStyle_Information },
+	{ "information", LogStyle_Information },
+	{ "notice", LogStyle_Information },
+	{ "debug", LogStyle_Debug },
+	{ "trace", LogStyle_Debug },
+	{ "verbose", LogStyle_Debug },
+};
+
+int GetLogLevelStyle(const char *word, Sci_Position length) noexcept {
+	char lower[12];
+	if (length < 3 || length >= static_cast<Sci_Position>(sizeof(lower))) {
+		return LogStyle_Default;
+	}
+	for (Sci_Position i = 0; i < length; i++) {
+		lower[i] = static_cast<char>(UnsafeLower(word[i]));
+	}
+	lower[length] = '\0';
+	for (const auto &item : logLevelWordList) {
+		if (strcmp(lower, item.word) == 0) {
+			return item.style;
+		}
+	}
+	return LogStyle_Default;
+}
+
+}
+
+static void Style_LogLineStyler(const char *text, unsigned char *styles, Sci_Position length) noexcept {
+	Sci_Position pos = 0;
+	while (pos < length) {
+		const uint8_t ch = text[pos];
+		const Sci_Position start = pos;
+		int style = LogStyle_Default;
+		if (IsAlpha(ch) || ch == '_') {
+			do {
+				++pos;
+			} while (pos < length && (IsAlphaNumeric(text[pos]) || text[pos] == '_'));
+			style = GetLogLevelStyle(text + start, pos - start);
+		} else if (IsADigit(ch)) {
+			// date, time or IPv4 address: digits joined by separators
+			int dash = 0;
+			int colon = 0;
+			int dot = 0;
+			++pos;
+			while (pos < length) {
+				const uint8_t chNext = text[pos];
+				if (!IsADigit(chNext)) {
+					if (pos + 1 == length || !IsADigit(text[pos + 1])) {
+						break;
+					}
+					if (chNext == '-' || chNext == '/') {
+						++dash;
+					} else if (chNext == ':') {
+						++colon;
+					} else if (chNext == '.' || chNext == ',') {
+						++dot;
+					} else if (!(chNext == 'T' && dash == 2 && colon == 0)) {
+						break;
+					}
+				}
+				++pos;
+			}
+			if (colon != 0 && pos < length && text[pos] == 'Z') {
+				++pos; // UTC time
+			}
+			if (pos < length && IsAlphaNumeric(text[pos])) {
+				// identifier starts with digits, e.g. hash or 3rd
+				do {
+					++pos;
+				} while (pos < length && IsAlphaNumeric(text[pos]));
+			} else if (dot == 3 && dash == 0 && colon <= 1) {
+				style = LogStyle_Address;
+			} else if (colon != 0 || dash == 2) {
+				style = LogStyle_DateTime;
+			}
+		} else {
+			++pos;
+		}
+		if (style != LogStyle_Default) {
+			memset(styles + start, style, pos - start);
+		}
+	}
+}
+
 //=============================================================================
 // set current lexer
 // Style_SetLexer()
@@ -1448,7 +1623,10 @@ void Style_SetLexer(PEDITLEXER pLexNew, BOOL bLexerChanged) noexcept {
 		if (SciCall_GetLength() == 0 && SciCall_GetUndoActions() == 0) {
 			EditApplyDefaultEncoding(pLexNew, bLexerChanged & LexerChanged_Override);
 		}
+		Style_StoreStylingDuration(pLexCurrent);
+		Style_RestoreStylingDuration(pLexNew);
 		SciCall_SetLexer(pLexNew->iLexer);
+		SciCall_SetLineStyler((rid == NP2LEX_2NDTEXTFILE) ? Style_LogLineStyler : nullptr);
 
 		// Code folding
 		SciCall_SetProperty("fold", "1");
@@ -1527,6 +1705,11 @@ void Style_SetLexer(PEDITLEXER pLexNew, BOOL bLexerChanged) noexcept {
 			memcpy(lang, &dialect, sizeof(int));
 			SciCall_SetProperty("lexer.lang", lang);
 		}
+		if (rid == NP2LEX_CSV) {
+			EditCsvIndexStart(iCsvOption);
+		} else {
+			EditCsvIndexStop();
+		}
 
 		// Add keyword lists
 		// StopWatch watch;
@@ -1535,7 +1718,8 @@ void Style_SetLexer(PEDITLEXER pLexNew, BOOL bLexerChanged) noexcept {
 		for (int i = 0; i < KEYWORDSET_MAX; attr >>= 4, i++) {
 			const char *pKeywords = pLexNew->pKeyWords->pszKeyWords[i];
 			if (!(attr & KeywordAttr_NoLexer) && StrNotEmpty(pKeywords)) {
-				const int attribute = attr & (KeywordAttr_NoLexer - 1);
+				// keyword strings are static, lexer uses presorted list in place
+				const int attribute = (attr & (KeywordAttr_NoLexer - 1)) | KeywordAttr_Static;
 				SciCall_SetKeywords(i | (attribute << 8), pKeywords);
 			}
 		}
@@ -1869,6 +2053,7 @@ void Style_SetLexer(PEDITLEXER pLexNew, BOOL bLexerChanged) noexcept {
 	UpdateLineNumberWidth();
 	UpdateBookmarkMarginWidth();
 	UpdateFoldMarginWidth();
+	EditPrintInvalidatePages();
 }
 
 //=============================================================================
@@ -1998,9 +2183,140 @@ PEDITLEXER Style_SniffShebang(char *pchText) noexcept {
 	return nullptr;
 }
 
+#define CSV_SNIFF_MAX_RECORDS	32
+#define CSV_SNIFF_MAX_BYTES		(1024*1024)
+
+namespace {
+
+// delimiters in preferred order, used to break ties
+constexpr char csvDelimiters[] = ";|\t,";
+constexpr int csvDelimiterCount = CSTRLEN(csvDelimiters);
+
+struct CSVSniffer {
+	const char *recordStart;
+	const char * const end;
+	// second quote of escaped "" inside quoted field
+	const char *escapedQuote = nullptr;
+	bool quoted = false;
+	int records = 0;
+	uint32_t current[csvDelimiterCount]{};
+	uint32_t counts[CSV_SNIFF_MAX_RECORDS][csvDelimiterCount];
+
+	CSVSniffer(const char *ptr, const char *last) noexcept : recordStart{ptr}, end{last} {}
+	bool Full() const noexcept {
+		return records == CSV_SNIFF_MAX_RECORDS;
+	}
+	void EndRecord(const char *ptr) noexcept {
+		// skip blank line and the LF in CR+LF
+		if (ptr != recordStart && records < CSV_SNIFF_MAX_RECORDS) {
+			memcpy(counts[records], current, sizeof(current));
+			++records;
+		}
+		memset(current, 0, sizeof(current));
+		recordStart = ptr + 1;
+	}
+	// ptr points to one of: quote, CR, LF or delimiter
+	void Add(const char *ptr) noexcept {
+		const char ch = *ptr;
+		if (ch == '\"') {
+			if (quoted) {
+				if (ptr == escapedQuote) {
+					escapedQuote = nullptr;
+				} else if (ptr + 1 < end && ptr[1] == '\"') {
+					escapedQuote = ptr + 1;
+				} else {
+					quoted = false;
+				}
+			} else {
+				// like LexCSV, quote only starts a field at record start or after a delimiter
+				const char *prev = ptr;
+				while (prev != recordStart && prev[-1] == ' ') {
+					--prev;
+				}
+				quoted = prev == recordStart || memchr(csvDelimiters, prev[-1], csvDelimiterCount) != nullptr;
+			}
+		} else if (!quoted) {
+			switch (ch) {
+			case '\r':
+			case '\n':
+				EndRecord(ptr);
+				break;
+			case ';':
+				++current[0];
+				break;
+			case '|':
+				++current[1];
+				break;
+			case '\t':
+				++current[2];
+				break;
+			default:
+				++current[3];
+				break;
+			}
+		}
+	}
+	uint8_t Delimiter() const noexcept;
+};
+
+uint8_t CSVSniffer::Delimiter() const noexcept {
+	// prefer the delimiter whose per record count is the same on most records
+	int delimiter = -1;
+	int maxRecords = 0;
+	uint32_t maxColumn = 0;
+	for (int index = 0; index < csvDelimiterCount; index++) {
+		int consistent = 0;
+		uint32_t column = 0;
+		for (int row = 0; row < records; row++) {
+			const uint32_t count = counts[row][index];
+			if (count == 0 || count == column) {
+				continue;
+			}
+			int same = 0;
+			for (int other = 0; other < records; other++) {
+				same += counts[other][index] == count;
+			}
+			if (same > consistent || (same == consistent && count > column)) {
+				consistent = same;
+				column = count;
+			}
+		}
+		// at least 75% records agree
+		if (consistent != 0 && 4*consistent >= 3*records) {
+			if (consistent > maxRecords || (consistent == maxRecords && column > maxColumn)) {
+				maxRecords = consistent;
+				maxColumn = column;
+				delimiter = index;
+			}
+		}
+	}
+	if (delimiter < 0) {
+		// fallback to the most frequent delimiter
+		uint32_t maxTotal = 0;
+		for (int index = 0; index < csvDelimiterCount; index++) {
+			uint32_t total = 0;
+			for (int row = 0; row < records; row++) {
+				total += counts[row][index];
+			}
+			if (total > maxTotal) {
+				maxTotal = total;
+				delimiter = index;
+			}
+		}
+	}
+	return (delimiter < 0) ? '\0' : csvDelimiters[delimiter];
+}
+
+}
+
 void Style_SniffCSV() noexcept {
 	const Sci_Line lines = SciCall_GetLineCount();
-	const Sci_Position endPos = SciCall_PositionFromLine(min<Sci_Line>(lines, 2));
+	Sci_Position endPos = SciCall_PositionFromLine(min<Sci_Line>(lines, CSV_SNIFF_MAX_RECORDS));
+	// long quoted field: only look at leading text
+	const bool truncated = endPos > CSV_SNIFF_MAX_BYTES;
+	if (truncated) {
+		endPos = CSV_SNIFF_MAX_BYTES;
+	}
 	const char *ptr = SciCall_GetRangePointer(0, endPos);
 	if (ptr == nullptr) { // empty document
 		return;
@@ -2009,86 +2325,69 @@ void Style_SniffCSV() noexcept {
 	StopWatch watch;
 	watch.Start();
 #endif
-	int table[32*2]{};
-	int offset = 0;
 	const char * const end = ptr + endPos;
-#if defined(_WIN64)
-	uint64_t maskSet = 0;
-	while (ptr < end) {
-		const uint8_t ch = *ptr++;
-		constexpr uint64_t mask = (1 << '\r') | (1 << '\n') | (1 << '\t') | (UINT64_C(1) << ',') | (UINT64_C(1) << ';');
+	CSVSniffer sniffer{ptr, end};
+#if NP2_USE_AVX2
+	const __m256i vectQuote = _mm256_set1_epi8('\"');
+	const __m256i vectCR = _mm256_set1_epi8('\r');
+	const __m256i vectLF = _mm256_set1_epi8('\n');
+	const __m256i vectSemicolon = _mm256_set1_epi8(';');
+	const __m256i vectPipe = _mm256_set1_epi8('|');
+	const __m256i vectTab = _mm256_set1_epi8('\t');
+	const __m256i vectComma = _mm256_set1_epi8(',');
+	while (ptr + sizeof(__m256i) <= end && !sniffer.Full()) {
+		const __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(ptr));
+		__m256i result = _mm256_or_si256(_mm256_cmpeq_epi8(chunk, vectQuote), _mm256_cmpeq_epi8(chunk, vectCR));
+		result = _mm256_or_si256(result, _mm256_or_si256(_mm256_cmpeq_epi8(chunk, vectLF), _mm256_cmpeq_epi8(chunk, vectSemicolon)));
+		result = _mm256_or_si256(result, _mm256_or_si256(_mm256_cmpeq_epi8(chunk, vectPipe), _mm256_cmpeq_epi8(chunk, vectTab)));
+		result = _mm256_or_si256(result, _mm256_cmpeq_epi8(chunk, vectComma));
+		uint32_t mask = mm256_movemask_epi8(result);
+		while (mask != 0) {
+			const uint32_t trailing = np2_ctz(mask);
+			sniffer.Add(ptr + trailing);
+			mask &= mask - 1;
+		}
+		ptr += sizeof(__m256i);
+	}
+	// end NP2_USE_AVX2
+#elif NP2_USE_SSE2
+	const __m128i vectQuote = _mm_set1_epi8('\"');
+	const __m128i vectCR = _mm_set1_epi8('\r');
+	const __m128i vectLF = _mm_set1_epi8('\n');
+	const __m128i vectSemicolon = _mm_set1_epi8(';');
+	const __m128i vectPipe = _mm_set1_epi8('|');
+	const __m128i vectTab = _mm_set1_epi8('\t');
+	const __m128i vectComma = _mm_set1_epi8(',');
+	while (ptr + sizeof(__m128i) <= end && !sniffer.Full()) {
+		const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i *>(ptr));
+		__m128i result = _mm_or_si128(_mm_cmpeq_epi8(chunk, vectQuote), _mm_cmpeq_epi8(chunk, vectCR));
+		result = _mm_or_si128(result, _mm_or_si128(_mm_cmpeq_epi8(chunk, vectLF), _mm_cmpeq_epi8(chunk, vectSemicolon)));
+		result = _mm_or_si128(result, _mm_or_si128(_mm_cmpeq_epi8(chunk, vectPipe), _mm_cmpeq_epi8(chunk, vectTab)));
+		result = _mm_or_si128(result, _mm_cmpeq_epi8(chunk, vectComma));
+		uint32_t mask = mm_movemask_epi8(result);
+		while (mask != 0) {
+			const uint32_t trailing = np2_ctz(mask);
+			sniffer.Add(ptr + trailing);
+			mask &= mask - 1;
+		}
+		ptr += sizeof(__m128i);
+	}
+	// end NP2_USE_SSE2
+#endif
+	while (ptr < end && !sniffer.Full()) {
+		const uint8_t ch = *ptr;
+		constexpr uint64_t mask = (1 << '\t') | (1 << '\n') | (1 << '\r') | (UINT64_C(1) << '\"') | (UINT64_C(1) << ',') | (UINT64_C(1) << ';');
 		if (ch == '|' || (ch <= ';' && (mask & (UINT64_C(1) << ch)) != 0)) {
-			if (ch == '\r' || ch == '\n') {
-				offset = 32;
-				if (ch == '\r' && *ptr == '\n') {
-					++ptr;
-				}
-			} else {
-				const unsigned index = offset + (ch & 31);
-				maskSet |= UINT64_C(1) << index;
-				table[index] += 1;
-			}
+			sniffer.Add(ptr);
 		}
+		++ptr;
 	}
-	const uint32_t mask = (maskSet & UINT32_MAX) & (maskSet >> 32);
-#else
-	while (ptr < end) {
-		const uint8_t ch = *ptr++;
-		if (ch == ',' || ch == '\t' || ch == ';' || ch == '|') {
-			const unsigned index = offset + (ch & 31);
-			table[index] += 1;
-		} else if (ch == '\r' || ch == '\n') {
-			offset = 32;
-			if (ch == '\r' && *ptr == '\n') {
-				++ptr;
-			}
-		}
-	}
-	uint32_t mask = 0;
-	{
-		uint32_t value = ('\t') | ((',' & 31) << 8) | (('|' & 31) << 16) | ((';' & 31) << 24);
-		while (value) {
-			const int index = value & 0xff;
-			if (table[index] && table[32 + index]) {
-				mask |= 1U << index;
-			}
-			value >>= 8;
-		}
-	}
-#endif // _WIN64
-
-	constexpr uint32_t preferred = ';' | ('|' << 8) | ('\t' << 16) | (',' << 24);
-	uint8_t delimiter = '\0';
-	if (mask != 0) { // delimiter occurs in both row
-		uint32_t value = preferred;
-		int maxColumn = 0;
-		while (value != 0) {
-			const int index = value & 31;
-			if (mask & (1U << index)) {
-				const int first = table[index];
-				const int second = table[32 + index];
-				const int column = min(first, second);
-				if (column > maxColumn && column >= 4*abs(first - second)) { // 75%
-					maxColumn = column;
-					delimiter = value & 0xff;
-				}
-			}
-			value >>= 8;
-		}
-	}
-	if (delimiter == 0) {
-		uint32_t value = preferred;
-		int maxColumn = 0;
-		while (value != 0) {
-			const int index = value & 31;
-			const int column = table[index] + table[32 + index];
-			if (column > maxColumn) {
-				maxColumn = column;
-				delimiter = value & 0xff;
-			}
-			value >>= 8;
-		}
+	if (!truncated && !sniffer.quoted) {
+		// last line without line ending
+		sniffer.EndRecord(end);
 	}
+
+	const uint8_t delimiter = sniffer.Delimiter();
 #if 0
 	watch.Stop();
 	watch.ShowLog(__func__);
@@ -2531,6 +2830,96 @@ static void Style_UpdateLexerLang(LPCEDITLEXER pLex, LPCWSTR lpszExt, LPCWSTR lp
 // find lexer from file extension
 // Style_MatchLexer()
 //
+static constexpr bool IsFileExtensionDelimiter(WCHAR ch) noexcept {
+	return ch == L';' || ch <= L' ';
+}
+
+static bool HasFileExtensionDelimiter(LPCWSTR ext) noexcept {
+	while (*ext) {
+		if (IsFileExtensionDelimiter(*ext)) {
+			return true;
+		}
+		++ext;
+	}
+	return false;
+}
+
+// non-ASCII characters are skipped to match StrCmpNI() for any case folding.
+static UINT FileExtensionHash(LPCWSTR ext, UINT length) noexcept {
+	UINT hash = 0;
+	for (UINT i = 0; i < length; i++) {
+		UINT ch = ext[i];
+		if (ch < 0x80) {
+			hash = hash*31 + UnsafeLower(ch);
+		}
+	}
+	return hash;
+}
+
+// extensions are separated by semicolon or spaces, first lexer in pLexArray wins for duplicate extension.
+static void Style_BuildFileExtensionMap() noexcept {
+	UINT count = 0;
+	for (UINT iLexer = LEXER_INDEX_MATCH; iLexer < ALL_LEXER_COUNT; iLexer++) {
+		LPCWSTR p = pLexArray[iLexer]->szExtensions;
+		while (*p) {
+			if (!IsFileExtensionDelimiter(*p) && (p == pLexArray[iLexer]->szExtensions || IsFileExtensionDelimiter(p[-1]))) {
+				++count;
+			}
+			++p;
+		}
+	}
+
+	UINT capacity = 256;
+	while (capacity < count*2) {
+		capacity <<= 1;
+	}
+	if (fileExtensionMap != nullptr && capacity == fileExtensionMapMask + 1) {
+		memset(fileExtensionMap, 0, capacity*sizeof(FileExtensionEntry));
+	} else {
+		if (fileExtensionMap != nullptr) {
+			NP2HeapFree(fileExtensionMap);
+		}
+		fileExtensionMap = static_cast<FileExtensionEntry *>(NP2HeapAlloc(capacity*sizeof(FileExtensionEntry)));
+		if (fileExtensionMap == nullptr) {
+			return;
+		}
+		fileExtensionMapMask = capacity - 1;
+	}
+
+	for (UINT iLexer = LEXER_INDEX_MATCH; iLexer < ALL_LEXER_COUNT; iLexer++) {
+		PEDITLEXER pLex = pLexArray[iLexer];
+		LPCWSTR p = pLex->szExtensions;
+		while (*p) {
+			if (IsFileExtensionDelimiter(*p)) {
+				++p;
+				continue;
+			}
+			LPCWSTR ext = p;
+			while (*p && !IsFileExtensionDelimiter(*p)) {
+				++p;
+			}
+			const UINT length = static_cast<UINT>(p - ext);
+			const UINT hash = FileExtensionHash(ext, length);
+			UINT index = hash & fileExtensionMapMask;
+			while (true) {
+				FileExtensionEntry &entry = fileExtensionMap[index];
+				if (entry.pLex == nullptr) {
+					entry.pLex = pLex;
+					entry.ext = ext;
+					entry.hash = hash;
+					entry.length = length;
+					break;
+				}
+				if (entry.hash == hash && entry.length == length && StrCmpNI(entry.ext, ext, length) == 0) {
+					break;
+				}
+				index = (index + 1) & fileExtensionMapMask;
+			}
+		}
+	}
+	bFileExtensionMapValid = true;
+}
+
 PEDITLEXER Style_MatchLexer(LPCWSTR lpszMatch, bool bCheckNames) noexcept {
 	if (!bCheckNames) {
 		if (bAutoSelect && lpszMatch[1] == L'\0') {
@@ -2552,6 +2941,25 @@ PEDITLEXER Style_MatchLexer(LPCWSTR lpszMatch, bool bCheckNames) noexcept {
 		}
 
 		const int cch = lstrlen(lpszMatch);
+		const bool fastPath = cch != 0 && !HasFileExtensionDelimiter(lpszMatch);
+		if (fastPath && !bFileExtensionMapValid) {
+			Style_BuildFileExtensionMap();
+		}
+		if (fastPath && bFileExtensionMapValid) {
+			const UINT hash = FileExtensionHash(lpszMatch, cch);
+			UINT index = hash & fileExtensionMapMask;
+			while (true) {
+				const FileExtensionEntry &entry = fileExtensionMap[index];
+				if (entry.pLex == nullptr) {
+					return nullptr;
+				}
+				if (entry.hash == hash && entry.length == static_cast<UINT>(cch) && StrCmpNI(entry.ext, lpszMatch, cch) == 0) {
+					return entry.pLex;
+				}
+				index = (index + 1) & fileExtensionMapMask;
+			}
+		}
+
 		for (UINT iLexer = LEXER_INDEX_MATCH; iLexer < ALL_LEXER_COUNT; iLexer++) {
 			PEDITLEXER pLex = pLexArray[iLexer];
 			LPCWSTR p1 = pLex->szExtensions;
@@ -2939,6 +3347,13 @@ void Style_SetLexerByLangIndex(int lang) noexcept {
 	}
 }
 
+// identify lexer output of current scheme, dialect and options
+uint64_t Style_GetLexerSignature() noexcept {
+	const int rid = pLexCurrent->rid;
+	const int option = (rid == NP2LEX_CSV) ? iCsvOption : 0;
+	return (static_cast<uint64_t>(rid) << 48) ^ (static_cast<uint64_t>(np2LexLangIndex) << 24) ^ static_cast<uint32_t>(option);
+}
+
 void Style_UpdateSchemeMenu(HMENU hmenu) noexcept {
 	int lang = np2LexLangIndex;
 	if (lang == 0) {
@@ -4284,6 +4699,7 @@ static INT_PTR CALLBACK Style_ConfigDlgProc(HWND hwnd, UINT umsg, WPARAM wParam,
 					if (!GetDlgItemText(hwnd, IDC_STYLEEDIT, pCurrentLexer->szExtensions, MAX_EDITLEXER_EXT_SIZE)) {
 						lstrcpy(pCurrentLexer->szExtensions, pCurrentLexer->pszDefExt);
 					}
+					bFileExtensionMapValid = false;
 				}
 
 				fLexerSelected = false;
@@ -4577,6 +4993,7 @@ static INT_PTR CALLBACK Style_ConfigDlgProc(HWND hwnd, UINT umsg, WPARAM wParam,
 				//CheckDlgButton(hwnd, IDC_STYLEEOLFILLED, (Style_StrGetEOLFilled(pCurrentStyle->szValue) ? BST_CHECKED : BST_UNCHECKED));
 			} else if (fLexerSelected && pCurrentLexer && pCurrentLexer->szExtensions) {
 				lstrcpy(pCurrentLexer->szExtensions, pCurrentLexer->pszDefExt);
+				bFileExtensionMapValid = false;
 				SetDlgItemText(hwnd, IDC_STYLEEDIT, pCurrentLexer->szExtensions);
 			}
 			PostMessage(hwnd, WM_NEXTDLGCTL, AsInteger<WPARAM>(GetDlgItem(hwnd, IDC_STYLEEDIT)), TRUE);
@@ -4644,6 +5061,7 @@ static INT_PTR CALLBACK Style_ConfigDlgProc(HWND hwnd, UINT umsg, WPARAM wParam,
 				if (!GetDlgItemText(hwnd, IDC_STYLEEDIT, pCurrentLexer->szExtensions, MAX_EDITLEXER_EXT_SIZE)) {
 					lstrcpy(pCurrentLexer->szExtensions, pCurrentLexer->pszDefExt);
 				}
+				bFileExtensionMapValid = false;
 			}
 
 			switch (LOWORD(wParam)) {
@@ -4725,6 +5143,7 @@ void Style_ConfigDlg(HWND hwnd) noexcept {
 	if (IDCANCEL == ThemedDialogBoxParam(g_hInstance, MAKEINTRESOURCE(IDD_STYLECONFIG), GetParent(hwnd), Style_ConfigDlgProc, AsInteger<LPARAM>(&param))) {
 		// Restore Styles
 		memcpy(g_AllFileExtensions, param.extBackup, ALL_FILE_EXTENSIONS_BYTE_SIZE);
+		bFileExtensionMapValid = false;
 		memcpy(customColor, param.colorBackup, MAX_CUSTOM_COLOR_COUNT * sizeof(COLORREF));
 		for (UINT iLexer = 0; iLexer < ALL_LEXER_COUNT; iLexer++) {
 			PEDITLEXER pLex = pLexArray[iLexer];
@@ -4994,6 +5413,7 @@ static void Style_GetFavoriteSchemesFromTreeView(HWND hwndTV, HTREEITEM hFavorit
 	}
 
 	qsort(AsVoidPointer(pLexArray + LEXER_INDEX_GENERAL), GENERAL_LEXER_COUNT, sizeof(PEDITLEXER), CmpEditLexerByOrder);
+	bFileExtensionMapValid = false;
 }
 
 //=============================================================================
@@ -30,6 +30,7 @@
 #define INI_SECTION_NAME_STYLES				L"Styles"
 #define INI_SECTION_NAME_FILE_EXTENSIONS	L"File Extensions"
 #define INI_SECTION_NAME_CUSTOM_COLORS		L"Custom Colors"
+#define INI_SECTION_NAME_STYLING_DURATION	L"Styling Duration"
 
 #define MAX_INI_SECTION_SIZE_STYLES			(8 * 1024)
 
@@ -74,11 +75,17 @@ struct StyleDefinition {
 	char fontFace[LF_FACESIZE * kMaxMultiByteCount];
 };
 
+// CSV option: delimiter in low byte, quote character in next byte
+#define CsvOption_BackslashEscape	(1 << 15)
+#define CsvOption_MergeDelimiter	(1 << 16)
+
 enum StyleLoadFlag {
 	StyleLoadFlag_Default = 0,
 	StyleLoadFlag_Reload = 1,
 	StyleLoadFlag_CustomColor = 2,
 	StyleLoadFlag_Apply = 4,
+	// only reload global and current scheme, other schemes are reloaded on first use
+	StyleLoadFlag_Lazy = 8,
 };
 
 extern PEDITLEXER pLexCurrent;
@@ -112,6 +119,7 @@ int		Style_GetMatchLexerIndex(int rid) noexcept;
 int		Style_GetDocTypeLanguage() noexcept;
 LPCWSTR Style_GetCurrentLexerName(LPWSTR lpszName, int cchName) noexcept;
 void	Style_SetLexerByLangIndex(int lang) noexcept;
+uint64_t Style_GetLexerSignature() noexcept;
 void	Style_UpdateSchemeMenu(HMENU hmenu) noexcept;
 
 void	Style_SetDefaultFont(HWND hwnd, bool bCode) noexcept;
@@ -17,6 +17,11 @@
 // This is a hidden feature in Windows Notepad.
 #define NP2_ENABLE_DOT_LOG_FEATURE				0
 
+//! Enable encoding detection benchmark
+// When enabled, `Notepad4 /encoding-benchmark corpus` measures accuracy and throughput
+// of encoding detection over labelled corpus folder, then exit.
+#define NP2_ENABLE_ENCODING_BENCHMARK			0
+
 //! Enable localization with satellite resource DLLs.
 #define NP2_ENABLE_APP_LOCALIZATION_DLL			1
 //! Enable test localization dialog layout with default UI font for target locale.
@@ -27,4 +32,8 @@
 //! Enable localization for scheme/lexer style names.
 #define NP2_ENABLE_LOCALIZE_STYLE_NAME			1
 
+//! Enable TraceLogging (ETW) events for paint, wrap, styling, idle work, mark all and file I/O.
+// Events are only recorded while a trace session (e.g. wpr or tracelog) enables provider *Notepad4.
+#define NP2_ENABLE_TRACE_LOGGING				1
+
 // scintilla\include\LaTeXInput.h defined NP2_ENABLE_LATEX_LIKE_EMOJI_INPUT
@@ -287,8 +287,16 @@
 #define IDC_INFOBOXICON					101
 #define IDC_INFOBOXTEXT					102
 #define IDC_INFOBOXCHECK				103
-//#define IDD_ 127
-//#define IDD_ 128
+// Find All Results
+#define IDD_FINDALLRESULTS				127
+#define IDC_FINDALLRESULTS				100
+// Find in Files
+#define IDD_FINDINFILES					128
+#define IDC_FINDINFILES					100
+// Goto Symbol
+#define IDD_GOTOSYMBOL					129
+#define IDC_SYMBOL_FILTER				104
+#define IDC_SYMBOL_LIST					105
 // Sort Lines
 #define IDD_SORT						115
 #define IDC_SORT_NONE					100
@@ -302,6 +310,7 @@
 #define IDC_SORT_LOGICAL_NUMBER			108
 #define IDC_SORT_COLUMN					109
 #define IDC_SORT_GROUPBY_FILE_TYPE		110
+#define IDC_SORT_COUNT_DUP				111
 // Align Lines
 #define IDD_ALIGN						112
 #define IDC_ALIGN_LEFT					100
@@ -790,6 +799,16 @@
 #define CMD_OPEN_CONTAINING_FOLDER		40587
 #define CMD_CALCULATE_EXPR				40588
 #define CMD_EVALUATE_JS_EXPR			40589
+#define CMD_VIEWER_PREVPART				40590	// Alt+PageUp
+#define CMD_VIEWER_NEXTPART				40591	// Alt+PageDown
+#define CMD_DOCUMENT_STATISTICS			40592
+#define CMD_PERFORMANCE_OVERLAY			40593
+#define IDM_VIEW_AUTOCOMPLETION_FUZZYMATCH	40594
+#define IDM_FILE_COMPARE				40595
+#define IDM_FILE_COMPARE_NEXT			40596	// Alt+F7
+#define IDM_FILE_COMPARE_PREV			40597	// Shift+F7
+#define IDM_FILE_COMPARE_CLEAR			40598
+#define IDM_EDIT_GOTOSYMBOL				40599	// Alt+G
 
 #define IDT_FILE_NEW					40600
 #define IDT_FILE_OPEN					40601
@@ -930,6 +949,13 @@
 #define IDS_GOOGLE_SEARCH_URL			50044
 #define IDS_BING_SEARCH_URL				50045
 #define IDS_WIKI_SEARCH_URL				50046
+#define IDS_INVALID_UTF8_RELOAD			50047
+#define IDS_ASK_VIEW_BIG_FILE			50048
+#define IDS_VIEWER_MODE_OPENED			50049
+#define IDS_DOCUMENT_STATISTICS			50050
+#define IDS_ASK_RECOVER_JOURNAL			50051
+#define IDS_COMPARE_IDENTICAL			50052
+#define IDS_COMPARE_FAILED				50053
 
 #define IDS_EOLMODENAME_CRLF			62000
 #define IDS_EOLMODENAME_CR				62001
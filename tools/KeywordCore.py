@@ -169,7 +169,7 @@ def UpdateLexerEnumFile(path, lexerPath):
 	output.extend(dump_enum_flag(KeywordAttr, max_value=KeywordAttr.Special))
 	Regenerate(path, '//Lexer Enum', output)
 
-	output = dump_enum_flag(KeywordAttr, indent='\t', anonymous=False, max_value=KeywordAttr.NoLexer)
+	output = dump_enum_flag(KeywordAttr, indent='\t', anonymous=False, max_value=KeywordAttr.NoLexer, include=(KeywordAttr.Static,))
 	Regenerate(lexerPath, '//', output)
 
 def UpdateAutoCompletionCache(path):
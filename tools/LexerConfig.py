@@ -77,6 +77,7 @@ class KeywordAttr(IntFlag):
 	PreSorted = 2	# word list is presorted.
 	NoLexer = 4		# not used by lexer, listed for auto-completion.
 	NoAutoComp = 8	# don't add to default auto-completion list.
+	Static = 16		# keyword string outlives lexer, presorted list is referenced without copying.
 	Special = 256	# used by context based auto-completion.
 	PrefixSpace = 512	# prefix first item with extra space.
 
@@ -1238,14 +1239,14 @@ def get_enum_flag_expr(flag, merge=True, separator='_'):
 		return ' | '.join(result)
 	return result
 
-def dump_enum_flag(cls, indent='', anonymous=True, as_shift=False, max_value=None, separator='_'):
+def dump_enum_flag(cls, indent='', anonymous=True, as_shift=False, max_value=None, separator='_', include=()):
 	prefix = cls.__name__ + separator
 	values = cls.__members__.values()
 	name = '' if anonymous else cls.__name__ + ' '
 	output = [f'{indent}enum {name}{{']
 	for flag in values:
 		value = int(flag)
-		if not max_value or value < max_value:
+		if not max_value or value < max_value or flag in include:
 			if value and as_shift:
 				assert value.bit_count() == 1, flag
 				value = f'1 << {value.bit_length() - 1}'